@@ -0,0 +1,7 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "hardware/pio.h"
+extern const pio_program_t i2s_mclk_program, i2s_dout_program, i2s_din_program;
+void i2s_mclk_program_init(PIO, size_t, size_t, size_t);
+void i2s_dout_program_init(PIO, size_t, size_t, size_t, size_t, size_t);
+void i2s_din_program_init(PIO, size_t, size_t, size_t, size_t);
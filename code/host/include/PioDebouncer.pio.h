@@ -0,0 +1,8 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "hardware/pio.h"
+#define pio_debouncer_PIN_COUNT 2
+#define pio_debouncer_SAMPLE_CYCLES 4
+#define pio_debouncer_LOCKOUT_CYCLES 1024
+extern const pio_program_t pio_debouncer_program;
+void pio_debouncer_program_init(PIO, uint, uint, uint, float);
@@ -0,0 +1,8 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "hardware/pio.h"
+#define ws2812_T1 2
+#define ws2812_T2 5
+#define ws2812_T3 3
+extern const pio_program_t ws2812_program;
+void ws2812_program_init(PIO, uint, uint, uint, float, uint);
@@ -0,0 +1,19 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+void adc_init(void); void adc_gpio_init(uint); void adc_select_input(uint); uint16_t adc_read(void);
+void adc_set_round_robin(uint); void adc_fifo_setup(bool, bool, uint16_t, bool, bool); void adc_run(bool);
+void adc_set_clkdiv(float); void adc_irq_set_enabled(bool); uint16_t adc_fifo_get(void); bool adc_fifo_is_empty(void);
+uint8_t adc_fifo_get_level(void); void adc_fifo_drain(void); uint adc_get_selected_input(void); uint16_t adc_fifo_get_blocking(void);
+#define ADC_IRQ_FIFO 22
+#define DREQ_ADC 36
+typedef struct { io_rw_32 cs, result, fcs, fifo, div, intr, inte, intf, ints; } adc_hw_t;
+extern adc_hw_t *adc_hw;
+#define ADC_CS_START_ONCE_BITS 4
+#define ADC_CS_READY_BITS 0x100
+#ifdef __cplusplus
+}
+#endif
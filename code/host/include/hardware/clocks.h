@@ -0,0 +1,12 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+enum clock_index { clk_gpout0 = 0, clk_ref=4, clk_sys=5, clk_peri=6, clk_usb=7, clk_adc=8, clk_rtc=9 };
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t clock_get_hz(enum clock_index);
+uint32_t frequency_count_khz(uint);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef uint64_t divmod_result_t;
+#ifdef __cplusplus
+extern "C" {
+#endif
+int32_t hw_divider_quotient_s32(int32_t, int32_t); uint32_t hw_divider_u32_quotient(uint32_t, uint32_t);
+divmod_result_t hw_divider_divmod_s32(int32_t, int32_t); divmod_result_t hw_divider_divmod_u32(uint32_t, uint32_t);
+static inline int32_t to_quotient_s32(divmod_result_t r) { return (int32_t)(r); }
+static inline int32_t to_remainder_s32(divmod_result_t r) { return (int32_t)(r >> 32); }
+static inline uint32_t to_quotient_u32(divmod_result_t r) { return (uint32_t)(r); }
+static inline uint32_t to_remainder_u32(divmod_result_t r) { return (uint32_t)(r >> 32); }
+void hw_divider_divmod_s32_start(int32_t, int32_t); void hw_divider_divmod_u32_start(uint32_t, uint32_t);
+int32_t hw_divider_s32_quotient_inlined(int32_t, int32_t); uint32_t hw_divider_u32_quotient_inlined(uint32_t, uint32_t);
+int32_t hw_divider_s32_remainder_inlined(int32_t, int32_t); uint32_t hw_divider_u32_remainder_inlined(uint32_t, uint32_t);
+void hw_divider_save_state(void *); void hw_divider_restore_state(void *);
+#ifdef __cplusplus
+}
+#endif
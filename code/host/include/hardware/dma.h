@@ -0,0 +1,40 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+typedef struct { uint32_t ctrl; } dma_channel_config;
+typedef struct { io_rw_32 read_addr, write_addr, transfer_count, ctrl_trig, al1_ctrl, al1_read_addr, al1_write_addr, al1_transfer_count_trig, al2_ctrl, al2_transfer_count, al2_read_addr, al2_write_addr_trig, al3_ctrl, al3_write_addr, al3_transfer_count, al3_read_addr_trig; } dma_channel_hw_t;
+typedef struct { dma_channel_hw_t ch[12]; io_rw_32 intr, inte0, intf0, ints0, _r, inte1, intf1, ints1; io_rw_32 timer[4]; io_wo_32 multi_channel_trigger; io_rw_32 sniff_ctrl, sniff_data; io_ro_32 fifo_levels; io_wo_32 abort; } dma_hw_t;
+extern dma_hw_t *dma_hw;
+#define DREQ_FORCE 0x3f
+#define DMA_SNIFF_CTRL_CALC_VALUE_CRC32 0
+#ifdef __cplusplus
+extern "C" {
+#endif
+int dma_claim_unused_channel(bool); void dma_channel_unclaim(uint);
+dma_channel_config dma_channel_get_default_config(uint);
+void channel_config_set_transfer_data_size(dma_channel_config *, enum dma_channel_transfer_size);
+void channel_config_set_read_increment(dma_channel_config *, bool);
+void channel_config_set_write_increment(dma_channel_config *, bool);
+void channel_config_set_dreq(dma_channel_config *, uint);
+void channel_config_set_chain_to(dma_channel_config *, uint);
+void channel_config_set_irq_quiet(dma_channel_config *, bool);
+void channel_config_set_ring(dma_channel_config *, bool, uint);
+void channel_config_set_sniff_enable(dma_channel_config *, bool);
+void channel_config_set_bswap(dma_channel_config *, bool);
+void channel_config_set_high_priority(dma_channel_config *, bool);
+void dma_channel_configure(uint, const dma_channel_config *, volatile void *, const volatile void *, uint, bool);
+void dma_start_channel_mask(uint32_t); void dma_channel_start(uint);
+void dma_channel_set_irq0_enabled(uint, bool); void dma_channel_set_irq1_enabled(uint, bool);
+bool dma_channel_is_busy(uint); void dma_channel_wait_for_finish_blocking(uint); void dma_channel_abort(uint);
+void dma_channel_set_read_addr(uint, const volatile void *, bool); void dma_channel_set_write_addr(uint, volatile void *, bool);
+void dma_channel_set_trans_count(uint, uint32_t, bool);
+void dma_channel_transfer_from_buffer_now(uint, const volatile void *, uint32_t);
+void dma_channel_transfer_to_buffer_now(uint, volatile void *, uint32_t);
+void dma_sniffer_enable(uint, uint, bool); void dma_sniffer_disable(void); void dma_sniffer_set_data_accumulator(uint32_t);
+uint32_t dma_sniffer_get_data_accumulator(void); void dma_sniffer_set_byte_swap_enabled(bool); void dma_sniffer_set_output_reverse_enabled(bool); void dma_sniffer_set_output_invert_enabled(bool);
+bool dma_channel_get_irq0_status(uint); void dma_channel_acknowledge_irq0(uint);
+int dma_claim_unused_timer(bool); void dma_timer_set_fraction(uint, uint16_t, uint16_t); uint dma_get_timer_dreq(uint);
+#ifdef __cplusplus
+}
+#endif
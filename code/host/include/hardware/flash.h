@@ -0,0 +1,16 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+#define FLASH_BLOCK_SIZE (1u << 16)
+#define XIP_BASE 0x10000000
+#define PICO_FLASH_SIZE_BYTES (8 * 1024 * 1024)
+#ifdef __cplusplus
+extern "C" {
+#endif
+void flash_range_erase(uint32_t, size_t); void flash_range_program(uint32_t, const uint8_t *, size_t);
+void flash_get_unique_id(uint8_t *id_out);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+enum gpio_function { GPIO_FUNC_XIP=0, GPIO_FUNC_SPI, GPIO_FUNC_UART, GPIO_FUNC_I2C, GPIO_FUNC_PWM, GPIO_FUNC_SIO, GPIO_FUNC_PIO0, GPIO_FUNC_PIO1, GPIO_FUNC_GPCK, GPIO_FUNC_USB, GPIO_FUNC_NULL = 0x1f };
+enum gpio_irq_level { GPIO_IRQ_LEVEL_LOW = 1, GPIO_IRQ_LEVEL_HIGH = 2, GPIO_IRQ_EDGE_FALL = 4, GPIO_IRQ_EDGE_RISE = 8 };
+#define GPIO_OUT 1
+#define GPIO_IN 0
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+void gpio_init(uint);
+void gpio_set_dir(uint, bool);
+void gpio_put(uint, bool);
+bool gpio_get(uint);
+uint32_t gpio_get_all(void);
+void gpio_pull_up(uint);
+void gpio_pull_down(uint);
+void gpio_disable_pulls(uint);
+void gpio_set_function(uint, enum gpio_function);
+void gpio_set_irq_enabled_with_callback(uint, uint32_t, bool, gpio_irq_callback_t);
+void gpio_set_irq_enabled(uint, uint32_t, bool);
+void gpio_add_raw_irq_handler(uint, void (*)(void));
+void gpio_acknowledge_irq(uint, uint32_t);
+uint32_t gpio_get_irq_event_mask(uint);
+void gpio_set_input_enabled(uint, bool);
+void gpio_set_drive_strength(uint, int);
+void gpio_set_slew_rate(uint, int);
+void gpio_xor_mask(uint32_t);
+void gpio_set_mask(uint32_t);
+void gpio_clr_mask(uint32_t);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+void gpio_set_pulls(uint, bool, bool); void gpio_deinit(uint);
+enum gpio_drive_strength { GPIO_DRIVE_STRENGTH_2MA, GPIO_DRIVE_STRENGTH_4MA, GPIO_DRIVE_STRENGTH_8MA, GPIO_DRIVE_STRENGTH_12MA };
+static inline void hw_set_bits(io_rw_32 *a, uint32_t m) { *a = *a | m; }
+static inline void hw_clear_bits(io_rw_32 *a, uint32_t m) { *a = *a & ~m; }
+static inline void hw_write_masked(io_rw_32 *a, uint32_t v, uint32_t m) { *a = (*a & ~m) | (v & m); }
+#ifdef __cplusplus
+}
+#endif
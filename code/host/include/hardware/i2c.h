@@ -0,0 +1,25 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#include "hardware/timer.h"
+typedef struct i2c_inst i2c_inst_t;
+struct i2c_inst { int x; }; extern i2c_inst_t i2c0_inst, i2c1_inst;
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+#define PICO_ERROR_GENERIC -1
+#define PICO_ERROR_TIMEOUT -2
+#define I2C_IC_DATA_CMD_CMD_BITS 0x00000100u
+#define I2C_IC_DATA_CMD_STOP_BITS 0x00000200u
+#define I2C_IC_DATA_CMD_RESTART_BITS 0x00000400u
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint i2c_init(i2c_inst_t *, uint); int i2c_write_blocking(i2c_inst_t *, uint8_t, const uint8_t *, size_t, bool);
+int i2c_read_blocking(i2c_inst_t *, uint8_t, uint8_t *, size_t, bool);
+int i2c_write_timeout_us(i2c_inst_t *, uint8_t, const uint8_t *, size_t, bool, uint);
+int i2c_read_timeout_us(i2c_inst_t *, uint8_t, uint8_t *, size_t, bool, uint);
+int i2c_write_blocking_until(i2c_inst_t *, uint8_t, const uint8_t *, size_t, bool, absolute_time_t);
+int i2c_read_blocking_until(i2c_inst_t *, uint8_t, uint8_t *, size_t, bool, absolute_time_t);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct { io_rw_32 accum[2], base[3]; io_ro_32 pop[3]; io_ro_32 peek[3]; io_rw_32 ctrl[2]; io_rw_32 add_raw[2]; io_wo_32 base01; } interp_hw_t;
+extern interp_hw_t *interp0; extern interp_hw_t *interp1;
+typedef struct { uint32_t ctrl; } interp_config;
+#ifdef __cplusplus
+extern "C" {
+#endif
+interp_config interp_default_config(void); void interp_config_set_shift(interp_config *, uint); void interp_config_set_mask(interp_config *, uint, uint);
+void interp_config_set_add_raw(interp_config *, bool); void interp_config_set_signed(interp_config *, bool); void interp_config_set_blend(interp_config *, bool);
+void interp_config_set_cross_input(interp_config *, bool); void interp_config_set_cross_result(interp_config *, bool);
+void interp_set_config(interp_hw_t *, uint, interp_config *); void interp_claim_lane(interp_hw_t *, uint);
+void interp_save(interp_hw_t *, void *); void interp_restore(interp_hw_t *, void *);
+#ifdef __cplusplus
+}
+#endif
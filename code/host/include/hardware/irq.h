@@ -0,0 +1,27 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef void (*irq_handler_t)(void);
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+#define USBCTRL_IRQ 5
+#define IO_IRQ_BANK0 13
+#define PIO0_IRQ_0 7
+#define PIO1_IRQ_0 9
+#define TIMER_IRQ_0 0
+#define TIMER_IRQ_1 1
+#define TIMER_IRQ_2 2
+#define TIMER_IRQ_3 3
+#define PICO_HIGHEST_IRQ_PRIORITY 0
+#define PICO_DEFAULT_IRQ_PRIORITY 0x80
+#define PICO_LOWEST_IRQ_PRIORITY 0xc0
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+#ifdef __cplusplus
+extern "C" {
+#endif
+void irq_set_exclusive_handler(uint, irq_handler_t); void irq_set_enabled(uint, bool); void irq_set_priority(uint, uint8_t);
+void irq_add_shared_handler(uint, irq_handler_t, uint8_t); void irq_set_pending(uint); void irq_clear(uint);
+int user_irq_claim_unused(bool);
+#ifdef __cplusplus
+}
+#endif
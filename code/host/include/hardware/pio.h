@@ -0,0 +1,35 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#include "hardware/gpio.h"
+#include "hardware/timer.h"
+typedef struct { io_rw_32 ctrl, fstat, fdebug, flevel; io_wo_32 txf[4]; io_ro_32 rxf[4]; io_rw_32 irq; } pio_hw_t;
+typedef pio_hw_t *PIO;
+extern pio_hw_t pio0_hw_, pio1_hw_;
+#define pio0 (&pio0_hw_)
+#define pio1 (&pio1_hw_)
+typedef struct { uint32_t clkdiv, execctrl, shiftctrl, pinctrl; } pio_sm_config;
+struct pio_program { const uint16_t *instructions; uint8_t length; int8_t origin; };
+typedef struct pio_program pio_program_t;
+#ifdef __cplusplus
+extern "C" {
+#endif
+int pio_claim_unused_sm(PIO, bool); uint pio_add_program(PIO, const pio_program_t *);
+void pio_sm_set_clkdiv_int_frac(PIO, uint, uint16_t, uint8_t); void pio_sm_set_clkdiv(PIO, uint, float);
+void pio_enable_sm_mask_in_sync(PIO, uint32_t); void pio_sm_set_enabled(PIO, uint, bool);
+uint pio_get_dreq(PIO, uint, bool); void pio_sm_put_blocking(PIO, uint, uint32_t); void pio_sm_put(PIO, uint, uint32_t);
+bool pio_sm_is_tx_fifo_empty(PIO, uint); bool pio_sm_is_tx_fifo_full(PIO, uint); uint pio_sm_get_tx_fifo_level(PIO, uint);
+bool pio_sm_is_rx_fifo_empty(PIO, uint); uint32_t pio_sm_get(PIO, uint); uint32_t pio_sm_get_blocking(PIO, uint);
+void pio_gpio_init(PIO, uint); void pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool);
+void pio_sm_init(PIO, uint, uint, const pio_sm_config *); pio_sm_config pio_get_default_sm_config(void);
+void sm_config_set_sideset_pins(pio_sm_config *, uint); void sm_config_set_out_shift(pio_sm_config *, bool, bool, uint);
+void sm_config_set_in_shift(pio_sm_config *, bool, bool, uint); void sm_config_set_fifo_join(pio_sm_config *, int);
+void sm_config_set_clkdiv(pio_sm_config *, float); void sm_config_set_in_pins(pio_sm_config *, uint); void sm_config_set_jmp_pin(pio_sm_config *, uint);
+void pio_sm_clear_fifos(PIO, uint); void pio_sm_restart(PIO, uint); void pio_sm_exec(PIO, uint, uint);
+void pio_set_irq0_source_enabled(PIO, int, bool); void pio_interrupt_clear(PIO, uint); bool pio_interrupt_get(PIO, uint);
+void pio_clkdiv_restart_sm_mask(PIO, uint32_t);
+#define PIO_FIFO_JOIN_TX 1
+#define PIO_FIFO_JOIN_RX 2
+#ifdef __cplusplus
+}
+#endif
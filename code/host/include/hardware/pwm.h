@@ -0,0 +1,22 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct { uint32_t csr, div, top; } pwm_config;
+typedef struct { io_rw_32 csr, div, ctr, cc, top; } pwm_slice_hw_t;
+typedef struct { pwm_slice_hw_t slice[8]; io_rw_32 en, intr, inte, intf, ints; } pwm_hw_t;
+extern pwm_hw_t *pwm_hw;
+#define PWM_CHAN_A 0
+#define PWM_CHAN_B 1
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint pwm_gpio_to_slice_num(uint); uint pwm_gpio_to_channel(uint); pwm_config pwm_get_default_config(void);
+void pwm_config_set_clkdiv(pwm_config *, float); void pwm_config_set_wrap(pwm_config *, uint16_t);
+void pwm_init(uint, pwm_config *, bool); void pwm_set_gpio_level(uint, uint16_t); void pwm_set_wrap(uint, uint16_t);
+void pwm_set_chan_level(uint, uint, uint16_t); void pwm_set_enabled(uint, bool); void pwm_set_clkdiv(uint, float);
+void pwm_set_irq_enabled(uint, bool); void pwm_clear_irq(uint); uint32_t pwm_get_irq_status_mask(void);
+uint pwm_get_dreq(uint);
+#define PWM_IRQ_WRAP 4
+#ifdef __cplusplus
+}
+#endif
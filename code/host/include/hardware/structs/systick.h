@@ -0,0 +1,9 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct { io_rw_32 csr, rvr, cvr; io_ro_32 calib; } systick_hw_t;
+extern systick_hw_t *systick_hw;
+#define M0PLUS_SYST_CSR_ENABLE_BITS 0x1u
+#define M0PLUS_SYST_CSR_TICKINT_BITS 0x2u
+#define M0PLUS_SYST_CSR_CLKSOURCE_BITS 0x4u
+#define M0PLUS_SYST_CSR_COUNTFLAG_BITS 0x10000u
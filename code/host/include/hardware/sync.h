@@ -0,0 +1,28 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef volatile uint32_t spin_lock_t;
+#ifdef __cplusplus
+extern "C" {
+#endif
+static inline void __dmb(void) { __sync_synchronize(); }
+static inline void __dsb(void) { __sync_synchronize(); }
+static inline void __isb(void) { __sync_synchronize(); }
+static inline void __sev(void) {}
+static inline void __wfe(void) { kastle2_host_yield(); }
+static inline void __wfi(void) {}
+static inline void __nop(void) {}
+static inline void __mem_fence_acquire(void) { __sync_synchronize(); }
+static inline void __mem_fence_release(void) { __sync_synchronize(); }
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t);
+spin_lock_t *spin_lock_instance(uint);
+int spin_lock_claim_unused(bool);
+void spin_lock_claim(uint);
+uint32_t spin_lock_blocking(spin_lock_t *);
+void spin_unlock(spin_lock_t *, uint32_t);
+spin_lock_t *spin_lock_init(uint);
+uint get_core_num(void);
+#ifdef __cplusplus
+}
+#endif
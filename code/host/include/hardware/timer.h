@@ -0,0 +1,27 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct { io_rw_32 dbgpause; io_ro_32 timerawl; io_ro_32 timerawh; io_rw_32 alarm[4]; io_rw_32 armed; io_rw_32 inte; io_rw_32 intr; io_rw_32 ints; } timer_hw_t;
+extern timer_hw_t *timer_hw;
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t time_us_32(void);
+void sleep_ms(uint32_t); void sleep_us(uint64_t);
+absolute_time_t make_timeout_time_ms(uint32_t);
+uint64_t time_us_64(void);
+typedef bool (*repeating_timer_callback_t)(struct repeating_timer *);
+struct repeating_timer { int64_t delay_us; void *user_data; };
+typedef void (*hardware_alarm_callback_t)(uint alarm_num);
+bool add_repeating_timer_us(int64_t, repeating_timer_callback_t, void *, struct repeating_timer *);
+bool cancel_repeating_timer(struct repeating_timer *);
+void hardware_alarm_claim(uint);
+int hardware_alarm_claim_unused(bool);
+void hardware_alarm_set_callback(uint, hardware_alarm_callback_t);
+bool hardware_alarm_set_target(uint, absolute_time_t);
+void hardware_alarm_cancel(uint);
+void busy_wait_us_32(uint32_t);
+void busy_wait_us(uint64_t);
+#ifdef __cplusplus
+}
+#endif
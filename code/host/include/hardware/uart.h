@@ -0,0 +1,32 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct uart_inst uart_inst_t;
+struct uart_inst { int x; }; extern uart_inst_t uart0_inst, uart1_inst;
+typedef struct { io_rw_32 dr, rsr, _pad0[4], fr, _pad1, ilpr, ibrd, fbrd, lcr_h, cr, ifls, imsc; io_ro_32 ris, mis; io_wo_32 icr; io_rw_32 dmacr; } uart_hw_t;
+#define uart1 (&uart1_inst)
+#define uart0 (&uart0_inst)
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint uart_init(uart_inst_t *, uint);
+bool uart_is_readable(uart_inst_t *);
+bool uart_is_writable(uart_inst_t *);
+char uart_getc(uart_inst_t *);
+void uart_putc_raw(uart_inst_t *, char);
+void uart_write_blocking(uart_inst_t *, const uint8_t *, size_t);
+void uart_read_blocking(uart_inst_t *, uint8_t *, size_t);
+void uart_set_format(uart_inst_t *, uint, uint, int);
+void uart_set_hw_flow(uart_inst_t *, bool, bool);
+void uart_set_fifo_enabled(uart_inst_t *, bool);
+void uart_set_irq_enables(uart_inst_t *, bool, bool);
+uint uart_get_index(uart_inst_t *);
+int uart_get_dreq(uart_inst_t *, bool);
+uart_hw_t *uart_get_hw(uart_inst_t *);
+#define UART_PARITY_NONE 0
+#define UART_UARTMIS_RTMIS_BITS 0x40u
+#define UART0_IRQ 20
+#define UART1_IRQ 21
+#ifdef __cplusplus
+}
+#endif
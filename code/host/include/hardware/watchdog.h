@@ -0,0 +1,13 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+typedef struct { io_rw_32 ctrl, load, reason, scratch[8], tick; } watchdog_hw_t;
+extern watchdog_hw_t *watchdog_hw;
+#ifdef __cplusplus
+extern "C" {
+#endif
+void watchdog_enable(uint32_t, bool); void watchdog_update(void); bool watchdog_caused_reboot(void); bool watchdog_enable_caused_reboot(void);
+void watchdog_reboot(uint32_t, uint32_t, uint32_t);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,58 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Host build: included before every source file (see host/CMakeLists.txt)
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Address of the user data (USER_DATA_SECTION_BEGIN on the host), loaded from a file by the renderer.
+ */
+extern uintptr_t kastle2_host_user_data;
+
+/**
+ * @brief Address of the presets (PRESET_SECTION_BEGIN on the host), blank at start, written by the flash functions.
+ */
+extern uintptr_t kastle2_host_presets;
+
+/**
+ * @brief Lets the other core's thread run (busy waits would spin away the whole time slice).
+ */
+void kastle2_host_yield(void);
+
+// Profiler counter of the calling thread, counts down in 24 bits like SysTick (see Profiler)
+uint32_t kastle2_host_profiler_counter(void);
+
+// Unit of the profiler counter: "instructions" when the kernel provides the counter, "ns" of CPU time otherwise
+const char *kastle2_host_profiler_unit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#define bi_decl(x)
+#define bi_program_description(x) 0
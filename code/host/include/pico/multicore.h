@@ -0,0 +1,20 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+void multicore_reset_core1(void);
+void multicore_launch_core1(void (*)(void));
+bool multicore_fifo_wready(void);
+bool multicore_fifo_rvalid(void);
+void multicore_fifo_push_blocking(uint32_t);
+uint32_t multicore_fifo_pop_blocking(void);
+void multicore_fifo_drain(void);
+void multicore_lockout_victim_init(void);
+void multicore_lockout_start_blocking(void);
+void multicore_lockout_end_blocking(void);
+bool multicore_lockout_victim_is_initialized(uint);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#include <string.h>
+#include <stdio.h>
+#include "hardware/gpio.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+#include "hardware/uart.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+static inline void tight_loop_contents(void) { kastle2_host_yield(); }
+absolute_time_t get_absolute_time(void);
+static const absolute_time_t nil_time = 0; static const absolute_time_t at_the_end_of_time = ~0ull;
+static inline bool is_nil_time(absolute_time_t t) { return t == 0; }
+int64_t absolute_time_diff_us(absolute_time_t, absolute_time_t);
+
+absolute_time_t make_timeout_time_us(uint64_t);
+absolute_time_t delayed_by_us(absolute_time_t, uint64_t);
+absolute_time_t delayed_by_ms(absolute_time_t, uint32_t);
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t/1000); }
+bool set_sys_clock_khz(uint32_t, bool);
+void set_sys_clock_hz(uint32_t, bool);
+#define PICO_SDK_VERSION_MAJOR 2
+#define PICO_SDK_VERSION_STRING "2.1.0"
+#define __not_in_flash_func(x) x
+#define __time_critical_func(x) x
+#define __no_inline_not_in_flash_func(x) x
+#define count_of(a) (sizeof(a)/sizeof((a)[0]))
+#define panic(...) __builtin_trap()
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,10 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+typedef uint64_t absolute_time_t;
+typedef unsigned int uint;
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
@@ -0,0 +1,13 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#define PICO_UNIQUE_BOARD_ID_SIZE_BYTES 8
+typedef struct { uint8_t id[PICO_UNIQUE_BOARD_ID_SIZE_BYTES]; } pico_unique_board_id_t;
+#ifdef __cplusplus
+extern "C" {
+#endif
+void pico_get_unique_board_id(pico_unique_board_id_t *);
+void pico_get_unique_board_id_string(char *, uint);
+#ifdef __cplusplus
+}
+#endif
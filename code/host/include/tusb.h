@@ -0,0 +1,17 @@
+#pragma once
+// Host stand-in for the pico-sdk header, declares just what Kastle 2 uses (implemented in host/src/HostPlatform.cpp)
+#include "pico/types.h"
+#include <string.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+bool tusb_init(void); void tud_task(void); bool tud_mounted(void); bool tud_ready(void);
+uint32_t tud_midi_available(void); uint32_t tud_midi_stream_read(void *, uint32_t); uint32_t tud_midi_stream_write(uint8_t, const uint8_t *, uint32_t);
+bool tud_midi_packet_read(uint8_t[4]); bool tud_midi_packet_write(const uint8_t[4]); uint32_t tud_midi_n_available(uint8_t, uint8_t);
+bool tud_cdc_connected(void); uint32_t tud_cdc_available(void); uint32_t tud_cdc_read(void *, uint32_t); uint32_t tud_cdc_write(const void *, uint32_t);
+uint32_t tud_cdc_write_flush(void); uint32_t tud_cdc_write_available(void); uint32_t tud_cdc_write_str(const char *); int32_t tud_cdc_read_char(void);
+void tud_cdc_read_flush(void); bool tud_cdc_peek(uint8_t *);
+void tud_cdc_n_read_flush(uint8_t); uint32_t tud_cdc_n_write(uint8_t, const void*, uint32_t); uint32_t tud_cdc_n_write_flush(uint8_t); uint32_t tud_cdc_n_available(uint8_t); uint32_t tud_cdc_n_read(uint8_t, void*, uint32_t); bool tud_cdc_n_connected(uint8_t); uint32_t tud_cdc_n_write_available(uint8_t);
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1093 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Host stand-ins for the pico-sdk functions used by Kastle 2 (see HostPlatform.hpp)
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <ctime>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/unique_id.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/i2c.h"
+#include "hardware/interp.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/pwm.h"
+#include "hardware/structs/systick.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "hardware/uart.h"
+#include "hardware/watchdog.h"
+#include "tusb.h"
+#include "I2S.pio.h"
+#include "PioDebouncer.pio.h"
+#include "WS2812.pio.h"
+
+#include "config.hpp"
+#include "HostPlatform.hpp"
+
+using namespace kastle2;
+
+namespace
+{
+
+constexpr size_t kGpioCount = 30;
+constexpr size_t kIrqCount = 32;
+constexpr size_t kFifoDepth = 8;      ///< Same as the RP2040 SIO FIFO
+constexpr uint8_t kCodecAddress = 0x1A;
+constexpr uint8_t kEepromAddress = 0x50;
+constexpr uint16_t kCodecDeviceId = 0x01A;
+constexpr uint8_t kCodecDeviceIdRegister = 0x3F;
+
+std::atomic<uint64_t> now_us{0};
+uint64_t time_limit_us = 0;
+
+// Timer alarms fire from AdvanceTime() once the virtual time passes their target
+constexpr size_t kAlarmCount = 4;
+struct Alarm
+{
+    hardware_alarm_callback_t callback = nullptr;
+    uint64_t target = 0;
+    bool armed = false;
+    bool claimed = false;
+};
+std::mutex alarm_mutex;
+std::array<Alarm, kAlarmCount> alarms;
+
+constexpr size_t kSpinLockCount = 32;
+std::array<spin_lock_t, kSpinLockCount> spin_locks{};
+uint spin_locks_claimed = 0;
+
+struct Gpio
+{
+    bool output = false;
+    bool value = false;
+    bool pull_up = false;
+    bool pull_down = false;
+    bool overridden = false;
+    bool input_level = false;
+    uint32_t irq_events = 0; ///< Enabled GPIO_IRQ_EDGE_* events
+};
+std::array<Gpio, kGpioCount> gpios;
+gpio_irq_callback_t gpio_irq_callback = nullptr;
+
+std::array<irq_handler_t, kIrqCount> irq_handlers{};
+uint adc_input = 0;
+host::AdcReader adc_reader = nullptr;
+host::TaskHook task_hook = nullptr;
+std::deque<uint8_t> uart_input; ///< MIDI bytes for the UART0 interrupt, see host::ReceiveUart()
+I2S::AudioCallback audio_callback = nullptr;
+
+// Inter-core FIFOs, [n] is read by core n
+std::mutex fifo_mutex;
+std::condition_variable fifo_cv;
+std::array<std::deque<uint32_t>, 2> fifos;
+thread_local uint core_num = 0;
+
+// Emulated I2C devices
+uint8_t codec_register = 0;
+uint8_t eeprom_pointer = 0;
+std::array<uint8_t, 256> eeprom = []()
+{
+    std::array<uint8_t, 256> blank;
+    blank.fill(0xFF); // Erased EEPROM
+    return blank;
+}();
+
+// User data section when no file is loaded (no valid magic)
+std::array<uint8_t, 16> empty_user_data{};
+
+// Preset section, not kept between the runs
+std::array<uint8_t, PRESET_SECTION_SIZE> presets = []
+{
+    std::array<uint8_t, PRESET_SECTION_SIZE> blank;
+    blank.fill(0xFF); // Erased flash
+    return blank;
+}();
+
+// Host memory of a flash offset if it's in the preset section (the offsets are made of XIP_BASE and the host address)
+uint8_t *preset_flash(const uint32_t offset, const size_t size)
+{
+    const uintptr_t address = static_cast<uintptr_t>(static_cast<uint32_t>(XIP_BASE + offset));
+    const uintptr_t begin = static_cast<uintptr_t>(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(presets.data())));
+    if (address < begin || address + size > begin + presets.size())
+    {
+        return nullptr;
+    }
+    return presets.data() + (address - begin);
+}
+
+// Peripheral registers, written by the code but not emulated
+systick_hw_t systick_regs{};
+timer_hw_t timer_regs{};
+dma_hw_t dma_regs{};
+pwm_hw_t pwm_regs{};
+adc_hw_t adc_regs{};
+watchdog_hw_t watchdog_regs{};
+interp_hw_t interp_regs[2]{};
+uart_hw_t uart_regs{}; // No interrupt status, the received bytes read as arrived at the interrupt
+
+uint dma_channels_claimed = 0;
+
+// Profiler counter of each thread, -1 when the instruction counter is not available
+thread_local int profiler_fd = -2;
+std::atomic<bool> profiler_instructions{true};
+
+int OpenInstructionCounter()
+{
+    perf_event_attr attr{};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0)
+    {
+        profiler_instructions = false;
+    }
+    return fd;
+}
+
+}
+
+systick_hw_t *systick_hw = &systick_regs;
+timer_hw_t *timer_hw = &timer_regs;
+dma_hw_t *dma_hw = &dma_regs;
+pwm_hw_t *pwm_hw = &pwm_regs;
+adc_hw_t *adc_hw = &adc_regs;
+watchdog_hw_t *watchdog_hw = &watchdog_regs;
+interp_hw_t *interp0 = &interp_regs[0];
+interp_hw_t *interp1 = &interp_regs[1];
+pio_hw_t pio0_hw_{}, pio1_hw_{};
+i2c_inst_t i2c0_inst, i2c1_inst;
+uart_inst_t uart0_inst, uart1_inst;
+
+// Generated by pioasm in the firmware build
+const pio_program_t ws2812_program = {nullptr, 0, -1};
+const pio_program_t i2s_mclk_program = {nullptr, 0, -1};
+const pio_program_t i2s_dout_program = {nullptr, 0, -1};
+const pio_program_t i2s_din_program = {nullptr, 0, -1};
+const pio_program_t pio_debouncer_program = {nullptr, 0, -1};
+
+void ws2812_program_init(PIO, uint, uint, uint, float, uint)
+{
+}
+
+void pio_debouncer_program_init(PIO, uint, uint, uint, float)
+{
+}
+
+extern "C"
+{
+
+uintptr_t kastle2_host_user_data = reinterpret_cast<uintptr_t>(empty_user_data.data());
+uintptr_t kastle2_host_presets = reinterpret_cast<uintptr_t>(presets.data());
+
+// Time
+
+absolute_time_t get_absolute_time(void)
+{
+    return now_us;
+}
+
+uint32_t time_us_32(void)
+{
+    return static_cast<uint32_t>(now_us);
+}
+
+uint64_t time_us_64(void)
+{
+    return now_us;
+}
+
+void sleep_ms(uint32_t ms)
+{
+    host::AdvanceTime(static_cast<uint64_t>(ms) * 1000);
+}
+
+void sleep_us(uint64_t us)
+{
+    host::AdvanceTime(us);
+}
+
+void busy_wait_us_32(uint32_t us)
+{
+    host::AdvanceTime(us);
+}
+
+void busy_wait_us(uint64_t us)
+{
+    host::AdvanceTime(us);
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+    return static_cast<int64_t>(to - from);
+}
+
+absolute_time_t make_timeout_time_us(uint64_t us)
+{
+    return now_us + us;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms)
+{
+    return now_us + static_cast<uint64_t>(ms) * 1000;
+}
+
+absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us)
+{
+    return t + us;
+}
+
+absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms)
+{
+    return t + static_cast<uint64_t>(ms) * 1000;
+}
+
+void hardware_alarm_claim(uint alarm_num)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    alarms.at(alarm_num).claimed = true;
+}
+
+int hardware_alarm_claim_unused(bool required)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    for (uint alarm_num = 0; alarm_num < kAlarmCount; alarm_num++)
+    {
+        if (!alarms[alarm_num].claimed)
+        {
+            alarms[alarm_num].claimed = true;
+            return static_cast<int>(alarm_num);
+        }
+    }
+    if (required)
+    {
+        std::fprintf(stderr, "No unused timer alarm\n");
+        std::abort();
+    }
+    return -1;
+}
+
+void hardware_alarm_set_callback(uint alarm_num, hardware_alarm_callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    alarms.at(alarm_num).callback = callback;
+}
+
+bool hardware_alarm_set_target(uint alarm_num, absolute_time_t target)
+{
+    if (target <= now_us)
+    {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    alarms.at(alarm_num).target = target;
+    alarms.at(alarm_num).armed = true;
+    return false;
+}
+
+void hardware_alarm_cancel(uint alarm_num)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    alarms.at(alarm_num).armed = false;
+}
+
+// Clocks
+
+bool set_sys_clock_khz(uint32_t, bool)
+{
+    return true;
+}
+
+void set_sys_clock_hz(uint32_t, bool)
+{
+}
+
+uint32_t clock_get_hz(enum clock_index)
+{
+    return SYSTEM_CLOCK_KHZ * 1000;
+}
+
+// GPIO
+
+void gpio_init(uint pin)
+{
+    gpios.at(pin).output = false;
+    gpios.at(pin).value = false;
+}
+
+void gpio_deinit(uint pin)
+{
+    gpio_init(pin);
+}
+
+void gpio_set_dir(uint pin, bool out)
+{
+    gpios.at(pin).output = out;
+}
+
+void gpio_put(uint pin, bool value)
+{
+    gpios.at(pin).value = value;
+}
+
+bool gpio_get(uint pin)
+{
+    return host::GetGpio(pin);
+}
+
+uint32_t gpio_get_all(void)
+{
+    uint32_t levels = 0;
+    for (uint32_t pin = 0; pin < kGpioCount; pin++)
+    {
+        levels |= host::GetGpio(pin) ? 1u << pin : 0;
+    }
+    return levels;
+}
+
+void gpio_set_pulls(uint pin, bool up, bool down)
+{
+    gpios.at(pin).pull_up = up;
+    gpios.at(pin).pull_down = down;
+}
+
+void gpio_pull_up(uint pin)
+{
+    gpio_set_pulls(pin, true, false);
+}
+
+void gpio_pull_down(uint pin)
+{
+    gpio_set_pulls(pin, false, true);
+}
+
+void gpio_disable_pulls(uint pin)
+{
+    gpio_set_pulls(pin, false, false);
+}
+
+void gpio_set_function(uint, enum gpio_function)
+{
+}
+
+void gpio_set_drive_strength(uint, int)
+{
+}
+
+void gpio_set_irq_enabled(uint pin, uint32_t events, bool enabled)
+{
+    Gpio &gpio = gpios.at(pin);
+    gpio.irq_events = enabled ? gpio.irq_events | events : gpio.irq_events & ~events;
+}
+
+void gpio_set_irq_enabled_with_callback(uint pin, uint32_t events, bool enabled, gpio_irq_callback_t callback)
+{
+    gpio_irq_callback = callback;
+    gpio_set_irq_enabled(pin, events, enabled);
+}
+
+// Interrupts
+
+void irq_set_exclusive_handler(uint irq, irq_handler_t handler)
+{
+    irq_handlers.at(irq) = handler;
+}
+
+void irq_set_enabled(uint, bool)
+{
+}
+
+void irq_set_priority(uint, uint8_t)
+{
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    return 0;
+}
+
+void restore_interrupts(uint32_t)
+{
+}
+
+void kastle2_host_yield(void)
+{
+    std::this_thread::yield();
+}
+
+uint32_t kastle2_host_profiler_counter(void)
+{
+    if (profiler_fd == -2)
+    {
+        profiler_fd = OpenInstructionCounter();
+    }
+    uint64_t count = 0;
+    if (profiler_fd < 0 || read(profiler_fd, &count, sizeof(count)) != sizeof(count))
+    {
+        timespec time;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+        count = static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+    }
+    return static_cast<uint32_t>(~count) & 0x00FFFFFF;
+}
+
+const char *kastle2_host_profiler_unit(void)
+{
+    if (profiler_fd == -2)
+    {
+        profiler_fd = OpenInstructionCounter();
+    }
+    return profiler_instructions ? "instructions" : "ns";
+}
+
+spin_lock_t *spin_lock_instance(uint lock_num)
+{
+    return &spin_locks.at(lock_num);
+}
+
+int spin_lock_claim_unused(bool)
+{
+    return static_cast<int>(spin_locks_claimed++ % kSpinLockCount);
+}
+
+void spin_lock_claim(uint)
+{
+}
+
+uint32_t spin_lock_blocking(spin_lock_t *lock)
+{
+    while (__atomic_exchange_n(lock, 1u, __ATOMIC_ACQUIRE) != 0)
+    {
+    }
+    return 0;
+}
+
+void spin_unlock(spin_lock_t *lock, uint32_t)
+{
+    __atomic_store_n(lock, 0u, __ATOMIC_RELEASE);
+}
+
+spin_lock_t *spin_lock_init(uint lock_num)
+{
+    spin_unlock(spin_lock_instance(lock_num), 0);
+    return spin_lock_instance(lock_num);
+}
+
+uint get_core_num(void)
+{
+    return core_num;
+}
+
+// ADC
+
+void adc_init(void)
+{
+}
+
+void adc_gpio_init(uint)
+{
+}
+
+void adc_select_input(uint input)
+{
+    adc_input = input;
+}
+
+uint adc_get_selected_input(void)
+{
+    return adc_input;
+}
+
+void adc_fifo_setup(bool, bool, uint16_t, bool, bool)
+{
+}
+
+void adc_irq_set_enabled(bool)
+{
+}
+
+uint16_t adc_fifo_get(void)
+{
+    return adc_reader != nullptr ? adc_reader(adc_input) : 0;
+}
+
+// PWM
+
+void pwm_set_chan_level(uint, uint, uint16_t)
+{
+}
+
+void pwm_set_wrap(uint, uint16_t)
+{
+}
+
+void pwm_set_enabled(uint, bool)
+{
+}
+
+void pwm_set_clkdiv(uint, float)
+{
+}
+
+uint pwm_gpio_to_slice_num(uint pin)
+{
+    return (pin >> 1) & 7;
+}
+
+uint pwm_gpio_to_channel(uint pin)
+{
+    return pin & 1;
+}
+
+// PIO (the audio and LEDs drivers have host versions or just write into the void)
+
+int pio_claim_unused_sm(PIO, bool)
+{
+    return 0;
+}
+
+uint pio_add_program(PIO, const pio_program_t *)
+{
+    return 0;
+}
+
+void pio_gpio_init(PIO, uint)
+{
+}
+
+void pio_sm_set_consecutive_pindirs(PIO, uint, uint, uint, bool)
+{
+}
+
+void pio_sm_init(PIO, uint, uint, const pio_sm_config *)
+{
+}
+
+void pio_sm_set_enabled(PIO, uint, bool)
+{
+}
+
+void pio_sm_put_blocking(PIO, uint, uint32_t)
+{
+}
+
+void pio_sm_set_clkdiv(PIO, uint, float)
+{
+}
+
+uint pio_get_dreq(PIO, uint, bool)
+{
+    return 0;
+}
+
+// DMA
+
+int dma_claim_unused_channel(bool)
+{
+    return static_cast<int>(dma_channels_claimed++ % 12);
+}
+
+dma_channel_config dma_channel_get_default_config(uint)
+{
+    return {0};
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *, enum dma_channel_transfer_size)
+{
+}
+
+void channel_config_set_read_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_write_increment(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_dreq(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_chain_to(dma_channel_config *, uint)
+{
+}
+
+void channel_config_set_irq_quiet(dma_channel_config *, bool)
+{
+}
+
+void channel_config_set_ring(dma_channel_config *, bool, uint)
+{
+}
+
+// Nothing is transferred, the write address stays where the transfer would start
+void dma_channel_configure(uint channel, const dma_channel_config *, volatile void *write_addr, const volatile void *, uint, bool)
+{
+    dma_hw->ch[channel].write_addr = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(write_addr));
+}
+
+// Transfers complete immediately, nothing reads the LED frames
+bool dma_channel_is_busy(uint)
+{
+    return false;
+}
+
+void dma_channel_transfer_from_buffer_now(uint, const volatile void *, uint32_t)
+{
+}
+
+void dma_channel_abort(uint)
+{
+}
+
+int dma_claim_unused_timer(bool)
+{
+    return 0;
+}
+
+void dma_timer_set_fraction(uint, uint16_t, uint16_t)
+{
+}
+
+uint dma_get_timer_dreq(uint timer)
+{
+    return 0x3b + timer;
+}
+
+// I2C with the codec and the EEPROM attached
+
+int i2c_write_blocking_until(i2c_inst_t *, uint8_t address, const uint8_t *src, size_t len, bool, absolute_time_t)
+{
+    if (len == 0)
+    {
+        return 0;
+    }
+    switch (address)
+    {
+    case kCodecAddress:
+        // 7-bit register address followed by the 9th bit of the value
+        codec_register = src[0] >> 1;
+        return static_cast<int>(len);
+    case kEepromAddress:
+        eeprom_pointer = src[0];
+        for (size_t i = 1; i < len; i++)
+        {
+            eeprom[eeprom_pointer++] = src[i];
+        }
+        return static_cast<int>(len);
+    }
+    return PICO_ERROR_GENERIC;
+}
+
+int i2c_read_blocking_until(i2c_inst_t *, uint8_t address, uint8_t *dst, size_t len, bool, absolute_time_t)
+{
+    switch (address)
+    {
+    case kCodecAddress:
+    {
+        const uint16_t value = codec_register == kCodecDeviceIdRegister ? kCodecDeviceId : 0;
+        for (size_t i = 0; i < len; i++)
+        {
+            dst[i] = i == 0 ? value >> 8 : value & 0xFF;
+        }
+        return static_cast<int>(len);
+    }
+    case kEepromAddress:
+        for (size_t i = 0; i < len; i++)
+        {
+            dst[i] = eeprom[eeprom_pointer++];
+        }
+        return static_cast<int>(len);
+    }
+    return PICO_ERROR_GENERIC;
+}
+
+uint i2c_init(i2c_inst_t *, uint baudrate)
+{
+    return baudrate;
+}
+
+// UART (MIDI input from host::ReceiveUart, silent in the renders)
+
+uint uart_init(uart_inst_t *, uint baudrate)
+{
+    return baudrate;
+}
+
+void uart_set_fifo_enabled(uart_inst_t *, bool)
+{
+}
+
+void uart_set_irq_enables(uart_inst_t *, bool, bool)
+{
+}
+
+uart_hw_t *uart_get_hw(uart_inst_t *)
+{
+    return &uart_regs;
+}
+
+bool uart_is_readable(uart_inst_t *uart)
+{
+    return uart == uart0 && !uart_input.empty();
+}
+
+char uart_getc(uart_inst_t *uart)
+{
+    if (!uart_is_readable(uart))
+    {
+        return 0;
+    }
+    const uint8_t byte = uart_input.front();
+    uart_input.pop_front();
+    return static_cast<char>(byte);
+}
+
+// Multicore (the second core is a thread)
+
+void multicore_reset_core1(void)
+{
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    std::thread(
+        [entry]()
+        {
+            core_num = 1;
+            entry();
+        })
+        .detach();
+}
+
+bool multicore_fifo_wready(void)
+{
+    std::lock_guard<std::mutex> lock(fifo_mutex);
+    return fifos[core_num ^ 1].size() < kFifoDepth;
+}
+
+bool multicore_fifo_rvalid(void)
+{
+    std::lock_guard<std::mutex> lock(fifo_mutex);
+    return !fifos[core_num].empty();
+}
+
+void multicore_fifo_push_blocking(uint32_t data)
+{
+    std::unique_lock<std::mutex> lock(fifo_mutex);
+    fifo_cv.wait(lock, []()
+                 { return fifos[core_num ^ 1].size() < kFifoDepth; });
+    fifos[core_num ^ 1].push_back(data);
+    fifo_cv.notify_all();
+}
+
+uint32_t multicore_fifo_pop_blocking(void)
+{
+    std::unique_lock<std::mutex> lock(fifo_mutex);
+    fifo_cv.wait(lock, []()
+                 { return !fifos[core_num].empty(); });
+    const uint32_t data = fifos[core_num].front();
+    fifos[core_num].pop_front();
+    fifo_cv.notify_all();
+    return data;
+}
+
+// The lockout has nothing to park. The renderer never writes the user data (no CDC data comes in),
+// the preset section is emulated in RAM.
+
+void multicore_lockout_victim_init(void)
+{
+}
+
+bool multicore_lockout_victim_is_initialized(uint)
+{
+    return true;
+}
+
+void multicore_lockout_start_blocking(void)
+{
+}
+
+void multicore_lockout_end_blocking(void)
+{
+}
+
+void flash_range_erase(uint32_t offset, size_t size)
+{
+    if (uint8_t *flash = preset_flash(offset, size))
+    {
+        std::memset(flash, 0xFF, size);
+    }
+}
+
+void flash_range_program(uint32_t offset, const uint8_t *data, size_t size)
+{
+    if (uint8_t *flash = preset_flash(offset, size))
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            flash[i] &= data[i]; // Programming only clears bits
+        }
+    }
+}
+
+// Misc
+
+void watchdog_reboot(uint32_t, uint32_t, uint32_t)
+{
+    std::fprintf(stderr, "watchdog_reboot() called, exiting\n");
+    std::_Exit(1);
+}
+
+void pico_get_unique_board_id(pico_unique_board_id_t *id)
+{
+    std::memset(id->id, 0x4B, sizeof(id->id));
+}
+
+void pico_get_unique_board_id_string(char *id_out, uint len)
+{
+    std::snprintf(id_out, len, "HOST");
+}
+
+// TinyUSB, CDC output goes to stderr, nothing ever comes in
+
+bool tusb_init(void)
+{
+    return true;
+}
+
+void tud_task(void)
+{
+    if (task_hook != nullptr)
+    {
+        task_hook();
+    }
+}
+
+bool tud_mounted(void)
+{
+    return false;
+}
+
+bool tud_cdc_connected(void)
+{
+    return true;
+}
+
+uint32_t tud_cdc_available(void)
+{
+    return 0;
+}
+
+int32_t tud_cdc_read_char(void)
+{
+    return -1;
+}
+
+uint32_t tud_cdc_read(void *, uint32_t)
+{
+    return 0;
+}
+
+bool tud_cdc_peek(uint8_t *)
+{
+    return false;
+}
+
+void tud_cdc_n_read_flush(uint8_t)
+{
+}
+
+uint32_t tud_cdc_write(const void *buffer, uint32_t size)
+{
+    return static_cast<uint32_t>(std::fwrite(buffer, 1, size, stderr));
+}
+
+uint32_t tud_cdc_write_flush(void)
+{
+    std::fflush(stderr);
+    return 0;
+}
+
+uint32_t tud_cdc_write_available(void)
+{
+    return 64;
+}
+
+uint32_t tud_midi_available(void)
+{
+    return 0;
+}
+
+bool tud_midi_packet_read(uint8_t[4])
+{
+    return false;
+}
+
+uint32_t tud_midi_stream_read(void *, uint32_t)
+{
+    return 0;
+}
+
+bool tud_midi_packet_write(const uint8_t[4])
+{
+    return true;
+}
+
+uint32_t tud_midi_stream_write(uint8_t, const uint8_t *, uint32_t bufsize)
+{
+    return bufsize;
+}
+
+}
+
+namespace kastle2::host
+{
+
+void AdvanceTime(uint64_t us)
+{
+    now_us += us;
+
+    // The alarm callbacks run like the interrupts, on the thread that moved the time
+    for (uint alarm_num = 0; alarm_num < kAlarmCount; alarm_num++)
+    {
+        hardware_alarm_callback_t callback = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(alarm_mutex);
+            Alarm &alarm = alarms[alarm_num];
+            if (alarm.armed && alarm.target <= now_us)
+            {
+                alarm.armed = false;
+                callback = alarm.callback;
+            }
+        }
+        if (callback != nullptr)
+        {
+            callback(alarm_num);
+        }
+    }
+    if (time_limit_us != 0 && now_us >= time_limit_us)
+    {
+        std::fprintf(stderr, "Time limit reached without finishing the render (the app never started audio?)\n");
+        std::_Exit(EXIT_FAILURE);
+    }
+}
+
+void SetTimeLimit(uint64_t us)
+{
+    time_limit_us = us;
+}
+
+void RunIrq(uint32_t irq)
+{
+    if (irq_handlers.at(irq) != nullptr)
+    {
+        irq_handlers.at(irq)();
+    }
+}
+
+void ReceiveUart(const uint8_t *bytes, size_t size)
+{
+    if (irq_handlers.at(UART0_IRQ) == nullptr)
+    {
+        return; // Nobody listens
+    }
+    uart_input.insert(uart_input.end(), bytes, bytes + size);
+    // The handler empties the FIFO (up to 32 bytes) each time
+    while (!uart_input.empty())
+    {
+        RunIrq(UART0_IRQ);
+    }
+}
+
+bool GetGpio(uint32_t pin)
+{
+    const Gpio &gpio = gpios.at(pin);
+    if (gpio.output)
+    {
+        return gpio.value;
+    }
+    if (gpio.overridden)
+    {
+        return gpio.input_level;
+    }
+    return gpio.pull_up;
+}
+
+void SetGpioInput(uint32_t pin, bool level)
+{
+    const bool prev_level = GetGpio(pin);
+    Gpio &gpio = gpios.at(pin);
+    gpio.overridden = true;
+    gpio.input_level = level;
+
+    // The edge interrupt runs right away, on the calling thread
+    const uint32_t event = level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    if (level != prev_level && (gpio.irq_events & event) && gpio_irq_callback != nullptr)
+    {
+        gpio_irq_callback(pin, event);
+    }
+}
+
+void SetAdcReader(AdcReader reader)
+{
+    adc_reader = reader;
+}
+
+void SetTaskHook(TaskHook hook)
+{
+    task_hook = hook;
+}
+
+I2S::AudioCallback GetAudioCallback()
+{
+    return audio_callback;
+}
+
+void SetAudioCallback(I2S::AudioCallback callback)
+{
+    audio_callback = callback;
+}
+
+}
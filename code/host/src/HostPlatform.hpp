@@ -0,0 +1,111 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "I2S.hpp"
+
+namespace kastle2::host
+{
+
+/**
+ * @file HostPlatform.hpp
+ * @ingroup host
+ * @brief Control over the emulated RP2040 peripherals of the host build.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Time is virtual: it only moves with sleep_ms() & co. and with AdvanceTime(),
+ * so the renders are deterministic and run faster than real time.
+ * Interrupts are not asynchronous, RunIrq() calls the registered handler directly.
+ */
+
+/**
+ * @brief Reads a raw ADC value (0-4095) of the selected ADC input.
+ */
+typedef uint16_t (*AdcReader)(uint32_t input);
+
+/**
+ * @brief Called from tud_task(), ie. once every UI loop.
+ */
+typedef void (*TaskHook)();
+
+/**
+ * @brief Moves the virtual time forward.
+ * @param us Microseconds.
+ */
+void AdvanceTime(uint64_t us);
+
+/**
+ * @brief Exits with an error once the virtual time reaches the limit (app stuck in its init etc.).
+ * @param us Microseconds since boot, 0 = no limit.
+ */
+void SetTimeLimit(uint64_t us);
+
+/**
+ * @brief Calls the interrupt handler registered with irq_set_exclusive_handler().
+ * @param irq IRQ number.
+ */
+void RunIrq(uint32_t irq);
+
+/**
+ * @brief Receives bytes on the MIDI UART (uart0), its interrupt handler reads them right away.
+ * @param bytes Received bytes.
+ * @param size Number of bytes.
+ */
+void ReceiveUart(const uint8_t *bytes, size_t size);
+
+/**
+ * @brief Gets the level of a GPIO (output value or input level).
+ */
+bool GetGpio(uint32_t pin);
+
+/**
+ * @brief Overrides the level of an input GPIO (pressing buttons etc.).
+ */
+void SetGpioInput(uint32_t pin, bool level);
+
+/**
+ * @brief Sets the function providing ADC readings.
+ */
+void SetAdcReader(AdcReader reader);
+
+/**
+ * @brief Sets the function called from tud_task().
+ */
+void SetTaskHook(TaskHook hook);
+
+/**
+ * @brief Gets the audio callback registered by I2S::StartAudio (nullptr if audio wasn't started).
+ */
+I2S::AudioCallback GetAudioCallback();
+
+/**
+ * @brief Sets the audio callback, used by the host I2S driver.
+ */
+void SetAudioCallback(I2S::AudioCallback callback);
+
+}
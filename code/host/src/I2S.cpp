@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Host version of the I2S driver, the renderer (host/src/main.cpp) calls the audio callback itself
+
+#include "I2S.hpp"
+#include "HostPlatform.hpp"
+
+void I2S::StartAudio(AudioCallback callback)
+{
+    callback_ = callback;
+    kastle2::host::SetAudioCallback(callback);
+}
+
+bool I2S::GetUnderrunEvent(const size_t, UnderrunEvent &) const
+{
+    // Rendering is not real-time, so there are no underruns
+    return false;
+}
+
+void I2S::ClearUnderruns()
+{
+    underrun_count_ = 0;
+}
+
+I2S::ClockDividers I2S::GetClockDividers(const uint32_t)
+{
+    // The PIO doesn't exist here, the renderer paces the callback
+    return {};
+}
+
+void I2S::SetClockDividers(const ClockDividers &)
+{
+}
+
+void I2S::SetClockTrim(const int32_t ppb)
+{
+    // The rendered blocks don't have a clock to trim
+    trim_ppb_ = ppb;
+}
@@ -0,0 +1,182 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "hardware/adc.h"
+#include "common/debug/Profiler.hpp"
+#include "HostPlatform.hpp"
+#include "RunnerCommon.hpp"
+
+namespace kastle2::host
+{
+
+namespace
+{
+
+std::array<uint16_t, static_cast<size_t>(Hardware::AnalogInput::COUNT)> analog_values;
+std::vector<uint8_t> user_data;
+
+uint16_t ReadAdc(uint32_t input)
+{
+    // Multiplexer address as set by Hardware::SelectAdcMux_()
+    const size_t mux = GetGpio(Hardware::PIN_MUX_A) |
+                       GetGpio(Hardware::PIN_MUX_B) << 1 |
+                       GetGpio(Hardware::PIN_MUX_C) << 2;
+    size_t index = 0;
+    switch (input)
+    {
+    case 0:
+        index = static_cast<size_t>(Hardware::AnalogInput::RESET) + mux;
+        break;
+    case 1:
+        index = static_cast<size_t>(Hardware::AnalogInput::POT_5) + mux;
+        break;
+    case 2:
+        index = static_cast<size_t>(Hardware::AnalogInput::PITCH_1);
+        break;
+    default:
+        index = static_cast<size_t>(Hardware::AnalogInput::PITCH_2);
+        break;
+    }
+    return analog_values.at(index);
+}
+
+// Names of Profiler::Section, in the same order
+constexpr std::array<const char *, static_cast<size_t>(Profiler::Section::COUNT)> kSectionNames = {
+    "AUDIO_CALLBACK", "BEFORE_AUDIO_LOOP", "AUDIO_LOOP", "AFTER_AUDIO_LOOP", "SECOND_CORE"};
+
+}
+
+void InitAnalogInputs()
+{
+    for (size_t i = 0; i < analog_values.size(); i++)
+    {
+        analog_values[i] = strncmp(kAnalogInputNames[i], "POT_", 4) == 0 ? kPotDefault : 0;
+    }
+    SetAdcReader(ReadAdc);
+}
+
+int FindAnalogInput(const std::string &name)
+{
+    for (size_t i = 0; i < kAnalogInputNames.size(); i++)
+    {
+        if (name == kAnalogInputNames[i])
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void SetAnalogInput(size_t index, uint16_t value)
+{
+    analog_values.at(index) = value;
+}
+
+bool SetAnalogInput(const char *assignment)
+{
+    const char *equals = strchr(assignment, '=');
+    if (equals == nullptr)
+    {
+        return false;
+    }
+    const int index = FindAnalogInput(std::string(assignment, equals - assignment));
+    const long value = strtol(equals + 1, nullptr, 10);
+    if (index < 0 || value < 0 || value > kAdcMax)
+    {
+        return false;
+    }
+    SetAnalogInput(index, static_cast<uint16_t>(value));
+    return true;
+}
+
+void RunAdcCycle()
+{
+    for (size_t i = 0; i < kAdcConversionsPerBlock; i++)
+    {
+        RunIrq(ADC_IRQ_FIFO);
+    }
+}
+
+bool LoadUserData(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        user_data.insert(user_data.end(), buffer, buffer + read);
+    }
+    fclose(file);
+    kastle2_host_user_data = reinterpret_cast<uintptr_t>(user_data.data());
+    return true;
+}
+
+void WriteProfile(const std::string &path)
+{
+    if (path.empty())
+    {
+        return;
+    }
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "%s: cannot create file\n", path.c_str());
+        return;
+    }
+    // Whole run, the second core is still running but its last block is already counted
+    fprintf(file, "section,unit,blocks,min,avg,max\n");
+    for (Profiler::Section section : EnumRange<Profiler::Section>())
+    {
+        const Profiler::Stats stats = Profiler::GetTotals(section);
+        if (stats.count == 0)
+        {
+            continue;
+        }
+        fprintf(file, "%s,%s,%u,%u,%llu,%u\n", kSectionNames[static_cast<size_t>(section)], kastle2_host_profiler_unit(),
+                static_cast<unsigned>(stats.count), static_cast<unsigned>(stats.min),
+                static_cast<unsigned long long>(stats.sum / stats.count), static_cast<unsigned>(stats.max));
+    }
+    fclose(file);
+}
+
+void PrintAnalogInputNames()
+{
+    fprintf(stderr, "Analog inputs:");
+    for (const char *input : kAnalogInputNames)
+    {
+        fprintf(stderr, " %s", input);
+    }
+    fprintf(stderr, "\n");
+}
+
+}
@@ -0,0 +1,115 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "common/core/Hardware.hpp"
+
+namespace kastle2::host
+{
+
+/**
+ * @file RunnerCommon.hpp
+ * @ingroup host
+ * @brief Parts shared by the host runners: the offline renderer (main.cpp) and the live runner (live.cpp).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The analog inputs are raw ADC readings set by the runner and read through the emulated ADC multiplexer.
+ * Everything here runs on the app's main thread (the UI loop), no locking.
+ */
+
+/**
+ * @brief Conversions in one full ADC cycle: 8 mux positions x (16 discarded + 4 ADC inputs).
+ */
+constexpr size_t kAdcConversionsPerBlock = 8 * (16 + 4);
+
+/**
+ * @brief Default raw reading of the pots (centered), inputs default to 0 V.
+ */
+constexpr uint16_t kPotDefault = 2048;
+
+/**
+ * @brief Maximum raw ADC reading.
+ */
+constexpr uint16_t kAdcMax = 4095;
+
+/**
+ * @brief Names of Hardware::AnalogInput, in the same order.
+ */
+constexpr std::array<const char *, static_cast<size_t>(Hardware::AnalogInput::COUNT)> kAnalogInputNames = {
+    "PITCH_1", "PITCH_2", "RESET", "PARAM_3", "PARAM_1", "MODE", "FEED_1", "FEED_2", "FEED_3",
+    "PARAM_2", "POT_5", "POT_1", "POT_4", "POT_6", "TRIG_IN", "POT_7", "POT_2", "POT_3"};
+
+/**
+ * @brief Sets the defaults of the analog inputs and registers the ADC reader.
+ */
+void InitAnalogInputs();
+
+/**
+ * @brief Finds an analog input by its name.
+ * @return Index of the input, -1 when there is no such input.
+ */
+int FindAnalogInput(const std::string &name);
+
+/**
+ * @brief Sets the raw reading of an analog input.
+ * @param index Index of the input (Hardware::AnalogInput).
+ * @param value Raw reading 0-4095.
+ */
+void SetAnalogInput(size_t index, uint16_t value);
+
+/**
+ * @brief Sets an analog input from a NAME=raw assignment (command line).
+ * @return False when the name or the value is invalid.
+ */
+bool SetAnalogInput(const char *assignment);
+
+/**
+ * @brief Runs one full ADC multiplexer cycle, ie. reads every analog input once.
+ */
+void RunAdcCycle();
+
+/**
+ * @brief Loads the user data file (as uploaded to the user data section).
+ * @return False when the file can't be read.
+ */
+bool LoadUserData(const char *path);
+
+/**
+ * @brief Writes the Profiler sections of the whole run (min/avg/max per block) as CSV, nothing when the path is empty.
+ */
+void WriteProfile(const std::string &path);
+
+/**
+ * @brief Prints the analog input names to stderr (the end of the usage).
+ */
+void PrintAnalogInputNames();
+
+}
@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "WavFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace kastle2::host;
+
+namespace
+{
+
+uint16_t ReadU16(const uint8_t *p)
+{
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t ReadU32(const uint8_t *p)
+{
+    return static_cast<uint32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24));
+}
+
+void WriteU16(uint8_t *p, uint16_t value)
+{
+    p[0] = value & 0xFF;
+    p[1] = value >> 8;
+}
+
+void WriteU32(uint8_t *p, uint32_t value)
+{
+    WriteU16(p, value & 0xFFFF);
+    WriteU16(p + 2, value >> 16);
+}
+
+}
+
+WavReader::~WavReader()
+{
+    if (file_ != nullptr)
+    {
+        fclose(file_);
+    }
+}
+
+bool WavReader::Open(const std::string &path, std::string &error)
+{
+    file_ = fopen(path.c_str(), "rb");
+    if (file_ == nullptr)
+    {
+        error = "cannot open file";
+        return false;
+    }
+
+    uint8_t riff[12];
+    if (fread(riff, 1, sizeof(riff), file_) != sizeof(riff) || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0)
+    {
+        error = "not a WAV file";
+        return false;
+    }
+
+    // Walk the chunks until the data chunk, the fmt chunk has to be before it
+    bool has_format = false;
+    uint8_t chunk[8];
+    while (fread(chunk, 1, sizeof(chunk), file_) == sizeof(chunk))
+    {
+        const uint32_t chunk_size = ReadU32(chunk + 4);
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            uint8_t format[16];
+            if (chunk_size < sizeof(format) || fread(format, 1, sizeof(format), file_) != sizeof(format))
+            {
+                error = "broken fmt chunk";
+                return false;
+            }
+            const uint16_t audio_format = ReadU16(format);
+            channels_ = ReadU16(format + 2);
+            sample_rate_ = ReadU32(format + 4);
+            const uint16_t bits = ReadU16(format + 14);
+            if (audio_format != 1 || bits != 16 || channels_ < 1 || channels_ > 2)
+            {
+                error = "only 16-bit PCM mono or stereo is supported";
+                return false;
+            }
+            has_format = true;
+            fseek(file_, (chunk_size - sizeof(format) + 1) & ~1u, SEEK_CUR);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (!has_format)
+            {
+                error = "data chunk before fmt chunk";
+                return false;
+            }
+            frames_left_ = chunk_size / (2 * channels_);
+            return true;
+        }
+        else
+        {
+            // Chunks are padded to even size
+            fseek(file_, (chunk_size + 1) & ~1u, SEEK_CUR);
+        }
+    }
+    error = "no data chunk";
+    return false;
+}
+
+void WavReader::Read(int32_t *buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        int16_t frame[2] = {0, 0};
+        if (frames_left_ > 0 && fread(frame, 2, channels_, file_) == channels_)
+        {
+            frames_left_--;
+            if (channels_ == 1)
+            {
+                frame[1] = frame[0];
+            }
+        }
+        else
+        {
+            frames_left_ = 0;
+        }
+        buffer[i * 2] = frame[0];
+        buffer[i * 2 + 1] = frame[1];
+    }
+}
+
+WavWriter::~WavWriter()
+{
+    Close();
+}
+
+bool WavWriter::Open(const std::string &path, uint32_t sample_rate)
+{
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr)
+    {
+        return false;
+    }
+    sample_rate_ = sample_rate;
+    frames_ = 0;
+    WriteHeader();
+    return true;
+}
+
+void WavWriter::Write(const int32_t *buffer, size_t size)
+{
+    if (file_ == nullptr)
+    {
+        return;
+    }
+    for (size_t i = 0; i < size * 2; i++)
+    {
+        const int16_t value = static_cast<int16_t>(std::clamp<int32_t>(buffer[i], INT16_MIN, INT16_MAX));
+        uint8_t bytes[2];
+        WriteU16(bytes, static_cast<uint16_t>(value));
+        fwrite(bytes, 1, sizeof(bytes), file_);
+    }
+    frames_ += size;
+}
+
+void WavWriter::Close()
+{
+    if (file_ == nullptr)
+    {
+        return;
+    }
+    fseek(file_, 0, SEEK_SET);
+    WriteHeader();
+    fclose(file_);
+    file_ = nullptr;
+}
+
+void WavWriter::WriteHeader()
+{
+    constexpr uint16_t kChannels = 2;
+    constexpr uint16_t kBytesPerFrame = kChannels * 2;
+    const uint32_t data_size = frames_ * kBytesPerFrame;
+
+    uint8_t header[44];
+    memcpy(header, "RIFF", 4);
+    WriteU32(header + 4, 36 + data_size);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    WriteU32(header + 16, 16);
+    WriteU16(header + 20, 1); // PCM
+    WriteU16(header + 22, kChannels);
+    WriteU32(header + 24, sample_rate_);
+    WriteU32(header + 28, sample_rate_ * kBytesPerFrame);
+    WriteU16(header + 32, kBytesPerFrame);
+    WriteU16(header + 34, 16);
+    memcpy(header + 36, "data", 4);
+    WriteU32(header + 40, data_size);
+    fwrite(header, 1, sizeof(header), file_);
+}
@@ -0,0 +1,120 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace kastle2::host
+{
+
+/**
+ * @class WavReader
+ * @ingroup host
+ * @brief Reads 16-bit PCM WAV files (mono or stereo) frame by frame.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * After the end of the file (or without a file) it returns silence,
+ * so the render length doesn't depend on the input length.
+ */
+class WavReader
+{
+public:
+    ~WavReader();
+
+    /**
+     * @brief Opens the file and parses the header.
+     * @param path File path.
+     * @param error Filled with the reason when it fails.
+     * @return True if the file is a supported WAV file.
+     */
+    bool Open(const std::string &path, std::string &error);
+
+    /**
+     * @brief Reads stereo frames into an interleaved buffer (16-bit values in int32_t).
+     * @param buffer Output buffer, size * 2 values.
+     * @param size Number of frames.
+     */
+    void Read(int32_t *buffer, size_t size);
+
+    /**
+     * @brief Sample rate of the opened file (0 if none).
+     */
+    uint32_t GetSampleRate() const
+    {
+        return sample_rate_;
+    }
+
+private:
+    FILE *file_ = nullptr;
+    uint16_t channels_ = 0;
+    uint32_t sample_rate_ = 0;
+    uint32_t frames_left_ = 0;
+};
+
+/**
+ * @class WavWriter
+ * @ingroup host
+ * @brief Writes 16-bit stereo PCM WAV files.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class WavWriter
+{
+public:
+    ~WavWriter();
+
+    /**
+     * @brief Creates the file and writes a placeholder header.
+     * @param path File path.
+     * @param sample_rate Sample rate in Hz.
+     * @return True on success.
+     */
+    bool Open(const std::string &path, uint32_t sample_rate);
+
+    /**
+     * @brief Writes interleaved stereo frames, values are saturated to 16 bits.
+     * @param buffer Interleaved buffer, size * 2 values.
+     * @param size Number of frames.
+     */
+    void Write(const int32_t *buffer, size_t size);
+
+    /**
+     * @brief Finalizes the header and closes the file.
+     */
+    void Close();
+
+private:
+    void WriteHeader();
+
+    FILE *file_ = nullptr;
+    uint32_t sample_rate_ = 0;
+    uint32_t frames_ = 0;
+};
+
+}
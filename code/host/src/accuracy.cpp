@@ -0,0 +1,564 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Accuracy harness: runs the fixed-point kernels next to a double precision model of the same math and reports the error
+//
+//   ./build-host/output/accuracy [-b benchmark.log] [-c accuracy.csv]
+//
+// The kernel and its model get the same input (deterministic, Xorshift32 noise or a test tone) and
+// the model uses exact coefficients, so the error is what the fixed point costs: the coefficient rounding,
+// the truncating multiplies, the lookup tables, the headroom shifts (kDownsample of the Svf) etc.
+// Errors are in LSB of Q15 (q31_t results scaled down), bias is the mean error (truncation shows up there),
+// SNR is the model's power over the error's, THD the harmonics 2-10 of the tone generators.
+//
+// -b takes the serial output of the Benchmark app (src/apps/Benchmark) and adds its cycles per sample,
+// matched by the kernel name, so a proposed fast path is judged by its error and its cost side by side.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <numbers>
+#include <string>
+#include <vector>
+
+#include "common/config.hpp"
+#include "common/dsp/effects/SoftClipper.hpp"
+#include "common/dsp/filters/Svf.hpp"
+#include "common/dsp/math/Xorshift32.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/synthesis/OscillatorQ15.hpp"
+
+using namespace kastle2;
+
+namespace
+{
+
+constexpr double kFullScale = 32768.0;
+constexpr size_t kRandomInputs = 1 << 20;
+constexpr size_t kToneLength = 1 << 16; ///< Whole periods of the 16-bit oscillator phase, the harmonics land on bins
+constexpr size_t kFilterLength = 1 << 16;
+constexpr size_t kHarmonics = 10;
+constexpr size_t kBlockSize = AUDIO_BUFFER_SIZE;
+constexpr uint32_t kSeed = 1;
+
+/**
+ * @brief Error of a kernel against its model, in Q15 LSB.
+ */
+class ErrorStats
+{
+public:
+    void Add(double value, double reference)
+    {
+        const double error = value - reference;
+        max_ = std::max(max_, std::abs(error));
+        sum_ += error;
+        error_power_ += error * error;
+        reference_power_ += reference * reference;
+        count_++;
+    }
+
+    double Max() const
+    {
+        return max_;
+    }
+
+    double Rms() const
+    {
+        return count_ > 0 ? std::sqrt(error_power_ / count_) : 0.0;
+    }
+
+    double Bias() const
+    {
+        return count_ > 0 ? sum_ / count_ : 0.0;
+    }
+
+    // Infinite for a bit exact kernel
+    double Snr() const
+    {
+        return error_power_ > 0.0 ? 10.0 * std::log10(reference_power_ / error_power_) : INFINITY;
+    }
+
+private:
+    double max_ = 0.0;
+    double sum_ = 0.0;
+    double error_power_ = 0.0;
+    double reference_power_ = 0.0;
+    size_t count_ = 0;
+};
+
+struct Result
+{
+    std::string name;
+    std::string benchmark; ///< Benchmark kernel with the same code, empty when there is none
+    ErrorStats stats;
+    double thd = NAN; ///< Tone generators only
+};
+
+std::vector<Result> results;
+
+double Saturate(double value, double min, double max)
+{
+    return std::clamp(value, min, max);
+}
+
+double SaturateQ15(double value)
+{
+    return Saturate(value, -kFullScale, kFullScale - 1.0);
+}
+
+q15_t RandomQ15(Xorshift32 &random)
+{
+    return static_cast<int16_t>(random.Next() >> 16);
+}
+
+/**
+ * @brief Power of one DFT bin (Goertzel).
+ */
+double BinPower(const std::vector<double> &signal, size_t bin)
+{
+    const double coefficient = 2.0 * std::cos(2.0 * std::numbers::pi * bin / signal.size());
+    double s1 = 0.0;
+    double s2 = 0.0;
+    for (double sample : signal)
+    {
+        const double s = sample + coefficient * s1 - s2;
+        s2 = s1;
+        s1 = s;
+    }
+    return s1 * s1 + s2 * s2 - coefficient * s1 * s2;
+}
+
+/**
+ * @brief THD in dB of a tone with a whole number of periods in the signal.
+ */
+double Thd(const std::vector<double> &signal, size_t fundamental_bin)
+{
+    double harmonics = 0.0;
+    for (size_t harmonic = 2; harmonic <= kHarmonics && harmonic * fundamental_bin < signal.size() / 2; harmonic++)
+    {
+        harmonics += BinPower(signal, harmonic * fundamental_bin);
+    }
+    return 10.0 * std::log10(harmonics / BinPower(signal, fundamental_bin));
+}
+
+// qmath
+
+void MeasureMultiplies()
+{
+    Result mult{"q15_mult", "", {}};
+    Result mult_fast{"q15_mult_fast", "", {}};
+    Result div{"q15_div", "", {}};
+    Result reciprocal{"q15_mult_reciprocal", "", {}};
+    Xorshift32 random;
+    random.Seed(kSeed);
+    for (size_t i = 0; i < kRandomInputs; i++)
+    {
+        const q15_t a = RandomQ15(random);
+        const q15_t b = RandomQ15(random);
+        const double product = SaturateQ15(static_cast<double>(a) * b / kFullScale);
+        mult.stats.Add(q15_mult(a, b), product);
+        mult_fast.stats.Add(q15_mult_fast(a, b), product);
+        if (b != 0)
+        {
+            div.stats.Add(q15_div(a, b), SaturateQ15(a * kFullScale / b));
+        }
+        // The reciprocal needs b of at least 0.125
+        const q15_t divisor = std::max<q15_t>(q15_abs(b), Q15_MAX / 8);
+        reciprocal.stats.Add(q15_mult_reciprocal(a, q15_reciprocal(divisor)), SaturateQ15(a * kFullScale / divisor));
+    }
+    results.push_back(mult);
+    results.push_back(mult_fast);
+    results.push_back(div);
+    results.push_back(reciprocal);
+}
+
+void MeasureSines()
+{
+    // One period over the positive range
+    Result sine15{"q15_sine", "", {}};
+    for (q15_t x = 0; x <= Q15_MAX; x++)
+    {
+        sine15.stats.Add(q15_sine(x), SaturateQ15(std::sin(2.0 * std::numbers::pi * x / kFullScale) * kFullScale));
+    }
+    results.push_back(sine15);
+
+    Result sine31{"q31_sine", "", {}};
+    Xorshift32 random;
+    random.Seed(kSeed);
+    for (size_t i = 0; i < kRandomInputs; i++)
+    {
+        const q31_t x = static_cast<q31_t>(random.Next() >> 1);
+        const double reference = Saturate(std::sin(2.0 * std::numbers::pi * x / 2147483648.0) * 2147483648.0, INT32_MIN, INT32_MAX);
+        sine31.stats.Add(q31_sine(x) / 65536.0, reference / 65536.0);
+    }
+    results.push_back(sine31);
+}
+
+void MeasureSvfCoefficients()
+{
+    Result svf{"q15_svf_coefficient", "", {}};
+    for (q15_t frequency = 0; frequency <= Q15_HALF; frequency++)
+    {
+        svf.stats.Add(q15_svf_coefficient(frequency), 2.0 * std::sin(std::numbers::pi * frequency / kFullScale / 2.0) * kFullScale);
+    }
+    results.push_back(svf);
+
+    // Up to 0.336 of the sample rate, where the table ends
+    Result zdf{"q15_svf_zdf_coefficient", "", {}};
+    for (q15_t frequency = 0; frequency <= QMATH_SVF_ZDF_TABLE_SIZE << QMATH_SVF_TABLE_SHIFT; frequency++)
+    {
+        zdf.stats.Add(q15_svf_zdf_coefficient(frequency), std::tan(std::numbers::pi * frequency / kFullScale) * kFullScale);
+    }
+    results.push_back(zdf);
+}
+
+// Generators
+
+void MeasureOscillator(bool block)
+{
+    OscillatorQ15 oscillator;
+    oscillator.Init(SAMPLE_RATE);
+    oscillator.SetFrequency(1000.0f);
+    const q15_t phase_increment = OscillatorQ15::CalcPhaseIncrement(freq_to_q15(1000.0f, SAMPLE_RATE));
+
+    std::vector<q15_t> output(kToneLength);
+    if (block)
+    {
+        for (size_t i = 0; i < kToneLength; i += kBlockSize)
+        {
+            oscillator.ProcessBlock(output.data() + i, std::min(kBlockSize, kToneLength - i));
+        }
+    }
+    else
+    {
+        for (q15_t &sample : output)
+        {
+            sample = oscillator.Process();
+        }
+    }
+
+    // The phase is exact (integer), the model takes the sine of it, so only the table lookup is measured
+    Result result{block ? "OscillatorQ15 (block)" : "OscillatorQ15", block ? "OscillatorQ15 (block)" : "OscillatorQ15", {}};
+    std::vector<double> signal(kToneLength);
+    int32_t phase = Q15_MIN;
+    for (size_t i = 0; i < kToneLength; i++)
+    {
+        const double reference = SaturateQ15(std::sin(2.0 * std::numbers::pi * (phase + 32768) / 65536.0) * kFullScale);
+        result.stats.Add(output[i], reference);
+        signal[i] = output[i];
+        phase = static_cast<int16_t>(phase + phase_increment);
+    }
+    // Whole phase periods: phase_increment periods in 65536 samples
+    result.thd = Thd(signal, static_cast<size_t>(phase_increment));
+    results.push_back(result);
+}
+
+// Processors
+
+void MeasureSoftClipper()
+{
+    constexpr q15_t kDrive = Q15_HALF;
+    SoftClipper clipper;
+    clipper.Init(SAMPLE_RATE);
+    clipper.SetDrive(kDrive);
+
+    Result result{"SoftClipper (block)", "SoftClipper (block)", {}};
+    std::vector<q15_t> input(kToneLength);
+    std::vector<q15_t> output(kToneLength);
+    for (size_t i = 0; i < kToneLength; i++)
+    {
+        input[i] = static_cast<q15_t>(std::lround(0.9 * Q15_MAX * std::sin(2.0 * std::numbers::pi * 1000.0 * i / SAMPLE_RATE)));
+    }
+    for (size_t i = 0; i < kToneLength; i += kBlockSize)
+    {
+        clipper.ProcessBlock(input.data() + i, output.data() + i, std::min(kBlockSize, kToneLength - i));
+    }
+
+    // tanh(pi * x) of the input over pi with the drive, saturated to 1, and the volume compensation
+    for (size_t i = 0; i < kToneLength; i++)
+    {
+        const double x = input[i] / kFullScale / std::numbers::pi * (1.0 + kDrive / 512.0);
+        const double shaped = std::tanh(std::numbers::pi * Saturate(x, -1.0, 1.0));
+        result.stats.Add(output[i], shaped * (1.0 - kDrive / 2.0 / kFullScale) * kFullScale);
+    }
+    results.push_back(result);
+}
+
+/**
+ * @brief Double precision Svf: the same passes in normalized units (Q15 1.0 = 1.0) with exact coefficients.
+ */
+class SvfModel
+{
+public:
+    SvfModel(Svf::Topology topology, double frequency, double resonance, double drive)
+        : topology_(topology)
+    {
+        resonance = std::clamp(resonance, 0.005, 1.0);
+        const double damp = 2.0 * (1.0 - std::pow(resonance, 0.25));
+        drive_ = drive * resonance;
+        if (topology != Svf::Topology::DOUBLE_SAMPLED)
+        {
+            frequency_ = std::tan(std::numbers::pi * frequency / SAMPLE_RATE);
+            damp_ = damp;
+            gain_ = 1.0 / (1.0 + frequency_ * (frequency_ + damp_));
+            feedback_ = (frequency_ + damp_) * gain_;
+        }
+        else
+        {
+            frequency_ = 2.0 * std::sin(std::numbers::pi * std::min(0.25, frequency / (SAMPLE_RATE * 2.0)));
+            damp_ = std::min(damp, std::min(2.0, 2.0 / frequency_ - frequency_ / 2.0));
+        }
+    }
+
+    // Lowpass output for a Q15 input, in Q15
+    double Process(double input)
+    {
+        // kDownsample: the input is halved, the output isn't scaled back
+        const double in = input / kFullScale / 2.0;
+        if (topology_ == Svf::Topology::DOUBLE_SAMPLED)
+        {
+            DoubleSampledPass(in);
+            DoubleSampledPass(in);
+        }
+        else
+        {
+            high_ = Saturate(gain_ * (in - s2_) - feedback_ * s1_);
+            band_ = Saturate(frequency_ * high_ + s1_);
+            const double distortion = topology_ == Svf::Topology::ZDF ? band_ * band_ * band_ : band_ * std::abs(band_);
+            band_ = Saturate(band_ - drive_ * distortion);
+            s1_ = Saturate(2.0 * band_ - s1_);
+            low_ = Saturate(frequency_ * band_ + s2_);
+            s2_ = Saturate(2.0 * low_ - s2_);
+        }
+        return low_ * kFullScale;
+    }
+
+private:
+    static double Saturate(double value)
+    {
+        return std::clamp(value, -1.0, (kFullScale - 1.0) / kFullScale);
+    }
+
+    void DoubleSampledPass(double in)
+    {
+        const double notch = in - damp_ * band_;
+        low_ = low_ + frequency_ * band_;
+        high_ = notch - low_;
+        band_ = frequency_ * high_ + band_ - drive_ * band_ * band_ * band_;
+        low_ = Saturate(low_);
+        high_ = Saturate(high_);
+        band_ = Saturate(band_);
+    }
+
+    Svf::Topology topology_;
+    double frequency_ = 0.0;
+    double damp_ = 0.0;
+    double drive_ = 0.0;
+    double gain_ = 0.0;
+    double feedback_ = 0.0;
+    double low_ = 0.0;
+    double high_ = 0.0;
+    double band_ = 0.0;
+    double s1_ = 0.0;
+    double s2_ = 0.0;
+};
+
+void MeasureSvf(Svf::Topology topology, float frequency)
+{
+    // As in the Benchmark app
+    constexpr float kResonance = 0.7f;
+    constexpr float kDrive = 0.5f;
+    Svf svf;
+    svf.Init(SAMPLE_RATE);
+    svf.SetTopology(topology);
+    svf.SetResonance(kResonance);
+    svf.SetDrive(kDrive);
+    svf.SetFrequency(frequency);
+    SvfModel model(topology, frequency, kResonance, kDrive);
+
+    // Noise at half of the full scale, over the whole band
+    std::vector<q15_t> input(kFilterLength);
+    std::vector<q15_t> output(kFilterLength);
+    Xorshift32 random;
+    random.Seed(kSeed);
+    for (q15_t &sample : input)
+    {
+        sample = RandomQ15(random) / 2;
+    }
+    for (size_t i = 0; i < kFilterLength; i += kBlockSize)
+    {
+        svf.ProcessBlock(input.data() + i, output.data() + i, std::min(kBlockSize, kFilterLength - i));
+    }
+
+    const char *topology_name = topology == Svf::Topology::DOUBLE_SAMPLED ? ""
+                                : topology == Svf::Topology::ZDF           ? " ZDF"
+                                                                           : " ZDF quadratic";
+    char name[64];
+    snprintf(name, sizeof(name), "Svf%s LP %g Hz", topology_name, frequency);
+    Result result{name, topology == Svf::Topology::DOUBLE_SAMPLED ? "Svf (block)" : "", {}};
+    for (size_t i = 0; i < kFilterLength; i++)
+    {
+        result.stats.Add(output[i], model.Process(input[i]));
+    }
+    results.push_back(result);
+}
+
+// Report
+
+/**
+ * @brief Average cycles per sample of each kernel in a capture of the Benchmark output.
+ * @details Lines like "Svf (block)   min   123 avg   125 (7% of the block)", the last report wins.
+ */
+bool ReadBenchmark(const char *path, std::map<std::string, unsigned long> &cycles)
+{
+    FILE *file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        const char *min = strstr(line, " min ");
+        const char *avg = strstr(line, " avg ");
+        if (min == nullptr || avg == nullptr)
+        {
+            continue;
+        }
+        std::string name(line, min - line);
+        name.erase(name.find_last_not_of(' ') + 1);
+        cycles[name] = strtoul(avg + 5, nullptr, 10);
+    }
+    fclose(file);
+    return true;
+}
+
+std::string Format(double value, const char *format)
+{
+    if (std::isnan(value))
+    {
+        return "-";
+    }
+    if (std::isinf(value))
+    {
+        return "exact";
+    }
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), format, value);
+    return buffer;
+}
+
+void PrintResults(FILE *file, const std::map<std::string, unsigned long> &cycles, bool csv)
+{
+    const char *row = csv ? "%s,%s,%s,%s,%s,%s,%s\n" : "%-28s %9s %9s %9s %8s %8s %8s\n";
+    fprintf(file, row, "kernel", "max_lsb", "rms_lsb", "bias_lsb", "snr_db", "thd_db", "cycles");
+    for (const Result &result : results)
+    {
+        const auto measured = cycles.find(result.benchmark);
+        const std::string cycles_per_sample = measured != cycles.end() ? std::to_string(measured->second) : "-";
+        fprintf(file, row, result.name.c_str(), Format(result.stats.Max(), "%.2f").c_str(),
+                Format(result.stats.Rms(), "%.3f").c_str(), Format(result.stats.Bias(), "%.3f").c_str(),
+                Format(result.stats.Snr(), "%.1f").c_str(), Format(result.thd, "%.1f").c_str(), cycles_per_sample.c_str());
+    }
+}
+
+void PrintUsage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-b benchmark.log] [-c accuracy.csv]\n"
+            "  -b  serial output of the Benchmark app, adds its cycles per sample\n"
+            "  -c  the results as CSV too\n",
+            name);
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, unsigned long> cycles;
+    std::string csv_path;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr || arg[0] != '-' || strlen(arg) != 2)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        i++;
+
+        bool ok = true;
+        switch (arg[1])
+        {
+        case 'b':
+            ok = ReadBenchmark(value, cycles);
+            break;
+        case 'c':
+            csv_path = value;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "Invalid argument: %s %s\n", arg, value);
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    MeasureMultiplies();
+    MeasureSines();
+    MeasureSvfCoefficients();
+    MeasureOscillator(false);
+    MeasureOscillator(true);
+    MeasureSoftClipper();
+    for (Svf::Topology topology : {Svf::Topology::DOUBLE_SAMPLED, Svf::Topology::ZDF, Svf::Topology::ZDF_QUADRATIC_DRIVE})
+    {
+        for (float frequency : {100.0f, 1000.0f, 5000.0f})
+        {
+            MeasureSvf(topology, frequency);
+        }
+    }
+
+    PrintResults(stdout, cycles, false);
+    if (!csv_path.empty())
+    {
+        FILE *file = fopen(csv_path.c_str(), "w");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "%s: cannot create file\n", csv_path.c_str());
+            return EXIT_FAILURE;
+        }
+        PrintResults(file, cycles, true);
+        fclose(file);
+    }
+    return EXIT_SUCCESS;
+}
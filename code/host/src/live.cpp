@@ -0,0 +1,474 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Live runner: runs an app's main() with the emulated hardware against the sound card (PortAudio) and MIDI (RtMidi)
+//
+// As in the renderer (main.cpp), every UI loop runs one full ADC multiplexer cycle and one audio block, here paced
+// by the blocking stream: the input block is read, the AudioLoop runs, the output block is written. The virtual time
+// moves by the block, so the app's timers follow the audio clock. The second core is a thread as in the renders.
+// MIDI input goes to the MIDI UART, so the app reacts to it as on the TRS MIDI input (its own CC assignments, clock etc.),
+// the CCs mapped with -c set an analog input instead (pots and CV inputs the app doesn't have a CC for).
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <portaudio.h>
+
+#ifdef KASTLE2_HOST_MIDI
+#include <memory>
+#include <vector>
+#include <RtMidi.h>
+#endif
+
+#include "common/core/Hardware.hpp"
+#include "HostPlatform.hpp"
+#include "RunnerCommon.hpp"
+
+using namespace kastle2;
+
+int kastle2_app_main();
+
+namespace
+{
+
+/**
+ * @brief Virtual time the app can spend before starting the audio (startup messages etc.).
+ */
+constexpr uint64_t kStartupTimeLimitUs = 10 * 1000000ull;
+
+/**
+ * @brief Silent blocks written when the stream starts, the headroom of the output against the input.
+ */
+constexpr size_t kPrimeBlocks = 2;
+
+constexpr uint32_t kAudioInDetectPin = Hardware::PIN_AUDIO_IN_DETECT;
+constexpr int kNoDevice = -1;
+constexpr int8_t kNoInput = -1;
+constexpr size_t kMidiCcCount = 128;
+
+constexpr uint64_t kBlockUs = I2S::kAudioBufferSize * 1000000ull / I2S_SAMPLE_RATE;
+
+PaStream *stream = nullptr;
+bool has_input = false;
+bool started = false;
+size_t blocks_left = 0; ///< 0 = until Ctrl+C
+std::string profile_path;
+bool in_task_hook = false;
+volatile std::sig_atomic_t stop_requested = 0;
+
+// Analog input set by each MIDI CC (-c), kNoInput = the CC goes to the app
+std::array<int8_t, kMidiCcCount> cc_inputs = []()
+{
+    std::array<int8_t, kMidiCcCount> inputs;
+    inputs.fill(kNoInput);
+    return inputs;
+}();
+
+#ifdef KASTLE2_HOST_MIDI
+std::unique_ptr<RtMidiIn> midi_in;
+#endif
+
+// Real-time statistics
+uint64_t blocks = 0;
+uint64_t output_underflows = 0;
+uint64_t input_overflows = 0;
+std::chrono::steady_clock::duration callback_time{};
+std::chrono::steady_clock::duration callback_max{};
+
+void RequestStop(int)
+{
+    stop_requested = 1;
+}
+
+[[noreturn]] void Stop(int status)
+{
+    if (stream != nullptr)
+    {
+        Pa_StopStream(stream);
+        Pa_CloseStream(stream);
+    }
+    Pa_Terminate();
+
+    if (blocks > 0)
+    {
+        // The AudioLoop's share of the block time, above 100 % it can't keep up
+        const double block_ns = kBlockUs * 1000.0;
+        fprintf(stderr, "%llu blocks, audio callback load avg %.1f %%, max %.1f %%, %llu output underflows, %llu input overflows\n",
+                static_cast<unsigned long long>(blocks),
+                100.0 * std::chrono::duration<double, std::nano>(callback_time).count() / blocks / block_ns,
+                100.0 * std::chrono::duration<double, std::nano>(callback_max).count() / block_ns,
+                static_cast<unsigned long long>(output_underflows), static_cast<unsigned long long>(input_overflows));
+    }
+    host::WriteProfile(profile_path);
+    // The second core thread never returns, just leave
+    std::_Exit(status);
+}
+
+void ReceiveMidi()
+{
+#ifdef KASTLE2_HOST_MIDI
+    if (midi_in == nullptr)
+    {
+        return;
+    }
+    std::vector<unsigned char> message;
+    while (midi_in->getMessage(&message), !message.empty())
+    {
+        const bool control_change = message.size() == 3 && (message[0] & 0xF0) == 0xB0;
+        if (control_change && cc_inputs[message[1] & 0x7F] != kNoInput)
+        {
+            host::SetAnalogInput(cc_inputs[message[1] & 0x7F], static_cast<uint16_t>(message[2] * host::kAdcMax / 127));
+            continue;
+        }
+        host::ReceiveUart(message.data(), message.size());
+    }
+#endif
+}
+
+bool StartStream()
+{
+    PaError error = Pa_StartStream(stream);
+    std::array<int16_t, I2S::kAudioBufferFrames> silence{};
+    for (size_t i = 0; i < kPrimeBlocks && error == paNoError; i++)
+    {
+        error = Pa_WriteStream(stream, silence.data(), I2S::kAudioBufferSize);
+    }
+    if (error != paNoError && error != paOutputUnderflowed)
+    {
+        fprintf(stderr, "Audio: %s\n", Pa_GetErrorText(error));
+        return false;
+    }
+    return true;
+}
+
+void LiveBlock()
+{
+    // The audio callback may call the UI code too (not on the hardware, but be safe)
+    if (in_task_hook)
+    {
+        return;
+    }
+    in_task_hook = true;
+
+    if (stop_requested)
+    {
+        Stop(EXIT_SUCCESS);
+    }
+
+    ReceiveMidi();
+    host::RunAdcCycle();
+
+    I2S::AudioCallback callback = host::GetAudioCallback();
+    if (callback == nullptr)
+    {
+        // Still starting, as fast as it goes
+        host::AdvanceTime(kBlockUs);
+        in_task_hook = false;
+        return;
+    }
+
+    if (!started)
+    {
+        // From now on paced by the audio
+        host::SetTimeLimit(0);
+        if (!StartStream())
+        {
+            Stop(EXIT_FAILURE);
+        }
+        started = true;
+    }
+
+    std::array<int16_t, I2S::kAudioBufferFrames> samples{};
+    if (has_input && Pa_ReadStream(stream, samples.data(), I2S::kAudioBufferSize) == paInputOverflowed)
+    {
+        input_overflows++;
+    }
+
+    int32_t input[I2S::kAudioBufferFrames];
+    int32_t output[I2S::kAudioBufferFrames] = {};
+    std::copy(samples.begin(), samples.end(), input);
+    const auto begin = std::chrono::steady_clock::now();
+    callback(input, output, I2S::kAudioBufferSize);
+    const auto duration = std::chrono::steady_clock::now() - begin;
+    callback_time += duration;
+    callback_max = std::max(callback_max, duration);
+
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = static_cast<int16_t>(std::clamp<int32_t>(output[i], INT16_MIN, INT16_MAX));
+    }
+    if (Pa_WriteStream(stream, samples.data(), I2S::kAudioBufferSize) == paOutputUnderflowed)
+    {
+        output_underflows++;
+    }
+    host::AdvanceTime(kBlockUs);
+
+    blocks++;
+    if (blocks_left != 0 && --blocks_left == 0)
+    {
+        Stop(EXIT_SUCCESS);
+    }
+
+    in_task_hook = false;
+}
+
+bool MapCc(const char *assignment)
+{
+    const char *equals = strchr(assignment, '=');
+    if (equals == nullptr)
+    {
+        return false;
+    }
+    const long cc = strtol(assignment, nullptr, 10);
+    const int input = host::FindAnalogInput(equals + 1);
+    if (cc < 0 || cc >= static_cast<long>(kMidiCcCount) || input < 0)
+    {
+        return false;
+    }
+    cc_inputs[cc] = static_cast<int8_t>(input);
+    return true;
+}
+
+void ListDevices()
+{
+    fprintf(stderr, "Audio devices:\n");
+    for (int i = 0; i < Pa_GetDeviceCount(); i++)
+    {
+        const PaDeviceInfo *info = Pa_GetDeviceInfo(i);
+        fprintf(stderr, "  %d: %s (%s, %d in, %d out)\n", i, info->name, Pa_GetHostApiInfo(info->hostApi)->name,
+                info->maxInputChannels, info->maxOutputChannels);
+    }
+#ifdef KASTLE2_HOST_MIDI
+    try
+    {
+        RtMidiIn midi;
+        fprintf(stderr, "MIDI inputs:\n");
+        for (unsigned int i = 0; i < midi.getPortCount(); i++)
+        {
+            fprintf(stderr, "  %u: %s\n", i, midi.getPortName(i).c_str());
+        }
+    }
+    catch (RtMidiError &error)
+    {
+        fprintf(stderr, "MIDI: %s\n", error.getMessage().c_str());
+    }
+#endif
+}
+
+bool OpenStream(int device)
+{
+    const PaDeviceIndex output_device = device != kNoDevice ? device : Pa_GetDefaultOutputDevice();
+    const PaDeviceIndex input_device = device != kNoDevice ? device : Pa_GetDefaultInputDevice();
+    if (output_device == paNoDevice || output_device >= Pa_GetDeviceCount())
+    {
+        fprintf(stderr, "Audio: no output device\n");
+        return false;
+    }
+
+    PaStreamParameters output = {};
+    output.device = output_device;
+    output.channelCount = 2;
+    output.sampleFormat = paInt16;
+    output.suggestedLatency = Pa_GetDeviceInfo(output_device)->defaultLowOutputLatency;
+
+    // Without a stereo input it runs output only, as with nothing plugged in the audio input
+    PaStreamParameters input = {};
+    has_input = input_device != paNoDevice && Pa_GetDeviceInfo(input_device)->maxInputChannels >= 2;
+    if (has_input)
+    {
+        input.device = input_device;
+        input.channelCount = 2;
+        input.sampleFormat = paInt16;
+        input.suggestedLatency = Pa_GetDeviceInfo(input_device)->defaultLowInputLatency;
+    }
+
+    const PaError error = Pa_OpenStream(&stream, has_input ? &input : nullptr, &output, I2S_SAMPLE_RATE,
+                                        I2S::kAudioBufferSize, paClipOff, nullptr, nullptr);
+    if (error != paNoError)
+    {
+        fprintf(stderr, "Audio: %s\n", Pa_GetErrorText(error));
+        stream = nullptr;
+        return false;
+    }
+    fprintf(stderr, "Audio: %s%s, %u Hz, %u frames per block\n", Pa_GetDeviceInfo(output_device)->name,
+            has_input ? "" : " (no input)", static_cast<unsigned>(I2S_SAMPLE_RATE), static_cast<unsigned>(I2S::kAudioBufferSize));
+    return true;
+}
+
+bool OpenMidi([[maybe_unused]] int port)
+{
+#ifdef KASTLE2_HOST_MIDI
+    try
+    {
+        midi_in = std::make_unique<RtMidiIn>();
+        if (port != kNoDevice)
+        {
+            midi_in->openPort(port);
+            fprintf(stderr, "MIDI: %s\n", midi_in->getPortName(port).c_str());
+        }
+        else
+        {
+            midi_in->openVirtualPort("Kastle 2");
+            fprintf(stderr, "MIDI: virtual input \"Kastle 2\"\n");
+        }
+        // The clock goes through (MIDI sync), SysEx and active sensing don't
+        midi_in->ignoreTypes(true, false, true);
+    }
+    catch (RtMidiError &error)
+    {
+        // Not fatal without -m, eg. no virtual ports on Windows
+        fprintf(stderr, "MIDI: %s\n", error.getMessage().c_str());
+        midi_in.reset();
+        return port == kNoDevice;
+    }
+#else
+    if (port != kNoDevice)
+    {
+        fprintf(stderr, "MIDI: built without RtMidi\n");
+        return false;
+    }
+#endif
+    return true;
+}
+
+void PrintUsage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-d device] [-m port] [-c CC=NAME]... [-s seconds] [-a NAME=raw]... [-u user_data.bin] [-p profile.csv] [-l]\n"
+            "  -d  audio device for the input and the output (default: the default ones), see -l\n"
+            "  -m  MIDI input port (default: a virtual input called Kastle 2), see -l\n"
+            "  -c  MIDI CC 0-127 setting an analog input (0-127 scaled to 0-4095) instead of going to the app\n"
+            "  -s  stop after this many seconds (default: run until Ctrl+C)\n"
+            "  -a  raw ADC reading 0-4095 of an analog input, pots default to %u, the rest to 0\n"
+            "  -u  user data file (the same as uploaded to the user data section)\n"
+            "  -p  Profiler sections of the whole run (min/avg/max per block) as CSV\n"
+            "  -l  list the audio devices and the MIDI inputs\n",
+            name, host::kPotDefault);
+    host::PrintAnalogInputNames();
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    int device = kNoDevice;
+    int midi_port = kNoDevice;
+    float seconds = 0.0f;
+    bool list = false;
+
+    host::InitAnalogInputs();
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        if (strcmp(arg, "-l") == 0)
+        {
+            list = true;
+            continue;
+        }
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr || arg[0] != '-' || strlen(arg) != 2)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        i++;
+
+        bool ok = true;
+        switch (arg[1])
+        {
+        case 'd':
+            device = static_cast<int>(strtol(value, nullptr, 10));
+            ok = device >= 0;
+            break;
+        case 'm':
+            midi_port = static_cast<int>(strtol(value, nullptr, 10));
+            ok = midi_port >= 0;
+            break;
+        case 'c':
+            ok = MapCc(value);
+            break;
+        case 's':
+            seconds = strtof(value, nullptr);
+            ok = seconds > 0.0f;
+            break;
+        case 'a':
+            ok = host::SetAnalogInput(value);
+            break;
+        case 'u':
+            ok = host::LoadUserData(value);
+            break;
+        case 'p':
+            profile_path = value;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "Invalid argument: %s %s\n", arg, value);
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const PaError error = Pa_Initialize();
+    if (error != paNoError)
+    {
+        fprintf(stderr, "Audio: %s\n", Pa_GetErrorText(error));
+        return EXIT_FAILURE;
+    }
+    if (list)
+    {
+        ListDevices();
+        Pa_Terminate();
+        return EXIT_SUCCESS;
+    }
+    if (!OpenStream(device) || !OpenMidi(midi_port))
+    {
+        Stop(EXIT_FAILURE);
+    }
+    if (has_input)
+    {
+        // The audio input jack is plugged
+        host::SetGpioInput(kAudioInDetectPin, true);
+    }
+
+    if (seconds > 0.0f)
+    {
+        blocks_left = std::max<size_t>(static_cast<size_t>(seconds * I2S_SAMPLE_RATE / I2S::kAudioBufferSize), 1);
+    }
+    std::signal(SIGINT, RequestStop);
+
+    host::SetTimeLimit(kStartupTimeLimitUs);
+    host::SetTaskHook(LiveBlock);
+
+    return kastle2_app_main();
+}
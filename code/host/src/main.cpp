@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Host renderer: runs an app's main() with the emulated hardware and renders its audio into a WAV file
+//
+// Every UI loop (tud_task() in Kastle2::ReadInputs) runs one full ADC multiplexer cycle
+// and one audio block, so the UI runs at the audio block rate and the render is deterministic.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "common/core/Hardware.hpp"
+#include "HostPlatform.hpp"
+#include "RunnerCommon.hpp"
+#include "WavFile.hpp"
+
+using namespace kastle2;
+
+int kastle2_app_main();
+
+namespace
+{
+
+/**
+ * @brief Virtual time the app can spend before starting the audio (startup messages etc.).
+ */
+constexpr uint64_t kStartupTimeLimitUs = 10 * 1000000ull;
+
+constexpr uint32_t kAudioInDetectPin = Hardware::PIN_AUDIO_IN_DETECT;
+
+host::WavReader input_wav;
+host::WavWriter output_wav;
+size_t blocks_left = 0;
+std::string profile_path;
+bool in_task_hook = false;
+
+void RenderBlock()
+{
+    // The audio callback may call the UI code too (not on the hardware, but be safe)
+    if (in_task_hook)
+    {
+        return;
+    }
+    in_task_hook = true;
+
+    host::RunAdcCycle();
+
+    I2S::AudioCallback callback = host::GetAudioCallback();
+    if (callback != nullptr)
+    {
+        int32_t input[I2S::kAudioBufferFrames];
+        int32_t output[I2S::kAudioBufferFrames] = {};
+        input_wav.Read(input, I2S::kAudioBufferSize);
+        callback(input, output, I2S::kAudioBufferSize);
+        output_wav.Write(output, I2S::kAudioBufferSize);
+        host::AdvanceTime(I2S::kAudioBufferSize * 1000000ull / I2S_SAMPLE_RATE);
+
+        if (--blocks_left == 0)
+        {
+            output_wav.Close();
+            host::WriteProfile(profile_path);
+            // The second core thread never returns, just leave
+            std::_Exit(EXIT_SUCCESS);
+        }
+    }
+    else
+    {
+        host::AdvanceTime(I2S::kAudioBufferSize * 1000000ull / I2S_SAMPLE_RATE);
+    }
+
+    in_task_hook = false;
+}
+
+void PrintUsage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-i input.wav] [-o output.wav] [-s seconds] [-a NAME=raw]... [-u user_data.bin] [-p profile.csv]\n"
+            "  -i  16-bit PCM input (mono or stereo), silence when missing or finished\n"
+            "  -o  16-bit stereo output (default output.wav)\n"
+            "  -s  length of the render in seconds (default 5)\n"
+            "  -a  raw ADC reading 0-4095 of an analog input, pots default to %u, the rest to 0\n"
+            "  -u  user data file (the same as uploaded to the user data section)\n"
+            "  -p  Profiler sections of the whole render (min/avg/max per block) as CSV\n",
+            name, host::kPotDefault);
+    host::PrintAnalogInputNames();
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    std::string input_path;
+    std::string output_path = "output.wav";
+    float seconds = 5.0f;
+
+    host::InitAnalogInputs();
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr || arg[0] != '-' || strlen(arg) != 2)
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        i++;
+
+        bool ok = true;
+        switch (arg[1])
+        {
+        case 'i':
+            input_path = value;
+            break;
+        case 'o':
+            output_path = value;
+            break;
+        case 's':
+            seconds = strtof(value, nullptr);
+            ok = seconds > 0.0f;
+            break;
+        case 'a':
+            ok = host::SetAnalogInput(value);
+            break;
+        case 'u':
+            ok = host::LoadUserData(value);
+            break;
+        case 'p':
+            profile_path = value;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "Invalid argument: %s %s\n", arg, value);
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!input_path.empty())
+    {
+        std::string error;
+        if (!input_wav.Open(input_path, error))
+        {
+            fprintf(stderr, "%s: %s\n", input_path.c_str(), error.c_str());
+            return EXIT_FAILURE;
+        }
+        if (input_wav.GetSampleRate() != I2S_SAMPLE_RATE)
+        {
+            fprintf(stderr, "Warning: %s is %u Hz, it is processed as %u Hz\n",
+                    input_path.c_str(), input_wav.GetSampleRate(), static_cast<unsigned>(I2S_SAMPLE_RATE));
+        }
+        // The audio input jack is plugged
+        host::SetGpioInput(kAudioInDetectPin, true);
+    }
+
+    if (!output_wav.Open(output_path, I2S_SAMPLE_RATE))
+    {
+        fprintf(stderr, "%s: cannot create file\n", output_path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    blocks_left = static_cast<size_t>(seconds * I2S_SAMPLE_RATE / I2S::kAudioBufferSize);
+    if (blocks_left == 0)
+    {
+        blocks_left = 1;
+    }
+
+    host::SetTimeLimit(kStartupTimeLimitUs + static_cast<uint64_t>(seconds * 1000000.0f));
+    host::SetTaskHook(RenderBlock);
+
+    return kastle2_app_main();
+}
@@ -0,0 +1,88 @@
+#
+# MIT License
+# Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+#
+
+# Kastle 2 common sources, expects SRC and LIBRARIES to be set
+# When creating a new cpp file in "src/common", add it here
+# Add app-specific sources in each app's CMakeLists.txt
+SET(KASTLE2_COMMON_SOURCES 
+    ${SRC}/common/core/Base.cpp
+    ${SRC}/common/core/Kastle2.cpp
+    ${SRC}/common/core/clocks/InternalClockSource.cpp
+    ${SRC}/common/core/clocks/ExternalClockSource.cpp
+    ${SRC}/common/core/clocks/MidiClockSource.cpp
+    ${SRC}/common/core/midi/Handler.cpp
+    ${SRC}/common/core/midi/Message.cpp
+    ${SRC}/common/core/Clock.cpp
+    ${SRC}/common/core/ClockGovernor.cpp
+    ${SRC}/common/core/ClockPlan.cpp
+    ${SRC}/common/core/Hardware.cpp
+    ${SRC}/common/core/InputEdges.cpp
+    ${SRC}/common/core/LedAnimator.cpp
+    ${SRC}/common/core/LevelMeter.cpp
+    ${SRC}/common/core/Memory.cpp
+    ${SRC}/common/core/MultiCore.cpp
+    ${SRC}/common/core/UsbAudio.cpp
+    ${SRC}/common/core/AudioClockSync.cpp
+    ${SRC}/common/core/FlashWriter.cpp
+    ${SRC}/common/core/Crc.cpp
+    ${SRC}/common/core/DmaFill.cpp
+    ${SRC}/common/core/UserDataFile.cpp
+    ${SRC}/common/core/UserDataUploader.cpp
+    ${SRC}/common/core/SysExTransfer.cpp
+    ${SRC}/common/core/SyncLink.cpp
+    ${SRC}/common/core/PresetStore.cpp
+    ${SRC}/common/controls/FancyPot.cpp
+    ${SRC}/common/controls/FancyMode.cpp
+    ${SRC}/common/debug/UsbSerial.cpp
+    ${SRC}/common/debug/InputRecorder.cpp
+    ${SRC}/common/debug/MemoryMonitor.cpp
+    ${SRC}/common/debug/Profiler.cpp
+    ${SRC}/common/debug/Telemetry.cpp
+    ${SRC}/common/debug/AudioClockMonitor.cpp
+    ${SRC}/common/debug/PostMortem.cpp
+    ${SRC}/common/debug/SEGGER_RTT.c
+    ${SRC}/common/fastcode.cpp
+    ${SRC}/common/peripherals/NAU88C22.cpp
+    ${SRC}/common/peripherals/AT24C.cpp
+    ${SRC}/common/peripherals/I2cBus.cpp
+    ${SRC}/common/peripherals/PioDebouncer.cpp
+    ${SRC}/common/peripherals/WS2812.cpp
+    ${SRC}/common/testmode/TestMode.cpp
+    ${SRC}/common/testmode/TestEntry.cpp
+    ${SRC}/common/testmode/TestScheduler.cpp
+    ${SRC}/common/testmode/LatencyMeter.cpp
+    ${SRC}/common/testmode/version_samples.cpp
+    ${SRC}/common/dsp/synthesis/Oscillator.cpp
+    ${SRC}/common/dsp/synthesis/OscillatorQ15.cpp
+    ${SRC}/common/dsp/synthesis/MultiOscillator.cpp
+    ${SRC}/common/dsp/synthesis/WavetableOscillator.cpp
+    ${SRC}/common/dsp/synthesis/Fm2.cpp
+    ${SRC}/common/dsp/control/AdsrEnv.cpp
+    ${SRC}/common/dsp/control/Lfo.cpp
+    ${SRC}/common/dsp/control/EnvelopeFollower.cpp
+    ${SRC}/common/dsp/filters/Svf.cpp
+    ${SRC}/common/dsp/filters/SvfStereo.cpp
+    ${SRC}/common/dsp/filters/DjFilter.cpp
+    ${SRC}/common/dsp/filters/DjFilterStereo.cpp
+    ${SRC}/common/dsp/math/Fft.cpp
+    ${SRC}/common/dsp/math/FftQ15.cpp
+    ${SRC}/common/dsp/utility/Quantizer.cpp
+    ${SRC}/common/dsp/utility/SignalCorrelator.cpp
+    ${SRC}/common/dsp/utility/Sequencer.cpp
+    ${SRC}/common/dsp/utility/Portamento.cpp
+    ${SRC}/common/dsp/utility/KastleRungler.cpp
+    ${SRC}/common/dsp/effects/HardClipper.cpp
+    ${SRC}/common/dsp/effects/SoftClipper.cpp
+    ${SRC}/common/dsp/effects/StereoDelay.cpp
+    ${SRC}/common/dsp/effects/PlateReverb.cpp
+    ${SRC}/common/dsp/effects/PitchShifter.cpp
+    ${SRC}/common/dsp/effects/Compressor.cpp
+    ${SRC}/common/dsp/effects/CorrectingTrackAndHold.cpp
+    ${SRC}/common/dsp/sampling/GranularCloud.cpp
+    ${SRC}/common/dsp/control/BeatDetector.cpp
+    ${SRC}/common/dsp/control/PitchTracker.cpp
+    ${SRC}/usb_descriptors.c
+    ${LIBRARIES}/I2S.cpp
+)
@@ -38,27 +38,86 @@
 
 #include "I2S.hpp"
 
-I2S::FractionalDivider I2S::CalculateDivider(float target_frequency)
+I2S::FractionalDivider I2S::CalculateDivider(float target_frequency, float sys_clk)
 {
-    float sys_clk = static_cast<float>(clock_get_hz(clk_sys));
     float divider = sys_clk / target_frequency;
     uint16_t int_div = static_cast<uint16_t>(divider);
     uint8_t frac_div = static_cast<uint8_t>((divider - int_div) * 256.0f + 0.5f);
     return FractionalDivider{int_div, frac_div};
 }
 
-I2S::FractionalDivider I2S::GetMclkDivider()
+I2S::FractionalDivider I2S::GetMclkDivider(float sys_clk)
 {
-    float mclk_freq = kMclkMult * sample_rate_;
-    float pio_freq = 2.0f * mclk_freq; // Toggle loop = 2 instructions per cycle
-    return CalculateDivider(pio_freq);
+    return CalculateDivider(MclkPioFrequency(sample_rate_), sys_clk);
 }
 
-I2S::FractionalDivider I2S::GetBclkDivider()
+I2S::FractionalDivider I2S::GetBclkDivider(float sys_clk)
 {
-    float bclk_freq = sample_rate_ * kBitDepth * 2.0f; // sample rate * bit depth * 2 (for stereo)
-    float pio_freq = 2.0f * bclk_freq;
-    return CalculateDivider(pio_freq);
+    return CalculateDivider(BclkPioFrequency(sample_rate_), sys_clk);
+}
+
+I2S::ClockDividers I2S::GetClockDividers(const uint32_t system_clock_hz)
+{
+    const float sys_clk = static_cast<float>(system_clock_hz);
+    return {GetMclkDivider(sys_clk), GetBclkDivider(sys_clk)};
+}
+
+void I2S::SetClockDividers(const ClockDividers &dividers)
+{
+    if (callback_ == nullptr)
+    {
+        return;
+    }
+    // The same trim is a different number of steps of the new dividers
+    dividers_ = dividers;
+    trim_steps_ = TrimSteps(dividers, trim_ppb_);
+    WriteDividers(dividers, trim_applied_);
+}
+
+void I2S::SetClockTrim(const int32_t ppb)
+{
+    const int32_t trim = ppb < -kMaxClockTrimPpb ? -kMaxClockTrimPpb : (ppb > kMaxClockTrimPpb ? kMaxClockTrimPpb : ppb);
+    // The dividers change in the audio callback (ClockGovernor)
+    uint32_t interrupt_state = save_and_disable_interrupts();
+    trim_ppb_ = trim;
+    trim_steps_ = TrimSteps(dividers_, trim);
+    restore_interrupts(interrupt_state);
+}
+
+int32_t I2S::TrimSteps(const ClockDividers &dividers, const int32_t ppb)
+{
+    // One step is 1 / divider of the rate, the divider in the steps is its 16.8 fixed point value
+    const int64_t divider = (static_cast<int64_t>(dividers.mclk.div) << 8) | dividers.mclk.frac;
+    return static_cast<int32_t>((static_cast<int64_t>(ppb) * divider << 16) / 1000000000);
+}
+
+void I2S::WriteDividers(const ClockDividers &dividers, const int32_t steps)
+{
+    // A smaller divider runs faster
+    const uint32_t mclk = ((static_cast<uint32_t>(dividers.mclk.div) << 8) | dividers.mclk.frac) - steps;
+    const uint32_t bclk = ((static_cast<uint32_t>(dividers.bclk.div) << 8) | dividers.bclk.frac) - steps * kBclkTrimSteps;
+    pio_sm_set_clkdiv_int_frac(pio_, sm_mclk_, static_cast<uint16_t>(mclk >> 8), static_cast<uint8_t>(mclk));
+    pio_sm_set_clkdiv_int_frac(pio_, sm_din_, static_cast<uint16_t>(mclk >> 8), static_cast<uint8_t>(mclk));
+    pio_sm_set_clkdiv_int_frac(pio_, sm_dout_, static_cast<uint16_t>(bclk >> 8), static_cast<uint8_t>(bclk));
+}
+
+void I2S::TrimClocks()
+{
+    const int32_t trim = trim_steps_;
+    if (trim == 0 && trim_applied_ == 0)
+    {
+        return;
+    }
+
+    // The whole steps and the carry of the fraction, the blocks average to the trim
+    trim_phase_ += static_cast<uint32_t>(trim) & 0xFFFF;
+    const int32_t steps = (trim >> 16) + static_cast<int32_t>(trim_phase_ >> 16);
+    trim_phase_ &= 0xFFFF;
+    if (steps != trim_applied_)
+    {
+        trim_applied_ = steps;
+        WriteDividers(dividers_, steps);
+    }
 }
 
 void I2S::StartAudio(AudioCallback callback)
@@ -67,7 +126,8 @@ void I2S::StartAudio(AudioCallback callback)
     pio_ = pio0; // Using PIO0 for I2S
 
     // Initialize MCLK (Master Clock)
-    auto mclk_clock = GetMclkDivider();
+    const float sys_clk = static_cast<float>(clock_get_hz(clk_sys));
+    auto mclk_clock = GetMclkDivider(sys_clk);
     sm_mclk_ = pio_claim_unused_sm(pio_, true);
     uint32_t mclk_offset = pio_add_program(pio_, &i2s_mclk_program);
     i2s_mclk_program_init(pio_, sm_mclk_, mclk_offset, pins_.mclk);
@@ -80,11 +140,13 @@ void I2S::StartAudio(AudioCallback callback)
     pio_sm_set_clkdiv_int_frac(pio_, sm_din_, mclk_clock.div, mclk_clock.frac);
 
     // Initialize DOUT (Data Output)
-    auto bclk_clock = GetBclkDivider();
+    auto bclk_clock = GetBclkDivider(sys_clk);
     sm_dout_ = pio_claim_unused_sm(pio_, true);
     uint32_t dout_offset = pio_add_program(pio_, &i2s_dout_program);
     i2s_dout_program_init(pio_, sm_dout_, dout_offset, pins_.dout, pins_.bclk, kBitDepth);
     pio_sm_set_clkdiv_int_frac(pio_, sm_dout_, bclk_clock.div, bclk_clock.frac);
+    dividers_ = {mclk_clock, bclk_clock};
+    trim_steps_ = TrimSteps(dividers_, trim_ppb_);
 
     // Initialize DMA and start state machines
     DmaInit();
@@ -188,8 +250,12 @@ void I2S::DmaHandler()
     }
 
     // Determine which buffer the DMA is currently reading to by checking the read address of the control channel
+    const uint32_t start_us = time_us_32();
+    instance_->irq_time_us_ = start_us;
+    instance_->TrimClocks();
+    const uint32_t ctrl_read_addr = dma_hw->ch[instance_->dma_din_ctrl_].read_addr;
     size_t buffer_idx = 0;
-    if (dma_hw->ch[instance_->dma_din_ctrl_].read_addr == (size_t)&instance_->din_ptr_[0])
+    if (ctrl_read_addr == (size_t)&instance_->din_ptr_[0])
     {
         buffer_idx = 0;
     }
@@ -198,23 +264,80 @@ void I2S::DmaHandler()
         buffer_idx = 1;
     }
 
-    // Scale down input to 16 bits
-    for (size_t i = 0; i < kAudioBufferFrames; i++)
+    // Scale down input to 16 bits and remove its DC, in place
+    int32_t *input = instance_->input_buffers_[buffer_idx];
+    if (instance_->input_dc_blocker_)
     {
-        instance_->input_buffers_[buffer_idx][i] = downscale_to_16bits(instance_->input_buffers_[buffer_idx][i]);
+        // The estimates of the previous blocks are subtracted, the sums of this one update them
+        int32_t *dc = instance_->input_dc_;
+        const int32_t dc_left = dc[0] >> kDcBlockerShift;
+        const int32_t dc_right = dc[1] >> kDcBlockerShift;
+        int32_t sum_left = 0;
+        int32_t sum_right = 0;
+        for (size_t i = 0; i < kAudioBufferFrames; i += 2)
+        {
+            const int32_t left = input[i] >> 16;
+            const int32_t right = input[i + 1] >> 16;
+            sum_left += left;
+            sum_right += right;
+            input[i] = saturate_16bits(left - dc_left);
+            input[i + 1] = saturate_16bits(right - dc_right);
+        }
+
+        // One pole lowpass of the DC, dc += (mean - dc) * kAudioBufferSize / 2^kDcBlockerShift
+        dc[0] += sum_left - dc_left * static_cast<int32_t>(kAudioBufferSize);
+        dc[1] += sum_right - dc_right * static_cast<int32_t>(kAudioBufferSize);
+    }
+    else
+    {
+        for (size_t i = 0; i < kAudioBufferFrames; i++)
+        {
+            input[i] = input[i] >> 16;
+        }
     }
 
     // Process audio in 16 bits
-    instance_->callback_(instance_->input_buffers_[buffer_idx],
-                         instance_->output_buffers_[buffer_idx],
-                         kAudioBufferSize);
+    int32_t *output = instance_->output_buffers_[buffer_idx];
+    instance_->callback_(input, output, kAudioBufferSize);
 
-    // Scale back audio to 32 bits
+    // Add the output DC offset and scale back audio to 32 bits, in place
+    const int32_t output_dc_offset = instance_->output_dc_offset_;
     for (size_t i = 0; i < kAudioBufferFrames; i++)
     {
-        instance_->output_buffers_[buffer_idx][i] = upscale_to_32bits(instance_->output_buffers_[buffer_idx][i]);
+        output[i] = upscale_to_32bits(output[i], output_dc_offset);
+    }
+
+    // DMA has already swapped the buffers again, so we were too late
+    if (dma_hw->ch[instance_->dma_din_ctrl_].read_addr != ctrl_read_addr)
+    {
+        UnderrunEvent &event = instance_->underrun_log_[instance_->underrun_count_ % kUnderrunLogSize];
+        event.timestamp_us = start_us;
+        event.duration_us = time_us_32() - start_us;
+        event.tag = instance_->underrun_tag_;
+        instance_->underrun_count_ = instance_->underrun_count_ + 1;
     }
 
     // Clear the interrupt
     dma_hw->ints0 = 1u << instance_->dma_din_data_;
-}
\ No newline at end of file
+}
+
+bool I2S::GetUnderrunEvent(const size_t age, UnderrunEvent &event) const
+{
+    // The log is written from the DMA interrupt
+    uint32_t interrupt_state = save_and_disable_interrupts();
+    const uint32_t count = underrun_count_;
+    const bool valid = age < count && age < kUnderrunLogSize;
+    if (valid)
+    {
+        event = underrun_log_[(count - 1 - age) % kUnderrunLogSize];
+    }
+    restore_interrupts(interrupt_state);
+    return valid;
+}
+
+void I2S::ClearUnderruns()
+{
+    uint32_t interrupt_state = save_and_disable_interrupts();
+    underrun_count_ = 0;
+    restore_interrupts(interrupt_state);
+}
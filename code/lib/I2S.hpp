@@ -46,6 +46,13 @@
 
 #include "I2S.pio.h"
 
+/**
+ * @brief Audio block size in frames, set per app (APP_AUDIO_BUFFER_SIZE in create_kastle2_app).
+ */
+#ifndef KASTLE2_AUDIO_BUFFER_SIZE
+#define KASTLE2_AUDIO_BUFFER_SIZE 48
+#endif
+
 /**
  * @class I2S
  * @brief I2S audio input/output driver for the Raspberry Pi Pico (RP2040)
@@ -59,7 +66,10 @@ public:
     /**
      * @brief Audio buffer size per channel (in frames)
      */
-    static constexpr size_t kAudioBufferSize = 48;
+    static constexpr size_t kAudioBufferSize = KASTLE2_AUDIO_BUFFER_SIZE;
+    static_assert(kAudioBufferSize == 16 || kAudioBufferSize == 32 || kAudioBufferSize == 48 ||
+                      kAudioBufferSize == 96 || kAudioBufferSize == 128,
+                  "Supported audio block sizes are 16, 32, 48, 96 and 128 frames");
 
     /**
      * @brief Total audio buffer frames (both channels)
@@ -103,10 +113,6 @@ public:
      */
     void StartAudio(const AudioCallback callback);
 
-private:
-    static constexpr float kMclkMult = 256.0f; ///< MCLK multiplier for I2S (typically 256)
-    static constexpr float kBitDepth = 32.0f;  ///< We scale it down for processing but we use 32-bits for the communication
-
     /**
      * @brief Fractional divider structure for PIO clocking.
      */
@@ -116,24 +122,206 @@ private:
         uint8_t frac; ///< Fractional part of the divider (8-bit)
     };
 
+    /**
+     * @brief PIO dividers of the state machines for one system clock.
+     */
+    struct ClockDividers
+    {
+        FractionalDivider mclk; ///< MCLK and DIN state machines
+        FractionalDivider bclk; ///< DOUT state machine
+    };
+
+    /**
+     * @brief Calculates the PIO dividers keeping the I2S clocks at the sample rate on another system clock.
+     * @param system_clock_hz The system clock.
+     * @return Dividers for SetClockDividers().
+     */
+    ClockDividers GetClockDividers(const uint32_t system_clock_hz);
+
+    /**
+     * @brief Moves the running state machines to other dividers (after a system clock change).
+     * @note Write them right after changing the system clock, so the I2S clocks are off for as short as possible.
+     *       Does nothing before StartAudio(), which takes the current system clock.
+     * @param dividers Dividers from GetClockDividers().
+     */
+    void SetClockDividers(const ClockDividers &dividers);
+
+    /**
+     * @brief Largest clock trim in ppb, the USB frames of a host are within 500 ppm.
+     */
+    static constexpr int32_t kMaxClockTrimPpb = 1000000;
+
+    /**
+     * @brief Runs the I2S clocks faster (slower when negative) than the sample rate, to follow an external reference.
+     * @details The PIO dividers have 8 fractional bits, hundreds of ppm at the usual dividers. The DMA interrupt switches
+     *          the state machines between the two nearest dividers from block to block (first order noise shaping),
+     *          so their average is the trim. MCLK and BCLK change together and keep their ratio. A few cycles per block.
+     * @param ppb Trim in parts per billion, limited to kMaxClockTrimPpb.
+     */
+    void SetClockTrim(const int32_t ppb);
+
+    /**
+     * @brief Gets the trim set by SetClockTrim().
+     * @return Trim in parts per billion.
+     */
+    int32_t GetClockTrim() const
+    {
+        return trim_ppb_;
+    }
+
+    /**
+     * @brief Checks if the PIO clocks are exact on the system clock (the 8 bit fractional dividers have no jitter).
+     * @param system_clock_hz System clock.
+     * @param sample_rate Sample rate of the audio.
+     * @return True if both dividers are exact and at least 1.
+     */
+    static constexpr bool IsExactSystemClock(const uint32_t system_clock_hz, const float sample_rate)
+    {
+        const uint64_t mclk = static_cast<uint64_t>(MclkPioFrequency(sample_rate));
+        const uint64_t bclk = static_cast<uint64_t>(BclkPioFrequency(sample_rate));
+        const uint64_t clock = static_cast<uint64_t>(system_clock_hz) * 256;
+        return system_clock_hz >= mclk && clock % mclk == 0 && clock % bclk == 0;
+    }
+
+    /**
+     * @brief Number of underrun events kept in the log
+     */
+    static constexpr size_t kUnderrunLogSize = 8;
+
+    /**
+     * @brief Single underrun event (the callback didn't finish before DMA moved to the next buffer)
+     */
+    struct UnderrunEvent
+    {
+        uint32_t timestamp_us; ///< Time when the late callback started
+        uint32_t duration_us;  ///< How long the late callback took
+        uint32_t tag;          ///< User tag active at the time (app mode etc.)
+    };
+
+    /**
+     * @brief Gets the number of underruns since the start (or the last ClearUnderruns()).
+     * @return Underrun count.
+     */
+    uint32_t GetUnderrunCount() const
+    {
+        return underrun_count_;
+    }
+
+    /**
+     * @brief Gets an event from the underrun log.
+     * @param age 0 for the newest event, 1 for the one before...
+     * @param event Event to fill.
+     * @return True if there is such event in the log.
+     */
+    bool GetUnderrunEvent(const size_t age, UnderrunEvent &event) const;
+
+    /**
+     * @brief Clears the underrun count and the log.
+     */
+    void ClearUnderruns();
+
+    /**
+     * @brief Sets a tag stored with each underrun event, so it's possible to tell what was running.
+     * @param tag Any value meaningful to the app (mode, parameter combination...).
+     */
+    void SetUnderrunTag(const uint32_t tag)
+    {
+        underrun_tag_ = tag;
+    }
+
+    /**
+     * @brief Gets the time of the last DMA interrupt entry, before the conversion passes and the callback.
+     * @return time_us_32() at the entry.
+     */
+    uint32_t GetIrqTime() const
+    {
+        return irq_time_us_;
+    }
+
+    /**
+     * @brief Turns on the input DC blocker, run in the same pass as the 32/16-bit conversion.
+     * @details Each channel's DC is tracked from the block sums and the estimate is subtracted from the next block,
+     * so it follows the codec offset of the unit and its drift with temperature. Starts from zero.
+     * @param enabled True to remove the input DC.
+     */
+    void SetInputDcBlocker(const bool enabled)
+    {
+        input_dc_blocker_ = enabled;
+        input_dc_[0] = 0;
+        input_dc_[1] = 0;
+    }
+
+    /**
+     * @brief Sets a DC offset added to the output in the same pass as the 16/32-bit conversion.
+     * @details The output offset comes after the DAC, out of the firmware's sight, so it stays a constant.
+     * @param offset Added to each output sample after the callback (16-bit scale, saturated).
+     */
+    void SetOutputDcOffset(const int32_t offset)
+    {
+        output_dc_offset_ = offset;
+    }
+
+private:
+    static constexpr float kMclkMult = 256.0f; ///< MCLK multiplier for I2S (typically 256)
+    static constexpr float kBitDepth = 32.0f;  ///< We scale it down for processing but we use 32-bits for the communication
+
+    /**
+     * @brief PIO clock of the MCLK and DIN state machines (toggle loop = 2 instructions per cycle).
+     */
+    static constexpr float MclkPioFrequency(const float sample_rate)
+    {
+        return 2.0f * kMclkMult * sample_rate;
+    }
+
+    /**
+     * @brief PIO clock of the DOUT state machine (sample rate * bit depth * 2 for stereo, 2 instructions per bit).
+     */
+    static constexpr float BclkPioFrequency(const float sample_rate)
+    {
+        return 2.0f * sample_rate * kBitDepth * 2.0f;
+    }
+
+    /**
+     * @brief BCLK divider steps per MCLK divider step, MclkPioFrequency() is 4 times BclkPioFrequency().
+     */
+    static constexpr int32_t kBclkTrimSteps = 4;
+
+    /**
+     * @brief Converts a trim to 1/65536 of the MCLK divider's fractional step.
+     */
+    static int32_t TrimSteps(const ClockDividers &dividers, const int32_t ppb);
+
+    /**
+     * @brief Writes the dividers of all the state machines, steps of the MCLK divider's fractional part faster.
+     */
+    void WriteDividers(const ClockDividers &dividers, const int32_t steps);
+
+    /**
+     * @brief Moves the state machines to the divider step of this block, called by the DMA interrupt.
+     */
+    void TrimClocks();
+
     /**
      * @brief Calculates the fractional divider for a given target frequency.
      * @param target_frequency_hz Target frequency in Hz.
+     * @param system_clock_hz System clock the PIO runs at.
      * @return FractionalDivider containing the integer and fractional parts of the divider.
      */
-    FractionalDivider CalculateDivider(float target_frequency_hz);
+    FractionalDivider CalculateDivider(float target_frequency_hz, float system_clock_hz);
 
     /**
      * @brief Gets the MCLK divider based on the sample rate.
+     * @param system_clock_hz System clock the PIO runs at.
      * @return FractionalDivider for MCLK.
      */
-    FractionalDivider GetMclkDivider();
+    FractionalDivider GetMclkDivider(float system_clock_hz);
 
     /**
      * @brief Gets the BCLK divider based on the sample rate and bit depth.
+     * @param system_clock_hz System clock the PIO runs at.
      * @return FractionalDivider for BCLK.
      */
-    FractionalDivider GetBclkDivider();
+    FractionalDivider GetBclkDivider(float system_clock_hz);
 
     /**
      * @brief Initialize double-buffered DMA for I2S
@@ -168,21 +356,41 @@ private:
     float sample_rate_ = 0.0f;
 
     /**
-     * @brief Converts a q15_t to a q31_t.
+     * @brief Time constant of the input DC blocker, 2^14 samples (cutoff about 0.4 Hz at 44.1 kHz).
      */
-    static inline constexpr int32_t upscale_to_32bits(const int32_t x)
+    static constexpr uint32_t kDcBlockerShift = 14;
+
+    bool input_dc_blocker_ = false; ///< Input DC removed (see SetInputDcBlocker)
+    int32_t input_dc_[2] = {0, 0};  ///< Input DC estimates of the left and right channel, << kDcBlockerShift
+    int32_t output_dc_offset_ = 0;  ///< Added in the output conversion pass (see SetOutputDcOffset)
+
+    /**
+     * @brief Saturates to the 16-bit range.
+     */
+    static inline constexpr int32_t saturate_16bits(const int32_t x)
     {
-        return x << 16;
+        return x > INT16_MAX ? INT16_MAX : (x < INT16_MIN ? INT16_MIN : x);
     }
 
     /**
-     * @brief Converts a q31_t to a q15_t.
+     * @brief Converts a q15_t to a q31_t, adding the offset first.
      */
-    static inline constexpr int32_t downscale_to_16bits(const int32_t x)
+    static inline constexpr int32_t upscale_to_32bits(const int32_t x, const int32_t offset)
     {
-        return x >> 16;
+        return saturate_16bits(x + offset) << 16;
     }
 
+    ClockDividers dividers_{};        ///< Dividers of the current system clock, without the trim
+    int32_t trim_ppb_ = 0;            ///< Trim set by SetClockTrim()
+    volatile int32_t trim_steps_ = 0; ///< The trim in 1/65536 of the MCLK divider's fractional step
+    uint32_t trim_phase_ = 0;         ///< Noise shaping accumulator of the steps below one
+    int32_t trim_applied_ = 0;        ///< Whole steps the state machines run at
+
+    volatile uint32_t irq_time_us_ = 0;             ///< Entry of the last DMA interrupt
+    volatile uint32_t underrun_count_ = 0;           ///< Total underruns, also the write position in the log
+    volatile uint32_t underrun_tag_ = 0;             ///< Tag stored with new underrun events
+    UnderrunEvent underrun_log_[kUnderrunLogSize]{}; ///< Ring of the latest underrun events
+
     PIO pio_;
     uint32_t sm_mclk_;
     uint32_t sm_dout_;
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+
+# Fastcode report for the Kastle 2 firmwares, run after each link (see configure_linker_script in CMakeLists.txt)
+#
+# Lists the functions placed in the .fastcode section with their sizes, the FASTCODE region budget
+# from the linker script and the largest functions still executed from the QSPI flash (XIP).
+# It also checks the hot function lists, so misspelled or inlined entries don't go unnoticed,
+# and shows the RAM taken by the FASTDATA lookup tables (between __fastdata_start__ and __fastdata_end__).
+
+import argparse
+import fnmatch
+import os
+import re
+import subprocess
+import sys
+from typing import Dict, List, NamedTuple, Tuple
+
+# Regions reported by name, the rest of RAM is "other RAM"
+FASTCODE_REGION = 'FASTCODE'
+FLASH_REGION = 'FLASH'
+RAM_REGIONS = ('RAM', 'SCRATCH_X', 'SCRATCH_Y')
+
+# Function symbol types printed by nm
+FUNCTION_TYPES = 'tTwW'
+# Data symbol types printed by nm (the FASTDATA tables end up in .data)
+DATA_TYPES = 'dDrRvV'
+
+
+class Function(NamedTuple):
+    address: int
+    size: int
+    name: str
+    demangled: str
+
+
+def parse_memory_regions(linker_script: str) -> Dict[str, Tuple[int, int]]:
+    """Reads the MEMORY regions of the linker script. Returns {name: (origin, length)}."""
+    units = {'': 1, 'k': 1024, 'K': 1024, 'm': 1024 * 1024, 'M': 1024 * 1024}
+    pattern = re.compile(r'^\s*(\w+)\s*\(\w+\)\s*:\s*ORIGIN\s*=\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*LENGTH\s*=\s*(\d+)([kKmM]?)')
+    regions = {}
+    with open(linker_script, 'r') as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                name, origin, length, unit = match.groups()
+                regions[name] = (int(origin, 0), int(length) * units[unit])
+    return regions
+
+
+def run_nm(nm: str, elf: str, demangle: bool) -> List[List[str]]:
+    """Runs nm in the symbol table order, so the plain and demangled outputs can be zipped."""
+    command = [nm, '--defined-only', '--print-size', '--no-sort']
+    if demangle:
+        command.append('--demangle')
+    output = subprocess.run(command + [elf], check=True, capture_output=True, text=True).stdout
+    return [line.split(maxsplit=3) for line in output.splitlines()]
+
+
+def read_symbols(plain_rows: List[List[str]], demangled_rows: List[List[str]], types: str) -> List[Function]:
+    symbols = []
+    for plain, demangled in zip(plain_rows, demangled_rows):
+        # Symbols without size have only 3 fields
+        if len(plain) != 4 or plain[2] not in types:
+            continue
+        # Thumb functions have the lowest address bit set
+        address = int(plain[0], 16) & ~1
+        size = int(plain[1], 16)
+        symbols.append(Function(address, size, plain[3], demangled[3] if len(demangled) == 4 else plain[3]))
+    return symbols
+
+
+def read_marker(plain_rows: List[List[str]], name: str) -> int:
+    """Address of a symbol defined by the linker script (no size), -1 when missing."""
+    for row in plain_rows:
+        if len(row) == 3 and row[2] == name:
+            return int(row[0], 16)
+    return -1
+
+
+def read_hot_lists(files: List[str]) -> List[Tuple[str, str]]:
+    """Reads the hot function lists. Returns [(list file name, pattern)]."""
+    patterns = []
+    for file in files:
+        with open(file, 'r') as f:
+            for line in f:
+                line = line.split('#', 1)[0].strip()
+                if line:
+                    patterns.append((os.path.basename(file), line))
+    return patterns
+
+
+def region_of(address: int, regions: Dict[str, Tuple[int, int]]) -> str:
+    for name, (origin, length) in regions.items():
+        if origin <= address < origin + length:
+            return name
+    return '?'
+
+
+def placement(region: str) -> str:
+    if region == FASTCODE_REGION:
+        return 'FASTCODE'
+    if region == FLASH_REGION:
+        return 'flash (XIP)'
+    if region in RAM_REGIONS:
+        return 'other RAM'
+    return region
+
+
+def format_function(function: Function) -> str:
+    return f"  {function.size:6d}  0x{function.address:08x}  {function.demangled}"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Report the .fastcode usage and placement of the functions of a Kastle 2 firmware.')
+    parser.add_argument('elf', help='Linked firmware (ELF)')
+    parser.add_argument('--linker-script', required=True, help='Linker script used for the link (memory regions)')
+    parser.add_argument('--nm', default='arm-none-eabi-nm', help='nm executable')
+    parser.add_argument('--hot', default='', help='Comma separated hot function lists to check')
+    parser.add_argument('--top', type=int, default=50, help='Number of largest flash functions to list')
+    parser.add_argument('--warn-percent', type=float, default=90.0, help='Warn when FASTCODE is used more than this')
+    parser.add_argument('-o', '--output', help='Report file (default: stdout)')
+    args = parser.parse_args()
+
+    regions = parse_memory_regions(args.linker_script)
+    if FASTCODE_REGION not in regions:
+        sys.exit(f"No {FASTCODE_REGION} region in {args.linker_script}")
+    fastcode_size = regions[FASTCODE_REGION][1]
+
+    plain_rows = run_nm(args.nm, args.elf, False)
+    demangled_rows = run_nm(args.nm, args.elf, True)
+    functions = read_symbols(plain_rows, demangled_rows, FUNCTION_TYPES)
+    by_region: Dict[str, List[Function]] = {}
+    for function in functions:
+        by_region.setdefault(region_of(function.address, regions), []).append(function)
+
+    in_fastcode = sorted(by_region.get(FASTCODE_REGION, []), key=lambda f: f.address)
+    in_flash = sorted(by_region.get(FLASH_REGION, []), key=lambda f: f.size, reverse=True)
+    in_other_ram = [f for r in RAM_REGIONS for f in by_region.get(r, [])]
+
+    fastcode_used = sum(f.size for f in in_fastcode)
+    fastcode_percent = 100.0 * fastcode_used / fastcode_size
+    name = os.path.basename(args.elf)
+
+    lines = [f"Fastcode report: {name}", '']
+    lines.append(f"FASTCODE (RAM)  {fastcode_used:7d} / {fastcode_size} bytes ({fastcode_percent:.1f} %), "
+                 f"{fastcode_size - fastcode_used} bytes free, {len(in_fastcode)} functions")
+    lines.append(f"Flash (XIP)     {sum(f.size for f in in_flash):7d} bytes of code in {len(in_flash)} functions")
+    lines.append(f"Other RAM       {sum(f.size for f in in_other_ram):7d} bytes of code in {len(in_other_ram)} functions "
+                 "(pico-sdk .time_critical, libraries)")
+
+    # FASTDATA tables, copied to RAM with .data by the startup code
+    fastdata_start = read_marker(plain_rows, '__fastdata_start__')
+    fastdata_end = read_marker(plain_rows, '__fastdata_end__')
+    tables = []
+    if 0 <= fastdata_start <= fastdata_end:
+        tables = sorted((t for t in read_symbols(plain_rows, demangled_rows, DATA_TYPES)
+                         if fastdata_start <= t.address < fastdata_end), key=lambda t: t.size, reverse=True)
+        lines.append(f"FASTDATA (RAM)  {fastdata_end - fastdata_start:7d} bytes of lookup tables in {len(tables)} tables "
+                     "(part of .data)")
+    else:
+        lines.append('FASTDATA (RAM)  no __fastdata_start__ / __fastdata_end__ in the linker script')
+
+    # Hot lists: what each entry matched and where it ended up
+    warnings = []
+    hot_files = [file for file in args.hot.split(',') if file]
+    hot_patterns = read_hot_lists(hot_files)
+    if hot_patterns:
+        lines += ['', 'Hot function lists']
+        for file, pattern in hot_patterns:
+            matches = [f for f in functions if fnmatch.fnmatchcase(f.name, pattern)]
+            if not matches:
+                result = 'NO MATCH (misspelled, inlined or removed by the linker)'
+                warnings.append(f"{file}: '{pattern}' matches no function")
+            else:
+                places = sorted({placement(region_of(f.address, regions)) for f in matches})
+                result = f"{len(matches)} function(s), {sum(f.size for f in matches)} bytes, {', '.join(places)}"
+            lines.append(f"  {file}: {pattern:50s} {result}")
+
+    lines += ['', 'Functions in FASTCODE (RAM)', '    size  address     name']
+    lines += [format_function(f) for f in in_fastcode]
+
+    if tables:
+        lines += ['', 'Tables in FASTDATA (RAM)', '    size  address     name']
+        lines += [format_function(t) for t in tables]
+
+    lines += ['', f"Largest functions in flash (XIP), top {args.top}", '    size  address     name']
+    lines += [format_function(f) for f in in_flash[:args.top]]
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write('\n'.join(lines) + '\n')
+        fastdata = f", fastdata {fastdata_end - fastdata_start} bytes" if tables else ''
+        print(f"{name}: fastcode {fastcode_used} / {fastcode_size} bytes ({fastcode_percent:.1f} %){fastdata}, "
+              f"report in {args.output}")
+    else:
+        print('\n'.join(lines))
+
+    if fastcode_percent > args.warn_percent:
+        warnings.append(f"FASTCODE region is {fastcode_percent:.1f} % full")
+    for warning in warnings:
+        print(f"warning: {name}: {warning}")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+# Performance regression suite of the Kastle 2 apps on the host build (see host/)
+#
+# Renders each scenario of the budgets file with the host renderer, reads the Profiler sections
+# of the whole render (-p) and compares the average per block against the recorded budget.
+# A section more than the tolerance (percent, in the budgets file or --tolerance) over its budget fails the suite.
+#
+#   cmake -S host -B build-host && cmake --build build-host -j
+#   python3 scripts/perf_regression.py --build build-host
+#   python3 scripts/perf_regression.py --build build-host --update    # record new budgets
+#
+# The host counts instructions of each thread when the kernel gives access to the hardware counter,
+# otherwise CPU time in ns. Neither is the Cortex-M0+ cycle count, the budgets catch relative changes
+# of the same code on the same machine, so record them again after changing the machine or the compiler.
+# Each scenario is rendered --runs times and the lowest average is used, which filters out most of the noise.
+
+import argparse
+import csv
+import json
+import math
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+from typing import Dict, List, Optional
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+CODE_DIR = os.path.dirname(SCRIPT_DIR)
+DEFAULT_BUDGETS = os.path.join(SCRIPT_DIR, 'perf_budgets.json')
+
+SAMPLE_RATE = 44000
+
+
+def write_input_wav(path: str, seconds: float):
+    """Stereo test input: two detuned saws with a decaying noise burst every half second."""
+    frames = int(seconds * SAMPLE_RATE)
+    seed = 1
+    data = bytearray()
+    for i in range(frames):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        noise = (seed >> 15) / 32768.0 - 0.5
+        burst = math.exp(-(i % (SAMPLE_RATE // 2)) / 2000.0)
+        left = ((i * 110.0 / SAMPLE_RATE) % 1.0) - 0.5 + noise * burst
+        right = ((i * 111.3 / SAMPLE_RATE) % 1.0) - 0.5 + noise * burst
+        data += struct.pack('<hh', int(left * 16000), int(right * 16000))
+    with open(path, 'wb') as wav:
+        wav.write(b'RIFF' + struct.pack('<I', 36 + len(data)) + b'WAVE')
+        wav.write(b'fmt ' + struct.pack('<IHHIIHH', 16, 1, 2, SAMPLE_RATE, SAMPLE_RATE * 4, 4, 16))
+        wav.write(b'data' + struct.pack('<I', len(data)) + data)
+
+
+def render(build: str, scenario: dict, seconds: float, input_wav: str, work: str) -> Optional[Dict[str, dict]]:
+    """Renders the scenario, returns the profiler rows by section or None when the renderer fails."""
+    binary = os.path.join(build, 'output', scenario['app'])
+    profile = os.path.join(work, 'profile.csv')
+    command = [binary, '-o', os.path.join(work, 'output.wav'), '-s', str(seconds), '-p', profile]
+    if scenario.get('input', False):
+        command += ['-i', input_wav]
+    if 'user_data' in scenario:
+        command += ['-u', os.path.join(CODE_DIR, scenario['user_data'])]
+    command += scenario.get('args', [])
+    if os.path.exists(profile):
+        os.remove(profile)
+    result = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    if result.returncode != 0 or not os.path.exists(profile):
+        print(f"{scenario['name']}: renderer failed ({result.returncode}) {result.stderr.strip()}", file=sys.stderr)
+        return None
+    with open(profile) as file:
+        return {row['section']: row for row in csv.DictReader(file)}
+
+
+def measure(build: str, scenario: dict, seconds: float, runs: int, input_wav: str, work: str) -> Optional[dict]:
+    """Lowest average and max of each section over the runs, with the unit of the counter."""
+    best: Dict[str, Dict[str, int]] = {}
+    unit = None
+    for _ in range(runs):
+        rows = render(build, scenario, seconds, input_wav, work)
+        if rows is None:
+            return None
+        for section, row in rows.items():
+            unit = row['unit']
+            avg, peak = int(row['avg']), int(row['max'])
+            if section not in best:
+                best[section] = {'avg': avg, 'max': peak}
+            else:
+                best[section]['avg'] = min(best[section]['avg'], avg)
+                best[section]['max'] = min(best[section]['max'], peak)
+    return {'unit': unit, 'sections': best}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare the audio path cost of the Kastle 2 apps against recorded budgets.')
+    parser.add_argument('--build', default='build-host', help='Host build directory (default: build-host)')
+    parser.add_argument('--budgets', default=DEFAULT_BUDGETS, help='Scenarios and budgets (default: scripts/perf_budgets.json)')
+    parser.add_argument('--tolerance', type=float, help='Allowed percent over the budget (default: from the budgets file)')
+    parser.add_argument('--runs', type=int, default=5, help='Renders per scenario, the lowest one counts (default: 5)')
+    parser.add_argument('--only', action='append', help='Run only the scenarios starting with this name (can repeat)')
+    parser.add_argument('--check-max', action='store_true', help='Check the worst block too, not only the average')
+    parser.add_argument('--update', action='store_true', help='Record the measured values as the new budgets')
+    args = parser.parse_args()
+
+    with open(args.budgets) as file:
+        suite = json.load(file)
+    seconds = suite.get('seconds', 4)
+    tolerance = args.tolerance if args.tolerance is not None else suite.get('tolerance', 10.0)
+
+    scenarios: List[dict] = suite['scenarios']
+    if args.only:
+        scenarios = [s for s in scenarios if any(s['name'].startswith(prefix) for prefix in args.only)]
+
+    failures = 0
+    with tempfile.TemporaryDirectory() as work:
+        input_wav = os.path.join(work, 'input.wav')
+        write_input_wav(input_wav, seconds)
+
+        for scenario in scenarios:
+            measured = measure(args.build, scenario, seconds, args.runs, input_wav, work)
+            if measured is None:
+                failures += 1
+                continue
+
+            if args.update:
+                scenario['budgets'] = measured['sections']
+                suite['unit'] = measured['unit']
+                print(f"{scenario['name']}: recorded")
+                continue
+
+            if measured['unit'] != suite.get('unit'):
+                print(f"{scenario['name']}: budgets are in {suite.get('unit')}, this machine measures {measured['unit']}, "
+                      f"record them with --update", file=sys.stderr)
+                failures += 1
+                continue
+
+            budgets = scenario.get('budgets', {})
+            for section, values in measured['sections'].items():
+                if section not in budgets:
+                    print(f"{scenario['name']} {section}: no budget, record it with --update")
+                    continue
+                for key in ('avg', 'max') if args.check_max else ('avg',):
+                    budget = budgets[section][key]
+                    change = (values[key] - budget) * 100.0 / budget if budget > 0 else 0.0
+                    status = 'ok'
+                    if change > tolerance:
+                        status = 'FAIL'
+                        failures += 1
+                    print(f"{status:4} {scenario['name']} {section} {key}: {values[key]} / {budget} {measured['unit']} "
+                          f"({change:+.1f}%)")
+
+    if args.update:
+        with open(args.budgets, 'w') as file:
+            json.dump(suite, file, indent=2)
+            file.write('\n')
+
+    if failures:
+        print(f"{failures} over budget or failed", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
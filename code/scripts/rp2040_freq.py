@@ -18,4 +18,56 @@ result = find_number()
 if result:
     print("Numbers found.")
 else:
-    print("No suitable number found.")
\ No newline at end of file
+    print("No suitable number found.")
+
+# Lower clocks for ClockGovernor (src/common/core/ClockGovernor.hpp): integer dividers of clk_sys
+# which keep exact I2S dividers (8 bit fraction) and a PIO divider of at least 1
+def find_levels(system_clock, sample_rate=44000, max_divider=16):
+    mclk_pio = 2 * 256 * sample_rate
+    bclk_pio = 2 * 2 * 32 * sample_rate
+    for divider in range(1, max_divider + 1):
+        if system_clock % divider != 0:
+            continue
+        clock = system_clock // divider
+        if clock < mclk_pio or (clock * 256) % mclk_pio != 0 or (clock * 256) % bclk_pio != 0:
+            continue
+        print(f"Divider: {divider}, freq: {clock}, MCLK div: {clock / mclk_pio}, BCLK div: {clock / bclk_pio}")
+
+print("\nClock levels of 176 MHz:")
+find_levels(176000000)
+
+
+# Clock plans for ClockPlan (src/common/core/ClockPlan.hpp): whole MHz clocks with exact I2S dividers,
+# the PLL settings the way vcocalc.py of the Pico SDK picks them (highest VCO) and the flash divider for <= 100 MHz
+def find_plans(min_mhz=132, max_mhz=280, crystal=12000000, sample_rate=44000):
+    mclk_pio = 2 * 256 * sample_rate
+    for mhz in range(min_mhz, max_mhz + 1):
+        clock = mhz * 1000000
+        if clock % sample_rate != 0 or (clock * 256) % mclk_pio != 0:
+            continue
+        plan = None
+        for fbdiv in range(320, 15, -1):
+            vco = crystal * fbdiv
+            if vco < 750000000 or vco > 1600000000:
+                continue
+            for post_div1 in range(7, 0, -1):
+                for post_div2 in range(1, post_div1 + 1):
+                    if vco == clock * post_div1 * post_div2:
+                        plan = (vco, post_div1, post_div2)
+                        break
+                if plan:
+                    break
+            if plan:
+                break
+        if plan:
+            flash_divider = 2
+            while clock / flash_divider > 100000000:
+                flash_divider += 2
+            print(f"Plan: {mhz} MHz, VCO: {plan[0]}, post dividers: {plan[1]} {plan[2]}, flash divider: {flash_divider}")
+
+for rate in (44000, 48000, 96000):
+    print(f"\nClock plans at {rate} Hz:")
+    find_plans(sample_rate=rate)
+
+print("\nClock levels of 192 MHz at 48 kHz:")
+find_levels(192000000, 48000)
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+
+# Writes the user data or a preset to a running Kastle 2 over MIDI SysEx (see src/common/core/SysExTransfer.hpp)
+#
+# For the setups with MIDI only, a USB MIDI host or a TRS MIDI interface. The port is a raw MIDI device
+# (ALSA, /dev/snd/midiC<card>D<device>, `amidi -l` lists them). Each sector goes as blocks, a whole sector
+# without waiting, and the device answers after writing it. The app must enable the transfer (WaveBard does).
+#
+#   python3 scripts/sysex_upload.py /dev/snd/midiC1D0 --user-data src/apps/WaveBard/SAMPLES.bin
+#   python3 scripts/sysex_upload.py /dev/snd/midiC1D0 --preset 3 preset.bin
+#
+# Over TRS the device can't answer (the Kastle 2 has no MIDI output), --paced then sends without the answers
+# and waits after each sector instead. Nothing is checked that way, verify the result with the USB uploader.
+
+import argparse
+import os
+import select
+import struct
+import sys
+import time
+import zlib
+
+HEADER = bytes([0x7D, ord('K'), ord('2')])
+REPLY = ord('R')
+RESPONSE = struct.Struct('<BB2xIII')
+TIMEOUT = 2.0
+RETRIES = 5
+
+# Defaults of the device, used without the answers (--paced)
+BLOCK_SIZE = 256
+SECTOR_SIZE = 4096
+SECTOR_WRITE_S = 0.2
+
+STATUS = ['OK', 'UNCHANGED', 'BAD_REQUEST', 'BAD_CRC', 'WRITE_FAILED', 'OUT_OF_ORDER']
+
+
+def pack7(data: bytes) -> bytes:
+    """Groups of 7 bytes, each after a byte with their top bits (bit 0 for the first byte)."""
+    packed = bytearray()
+    for i in range(0, len(data), 7):
+        group = data[i:i + 7]
+        packed.append(sum(((byte >> 7) & 1) << bit for bit, byte in enumerate(group)))
+        packed += bytes(byte & 0x7F for byte in group)
+    return bytes(packed)
+
+
+def unpack7(packed: bytes) -> bytes:
+    data = bytearray()
+    for i in range(0, len(packed), 8):
+        bits = packed[i]
+        data += bytes(byte | (((bits >> bit) & 1) << 7) for bit, byte in enumerate(packed[i + 1:i + 8]))
+    return bytes(data)
+
+
+class Device:
+    def __init__(self, port: str, paced: bool):
+        self.fd = os.open(port, os.O_WRONLY if paced else os.O_RDWR)
+        self.paced = paced
+        self.input = bytearray()
+
+    def close(self):
+        os.close(self.fd)
+
+    def send(self, command: str, payload: bytes = b''):
+        message = b'\xf0' + HEADER + command.encode() + pack7(payload) + b'\xf7'
+        view = memoryview(message)
+        while view:
+            view = view[os.write(self.fd, view):]
+
+    def receive(self, timeout: float = TIMEOUT):
+        """Next answer of the device as (command, status, values), None after the timeout."""
+        deadline = time.monotonic() + timeout
+        while True:
+            # Real-time bytes can come anywhere, the other messages are skipped
+            self.input = bytearray(byte for byte in self.input if byte < 0xF8)
+            start = self.input.find(b'\xf0' + HEADER + bytes([REPLY]))
+            end = self.input.find(b'\xf7', start) if start >= 0 else -1
+            if end >= 0:
+                data = unpack7(bytes(self.input[start + len(HEADER) + 2:end]))
+                del self.input[:end + 1]
+                if len(data) == RESPONSE.size:
+                    command, status, *values = RESPONSE.unpack(data)
+                    return chr(command), status, values
+                continue
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+                return None
+            self.input += os.read(self.fd, 1024)
+
+    def request(self, command: str, payload: bytes = b''):
+        """Sends the request until there is an answer to it."""
+        for _ in range(RETRIES):
+            self.send(command, payload)
+            if self.paced:
+                return 0, [0, 0, 0]
+            reply = self.receive()
+            while reply is not None and reply[0] != command:
+                reply = self.receive()
+            if reply is not None:
+                return reply[1], reply[2]
+        sys.exit(f"No answer to '{command}' (is the transfer enabled in the app? over TRS use --paced)")
+
+
+def block_message(data: bytes, offset: int) -> bytes:
+    block = data[offset:offset + BLOCK_SIZE]
+    return struct.pack('<II', offset, zlib.crc32(block)) + block
+
+
+def write_sector(device: Device, data: bytes, offset: int, sector_size: int) -> int:
+    """Sends the blocks of the sector from the offset, returns the status of the write."""
+    end = offset - offset % sector_size + sector_size
+    for _ in range(RETRIES):
+        for block in range(offset, end, BLOCK_SIZE):
+            device.send('B', block_message(data, block))
+        if device.paced:
+            time.sleep(SECTOR_WRITE_S)
+            return 0
+        reply = device.receive()
+        while reply is not None and reply[0] != 'B':
+            reply = device.receive()
+        if reply is None:
+            # The answer got lost, the sector again (an unchanged one is not written twice)
+            offset = end - sector_size
+            continue
+        _, status, (next_offset, *_) = reply
+        if STATUS[status] in ('BAD_CRC', 'OUT_OF_ORDER') and end - sector_size <= next_offset < end:
+            offset = next_offset
+            continue
+        return status
+    sys.exit(f"Writing the sector at {end - sector_size:#x} failed, no answer")
+
+
+def upload_user_data(device: Device, path: str):
+    global BLOCK_SIZE
+    with open(path, 'rb') as file:
+        data = file.read()
+    if not data[:2] == b'k2':
+        print(f"warning: {path} doesn't look like a Kastle 2 user data file", file=sys.stderr)
+
+    status, (block_window, user_data_size, _) = device.request('I')
+    sector_size = SECTOR_SIZE
+    if not device.paced:
+        if status != 0:
+            sys.exit(f"The device refused the transfer: {STATUS[status]}")
+        BLOCK_SIZE = block_window & 0xFFFF
+        sector_size = BLOCK_SIZE * (block_window >> 16)
+        if len(data) > user_data_size:
+            sys.exit(f"{path} has {len(data)} bytes, the user data section {user_data_size}")
+
+    # Erased flash reads 0xFF, the last sector is padded the same way
+    sectors = (len(data) + sector_size - 1) // sector_size
+    data += b'\xff' * (sectors * sector_size - len(data))
+    start = time.monotonic()
+    written = 0
+    for index in range(sectors):
+        status = write_sector(device, data, index * sector_size, sector_size)
+        if status > 1:
+            sys.exit(f"Writing sector {index} failed: {STATUS[status] if status < len(STATUS) else status}")
+        written += status == 0
+        seconds = time.monotonic() - start
+        print(f"\r{index + 1} / {sectors} sectors, {(index + 1) * sector_size / seconds / 1024:.1f} kB/s",
+              end='', flush=True)
+    print()
+    print(f"{written} sectors written, {sectors - written} unchanged in {time.monotonic() - start:.1f} s")
+
+
+def upload_preset(device: Device, slot: int, path: str):
+    with open(path, 'rb') as file:
+        data = file.read()
+    device.request('I')
+    status, _ = device.request('P', struct.pack('<B3xII', slot, len(data), zlib.crc32(data)) + data)
+    if status != 0:
+        sys.exit(f"Storing the preset failed: {STATUS[status] if status < len(STATUS) else status}")
+    print(f"Preset {slot} stored ({len(data)} bytes)")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Write the user data or a preset to a Kastle 2 over MIDI SysEx.')
+    parser.add_argument('port', help='Raw MIDI port connected to the Kastle 2 (eg. /dev/snd/midiC1D0)')
+    parser.add_argument('--user-data', metavar='FILE', help='User data file (eg. SAMPLES.bin)')
+    parser.add_argument('--preset', nargs=2, metavar=('SLOT', 'FILE'), help='Preset data for a slot of the app')
+    parser.add_argument('--paced', action='store_true', help='Send without the answers (TRS MIDI only)')
+    parser.add_argument('--no-reboot', action='store_true', help="Don't reboot the device at the end")
+    args = parser.parse_args()
+    if not args.user_data and not args.preset:
+        parser.error('nothing to send, use --user-data or --preset')
+
+    device = Device(args.port, args.paced)
+    if args.user_data:
+        upload_user_data(device, args.user_data)
+    if args.preset:
+        upload_preset(device, int(args.preset[0]), args.preset[1])
+    device.request('E', struct.pack('<I', 0 if args.no_reboot or not args.user_data else 1))
+    device.close()
+
+
+if __name__ == '__main__':
+    main()
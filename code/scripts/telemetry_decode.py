@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+
+# Decoder of the Kastle 2 binary telemetry (see src/common/debug/Telemetry.hpp)
+#
+# Reads the records of one RTT channel (1 for core 0, 2 for core 1) from a file written by
+# JLinkRTTLogger, or live from the OpenOCD RTT server, and prints them as CSV.
+#
+#   JLinkRTTLogger -Device RP2040_M0_0 -If SWD -Speed 4000 -RTTChannel 1 telemetry.bin
+#   python3 scripts/telemetry_decode.py telemetry.bin
+#
+#   openocd ... -c "rtt setup 0x20000000 0x42000 \"SEGGER RTT\"" -c "rtt start" -c "rtt server start 9091 1"
+#   python3 scripts/telemetry_decode.py --tcp localhost:9091
+#
+# The trace points of the core modules (src/common/debug/Trace.hpp) and the audio clock statistics
+# (src/common/debug/AudioClockMonitor.hpp) are printed by their names.
+# The records of a scope snippet are joined to one line. Dropped records (full RTT buffer)
+# show up as gaps in the sequence numbers, they are counted and reported at the end.
+
+import argparse
+import socket
+import struct
+import sys
+from typing import BinaryIO, Iterator, List, Optional, Tuple
+
+RECORD_SIZE = 16
+SYNC = 0xA5
+
+TYPE_PROFILER = 1
+TYPE_VALUE = 2
+TYPE_SCOPE = 3
+TYPE_TRACE = 4
+TYPE_CLOCK = 5
+
+# Profiler::Section order
+PROFILER_SECTIONS = ['AUDIO_CALLBACK', 'BEFORE_AUDIO_LOOP', 'AUDIO_LOOP', 'AFTER_AUDIO_LOOP', 'SECOND_CORE']
+
+# TracePoint order (src/common/debug/Trace.hpp)
+TRACE_POINTS = ['CLOCK_SYNC_TYPE', 'CLOCK_TAP', 'CLOCK_RESET', 'MIDI_CLOCK_START', 'MIDI_CLOCK_PULSE', 'MIDI_CLOCK_LOCK',
+                'MIDI_CLOCK_LOST', 'MEMORY_PAGE_WRITE', 'MEMORY_BUS_FULL', 'MEMORY_VERIFY_FAILED', 'MIDI_MESSAGE',
+                'MIDI_UART_DROPPED', 'MIDI_SYSEX_CUT', 'BASE_LAYER', 'SPAN_BEGIN', 'SPAN_END']
+
+# AudioClockMonitor::Stat order (src/common/debug/AudioClockMonitor.hpp)
+CLOCK_STATS = ['PERIOD', 'START_LATENCY', 'DURATION', 'I2S_RATE', 'USB_RATE']
+
+# sync, type, id, sequence, timestamp, 8 payload bytes
+RECORD = struct.Struct('<BBBBI8s')
+
+
+class Record:
+    def __init__(self, data: bytes):
+        self.sync, self.type, self.id, self.sequence, self.timestamp, payload = RECORD.unpack(data)
+        self.values = struct.unpack('<ii', payload)
+        self.samples = struct.unpack('<hhhh', payload)
+
+
+def read_chunks(source: BinaryIO) -> Iterator[bytes]:
+    while True:
+        chunk = source.read(4096)
+        if not chunk:
+            return
+        yield chunk
+
+
+def read_socket(address: str) -> Iterator[bytes]:
+    host, port = address.rsplit(':', 1)
+    with socket.create_connection((host, int(port))) as connection:
+        while True:
+            chunk = connection.recv(4096)
+            if not chunk:
+                return
+            yield chunk
+
+
+def read_records(chunks: Iterator[bytes]) -> Iterator[Tuple[Record, int]]:
+    """Splits the stream to records. Yields (record, bytes skipped to find it)."""
+    data = bytearray()
+    skipped = 0
+    for chunk in chunks:
+        data += chunk
+        position = 0
+        while len(data) - position >= RECORD_SIZE:
+            record = Record(bytes(data[position:position + RECORD_SIZE]))
+            if record.sync != SYNC or record.type not in (TYPE_PROFILER, TYPE_VALUE, TYPE_SCOPE, TYPE_TRACE, TYPE_CLOCK):
+                # Cut stream or garbage, move by a byte until the records line up again
+                position += 1
+                skipped += 1
+                continue
+            yield record, skipped
+            skipped = 0
+            position += RECORD_SIZE
+        del data[:position]
+
+
+def format_record(record: Record) -> str:
+    if record.type == TYPE_PROFILER:
+        name = PROFILER_SECTIONS[record.id] if record.id < len(PROFILER_SECTIONS) else str(record.id)
+        return f"{record.timestamp},profiler,{name},{record.values[0]}"
+    if record.type == TYPE_TRACE:
+        name = TRACE_POINTS[record.id] if record.id < len(TRACE_POINTS) else str(record.id)
+        return f"{record.timestamp},trace,{name},{record.values[0]},{record.values[1]}"
+    if record.type == TYPE_CLOCK:
+        name = CLOCK_STATS[record.id] if record.id < len(CLOCK_STATS) else str(record.id)
+        return f"{record.timestamp},clock,{name},{record.values[0]},{record.values[1]}"
+    return f"{record.timestamp},value,{record.id},{record.values[0]},{record.values[1]}"
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the binary telemetry of a Kastle 2 firmware to CSV.')
+    parser.add_argument('input', nargs='?', help='Raw RTT channel dump (default: stdin)')
+    parser.add_argument('--tcp', metavar='HOST:PORT', help='Read live from an RTT server (OpenOCD) instead of a file')
+    parser.add_argument('--id', type=int, action='append', help='Print only these ids (can repeat)')
+    parser.add_argument('-o', '--output', help='CSV file (default: stdout)')
+    args = parser.parse_args()
+
+    if args.tcp:
+        chunks = read_socket(args.tcp)
+    elif args.input:
+        chunks = read_chunks(open(args.input, 'rb'))
+    else:
+        chunks = read_chunks(sys.stdin.buffer)
+    output = open(args.output, 'w') if args.output else sys.stdout
+
+    records = 0
+    dropped = 0
+    skipped = 0
+    sequence: Optional[int] = None
+    # Scope snippet being joined: (id, timestamp, samples)
+    scope: Optional[Tuple[int, int, List[int]]] = None
+
+    def flush_scope():
+        nonlocal scope
+        if scope is not None:
+            if args.id is None or scope[0] in args.id:
+                output.write(f"{scope[1]},scope,{scope[0]},{' '.join(str(s) for s in scope[2])}\n")
+            scope = None
+
+    output.write('timestamp_us,type,id,values\n')
+    try:
+        for record, skipped_bytes in read_records(chunks):
+            records += 1
+            skipped += skipped_bytes
+            if sequence is not None:
+                dropped += (record.sequence - sequence - 1) & 0xFF
+            sequence = record.sequence
+
+            if record.type == TYPE_SCOPE:
+                if scope is not None and (scope[0], scope[1]) == (record.id, record.timestamp):
+                    scope[2].extend(record.samples)
+                else:
+                    flush_scope()
+                    scope = (record.id, record.timestamp, list(record.samples))
+                continue
+            flush_scope()
+            if args.id is None or record.id in args.id:
+                output.write(format_record(record) + '\n')
+    except KeyboardInterrupt:
+        pass
+    flush_scope()
+
+    print(f"{records} records, {dropped} dropped, {skipped} bytes skipped", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+# Converts the Kastle 2 trace records to a Chrome trace (chrome://tracing, https://ui.perfetto.dev)
+#
+# Each core writes its own RTT channel (1 for core 0, 2 for core 1, see src/common/debug/Telemetry.hpp),
+# dump both and pass them in the core order:
+#
+#   JLinkRTTLogger -Device RP2040_M0_0 -If SWD -Speed 4000 -RTTChannel 1 core0.bin
+#   JLinkRTTLogger -Device RP2040_M0_0 -If SWD -Speed 4000 -RTTChannel 2 core1.bin
+#   python3 scripts/trace_to_chrome.py core0.bin core1.bin -o trace.json
+#
+# Build the firmware with TRACE_LEVEL 4 in debug.hpp for the timeline spans (Trace::Begin / Trace::End).
+# The spans of each core land on its own track, nested as they ran (an interrupt inside a UI task etc.),
+# the other trace points show up as instant events and the profiler, value and audio clock records (TELEMETRY) as counters.
+# The spans cut by dropped records (full RTT buffer) are left out, the count is reported at the end.
+
+import argparse
+import json
+import sys
+from typing import Dict, List, Optional, Tuple
+
+from telemetry_decode import (CLOCK_STATS, PROFILER_SECTIONS, TRACE_POINTS, TYPE_CLOCK, TYPE_PROFILER, TYPE_TRACE,
+                              TYPE_VALUE, read_chunks, read_records)
+
+# TraceSpan order (src/common/debug/Trace.hpp)
+TRACE_SPANS = ['AUDIO_CALLBACK', 'AUDIO_LOOP', 'ADC_IRQ', 'UI_TASK', 'WAIT_FOR_BLOCK', 'SECOND_CORE']
+
+SPAN_BEGIN = TRACE_POINTS.index('SPAN_BEGIN')
+SPAN_END = TRACE_POINTS.index('SPAN_END')
+
+# The timestamps are time_us_32(), which wraps after about 71 minutes
+TIME_WRAP = 1 << 32
+
+
+def span_name(span: int, detail: int) -> Tuple[str, dict]:
+    name = TRACE_SPANS[span] if span < len(TRACE_SPANS) else f"span {span}"
+    if name == 'UI_TASK':
+        return f"UI task {detail}", {'task': detail}
+    if name == 'SECOND_CORE' and detail != 0:
+        return name, {'from': detail & 0xFFFF, 'to': detail >> 16}
+    return name, {}
+
+
+def convert_core(path: str, core: int, events: List[dict], stats: Dict[str, int]):
+    """Appends the events of one core's channel dump."""
+    # Open spans of this core: (span, begin time, name, args)
+    stack: List[Tuple[int, int, str, dict]] = []
+    last_time: Optional[int] = None
+    offset = 0
+    sequence: Optional[int] = None
+
+    with open(path, 'rb') as source:
+        for record, _ in read_records(read_chunks(source)):
+            stats['records'] += 1
+            if last_time is not None and record.timestamp + offset < last_time - TIME_WRAP // 2:
+                offset += TIME_WRAP
+            time = record.timestamp + offset
+            last_time = time
+
+            if sequence is not None and (record.sequence - sequence - 1) & 0xFF:
+                # Records are missing, the open spans may never end
+                stats['dropped'] += (record.sequence - sequence - 1) & 0xFF
+                stats['cut'] += len(stack)
+                stack.clear()
+            sequence = record.sequence
+
+            value, value2 = record.values
+            if record.type == TYPE_TRACE and record.id == SPAN_BEGIN:
+                name, args = span_name(value, value2)
+                stack.append((value, time, name, args))
+            elif record.type == TYPE_TRACE and record.id == SPAN_END:
+                if not stack or stack[-1][0] != value:
+                    stats['cut'] += 1
+                    stack.clear()
+                    continue
+                _, begin, name, args = stack.pop()
+                events.append({'name': name, 'ph': 'X', 'pid': 0, 'tid': core, 'ts': begin, 'dur': time - begin,
+                               'args': args})
+            elif record.type == TYPE_TRACE:
+                name = TRACE_POINTS[record.id] if record.id < len(TRACE_POINTS) else f"point {record.id}"
+                events.append({'name': name, 'ph': 'i', 's': 't', 'pid': 0, 'tid': core, 'ts': time,
+                               'args': {'value': value, 'value2': value2}})
+            elif record.type == TYPE_PROFILER:
+                name = PROFILER_SECTIONS[record.id] if record.id < len(PROFILER_SECTIONS) else str(record.id)
+                events.append({'name': f"{name} cycles", 'ph': 'C', 'pid': 0, 'ts': time, 'args': {'cycles': value}})
+            elif record.type == TYPE_CLOCK:
+                name = CLOCK_STATS[record.id] if record.id < len(CLOCK_STATS) else f"clock {record.id}"
+                events.append({'name': name, 'ph': 'C', 'pid': 0, 'ts': time,
+                               'args': {'value': value, 'value2': value2}})
+            elif record.type == TYPE_VALUE:
+                events.append({'name': f"value {record.id}", 'ph': 'C', 'pid': 0, 'ts': time,
+                               'args': {'value': value, 'value2': value2}})
+
+    stats['cut'] += len(stack)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert the Kastle 2 trace records to a Chrome trace JSON.')
+    parser.add_argument('inputs', nargs='+', help='Raw RTT channel dumps, core 0 (channel 1) first, then core 1')
+    parser.add_argument('-o', '--output', help='JSON file (default: stdout)')
+    args = parser.parse_args()
+
+    if len(args.inputs) > 2:
+        parser.error('at most two dumps, one per core')
+
+    events: List[dict] = [{'name': 'process_name', 'ph': 'M', 'pid': 0, 'args': {'name': 'Kastle 2'}}]
+    stats = {'records': 0, 'dropped': 0, 'cut': 0}
+    for core, path in enumerate(args.inputs):
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': core, 'args': {'name': f"core {core}"}})
+        convert_core(path, core, events, stats)
+
+    # Both cores read the same timer, so the tracks line up as they are
+    output = open(args.output, 'w') if args.output else sys.stdout
+    json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, output)
+    output.write('\n')
+
+    print(f"{stats['records']} records, {stats['dropped']} dropped, {stats['cut']} spans cut", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
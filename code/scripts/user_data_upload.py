@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+
+# Updates the user data of a running Kastle 2 over USB serial (see src/common/core/UserDataUploader.hpp)
+#
+# Reads the CRC32 of each 4 kB sector of the device's user data, compares them with the file and writes
+# only the sectors which differ, so swapping one sample bank takes seconds instead of a full UF2 reflash.
+# The app must enable the uploader (WaveBard does). The device reboots at the end to load the new data.
+#
+#   python3 scripts/user_data_upload.py /dev/ttyACM0 src/apps/WaveBard/SAMPLES.bin
+#
+# Sectors past the end of the file are left as they are.
+
+import argparse
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+import zlib
+
+SYNC = b'\x02'
+REQUEST = struct.Struct('<B3xIII')
+RESPONSE = struct.Struct('<BB2xIII')
+TIMEOUT = 5.0
+
+STATUS = ['OK', 'UNCHANGED', 'BAD_REQUEST', 'BAD_CRC', 'WRITE_FAILED']
+
+
+class Device:
+    def __init__(self, port: str):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+
+    def close(self):
+        os.close(self.fd)
+
+    def write(self, data: bytes):
+        view = memoryview(data)
+        while view:
+            view = view[os.write(self.fd, view):]
+
+    def read(self, size: int) -> bytes:
+        data = b''
+        deadline = time.monotonic() + TIMEOUT
+        while len(data) < size:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+                sys.exit("No response from the device (is the uploader enabled in the app?)")
+            data += os.read(self.fd, size - len(data))
+        return data
+
+    def request(self, command: str, offset: int = 0, length: int = 0, crc: int = 0, payload: bytes = b''):
+        self.write(REQUEST.pack(ord(command), offset, length, crc) + payload)
+        reply, status, *values = RESPONSE.unpack(self.read(RESPONSE.size))
+        if reply != ord(command):
+            sys.exit(f"Unexpected response {reply:#x} to '{command}'")
+        return status, values
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Write the changed sectors of a user data file to a Kastle 2.')
+    parser.add_argument('port', help='USB serial port of the Kastle 2 (eg. /dev/ttyACM0)')
+    parser.add_argument('file', help='User data file (eg. SAMPLES.bin)')
+    parser.add_argument('--no-reboot', action='store_true', help="Don't reboot the device at the end")
+    args = parser.parse_args()
+
+    with open(args.file, 'rb') as file:
+        data = file.read()
+    if not data[:2] == b'k2':
+        print(f"warning: {args.file} doesn't look like a Kastle 2 user data file", file=sys.stderr)
+
+    device = Device(args.port)
+    device.write(SYNC)
+    status, (sector_size, user_data_size, max_checksums) = device.request('I')
+    if status != 0:
+        sys.exit(f"The device refused the upload: {STATUS[status]}")
+    if len(data) > user_data_size:
+        sys.exit(f"{args.file} has {len(data)} bytes, the user data section {user_data_size}")
+
+    # Erased flash reads 0xFF, the last sector is padded the same way
+    sectors = (len(data) + sector_size - 1) // sector_size
+    data += b'\xff' * (sectors * sector_size - len(data))
+    start = time.monotonic()
+
+    changed = []
+    for first in range(0, sectors, max_checksums):
+        count = min(max_checksums, sectors - first)
+        status, _ = device.request('C', first * sector_size, count)
+        if status != 0:
+            sys.exit(f"Reading checksums failed: {STATUS[status]}")
+        checksums = struct.unpack(f'<{count}I', device.read(4 * count))
+        for index, checksum in enumerate(checksums, first):
+            if zlib.crc32(data[index * sector_size:(index + 1) * sector_size]) != checksum:
+                changed.append(index)
+    print(f"{len(changed)} of {sectors} sectors changed")
+
+    for number, index in enumerate(changed, 1):
+        sector = data[index * sector_size:(index + 1) * sector_size]
+        status, (crc, *_) = device.request('W', index * sector_size, sector_size, zlib.crc32(sector), sector)
+        if status > 1 or crc != zlib.crc32(sector):
+            sys.exit(f"Writing sector {index} failed: {STATUS[status] if status < len(STATUS) else status}")
+        print(f"\r{number} / {len(changed)} sectors written", end='', flush=True)
+    if changed:
+        print()
+
+    device.request('E', length=0 if args.no_reboot else 1)
+    device.close()
+    print(f"Done in {time.monotonic() - start:.1f} s{'' if args.no_reboot else ', the device reboots'}")
+
+
+if __name__ == '__main__':
+    main()
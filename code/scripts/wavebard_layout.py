@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+
+# Lays out a Wave Bard sample file (k2wb, see src/apps/WaveBard/WAVE_BARD_FORMAT.md) for the playback from flash
+#
+# Each sample's data starts at an --align boundary (the 256 byte flash page by default, a multiple of the 8 byte
+# XIP cache line), so the first read of a triggered sample doesn't straddle a cache line or page it doesn't need.
+# A bank's samples are the ones the sample pot and the sequencer switch between, they stay together in their order,
+# each bank header right before its first sample. The padding goes before the sample headers, the file gets
+# the Sample Index pointing at them (the firmware can't walk the headers of an aligned file).
+# The slice tables (wavebard_slices.py) are kept.
+#
+#   python3 scripts/wavebard_layout.py SAMPLES.bin -o SAMPLES_ALIGNED.bin
+#
+# The build runs it on APP_USER_DATA of the apps with APP_USER_DATA_LAYOUT (create_data_merged_target).
+# When the padding doesn't fit the user data space, the alignment is halved down to the cache line.
+
+import argparse
+import struct
+import sys
+from typing import List
+
+from wavebard_slices import (BANK_HEADER_SIZE, END_MARKER, FLAG_SAMPLE_INDEX, FLAG_SLICE_TABLE, HEADER_SIZE, MAGIC,
+                             SAMPLE_HEADER_SIZE, SLICE_FRAMES, frames_in_bytes, walk)
+
+# User data space: 0x10080000 up to the presets in the last 64 kB of the 8 MB flash
+MAX_FILE_SIZE = 7616 * 1024
+XIP_CACHE_LINE = 8
+FLASH_PAGE = 256
+
+
+def pad(output: bytearray, align: int, offset: int = 0):
+    """Zeros up to the next position where output + offset is a multiple of align."""
+    output += bytes(-(len(output) + offset) % align)
+
+
+def lay_out(data: bytes, align: int) -> bytes:
+    _, file_size, _, _, banks, samples_per_bank, scales, rhythms = struct.unpack_from('<4sIIBBBBB', data, 0)
+    flags = data[19]
+    index, samples, samples_end = walk(data)
+
+    # Main header, scales and rhythms stay as they are
+    output = bytearray(data[:HEADER_SIZE + 4 * scales + 4 * rhythms])
+    new_index: List[int] = []
+    for i, offset in enumerate(index):
+        if i % (samples_per_bank + 1) == 0:
+            # Bank header, in the padding before its first sample when it fits
+            pad(output, 4)
+            new_index.append(len(output))
+            output += data[offset:offset + BANK_HEADER_SIZE]
+        else:
+            # Sample header, the data right after it on the boundary
+            size = struct.unpack_from('<I', data, offset)[0]
+            pad(output, align, SAMPLE_HEADER_SIZE)
+            new_index.append(len(output))
+            output += data[offset:offset + SAMPLE_HEADER_SIZE + ((size + 1) & ~1)]
+
+    # Slice tables copied after the samples, their offsets right before the index
+    if flags & FLAG_SLICE_TABLE:
+        entries = banks * samples_per_bank
+        offsets_end = file_size - len(END_MARKER)
+        if flags & FLAG_SAMPLE_INDEX:
+            offsets_end -= 4 * len(index)
+        offsets = struct.unpack_from(f'<{entries}I', data, offsets_end - 4 * entries)
+        new_offsets = []
+        for (_, size, channels), table in zip(samples, offsets):
+            steps = (frames_in_bytes(size, channels, data[12]) + SLICE_FRAMES - 1) // SLICE_FRAMES
+            new_offsets.append(len(output))
+            output += data[table:table + steps]
+        pad(output, 4)
+        output += struct.pack(f'<{entries}I', *new_offsets)
+
+    pad(output, 4)
+    output += struct.pack(f'<{len(new_index)}I', *new_index)
+    output += END_MARKER
+
+    output[19] = flags | FLAG_SAMPLE_INDEX
+    struct.pack_into('<I', output, 4, len(output))
+    return bytes(output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Align the samples of a Wave Bard sample file for the playback from flash.')
+    parser.add_argument('input', help='Wave Bard sample file (k2wb)')
+    parser.add_argument('-o', '--output', required=True, help='Output file')
+    parser.add_argument('--align', type=int, default=FLASH_PAGE, help=f"Sample data alignment in bytes (default {FLASH_PAGE})")
+    args = parser.parse_args()
+
+    if args.align < XIP_CACHE_LINE or args.align & (args.align - 1):
+        parser.error(f"the alignment must be a power of two, at least {XIP_CACHE_LINE}")
+
+    with open(args.input, 'rb') as file:
+        data = file.read()
+    if data[:4] != MAGIC:
+        sys.exit(f"{args.input}: not a Wave Bard sample file")
+    data = data[:struct.unpack_from('<I', data, 4)[0]]
+
+    align = args.align
+    output = lay_out(data, align)
+    while len(output) > MAX_FILE_SIZE and align > XIP_CACHE_LINE:
+        align //= 2
+        output = lay_out(data, align)
+    if len(output) > MAX_FILE_SIZE:
+        sys.exit(f"{args.input}: {len(output)} bytes don't fit the {MAX_FILE_SIZE} bytes of the user data")
+    if align != args.align:
+        print(f"aligned to {align} bytes, {args.align} doesn't fit the user data", file=sys.stderr)
+
+    with open(args.output, 'wb') as file:
+        file.write(output)
+
+    print(f"{len(data)} -> {len(output)} bytes, samples aligned to {align} bytes", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
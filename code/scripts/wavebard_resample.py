@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+
+# Resamples a Wave Bard sample file (k2wb, see src/apps/WaveBard/WAVE_BARD_FORMAT.md) to the playback rate of the module
+#
+# A sample at the rate of the module plays at its original pitch one frame per output frame, the SamplePlayer
+# then reads the frames as they are instead of interpolating between them. The samples are resampled here once,
+# with a Kaiser windowed sinc filter, instead of by the interpolation on each playback, and the Sample Rate field
+# of the main header is set to the new rate.
+#
+#   python3 scripts/wavebard_resample.py SAMPLES.bin -o SAMPLES_44000.bin --rate 44000
+#
+# The samples are encoded again in the encoding of the file, the slice tables (wavebard_slices.py) are computed again.
+# The headers follow one another, without the Sample Index - wavebard_layout.py (run by the build) adds it.
+
+import argparse
+import math
+import struct
+import sys
+from typing import List
+
+from wavebard_slices import (ADPCM_BLOCK_FRAMES, ADPCM_CODE_BYTES, ADPCM_INDEX_CHANGES, ADPCM_STEPS, BANK_HEADER_SIZE,
+                             END_MARKER, FLAG_SAMPLE_INDEX, FLAG_SLICE_TABLE, HEADER_SIZE, MAGIC, SAMPLE_HEADER_SIZE,
+                             decode, slice_table, walk)
+
+# Default KASTLE2_SAMPLE_RATE (src/common/config.hpp)
+DEFAULT_RATE = 44000
+
+# Zero crossings of the sinc on each side and the Kaiser window (about 90 dB of stopband)
+ZERO_CROSSINGS = 16
+KAISER_BETA = 8.6
+# Passband edge relative to the lower Nyquist frequency, the transition band fits below it
+CUTOFF = 0.94
+
+
+def bessel_i0(x: float) -> float:
+    total = term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def polyphase_filter(up: int, down: int) -> List[List[float]]:
+    """Coefficients of the input frames -ZERO_CROSSINGS / cutoff + 1 to ZERO_CROSSINGS / cutoff around each of the up phases."""
+    cutoff = CUTOFF * min(1.0, up / down)
+    half = math.ceil(ZERO_CROSSINGS / cutoff)
+    phases = []
+    for phase in range(up):
+        fraction = phase / up
+        row = []
+        for tap in range(-half + 1, half + 1):
+            distance = tap - fraction
+            x = distance / half
+            window = bessel_i0(KAISER_BETA * math.sqrt(1 - x * x)) / bessel_i0(KAISER_BETA) if abs(x) < 1 else 0.0
+            sinc = math.sin(math.pi * cutoff * distance) / (math.pi * cutoff * distance) if distance else 1.0
+            row.append(cutoff * sinc * window)
+        # Unity gain at DC in every phase
+        gain = sum(row)
+        phases.append([coefficient / gain for coefficient in row])
+    return phases
+
+
+def resample(samples: List[int], channels: int, up: int, down: int, phases: List[List[float]]) -> List[int]:
+    """Interleaved 16-bit samples at up / down of the rate, the frames outside the sample are silent."""
+    frames = len(samples) // channels
+    taps = len(phases[0])
+    half = taps // 2
+    out_frames = (frames * up + down - 1) // down
+    output = [0] * (out_frames * channels)
+    for channel in range(channels):
+        padded = [0] * half + samples[channel::channels][:frames] + [0] * half
+        for frame in range(out_frames):
+            position = frame * down
+            start = position // up + 1
+            value = sum(map(float.__mul__, phases[position % up], padded[start:start + taps]))
+            output[frame * channels + channel] = max(-32768, min(32767, round(value)))
+    return output
+
+
+def mu_law_encode(value: int) -> int:
+    sign = 0x80 if value < 0 else 0
+    magnitude = min(abs(value), 32635) + 0x84
+    exponent = magnitude.bit_length() - 8
+    return ~(sign | exponent << 4 | (magnitude >> (exponent + 3)) & 0x0F) & 0xFF
+
+
+def a_law_encode(value: int) -> int:
+    mask = 0xD5 if value >= 0 else 0x55
+    magnitude = value if value >= 0 else -value - 1
+    segment = max(0, magnitude.bit_length() - 8)
+    code = segment << 4 | (magnitude >> (segment + 3 if segment else 4)) & 0x0F
+    return code ^ mask
+
+
+def encode_adpcm(samples: List[int], channels: int) -> bytes:
+    """IMA-ADPCM blocks, the last one padded with silence, and their seek table."""
+    frames = len(samples) // channels
+    blocks = (frames + ADPCM_BLOCK_FRAMES - 1) // ADPCM_BLOCK_FRAMES
+    samples = samples + [0] * (blocks * ADPCM_BLOCK_FRAMES * channels - len(samples))
+    codes = bytearray(blocks * ADPCM_CODE_BYTES * channels)
+    seek_table = bytearray()
+    predictors = [0] * channels
+    indexes = [0] * channels
+    for block in range(blocks):
+        for channel in range(channels):
+            seek_table += struct.pack('<hBB', predictors[channel], indexes[channel], 0)
+        for frame in range(ADPCM_BLOCK_FRAMES):
+            for channel in range(channels):
+                nibble = frame * channels + channel
+                predictor, index = predictors[channel], indexes[channel]
+                step = ADPCM_STEPS[index]
+                difference = samples[block * ADPCM_BLOCK_FRAMES * channels + nibble] - predictor
+                code = 8 if difference < 0 else 0
+                difference = abs(difference)
+                for bit, threshold in ((4, step), (2, step >> 1), (1, step >> 2)):
+                    if difference >= threshold:
+                        code |= bit
+                        difference -= threshold
+                # The predictor as the decoder gets it
+                delta = step >> 3
+                if code & 4:
+                    delta += step
+                if code & 2:
+                    delta += step >> 1
+                if code & 1:
+                    delta += step >> 2
+                predictor = predictor - delta if code & 8 else predictor + delta
+                predictors[channel] = max(-32768, min(32767, predictor))
+                indexes[channel] = max(0, min(len(ADPCM_STEPS) - 1, index + ADPCM_INDEX_CHANGES[code & 7]))
+                codes[block * ADPCM_CODE_BYTES * channels + (nibble >> 1)] |= code << ((nibble & 1) * 4)
+    return bytes(codes + seek_table)
+
+
+def encode(samples: List[int], channels: int, bit_depth: int, encoding: int) -> bytes:
+    """Sample data of the interleaved 16-bit samples, the inverse of decode()."""
+    if bit_depth == 16 and encoding == 0:
+        return struct.pack(f'<{len(samples)}h', *samples)
+    if bit_depth == 12 and encoding == 0:
+        if len(samples) % 2:
+            samples = samples + [0]
+        data = bytearray()
+        for i in range(0, len(samples), 2):
+            a, b = (min(2047, (sample + 8) >> 4) & 0xFFF for sample in samples[i:i + 2])
+            data += bytes([a & 0xFF, (a >> 8) | (b & 0x0F) << 4, b >> 4])
+        return bytes(data)
+    if bit_depth == 8 and encoding == 1:
+        return bytes(mu_law_encode(sample) for sample in samples)
+    if bit_depth == 8 and encoding == 2:
+        return bytes(a_law_encode(sample) for sample in samples)
+    if bit_depth == 4 and encoding == 3:
+        return encode_adpcm(samples, channels)
+    sys.exit(f"unsupported bit depth {bit_depth} with encoding {encoding}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Resample a Wave Bard sample file to the playback rate of the module.')
+    parser.add_argument('input', help='Wave Bard sample file (k2wb)')
+    parser.add_argument('-o', '--output', required=True, help='Output file')
+    parser.add_argument('--rate', type=int, default=DEFAULT_RATE,
+                        help=f"Sample rate of the firmware (KASTLE2_SAMPLE_RATE, default {DEFAULT_RATE})")
+    args = parser.parse_args()
+
+    if args.rate <= 0:
+        parser.error('the rate must be positive')
+
+    with open(args.input, 'rb') as file:
+        data = file.read()
+    if data[:4] != MAGIC:
+        sys.exit(f"{args.input}: not a Wave Bard sample file")
+    data = data[:struct.unpack_from('<I', data, 4)[0]]
+    _, _, rate, bit_depth, banks, samples_per_bank, scales, rhythms = struct.unpack_from('<4sIIBBBBB', data, 0)
+    encoding, flags = data[18], data[19]
+    if rate == 0:
+        sys.exit(f"{args.input}: no sample rate in the header")
+
+    index, samples, _ = walk(data)
+    divisor = math.gcd(args.rate, rate)
+    up, down = args.rate // divisor, rate // divisor
+    phases = polyphase_filter(up, down) if up != down else []
+
+    # Main header, scales and rhythms, then the banks and the samples one after another
+    output = bytearray(data[:HEADER_SIZE + 4 * scales + 4 * rhythms])
+    tables = []
+    sample = 0
+    for i, offset in enumerate(index):
+        if i % (samples_per_bank + 1) == 0:
+            output += data[offset:offset + BANK_HEADER_SIZE]
+            continue
+        data_offset, size, channels = samples[sample]
+        sample += 1
+        decoded = decode(data[data_offset:data_offset + size], channels, bit_depth, encoding)
+        if up != down:
+            decoded = resample(decoded, channels, up, down, phases)
+            encoded = encode(decoded, channels, bit_depth, encoding)
+            decoded = decode(encoded, channels, bit_depth, encoding)
+        else:
+            encoded = data[data_offset:data_offset + size]
+        output += struct.pack('<I', len(encoded)) + data[offset + 4:offset + SAMPLE_HEADER_SIZE]
+        output += encoded + bytes(len(encoded) & 1)
+        if flags & FLAG_SLICE_TABLE:
+            tables.append(slice_table(decoded, channels))
+
+    # Slice tables of the new frames, their offsets before the end marker
+    if flags & FLAG_SLICE_TABLE:
+        output += bytes(-len(output) % 4)
+        offsets = []
+        for table in tables:
+            offsets.append(len(output))
+            output += table
+        output += bytes(-len(output) % 4)
+        output += struct.pack(f'<{len(offsets)}I', *offsets)
+    output += END_MARKER
+
+    struct.pack_into('<I', output, 8, args.rate)
+    output[19] = flags & ~FLAG_SAMPLE_INDEX
+    struct.pack_into('<I', output, 4, len(output))
+    with open(args.output, 'wb') as file:
+        file.write(output)
+
+    print(f"{banks * samples_per_bank} samples, {rate} -> {args.rate} Hz, {len(data)} -> {len(output)} bytes", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+
+# Adds the slice tables to a Wave Bard sample file (k2wb, see src/apps/WaveBard/WAVE_BARD_FORMAT.md)
+#
+# The start points of Wave Bard (the reverse playback starts where the envelope ends at the sample end) snap
+# to the slice points, so they don't start in the middle of a waveform. Each sample gets one slice point
+# per 256 frames: the quietest frame of the first zero crossing in the step, found here once instead of
+# searching for it on the module.
+#
+#   python3 scripts/wavebard_slices.py SAMPLES.bin -o SAMPLES_SLICED.bin
+#
+# The file may already have the slice tables, they are computed again. The samples and the sample index stay as they are.
+
+import argparse
+import struct
+import sys
+from typing import List, Tuple
+
+MAGIC = b'k2wb'
+END_MARKER = b'ahoj'
+HEADER_SIZE = 20
+BANK_HEADER_SIZE = 12
+SAMPLE_HEADER_SIZE = 16
+
+FLAG_SAMPLE_INDEX = 0x01
+FLAG_SLICE_TABLE = 0x02
+
+SLICE_FRAMES = 256
+NO_SLICE = 0xFF
+
+ADPCM_BLOCK_FRAMES = 256
+ADPCM_CODE_BYTES = ADPCM_BLOCK_FRAMES // 2
+ADPCM_SEEK_BYTES = 4
+
+# src/common/dsp/sampling/AdpcmDecoder.hpp
+ADPCM_STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+ADPCM_INDEX_CHANGES = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def mu_law(code: int) -> int:
+    code = ~code & 0xFF
+    magnitude = (((code & 0x0F) << 3) + 0x84) << ((code & 0x70) >> 4)
+    return 0x84 - magnitude if code & 0x80 else magnitude - 0x84
+
+
+def a_law(code: int) -> int:
+    code ^= 0x55
+    segment = (code & 0x70) >> 4
+    magnitude = (code & 0x0F) << 4
+    magnitude = magnitude + 8 if segment == 0 else (magnitude + 0x108) << (segment - 1)
+    return magnitude if code & 0x80 else -magnitude
+
+
+def decode_adpcm(data: bytes, channels: int) -> List[int]:
+    block_bytes = ADPCM_CODE_BYTES * channels
+    blocks = len(data) // ((ADPCM_CODE_BYTES + ADPCM_SEEK_BYTES) * channels)
+    seek_table = blocks * block_bytes
+    samples = [0] * (blocks * ADPCM_BLOCK_FRAMES * channels)
+    for block in range(blocks):
+        codes = data[block * block_bytes:(block + 1) * block_bytes]
+        for channel in range(channels):
+            entry = seek_table + (block * channels + channel) * ADPCM_SEEK_BYTES
+            predictor = struct.unpack_from('<h', data, entry)[0]
+            index = min(data[entry + 2], len(ADPCM_STEPS) - 1)
+            for frame in range(ADPCM_BLOCK_FRAMES):
+                nibble = frame * channels + channel
+                code = (codes[nibble >> 1] >> ((nibble & 1) * 4)) & 0x0F
+                step = ADPCM_STEPS[index]
+                difference = step >> 3
+                if code & 4:
+                    difference += step
+                if code & 2:
+                    difference += step >> 1
+                if code & 1:
+                    difference += step >> 2
+                predictor = predictor - difference if code & 8 else predictor + difference
+                predictor = max(-32768, min(32767, predictor))
+                index = max(0, min(len(ADPCM_STEPS) - 1, index + ADPCM_INDEX_CHANGES[code & 7]))
+                samples[block * ADPCM_BLOCK_FRAMES * channels + nibble] = predictor
+    return samples
+
+
+def decode(data: bytes, channels: int, bit_depth: int, encoding: int) -> List[int]:
+    """Interleaved 16-bit samples of the sample data, as the SamplePlayer decodes them."""
+    if bit_depth == 16 and encoding == 0:
+        return list(struct.unpack(f'<{len(data) // 2}h', data[:len(data) // 2 * 2]))
+    if bit_depth == 12 and encoding == 0:
+        samples = []
+        for i in range(0, len(data) // 3 * 3, 3):
+            a = data[i] | ((data[i + 1] & 0x0F) << 8)
+            b = (data[i + 1] >> 4) | (data[i + 2] << 4)
+            samples += [(a ^ 0x800) - 0x800 << 4, (b ^ 0x800) - 0x800 << 4]
+        return samples
+    if bit_depth == 8 and encoding == 1:
+        return [mu_law(code) for code in data]
+    if bit_depth == 8 and encoding == 2:
+        return [a_law(code) for code in data]
+    if bit_depth == 4 and encoding == 3:
+        return decode_adpcm(data, channels)
+    sys.exit(f"unsupported bit depth {bit_depth} with encoding {encoding}")
+
+
+def frames_in_bytes(size: int, channels: int, bit_depth: int) -> int:
+    """Frames of the sample data, as SamplePlayer::FramesInBytes counts them."""
+    if bit_depth == 12:
+        return size // 3 * 2 // channels
+    if bit_depth == 4:
+        return size // ((ADPCM_CODE_BYTES + ADPCM_SEEK_BYTES) * channels) * ADPCM_BLOCK_FRAMES
+    return size // (bit_depth // 8) // channels
+
+
+def slice_table(samples: List[int], channels: int) -> bytes:
+    """One byte per step: the offset of the first zero crossing in the step, NO_SLICE without one."""
+    frames = [sum(samples[i:i + channels]) for i in range(0, len(samples) // channels * channels, channels)]
+    table = bytearray()
+    for start in range(0, len(frames), SLICE_FRAMES):
+        if start == 0:
+            # The sample start is where the forward playback starts anyway
+            table.append(0)
+            continue
+        offset = NO_SLICE
+        for frame in range(start, min(start + NO_SLICE, len(frames))):
+            if frames[frame] == 0 or (frames[frame - 1] < 0) != (frames[frame] < 0):
+                # The quieter frame of the pair, when it's still in the step
+                quieter = frame - 1 if abs(frames[frame - 1]) < abs(frames[frame]) and frame > start else frame
+                offset = quieter - start
+                break
+        table.append(offset)
+    return bytes(table)
+
+
+def walk(data: bytes) -> Tuple[List[int], List[Tuple[int, int, int]], int]:
+    """Bank and sample header offsets (the sample index), the samples (offset, size, channels) and the end of the last one."""
+    _, file_size, _, _, banks, samples_per_bank, scales, rhythms = struct.unpack_from('<4sIIBBBBB', data, 0)
+    flags = data[19]
+    entries = banks * (samples_per_bank + 1)
+    if flags & FLAG_SAMPLE_INDEX:
+        # The headers may be anywhere (eg. aligned by wavebard_layout.py), the index right before the end marker
+        index = list(struct.unpack_from(f'<{entries}I', data, file_size - len(END_MARKER) - 4 * entries))
+    else:
+        # Headers one after another, the data padded to an even size
+        index = []
+        offset = HEADER_SIZE + 4 * scales + 4 * rhythms
+        for _ in range(banks):
+            index.append(offset)
+            offset += BANK_HEADER_SIZE
+            for _ in range(samples_per_bank):
+                index.append(offset)
+                offset += SAMPLE_HEADER_SIZE + ((struct.unpack_from('<I', data, offset)[0] + 1) & ~1)
+                if offset > len(data):
+                    sys.exit('the samples go past the end of the file')
+    samples = []
+    samples_end = 0
+    for i, offset in enumerate(index):
+        if i % (samples_per_bank + 1) == 0:
+            continue
+        size, channels = struct.unpack_from('<IB', data, offset)
+        samples.append((offset + SAMPLE_HEADER_SIZE, size, channels))
+        samples_end = max(samples_end, offset + SAMPLE_HEADER_SIZE + ((size + 1) & ~1))
+    if samples_end > len(data):
+        sys.exit('the samples go past the end of the file')
+    return index, samples, samples_end
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Add the slice tables to a Wave Bard sample file.')
+    parser.add_argument('input', help='Wave Bard sample file (k2wb)')
+    parser.add_argument('-o', '--output', required=True, help='Output file')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as file:
+        data = file.read()
+    if data[:4] != MAGIC:
+        sys.exit(f"{args.input}: not a Wave Bard sample file")
+    file_size = struct.unpack_from('<I', data, 4)[0]
+    data = data[:file_size]
+    bit_depth, encoding, flags = data[12], data[18], data[19]
+
+    index, samples, samples_end = walk(data)
+
+    # The samples stay, the tables, their offsets and the sample index follow them
+    output = bytearray(data[:samples_end])
+    output += bytes(-len(output) % 4)
+    offsets = []
+    for offset, size, channels in samples:
+        offsets.append(len(output))
+        output += slice_table(decode(data[offset:offset + size], channels, bit_depth, encoding), channels)
+    output += bytes(-len(output) % 4)
+    output += struct.pack(f'<{len(offsets)}I', *offsets)
+    if flags & FLAG_SAMPLE_INDEX:
+        output += struct.pack(f'<{len(index)}I', *index)
+    output += END_MARKER
+
+    output[19] = flags | FLAG_SLICE_TABLE
+    struct.pack_into('<I', output, 4, len(output))
+    with open(args.output, 'wb') as file:
+        file.write(output)
+
+    print(f"{len(samples)} samples, {len(output) - samples_end - len(END_MARKER)} bytes of the tables and the index", file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
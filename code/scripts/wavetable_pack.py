@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+
+# Packs wavetables to a k2wt user data file (see src/common/dsp/synthesis/WavetableOscillator.hpp)
+#
+# Each source is a built-in shape (sine, triangle, saw, square) or a mono WAV file. A WAV file holds one
+# single cycle, or several of --cycle frames each (one table per cycle, like the common 2048 frame wavetables).
+# The tables are resampled to 2^--bits samples and band-limited per octave: mip level 0 keeps all the harmonics
+# the table can hold, each next level half of them, so the oscillator plays them without aliasing.
+#
+#   python3 scripts/wavetable_pack.py sine triangle saw square -o WAVETABLES.bin
+#   python3 scripts/wavetable_pack.py pad.wav --cycle 2048 -o WAVETABLES.bin
+
+import argparse
+import cmath
+import math
+import struct
+import sys
+import wave
+from typing import List
+
+MAGIC = b'k2wt'
+END_MARKER = b'ahoj'
+VERSION = 1
+MIN_BITS = 6
+MAX_BITS = 12
+MAX_LEVELS = 16
+MAX_TABLES = 255
+
+
+def shape(name: str, size: int) -> List[float]:
+    """One cycle of a built-in shape, harmonics are removed later by the mip levels."""
+    phases = [i / size for i in range(size)]
+    if name == 'sine':
+        return [math.sin(2 * math.pi * p) for p in phases]
+    if name == 'triangle':
+        return [1.0 - 4.0 * abs(p - 0.5) for p in phases]
+    if name == 'saw':
+        return [2.0 * p - 1.0 for p in phases]
+    if name == 'square':
+        return [1.0 if p < 0.5 else -1.0 for p in phases]
+    raise ValueError(name)
+
+
+def read_cycles(path: str, cycle: int) -> List[List[float]]:
+    with wave.open(path, 'rb') as wav:
+        if wav.getsampwidth() != 2:
+            sys.exit(f"{path}: only 16 bit WAV files are supported")
+        channels = wav.getnchannels()
+        raw = wav.readframes(wav.getnframes())
+    samples = struct.unpack(f'<{len(raw) // 2}h', raw)
+    # Mix down to mono
+    frames = [sum(samples[i:i + channels]) / (channels * 32768.0) for i in range(0, len(samples), channels)]
+    if cycle <= 0 or len(frames) <= cycle:
+        return [frames]
+    return [frames[i:i + cycle] for i in range(0, len(frames) - cycle + 1, cycle)]
+
+
+def fft(values: List[complex], inverse: bool = False) -> List[complex]:
+    """Radix-2 FFT, the length must be a power of two."""
+    size = len(values)
+    if size == 1:
+        return list(values)
+    sign = 1 if inverse else -1
+    even = fft(values[0::2], inverse)
+    odd = fft(values[1::2], inverse)
+    result = [0j] * size
+    for k in range(size // 2):
+        twiddle = cmath.exp(sign * 2j * math.pi * k / size) * odd[k]
+        result[k] = even[k] + twiddle
+        result[k + size // 2] = even[k] - twiddle
+    return result
+
+
+def harmonics_of(cycle: List[float], count: int) -> List[complex]:
+    """Complex amplitudes of the harmonics 1 to count of the cycle (any length)."""
+    size = len(cycle)
+    if size & (size - 1) == 0:
+        spectrum = fft([complex(v) for v in cycle])
+        return [spectrum[h] / size if h < size // 2 else 0j for h in range(1, count + 1)]
+    result = []
+    for h in range(1, count + 1):
+        if h >= size / 2:
+            result.append(0j)
+            continue
+        step = -2j * math.pi * h / size
+        result.append(sum(v * cmath.exp(step * i) for i, v in enumerate(cycle)) / size)
+    return result
+
+
+def mip_levels(cycle: List[float], bits: int, levels: int) -> List[List[float]]:
+    """Resamples the cycle to 2^bits samples in the frequency domain, level k keeps 2^(bits-1) >> k harmonics.
+    The Nyquist harmonic is left out (no phase in a real table) and so is DC."""
+    size = 1 << bits
+    harmonics = harmonics_of(cycle, size // 2 - 1)
+    result = []
+    for level in range(levels):
+        count = max(1, (size // 2) >> level)
+        spectrum = [0j] * size
+        for h in range(1, min(count, size // 2 - 1) + 1):
+            spectrum[h] = harmonics[h - 1]
+            spectrum[size - h] = harmonics[h - 1].conjugate()
+        result.append([v.real for v in fft(spectrum, inverse=True)])
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack wavetables to a Kastle 2 k2wt user data file.')
+    parser.add_argument('sources', nargs='+', help='sine, triangle, saw, square or a mono 16 bit WAV file')
+    parser.add_argument('-o', '--output', required=True, help='Output file')
+    parser.add_argument('--bits', type=int, default=11, help=f'Table size 2^bits ({MIN_BITS}-{MAX_BITS}, default: 11)')
+    parser.add_argument('--levels', type=int, help='Mip levels (default: down to the fundamental only)')
+    parser.add_argument('--cycle', type=int, default=0, help='Frames of one cycle in the WAV files (default: whole file)')
+    args = parser.parse_args()
+
+    if not MIN_BITS <= args.bits <= MAX_BITS:
+        sys.exit(f"--bits must be {MIN_BITS} to {MAX_BITS}")
+    levels = args.levels if args.levels else min(args.bits, MAX_LEVELS)
+    if not 1 <= levels <= MAX_LEVELS:
+        sys.exit(f"--levels must be 1 to {MAX_LEVELS}")
+
+    cycles = []
+    for source in args.sources:
+        if source in ('sine', 'triangle', 'saw', 'square'):
+            cycles.append(shape(source, 1 << MAX_BITS))
+        else:
+            cycles += read_cycles(source, args.cycle)
+    if not 1 <= len(cycles) <= MAX_TABLES:
+        sys.exit(f"{len(cycles)} tables, 1 to {MAX_TABLES} are supported")
+
+    tables = [mip_levels(cycle, args.bits, levels) for cycle in cycles]
+    # The same gain for all the tables and levels keeps the morphing and the level changes smooth
+    peak = max(abs(v) for table in tables for level in table for v in level)
+    gain = 32767.0 / peak if peak > 0 else 0.0
+
+    data = bytearray()
+    for table in tables:
+        for level in table:
+            samples = [max(-32768, min(32767, round(v * gain))) for v in level]
+            # Guard sample for the interpolation
+            data += struct.pack(f'<{len(samples) + 1}h', *samples, samples[0])
+
+    header_size = 12
+    file_size = header_size + len(data) + len(END_MARKER)
+    with open(args.output, 'wb') as output:
+        output.write(MAGIC + struct.pack('<IBBBB', file_size, VERSION, args.bits, levels, len(tables)))
+        output.write(data)
+        output.write(END_MARKER)
+    print(f"{args.output}: {len(tables)} tables, {levels} levels of {1 << args.bits} samples, {file_size} bytes")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,491 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AppBenchmark.hpp"
+#include <algorithm>
+#include <cstdio>
+#include "hardware/structs/systick.h"
+#include "hardware/sync.h"
+#include "common/EnumTools.hpp"
+#include "common/dsp/synthesis/WhiteNoise.hpp"
+
+using namespace kastle2;
+
+static const EnumArray<AppBenchmark::Kernel, const char *> kKernelNames = {
+    "Svf",
+    "Svf (block)",
+    "SvfStereo",
+    "SvfStereo (block)",
+    "DjFilterStereo",
+    "DjFilterStereo (block)",
+    "Fm2",
+    "Fm2 (block)",
+    "FmVoice (4 ops, block)",
+    "MultiOscillator",
+    "MultiOscillator (block)",
+    "MultiOscillator (block, polyBLEP)",
+    "OscillatorQ15",
+    "OscillatorQ15 (block)",
+    "StereoDelay",
+    "StereoDelay (block)",
+    "AdvancedDynamicDelayLine",
+    "AdvancedDynamicDelayLine (32-bit slew)",
+    "AdvancedDynamicDelayLine (32-bit slew, mu-law)",
+    "AdvancedDynamicDelayLine (32-bit slew, 12-bit packed)",
+    "MultiTapDelayLine (4 taps, block)",
+    "PlateReverb (block)",
+    "GranularCloud (16 grains, block)",
+    "PitchShifter (block)",
+    "SamplePlayer16bit",
+    "SamplePlayer16bit (block)",
+    "SamplePlayer16bit (block, Hermite)",
+    "Quantizer",
+    "SoftClipper",
+    "SoftClipper (block)",
+    "Compressor (stereo, block)",
+    "WhiteNoise",
+    "WhiteNoise (block)",
+    "Slewer",
+    "Slewer (block)",
+    "PortamentoQ15 (block)",
+    "BitCrusher",
+    "BitCrusher (block)",
+};
+
+void AppBenchmark::Init()
+{
+    inited_ = false;
+
+    // Nothing else than the benchmark should run
+    Kastle2::base.SetFeatureEnabled(Base::Feature::AUDIO_CHAIN, false);
+    Kastle2::debug.SetEnabled(true);
+
+    // Free-running 24-bit counter clocked by the processor clock
+    systick_hw->csr = 0;
+    systick_hw->rvr = kSysTickMask;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+    // Test signals
+    WhiteNoise noise;
+    noise.Seed(1);
+    for (auto &sample : input_)
+    {
+        sample = q15_mult(noise.Process(), q15(0.5f));
+    }
+    for (size_t i = 0; i < sample_.size(); i++)
+    {
+        sample_[i] = q15_sine(fraction_to_q15(i, sample_.size()));
+    }
+
+    // Kernels with some typical settings
+    svf_.Init(SAMPLE_RATE);
+    svf_.SetFrequency(1000.0f);
+    svf_.SetResonance(0.7f);
+
+    svf_stereo_.Init(SAMPLE_RATE);
+    svf_stereo_.SetFrequency(1000.0f);
+    svf_stereo_.SetResonance(0.7f);
+
+    dj_filter_stereo_.Init(SAMPLE_RATE);
+    dj_filter_stereo_.SetCrossfade(q15(-0.5f));
+
+    fm2_.Init(SAMPLE_RATE);
+    fm2_.SetFrequency(220.0f);
+
+    fm_voice_.Init(SAMPLE_RATE);
+    fm_voice_.SetFrequency(220.0f);
+    fm_voice_.SetFeedback(q15(0.2f));
+
+    multi_oscillator_.Init(SAMPLE_RATE);
+    multi_oscillator_.SetFrequency(220.0f);
+
+    multi_oscillator_polyblep_.Init(SAMPLE_RATE);
+    multi_oscillator_polyblep_.SetFrequency(220.0f);
+    multi_oscillator_polyblep_.SetBandLimited(true);
+
+    oscillator_q15_.Init(SAMPLE_RATE);
+    oscillator_q15_.SetFrequency(220.0f);
+
+    stereo_delay_.Init(SAMPLE_RATE);
+    stereo_delay_.SetDelay(kDelayLength / 2, kDelayLength / 3);
+    stereo_delay_.SetFilterEnabled(true);
+
+    delay_line_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(kDelayLength);
+    delay_line_->SetDelay(kDelayLength / 2);
+
+    delay_line_32bit_slew_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(kDelayLength);
+    delay_line_32bit_slew_->SetDelay(kDelayLength / 2);
+
+    delay_line_mu_law_ = std::make_unique<AdvancedDynamicDelayLine<MuLawSample, DelaySlew::BITS_32>>(kDelayLength);
+    delay_line_mu_law_->SetDelay(kDelayLength / 2);
+
+    delay_line_packed_12_ = std::make_unique<AdvancedDynamicDelayLine<Packed12Sample, DelaySlew::BITS_32>>(kDelayLength);
+    delay_line_packed_12_->SetDelay(kDelayLength / 2);
+
+    multi_tap_delay_line_ = std::make_unique<MultiTapDelayLine<q15least_t, kDelayTaps>>(kDelayLength);
+    for (size_t tap = 0; tap < kDelayTaps; tap++)
+    {
+        multi_tap_delay_line_->SetDelay(tap, kDelayLength / (tap + 2));
+    }
+    for (size_t i = 0; i < kBlockSize; i++)
+    {
+        delay_input_[i] = static_cast<q15least_t>(input_[i]);
+    }
+
+    plate_reverb_ = std::make_unique<PlateReverb>();
+    plate_reverb_->Init();
+    plate_reverb_->SetDecay(q15(0.8f));
+
+    // Dense enough for kGranularGrains playing most of the time
+    granular_cloud_ = std::make_unique<GranularCloud>();
+    granular_cloud_->Init(kGranularLength);
+    granular_cloud_->SetGrainSize(kGranularLength / 8);
+    granular_cloud_->SetDensity(kGranularGrains * SAMPLE_RATE / (kGranularLength / 8));
+    granular_cloud_->SetPitch(1.5f);
+
+    pitch_shifter_.Init(kDelayLength);
+    pitch_shifter_.SetWindow(1024);
+    pitch_shifter_.SetRatio(1.5f);
+
+    sample_player_.Init(SAMPLE_RATE);
+    sample_player_.SetSample({.data = sample_.data(), .length = sample_.size(), .channels = SamplePlayer16bit::MONO});
+    sample_player_.SetHifi(true);
+    sample_player_.SetSpeed(0.75f);
+    sample_player_.Play();
+
+    quantizer_.Init();
+    quantizer_.SetEnabled(true);
+
+    soft_clipper_.Init(SAMPLE_RATE);
+    soft_clipper_.SetDrive(q15(0.5f));
+
+    compressor_.Init(SAMPLE_RATE / kBlockSize);
+    compressor_.SetCurve(q15(0.25f), q15(0.75f), q15(0.5f));
+
+    white_noise_.Seed(1);
+
+    slewer_.Init();
+    slewer_.SetSpeed(3);
+
+    portamento_q15_.Init(SAMPLE_RATE);
+    portamento_q15_.SetSpeed(0.1f);
+
+    bit_crusher_.Init();
+    bit_crusher_.SetBitDepth(4);
+    bit_crusher_.SetSampleRate(Q15_MAX / 8);
+
+    report_timeout_ = make_timeout_time_ms(kReportIntervalMs);
+    inited_ = true;
+}
+
+void AppBenchmark::DeInit()
+{
+    inited_ = false;
+    delay_line_.reset();
+    delay_line_32bit_slew_.reset();
+    delay_line_mu_law_.reset();
+    delay_line_packed_12_.reset();
+    multi_tap_delay_line_.reset();
+    plate_reverb_.reset();
+    granular_cloud_.reset();
+}
+
+FASTCODE void AppBenchmark::RunKernel(Kernel kernel)
+{
+    const q15_t *in = input_.data();
+    q15_t *out = output_.data();
+
+    switch (kernel)
+    {
+    case Kernel::SVF:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = svf_.Process(in[i]);
+        }
+        break;
+    case Kernel::SVF_BLOCK:
+        svf_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::SVF_STEREO:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            svf_stereo_.Process(in[2 * i], in[2 * i + 1]);
+            out[2 * i] = svf_stereo_.GetLeft();
+            out[2 * i + 1] = svf_stereo_.GetRight();
+        }
+        break;
+    case Kernel::SVF_STEREO_BLOCK:
+        svf_stereo_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::DJ_FILTER_STEREO:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            dj_filter_stereo_.Process(in[2 * i], in[2 * i + 1]);
+            out[2 * i] = dj_filter_stereo_.GetLeft();
+            out[2 * i + 1] = dj_filter_stereo_.GetRight();
+        }
+        break;
+    case Kernel::DJ_FILTER_STEREO_BLOCK:
+        dj_filter_stereo_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::FM2:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = q31_to_q15(fm2_.Process());
+        }
+        break;
+    case Kernel::FM2_BLOCK:
+        fm2_.ProcessBlock(fm2_output_.data(), kBlockSize);
+        break;
+    case Kernel::FM_VOICE_BLOCK:
+        fm_voice_.ProcessBlock(out, kBlockSize);
+        break;
+    case Kernel::MULTI_OSCILLATOR:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            oscillator_outputs_[i] = multi_oscillator_.Process();
+        }
+        break;
+    case Kernel::MULTI_OSCILLATOR_BLOCK:
+        multi_oscillator_.ProcessBlock(oscillator_outputs_.data(), kBlockSize);
+        break;
+    case Kernel::MULTI_OSCILLATOR_POLYBLEP_BLOCK:
+        multi_oscillator_polyblep_.ProcessBlock(oscillator_outputs_.data(), kBlockSize);
+        break;
+    case Kernel::OSCILLATOR_Q15:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = oscillator_q15_.Process();
+        }
+        break;
+    case Kernel::OSCILLATOR_Q15_BLOCK:
+        oscillator_q15_.ProcessBlock(out, kBlockSize);
+        break;
+    case Kernel::STEREO_DELAY:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            StereoDelay::Output delayed = stereo_delay_.Process(in[2 * i], in[2 * i + 1]);
+            out[2 * i] = delayed.left;
+            out[2 * i + 1] = delayed.right;
+        }
+        break;
+    case Kernel::STEREO_DELAY_BLOCK:
+        stereo_delay_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::DELAY_LINE:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = delay_line_->Read();
+            delay_line_->Write(in[i]);
+        }
+        break;
+    case Kernel::DELAY_LINE_32BIT_SLEW:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = delay_line_32bit_slew_->Read();
+            delay_line_32bit_slew_->Write(in[i]);
+        }
+        break;
+    case Kernel::DELAY_LINE_MU_LAW:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = delay_line_mu_law_->Read();
+            delay_line_mu_law_->Write(in[i]);
+        }
+        break;
+    case Kernel::DELAY_LINE_PACKED_12:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = delay_line_packed_12_->Read();
+            delay_line_packed_12_->Write(in[i]);
+        }
+        break;
+    case Kernel::MULTI_TAP_DELAY_LINE_BLOCK:
+        multi_tap_delay_line_->ProcessBlock(delay_input_.data(), delay_taps_.data(), kBlockSize);
+        break;
+    case Kernel::PLATE_REVERB_BLOCK:
+        plate_reverb_->ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::GRANULAR_CLOUD_BLOCK:
+        granular_cloud_->ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::PITCH_SHIFTER_BLOCK:
+        pitch_shifter_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::SAMPLE_PLAYER:
+        RestartSamplePlayer();
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = sample_player_.Process();
+        }
+        break;
+    case Kernel::SAMPLE_PLAYER_BLOCK:
+        RestartSamplePlayer();
+        sample_player_.ProcessBlock(sample_frames_.data(), kBlockSize);
+        break;
+    case Kernel::SAMPLE_PLAYER_HERMITE_BLOCK:
+        RestartSamplePlayer();
+        sample_player_.ProcessBlock<SamplePlayer16bit::Interpolation::HERMITE>(sample_frames_.data(), kBlockSize);
+        break;
+    case Kernel::QUANTIZER:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            quantizer_output_ = quantizer_.Process(100.0f + in[i] * 0.01f);
+        }
+        break;
+    case Kernel::SOFT_CLIPPER:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = soft_clipper_.Process(in[i]);
+        }
+        break;
+    case Kernel::SOFT_CLIPPER_BLOCK:
+        soft_clipper_.ProcessBlock(in, out, kBlockSize);
+        break;
+    case Kernel::COMPRESSOR_BLOCK:
+        compressor_.Detect(in, 2 * kBlockSize);
+        compressor_.Update(kBlockSize);
+        compressor_.ProcessBlock(in, out, kBlockSize, 2);
+        break;
+    case Kernel::WHITE_NOISE:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = white_noise_.Process();
+        }
+        break;
+    case Kernel::WHITE_NOISE_BLOCK:
+        white_noise_.Render(out, kBlockSize);
+        break;
+    case Kernel::SLEWER:
+        // Back and forth over the whole range, so it keeps moving
+        if (slewer_.IsAtTarget())
+        {
+            slewer_.SetValue(slewer_.GetValue() == 0 ? Q15_MAX : 0);
+        }
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            smoothed_value_ = slewer_.Process();
+        }
+        break;
+    case Kernel::SLEWER_BLOCK:
+        if (slewer_.IsAtTarget())
+        {
+            slewer_.SetValue(slewer_.GetValue() == 0 ? Q15_MAX : 0);
+        }
+        if (slewer_.ProcessBlock(kBlockSize))
+        {
+            smoothed_value_ = slewer_.GetValue();
+        }
+        break;
+    case Kernel::PORTAMENTO_Q15_BLOCK:
+        if (portamento_q15_.IsAtTarget())
+        {
+            portamento_q15_.SetValue(portamento_q15_.GetValue() == 0 ? Q15_MAX : 0);
+        }
+        if (portamento_q15_.Process(kBlockSize))
+        {
+            smoothed_value_ = portamento_q15_.GetValue();
+        }
+        break;
+    case Kernel::BIT_CRUSHER:
+        for (size_t i = 0; i < kBlockSize; i++)
+        {
+            out[i] = bit_crusher_.Process(in[i]);
+        }
+        break;
+    case Kernel::BIT_CRUSHER_BLOCK:
+        bit_crusher_.ProcessBlock(in, out, kBlockSize);
+        break;
+    default:
+        break;
+    }
+}
+
+void AppBenchmark::RestartSamplePlayer()
+{
+    // Keep measuring the playback, not the stopped player
+    if (!sample_player_.IsPlaying())
+    {
+        sample_player_.Play();
+    }
+}
+
+AppBenchmark::Result AppBenchmark::Measure(Kernel kernel)
+{
+    Result result{.min = UINT32_MAX, .sum = 0};
+    for (size_t i = 0; i < kRepeats; i++)
+    {
+        uint32_t interrupt_state = save_and_disable_interrupts();
+        uint32_t start = systick_hw->cvr;
+        RunKernel(kernel);
+        uint32_t cycles = (start - systick_hw->cvr) & kSysTickMask; // SysTick counts down
+        restore_interrupts(interrupt_state);
+
+        result.min = std::min(result.min, cycles);
+        result.sum += cycles;
+
+        // Keep USB alive
+        Kastle2::UsbTask();
+    }
+    return result;
+}
+
+void AppBenchmark::Report()
+{
+    char buff[96];
+#ifdef FASTCODE_ENABLED
+    Kastle2::debug.PrintLine("Benchmark (FASTCODE in RAM), cycles per sample:");
+#else
+    Kastle2::debug.PrintLine("Benchmark (flash only), cycles per sample:");
+#endif
+    for (auto kernel : EnumRange<Kernel>())
+    {
+        const Result result = Measure(kernel);
+        const uint32_t avg = result.sum / kRepeats;
+        snprintf(buff, sizeof(buff), "%-26s min %5lu avg %5lu (%lu%% of the block)",
+                 kKernelNames[kernel],
+                 static_cast<unsigned long>(result.min / kBlockSize),
+                 static_cast<unsigned long>(avg / kBlockSize),
+                 static_cast<unsigned long>((avg * 100) / kBlockBudgetCycles));
+        Kastle2::debug.PrintLine(buff);
+    }
+}
+
+void AppBenchmark::UiLoop()
+{
+    if (!inited_)
+    {
+        return;
+    }
+
+    if (absolute_time_diff_us(report_timeout_, get_absolute_time()) > 0)
+    {
+        Report();
+        report_timeout_ = make_timeout_time_ms(kReportIntervalMs);
+    }
+
+    // Blinking means the benchmark is running
+    Kastle2::hw.SetLed(Hardware::Led::LED_1, (to_ms_since_boot(get_absolute_time()) / 500) % 2 ? 0x00FF00 : 0x000000);
+}
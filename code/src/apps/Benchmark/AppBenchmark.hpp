@@ -0,0 +1,243 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/core/App.hpp"
+#include "common/core/Kastle2.hpp"
+#include "common/dsp/effects/BitCrusher.hpp"
+#include "common/dsp/effects/Compressor.hpp"
+#include "common/dsp/effects/PitchShifter.hpp"
+#include "common/dsp/effects/PlateReverb.hpp"
+#include "common/dsp/effects/SoftClipper.hpp"
+#include "common/dsp/effects/StereoDelay.hpp"
+#include "common/dsp/filters/DjFilterStereo.hpp"
+#include "common/dsp/filters/Svf.hpp"
+#include "common/dsp/filters/SvfStereo.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/sampling/GranularCloud.hpp"
+#include "common/dsp/sampling/SamplePlayer.hpp"
+#include "common/dsp/synthesis/Fm2.hpp"
+#include "common/dsp/synthesis/FmVoice.hpp"
+#include "common/dsp/synthesis/MultiOscillator.hpp"
+#include "common/dsp/synthesis/OscillatorQ15.hpp"
+#include "common/dsp/synthesis/WhiteNoise.hpp"
+#include "common/dsp/utility/AdvancedDynamicDelayLine.hpp"
+#include "common/dsp/utility/MuLawSample.hpp"
+#include "common/dsp/utility/MultiTapDelayLine.hpp"
+#include "common/dsp/utility/PortamentoQ15.hpp"
+#include "common/dsp/utility/Quantizer.hpp"
+#include "common/dsp/utility/Slewer.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AppBenchmark
+ * @ingroup apps
+ * @brief Measures cycles per sample of the DSP library kernels and prints them over USB serial.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Each kernel processes one audio block (AUDIO_BUFFER_SIZE frames) with interrupts disabled,
+ * timed by the SysTick counter. The table is printed every kReportIntervalMs.
+ * Audio is not started, so nothing else competes for the CPU.
+ *
+ * The `benchmark` target runs the FASTCODE kernels from RAM, `benchmark-flash` is the same
+ * app built with KASTLE2_FASTCODE_DISABLED, so everything executes from the QSPI flash.
+ */
+class AppBenchmark final : public App
+{
+public:
+    /**
+     * @brief Measured kernels.
+     */
+    enum class Kernel
+    {
+        SVF,
+        SVF_BLOCK,
+        SVF_STEREO,
+        SVF_STEREO_BLOCK,
+        DJ_FILTER_STEREO,
+        DJ_FILTER_STEREO_BLOCK,
+        FM2,
+        FM2_BLOCK,
+        FM_VOICE_BLOCK,
+        MULTI_OSCILLATOR,
+        MULTI_OSCILLATOR_BLOCK,
+        MULTI_OSCILLATOR_POLYBLEP_BLOCK,
+        OSCILLATOR_Q15,
+        OSCILLATOR_Q15_BLOCK,
+        STEREO_DELAY,
+        STEREO_DELAY_BLOCK,
+        DELAY_LINE,
+        DELAY_LINE_32BIT_SLEW,
+        DELAY_LINE_MU_LAW,
+        DELAY_LINE_PACKED_12,
+        MULTI_TAP_DELAY_LINE_BLOCK,
+        PLATE_REVERB_BLOCK,
+        GRANULAR_CLOUD_BLOCK,
+        PITCH_SHIFTER_BLOCK,
+        SAMPLE_PLAYER,
+        SAMPLE_PLAYER_BLOCK,
+        SAMPLE_PLAYER_HERMITE_BLOCK,
+        QUANTIZER,
+        SOFT_CLIPPER,
+        SOFT_CLIPPER_BLOCK,
+        COMPRESSOR_BLOCK,
+        WHITE_NOISE,
+        WHITE_NOISE_BLOCK,
+        SLEWER,
+        SLEWER_BLOCK,
+        PORTAMENTO_Q15_BLOCK,
+        BIT_CRUSHER,
+        BIT_CRUSHER_BLOCK,
+        COUNT
+    };
+
+    /**
+     * @brief Initializes all the kernels and the SysTick counter.
+     */
+    void Init();
+
+    /**
+     * @brief Deinitializes the app.
+     */
+    void DeInit();
+
+    /**
+     * @brief Audio is not used by the benchmark.
+     */
+    void AudioLoop([[maybe_unused]] q15_t *input, [[maybe_unused]] q15_t *output, [[maybe_unused]] size_t size) {}
+
+    /**
+     * @brief Runs the benchmark and prints the results periodically.
+     */
+    void UiLoop();
+
+    /**
+     * @brief Nothing stored in the memory.
+     */
+    void MemoryInitialization() {}
+
+    /**
+     * @brief Returns the app ID.
+     * @return The app ID.
+     */
+    uint8_t GetId()
+    {
+        return Kastle2::kDefaultAppId;
+    }
+
+private:
+    /**
+     * @brief Results of one kernel.
+     */
+    struct Result
+    {
+        uint32_t min; ///< Fastest block in cycles
+        uint32_t sum; ///< Sum of all the blocks in cycles
+    };
+
+    static constexpr size_t kBlockSize = AUDIO_BUFFER_SIZE;
+    static constexpr size_t kRepeats = 64;
+    static constexpr uint32_t kReportIntervalMs = 2000;
+    static constexpr size_t kDelayLength = 4800;
+    static constexpr size_t kDelayTaps = 4;
+    static constexpr size_t kSampleLength = 1024;
+    static constexpr size_t kGranularLength = 16384;
+    static constexpr size_t kGranularGrains = 16;
+    static constexpr uint32_t kSysTickMask = 0x00FFFFFF;
+    static constexpr uint32_t kBlockBudgetCycles = static_cast<uint32_t>(SYSTEM_CLOCK_KHZ * 1000.0f / AUDIO_LOOP_RATE);
+
+    /**
+     * @brief Processes one block with the kernel.
+     * @param kernel Kernel to run.
+     */
+    FASTCODE void RunKernel(Kernel kernel);
+
+    /**
+     * @brief Starts the sample player again when the sample ended.
+     */
+    void RestartSamplePlayer();
+
+    /**
+     * @brief Measures the kernel kRepeats times.
+     * @param kernel Kernel to measure.
+     * @return Measured cycles.
+     */
+    Result Measure(Kernel kernel);
+
+    /**
+     * @brief Prints a table of all the kernels over USB serial.
+     */
+    void Report();
+
+    bool inited_ = false;
+    absolute_time_t report_timeout_;
+
+    // Test signals
+    std::array<q15_t, kBlockSize * 2> input_;
+    std::array<q15_t, kBlockSize * 2> output_;
+    std::array<MultiOscillator::Outputs, kBlockSize> oscillator_outputs_;
+    std::array<q31_t, kBlockSize> fm2_output_;
+    std::array<int16_t, kSampleLength> sample_;
+    std::array<int16_t, kBlockSize * 2> sample_frames_;
+    std::array<q15least_t, kBlockSize> delay_input_;
+    std::array<q15least_t, kBlockSize * kDelayTaps> delay_taps_;
+    float quantizer_output_ = 0.0f;
+    int32_t smoothed_value_ = 0;
+
+    // Kernels
+    Svf svf_;
+    SvfStereo svf_stereo_;
+    DjFilterStereo dj_filter_stereo_;
+    Fm2 fm2_;
+    FmVoice<4, fm_algorithms::kStack> fm_voice_;
+    MultiOscillator multi_oscillator_;
+    MultiOscillator multi_oscillator_polyblep_;
+    OscillatorQ15 oscillator_q15_;
+    StereoDelay stereo_delay_{kDelayLength};
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_line_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> delay_line_32bit_slew_;
+    std::unique_ptr<AdvancedDynamicDelayLine<MuLawSample, DelaySlew::BITS_32>> delay_line_mu_law_;
+    std::unique_ptr<AdvancedDynamicDelayLine<Packed12Sample, DelaySlew::BITS_32>> delay_line_packed_12_;
+    std::unique_ptr<MultiTapDelayLine<q15least_t, kDelayTaps>> multi_tap_delay_line_;
+    std::unique_ptr<PlateReverb> plate_reverb_;
+    std::unique_ptr<GranularCloud> granular_cloud_;
+    PitchShifter pitch_shifter_;
+    SamplePlayer16bit sample_player_;
+    Quantizer quantizer_;
+    SoftClipper soft_clipper_;
+    Compressor compressor_;
+    WhiteNoise white_noise_;
+    Slewer slewer_;
+    PortamentoQ15 portamento_q15_;
+    BitCrusher bit_crusher_;
+};
+}
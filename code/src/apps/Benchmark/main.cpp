@@ -0,0 +1,59 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Main stuff
+#include "common/core/Kastle2.hpp"
+#include "apps/Benchmark/AppBenchmark.hpp"
+
+using namespace kastle2;
+
+/**
+ * @file main.cpp
+ * @brief Main entry point for the DSP benchmark firmware.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+
+AppBenchmark app;
+
+int main()
+{
+    // Initializes the hardware
+    Kastle2::Init();
+
+    // Register it with the Kastle2
+    Kastle2::RegisterApp(&app);
+
+    // Initialize the app
+    app.Init();
+
+    // No audio, the benchmark runs in the UI loop
+    while (true)
+    {
+        Kastle2::ReadInputs();
+        app.UiLoop();
+    }
+
+    return 0;
+}
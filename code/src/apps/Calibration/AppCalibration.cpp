@@ -23,13 +23,17 @@ SOFTWARE.
 */
 
 #include "AppCalibration.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
 #include "common/core/Kastle2.hpp"
 #include "common/utils.hpp"
 #include "Sentence.hpp"
 
 using namespace kastle2;
 
-void AppCalibration::Init()
+COLDCODE void AppCalibration::Init()
 {
     inited_ = false;
     voltages_ok_ = false;
@@ -51,8 +55,14 @@ void AppCalibration::Init()
     // Disable HW calibrations so we get the raw ADC values
     Kastle2::hw.SetCalibrationsEnabled(false);
 
+    // Automated mode commands
+    Kastle2::debug.SetEnabled(true);
+    capturing_ = false;
+    automated_points_ = {};
+
     // Sample player initialization
     sample_player_.Init(SAMPLE_RATE, 22050);
+    sample_player_.SetAdpcmDecoder(&prompt_decoder_);
     sample_player_.SetHifi(true);
 
     // Envelope follower to get nice LED action
@@ -72,7 +82,7 @@ void AppCalibration::Init()
     inited_ = true;
 }
 
-void AppCalibration::PlaySentence(SentenceName sentence_name)
+COLDCODE void AppCalibration::PlaySentence(SentenceName sentence_name)
 {
     current_sentence_ = &sentences_[sentence_name];
     current_sentence_->Reset();
@@ -108,7 +118,7 @@ void AppCalibration::CheckSentencePlayState()
             StartCalibrationSequence();
             break;
         case Stage::CALIBRATING:
-            if (is_testing_voltage_)
+            if (is_testing_voltage_ && !capturing_)
             {
                 MoveToNextCalibrationStep();
             }
@@ -166,6 +176,7 @@ void AppCalibration::SetStage(Stage stage)
             break;
         }
         next_time_write_calibrations_ = true;
+        PrintFit();
         break;
     default:
         break;
@@ -245,8 +256,8 @@ void AppCalibration::UiLoop()
     }
 
     // Read ADCs
-    adc_readings_[Input::FREE].Add(Kastle2::hw.GetAnalogValue(Hardware::AnalogInput::PITCH_1));
-    adc_readings_[Input::NOTE].Add(Kastle2::hw.GetAnalogValue(Hardware::AnalogInput::PITCH_2));
+    ProcessCapture();
+    ProcessSerial();
 
     // Extra debouncing to prevent accidental double-triggers
     // Shouldn't be necessary, but let's be sure
@@ -261,7 +272,8 @@ void AppCalibration::UiLoop()
         }
     }
 
-    if (is_valid_press)
+    // The capture of the current step decides first
+    if (is_valid_press && !capturing_)
     {
         switch (current_stage_)
         {
@@ -279,9 +291,9 @@ void AppCalibration::UiLoop()
             }
             else
             {
-                // Start testing the current voltage
+                // Start testing the current voltage, ProcessCapture() checks it when the capture is done
                 is_testing_voltage_ = true;
-                ProcessCurrentCalibrationStep();
+                StartCapture(false, calibration_sequence_[current_calibration_step_].voltage);
             }
             break;
         case Stage::SUCCESS:
@@ -354,7 +366,7 @@ void AppCalibration::ProcessCurrentCalibrationStep()
     const auto &step = calibration_sequence_[current_calibration_step_];
 
     // Skip step if version doesn't match (unless step version is COUNT which means all versions)
-    if (step.version != Hardware::Version::COUNT && step.version != Kastle2::hw.GetVersion())
+    if (!IsStepUsed(step))
     {
         current_calibration_step_++;
         ProcessCurrentCalibrationStep();
@@ -364,7 +376,7 @@ void AppCalibration::ProcessCurrentCalibrationStep()
     if (is_testing_voltage_)
     {
         // Test the voltage
-        int32_t current_reading = adc_readings_[step.input].GetAverage();
+        const int32_t current_reading = (GetCaptureFine(step.input) + (1 << (Hardware::kPitchFineBits - 1))) >> Hardware::kPitchFineBits;
         Hardware::Calibration cal_type = GetCalibrationType(step.input, step.voltage);
         int32_t target_value = ref_calibrations_[cal_type];
         if (CheckVoltage(current_reading, target_value))
@@ -399,7 +411,7 @@ void AppCalibration::MoveToNextCalibrationStep()
     }
 }
 
-void AppCalibration::PlayInstructionSentence(Input input, Voltage voltage)
+COLDCODE void AppCalibration::PlayInstructionSentence(Input input, Voltage voltage)
 {
     // Get the voltage sample
     SamplePlayer16bit::Sample voltage_sample = voltage_samples_[voltage];
@@ -444,4 +456,191 @@ Hardware::Calibration AppCalibration::GetCalibrationType(Input input, Voltage vo
         Hardware::Calibration::PITCH2_4V};
     const auto &calibrations = (input == Input::FREE) ? free_calibrations : step_calibrations;
     return calibrations[voltage];
-}
\ No newline at end of file
+}
+bool AppCalibration::IsStepUsed(const CalibrationStep &step)
+{
+    return step.version == Hardware::Version::COUNT || step.version == Kastle2::hw.GetVersion();
+}
+
+void AppCalibration::StartCapture(bool automated, Voltage voltage)
+{
+    for (Input input : EnumRange<Input>())
+    {
+        captures_[input] = {};
+    }
+    capture_count_ = 0;
+    next_capture_us_ = time_us_32();
+    capturing_ = true;
+    automated_capture_ = automated;
+    automated_voltage_ = voltage;
+}
+
+void AppCalibration::ProcessCapture()
+{
+    if (!capturing_ || static_cast<int32_t>(time_us_32() - next_capture_us_) < 0)
+    {
+        return;
+    }
+    next_capture_us_ += kCaptureIntervalUs;
+
+    // The fine values are averaged by the ADC already, the capture averages many of them
+    const EnumArray<Input, int32_t> readings = {
+        Kastle2::hw.GetPitchValueFine(Hardware::AnalogInput::PITCH_1),
+        Kastle2::hw.GetPitchValueFine(Hardware::AnalogInput::PITCH_2)};
+    for (Input input : EnumRange<Input>())
+    {
+        captures_[input].sum += readings[input];
+        captures_[input].sum_squares += static_cast<uint64_t>(static_cast<int64_t>(readings[input]) * readings[input]);
+    }
+    if (++capture_count_ < kCaptureSamples)
+    {
+        return;
+    }
+
+    capturing_ = false;
+    if (automated_capture_)
+    {
+        FinishAutomatedCapture();
+    }
+    else
+    {
+        ProcessCurrentCalibrationStep();
+    }
+}
+
+int32_t AppCalibration::GetCaptureFine(Input input) const
+{
+    if (capture_count_ == 0)
+    {
+        return 0;
+    }
+    const int64_t count = capture_count_;
+    return static_cast<int32_t>((captures_[input].sum + count / 2) / count);
+}
+
+int32_t AppCalibration::GetCaptureNoiseFine(Input input) const
+{
+    if (capture_count_ == 0)
+    {
+        return 0;
+    }
+    const float mean = static_cast<float>(captures_[input].sum) / capture_count_;
+    const float variance = static_cast<float>(captures_[input].sum_squares) / capture_count_ - mean * mean;
+    return variance > 0.0f ? static_cast<int32_t>(sqrtf(variance) + 0.5f) : 0;
+}
+
+void AppCalibration::ProcessSerial()
+{
+    static constexpr char kCaptureCommands[] = {'0', '1', '2', '3', '4'};
+    static_assert(std::size(kCaptureCommands) == static_cast<size_t>(Voltage::COUNT));
+    for (Voltage voltage : EnumRange<Voltage>())
+    {
+        if (Kastle2::debug.ReceivedChar(kCaptureCommands[static_cast<size_t>(voltage)]) && !capturing_)
+        {
+            StartCapture(true, voltage);
+        }
+    }
+
+    if (Kastle2::debug.ReceivedChar('l'))
+    {
+        PrintFit();
+    }
+
+    if (Kastle2::debug.ReceivedChar('w') && !capturing_)
+    {
+        // All points of this version, on the fitted lines
+        bool complete = true;
+        for (const auto &step : calibration_sequence_)
+        {
+            if (IsStepUsed(step) && !automated_points_[GetCalibrationType(step.input, step.voltage)])
+            {
+                complete = false;
+            }
+        }
+        if (complete && PrintFit())
+        {
+            Kastle2::debug.PrintLine("CAL WRITE OK");
+            SetStage(Stage::SUCCESS);
+        }
+        else
+        {
+            Kastle2::debug.PrintLine(complete ? "CAL WRITE FAIL: points off the line" : "CAL WRITE FAIL: points missing");
+        }
+        Kastle2::debug.Flush();
+    }
+}
+
+void AppCalibration::FinishAutomatedCapture()
+{
+    // Tenths of the ADC step
+    auto tenths = [](int32_t fine)
+    { return static_cast<long>((fine * 10 + (1 << (Hardware::kPitchFineBits - 1))) >> Hardware::kPitchFineBits); };
+
+    char buff[128];
+    int length = snprintf(buff, sizeof(buff), "CAL %uV:", static_cast<unsigned>(automated_voltage_));
+    for (Input input : EnumRange<Input>())
+    {
+        const Hardware::Calibration cal_type = GetCalibrationType(input, automated_voltage_);
+        const int32_t fine = GetCaptureFine(input);
+        const int32_t value = (fine + (1 << (Hardware::kPitchFineBits - 1))) >> Hardware::kPitchFineBits;
+        const int32_t target = ref_calibrations_[cal_type];
+        const char *status = value < target - kTolerance ? "LOW" : (value > target + kTolerance ? "HIGH" : "OK");
+        if (value >= target - kTolerance && value <= target + kTolerance)
+        {
+            calibrations_[cal_type] = value;
+            automated_points_[cal_type] = true;
+        }
+        if (length > 0 && static_cast<size_t>(length) < sizeof(buff))
+        {
+            length += snprintf(buff + length, sizeof(buff) - length, "%s PITCH %u %ld.%ld (noise %ld.%ld) %s",
+                               input == Input::FREE ? "" : ",", input == Input::FREE ? 1u : 2u,
+                               tenths(fine) / 10, tenths(fine) % 10,
+                               tenths(GetCaptureNoiseFine(input)) / 10, tenths(GetCaptureNoiseFine(input)) % 10, status);
+        }
+    }
+    Kastle2::debug.PrintLine(buff);
+    Kastle2::debug.Flush();
+}
+
+COLDCODE float AppCalibration::FitInput(Input input, LinearFit &fit)
+{
+    fit.Reset();
+    for (const auto &step : calibration_sequence_)
+    {
+        if (step.input == input && IsStepUsed(step))
+        {
+            fit.Add(static_cast<float>(step.voltage), static_cast<float>(calibrations_[GetCalibrationType(step.input, step.voltage)]));
+        }
+    }
+    float max_residual = 0.0f;
+    for (const auto &step : calibration_sequence_)
+    {
+        if (step.input == input && IsStepUsed(step))
+        {
+            const float value = static_cast<float>(calibrations_[GetCalibrationType(step.input, step.voltage)]);
+            max_residual = std::max(max_residual, fabsf(value - fit.Evaluate(static_cast<float>(step.voltage))));
+        }
+    }
+    return max_residual;
+}
+
+COLDCODE bool AppCalibration::PrintFit()
+{
+    bool ok = true;
+    char buff[96];
+    for (Input input : EnumRange<Input>())
+    {
+        LinearFit fit;
+        const float residual = FitInput(input, fit);
+        ok = ok && residual <= kFitTolerance;
+        // Tenths of the ADC step
+        snprintf(buff, sizeof(buff), "CAL FIT PITCH %u: %ld per volt, %ld at 0V, max residual %ld.%ld %s",
+                 input == Input::FREE ? 1u : 2u,
+                 static_cast<long>(lroundf(fit.GetSlope())), static_cast<long>(lroundf(fit.GetOffset())),
+                 static_cast<long>(residual * 10.0f) / 10, static_cast<long>(residual * 10.0f) % 10,
+                 residual <= kFitTolerance ? "OK" : "FAIL");
+        Kastle2::debug.PrintLine(buff);
+    }
+    Kastle2::debug.Flush();
+    return ok;
+}
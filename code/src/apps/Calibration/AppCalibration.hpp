@@ -32,6 +32,7 @@ SOFTWARE.
 #include "common/core/Hardware.hpp"
 #include "common/core/Kastle2.hpp"
 #include "common/dsp/control/EnvelopeFollower.hpp"
+#include "common/dsp/math/LinearFit.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 #include "Sentence.hpp"
 #include "samples_calibration.hpp"
@@ -45,8 +46,18 @@ namespace kastle2
  * @brief Special calibration app for Kastle 2. Load it and calibrate your device using step-by-step instructions.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-09-02
+ * @details Each voltage is captured as the average of kCaptureSamples fine pitch readings (the oversampled
+ *          boxcar of the ADC, see Hardware::GetPitchValueFine()), taken kCaptureIntervalUs apart.
+ *
+ * Automated mode, for a bench with a reference voltage source patched to both pitch inputs,
+ * driven over USB serial (any stage):
+ * - '0' to '4' captures both inputs at 0V to 4V, replies "CAL 2V: PITCH 1 1640.3 (noise 0.4) OK, PITCH 2 ..."
+ * - 'l' prints the least-squares line of each input through its captured points and the largest residual
+ *   ('f' is taken by the FlashWriter report of all apps)
+ * - 'w' checks that all points of this hardware version are captured and fit the lines, then saves them
+ *   (the SUCCESS stage), replies "CAL WRITE OK" or "CAL WRITE FAIL"
  */
-class AppCalibration : public virtual App
+class AppCalibration final : public App
 {
 public:
     /**
@@ -232,6 +243,61 @@ public:
      */
     Hardware::Calibration GetCalibrationType(Input input, Voltage voltage);
 
+    /**
+     * @brief Starts capturing both inputs, the result comes kCaptureSamples readings later.
+     * @param automated Captured by the automated mode (USB serial), not the current step
+     * @param voltage Voltage of the automated capture
+     */
+    void StartCapture(bool automated, Voltage voltage);
+
+    /**
+     * @brief Adds the readings of a running capture and finishes it.
+     */
+    void ProcessCapture();
+
+    /**
+     * @brief Returns the average of the last capture.
+     * @param input Captured input
+     * @return Value in the fine resolution (Hardware::kPitchFineBits)
+     */
+    int32_t GetCaptureFine(Input input) const;
+
+    /**
+     * @brief Returns the standard deviation of the last capture's readings.
+     * @param input Captured input
+     * @return Value in the fine resolution (Hardware::kPitchFineBits)
+     */
+    int32_t GetCaptureNoiseFine(Input input) const;
+
+    /**
+     * @brief Handles the automated mode commands received over USB serial.
+     */
+    void ProcessSerial();
+
+    /**
+     * @brief Stores and reports the finished automated capture.
+     */
+    void FinishAutomatedCapture();
+
+    /**
+     * @brief Fits a least-squares line through the calibration points of the input (of this hardware version).
+     * @param input Input to fit
+     * @param fit The fitted line, ADC value against volts
+     * @return Largest distance of a point from the line in ADC steps
+     */
+    float FitInput(Input input, LinearFit &fit);
+
+    /**
+     * @brief Prints the fitted lines over USB serial.
+     * @return true if all points of both inputs are within kFitTolerance
+     */
+    bool PrintFit();
+
+    /**
+     * @brief Checks whether the calibration step applies to the current hardware version.
+     */
+    static bool IsStepUsed(const CalibrationStep &step);
+
     /**
      * @brief Get the app ID (always returns default ID for calibration)
      * @return Default app ID
@@ -242,8 +308,11 @@ public:
     }
 
 private:
-    static constexpr int32_t kTolerance = ADC_1V / 10; ///< 100mV tolerance for voltage calibration
-    static constexpr q15_t kVolume = q15(0.25f);       ///< Audio output volume (25% to prevent ear damage)
+    static constexpr int32_t kTolerance = ADC_1V / 10;    ///< 100mV tolerance for voltage calibration
+    static constexpr q15_t kVolume = q15(0.25f);          ///< Audio output volume (25% to prevent ear damage)
+    static constexpr uint32_t kCaptureSamples = 256;      ///< Readings averaged per capture
+    static constexpr uint32_t kCaptureIntervalUs = 1000;  ///< Time between the readings, a few pitch boxcar updates
+    static constexpr float kFitTolerance = ADC_1V / 20.0f; ///< 50mV, points further from the fitted line are rejected
 
     bool inited_ = false;                        ///< Flag indicating if app is initialized
     bool next_time_write_calibrations_ = false;  ///< Flag to write calibrations on next UI loop
@@ -290,6 +359,7 @@ private:
     Hardware::CalibrationsType calibrations_;     ///< Measured calibration values to be saved
 
     SamplePlayer16bit sample_player_; ///< Audio player for calibration instructions
+    AdpcmDecoder prompt_decoder_;     ///< Decoded blocks of the (IMA-ADPCM) instructions
     EnvelopeFollower env_follower_;   ///< Envelope follower of the sample player for LED brightness control
 
     Stage current_stage_;             ///< Current calibration stage
@@ -297,13 +367,22 @@ private:
     bool voltages_ok_ = false;        ///< Flag indicating if last voltage test passed
 
     /**
-     * @brief Running averages of ADC readings for each input
-     *
-     * Maintains 20-sample running averages to smooth out ADC noise.
+     * @brief Sums of the fine pitch readings of a capture, for the average and the noise
      */
-    EnumArray<Input, RunningAverage<int32_t>> adc_readings_ = {
-        RunningAverage<int32_t>(20),  ///< FREE input running average
-        RunningAverage<int32_t>(20)}; ///< NOTE input running average
+    struct Capture
+    {
+        int64_t sum = 0;
+        uint64_t sum_squares = 0;
+    };
+    EnumArray<Input, Capture> captures_;
+    uint32_t capture_count_ = 0;              ///< Readings of the running or last capture
+    uint32_t next_capture_us_ = 0;            ///< Time of the next reading
+    bool capturing_ = false;                  ///< A capture is running
+    bool automated_capture_ = false;          ///< The running capture is for the automated mode
+    Voltage automated_voltage_ = Voltage::V0; ///< Voltage of the automated capture
+
+    ///> Calibration points captured by the automated mode
+    EnumArray<Hardware::Calibration, bool> automated_points_ = {};
 
     Sentence *current_sentence_;            ///< Pointer to currently playing sentence
     Sentence voltage_instruction_sentence_; ///< Dynamically generated voltage instruction sentence
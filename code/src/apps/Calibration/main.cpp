@@ -41,11 +41,6 @@ using namespace kastle2;
 #define APP_VERSION "1.5"
 AppCalibration app;
 
-static void process_audio(q15_t *input, q15_t *output, size_t size)
-{
-    app.AudioLoop(input, output, size);
-}
-
 int main()
 {
     // Create the version chain (for announcement in Test Mode)
@@ -61,8 +56,8 @@ int main()
     // Initialize the app
     app.Init();
 
-    // Start I2S
-    Kastle2::StartAudio(process_audio);
+    // Start I2S, the audio interrupt calls the app directly
+    Kastle2::StartAudio<app>();
 
     // Infinite program loop
     while (true)
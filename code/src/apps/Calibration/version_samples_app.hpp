@@ -13,13 +13,14 @@
 
 /*
  * Samples made using TTS Maker (voice 178 - Chloe) and sped up by 1.05x
- * Sample rate is 11025 Hz.
+ * Sample rate is 11025 Hz, stored as IMA-ADPCM (encoded at compile time).
  */
 
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
+#include "common/dsp/sampling/AdpcmEncoder.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 
 namespace kastle2
@@ -29,11 +30,13 @@ namespace version
 {
 
 static constexpr size_t calibration_length = 11501;
-const int16_t calibration_data[calibration_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -4, -4, -5, -5, -6, -7, -6, -6, -7, -7, -6, -7, -7, -7, -7, -8, -9, -9, -8, -9, -9, -9, -10, -10, -10, -9, -11, -11, -11, -10, -11, -12, -11, -10, -11, -11, -8, -7, -8, -6, -6, -4, -4, -1, 0, -2, 1, 4, 5, 2, 5, 6, 6, 5, 9, 13, 7, 5, 7, 16, 20, 18, 27, 29, 22, 29, 40, 50, 43, 40, 43, 51, 49, 49, 53, 50, 61, 59, 71, 71, 63, 73, 76, 86, 74, 71, 74, 71, 81, 73, 63, 57, 59, 66, 54, 73, 60, 53, 54, 51, 83, 77, 80, 66, 66, 73, 63, 64, 73, 70, 69, 63, 83, 70, 63, 66, 77, 54, 34, 54, 43, 64, 26, 33, 23, 4, 21, 13, -1, 11, -27, 21, -40, -3, -9, 31, 51, -24, 9, -29, 31, 26, -27, 9, 20, -16, -57, -1, 67, 21, 13, -3, -33, 16, -19, 81, 44, 36, -14, -20, 31, 70, -71, -60, -93, 73, -49, -76, -107, 21, 103, 89, 160, -60, -87, -140, 16, 67, 114, 131, 69, 77, -74, 184, 64, 94, -64, -1, 116, 27, 3, 37, 73, 154, -26, 13, -20, 49, -13, -159, 16, 96, 87, -79, -91, 84, 94, 11, -6, -103, 59, 113, 171, 208, 17, 157, -107, 156, 39, -69, -74, -146, 131, -9, 30, 208, 133, 310, -33, -20, -14, -47, 281, -19, 257, -34, 70, 370, 774, 1478, 553, -431, -206, 617, 621, -147, -87, -208, 216, 37, 628, 356, -111, -206, 635, 217, 563, 670, 1168, 1078, 318, 17, 371, 1138, 127, -597, -1451, -126, 287, 124, -778, 90, 363, 815, 463, -9, 895, 605, 1758, 1194, 965, 301, 1428, 2448, 1214, 486, -643, 133, 47, -313, -1218, -765, -79, 81, -663, -388, -444, 171, 436, 179, -19, -183, 374, 346, 54, -19, -76, 87, 190, 129, -39, 1601, 664, 1042, -1164, 127, -53, -283, -544, -1771, -141, -1151, 554, -972, -111, -967, -204, 720, 254, 506, -80, 861, 808, -161, -877, 661, 113, -306, -1834, -113, -190, -984, -540, -587, 617, -1331, -56, -788, 1154, -526, -147, -545, 321, -224, -473, -424, -267, -654, -1011, -331, -1304, -1140, -977, -610, -1789, -1945, -400, -126, 467, 760, -338, -1369, -1221, 420, -1090, -1528, -1968, -613, -234, -343, -477, 393, 725, 397, 190, 233, -754, -1541, -248, 30, -493, -2001, -818, -200, -1058, -1889, -2295, -1371, -2438, -403, -437, 888, -133, 1581, 823, 1858, 1164, 303, -460, -603, -635, -974, -948, -684, -1074, -1100, -1254, -1265, -1085, -558, -1017, -301, 66, 478, 781, 264, 825, 794, 1080, -240, -740, -129, -817, -1419, -998, -1097, -537, -1906, -426, -1260, -241, -641, -734, -17, -980, 337, -133, -167, -187, -149, 304, -408, -40, -633, -753, -316, -877, -201, -1484, -273, -523, -727, -401, -1315, -94, -497, -1092, -151, -758, -154, -683, 1005, -204, -765, 167, -483, 400, -1392, -256, -34, -506, 444, -661, 434, -310, -268, 1010, 367, -131, 207, 313, 388, -985, 818, 191, 149, 565, 433, 890, 543, 1172, 620, 300, 871, -527, 1197, -874, 407, 170, -456, 514, -1751, 164, -240, 356, 331, 161, 1220, 1478, 1279, 1896, 607, 1265, 59, 1612, -373, -237, 30, -30, 346, -1345, -393, -407, -795, -421, -1454, -521, -984, -681, -488, -1615, 583, -60, -276, -658, -87, 57, -1010, -693, -1309, -1087, -1649, -1007, -46, -1557, -446, -1121, -907, -763, -2043, -268, -817, -1461, -920, -651, -1445, -1628, -941, -655, -1100, -1816, -947, -336, -643, -885, -1052, -701, -1745, -664, -1134, -1492, -998, -1017, -344, -1442, 657, -910, -631, 91, -724, 36, -1005, 84, 89, 160, 273, 850, -410, 854, 1565, 341, -744, -1211, 625, 493, -341, -80, 857, 1147, 1324, 2399, 1705, 1298, 1854, 2136, 958, 720, 1444, 241, 1645, 190, 2499, 2072, 370, 594, 2272, 2426, 735, 1795, 743, 1217, 1889, 443, 1467, 644, 1207, 2332, 179, 407, 1398, 1398, 1991, 694, 1759, 1561, 947, 1962, 1002, 217, 1252, 2169, 1254, -257, 633, 2540, 2163, 1634, 883, 114, 1886, 2092, 1302, 508, 565, 1879, 2223, 417, 3, 1045, 1605, 894, 807, 723, 1128, 1684, 1461, 2123, -163, 915, 1468, 868, 1962, -1061, -628, 693, 1064, 1969, -191, 820, 3363, 1117, 540, 527, 804, 1449, 1025, -597, 47, -820, 1728, 2842, -691, 353, 1185, 2648, 247, -293, 2606, 1557, 134, 1441, 343, -1465, -1164, 2162, 1267, -1901, -982, 3013, 1641, -942, -830, 928, 503, 1434, -1124, -446, 506, 1349, 1854, -2296, 568, 1414, -258, 134, -697, 1134, 551, 793, 905, -71, -490, 1052, 1299, -1575, -2121, 13, 3079, -417, -1237, -376, 1007, 2233, 543, -753, -177, -595, 46, 126, -1182, -327, -893, 614, 787, -978, -274, 931, 510, 683, 1105, 91, -964, -71, 40, -594, -1357, -1824, -615, -293, 1538, 1482, -890, -266, 29, 1302, -400, -1001, -1993, -655, 878, -188, -250, 574, 2478, -361, -1849, -1220, -595, -341, -1238, -1041, -1240, -1027, 952, -167, -1377, -514, 1344, 401, -1074, -1374, -113, 63, -2208, -410, 351, -364, -1511, -109, 740, 615, -1472, -517, 1214, 137, -376, -1479, -2045, 374, 307, -440, 64, -1975, 1639, -1339, -571, -947, -2253, 1674, 1121, 1088, -1305, -1309, 1755, -174, -3786, -1774, -117, -19, -1294, -461, 1117, 1504, 2480, 119, 888, 1656, -994, -440, -1535, -494, -1010, -2822, 233, -260, 808, -4, 674, 4308, -1671, -2535, 2289, 795, 1372, -2910, -2339, -858, -1871, 2766, 236, -1646, -2006, 247, -107, -2072, 1375, 3202, -2171, -2732, -2913, -87, -156, -1192, -860, -1552, 1254, -311, -390, -240, 267, 570, -1107, -26, 1521, -126, -1681, 90, 3133, 84, -3948, -2069, -49, 2446, 4708, -2158, -1462, 1651, 1956, 2433, -2746, -3763, 974, -780, -1724, 3551, 1105, -801, 220, 1849, 361, -2031, -1719, 143, 3096, -565, -1862, -1040, 464, 2995, 1361, -2566, -1672, 1115, 2575, 374, -1644, 1805, 703, -348, -1542, -1297, -228, 17, 1894, 2793, -2206, -21, 2772, 3711, 2098, -3521, -1455, -997, 1245, 2086, -3440, -3507, 256, 2935, 1965, -1187, -34, 3729, 104, -406, 1288, 4, -3432, -4530, 655, 2119, -87, -3314, 94, 1415, 3249, 2652, 1708, -1015, -2705, 270, 1712, 1157, -2439, -2008, 618, 1397, 875, -1634, 7, 1312, -119, -254, -925, 711, 87, -1531, 1117, 2873, 717, -2315, -6516, -1634, -19, 1996, 2796, -670, -2688, -2173, 4136, 4200, -1227, -3986, -1407, -575, 2231, 1564, -1277, -2973, -1461, 1155, 1359, 423, -3050, -710, 1929, 847, -711, -1462, -130, 1442, -2325, -431, 5695, 493, -1428, -473, 1315, -618, -3494, -1829, 1352, 2909, -117, -948, 1305, -2910, -2305, 1399, -1477, -1665, -1559, -2787, 434, 1260, 444, 727, 244, -13, -548, -2389, -3063, -735, 1397, 2079, -2693, -3504, -938, 1485, 1996, -3246, -857, 3039, 3443, 1160, -2639, -703, 2756, 433, -2636, -4143, -1278, -508, -308, 1632, 555, 3737, 3242, -338, -1669, -4584, -2308, 133, -584, 218, -140, -1599, -403, -1599, 281, -760, -2293, -114, -694, 1427, 1532, -1015, -1431, 861, 2799, 1588, -4912, -2399, 2193, 6132, 2946, -2372, 2078, 5668, 1968, 1674, 2688, 111, 104, 1115, 4113, 3033, -121, -1324, 805, 3747, 2949, 1062, -1302, -3640, -1505, 793, 3406, 1197, -7788, -8424, -2201, 1675, -13, -3813, -4384, -4667, -2452, 250, 2032, 2298, -7243, -8158, -1117, 2618, 1531, -1080, -364, 2739, 3557, 4574, 5315, 4601, 3150, 1672, 3650, 4364, 2258, 1224, 4074, 4548, 4624, 6399, 4912, 4514, 1355, 625, 3169, 3546, -147, -5886, -4220, -79, 1432, 56, -4481, -9789, -13005, -9836, -5916, -9343, -7731, -4521, -5705, -6516, -4185, 3314, 5429, 3514, -680, -1297, -336, -884, 3436, 3974, 2039, 3697, 5803, 8361, 9816, 8507, 6209, 6632, 6380, 6060, 7219, 6188, 3370, -227, 570, 4410, 2568, 2546, 1578, 417, -834, -5208, -6430, -6483, -8936, -10606, -10423, -13078, -15919, -12616, -5272, 4101, 4821, 1007, 2056, -1387, -3798, -4400, -2660, 1467, 1421, 2329, 2313, 6192, 11064, 8522, 4810, 3908, 6285, 8395, 5979, 5462, 6496, 5496, 5988, 5762, 4681, 1656, 1167, 1418, 795, 1225, -1087, -1461, -2812, -4851, -7369, -10734, -12008, -12575, -19084, -19142, -4692, 6512, 1799, -4568, -2228, -24, 386, -2375, -1534, -2530, -3107, 3050, 6239, 5081, 3086, 6000, 6216, 5007, 6989, 7050, 7747, 6320, 6870, 9114, 4680, 2629, 4624, 3586, 2329, 177, -630, -343, 560, -110, -1708, -2078, -7811, -11333, -16983, -23624, -19464, -8757, -1447, 5895, 8265, 427, -3754, -2493, -2072, -4098, -2875, -708, -992, 2362, 4837, 8762, 8018, 948, 2598, 6632, 6663, 8284, 6653, 7775, 7478, 5869, 6166, 4078, -1394, -2926, 378, 2466, 2936, -758, -1318, 120, -3197, -6492, -14117, -15634, -17153, -23018, -12589, 5792, 11932, 8942, -97, -5656, -6876, -4548, -2626, -1938, -2348, -1432, 6180, 10869, 9555, 4418, 1262, 4263, 4104, 3494, 5569, 7067, 7818, 7844, 5585, 3993, 584, -2013, -3193, 703, 2025, -577, -854, -3793, -2723, -2927, -10354, -16082, -23491, -25003, -7450, 12001, 14810, 7754, 213, -4270, -6759, -7074, -4657, -287, -1918, 2525, 9468, 9893, 9662, 6704, 4235, -1134, 69, 5024, 5565, 6627, 9181, 10432, 6225, 2598, -980, -3544, -2101, 907, 2759, 2518, 2322, -613, -6607, -10215, -12765, -18576, -25821, -19382, 7296, 19869, 11945, 1120, -4575, -4995, -6946, -5478, -2770, -1452, -2092, 3039, 10409, 13295, 8964, -390, -703, 1092, 3867, 9112, 9743, 6290, 5742, 3330, -1766, 1878, 1211, -3540, 1387, 7680, 7981, 2822, -2456, -8707, -16328, -20035, -24072, -26414, -9499, 15197, 22578, 12321, -638, -5663, -6126, -8558, -6593, -5554, -6570, -911, 10302, 20025, 17872, 8909, -3019, -9335, -3179, 5818, 13569, 13348, 6350, 5051, 5249, -531, -4894, -3980, -1711, 828, 5254, 10077, 5936, -6850, -14820, -17616, -19157, -21950, -20700, -1389, 18441, 17102, 8162, 1732, -4060, -8944, -8382, -6556, -2836, -407, 1949, 7406, 12761, 14768, 10157, -1409, -8939, -1507, 7791, 9525, 7466, 7032, 6560, 568, -2776, -1632, 1181, 1718, 555, 2533, 2593, 436, -6409, -15075, -18578, -28349, -26368, 1082, 17852, 18705, 12148, 3030, -1781, -9668, -9662, -7793, -10407, -7006, -327, 10216, 19682, 19060, 12109, -2133, -10043, -2618, 8101, 10259, 8238, 6195, 2445, 908, 1764, 2509, 3436, 3481, -831, -4867, -4611, -4650, -9745, -18731, -26361, -20262, 5538, 18434, 12554, 9635, 2121, -7610, -13825, -11453, -5522, -7511, -6236, 4357, 11955, 17589, 17719, 7488, -638, -4687, -1751, 5662, 7953, 7159, 6306, 5112, 5525, 5972, 5923, 593, -4494, -3383, -4610, -6590, -8402, -13766, -24173, -22641, 754, 15254, 16024, 9366, -1282, -7967, -12327, -7430, -4575, -10075, -10819, 527, 14300, 17352, 15010, 10192, 1656, -4387, -4097, 6852, 10550, 6475, 9479, 6278, 3416, 4705, 1051, -685, -388, -621, -4210, -10155, -12911, -17138, -25666, -14890, 11378, 18864, 16719, 6209, -6427, -9249, -11590, -8467, -6982, -9726, -5585, 3087, 12559, 18033, 16355, 7104, -4243, -7878, -1675, 7891, 10182, 7915, 6238, 4164, 1958, 1147, 3726, 3754, -4959, -9869, -7093, -8370, -15213, -22345, -17693, 3630, 16803, 18250, 11287, 181, -4554, -12491, -13121, -6380, -5564, -6462, -1508, 10844, 19448, 16825, 8195, 34, -8107, -8162, 3157, 13036, 13979, 6135, -2259, -3167, 1461, 2959, 3551, 1255, -5866, -10136, -11467, -11655, -17736, -19477, -3494, 15181, 17550, 10285, 6098, -257, -8804, -9116, -7611, -7883, -5058, -2568, 1529, 11383, 20131, 16184, 911, -7681, -1805, 5041, 4694, 5151, 7584, 4644, -447, -67, 3254, -595, -6490, -7814, -8519, -8795, -13181, -22602, -14440, 7023, 16298, 14823, 11343, 5228, -8364, -13683, -2016, -690, -7690, -7051, -3067, 2103, 9732, 19492, 16492, 3473, -3383, -1467, 2426, 3106, 6563, 6439, 2793, 2590, 1208, 1034, -1215, -7210, -11907, -15604, -14668, -17240, -16683, 3963, 19478, 14146, 8871, 7443, -1724, -10837, -9842, -7337, -5609, -5711, -2096, 4285, 10412, 17557, 13475, 5941, 630, -4972, -2729, 2959, 8939, 10172, 2193, -474, 5706, 4641, -3433, -5779, -12591, -20916, -18940, -17633, -9089, 8211, 14886, 12702, 8628, 5292, 988, -6208, -9089, -9243, -10419, -6099, 11, 5886, 11861, 13752, 10449, 4651, 104, -1852, 724, 961, 4393, 9041, 2428, 1846, 5596, 2673, -914, -6794, -14450, -18166, -18303, -18824, -10259, 7009, 14369, 12712, 6583, 5406, 6969, -2106, -5177, -9141, -14917, -9993, -3669, 7581, 15998, 16892, 11070, 711, -2639, -2071, 341, 3893, 6356, 4929, 2857, 4540, 4661, 4136, -107, -11237, -18237, -16905, -17619, -16752, -3342, 7286, 10730, 8969, 4682, 7501, 4747, 104, -2253, -8856, -11800, -11980, -4939, 5207, 11243, 15091, 12298, 8628, 3560, -2780, 1766, 4848, 1626, 1434, 3189, 2716, -206, 991, 1671, -8282, -16628, -20076, -22615, -11537, 2450, 8829, 12412, 9005, 7110, 4264, 2767, 1274, -7127, -11741, -14449, -10771, 981, 9114, 16719, 14716, 8420, 7517, 755, 134, 4463, 2385, 370, -1919, 3293, 6847, 3373, 2099, -3233, -11994, -21147, -26911, -17376, -1989, 8225, 11623, 9192, 7664, 5742, 4510, 2897, -2465, -7853, -15318, -15271, -4551, 4697, 11273, 15412, 12584, 8115, 2380, 2865, 7768, 3684, 870, -129, -905, 1996, 1377, 1467, -2793, -11291, -18521, -25997, -19455, -3741, 6949, 13992, 12866, 9435, 4645, 2319, 4010, -3083, -9598, -12441, -13122, -6555, 1105, 9950, 15838, 13924, 9652, 3740, 3679, 5434, 3461, 3053, 361, -250, 907, -1138, -707, -4090, -10699, -18473, -24897, -18134, -4842, 6563, 14159, 11792, 8982, 5529, 4185, 5042, 741, -4787, -12254, -15625, -9356, -2198, 8162, 14386, 13779, 12201, 6235, 4116, 4137, 2456, 4947, 1015, -661, -1929, -2603, -1571, -7653, -10156, -15999, -23736, -15794, -6125, 5633, 14033, 13896, 11787, 6046, 5821, 4837, -1448, -4093, -13240, -15702, -10149, -2118, 8635, 12498, 13964, 11363, 4390, 4901, 3283, 3477, 4164, 1394, 1048, -2429, -4094, -3314, -7807, -12377, -19262, -19772, -12715, -4373, 7176, 13352, 12357, 10477, 7491, 6686, 3656, -491, -6113, -10849, -11154, -8568, -897, 7534, 10831, 10853, 9426, 7470, 6048, 5346, 5169, 5151, 2460, -981, -3689, -6990, -9355, -11683, -16910, -19311, -16022, -8892, 1182, 9142, 12285, 12388, 11304, 7844, 4361, 1924, -2642, -8073, -9272, -8124, -4964, 1265, 7167, 10911, 11300, 10532, 9937, 6206, 5099, 4760, 3170, 1645, -2148, -5069, -8822, -13448, -16461, -21090, -17782, -10237, -2730, 7147, 11514, 11167, 10013, 8137, 6229, 1085, 69, -3416, -8981, -8014, -6363, -2029, 2835, 7094, 11880, 10839, 10891, 9052, 6689, 6796, 4790, 3154, 83, -5008, -8578, -14273, -17976, -20969, -18733, -11146, -3354, 5969, 10642, 12047, 11283, 8111, 6729, 3267, 458, -2972, -6060, -7847, -8514, -4735, 136, 4808, 10075, 11894, 12584, 9606, 7661, 6847, 3973, 3794, 196, -4323, -8555, -14070, -17812, -21984, -19112, -11518, -4185, 4678, 9957, 12259, 11487, 9126, 9021, 5019, 1676, -1188, -5119, -7153, -9018, -5698, -1874, 2747, 8358, 10137, 11638, 11671, 9615, 8027, 5662, 3419, -574, -5768, -10122, -15597, -19657, -21541, -18920, -11841, -2733, 6573, 11234, 13939, 12569, 9099, 5224, 2849, 1191, -2239, -4003, -5461, -6640, -4680, -1155, 3777, 7424, 8995, 10169, 9272, 7634, 6759, 5899, 3803, -1462, -6260, -13052, -18260, -20759, -20535, -15640, -8428, 991, 8702, 12319, 13783, 11633, 7845, 3422, 560, -637, -2295, -2715, -3264, -3497, -1778, 208, 4090, 6123, 7784, 9069, 7987, 7076, 5088, 2923, -54, -4450, -8225, -14476, -18226, -17779, -16332, -10833, -3777, 3299, 8388, 9950, 10432, 8111, 5882, 4070, 1394, 821, 198, -815, -1282, -1487, -66, 2083, 4525, 6910, 7998, 7390, 5578, 3433, 1072, -2241, -6116, -9096, -12833, -15013, -14244, -12035, -8414, -3200, 1856, 4620, 6672, 7329, 6155, 5745, 4919, 3963, 3279, 1220, 765, 853, -133, 883, 2589, 4437, 5751, 7146, 7066, 4884, 1936, -1626, -5157, -8554, -10282, -11898, -11867, -10153, -8227, -4618, -1702, 1070, 3497, 5105, 5943, 5496, 5571, 5085, 4504, 3584, 1545, 865, -77, 263, 2015, 2755, 5272, 5835, 5596, 4894, 1379, -1284, -5171, -8155, -9635, -11113, -9939, -9301, -7164, -4357, -1941, 1981, 3787, 4841, 5522, 4791, 5107, 4771, 4073, 3750, 1894, 1669, 1669, 1261, 2496, 3807, 4999, 4852, 4245, 2658, -581, -3142, -5638, -8241, -9433, -11148, -10877, -9079, -6774, -3043, 81, 3162, 4557, 5065, 5861, 5028, 4724, 5244, 4241, 2786, 2082, 1362, 884, 1587, 2907, 4464, 5359, 5312, 4253, 1260, -2032, -5141, -8167, -9381, -10632, -10407, -8814, -7036, -4124, -1421, 958, 2895, 4470, 5002, 5111, 5119, 5211, 5139, 4327, 3721, 2735, 1819, 1534, 1915, 2558, 3330, 4021, 3273, 1639, -673, -4404, -6910, -8898, -10760, -10473, -9168, -7381, -4915, -2148, 56, 1449, 3786, 4277, 4744, 5908, 5912, 5366, 5139, 4080, 2548, 2458, 2772, 2786, 3563, 3973, 4004, 3077, 1475, -1557, -4992, -6809, -9231, -10287, -9866, -9375, -7568, -5255, -2242, 27, 2402, 4198, 4550, 4610, 4571, 4507, 4175, 3907, 3771, 2953, 2995, 2796, 2735, 3309, 3824, 4640, 3843, 2311, -307, -3741, -6567, -9014, -10282, -10983, -10093, -7646, -5117, -2041, 320, 2850, 4217, 4758, 5045, 4297, 4218, 3893, 3554, 2693, 2045, 2640, 2662, 3109, 3664, 4557, 5049, 3984, 2296, -670, -3737, -7160, -9086, -10085, -11054, -10126, -7943, -5688, -2689, 284, 3536, 4621, 5414, 5679, 4664, 4360, 4591, 3984, 2916, 3025, 2693, 2419, 2882, 3194, 3790, 4071, 3102, 1232, -1874, -5188, -8043, -9045, -10810, -11316, -9269, -7833, -4083, -1409, 2082, 4767, 5768, 6773, 6403, 6135, 5603, 4168, 3631, 2822, 2208, 2538, 2323, 3119, 3430, 3900, 3240, 1925, -411, -3444, -7194, -9098, -11347, -12915, -11161, -9815, -6605, -1892, 457, 4034, 6250, 6610, 7339, 6717, 6535, 4985, 3327, 2789, 1582, 1925, 2603, 3567, 4505, 5028, 5221, 4121, 1074, -2263, -5356, -8915, -11822, -13836, -13613, -11677, -9372, -3826, -133, 3294, 6352, 7900, 7568, 6583, 6810, 5865, 4047, 3513, 2133, 1421, 2023, 2842, 4792, 4792, 5602, 5009, 2001, -698, -4574, -7965, -10146, -13582, -14891, -11998, -10747, -6032, 891, 3609, 6112, 8150, 7438, 6445, 4764, 5384, 3514, 1644, 3016, 1097, 1958, 4682, 5286, 6308, 6727, 5606, 3606, -344, -4278, -8217, -11430, -14209, -17786, -15380, -11418, -8103, -880, 4624, 6793, 8225, 9096, 7901, 6406, 5985, 4271, 1339, 1661, 1115, 1132, 4130, 5531, 7387, 6914, 6540, 5561, 1524, -1475, -5788, -10363, -12872, -17797, -19678, -14074, -10707, -4133, 3060, 5921, 8195, 8664, 9321, 9099, 6747, 6482, 2470, -820, 803, -350, 2119, 6019, 6459, 7227, 5836, 4772, 3313, 131, -2705, -7381, -12191, -15518, -20755, -18430, -11747, -7541, -551, 4931, 6055, 7247, 9445, 9890, 9678, 8717, 6110, 851, -580, -103, 567, 4170, 6100, 6390, 5004, 3664, 3156, 1542, -595, -4264, -9295, -13270, -17437, -20593, -13896, -9283, -4280, 2338, 4271, 6476, 7883, 9650, 11567, 9306, 7756, 3527, -1122, 137, 50, 2622, 5980, 5124, 6350, 4340, 3770, 4675, 1030, -2036, -6596, -12798, -15550, -20143, -19161, -11050, -8105, -1090, 3998, 5669, 9045, 10486, 11924, 11872, 8091, 5211, -557, -2229, -1088, 24, 3500, 4901, 5656, 5878, 5039, 6749, 5157, 1385, -3056, -9423, -14733, -18004, -21793, -15765, -11167, -7236, 440, 3250, 7356, 10913, 12298, 13782, 10434, 7090, 3393, -1565, -316, 90, 1555, 3851, 3380, 5385, 4949, 4682, 6786, 3204, -654, -5359, -11574, -14333, -17883, -19120, -10909, -9556, -3724, 2116, 3259, 8137, 10040, 10676, 11795, 7117, 5365, 1304, -1351, 627, 1341, 2980, 4221, 3887, 5139, 3928, 5158, 5179, 1369, -2388, -7616, -12198, -14004, -18753, -14510, -8814, -7476, -938, 1322, 4435, 8295, 8962, 10814, 9535, 6086, 4585, 76, 698, 2091, 2822, 4033, 4114, 4851, 4650, 3966, 5585, 2615, -1369, -6149, -11385, -14610, -17657, -20288, -12452, -9512, -5081, 1514, 3800, 8381, 11087, 11067, 12815, 8647, 5586, 2725, -961, 545, 1854, 2066, 4020, 4171, 5314, 5912, 6099, 6347, 1592, -3650, -8659, -14117, -16422, -20997, -19661, -12042, -10650, -3651, 1979, 5655, 10817, 12101, 13283, 13448, 8125, 6535, 1962, 114, 1412, 1602, 2362, 3264, 3460, 4899, 5089, 6283, 3868, -795, -5701, -11224, -14928, -17961, -21910, -14923, -11233, -8360, -744, 2322, 7049, 10590, 11660, 14351, 11231, 8028, 6222, 1504, 2589, 3493, 2852, 3530, 2533, 2709, 3426, 3427, 4228, -100, -3933, -8392, -12952, -14738, -18763, -17692, -10320, -9963, -4068, 400, 3063, 7894, 10027, 12222, 12979, 8818, 7780, 4007, 2266, 3613, 3609, 3380, 3230, 2613, 3299, 4071, 5105, 3082, -917, -5576, -10566, -13679, -16699, -19776, -14157, -10422, -8587, -2350, 400, 4931, 9122, 11191, 13208, 11351, 7978, 6182, 2056, 2363, 3042, 2082, 2483, 1832, 2122, 3818, 4321, 5037, 1357, -2325, -7131, -11671, -13802, -18004, -16926, -9950, -9898, -4722, -688, 1542, 7017, 9608, 12235, 12842, 9396, 7914, 4003, 2059, 3303, 2388, 2163, 2059, 1524, 2386, 3233, 4418, 2346, -1022, -5009, -9562, -12258, -16098, -17857, -12484, -9712, -8043, -2889, -554, 3370, 7714, 10710, 12382, 11445, 9092, 6650, 3673, 3739, 4234, 2730, 2880, 2091, 1387, 2251, 2849, 2866, -179, -3723, -7563, -11370, -14374, -16979, -14377, -9152, -8734, -4855, -1462, -351, 4674, 8150, 10483, 11668, 10086, 8638, 6069, 4498, 5252, 4221, 3621, 3477, 2093, 2043, 2228, 2468, 691, -2253, -5648, -8687, -12132, -15635, -14963, -11170, -9393, -7498, -4071, -1895, 613, 4932, 8341, 10067, 10627, 9576, 7734, 6590, 5594, 5773, 4674, 4031, 3306, 2085, 1835, 1809, 1235, -169, -3152, -5970, -9038, -13159, -14069, -11842, -9485, -7828, -5341, -2813, -1626, 1167, 4537, 7111, 9029, 9108, 8544, 7501, 6195, 5681, 5212, 4548, 3987, 2763, 1966, 1051, 1027, 464, -981, -3399, -5432, -8252, -10909, -10145, -8905, -7527, -5782, -4530, -2719, -1722, 36, 2796, 4645, 6159, 6804, 6447, 6467, 5581, 5475, 5452, 4375, 4148, 3269, 2353, 2081, 1491, 1167, -310, -2201, -3570, -6179, -7256, -7583, -7524, -6209, -5671, -4234, -3000, -2640, -1138, 318, 1801, 3222, 3974, 4692, 4801, 4614, 4505, 4227, 4023, 4150, 3824, 3591, 3639, 3209, 2849, 2249, 1044, -211, -1974, -3130, -4200, -4398, -4371, -4375, -3791, -3661, -3569, -2823, -2653, -1719, -635, -247, 471, 992, 1517, 2252, 2301, 3306, 3830, 3824, 4672, 4618, 4367, 4398, 3466, 2486, 1381, 570, -7, -871, -1214, -1412, -1124, -1338, -2081, -2001, -2342, -2913, -3100, -3630, -3673, -3649, -3184, -2091, -1297, -501, 770, 1101, 1942, 3197, 3584, 4184, 4347, 3646, 3306, 2805, 2148, 1944, 1652, 1592, 1802, 1405, 824, -127, -548, -1054, -1721, -2313, -2832, -3207, -4016, -4308, -3951, -3641, -3093, -2339, -1768, -775, -144, 154, 1571, 2009, 2103, 2857, 2526, 2435, 2570, 2402, 2699, 2659, 2696, 2565, 1938, 1559, 1204, 223, -493, -875, -1492, -2106, -2883, -3199, -3559, -3804, -3610, -3150, -2572, -2536, -1742, -995, -1167, -668, -110, 21, 548, 1001, 1528, 2068, 2282, 2923, 3035, 2890, 2775, 2412, 1992, 1694, 1288, 853, 458, -33, -110, -593, -1200, -1364, -1878, -2482, -3020, -3080, -3240, -3349, -3020, -2952, -2773, -2228, -1659, -651, 134, 1054, 2013, 2269, 2592, 2610, 2465, 2592, 2409, 2281, 2311, 1828, 1778, 1741, 1369, 1449, 1045, 410, -173, -878, -1459, -2122, -2630, -2929, -3376, -3553, -3459, -3030, -2522, -2019, -1195, -643, 101, 741, 1257, 1618, 1839, 1945, 1956, 1946, 1789, 2089, 2203, 2249, 2362, 2128, 1964, 1716, 1204, 801, 223, -561, -907, -1511, -1931, -2179, -2365, -2468, -2433, -2262, -1895, -1497, -1038, -500, -93, 181, 391, 587, 887, 1112, 1321, 1615, 1778, 1954, 2191, 2279, 2205, 2026, 1812, 1285, 884, 378, -66, -527, -781, -964, -1248, -1544, -1786, -1786, -1845, -1642, -1454, -1157, -868, -894, -775, -617, -547, -186, 196, 543, 1175, 1645, 1939, 2131, 2088, 2032, 1954, 1625, 1379, 1120, 694, 451, 130, -161, -347, -564, -788, -895, -1194, -1348, -1371, -1431, -1399, -1332, -1275, -1154, -870, -731, -410, -49, 214, 621, 825, 987, 1181, 1130, 1090, 1125, 1042, 1068, 1170, 1298, 1367, 1264, 1070, 795, 493, 161, -167, -457, -837, -1234, -1501, -1758, -1755, -1632, -1484, -1148, -868, -644, -503, -374, -161, 3, 87, 181, 428, 601, 917, 1288, 1585, 1958, 2195, 2265, 2203, 1926, 1547, 1107, 494, -120, -617, -1021, -1377, -1635, -1769, -1846, -1716, -1582, -1429, -1175, -994, -868, -695, -635, -470, -263, 16, 371, 730, 1194, 1594, 1971, 2205, 2348, 2360, 2156, 1872, 1465, 984, 451, -83, -541, -942, -1242, -1365, -1449, -1408, -1317, -1268, -1255, -1275, -1308, -1245, -1122, -917, -655, -406, -1, 310, 688, 1101, 1465, 1795, 1966, 2008, 1971, 1836, 1502, 1197, 870, 436, 86, -216, -517, -743, -897, -1035, -1144, -1210, -1294, -1459, -1567, -1568, -1517, -1375, -1081, -750, -397, -36, 290, 684, 1028, 1230, 1394, 1407, 1277, 1125, 940, 737, 598, 460, 353, 208, 43, -73, -251, -428, -591, -823, -1088, -1291, -1498, -1649, -1582, -1449, -1235, -995, -725, -387, -71, 226, 467, 641, 720, 615, 526, 411, 304, 268, 267, 324, 330, 310, 268, 218, 174, 64, -67, -237, -476, -670, -760, -811, -797, -701, -640, -541, -394, -228, 11, 213, 261, 311, 201, 57, -17, -60, -34, 14, 60, 64, 70, 89, 151, 303, 347, 350, 274, 196, 117, 46, 110, 101, 103, 41, -53, -110, -179, -194, -137, -24, 44, 29, 3, -103, -100, -80, -51, 1, 17, 16, -11, 6, 7, 130, 203, 261, 308, 261, 240, 223, 206, 250, 233, 130, 56, -86, -127, -63, -70, -49, -94, -163, -221, -264, -250, -254, -218, -258, -318, -318, -338, -313, -230, -119, -20, 14, 23, 71, 101, 164, 228, 256, 304, 403, 443, 444, 440, 431, 466, 417, 337, 351, 238, 106, 10, -107, -166, -207, -300, -320, -276, -177, -149, -64, -10, 109, 149, 109, 106, 83, 59, 141, 119, 181, 216, 181, 204, 247, 258, 264, 338, 248, 196, 54, -90, -179, -246, -293, -301, -241, -227, -186, -127, -90, 4, -31, -114, -150, -160, -218, -274, -248, -231, -176, -201, -170, -166, -188, -137, -139, -110, -127, -213, -281, -418, -501, -514, -478, -430, -303, -190, -90, 56, 14, -41, 14, 30, 9, 24, 37, 81, 134, 201, 121, 136, 39, -167, -248, -284, -328, -334, -353, -416, -337, -218, -224, -240, -256, -153, -114, -81, -40, -19, -13, -70, -24, 4, -16, -4, 91, 79, 99, 174, 224, 301, 211, 131, 49, -124, -306, -426, -555, -541, -567, -658, -504, -410, -348, -201, -104, -33, 7, 17, 99, 291, 473, 744, 855, 728, 578, 468, 391, 293, 200, 190, -100, -283, -397, -574, -703, -854, -897, -795, -625, -514, -510, -378, -237, -197, -84, -123, -56, -51, -154, -33, 107, 179, 204, 267, 437, 570, 638, 577, 443, 434, 420, 338, 260, 66, -27, 69, -87, -87, -94, -187, -307, -427, -561, -670, -777, -873, -911, -831, -630, -497, -286, -63, 167, 414, 855, 1198, 1204, 1288, 1268, 1104, 1161, 1145, 768, 740, 701, 621, 867, 744, 437, 124, -447, -918, -1244, -1724, -2185, -2663, -3137, -3197, -2889, -2412, -1896, -1158, -323, 381, 1151, 1522, 1821, 2036, 2003, 2112, 2059, 2095, 2335, 2453, 2553, 2596, 2516, 2386, 2226, 1794, 1078, 231, -981, -2223, -3099, -3656, -4161, -4645, -5518, -6226, -5915, -5042, -3574, -1906, -90, 1752, 3097, 4147, 4650, 4694, 4580, 4443, 4391, 4575, 4740, 4811, 4838, 4515, 4081, 3604, 2850, 2031, 1098, -56, -1278, -2625, -3746, -5002, -6549, -7955, -8918, -8301, -6733, -4680, -2256, -33, 2492, 4148, 4715, 4560, 4254, 4388, 4877, 5369, 5449, 5702, 5779, 5562, 5315, 4997, 4681, 4291, 3627, 2536, 1591, 210, -1248, -2959, -5087, -6824, -8645, -10317, -11657, -11411, -9222, -6343, -2745, 481, 3437, 5948, 6914, 6766, 6219, 6377, 6926, 6989, 6355, 5205, 4373, 3676, 3346, 3187, 2950, 3260, 3129, 2593, 1798, 161, -2025, -4594, -7300, -9542, -11458, -13398, -13188, -10854, -7835, -3760, -183, 2837, 5459, 6767, 7393, 7696, 7850, 8312, 7870, 6128, 4612, 3553, 2915, 2999, 2845, 2640, 2932, 3042, 2668, 1367, -774, -3067, -5526, -7894, -10006, -12648, -15395, -15125, -12309, -8023, -2252, 1522, 4245, 6999, 8088, 8529, 8779, 8441, 8445, 8322, 6288, 4118, 2690, 1458, 1564, 1864, 1992, 2837, 3083, 2645, 1005, -1705, -3986, -6193, -8231, -10426, -13857, -16551, -15294, -11860, -6323, -496, 1875, 4431, 6416, 6987, 8264, 8575, 8926, 9376, 7598, 4627, 1859, 343, 858, 2141, 2797, 3196, 3463, 2903, 1986, 4, -2763, -4602, -6602, -9443, -12849, -17128, -17333, -13136, -8182, -1762, 1082, 2139, 4775, 5721, 7830, 9699, 10053, 10770, 8542, 4164, 745, -1037, 100, 2780, 3683, 3347, 2709, 1359, 1164, 945, -306, -1581, -4357, -8812, -13200, -18043, -19217, -13585, -7857, -1784, 1615, 550, 2418, 4548, 7630, 11941, 12869, 12119, 8875, 2589, -1815, -2205, 9, 3583, 4378, 2380, 1008, 19, 1182, 3277, 3209, 1558, -2308, -8291, -13288, -16426, -17303, -13226, -7931, -4275, -1559, -1595, -301, 3833, 8131, 12080, 13043, 11206, 7556, 2676, -394, -684, 873, 2829, 3212, 1421, 44, 1041, 3065, 4874, 4565, 803, -4303, -9351, -13303, -16018, -17233, -14127, -9363, -5578, -2827, -2600, -751, 4140, 9352, 13535, 14127, 11171, 6575, 2435, 144, 153, 2039, 3479, 3350, 1678, -271, 258, 2980, 5586, 5449, 1167, -4919, -10379, -13460, -15600, -16642, -12639, -7880, -5142, -3434, -3614, -348, 6620, 12936, 16511, 14029, 8111, 3741, 1696, 1461, 2572, 2678, 1028, -380, -1771, -1565, 2126, 5471, 6276, 3926, -1972, -6937, -9739, -11334, -13575, -15437, -12362, -8695, -5295, -1969, -1625, 2242, 9393, 13954, 15227, 11570, 6326, 4210, 3360, 2450, 1822, 314, -878, -888, -1190, 136, 3100, 4915, 5595, 2846, -2532, -5696, -8567, -11475, -14327, -17079, -14043, -8537, -4540, -1455, -890, 2516, 9541, 14410, 15768, 12561, 7493, 4800, 3680, 2823, 2071, 681, -448, -467, -557, 621, 3456, 5152, 4834, 1861, -2568, -6225, -9501, -11670, -15728, -18853, -13288, -7560, -4180, -868, -1949, 1905, 11194, 15814, 16105, 11744, 5292, 3164, 3683, 3577, 3116, 1008, -961, -968, -838, 1561, 5039, 5723, 4430, 750, -4330, -7721, -9108, -11387, -15885, -16261, -11308, -6419, -1854, -680, -753, 5221, 12215, 15697, 14637, 8387, 3624, 2703, 2776, 3103, 1928, -1092, -2696, -1894, -136, 3406, 6202, 5228, 1898, -2663, -5452, -6822, -8689, -12182, -17099, -14366, -6989, -3063, -350, -767, 1365, 9596, 15647, 16209, 11288, 5244, 2543, 2816, 3657, 2646, -146, -3055, -2835, -668, 1985, 5866, 5708, 2022, -1205, -4218, -5765, -7616, -11164, -16858, -17609, -9138, -3137, -99, 179, -1659, 5514, 14840, 17522, 14430, 6679, 1748, 3032, 4884, 3963, 1561, -2041, -3046, -181, 1434, 4067, 5416, 2023, -800, -3279, -4942, -6809, -10417, -15153, -18857, -12658, -3851, -760, -558, -3287, 1549, 12886, 17524, 15411, 8662, 3070, 4203, 6723, 5308, 2716, -538, -3243, -988, 1068, 3407, 5798, 2018, -1281, -2930, -4961, -5689, -8202, -12885, -17736, -14967, -5949, -1479, -685, -3005, -1886, 8792, 17136, 16536, 10483, 3927, 2602, 6859, 8614, 4742, -437, -4330, -2221, 1968, 3764, 5266, 2308, -1798, -2532, -3514, -4667, -6356, -12192, -19468, -16918, -6337, -584, -460, -4674, -4567, 7587, 17462, 17382, 10947, 2655, 1398, 6535, 9436, 5648, -990, -4748, -3650, 1836, 6393, 6246, 2825, -763, -2062, -1892, -3459, -7267, -12908, -20676, -18827, -5998, 567, -506, -5047, -5992, 5716, 18596, 20058, 12030, 1865, -965, 5906, 10369, 6473, 220, -6202, -5504, 3057, 6976, 6272, 3045, -2313, -2466, -131, -1551, -6586, -13786, -20580, -18687, -6182, 1170, -1699, -7016, -5853, 7336, 19635, 18747, 8492, 484, 1904, 9558, 11168, 2937, -3787, -5506, -1587, 4588, 6025, 4525, 710, -1742, 73, 1045, -3025, -9059, -15607, -21123, -12792, -1128, -2245, -5256, -6797, -1247, 12689, 17869, 12656, 5182, 2252, 6956, 9271, 4560, -59, -2338, -1399, 3110, 4240, 1605, 1729, 1791, 731, 526, -3659, -9443, -14017, -18507, -14380, -3830, -1892, -5538, -6389, -1437, 11471, 17961, 10784, 3867, 3837, 7230, 10032, 5019, -3134, -2830, 844, 4607, 5565, 1921, 1011, 881, 735, 958, -3801, -10726, -15261, -18119, -12778, -2866, -2603, -7343, -6520, 4407, 15998, 15090, 7181, 2510, 4548, 9825, 9652, 920, -3814, -2118, 1120, 6682, 3974, 417, 2468, 1956, 1642, -2083, -7778, -10360, -14129, -17230, -10176, -2845, -5932, -6570, -3163, 6579, 16382, 10817, 4310, 5201, 8074, 11583, 6286, -2976, -1265, 2466, 3476, 4752, 1668, 764, 2296, 1142, -228, -3339, -9348, -13877, -16711, -14656, -4454, -2256, -7336, -6536, 111, 12841, 15942, 5982, 2049, 5911, 9468, 7918, 1085, -2420, 815, 3439, 4495, 3993, 2041, 1959, 3273, 3691, -393, -7750, -12746, -15478, -16254, -7371, -2946, -9608, -7873, -1832, 9338, 17213, 8322, 3440, 5988, 8757, 9936, 2292, -3424, -922, 1744, 4483, 2468, 27, 2222, 1995, 3343, 1769, -6542, -11203, -12962, -16088, -9501, -1115, -8204, -10372, -1587, 8744, 15901, 8070, 2693, 7868, 12181, 11964, 830, -4146, 2162, 4107, 3173, -111, -965, 1415, 2206, 1388, -3147, -7596, -10206, -12611, -14856, -9752, -3326, -7516, -7264, -179, 8941, 14397, 7069, 4577, 9892, 11850, 8287, 897, 997, 4290, 3103, 1322, -1094, 1207, 3673, -878, -2363, -4040, -8784, -9888, -14330, -17262, -7700, -2613, -7277, -6265, 31, 11344, 14601, 5326, 5264, 11418, 13565, 7904, 173, 1515, 4949, 4417, 1417, 243, 797, 803, -321, -2669, -5292, -10763, -13355, -16067, -14473, -4034, -6959, -11364, -4685, 5935, 15887, 9999, 2181, 6020, 14173, 14941, 4487, 169, 2785, 4822, 4534, 1210, 127, -69, -213, 103, -2532, -8778, -13456, -14172, -14808, -7995, -2655, -10056, -9343, 595, 11354, 14963, 5618, 3092, 9273, 13015, 8668, 1297, 1959, 3517, 2599, 1811, 970, 183, -256, -430, -2443, -6503, -10387, -11741, -14456, -11377, -3756, -6713, -8572, -3240, 5889, 14237, 9813, 3751, 6275, 11785, 11882, 4314, 548, 3556, 4914, 823, -921, 1120, 261, -1655, -3994, -5458, -7928, -11270, -14366, -14064, -4013, -2321, -8368, -5508, 3691, 14516, 12101, 2095, 4301, 13111, 12137, 2426, -378, 2760, 5645, 2962, -3006, -480, 2873, 391, -3253, -6997, -8961, -9009, -12822, -14199, -5639, -3576, -8170, -4878, 5501, 14400, 9716, 1130, 6369, 16064, 12074, 277, -2062, 4367, 7704, 1445, -5129, -1728, 4173, 1434, -5275, -7658, -8107, -8681, -12689, -13712, -4825, -3015, -7630, -4144, 6293, 14857, 8292, 1181, 8085, 14794, 11360, 661, -478, 6410, 5992, 558, -3504, -1211, 2009, -1208, -5646, -7981, -9226, -10741, -13940, -10904, -3916, -5237, -6219, 177, 9235, 12868, 6476, 4330, 12179, 14771, 6392, 180, 2226, 6136, 4490, -2305, -2936, 533, 518, -2635, -7059, -9546, -9930, -11561, -14040, -8138, -2989, -6613, -4979, 3621, 12729, 11657, 3524, 6874, 15097, 12953, 4648, 844, 2850, 5081, 2442, -2036, -2082, -840, -2096, -3814, -6050, -10464, -12476, -12986, -11600, -5145, -5745, -7133, -863, 6002, 12548, 9118, 5174, 11224, 13319, 9670, 4027, 1818, 5001, 4423, -333, -2355, -947, -288, -3537, -7094, -8482, -9829, -11531, -13216, -9169, -4542, -6239, -4875, 2235, 9860, 9735, 4066, 6986, 14416, 12541, 5152, 1972, 4661, 7473, 2038, -2496, 558, 1709, -3094, -7470, -6423, -7556, -12441, -15580, -9502, -2760, -7480, -8619, -734, 10387, 10729, 1214, 3766, 13705, 16145, 5873, -654, 6276, 9468, 3783, -2075, -954, 2797, 573, -5926, -7830, -7307, -10286, -13101, -11156, -5465, -5726, -8531, -4520, 6055, 11407, 3614, 1385, 9251, 14634, 10192, 501, 2907, 10023, 6357, -597, -1324, 2500, 733, -5982, -7107, -7303, -10245, -13712, -12072, -4161, -4474, -7983, -5675, 3606, 12249, 6125, 1508, 7461, 13609, 11554, 2348, 2338, 8138, 6272, 1732, -333, 267, 254, -4907, -6743, -6883, -10740, -13947, -13969, -6457, -3927, -7510, -5781, 1609, 10464, 7447, 3320, 9179, 13687, 11992, 4891, 2959, 8194, 7466, 1724, -721, -47, -358, -3946, -6409, -7301, -9579, -13092, -13409, -7189, -4818, -7367, -6535, 833, 8801, 6489, 3243, 8414, 13876, 11093, 4934, 5869, 8078, 4070, 487, 1274, 2103, -1868, -7359, -5949, -4730, -8347, -12417, -13118, -5872, -3309, -7206, -5919, 1719, 8712, 5536, 3159, 9131, 14294, 11270, 3933, 5611, 9399, 4969, -617, -968, 1746, -1468, -8145, -8294, -6799, -9568, -13121, -12178, -7290, -5759, -6773, -5065, 1859, 7947, 5546, 4678, 10022, 14744, 12876, 5548, 6288, 10926, 7101, 1519, -311, 884, -684, -6744, -8370, -7858, -10037, -14044, -14123, -7313, -6016, -8641, -5945, 1626, 7824, 4607, 3911, 11288, 14473, 10891, 5968, 7586, 10489, 5354, 914, 2053, 2269, -2885, -8071, -6477, -5316, -9698, -14931, -12716, -6092, -6397, -8515, -5302, 2797, 6830, 3981, 4991, 11234, 15275, 11000, 6219, 7993, 9375, 5168, 484, 1168, 1111, -4304, -8679, -7022, -6953, -11226, -14629, -12575, -6829, -7083, -8081, -4331, 2817, 6886, 4577, 6724, 12464, 15394, 12215, 8242, 10132, 10042, 4757, 992, 1449, 316, -5252, -9051, -8450, -9242, -12459, -15271, -12751, -8188, -9112, -8381, -3394, 3537, 5921, 4317, 8411, 14434, 16045, 11481, 9729, 12297, 10440, 5555, 2206, 1881, -784, -5819, -7897, -8515, -10406, -13368, -15213, -12606, -9705, -9732, -7985, -3336, 2489, 4527, 5328, 9184, 14056, 15665, 11501, 10394, 12251, 10470, 5875, 2116, 1424, -1088, -6189, -8308, -9272, -11261, -13219, -14947, -12342, -9816, -9312, -7561, -3474, 3884, 5578, 5651, 10027, 14943, 16206, 12115, 12131, 12775, 8859, 5152, 2463, 597, -2969, -7963, -9275, -9873, -12111, -14160, -15641, -12447, -9885, -9620, -7681, -2658, 4721, 5332, 5765, 11417, 16188, 16396, 12832, 13378, 13452, 9352, 5431, 3523, 952, -3763, -7458, -8574, -9810, -12705, -14589, -15145, -12455, -10453, -9805, -8067, -3584, 3050, 4007, 5702, 10653, 14978, 15455, 12762, 14232, 14340, 10037, 5558, 4073, 2215, -3166, -7111, -7954, -9483, -12991, -14411, -14270, -12918, -12078, -11031, -7327, -3937, 768, 3150, 5481, 10016, 14260, 15899, 13109, 13836, 14747, 11364, 6537, 5055, 3794, -2058, -6315, -6457, -7617, -12358, -14333, -13446, -12696, -13332, -12759, -8005, -5019, -1691, 1125, 4355, 8995, 11750, 12668, 13028, 14637, 13353, 10370, 8190, 7114, 3963, -905, -3417, -4250, -6762, -10506, -12151, -11480, -12532, -13045, -11027, -8081, -6452, -3660, 981, 3579, 6513, 8644, 12199, 13230, 12349, 12157, 10237, 9416, 6572, 3740, 958, -1809, -3273, -6236, -8467, -9595, -10496, -12609, -12735, -10239, -8441, -8254, -5819, -581, 2670, 4577, 6506, 10620, 12189, 11775, 12025, 11544, 9920, 7251, 5121, 2508, 60, -2042, -4580, -7140, -8558, -9900, -12318, -12141, -11531, -10894, -9439, -7344, -2945, -730, 1668, 5356, 8895, 11393, 10760, 12109, 13435, 11217, 8321, 6653, 5518, 2586, -1607, -4735, -5578, -6856, -9656, -11128, -12010, -12381, -11034, -10363, -7821, -5976, -2279, 910, 2827, 6646, 9498, 11772, 11250, 12786, 12979, 10243, 8608, 6652, 5187, 1524, -1565, -3717, -6079, -7339, -9676, -10827, -11771, -11555, -10930, -9849, -7488, -4914, -2432, 500, 3789, 6265, 8508, 10751, 11671, 11438, 11286, 9011, 8010, 6442, 3557, 1317, -1317, -2983, -5204, -7223, -7713, -8430, -9438, -10477, -9011, -6970, -6393, -4908, -1809, 1102, 2783, 5225, 7914, 9396, 9850, 10456, 10379, 9112, 6993, 5518, 2762, 2253, -341, -3514, -4335, -6228, -6903, -8361, -8328, -8898, -9476, -7604, -5829, -4151, -3407, -694, 2628, 4150, 6075, 7684, 9233, 10382, 9443, 8625, 8452, 7294, 4989, 3441, 1251, -464, -2440, -4802, -4280, -6886, -8354, -8989, -9034, -7497, -8775, -6020, -4540, -3346, -1117, 1015, 4053, 4348, 6649, 8127, 8495, 8956, 7464, 7163, 6543, 5645, 3432, 437, -81, -995, -3504, -5932, -5504, -5722, -8252, -7541, -7441, -5652, -5775, -4301, -1804, -574, 496, 2153, 5615, 6302, 5822, 5916, 7874, 7676, 4614, 4360, 3563, 3536, -157, -861, -2278, -2932, -4257, -7284, -6105, -6433, -6546, -6559, -6657, -5139, -1844, -2815, -164, 1809, 2747, 4294, 5164, 5992, 6940, 5276, 5514, 5706, 4191, 2580, 1654, 707, 333, -3066, -3571, -3092, -4612, -5615, -6148, -4518, -5262, -5069, -4330, -2366, -327, -1314, -169, 3501, 3971, 3607, 2753, 5668, 5828, 3853, 4518, 2773, 4020, 1488, 1248, -111, -1355, -2546, -1825, -4241, -4435, -3680, -4353, -2920, -4270, -4261, -2243, -1646, 1317, -1701, -113, 1979, 2322, 3389, 1399, 3149, 4006, 3773, 2143, 2022, 2413, 2830, 237, -49, -1341, -884, -1519, -2930, -4671, -2536, -1161, -3848, -3961, -2959, -1161, -123, -2295, -310, 1180, 873, 1164, 1288, 2326, 2917, 2569, 3050, 1125, 2465, 1869, 1744, 176, 613, -91, -1568, -2256, -2296, -758, -1638, -3100, -3490, -13, -2043, -493, -1626, -2171, 764, 625, 230, -179, 927, 1892, 1666, 1341, 2086, 1809, 2358, 320, 1826, 1369, 581, 478, -905, -810, -63, -1332, -1768, -1449, -1624, -1768, -1821, -1442, -1282, -1305, -2055, 1659, -985, 169, 326, 1041, 2548, 1037, 476, 2072, 2532, 1448, 641, 1140, 1114, 2385, -897, -314, 1646, -1959, 287, -3629, -201, -915, -2488, -1172, -3189, -1011, -623, -480, -1368, -1314, -298, 863, 1277, -271, 754, 734, 2312, 554, 1445, -227, 1211, 1756, 91, 1502, -942, 934, -520, 224, -2189, 344, -697, -1494, -1819, -1264, -1245, -37, -2315, 210, 528, -773, -1060, 851, 1308, 111, 661, -897, 3176, 341, 1262, 547, 394, 1818, 320, 83, -393, -456, -317, 630, -2588, 250, -745, -1227, 1765, -3414, 765, 190, 591, -51, -1052, 560, 1809, -601, 1107, -173, 708, 1469, -1332, 664, 561, -49, -308, -1351, 1738, 90, -678, -928, -724, 1709, -998, -661, 1465, -955, 2315, -2046, 2153, -353, 496, 1562, -2373, 3886, -3430, 2456, -1168, 705, 218, -404, 70, 1448, -1148, 1334, -2365, 3033, -207, -1102, 1184, -1528, 1180, -196, 210, -263, -463, 664, -1137, 280, 214, -2299, 3212, -3627, 3267, -1419, -845, 1489, 530, 800, 414, 890, 1074, 436, -593, 2345, -2139, 3102, -2680, 1385, -1664, 1302, -1899, 750, -1408, -537, 224, -975, -121, -2412, 827, -380, 121, -131, -1357, 1217, 423, 917, -811, 1822, 43, 1732, -397, 633, 614, 238, 1609, -1425, 1602, -954, 558, 14, 274, -1489, 1612, -2653, 2245, -2062, 1157, -3446, 1452, 708, -2508, 2649, -2496, 801, 2286, -2306, 2826, -3170, 4004, -994, 114, 6, 454, 348, 1254, -2598, 1269, 638, -1788, 3459, -5805, 5291, -3551, 3530, -2375, 1861, -198, 21, 1371, 74, 16, 700, 24, -258, 1494, -3791, 4173, -3167, 2176, -2885, 348, 1425, -2168, 2289, -4141, 3314, -2065, 1891, -1605, 201, 76, 665, 106, 932, -764, 1672, -1659, 2876, -1359, 410, 11, -286, 488, -880, -157, 904, -2196, 2745, -2706, 1337, -537, 331, 458, -1802, 2445, -1705, 1255, -521, 1822, -2629, 2987, -1958, 1869, -1240, 787, -925, -241, 958, -1901, 1405, -2500, 771, 17, -1035, 340, -823, 406, 6, -594, 1227, -1471, 2462, -1636, 446, 1646, -955, 948, -848, 1237, 121, -707, 1264, -2422, 2235, -1979, -191, -430, -711, -286, 30, -1716, 1168, -2019, 1979, -1242, 244, -190, -139, 1921, -1956, 1991, -1387, 984, 248, -34, 240, -453, 210, -528, 555, -938, 224, -804, 53, -881, -583, 653, -1952, 1459, -1716, 1265, -951, 1054, -121, -488, 1982, -1120, 2132, -1604, 2009, -83, -441, 1728, -1472, 2006, -938, 190, 234, -1944, 1364, -1565, -170, -71, -2161, 2166, -2880, 3077, -2410, 1274, -853, 2929, -2052, 1766, -962, 1504, -343, 540, 688, -990, 1062, -13, 111, -353, -40, -220, -450, -127, 84, -1474, 828, -1124, 453, 34, -511, 987, -607, 690, -374, -34, 673, -166, 159, 39, -701, 1339, -694, 136, 146, -363, 134, -997, 374, -513, -421, 156, -741, 520, -1217, 1312, -1281, 1648, -1369, 1524, -454, -621, 1731, -2579, 3710, -3422, 2309, -853, -594, 2141, -3172, 2937, -3253, 2650, -1721, 371, -791, 124, 223, -478, 194, -231, 871, -693, 594, -553, 611, -43, 446, -497, 695, -804, 1555, -1691, 1422, -1574, 771, -353, -356, 744, -1428, 1744, -2173, 1659, -1329, 1537, -403, -131, -147, 1345, -751, 930, -273, 543, -441, 384, 635, -931, 1192, -1155, 944, -1785, 1845, -2258, 1342, -1081, -267, 1212, -1901, 1594, -1405, 1811, -424, -177, 961, -764, 1459, -937, 1315, -633, 426, 238, -694, 1102, -1542, 1177, -1035, -263, 159, -781, 498, -874, 685, -887, 768, -1609, 2282, -2710, 2740, -2296, 910, 458, -932, 1032, -493, -121, 1354, -1926, 1842, -587, -330, 813, -1814, 2286, -1619, 637, 617, -1449, 1140, -1110, 43, 1529, -1971, 2128, -1685, 1691, -281, -695, 2246, -2925, 3276, -2372, 1589, -536, 24, 130, 49, -992, 1829, -2652, 2286, -1077, 84, 1200, -2205, 2870, -2365, 1568, -697, 188, 0, 1037, -2112, 2702, -2152, 1904, -1282, 166, 1408, -2192, 2415, -2221, 1411, -815, 421, -147, -394, 935, -793, 683, -210, -171, 1422, -1489, 1382, -581, -588, 1698, -2767, 3716, -3584, 2937, -1794, 230, 703, -501, 143, 16, -101, -343, 905, -1475, 1154, -480, -73, 1282, -2370, 2500, -2048, 1291, 61, -1539, 1471, -1385, 907, -843, 91, 760, -1752, 1201, -1557, 1985, -2842, 2105, -2089, 713, 364, -87, -637, 988, -1911, 3701, -4538, 3937, -2759, 1752, -620, -27, 278, -347, 214, 994, -1525, 1469, -577, 841, -1459, 2353, -2620, 2565, -938, 397, 932, -1834, 2480, -1461, 1035, 464, -1327, 1325, -583, 310, -450, 268, -1325, 1841, -2485, 1240, -176, -1491, 2682, -3539, 1804, -677, -341, 1125, -1916, 850, 1041, -2740, 3334, -2880, 1769, -458, -1110, 687, -291, -743, 565, -1751, 745, 343, -2189, 1724, -1901, 37, 1597, -2905, 3496, -3539, 3134, -301, -353, 1161, -114, 136, 1518, -1785, 2490, -2038, 1471, -1408, 1588, -1762, 2086, -2805, 2286, -1289, 717, 134, -1725, 2500, -2406, 1377, 283, -1828, 2779, -2513, 2553, -1425, -541, 2339, -3230, 3493, -3691, 2572, -740, -984, 193, -491, 581, -945, 648, -931, 914, -1535, 1125, -386, -21, 691, -524, 841, 284, -914, 2543, -1574, 1108, -257, -170, 554, -136, -990, 2001, -2335, 1317, -220, -401, 2005, -3273, 2690, -326, -1462, 2366, -2699, 2877, -2590, 638, 1321, -1465, 860, -824, 1114, -1399, 847, -835, 1681, -2011, 297, 1295, -537, 605, -1575, 1592, 198, 537, 741, -241, 183, 1107, 903, -213, 831, -1878, 3471, -3060, 3527, -4050, 2913, -2008, 183, 1095, -4124, 3821, -3573, 1345, -63, -1889, 3146, -3854, 2725, -660, -1071, 2012, -2119, 86, 2325, -3861, 4121, -3304, 1362, 277, -2678, 3186, -2341, 174, -153, -590, 374, 221, -2006, 3206, -3217, 484, 1769, -1811, 3274, -2505, 1112, 1502, -1365, 2388, -1718, 471, 650, -476, -50, 131, -1471, 1567, -701, -2419, 2486, -3814, 3439, -2972, 640, 817, -1716, 1364, 1210, -2436, 3430, -1915, 2128, -310, -1611, 4290, -2506, 754, 248, -311, 1267, -641, -516, 2452, -3791, 2535, -298, -283, 1085, -1257, 296, 1955, -2733, 4137, -3110, 1455, 478, -2023, 3529, -3674, 2483, -730, -600, 313, 7, -992, 2595, -2188, 1591, -2266, 997, 1861, -2153, 911, -2416, 2678, -1220, 49, -608, -1051, 1755, -2031, 2348, -2139, -256, 2630, -3025, 5275, -3333, 3554, 491, -483, 2555, -1382, 1581, 873, -2409, 2708, -264, -173, 817, -3357, 2560, -1427, -188, 1327, -1706, -278, 1042, -2035, 2872, -4178, 1228, 40, -1839, 1464, -1401, 377, 151, -420, 1814, -304, -630, 2192, -169, -690, 1238, 29, 2151, -1371, -813, 3076, -1421, 2018, -213, -437, 1538, -1497, 1528, 721, -1879, 1187, -2192, 628, -446, -4735, -404, -3617, -3009, -3990, -5752, -4417, -5394, -6662, -1034, -7194, -1845, -3881, -962, 1925, -327, 2318, 3626, 3914, 7905, 4767, 6846, 10127, 4581, 9729, 3927, 8231, 5252, 2592, 6694, 1044, 2812, 1368, 398, 681, -3280, -2536, -2678, -5002, -7113, -6536, -9605, -8637, -14283, -9719, -2430, -9703, -6066, -10526, 2800, 2242, -536, 4084, 3713, 5259, 9062, 6722, 9608, 2486, 3569, 9936, 1278, 3114, -2540, -236, 998, -3854, -2121, -2253, -5421, 1798, -124, 1485, 4207, -434, 11010, 6427, 8131, 11271, 4468, 13849, 7556, 7905, 7413, 847, 6053, -19, -2498, -1448, -6036, -8114, -9501, -12949, -12411, -20485, -19811, -7781, -11987, -11947, -13476, -6106, 5762, 83, 4788, 8679, 5114, 15924, 11324, 13346, 8715, 1535, 12544, 2739, -434, -2345, -8749, -4470, -9079, -8197, -4838, -14559, -5526, -2558, 291, 5054, -2256, 10119, 11403, 14776, 14023, 10513, 14177, 14284, 11560, 9219, 4053, 2680, 3217, -857, -3991, -5581, -7401, -6422, -9421, -7257, -7651, -12151, -9770, -13202, -14444, -13730, -6527, -3550, -9676, -8073, 193, 6562, 4076, 4895, 6659, 6202, 7616, 9074, 8614, 788, -2536, 1302, 223, -5205, -8712, -7676, -5576, -6842, -7117, -2832, -4368, 16, 3230, 6228, 8070, 6126, 11581, 11942, 12050, 11226, 8905, 6729, 8188, 6536, 3464, -1034, -2972, 2309, -3089, -2722, -2912, -3190, -1174, -4230, -69, 59, -5141, -4797, -5291, -7975, -13553, -19602, -8105, -4155, -10379, -15385, -10086, 3347, 6492, -201, 4051, 4165, 6410, 11007, 9603, 9389, -1000, 748, 7401, 414, -5519, -8354, -6485, -1365, -8668, -7731, -6522, -7657, 2767, 1431, 5379, 5035, 3224, 12074, 10653, 11524, 9242, 4620, 8728, 7508, 5843, 2889, -1309, -1438, 2323, -1472, -1285, -3496, -2128, 4981, -366, 1299, 1030, -1908, 5848, -2468, -4330, -6972, -17172, -12114, -20787, -10232, -3240, -17287, -11624, -7443, 9632, 12755, -253, 10089, 9448, 10374, 16885, 8247, 7643, -4401, -2176, 6732, -7343, -11845, -13161, -9492, -5825, -9361, -6649, -2536, -5316, 5425, 11091, 8371, 9755, 7286, 14393, 12768, 4447, 8642, 2395, -304, 2303, -4128, -1459, -8582, -5535, 2755, -4744, 377, 1467, 2063, 7616, 5462, 11450, 10826, 3043, 6714, 3045, 2266, 2051, -9552, -8558, -10552, -20071, -25720, -32393, -12629, -2598, -17336, -14004, -3964, 16042, 21581, 8542, 18288, 13075, 11463, 18780, 8472, 6076, -11980, -12798, -11, -13687, -15795, -20189, -17519, -4340, -6437, 5001, 4480, -1514, 16275, 19261, 21319, 11921, 4195, 14641, 7287, 1424, -2038, -12841, -9643, -11280, -9436, -6108, -14877, -5975, 637, 6879, 13939, 7994, 12122, 16059, 15755, 16766, 8668, 5985, 4435, -557, 1037, -5321, -9184, -7087, -9312, -10136, -12095, -17379, -20629, -21910, -7214, 5942, -5555, -9713, 1468, 17866, 20890, 5918, 7540, 8171, 3076, 5818, -1588, -4875, -15897, -17033, -2575, -6593, -9125, -11238, -6123, 8015, 5682, 9121, 7668, 5069, 13349, 12674, 13052, 1419, -6560, 1939, 1951, -1347, -8340, -11394, -6372, -4715, 1110, 3930, -1262, 403, 4870, 9819, 10235, 6399, 6863, 7042, 4248, 6643, 2455, 1398, 2802, 937, 4531, 324, -9, 1651, -3537, -1621, -7400, -9843, -10496, -20640, -21214, -21926, -8312, 4744, -5388, -7276, 574, 19579, 25847, 9248, 5898, 6460, 6393, 5709, -3934, -7154, -16833, -19048, -7333, -5309, -5958, -8128, -4013, 10077, 13503, 13877, 11795, 5638, 10656, 11324, 9122, 3217, -9142, -7740, -7194, -7290, -6276, -13493, -8298, -2893, 644, 7628, 3503, 6860, 8827, 8939, 13423, 6329, 4772, 3032, -510, 4571, 677, -511, -677, -1282, 5625, 2990, 2762, 5672, 2369, 3414, 50, -2308, -3727, -12459, -13210, -15719, -22333, -26281, -23492, -1838, 10447, 1197, -1348, 9519, 27932, 26869, 9116, 4657, 1875, -1082, -5851, -12892, -16766, -26467, -23371, -7773, -858, 1448, 43, 7344, 20585, 21964, 20773, 13849, 7326, 6832, 1931, -2066, -10697, -17686, -13759, -11484, -6607, -2929, -1389, 6089, 9638, 14748, 17352, 11817, 10353, 6842, 3056, -143, -7233, -9308, -11824, -9799, -2233, -2625, -474, 6400, 12184, 13952, 9228, 10253, 12061, 5725, 713, -5276, -8372, -6879, -8525, -10203, -14636, -16538, -13082, -14321, -12848, -6707, 2286, 9656, 6063, 6492, 12337, 14656, 12268, 2062, -3947, -5189, -7804, -8922, -12374, -13483, -13186, -8581, 3676, 8735, 9551, 10811, 12634, 14283, 10183, 5602, 715, -5205, -6636, -8151, -9633, -12903, -12832, -5125, 1365, 5695, 7236, 7908, 10239, 10573, 11318, 11131, 6313, -918, -6786, -5522, -4728, -7817, -8629, -6839, -2433, 1681, 6396, 10235, 11036, 12221, 12028, 8948, 5763, 2933, 167, -4954, -7694, -7591, -6516, -4878, -5019, -6415, -9759, -10257, -7536, -7184, -8377, -3958, 3998, 5017, 154, 2706, 9142, 11503, 7878, 4231, 2249, -3703, -8602, -9144, -5688, -7084, -10979, -6990, 76, 4808, 5384, 5188, 7741, 7527, 8898, 8041, 2103, -2663, -5125, -2339, -2860, -6419, -5623, -3186, 494, 4641, 6406, 7193, 4724, 2740, 3824, 2870, 271, -4909, -6897, -5619, -5129, -3500, -1756, -96, 1648, 4026, 8162, 9383, 8070, 6039, 5117, 5873, 5973, 1595, -3226, -2575, 774, 2825, -7, -3559, -3332, -2876, -2448, -3162, -4327, -6710, -10537, -11625, -12114, -12022, -5569, 2925, 4391, 3439, 5452, 10683, 14490, 11487, 6362, 1064, -2849, -4054, -6573, -8891, -11758, -12087, -6020, -990, 2945, 5328, 7116, 9488, 9232, 9175, 7411, 2616, -1868, -2970, -2795, -4607, -8441, -8365, -4954, -800, 2846, 5899, 5911, 5256, 3689, 3163, 2845, -1464, -4481, -6393, -6553, -5546, -4798, -1639, 1267, 2472, 5638, 6455, 6243, 5385, 1658, 580, -1659, -4648, -5803, -5951, -5168, -3337, 795, 8651, 9571, 6922, 9272, 13653, 17647, 11914, 3080, -2235, -5358, -5359, -6700, -10663, -15464, -18433, -15869, -11270, -7054, -1591, 5002, 7241, 7984, 11711, 14210, 12759, 5695, -17, -4537, -8295, -8422, -10432, -11253, -12098, -7840, 633, 5194, 7030, 7124, 7608, 8994, 8775, 6512, 296, -6969, -9061, -8015, -6260, -6380, -6493, -3856, 665, 6535, 9812, 9625, 6870, 5256, 4391, 1152, -2456, -6083, -8954, -9561, -8639, -5326, -2907, -276, 3380, 6645, 10326, 9603, 7526, 5394, 4360, 2349, -893, -4021, -7808, -8899, -7007, -3536, -493, 771, 2559, 5085, 7163, 8902, 8599, 6812, 5047, 4498, 2970, 129, -2092, -2151, -358, -413, -351, -721, 410, 1434, 129, -1759, -4870, -7369, -10040, -12764, -9979, -3724, -1024, -841, 233, 5586, 10329, 9579, 6989, 2379, -2422, -4163, -5248, -6543, -9736, -11127, -7738, -3092, 1512, 3063, 5041, 7963, 8829, 8431, 5765, 2405, -1854, -4314, -4240, -4588, -5855, -6223, -4717, -167, 4762, 6669, 5925, 3202, 2562, 2869, 421, -3533, -5348, -6612, -6305, -4363, -1689, 1382, 2268, 4864, 7691, 8577, 7009, 3973, 2732, 81, -1815, -3077, -4527, -5398, -5748, -4168, -1448, 1241, 2272, 2256, 2983, 3636, 3883, 3005, 518, -1408, -2325, -2488, -3444, -3626, -2378, 878, 1311, 711, 6503, 8549, 8402, 7326, 5461, 6243, 4167, 4577, 2161, -1896, -2733, -3734, -3433, -7029, -11615, -13315, -13914, -10383, -1668, 4060, 2182, 2042, 5806, 12502, 13663, 7807, 3040, -3537, -7917, -8509, -10402, -10429, -12294, -11108, -3483, 3304, 8192, 7707, 7951, 9739, 10437, 8599, 2872, -1975, -5859, -8021, -7728, -8382, -8817, -6349, -1548, 3140, 5628, 5321, 5896, 6380, 6039, 5314, 1101, -3537, -7276, -8440, -6198, -5739, -5623, -3466, -101, 4565, 7656, 8701, 9670, 8118, 5833, 2827, -737, -3157, -4919, -7423, -7314, -5761, -4781, -2013, 523, 3643, 6385, 6589, 6483, 7220, 6303, 3270, -615, -3918, -6248, -6482, -6235, -3556, -1612, -2066, -483, 2725, 5566, 6179, 3789, 2747, 3157, 958, -1761, -2872, -3464, -3149, -3540, -3374, -617, 834, 2439, 3534, 3146, 3569, 2773, 777, -911, -2462, -3282, -3947, -4345, -4605, -4128, -2560, -911, 758, 1489, 2752, 2599, 2173, 3650, 4405, 2306, -668, -1949, 2105, 5286, 861, 1554, 2293, 3827, 5723, 2837, 2039, 952, -1269, -2069, -3847, -8679, -12714, -14247, -14330, -7904, -944, 243, 247, 1951, 9722, 13637, 9965, 6032, 2261, 451, -3262, -4937, -5529, -10627, -12139, -8748, -810, 2365, 1190, 3836, 7768, 11453, 10209, 5996, 2141, -2055, -4824, -5019, -6947, -8567, -7910, -6043, -393, 3734, 6235, 8405, 7684, 7750, 7864, 5805, 1862, -4345, -6617, -6689, -6592, -7221, -7530, -4822, -1341, 3045, 5792, 7179, 7120, 6320, 6699, 5592, 2966, -795, -3787, -4921, -6020, -5276, -5034, -4912, -3189, -558, 2528, 3599, 3744, 4575, 4598, 4625, 2730, 563, -1478, -4100, -4313, -3626, -3402, -3771, -3513, -1008, 2126, 3817, 3551, 3754, 3897, 3681, 2762, 473, -1007, -1948, -2800, -2783, -3720, -3536, -2301, -548, 1628, 2288, 2943, 2886, 2538, 2572, 1492, 4, -2179, -3757, -3903, -4373, -4178, -3234, -2452, -922, 911, 2095, 3737, 3693, 3130, 3180, 2392, 1712, 316, -1131, -1818, -2953, -3149, -3113, -2472, -1155, -921, -303, 877, 1975, 2902, 2479, 1875, 1289, 548, -60, -745, -1479, -2089, -2498, -2055, -1227, -1150, 147, 1288, 2628, 3393, 2235, 2208, 2456, 2006, 2756, 1905, 1464, 1722, 2560, 3980, 3144, 1656, 150, -1824, -3493, -6665, -9488, -11013, -11258, -9710, -6330, -1639, 2145, 4274, 6476, 9957, 12168, 10403, 5719, 1625, -367, -3581, -7190, -9906, -11398, -10753, -8499, -3486, 411, 3020, 5405, 7597, 9680, 10065, 8300, 4527, -708, -3414, -4047, -5682, -7740, -9303, -7811, -4067, 117, 3696, 5751, 6393, 6989, 8091, 7988, 4595, 73, -2512, -3781, -4928, -6235, -6852, -5688, -3283, 124, 2777, 4524, 5237, 6160, 6803, 5918, 3589, 139, -2198, -3314, -4621, -5067, -5823, -5394, -2997, -41, 2331, 3654, 4685, 5442, 6293, 5792, 4274, 1314, -1688, -3056, -3976, -4811, -5476, -5502, -4285, -2325, 473, 2191, 3571, 4720, 5369, 5559, 4167, 2692, 1054, -306, -1886, -3749, -4605, -4157, -3444, -2151, -754, 484, 2099, 3313, 3696, 3501, 2538, 1462, 124, -1222, -2675, -3739, -4284, -4225, -3372, -2135, -1130, 408, 1601, 2956, 3727, 3306, 3464, 3029, 1759, 44, -1150, -1725, -2123, -2740, -2890, -2393, -1782, -707, 431, 1365, 1878, 1775, 1658, 1996, 1732, 513, -561, -1201, -1369, -1331, -1349, -1447, -1252, -554, 433, 1322, 1652, 1655, 1654, 1518, 1101, 497, -228, -801, -1514, -1946, -1871, -1369, -921, -430, 198, 1118, 1916, 2866, 3504, 3733, 3196, 2907, 3196, 3077, 2388, 888, -133, -730, -1712, -2886, -4794, -7306, -8605, -7850, -6063, -4802, -3846, -1584, 2046, 5097, 6892, 6794, 5516, 4030, 2692, 1210, -1599, -4764, -6873, -6873, -5739, -4350, -2927, -1377, 941, 3641, 6155, 6987, 5609, 3803, 2249, 1465, -358, -2886, -4997, -6305, -5452, -4027, -2440, -1294, -26, 2152, 4017, 5149, 4917, 3960, 2483, 1240, 443, -1175, -3167, -4805, -4725, -3393, -2413, -1472, -396, 1085, 2895, 4640, 5319, 4825, 3808, 2757, 1948, 534, -1195, -2736, -4046, -4228, -3489, -2586, -1818, -987, 463, 2316, 3551, 3883, 3527, 3023, 2485, 1539, 251, -1168, -2473, -3063, -2649, -2253, -2106, -1671, -555, 934, 2042, 2823, 2819, 2329, 1991, 1656, 1030, -247, -1607, -2236, -2335, -2151, -2198, -2008, -1221, -146, 1164, 1974, 2366, 2519, 2529, 2400, 1905, 930, -394, -1564, -2226, -2445, -2598, -2622, -2455, -1769, -793, 71, 858, 1317, 1815, 2199, 2429, 2478, 1844, 998, 186, -511, -853, -1385, -2051, -2423, -2453, -1775, -1120, -687, -31, 388, 1024, 1748, 2029, 2039, 1674, 1454, 1447, 1289, 1121, 1151, 950, 1038, 1721, 2046, 1999, 1565, 1564, 1705, 1309, 627, -777, -2516, -4177, -5038, -5772, -6839, -7160, -6456, -3967, -930, 1427, 2829, 3326, 4504, 5778, 5929, 4391, 1538, -1120, -3076, -3947, -4337, -5019, -5691, -5538, -3786, -1005, 1375, 2712, 3476, 4174, 5128, 5672, 5049, 3137, 585, -990, -1492, -1914, -2982, -4244, -4228, -3229, -1508, 216, 988, 1452, 1925, 2982, 3873, 3253, 1915, 478, -487, -631, -951, -1571, -2322, -2655, -1751, -470, 628, 1154, 1228, 1729, 2355, 2882, 2715, 1568, 438, -418, -688, -763, -1414, -2032, -2295, -1835, -800, 177, 745, 897, 1198, 1792, 2520, 2545, 1771, 908, 224, 114, -123, -737, -1278, -1655, -1492, -1057, -534, -3, 109, 336, 864, 1397, 1709, 1332, 871, 630, 334, 194, -161, -667, -940, -1138, -904, -531, -516, -476, -421, -236, 129, 293, 381, 200, -17, -34, 69, 230, 17, -196, -333, -383, -171, -124, -167, -316, -571, -628, -448, -263, -253, -364, -431, -43, 358, 500, 1038, 1382, 1547, 1782, 1805, 2083, 1672, 1338, 1669, 1482, 1311, 997, 1100, 1404, 1037, 1047, 815, 169, -593, -1838, -2856, -4207, -5681, -5990, -5966, -5369, -4470, -3650, -2253, -1251, 157, 1954, 3046, 3524, 3087, 3022, 2983, 2480, 1919, 807, -231, -1335, -1885, -1662, -1814, -2088, -2305, -2145, -1598, -962, -136, 317, 307, 470, 1097, 1846, 2038, 1902, 1775, 1445, 1388, 1532, 1419, 1012, 147, -203, -73, -263, -376, -750, -1100, -1088, -907, -317, -41, -159, -109, 221, 715, 990, 1130, 1060, 787, 685, 740, 820, 503, -69, -336, -401, -256, -89, -77, -167, -317, -140, 320, 617, 545, 264, 188, 333, 451, 583, 581, 347, 218, 190, 331, 456, 241, -4, -323, -436, -237, -121, -110, -146, -111, 39, 337, 585, 641, 494, 214, 141, 107, -14, -133, -376, -608, -658, -607, -437, -307, -344, -357, -320, -170, 39, 154, 129, 51, 140, 257, 384, 447, 344, 307, 196, 63, 56, -77, -234, -380, -524, -466, -438, -471, -411, -397, -350, -203, -51, 67, 116, 166, 293, 473, 641, 780, 918, 1004, 1095, 1260, 1374, 1488, 1599, 1679, 1734, 1626, 1435, 1288, 1017, 565, 16, -697, -1605, -2638, -3402, -3643, -3833, -4197, -4474, -4407, -3848, -3020, -2121, -1379, -984, -557, 180, 1015, 1525, 1571, 1499, 1385, 1207, 1121, 1034, 738, 204, -354, -573, -541, -588, -673, -790, -868, -707, -338, 110, 457, 617, 781, 988, 1192, 1471, 1661, 1665, 1468, 1198, 1131, 1064, 935, 730, 383, 156, -70, -120, -29, -201, -350, -506, -593, -490, -554, -531, -567, -741, -694, -543, -316, -213, -188, -107, -71, 113, 301, 454, 541, 438, 456, 571, 647, 744, 761, 690, 598, 526, 530, 581, 476, 277, 164, 56, 1, -9, -23, -44, -154, -228, -196, -179, -159, -146, -173, -159, -70, 37, 164, 240, 231, 237, 201, 109, 93, -1, -154, -304, -476, -503, -501, -500, -437, -421, -298, -154, -40, 139, 210, 228, 246, 256, 344, 358, 331, 331, 341, 414, 431, 488, 601, 628, 684, 777, 865, 952, 957, 1005, 1065, 1045, 1012, 955, 950, 900, 761, 657, 463, 200, -136, -587, -1171, -1795, -2482, -3239, -3579, -3796, -4067, -4063, -4068, -3494, -2655, -2152, -1359, -833, -293, 376, 635, 1140, 1225, 1057, 1118, 905, 947, 878, 707, 703, 368, 231, 223, 190, 293, 211, 187, 183, 146, 298, 401, 483, 507, 471, 604, 693, 825, 957, 918, 865, 665, 595, 645, 503, 427, 240, 47, 9, -84, -43, -51, -176, -271, -426, -467, -464, -516, -561, -664, -670, -597, -496, -287, -147, -47, 39, 86, 230, 416, 561, 603, 551, 564, 583, 654, 758, 721, 631, 494, 333, 330, 318, 263, 176, 13, -6, 14, 97, 310, 388, 490, 655, 847, 1152, 1331, 1434, 1518, 1498, 1465, 1427, 1405, 1335, 1132, 890, 648, 414, 143, -208, -663, -1312, -2059, -2882, -3456, -3673, -4047, -4295, -4395, -4184, -3319, -2749, -2156, -1481, -1138, -403, 87, 548, 1017, 817, 880, 860, 788, 922, 650, 577, 404, 164, 198, 113, 268, 367, 357, 468, 446, 600, 765, 890, 1000, 873, 894, 940, 997, 1207, 1140, 1084, 971, 721, 783, 740, 613, 476, 139, -16, -114, -179, -180, -314, -423, -561, -633, -585, -570, -563, -645, -670, -597, -493, -297, -180, -87, 41, 116, 280, 444, 574, 635, 587, 577, 583, 648, 721, 687, 618, 498, 366, 357, 358, 313, 253, 137, 81, 93, 86, 136, 111, 56, 37, 11, 54, 89, 50, -14, -86, -163, -164, -156, -174, -166, -166, -153, -56, 84, 250, 431, 580, 704, 904, 1050, 1195, 1309, 1354, 1482, 1471, 1422, 1321, 1090, 955, 665, 277, -171, -920, -1688, -2548, -3264, -3476, -3810, -4118, -4261, -4287, -3560, -2852, -2315, -1682, -1437, -835, -243, 246, 821, 827, 880, 807, 675, 818, 621, 526, 311, -21, -24, -136, -26, 154, 137, 304, 300, 430, 757, 865, 1108, 1118, 1028, 1170, 1181, 1361, 1352, 1074, 931, 684, 597, 544, 280, 81, -228, -487, -543, -604, -605, -708, -843, -837, -788, -624, -498, -430, -318, -261, -104, 133, 290, 424, 448, 460, 545, 587, 701, 767, 721, 701, 584, 561, 593, 561, 573, 420, 241, 161, 71, 87, 71, -66, -39, -109, -53, 63, 6, 111, 91, 39, 126, 96, 153, 103, 20, 10, -89, -153, -258, -326, -391, -431, -446, -457, -468, -500, -420, -351, -296, -214, -206, -93, 70, 143, 384, 488, 627, 898, 978, 1180, 1309, 1304, 1448, 1385, 1379, 1478, 1332, 1292, 1104, 897, 940, 723, 601, 413, -11, -120, -491, -824, -1071, -1754, -2352, -2992, -3596, -3581, -3767, -4007, -3943, -3963, -3174, -2456, -1876, -1075, -891, -273, 293, 645, 1302, 1058, 1005, 941, 617, 773, 468, 253, 131, -314, -311, -318, -273, -4, -20, 91, 167, 248, 631, 773, 874, 934, 911, 1054, 1148, 1242, 1381, 1332, 1075, 990, 918, 873, 838, 470, 250, -54, -324, -277, -468, -643, -922, -1170, -1037, -985, -837, -685, -734, -521, -386, -161, 119, 177, 304, 350, 317, 467, 633, 758, 747, 597, 550, 553, 617, 644, 570, 484, 330, 217, 217, 216, 123, 34, -39, -73, 37, 34, 80, 111, 27, 113, 173, 146, 206, 123, 19, -83, -141, -198, -238, -317, -436, -508, -648, -688, -635, -640, -614, -560, -527, -417, -260, -121, 61, 130, 223, 378, 431, 557, 638, 643, 867, 894, 954, 1072, 944, 1112, 1235, 1252, 1429, 1322, 1321, 1467, 1375, 1469, 1434, 1289, 1208, 1070, 1034, 938, 754, 587, 268, 49, -169, -376, -570, -938, -1238, -1532, -1617, -1845, -2175, -2642, -3347, -4091, -4761, -4778, -3967, -4141, -4210, -3966, -3403, -1755, -1224, 20, 533, 240, 1017, 1261, 2266, 2262, 1344, 1384, 653, 704, 621, 134, 17, -821, -884, -541, -430, -50, -43, 206, 550, 910, 1694, 2026, 2045, 2056, 2088, 2165, 2335, 2203, 1804, 1347, 501, 368, 196, -420, -464, -1185, -1359, -1232, -1484, -887, -1162, -1225, -855, -858, -203, -113, -81, 197, -37, 397, 660, 663, 674, 291, 290, 363, 400, 645, 554, 451, 400, 628, 1127, 1224, 1441, 1609, 1749, 2065, 2198, 2496, 2448, 2136, 2035, 2025, 1884, 1738, 1271, 932, 540, 251, 54, -228, -500, -758, -1030, -1065, -1071, -1077, -905, -957, -928, -823, -908, -624, -695, -770, -743, -927, -914, -884, -1092, -1042, -1030, -813, -777, -800, -743, -530, -146, -109, 107, 273, 490, 695, 644, 827, 951, 900, 915, 773, 743, 570, 300, 30, -290, -584, -931, -1244, -1669, -2006, -2498, -3087, -3336, -3667, -4036, -4435, -4864, -4915, -4902, -4854, -4101, -2706, -1524, -643, -348, 645, 1455, 1818, 1871, 1419, 1194, 456, 510, 487, 7, -357, -447, -6, 426, 568, 1025, 1048, 971, 1512, 2122, 2523, 2295, 2255, 2513, 2739, 2747, 2612, 2285, 1617, 1435, 1418, 1222, 564, 53, -261, -100, -220, -30, 104, -147, -61, 403, 1054, 1148, 881, 1241, 1514, 1678, 1846, 1846, 1849, 918, 918, 1357, 855, 197, -364, 283, 536, 83, 17, 188, 336, 388, 414, 774, 454, 160, 114, 417, 323, -14, -16, 9, 0, -330, -370, -547, -895, -1054, -885, -1052, -1551, -1738, -1521, -1605, -1706, -1824, -1768, -1714, -1734, -1764, -1816, -2052, -1888, -1592, -1542, -1282, -1252, -944, -280, 383, 644, 567, 870, 1132, 1469, 917, 1021, 955, 968, 1114, 934, 1115, 1028, 942, 1172, 1137, 1198, 1225, 1022, 1017, 878, 948, 948, 197, -234, -507, -643, -1178, -1875, -2568, -3096, -3767, -3924, -4134, -4654, -4552, -4577, -4018, -4010, -3043, -1932, -1281, -567, 488, 1208, 1557, 1315, 1495, 1755, 1505, 1167, 763, 637, 661, 1024, 893, 858, 1048, 1161, 1571, 1574, 1754, 1805, 1658, 1968, 2305, 2569, 2265, 2008, 2233, 2149, 2142, 1762, 1217, 1100, 590, 658, 468, -4, -214, -360, -136, 70, 173, 167, 3, 303, 693, 1054, 773, 627, 700, 708, 580, 476, 77, 37, -250, 16, -331, -481, -663, -578, -401, -378, -53, -83, -30, 197, 494, 526, 514, 411, 398, 453, 436, 376, -187, -448, -266, -173, -273, -554, -644, -625, -431, -248, -264, -313, -253, -47, 213, 150, 114, -34, 74, 113, 11, -179, -401, -610, -471, -597, -604, -905, -935, -777, -634, -660, -607, -573, -350, -256, -133, -161, -244, -150, -354, -346, -360, -450, -530, -643, -490, -624, -597, -590, -430, -477, -358, -281, -236, -214, -221, -211, -237, -80, -96, -70, -150, -70, -43, -97, -50, 21, -81, -198, 0, 256, 358, 1, -89, 244, 431, 388, 226, 34, -6, -149, -177, -194, -466, -493, -466, -367, -324, -564, -533, -288, -136, -109, -214, -361, -181, -111, 129, 57, -287, -343, -56, 456, 183, -210, -124, 106, 310, 368, 113, -119, -1, 130, 378, 230, -139, -120, 270, 506, 218, -131, -49, 246, 370, 451, 251, 243, 260, 464, 723, 423, 210, 218, 398, 303, 146, 59, 79, 156, 177, 3, -120, -57, 17, 87, 43, -39, -126, -39, 153, 266, 160, -40, -39, -44, 77, -104, -150, -227, -298, -253, -169, -270, -374, -383, -201, -83, -93, -133, 9, 93, 261, 221, 208, 170, 278, 418, 366, 380, 348, 350, 444, 523, 500, 307, 37, 154, 230, 130, 126, 126, 226, 221, 253, 287, 260, 186, 161, 211, 170, 170, 109, 96, 134, 197, 149, 96, 41, 20, -94, -51, -107, -207, -341, -291, -164, -139, -127, -9, -3, -44, 49, 119, 50, -41, -103, 7, -10, -101, -97, -53, 77, 101, 41, -54, -33, -4, -69, -81, -36, -26, 24, 84, 131, 66, -47, -36, 64, 24, -114, -83, -93, -169, -181, -151, -39, -91, -56, -127, -117, -210, -139, 20, 53, 16, -176, -231, -197, -120, -159, -248, -271, -224, -110, -54, -17, -46, -10, 37, 119, 86, 26, 89, 154, 170, 70, 16, 9, -6, -41, -157, -260, -218, -213, -127, -107, -157, -169, -163, -60, -37, -41, -120, -153, -76, -43, -33, -109, -157, -64, 86, 73, -36, -64, -80, -16, -84, -126, -170, -101, 7, 74, 116, 133, 151, 147, 163, 187, 87, -30, -50, 13, -10, -120, -147, -123, -130, -126, -126, -80, -106, -130, -90, -30, 33, 11, -44, -121, -117, -34, -16, -34, -50, -59, -3, 69, 101, 117, 66, 16, 17, -29, 13, -27, -26, -34, -43, 1, -37, -1, -19, -20, -10, -43, -16, -60, -29, -40, -27, 14, -3, -9, -43, -14, -6, -26, -21, -9, 61, 89, 74, 114, 84, 80, 90, 86, 99, 74, 97, 109, 116, 84, 83, 86, 66, 31, 21, 36, 37, 29, 67, 79, 117, 116, 114, 136, 116, 117, 91, 101, 94, 67, 93, 127, 157, 136, 130, 114, 124, 104, 74, 27, 3, 0, 13, 39, 76, 99, 94, 101, 121, 167, 183, 174, 190, 181, 173, 187, 169, 136, 107, 87, 74, 49, 39, 44, 14, 6, 13, 10, 9, 10, 39, 43, 56, 61, 79, 113, 100, 113, 91, 66, 44, 36, 39, -1, -59, -97, -90, -66, -73, -116, -149, -144, -124, -94, -103, -109, -84, -79, -70, -64, -64, -84, -94, -94, -123, -167, -188, -179, -171, -167, -180, -151, -156, -146, -111, -90, -76, -63, -60, -40, -11, 4, 1, -14, -26, -16, -4, -23, -41, -74, -83, -66, -80, -71, -79, -61, -60, -46, -14, 4, 0, 3, 21, 39, 33, 7, 13, 0, -26, -69, -74, -81, -93, -116, -104, -100, -94, -79, -57, -59, -54, -39, -30, -47, -50, -57, -57, -94, -114, -130, -127, -111, -103, -103, -99, -93, -57, -61, -51, -33, -21, -6, 1, 21, 39, 29, 41, 37, 27, 50, 39, 34, 13, 4, 3, 1, -4, -36, -51, -53, -63, -70, -80, -86, -59, -49, -40, -44, -49, -27, -21, -27, -46, -73, -87, -79, -66, -69, -63, -34, -14, 31, 59, 91, 113, 114, 140, 141, 144, 126, 114, 114, 111, 117, 130, 127, 130, 139, 147, 151, 133, 133, 121, 113, 106, 91, 74, 66, 50, 56, 44, 31, 31, 31, 23, 23, 17, 14, 7, 7, 1, -9, -9, -9, 0, 1, 6, 13, 30, 37, 47, 59, 61, 64, 79, 59, 51, 47, 39, 51, 44, 63, 61, 83, 96, 111, 110, 111, 107, 109, 91, 80, 67, 41, 29, 16, 9, -3, -16, -31, -37, -37, -31, -41, -50, -34, -27, -6, -7, -6, -11, -27, -39, -63, -69, -89, -97, -104, -111, -101, -97, -100, -81, -74, -56, -54, -50, -43, -37, -37, -37, -37, -29, -21, -13, -7, 0, -6, 9, 3, -6, -10, -20, -24, -53, -43, -54, -61, -56, -41, -31, -29, -19, -9, -14, -10, -23, -31, -41, -39, -43, -51, -54, -64, -50, -46, -41, -33, -30, -23, -13, 0, 6, 1, 6, 7, 3, 7, 14, 6, 9, 10, 16, 4, -4, -11, -33, -43, -56, -64, -60, -71, -67, -67, -76, -69, -70, -64, -76, -71, -67, -71, -71, -84, -79, -83, -74, -64, -66, -56, -37, -20, -6, -4, 4, 10, 17, 20, 9, -10, -14, -24, -23, -26, -33, -31, -23, -13, 10, 20, 31, 31, 36, 36, 26, 19, 9, 7, -1, 0, 7, -3, 0, 1, -3, -6, -7, -21, -23, -37, -34, -46, -51, -56, -59, -50, -41, -37, -40, -44, -31, -30, -29, -30, -47, -64, -74, -67, -70, -76, -77, -74, -60, -56, -41, -39, -26, -23, -10, -14, -7, -16, -26, -30, -34, -34, -49, -49, -59, -63, -63, -69, -74, -67, -74, -73, -79, -71, -79, -84, -81, -91, -84, -93, -91, -99, -100, -103, -103, -101, -101, -106, -109, -103, -100, -91, -89, -89, -81, -76, -71, -76, -73, -70, -63, -60, -49, -43, -50, -44, -43, -46, -37, -47, -49, -60, -74, -69, -77, -94, -99, -97, -90, -89, -87, -80, -71, -71, -74, -81, -90, -94, -96, -101, -100, -104, -87, -84, -76, -70, -67, -60, -53, -41, -39, -37, -37, -40, -44, -43, -44, -41, -43, -34, -29, -23, -16, -6, -1, 7, 7, 6, 21, 16, 19, 24, 21, 24, 20, 23, 11, 7, 4, -1, -1, -3, -4, 1, 1, 4, 6, 3, 9, 7, 9, 7, 6, 7, 6, 1, -1, 0, 7, 6, 3, 9, 14, 17, 27, 26, 24, 26, 30, 27, 17, 13, 3, 6, 13, 10, 14, 10, 10, 14, 19, 20, 23, 23, 23, 21, 23, 23, 13, 11, 19, 17, 27, 23, 30, 30, 29, 31, 33, 30, 26, 31, 30, 34, 33, 30, 26, 30, 24, 31, 34, 34, 37, 40, 43, 47, 40, 44, 41, 47, 40, 40, 49, 40, 43, 50, 56, 61, 66, 79, 76, 90, 97, 99, 96, 94, 96, 99, 86, 80, 83, 77, 74, 76, 76, 67, 79, 73, 80, 84, 79, 86, 80, 89, 91, 71, 79, 71, 69, 70, 69, 67, 76, 71, 71, 77, 80, 76, 76, 81, 80, 83, 77, 77, 81, 79, 70, 73, 69, 74, 57, 4, 11, 7, 3, 3, 3, 0, 0, -4, 0, -3, 0, 0, 0, 0, -1, -1, -3, -3, -1, 0, 0, -1, -1, 3, 1, -2, 0, -1, -1, 3, -1, 4, 0, 0, 1, -3, 0, 1, 0, -1, 0, -2, -2, 0, 2, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 2, 1, 0, 1, -1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t calibration_pcm[calibration_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -4, -4, -5, -5, -6, -7, -6, -6, -7, -7, -6, -7, -7, -7, -7, -8, -9, -9, -8, -9, -9, -9, -10, -10, -10, -9, -11, -11, -11, -10, -11, -12, -11, -10, -11, -11, -8, -7, -8, -6, -6, -4, -4, -1, 0, -2, 1, 4, 5, 2, 5, 6, 6, 5, 9, 13, 7, 5, 7, 16, 20, 18, 27, 29, 22, 29, 40, 50, 43, 40, 43, 51, 49, 49, 53, 50, 61, 59, 71, 71, 63, 73, 76, 86, 74, 71, 74, 71, 81, 73, 63, 57, 59, 66, 54, 73, 60, 53, 54, 51, 83, 77, 80, 66, 66, 73, 63, 64, 73, 70, 69, 63, 83, 70, 63, 66, 77, 54, 34, 54, 43, 64, 26, 33, 23, 4, 21, 13, -1, 11, -27, 21, -40, -3, -9, 31, 51, -24, 9, -29, 31, 26, -27, 9, 20, -16, -57, -1, 67, 21, 13, -3, -33, 16, -19, 81, 44, 36, -14, -20, 31, 70, -71, -60, -93, 73, -49, -76, -107, 21, 103, 89, 160, -60, -87, -140, 16, 67, 114, 131, 69, 77, -74, 184, 64, 94, -64, -1, 116, 27, 3, 37, 73, 154, -26, 13, -20, 49, -13, -159, 16, 96, 87, -79, -91, 84, 94, 11, -6, -103, 59, 113, 171, 208, 17, 157, -107, 156, 39, -69, -74, -146, 131, -9, 30, 208, 133, 310, -33, -20, -14, -47, 281, -19, 257, -34, 70, 370, 774, 1478, 553, -431, -206, 617, 621, -147, -87, -208, 216, 37, 628, 356, -111, -206, 635, 217, 563, 670, 1168, 1078, 318, 17, 371, 1138, 127, -597, -1451, -126, 287, 124, -778, 90, 363, 815, 463, -9, 895, 605, 1758, 1194, 965, 301, 1428, 2448, 1214, 486, -643, 133, 47, -313, -1218, -765, -79, 81, -663, -388, -444, 171, 436, 179, -19, -183, 374, 346, 54, -19, -76, 87, 190, 129, -39, 1601, 664, 1042, -1164, 127, -53, -283, -544, -1771, -141, -1151, 554, -972, -111, -967, -204, 720, 254, 506, -80, 861, 808, -161, -877, 661, 113, -306, -1834, -113, -190, -984, -540, -587, 617, -1331, -56, -788, 1154, -526, -147, -545, 321, -224, -473, -424, -267, -654, -1011, -331, -1304, -1140, -977, -610, -1789, -1945, -400, -126, 467, 760, -338, -1369, -1221, 420, -1090, -1528, -1968, -613, -234, -343, -477, 393, 725, 397, 190, 233, -754, -1541, -248, 30, -493, -2001, -818, -200, -1058, -1889, -2295, -1371, -2438, -403, -437, 888, -133, 1581, 823, 1858, 1164, 303, -460, -603, -635, -974, -948, -684, -1074, -1100, -1254, -1265, -1085, -558, -1017, -301, 66, 478, 781, 264, 825, 794, 1080, -240, -740, -129, -817, -1419, -998, -1097, -537, -1906, -426, -1260, -241, -641, -734, -17, -980, 337, -133, -167, -187, -149, 304, -408, -40, -633, -753, -316, -877, -201, -1484, -273, -523, -727, -401, -1315, -94, -497, -1092, -151, -758, -154, -683, 1005, -204, -765, 167, -483, 400, -1392, -256, -34, -506, 444, -661, 434, -310, -268, 1010, 367, -131, 207, 313, 388, -985, 818, 191, 149, 565, 433, 890, 543, 1172, 620, 300, 871, -527, 1197, -874, 407, 170, -456, 514, -1751, 164, -240, 356, 331, 161, 1220, 1478, 1279, 1896, 607, 1265, 59, 1612, -373, -237, 30, -30, 346, -1345, -393, -407, -795, -421, -1454, -521, -984, -681, -488, -1615, 583, -60, -276, -658, -87, 57, -1010, -693, -1309, -1087, -1649, -1007, -46, -1557, -446, -1121, -907, -763, -2043, -268, -817, -1461, -920, -651, -1445, -1628, -941, -655, -1100, -1816, -947, -336, -643, -885, -1052, -701, -1745, -664, -1134, -1492, -998, -1017, -344, -1442, 657, -910, -631, 91, -724, 36, -1005, 84, 89, 160, 273, 850, -410, 854, 1565, 341, -744, -1211, 625, 493, -341, -80, 857, 1147, 1324, 2399, 1705, 1298, 1854, 2136, 958, 720, 1444, 241, 1645, 190, 2499, 2072, 370, 594, 2272, 2426, 735, 1795, 743, 1217, 1889, 443, 1467, 644, 1207, 2332, 179, 407, 1398, 1398, 1991, 694, 1759, 1561, 947, 1962, 1002, 217, 1252, 2169, 1254, -257, 633, 2540, 2163, 1634, 883, 114, 1886, 2092, 1302, 508, 565, 1879, 2223, 417, 3, 1045, 1605, 894, 807, 723, 1128, 1684, 1461, 2123, -163, 915, 1468, 868, 1962, -1061, -628, 693, 1064, 1969, -191, 820, 3363, 1117, 540, 527, 804, 1449, 1025, -597, 47, -820, 1728, 2842, -691, 353, 1185, 2648, 247, -293, 2606, 1557, 134, 1441, 343, -1465, -1164, 2162, 1267, -1901, -982, 3013, 1641, -942, -830, 928, 503, 1434, -1124, -446, 506, 1349, 1854, -2296, 568, 1414, -258, 134, -697, 1134, 551, 793, 905, -71, -490, 1052, 1299, -1575, -2121, 13, 3079, -417, -1237, -376, 1007, 2233, 543, -753, -177, -595, 46, 126, -1182, -327, -893, 614, 787, -978, -274, 931, 510, 683, 1105, 91, -964, -71, 40, -594, -1357, -1824, -615, -293, 1538, 1482, -890, -266, 29, 1302, -400, -1001, -1993, -655, 878, -188, -250, 574, 2478, -361, -1849, -1220, -595, -341, -1238, -1041, -1240, -1027, 952, -167, -1377, -514, 1344, 401, -1074, -1374, -113, 63, -2208, -410, 351, -364, -1511, -109, 740, 615, -1472, -517, 1214, 137, -376, -1479, -2045, 374, 307, -440, 64, -1975, 1639, -1339, -571, -947, -2253, 1674, 1121, 1088, -1305, -1309, 1755, -174, -3786, -1774, -117, -19, -1294, -461, 1117, 1504, 2480, 119, 888, 1656, -994, -440, -1535, -494, -1010, -2822, 233, -260, 808, -4, 674, 4308, -1671, -2535, 2289, 795, 1372, -2910, -2339, -858, -1871, 2766, 236, -1646, -2006, 247, -107, -2072, 1375, 3202, -2171, -2732, -2913, -87, -156, -1192, -860, -1552, 1254, -311, -390, -240, 267, 570, -1107, -26, 1521, -126, -1681, 90, 3133, 84, -3948, -2069, -49, 2446, 4708, -2158, -1462, 1651, 1956, 2433, -2746, -3763, 974, -780, -1724, 3551, 1105, -801, 220, 1849, 361, -2031, -1719, 143, 3096, -565, -1862, -1040, 464, 2995, 1361, -2566, -1672, 1115, 2575, 374, -1644, 1805, 703, -348, -1542, -1297, -228, 17, 1894, 2793, -2206, -21, 2772, 3711, 2098, -3521, -1455, -997, 1245, 2086, -3440, -3507, 256, 2935, 1965, -1187, -34, 3729, 104, -406, 1288, 4, -3432, -4530, 655, 2119, -87, -3314, 94, 1415, 3249, 2652, 1708, -1015, -2705, 270, 1712, 1157, -2439, -2008, 618, 1397, 875, -1634, 7, 1312, -119, -254, -925, 711, 87, -1531, 1117, 2873, 717, -2315, -6516, -1634, -19, 1996, 2796, -670, -2688, -2173, 4136, 4200, -1227, -3986, -1407, -575, 2231, 1564, -1277, -2973, -1461, 1155, 1359, 423, -3050, -710, 1929, 847, -711, -1462, -130, 1442, -2325, -431, 5695, 493, -1428, -473, 1315, -618, -3494, -1829, 1352, 2909, -117, -948, 1305, -2910, -2305, 1399, -1477, -1665, -1559, -2787, 434, 1260, 444, 727, 244, -13, -548, -2389, -3063, -735, 1397, 2079, -2693, -3504, -938, 1485, 1996, -3246, -857, 3039, 3443, 1160, -2639, -703, 2756, 433, -2636, -4143, -1278, -508, -308, 1632, 555, 3737, 3242, -338, -1669, -4584, -2308, 133, -584, 218, -140, -1599, -403, -1599, 281, -760, -2293, -114, -694, 1427, 1532, -1015, -1431, 861, 2799, 1588, -4912, -2399, 2193, 6132, 2946, -2372, 2078, 5668, 1968, 1674, 2688, 111, 104, 1115, 4113, 3033, -121, -1324, 805, 3747, 2949, 1062, -1302, -3640, -1505, 793, 3406, 1197, -7788, -8424, -2201, 1675, -13, -3813, -4384, -4667, -2452, 250, 2032, 2298, -7243, -8158, -1117, 2618, 1531, -1080, -364, 2739, 3557, 4574, 5315, 4601, 3150, 1672, 3650, 4364, 2258, 1224, 4074, 4548, 4624, 6399, 4912, 4514, 1355, 625, 3169, 3546, -147, -5886, -4220, -79, 1432, 56, -4481, -9789, -13005, -9836, -5916, -9343, -7731, -4521, -5705, -6516, -4185, 3314, 5429, 3514, -680, -1297, -336, -884, 3436, 3974, 2039, 3697, 5803, 8361, 9816, 8507, 6209, 6632, 6380, 6060, 7219, 6188, 3370, -227, 570, 4410, 2568, 2546, 1578, 417, -834, -5208, -6430, -6483, -8936, -10606, -10423, -13078, -15919, -12616, -5272, 4101, 4821, 1007, 2056, -1387, -3798, -4400, -2660, 1467, 1421, 2329, 2313, 6192, 11064, 8522, 4810, 3908, 6285, 8395, 5979, 5462, 6496, 5496, 5988, 5762, 4681, 1656, 1167, 1418, 795, 1225, -1087, -1461, -2812, -4851, -7369, -10734, -12008, -12575, -19084, -19142, -4692, 6512, 1799, -4568, -2228, -24, 386, -2375, -1534, -2530, -3107, 3050, 6239, 5081, 3086, 6000, 6216, 5007, 6989, 7050, 7747, 6320, 6870, 9114, 4680, 2629, 4624, 3586, 2329, 177, -630, -343, 560, -110, -1708, -2078, -7811, -11333, -16983, -23624, -19464, -8757, -1447, 5895, 8265, 427, -3754, -2493, -2072, -4098, -2875, -708, -992, 2362, 4837, 8762, 8018, 948, 2598, 6632, 6663, 8284, 6653, 7775, 7478, 5869, 6166, 4078, -1394, -2926, 378, 2466, 2936, -758, -1318, 120, -3197, -6492, -14117, -15634, -17153, -23018, -12589, 5792, 11932, 8942, -97, -5656, -6876, -4548, -2626, -1938, -2348, -1432, 6180, 10869, 9555, 4418, 1262, 4263, 4104, 3494, 5569, 7067, 7818, 7844, 5585, 3993, 584, -2013, -3193, 703, 2025, -577, -854, -3793, -2723, -2927, -10354, -16082, -23491, -25003, -7450, 12001, 14810, 7754, 213, -4270, -6759, -7074, -4657, -287, -1918, 2525, 9468, 9893, 9662, 6704, 4235, -1134, 69, 5024, 5565, 6627, 9181, 10432, 6225, 2598, -980, -3544, -2101, 907, 2759, 2518, 2322, -613, -6607, -10215, -12765, -18576, -25821, -19382, 7296, 19869, 11945, 1120, -4575, -4995, -6946, -5478, -2770, -1452, -2092, 3039, 10409, 13295, 8964, -390, -703, 1092, 3867, 9112, 9743, 6290, 5742, 3330, -1766, 1878, 1211, -3540, 1387, 7680, 7981, 2822, -2456, -8707, -16328, -20035, -24072, -26414, -9499, 15197, 22578, 12321, -638, -5663, -6126, -8558, -6593, -5554, -6570, -911, 10302, 20025, 17872, 8909, -3019, -9335, -3179, 5818, 13569, 13348, 6350, 5051, 5249, -531, -4894, -3980, -1711, 828, 5254, 10077, 5936, -6850, -14820, -17616, -19157, -21950, -20700, -1389, 18441, 17102, 8162, 1732, -4060, -8944, -8382, -6556, -2836, -407, 1949, 7406, 12761, 14768, 10157, -1409, -8939, -1507, 7791, 9525, 7466, 7032, 6560, 568, -2776, -1632, 1181, 1718, 555, 2533, 2593, 436, -6409, -15075, -18578, -28349, -26368, 1082, 17852, 18705, 12148, 3030, -1781, -9668, -9662, -7793, -10407, -7006, -327, 10216, 19682, 19060, 12109, -2133, -10043, -2618, 8101, 10259, 8238, 6195, 2445, 908, 1764, 2509, 3436, 3481, -831, -4867, -4611, -4650, -9745, -18731, -26361, -20262, 5538, 18434, 12554, 9635, 2121, -7610, -13825, -11453, -5522, -7511, -6236, 4357, 11955, 17589, 17719, 7488, -638, -4687, -1751, 5662, 7953, 7159, 6306, 5112, 5525, 5972, 5923, 593, -4494, -3383, -4610, -6590, -8402, -13766, -24173, -22641, 754, 15254, 16024, 9366, -1282, -7967, -12327, -7430, -4575, -10075, -10819, 527, 14300, 17352, 15010, 10192, 1656, -4387, -4097, 6852, 10550, 6475, 9479, 6278, 3416, 4705, 1051, -685, -388, -621, -4210, -10155, -12911, -17138, -25666, -14890, 11378, 18864, 16719, 6209, -6427, -9249, -11590, -8467, -6982, -9726, -5585, 3087, 12559, 18033, 16355, 7104, -4243, -7878, -1675, 7891, 10182, 7915, 6238, 4164, 1958, 1147, 3726, 3754, -4959, -9869, -7093, -8370, -15213, -22345, -17693, 3630, 16803, 18250, 11287, 181, -4554, -12491, -13121, -6380, -5564, -6462, -1508, 10844, 19448, 16825, 8195, 34, -8107, -8162, 3157, 13036, 13979, 6135, -2259, -3167, 1461, 2959, 3551, 1255, -5866, -10136, -11467, -11655, -17736, -19477, -3494, 15181, 17550, 10285, 6098, -257, -8804, -9116, -7611, -7883, -5058, -2568, 1529, 11383, 20131, 16184, 911, -7681, -1805, 5041, 4694, 5151, 7584, 4644, -447, -67, 3254, -595, -6490, -7814, -8519, -8795, -13181, -22602, -14440, 7023, 16298, 14823, 11343, 5228, -8364, -13683, -2016, -690, -7690, -7051, -3067, 2103, 9732, 19492, 16492, 3473, -3383, -1467, 2426, 3106, 6563, 6439, 2793, 2590, 1208, 1034, -1215, -7210, -11907, -15604, -14668, -17240, -16683, 3963, 19478, 14146, 8871, 7443, -1724, -10837, -9842, -7337, -5609, -5711, -2096, 4285, 10412, 17557, 13475, 5941, 630, -4972, -2729, 2959, 8939, 10172, 2193, -474, 5706, 4641, -3433, -5779, -12591, -20916, -18940, -17633, -9089, 8211, 14886, 12702, 8628, 5292, 988, -6208, -9089, -9243, -10419, -6099, 11, 5886, 11861, 13752, 10449, 4651, 104, -1852, 724, 961, 4393, 9041, 2428, 1846, 5596, 2673, -914, -6794, -14450, -18166, -18303, -18824, -10259, 7009, 14369, 12712, 6583, 5406, 6969, -2106, -5177, -9141, -14917, -9993, -3669, 7581, 15998, 16892, 11070, 711, -2639, -2071, 341, 3893, 6356, 4929, 2857, 4540, 4661, 4136, -107, -11237, -18237, -16905, -17619, -16752, -3342, 7286, 10730, 8969, 4682, 7501, 4747, 104, -2253, -8856, -11800, -11980, -4939, 5207, 11243, 15091, 12298, 8628, 3560, -2780, 1766, 4848, 1626, 1434, 3189, 2716, -206, 991, 1671, -8282, -16628, -20076, -22615, -11537, 2450, 8829, 12412, 9005, 7110, 4264, 2767, 1274, -7127, -11741, -14449, -10771, 981, 9114, 16719, 14716, 8420, 7517, 755, 134, 4463, 2385, 370, -1919, 3293, 6847, 3373, 2099, -3233, -11994, -21147, -26911, -17376, -1989, 8225, 11623, 9192, 7664, 5742, 4510, 2897, -2465, -7853, -15318, -15271, -4551, 4697, 11273, 15412, 12584, 8115, 2380, 2865, 7768, 3684, 870, -129, -905, 1996, 1377, 1467, -2793, -11291, -18521, -25997, -19455, -3741, 6949, 13992, 12866, 9435, 4645, 2319, 4010, -3083, -9598, -12441, -13122, -6555, 1105, 9950, 15838, 13924, 9652, 3740, 3679, 5434, 3461, 3053, 361, -250, 907, -1138, -707, -4090, -10699, -18473, -24897, -18134, -4842, 6563, 14159, 11792, 8982, 5529, 4185, 5042, 741, -4787, -12254, -15625, -9356, -2198, 8162, 14386, 13779, 12201, 6235, 4116, 4137, 2456, 4947, 1015, -661, -1929, -2603, -1571, -7653, -10156, -15999, -23736, -15794, -6125, 5633, 14033, 13896, 11787, 6046, 5821, 4837, -1448, -4093, -13240, -15702, -10149, -2118, 8635, 12498, 13964, 11363, 4390, 4901, 3283, 3477, 4164, 1394, 1048, -2429, -4094, -3314, -7807, -12377, -19262, -19772, -12715, -4373, 7176, 13352, 12357, 10477, 7491, 6686, 3656, -491, -6113, -10849, -11154, -8568, -897, 7534, 10831, 10853, 9426, 7470, 6048, 5346, 5169, 5151, 2460, -981, -3689, -6990, -9355, -11683, -16910, -19311, -16022, -8892, 1182, 9142, 12285, 12388, 11304, 7844, 4361, 1924, -2642, -8073, -9272, -8124, -4964, 1265, 7167, 10911, 11300, 10532, 9937, 6206, 5099, 4760, 3170, 1645, -2148, -5069, -8822, -13448, -16461, -21090, -17782, -10237, -2730, 7147, 11514, 11167, 10013, 8137, 6229, 1085, 69, -3416, -8981, -8014, -6363, -2029, 2835, 7094, 11880, 10839, 10891, 9052, 6689, 6796, 4790, 3154, 83, -5008, -8578, -14273, -17976, -20969, -18733, -11146, -3354, 5969, 10642, 12047, 11283, 8111, 6729, 3267, 458, -2972, -6060, -7847, -8514, -4735, 136, 4808, 10075, 11894, 12584, 9606, 7661, 6847, 3973, 3794, 196, -4323, -8555, -14070, -17812, -21984, -19112, -11518, -4185, 4678, 9957, 12259, 11487, 9126, 9021, 5019, 1676, -1188, -5119, -7153, -9018, -5698, -1874, 2747, 8358, 10137, 11638, 11671, 9615, 8027, 5662, 3419, -574, -5768, -10122, -15597, -19657, -21541, -18920, -11841, -2733, 6573, 11234, 13939, 12569, 9099, 5224, 2849, 1191, -2239, -4003, -5461, -6640, -4680, -1155, 3777, 7424, 8995, 10169, 9272, 7634, 6759, 5899, 3803, -1462, -6260, -13052, -18260, -20759, -20535, -15640, -8428, 991, 8702, 12319, 13783, 11633, 7845, 3422, 560, -637, -2295, -2715, -3264, -3497, -1778, 208, 4090, 6123, 7784, 9069, 7987, 7076, 5088, 2923, -54, -4450, -8225, -14476, -18226, -17779, -16332, -10833, -3777, 3299, 8388, 9950, 10432, 8111, 5882, 4070, 1394, 821, 198, -815, -1282, -1487, -66, 2083, 4525, 6910, 7998, 7390, 5578, 3433, 1072, -2241, -6116, -9096, -12833, -15013, -14244, -12035, -8414, -3200, 1856, 4620, 6672, 7329, 6155, 5745, 4919, 3963, 3279, 1220, 765, 853, -133, 883, 2589, 4437, 5751, 7146, 7066, 4884, 1936, -1626, -5157, -8554, -10282, -11898, -11867, -10153, -8227, -4618, -1702, 1070, 3497, 5105, 5943, 5496, 5571, 5085, 4504, 3584, 1545, 865, -77, 263, 2015, 2755, 5272, 5835, 5596, 4894, 1379, -1284, -5171, -8155, -9635, -11113, -9939, -9301, -7164, -4357, -1941, 1981, 3787, 4841, 5522, 4791, 5107, 4771, 4073, 3750, 1894, 1669, 1669, 1261, 2496, 3807, 4999, 4852, 4245, 2658, -581, -3142, -5638, -8241, -9433, -11148, -10877, -9079, -6774, -3043, 81, 3162, 4557, 5065, 5861, 5028, 4724, 5244, 4241, 2786, 2082, 1362, 884, 1587, 2907, 4464, 5359, 5312, 4253, 1260, -2032, -5141, -8167, -9381, -10632, -10407, -8814, -7036, -4124, -1421, 958, 2895, 4470, 5002, 5111, 5119, 5211, 5139, 4327, 3721, 2735, 1819, 1534, 1915, 2558, 3330, 4021, 3273, 1639, -673, -4404, -6910, -8898, -10760, -10473, -9168, -7381, -4915, -2148, 56, 1449, 3786, 4277, 4744, 5908, 5912, 5366, 5139, 4080, 2548, 2458, 2772, 2786, 3563, 3973, 4004, 3077, 1475, -1557, -4992, -6809, -9231, -10287, -9866, -9375, -7568, -5255, -2242, 27, 2402, 4198, 4550, 4610, 4571, 4507, 4175, 3907, 3771, 2953, 2995, 2796, 2735, 3309, 3824, 4640, 3843, 2311, -307, -3741, -6567, -9014, -10282, -10983, -10093, -7646, -5117, -2041, 320, 2850, 4217, 4758, 5045, 4297, 4218, 3893, 3554, 2693, 2045, 2640, 2662, 3109, 3664, 4557, 5049, 3984, 2296, -670, -3737, -7160, -9086, -10085, -11054, -10126, -7943, -5688, -2689, 284, 3536, 4621, 5414, 5679, 4664, 4360, 4591, 3984, 2916, 3025, 2693, 2419, 2882, 3194, 3790, 4071, 3102, 1232, -1874, -5188, -8043, -9045, -10810, -11316, -9269, -7833, -4083, -1409, 2082, 4767, 5768, 6773, 6403, 6135, 5603, 4168, 3631, 2822, 2208, 2538, 2323, 3119, 3430, 3900, 3240, 1925, -411, -3444, -7194, -9098, -11347, -12915, -11161, -9815, -6605, -1892, 457, 4034, 6250, 6610, 7339, 6717, 6535, 4985, 3327, 2789, 1582, 1925, 2603, 3567, 4505, 5028, 5221, 4121, 1074, -2263, -5356, -8915, -11822, -13836, -13613, -11677, -9372, -3826, -133, 3294, 6352, 7900, 7568, 6583, 6810, 5865, 4047, 3513, 2133, 1421, 2023, 2842, 4792, 4792, 5602, 5009, 2001, -698, -4574, -7965, -10146, -13582, -14891, -11998, -10747, -6032, 891, 3609, 6112, 8150, 7438, 6445, 4764, 5384, 3514, 1644, 3016, 1097, 1958, 4682, 5286, 6308, 6727, 5606, 3606, -344, -4278, -8217, -11430, -14209, -17786, -15380, -11418, -8103, -880, 4624, 6793, 8225, 9096, 7901, 6406, 5985, 4271, 1339, 1661, 1115, 1132, 4130, 5531, 7387, 6914, 6540, 5561, 1524, -1475, -5788, -10363, -12872, -17797, -19678, -14074, -10707, -4133, 3060, 5921, 8195, 8664, 9321, 9099, 6747, 6482, 2470, -820, 803, -350, 2119, 6019, 6459, 7227, 5836, 4772, 3313, 131, -2705, -7381, -12191, -15518, -20755, -18430, -11747, -7541, -551, 4931, 6055, 7247, 9445, 9890, 9678, 8717, 6110, 851, -580, -103, 567, 4170, 6100, 6390, 5004, 3664, 3156, 1542, -595, -4264, -9295, -13270, -17437, -20593, -13896, -9283, -4280, 2338, 4271, 6476, 7883, 9650, 11567, 9306, 7756, 3527, -1122, 137, 50, 2622, 5980, 5124, 6350, 4340, 3770, 4675, 1030, -2036, -6596, -12798, -15550, -20143, -19161, -11050, -8105, -1090, 3998, 5669, 9045, 10486, 11924, 11872, 8091, 5211, -557, -2229, -1088, 24, 3500, 4901, 5656, 5878, 5039, 6749, 5157, 1385, -3056, -9423, -14733, -18004, -21793, -15765, -11167, -7236, 440, 3250, 7356, 10913, 12298, 13782, 10434, 7090, 3393, -1565, -316, 90, 1555, 3851, 3380, 5385, 4949, 4682, 6786, 3204, -654, -5359, -11574, -14333, -17883, -19120, -10909, -9556, -3724, 2116, 3259, 8137, 10040, 10676, 11795, 7117, 5365, 1304, -1351, 627, 1341, 2980, 4221, 3887, 5139, 3928, 5158, 5179, 1369, -2388, -7616, -12198, -14004, -18753, -14510, -8814, -7476, -938, 1322, 4435, 8295, 8962, 10814, 9535, 6086, 4585, 76, 698, 2091, 2822, 4033, 4114, 4851, 4650, 3966, 5585, 2615, -1369, -6149, -11385, -14610, -17657, -20288, -12452, -9512, -5081, 1514, 3800, 8381, 11087, 11067, 12815, 8647, 5586, 2725, -961, 545, 1854, 2066, 4020, 4171, 5314, 5912, 6099, 6347, 1592, -3650, -8659, -14117, -16422, -20997, -19661, -12042, -10650, -3651, 1979, 5655, 10817, 12101, 13283, 13448, 8125, 6535, 1962, 114, 1412, 1602, 2362, 3264, 3460, 4899, 5089, 6283, 3868, -795, -5701, -11224, -14928, -17961, -21910, -14923, -11233, -8360, -744, 2322, 7049, 10590, 11660, 14351, 11231, 8028, 6222, 1504, 2589, 3493, 2852, 3530, 2533, 2709, 3426, 3427, 4228, -100, -3933, -8392, -12952, -14738, -18763, -17692, -10320, -9963, -4068, 400, 3063, 7894, 10027, 12222, 12979, 8818, 7780, 4007, 2266, 3613, 3609, 3380, 3230, 2613, 3299, 4071, 5105, 3082, -917, -5576, -10566, -13679, -16699, -19776, -14157, -10422, -8587, -2350, 400, 4931, 9122, 11191, 13208, 11351, 7978, 6182, 2056, 2363, 3042, 2082, 2483, 1832, 2122, 3818, 4321, 5037, 1357, -2325, -7131, -11671, -13802, -18004, -16926, -9950, -9898, -4722, -688, 1542, 7017, 9608, 12235, 12842, 9396, 7914, 4003, 2059, 3303, 2388, 2163, 2059, 1524, 2386, 3233, 4418, 2346, -1022, -5009, -9562, -12258, -16098, -17857, -12484, -9712, -8043, -2889, -554, 3370, 7714, 10710, 12382, 11445, 9092, 6650, 3673, 3739, 4234, 2730, 2880, 2091, 1387, 2251, 2849, 2866, -179, -3723, -7563, -11370, -14374, -16979, -14377, -9152, -8734, -4855, -1462, -351, 4674, 8150, 10483, 11668, 10086, 8638, 6069, 4498, 5252, 4221, 3621, 3477, 2093, 2043, 2228, 2468, 691, -2253, -5648, -8687, -12132, -15635, -14963, -11170, -9393, -7498, -4071, -1895, 613, 4932, 8341, 10067, 10627, 9576, 7734, 6590, 5594, 5773, 4674, 4031, 3306, 2085, 1835, 1809, 1235, -169, -3152, -5970, -9038, -13159, -14069, -11842, -9485, -7828, -5341, -2813, -1626, 1167, 4537, 7111, 9029, 9108, 8544, 7501, 6195, 5681, 5212, 4548, 3987, 2763, 1966, 1051, 1027, 464, -981, -3399, -5432, -8252, -10909, -10145, -8905, -7527, -5782, -4530, -2719, -1722, 36, 2796, 4645, 6159, 6804, 6447, 6467, 5581, 5475, 5452, 4375, 4148, 3269, 2353, 2081, 1491, 1167, -310, -2201, -3570, -6179, -7256, -7583, -7524, -6209, -5671, -4234, -3000, -2640, -1138, 318, 1801, 3222, 3974, 4692, 4801, 4614, 4505, 4227, 4023, 4150, 3824, 3591, 3639, 3209, 2849, 2249, 1044, -211, -1974, -3130, -4200, -4398, -4371, -4375, -3791, -3661, -3569, -2823, -2653, -1719, -635, -247, 471, 992, 1517, 2252, 2301, 3306, 3830, 3824, 4672, 4618, 4367, 4398, 3466, 2486, 1381, 570, -7, -871, -1214, -1412, -1124, -1338, -2081, -2001, -2342, -2913, -3100, -3630, -3673, -3649, -3184, -2091, -1297, -501, 770, 1101, 1942, 3197, 3584, 4184, 4347, 3646, 3306, 2805, 2148, 1944, 1652, 1592, 1802, 1405, 824, -127, -548, -1054, -1721, -2313, -2832, -3207, -4016, -4308, -3951, -3641, -3093, -2339, -1768, -775, -144, 154, 1571, 2009, 2103, 2857, 2526, 2435, 2570, 2402, 2699, 2659, 2696, 2565, 1938, 1559, 1204, 223, -493, -875, -1492, -2106, -2883, -3199, -3559, -3804, -3610, -3150, -2572, -2536, -1742, -995, -1167, -668, -110, 21, 548, 1001, 1528, 2068, 2282, 2923, 3035, 2890, 2775, 2412, 1992, 1694, 1288, 853, 458, -33, -110, -593, -1200, -1364, -1878, -2482, -3020, -3080, -3240, -3349, -3020, -2952, -2773, -2228, -1659, -651, 134, 1054, 2013, 2269, 2592, 2610, 2465, 2592, 2409, 2281, 2311, 1828, 1778, 1741, 1369, 1449, 1045, 410, -173, -878, -1459, -2122, -2630, -2929, -3376, -3553, -3459, -3030, -2522, -2019, -1195, -643, 101, 741, 1257, 1618, 1839, 1945, 1956, 1946, 1789, 2089, 2203, 2249, 2362, 2128, 1964, 1716, 1204, 801, 223, -561, -907, -1511, -1931, -2179, -2365, -2468, -2433, -2262, -1895, -1497, -1038, -500, -93, 181, 391, 587, 887, 1112, 1321, 1615, 1778, 1954, 2191, 2279, 2205, 2026, 1812, 1285, 884, 378, -66, -527, -781, -964, -1248, -1544, -1786, -1786, -1845, -1642, -1454, -1157, -868, -894, -775, -617, -547, -186, 196, 543, 1175, 1645, 1939, 2131, 2088, 2032, 1954, 1625, 1379, 1120, 694, 451, 130, -161, -347, -564, -788, -895, -1194, -1348, -1371, -1431, -1399, -1332, -1275, -1154, -870, -731, -410, -49, 214, 621, 825, 987, 1181, 1130, 1090, 1125, 1042, 1068, 1170, 1298, 1367, 1264, 1070, 795, 493, 161, -167, -457, -837, -1234, -1501, -1758, -1755, -1632, -1484, -1148, -868, -644, -503, -374, -161, 3, 87, 181, 428, 601, 917, 1288, 1585, 1958, 2195, 2265, 2203, 1926, 1547, 1107, 494, -120, -617, -1021, -1377, -1635, -1769, -1846, -1716, -1582, -1429, -1175, -994, -868, -695, -635, -470, -263, 16, 371, 730, 1194, 1594, 1971, 2205, 2348, 2360, 2156, 1872, 1465, 984, 451, -83, -541, -942, -1242, -1365, -1449, -1408, -1317, -1268, -1255, -1275, -1308, -1245, -1122, -917, -655, -406, -1, 310, 688, 1101, 1465, 1795, 1966, 2008, 1971, 1836, 1502, 1197, 870, 436, 86, -216, -517, -743, -897, -1035, -1144, -1210, -1294, -1459, -1567, -1568, -1517, -1375, -1081, -750, -397, -36, 290, 684, 1028, 1230, 1394, 1407, 1277, 1125, 940, 737, 598, 460, 353, 208, 43, -73, -251, -428, -591, -823, -1088, -1291, -1498, -1649, -1582, -1449, -1235, -995, -725, -387, -71, 226, 467, 641, 720, 615, 526, 411, 304, 268, 267, 324, 330, 310, 268, 218, 174, 64, -67, -237, -476, -670, -760, -811, -797, -701, -640, -541, -394, -228, 11, 213, 261, 311, 201, 57, -17, -60, -34, 14, 60, 64, 70, 89, 151, 303, 347, 350, 274, 196, 117, 46, 110, 101, 103, 41, -53, -110, -179, -194, -137, -24, 44, 29, 3, -103, -100, -80, -51, 1, 17, 16, -11, 6, 7, 130, 203, 261, 308, 261, 240, 223, 206, 250, 233, 130, 56, -86, -127, -63, -70, -49, -94, -163, -221, -264, -250, -254, -218, -258, -318, -318, -338, -313, -230, -119, -20, 14, 23, 71, 101, 164, 228, 256, 304, 403, 443, 444, 440, 431, 466, 417, 337, 351, 238, 106, 10, -107, -166, -207, -300, -320, -276, -177, -149, -64, -10, 109, 149, 109, 106, 83, 59, 141, 119, 181, 216, 181, 204, 247, 258, 264, 338, 248, 196, 54, -90, -179, -246, -293, -301, -241, -227, -186, -127, -90, 4, -31, -114, -150, -160, -218, -274, -248, -231, -176, -201, -170, -166, -188, -137, -139, -110, -127, -213, -281, -418, -501, -514, -478, -430, -303, -190, -90, 56, 14, -41, 14, 30, 9, 24, 37, 81, 134, 201, 121, 136, 39, -167, -248, -284, -328, -334, -353, -416, -337, -218, -224, -240, -256, -153, -114, -81, -40, -19, -13, -70, -24, 4, -16, -4, 91, 79, 99, 174, 224, 301, 211, 131, 49, -124, -306, -426, -555, -541, -567, -658, -504, -410, -348, -201, -104, -33, 7, 17, 99, 291, 473, 744, 855, 728, 578, 468, 391, 293, 200, 190, -100, -283, -397, -574, -703, -854, -897, -795, -625, -514, -510, -378, -237, -197, -84, -123, -56, -51, -154, -33, 107, 179, 204, 267, 437, 570, 638, 577, 443, 434, 420, 338, 260, 66, -27, 69, -87, -87, -94, -187, -307, -427, -561, -670, -777, -873, -911, -831, -630, -497, -286, -63, 167, 414, 855, 1198, 1204, 1288, 1268, 1104, 1161, 1145, 768, 740, 701, 621, 867, 744, 437, 124, -447, -918, -1244, -1724, -2185, -2663, -3137, -3197, -2889, -2412, -1896, -1158, -323, 381, 1151, 1522, 1821, 2036, 2003, 2112, 2059, 2095, 2335, 2453, 2553, 2596, 2516, 2386, 2226, 1794, 1078, 231, -981, -2223, -3099, -3656, -4161, -4645, -5518, -6226, -5915, -5042, -3574, -1906, -90, 1752, 3097, 4147, 4650, 4694, 4580, 4443, 4391, 4575, 4740, 4811, 4838, 4515, 4081, 3604, 2850, 2031, 1098, -56, -1278, -2625, -3746, -5002, -6549, -7955, -8918, -8301, -6733, -4680, -2256, -33, 2492, 4148, 4715, 4560, 4254, 4388, 4877, 5369, 5449, 5702, 5779, 5562, 5315, 4997, 4681, 4291, 3627, 2536, 1591, 210, -1248, -2959, -5087, -6824, -8645, -10317, -11657, -11411, -9222, -6343, -2745, 481, 3437, 5948, 6914, 6766, 6219, 6377, 6926, 6989, 6355, 5205, 4373, 3676, 3346, 3187, 2950, 3260, 3129, 2593, 1798, 161, -2025, -4594, -7300, -9542, -11458, -13398, -13188, -10854, -7835, -3760, -183, 2837, 5459, 6767, 7393, 7696, 7850, 8312, 7870, 6128, 4612, 3553, 2915, 2999, 2845, 2640, 2932, 3042, 2668, 1367, -774, -3067, -5526, -7894, -10006, -12648, -15395, -15125, -12309, -8023, -2252, 1522, 4245, 6999, 8088, 8529, 8779, 8441, 8445, 8322, 6288, 4118, 2690, 1458, 1564, 1864, 1992, 2837, 3083, 2645, 1005, -1705, -3986, -6193, -8231, -10426, -13857, -16551, -15294, -11860, -6323, -496, 1875, 4431, 6416, 6987, 8264, 8575, 8926, 9376, 7598, 4627, 1859, 343, 858, 2141, 2797, 3196, 3463, 2903, 1986, 4, -2763, -4602, -6602, -9443, -12849, -17128, -17333, -13136, -8182, -1762, 1082, 2139, 4775, 5721, 7830, 9699, 10053, 10770, 8542, 4164, 745, -1037, 100, 2780, 3683, 3347, 2709, 1359, 1164, 945, -306, -1581, -4357, -8812, -13200, -18043, -19217, -13585, -7857, -1784, 1615, 550, 2418, 4548, 7630, 11941, 12869, 12119, 8875, 2589, -1815, -2205, 9, 3583, 4378, 2380, 1008, 19, 1182, 3277, 3209, 1558, -2308, -8291, -13288, -16426, -17303, -13226, -7931, -4275, -1559, -1595, -301, 3833, 8131, 12080, 13043, 11206, 7556, 2676, -394, -684, 873, 2829, 3212, 1421, 44, 1041, 3065, 4874, 4565, 803, -4303, -9351, -13303, -16018, -17233, -14127, -9363, -5578, -2827, -2600, -751, 4140, 9352, 13535, 14127, 11171, 6575, 2435, 144, 153, 2039, 3479, 3350, 1678, -271, 258, 2980, 5586, 5449, 1167, -4919, -10379, -13460, -15600, -16642, -12639, -7880, -5142, -3434, -3614, -348, 6620, 12936, 16511, 14029, 8111, 3741, 1696, 1461, 2572, 2678, 1028, -380, -1771, -1565, 2126, 5471, 6276, 3926, -1972, -6937, -9739, -11334, -13575, -15437, -12362, -8695, -5295, -1969, -1625, 2242, 9393, 13954, 15227, 11570, 6326, 4210, 3360, 2450, 1822, 314, -878, -888, -1190, 136, 3100, 4915, 5595, 2846, -2532, -5696, -8567, -11475, -14327, -17079, -14043, -8537, -4540, -1455, -890, 2516, 9541, 14410, 15768, 12561, 7493, 4800, 3680, 2823, 2071, 681, -448, -467, -557, 621, 3456, 5152, 4834, 1861, -2568, -6225, -9501, -11670, -15728, -18853, -13288, -7560, -4180, -868, -1949, 1905, 11194, 15814, 16105, 11744, 5292, 3164, 3683, 3577, 3116, 1008, -961, -968, -838, 1561, 5039, 5723, 4430, 750, -4330, -7721, -9108, -11387, -15885, -16261, -11308, -6419, -1854, -680, -753, 5221, 12215, 15697, 14637, 8387, 3624, 2703, 2776, 3103, 1928, -1092, -2696, -1894, -136, 3406, 6202, 5228, 1898, -2663, -5452, -6822, -8689, -12182, -17099, -14366, -6989, -3063, -350, -767, 1365, 9596, 15647, 16209, 11288, 5244, 2543, 2816, 3657, 2646, -146, -3055, -2835, -668, 1985, 5866, 5708, 2022, -1205, -4218, -5765, -7616, -11164, -16858, -17609, -9138, -3137, -99, 179, -1659, 5514, 14840, 17522, 14430, 6679, 1748, 3032, 4884, 3963, 1561, -2041, -3046, -181, 1434, 4067, 5416, 2023, -800, -3279, -4942, -6809, -10417, -15153, -18857, -12658, -3851, -760, -558, -3287, 1549, 12886, 17524, 15411, 8662, 3070, 4203, 6723, 5308, 2716, -538, -3243, -988, 1068, 3407, 5798, 2018, -1281, -2930, -4961, -5689, -8202, -12885, -17736, -14967, -5949, -1479, -685, -3005, -1886, 8792, 17136, 16536, 10483, 3927, 2602, 6859, 8614, 4742, -437, -4330, -2221, 1968, 3764, 5266, 2308, -1798, -2532, -3514, -4667, -6356, -12192, -19468, -16918, -6337, -584, -460, -4674, -4567, 7587, 17462, 17382, 10947, 2655, 1398, 6535, 9436, 5648, -990, -4748, -3650, 1836, 6393, 6246, 2825, -763, -2062, -1892, -3459, -7267, -12908, -20676, -18827, -5998, 567, -506, -5047, -5992, 5716, 18596, 20058, 12030, 1865, -965, 5906, 10369, 6473, 220, -6202, -5504, 3057, 6976, 6272, 3045, -2313, -2466, -131, -1551, -6586, -13786, -20580, -18687, -6182, 1170, -1699, -7016, -5853, 7336, 19635, 18747, 8492, 484, 1904, 9558, 11168, 2937, -3787, -5506, -1587, 4588, 6025, 4525, 710, -1742, 73, 1045, -3025, -9059, -15607, -21123, -12792, -1128, -2245, -5256, -6797, -1247, 12689, 17869, 12656, 5182, 2252, 6956, 9271, 4560, -59, -2338, -1399, 3110, 4240, 1605, 1729, 1791, 731, 526, -3659, -9443, -14017, -18507, -14380, -3830, -1892, -5538, -6389, -1437, 11471, 17961, 10784, 3867, 3837, 7230, 10032, 5019, -3134, -2830, 844, 4607, 5565, 1921, 1011, 881, 735, 958, -3801, -10726, -15261, -18119, -12778, -2866, -2603, -7343, -6520, 4407, 15998, 15090, 7181, 2510, 4548, 9825, 9652, 920, -3814, -2118, 1120, 6682, 3974, 417, 2468, 1956, 1642, -2083, -7778, -10360, -14129, -17230, -10176, -2845, -5932, -6570, -3163, 6579, 16382, 10817, 4310, 5201, 8074, 11583, 6286, -2976, -1265, 2466, 3476, 4752, 1668, 764, 2296, 1142, -228, -3339, -9348, -13877, -16711, -14656, -4454, -2256, -7336, -6536, 111, 12841, 15942, 5982, 2049, 5911, 9468, 7918, 1085, -2420, 815, 3439, 4495, 3993, 2041, 1959, 3273, 3691, -393, -7750, -12746, -15478, -16254, -7371, -2946, -9608, -7873, -1832, 9338, 17213, 8322, 3440, 5988, 8757, 9936, 2292, -3424, -922, 1744, 4483, 2468, 27, 2222, 1995, 3343, 1769, -6542, -11203, -12962, -16088, -9501, -1115, -8204, -10372, -1587, 8744, 15901, 8070, 2693, 7868, 12181, 11964, 830, -4146, 2162, 4107, 3173, -111, -965, 1415, 2206, 1388, -3147, -7596, -10206, -12611, -14856, -9752, -3326, -7516, -7264, -179, 8941, 14397, 7069, 4577, 9892, 11850, 8287, 897, 997, 4290, 3103, 1322, -1094, 1207, 3673, -878, -2363, -4040, -8784, -9888, -14330, -17262, -7700, -2613, -7277, -6265, 31, 11344, 14601, 5326, 5264, 11418, 13565, 7904, 173, 1515, 4949, 4417, 1417, 243, 797, 803, -321, -2669, -5292, -10763, -13355, -16067, -14473, -4034, -6959, -11364, -4685, 5935, 15887, 9999, 2181, 6020, 14173, 14941, 4487, 169, 2785, 4822, 4534, 1210, 127, -69, -213, 103, -2532, -8778, -13456, -14172, -14808, -7995, -2655, -10056, -9343, 595, 11354, 14963, 5618, 3092, 9273, 13015, 8668, 1297, 1959, 3517, 2599, 1811, 970, 183, -256, -430, -2443, -6503, -10387, -11741, -14456, -11377, -3756, -6713, -8572, -3240, 5889, 14237, 9813, 3751, 6275, 11785, 11882, 4314, 548, 3556, 4914, 823, -921, 1120, 261, -1655, -3994, -5458, -7928, -11270, -14366, -14064, -4013, -2321, -8368, -5508, 3691, 14516, 12101, 2095, 4301, 13111, 12137, 2426, -378, 2760, 5645, 2962, -3006, -480, 2873, 391, -3253, -6997, -8961, -9009, -12822, -14199, -5639, -3576, -8170, -4878, 5501, 14400, 9716, 1130, 6369, 16064, 12074, 277, -2062, 4367, 7704, 1445, -5129, -1728, 4173, 1434, -5275, -7658, -8107, -8681, -12689, -13712, -4825, -3015, -7630, -4144, 6293, 14857, 8292, 1181, 8085, 14794, 11360, 661, -478, 6410, 5992, 558, -3504, -1211, 2009, -1208, -5646, -7981, -9226, -10741, -13940, -10904, -3916, -5237, -6219, 177, 9235, 12868, 6476, 4330, 12179, 14771, 6392, 180, 2226, 6136, 4490, -2305, -2936, 533, 518, -2635, -7059, -9546, -9930, -11561, -14040, -8138, -2989, -6613, -4979, 3621, 12729, 11657, 3524, 6874, 15097, 12953, 4648, 844, 2850, 5081, 2442, -2036, -2082, -840, -2096, -3814, -6050, -10464, -12476, -12986, -11600, -5145, -5745, -7133, -863, 6002, 12548, 9118, 5174, 11224, 13319, 9670, 4027, 1818, 5001, 4423, -333, -2355, -947, -288, -3537, -7094, -8482, -9829, -11531, -13216, -9169, -4542, -6239, -4875, 2235, 9860, 9735, 4066, 6986, 14416, 12541, 5152, 1972, 4661, 7473, 2038, -2496, 558, 1709, -3094, -7470, -6423, -7556, -12441, -15580, -9502, -2760, -7480, -8619, -734, 10387, 10729, 1214, 3766, 13705, 16145, 5873, -654, 6276, 9468, 3783, -2075, -954, 2797, 573, -5926, -7830, -7307, -10286, -13101, -11156, -5465, -5726, -8531, -4520, 6055, 11407, 3614, 1385, 9251, 14634, 10192, 501, 2907, 10023, 6357, -597, -1324, 2500, 733, -5982, -7107, -7303, -10245, -13712, -12072, -4161, -4474, -7983, -5675, 3606, 12249, 6125, 1508, 7461, 13609, 11554, 2348, 2338, 8138, 6272, 1732, -333, 267, 254, -4907, -6743, -6883, -10740, -13947, -13969, -6457, -3927, -7510, -5781, 1609, 10464, 7447, 3320, 9179, 13687, 11992, 4891, 2959, 8194, 7466, 1724, -721, -47, -358, -3946, -6409, -7301, -9579, -13092, -13409, -7189, -4818, -7367, -6535, 833, 8801, 6489, 3243, 8414, 13876, 11093, 4934, 5869, 8078, 4070, 487, 1274, 2103, -1868, -7359, -5949, -4730, -8347, -12417, -13118, -5872, -3309, -7206, -5919, 1719, 8712, 5536, 3159, 9131, 14294, 11270, 3933, 5611, 9399, 4969, -617, -968, 1746, -1468, -8145, -8294, -6799, -9568, -13121, -12178, -7290, -5759, -6773, -5065, 1859, 7947, 5546, 4678, 10022, 14744, 12876, 5548, 6288, 10926, 7101, 1519, -311, 884, -684, -6744, -8370, -7858, -10037, -14044, -14123, -7313, -6016, -8641, -5945, 1626, 7824, 4607, 3911, 11288, 14473, 10891, 5968, 7586, 10489, 5354, 914, 2053, 2269, -2885, -8071, -6477, -5316, -9698, -14931, -12716, -6092, -6397, -8515, -5302, 2797, 6830, 3981, 4991, 11234, 15275, 11000, 6219, 7993, 9375, 5168, 484, 1168, 1111, -4304, -8679, -7022, -6953, -11226, -14629, -12575, -6829, -7083, -8081, -4331, 2817, 6886, 4577, 6724, 12464, 15394, 12215, 8242, 10132, 10042, 4757, 992, 1449, 316, -5252, -9051, -8450, -9242, -12459, -15271, -12751, -8188, -9112, -8381, -3394, 3537, 5921, 4317, 8411, 14434, 16045, 11481, 9729, 12297, 10440, 5555, 2206, 1881, -784, -5819, -7897, -8515, -10406, -13368, -15213, -12606, -9705, -9732, -7985, -3336, 2489, 4527, 5328, 9184, 14056, 15665, 11501, 10394, 12251, 10470, 5875, 2116, 1424, -1088, -6189, -8308, -9272, -11261, -13219, -14947, -12342, -9816, -9312, -7561, -3474, 3884, 5578, 5651, 10027, 14943, 16206, 12115, 12131, 12775, 8859, 5152, 2463, 597, -2969, -7963, -9275, -9873, -12111, -14160, -15641, -12447, -9885, -9620, -7681, -2658, 4721, 5332, 5765, 11417, 16188, 16396, 12832, 13378, 13452, 9352, 5431, 3523, 952, -3763, -7458, -8574, -9810, -12705, -14589, -15145, -12455, -10453, -9805, -8067, -3584, 3050, 4007, 5702, 10653, 14978, 15455, 12762, 14232, 14340, 10037, 5558, 4073, 2215, -3166, -7111, -7954, -9483, -12991, -14411, -14270, -12918, -12078, -11031, -7327, -3937, 768, 3150, 5481, 10016, 14260, 15899, 13109, 13836, 14747, 11364, 6537, 5055, 3794, -2058, -6315, -6457, -7617, -12358, -14333, -13446, -12696, -13332, -12759, -8005, -5019, -1691, 1125, 4355, 8995, 11750, 12668, 13028, 14637, 13353, 10370, 8190, 7114, 3963, -905, -3417, -4250, -6762, -10506, -12151, -11480, -12532, -13045, -11027, -8081, -6452, -3660, 981, 3579, 6513, 8644, 12199, 13230, 12349, 12157, 10237, 9416, 6572, 3740, 958, -1809, -3273, -6236, -8467, -9595, -10496, -12609, -12735, -10239, -8441, -8254, -5819, -581, 2670, 4577, 6506, 10620, 12189, 11775, 12025, 11544, 9920, 7251, 5121, 2508, 60, -2042, -4580, -7140, -8558, -9900, -12318, -12141, -11531, -10894, -9439, -7344, -2945, -730, 1668, 5356, 8895, 11393, 10760, 12109, 13435, 11217, 8321, 6653, 5518, 2586, -1607, -4735, -5578, -6856, -9656, -11128, -12010, -12381, -11034, -10363, -7821, -5976, -2279, 910, 2827, 6646, 9498, 11772, 11250, 12786, 12979, 10243, 8608, 6652, 5187, 1524, -1565, -3717, -6079, -7339, -9676, -10827, -11771, -11555, -10930, -9849, -7488, -4914, -2432, 500, 3789, 6265, 8508, 10751, 11671, 11438, 11286, 9011, 8010, 6442, 3557, 1317, -1317, -2983, -5204, -7223, -7713, -8430, -9438, -10477, -9011, -6970, -6393, -4908, -1809, 1102, 2783, 5225, 7914, 9396, 9850, 10456, 10379, 9112, 6993, 5518, 2762, 2253, -341, -3514, -4335, -6228, -6903, -8361, -8328, -8898, -9476, -7604, -5829, -4151, -3407, -694, 2628, 4150, 6075, 7684, 9233, 10382, 9443, 8625, 8452, 7294, 4989, 3441, 1251, -464, -2440, -4802, -4280, -6886, -8354, -8989, -9034, -7497, -8775, -6020, -4540, -3346, -1117, 1015, 4053, 4348, 6649, 8127, 8495, 8956, 7464, 7163, 6543, 5645, 3432, 437, -81, -995, -3504, -5932, -5504, -5722, -8252, -7541, -7441, -5652, -5775, -4301, -1804, -574, 496, 2153, 5615, 6302, 5822, 5916, 7874, 7676, 4614, 4360, 3563, 3536, -157, -861, -2278, -2932, -4257, -7284, -6105, -6433, -6546, -6559, -6657, -5139, -1844, -2815, -164, 1809, 2747, 4294, 5164, 5992, 6940, 5276, 5514, 5706, 4191, 2580, 1654, 707, 333, -3066, -3571, -3092, -4612, -5615, -6148, -4518, -5262, -5069, -4330, -2366, -327, -1314, -169, 3501, 3971, 3607, 2753, 5668, 5828, 3853, 4518, 2773, 4020, 1488, 1248, -111, -1355, -2546, -1825, -4241, -4435, -3680, -4353, -2920, -4270, -4261, -2243, -1646, 1317, -1701, -113, 1979, 2322, 3389, 1399, 3149, 4006, 3773, 2143, 2022, 2413, 2830, 237, -49, -1341, -884, -1519, -2930, -4671, -2536, -1161, -3848, -3961, -2959, -1161, -123, -2295, -310, 1180, 873, 1164, 1288, 2326, 2917, 2569, 3050, 1125, 2465, 1869, 1744, 176, 613, -91, -1568, -2256, -2296, -758, -1638, -3100, -3490, -13, -2043, -493, -1626, -2171, 764, 625, 230, -179, 927, 1892, 1666, 1341, 2086, 1809, 2358, 320, 1826, 1369, 581, 478, -905, -810, -63, -1332, -1768, -1449, -1624, -1768, -1821, -1442, -1282, -1305, -2055, 1659, -985, 169, 326, 1041, 2548, 1037, 476, 2072, 2532, 1448, 641, 1140, 1114, 2385, -897, -314, 1646, -1959, 287, -3629, -201, -915, -2488, -1172, -3189, -1011, -623, -480, -1368, -1314, -298, 863, 1277, -271, 754, 734, 2312, 554, 1445, -227, 1211, 1756, 91, 1502, -942, 934, -520, 224, -2189, 344, -697, -1494, -1819, -1264, -1245, -37, -2315, 210, 528, -773, -1060, 851, 1308, 111, 661, -897, 3176, 341, 1262, 547, 394, 1818, 320, 83, -393, -456, -317, 630, -2588, 250, -745, -1227, 1765, -3414, 765, 190, 591, -51, -1052, 560, 1809, -601, 1107, -173, 708, 1469, -1332, 664, 561, -49, -308, -1351, 1738, 90, -678, -928, -724, 1709, -998, -661, 1465, -955, 2315, -2046, 2153, -353, 496, 1562, -2373, 3886, -3430, 2456, -1168, 705, 218, -404, 70, 1448, -1148, 1334, -2365, 3033, -207, -1102, 1184, -1528, 1180, -196, 210, -263, -463, 664, -1137, 280, 214, -2299, 3212, -3627, 3267, -1419, -845, 1489, 530, 800, 414, 890, 1074, 436, -593, 2345, -2139, 3102, -2680, 1385, -1664, 1302, -1899, 750, -1408, -537, 224, -975, -121, -2412, 827, -380, 121, -131, -1357, 1217, 423, 917, -811, 1822, 43, 1732, -397, 633, 614, 238, 1609, -1425, 1602, -954, 558, 14, 274, -1489, 1612, -2653, 2245, -2062, 1157, -3446, 1452, 708, -2508, 2649, -2496, 801, 2286, -2306, 2826, -3170, 4004, -994, 114, 6, 454, 348, 1254, -2598, 1269, 638, -1788, 3459, -5805, 5291, -3551, 3530, -2375, 1861, -198, 21, 1371, 74, 16, 700, 24, -258, 1494, -3791, 4173, -3167, 2176, -2885, 348, 1425, -2168, 2289, -4141, 3314, -2065, 1891, -1605, 201, 76, 665, 106, 932, -764, 1672, -1659, 2876, -1359, 410, 11, -286, 488, -880, -157, 904, -2196, 2745, -2706, 1337, -537, 331, 458, -1802, 2445, -1705, 1255, -521, 1822, -2629, 2987, -1958, 1869, -1240, 787, -925, -241, 958, -1901, 1405, -2500, 771, 17, -1035, 340, -823, 406, 6, -594, 1227, -1471, 2462, -1636, 446, 1646, -955, 948, -848, 1237, 121, -707, 1264, -2422, 2235, -1979, -191, -430, -711, -286, 30, -1716, 1168, -2019, 1979, -1242, 244, -190, -139, 1921, -1956, 1991, -1387, 984, 248, -34, 240, -453, 210, -528, 555, -938, 224, -804, 53, -881, -583, 653, -1952, 1459, -1716, 1265, -951, 1054, -121, -488, 1982, -1120, 2132, -1604, 2009, -83, -441, 1728, -1472, 2006, -938, 190, 234, -1944, 1364, -1565, -170, -71, -2161, 2166, -2880, 3077, -2410, 1274, -853, 2929, -2052, 1766, -962, 1504, -343, 540, 688, -990, 1062, -13, 111, -353, -40, -220, -450, -127, 84, -1474, 828, -1124, 453, 34, -511, 987, -607, 690, -374, -34, 673, -166, 159, 39, -701, 1339, -694, 136, 146, -363, 134, -997, 374, -513, -421, 156, -741, 520, -1217, 1312, -1281, 1648, -1369, 1524, -454, -621, 1731, -2579, 3710, -3422, 2309, -853, -594, 2141, -3172, 2937, -3253, 2650, -1721, 371, -791, 124, 223, -478, 194, -231, 871, -693, 594, -553, 611, -43, 446, -497, 695, -804, 1555, -1691, 1422, -1574, 771, -353, -356, 744, -1428, 1744, -2173, 1659, -1329, 1537, -403, -131, -147, 1345, -751, 930, -273, 543, -441, 384, 635, -931, 1192, -1155, 944, -1785, 1845, -2258, 1342, -1081, -267, 1212, -1901, 1594, -1405, 1811, -424, -177, 961, -764, 1459, -937, 1315, -633, 426, 238, -694, 1102, -1542, 1177, -1035, -263, 159, -781, 498, -874, 685, -887, 768, -1609, 2282, -2710, 2740, -2296, 910, 458, -932, 1032, -493, -121, 1354, -1926, 1842, -587, -330, 813, -1814, 2286, -1619, 637, 617, -1449, 1140, -1110, 43, 1529, -1971, 2128, -1685, 1691, -281, -695, 2246, -2925, 3276, -2372, 1589, -536, 24, 130, 49, -992, 1829, -2652, 2286, -1077, 84, 1200, -2205, 2870, -2365, 1568, -697, 188, 0, 1037, -2112, 2702, -2152, 1904, -1282, 166, 1408, -2192, 2415, -2221, 1411, -815, 421, -147, -394, 935, -793, 683, -210, -171, 1422, -1489, 1382, -581, -588, 1698, -2767, 3716, -3584, 2937, -1794, 230, 703, -501, 143, 16, -101, -343, 905, -1475, 1154, -480, -73, 1282, -2370, 2500, -2048, 1291, 61, -1539, 1471, -1385, 907, -843, 91, 760, -1752, 1201, -1557, 1985, -2842, 2105, -2089, 713, 364, -87, -637, 988, -1911, 3701, -4538, 3937, -2759, 1752, -620, -27, 278, -347, 214, 994, -1525, 1469, -577, 841, -1459, 2353, -2620, 2565, -938, 397, 932, -1834, 2480, -1461, 1035, 464, -1327, 1325, -583, 310, -450, 268, -1325, 1841, -2485, 1240, -176, -1491, 2682, -3539, 1804, -677, -341, 1125, -1916, 850, 1041, -2740, 3334, -2880, 1769, -458, -1110, 687, -291, -743, 565, -1751, 745, 343, -2189, 1724, -1901, 37, 1597, -2905, 3496, -3539, 3134, -301, -353, 1161, -114, 136, 1518, -1785, 2490, -2038, 1471, -1408, 1588, -1762, 2086, -2805, 2286, -1289, 717, 134, -1725, 2500, -2406, 1377, 283, -1828, 2779, -2513, 2553, -1425, -541, 2339, -3230, 3493, -3691, 2572, -740, -984, 193, -491, 581, -945, 648, -931, 914, -1535, 1125, -386, -21, 691, -524, 841, 284, -914, 2543, -1574, 1108, -257, -170, 554, -136, -990, 2001, -2335, 1317, -220, -401, 2005, -3273, 2690, -326, -1462, 2366, -2699, 2877, -2590, 638, 1321, -1465, 860, -824, 1114, -1399, 847, -835, 1681, -2011, 297, 1295, -537, 605, -1575, 1592, 198, 537, 741, -241, 183, 1107, 903, -213, 831, -1878, 3471, -3060, 3527, -4050, 2913, -2008, 183, 1095, -4124, 3821, -3573, 1345, -63, -1889, 3146, -3854, 2725, -660, -1071, 2012, -2119, 86, 2325, -3861, 4121, -3304, 1362, 277, -2678, 3186, -2341, 174, -153, -590, 374, 221, -2006, 3206, -3217, 484, 1769, -1811, 3274, -2505, 1112, 1502, -1365, 2388, -1718, 471, 650, -476, -50, 131, -1471, 1567, -701, -2419, 2486, -3814, 3439, -2972, 640, 817, -1716, 1364, 1210, -2436, 3430, -1915, 2128, -310, -1611, 4290, -2506, 754, 248, -311, 1267, -641, -516, 2452, -3791, 2535, -298, -283, 1085, -1257, 296, 1955, -2733, 4137, -3110, 1455, 478, -2023, 3529, -3674, 2483, -730, -600, 313, 7, -992, 2595, -2188, 1591, -2266, 997, 1861, -2153, 911, -2416, 2678, -1220, 49, -608, -1051, 1755, -2031, 2348, -2139, -256, 2630, -3025, 5275, -3333, 3554, 491, -483, 2555, -1382, 1581, 873, -2409, 2708, -264, -173, 817, -3357, 2560, -1427, -188, 1327, -1706, -278, 1042, -2035, 2872, -4178, 1228, 40, -1839, 1464, -1401, 377, 151, -420, 1814, -304, -630, 2192, -169, -690, 1238, 29, 2151, -1371, -813, 3076, -1421, 2018, -213, -437, 1538, -1497, 1528, 721, -1879, 1187, -2192, 628, -446, -4735, -404, -3617, -3009, -3990, -5752, -4417, -5394, -6662, -1034, -7194, -1845, -3881, -962, 1925, -327, 2318, 3626, 3914, 7905, 4767, 6846, 10127, 4581, 9729, 3927, 8231, 5252, 2592, 6694, 1044, 2812, 1368, 398, 681, -3280, -2536, -2678, -5002, -7113, -6536, -9605, -8637, -14283, -9719, -2430, -9703, -6066, -10526, 2800, 2242, -536, 4084, 3713, 5259, 9062, 6722, 9608, 2486, 3569, 9936, 1278, 3114, -2540, -236, 998, -3854, -2121, -2253, -5421, 1798, -124, 1485, 4207, -434, 11010, 6427, 8131, 11271, 4468, 13849, 7556, 7905, 7413, 847, 6053, -19, -2498, -1448, -6036, -8114, -9501, -12949, -12411, -20485, -19811, -7781, -11987, -11947, -13476, -6106, 5762, 83, 4788, 8679, 5114, 15924, 11324, 13346, 8715, 1535, 12544, 2739, -434, -2345, -8749, -4470, -9079, -8197, -4838, -14559, -5526, -2558, 291, 5054, -2256, 10119, 11403, 14776, 14023, 10513, 14177, 14284, 11560, 9219, 4053, 2680, 3217, -857, -3991, -5581, -7401, -6422, -9421, -7257, -7651, -12151, -9770, -13202, -14444, -13730, -6527, -3550, -9676, -8073, 193, 6562, 4076, 4895, 6659, 6202, 7616, 9074, 8614, 788, -2536, 1302, 223, -5205, -8712, -7676, -5576, -6842, -7117, -2832, -4368, 16, 3230, 6228, 8070, 6126, 11581, 11942, 12050, 11226, 8905, 6729, 8188, 6536, 3464, -1034, -2972, 2309, -3089, -2722, -2912, -3190, -1174, -4230, -69, 59, -5141, -4797, -5291, -7975, -13553, -19602, -8105, -4155, -10379, -15385, -10086, 3347, 6492, -201, 4051, 4165, 6410, 11007, 9603, 9389, -1000, 748, 7401, 414, -5519, -8354, -6485, -1365, -8668, -7731, -6522, -7657, 2767, 1431, 5379, 5035, 3224, 12074, 10653, 11524, 9242, 4620, 8728, 7508, 5843, 2889, -1309, -1438, 2323, -1472, -1285, -3496, -2128, 4981, -366, 1299, 1030, -1908, 5848, -2468, -4330, -6972, -17172, -12114, -20787, -10232, -3240, -17287, -11624, -7443, 9632, 12755, -253, 10089, 9448, 10374, 16885, 8247, 7643, -4401, -2176, 6732, -7343, -11845, -13161, -9492, -5825, -9361, -6649, -2536, -5316, 5425, 11091, 8371, 9755, 7286, 14393, 12768, 4447, 8642, 2395, -304, 2303, -4128, -1459, -8582, -5535, 2755, -4744, 377, 1467, 2063, 7616, 5462, 11450, 10826, 3043, 6714, 3045, 2266, 2051, -9552, -8558, -10552, -20071, -25720, -32393, -12629, -2598, -17336, -14004, -3964, 16042, 21581, 8542, 18288, 13075, 11463, 18780, 8472, 6076, -11980, -12798, -11, -13687, -15795, -20189, -17519, -4340, -6437, 5001, 4480, -1514, 16275, 19261, 21319, 11921, 4195, 14641, 7287, 1424, -2038, -12841, -9643, -11280, -9436, -6108, -14877, -5975, 637, 6879, 13939, 7994, 12122, 16059, 15755, 16766, 8668, 5985, 4435, -557, 1037, -5321, -9184, -7087, -9312, -10136, -12095, -17379, -20629, -21910, -7214, 5942, -5555, -9713, 1468, 17866, 20890, 5918, 7540, 8171, 3076, 5818, -1588, -4875, -15897, -17033, -2575, -6593, -9125, -11238, -6123, 8015, 5682, 9121, 7668, 5069, 13349, 12674, 13052, 1419, -6560, 1939, 1951, -1347, -8340, -11394, -6372, -4715, 1110, 3930, -1262, 403, 4870, 9819, 10235, 6399, 6863, 7042, 4248, 6643, 2455, 1398, 2802, 937, 4531, 324, -9, 1651, -3537, -1621, -7400, -9843, -10496, -20640, -21214, -21926, -8312, 4744, -5388, -7276, 574, 19579, 25847, 9248, 5898, 6460, 6393, 5709, -3934, -7154, -16833, -19048, -7333, -5309, -5958, -8128, -4013, 10077, 13503, 13877, 11795, 5638, 10656, 11324, 9122, 3217, -9142, -7740, -7194, -7290, -6276, -13493, -8298, -2893, 644, 7628, 3503, 6860, 8827, 8939, 13423, 6329, 4772, 3032, -510, 4571, 677, -511, -677, -1282, 5625, 2990, 2762, 5672, 2369, 3414, 50, -2308, -3727, -12459, -13210, -15719, -22333, -26281, -23492, -1838, 10447, 1197, -1348, 9519, 27932, 26869, 9116, 4657, 1875, -1082, -5851, -12892, -16766, -26467, -23371, -7773, -858, 1448, 43, 7344, 20585, 21964, 20773, 13849, 7326, 6832, 1931, -2066, -10697, -17686, -13759, -11484, -6607, -2929, -1389, 6089, 9638, 14748, 17352, 11817, 10353, 6842, 3056, -143, -7233, -9308, -11824, -9799, -2233, -2625, -474, 6400, 12184, 13952, 9228, 10253, 12061, 5725, 713, -5276, -8372, -6879, -8525, -10203, -14636, -16538, -13082, -14321, -12848, -6707, 2286, 9656, 6063, 6492, 12337, 14656, 12268, 2062, -3947, -5189, -7804, -8922, -12374, -13483, -13186, -8581, 3676, 8735, 9551, 10811, 12634, 14283, 10183, 5602, 715, -5205, -6636, -8151, -9633, -12903, -12832, -5125, 1365, 5695, 7236, 7908, 10239, 10573, 11318, 11131, 6313, -918, -6786, -5522, -4728, -7817, -8629, -6839, -2433, 1681, 6396, 10235, 11036, 12221, 12028, 8948, 5763, 2933, 167, -4954, -7694, -7591, -6516, -4878, -5019, -6415, -9759, -10257, -7536, -7184, -8377, -3958, 3998, 5017, 154, 2706, 9142, 11503, 7878, 4231, 2249, -3703, -8602, -9144, -5688, -7084, -10979, -6990, 76, 4808, 5384, 5188, 7741, 7527, 8898, 8041, 2103, -2663, -5125, -2339, -2860, -6419, -5623, -3186, 494, 4641, 6406, 7193, 4724, 2740, 3824, 2870, 271, -4909, -6897, -5619, -5129, -3500, -1756, -96, 1648, 4026, 8162, 9383, 8070, 6039, 5117, 5873, 5973, 1595, -3226, -2575, 774, 2825, -7, -3559, -3332, -2876, -2448, -3162, -4327, -6710, -10537, -11625, -12114, -12022, -5569, 2925, 4391, 3439, 5452, 10683, 14490, 11487, 6362, 1064, -2849, -4054, -6573, -8891, -11758, -12087, -6020, -990, 2945, 5328, 7116, 9488, 9232, 9175, 7411, 2616, -1868, -2970, -2795, -4607, -8441, -8365, -4954, -800, 2846, 5899, 5911, 5256, 3689, 3163, 2845, -1464, -4481, -6393, -6553, -5546, -4798, -1639, 1267, 2472, 5638, 6455, 6243, 5385, 1658, 580, -1659, -4648, -5803, -5951, -5168, -3337, 795, 8651, 9571, 6922, 9272, 13653, 17647, 11914, 3080, -2235, -5358, -5359, -6700, -10663, -15464, -18433, -15869, -11270, -7054, -1591, 5002, 7241, 7984, 11711, 14210, 12759, 5695, -17, -4537, -8295, -8422, -10432, -11253, -12098, -7840, 633, 5194, 7030, 7124, 7608, 8994, 8775, 6512, 296, -6969, -9061, -8015, -6260, -6380, -6493, -3856, 665, 6535, 9812, 9625, 6870, 5256, 4391, 1152, -2456, -6083, -8954, -9561, -8639, -5326, -2907, -276, 3380, 6645, 10326, 9603, 7526, 5394, 4360, 2349, -893, -4021, -7808, -8899, -7007, -3536, -493, 771, 2559, 5085, 7163, 8902, 8599, 6812, 5047, 4498, 2970, 129, -2092, -2151, -358, -413, -351, -721, 410, 1434, 129, -1759, -4870, -7369, -10040, -12764, -9979, -3724, -1024, -841, 233, 5586, 10329, 9579, 6989, 2379, -2422, -4163, -5248, -6543, -9736, -11127, -7738, -3092, 1512, 3063, 5041, 7963, 8829, 8431, 5765, 2405, -1854, -4314, -4240, -4588, -5855, -6223, -4717, -167, 4762, 6669, 5925, 3202, 2562, 2869, 421, -3533, -5348, -6612, -6305, -4363, -1689, 1382, 2268, 4864, 7691, 8577, 7009, 3973, 2732, 81, -1815, -3077, -4527, -5398, -5748, -4168, -1448, 1241, 2272, 2256, 2983, 3636, 3883, 3005, 518, -1408, -2325, -2488, -3444, -3626, -2378, 878, 1311, 711, 6503, 8549, 8402, 7326, 5461, 6243, 4167, 4577, 2161, -1896, -2733, -3734, -3433, -7029, -11615, -13315, -13914, -10383, -1668, 4060, 2182, 2042, 5806, 12502, 13663, 7807, 3040, -3537, -7917, -8509, -10402, -10429, -12294, -11108, -3483, 3304, 8192, 7707, 7951, 9739, 10437, 8599, 2872, -1975, -5859, -8021, -7728, -8382, -8817, -6349, -1548, 3140, 5628, 5321, 5896, 6380, 6039, 5314, 1101, -3537, -7276, -8440, -6198, -5739, -5623, -3466, -101, 4565, 7656, 8701, 9670, 8118, 5833, 2827, -737, -3157, -4919, -7423, -7314, -5761, -4781, -2013, 523, 3643, 6385, 6589, 6483, 7220, 6303, 3270, -615, -3918, -6248, -6482, -6235, -3556, -1612, -2066, -483, 2725, 5566, 6179, 3789, 2747, 3157, 958, -1761, -2872, -3464, -3149, -3540, -3374, -617, 834, 2439, 3534, 3146, 3569, 2773, 777, -911, -2462, -3282, -3947, -4345, -4605, -4128, -2560, -911, 758, 1489, 2752, 2599, 2173, 3650, 4405, 2306, -668, -1949, 2105, 5286, 861, 1554, 2293, 3827, 5723, 2837, 2039, 952, -1269, -2069, -3847, -8679, -12714, -14247, -14330, -7904, -944, 243, 247, 1951, 9722, 13637, 9965, 6032, 2261, 451, -3262, -4937, -5529, -10627, -12139, -8748, -810, 2365, 1190, 3836, 7768, 11453, 10209, 5996, 2141, -2055, -4824, -5019, -6947, -8567, -7910, -6043, -393, 3734, 6235, 8405, 7684, 7750, 7864, 5805, 1862, -4345, -6617, -6689, -6592, -7221, -7530, -4822, -1341, 3045, 5792, 7179, 7120, 6320, 6699, 5592, 2966, -795, -3787, -4921, -6020, -5276, -5034, -4912, -3189, -558, 2528, 3599, 3744, 4575, 4598, 4625, 2730, 563, -1478, -4100, -4313, -3626, -3402, -3771, -3513, -1008, 2126, 3817, 3551, 3754, 3897, 3681, 2762, 473, -1007, -1948, -2800, -2783, -3720, -3536, -2301, -548, 1628, 2288, 2943, 2886, 2538, 2572, 1492, 4, -2179, -3757, -3903, -4373, -4178, -3234, -2452, -922, 911, 2095, 3737, 3693, 3130, 3180, 2392, 1712, 316, -1131, -1818, -2953, -3149, -3113, -2472, -1155, -921, -303, 877, 1975, 2902, 2479, 1875, 1289, 548, -60, -745, -1479, -2089, -2498, -2055, -1227, -1150, 147, 1288, 2628, 3393, 2235, 2208, 2456, 2006, 2756, 1905, 1464, 1722, 2560, 3980, 3144, 1656, 150, -1824, -3493, -6665, -9488, -11013, -11258, -9710, -6330, -1639, 2145, 4274, 6476, 9957, 12168, 10403, 5719, 1625, -367, -3581, -7190, -9906, -11398, -10753, -8499, -3486, 411, 3020, 5405, 7597, 9680, 10065, 8300, 4527, -708, -3414, -4047, -5682, -7740, -9303, -7811, -4067, 117, 3696, 5751, 6393, 6989, 8091, 7988, 4595, 73, -2512, -3781, -4928, -6235, -6852, -5688, -3283, 124, 2777, 4524, 5237, 6160, 6803, 5918, 3589, 139, -2198, -3314, -4621, -5067, -5823, -5394, -2997, -41, 2331, 3654, 4685, 5442, 6293, 5792, 4274, 1314, -1688, -3056, -3976, -4811, -5476, -5502, -4285, -2325, 473, 2191, 3571, 4720, 5369, 5559, 4167, 2692, 1054, -306, -1886, -3749, -4605, -4157, -3444, -2151, -754, 484, 2099, 3313, 3696, 3501, 2538, 1462, 124, -1222, -2675, -3739, -4284, -4225, -3372, -2135, -1130, 408, 1601, 2956, 3727, 3306, 3464, 3029, 1759, 44, -1150, -1725, -2123, -2740, -2890, -2393, -1782, -707, 431, 1365, 1878, 1775, 1658, 1996, 1732, 513, -561, -1201, -1369, -1331, -1349, -1447, -1252, -554, 433, 1322, 1652, 1655, 1654, 1518, 1101, 497, -228, -801, -1514, -1946, -1871, -1369, -921, -430, 198, 1118, 1916, 2866, 3504, 3733, 3196, 2907, 3196, 3077, 2388, 888, -133, -730, -1712, -2886, -4794, -7306, -8605, -7850, -6063, -4802, -3846, -1584, 2046, 5097, 6892, 6794, 5516, 4030, 2692, 1210, -1599, -4764, -6873, -6873, -5739, -4350, -2927, -1377, 941, 3641, 6155, 6987, 5609, 3803, 2249, 1465, -358, -2886, -4997, -6305, -5452, -4027, -2440, -1294, -26, 2152, 4017, 5149, 4917, 3960, 2483, 1240, 443, -1175, -3167, -4805, -4725, -3393, -2413, -1472, -396, 1085, 2895, 4640, 5319, 4825, 3808, 2757, 1948, 534, -1195, -2736, -4046, -4228, -3489, -2586, -1818, -987, 463, 2316, 3551, 3883, 3527, 3023, 2485, 1539, 251, -1168, -2473, -3063, -2649, -2253, -2106, -1671, -555, 934, 2042, 2823, 2819, 2329, 1991, 1656, 1030, -247, -1607, -2236, -2335, -2151, -2198, -2008, -1221, -146, 1164, 1974, 2366, 2519, 2529, 2400, 1905, 930, -394, -1564, -2226, -2445, -2598, -2622, -2455, -1769, -793, 71, 858, 1317, 1815, 2199, 2429, 2478, 1844, 998, 186, -511, -853, -1385, -2051, -2423, -2453, -1775, -1120, -687, -31, 388, 1024, 1748, 2029, 2039, 1674, 1454, 1447, 1289, 1121, 1151, 950, 1038, 1721, 2046, 1999, 1565, 1564, 1705, 1309, 627, -777, -2516, -4177, -5038, -5772, -6839, -7160, -6456, -3967, -930, 1427, 2829, 3326, 4504, 5778, 5929, 4391, 1538, -1120, -3076, -3947, -4337, -5019, -5691, -5538, -3786, -1005, 1375, 2712, 3476, 4174, 5128, 5672, 5049, 3137, 585, -990, -1492, -1914, -2982, -4244, -4228, -3229, -1508, 216, 988, 1452, 1925, 2982, 3873, 3253, 1915, 478, -487, -631, -951, -1571, -2322, -2655, -1751, -470, 628, 1154, 1228, 1729, 2355, 2882, 2715, 1568, 438, -418, -688, -763, -1414, -2032, -2295, -1835, -800, 177, 745, 897, 1198, 1792, 2520, 2545, 1771, 908, 224, 114, -123, -737, -1278, -1655, -1492, -1057, -534, -3, 109, 336, 864, 1397, 1709, 1332, 871, 630, 334, 194, -161, -667, -940, -1138, -904, -531, -516, -476, -421, -236, 129, 293, 381, 200, -17, -34, 69, 230, 17, -196, -333, -383, -171, -124, -167, -316, -571, -628, -448, -263, -253, -364, -431, -43, 358, 500, 1038, 1382, 1547, 1782, 1805, 2083, 1672, 1338, 1669, 1482, 1311, 997, 1100, 1404, 1037, 1047, 815, 169, -593, -1838, -2856, -4207, -5681, -5990, -5966, -5369, -4470, -3650, -2253, -1251, 157, 1954, 3046, 3524, 3087, 3022, 2983, 2480, 1919, 807, -231, -1335, -1885, -1662, -1814, -2088, -2305, -2145, -1598, -962, -136, 317, 307, 470, 1097, 1846, 2038, 1902, 1775, 1445, 1388, 1532, 1419, 1012, 147, -203, -73, -263, -376, -750, -1100, -1088, -907, -317, -41, -159, -109, 221, 715, 990, 1130, 1060, 787, 685, 740, 820, 503, -69, -336, -401, -256, -89, -77, -167, -317, -140, 320, 617, 545, 264, 188, 333, 451, 583, 581, 347, 218, 190, 331, 456, 241, -4, -323, -436, -237, -121, -110, -146, -111, 39, 337, 585, 641, 494, 214, 141, 107, -14, -133, -376, -608, -658, -607, -437, -307, -344, -357, -320, -170, 39, 154, 129, 51, 140, 257, 384, 447, 344, 307, 196, 63, 56, -77, -234, -380, -524, -466, -438, -471, -411, -397, -350, -203, -51, 67, 116, 166, 293, 473, 641, 780, 918, 1004, 1095, 1260, 1374, 1488, 1599, 1679, 1734, 1626, 1435, 1288, 1017, 565, 16, -697, -1605, -2638, -3402, -3643, -3833, -4197, -4474, -4407, -3848, -3020, -2121, -1379, -984, -557, 180, 1015, 1525, 1571, 1499, 1385, 1207, 1121, 1034, 738, 204, -354, -573, -541, -588, -673, -790, -868, -707, -338, 110, 457, 617, 781, 988, 1192, 1471, 1661, 1665, 1468, 1198, 1131, 1064, 935, 730, 383, 156, -70, -120, -29, -201, -350, -506, -593, -490, -554, -531, -567, -741, -694, -543, -316, -213, -188, -107, -71, 113, 301, 454, 541, 438, 456, 571, 647, 744, 761, 690, 598, 526, 530, 581, 476, 277, 164, 56, 1, -9, -23, -44, -154, -228, -196, -179, -159, -146, -173, -159, -70, 37, 164, 240, 231, 237, 201, 109, 93, -1, -154, -304, -476, -503, -501, -500, -437, -421, -298, -154, -40, 139, 210, 228, 246, 256, 344, 358, 331, 331, 341, 414, 431, 488, 601, 628, 684, 777, 865, 952, 957, 1005, 1065, 1045, 1012, 955, 950, 900, 761, 657, 463, 200, -136, -587, -1171, -1795, -2482, -3239, -3579, -3796, -4067, -4063, -4068, -3494, -2655, -2152, -1359, -833, -293, 376, 635, 1140, 1225, 1057, 1118, 905, 947, 878, 707, 703, 368, 231, 223, 190, 293, 211, 187, 183, 146, 298, 401, 483, 507, 471, 604, 693, 825, 957, 918, 865, 665, 595, 645, 503, 427, 240, 47, 9, -84, -43, -51, -176, -271, -426, -467, -464, -516, -561, -664, -670, -597, -496, -287, -147, -47, 39, 86, 230, 416, 561, 603, 551, 564, 583, 654, 758, 721, 631, 494, 333, 330, 318, 263, 176, 13, -6, 14, 97, 310, 388, 490, 655, 847, 1152, 1331, 1434, 1518, 1498, 1465, 1427, 1405, 1335, 1132, 890, 648, 414, 143, -208, -663, -1312, -2059, -2882, -3456, -3673, -4047, -4295, -4395, -4184, -3319, -2749, -2156, -1481, -1138, -403, 87, 548, 1017, 817, 880, 860, 788, 922, 650, 577, 404, 164, 198, 113, 268, 367, 357, 468, 446, 600, 765, 890, 1000, 873, 894, 940, 997, 1207, 1140, 1084, 971, 721, 783, 740, 613, 476, 139, -16, -114, -179, -180, -314, -423, -561, -633, -585, -570, -563, -645, -670, -597, -493, -297, -180, -87, 41, 116, 280, 444, 574, 635, 587, 577, 583, 648, 721, 687, 618, 498, 366, 357, 358, 313, 253, 137, 81, 93, 86, 136, 111, 56, 37, 11, 54, 89, 50, -14, -86, -163, -164, -156, -174, -166, -166, -153, -56, 84, 250, 431, 580, 704, 904, 1050, 1195, 1309, 1354, 1482, 1471, 1422, 1321, 1090, 955, 665, 277, -171, -920, -1688, -2548, -3264, -3476, -3810, -4118, -4261, -4287, -3560, -2852, -2315, -1682, -1437, -835, -243, 246, 821, 827, 880, 807, 675, 818, 621, 526, 311, -21, -24, -136, -26, 154, 137, 304, 300, 430, 757, 865, 1108, 1118, 1028, 1170, 1181, 1361, 1352, 1074, 931, 684, 597, 544, 280, 81, -228, -487, -543, -604, -605, -708, -843, -837, -788, -624, -498, -430, -318, -261, -104, 133, 290, 424, 448, 460, 545, 587, 701, 767, 721, 701, 584, 561, 593, 561, 573, 420, 241, 161, 71, 87, 71, -66, -39, -109, -53, 63, 6, 111, 91, 39, 126, 96, 153, 103, 20, 10, -89, -153, -258, -326, -391, -431, -446, -457, -468, -500, -420, -351, -296, -214, -206, -93, 70, 143, 384, 488, 627, 898, 978, 1180, 1309, 1304, 1448, 1385, 1379, 1478, 1332, 1292, 1104, 897, 940, 723, 601, 413, -11, -120, -491, -824, -1071, -1754, -2352, -2992, -3596, -3581, -3767, -4007, -3943, -3963, -3174, -2456, -1876, -1075, -891, -273, 293, 645, 1302, 1058, 1005, 941, 617, 773, 468, 253, 131, -314, -311, -318, -273, -4, -20, 91, 167, 248, 631, 773, 874, 934, 911, 1054, 1148, 1242, 1381, 1332, 1075, 990, 918, 873, 838, 470, 250, -54, -324, -277, -468, -643, -922, -1170, -1037, -985, -837, -685, -734, -521, -386, -161, 119, 177, 304, 350, 317, 467, 633, 758, 747, 597, 550, 553, 617, 644, 570, 484, 330, 217, 217, 216, 123, 34, -39, -73, 37, 34, 80, 111, 27, 113, 173, 146, 206, 123, 19, -83, -141, -198, -238, -317, -436, -508, -648, -688, -635, -640, -614, -560, -527, -417, -260, -121, 61, 130, 223, 378, 431, 557, 638, 643, 867, 894, 954, 1072, 944, 1112, 1235, 1252, 1429, 1322, 1321, 1467, 1375, 1469, 1434, 1289, 1208, 1070, 1034, 938, 754, 587, 268, 49, -169, -376, -570, -938, -1238, -1532, -1617, -1845, -2175, -2642, -3347, -4091, -4761, -4778, -3967, -4141, -4210, -3966, -3403, -1755, -1224, 20, 533, 240, 1017, 1261, 2266, 2262, 1344, 1384, 653, 704, 621, 134, 17, -821, -884, -541, -430, -50, -43, 206, 550, 910, 1694, 2026, 2045, 2056, 2088, 2165, 2335, 2203, 1804, 1347, 501, 368, 196, -420, -464, -1185, -1359, -1232, -1484, -887, -1162, -1225, -855, -858, -203, -113, -81, 197, -37, 397, 660, 663, 674, 291, 290, 363, 400, 645, 554, 451, 400, 628, 1127, 1224, 1441, 1609, 1749, 2065, 2198, 2496, 2448, 2136, 2035, 2025, 1884, 1738, 1271, 932, 540, 251, 54, -228, -500, -758, -1030, -1065, -1071, -1077, -905, -957, -928, -823, -908, -624, -695, -770, -743, -927, -914, -884, -1092, -1042, -1030, -813, -777, -800, -743, -530, -146, -109, 107, 273, 490, 695, 644, 827, 951, 900, 915, 773, 743, 570, 300, 30, -290, -584, -931, -1244, -1669, -2006, -2498, -3087, -3336, -3667, -4036, -4435, -4864, -4915, -4902, -4854, -4101, -2706, -1524, -643, -348, 645, 1455, 1818, 1871, 1419, 1194, 456, 510, 487, 7, -357, -447, -6, 426, 568, 1025, 1048, 971, 1512, 2122, 2523, 2295, 2255, 2513, 2739, 2747, 2612, 2285, 1617, 1435, 1418, 1222, 564, 53, -261, -100, -220, -30, 104, -147, -61, 403, 1054, 1148, 881, 1241, 1514, 1678, 1846, 1846, 1849, 918, 918, 1357, 855, 197, -364, 283, 536, 83, 17, 188, 336, 388, 414, 774, 454, 160, 114, 417, 323, -14, -16, 9, 0, -330, -370, -547, -895, -1054, -885, -1052, -1551, -1738, -1521, -1605, -1706, -1824, -1768, -1714, -1734, -1764, -1816, -2052, -1888, -1592, -1542, -1282, -1252, -944, -280, 383, 644, 567, 870, 1132, 1469, 917, 1021, 955, 968, 1114, 934, 1115, 1028, 942, 1172, 1137, 1198, 1225, 1022, 1017, 878, 948, 948, 197, -234, -507, -643, -1178, -1875, -2568, -3096, -3767, -3924, -4134, -4654, -4552, -4577, -4018, -4010, -3043, -1932, -1281, -567, 488, 1208, 1557, 1315, 1495, 1755, 1505, 1167, 763, 637, 661, 1024, 893, 858, 1048, 1161, 1571, 1574, 1754, 1805, 1658, 1968, 2305, 2569, 2265, 2008, 2233, 2149, 2142, 1762, 1217, 1100, 590, 658, 468, -4, -214, -360, -136, 70, 173, 167, 3, 303, 693, 1054, 773, 627, 700, 708, 580, 476, 77, 37, -250, 16, -331, -481, -663, -578, -401, -378, -53, -83, -30, 197, 494, 526, 514, 411, 398, 453, 436, 376, -187, -448, -266, -173, -273, -554, -644, -625, -431, -248, -264, -313, -253, -47, 213, 150, 114, -34, 74, 113, 11, -179, -401, -610, -471, -597, -604, -905, -935, -777, -634, -660, -607, -573, -350, -256, -133, -161, -244, -150, -354, -346, -360, -450, -530, -643, -490, -624, -597, -590, -430, -477, -358, -281, -236, -214, -221, -211, -237, -80, -96, -70, -150, -70, -43, -97, -50, 21, -81, -198, 0, 256, 358, 1, -89, 244, 431, 388, 226, 34, -6, -149, -177, -194, -466, -493, -466, -367, -324, -564, -533, -288, -136, -109, -214, -361, -181, -111, 129, 57, -287, -343, -56, 456, 183, -210, -124, 106, 310, 368, 113, -119, -1, 130, 378, 230, -139, -120, 270, 506, 218, -131, -49, 246, 370, 451, 251, 243, 260, 464, 723, 423, 210, 218, 398, 303, 146, 59, 79, 156, 177, 3, -120, -57, 17, 87, 43, -39, -126, -39, 153, 266, 160, -40, -39, -44, 77, -104, -150, -227, -298, -253, -169, -270, -374, -383, -201, -83, -93, -133, 9, 93, 261, 221, 208, 170, 278, 418, 366, 380, 348, 350, 444, 523, 500, 307, 37, 154, 230, 130, 126, 126, 226, 221, 253, 287, 260, 186, 161, 211, 170, 170, 109, 96, 134, 197, 149, 96, 41, 20, -94, -51, -107, -207, -341, -291, -164, -139, -127, -9, -3, -44, 49, 119, 50, -41, -103, 7, -10, -101, -97, -53, 77, 101, 41, -54, -33, -4, -69, -81, -36, -26, 24, 84, 131, 66, -47, -36, 64, 24, -114, -83, -93, -169, -181, -151, -39, -91, -56, -127, -117, -210, -139, 20, 53, 16, -176, -231, -197, -120, -159, -248, -271, -224, -110, -54, -17, -46, -10, 37, 119, 86, 26, 89, 154, 170, 70, 16, 9, -6, -41, -157, -260, -218, -213, -127, -107, -157, -169, -163, -60, -37, -41, -120, -153, -76, -43, -33, -109, -157, -64, 86, 73, -36, -64, -80, -16, -84, -126, -170, -101, 7, 74, 116, 133, 151, 147, 163, 187, 87, -30, -50, 13, -10, -120, -147, -123, -130, -126, -126, -80, -106, -130, -90, -30, 33, 11, -44, -121, -117, -34, -16, -34, -50, -59, -3, 69, 101, 117, 66, 16, 17, -29, 13, -27, -26, -34, -43, 1, -37, -1, -19, -20, -10, -43, -16, -60, -29, -40, -27, 14, -3, -9, -43, -14, -6, -26, -21, -9, 61, 89, 74, 114, 84, 80, 90, 86, 99, 74, 97, 109, 116, 84, 83, 86, 66, 31, 21, 36, 37, 29, 67, 79, 117, 116, 114, 136, 116, 117, 91, 101, 94, 67, 93, 127, 157, 136, 130, 114, 124, 104, 74, 27, 3, 0, 13, 39, 76, 99, 94, 101, 121, 167, 183, 174, 190, 181, 173, 187, 169, 136, 107, 87, 74, 49, 39, 44, 14, 6, 13, 10, 9, 10, 39, 43, 56, 61, 79, 113, 100, 113, 91, 66, 44, 36, 39, -1, -59, -97, -90, -66, -73, -116, -149, -144, -124, -94, -103, -109, -84, -79, -70, -64, -64, -84, -94, -94, -123, -167, -188, -179, -171, -167, -180, -151, -156, -146, -111, -90, -76, -63, -60, -40, -11, 4, 1, -14, -26, -16, -4, -23, -41, -74, -83, -66, -80, -71, -79, -61, -60, -46, -14, 4, 0, 3, 21, 39, 33, 7, 13, 0, -26, -69, -74, -81, -93, -116, -104, -100, -94, -79, -57, -59, -54, -39, -30, -47, -50, -57, -57, -94, -114, -130, -127, -111, -103, -103, -99, -93, -57, -61, -51, -33, -21, -6, 1, 21, 39, 29, 41, 37, 27, 50, 39, 34, 13, 4, 3, 1, -4, -36, -51, -53, -63, -70, -80, -86, -59, -49, -40, -44, -49, -27, -21, -27, -46, -73, -87, -79, -66, -69, -63, -34, -14, 31, 59, 91, 113, 114, 140, 141, 144, 126, 114, 114, 111, 117, 130, 127, 130, 139, 147, 151, 133, 133, 121, 113, 106, 91, 74, 66, 50, 56, 44, 31, 31, 31, 23, 23, 17, 14, 7, 7, 1, -9, -9, -9, 0, 1, 6, 13, 30, 37, 47, 59, 61, 64, 79, 59, 51, 47, 39, 51, 44, 63, 61, 83, 96, 111, 110, 111, 107, 109, 91, 80, 67, 41, 29, 16, 9, -3, -16, -31, -37, -37, -31, -41, -50, -34, -27, -6, -7, -6, -11, -27, -39, -63, -69, -89, -97, -104, -111, -101, -97, -100, -81, -74, -56, -54, -50, -43, -37, -37, -37, -37, -29, -21, -13, -7, 0, -6, 9, 3, -6, -10, -20, -24, -53, -43, -54, -61, -56, -41, -31, -29, -19, -9, -14, -10, -23, -31, -41, -39, -43, -51, -54, -64, -50, -46, -41, -33, -30, -23, -13, 0, 6, 1, 6, 7, 3, 7, 14, 6, 9, 10, 16, 4, -4, -11, -33, -43, -56, -64, -60, -71, -67, -67, -76, -69, -70, -64, -76, -71, -67, -71, -71, -84, -79, -83, -74, -64, -66, -56, -37, -20, -6, -4, 4, 10, 17, 20, 9, -10, -14, -24, -23, -26, -33, -31, -23, -13, 10, 20, 31, 31, 36, 36, 26, 19, 9, 7, -1, 0, 7, -3, 0, 1, -3, -6, -7, -21, -23, -37, -34, -46, -51, -56, -59, -50, -41, -37, -40, -44, -31, -30, -29, -30, -47, -64, -74, -67, -70, -76, -77, -74, -60, -56, -41, -39, -26, -23, -10, -14, -7, -16, -26, -30, -34, -34, -49, -49, -59, -63, -63, -69, -74, -67, -74, -73, -79, -71, -79, -84, -81, -91, -84, -93, -91, -99, -100, -103, -103, -101, -101, -106, -109, -103, -100, -91, -89, -89, -81, -76, -71, -76, -73, -70, -63, -60, -49, -43, -50, -44, -43, -46, -37, -47, -49, -60, -74, -69, -77, -94, -99, -97, -90, -89, -87, -80, -71, -71, -74, -81, -90, -94, -96, -101, -100, -104, -87, -84, -76, -70, -67, -60, -53, -41, -39, -37, -37, -40, -44, -43, -44, -41, -43, -34, -29, -23, -16, -6, -1, 7, 7, 6, 21, 16, 19, 24, 21, 24, 20, 23, 11, 7, 4, -1, -1, -3, -4, 1, 1, 4, 6, 3, 9, 7, 9, 7, 6, 7, 6, 1, -1, 0, 7, 6, 3, 9, 14, 17, 27, 26, 24, 26, 30, 27, 17, 13, 3, 6, 13, 10, 14, 10, 10, 14, 19, 20, 23, 23, 23, 21, 23, 23, 13, 11, 19, 17, 27, 23, 30, 30, 29, 31, 33, 30, 26, 31, 30, 34, 33, 30, 26, 30, 24, 31, 34, 34, 37, 40, 43, 47, 40, 44, 41, 47, 40, 40, 49, 40, 43, 50, 56, 61, 66, 79, 76, 90, 97, 99, 96, 94, 96, 99, 86, 80, 83, 77, 74, 76, 76, 67, 79, 73, 80, 84, 79, 86, 80, 89, 91, 71, 79, 71, 69, 70, 69, 67, 76, 71, 71, 77, 80, 76, 76, 81, 80, 83, 77, 77, 81, 79, 70, 73, 69, 74, 57, 4, 11, 7, 3, 3, 3, 0, 0, -4, 0, -3, 0, 0, 0, 0, -1, -1, -3, -3, -1, 0, 0, -1, -1, 3, 1, -2, 0, -1, -1, 3, -1, 4, 0, 0, 1, -3, 0, 1, 0, -1, 0, -2, -2, 0, 2, 0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 2, 1, 0, 1, -1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr AdpcmEncoder::Encoded<calibration_length> calibration_data = AdpcmEncoder::Encode(calibration_pcm);
 
 static constexpr SamplePlayer16bit::Sample calibration = {
-    .data = calibration_data,
-    .length = calibration_length,
+    .data = calibration_data.data(),
+    .length = AdpcmEncoder::PaddedLength(calibration_length),
+    .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM,
 };
 
 }
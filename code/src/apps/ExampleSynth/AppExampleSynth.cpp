@@ -24,40 +24,66 @@ SOFTWARE.
 
 #include "AppExampleSynth.hpp"
 #include "common/core/Kastle2.hpp"
+#include "common/core/MultiCore.hpp"
 #include "common/utils.hpp"
 #include "ExampleSynthParameterMaps.hpp"
 
 using namespace kastle2;
 
-void AppExampleSynth::Init()
+COLDCODE void AppExampleSynth::Init()
 {
     inited_ = false;
 
-    // Oscillators
-    subtractive_osc_.Init(SAMPLE_RATE);
-    subtractive_osc_.SetWaveform(Oscillator::Waveform::SQUARE);
-    subtractive_osc_.SetFrequency(110.0f);
-    fm_osc_.Init(SAMPLE_RATE);
-    fm_osc_.SetFrequency(110.0f);
-
-    // Low-pass filter
-    filter_.Init(SAMPLE_RATE);
-    filter_.SetFrequency(500.0f);
-    filter_.SetResonance(0.0f);
-    filter_.SetType(Svf::Type::LOWPASS);
-
-    // Envelope
-    env_.Init(SAMPLE_RATE);
-    env_.SetAttackTime(0.01f);
-    env_.SetDecayTime(1.0f);
-    env_.SetNonResetting(AdsrEnv::NonResetting::DECAY); // prevents clicks
+    for (auto &voice : voices_.GetVoices())
+    {
+        // Oscillators
+        voice.subtractive_osc.Init(SAMPLE_RATE);
+        voice.subtractive_osc.SetWaveform(Oscillator::Waveform::SQUARE);
+        voice.subtractive_osc.SetFrequency(110.0f);
+        voice.fm_osc.Init(SAMPLE_RATE);
+        voice.fm_osc.SetFrequency(110.0f);
+        voice.fm_osc.SetRatio(3, 2 * FmOsc::kRatioOne);
+
+        // Low-pass filter
+        voice.filter.Init(SAMPLE_RATE);
+        voice.filter.SetFrequency(500.0f);
+        voice.filter.SetResonance(0.0f);
+
+        // Envelope
+        voice.env.Init(SAMPLE_RATE);
+        voice.env.SetAttackTime(0.01f);
+        voice.env.SetDecayTime(1.0f);
+        voice.env.SetNonResetting(AdsrEnv::NonResetting::DECAY); // prevents clicks
+        voice.env_value = 0;
+
+        // Quantizer
+        voice.quantizer.Init(0.8f);
+        voice.quantizer.SetEnabled(true);
+        voice.quantizer.SetScale(Quantizer::DefaultScale::CHROMATIC);
+    }
     env_value_ = 0;
     env_enabled_ = false;
 
-    // Quantizer
-    quantizer_.Init(0.8f);
-    quantizer_.SetEnabled(true);
-    quantizer_.SetScale(Quantizer::DefaultScale::CHROMATIC);
+    // The first voice belongs to the trigger input until MIDI notes take it
+    voices_.Reset();
+    voices_.NoteOn(kCvNote);
+    voices_.SetVoiceCount(1);
+    block_voice_count_ = 1;
+
+    // The designers have the same setup as the voices, so their coefficients fit the voices
+    filter_designer_.Init(SAMPLE_RATE);
+    env_designer_.Init(SAMPLE_RATE);
+    filter_coefficients_.Invalidate();
+    attack_coefficients_.Invalidate();
+    decay_coefficients_.Invalidate();
+
+    // Params flip at the start of each block, before the AudioLoop
+    Params params;
+    params.filter = voices_[0].filter.GetCoefficients();
+    params.attack = voices_[0].env.GetAttack();
+    params.decay = voices_[0].env.GetDecay();
+    params_.Reset(params);
+    Kastle2::base.GetScheduler().Add<ParamSnapshot<Params>, &ParamSnapshot<Params>::Flip>(&params_);
 
     // Stereo Delay
     stereo_delay_.Init(SAMPLE_RATE);
@@ -73,94 +99,101 @@ void AppExampleSynth::Init()
     // Mode selection
     mode_selector_.Init();
 
+    // Presets, recalled by MIDI program change
+    Kastle2::presets.Init(GetId());
+
     // POTS
 
     // Normal layer
-    pots_[Pot::PITCH_MOD] = FancyPot::Create({
+    pots_[Pot::PITCH_MOD] = FancyPot({
         .pot = Hardware::Pot::POT_1,
         .layer = Hardware::Layer::NORMAL,
         .deadzone = true,
         .freeze = true,
     });
 
-    pots_[Pot::TIMBRE_MOD] = FancyPot::Create({
+    pots_[Pot::TIMBRE_MOD] = FancyPot({
         .pot = Hardware::Pot::POT_2,
         .layer = Hardware::Layer::NORMAL,
         .deadzone = true,
     });
 
-    pots_[Pot::ENV] = FancyPot::Create({
+    pots_[Pot::ENV] = FancyPot({
         .pot = Hardware::Pot::POT_4,
         .layer = Hardware::Layer::NORMAL,
         .deadzone = true,
     });
 
-    pots_[Pot::PITCH] = FancyPot::Create({
+    pots_[Pot::PITCH] = FancyPot({
         .pot = Hardware::Pot::POT_5,
         .layer = Hardware::Layer::NORMAL,
         .freeze = true,
     });
 
-    pots_[Pot::TIMBRE] = FancyPot::Create({.pot = Hardware::Pot::POT_6,
-                                           .layer = Hardware::Layer::NORMAL});
+    pots_[Pot::TIMBRE] = FancyPot({.pot = Hardware::Pot::POT_6,
+                                   .layer = Hardware::Layer::NORMAL});
 
     // Shift layer
-    pots_[Pot::ENV_MOD] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
-                                            .layer = Hardware::Layer::SHIFT,
-                                            .initial_value = kEnvModDefaultValue,
-                                            .deadzone = true});
-
-    pots_[Pot::FX] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
-                                       .layer = Hardware::Layer::SHIFT,
-                                       .initial_value = kFxDefaultValue,
+    pots_[Pot::ENV_MOD] = FancyPot({.pot = Hardware::Pot::POT_4,
+                                    .layer = Hardware::Layer::SHIFT,
+                                    .initial_value = kEnvModDefaultValue,
+                                    .deadzone = true});
+
+    pots_[Pot::FX] = FancyPot({.pot = Hardware::Pot::POT_2,
+                               .layer = Hardware::Layer::SHIFT,
+                               .initial_value = kFxDefaultValue,
+                               .deadzone = true,
+                               .memory_addr = kMemFx});
+
+    pots_[Pot::RESONANCE] = FancyPot({.pot = Hardware::Pot::POT_6,
+                                      .layer = Hardware::Layer::SHIFT,
+                                      .initial_value = kResonanceDefaultValue,
+                                      .deadzone = true});
+
+    // Mode layer
+    pots_[Pot::PITCH_SCALE] = FancyPot({.pot = Hardware::Pot::POT_1,
+                                        .layer = Hardware::Layer::MODE,
+                                        .initial_value = kPitchScaleDefaultValue,
+                                        .map_size = voices_[0].quantizer.GetScaleTableSize(), // quantizer needs to be initialized before calling this
+                                        .memory_addr = kMemPitchScale});
+
+    pots_[Pot::PITCH_ROOT] = FancyPot({.pot = Hardware::Pot::POT_2,
+                                       .layer = Hardware::Layer::MODE,
+                                       .initial_value = kPitchRootDefaultValue,
+                                       .map_size = Quantizer::kMultiplierTable.size(),
+                                       .memory_addr = kMemPitchRoot});
+
+    pots_[Pot::PITCH_FINE] = FancyPot({.pot = Hardware::Pot::POT_3,
+                                       .layer = Hardware::Layer::MODE,
+                                       .initial_value = kPitchFineDefaultValue,
                                        .deadzone = true,
-                                       .memory_addr = kMemFx});
+                                       .memory_addr = kMemPitchFine});
 
-    pots_[Pot::RESONANCE] = FancyPot::Create({.pot = Hardware::Pot::POT_6,
-                                              .layer = Hardware::Layer::SHIFT,
-                                              .initial_value = kResonanceDefaultValue,
-                                              .deadzone = true});
+    pots_[Pot::MODE_MOD] = FancyPot({.pot = Hardware::Pot::POT_4,
+                                     .layer = Hardware::Layer::MODE,
+                                     .initial_value = kModeModDefaultValue,
+                                     .memory_addr = kMemModeMod});
 
-    // Mode layer
-    pots_[Pot::PITCH_SCALE] = FancyPot::Create({.pot = Hardware::Pot::POT_1,
-                                                .layer = Hardware::Layer::MODE,
-                                                .initial_value = kPitchScaleDefaultValue,
-                                                .map_size = quantizer_.GetScaleTableSize(), // quantizer needs to be initialized before calling this
-                                                .memory_addr = kMemPitchScale});
-
-    pots_[Pot::PITCH_ROOT] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
-                                               .layer = Hardware::Layer::MODE,
-                                               .initial_value = kPitchRootDefaultValue,
-                                               .map_size = Quantizer::kMultiplierTable.size(),
-                                               .memory_addr = kMemPitchRoot});
-
-    pots_[Pot::PITCH_FINE] = FancyPot::Create({.pot = Hardware::Pot::POT_3,
-                                               .layer = Hardware::Layer::MODE,
-                                               .initial_value = kPitchFineDefaultValue,
-                                               .deadzone = true,
-                                               .memory_addr = kMemPitchFine});
-
-    pots_[Pot::MODE_MOD] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
-                                             .layer = Hardware::Layer::MODE,
-                                             .initial_value = kModeModDefaultValue,
-                                             .memory_addr = kMemModeMod});
-
-    // Pots need to be initialized
-    for (auto &pot : pots_)
-    {
-        pot->Init(AUDIO_LOOP_RATE);
-    }
+    // Pots need to be initialized, their autofreeze runs in the control-rate scheduler
+    pots_.Init(ControlScheduler::GetRate(kPotDivisor));
+    Kastle2::base.GetScheduler().Add<FancyPotBank<Pot>, &FancyPotBank<Pot>::Process>(&pots_, kPotDivisor);
+    Kastle2::base.GetScheduler().Add<FancyMode, &FancyMode::Process>(&mode_selector_);
 
     // This disables the next change when the pots are moved
     // or when the current layer time is over the specified number of ticks
     mode_selector_.DisableNextChangeWhen(pots_, kModeShortPressUnder);
 
+    // Light load, let the clock drop to save the battery
+    Kastle2::governor.SetEnabled(true);
+
     inited_ = true;
 }
 
 void AppExampleSynth::DeInit()
 {
     inited_ = false;
+    Kastle2::governor.SetEnabled(false);
+    Kastle2::base.GetScheduler().Clear();
 }
 
 void AppExampleSynth::AudioLoop([[maybe_unused]] q15_t *input, q15_t *output, size_t size)
@@ -176,50 +209,169 @@ void AppExampleSynth::AudioLoop([[maybe_unused]] q15_t *input, q15_t *output, si
         do_trigger_ = true;
     }
 
-    // Calculate all samples
+    // Params of this block
+    const Params &params = params_.Get();
+    if (params_.HasChanged())
+    {
+        ApplyParams(params);
+    }
+
+    // The envelope turned off is a mono drone, the voice count is fixed for the whole block
+    block_voice_count_ = params.env_enabled ? kVoices : 1;
+    block_size_ = size;
+
+    // Core 0 renders the first voice, core 1 the second one
+    MultiCore::ParallelFor(RenderVoicesJob, this, kVoices);
+
+    env_value_ = voices_[voices_.GetLastVoice()].env_value;
+
+    // Mix the voices
     for (size_t i = 0; i < size; i++)
     {
         q15_t osc_out = 0;
+        for (size_t voice = 0; voice < block_voice_count_; voice++)
+        {
+            osc_out = q15_add(osc_out, voices_[voice].buffer[i]);
+        }
+
+        // Apply delay
+        auto delay_output = stereo_delay_.Process(osc_out, osc_out);
+
+        // Update outputs
+        output[2 * i] = delay_output.left;
+        output[2 * i + 1] = delay_output.right;
+    }
+}
+
+FASTCODE_APP(example_synth) void AppExampleSynth::RenderVoicesJob(void *context, const size_t from, const size_t to)
+{
+    static_cast<AppExampleSynth *>(context)->RenderVoices(from, to);
+}
 
-        switch (current_mode_)
+void AppExampleSynth::ApplyParams(const Params &params)
+{
+    for (size_t index = 0; index < kVoices; index++)
+    {
+        Voice &voice = voices_[index];
+        // Each mode sets different values
+        switch (params.mode)
         {
-        case Mode::FM:
-            osc_out = q31_to_q15(fm_osc_.Process());
-            break;
         case Mode::SUBTRACTIVE:
-            osc_out = q31_to_q15(subtractive_osc_.Process());
-            osc_out = filter_.Process(osc_out);
+            voice.subtractive_osc.SetNativeFrequency(params.native_pitch[index]);
+            voice.filter.SetCoefficients(params.filter);
+            break;
+        case Mode::FM:
+        {
+            // The index (up to 0.8) is the level of the first modulator, the deeper ones get less
+            const q15_t level = q31_to_q15(params.fm_index) / 2;
+            voice.fm_osc.SetNativeFrequency(params.native_pitch[index]);
+            voice.fm_osc.SetRatio(1, static_cast<uint32_t>(params.fm_ratio) >> 15); // Q31 to Q16
+            voice.fm_osc.SetLevel(1, level);
+            voice.fm_osc.SetLevel(2, level / 2);
+            voice.fm_osc.SetLevel(3, level / 4);
+            voice.fm_osc.SetFeedback(level / 4);
             break;
         }
+        }
+        voice.env.SetAttack(params.attack);
+        voice.env.SetDecay(params.decay);
+    }
+}
 
-        // Calculate the envelope
-        env_value_ = q31_to_q15(env_.Process());
+FASTCODE_APP(example_synth) void AppExampleSynth::RenderVoices(const size_t from, const size_t to)
+{
+    const Params &params = params_.Get();
+    for (size_t index = from; index < to && index < block_voice_count_; index++)
+    {
+        Voice &voice = voices_[index];
 
-        // Apply the envelope
-        if (env_enabled_)
+        // The envelope is an amplitude, exact every few samples is enough
+        std::array<q31_t, AUDIO_BUFFER_SIZE> env;
+        voice.env.ProcessBlock(env.data(), block_size_);
+
+        // The FM operators render the whole block at once, the loop below applies the envelope
+        if (params.mode == Mode::FM)
         {
-            osc_out = q15_mult(osc_out, env_value_);
+            voice.fm_osc.ProcessBlock(voice.buffer.data(), block_size_);
         }
 
-        // Lower the output to prevent clipping
-        osc_out /= 2;
-
-        // Apply delay
-        auto delay_output = stereo_delay_.Process(osc_out, osc_out);
+        for (size_t i = 0; i < block_size_; i++)
+        {
+            q15_t osc_out = 0;
+
+            switch (params.mode)
+            {
+            case Mode::FM:
+                osc_out = voice.buffer[i];
+                break;
+            case Mode::SUBTRACTIVE:
+                osc_out = q31_to_q15(voice.subtractive_osc.Process());
+                osc_out = voice.filter.Process(osc_out);
+                break;
+            }
+
+            // Calculate the envelope
+            voice.env_value = q31_to_q15(env[i]);
+
+            // Apply the envelope
+            if (params.env_enabled)
+            {
+                osc_out = q15_mult(osc_out, voice.env_value);
+            }
+
+            // Lower the output to prevent clipping
+            voice.buffer[i] = osc_out / 2;
+        }
+    }
+}
 
-        // Update outputs
-        output[2 * i] = delay_output.left;
-        output[2 * i + 1] = delay_output.right;
+void AppExampleSynth::MidiCallback(midi::Message *msg)
+{
+    // Each note gets a voice, the envelope is one shot so the note off only frees the voice for the next notes
+    if (msg->IsNoteOn())
+    {
+        const size_t voice = voices_.NoteOn(msg->GetData1());
+        voices_[voice].env.Trigger();
     }
+    else if (msg->IsNoteOff())
+    {
+        voices_.NoteOff(msg->GetData1());
+    }
+    else if (msg->IsProgramChange())
+    {
+        RecallPreset(msg->GetData1());
+    }
+    else if (msg->IsControlChange() && msg->GetData1() == cc::PRESET_SAVE)
+    {
+        SavePreset(msg->GetData2());
+    }
+}
 
-    // Handle mode audio-rate processing
-    mode_selector_.Process();
+void AppExampleSynth::SavePreset(const uint8_t slot)
+{
+    // The params of the last UI loop, the audio has them already
+    Kastle2::presets.Save(slot, Preset{pots_.GetSnapshot(), params_.Edit()});
+}
 
-    // Process pots in audio-rate
-    for (auto &pot : pots_)
+void AppExampleSynth::RecallPreset(const uint8_t slot)
+{
+    Preset preset;
+    if (!Kastle2::presets.Load(slot, preset))
     {
-        pot->Process();
+        return;
     }
+
+    // The pots hold the recalled values until they're moved, the next UI loops derive the same params from them
+    pots_.SetSnapshot(preset.pots);
+
+    // The mode has its own selector and the pitch follows the notes playing now, the rest goes as stored
+    Params &params = params_.Edit();
+    const Mode mode = params.mode;
+    const auto native_pitch = params.native_pitch;
+    params = preset.params;
+    params.mode = mode;
+    params.native_pitch = native_pitch;
+    params_.Publish();
 }
 
 void AppExampleSynth::Trigger()
@@ -232,8 +384,34 @@ void AppExampleSynth::Trigger()
     // Store current mode
     mode_selector_.TriggerAdcRead();
 
-    // Trigger envelope
-    env_.Trigger();
+    // Trigger envelope of the voice playing the CV note
+    const size_t voice = voices_.NoteOn(kCvNote);
+    voices_[voice].env.Trigger();
+}
+
+q31_t AppExampleSynth::CalculatePitch(Quantizer &quantizer, const float pot_pitch, const float note_octaves, const int32_t pitch_free_mod)
+{
+    // Apply NOTE PITCH
+    float base_pitch = pot_pitch * std::pow(2.0f, note_octaves);
+
+    // Multiply by base frequency
+    base_pitch *= kBaseTune;
+
+    // Apply quantization
+    base_pitch = quantizer.Process(base_pitch);
+
+    // Apply quantization root note
+    int32_t quantizer_root = pots_[Pot::PITCH_ROOT].GetMappedValue();
+    base_pitch *= Quantizer::kMultiplierTable[quantizer_root];
+
+    // Add fine tuning
+    base_pitch *= curve_map(pots_[Pot::PITCH_FINE].GetValue(), kMapPitchFine);
+
+    // Apply FREE PITCH mod to the native frequency, V/Oct without powf
+    q31_t native_pitch = q31_exp2(freq_to_q31(base_pitch, SAMPLE_RATE), adc_to_octaves(pitch_free_mod, ADC_1V));
+
+    // Clamp the frequency
+    return std::min(native_pitch, kMaxNativePitch);
 }
 
 void AppExampleSynth::UpdateDelayTime()
@@ -258,88 +436,98 @@ void AppExampleSynth::UiLoop()
 
     // Handle mode switching
     mode_selector_.ReadValue();
-    current_mode_ = static_cast<Mode>(mode_selector_.GetMode());
-
-    // Update pots
-    for (auto &pot : pots_)
+    const Mode mode = static_cast<Mode>(mode_selector_.GetMode());
+    if (mode != current_mode_)
     {
-        pot->ReadValue();
+        // Full clock for the first blocks of the other mode, before the governor measures it
+        Kastle2::governor.Boost();
     }
+    current_mode_ = mode;
+
+    // Update pots
+    pots_.ReadValues();
 
     // Quantizer Scale selection based on the pot value
-    int32_t quantizer_scale = pots_[Pot::PITCH_SCALE]->GetMappedValue();
-    quantizer_.SetScale(quantizer_scale >= 0 ? quantizer_scale : 0);
+    int32_t quantizer_scale = pots_[Pot::PITCH_SCALE].GetMappedValue();
+    for (auto &voice : voices_.GetVoices())
+    {
+        voice.quantizer.SetScale(quantizer_scale >= 0 ? quantizer_scale : 0);
+    }
 
     // Raw pitch value from the pot
-    float base_pitch = std::pow(2.0f, curve_map(pots_[Pot::PITCH]->GetValue(), kMapFreePitch));
+    const int32_t pitch_pot = pots_[Pot::PITCH].GetValue();
+    float pot_pitch = pot_pitch_.Get({pitch_pot}, [&]
+                                     { return std::pow(2.0f, curve_map(pitch_pot, kMapFreePitch)); });
 
-    // Apply NOTE PITCH mod
-    int32_t pitch_mod_pot = pots_[Pot::PITCH_MOD]->GetValue();
+    // NOTE PITCH mod of the trigger voice, the MIDI voices play their notes
+    int32_t pitch_mod_pot = pots_[Pot::PITCH_MOD].GetValue();
     int32_t pitch_note_mod = apply_pot_mod_attenuvert(pitch_note_cv_, pitch_mod_pot);
-    base_pitch *= std::pow(2.0f, static_cast<float>(pitch_note_mod) / static_cast<float>(ADC_1V)); // V/Oct
-
-    // Multiply by base frequency
-    base_pitch *= kBaseTune;
-
-    // Apply quantization
-    base_pitch = quantizer_.Process(base_pitch);
-
-    // Apply quantization root note
-    int32_t quantizer_root = pots_[Pot::PITCH_ROOT]->GetMappedValue();
-    base_pitch *= Quantizer::kMultiplierTable[quantizer_root];
-
-    // Apply FREE PITCH mod
     int32_t pitch_free_mod = apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_PITCH_FREE), pitch_mod_pot);
-    base_pitch *= std::pow(2.0f, static_cast<float>(pitch_free_mod) / static_cast<float>(ADC_1V)); // V/Oct
 
-    // Add fine tuning
-    base_pitch *= curve_map(pots_[Pot::PITCH_FINE]->GetValue(), kMapPitchFine);
-
-    // Clamp the frequency
-    base_pitch = fmin(base_pitch, kMaxPitchHz);
+    Params &params = params_.Edit();
+    params.mode = current_mode_;
+    for (size_t voice = 0; voice < kVoices; voice++)
+    {
+        const uint8_t note = voices_.GetNote(voice);
+        const float note_octaves = note == kCvNote ? static_cast<float>(pitch_note_mod) / static_cast<float>(ADC_1V) // V/Oct
+                                                   : static_cast<float>(note - kMidiBaseNote) / 12.0f;
+        params.native_pitch[voice] = CalculatePitch(voices_[voice].quantizer, pot_pitch, note_octaves, pitch_free_mod);
+    }
 
     // Calculate timbre and resonance settings
-    int32_t timbre_val = pots_[Pot::TIMBRE]->GetValue();
-    timbre_val += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_TIMBRE), pots_[Pot::TIMBRE_MOD]->GetValue());
-    int32_t resonance_val = pots_[Pot::RESONANCE]->GetValue();
+    int32_t timbre_val = pots_[Pot::TIMBRE].GetValue();
+    timbre_val += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_TIMBRE), pots_[Pot::TIMBRE_MOD].GetValue());
+    int32_t resonance_val = pots_[Pot::RESONANCE].GetValue();
 
-    // Each mode sets different values
+    // Each mode uses different values
     switch (current_mode_)
     {
     case Mode::SUBTRACTIVE:
-    {
-        subtractive_osc_.SetFrequency(base_pitch);
-        float cutoff_frequency = curve_map(timbre_val, kMapFilterFreq, MapClamp::TRUE);
-        filter_.SetFrequency(cutoff_frequency);
-        float resonance = curve_map(resonance_val, kMapResonance, MapClamp::TRUE);
-        filter_.SetResonance(resonance);
+        params.filter = filter_coefficients_.Get({timbre_val, resonance_val}, [&]
+                                                 {
+                                                     Svf::Params filter = filter_designer_.GetParams();
+                                                     filter.frequency = curve_map(timbre_val, kMapFilterFreq, MapClamp::TRUE);
+                                                     filter.resonance = curve_map(resonance_val, kMapResonance, MapClamp::TRUE);
+                                                     filter_designer_.SetParams(filter);
+                                                     return filter_designer_.GetCoefficients();
+                                                 });
         break;
-    }
     case Mode::FM:
-    {
-        fm_osc_.SetFrequency(base_pitch);
         // MapClamp::TRUE and especially MapSafe::TRUE is necessary here so we don't overflow q31 while calculating
-        fm_osc_.SetIndex(curve_map(timbre_val, kMapFmIndex, MapClamp::TRUE, MapSafe::TRUE));
-        fm_osc_.SetRatio(curve_map(resonance_val, kMapFmRatio, MapClamp::TRUE, MapSafe::TRUE));
+        params.fm_index = curve_map(timbre_val, kMapFmIndex, MapClamp::TRUE, MapSafe::TRUE);
+        params.fm_ratio = curve_map(resonance_val, kMapFmRatio, MapClamp::TRUE, MapSafe::TRUE);
         break;
     }
-    }
 
     // Calculate envelope
-    int32_t env_val = pots_[Pot::ENV]->GetValue();
-    env_val += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_ENV), pots_[Pot::ENV_MOD]->GetValue());
-    env_.SetAttackTime(curve_map(env_val, kMapEnvAttack, MapClamp::TRUE));
-    env_.SetDecayTime(curve_map(env_val, kMapEnvDecay, MapClamp::TRUE));
-    if (pots_[Pot::ENV]->HasChanged())
+    int32_t env_val = pots_[Pot::ENV].GetValue();
+    env_val += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_ENV), pots_[Pot::ENV_MOD].GetValue());
+    params.attack = attack_coefficients_.Get({env_val}, [&]
+                                             {
+                                                 env_designer_.SetAttackTime(curve_map(env_val, kMapEnvAttack, MapClamp::TRUE));
+                                                 return env_designer_.GetAttack();
+                                             });
+    params.decay = decay_coefficients_.Get({env_val}, [&]
+                                           {
+                                               env_designer_.SetDecayTime(curve_map(env_val, kMapEnvDecay, MapClamp::TRUE));
+                                               return env_designer_.GetDecay();
+                                           });
+    if (pots_[Pot::ENV].HasChanged())
     {
         env_enabled_ = (env_val > pot(0.05f)) && (env_val < pot(0.95f));
+        // Without the envelope the notes would just add up, so it's a mono drone
+        voices_.SetVoiceCount(env_enabled_ ? kVoices : 1);
     }
+    params.env_enabled = env_enabled_;
+
+    // The audio gets all of it at the next block
+    params_.Publish();
 
     // Pass the calculated envelope into ENV output
     Kastle2::hw.SetEnvOut(((uint32_t)env_value_) >> (15 - 10));
 
     // Update delay
-    q15_t delay_wet = curve_map(pots_[Pot::FX]->GetValue(), kMapFxDelay, MapClamp::TRUE, MapSafe::TRUE);
+    q15_t delay_wet = curve_map(pots_[Pot::FX].GetValue(), kMapFxDelay, MapClamp::TRUE, MapSafe::TRUE);
     stereo_delay_.SetWet(delay_wet);
     UpdateDelayTime();
 
@@ -359,7 +547,7 @@ void AppExampleSynth::UiLoop()
     }
 }
 
-void AppExampleSynth::MemoryInitialization()
+COLDCODE void AppExampleSynth::MemoryInitialization()
 {
     Kastle2::memory.Write8(kMemMode, std::to_underlying(Mode::SUBTRACTIVE));
     Kastle2::memory.Write8(kMemFx, pot_to_mem(kFxDefaultValue));
@@ -24,19 +24,24 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include "common/EnumTools.hpp"
+#include "common/controls/DerivedParameter.hpp"
 #include "common/controls/FancyMode.hpp"
-#include "common/controls/FancyPot.hpp"
+#include "common/controls/FancyPotBank.hpp"
 #include "common/core/App.hpp"
 #include "common/core/Hardware.hpp"
+#include "common/core/ParamSnapshot.hpp"
+#include "common/core/midi/Message.hpp"
 #include "common/dsp/control/AdsrEnv.hpp"
 #include "common/dsp/effects/StereoDelay.hpp"
 #include "common/dsp/filters/Svf.hpp"
 #include "common/dsp/math/math_utils.hpp"
-#include "common/dsp/synthesis/Fm2.hpp"
+#include "common/dsp/synthesis/FmVoice.hpp"
 #include "common/dsp/utility/Quantizer.hpp"
+#include "common/dsp/utility/VoiceAllocator.hpp"
 
 namespace kastle2
 {
@@ -47,8 +52,12 @@ namespace kastle2
  * @brief Simple synthesizer example for Kastle 2 platform
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2026-01-19
+ *
+ * Duophonic: the trigger input and MIDI notes are allocated to two voices, the first voice is rendered
+ * by core 0 and the second one by core 1 in parallel (MultiCore::ParallelFor()). With the envelope turned off the synth drones
+ * with the first voice only.
  */
-class AppExampleSynth : public virtual App
+class AppExampleSynth final : public App
 {
 public:
     /**
@@ -80,6 +89,12 @@ public:
      */
     void AudioLoop(q15_t *input, q15_t *output, size_t size);
 
+    /**
+     * @brief Allocates MIDI notes to the voices.
+     * @param msg MIDI message
+     */
+    void MidiCallback(midi::Message *msg);
+
     /**
      * @brief Main UI control loop
      *
@@ -144,8 +159,11 @@ private:
     static constexpr Hardware::AnalogInput CV_PITCH_FREE = Hardware::AnalogInput::PITCH_1; ///< CV input for free pitch modulation
     static constexpr Hardware::AnalogInput CV_PITCH_NOTE = Hardware::AnalogInput::PITCH_2; ///< CV input for quantized pitch (V/Oct)
 
-    /** @brief Array of smart pointers to FancyPot objects for all potentiometer controls */
-    EnumArray<Pot, std::unique_ptr<FancyPot>> pots_;
+    /** @brief FancyPot objects for all potentiometer controls */
+    FancyPotBank<Pot> pots_;
+
+    /** @brief Pitch multiplier of the PITCH pot, computed again only when the pot moves */
+    DerivedValue<float, 1> pot_pitch_;
 
     /**
      * @brief Memory addresses for persistent storage of values
@@ -170,25 +188,128 @@ private:
     /** @brief Currently active synthesis mode */
     Mode current_mode_ = Mode::SUBTRACTIVE;
 
-    /** @brief FM oscillator for frequency modulation synthesis mode */
-    Fm2 fm_osc_;
+    /**
+     * @brief 4 operator stack (3 -> 2 -> 1 -> 0) of the FM mode
+     *
+     * TIMBRE sets the levels of the modulators (operator 1 the most, 3 and its feedback the least),
+     * RESONANCE the ratio of operator 1, operator 2 runs at the voice frequency and operator 3 at twice of it.
+     */
+    using FmOsc = FmVoice<4, fm_algorithms::kStack>;
+
+    /**
+     * @brief One voice of the synth, rendered block by block into its buffer
+     */
+    struct Voice
+    {
+        Oscillator subtractive_osc;          ///< Basic oscillator for subtractive synthesis mode
+        FmOsc fm_osc;                        ///< FM operators for frequency modulation synthesis mode
+        FixedSvf<Svf::Type::LOWPASS> filter; ///< Low-pass filter for subtractive synthesis mode
+        Quantizer quantizer;                 ///< Pitch quantizer, each voice has its own hysteresis
+        AdsrEnv env;                         ///< ADSR envelope generator
+        q15_t env_value = 0;                 ///< Current envelope value in q15 format
+
+        /** @brief Rendered output of the block, already lowered to prevent clipping of the mix */
+        std::array<q15_t, AUDIO_BUFFER_SIZE> buffer{};
+    };
+
+    /** @brief Number of voices, split evenly between the cores */
+    static constexpr size_t kVoices = 2;
+
+    /** @brief Note of the trigger input (and PITCH 2 CV) in the voice allocator, outside the MIDI range */
+    static constexpr uint8_t kCvNote = 0x80;
+
+    /** @brief The voices and their notes */
+    VoiceAllocator<Voice, kVoices> voices_;
+
+    /**
+     * @brief Sound parameters calculated by the UiLoop, the audio applies them to the voices at the block start
+     */
+    struct Params
+    {
+        Mode mode = Mode::SUBTRACTIVE;             ///< Synthesis mode
+        bool env_enabled = false;                  ///< Envelope applied (otherwise a mono drone)
+        std::array<q31_t, kVoices> native_pitch{}; ///< Native pitch of each voice
+        Svf::Coefficients filter{};                ///< Filter cutoff and resonance (SUBTRACTIVE)
+        int32_t fm_index = 0;                      ///< FM index (FM)
+        int32_t fm_ratio = 0;                      ///< FM ratio (FM)
+        AdsrEnv::Stage attack{};                   ///< Envelope attack
+        AdsrEnv::Stage decay{};                    ///< Envelope decay
+    };
+
+    /** @brief Params from the UI, one coherent copy for each block on both cores */
+    ParamSnapshot<Params> params_;
+
+    /**
+     * @brief Applies new params to the voices, called at the block start before the voices are rendered.
+     * @param params The params of the block, all of them ready to set (no float math on the audio side)
+     */
+    void ApplyParams(const Params &params);
+
+    /** @brief Computes the filter coefficients of the params in the UI loop, it doesn't process any audio */
+    FixedSvf<Svf::Type::LOWPASS> filter_designer_;
+
+    /** @brief Computes the envelope coefficients of the params in the UI loop, it doesn't process any audio */
+    AdsrEnv env_designer_;
+
+    /** @brief Filter coefficients, computed again only when the TIMBRE or RESONANCE values change */
+    DerivedValue<Svf::Coefficients, 2> filter_coefficients_;
+
+    /** @brief Envelope coefficients, computed again only when the ENV value changes */
+    DerivedValue<AdsrEnv::Stage, 1> attack_coefficients_;
+    DerivedValue<AdsrEnv::Stage, 1> decay_coefficients_;
+
+    /**
+     * @brief A preset: the pots and the params derived from them, so a recall needs no math at all
+     */
+    struct Preset
+    {
+        FancyPotBank<Pot>::Snapshot pots;
+        Params params;
+    };
+
+    /**
+     * @brief Stores the current pots and params to the preset slot (MIDI CC cc::PRESET_SAVE).
+     * @note The flash write stalls the audio for a moment, the app runs on both cores.
+     */
+    void SavePreset(uint8_t slot);
+
+    /**
+     * @brief Recalls the preset of the slot (MIDI program change), the audio gets the whole sound at the next block.
+     */
+    void RecallPreset(uint8_t slot);
+
+    /** @brief Voices rendered in the current block, fixed for the block so both cores agree */
+    size_t block_voice_count_ = 1;
+
+    /** @brief Size of the current block */
+    size_t block_size_ = 0;
 
-    /** @brief Basic oscillator for subtractive synthesis mode */
-    Oscillator subtractive_osc_;
+    /**
+     * @brief Renders the block of the voices (of the block voices) into their buffers.
+     * @param from First voice to render
+     * @param to One past the last voice to render
+     */
+    FASTCODE_APP(example_synth) void RenderVoices(size_t from, size_t to);
 
-    /** @brief State variable filter for subtractive synthesis mode */
-    Svf filter_;
+    /**
+     * @brief MultiCore::ParallelFor() job calling RenderVoices() of the app passed as the context.
+     */
+    FASTCODE_APP(example_synth) static void RenderVoicesJob(void *context, size_t from, size_t to);
 
-    /** @brief Pitch quantizer for musical note quantization */
-    Quantizer quantizer_;
+    /**
+     * @brief Calculates the native pitch of a voice from the pots, the quantizer, and the CV or MIDI note.
+     * @param quantizer The quantizer of the voice
+     * @param pot_pitch The pitch multiplier of the PITCH pot
+     * @param note_octaves The note pitch in octaves (V/Oct CV or MIDI note)
+     * @param pitch_free_mod The FREE PITCH CV after attenuversion
+     * @return The native pitch for SetNativeFrequency()
+     */
+    q31_t CalculatePitch(Quantizer &quantizer, float pot_pitch, float note_octaves, int32_t pitch_free_mod);
 
     /** @brief Stored CV value for quantized pitch input (V/Oct) */
     int32_t pitch_note_cv_ = 0;
 
-    /** @brief ADSR envelope generator */
-    AdsrEnv env_;
-
-    /** @brief Current envelope value in q15 format */
+    /** @brief Envelope value of the latest triggered voice in q15 format */
     q15_t env_value_ = 0;
 
     /** @brief Flag indicating whether envelope is active (controlled by ENV pot position) */
@@ -25,7 +25,9 @@ SOFTWARE.
 #pragma once
 
 #include <cstdint>
+#include "common/config.hpp"
 #include "common/dsp/math/math_utils.hpp"
+#include "common/dsp/math/qmath.hpp"
 
 namespace kastle2
 {
@@ -33,8 +35,12 @@ namespace kastle2
 // Base tuning frequency in Hz
 static constexpr float kBaseTune = 32.71875f;
 
+// MIDI note played at kBaseTune (C1), same as 0 V on the PITCH 2 input
+static constexpr int32_t kMidiBaseNote = 24;
+
 // Max pitch frequency in Hz (applied after all modulations and transpositions)
 static constexpr float kMaxPitchHz = 15000.0f;
+static constexpr q31_t kMaxNativePitch = freq_to_q31(kMaxPitchHz, SAMPLE_RATE);
 
 // Octave selection
 static constexpr auto kMapFreePitch = MapDef<float, 7>{
@@ -88,6 +94,9 @@ static constexpr int32_t kEnvModDefaultValue = pot(1.0f);
 // For the mode change you need to press it for less than 1.5s
 static constexpr uint32_t kModeShortPressUnder = s2alr(1.5f);
 
+// Pot autofreeze runs every 4th audio block
+static constexpr size_t kPotDivisor = 4;
+
 // Delay
 static constexpr Fraction kDelayRatio = {3, 2};
 static constexpr auto kMapFxDelay = MapDef<int32_t, 6>{
@@ -39,9 +39,9 @@ using namespace kastle2;
 #define APP_VERSION "1.0"
 AppExampleSynth app;
 
-static void process_audio(q15_t *input, q15_t *output, size_t size)
+static void ui_loop()
 {
-    app.AudioLoop(input, output, size);
+    app.UiLoop();
 }
 
 int main()
@@ -56,15 +56,18 @@ int main()
     // Initialize the app
     app.Init();
 
-    // Start I2S
-    Kastle2::StartAudio(process_audio);
+    // Presets can be sent over MIDI SysEx (scripts/sysex_upload.py), before the second core starts
+    Kastle2::sysex_transfer.SetEnabled(true);
 
-    // Infinite program loop
-    while (true)
-    {
-        Kastle2::ReadInputs();
-        app.UiLoop();
-    }
+    // Start second core, it runs the jobs of the app (the second voice)
+    Kastle2::StartSecondCore(MultiCore::JobWorker);
 
-    return 0;
+    // Start I2S, the audio interrupt calls the app directly
+    Kastle2::StartAudio<app>();
+
+    // Set the MIDI callback
+    Kastle2::SetAppMidiCallback<app>();
+
+    // Infinite program loop, the second core is busy with the audio so the UI runs on core 0
+    Kastle2::RunUi(ui_loop, Kastle2::UiCore::CORE_0);
 }
@@ -13,13 +13,14 @@
 
 /*
  * Samples made using TTS Maker (voice 178 - Chloe) and sped up by 1.05x
- * Sample rate is 11025 Hz.
+ * Sample rate is 11025 Hz, stored as IMA-ADPCM (encoded at compile time).
  */
 
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
+#include "common/dsp/sampling/AdpcmEncoder.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 
 namespace kastle2
@@ -29,11 +30,13 @@ namespace version
 {
 
 static constexpr size_t example_synthesizer_length = 16252;
-const int16_t example_synthesizer_data[example_synthesizer_length] = {0, -105, -211, 27, -168, -587, 56, 792, 1714, 354, 1121, 2211, 1010, 250, -2135, -2237, -1761, -1273, -2310, -3779, -1698, 896, 791, 425, 1498, 3269, 3552, 1545, 886, 1929, 1206, 659, -362, 640, 935, 1399, 2778, 2927, 3097, 2140, 1357, 925, 466, -1205, -4748, -7120, -10286, -9492, -8485, -3930, -3190, -4698, 2505, 6224, 8635, 5490, 5630, 8080, 3998, 1190, -3321, -6086, -4331, -5328, -6547, -6981, -3820, 1352, 1909, 2369, 4862, 6791, 8271, 5709, 3862, 3732, 4573, 3146, 1093, 2481, 2797, 3735, 4101, 5438, 4362, 2468, 1041, -464, -2593, -8969, -14833, -18859, -20336, -13692, -6494, -8253, -6304, 4966, 15701, 15270, 9701, 12891, 11844, 6495, 273, -5619, -9055, -10073, -8271, -10240, -7422, -1240, 1580, 2653, 6313, 10523, 10472, 9326, 6224, 3847, 3625, 3235, 771, -933, 1701, 4261, 4028, 3992, 3906, 4623, 2744, -2008, -8795, -18055, -21390, -18640, -12643, -12742, -13300, -5351, 7269, 14026, 12326, 13349, 15703, 13352, 7114, -628, -5336, -6391, -7170, -11312, -11313, -6036, -446, 2477, 3537, 7177, 11255, 12615, 9331, 5482, 4550, 4463, 2661, -287, 396, 2041, 3451, 2667, 1534, 3563, 4164, 131, -7935, -13896, -20589, -20888, -12911, -11403, -16555, -11898, 3731, 12758, 9466, 9229, 13420, 13748, 11058, 2109, -4610, -5104, -3094, -5774, -9490, -5495, 1188, 4213, 3703, 5507, 8247, 9752, 8281, 3998, 2659, 2734, 2734, 1580, 674, 3550, 4849, 4157, 3943, 4633, 3797, 3, -6390, -14632, -20984, -20576, -14808, -14917, -18198, -10558, 831, 9942, 10312, 10511, 13503, 13757, 11047, 4323, -1693, -4000, -4106, -5771, -7347, -4485, -375, 3123, 4248, 6281, 9872, 9120, 7500, 5719, 4735, 3922, 841, -1114, 464, 2537, 2721, 2360, 1218, 2825, 2872, -2948, -13019, -17156, -18739, -18890, -14916, -13864, -13617, -7086, 5175, 12180, 10024, 9419, 13922, 13216, 7416, 1937, -2380, -3127, -2942, -5263, -6916, -1945, 4450, 6143, 5308, 7705, 10167, 10047, 7391, 4734, 2849, 2253, 1008, -929, -568, 825, 2076, 1485, -75, 867, -537, -9998, -17125, -17347, -18818, -12862, -15744, -12955, -6216, 1471, 11261, 10248, 8687, 11396, 13229, 9455, 2307, -3359, -2583, -3295, -4136, -4435, -3013, 2544, 5222, 5740, 7435, 10063, 10529, 7330, 5253, 3203, 2383, 404, -407, -557, -359, 630, 833, 547, 800, -3188, -8295, -14948, -19729, -17890, -13531, -11744, -14164, -7927, 3761, 9586, 10588, 8549, 11065, 13583, 10414, 2752, -1630, -2677, -1308, -3706, -6235, -2219, 2349, 4214, 4956, 7179, 9261, 10104, 8164, 6049, 4831, 2601, 1479, -274, 367, 1378, 286, -823, -709, -1192, -5287, -11519, -17778, -21711, -18474, -11334, -12609, -12000, -4873, 6282, 13576, 9758, 10581, 12539, 13649, 9614, 938, -2542, -2437, -1565, -3425, -4721, -2153, 2679, 5378, 6295, 7531, 8255, 9115, 8385, 5670, 2698, 1273, 1088, 385, 542, -269, 607, 580, -1352, -2891, -6963, -13594, -18981, -22445, -16070, -10670, -12729, -9464, -1644, 9864, 13925, 9268, 10755, 13192, 12817, 6828, -974, -2567, -2489, -1794, -4279, -5016, -680, 2771, 4333, 4740, 6612, 9349, 8856, 5938, 4292, 4263, 3019, 1735, 47, 662, -461, -393, -872, -3693, -5675, -10930, -14695, -18745, -20539, -12602, -8403, -9955, -6279, 2972, 12815, 12461, 9430, 10448, 11959, 9349, 3523, -901, -3409, -1485, -2760, -3630, -3172, 1813, 4346, 4576, 6589, 7804, 8943, 7109, 6820, 4073, 1937, 2187, 1769, -80, -839, -1695, -3320, -4106, -6612, -11122, -15162, -18510, -18088, -10518, -8711, -8557, -6068, 4209, 13407, 11810, 7802, 9099, 11411, 8511, 2992, -3196, -3198, -2394, -2446, -3601, -3213, 946, 4877, 5430, 6781, 7667, 8567, 8500, 5766, 4006, 2628, 3065, 1550, -250, -1123, -1359, -1531, -4666, -7292, -11286, -13774, -18854, -18800, -10588, -8554, -9674, -4849, 4578, 11541, 9901, 10336, 9930, 10021, 9287, 4261, -2524, -4552, 687, -1615, -5010, -3106, 2325, 5433, 4765, 6693, 7833, 8779, 8693, 6174, 3443, 2968, 3133, 1591, -1131, -1817, -2175, -3448, -4615, -8565, -12981, -17505, -20487, -15101, -8081, -9588, -9080, -2755, 8659, 13740, 11078, 9817, 10846, 11745, 9388, 596, -5102, -2886, -1547, -4547, -6518, -3951, 3240, 5607, 5437, 6596, 9484, 12240, 9648, 4672, 4080, 5386, 3700, 545, -716, -1109, -2555, -3565, -6847, -12847, -16677, -23021, -20581, -11281, -10628, -11557, -8909, 4537, 14898, 12656, 9946, 10614, 14120, 12442, 3963, -3646, -5036, -701, -3292, -7414, -6123, 429, 5833, 5107, 6177, 8761, 11844, 11800, 7547, 5424, 5174, 5307, 2536, -359, -1299, -1752, -2614, -7127, -12769, -14838, -19580, -22448, -15909, -11338, -11831, -9373, 1067, 11620, 13490, 9834, 11877, 14133, 11420, 6334, -1218, -3516, -2394, -2739, -6026, -5834, -677, 3675, 5653, 6209, 7529, 10157, 10836, 9646, 5502, 5416, 6039, 3554, 672, -766, -1933, -3667, -6330, -11250, -15284, -20049, -21748, -14679, -12380, -12929, -9958, -229, 9945, 11346, 10747, 10226, 13515, 12299, 7469, 300, -4131, -792, -1438, -6110, -7545, -927, 4443, 3752, 5080, 7644, 11554, 12510, 9502, 6307, 6416, 7502, 4102, 216, -2221, -2765, -3646, -8360, -12817, -17346, -22182, -20422, -13213, -12594, -13474, -9253, 4369, 11830, 11028, 10099, 12690, 15841, 11430, 5458, -154, -718, -1183, -5330, -7677, -5997, 643, 2179, 1044, 6442, 10162, 12539, 11099, 8432, 8406, 8132, 7961, 2378, -1057, -1463, -2200, -5362, -11909, -15320, -17680, -22849, -20382, -15638, -13213, -12170, -6490, 6424, 10628, 11404, 12269, 16015, 16554, 11102, 6320, 2698, 1002, -1729, -6201, -6734, -4292, -352, -330, 472, 5224, 9013, 10570, 9154, 8166, 9326, 8833, 6347, 3162, 1703, -869, -4510, -8872, -14015, -19469, -23581, -22580, -18453, -16872, -14417, -9490, 531, 7807, 10010, 12601, 14297, 17437, 14869, 11507, 7662, 4693, 3266, -458, -2773, -3307, -2813, -1169, -537, 2094, 3808, 5943, 7359, 7748, 8549, 6976, 6690, 6205, 2907, -593, -4562, -7882, -12985, -16791, -20080, -20513, -17969, -16833, -12532, -9692, -2761, 1795, 5904, 8781, 10045, 12792, 12349, 11682, 8604, 7539, 6058, 4289, 3490, 1927, 1495, 190, 1054, 1808, 2083, 3070, 2675, 3593, 3956, 4977, 4226, 3209, 2549, -427, -3860, -7294, -9791, -11568, -13989, -15055, -14065, -12696, -9633, -8016, -5487, -1456, 1334, 3860, 4450, 6304, 7372, 8156, 7591, 7817, 8015, 7196, 6489, 5373, 5549, 4813, 4680, 2797, 3065, 2667, 1851, 1753, 677, 1562, 549, -435, 23, -162, -2091, -5644, -6580, -6961, -7364, -7731, -9713, -9771, -8123, -5984, -5998, -5804, -3019, -937, 148, -490, 1461, 3573, 4039, 4393, 4248, 5425, 6235, 7005, 6386, 5440, 5302, 5745, 5174, 3312, 2424, 2429, 2193, 1818, 2084, 677, 388, 997, 195, -37, -1294, -1644, -3013, -4562, -4933, -4458, -5201, -6510, -6247, -4828, -4544, -5547, -4787, -3237, -1693, -2372, -2136, -1279, -166, 932, 1537, 1594, 2032, 2945, 3940, 4429, 3154, 3594, 4206, 3977, 3763, 3000, 3894, 3096, 3002, 2990, 2172, 2558, 1776, 1534, 357, 221, 636, 253, -549, -969, -424, 252, -466, -1849, -2320, -2591, -2292, -3060, -4550, -4922, -4844, -4258, -4360, -4156, -4063, -3185, -2435, -2331, -1565, -1214, -180, -36, 112, 1130, 2287, 2425, 2464, 2476, 2813, 2922, 3015, 2222, 2019, 2586, 2552, 3448, 2714, 2877, 3664, 3994, 4101, 3729, 3823, 3657, 3128, 2610, 1529, 1097, 260, -1412, -2282, -3091, -3531, -4610, -4995, -5062, -5211, -5162, -5477, -4734, -4747, -4576, -3789, -3675, -3200, -2951, -2294, -1852, -1735, -1557, -1143, -588, -407, 315, 1135, 1724, 2323, 3122, 4101, 4821, 5229, 5823, 6119, 6260, 6490, 6149, 5593, 5622, 5394, 4846, 3935, 3071, 2646, 1729, 511, -877, -1865, -2607, -3644, -4500, -5031, -5419, -5617, -5911, -6024, -5753, -5688, -5940, -5807, -5690, -5469, -5044, -4667, -4083, -3443, -2695, -1687, -795, -258, 698, 1586, 2177, 2820, 3469, 4109, 4391, 5003, 5576, 5909, 6274, 6407, 6839, 6607, 6484, 6234, 5747, 5365, 4659, 3950, 3102, 2135, 1206, 170, -969, -1920, -3115, -4034, -4890, -5670, -6213, -6584, -6804, -6709, -6507, -6286, -5886, -5370, -4891, -4627, -4169, -3669, -3187, -2891, -2461, -1857, -1424, -674, -232, 571, 1268, 1971, 2966, 3602, 4347, 4864, 5438, 5953, 6068, 6417, 6580, 6390, 6367, 6026, 5560, 5019, 4446, 3786, 2841, 1817, 1208, 326, -547, -1278, -2149, -2615, -3104, -3505, -3950, -4560, -4718, -4872, -5182, -5388, -5359, -5294, -5205, -5214, -5008, -4511, -4049, -3627, -3338, -2765, -2167, -1453, -968, -498, 320, 1261, 1859, 2438, 3071, 3750, 4339, 4698, 5097, 5294, 5492, 5627, 5786, 5740, 5729, 5709, 5325, 5039, 4604, 4037, 3343, 2474, 1714, 773, -211, -1041, -1828, -2555, -3351, -3917, -4318, -4661, -4852, -4984, -5183, -5187, -5149, -5304, -5166, -5190, -4883, -4583, -4343, -3945, -3580, -2979, -2476, -1933, -1373, -807, -117, 588, 1052, 1870, 2761, 3482, 4115, 4722, 5407, 5838, 6063, 6067, 6117, 6031, 5818, 5341, 4823, 4502, 4058, 3615, 3003, 2386, 1805, 1125, 429, -295, -968, -1524, -2281, -3032, -3506, -3969, -4521, -4937, -5214, -5485, -5607, -5771, -5755, -5643, -5419, -5023, -4670, -4099, -3554, -3005, -2383, -1742, -1115, -529, -13, 599, 1205, 1693, 2244, 2781, 3385, 4018, 4580, 4976, 5330, 5669, 6024, 6104, 6000, 5935, 5797, 5537, 5057, 4545, 3907, 3154, 2347, 1404, 388, -545, -1360, -2234, -3047, -3571, -3989, -4404, -4732, -4808, -4869, -4985, -5013, -5089, -5096, -5084, -5015, -4880, -4706, -4369, -4021, -3531, -2976, -2336, -1664, -971, -253, 469, 1206, 1880, 2610, 3157, 3758, 4321, 4792, 5067, 5159, 5373, 5505, 5409, 5211, 5047, 4873, 4688, 4396, 4024, 3606, 3114, 2581, 1933, 1252, 474, -281, -1003, -1708, -2334, -2992, -3599, -4068, -4394, -4696, -4933, -5041, -5099, -5141, -5058, -4982, -4760, -4472, -4071, -3698, -3336, -2916, -2393, -1872, -1401, -966, -519, -2, 468, 1015, 1523, 2117, 2693, 3351, 3995, 4416, 4870, 5261, 5456, 5632, 5516, 5333, 5101, 4883, 4507, 4054, 3669, 3195, 2726, 2211, 1542, 789, 109, -571, -1117, -1792, -2573, -3097, -3510, -3784, -4188, -4521, -4851, -4955, -4964, -5091, -5172, -5221, -5063, -4864, -4640, -4281, -3763, -3299, -2607, -1828, -1127, -424, 313, 984, 1609, 2222, 2651, 3211, 3474, 3956, 4321, 4630, 4778, 4968, 5192, 5162, 5102, 5013, 4830, 4688, 4308, 3825, 3344, 2976, 2341, 1721, 1209, 542, -115, -687, -1390, -2088, -2744, -3347, -3955, -4396, -4768, -5018, -5317, -5276, -5015, -4943, -4666, -4433, -4050, -3644, -3432, -3000, -2638, -2201, -1857, -1461, -839, -445, 174, 789, 1347, 1813, 2146, 2696, 2974, 3304, 3628, 3917, 3945, 4071, 4196, 4164, 4156, 4080, 4065, 4016, 3787, 3570, 3201, 2643, 2086, 1765, 1136, 549, 8, -586, -1058, -1417, -1950, -2453, -2580, -2933, -3274, -3508, -3802, -3929, -4041, -4213, -4282, -4211, -4060, -3828, -3539, -3343, -2963, -2461, -2222, -1711, -1188, -722, -266, 123, 739, 899, 1494, 2034, 2380, 2935, 3195, 3537, 3724, 3830, 3984, 4023, 3990, 3779, 3604, 3589, 3458, 3399, 3226, 3078, 2857, 2511, 2183, 1795, 1091, 547, -94, -916, -1424, -1906, -2619, -2942, -3297, -3696, -3834, -4068, -4192, -4143, -3959, -3812, -3774, -3571, -3312, -2906, -2794, -2519, -2070, -1779, -1492, -956, -610, -248, 195, 656, 885, 1328, 1834, 1865, 2253, 2893, 3010, 3360, 3732, 3795, 4206, 3917, 3844, 3802, 3481, 3554, 2992, 2716, 1927, 1748, 1619, 1318, 666, 221, -164, -468, -615, -1253, -1403, -1958, -2328, -2641, -3115, -3419, -3614, -3357, -3620, -3761, -3852, -3724, -3291, -3060, -3141, -2685, -2391, -1890, -1531, -1010, -635, -190, 620, 1015, 1394, 1570, 1856, 2188, 2440, 2521, 2826, 3110, 3068, 3144, 3328, 3442, 3063, 3076, 3096, 3315, 2677, 2323, 2279, 1833, 1664, 1326, 195, 34, 164, -443, -877, -1602, -2286, -2164, -2541, -2807, -3356, -3544, -3279, -3610, -3377, -3528, -3472, -3536, -3273, -2740, -2677, -2390, -2429, -2045, -1544, -1016, -1023, -500, 91, 519, 636, 1106, 2016, 1799, 2904, 3049, 2760, 3474, 3273, 3271, 3919, 3877, 3545, 3094, 3607, 3398, 3226, 3562, 2182, 1987, 2018, 1584, 1724, 881, 91, 23, -94, -1119, -880, -1271, -2276, -3146, -3094, -3549, -3253, -3682, -4062, -4063, -4458, -4099, -4089, -3894, -3537, -3373, -2844, -2619, -2037, -1606, -1015, -825, -6, 154, 1179, 1536, 1893, 2261, 2383, 3086, 3422, 3644, 3750, 3690, 4102, 4500, 4067, 4456, 4154, 4112, 4427, 2955, 3938, 3234, 2201, 1950, 584, 419, 1135, 159, -226, -1422, -1248, -1732, -2807, -2377, -3060, -2922, -3372, -3982, -4146, -4135, -4787, -4175, -4516, -4377, -3930, -4106, -3472, -2836, -2356, -1740, -1498, -1245, -221, 731, 781, 1214, 1682, 2209, 2859, 3149, 3675, 3555, 3599, 4110, 3862, 4146, 3675, 3411, 3711, 3758, 3484, 3482, 2631, 2631, 2179, 1760, 1805, 1130, 657, 3, -381, -646, -1229, -1745, -2581, -2761, -2826, -3950, -3981, -3594, -4508, -4844, -4797, -4557, -4369, -4154, -3899, -4011, -3705, -2644, -2782, -2156, -1651, -1597, -781, -622, 519, 773, 1260, 1714, 2136, 2872, 3253, 3506, 4291, 4312, 4633, 4565, 4252, 4149, 4534, 4399, 4067, 4015, 3070, 3041, 2703, 2286, 1860, 1419, 917, 93, -300, 144, -982, -1942, -2032, -2323, -2456, -4002, -3987, -4440, -4976, -4870, -4953, -5692, -5166, -4935, -4159, -4417, -4188, -3463, -3065, -2196, -1747, -856, -305, 83, 542, 1213, 1817, 2128, 2969, 3075, 3640, 4190, 4344, 4406, 4347, 4539, 4976, 4755, 4380, 4562, 4130, 4122, 3420, 3526, 2675, 2218, 2029, 1597, 529, 190, -492, -443, -1338, -1877, -1834, -2721, -3093, -3797, -3805, -4281, -4722, -4526, -5140, -4959, -4794, -4933, -4789, -4412, -3724, -3795, -3417, -2175, -2058, -1599, -1049, -198, 177, 1185, 1737, 2054, 2532, 3459, 3416, 3852, 3873, 4596, 4695, 4529, 4820, 4615, 4739, 4029, 4503, 4317, 3808, 3208, 3205, 2641, 2224, 1333, 1347, 557, -416, -321, -1224, -1758, -2377, -2391, -3209, -3435, -3950, -3838, -4638, -4708, -4485, -4766, -4632, -4620, -4278, -3856, -3932, -3451, -3083, -2570, -1997, -1532, -1042, -347, 115, 886, 1339, 1932, 2089, 2844, 2989, 3636, 3417, 4018, 4201, 4070, 4458, 4170, 3701, 4244, 3907, 3867, 3250, 3013, 2578, 2640, 1953, 1552, 1122, 675, -109, -620, -396, -1442, -1765, -1989, -2679, -3065, -3461, -4032, -3740, -4068, -4541, -4127, -4516, -4312, -4253, -3977, -3474, -3208, -2701, -2446, -1640, -1286, -708, -273, 516, 765, 1455, 1735, 1995, 2828, 2638, 3229, 3438, 3532, 3677, 3985, 3938, 3946, 3440, 3542, 3555, 3232, 3125, 2469, 2503, 1458, 1602, 1021, 448, 179, -127, -687, -1265, -1450, -2300, -2511, -2463, -2929, -3580, -3339, -3610, -3860, -4088, -3394, -4115, -3683, -3468, -3388, -2813, -2638, -2167, -1627, -1339, -669, -245, 263, 924, 1188, 1485, 2256, 2412, 2722, 3107, 3110, 3653, 3416, 3789, 3765, 3657, 3534, 3383, 3154, 3117, 2518, 2364, 2305, 1679, 1352, 834, 659, 153, -320, -636, -1146, -1550, -1633, -2229, -2625, -2740, -2937, -3114, -3445, -3292, -3636, -3313, -3299, -3205, -3086, -2763, -2422, -2420, -1987, -1502, -1240, -511, -31, 32, 487, 708, 1495, 1453, 2169, 2292, 2325, 2773, 2935, 3244, 3107, 3536, 3044, 3222, 2989, 3226, 2263, 2735, 2370, 1724, 1805, 1549, 982, 532, 544, -302, -213, -841, -1131, -1398, -1693, -2484, -2336, -2627, -2976, -3015, -3062, -3201, -3333, -3140, -2963, -2549, -2849, -2495, -2169, -1545, -1494, -1232, -630, -604, 286, 286, 401, 1078, 802, 1818, 1644, 2045, 2130, 2516, 2245, 2656, 2927, 2503, 3037, 2320, 3023, 2258, 2010, 2260, 1958, 1593, 1229, 1190, 805, 409, -75, -330, -953, -873, -1067, -1830, -2075, -2060, -2237, -2838, -2682, -2615, -2942, -2667, -3029, -2328, -2455, -2563, -2183, -1390, -1675, -1391, -833, -826, -237, -135, 388, 571, 745, 1130, 1407, 1752, 1838, 2130, 2248, 2365, 2492, 2703, 2401, 2308, 2539, 2222, 2052, 2044, 1654, 1424, 1602, 903, 649, 393, 119, 388, -141, -1037, -865, -1179, -1562, -1573, -1950, -2076, -2429, -2141, -2252, -2386, -2300, -2107, -2323, -2123, -1714, -1709, -1468, -1455, -959, -489, -661, -269, -315, 130, 620, 651, 1032, 446, 1375, 1438, 1289, 1883, 1633, 1812, 1974, 2106, 2248, 1995, 1943, 2091, 1945, 1862, 1630, 1502, 1214, 844, 1028, 506, 89, -19, -138, -443, -994, -1185, -1560, -1411, -1256, -1869, -2205, -2063, -2208, -1635, -1732, -2041, -2169, -2006, -1157, -1211, -1515, -977, -448, -619, -169, 75, 84, 356, 466, 1144, 1070, 1209, 1615, 1641, 1789, 1620, 2351, 1735, 2143, 2344, 1479, 2276, 1833, 1716, 1617, 1343, 1453, 1107, 539, 310, -143, -377, -635, -1010, -1299, -1714, -1836, -1971, -1982, -1998, -2747, -2084, -1795, -2244, -1799, -1929, -1701, -1698, -1339, -1019, -1164, -789, -602, -198, -159, -65, 456, 331, 959, 938, 1114, 1761, 1133, 1541, 2346, 1981, 1729, 2167, 2300, 2041, 2310, 2588, 1911, 1628, 1492, 1758, 1646, 511, 273, -209, -734, -922, -1468, -1877, -2282, -2224, -2349, -2589, -2567, -2669, -2594, -2417, -2016, -1726, -1924, -1959, -1372, -558, -273, -946, -539, 42, 377, 1071, 490, 1110, 1063, 1174, 2242, 1260, 2097, 2159, 2159, 2451, 1968, 3620, 1933, 1828, 3002, 2016, 2938, 1838, 953, 1013, 907, 385, -1018, -1058, -1800, -2391, -2437, -3041, -3114, -3523, -3703, -2930, -3292, -3308, -2744, -2721, -1597, -1506, -1242, -255, 2, 356, 430, 1029, 1260, 1437, 1880, 1682, 2138, 2328, 1641, 2273, 2599, 2435, 3265, 2727, 2968, 3300, 2661, 3346, 2778, 2753, 2680, 1331, 1354, 549, -429, -1307, -2896, -3388, -3291, -3519, -3990, -4841, -5115, -4127, -3830, -3250, -3326, -3614, -1662, -1690, -1222, 339, -192, 149, 1153, 1886, 2420, 2088, 1794, 1911, 2110, 2474, 2502, 2068, 1854, 2273, 2718, 3338, 2873, 2498, 3597, 3170, 3365, 2914, 1630, 1894, 110, -1258, -2026, -3695, -4112, -4808, -5688, -6211, -6877, -6847, -5549, -4620, -5286, -4794, -3888, -2472, -192, -433, 416, 1662, 2096, 3554, 3563, 4229, 3284, 2256, 4511, 4140, 3167, 2167, 1670, 3339, 2674, 2938, 3315, 2628, 2708, 3065, 4771, 3333, 1336, 1117, 326, -781, -3274, -4253, -4510, -5768, -7258, -8878, -8409, -7675, -7709, -6688, -6430, -5906, -4182, -1849, 458, 1174, 1802, 3162, 5606, 6593, 6690, 7136, 6055, 5917, 6274, 5904, 4555, 2747, 2515, 2766, 2180, 1761, 1196, 851, 1795, 2427, 1422, -170, -888, -1984, -3808, -6339, -6222, -5237, -8219, -10492, -10073, -7627, -6235, -7032, -6364, -3661, -2916, -1795, 2359, 3726, 4182, 4739, 6318, 9237, 8843, 8097, 8567, 7521, 7140, 6802, 4757, 3227, 1347, 2057, 1713, -386, 289, -701, -261, 419, -1315, -3071, -6196, -8781, -7640, -6269, -8002, -10700, -12539, -9706, -5089, -4810, -5260, -4325, -3045, 1141, 4593, 4966, 5477, 5451, 7536, 10523, 10961, 8985, 6669, 7050, 8307, 7953, 4380, 1023, 1037, 2138, 1438, -576, -643, -1381, -1633, -182, -2312, -5080, -8885, -11628, -6521, -5420, -11308, -14010, -11438, -5542, -3422, -4394, -4247, -2744, 1721, 6214, 7903, 6430, 5062, 7997, 11805, 11661, 8308, 6315, 6782, 7550, 6844, 3881, 1640, 422, 826, 2070, 179, -1920, -1662, -179, -198, -4250, -9295, -12213, -9864, -5640, -8047, -14153, -15977, -8143, -1844, -3203, -3008, -2604, 1547, 6471, 8696, 9328, 5945, 7588, 12148, 11924, 9164, 5107, 4524, 6659, 5804, 3893, -398, -834, 1469, 166, 1336, -550, -1843, -136, -3209, -5810, -10599, -13119, -6076, -7394, -13432, -14609, -11398, -1731, -1898, -3112, -162, 1172, 7669, 9174, 8768, 7974, 6023, 10843, 11584, 6718, 3851, 3446, 6029, 4456, 1825, 675, -495, 2591, 2356, 1075, 588, -206, 2028, -1083, -5523, -9904, -14399, -8804, -6937, -12544, -16094, -14148, -2601, -159, -4847, -1198, 1933, 6964, 10294, 7528, 8333, 6698, 8416, 11977, 5260, 1722, 1854, 5101, 5076, -1156, 282, 2367, 3114, 3304, 3151, 3438, 2049, 3115, 167, -5731, -12167, -13250, -4323, -8073, -17333, -16240, -9062, 213, -2041, -3870, -218, 3674, 10013, 8250, 7036, 6019, 4810, 9942, 6810, 500, -541, 2047, 3662, -128, -185, 1521, 2971, 3834, 3966, 5240, 3568, 4263, 3388, -2510, -9229, -14385, -7271, -4466, -15273, -17532, -13830, -3646, 2185, -3911, -581, 3919, 8519, 11815, 8958, 7179, 4716, 9135, 9036, 232, -2039, 586, 3482, 240, -2914, 948, 2149, 2877, 3810, 3990, 5821, 4354, 2029, -2253, -8096, -11635, -10110, -5576, -12287, -18666, -13028, -4036, 1297, -3000, -709, 5490, 7097, 11023, 8727, 6630, 5656, 6245, 8175, 1964, -1894, -245, 3208, 1794, -1448, 2080, 2864, 3013, 5284, 5628, 5156, 2489, 1381, -2255, -9666, -14192, -9334, -3774, -14711, -19633, -10170, -78, 1588, -3971, 1557, 8023, 8933, 9299, 6958, 5265, 5136, 6740, 5847, -508, -4682, 1369, 5135, -201, -3190, 601, 5406, 4856, 3138, 3864, 4545, 3763, -91, -5055, -10589, -15477, -6558, -3726, -17690, -16620, -5968, 2963, 1761, -5211, 4448, 11266, 9761, 8081, 4528, 4771, 6813, 7924, 1563, -5706, -1555, 5279, 3153, -2765, -1039, 5365, 6511, 2377, 2521, 5242, 3690, 680, -4044, -7412, -16856, -15326, 643, -12826, -21997, -10414, 929, 8882, -5196, -1356, 12359, 10674, 12032, 4869, 3917, 6502, 5419, 5903, -4183, -3317, 4203, 1825, 122, -2560, 3169, 7114, 2550, 3169, 2282, 2760, 2794, -4781, -9619, -16026, -15547, -381, -8109, -21226, -12633, 1778, 11464, -2244, -2823, 11045, 11437, 12774, 4060, 1818, 6927, 5485, 4427, -3343, -3144, 3315, 3943, 2558, -2575, 1161, 7760, 5894, 2794, 547, 1200, 1102, -4406, -10190, -17573, -16313, -209, -7445, -21709, -13157, 3385, 12266, -2406, -2641, 12229, 12343, 8873, 3231, 4093, 5265, 4263, 4719, -3188, -3557, 4484, 7089, 1825, -3831, 4448, 10109, 4968, 1959, 541, 1218, -656, -6878, -12317, -20442, -12032, 1795, -13237, -20187, -6242, 8789, 8396, -5412, 3946, 12976, 9833, 5562, 1481, 5515, 3459, 3609, 2477, -3869, -133, 5055, 5869, 2331, -305, 4852, 6719, 6003, 3718, -935, -968, -3922, -7774, -16320, -18461, -2420, -4557, -19198, -13807, 4013, 12531, -2037, -4120, 11654, 12232, 7252, 1552, 2174, 4716, 2273, 4094, -558, -3867, 4205, 7972, 2321, -1231, 4950, 10007, 4097, 1028, 3047, 1984, -2948, -9154, -13088, -18367, -8711, -1258, -13904, -17015, -5844, 11084, 6549, -5310, 4757, 10735, 9768, 3192, -315, 3955, 1510, 3860, 3042, -2961, 529, 6807, 9287, 2117, 1192, 8787, 7606, 4416, 1943, -1656, -5062, -6890, -11854, -19209, -10110, -1821, -12571, -13571, -1917, 8477, 4982, -3581, 5719, 9424, 5039, 2524, -80, 1737, 2774, 4667, 1547, -1455, 2961, 8123, 6641, 886, 2786, 6701, 6175, 1404, -1047, -2485, -5632, -8682, -16584, -12170, -990, -7427, -12981, -6591, 5594, 6940, -3422, 2162, 9674, 6575, 1818, -16, 3424, 4922, 3461, 1472, -1292, 2343, 8247, 5500, 849, -271, 6286, 7963, 774, -3112, -3205, -1815, -8310, -17735, -12227, -1070, -5244, -12476, -7995, 4390, 6268, -1076, 2450, 7024, 6367, 3279, 373, 3080, 5154, 4196, 1297, -357, 4068, 6583, 5541, 1169, 151, 5135, 5750, 2346, -2865, -4052, -3836, -9235, -17841, -9510, 1286, -8362, -14414, -6174, 10308, 6104, -5607, 1968, 8997, 9464, 476, -1515, 4054, 4271, 3557, 1325, 1239, 1154, 5195, 7945, 1544, 440, 5359, 5284, 1807, -2317, -4482, -3782, -11351, -18461, -4729, 1144, -12276, -13584, -2276, 10357, 4638, -4318, 3232, 8172, 7826, 760, 106, 4865, 2093, 3341, 4698, 789, 667, 4195, 7132, 4651, 1482, 3745, 2172, 391, 459, -3672, -9825, -17148, -10044, 1455, -8625, -15218, -9170, 5179, 9352, -1471, -216, 3956, 9451, 4833, 1057, 3349, 81, 5442, 4094, 667, 2021, 3244, 5268, 4442, 2938, 2409, 4185, 2349, -469, -5625, -7344, -9896, -16562, -2958, -2281, -13950, -10810, 1701, 12042, -1885, -1760, 7157, 6170, 6062, 1968, 3416, 722, 2700, 6683, 1578, -305, 2261, 6748, 6068, -1407, -596, 6643, 4977, -2114, -7437, -7437, -10716, -12998, -1404, -3497, -16222, -10745, 6524, 11364, -4292, -1674, 8963, 7019, 4411, 120, 5636, 2055, -505, 8242, 2896, -2588, 1477, 7588, 6143, -1880, -821, 6435, 3170, -4067, -4903, -8002, -13677, -12791, -593, -2644, -15330, -7666, 6333, 9565, -2174, -328, 10317, 6226, 3279, 1502, 3924, 2502, 2169, 4982, 1065, 826, 2144, 4990, 4151, -1166, 831, 3643, 112, -4847, -7933, -8567, -12994, -11364, -1166, -5933, -11019, -2812, 7860, 7615, -49, 3612, 7060, 7498, 4612, 3860, 2683, 2, 6153, 5149, 1917, 313, 1726, 4464, 2854, -334, -1041, 294, -442, -7146, -12784, -10112, -13752, -5994, -2297, -8867, -6922, -1455, 11959, 7231, -414, 3688, 7875, 9982, 2794, 1433, 3273, 5183, 5500, 1752, 1159, 2164, 5274, 3292, -234, -1002, 334, 1159, -3273, -9917, -14976, -12659, -7153, -5320, -8709, -6784, -3437, 3623, 7984, 4646, 5541, 2375, 8154, 8838, 4492, 2528, -3, 9028, 7472, 575, -1446, 4078, 10458, 334, -3136, 831, -136, -2123, -8787, -10078, -15844, -17146, -2920, -2854, -9893, -9589, 2008, 9429, 4084, 4964, 4661, 3894, 6531, 7445, 6084, 1680, 2360, 7321, 7977, 2094, 571, 6127, 5359, 1349, -742, -1433, -1948, -6393, -9547, -16675, -17956, -4610, -2518, -8417, -10867, 164, 10042, 2961, 4357, 4088, 3644, 6334, 6183, 7164, 586, 2193, 8403, 6360, 2433, 2529, 6604, 3185, 409, 2765, 182, -5005, -8898, -7412, -11416, -18784, -9906, -1037, -4833, -9208, -2805, 7484, 5937, 4860, 4036, 1252, 4609, 7271, 6649, 420, 1516, 6110, 6721, 5300, 1576, 4282, 3256, 3304, 2805, -1927, -4247, -8026, -7093, -12698, -16435, -6143, -2494, -4898, -7927, -979, 7870, 4390, 4619, 3573, 2260, 4071, 6641, 4899, 83, 3369, 4705, 4797, 3419, 2922, 4461, 1953, 1909, 1859, -1179, -4945, -7836, -9898, -14640, -13070, -4183, -2805, -4703, -3808, 1417, 5802, 4998, 5797, 4343, 653, 3271, 8305, 3464, 872, 5615, 5718, 4284, 3292, 5196, 4377, -235, 1075, 1125, -3235, -7356, -10333, -11497, -16265, -12573, -2390, -3839, -5015, -1906, 3769, 6839, 4347, 6448, 5586, 1247, 5253, 7708, 2490, 2265, 4808, 5787, 4065, 2557, 4131, 2695, 1518, 1443, -422, -3607, -5815, -9299, -13583, -17615, -10573, -97, -3636, -5502, -2067, 5268, 6932, 4735, 8021, 3716, -122, 5476, 7490, 3172, 1901, 4693, 6151, 4487, 3813, 3700, 2451, 872, 440, -657, -4411, -6130, -10682, -14287, -15050, -10127, -1669, -2968, -3907, -1089, 4727, 5562, 4969, 7779, 3781, 1872, 5076, 3933, 1531, 4325, 5614, 4526, 3693, 4417, 5477, 3140, 2367, 1938, -2554, -5240, -6450, -11411, -15399, -14651, -8334, -3414, -3141, -1864, 1352, 4864, 3860, 5891, 7369, 1644, 839, 4339, 2830, 1612, 4968, 5401, 3735, 2453, 4825, 5708, 2649, 2774, 2028, -2167, -4828, -5826, -9370, -15148, -13627, -6651, -3877, -2144, -1164, 2571, 3430, 2060, 7094, 6792, 2286, 1494, 2682, 1049, 2055, 6482, 5377, 2508, 2219, 3977, 4661, 3839, 3271, 1498, -2765, -5644, -7196, -10542, -14555, -11247, -6515, -3995, -497, 1922, 3768, 1635, 2383, 6180, 4856, 2308, 2851, 2279, -550, 2875, 8208, 5237, 2360, 2781, 3002, 3369, 3862, 3894, 568, -3833, -6456, -7972, -11773, -15497, -11268, -6123, -3753, -240, 3175, 3273, 2144, 3795, 6643, 5167, 2773, 4006, 1695, -2021, 1956, 7370, 5484, 3162, 3732, 2567, 2385, 4211, 4115, 1469, -2347, -5744, -8588, -12464, -15119, -11011, -6669, -3958, 443, 2958, 3013, 1779, 3096, 5886, 4994, 2726, 3383, 1050, -1956, 630, 5140, 4893, 3791, 3984, 2263, 1555, 3089, 4218, 2856, -677, -4268, -7987, -11937, -14891, -12609, -7992, -3532, 1662, 4615, 4669, 2994, 3247, 5232, 6086, 4583, 5302, 1945, -1674, -1998, 768, 3445, 3683, 4724, 3479, 1169, 914, 2364, 2123, 675, -2786, -6018, -9823, -15081, -15112, -10693, -6792, 446, 4424, 5331, 5234, 3419, 3985, 5955, 5037, 6162, 5617, 1687, 581, -420, 1942, 3258, 3776, 4511, 4131, 1797, 1393, 1438, 24, -1088, -3336, -6502, -11200, -14851, -15289, -11924, -7227, -1162, 3237, 6468, 6218, 4596, 4231, 3950, 3010, 4625, 5057, 3442, 3266, 1946, 2195, 2406, 2924, 4628, 5058, 3745, 3537, 1149, -1494, -2641, -6177, -8557, -10558, -13654, -13722, -10636, -7289, -1518, 2805, 5873, 7140, 5836, 4722, 3968, 1981, 1917, 3276, 3237, 3864, 3101, 2328, 2687, 2373, 2972, 4508, 4049, 3898, 2279, 170, -1938, -5078, -7086, -8476, -11227, -11133, -9451, -7688, -4175, -1099, 1899, 3654, 4250, 3945, 3218, 1557, 924, 1429, 1667, 2649, 2956, 3234, 3722, 3575, 3023, 3541, 3024, 2248, 1838, 1135, 360, -617, -828, -1112, -2115, -2231, -2644, -2843, -3013, -3151, -2581, -2615, -3302, -3213, -2690, -2219, -1593, -1141, -260, -19, 367, 846, 1430, 1013, 1099, 1817, 1721, 1545, 1422, 1244, 1256, 1698, 2060, 2878, 2802, 3206, 3219, 2664, 1979, 1416, 919, 96, -1187, -1679, -1951, -2571, -2305, -1696, -1459, -1144, -1201, -1485, -1438, -2502, -2666, -2381, -2242, -2367, -1834, -1141, -377, 554, 1529, 2417, 3067, 2818, 3159, 3211, 2925, 3612, 3339, 2638, 2385, 1990, 1653, 1828, 1804, 1946, 2036, 1370, 656, 34, -1498, -2429, -2914, -3357, -3390, -3526, -3468, -3175, -2953, -2115, -1419, -1047, -575, -695, -115, -57, 560, 1122, 1091, 1406, 1667, 1755, 2310, 2721, 2869, 3245, 3208, 3328, 2938, 2482, 1758, 1138, 331, -226, -584, -886, -1091, -1260, -1380, -1537, -1594, -1607, -1886, -1875, -1765, -1891, -1584, -1924, -1904, -1964, -1810, -1291, -854, -604, -133, 16, 562, 1161, 1609, 2099, 1992, 1997, 1907, 1692, 1703, 1942, 1765, 1750, 1669, 1550, 1211, 750, 380, 234, -304, -506, -865, -1425, -1799, -1968, -2096, -2037, -1894, -1854, -1894, -2000, -1735, -1563, -1117, -1256, -1135, -894, -716, -237, 594, 865, 1542, 1869, 2115, 2414, 2141, 2062, 1740, 1242, 1060, 784, 537, 414, 21, 24, -174, -469, -584, -828, -920, -942, -1417, -1591, -1737, -1981, -2138, -2083, -2008, -1792, -1494, -1159, -620, -343, 172, 498, 817, 804, 834, 781, 682, 859, 953, 990, 906, 994, 833, 864, 766, 549, 503, 258, 39, 106, -284, -508, -654, -810, -834, -761, -791, -760, -677, -817, -758, -729, -674, -607, -414, -531, -472, -446, -643, -227, -127, -166, 146, 32, 120, 500, 359, 541, 753, 581, 378, 391, 377, 455, 518, 456, 532, 481, 422, 437, 294, 268, 15, -99, -406, -529, -424, -714, -584, -565, -523, -701, -756, -784, -752, -755, -740, -532, -490, -424, -326, -131, -49, 58, 300, 503, 631, 781, 813, 776, 880, 744, 500, 253, 114, 65, 58, 188, 214, 352, 386, -23, -31, -89, -235, -333, -581, -752, -787, -906, -752, -601, -576, -446, -174, -114, 23, 226, 260, 451, 500, 524, 440, 347, 317, 305, 377, 468, 422, 526, 461, 229, 162, 71, -114, -258, -416, -575, -747, -744, -631, -568, -414, -349, -201, 60, 146, 195, 247, 244, 295, 341, 281, 161, 50, 49, 93, 101, 153, 263, 323, 305, 330, 369, 231, 170, 104, -39, -117, -182, -213, -135, -97, -106, 16, 84, 125, 200, 235, 179, 133, 99, -37, -138, -213, -299, -349, -273, -209, -70, 76, 84, 93, 151, 164, 177, 91, 36, 187, 154, 54, 57, 15, 109, 122, 265, 318, 247, 240, 239, 273, 237, 115, -57, -218, -378, -338, -341, -269, -192, -209, -247, -227, -205, -182, -209, -214, -120, -23, -21, -88, -15, 60, 106, 169, 182, 148, 211, 247, 284, 297, 149, -60, -162, -203, -235, -166, -125, -109, -60, -114, -146, -261, -388, -479, -490, -385, -242, -52, 52, 110, 120, 141, 115, 153, 218, 224, 245, 248, 258, 222, 157, 23, -63, -41, -96, -42, 104, 166, 192, 185, 127, -15, -161, -248, -289, -393, -304, -117, -21, 93, 153, 170, 68, 63, 161, 97, -2, 15, -28, -97, -122, -250, -304, -295, -222, -167, -37, -26, -75, -50, -50, -16, -42, -117, -183, -169, -153, -6, 229, 373, 435, 464, 440, 356, 289, 94, -83, -187, -394, -414, -289, -157, -114, -127, -8, 71, 101, 172, 226, 198, 119, 130, 62, -21, -54, -170, -250, -232, -110, 23, 193, 244, 284, 195, 50, -63, -144, -221, -244, -141, -109, -32, 71, 23, -68, -78, -58, -29, 42, 68, 146, 123, 34, 91, -133, -187, -97, -133, -62, 68, 294, 495, 649, 773, 765, 690, 513, 198, -13, -185, -349, -456, -458, -383, -274, -78, 89, 130, 65, -73, -175, -321, -435, -370, -414, -458, -258, -193, -115, 93, 229, 489, 731, 735, 747, 610, 446, 323, 37, -166, -310, -333, -300, -305, -211, -143, -161, -37, 119, 45, 83, 13, -188, -198, -169, -81, -123, -125, -15, 21, 41, 57, 224, 331, 471, 672, 674, 601, 409, 231, 44, -127, -123, -67, -71, 151, 464, 771, 797, 831, 802, 636, 469, 104, -138, -338, -231, -107, -250, -258, -229, -18, 107, -16, -68, -89, -183, -351, -542, -558, -354, -310, -282, -65, 68, 265, 383, 547, 644, 747, 698, 700, 571, 253, 169, 67, -148, -256, -216, -245, -120, 141, 255, 435, 541, 446, 349, 279, 248, -5, -193, -34, -93, -31, 170, 188, 146, 73, -451, -867, -745, -830, -880, -933, -930, -651, -383, -377, -310, -175, -88, -287, -476, -849, -1065, -765, -537, -506, -490, -448, 606, 992, 516, 661, 690, 167, -140, -2, -565, -696, -1055, -1143, -1016, -1119, -924, -266, 54, 133, -19, -78, -187, -463, -567, -1080, -834, -659, -649, -320, -195, -109, -226, -180, -420, -253, -65, 6, 102, 119, 112, -73, 304, 65, -151, -203, 213, 547, 492, 677, 969, 1326, 1114, 1200, 1234, 1394, 1588, 1813, 1640, 1657, 2201, 1935, 2425, 2518, 2169, 1857, 1705, 1201, 740, 719, 122, -445, -1036, -1677, -2813, -3729, -4407, -5097, -5211, -6107, -7164, -6601, -5380, -4627, -2844, -49, 1768, 3604, 5187, 6055, 6026, 5589, 4732, 4281, 3964, 3721, 4187, 4935, 5828, 6269, 6510, 6107, 5552, 4844, 4279, 3198, 3122, 3000, 2750, 2974, 2760, 2222, 1420, 83, -2076, -4367, -6308, -8294, -9450, -10852, -13419, -13742, -11258, -9607, -7200, -1972, 1317, 4174, 7315, 8763, 8143, 6602, 4440, 2456, 294, -1086, -310, -123, 1096, 3529, 4956, 5032, 6016, 5252, 3446, 2823, 2144, 1282, 1429, 1763, 2571, 3633, 3969, 4820, 5489, 4532, 4185, 4482, 2188, 407, -922, -3481, -5981, -8268, -10633, -13054, -15240, -18166, -18420, -14714, -13687, -8523, -47, 3636, 8735, 13731, 13895, 12461, 10318, 5437, 1576, -2591, -5252, -5221, -5213, -3924, 294, 2292, 2964, 6213, 5766, 4028, 4062, 3101, 1112, 1657, 3050, 3971, 5562, 6536, 6938, 6651, 4403, 3026, 849, -2898, -3625, -4778, -6602, -6305, -5791, -7312, -8544, -10179, -13086, -17270, -16924, -13589, -13555, -5998, 2667, 6469, 13420, 17984, 17094, 14792, 9882, 3474, -1070, -6529, -9255, -8133, -8050, -4937, 409, 1781, 4305, 7203, 5331, 4375, 4094, 2203, 2351, 3321, 4299, 6580, 8045, 8101, 8154, 5886, 3115, 1528, -1906, -3385, -2838, -3552, -2593, -808, -1128, -1093, -2260, -6130, -9982, -13716, -20227, -21169, -16870, -17424, -8602, 2718, 7240, 15420, 21315, 18893, 16477, 11675, 2942, -2161, -8183, -11774, -10294, -9669, -6084, -601, 224, 2856, 5938, 3258, 3019, 4110, 1856, 3563, 6067, 6529, 9336, 10101, 9407, 8810, 4891, 1578, -32, -4385, -5203, -3469, -3700, -1104, 1649, 1805, 1888, 555, -2958, -6997, -12323, -17175, -21943, -23190, -17623, -15469, -7282, 5156, 9466, 16919, 21781, 18271, 15427, 10081, 1414, -3669, -8804, -12279, -10933, -10257, -8015, -2771, -1940, -849, 3219, 2010, 1248, 4330, 4339, 5310, 8576, 9417, 11310, 11612, 9792, 8657, 4838, 216, -1657, -4904, -6362, -4253, -3833, -1773, 1724, 2649, 3942, 3938, 1286, -234, -4185, -9429, -11797, -15287, -20648, -18740, -14542, -14028, -4961, 3948, 6315, 14107, 17945, 15395, 14916, 10112, 3732, 128, -6021, -8948, -8675, -10625, -7771, -5013, -5299, -2244, -565, -1258, 1646, 3119, 3245, 7109, 8867, 10151, 12620, 11239, 10099, 7989, 3761, 2122, -1338, -4633, -4299, -4419, -3846, -881, 1143, 2357, 3175, 3708, 3547, 1201, 120, -1802, -5735, -8864, -11581, -15895, -18994, -16857, -16417, -13464, -4235, 498, 6388, 14248, 15828, 16170, 15369, 10542, 6101, 401, -4334, -5886, -9047, -9369, -6391, -7132, -6479, -3190, -4054, -3227, -1005, -432, 1916, 5206, 8031, 10757, 12294, 12430, 12044, 9299, 5849, 2956, -1305, -3401, -3578, -5011, -3476, -1344, -240, 1716, 3935, 4778, 3718, 3102, 1601, -971, -2800, -6119, -9914, -12058, -17365, -19297, -15674, -16110, -10575, -1524, 1846, 9896, 15882, 16154, 16963, 14071, 9239, 4209, -1558, -4024, -7018, -10067, -7622, -6833, -7580, -4763, -3797, -4131, -2149, -440, 221, 2578, 5779, 7885, 10742, 12153, 12213, 10573, 6907, 4315, 1375, -2445, -3789, -3195, -3386, -2034, 838, 2451, 3492, 4438, 4625, 3760, 1945, 1328, -492, -3099, -3813, -7084, -11097, -13755, -18422, -18193, -16101, -15182, -6453, -39, 4930, 14411, 16776, 16500, 16688, 11344, 6615, 2494, -2515, -4808, -7404, -7722, -6127, -7386, -5854, -3981, -6295, -5602, -2890, -3451, -381, 4773, 6760, 10769, 13836, 14052, 13073, 9662, 6528, 2841, -2068, -3227, -4286, -5080, -1774, -3, 1018, 4334, 4625, 3312, 4815, 3584, 1260, 1519, 52, -1925, -3584, -7055, -9505, -14412, -19028, -17226, -17854, -15520, -6416, -1492, 5209, 12779, 15115, 17263, 14807, 10648, 8325, 1390, -2070, -2391, -6333, -6031, -4943, -6969, -6430, -6060, -7708, -7508, -6412, -4882, -1732, 2593, 7862, 12221, 14425, 16132, 15919, 12037, 8722, 4653, -318, -2786, -4708, -4661, -2843, -2391, -253, 2255, 2036, 2399, 3167, 3141, 2765, 2188, 2497, 1406, -1974, -4619, -7979, -14226, -18294, -18109, -18620, -16555, -9073, -3276, 2761, 10860, 13656, 15011, 15242, 10817, 7550, 3760, -745, -1794, -3834, -5060, -3701, -6123, -6508, -5407, -8773, -8547, -6420, -6789, -3172, 1856, 5468, 10833, 14216, 15576, 15966, 12812, 9206, 5873, 1140, -1692, -2446, -3586, -2696, -369, 295, 1440, 2481, 1628, 1416, 1352, 687, 951, 1115, 1308, 1034, -1545, -4528, -8201, -14425, -17787, -17844, -18541, -14448, -7010, -1682, 5430, 12133, 14307, 14987, 13200, 9586, 5737, 1089, -1399, -3313, -4656, -3635, -4067, -4890, -4649, -6164, -7552, -6984, -6437, -5776, -2195, 2802, 5632, 9843, 14208, 13745, 13170, 12011, 7721, 4760, 1732, -830, -1201, -2531, -1474, 416, -755, 1162, 2531, 179, 1782, 2151, -167, 1789, 1688, -182, 443, -2394, -5586, -8682, -14610, -15804, -16172, -17096, -11003, -5489, -1198, 6888, 10924, 12511, 13821, 10688, 8097, 5297, 883, -63, -1331, -3179, -2135, -3049, -4690, -5063, -7119, -8349, -8203, -7747, -5359, -1422, 2654, 6882, 10940, 12831, 12627, 11961, 9047, 5248, 3154, 542, -846, -93, -183, 804, 2029, 1188, 1541, 1331, -403, 71, 157, 63, 2109, 2721, 2875, 3596, 378, -3580, -6799, -13554, -17617, -17591, -18182, -14352, -7808, -2365, 4394, 9089, 11484, 12753, 10330, 8122, 6245, 2222, 943, 930, -1148, -917, -888, -3513, -4519, -6042, -8518, -8893, -8310, -6679, -3544, 607, 4925, 8607, 10857, 11620, 10998, 8695, 6294, 4011, 1651, 696, 183, 497, 1503, 1271, 1407, 1619, 709, -24, -146, 26, 367, 1287, 2446, 3623, 3883, 3260, 1797, -1927, -6289, -11023, -16375, -18287, -17755, -16580, -10886, -4333, 758, 6841, 10552, 12115, 12065, 9584, 7779, 4929, 1664, 1211, -65, -1188, -1284, -2388, -3881, -6138, -7552, -8899, -9854, -8537, -6187, -2830, 1744, 5644, 8846, 11167, 10959, 10057, 8416, 5409, 3635, 2279, 992, 1532, 1682, 1593, 2338, 1690, 1003, 771, -19, -696, 11, 565, 1406, 3016, 3907, 4981, 4232, 2464, -222, -5330, -10161, -15343, -18789, -18403, -17438, -13034, -6260, -1123, 5498, 9709, 11331, 12167, 10032, 7659, 5273, 2614, 1643, 344, -526, -222, -2099, -3425, -5399, -8058, -8917, -10430, -9407, -6435, -3904, 963, 5830, 8334, 11007, 11333, 9856, 8252, 5508, 3672, 2607, 1258, 2222, 3080, 2068, 3308, 2756, 760, 468, -489, -964, -951, 102, 2084, 3253, 4580, 5542, 4487, 2914, -807, -5657, -10180, -16003, -19792, -19110, -18112, -14419, -7307, -1966, 4263, 8776, 10518, 11849, 9802, 7903, 6183, 3638, 2982, 2120, 1151, 760, -1476, -3375, -5820, -8938, -10140, -10891, -10141, -7287, -3942, 649, 5140, 8292, 11019, 11606, 10308, 9378, 6763, 4644, 3571, 2291, 2373, 2628, 2131, 2031, 1325, -346, -958, -2196, -2596, -1375, -659, 1804, 4185, 5237, 6591, 6295, 4214, 1787, -3021, -8000, -12721, -18026, -20300, -19013, -16951, -12055, -5463, -117, 5675, 8782, 10599, 11489, 9412, 8377, 6781, 4482, 3831, 2201, 682, -804, -3359, -5560, -8474, -9847, -10602, -10505, -8019, -4854, -1281, 3055, 6833, 9054, 10666, 10581, 9086, 7718, 5693, 4219, 3448, 2482, 2700, 2537, 1567, 1208, -135, -1409, -2263, -2700, -1930, -807, 1248, 3826, 5417, 6734, 6810, 5420, 3138, -495, -4955, -9472, -13839, -17708, -19477, -17593, -15224, -10700, -4273, 372, 5391, 8667, 10338, 11157, 9752, 9260, 7312, 5080, 4328, 1433, -278, -2437, -6010, -7628, -10007, -11018, -10227, -9088, -6054, -2334, 1177, 5045, 7909, 9633, 10420, 9729, 8378, 7088, 4839, 3813, 3058, 1706, 2062, 1047, 2, -153, -1586, -2107, -2068, -1769, -161, 1446, 3623, 5554, 6412, 7005, 6156, 4377, 1612, -1654, -5445, -9409, -12653, -16185, -18222, -16414, -14656, -10942, -4994, -641, 4633, 8177, 10266, 11599, 10614, 10247, 8440, 5482, 4341, 1302, -1580, -3649, -6732, -8443, -10268, -10427, -9532, -8443, -5310, -1687, 1372, 4708, 7815, 8890, 9518, 9742, 8354, 7388, 5992, 4617, 3580, 1792, 1044, -237, -1943, -2442, -3133, -3359, -2308, -1037, 953, 2979, 4692, 6045, 6632, 6669, 5705, 4394, 1966, -594, -3768, -7646, -10948, -14836, -18036, -17849, -16304, -13696, -7451, -2047, 3336, 8382, 10714, 12542, 11882, 11019, 9661, 6372, 4977, 2734, -714, -2425, -5308, -8101, -9648, -11010, -10302, -9515, -7151, -3102, -97, 3419, 6898, 8732, 9508, 9997, 9398, 8257, 6839, 5700, 4411, 2565, 1521, 114, -1708, -2924, -3041, -3623, -3016, -1143, -42, 2141, 3821, 4938, 6244, 5958, 5787, 4830, 2440, 599, -2698, -6464, -9586, -13683, -17282, -18604, -17252, -15369, -10458, -4231, 487, 6136, 9507, 11547, 12448, 11502, 10857, 8318, 6140, 4597, 920, -1268, -3909, -7708, -9218, -11091, -11062, -10104, -8244, -4539, -1412, 2141, 5544, 7591, 9058, 9831, 9612, 9232, 8242, 7338, 6029, 4159, 2649, 443, -1218, -3023, -3709, -4008, -3756, -2135, -1138, 812, 2541, 3614, 4959, 5542, 5442, 5057, 4097, 2153, -713, -4019, -7469, -11580, -15490, -18190, -17500, -16495, -13083, -6898, -2813, 3141, 7430, 9614, 11596, 11307, 11107, 9567, 7628, 5930, 2846, 84, -2339, -6037, -8078, -9674, -10446, -9622, -8183, -5226, -2487, 617, 3583, 5685, 7209, 8138, 8596, 8391, 8039, 7430, 6518, 5179, 3869, 2088, 346, -1078, -2180, -2531, -2682, -1859, -1101, -346, 1222, 2127, 2864, 3992, 4458, 3841, 4156, 2599, -156, -2607, -6407, -10162, -14318, -17498, -16635, -15851, -12961, -6588, -2649, 2209, 6266, 8122, 9683, 9477, 10097, 9250, 7804, 7170, 4872, 2120, -393, -3969, -6761, -9097, -9773, -9420, -8661, -5714, -3394, -1161, 1732, 3977, 5437, 6742, 7990, 8550, 8409, 8388, 7917, 6154, 4701, 2976, 849, -938, -2058, -2536, -3018, -2536, -1471, -1253, -133, 1164, 2213, 3128, 4404, 4513, 4282, 3216, 656, -2002, -5722, -9218, -12951, -16200, -16021, -14698, -12981, -7560, -3244, 685, 4383, 6831, 8614, 8414, 9820, 9860, 8482, 8425, 6177, 3703, 1058, -2599, -4959, -7839, -9292, -9269, -9542, -7347, -5388, -3554, -136, 1731, 3977, 6205, 7429, 8695, 9240, 9312, 9070, 7718, 6369, 4321, 2157, 724, -1446, -2297, -2776, -3412, -2560, -2133, -1034, -11, 1148, 2357, 2828, 3084, 3442, 2029, 185, -2008, -5119, -8661, -12380, -14950, -16211, -15521, -13289, -8716, -4545, 54, 3933, 6200, 8153, 8252, 9136, 9023, 8394, 8287, 6644, 5161, 3247, -185, -2265, -5193, -7321, -8120, -8688, -7206, -6365, -4060, -1503, -107, 2383, 4052, 5511, 7166, 8044, 9234, 9422, 8757, 8203, 6055, 4341, 2495, 78, -659, -1852, -2299, -1818, -1826, -1192, -636, -80, 958, 1458, 2211, 2662, 2036, 1297, -692, -3091, -6091, -9635, -12716, -14412, -15007, -13818, -10662, -6833, -3146, 752, 3503, 5401, 6307, 7023, 7437, 6894, 6781, 6433, 4929, 3857, 1883, -8, -1963, -3860, -4536, -5529, -5279, -4459, -3914, -2508, -1508, 50, 1357, 2706, 4609, 5882, 6818, 7562, 7532, 6831, 6257, 5221, 4010, 2956, 2692, 1932, 1641, 1198, 849, 458, -308, 37, -131, 135, 1052, 1378, 1567, 1429, 481, -1104, -3047, -4971, -6808, -9287, -10380, -12011, -12567, -12096, -11007, -8813, -6573, -3268, -1010, 1052, 3219, 3836, 4409, 4912, 4757, 4888, 4404, 4544, 3682, 2597, 2614, 791, 58, -609, -1479, -1494, -1805, -1213, -872, -685, 122, 390, 734, 1719, 2312, 3003, 3510, 4109, 4281, 4584, 4862, 5231, 5562, 5503, 5781, 5670, 4890, 4537, 3263, 2390, 1062, -29, -357, -1602, -1818, -2224, -2709, -2620, -3084, -3494, -3144, -3836, -3654, -4932, -5641, -6825, -8576, -8882, -9503, -9104, -8370, -7216, -5807, -4633, -2959, -1804, -479, 740, 1687, 3078, 4130, 4763, 5476, 5278, 5360, 4050, 3635, 2459, 1657, 1360, 745, 623, 55, -73, -170, -140, -58, 433, 802, 1562, 2068, 2708, 3354, 3547, 4115, 4591, 4174, 4472, 4255, 4015, 3958, 2927, 2644, 1550, 786, 170, -843, -782, -1239, -1016, -1399, -862, -713, -273, -263, -390, -433, -1461, -1825, -2429, -3502, -3885, -4409, -4698, -5461, -5584, -5391, -5524, -4938, -5372, -4057, -3877, -2640, -1807, -849, -44, 461, 1529, 2192, 2320, 2961, 3006, 2463, 2437, 2343, 1769, 1813, 1468, 854, 982, 722, 870, 893, 1000, 1662, 1094, 1945, 2002, 1778, 2239, 2196, 2167, 2416, 2333, 1773, 2120, 1078, 857, 495, 248, 763, 258, 498, 844, -88, 458, -325, 2, -628, -794, -575, -722, -1578, -1807, -1373, -2740, -2011, -2524, -2737, -2607, -2547, -1981, -1826, -1779, -1468, -1968, -2062, -1808, -1920, -1899, -1071, -1409, -218, -157, 117, 776, 159, 748, 1192, 664, 1636, 1847, 1659, 1619, 1578, 1378, 1005, 584, 771, 852, 407, 1644, 489, 765, 674, 651, 813, 896, 932, 1471, 1808, 1240, 1839, 1567, 1942, 1287, 744, 656, 586, 373, 599, 203, -580, -594, -1810, -1369, -1789, -2010, -1279, -1690, -1542, -1578, -1281, -1289, -643, -1323, -737, -675, -763, -740, -1308, -638, -625, -1201, -245, -786, -187, -446, 555, 39, 619, 291, 711, 726, -97, 873, -295, 338, 106, 542, -148, 70, 70, -375, -304, 127, 591, 32, 476, 412, 177, 354, 651, 346, 154, 437, 172, 891, 771, 604, 398, 104, 265, 336, 515, 235, 654, -45, -253, -427, 183, -65, -393, 75, -138, -695, -497, -601, -953, -1055, -911, -401, -435, -385, -388, 247, -386, -388, -151, -213, 635, -247, 1003, 657, 1185, 506, 1021, 839, 805, 825, 256, 1282, 196, 399, -10, 32, 435, 385, 1133, 808, 570, 437, 190, -343, -39, 390, -42, 1049, 463, 360, 385, 370, 469, 688, 825, 990, 1041, 1037, 869, 284, 162, 568, -244, 312, -245, -45, -448, -523, -1062, -808, -1357, -854, -946, -782, -724, -508, -870, -182, -1088, 28, -349, 50, -67, 198, -253, 308, 446, -102, 636, 263, 622, 73, 477, 734, 398, 123, 369, 571, 807, 615, 631, 998, 748, 325, 674, 424, 117, 651, 49, -3, -104, -177, 255, -630, 104, -196, 417, -232, 627, -122, 114, -93, -619, -151, -166, -140, -302, -653, 18, -813, -518, -864, -643, -1000, -726, -869, -1229, -617, -942, -76, -619, -294, 437, 153, 177, 302, 570, 456, 609, 542, -255, 140, -286, 894, 47, 253, -68, -182, 399, -21, 76, 122, 359, 266, 742, 562, 391, 726, 313, 464, -5, 545, 487, 122, -8, 167, 115, 18, -13, -240, -112, 175, -109, -83, -52, -476, -91, -214, 287, -769, -373, -630, -429, -977, -508, -727, -1151, -555, -1078, -354, -670, -344, -446, -278, 86, -255, -149, -396, 276, -310, 73, -310, 80, -265, -120, -16, -198, -294, -13, 130, 58, 141, 97, 357, 506, 456, 307, 713, 256, 557, 477, 247, 714, 198, 485, -154, 224, 164, -308, -234, -424, 318, -724, 125, -420, 63, -177, -89, 52, -456, 84, -813, -109, -773, -42, -677, -599, -182, -438, 58, -451, -183, -407, -200, -696, -123, -252, -287, -109, -175, -206, -250, -510, -177, -432, 91, -677, -378, -112, -211, -11, -294, -162, 372, 200, 80, 528, 656, 789, 607, 795, 440, 693, 672, 287, 299, 529, 179, -179, -122, 32, -222, -170, -378, -482, -297, -411, -125, 18, -253, -205, 339, -239, 29, -417, -162, -258, 11, -244, -131, -37, -242, -295, -122, 23, -294, -253, -271, -140, -489, -351, -640, -252, -455, -174, -240, -372, -526, -203, -295, -75, -354, 39, 239, 477, 198, 847, 106, 615, 308, 336, 654, 403, 643, 232, 662, 135, 297, 258, 209, -80, 383, 209, 19, 63, 80, 68, 297, -378, -164, -245, -487, -253, -307, -505, -325, -252, -54, -258, -88, -187, 390, 138, 146, 203, 80, 201, 88, -42, 34, -97, -388, -68, -432, -339, -203, -524, -172, -667, -94, -666, -505, 31, -88, 93, 330, 37, 106, 96, 414, 396, -31, 122, 169, 391, 265, 610, 47, 23, 495, -119, 289, 94, 407, 455, 256, 367, 442, 193, -326, 383, -545, 131, -859, -307, -549, -481, -526, -334, -235, -666, 115, -308, -86, 81, -117, 281, 141, 445, 39, 325, 55, -148, -47, -192, -44, -394, -229, -282, -133, -177, -29, -266, 214, 63, 62, 161, 268, -10, 57, 88, 50, -169, 258, -166, -237, 101, -3, 89, -123, 81, 32, 146, 169, 370, 65, 515, 164, 96, 206, -159, 8, 29, -276, -68, -135, -162, -144, -2, -55, -336, -68, 15, -135, -213, 151, -330, 49, 291, 218, -261, -284, -273, -143, -424, -21, -481, -203, -234, 39, -149, -167, 164, 214, 28, 265, 420, 208, 295, 156, 360, 57, 190, 307, -54, -36, -104, 15, 49, -432, -218, 198, -130, 39, -162, -32, 102, 37, 93, 15, 174, 11, -526, 399, -313, 607, -68, 200, 336, 430, -65, 88, 190, -135, 349, -28, 411, -226, 282, 222, -208, -167, -185, -323, -411, -148, -445, -123, -552, -114, -437, -172, -131, 128, -347, 13, 218, -26, 300, 208, 47, 196, 203, 149, 216, 119, 21, 117, -141, 177, -16, 235, -229, 198, -26, -89, -149, 157, -269, 169, -140, -351, -221, -198, 32, -216, -161, 263, -52, 339, -260, 494, 284, 185, 11, 641, 409, 157, 500, 125, 104, -21, 161, -518, -21, -227, -93, -195, -338, -125, -141, -536, -3, -244, -71, 84, 119, -5, -57, 313, -24, -119, 188, -185, -62, -333, -123, -45, 60, -216, 218, -172, 307, 106, -36, 414, 187, 268, 44, 24, 213, 127, -128, -47, -57, -278, -133, -36, 182, -102, 153, 644, -192, 39, 200, 36, 523, -52, 435, 250, 47, 127, 130, 81, 67, 588, -463, 140, 164, -328, 54, -153, 26, -18, -80, 42, 206, -99, -182, 414, -529, -166, -10, -183, 109, -6, -143, -154, -138, 135, -237, 313, 119, 28, 255, 106, -154, 0, 498, 71, -253, -195, -140, -266, 179, -57, -234, 151, 425, 21, 159, -130, 135, 282, -52, 680, -50, 516, 224, 453, -377, 130, -131, 248, -128, -65, -291, -76, -130, 54, -119, 8, -112, 11, -349, 156, 247, -307, 240, 208, -386, 47, -256, 245, -135, -15, -284, -37, -127, -216, 62, -6, -39, 367, -68, 15, 123, -83, 338, -143, -151, 282, -157, -214, -229, -190, -330, -203, 29, 115, -89, -24, 464, -341, 359, 195, 307, 369, -206, 245, 265, 240, -41, -167, -128, -39, 226, -352, 167, -364, -466, 328, -317, -266, 180, 177, -37, 544, -312, 328, -354, 498, 63, 235, -276, 81, -278, -47, -34, -159, -175, -41, -544, 159, -617, 2, -19, 140, 276, -8, 406, -125, -138, 250, -104, 325, -584, 237, -144, -55, -119, 138, 122, 297, -185, -209, 101, -41, 386, 115, 330, 36, -57, -19, 305, -136, -211, 518, -313, 140, 91, 260, -32, -719, 404, 110, -23, -343, 70, 240, 300, -369, 489, -258, 187, -477, 359, 68, -104, 344, -461, 550, -531, 255, 351, -138, 97, 166, 667, -148, -75, -213, -205, 183, -279, -287, -188, -708, 41, -18, -115, 198, -349, 373, 466, 221, 263, -169, 484, 123, 232, 203, -235, 346, -721, -190, 128, -942, -601, 47, 205, 10, 321, 209, 172, 187, -432, 367, 125, 128, -154, 349, 339, -110, -312, 172, -349, -201, 407, -352, -101, -531, 195, -161, -580, 359, -346, 468, -149, -903, 232, -13, -128, 323, 354, -351, 62, 372, -682, -396, -106, 302, -250, 154, 179, 94, -141, -60, 393, -227, 159, 154, -672, -175, -102, -338, -159, -269, 70, -459, 304, 672, -362, -63, 318, 386, -636, -321, 365, -41, 313, -97, 359, 907, 2, 459, 13, -13, 182, -219, -60, -156, 31, -550, -560, -80, -281, 326, -291, 44, 393, 84, 328, 60, 719, 23, -159, 459, 339, -591, -372, 373, -474, -576, 471, 101, 8, 185, -305, 442, -180, -320, 365, -75, -68, 219, 331, 16, -239, 630, 133, 148, 156, 424, 2, -125, 119, 442, -180, -606, 669, 170, -362, -482, -339, 240, 286, 373, 490, -8, 330, 19, -370, -94, -273, 115, 312, 383, 346, -438, -401, -190, 19, -58, -58, -104, -231, -161, 54, 503, -136, 80, 218, -424, 364, 75, -351, 57, -330, 456, -519, -269, 287, -88, -320, -869, 679, 865, -513, 32, 320, 357, 5, -576, -563, 156, 321, 104, -448, -172, 154, -110, 81, -292, -208, -404, 211, 333, -201, -180, -279, -274, -117, 94, 232, 393, 307, -539, 115, 719, 523, -414, -211, 1003, 146, -672, -300, -106, 369, -57, 153, 325, -815, 170, -351, -844, -274, -237, 388, 11, 42, 198, 39, 1044, 419, 52, 159, 167, 552, 260, -196, -334, 318, -42, -477, -635, -959, -247, -508, -718, -403, -508, -260, -278, -42, 37, 656, 54, -362, 380, 666, 964, 442, -307, 619, 469, -651, -3, -808, -552, -378, -1547, -891, -557, -693, -614, -998, -519, 417, 67, 192, 542, 151, 722, 492, 648, 317, -799, -16, 55, -54, 229, 565, 680, 513, 140, 563, 427, -299, -542, -727, -619, -1360, -1841, -1568, -2078, -838, 297, -235, -15, -417, 601, 2321, 1414, 1515, 1802, -235, -765, -599, -857, -2411, -4459, -4870, -4641, -4088, -3547, -2146, -1773, -2838, -182, 3093, 5974, 6312, 6463, 8622, 8156, 8636, 8834, 8000, 5768, 2479, 2390, 1916, -209, -1107, -1903, -2411, -4599, -4409, -1995, -2523, -4701, -6237, -7659, -9201, -11558, -14781, -10898, -3497, -6554, -7143, -5180, -578, 6919, 5005, 8278, 8310, 3182, 4360, 4526, 7146, 2946, -3054, -2463, -4550, -3761, -4481, -2985, -2745, -5784, -1349, 3719, 6547, 7078, 6914, 10463, 10310, 10248, 12258, 11692, 7484, 3856, 4364, 3347, 860, -1667, -1950, -2146, -3813, -2078, -932, -1403, -1515, -5018, -5748, -8412, -10937, -10904, -18257, -19870, -7609, -4419, -6424, -5054, -1057, 9696, 10248, 10995, 15786, 6825, 2745, 2641, 5468, 3870, -8487, -10359, -11257, -10994, -8619, -7849, -4086, -6242, -4352, 4153, 8628, 11877, 12304, 12619, 12218, 10901, 12089, 11058, 6167, 1922, -101, 602, -1312, -2768, -1753, -1989, -812, 1141, 4063, 5484, 3440, 4471, 4914, 510, -2818, -8922, -13050, -19089, -27188, -15140, -7664, -13666, -10123, -8907, 3919, 11875, 9021, 18508, 11735, 3417, 6219, 5930, 8515, -2365, -10510, -8773, -12541, -11326, -7484, -3731, -5201, -8440, -10, 8524, 9872, 10101, 10672, 10927, 8810, 8628, 10344, 7058, 1362, -724, -403, 1554, 1748, 1391, 2370, 1282, 2313, 7156, 8807, 5128, 2216, 2390, 568, -3396, -7044, -11984, -17127, -24787, -27669, -12859, -4331, -8849, -7268, -3044, 9281, 13586, 10175, 17940, 9575, -966, 268, 1502, 5705, -5640, -13526, -10456, -13039, -8109, -2567, 1133, 318, -4763, 2422, 9703, 11961, 10185, 6292, 6071, 2674, 2143, 5716, 5135, 774, -1424, 662, 3058, 5919, 8086, 7541, 5034, 3438, 7287, 8706, 4771, 641, -1542, -416, -2284, -5627, -7778, -13539, -18607, -24146, -25292, -7859, 68, -5675, -4497, -2188, 7159, 11174, 8302, 14292, 4872, -5597, -2307, 78, 2370, -4795, -9898, -8247, -10373, -4302, 2922, 5041, 888, -4071, 1912, 6443, 7503, 7771, 3354, 1448, -420, 1714, 5542, 6823, 5909, 1929, 3422, 6523, 8187, 11083, 8291, 5011, 3269, 2898, 6362, 4818, 424, -1946, -1282, -878, -4219, -6321, -10042, -15852, -19104, -23985, -13172, 1149, -5028, -6063, -3407, 1013, 9565, 6497, 9474, 7255, -4198, -3222, -2016, 2693, 2026, -6781, -6466, -6632, -3219, 1222, 3558, 3273, -3122, -2136, 1989, 4274, 5617, 1795, 1774, 433, 1201, 6662, 6815, 7812, 6313, 5578, 8063, 8463, 10058, 8945, 4060, 2086, 1846, 3891, 2607, -817, -2222, -2229, -1547, -3552, -5055, -8451, -15593, -16206, -20787, -20763, -4375, -1964, -5172, -3709, -3010, 8398, 8398, 7828, 12938, 1433, -3141, -2060, 834, 5698, -4765, -6856, -5657, -7114, -1735, 81, 3937, -37, -4154, 1489, 3674, 6747, 6245, 3336, 3729, 964, 4219, 7588, 8571, 8862, 6800, 5898, 6933, 8102, 9044, 8044, 2828, -378, 981, 1523, 536, -2461, -3417, -3409, -5654, -4994, -5463, -11529, -14518, -16489, -21623, -13597, -1503, -3182, -2576, -4489, 291, 8745, 5550, 11237, 9196, -1805, -2279, -3015, 3683, 1958, -5854, -3817, -7992, -5731, -990, 1971, 4656, -899, -851, 2299, 4024, 7315, 6097, 5718, 4076, 3271, 6761, 7925, 9015, 8578, 6735, 5990, 5818, 6541, 7513, 4159, -339, -898, -52, -409, -2464, -3469, -3487, -4055, -5148, -5791, -7774, -12247, -13903, -17073, -16812, -3885, -2393, -5076, -1263, -3209, 3156, 4248, 4516, 10234, 1219, -3422, -2662, -1476, 2711, -2318, -1078, -1239, -5016, -1929, 994, 5445, 3471, 218, 2471, 3357, 4227, 4943, 6479, 5958, 2312, 3609, 6135, 7656, 7778, 6015, 6162, 5755, 5404, 6886, 5805, 2490, -18, -620, 843, 36, -1398, -3000, -4878, -5125, -6146, -6708, -9255, -12578, -14804, -18856, -12362, -3029, -5586, -3818, -4058, -2435, 4753, 2683, 7143, 7898, 474, -635, -1269, 2878, 1881, -2369, -1161, -4419, -3685, -2541, 555, 3315, 148, 810, 1992, 3555, 5688, 6180, 8333, 7120, 5330, 6641, 6998, 8641, 7919, 5791, 6136, 4167, 3745, 5349, 4208, 3429, 1159, 612, 604, -1398, -1437, -2510, -3857, -5953, -8609, -9649, -12529, -13253, -15865, -16994, -9416, -7763, -8615, -5394, -6253, 674, 2748, 2086, 8617, 5666, 2708, 2297, 2692, 5570, 1075, 1331, 1031, -1510, -1521, -2930, 1247, 1229, -352, 1601, 1312, 2654, 2177, 3344, 7167, 5774, 5545, 6281, 6403, 8119, 7028, 8117, 9432, 5951, 5229, 4894, 4122, 3656, 1656, 1256, -968, -4286, -5507, -6109, -5782, -7172, -8222, -9044, -10097, -11162, -12696, -10544, -6898, -7731, -6601, -6179, -5352, -1500, -2312, 945, 4571, 3002, 3075, 2304, 3438, 3265, 1679, 3430, 2508, 1802, -151, -568, 1063, 333, 1550, 2211, 2057, 2070, 1722, 3054, 4130, 4088, 5037, 5633, 5727, 5808, 5627, 6015, 6333, 5484, 4795, 4271, 3612, 2851, 2031, 1453, 362, -200, -1016, -1722, -2482, -3506, -3776, -3977, -4722, -6180, -7729, -8356, -9286, -10151, -9925, -9985, -9050, -9430, -9166, -6458, -4896, -3206, -1911, -891, 299, 247, 1924, 4036, 4852, 5110, 3869, 4221, 4013, 3896, 5057, 4873, 4536, 4071, 3719, 4607, 4474, 4643, 5737, 5856, 5989, 5643, 5990, 6148, 5787, 5323, 4696, 4461, 3700, 2404, 1958, 1003, 140, -537, -1563, -2231, -3297, -4609, -5657, -6903, -8810, -9929, -10708, -12369, -12896, -13062, -12670, -10946, -10437, -8541, -6138, -5200, -2477, -929, 753, 1807, 1907, 4023, 4878, 5278, 5617, 5315, 6302, 6063, 6313, 7612, 7073, 6891, 6507, 6404, 6896, 6680, 6445, 6213, 5619, 5177, 4580, 5044, 4787, 4156, 3916, 2683, 2580, 2057, 956, 724, -440, -1508, -2179, -3545, -4521, -5576, -6982, -8201, -10003, -10933, -10984, -12093, -12357, -12482, -11938, -9800, -9003, -7091, -5010, -3805, -1695, -282, 1440, 2995, 3177, 3586, 4304, 4795, 5209, 5247, 5670, 6141, 6606, 6966, 7609, 8081, 7865, 8343, 8300, 7575, 7701, 6632, 5916, 5344, 4136, 4037, 3320, 3000, 2836, 2206, 1675, 917, 542, -299, -1365, -1992, -2865, -4125, -5422, -6607, -7838, -9013, -10271, -11237, -11380, -11466, -11304, -11187, -10479, -9101, -7701, -5894, -4420, -3166, -1107, -6, 1289, 2695, 2851, 3966, 4482, 4644, 5279, 5125, 5833, 6295, 6526, 7313, 7375, 7729, 7700, 7606, 7817, 7183, 6701, 6200, 5693, 5052, 4084, 3646, 3140, 2659, 2446, 1606, 851, 481, -148, -667, -1370, -2289, -3070, -3997, -5242, -6172, -6745, -7782, -8877, -9575, -9914, -9904, -9917, -9661, -9190, -8240, -7050, -5974, -4407, -3136, -2062, -831, 58, 810, 1654, 2117, 2825, 3468, 3948, 4432, 4799, 5481, 5792, 6291, 6680, 6547, 6664, 6497, 6633, 6800, 6399, 5984, 5442, 5143, 4670, 4214, 3635, 2935, 2487, 2062, 1567, 1088, 388, -41, -433, -1206, -1732, -2399, -3093, -3682, -4521, -5135, -5526, -6172, -6925, -7370, -7729, -7721, -7614, -7765, -7317, -6907, -6435, -5659, -4789, -3698, -2696, -1766, -828, -36, 575, 1149, 1880, 2466, 2932, 3153, 3484, 3852, 4036, 4388, 4594, 4667, 4734, 4748, 5039, 5182, 5099, 5024, 4894, 4885, 4601, 4250, 4073, 3617, 3245, 2841, 2269, 2045, 1518, 938, 591, 125, -351, -782, -1273, -1685, -1813, -2063, -2532, -2862, -3318, -3623, -3917, -4521, -4951, -5154, -5362, -5498, -5722, -5794, -5482, -5278, -4758, -4224, -3583, -2672, -2112, -1508, -812, -346, 115, 562, 786, 1141, 1516, 1768, 2185, 2593, 2896, 3213, 3367, 3542, 3683, 3839, 3869, 3782, 3834, 3823, 3758, 3763, 3591, 3526, 3380, 2959, 2727, 2394, 2182, 1966, 1459, 1071, 744, 398, 81, -227, -599, -839, -1125, -1471, -1555, -1729, -2002, -2190, -2437, -2542, -2644, -2739, -2808, -2989, -3084, -3153, -3166, -3149, -3063, -2964, -2791, -2648, -2494, -2299, -2211, -1990, -1679, -1424, -1273, -998, -528, -104, 244, 609, 1010, 1365, 1640, 1888, 2112, 2271, 2419, 2641, 2786, 2763, 2646, 2588, 2549, 2372, 2188, 1929, 1795, 1630, 1506, 1383, 1256, 1172, 927, 778, 683, 635, 552, 455, 328, 200, 188, 45, 5, -50, -226, -180, -255, -420, -516, -627, -606, -748, -956, -1023, -1052, -1128, -1260, -1380, -1406, -1468, -1498, -1445, -1429, -1437, -1341, -1286, -1182, -1057, -982, -812, -620, -463, -256, -19, 109, 133, 211, 357, 508, 531, 536, 536, 503, 555, 495, 468, 445, 459, 547, 554, 560, 721, 870, 994, 1115, 1157, 1227, 1282, 1291, 1310, 1211, 1107, 914, 696, 619, 472, 237, -29, -339, -495, -628, -763, -870, -972, -982, -969, -956, -948, -925, -971, -927, -906, -912, -885, -893, -857, -870, -834, -860, -937, -994, -1029, -948, -959, -898, -781, -761, -583, -469, -325, -110, -70, 62, 234, 377, 515, 549, 610, 708, 766, 849, 875, 883, 851, 844, 950, 976, 961, 997, 1029, 1024, 950, 942, 904, 789, 705, 565, 471, 273, 52, -47, -175, -313, -438, -508, -518, -545, -497, -458, -455, -445, -437, -420, -461, -560, -659, -732, -851, -917, -982, -1094, -1156, -1183, -1050, -886, -776, -644, -500, -346, -166, 23, 175, 265, 334, 430, 571, 711, 786, 849, 865, 841, 817, 787, 771, 742, 687, 714, 729, 700, 670, 589, 593, 519, 463, 455, 399, 315, 226, 133, 62, -5, -96, -151, -216, -304, -351, -424, -505, -554, -620, -659, -687, -685, -644, -623, -606, -588, -495, -472, -459, -422, -416, -373, -320, -234, -187, -107, -70, -47, 15, 68, 175, 183, 226, 237, 256, 282, 302, 343, 394, 378, 429, 468, 500, 597, 641, 708, 766, 713, 690, 708, 679, 693, 669, 541, 364, 214, 73, -23, -154, -224, -235, -265, -287, -317, -297, -193, -133, -96, -229, -315, -399, -531, -550, -576, -552, -539, -576, -554, -532, -393, -273, -227, -159, -131, -106, -31, -6, 34, 115, 114, 157, 195, 226, 304, 341, 487, 623, 670, 877, 1192, 1685, 2308, 1984, 1255, 815, 498, 205, 63, 214, 218, -45, -3, -218, -331, -558, -506, -482, 808, 1136, 2, -1325, -1291, -599, -956, -938, -989, -599, 451, 1011, 2156, 1942, 420, 502, 1133, 1628, 649, -828, -1050, -782, -75, 258, 607, 1044, -109, -60, 950, 1143, 1325, 1185, 281, -239, -620, -653, -115, -607, -875, -1239, -1289, -672, -680, -323, -237, -742, -888, -792, -583, -28, -1211, -1763, -576, 109, 170, -37, 99, 1693, 1859, 1362, 580, -584, 211, 343, 68, -623, -1446, -1843, -1558, -1084, -742, -930, -849, -391, -88, 344, 782, 977, 984, 300, 336, 817, 628, 54, -545, -554, -240, -805, -437, 88, -474, -610, -183, 779, 1266, 661, 1282, 1341, 854, 718, 161, 54, -162, -883, -1362, -2123, -2123, -2336, -3050, -3278, -4028, -4308, -4485, -4521, -4859, -5748, -6464, -5807, -5792, -5968, -5472, -5315, -3888, -2651, -745, 1419, 2407, 3394, 4360, 5481, 6705, 6831, 6692, 6245, 5086, 4800, 4133, 3662, 3336, 1878, 1302, 909, 1128, 1881, 1859, 1956, 1823, 1830, 1752, 859, 49, -1144, -2021, -3136, -5641, -7352, -9896, -12076, -13773, -16352, -13722, -7739, -6989, -5096, -4646, -1047, 4250, 5138, 9964, 10935, 9453, 8589, 6019, 8362, 6459, 2429, -242, -4138, -4576, -6752, -6805, -5432, -6362, -5468, -5372, -2214, 1951, 3399, 6740, 8515, 10307, 12308, 12419, 13982, 13175, 11143, 9185, 6503, 5628, 3156, 1250, -435, -3312, -3633, -3961, -3718, -2346, -2500, -1403, -1942, -3588, -4328, -6755, -7911, -11948, -13390, -5744, -4203, -5248, -6133, -5003, 2377, 2456, 5295, 9120, 6252, 5049, 1818, 4805, 6576, 1984, 346, -3016, -4497, -6058, -6300, -2620, -4232, -5615, -5589, -3857, 1433, 2765, 5565, 7183, 6310, 7765, 8805, 11248, 10843, 8034, 7532, 5550, 4052, 3474, 2653, 1317, -1427, -2144, -1295, -989, -685, 93, 1117, 552, -88, 948, 1766, 354, -2039, -6516, -10041, -12549, -17078, -14297, -7315, -9132, -9021, -9258, -5037, 2878, 2006, 8438, 10240, 6856, 6958, 4567, 10183, 7810, 2888, 1211, -4334, -4886, -7419, -6263, -4265, -8485, -8266, -7878, -3716, 343, 1615, 6688, 6339, 7294, 7771, 9497, 12347, 9407, 8011, 5808, 3703, 4029, 1032, 2287, 813, -3208, -2143, -2269, -763, 26, -391, 2039, 690, 810, 2010, 2229, 1131, -1659, -4657, -9581, -10932, -15115, -17687, -10497, -8593, -10445, -8875, -8123, 981, 2396, 5193, 11099, 8497, 9062, 6737, 8003, 11029, 3365, 2005, -1726, -4276, -6468, -8347, -4680, -6971, -8420, -7781, -6076, -498, 568, 4666, 7778, 7807, 9200, 9534, 12167, 11808, 10146, 9175, 6360, 4359, 2619, 1336, 971, -3109, -2602, -3094, -3010, -1698, -1911, 391, 821, -719, 745, 1372, 1399, -1024, -3653, -5422, -8950, -10696, -16041, -17776, -11031, -9906, -9672, -8687, -8156, 425, 776, 5130, 12039, 9403, 10330, 6990, 8524, 10984, 5748, 4341, -537, -1951, -5724, -7094, -4453, -6724, -7265, -7755, -5643, -2024, -2274, 2641, 6339, 6982, 8505, 8843, 12028, 12315, 10904, 9896, 8182, 6494, 3706, 3037, 1948, -1096, -1982, -3169, -2050, -1266, -1313, -167, -80, -544, 563, -162, -28, -542, -2489, -4245, -7016, -9693, -12166, -16201, -16013, -9554, -9961, -9269, -9602, -5787, 261, 1440, 7399, 9024, 8648, 7507, 6625, 11266, 8544, 6193, 4339, 138, -1373, -4979, -4193, -3602, -6427, -6620, -7369, -4495, -3036, -1446, 2955, 4031, 5456, 6192, 8596, 11657, 10930, 10182, 9192, 7104, 5339, 4544, 4925, 2620, 291, -1188, -1773, -1003, -838, -1010, 502, -138, -1067, -183, 119, 58, -1058, -2756, -3899, -5481, -7964, -9765, -13255, -15097, -12138, -9917, -8373, -9174, -9226, -4771, -2068, 2156, 4227, 5021, 5906, 4685, 7760, 7687, 7950, 7151, 3997, 3058, 524, 305, 656, -1440, -2511, -4144, -3958, -3287, -2599, 114, 60, 1127, 1646, 3510, 6107, 5679, 6099, 6617, 6331, 6872, 5745, 6521, 5641, 3529, 3295, 2398, 2258, 1687, 542, 708, -333, -1195, -536, -766, -99, -1594, -2857, -3268, -4448, -4481, -5414, -7216, -8364, -11175, -12188, -9091, -8481, -7601, -7670, -7693, -5106, -4390, -1377, -183, 974, 1333, 1563, 3524, 3972, 5179, 5500, 4698, 4412, 2909, 3013, 3448, 1903, 2062, 508, -1015, -1097, -482, 1343, 964, 729, 1638, 1834, 3443, 3474, 4885, 5815, 4695, 4860, 4633, 4765, 5305, 3903, 3133, 2857, 1672, 2073, 1177, 732, 627, 416, 130, 6, -873, -1357, -1102, -1713, -1883, -3024, -3458, -3794, -4679, -5906, -6718, -7935, -7828, -7304, -7769, -6766, -6750, -6578, -5914, -5086, -3058, -2182, -1146, -929, 200, 1818, 2302, 3419, 3151, 3455, 3422, 3471, 3593, 3692, 3351, 2151, 1404, 1135, 1591, 1635, 1334, 1015, 1218, 2446, 2646, 2760, 3664, 3601, 3959, 4128, 4812, 5326, 3912, 3627, 3201, 2511, 2552, 2429, 2256, 1773, 883, 377, 711, 346, 403, -782, -247, -453, -1396, -1442, -1760, -1484, -2312, -3518, -3312, -3886, -3550, -4359, -5076, -4495, -4394, -4182, -4529, -3708, -4084, -3997, -3568, -3153, -2696, -2398, -1792, -1529, -1177, -445, -52, 682, 584, 1568, 2036, 1857, 2401, 2550, 2886, 3240, 3304, 3459, 3354, 3144, 3554, 3078, 3076, 3109, 2292, 2325, 2206, 1732, 1852, 1659, 753, 1287, 938, 899, 1070, 690, 940, 881, 867, 778, 791, 260, 343, 357, -312, -193, -503, -347, -563, -1037, -825, -1419, -1006, -1877, -2011, -2015, -2208, -2154, -2735, -3143, -3133, -2942, -2961, -3054, -3263, -3076, -2667, -2612, -2323, -1586, -1523, -995, -550, -106, 386, 378, 833, 1151, 990, 1291, 1571, 2226, 2315, 2266, 2313, 2006, 1804, 1732, 1916, 1708, 1409, 1029, 1123, 917, 953, 1299, 1107, 938, 365, 1192, 821, 1231, 1011, 492, 1060, 675, 732, 828, 748, 440, 39, -84, -232, 240, -555, -609, -463, -1084, -706, -1122, -891, -1156, -1229, -1180, -1295, -1450, -1443, -1838, -1674, -1417, -1466, -930, -1211, -813, -920, -349, -503, -97, -218, -32, 19, -99, 375, 179, -130, 140, -279, 174, 39, 174, 96, -71, -99, -151, 99, -8, 323, 58, 281, 446, 667, 211, 761, 899, 990, 776, 709, 1131, 786, 834, 821, 709, 881, 291, 224, -93, 391, 276, -424, -182, -300, -222, -554, -219, -344, -1032, -565, -1167, -779, -541, -968, -805, -805, -550, -721, -157, -330, -310, 57, 188, 344, -49, 531, 390, 32, 807, 359, 610, 411, 156, 177, 196, 351, 141, 281, 247, 506, 297, 820, 440, 672, 497, 682, 659, 782, 692, 375, 609, 735, 498, 955, 60, 864, 523, 825, 685, 326, 601, 291, -37, -94, 169, -528, -294, -675, -677, -917, -1203, -1036, -1067, -976, -781, -606, -438, -716, -172, -352, -16, -539, -42, 34, -310, -26, -359, -229, -250, -442, -5, -73, 84, 28, -250, 164, 146, 341, 23, 568, 542, 695, 758, 667, 867, 458, 700, 631, 419, 481, 427, 567, 247, 524, 487, 515, 471, 485, 403, 484, 635, 179, 232, 476, -206, -323, -333, -659, -606, -680, -1266, -1185, -1042, -1367, -1448, -1144, -1198, -946, -1016, -940, -495, -1000, -297, -615, -714, -302, -182, -597, -237, -159, -323, -669, -318, -442, -226, -433, -310, -97, -412, -146, 13, 169, 287, 318, 179, 558, 281, 940, 256, 503, 529, 510, 420, 494, 396, 782, 312, 362, 409, 518, 554, 705, 479, 284, 255, 287, 140, 49, -106, -646, -346, -826, -666, -942, -627, -1094, -654, -687, -802, -916, -623, -805, -339, -456, -386, -52, -562, -52, -23, -231, 8, -127, 122, -115, -58, -166, -276, -102, -211, 88, -131, -156, -47, 266, 343, 312, 227, 164, 279, 791, 407, 490, 433, 351, 571, 174, 763, 547, 518, 656, 524, 474, 519, 643, 364, 482, 180, 338, 154, 75, -57, -138, -198, -430, -128, -524, -222, -481, -381, -122, -529, -307, -502, -339, -224, -221, -83, -459, 11, -253, -326, -188, -381, -24, -110, -562, 239, -140, -281, -19, -71, 101, 156, 391, -141, 502, -15, 609, 208, 169, 627, 570, 479, 503, 419, 609, 411, 218, 414, 274, 291, 304, 49, 71, -88, 179, -219, -10, -170, -130, -73, -557, 89, -313, 213, -234, -148, -86, 140, -354, 32, -24, 268, 218, -89, -13, -97, 219, -201, -193, 55, -240, -31, -711, -84, -227, -271, -385, -476, -317, -55, -195, -193, 175, -190, 2, 28, 205, 146, 144, 443, -32, 422, 468, 396, 292, 334, 347, 602, 494, 106, 367, 331, 489, 274, 151, -28, 252, -89, 52, -508, -286, -128, -430, -344, -343, -545, -586, 192, -315, 24, -250, -286, -81, -2, 427, -279, 343, 54, 485, 362, 76, 172, -153, 373, -539, 531, -674, -71, 269, -638, -245, -459, -271, -214, -73, -101, -438, 29, -19, 154, 331, 65, 523, 256, 372, 497, 343, 453, 174, 385, 198, -21, 57, 156, 157, -42, -174, -49, -49, -534, 80, 357, 60, -323, 120, -192, 63, -265, -65, 75, 49, -274, -99, 62, -219, 365, -60, -333, -5, -84, 356, -146, 13, 58, 162, 101, -89, 28, 117, -430, 83, -99, -224, -244, 107, -60, 123, -143, -268, 237, 115, 200, 380, 131, 255, 278, 383, 148, 263, 286, 260, 110, 208, -227, 263, 180, -54, -286, -41, 47, -15, 42, -234, 250, 6, -73, 289, 271, 196, 281, -240, 344, -390, -214, 21, -237, -71, -416, 41, -416, -91, -31, -708, -99, -370, -112, 23, 334, -151, -110, -294, 16, -91, -143, -28, -346, 205, -18, -58, -144, 269, -83, -347, 299, 131, -16, 206, 125, 157, 144, 393, -19, 218, 187, 318, 52, -68, 26, 26, 273, 8, 120, -245, -89, 65, -268, 266, -135, 167, -86, -83, 224, 166, 433, -273, 157, -54, 180, -245, -192, -508, -420, -244, -71, -307, -427, -323, -36, -41, -172, -94, 78, -143, 80, 58, 135, -153, 330, -164, -21, 55, 291, -175, -231, 565, -99, 302, 29, 68, 60, 201, 76, -356, -127, 75, -36, -341, -141, -443, -144, 356, -172, 375, -364, 153, 266, 401, 347, -135, 63, 502, 407, -109, -110, 104, 252, 125, 0, -148, 308, -255, -198, 151, 357, 352, 78, -263, -222, -138, -2, -209, -185, -388, 58, -75, -193, 188, 292, -545, 242, -187, -174, -170, 360, 489, 291, 573, -49, -71, 459, 474, -206, -39, -208, -101, -157, -101, 75, 258, 494, -185, -146, 135, -580, -60, -115, -58, -638, -170, -817, -203, 250, 294, -34, 193, 164, 601, 635, 430, 622, 76, 88, 161, -75, 800, 198, 185, -195, 78, 131, -317, -787, -596, 214, -519, -471, -565, -242, -815, 312, 406, -287, -154, -222, -104, 141, 187, -70, -365, -227, -99, 482, -117, 541, 0, 666, -200, -102, 146, 263, 430, 128, 57, 162, 240, -644, -97, 375, -183, -10, -140, 680, 696, 487, -560, -135, 685, 536, 455, -424, 200, 393, 550, -276, 370, 365, -24, -42, 78, -175, -438, -60, -310, -558, -265, -648, -398, -593, -235, -412, -286, -1313, -555, -341, -438, -367, 130, 292, -942, -607, -76, 44, 346, -570, -705, -192, 239, -174, -820, -599, 516, 248, -321, -516, -394, 536, -49, -542, -778, -127, 339, 352, 532, 1041, 1151, 891, 701, 1117, 1045, 177, -336, 313, 28, -76, -248, -388, 214, 515, -367, 498, 269, 28, 438, -133, 193, -321, -1149, -299, -839, -727, -752, -830, 67, 83, 37, 162, -377, -67, -370, -981, -541, 45, -565, -1253, -685, -532, -422, 349, 299, -133, 232, 1154, 1674, 953, 315, 503, 1218, 325, -1278, -299, 623, -68, 701, -258, -651, 872, 581, 193, 456, -386, 343, -174, -1365, -295, -545, -844, 494, -1086, -1166, -547, -1156, -84, -484, -1388, 479, -119, -612, -188, -615, 67, -232, -1213, -1162, -1125, -505, -766, -1547, -865, -778, -745, 534, 450, 1089, 1701, 1690, 3143, 2943, 3550, 3890, 3226, 3565, 2966, 2169, 1880, 1481, 2226, 1341, 627, 606, -169, 433, 323, -1266, -1458, -2084, -3276, -5196, -5666, -7544, -9417, -7062, -5800, -6219, -6885, -8339, -4377, -153, 1226, 3953, 2242, -159, 768, 1448, 2826, 2227, 903, -330, -1856, -2002, -633, 2472, 2942, 1555, 808, 1429, 4344, 6281, 6278, 5252, 4331, 4320, 4695, 5557, 3997, 3146, 3281, 1933, 1505, 1823, 3227, 3896, 3628, 3297, 3448, 6292, 6252, 4692, 3398, 1502, 484, -1907, -3761, -7149, -11430, -15485, -19273, -22761, -28593, -18860, -2357, 459, 938, 1854, 10972, 16630, 14205, 21159, 15336, 1269, -6813, -10818, -5654, -10138, -14643, -12997, -15782, -10622, -3317, 8761, 17718, 12338, 12302, 13946, 13854, 12789, 7380, 4339, -2458, -8701, -9547, -8416, -4250, -3016, -442, 3352, 5560, 11338, 14216, 14299, 12096, 6893, 5386, 2675, -1998, -3146, -3315, -4917, -5463, -3029, -1109, -2427, -5326, -6619, -10539, -13084, -14352, -25250, -18305, 394, 375, 3638, 3821, 5567, 15620, 10148, 13201, 12180, -4583, -10287, -14221, -9987, -8851, -13632, -6890, -6617, -3341, 4276, 10250, 18026, 12752, 7719, 6635, 3002, 1375, -2221, -3532, -6794, -9221, -4791, -372, 5149, 7873, 9029, 12318, 11657, 9903, 10304, 8726, 3989, -2610, -6542, -4359, -3802, -3737, -265, 654, 2450, 3299, 3231, 4834, 2497, -16, -4453, -11990, -17188, -19253, -25727, -32393, -14331, 7278, 9886, 9672, 7992, 15062, 18279, 10899, 14502, 5031, -14724, -22722, -22500, -11773, -8985, -8911, -1604, -1654, 3894, 15146, 21339, 19346, 9872, 5930, -256, -6893, -5729, -6893, -6346, -7156, -7560, -255, 6156, 13406, 15063, 11487, 12669, 9346, 6420, 5718, -196, -3896, -6795, -7708, -2278, 1096, 2196, 3096, 2455, 5485, 7959, 4828, 1305, -1929, -4341, -7456, -10013, -12847, -19411, -21903, -29466, -26797, 3633, 18203, 15110, 12282, 7308, 13808, 10802, 4930, 7956, -10269, -27393, -25838, -16776, -4219, -136, 4737, 9807, 9102, 13036, 17550, 19221, 11589, -3675, -11016, -12828, -13023, -10669, -5869, 94, 2709, 7159, 13659, 17609, 18812, 12010, 4240, 1006, -3245, -3244, -2120, -4247, -3323, -674, 3229, 5763, 4041, 4981, 6716, 3984, 3468, 2815, -1471, -555, -1805, -4523, -3065, -9429, -12179, -13343, -21024, -25300, -29925, -8630, 22836, 19869, 12154, 8023, 8104, 11641, 297, 1351, -2979, -25516, -27658, -18599, -6349, 4240, 8268, 14094, 11607, 8442, 11760, 15188, 11130, -3054, -10714, -14343, -14753, -7844, -2381, 5109, 7291, 7609, 12507, 13291, 13755, 7216, 1117, 1575, -3843, -4919, -2544, -2365, 1898, 3661, 3644, 5318, 5144, 3990, 3195, 3123, 1468, 1005, 1625, -1505, 459, 4065, 528, -2265, -6563, -10917, -14882, -22872, -25143, -26300, -15765, 13119, 23755, 17044, 12148, 8365, 6659, -3018, -8274, -5776, -16825, -23893, -18521, -5693, 10490, 13927, 14445, 15619, 9510, 3006, -688, 1096, -2326, -10718, -13844, -11854, -1047, 6265, 10328, 12933, 7081, 8120, 6776, 354, 1002, -3911, -3930, 625, -3526, 4115, 8153, 3352, 8239, 7416, 6714, 2714, -5041, 459, 2565, -1503, -377, 3032, 6023, 3102, -1763, -508, 1195, -1776, -7096, -10382, -12958, -18190, -21706, -27161, -14545, 19765, 27852, 16364, 11183, 2317, -2437, -7541, -9248, -4393, -14438, -21698, -12317, 2016, 15015, 16115, 15247, 13929, 2299, -9060, -10549, -4054, -1094, -5815, -6084, -1584, 3068, 8244, 11943, 14391, 7836, -1703, -3203, -5825, -5597, -771, 3032, 5995, 3318, 5644, 9378, 6242, 6521, 994, -3370, 740, -3891, -5281, 998, 6505, 8304, 5244, 3799, 4205, 1711, -2425, -2278, -1849, -6911, -13086, -13834, -12354, -16950, -26526, -22347, 13287, 29266, 14789, 10987, 6896, 435, -9490, -13836, -2919, -7664, -18507, -10427, 1846, 11573, 14630, 12640, 12606, 3487, -9422, -12661, -5183, -1320, -4458, -698, 2360, 2716, 3318, 5250, 10484, 7183, 878, -1843, -6938, -4831, 3044, 6946, 5433, 4834, 4843, 4146, 2292, 476, 1218, -29, 31, 1367, 696, 2313, 3344, 5633, 7761, 5786, 2518, -70, -2508, -4914, -2458, -753, -7507, -12563, -12946, -12619, -17539, -27463, -17032, 19656, 27916, 10922, 11039, 4774, -4252, -6573, -11696, -8497, -10240, -17143, -5938, 5367, 10125, 15364, 13818, 12666, 2232, -13433, -11956, -5187, -4258, -3333, 1776, 3883, 2263, 4581, 10326, 11075, 5513, -3005, -5581, -4752, -4291, 3735, 6524, 5747, 7872, 3778, 2328, 1643, 761, 365, -3479, -1513, 5878, 3615, 831, 2795, 5632, 9917, 3646, -1162, 1890, 1151, -2481, -2563, 1830, -2576, -11976, -16494, -18778, -18656, -22096, -22002, 10794, 30882, 16479, 13453, 3862, -6002, -7963, -13956, -8318, -8584, -17666, -9636, 3657, 11672, 17219, 17339, 12312, 1625, -10731, -13420, -10933, -6443, -1448, 2102, 4188, 3719, 4287, 11386, 15107, 1619, -5019, -3800, -8615, -5101, -2081, 6427, 14406, 9045, 6536, 4925, 62, -1328, -828, -2258, -1846, 169, 2769, 6089, 8328, 6672, 7776, 5878, -234, -1843, -1459, 349, 649, -394, -1692, -7873, -11205, -13209, -18339, -23237, -28547, -9782, 23029, 22518, 15731, 11222, -1674, -8166, -10776, -6828, -2469, -16250, -18498, -1463, 7305, 12396, 17365, 17127, 7641, -7089, -12278, -11321, -7838, -3851, -906, 4502, 1794, 4544, 13656, 12604, 6987, 432, -5813, -6555, -8102, -3468, 3661, 5990, 7825, 6703, 6688, 6193, 4810, 979, -4407, -2479, 661, 282, 4719, 8841, 6753, 4135, 3347, 3537, 1841, -2732, -4761, -1800, -166, -4188, -3351, -4268, -10211, -16294, -22606, -26959, -27201, -5497, 27078, 25799, 13216, 7612, -2487, -5670, -9299, -5476, -4636, -19451, -15049, 825, 7593, 16606, 18670, 13914, 5188, -9443, -9682, -4430, -4148, -8893, -4752, 4625, 3201, 10257, 16792, 11847, 4951, -3070, -2755, -1506, -7237, -4031, 630, 4219, 4459, 7643, 10019, 4157, 6370, 5094, -3237, -5304, 81, 1505, 3227, 4534, 2828, 7102, 5646, 4154, 4607, -635, -3641, -5459, -7282, -4591, -3334, -9414, -13244, -14425, -15880, -23097, -31057, -9643, 28648, 22510, 10872, 8377, -974, -1935, -6907, -982, -2364, -23930, -20169, -3214, 9208, 16096, 10734, 10575, 7552, 576, 1359, 5388, -4836, -17757, -9971, 982, 3224, 8886, 10273, 8583, 9265, 6554, 8156, 6549, -6047, -8484, -5192, -1115, 6123, 2644, 3877, 6976, 6451, 10042, 3867, -2187, 1078, -438, 1078, 969, -373, 5156, 5019, 4310, 6492, 2657, -2461, -4318, -4149, -6682, -7883, -9700, -13257, -14641, -16018, -16075, -24479, -21146, 17253, 24385, 7682, 6917, 3097, 10586, 2456, -5924, -670, -19567, -25784, -9231, 3625, 10412, 5390, 7844, 14722, 13024, 8450, 4049, 724, -15037, -16761, -3550, -776, -1211, -403, 6000, 11586, 12828, 12705, 9388, 2407, -4687, -3851, -2682, -2086, -3844, -5380, 1351, 6370, 8724, 9979, 5524, 5680, 6482, 2071, 1057, 620, -183, 438, 1946, 3409, 3682, 2722, 65, 1005, 1787, -4507, -11920, -12703, -14451, -18404, -18968, -18778, -25148, -13755, 19058, 18002, 7623, 8507, 9940, 16524, 3112, -5007, -4359, -20912, -22378, -9125, 2253, 2240, -2508, 9429, 15248, 17174, 14028, 4159, 1041, -8586, -10039, -3123, -5849, -10107, -8898, 4821, 11054, 9536, 12776, 10846, 7394, 5234, 3208, 2367, -4412, -9813, -6594, -1481, 1239, 248, 2756, 8726, 9244, 10925, 5877, 3925, 7146, 2567, 2247, 1818, 284, -1346, -3326, 1693, 881, -3740, -4752, -9774, -10489, -12122, -18153, -18753, -19959, -27727, -10369, 17495, 7852, 1231, 10208, 16745, 22258, 8997, 2682, -3198, -19011, -15487, -7149, -6190, -14799, -11873, 5333, 14602, 15830, 13643, 11141, 4594, 2265, 4834, 890, -5830, -15276, -11127, -315, 1299, 3495, 4580, 8135, 7945, 6075, 11365, 6615, 359, -2591, -1492, -1403, -4485, -5589, -1979, 5836, 4464, 5930, 5558, 6148, 12080, 7987, 6781, 5062, 1154, 1188, 102, 3252, -2594, -10276, -9640, -10227, -10974, -13869, -17906, -21461, -19294, -21977, -9898, 17830, 8091, -1305, 6224, 14188, 24860, 10597, 3506, -1756, -12956, -10802, -6369, -2206, -15429, -17964, -1825, 8302, 11760, 5982, 10834, 9890, 3479, 9166, 7906, 4911, -6781, -10870, 112, -1437, -2469, -2784, 2591, 5300, -617, 5781, 5568, 2310, 4416, 6372, 4669, -2015, -3925, 542, 6308, 4078, 1282, 1136, 1487, 5885, 7237, 8378, 5641, 3601, 3068, 2924, 5945, 896, -5112, -8872, -10753, -12170, -17312, -18800, -20632, -22054, -26518, -16667, 13010, 9674, -2115, 6765, 16981, 26536, 16860, 9562, 5722, -8698, -9200, -3226, -4248, -17576, -24075, -9674, 1510, 3065, 2433, 6532, 9935, 7609, 13721, 17709, 7760, 289, -3003, 1119, 4172, -5000, -8101, -5195, -3677, 542, -318, -1468, -1164, 555, 9971, 8607, 3786, 5537, 4365, 7211, 7880, 3198, 394, 789, 2226, 4557, 1833, -761, 2883, 2875, 3117, 2942, 1041, -1857, -5013, -5045, -9838, -13888, -16438, -19143, -22601, -28356, -12864, 3833, -3450, -5076, 5932, 20284, 20830, 17959, 19693, 7507, -266, 1466, 6203, -735, -21507, -21557, -11742, -5049, -5713, -9907, -2843, 1601, 4224, 13252, 16234, 9828, 6753, 10977, 11045, 6917, 1333, -768, -2756, -5882, -2429, -4708, -8789, -6367, -4041, 3000, 2812, 584, 5052, 7458, 9731, 11302, 7951, 5734, 5924, 6565, 6128, 1268, -2086, -1070, -1821, -1084, -2529, -5544, -6377, -7539, -7825, -8185, -8977, -10945, -16641, -22039, -15976, -198, -1596, -9757, -4942, 7218, 14357, 10446, 13075, 13382, 4474, 5578, 9813, 8984, -1664, -11838, -8955, -3903, -4885, -9729, -10942, -8567, -4622, 992, 4049, 5731, 3886, 7265, 14508, 13477, 10791, 8797, 6356, 4201, 3242, 2294, -4581, -8425, -6237, -4011, -4911, -5093, -2021, -188, 1982, 5234, 7294, 7805, 8104, 9594, 10714, 8774, 5430, 3718, 3200, 2021, -1304, -3287, -5143, -9089, -11039, -11437, -11627, -13274, -15672, -18823, -22341, -12589, -3286, -6666, -7096, -2610, 7854, 11890, 10248, 12464, 9821, 9458, 10729, 11627, 8338, -1768, -4218, -2555, -2416, -5995, -11765, -10398, -8526, -7950, -4865, -2089, -1320, -547, 5435, 10841, 12206, 12198, 11430, 10990, 10531, 11114, 6971, 1205, -1500, -2138, -1282, -4782, -6911, -6328, -4920, -1097, 307, 1455, 3740, 4862, 6963, 8633, 10362, 9492, 5536, 6580, 5979, 2044, -614, -3503, -5573, -9219, -11359, -11810, -15795, -19320, -22055, -17013, -8508, -12119, -13325, -7713, -695, 5008, 4549, 7826, 9675, 8847, 12031, 14476, 12969, 7054, 4442, 4979, 3958, 224, -4880, -7273, -9620, -9383, -6472, -6761, -8867, -9373, -4339, 2036, 4010, 5041, 6935, 9396, 10489, 12409, 13422, 9755, 6130, 5213, 5547, 2307, -839, -1317, -2206, -2878, -2481, -1633, -885, -44, 203, 2166, 3609, 3016, 3825, 4599, 4550, 2274, 718, 1468, -299, -4464, -7672, -7821, -7718, -10828, -14606, -15380, -10857, -9198, -11443, -10890, -7873, -3581, -1464, 269, 2331, 3502, 6008, 8028, 9843, 8813, 7750, 7732, 6281, 5440, 4086, 3500, 485, -3972, -3495, -2739, -3002, -5143, -6766, -4117, -2872, -1888, 623, 2175, 3554, 3169, 3992, 5872, 6271, 5901, 4945, 4481, 4286, 4687, 5331, 3833, 2443, 1946, 2024, 2782, 1628, 795, -86, -427, 1274, 1846, 1664, -187, -823, 237, 174, 779, -1135, -3700, -4278, -4976, -5279, -6989, -8916, -9378, -9096, -8099, -8052, -8349, -7099, -4924, -3437, -1807, -1188, -732, 946, 1578, 3067, 4839, 5015, 4430, 3282, 4795, 5351, 4331, 2532, 753, 718, 151, 588, -455, -1893, -1339, -1317, 584, 1459, 1536, 2534, 2149, 3058, 3318, 2377, 2680, 2117, 1664, 1073, 792, 2016, 2154, 1670, 1945, 2279, 3198, 3231, 2237, 1971, 2558, 2291, 1463, 1276, 1096, 799, 920, 886, 550, -182, -294, -359, -1313, -1841, -3130, -3701, -4726, -5859, -5492, -5937, -6628, -7586, -7177, -5568, -6128, -6091, -4654, -3123, -2870, -2820, -1073, 201, 1385, 1476, 1714, 2333, 2352, 3057, 2828, 2471, 2088, 1445, 1482, 1664, 1752, 1594, 1911, 2042, 2164, 2774, 2964, 3162, 2334, 2089, 2263, 2078, 1981, 1369, 1432, 1351, 1032, 1299, 971, 1247, 1628, 1216, 1451, 1042, 916, 1166, 1315, 805, 198, 318, 558, 558, 359, -84, -153, -323, -703, -886, -1200, -1834, -2537, -3299, -3167, -3302, -4442, -4799, -4831, -4362, -4481, -4356, -3847, -3635, -2497, -1906, -1763, -1682, -1156, -99, 317, -109, 10, -13, 677, 1433, 1518, 1761, 1571, 1549, 2177, 2856, 3221, 3010, 2484, 2833, 3336, 3282, 2769, 2653, 1700, 1224, 1032, 851, 573, 563, 727, 588, 627, 685, 875, 807, 497, 924, 1159, 1154, 951, 654, 1067, 852, 683, 604, 205, -167, -433, 409, 211, -744, -1265, -1672, -1378, -1067, -1726, -2599, -2859, -2513, -2635, -2929, -3102, -2718, -3011, -3104, -2513, -1909, -1672, -1881, -1094, -834, -596, 106, 393, 339, -248, 29, 886, 1097, 1094, 899, 1411, 1846, 1856, 2412, 2403, 2373, 2209, 2122, 1844, 1558, 1187, 1196, 841, 846, 904, 982, 1096, 781, 1094, 1060, 1080, 976, 1196, 1351, 1130, 1175, 1120, 852, 808, 583, 641, 370, 281, -330, -317, -440, -610, -854, -984, -972, -1506, -1735, -1532, -1234, -1125, -1286, -1831, -1568, -1729, -1617, -1963, -1899, -1786, -1641, -1417, -1235, -1015, -1177, -653, -800, -677, -776, -812, -586, -393, -503, -161, 128, 539, 711, 930, 1157, 1000, 1346, 1034, 1041, 912, 958, 519, 808, 589, 459, 672, 761, 547, 695, 1028, 1364, 1089, 1094, 1326, 1487, 1305, 1602, 1490, 1248, 1058, 972, 1000, 487, 425, 344, -70, -224, -481, -666, -555, -769, -747, -610, -805, -666, -870, -833, -752, -685, -995, -872, -1144, -758, -849, -849, -847, -724, -726, -640, -773, -1123, -998, -1362, -1117, -1291, -1093, -1091, -989, -593, -758, -278, -15, -325, -159, -222, -15, 141, -76, 80, 144, 360, 81, 464, 388, 532, 424, 526, 748, 823, 685, 768, 836, 1078, 1185, 916, 812, 1157, 1211, 1003, 969, 896, 695, 588, 685, 81, -91, -581, -179, -825, -784, -1021, -653, -854, -627, -622, -484, -453, -497, -78, 88, -99, 271, 218, -37, 205, 23, 172, -594, -131, -180, -446, -101, -531, -67, -550, -297, 112, -357, -205, -680, -234, -307, -141, -300, -584, -190, -666, -672, -880, -578, -627, -674, -539, -812, -425, 320, 258, 18, 737, 575, 666, 906, 1247, 893, 390, 864, 1133, 872, 617, 1308, 656, 919, 519, 503, 891, 352, 93, -644, -641, -1089, -1062, -877, -1114, -890, -341, -670, 71, -50, 388, -96, 93, 164, 188, -229, -432, -49, -289, -419, 265, -297, -91, -157, -299, -356, -278, -542, -463, -547, -390, 55, -894, -97, -265, -104, -91, -308, 28, -86, 50, -88, -102, 365, 308, 506, 886, 651, 724, 826, 1083, 880, 851, 1049, 700, 420, 201, 411, -104, 739, 443, 50, 265, 687, 502, 41, 315, -195, -375, -628, -688, -256, 54, -599, -370, -16, 429, -510, -586, 110, -821, -313, -622, -367, 737, 1657, 1041, 976, 519, 1161, 695, -256, -67, -18, -347, -443, 172, -412, -573, -406, 81, -362, -141, 93, -271, -2, -412, -433, -26, 388, 281, -328, 433, 330, 247, -226, 292, -63, -276, 96, -534, -450, -1222, -172, -580, -731, 21, 213, -83, 359, 1127, 1044, 144, -91, 320, -237, -115, -610, -450, -485, -326, -312, 274, 13, 179, 487, -242, 907, 409, 604, 323, 687, 575, 1211, 481, 365, -128, 112, -273, -763, -808, -1234, -1666, -1422, -1724, -2292, -1802, -2338, -2271, -2396, -1708, -2216, -2419, -1664, -1763, -1198, -1031, -891, -1153, -247, 0, 339, 271, 422, 753, 1286, 1495, 1149, 1026, 1563, 1953, 1679, 1740, 2438, 2365, 2156, 2409, 3071, 2333, 2339, 2107, 1567, 2010, 883, 1388, 515, 1506, -180, 800, -106, -214, -2034, -1909, -2799, -3115, -4929, -4614, -4914, -5222, -5117, -4646, -3971, -3930, -3615, -2904, -1907, -1008, -1157, -261, -362, 518, 886, 1291, 1614, 1440, 1295, 466, 1373, 1729, 1591, 1356, 398, 916, 1320, 1580, 1797, 1206, 1817, 1318, 2159, 2187, 2843, 2133, 1750, 2367, 2610, 2554, 2313, 1859, 2153, 2571, 2721, 2726, 2305, 2435, 1956, 2748, 1925, 1627, 1284, 1011, 403, 1461, 878, 357, -541, -1773, -2235, -2898, -3131, -4617, -6226, -7102, -7573, -7188, -5977, -5654, -5588, -6479, -4151, -2201, -196, 341, -453, 756, 1102, 2122, 3325, 3435, 2367, 1023, 1437, 2102, 2089, 1656, -310, -37, -291, 359, 698, 1219, 356, -455, 709, 2182, 2203, 2333, 1961, 2407, 2398, 2458, 3455, 3287, 1825, 1890, 1906, 2524, 2890, 1920, 2011, 2041, 2244, 2403, 2341, 1797, 1494, 1216, 1339, 1682, 1469, 766, 1156, 1097, 247, 106, -2021, -3086, -4778, -6141, -8162, -10388, -11485, -9786, -8383, -9224, -9438, -6995, -3648, -1547, 953, 2403, 3828, 4177, 4347, 7138, 7638, 6088, 3515, 1946, 2468, 1289, -206, -1076, -2253, -3354, -3940, -2336, -1583, -1750, -1076, -393, 2253, 2893, 3093, 4404, 3708, 3933, 4990, 5119, 4437, 3602, 2588, 2510, 2166, 3732, 3287, 2313, 2172, 2758, 4034, 4143, 4010, 2745, 2226, 2792, 2531, 2719, 1734, -760, -1378, -2554, -3159, -5865, -8183, -11276, -15106, -18141, -17766, -10341, -5917, -8045, -8670, -4096, 5192, 8719, 9000, 9971, 7542, 5666, 6357, 7226, 5528, -1625, -6680, -6390, -4752, -4578, -6185, -5617, -5383, -4032, 154, 4971, 6938, 5804, 4885, 7581, 9375, 8445, 5709, 2593, 893, -1084, -1690, -1291, -2586, -4388, -3375, -877, 1755, 2573, 4974, 7872, 8018, 7576, 7739, 9122, 7823, 5534, 4164, 3125, 1256, -10, -34, -510, -2054, -2432, -2606, -3201, -4670, -7172, -8685, -11562, -15870, -17856, -19143, -14901, -3925, -2110, -3739, -2935, 3729, 15237, 14930, 12372, 9961, 4705, 4247, 1841, 2175, -1891, -12706, -14674, -11784, -5695, -3692, -6669, -3320, -213, 4026, 9420, 11883, 12167, 7784, 5049, 7565, 6508, 2589, -2357, -5187, -5641, -6172, -5961, -3731, -3169, -3360, -857, 3688, 8873, 9281, 6813, 7990, 8739, 8216, 6797, 3841, 2615, -96, -631, 149, -917, -1830, -1705, 528, 2442, 2529, 2381, 846, -2192, -3622, -4878, -7541, -12838, -17904, -21107, -22651, -13529, 399, 1427, -2119, -2378, 7578, 21015, 18687, 12386, 7144, 1269, 321, -1943, -2688, -7963, -18526, -18683, -11620, -3503, -948, -2580, 1430, 7169, 13133, 16500, 14235, 10662, 5701, 2692, 2505, 138, -4742, -11130, -12005, -8237, -4695, -2705, -1640, 138, 3091, 6692, 10795, 11802, 9869, 6518, 4601, 4411, 3162, 677, -1500, -3924, -4106, -1523, 286, 1385, 953, 1773, 4063, 5284, 5773, 3377, 1021, -446, -2383, -3813, -7516, -11141, -14052, -18614, -20922, -20146, -14114, -1352, 7037, 5607, 4216, 8875, 17612, 21386, 14276, 4433, -1883, -5279, -6055, -8227, -11107, -14932, -16903, -11571, -2448, 4414, 5438, 5414, 9732, 14281, 15977, 12893, 6964, 2127, -2179, -4951, -6896, -8849, -10539, -11282, -9519, -3649, 1833, 4552, 6976, 8192, 9687, 11916, 10844, 8291, 3838, -1133, -2198, -2396, -4174, -5622, -5742, -3622, 88, 4032, 6763, 6680, 5774, 6987, 8068, 7354, 4696, 583, -2182, -4698, -6443, -6911, -8544, -9930, -12200, -15672, -18257, -17669, -11271, 635, 9914, 8560, 4523, 6573, 13330, 18106, 12623, 2894, -4828, -9024, -8466, -9026, -9995, -12263, -14627, -9632, -407, 7906, 10440, 7899, 8492, 11274, 13284, 10929, 4362, -1867, -6695, -8406, -8093, -7705, -7662, -7630, -5786, -393, 5732, 8890, 10343, 9133, 7794, 7831, 5627, 3287, -474, -5507, -7776, -8067, -5904, -3510, -1531, 373, 3339, 9570, 13943, 13140, 9153, 5338, 5399, 5370, 3136, -669, -6706, -8906, -7933, -6274, -4565, -6190, -9317, -11443, -12701, -11354, -8797, -5377, 494, 4588, 4635, 5214, 7021, 9643, 10859, 6623, 782, -3531, -6336, -6878, -6977, -7193, -7599, -7628, -4680, 534, 5110, 6979, 6281, 6515, 7757, 7838, 5302, 1773, -1792, -4372, -5089, -5752, -5143, -4179, -3821, -1224, 1633, 4537, 7490, 6856, 5575, 4706, 3023, 2289, 211, -2784, -3609, -3946, -4101, -3615, -2026, 1515, 4378, 7192, 10846, 12005, 10120, 7302, 5768, 5323, 2740, -1109, -4693, -5669, -3929, -4917, -6388, -7932, -9687, -9826, -10825, -11808, -11252, -9195, -3776, 3045, 5766, 5153, 6354, 8231, 10716, 9594, 2763, -1821, -5453, -7994, -7765, -8162, -7852, -7125, -5883, -1080, 5162, 8899, 8807, 6823, 6140, 6911, 5958, 1810, -2706, -5757, -6836, -6984, -6737, -4742, -1805, 659, 2606, 5412, 8529, 9330, 7419, 4313, 1804, 133, -1734, -3942, -6433, -7081, -6019, -3815, 123, 3131, 5365, 7284, 7894, 9500, 10698, 10755, 9856, 3942, -1081, -1013, -456, -1044, -4018, -7321, -6073, -2958, -1120, 484, -1510, -4563, -6089, -7968, -7468, -8130, -9670, -7849, -3506, 1727, 2843, 3279, 5042, 6632, 8271, 4903, 1026, -1357, -4453, -5133, -6588, -8672, -7943, -7388, -5687, -1430, 2003, 5308, 7498, 7193, 7888, 8542, 6854, 4068, -231, -3731, -5149, -5870, -6114, -5464, -3972, -2326, 365, 2867, 4651, 6101, 5696, 4984, 3911, 1349, -865, -2878, -4156, -4321, -3560, -2031, -372, 1394, 3427, 5659, 7276, 8203, 8412, 7968, 5734, 2951, 1063, 78, 341, 71, -877, -1581, -1182, -107, 119, -719, -3804, -7529, -10127, -12308, -12630, -12021, -9588, -2857, 2943, 4153, 4901, 5578, 8781, 12524, 8873, 3232, -2854, -7034, -6495, -7771, -9047, -8795, -7998, -4729, -601, 3510, 7313, 9722, 10036, 9000, 8268, 6726, 4125, 1073, -3047, -6737, -8362, -8849, -7166, -4409, -2440, 346, 2614, 3865, 6263, 7250, 5782, 4458, 1640, -545, -1721, -4862, -7028, -6826, -4984, -1768, 1226, 2818, 4146, 6164, 6904, 6468, 5680, 3823, 2628, 769, -2050, -3700, -4260, -3541, -1120, 1709, 2500, 3018, 4643, 6765, 9070, 8247, 4135, 617, -433, -294, -1274, -4398, -9032, -11463, -12614, -14213, -14562, -13677, -8870, 451, 7274, 7834, 7437, 7492, 11144, 15247, 10101, 1760, -6284, -10369, -8015, -8089, -9047, -8804, -8490, -3885, 2344, 6920, 10563, 10617, 8347, 6477, 3878, 1571, -2188, -6883, -10640, -12633, -10898, -7929, -3804, -200, 2281, 5584, 7843, 9929, 11989, 10739, 6958, 2771, -1907, -4206, -5175, -6636, -6468, -6344, -5695, -2998, 325, 3675, 6706, 7901, 7446, 7404, 6016, 4021, 1625, -2351, -4494, -5695, -6258, -5222, -4925, -3768, -1250, 883, 3657, 5490, 6115, 6481, 6308, 5847, 4221, 2378, -263, -1562, -545, -594, -146, 13, -3, 1268, 2050, 2909, 3131, 2515, 2261, 2089, 1157, -607, -3229, -7219, -10698, -13054, -14234, -14209, -11021, -3641, 1276, 4141, 5542, 6031, 11906, 14093, 10224, 4929, -3630, -7013, -6875, -8932, -9766, -10539, -9304, -4654, -308, 3541, 7406, 9581, 9446, 7828, 5438, 2685, 893, -1864, -5826, -7227, -7935, -6821, -3661, -1594, 836, 2938, 4958, 6739, 7545, 7067, 4932, 2411, -716, -3203, -5232, -6495, -6132, -5039, -3138, -1252, 765, 2948, 5433, 7276, 7683, 6987, 5034, 2976, 401, -1890, -3940, -5818, -5823, -5719, -5007, -2909, -718, 1883, 4019, 4950, 5734, 5769, 4588, 3594, 1791, -675, -2550, -4495, -5495, -5119, -3919, -2416, -990, 545, 1982, 3568, 4334, 4321, 4021, 2682, 1594, 269, -1393, -2269, -3166, -3307, -3013, -2448, -1062, 122, 1511, 2773, 3477, 3920, 3581, 2950, 2437, 1196, -294, -833, -1617, -2547, -2640, -2552, -1364, 234, 932, 1466, 1666, 2021, 2450, 2125, 1312, -102, -1610, -2669, -3429, -3911, -3670, -2463, -1239, -369, 347, 818, 1554, 2477, 2898, 2808, 2153, 1047, 386, -112, -489, -823, -1682, -2122, -2214, -1860, -794, -5, 549, 1162, 1146, 1573, 4159, 6411, 6041, 3589, 521, 3, 1735, 2607, 839, -2455, -4373, -3399, -843, -448, -2917, -6412, -9104, -9239, -8141, -7490, -5713, -1972, 1547, 4170, 5333, 5179, 6974, 7792, 5714, 2161, -3221, -6062, -6318, -6729, -6466, -6727, -6019, -3226, -271, 2818, 5571, 7007, 7398, 6356, 3964, 2133, 831, -716, -2619, -5086, -6581, -5708, -3466, -1203, 338, 1219, 2565, 4482, 5765, 5883, 4690, 2745, 831, -1054, -2654, -3601, -3830, -3619, -3195, -2578, -1343, 916, 3226, 4705, 4920, 4093, 3391, 2953, 2265, 938, -1042, -2981, -4036, -4080, -3464, -2445, -1468, -567, 528, 1760, 2953, 3831, 4062, 3532, 2453, 1148, -60, -998, -1703, -2284, -2724, -2797, -2346, -1344, -3, 1218, 2045, 2489, 2680, 2745, 2588, 2084, 1198, 36, -997, -1769, -2265, -2328, -2071, -1630, -1049, -390, 336, 1159, 1914, 2271, 2192, 1758, 1109, 420, -269, -981, -1688, -2245, -2484, -2375, -1966, -1354, -753, -143, 547, 1180, 1761, 2140, 2136, 1854, 1356, 711, 47, -638, -1263, -1709, -1989, -1992, -1722, -1253, -612, 6, 589, 1107, 1456, 1700, 1682, 1341, 828, 198, -347, -685, -925, -1078, -1149, -1128, -870, -451, 37, 537, 865, 1002, 1049, 1049, 948, 807, 481, -24, -367, -690, -391, 933, 1875, 2320, 2469, 1997, 2273, 3167, 3304, 2331, 450, -942, -781, -203, -334, -826, -1466, -1489, -830, -940, -1987, -4036, -6482, -7797, -8154, -7820, -5484, -1344, 1536, 3317, 3945, 3701, 6089, 7273, 5633, 2521, -2756, -5170, -5328, -5662, -5299, -5760, -5312, -2940, -247, 2498, 4857, 6154, 6528, 5774, 3731, 1851, 511, -953, -2636, -4687, -6135, -5552, -3461, -1240, 534, 1516, 2552, 4224, 5406, 5640, 4609, 2521, 458, -1346, -2836, -3701, -3998, -3849, -3253, -2453, -1162, 813, 2797, 4242, 4635, 4067, 3424, 2812, 1937, 651, -1206, -3023, -4003, -4117, -3508, -2515, -1549, -479, 791, 2119, 3357, 4167, 4256, 3737, 2721, 1378, 37, -1144, -2037, -2606, -2930, -2914, -2365, -1331, 41, 1383, 2284, 2784, 2924, 2813, 2531, 1859, 799, -354, -1318, -1932, -2161, -2097, -1750, -1144, -302, 623, 1386, 1917, 2149, 2102, 1768, 1063, 125, -831, -1580, -2023, -2253, -2261, -2019, -1461, -612, 261, 990, 1537, 1888, 2114, 2125, 1805, 1209, 420, -390, -1049, -1471, -1679, -1700, -1550, -1213, -667, -93, 453, 925, 1219, 1372, 1315, 1078, 683, 153, -354, -776, -1058, -1177, -1190, -1058, -774, -367, 80, 519, 1018, 1357, 1654, 1857, 1731, 1528, 1080, 945, 1222, 1179, 1114, 907, 688, 804, 1057, 1205, 1114, 925, 649, 544, 464, 167, -367, -1430, -2708, -4010, -5438, -6739, -7614, -7675, -6580, -3883, -521, 1859, 3477, 4143, 4688, 5687, 5073, 3091, -94, -3648, -5396, -6073, -5732, -4880, -4274, -2982, -1218, 1042, 3688, 5695, 6586, 6016, 4172, 2125, 657, -450, -1766, -3513, -5120, -5427, -4028, -1778, 352, 1744, 2567, 3513, 4351, 4680, 4227, 2782, 826, -1170, -2782, -3688, -3756, -3308, -2709, -1922, -1039, 391, 2245, 3732, 4545, 4248, 3221, 2218, 1331, 412, -703, -2140, -3396, -3719, -3190, -1963, -599, 320, 1143, 1823, 2414, 3044, 3226, 2692, 1524, 104, -1076, -1782, -2015, -1994, -1935, -1735, -1229, -359, 786, 1750, 2278, 2485, 2242, 1765, 1287, 518, -219, -810, -1344, -1508, -1500, -1295, -804, -101, 523, 774, 1138, 1347, 1247, 1218, 779, 127, -312, -597, -669, -692, -700, -596, -430, -226, -211, -252, -136, -235, -346, -370, -420, -351, -231, 96, 412, 640, 904, 925, 920, 878, 461, 2, -390, -942, -1276, -1375, -1502, -1292, -880, -524, 49, 563, 976, 1495, 1578, 1292, 971, 558, 279, -76, -484, -724, -1146, -1284, -886, -524, -47, 482, 693, 857, 1148, 1383, 1823, 2594, 2755, 2380, 2086, 1890, 2256, 2484, 2065, 1300, 427, 294, 459, 373, 47, -534, -838, -852, -942, -1325, -2334, -4330, -6972, -9211, -10703, -10953, -6854, -534, 2422, 3628, 2646, 2248, 6878, 9386, 7748, 2818, -4370, -6987, -6037, -5094, -5037, -6523, -7224, -5016, -1021, 2398, 5164, 6317, 6047, 5640, 3997, 2631, 1869, 114, -1888, -4317, -6255, -5425, -3200, -1234, 281, 640, 1524, 3635, 5365, 6218, 5321, 3078, 1086, -500, -1828, -2531, -3141, -3609, -3083, -2459, -1328, 794, 2398, 3599, 4127, 3502, 3099, 3015, 2461, 1412, -373, -2464, -3518, -3440, -2881, -2156, -1748, -1227, -88, 1360, 2705, 3315, 3268, 2800, 1976, 1083, 237, -576, -1313, -1786, -2224, -2445, -2005, -1058, 39, 818, 1227, 1615, 2133, 2380, 2260, 1846, 1018, 263, -344, -860, -1205, -1503, -1519, -1352, -1078, -571, 36, 529, 807, 997, 1071, 1010, 844, 479, -50, -558, -753, -823, -953, -943, -930, -773, -433, -183, 52, 297, 536, 636, 698, 825, 885, 946, 893, 594, 308, 135, -117, -346, -568, -786, -731, -539, -378, -279, -141, 830, 2313, 2890, 2740, 2403, 2544, 3409, 3575, 2568, 1172, 307, 248, 606, 602, -179, -666, -437, 107, 597, 557, -172, -1172, -2112, -3198, -4648, -6570, -8734, -10422, -11292, -10799, -6578, -432, 3442, 5010, 4471, 5007, 8344, 9958, 7437, 1409, -4377, -6554, -5752, -5440, -7115, -8112, -7263, -3568, 1081, 3791, 5599, 6601, 7011, 6706, 5063, 2956, 1023, -859, -3057, -5245, -6487, -5664, -3599, -1888, -836, 114, 2099, 4516, 5940, 5536, 3995, 2532, 1742, 1000, -708, -2445, -3455, -3021, -1299, -455, -157, 753, 2292, 4308, 5552, 4830, 3619, 3286, 2888, 2037, 247, -1825, -2523, -2174, -1930, -2101, -2106, -1312, 344, 1644, 1849, 1599, 1907, 2396, 2466, 1674, 234, -963, -1724, -2159, -2945, -2903, -1989, -1847, -1057, -159, 1383, 3716, 4575, 4182, 2860, 1968, 1286, 1263, 1006, -281, -565, -1041, -937, -91, 24, 302, 789, 817, 609, 601, 36, -927, -1737, -3221, -3933, -4253, -5065, -6373, -8744, -11209, -13050, -12740, -10045, -3537, 2893, 4989, 4862, 3560, 5003, 7974, 7661, 3115, -3193, -6346, -6279, -4596, -4526, -6089, -5573, -3347, 602, 3589, 4411, 4891, 5029, 4989, 3787, 1942, 305, -532, -872, -1919, -2753, -2536, -1024, 633, 1265, 1256, 1375, 2201, 2782, 2758, 2159, 1229, 1149, 1255, 979, 393, -2, 281, 846, 1226, 956, 821, 1054, 1279, 1794, 1705, 1364, 1232, 1081, 1219, 1346, 1351, 1050, 545, 315, 450, 737, 893, 1034, 932, 1109, 1341, 1403, 1771, 1625, 1068, 781, 791, 748, 909, 820, 96, -47, -240, -438, -641, -821, -808, -641, -317, -278, -219, 122, 878, 1495, 1714, 1711, 1281, 1209, 1119, 690, 269, -494, -1406, -1987, -2396, -2383, -2136, -1966, -1747, -1266, -1119, -1231, -1256, -1344, -1144, -804, -1240, -2047, -2404, -2497, -2635, -2907, -3138, -2959, -2622, -2602, -3412, -4245, -3992, -2857, -1675, -1594, -2279, -2258, -1211, 563, 1398, 1015, 343, 175, 922, 1649, 2058, 1748, 1580, 2123, 2828, 3644, 3859, 3625, 3325, 3255, 3510, 3774, 3860, 3562, 3164, 2930, 2696, 2159, 1672, 1080, 86, -571, -1006, -1591, -2321, -3099, -4214, -5584, -6773, -8143, -9297, -10143, -10318, -9039, -6420, -3050, -266, 1261, 1976, 2565, 3703, 3542, 1604, -1094, -2940, -2568, -1362, -593, -817, -430, 1276, 3344, 5003, 4692, 3711, 3157, 2951, 3070, 2849, 2360, 1893, 2026, 3018, 4162, 5130, 4992, 4068, 3209, 2857, 2683, 2315, 1321, 240, -151, 346, 1292, 1815, 1763, 1148, 1271, 2182, 2789, 2529, 1028, 169, 542, 1162, 1305, 492, -552, -570, -8, -10, -575, -1000, -1347, -1117, -971, -1313, -1354, -1193, -786, 86, 442, 258, 24, -232, 26, 550, 576, -351, -1461, -1628, -1133, -664, -825, -1438, -1609, -950, 3, 406, 370, 672, 799, 927, 726, 432, 425, 211, -250, -851, -1310, -1412, -1195, -1201, -1500, -1347, -935, -235, 131, -573, -1982, -3055, -3143, -2795, -2679, -3367, -4180, -4138, -3110, -1458, -321, -213, -805, -633, -26, 633, 856, 96, -690, -703, -235, 42, 47, -39, -36, 422, 1102, 1705, 2122, 1968, 1610, 1515, 1946, 2596, 2739, 2144, 1268, 1049, 1396, 1977, 1851, 830, 58, 67, 685, 1252, 833, -282, -1420, -1979, -1698, -1245, -1253, -1774, -2489, -2752, -2390, -1894, -1872, -2399, -2631, -2466, -2157, -1795, -1964, -2323, -2599, -2188, -1755, -1724, -1643, -1351, -515, 494, 1135, 894, 545, 924, 1326, 1597, 1291, 1114, 1310, 1852, 2622, 2794, 2859, 2557, 2193, 2185, 2167, 2177, 1972, 1539, 1558, 2414, 3331, 3670, 3583, 3078, 2643, 2680, 2432, 1479, 0, -893, -1255, -1248, -1440, -2164, -2321, -1747, -834, -602, -1276, -2393, -3343, -3773, -4143, -4231, -4291, -4174, -3753, -3610, -3318, -2662, -1729, -1195, -1146, -1018, -911, -425, 485, 890, 955, 802, 459, 357, 562, 1192, 1539, 1545, 1615, 2331, 3500, 3635, 2992, 2987, 3542, 4182, 3940, 2976, 2411, 2545, 3287, 3476, 2851, 2354, 2013, 2008, 2106, 1823, 1435, 690, 49, -149, 23, 71, -565, -1497, -2349, -2260, -2086, -2427, -2778, -3318, -3286, -2925, -2339, -2412, -3026, -3146, -3157, -2781, -2196, -1713, -1711, -1656, -1328, -510, 359, 269, 265, 203, 518, 1123, 1344, 1093, 670, 724, 1167, 1508, 1455, 1060, 1003, 1380, 2179, 2636, 2422, 2096, 2065, 2606, 3109, 2922, 2029, 1154, 963, 1174, 1404, 1226, 485, -385, -693, -476, -484, -1153, -2125, -2602, -2076, -1506, -1373, -1586, -2102, -2370, -2375, -2193, -1946, -2265, -2862, -2821, -2042, -1477, -1310, -1994, -2359, -1825, -893, -531, -937, -1034, -695, 271, 1039, 1076, 734, 614, 945, 1339, 1594, 1466, 1346, 1394, 1497, 1589, 1519, 1417, 1299, 1367, 1607, 1528, 1269, 797, 662, 953, 1156, 890, 349, 167, 435, 593, 477, 83, -104, -346, -396, -258, -206, -452, -692, -656, -596, -508, -409, -431, -418, -308, -194, -78};
+constexpr int16_t example_synthesizer_pcm[example_synthesizer_length] = {0, -105, -211, 27, -168, -587, 56, 792, 1714, 354, 1121, 2211, 1010, 250, -2135, -2237, -1761, -1273, -2310, -3779, -1698, 896, 791, 425, 1498, 3269, 3552, 1545, 886, 1929, 1206, 659, -362, 640, 935, 1399, 2778, 2927, 3097, 2140, 1357, 925, 466, -1205, -4748, -7120, -10286, -9492, -8485, -3930, -3190, -4698, 2505, 6224, 8635, 5490, 5630, 8080, 3998, 1190, -3321, -6086, -4331, -5328, -6547, -6981, -3820, 1352, 1909, 2369, 4862, 6791, 8271, 5709, 3862, 3732, 4573, 3146, 1093, 2481, 2797, 3735, 4101, 5438, 4362, 2468, 1041, -464, -2593, -8969, -14833, -18859, -20336, -13692, -6494, -8253, -6304, 4966, 15701, 15270, 9701, 12891, 11844, 6495, 273, -5619, -9055, -10073, -8271, -10240, -7422, -1240, 1580, 2653, 6313, 10523, 10472, 9326, 6224, 3847, 3625, 3235, 771, -933, 1701, 4261, 4028, 3992, 3906, 4623, 2744, -2008, -8795, -18055, -21390, -18640, -12643, -12742, -13300, -5351, 7269, 14026, 12326, 13349, 15703, 13352, 7114, -628, -5336, -6391, -7170, -11312, -11313, -6036, -446, 2477, 3537, 7177, 11255, 12615, 9331, 5482, 4550, 4463, 2661, -287, 396, 2041, 3451, 2667, 1534, 3563, 4164, 131, -7935, -13896, -20589, -20888, -12911, -11403, -16555, -11898, 3731, 12758, 9466, 9229, 13420, 13748, 11058, 2109, -4610, -5104, -3094, -5774, -9490, -5495, 1188, 4213, 3703, 5507, 8247, 9752, 8281, 3998, 2659, 2734, 2734, 1580, 674, 3550, 4849, 4157, 3943, 4633, 3797, 3, -6390, -14632, -20984, -20576, -14808, -14917, -18198, -10558, 831, 9942, 10312, 10511, 13503, 13757, 11047, 4323, -1693, -4000, -4106, -5771, -7347, -4485, -375, 3123, 4248, 6281, 9872, 9120, 7500, 5719, 4735, 3922, 841, -1114, 464, 2537, 2721, 2360, 1218, 2825, 2872, -2948, -13019, -17156, -18739, -18890, -14916, -13864, -13617, -7086, 5175, 12180, 10024, 9419, 13922, 13216, 7416, 1937, -2380, -3127, -2942, -5263, -6916, -1945, 4450, 6143, 5308, 7705, 10167, 10047, 7391, 4734, 2849, 2253, 1008, -929, -568, 825, 2076, 1485, -75, 867, -537, -9998, -17125, -17347, -18818, -12862, -15744, -12955, -6216, 1471, 11261, 10248, 8687, 11396, 13229, 9455, 2307, -3359, -2583, -3295, -4136, -4435, -3013, 2544, 5222, 5740, 7435, 10063, 10529, 7330, 5253, 3203, 2383, 404, -407, -557, -359, 630, 833, 547, 800, -3188, -8295, -14948, -19729, -17890, -13531, -11744, -14164, -7927, 3761, 9586, 10588, 8549, 11065, 13583, 10414, 2752, -1630, -2677, -1308, -3706, -6235, -2219, 2349, 4214, 4956, 7179, 9261, 10104, 8164, 6049, 4831, 2601, 1479, -274, 367, 1378, 286, -823, -709, -1192, -5287, -11519, -17778, -21711, -18474, -11334, -12609, -12000, -4873, 6282, 13576, 9758, 10581, 12539, 13649, 9614, 938, -2542, -2437, -1565, -3425, -4721, -2153, 2679, 5378, 6295, 7531, 8255, 9115, 8385, 5670, 2698, 1273, 1088, 385, 542, -269, 607, 580, -1352, -2891, -6963, -13594, -18981, -22445, -16070, -10670, -12729, -9464, -1644, 9864, 13925, 9268, 10755, 13192, 12817, 6828, -974, -2567, -2489, -1794, -4279, -5016, -680, 2771, 4333, 4740, 6612, 9349, 8856, 5938, 4292, 4263, 3019, 1735, 47, 662, -461, -393, -872, -3693, -5675, -10930, -14695, -18745, -20539, -12602, -8403, -9955, -6279, 2972, 12815, 12461, 9430, 10448, 11959, 9349, 3523, -901, -3409, -1485, -2760, -3630, -3172, 1813, 4346, 4576, 6589, 7804, 8943, 7109, 6820, 4073, 1937, 2187, 1769, -80, -839, -1695, -3320, -4106, -6612, -11122, -15162, -18510, -18088, -10518, -8711, -8557, -6068, 4209, 13407, 11810, 7802, 9099, 11411, 8511, 2992, -3196, -3198, -2394, -2446, -3601, -3213, 946, 4877, 5430, 6781, 7667, 8567, 8500, 5766, 4006, 2628, 3065, 1550, -250, -1123, -1359, -1531, -4666, -7292, -11286, -13774, -18854, -18800, -10588, -8554, -9674, -4849, 4578, 11541, 9901, 10336, 9930, 10021, 9287, 4261, -2524, -4552, 687, -1615, -5010, -3106, 2325, 5433, 4765, 6693, 7833, 8779, 8693, 6174, 3443, 2968, 3133, 1591, -1131, -1817, -2175, -3448, -4615, -8565, -12981, -17505, -20487, -15101, -8081, -9588, -9080, -2755, 8659, 13740, 11078, 9817, 10846, 11745, 9388, 596, -5102, -2886, -1547, -4547, -6518, -3951, 3240, 5607, 5437, 6596, 9484, 12240, 9648, 4672, 4080, 5386, 3700, 545, -716, -1109, -2555, -3565, -6847, -12847, -16677, -23021, -20581, -11281, -10628, -11557, -8909, 4537, 14898, 12656, 9946, 10614, 14120, 12442, 3963, -3646, -5036, -701, -3292, -7414, -6123, 429, 5833, 5107, 6177, 8761, 11844, 11800, 7547, 5424, 5174, 5307, 2536, -359, -1299, -1752, -2614, -7127, -12769, -14838, -19580, -22448, -15909, -11338, -11831, -9373, 1067, 11620, 13490, 9834, 11877, 14133, 11420, 6334, -1218, -3516, -2394, -2739, -6026, -5834, -677, 3675, 5653, 6209, 7529, 10157, 10836, 9646, 5502, 5416, 6039, 3554, 672, -766, -1933, -3667, -6330, -11250, -15284, -20049, -21748, -14679, -12380, -12929, -9958, -229, 9945, 11346, 10747, 10226, 13515, 12299, 7469, 300, -4131, -792, -1438, -6110, -7545, -927, 4443, 3752, 5080, 7644, 11554, 12510, 9502, 6307, 6416, 7502, 4102, 216, -2221, -2765, -3646, -8360, -12817, -17346, -22182, -20422, -13213, -12594, -13474, -9253, 4369, 11830, 11028, 10099, 12690, 15841, 11430, 5458, -154, -718, -1183, -5330, -7677, -5997, 643, 2179, 1044, 6442, 10162, 12539, 11099, 8432, 8406, 8132, 7961, 2378, -1057, -1463, -2200, -5362, -11909, -15320, -17680, -22849, -20382, -15638, -13213, -12170, -6490, 6424, 10628, 11404, 12269, 16015, 16554, 11102, 6320, 2698, 1002, -1729, -6201, -6734, -4292, -352, -330, 472, 5224, 9013, 10570, 9154, 8166, 9326, 8833, 6347, 3162, 1703, -869, -4510, -8872, -14015, -19469, -23581, -22580, -18453, -16872, -14417, -9490, 531, 7807, 10010, 12601, 14297, 17437, 14869, 11507, 7662, 4693, 3266, -458, -2773, -3307, -2813, -1169, -537, 2094, 3808, 5943, 7359, 7748, 8549, 6976, 6690, 6205, 2907, -593, -4562, -7882, -12985, -16791, -20080, -20513, -17969, -16833, -12532, -9692, -2761, 1795, 5904, 8781, 10045, 12792, 12349, 11682, 8604, 7539, 6058, 4289, 3490, 1927, 1495, 190, 1054, 1808, 2083, 3070, 2675, 3593, 3956, 4977, 4226, 3209, 2549, -427, -3860, -7294, -9791, -11568, -13989, -15055, -14065, -12696, -9633, -8016, -5487, -1456, 1334, 3860, 4450, 6304, 7372, 8156, 7591, 7817, 8015, 7196, 6489, 5373, 5549, 4813, 4680, 2797, 3065, 2667, 1851, 1753, 677, 1562, 549, -435, 23, -162, -2091, -5644, -6580, -6961, -7364, -7731, -9713, -9771, -8123, -5984, -5998, -5804, -3019, -937, 148, -490, 1461, 3573, 4039, 4393, 4248, 5425, 6235, 7005, 6386, 5440, 5302, 5745, 5174, 3312, 2424, 2429, 2193, 1818, 2084, 677, 388, 997, 195, -37, -1294, -1644, -3013, -4562, -4933, -4458, -5201, -6510, -6247, -4828, -4544, -5547, -4787, -3237, -1693, -2372, -2136, -1279, -166, 932, 1537, 1594, 2032, 2945, 3940, 4429, 3154, 3594, 4206, 3977, 3763, 3000, 3894, 3096, 3002, 2990, 2172, 2558, 1776, 1534, 357, 221, 636, 253, -549, -969, -424, 252, -466, -1849, -2320, -2591, -2292, -3060, -4550, -4922, -4844, -4258, -4360, -4156, -4063, -3185, -2435, -2331, -1565, -1214, -180, -36, 112, 1130, 2287, 2425, 2464, 2476, 2813, 2922, 3015, 2222, 2019, 2586, 2552, 3448, 2714, 2877, 3664, 3994, 4101, 3729, 3823, 3657, 3128, 2610, 1529, 1097, 260, -1412, -2282, -3091, -3531, -4610, -4995, -5062, -5211, -5162, -5477, -4734, -4747, -4576, -3789, -3675, -3200, -2951, -2294, -1852, -1735, -1557, -1143, -588, -407, 315, 1135, 1724, 2323, 3122, 4101, 4821, 5229, 5823, 6119, 6260, 6490, 6149, 5593, 5622, 5394, 4846, 3935, 3071, 2646, 1729, 511, -877, -1865, -2607, -3644, -4500, -5031, -5419, -5617, -5911, -6024, -5753, -5688, -5940, -5807, -5690, -5469, -5044, -4667, -4083, -3443, -2695, -1687, -795, -258, 698, 1586, 2177, 2820, 3469, 4109, 4391, 5003, 5576, 5909, 6274, 6407, 6839, 6607, 6484, 6234, 5747, 5365, 4659, 3950, 3102, 2135, 1206, 170, -969, -1920, -3115, -4034, -4890, -5670, -6213, -6584, -6804, -6709, -6507, -6286, -5886, -5370, -4891, -4627, -4169, -3669, -3187, -2891, -2461, -1857, -1424, -674, -232, 571, 1268, 1971, 2966, 3602, 4347, 4864, 5438, 5953, 6068, 6417, 6580, 6390, 6367, 6026, 5560, 5019, 4446, 3786, 2841, 1817, 1208, 326, -547, -1278, -2149, -2615, -3104, -3505, -3950, -4560, -4718, -4872, -5182, -5388, -5359, -5294, -5205, -5214, -5008, -4511, -4049, -3627, -3338, -2765, -2167, -1453, -968, -498, 320, 1261, 1859, 2438, 3071, 3750, 4339, 4698, 5097, 5294, 5492, 5627, 5786, 5740, 5729, 5709, 5325, 5039, 4604, 4037, 3343, 2474, 1714, 773, -211, -1041, -1828, -2555, -3351, -3917, -4318, -4661, -4852, -4984, -5183, -5187, -5149, -5304, -5166, -5190, -4883, -4583, -4343, -3945, -3580, -2979, -2476, -1933, -1373, -807, -117, 588, 1052, 1870, 2761, 3482, 4115, 4722, 5407, 5838, 6063, 6067, 6117, 6031, 5818, 5341, 4823, 4502, 4058, 3615, 3003, 2386, 1805, 1125, 429, -295, -968, -1524, -2281, -3032, -3506, -3969, -4521, -4937, -5214, -5485, -5607, -5771, -5755, -5643, -5419, -5023, -4670, -4099, -3554, -3005, -2383, -1742, -1115, -529, -13, 599, 1205, 1693, 2244, 2781, 3385, 4018, 4580, 4976, 5330, 5669, 6024, 6104, 6000, 5935, 5797, 5537, 5057, 4545, 3907, 3154, 2347, 1404, 388, -545, -1360, -2234, -3047, -3571, -3989, -4404, -4732, -4808, -4869, -4985, -5013, -5089, -5096, -5084, -5015, -4880, -4706, -4369, -4021, -3531, -2976, -2336, -1664, -971, -253, 469, 1206, 1880, 2610, 3157, 3758, 4321, 4792, 5067, 5159, 5373, 5505, 5409, 5211, 5047, 4873, 4688, 4396, 4024, 3606, 3114, 2581, 1933, 1252, 474, -281, -1003, -1708, -2334, -2992, -3599, -4068, -4394, -4696, -4933, -5041, -5099, -5141, -5058, -4982, -4760, -4472, -4071, -3698, -3336, -2916, -2393, -1872, -1401, -966, -519, -2, 468, 1015, 1523, 2117, 2693, 3351, 3995, 4416, 4870, 5261, 5456, 5632, 5516, 5333, 5101, 4883, 4507, 4054, 3669, 3195, 2726, 2211, 1542, 789, 109, -571, -1117, -1792, -2573, -3097, -3510, -3784, -4188, -4521, -4851, -4955, -4964, -5091, -5172, -5221, -5063, -4864, -4640, -4281, -3763, -3299, -2607, -1828, -1127, -424, 313, 984, 1609, 2222, 2651, 3211, 3474, 3956, 4321, 4630, 4778, 4968, 5192, 5162, 5102, 5013, 4830, 4688, 4308, 3825, 3344, 2976, 2341, 1721, 1209, 542, -115, -687, -1390, -2088, -2744, -3347, -3955, -4396, -4768, -5018, -5317, -5276, -5015, -4943, -4666, -4433, -4050, -3644, -3432, -3000, -2638, -2201, -1857, -1461, -839, -445, 174, 789, 1347, 1813, 2146, 2696, 2974, 3304, 3628, 3917, 3945, 4071, 4196, 4164, 4156, 4080, 4065, 4016, 3787, 3570, 3201, 2643, 2086, 1765, 1136, 549, 8, -586, -1058, -1417, -1950, -2453, -2580, -2933, -3274, -3508, -3802, -3929, -4041, -4213, -4282, -4211, -4060, -3828, -3539, -3343, -2963, -2461, -2222, -1711, -1188, -722, -266, 123, 739, 899, 1494, 2034, 2380, 2935, 3195, 3537, 3724, 3830, 3984, 4023, 3990, 3779, 3604, 3589, 3458, 3399, 3226, 3078, 2857, 2511, 2183, 1795, 1091, 547, -94, -916, -1424, -1906, -2619, -2942, -3297, -3696, -3834, -4068, -4192, -4143, -3959, -3812, -3774, -3571, -3312, -2906, -2794, -2519, -2070, -1779, -1492, -956, -610, -248, 195, 656, 885, 1328, 1834, 1865, 2253, 2893, 3010, 3360, 3732, 3795, 4206, 3917, 3844, 3802, 3481, 3554, 2992, 2716, 1927, 1748, 1619, 1318, 666, 221, -164, -468, -615, -1253, -1403, -1958, -2328, -2641, -3115, -3419, -3614, -3357, -3620, -3761, -3852, -3724, -3291, -3060, -3141, -2685, -2391, -1890, -1531, -1010, -635, -190, 620, 1015, 1394, 1570, 1856, 2188, 2440, 2521, 2826, 3110, 3068, 3144, 3328, 3442, 3063, 3076, 3096, 3315, 2677, 2323, 2279, 1833, 1664, 1326, 195, 34, 164, -443, -877, -1602, -2286, -2164, -2541, -2807, -3356, -3544, -3279, -3610, -3377, -3528, -3472, -3536, -3273, -2740, -2677, -2390, -2429, -2045, -1544, -1016, -1023, -500, 91, 519, 636, 1106, 2016, 1799, 2904, 3049, 2760, 3474, 3273, 3271, 3919, 3877, 3545, 3094, 3607, 3398, 3226, 3562, 2182, 1987, 2018, 1584, 1724, 881, 91, 23, -94, -1119, -880, -1271, -2276, -3146, -3094, -3549, -3253, -3682, -4062, -4063, -4458, -4099, -4089, -3894, -3537, -3373, -2844, -2619, -2037, -1606, -1015, -825, -6, 154, 1179, 1536, 1893, 2261, 2383, 3086, 3422, 3644, 3750, 3690, 4102, 4500, 4067, 4456, 4154, 4112, 4427, 2955, 3938, 3234, 2201, 1950, 584, 419, 1135, 159, -226, -1422, -1248, -1732, -2807, -2377, -3060, -2922, -3372, -3982, -4146, -4135, -4787, -4175, -4516, -4377, -3930, -4106, -3472, -2836, -2356, -1740, -1498, -1245, -221, 731, 781, 1214, 1682, 2209, 2859, 3149, 3675, 3555, 3599, 4110, 3862, 4146, 3675, 3411, 3711, 3758, 3484, 3482, 2631, 2631, 2179, 1760, 1805, 1130, 657, 3, -381, -646, -1229, -1745, -2581, -2761, -2826, -3950, -3981, -3594, -4508, -4844, -4797, -4557, -4369, -4154, -3899, -4011, -3705, -2644, -2782, -2156, -1651, -1597, -781, -622, 519, 773, 1260, 1714, 2136, 2872, 3253, 3506, 4291, 4312, 4633, 4565, 4252, 4149, 4534, 4399, 4067, 4015, 3070, 3041, 2703, 2286, 1860, 1419, 917, 93, -300, 144, -982, -1942, -2032, -2323, -2456, -4002, -3987, -4440, -4976, -4870, -4953, -5692, -5166, -4935, -4159, -4417, -4188, -3463, -3065, -2196, -1747, -856, -305, 83, 542, 1213, 1817, 2128, 2969, 3075, 3640, 4190, 4344, 4406, 4347, 4539, 4976, 4755, 4380, 4562, 4130, 4122, 3420, 3526, 2675, 2218, 2029, 1597, 529, 190, -492, -443, -1338, -1877, -1834, -2721, -3093, -3797, -3805, -4281, -4722, -4526, -5140, -4959, -4794, -4933, -4789, -4412, -3724, -3795, -3417, -2175, -2058, -1599, -1049, -198, 177, 1185, 1737, 2054, 2532, 3459, 3416, 3852, 3873, 4596, 4695, 4529, 4820, 4615, 4739, 4029, 4503, 4317, 3808, 3208, 3205, 2641, 2224, 1333, 1347, 557, -416, -321, -1224, -1758, -2377, -2391, -3209, -3435, -3950, -3838, -4638, -4708, -4485, -4766, -4632, -4620, -4278, -3856, -3932, -3451, -3083, -2570, -1997, -1532, -1042, -347, 115, 886, 1339, 1932, 2089, 2844, 2989, 3636, 3417, 4018, 4201, 4070, 4458, 4170, 3701, 4244, 3907, 3867, 3250, 3013, 2578, 2640, 1953, 1552, 1122, 675, -109, -620, -396, -1442, -1765, -1989, -2679, -3065, -3461, -4032, -3740, -4068, -4541, -4127, -4516, -4312, -4253, -3977, -3474, -3208, -2701, -2446, -1640, -1286, -708, -273, 516, 765, 1455, 1735, 1995, 2828, 2638, 3229, 3438, 3532, 3677, 3985, 3938, 3946, 3440, 3542, 3555, 3232, 3125, 2469, 2503, 1458, 1602, 1021, 448, 179, -127, -687, -1265, -1450, -2300, -2511, -2463, -2929, -3580, -3339, -3610, -3860, -4088, -3394, -4115, -3683, -3468, -3388, -2813, -2638, -2167, -1627, -1339, -669, -245, 263, 924, 1188, 1485, 2256, 2412, 2722, 3107, 3110, 3653, 3416, 3789, 3765, 3657, 3534, 3383, 3154, 3117, 2518, 2364, 2305, 1679, 1352, 834, 659, 153, -320, -636, -1146, -1550, -1633, -2229, -2625, -2740, -2937, -3114, -3445, -3292, -3636, -3313, -3299, -3205, -3086, -2763, -2422, -2420, -1987, -1502, -1240, -511, -31, 32, 487, 708, 1495, 1453, 2169, 2292, 2325, 2773, 2935, 3244, 3107, 3536, 3044, 3222, 2989, 3226, 2263, 2735, 2370, 1724, 1805, 1549, 982, 532, 544, -302, -213, -841, -1131, -1398, -1693, -2484, -2336, -2627, -2976, -3015, -3062, -3201, -3333, -3140, -2963, -2549, -2849, -2495, -2169, -1545, -1494, -1232, -630, -604, 286, 286, 401, 1078, 802, 1818, 1644, 2045, 2130, 2516, 2245, 2656, 2927, 2503, 3037, 2320, 3023, 2258, 2010, 2260, 1958, 1593, 1229, 1190, 805, 409, -75, -330, -953, -873, -1067, -1830, -2075, -2060, -2237, -2838, -2682, -2615, -2942, -2667, -3029, -2328, -2455, -2563, -2183, -1390, -1675, -1391, -833, -826, -237, -135, 388, 571, 745, 1130, 1407, 1752, 1838, 2130, 2248, 2365, 2492, 2703, 2401, 2308, 2539, 2222, 2052, 2044, 1654, 1424, 1602, 903, 649, 393, 119, 388, -141, -1037, -865, -1179, -1562, -1573, -1950, -2076, -2429, -2141, -2252, -2386, -2300, -2107, -2323, -2123, -1714, -1709, -1468, -1455, -959, -489, -661, -269, -315, 130, 620, 651, 1032, 446, 1375, 1438, 1289, 1883, 1633, 1812, 1974, 2106, 2248, 1995, 1943, 2091, 1945, 1862, 1630, 1502, 1214, 844, 1028, 506, 89, -19, -138, -443, -994, -1185, -1560, -1411, -1256, -1869, -2205, -2063, -2208, -1635, -1732, -2041, -2169, -2006, -1157, -1211, -1515, -977, -448, -619, -169, 75, 84, 356, 466, 1144, 1070, 1209, 1615, 1641, 1789, 1620, 2351, 1735, 2143, 2344, 1479, 2276, 1833, 1716, 1617, 1343, 1453, 1107, 539, 310, -143, -377, -635, -1010, -1299, -1714, -1836, -1971, -1982, -1998, -2747, -2084, -1795, -2244, -1799, -1929, -1701, -1698, -1339, -1019, -1164, -789, -602, -198, -159, -65, 456, 331, 959, 938, 1114, 1761, 1133, 1541, 2346, 1981, 1729, 2167, 2300, 2041, 2310, 2588, 1911, 1628, 1492, 1758, 1646, 511, 273, -209, -734, -922, -1468, -1877, -2282, -2224, -2349, -2589, -2567, -2669, -2594, -2417, -2016, -1726, -1924, -1959, -1372, -558, -273, -946, -539, 42, 377, 1071, 490, 1110, 1063, 1174, 2242, 1260, 2097, 2159, 2159, 2451, 1968, 3620, 1933, 1828, 3002, 2016, 2938, 1838, 953, 1013, 907, 385, -1018, -1058, -1800, -2391, -2437, -3041, -3114, -3523, -3703, -2930, -3292, -3308, -2744, -2721, -1597, -1506, -1242, -255, 2, 356, 430, 1029, 1260, 1437, 1880, 1682, 2138, 2328, 1641, 2273, 2599, 2435, 3265, 2727, 2968, 3300, 2661, 3346, 2778, 2753, 2680, 1331, 1354, 549, -429, -1307, -2896, -3388, -3291, -3519, -3990, -4841, -5115, -4127, -3830, -3250, -3326, -3614, -1662, -1690, -1222, 339, -192, 149, 1153, 1886, 2420, 2088, 1794, 1911, 2110, 2474, 2502, 2068, 1854, 2273, 2718, 3338, 2873, 2498, 3597, 3170, 3365, 2914, 1630, 1894, 110, -1258, -2026, -3695, -4112, -4808, -5688, -6211, -6877, -6847, -5549, -4620, -5286, -4794, -3888, -2472, -192, -433, 416, 1662, 2096, 3554, 3563, 4229, 3284, 2256, 4511, 4140, 3167, 2167, 1670, 3339, 2674, 2938, 3315, 2628, 2708, 3065, 4771, 3333, 1336, 1117, 326, -781, -3274, -4253, -4510, -5768, -7258, -8878, -8409, -7675, -7709, -6688, -6430, -5906, -4182, -1849, 458, 1174, 1802, 3162, 5606, 6593, 6690, 7136, 6055, 5917, 6274, 5904, 4555, 2747, 2515, 2766, 2180, 1761, 1196, 851, 1795, 2427, 1422, -170, -888, -1984, -3808, -6339, -6222, -5237, -8219, -10492, -10073, -7627, -6235, -7032, -6364, -3661, -2916, -1795, 2359, 3726, 4182, 4739, 6318, 9237, 8843, 8097, 8567, 7521, 7140, 6802, 4757, 3227, 1347, 2057, 1713, -386, 289, -701, -261, 419, -1315, -3071, -6196, -8781, -7640, -6269, -8002, -10700, -12539, -9706, -5089, -4810, -5260, -4325, -3045, 1141, 4593, 4966, 5477, 5451, 7536, 10523, 10961, 8985, 6669, 7050, 8307, 7953, 4380, 1023, 1037, 2138, 1438, -576, -643, -1381, -1633, -182, -2312, -5080, -8885, -11628, -6521, -5420, -11308, -14010, -11438, -5542, -3422, -4394, -4247, -2744, 1721, 6214, 7903, 6430, 5062, 7997, 11805, 11661, 8308, 6315, 6782, 7550, 6844, 3881, 1640, 422, 826, 2070, 179, -1920, -1662, -179, -198, -4250, -9295, -12213, -9864, -5640, -8047, -14153, -15977, -8143, -1844, -3203, -3008, -2604, 1547, 6471, 8696, 9328, 5945, 7588, 12148, 11924, 9164, 5107, 4524, 6659, 5804, 3893, -398, -834, 1469, 166, 1336, -550, -1843, -136, -3209, -5810, -10599, -13119, -6076, -7394, -13432, -14609, -11398, -1731, -1898, -3112, -162, 1172, 7669, 9174, 8768, 7974, 6023, 10843, 11584, 6718, 3851, 3446, 6029, 4456, 1825, 675, -495, 2591, 2356, 1075, 588, -206, 2028, -1083, -5523, -9904, -14399, -8804, -6937, -12544, -16094, -14148, -2601, -159, -4847, -1198, 1933, 6964, 10294, 7528, 8333, 6698, 8416, 11977, 5260, 1722, 1854, 5101, 5076, -1156, 282, 2367, 3114, 3304, 3151, 3438, 2049, 3115, 167, -5731, -12167, -13250, -4323, -8073, -17333, -16240, -9062, 213, -2041, -3870, -218, 3674, 10013, 8250, 7036, 6019, 4810, 9942, 6810, 500, -541, 2047, 3662, -128, -185, 1521, 2971, 3834, 3966, 5240, 3568, 4263, 3388, -2510, -9229, -14385, -7271, -4466, -15273, -17532, -13830, -3646, 2185, -3911, -581, 3919, 8519, 11815, 8958, 7179, 4716, 9135, 9036, 232, -2039, 586, 3482, 240, -2914, 948, 2149, 2877, 3810, 3990, 5821, 4354, 2029, -2253, -8096, -11635, -10110, -5576, -12287, -18666, -13028, -4036, 1297, -3000, -709, 5490, 7097, 11023, 8727, 6630, 5656, 6245, 8175, 1964, -1894, -245, 3208, 1794, -1448, 2080, 2864, 3013, 5284, 5628, 5156, 2489, 1381, -2255, -9666, -14192, -9334, -3774, -14711, -19633, -10170, -78, 1588, -3971, 1557, 8023, 8933, 9299, 6958, 5265, 5136, 6740, 5847, -508, -4682, 1369, 5135, -201, -3190, 601, 5406, 4856, 3138, 3864, 4545, 3763, -91, -5055, -10589, -15477, -6558, -3726, -17690, -16620, -5968, 2963, 1761, -5211, 4448, 11266, 9761, 8081, 4528, 4771, 6813, 7924, 1563, -5706, -1555, 5279, 3153, -2765, -1039, 5365, 6511, 2377, 2521, 5242, 3690, 680, -4044, -7412, -16856, -15326, 643, -12826, -21997, -10414, 929, 8882, -5196, -1356, 12359, 10674, 12032, 4869, 3917, 6502, 5419, 5903, -4183, -3317, 4203, 1825, 122, -2560, 3169, 7114, 2550, 3169, 2282, 2760, 2794, -4781, -9619, -16026, -15547, -381, -8109, -21226, -12633, 1778, 11464, -2244, -2823, 11045, 11437, 12774, 4060, 1818, 6927, 5485, 4427, -3343, -3144, 3315, 3943, 2558, -2575, 1161, 7760, 5894, 2794, 547, 1200, 1102, -4406, -10190, -17573, -16313, -209, -7445, -21709, -13157, 3385, 12266, -2406, -2641, 12229, 12343, 8873, 3231, 4093, 5265, 4263, 4719, -3188, -3557, 4484, 7089, 1825, -3831, 4448, 10109, 4968, 1959, 541, 1218, -656, -6878, -12317, -20442, -12032, 1795, -13237, -20187, -6242, 8789, 8396, -5412, 3946, 12976, 9833, 5562, 1481, 5515, 3459, 3609, 2477, -3869, -133, 5055, 5869, 2331, -305, 4852, 6719, 6003, 3718, -935, -968, -3922, -7774, -16320, -18461, -2420, -4557, -19198, -13807, 4013, 12531, -2037, -4120, 11654, 12232, 7252, 1552, 2174, 4716, 2273, 4094, -558, -3867, 4205, 7972, 2321, -1231, 4950, 10007, 4097, 1028, 3047, 1984, -2948, -9154, -13088, -18367, -8711, -1258, -13904, -17015, -5844, 11084, 6549, -5310, 4757, 10735, 9768, 3192, -315, 3955, 1510, 3860, 3042, -2961, 529, 6807, 9287, 2117, 1192, 8787, 7606, 4416, 1943, -1656, -5062, -6890, -11854, -19209, -10110, -1821, -12571, -13571, -1917, 8477, 4982, -3581, 5719, 9424, 5039, 2524, -80, 1737, 2774, 4667, 1547, -1455, 2961, 8123, 6641, 886, 2786, 6701, 6175, 1404, -1047, -2485, -5632, -8682, -16584, -12170, -990, -7427, -12981, -6591, 5594, 6940, -3422, 2162, 9674, 6575, 1818, -16, 3424, 4922, 3461, 1472, -1292, 2343, 8247, 5500, 849, -271, 6286, 7963, 774, -3112, -3205, -1815, -8310, -17735, -12227, -1070, -5244, -12476, -7995, 4390, 6268, -1076, 2450, 7024, 6367, 3279, 373, 3080, 5154, 4196, 1297, -357, 4068, 6583, 5541, 1169, 151, 5135, 5750, 2346, -2865, -4052, -3836, -9235, -17841, -9510, 1286, -8362, -14414, -6174, 10308, 6104, -5607, 1968, 8997, 9464, 476, -1515, 4054, 4271, 3557, 1325, 1239, 1154, 5195, 7945, 1544, 440, 5359, 5284, 1807, -2317, -4482, -3782, -11351, -18461, -4729, 1144, -12276, -13584, -2276, 10357, 4638, -4318, 3232, 8172, 7826, 760, 106, 4865, 2093, 3341, 4698, 789, 667, 4195, 7132, 4651, 1482, 3745, 2172, 391, 459, -3672, -9825, -17148, -10044, 1455, -8625, -15218, -9170, 5179, 9352, -1471, -216, 3956, 9451, 4833, 1057, 3349, 81, 5442, 4094, 667, 2021, 3244, 5268, 4442, 2938, 2409, 4185, 2349, -469, -5625, -7344, -9896, -16562, -2958, -2281, -13950, -10810, 1701, 12042, -1885, -1760, 7157, 6170, 6062, 1968, 3416, 722, 2700, 6683, 1578, -305, 2261, 6748, 6068, -1407, -596, 6643, 4977, -2114, -7437, -7437, -10716, -12998, -1404, -3497, -16222, -10745, 6524, 11364, -4292, -1674, 8963, 7019, 4411, 120, 5636, 2055, -505, 8242, 2896, -2588, 1477, 7588, 6143, -1880, -821, 6435, 3170, -4067, -4903, -8002, -13677, -12791, -593, -2644, -15330, -7666, 6333, 9565, -2174, -328, 10317, 6226, 3279, 1502, 3924, 2502, 2169, 4982, 1065, 826, 2144, 4990, 4151, -1166, 831, 3643, 112, -4847, -7933, -8567, -12994, -11364, -1166, -5933, -11019, -2812, 7860, 7615, -49, 3612, 7060, 7498, 4612, 3860, 2683, 2, 6153, 5149, 1917, 313, 1726, 4464, 2854, -334, -1041, 294, -442, -7146, -12784, -10112, -13752, -5994, -2297, -8867, -6922, -1455, 11959, 7231, -414, 3688, 7875, 9982, 2794, 1433, 3273, 5183, 5500, 1752, 1159, 2164, 5274, 3292, -234, -1002, 334, 1159, -3273, -9917, -14976, -12659, -7153, -5320, -8709, -6784, -3437, 3623, 7984, 4646, 5541, 2375, 8154, 8838, 4492, 2528, -3, 9028, 7472, 575, -1446, 4078, 10458, 334, -3136, 831, -136, -2123, -8787, -10078, -15844, -17146, -2920, -2854, -9893, -9589, 2008, 9429, 4084, 4964, 4661, 3894, 6531, 7445, 6084, 1680, 2360, 7321, 7977, 2094, 571, 6127, 5359, 1349, -742, -1433, -1948, -6393, -9547, -16675, -17956, -4610, -2518, -8417, -10867, 164, 10042, 2961, 4357, 4088, 3644, 6334, 6183, 7164, 586, 2193, 8403, 6360, 2433, 2529, 6604, 3185, 409, 2765, 182, -5005, -8898, -7412, -11416, -18784, -9906, -1037, -4833, -9208, -2805, 7484, 5937, 4860, 4036, 1252, 4609, 7271, 6649, 420, 1516, 6110, 6721, 5300, 1576, 4282, 3256, 3304, 2805, -1927, -4247, -8026, -7093, -12698, -16435, -6143, -2494, -4898, -7927, -979, 7870, 4390, 4619, 3573, 2260, 4071, 6641, 4899, 83, 3369, 4705, 4797, 3419, 2922, 4461, 1953, 1909, 1859, -1179, -4945, -7836, -9898, -14640, -13070, -4183, -2805, -4703, -3808, 1417, 5802, 4998, 5797, 4343, 653, 3271, 8305, 3464, 872, 5615, 5718, 4284, 3292, 5196, 4377, -235, 1075, 1125, -3235, -7356, -10333, -11497, -16265, -12573, -2390, -3839, -5015, -1906, 3769, 6839, 4347, 6448, 5586, 1247, 5253, 7708, 2490, 2265, 4808, 5787, 4065, 2557, 4131, 2695, 1518, 1443, -422, -3607, -5815, -9299, -13583, -17615, -10573, -97, -3636, -5502, -2067, 5268, 6932, 4735, 8021, 3716, -122, 5476, 7490, 3172, 1901, 4693, 6151, 4487, 3813, 3700, 2451, 872, 440, -657, -4411, -6130, -10682, -14287, -15050, -10127, -1669, -2968, -3907, -1089, 4727, 5562, 4969, 7779, 3781, 1872, 5076, 3933, 1531, 4325, 5614, 4526, 3693, 4417, 5477, 3140, 2367, 1938, -2554, -5240, -6450, -11411, -15399, -14651, -8334, -3414, -3141, -1864, 1352, 4864, 3860, 5891, 7369, 1644, 839, 4339, 2830, 1612, 4968, 5401, 3735, 2453, 4825, 5708, 2649, 2774, 2028, -2167, -4828, -5826, -9370, -15148, -13627, -6651, -3877, -2144, -1164, 2571, 3430, 2060, 7094, 6792, 2286, 1494, 2682, 1049, 2055, 6482, 5377, 2508, 2219, 3977, 4661, 3839, 3271, 1498, -2765, -5644, -7196, -10542, -14555, -11247, -6515, -3995, -497, 1922, 3768, 1635, 2383, 6180, 4856, 2308, 2851, 2279, -550, 2875, 8208, 5237, 2360, 2781, 3002, 3369, 3862, 3894, 568, -3833, -6456, -7972, -11773, -15497, -11268, -6123, -3753, -240, 3175, 3273, 2144, 3795, 6643, 5167, 2773, 4006, 1695, -2021, 1956, 7370, 5484, 3162, 3732, 2567, 2385, 4211, 4115, 1469, -2347, -5744, -8588, -12464, -15119, -11011, -6669, -3958, 443, 2958, 3013, 1779, 3096, 5886, 4994, 2726, 3383, 1050, -1956, 630, 5140, 4893, 3791, 3984, 2263, 1555, 3089, 4218, 2856, -677, -4268, -7987, -11937, -14891, -12609, -7992, -3532, 1662, 4615, 4669, 2994, 3247, 5232, 6086, 4583, 5302, 1945, -1674, -1998, 768, 3445, 3683, 4724, 3479, 1169, 914, 2364, 2123, 675, -2786, -6018, -9823, -15081, -15112, -10693, -6792, 446, 4424, 5331, 5234, 3419, 3985, 5955, 5037, 6162, 5617, 1687, 581, -420, 1942, 3258, 3776, 4511, 4131, 1797, 1393, 1438, 24, -1088, -3336, -6502, -11200, -14851, -15289, -11924, -7227, -1162, 3237, 6468, 6218, 4596, 4231, 3950, 3010, 4625, 5057, 3442, 3266, 1946, 2195, 2406, 2924, 4628, 5058, 3745, 3537, 1149, -1494, -2641, -6177, -8557, -10558, -13654, -13722, -10636, -7289, -1518, 2805, 5873, 7140, 5836, 4722, 3968, 1981, 1917, 3276, 3237, 3864, 3101, 2328, 2687, 2373, 2972, 4508, 4049, 3898, 2279, 170, -1938, -5078, -7086, -8476, -11227, -11133, -9451, -7688, -4175, -1099, 1899, 3654, 4250, 3945, 3218, 1557, 924, 1429, 1667, 2649, 2956, 3234, 3722, 3575, 3023, 3541, 3024, 2248, 1838, 1135, 360, -617, -828, -1112, -2115, -2231, -2644, -2843, -3013, -3151, -2581, -2615, -3302, -3213, -2690, -2219, -1593, -1141, -260, -19, 367, 846, 1430, 1013, 1099, 1817, 1721, 1545, 1422, 1244, 1256, 1698, 2060, 2878, 2802, 3206, 3219, 2664, 1979, 1416, 919, 96, -1187, -1679, -1951, -2571, -2305, -1696, -1459, -1144, -1201, -1485, -1438, -2502, -2666, -2381, -2242, -2367, -1834, -1141, -377, 554, 1529, 2417, 3067, 2818, 3159, 3211, 2925, 3612, 3339, 2638, 2385, 1990, 1653, 1828, 1804, 1946, 2036, 1370, 656, 34, -1498, -2429, -2914, -3357, -3390, -3526, -3468, -3175, -2953, -2115, -1419, -1047, -575, -695, -115, -57, 560, 1122, 1091, 1406, 1667, 1755, 2310, 2721, 2869, 3245, 3208, 3328, 2938, 2482, 1758, 1138, 331, -226, -584, -886, -1091, -1260, -1380, -1537, -1594, -1607, -1886, -1875, -1765, -1891, -1584, -1924, -1904, -1964, -1810, -1291, -854, -604, -133, 16, 562, 1161, 1609, 2099, 1992, 1997, 1907, 1692, 1703, 1942, 1765, 1750, 1669, 1550, 1211, 750, 380, 234, -304, -506, -865, -1425, -1799, -1968, -2096, -2037, -1894, -1854, -1894, -2000, -1735, -1563, -1117, -1256, -1135, -894, -716, -237, 594, 865, 1542, 1869, 2115, 2414, 2141, 2062, 1740, 1242, 1060, 784, 537, 414, 21, 24, -174, -469, -584, -828, -920, -942, -1417, -1591, -1737, -1981, -2138, -2083, -2008, -1792, -1494, -1159, -620, -343, 172, 498, 817, 804, 834, 781, 682, 859, 953, 990, 906, 994, 833, 864, 766, 549, 503, 258, 39, 106, -284, -508, -654, -810, -834, -761, -791, -760, -677, -817, -758, -729, -674, -607, -414, -531, -472, -446, -643, -227, -127, -166, 146, 32, 120, 500, 359, 541, 753, 581, 378, 391, 377, 455, 518, 456, 532, 481, 422, 437, 294, 268, 15, -99, -406, -529, -424, -714, -584, -565, -523, -701, -756, -784, -752, -755, -740, -532, -490, -424, -326, -131, -49, 58, 300, 503, 631, 781, 813, 776, 880, 744, 500, 253, 114, 65, 58, 188, 214, 352, 386, -23, -31, -89, -235, -333, -581, -752, -787, -906, -752, -601, -576, -446, -174, -114, 23, 226, 260, 451, 500, 524, 440, 347, 317, 305, 377, 468, 422, 526, 461, 229, 162, 71, -114, -258, -416, -575, -747, -744, -631, -568, -414, -349, -201, 60, 146, 195, 247, 244, 295, 341, 281, 161, 50, 49, 93, 101, 153, 263, 323, 305, 330, 369, 231, 170, 104, -39, -117, -182, -213, -135, -97, -106, 16, 84, 125, 200, 235, 179, 133, 99, -37, -138, -213, -299, -349, -273, -209, -70, 76, 84, 93, 151, 164, 177, 91, 36, 187, 154, 54, 57, 15, 109, 122, 265, 318, 247, 240, 239, 273, 237, 115, -57, -218, -378, -338, -341, -269, -192, -209, -247, -227, -205, -182, -209, -214, -120, -23, -21, -88, -15, 60, 106, 169, 182, 148, 211, 247, 284, 297, 149, -60, -162, -203, -235, -166, -125, -109, -60, -114, -146, -261, -388, -479, -490, -385, -242, -52, 52, 110, 120, 141, 115, 153, 218, 224, 245, 248, 258, 222, 157, 23, -63, -41, -96, -42, 104, 166, 192, 185, 127, -15, -161, -248, -289, -393, -304, -117, -21, 93, 153, 170, 68, 63, 161, 97, -2, 15, -28, -97, -122, -250, -304, -295, -222, -167, -37, -26, -75, -50, -50, -16, -42, -117, -183, -169, -153, -6, 229, 373, 435, 464, 440, 356, 289, 94, -83, -187, -394, -414, -289, -157, -114, -127, -8, 71, 101, 172, 226, 198, 119, 130, 62, -21, -54, -170, -250, -232, -110, 23, 193, 244, 284, 195, 50, -63, -144, -221, -244, -141, -109, -32, 71, 23, -68, -78, -58, -29, 42, 68, 146, 123, 34, 91, -133, -187, -97, -133, -62, 68, 294, 495, 649, 773, 765, 690, 513, 198, -13, -185, -349, -456, -458, -383, -274, -78, 89, 130, 65, -73, -175, -321, -435, -370, -414, -458, -258, -193, -115, 93, 229, 489, 731, 735, 747, 610, 446, 323, 37, -166, -310, -333, -300, -305, -211, -143, -161, -37, 119, 45, 83, 13, -188, -198, -169, -81, -123, -125, -15, 21, 41, 57, 224, 331, 471, 672, 674, 601, 409, 231, 44, -127, -123, -67, -71, 151, 464, 771, 797, 831, 802, 636, 469, 104, -138, -338, -231, -107, -250, -258, -229, -18, 107, -16, -68, -89, -183, -351, -542, -558, -354, -310, -282, -65, 68, 265, 383, 547, 644, 747, 698, 700, 571, 253, 169, 67, -148, -256, -216, -245, -120, 141, 255, 435, 541, 446, 349, 279, 248, -5, -193, -34, -93, -31, 170, 188, 146, 73, -451, -867, -745, -830, -880, -933, -930, -651, -383, -377, -310, -175, -88, -287, -476, -849, -1065, -765, -537, -506, -490, -448, 606, 992, 516, 661, 690, 167, -140, -2, -565, -696, -1055, -1143, -1016, -1119, -924, -266, 54, 133, -19, -78, -187, -463, -567, -1080, -834, -659, -649, -320, -195, -109, -226, -180, -420, -253, -65, 6, 102, 119, 112, -73, 304, 65, -151, -203, 213, 547, 492, 677, 969, 1326, 1114, 1200, 1234, 1394, 1588, 1813, 1640, 1657, 2201, 1935, 2425, 2518, 2169, 1857, 1705, 1201, 740, 719, 122, -445, -1036, -1677, -2813, -3729, -4407, -5097, -5211, -6107, -7164, -6601, -5380, -4627, -2844, -49, 1768, 3604, 5187, 6055, 6026, 5589, 4732, 4281, 3964, 3721, 4187, 4935, 5828, 6269, 6510, 6107, 5552, 4844, 4279, 3198, 3122, 3000, 2750, 2974, 2760, 2222, 1420, 83, -2076, -4367, -6308, -8294, -9450, -10852, -13419, -13742, -11258, -9607, -7200, -1972, 1317, 4174, 7315, 8763, 8143, 6602, 4440, 2456, 294, -1086, -310, -123, 1096, 3529, 4956, 5032, 6016, 5252, 3446, 2823, 2144, 1282, 1429, 1763, 2571, 3633, 3969, 4820, 5489, 4532, 4185, 4482, 2188, 407, -922, -3481, -5981, -8268, -10633, -13054, -15240, -18166, -18420, -14714, -13687, -8523, -47, 3636, 8735, 13731, 13895, 12461, 10318, 5437, 1576, -2591, -5252, -5221, -5213, -3924, 294, 2292, 2964, 6213, 5766, 4028, 4062, 3101, 1112, 1657, 3050, 3971, 5562, 6536, 6938, 6651, 4403, 3026, 849, -2898, -3625, -4778, -6602, -6305, -5791, -7312, -8544, -10179, -13086, -17270, -16924, -13589, -13555, -5998, 2667, 6469, 13420, 17984, 17094, 14792, 9882, 3474, -1070, -6529, -9255, -8133, -8050, -4937, 409, 1781, 4305, 7203, 5331, 4375, 4094, 2203, 2351, 3321, 4299, 6580, 8045, 8101, 8154, 5886, 3115, 1528, -1906, -3385, -2838, -3552, -2593, -808, -1128, -1093, -2260, -6130, -9982, -13716, -20227, -21169, -16870, -17424, -8602, 2718, 7240, 15420, 21315, 18893, 16477, 11675, 2942, -2161, -8183, -11774, -10294, -9669, -6084, -601, 224, 2856, 5938, 3258, 3019, 4110, 1856, 3563, 6067, 6529, 9336, 10101, 9407, 8810, 4891, 1578, -32, -4385, -5203, -3469, -3700, -1104, 1649, 1805, 1888, 555, -2958, -6997, -12323, -17175, -21943, -23190, -17623, -15469, -7282, 5156, 9466, 16919, 21781, 18271, 15427, 10081, 1414, -3669, -8804, -12279, -10933, -10257, -8015, -2771, -1940, -849, 3219, 2010, 1248, 4330, 4339, 5310, 8576, 9417, 11310, 11612, 9792, 8657, 4838, 216, -1657, -4904, -6362, -4253, -3833, -1773, 1724, 2649, 3942, 3938, 1286, -234, -4185, -9429, -11797, -15287, -20648, -18740, -14542, -14028, -4961, 3948, 6315, 14107, 17945, 15395, 14916, 10112, 3732, 128, -6021, -8948, -8675, -10625, -7771, -5013, -5299, -2244, -565, -1258, 1646, 3119, 3245, 7109, 8867, 10151, 12620, 11239, 10099, 7989, 3761, 2122, -1338, -4633, -4299, -4419, -3846, -881, 1143, 2357, 3175, 3708, 3547, 1201, 120, -1802, -5735, -8864, -11581, -15895, -18994, -16857, -16417, -13464, -4235, 498, 6388, 14248, 15828, 16170, 15369, 10542, 6101, 401, -4334, -5886, -9047, -9369, -6391, -7132, -6479, -3190, -4054, -3227, -1005, -432, 1916, 5206, 8031, 10757, 12294, 12430, 12044, 9299, 5849, 2956, -1305, -3401, -3578, -5011, -3476, -1344, -240, 1716, 3935, 4778, 3718, 3102, 1601, -971, -2800, -6119, -9914, -12058, -17365, -19297, -15674, -16110, -10575, -1524, 1846, 9896, 15882, 16154, 16963, 14071, 9239, 4209, -1558, -4024, -7018, -10067, -7622, -6833, -7580, -4763, -3797, -4131, -2149, -440, 221, 2578, 5779, 7885, 10742, 12153, 12213, 10573, 6907, 4315, 1375, -2445, -3789, -3195, -3386, -2034, 838, 2451, 3492, 4438, 4625, 3760, 1945, 1328, -492, -3099, -3813, -7084, -11097, -13755, -18422, -18193, -16101, -15182, -6453, -39, 4930, 14411, 16776, 16500, 16688, 11344, 6615, 2494, -2515, -4808, -7404, -7722, -6127, -7386, -5854, -3981, -6295, -5602, -2890, -3451, -381, 4773, 6760, 10769, 13836, 14052, 13073, 9662, 6528, 2841, -2068, -3227, -4286, -5080, -1774, -3, 1018, 4334, 4625, 3312, 4815, 3584, 1260, 1519, 52, -1925, -3584, -7055, -9505, -14412, -19028, -17226, -17854, -15520, -6416, -1492, 5209, 12779, 15115, 17263, 14807, 10648, 8325, 1390, -2070, -2391, -6333, -6031, -4943, -6969, -6430, -6060, -7708, -7508, -6412, -4882, -1732, 2593, 7862, 12221, 14425, 16132, 15919, 12037, 8722, 4653, -318, -2786, -4708, -4661, -2843, -2391, -253, 2255, 2036, 2399, 3167, 3141, 2765, 2188, 2497, 1406, -1974, -4619, -7979, -14226, -18294, -18109, -18620, -16555, -9073, -3276, 2761, 10860, 13656, 15011, 15242, 10817, 7550, 3760, -745, -1794, -3834, -5060, -3701, -6123, -6508, -5407, -8773, -8547, -6420, -6789, -3172, 1856, 5468, 10833, 14216, 15576, 15966, 12812, 9206, 5873, 1140, -1692, -2446, -3586, -2696, -369, 295, 1440, 2481, 1628, 1416, 1352, 687, 951, 1115, 1308, 1034, -1545, -4528, -8201, -14425, -17787, -17844, -18541, -14448, -7010, -1682, 5430, 12133, 14307, 14987, 13200, 9586, 5737, 1089, -1399, -3313, -4656, -3635, -4067, -4890, -4649, -6164, -7552, -6984, -6437, -5776, -2195, 2802, 5632, 9843, 14208, 13745, 13170, 12011, 7721, 4760, 1732, -830, -1201, -2531, -1474, 416, -755, 1162, 2531, 179, 1782, 2151, -167, 1789, 1688, -182, 443, -2394, -5586, -8682, -14610, -15804, -16172, -17096, -11003, -5489, -1198, 6888, 10924, 12511, 13821, 10688, 8097, 5297, 883, -63, -1331, -3179, -2135, -3049, -4690, -5063, -7119, -8349, -8203, -7747, -5359, -1422, 2654, 6882, 10940, 12831, 12627, 11961, 9047, 5248, 3154, 542, -846, -93, -183, 804, 2029, 1188, 1541, 1331, -403, 71, 157, 63, 2109, 2721, 2875, 3596, 378, -3580, -6799, -13554, -17617, -17591, -18182, -14352, -7808, -2365, 4394, 9089, 11484, 12753, 10330, 8122, 6245, 2222, 943, 930, -1148, -917, -888, -3513, -4519, -6042, -8518, -8893, -8310, -6679, -3544, 607, 4925, 8607, 10857, 11620, 10998, 8695, 6294, 4011, 1651, 696, 183, 497, 1503, 1271, 1407, 1619, 709, -24, -146, 26, 367, 1287, 2446, 3623, 3883, 3260, 1797, -1927, -6289, -11023, -16375, -18287, -17755, -16580, -10886, -4333, 758, 6841, 10552, 12115, 12065, 9584, 7779, 4929, 1664, 1211, -65, -1188, -1284, -2388, -3881, -6138, -7552, -8899, -9854, -8537, -6187, -2830, 1744, 5644, 8846, 11167, 10959, 10057, 8416, 5409, 3635, 2279, 992, 1532, 1682, 1593, 2338, 1690, 1003, 771, -19, -696, 11, 565, 1406, 3016, 3907, 4981, 4232, 2464, -222, -5330, -10161, -15343, -18789, -18403, -17438, -13034, -6260, -1123, 5498, 9709, 11331, 12167, 10032, 7659, 5273, 2614, 1643, 344, -526, -222, -2099, -3425, -5399, -8058, -8917, -10430, -9407, -6435, -3904, 963, 5830, 8334, 11007, 11333, 9856, 8252, 5508, 3672, 2607, 1258, 2222, 3080, 2068, 3308, 2756, 760, 468, -489, -964, -951, 102, 2084, 3253, 4580, 5542, 4487, 2914, -807, -5657, -10180, -16003, -19792, -19110, -18112, -14419, -7307, -1966, 4263, 8776, 10518, 11849, 9802, 7903, 6183, 3638, 2982, 2120, 1151, 760, -1476, -3375, -5820, -8938, -10140, -10891, -10141, -7287, -3942, 649, 5140, 8292, 11019, 11606, 10308, 9378, 6763, 4644, 3571, 2291, 2373, 2628, 2131, 2031, 1325, -346, -958, -2196, -2596, -1375, -659, 1804, 4185, 5237, 6591, 6295, 4214, 1787, -3021, -8000, -12721, -18026, -20300, -19013, -16951, -12055, -5463, -117, 5675, 8782, 10599, 11489, 9412, 8377, 6781, 4482, 3831, 2201, 682, -804, -3359, -5560, -8474, -9847, -10602, -10505, -8019, -4854, -1281, 3055, 6833, 9054, 10666, 10581, 9086, 7718, 5693, 4219, 3448, 2482, 2700, 2537, 1567, 1208, -135, -1409, -2263, -2700, -1930, -807, 1248, 3826, 5417, 6734, 6810, 5420, 3138, -495, -4955, -9472, -13839, -17708, -19477, -17593, -15224, -10700, -4273, 372, 5391, 8667, 10338, 11157, 9752, 9260, 7312, 5080, 4328, 1433, -278, -2437, -6010, -7628, -10007, -11018, -10227, -9088, -6054, -2334, 1177, 5045, 7909, 9633, 10420, 9729, 8378, 7088, 4839, 3813, 3058, 1706, 2062, 1047, 2, -153, -1586, -2107, -2068, -1769, -161, 1446, 3623, 5554, 6412, 7005, 6156, 4377, 1612, -1654, -5445, -9409, -12653, -16185, -18222, -16414, -14656, -10942, -4994, -641, 4633, 8177, 10266, 11599, 10614, 10247, 8440, 5482, 4341, 1302, -1580, -3649, -6732, -8443, -10268, -10427, -9532, -8443, -5310, -1687, 1372, 4708, 7815, 8890, 9518, 9742, 8354, 7388, 5992, 4617, 3580, 1792, 1044, -237, -1943, -2442, -3133, -3359, -2308, -1037, 953, 2979, 4692, 6045, 6632, 6669, 5705, 4394, 1966, -594, -3768, -7646, -10948, -14836, -18036, -17849, -16304, -13696, -7451, -2047, 3336, 8382, 10714, 12542, 11882, 11019, 9661, 6372, 4977, 2734, -714, -2425, -5308, -8101, -9648, -11010, -10302, -9515, -7151, -3102, -97, 3419, 6898, 8732, 9508, 9997, 9398, 8257, 6839, 5700, 4411, 2565, 1521, 114, -1708, -2924, -3041, -3623, -3016, -1143, -42, 2141, 3821, 4938, 6244, 5958, 5787, 4830, 2440, 599, -2698, -6464, -9586, -13683, -17282, -18604, -17252, -15369, -10458, -4231, 487, 6136, 9507, 11547, 12448, 11502, 10857, 8318, 6140, 4597, 920, -1268, -3909, -7708, -9218, -11091, -11062, -10104, -8244, -4539, -1412, 2141, 5544, 7591, 9058, 9831, 9612, 9232, 8242, 7338, 6029, 4159, 2649, 443, -1218, -3023, -3709, -4008, -3756, -2135, -1138, 812, 2541, 3614, 4959, 5542, 5442, 5057, 4097, 2153, -713, -4019, -7469, -11580, -15490, -18190, -17500, -16495, -13083, -6898, -2813, 3141, 7430, 9614, 11596, 11307, 11107, 9567, 7628, 5930, 2846, 84, -2339, -6037, -8078, -9674, -10446, -9622, -8183, -5226, -2487, 617, 3583, 5685, 7209, 8138, 8596, 8391, 8039, 7430, 6518, 5179, 3869, 2088, 346, -1078, -2180, -2531, -2682, -1859, -1101, -346, 1222, 2127, 2864, 3992, 4458, 3841, 4156, 2599, -156, -2607, -6407, -10162, -14318, -17498, -16635, -15851, -12961, -6588, -2649, 2209, 6266, 8122, 9683, 9477, 10097, 9250, 7804, 7170, 4872, 2120, -393, -3969, -6761, -9097, -9773, -9420, -8661, -5714, -3394, -1161, 1732, 3977, 5437, 6742, 7990, 8550, 8409, 8388, 7917, 6154, 4701, 2976, 849, -938, -2058, -2536, -3018, -2536, -1471, -1253, -133, 1164, 2213, 3128, 4404, 4513, 4282, 3216, 656, -2002, -5722, -9218, -12951, -16200, -16021, -14698, -12981, -7560, -3244, 685, 4383, 6831, 8614, 8414, 9820, 9860, 8482, 8425, 6177, 3703, 1058, -2599, -4959, -7839, -9292, -9269, -9542, -7347, -5388, -3554, -136, 1731, 3977, 6205, 7429, 8695, 9240, 9312, 9070, 7718, 6369, 4321, 2157, 724, -1446, -2297, -2776, -3412, -2560, -2133, -1034, -11, 1148, 2357, 2828, 3084, 3442, 2029, 185, -2008, -5119, -8661, -12380, -14950, -16211, -15521, -13289, -8716, -4545, 54, 3933, 6200, 8153, 8252, 9136, 9023, 8394, 8287, 6644, 5161, 3247, -185, -2265, -5193, -7321, -8120, -8688, -7206, -6365, -4060, -1503, -107, 2383, 4052, 5511, 7166, 8044, 9234, 9422, 8757, 8203, 6055, 4341, 2495, 78, -659, -1852, -2299, -1818, -1826, -1192, -636, -80, 958, 1458, 2211, 2662, 2036, 1297, -692, -3091, -6091, -9635, -12716, -14412, -15007, -13818, -10662, -6833, -3146, 752, 3503, 5401, 6307, 7023, 7437, 6894, 6781, 6433, 4929, 3857, 1883, -8, -1963, -3860, -4536, -5529, -5279, -4459, -3914, -2508, -1508, 50, 1357, 2706, 4609, 5882, 6818, 7562, 7532, 6831, 6257, 5221, 4010, 2956, 2692, 1932, 1641, 1198, 849, 458, -308, 37, -131, 135, 1052, 1378, 1567, 1429, 481, -1104, -3047, -4971, -6808, -9287, -10380, -12011, -12567, -12096, -11007, -8813, -6573, -3268, -1010, 1052, 3219, 3836, 4409, 4912, 4757, 4888, 4404, 4544, 3682, 2597, 2614, 791, 58, -609, -1479, -1494, -1805, -1213, -872, -685, 122, 390, 734, 1719, 2312, 3003, 3510, 4109, 4281, 4584, 4862, 5231, 5562, 5503, 5781, 5670, 4890, 4537, 3263, 2390, 1062, -29, -357, -1602, -1818, -2224, -2709, -2620, -3084, -3494, -3144, -3836, -3654, -4932, -5641, -6825, -8576, -8882, -9503, -9104, -8370, -7216, -5807, -4633, -2959, -1804, -479, 740, 1687, 3078, 4130, 4763, 5476, 5278, 5360, 4050, 3635, 2459, 1657, 1360, 745, 623, 55, -73, -170, -140, -58, 433, 802, 1562, 2068, 2708, 3354, 3547, 4115, 4591, 4174, 4472, 4255, 4015, 3958, 2927, 2644, 1550, 786, 170, -843, -782, -1239, -1016, -1399, -862, -713, -273, -263, -390, -433, -1461, -1825, -2429, -3502, -3885, -4409, -4698, -5461, -5584, -5391, -5524, -4938, -5372, -4057, -3877, -2640, -1807, -849, -44, 461, 1529, 2192, 2320, 2961, 3006, 2463, 2437, 2343, 1769, 1813, 1468, 854, 982, 722, 870, 893, 1000, 1662, 1094, 1945, 2002, 1778, 2239, 2196, 2167, 2416, 2333, 1773, 2120, 1078, 857, 495, 248, 763, 258, 498, 844, -88, 458, -325, 2, -628, -794, -575, -722, -1578, -1807, -1373, -2740, -2011, -2524, -2737, -2607, -2547, -1981, -1826, -1779, -1468, -1968, -2062, -1808, -1920, -1899, -1071, -1409, -218, -157, 117, 776, 159, 748, 1192, 664, 1636, 1847, 1659, 1619, 1578, 1378, 1005, 584, 771, 852, 407, 1644, 489, 765, 674, 651, 813, 896, 932, 1471, 1808, 1240, 1839, 1567, 1942, 1287, 744, 656, 586, 373, 599, 203, -580, -594, -1810, -1369, -1789, -2010, -1279, -1690, -1542, -1578, -1281, -1289, -643, -1323, -737, -675, -763, -740, -1308, -638, -625, -1201, -245, -786, -187, -446, 555, 39, 619, 291, 711, 726, -97, 873, -295, 338, 106, 542, -148, 70, 70, -375, -304, 127, 591, 32, 476, 412, 177, 354, 651, 346, 154, 437, 172, 891, 771, 604, 398, 104, 265, 336, 515, 235, 654, -45, -253, -427, 183, -65, -393, 75, -138, -695, -497, -601, -953, -1055, -911, -401, -435, -385, -388, 247, -386, -388, -151, -213, 635, -247, 1003, 657, 1185, 506, 1021, 839, 805, 825, 256, 1282, 196, 399, -10, 32, 435, 385, 1133, 808, 570, 437, 190, -343, -39, 390, -42, 1049, 463, 360, 385, 370, 469, 688, 825, 990, 1041, 1037, 869, 284, 162, 568, -244, 312, -245, -45, -448, -523, -1062, -808, -1357, -854, -946, -782, -724, -508, -870, -182, -1088, 28, -349, 50, -67, 198, -253, 308, 446, -102, 636, 263, 622, 73, 477, 734, 398, 123, 369, 571, 807, 615, 631, 998, 748, 325, 674, 424, 117, 651, 49, -3, -104, -177, 255, -630, 104, -196, 417, -232, 627, -122, 114, -93, -619, -151, -166, -140, -302, -653, 18, -813, -518, -864, -643, -1000, -726, -869, -1229, -617, -942, -76, -619, -294, 437, 153, 177, 302, 570, 456, 609, 542, -255, 140, -286, 894, 47, 253, -68, -182, 399, -21, 76, 122, 359, 266, 742, 562, 391, 726, 313, 464, -5, 545, 487, 122, -8, 167, 115, 18, -13, -240, -112, 175, -109, -83, -52, -476, -91, -214, 287, -769, -373, -630, -429, -977, -508, -727, -1151, -555, -1078, -354, -670, -344, -446, -278, 86, -255, -149, -396, 276, -310, 73, -310, 80, -265, -120, -16, -198, -294, -13, 130, 58, 141, 97, 357, 506, 456, 307, 713, 256, 557, 477, 247, 714, 198, 485, -154, 224, 164, -308, -234, -424, 318, -724, 125, -420, 63, -177, -89, 52, -456, 84, -813, -109, -773, -42, -677, -599, -182, -438, 58, -451, -183, -407, -200, -696, -123, -252, -287, -109, -175, -206, -250, -510, -177, -432, 91, -677, -378, -112, -211, -11, -294, -162, 372, 200, 80, 528, 656, 789, 607, 795, 440, 693, 672, 287, 299, 529, 179, -179, -122, 32, -222, -170, -378, -482, -297, -411, -125, 18, -253, -205, 339, -239, 29, -417, -162, -258, 11, -244, -131, -37, -242, -295, -122, 23, -294, -253, -271, -140, -489, -351, -640, -252, -455, -174, -240, -372, -526, -203, -295, -75, -354, 39, 239, 477, 198, 847, 106, 615, 308, 336, 654, 403, 643, 232, 662, 135, 297, 258, 209, -80, 383, 209, 19, 63, 80, 68, 297, -378, -164, -245, -487, -253, -307, -505, -325, -252, -54, -258, -88, -187, 390, 138, 146, 203, 80, 201, 88, -42, 34, -97, -388, -68, -432, -339, -203, -524, -172, -667, -94, -666, -505, 31, -88, 93, 330, 37, 106, 96, 414, 396, -31, 122, 169, 391, 265, 610, 47, 23, 495, -119, 289, 94, 407, 455, 256, 367, 442, 193, -326, 383, -545, 131, -859, -307, -549, -481, -526, -334, -235, -666, 115, -308, -86, 81, -117, 281, 141, 445, 39, 325, 55, -148, -47, -192, -44, -394, -229, -282, -133, -177, -29, -266, 214, 63, 62, 161, 268, -10, 57, 88, 50, -169, 258, -166, -237, 101, -3, 89, -123, 81, 32, 146, 169, 370, 65, 515, 164, 96, 206, -159, 8, 29, -276, -68, -135, -162, -144, -2, -55, -336, -68, 15, -135, -213, 151, -330, 49, 291, 218, -261, -284, -273, -143, -424, -21, -481, -203, -234, 39, -149, -167, 164, 214, 28, 265, 420, 208, 295, 156, 360, 57, 190, 307, -54, -36, -104, 15, 49, -432, -218, 198, -130, 39, -162, -32, 102, 37, 93, 15, 174, 11, -526, 399, -313, 607, -68, 200, 336, 430, -65, 88, 190, -135, 349, -28, 411, -226, 282, 222, -208, -167, -185, -323, -411, -148, -445, -123, -552, -114, -437, -172, -131, 128, -347, 13, 218, -26, 300, 208, 47, 196, 203, 149, 216, 119, 21, 117, -141, 177, -16, 235, -229, 198, -26, -89, -149, 157, -269, 169, -140, -351, -221, -198, 32, -216, -161, 263, -52, 339, -260, 494, 284, 185, 11, 641, 409, 157, 500, 125, 104, -21, 161, -518, -21, -227, -93, -195, -338, -125, -141, -536, -3, -244, -71, 84, 119, -5, -57, 313, -24, -119, 188, -185, -62, -333, -123, -45, 60, -216, 218, -172, 307, 106, -36, 414, 187, 268, 44, 24, 213, 127, -128, -47, -57, -278, -133, -36, 182, -102, 153, 644, -192, 39, 200, 36, 523, -52, 435, 250, 47, 127, 130, 81, 67, 588, -463, 140, 164, -328, 54, -153, 26, -18, -80, 42, 206, -99, -182, 414, -529, -166, -10, -183, 109, -6, -143, -154, -138, 135, -237, 313, 119, 28, 255, 106, -154, 0, 498, 71, -253, -195, -140, -266, 179, -57, -234, 151, 425, 21, 159, -130, 135, 282, -52, 680, -50, 516, 224, 453, -377, 130, -131, 248, -128, -65, -291, -76, -130, 54, -119, 8, -112, 11, -349, 156, 247, -307, 240, 208, -386, 47, -256, 245, -135, -15, -284, -37, -127, -216, 62, -6, -39, 367, -68, 15, 123, -83, 338, -143, -151, 282, -157, -214, -229, -190, -330, -203, 29, 115, -89, -24, 464, -341, 359, 195, 307, 369, -206, 245, 265, 240, -41, -167, -128, -39, 226, -352, 167, -364, -466, 328, -317, -266, 180, 177, -37, 544, -312, 328, -354, 498, 63, 235, -276, 81, -278, -47, -34, -159, -175, -41, -544, 159, -617, 2, -19, 140, 276, -8, 406, -125, -138, 250, -104, 325, -584, 237, -144, -55, -119, 138, 122, 297, -185, -209, 101, -41, 386, 115, 330, 36, -57, -19, 305, -136, -211, 518, -313, 140, 91, 260, -32, -719, 404, 110, -23, -343, 70, 240, 300, -369, 489, -258, 187, -477, 359, 68, -104, 344, -461, 550, -531, 255, 351, -138, 97, 166, 667, -148, -75, -213, -205, 183, -279, -287, -188, -708, 41, -18, -115, 198, -349, 373, 466, 221, 263, -169, 484, 123, 232, 203, -235, 346, -721, -190, 128, -942, -601, 47, 205, 10, 321, 209, 172, 187, -432, 367, 125, 128, -154, 349, 339, -110, -312, 172, -349, -201, 407, -352, -101, -531, 195, -161, -580, 359, -346, 468, -149, -903, 232, -13, -128, 323, 354, -351, 62, 372, -682, -396, -106, 302, -250, 154, 179, 94, -141, -60, 393, -227, 159, 154, -672, -175, -102, -338, -159, -269, 70, -459, 304, 672, -362, -63, 318, 386, -636, -321, 365, -41, 313, -97, 359, 907, 2, 459, 13, -13, 182, -219, -60, -156, 31, -550, -560, -80, -281, 326, -291, 44, 393, 84, 328, 60, 719, 23, -159, 459, 339, -591, -372, 373, -474, -576, 471, 101, 8, 185, -305, 442, -180, -320, 365, -75, -68, 219, 331, 16, -239, 630, 133, 148, 156, 424, 2, -125, 119, 442, -180, -606, 669, 170, -362, -482, -339, 240, 286, 373, 490, -8, 330, 19, -370, -94, -273, 115, 312, 383, 346, -438, -401, -190, 19, -58, -58, -104, -231, -161, 54, 503, -136, 80, 218, -424, 364, 75, -351, 57, -330, 456, -519, -269, 287, -88, -320, -869, 679, 865, -513, 32, 320, 357, 5, -576, -563, 156, 321, 104, -448, -172, 154, -110, 81, -292, -208, -404, 211, 333, -201, -180, -279, -274, -117, 94, 232, 393, 307, -539, 115, 719, 523, -414, -211, 1003, 146, -672, -300, -106, 369, -57, 153, 325, -815, 170, -351, -844, -274, -237, 388, 11, 42, 198, 39, 1044, 419, 52, 159, 167, 552, 260, -196, -334, 318, -42, -477, -635, -959, -247, -508, -718, -403, -508, -260, -278, -42, 37, 656, 54, -362, 380, 666, 964, 442, -307, 619, 469, -651, -3, -808, -552, -378, -1547, -891, -557, -693, -614, -998, -519, 417, 67, 192, 542, 151, 722, 492, 648, 317, -799, -16, 55, -54, 229, 565, 680, 513, 140, 563, 427, -299, -542, -727, -619, -1360, -1841, -1568, -2078, -838, 297, -235, -15, -417, 601, 2321, 1414, 1515, 1802, -235, -765, -599, -857, -2411, -4459, -4870, -4641, -4088, -3547, -2146, -1773, -2838, -182, 3093, 5974, 6312, 6463, 8622, 8156, 8636, 8834, 8000, 5768, 2479, 2390, 1916, -209, -1107, -1903, -2411, -4599, -4409, -1995, -2523, -4701, -6237, -7659, -9201, -11558, -14781, -10898, -3497, -6554, -7143, -5180, -578, 6919, 5005, 8278, 8310, 3182, 4360, 4526, 7146, 2946, -3054, -2463, -4550, -3761, -4481, -2985, -2745, -5784, -1349, 3719, 6547, 7078, 6914, 10463, 10310, 10248, 12258, 11692, 7484, 3856, 4364, 3347, 860, -1667, -1950, -2146, -3813, -2078, -932, -1403, -1515, -5018, -5748, -8412, -10937, -10904, -18257, -19870, -7609, -4419, -6424, -5054, -1057, 9696, 10248, 10995, 15786, 6825, 2745, 2641, 5468, 3870, -8487, -10359, -11257, -10994, -8619, -7849, -4086, -6242, -4352, 4153, 8628, 11877, 12304, 12619, 12218, 10901, 12089, 11058, 6167, 1922, -101, 602, -1312, -2768, -1753, -1989, -812, 1141, 4063, 5484, 3440, 4471, 4914, 510, -2818, -8922, -13050, -19089, -27188, -15140, -7664, -13666, -10123, -8907, 3919, 11875, 9021, 18508, 11735, 3417, 6219, 5930, 8515, -2365, -10510, -8773, -12541, -11326, -7484, -3731, -5201, -8440, -10, 8524, 9872, 10101, 10672, 10927, 8810, 8628, 10344, 7058, 1362, -724, -403, 1554, 1748, 1391, 2370, 1282, 2313, 7156, 8807, 5128, 2216, 2390, 568, -3396, -7044, -11984, -17127, -24787, -27669, -12859, -4331, -8849, -7268, -3044, 9281, 13586, 10175, 17940, 9575, -966, 268, 1502, 5705, -5640, -13526, -10456, -13039, -8109, -2567, 1133, 318, -4763, 2422, 9703, 11961, 10185, 6292, 6071, 2674, 2143, 5716, 5135, 774, -1424, 662, 3058, 5919, 8086, 7541, 5034, 3438, 7287, 8706, 4771, 641, -1542, -416, -2284, -5627, -7778, -13539, -18607, -24146, -25292, -7859, 68, -5675, -4497, -2188, 7159, 11174, 8302, 14292, 4872, -5597, -2307, 78, 2370, -4795, -9898, -8247, -10373, -4302, 2922, 5041, 888, -4071, 1912, 6443, 7503, 7771, 3354, 1448, -420, 1714, 5542, 6823, 5909, 1929, 3422, 6523, 8187, 11083, 8291, 5011, 3269, 2898, 6362, 4818, 424, -1946, -1282, -878, -4219, -6321, -10042, -15852, -19104, -23985, -13172, 1149, -5028, -6063, -3407, 1013, 9565, 6497, 9474, 7255, -4198, -3222, -2016, 2693, 2026, -6781, -6466, -6632, -3219, 1222, 3558, 3273, -3122, -2136, 1989, 4274, 5617, 1795, 1774, 433, 1201, 6662, 6815, 7812, 6313, 5578, 8063, 8463, 10058, 8945, 4060, 2086, 1846, 3891, 2607, -817, -2222, -2229, -1547, -3552, -5055, -8451, -15593, -16206, -20787, -20763, -4375, -1964, -5172, -3709, -3010, 8398, 8398, 7828, 12938, 1433, -3141, -2060, 834, 5698, -4765, -6856, -5657, -7114, -1735, 81, 3937, -37, -4154, 1489, 3674, 6747, 6245, 3336, 3729, 964, 4219, 7588, 8571, 8862, 6800, 5898, 6933, 8102, 9044, 8044, 2828, -378, 981, 1523, 536, -2461, -3417, -3409, -5654, -4994, -5463, -11529, -14518, -16489, -21623, -13597, -1503, -3182, -2576, -4489, 291, 8745, 5550, 11237, 9196, -1805, -2279, -3015, 3683, 1958, -5854, -3817, -7992, -5731, -990, 1971, 4656, -899, -851, 2299, 4024, 7315, 6097, 5718, 4076, 3271, 6761, 7925, 9015, 8578, 6735, 5990, 5818, 6541, 7513, 4159, -339, -898, -52, -409, -2464, -3469, -3487, -4055, -5148, -5791, -7774, -12247, -13903, -17073, -16812, -3885, -2393, -5076, -1263, -3209, 3156, 4248, 4516, 10234, 1219, -3422, -2662, -1476, 2711, -2318, -1078, -1239, -5016, -1929, 994, 5445, 3471, 218, 2471, 3357, 4227, 4943, 6479, 5958, 2312, 3609, 6135, 7656, 7778, 6015, 6162, 5755, 5404, 6886, 5805, 2490, -18, -620, 843, 36, -1398, -3000, -4878, -5125, -6146, -6708, -9255, -12578, -14804, -18856, -12362, -3029, -5586, -3818, -4058, -2435, 4753, 2683, 7143, 7898, 474, -635, -1269, 2878, 1881, -2369, -1161, -4419, -3685, -2541, 555, 3315, 148, 810, 1992, 3555, 5688, 6180, 8333, 7120, 5330, 6641, 6998, 8641, 7919, 5791, 6136, 4167, 3745, 5349, 4208, 3429, 1159, 612, 604, -1398, -1437, -2510, -3857, -5953, -8609, -9649, -12529, -13253, -15865, -16994, -9416, -7763, -8615, -5394, -6253, 674, 2748, 2086, 8617, 5666, 2708, 2297, 2692, 5570, 1075, 1331, 1031, -1510, -1521, -2930, 1247, 1229, -352, 1601, 1312, 2654, 2177, 3344, 7167, 5774, 5545, 6281, 6403, 8119, 7028, 8117, 9432, 5951, 5229, 4894, 4122, 3656, 1656, 1256, -968, -4286, -5507, -6109, -5782, -7172, -8222, -9044, -10097, -11162, -12696, -10544, -6898, -7731, -6601, -6179, -5352, -1500, -2312, 945, 4571, 3002, 3075, 2304, 3438, 3265, 1679, 3430, 2508, 1802, -151, -568, 1063, 333, 1550, 2211, 2057, 2070, 1722, 3054, 4130, 4088, 5037, 5633, 5727, 5808, 5627, 6015, 6333, 5484, 4795, 4271, 3612, 2851, 2031, 1453, 362, -200, -1016, -1722, -2482, -3506, -3776, -3977, -4722, -6180, -7729, -8356, -9286, -10151, -9925, -9985, -9050, -9430, -9166, -6458, -4896, -3206, -1911, -891, 299, 247, 1924, 4036, 4852, 5110, 3869, 4221, 4013, 3896, 5057, 4873, 4536, 4071, 3719, 4607, 4474, 4643, 5737, 5856, 5989, 5643, 5990, 6148, 5787, 5323, 4696, 4461, 3700, 2404, 1958, 1003, 140, -537, -1563, -2231, -3297, -4609, -5657, -6903, -8810, -9929, -10708, -12369, -12896, -13062, -12670, -10946, -10437, -8541, -6138, -5200, -2477, -929, 753, 1807, 1907, 4023, 4878, 5278, 5617, 5315, 6302, 6063, 6313, 7612, 7073, 6891, 6507, 6404, 6896, 6680, 6445, 6213, 5619, 5177, 4580, 5044, 4787, 4156, 3916, 2683, 2580, 2057, 956, 724, -440, -1508, -2179, -3545, -4521, -5576, -6982, -8201, -10003, -10933, -10984, -12093, -12357, -12482, -11938, -9800, -9003, -7091, -5010, -3805, -1695, -282, 1440, 2995, 3177, 3586, 4304, 4795, 5209, 5247, 5670, 6141, 6606, 6966, 7609, 8081, 7865, 8343, 8300, 7575, 7701, 6632, 5916, 5344, 4136, 4037, 3320, 3000, 2836, 2206, 1675, 917, 542, -299, -1365, -1992, -2865, -4125, -5422, -6607, -7838, -9013, -10271, -11237, -11380, -11466, -11304, -11187, -10479, -9101, -7701, -5894, -4420, -3166, -1107, -6, 1289, 2695, 2851, 3966, 4482, 4644, 5279, 5125, 5833, 6295, 6526, 7313, 7375, 7729, 7700, 7606, 7817, 7183, 6701, 6200, 5693, 5052, 4084, 3646, 3140, 2659, 2446, 1606, 851, 481, -148, -667, -1370, -2289, -3070, -3997, -5242, -6172, -6745, -7782, -8877, -9575, -9914, -9904, -9917, -9661, -9190, -8240, -7050, -5974, -4407, -3136, -2062, -831, 58, 810, 1654, 2117, 2825, 3468, 3948, 4432, 4799, 5481, 5792, 6291, 6680, 6547, 6664, 6497, 6633, 6800, 6399, 5984, 5442, 5143, 4670, 4214, 3635, 2935, 2487, 2062, 1567, 1088, 388, -41, -433, -1206, -1732, -2399, -3093, -3682, -4521, -5135, -5526, -6172, -6925, -7370, -7729, -7721, -7614, -7765, -7317, -6907, -6435, -5659, -4789, -3698, -2696, -1766, -828, -36, 575, 1149, 1880, 2466, 2932, 3153, 3484, 3852, 4036, 4388, 4594, 4667, 4734, 4748, 5039, 5182, 5099, 5024, 4894, 4885, 4601, 4250, 4073, 3617, 3245, 2841, 2269, 2045, 1518, 938, 591, 125, -351, -782, -1273, -1685, -1813, -2063, -2532, -2862, -3318, -3623, -3917, -4521, -4951, -5154, -5362, -5498, -5722, -5794, -5482, -5278, -4758, -4224, -3583, -2672, -2112, -1508, -812, -346, 115, 562, 786, 1141, 1516, 1768, 2185, 2593, 2896, 3213, 3367, 3542, 3683, 3839, 3869, 3782, 3834, 3823, 3758, 3763, 3591, 3526, 3380, 2959, 2727, 2394, 2182, 1966, 1459, 1071, 744, 398, 81, -227, -599, -839, -1125, -1471, -1555, -1729, -2002, -2190, -2437, -2542, -2644, -2739, -2808, -2989, -3084, -3153, -3166, -3149, -3063, -2964, -2791, -2648, -2494, -2299, -2211, -1990, -1679, -1424, -1273, -998, -528, -104, 244, 609, 1010, 1365, 1640, 1888, 2112, 2271, 2419, 2641, 2786, 2763, 2646, 2588, 2549, 2372, 2188, 1929, 1795, 1630, 1506, 1383, 1256, 1172, 927, 778, 683, 635, 552, 455, 328, 200, 188, 45, 5, -50, -226, -180, -255, -420, -516, -627, -606, -748, -956, -1023, -1052, -1128, -1260, -1380, -1406, -1468, -1498, -1445, -1429, -1437, -1341, -1286, -1182, -1057, -982, -812, -620, -463, -256, -19, 109, 133, 211, 357, 508, 531, 536, 536, 503, 555, 495, 468, 445, 459, 547, 554, 560, 721, 870, 994, 1115, 1157, 1227, 1282, 1291, 1310, 1211, 1107, 914, 696, 619, 472, 237, -29, -339, -495, -628, -763, -870, -972, -982, -969, -956, -948, -925, -971, -927, -906, -912, -885, -893, -857, -870, -834, -860, -937, -994, -1029, -948, -959, -898, -781, -761, -583, -469, -325, -110, -70, 62, 234, 377, 515, 549, 610, 708, 766, 849, 875, 883, 851, 844, 950, 976, 961, 997, 1029, 1024, 950, 942, 904, 789, 705, 565, 471, 273, 52, -47, -175, -313, -438, -508, -518, -545, -497, -458, -455, -445, -437, -420, -461, -560, -659, -732, -851, -917, -982, -1094, -1156, -1183, -1050, -886, -776, -644, -500, -346, -166, 23, 175, 265, 334, 430, 571, 711, 786, 849, 865, 841, 817, 787, 771, 742, 687, 714, 729, 700, 670, 589, 593, 519, 463, 455, 399, 315, 226, 133, 62, -5, -96, -151, -216, -304, -351, -424, -505, -554, -620, -659, -687, -685, -644, -623, -606, -588, -495, -472, -459, -422, -416, -373, -320, -234, -187, -107, -70, -47, 15, 68, 175, 183, 226, 237, 256, 282, 302, 343, 394, 378, 429, 468, 500, 597, 641, 708, 766, 713, 690, 708, 679, 693, 669, 541, 364, 214, 73, -23, -154, -224, -235, -265, -287, -317, -297, -193, -133, -96, -229, -315, -399, -531, -550, -576, -552, -539, -576, -554, -532, -393, -273, -227, -159, -131, -106, -31, -6, 34, 115, 114, 157, 195, 226, 304, 341, 487, 623, 670, 877, 1192, 1685, 2308, 1984, 1255, 815, 498, 205, 63, 214, 218, -45, -3, -218, -331, -558, -506, -482, 808, 1136, 2, -1325, -1291, -599, -956, -938, -989, -599, 451, 1011, 2156, 1942, 420, 502, 1133, 1628, 649, -828, -1050, -782, -75, 258, 607, 1044, -109, -60, 950, 1143, 1325, 1185, 281, -239, -620, -653, -115, -607, -875, -1239, -1289, -672, -680, -323, -237, -742, -888, -792, -583, -28, -1211, -1763, -576, 109, 170, -37, 99, 1693, 1859, 1362, 580, -584, 211, 343, 68, -623, -1446, -1843, -1558, -1084, -742, -930, -849, -391, -88, 344, 782, 977, 984, 300, 336, 817, 628, 54, -545, -554, -240, -805, -437, 88, -474, -610, -183, 779, 1266, 661, 1282, 1341, 854, 718, 161, 54, -162, -883, -1362, -2123, -2123, -2336, -3050, -3278, -4028, -4308, -4485, -4521, -4859, -5748, -6464, -5807, -5792, -5968, -5472, -5315, -3888, -2651, -745, 1419, 2407, 3394, 4360, 5481, 6705, 6831, 6692, 6245, 5086, 4800, 4133, 3662, 3336, 1878, 1302, 909, 1128, 1881, 1859, 1956, 1823, 1830, 1752, 859, 49, -1144, -2021, -3136, -5641, -7352, -9896, -12076, -13773, -16352, -13722, -7739, -6989, -5096, -4646, -1047, 4250, 5138, 9964, 10935, 9453, 8589, 6019, 8362, 6459, 2429, -242, -4138, -4576, -6752, -6805, -5432, -6362, -5468, -5372, -2214, 1951, 3399, 6740, 8515, 10307, 12308, 12419, 13982, 13175, 11143, 9185, 6503, 5628, 3156, 1250, -435, -3312, -3633, -3961, -3718, -2346, -2500, -1403, -1942, -3588, -4328, -6755, -7911, -11948, -13390, -5744, -4203, -5248, -6133, -5003, 2377, 2456, 5295, 9120, 6252, 5049, 1818, 4805, 6576, 1984, 346, -3016, -4497, -6058, -6300, -2620, -4232, -5615, -5589, -3857, 1433, 2765, 5565, 7183, 6310, 7765, 8805, 11248, 10843, 8034, 7532, 5550, 4052, 3474, 2653, 1317, -1427, -2144, -1295, -989, -685, 93, 1117, 552, -88, 948, 1766, 354, -2039, -6516, -10041, -12549, -17078, -14297, -7315, -9132, -9021, -9258, -5037, 2878, 2006, 8438, 10240, 6856, 6958, 4567, 10183, 7810, 2888, 1211, -4334, -4886, -7419, -6263, -4265, -8485, -8266, -7878, -3716, 343, 1615, 6688, 6339, 7294, 7771, 9497, 12347, 9407, 8011, 5808, 3703, 4029, 1032, 2287, 813, -3208, -2143, -2269, -763, 26, -391, 2039, 690, 810, 2010, 2229, 1131, -1659, -4657, -9581, -10932, -15115, -17687, -10497, -8593, -10445, -8875, -8123, 981, 2396, 5193, 11099, 8497, 9062, 6737, 8003, 11029, 3365, 2005, -1726, -4276, -6468, -8347, -4680, -6971, -8420, -7781, -6076, -498, 568, 4666, 7778, 7807, 9200, 9534, 12167, 11808, 10146, 9175, 6360, 4359, 2619, 1336, 971, -3109, -2602, -3094, -3010, -1698, -1911, 391, 821, -719, 745, 1372, 1399, -1024, -3653, -5422, -8950, -10696, -16041, -17776, -11031, -9906, -9672, -8687, -8156, 425, 776, 5130, 12039, 9403, 10330, 6990, 8524, 10984, 5748, 4341, -537, -1951, -5724, -7094, -4453, -6724, -7265, -7755, -5643, -2024, -2274, 2641, 6339, 6982, 8505, 8843, 12028, 12315, 10904, 9896, 8182, 6494, 3706, 3037, 1948, -1096, -1982, -3169, -2050, -1266, -1313, -167, -80, -544, 563, -162, -28, -542, -2489, -4245, -7016, -9693, -12166, -16201, -16013, -9554, -9961, -9269, -9602, -5787, 261, 1440, 7399, 9024, 8648, 7507, 6625, 11266, 8544, 6193, 4339, 138, -1373, -4979, -4193, -3602, -6427, -6620, -7369, -4495, -3036, -1446, 2955, 4031, 5456, 6192, 8596, 11657, 10930, 10182, 9192, 7104, 5339, 4544, 4925, 2620, 291, -1188, -1773, -1003, -838, -1010, 502, -138, -1067, -183, 119, 58, -1058, -2756, -3899, -5481, -7964, -9765, -13255, -15097, -12138, -9917, -8373, -9174, -9226, -4771, -2068, 2156, 4227, 5021, 5906, 4685, 7760, 7687, 7950, 7151, 3997, 3058, 524, 305, 656, -1440, -2511, -4144, -3958, -3287, -2599, 114, 60, 1127, 1646, 3510, 6107, 5679, 6099, 6617, 6331, 6872, 5745, 6521, 5641, 3529, 3295, 2398, 2258, 1687, 542, 708, -333, -1195, -536, -766, -99, -1594, -2857, -3268, -4448, -4481, -5414, -7216, -8364, -11175, -12188, -9091, -8481, -7601, -7670, -7693, -5106, -4390, -1377, -183, 974, 1333, 1563, 3524, 3972, 5179, 5500, 4698, 4412, 2909, 3013, 3448, 1903, 2062, 508, -1015, -1097, -482, 1343, 964, 729, 1638, 1834, 3443, 3474, 4885, 5815, 4695, 4860, 4633, 4765, 5305, 3903, 3133, 2857, 1672, 2073, 1177, 732, 627, 416, 130, 6, -873, -1357, -1102, -1713, -1883, -3024, -3458, -3794, -4679, -5906, -6718, -7935, -7828, -7304, -7769, -6766, -6750, -6578, -5914, -5086, -3058, -2182, -1146, -929, 200, 1818, 2302, 3419, 3151, 3455, 3422, 3471, 3593, 3692, 3351, 2151, 1404, 1135, 1591, 1635, 1334, 1015, 1218, 2446, 2646, 2760, 3664, 3601, 3959, 4128, 4812, 5326, 3912, 3627, 3201, 2511, 2552, 2429, 2256, 1773, 883, 377, 711, 346, 403, -782, -247, -453, -1396, -1442, -1760, -1484, -2312, -3518, -3312, -3886, -3550, -4359, -5076, -4495, -4394, -4182, -4529, -3708, -4084, -3997, -3568, -3153, -2696, -2398, -1792, -1529, -1177, -445, -52, 682, 584, 1568, 2036, 1857, 2401, 2550, 2886, 3240, 3304, 3459, 3354, 3144, 3554, 3078, 3076, 3109, 2292, 2325, 2206, 1732, 1852, 1659, 753, 1287, 938, 899, 1070, 690, 940, 881, 867, 778, 791, 260, 343, 357, -312, -193, -503, -347, -563, -1037, -825, -1419, -1006, -1877, -2011, -2015, -2208, -2154, -2735, -3143, -3133, -2942, -2961, -3054, -3263, -3076, -2667, -2612, -2323, -1586, -1523, -995, -550, -106, 386, 378, 833, 1151, 990, 1291, 1571, 2226, 2315, 2266, 2313, 2006, 1804, 1732, 1916, 1708, 1409, 1029, 1123, 917, 953, 1299, 1107, 938, 365, 1192, 821, 1231, 1011, 492, 1060, 675, 732, 828, 748, 440, 39, -84, -232, 240, -555, -609, -463, -1084, -706, -1122, -891, -1156, -1229, -1180, -1295, -1450, -1443, -1838, -1674, -1417, -1466, -930, -1211, -813, -920, -349, -503, -97, -218, -32, 19, -99, 375, 179, -130, 140, -279, 174, 39, 174, 96, -71, -99, -151, 99, -8, 323, 58, 281, 446, 667, 211, 761, 899, 990, 776, 709, 1131, 786, 834, 821, 709, 881, 291, 224, -93, 391, 276, -424, -182, -300, -222, -554, -219, -344, -1032, -565, -1167, -779, -541, -968, -805, -805, -550, -721, -157, -330, -310, 57, 188, 344, -49, 531, 390, 32, 807, 359, 610, 411, 156, 177, 196, 351, 141, 281, 247, 506, 297, 820, 440, 672, 497, 682, 659, 782, 692, 375, 609, 735, 498, 955, 60, 864, 523, 825, 685, 326, 601, 291, -37, -94, 169, -528, -294, -675, -677, -917, -1203, -1036, -1067, -976, -781, -606, -438, -716, -172, -352, -16, -539, -42, 34, -310, -26, -359, -229, -250, -442, -5, -73, 84, 28, -250, 164, 146, 341, 23, 568, 542, 695, 758, 667, 867, 458, 700, 631, 419, 481, 427, 567, 247, 524, 487, 515, 471, 485, 403, 484, 635, 179, 232, 476, -206, -323, -333, -659, -606, -680, -1266, -1185, -1042, -1367, -1448, -1144, -1198, -946, -1016, -940, -495, -1000, -297, -615, -714, -302, -182, -597, -237, -159, -323, -669, -318, -442, -226, -433, -310, -97, -412, -146, 13, 169, 287, 318, 179, 558, 281, 940, 256, 503, 529, 510, 420, 494, 396, 782, 312, 362, 409, 518, 554, 705, 479, 284, 255, 287, 140, 49, -106, -646, -346, -826, -666, -942, -627, -1094, -654, -687, -802, -916, -623, -805, -339, -456, -386, -52, -562, -52, -23, -231, 8, -127, 122, -115, -58, -166, -276, -102, -211, 88, -131, -156, -47, 266, 343, 312, 227, 164, 279, 791, 407, 490, 433, 351, 571, 174, 763, 547, 518, 656, 524, 474, 519, 643, 364, 482, 180, 338, 154, 75, -57, -138, -198, -430, -128, -524, -222, -481, -381, -122, -529, -307, -502, -339, -224, -221, -83, -459, 11, -253, -326, -188, -381, -24, -110, -562, 239, -140, -281, -19, -71, 101, 156, 391, -141, 502, -15, 609, 208, 169, 627, 570, 479, 503, 419, 609, 411, 218, 414, 274, 291, 304, 49, 71, -88, 179, -219, -10, -170, -130, -73, -557, 89, -313, 213, -234, -148, -86, 140, -354, 32, -24, 268, 218, -89, -13, -97, 219, -201, -193, 55, -240, -31, -711, -84, -227, -271, -385, -476, -317, -55, -195, -193, 175, -190, 2, 28, 205, 146, 144, 443, -32, 422, 468, 396, 292, 334, 347, 602, 494, 106, 367, 331, 489, 274, 151, -28, 252, -89, 52, -508, -286, -128, -430, -344, -343, -545, -586, 192, -315, 24, -250, -286, -81, -2, 427, -279, 343, 54, 485, 362, 76, 172, -153, 373, -539, 531, -674, -71, 269, -638, -245, -459, -271, -214, -73, -101, -438, 29, -19, 154, 331, 65, 523, 256, 372, 497, 343, 453, 174, 385, 198, -21, 57, 156, 157, -42, -174, -49, -49, -534, 80, 357, 60, -323, 120, -192, 63, -265, -65, 75, 49, -274, -99, 62, -219, 365, -60, -333, -5, -84, 356, -146, 13, 58, 162, 101, -89, 28, 117, -430, 83, -99, -224, -244, 107, -60, 123, -143, -268, 237, 115, 200, 380, 131, 255, 278, 383, 148, 263, 286, 260, 110, 208, -227, 263, 180, -54, -286, -41, 47, -15, 42, -234, 250, 6, -73, 289, 271, 196, 281, -240, 344, -390, -214, 21, -237, -71, -416, 41, -416, -91, -31, -708, -99, -370, -112, 23, 334, -151, -110, -294, 16, -91, -143, -28, -346, 205, -18, -58, -144, 269, -83, -347, 299, 131, -16, 206, 125, 157, 144, 393, -19, 218, 187, 318, 52, -68, 26, 26, 273, 8, 120, -245, -89, 65, -268, 266, -135, 167, -86, -83, 224, 166, 433, -273, 157, -54, 180, -245, -192, -508, -420, -244, -71, -307, -427, -323, -36, -41, -172, -94, 78, -143, 80, 58, 135, -153, 330, -164, -21, 55, 291, -175, -231, 565, -99, 302, 29, 68, 60, 201, 76, -356, -127, 75, -36, -341, -141, -443, -144, 356, -172, 375, -364, 153, 266, 401, 347, -135, 63, 502, 407, -109, -110, 104, 252, 125, 0, -148, 308, -255, -198, 151, 357, 352, 78, -263, -222, -138, -2, -209, -185, -388, 58, -75, -193, 188, 292, -545, 242, -187, -174, -170, 360, 489, 291, 573, -49, -71, 459, 474, -206, -39, -208, -101, -157, -101, 75, 258, 494, -185, -146, 135, -580, -60, -115, -58, -638, -170, -817, -203, 250, 294, -34, 193, 164, 601, 635, 430, 622, 76, 88, 161, -75, 800, 198, 185, -195, 78, 131, -317, -787, -596, 214, -519, -471, -565, -242, -815, 312, 406, -287, -154, -222, -104, 141, 187, -70, -365, -227, -99, 482, -117, 541, 0, 666, -200, -102, 146, 263, 430, 128, 57, 162, 240, -644, -97, 375, -183, -10, -140, 680, 696, 487, -560, -135, 685, 536, 455, -424, 200, 393, 550, -276, 370, 365, -24, -42, 78, -175, -438, -60, -310, -558, -265, -648, -398, -593, -235, -412, -286, -1313, -555, -341, -438, -367, 130, 292, -942, -607, -76, 44, 346, -570, -705, -192, 239, -174, -820, -599, 516, 248, -321, -516, -394, 536, -49, -542, -778, -127, 339, 352, 532, 1041, 1151, 891, 701, 1117, 1045, 177, -336, 313, 28, -76, -248, -388, 214, 515, -367, 498, 269, 28, 438, -133, 193, -321, -1149, -299, -839, -727, -752, -830, 67, 83, 37, 162, -377, -67, -370, -981, -541, 45, -565, -1253, -685, -532, -422, 349, 299, -133, 232, 1154, 1674, 953, 315, 503, 1218, 325, -1278, -299, 623, -68, 701, -258, -651, 872, 581, 193, 456, -386, 343, -174, -1365, -295, -545, -844, 494, -1086, -1166, -547, -1156, -84, -484, -1388, 479, -119, -612, -188, -615, 67, -232, -1213, -1162, -1125, -505, -766, -1547, -865, -778, -745, 534, 450, 1089, 1701, 1690, 3143, 2943, 3550, 3890, 3226, 3565, 2966, 2169, 1880, 1481, 2226, 1341, 627, 606, -169, 433, 323, -1266, -1458, -2084, -3276, -5196, -5666, -7544, -9417, -7062, -5800, -6219, -6885, -8339, -4377, -153, 1226, 3953, 2242, -159, 768, 1448, 2826, 2227, 903, -330, -1856, -2002, -633, 2472, 2942, 1555, 808, 1429, 4344, 6281, 6278, 5252, 4331, 4320, 4695, 5557, 3997, 3146, 3281, 1933, 1505, 1823, 3227, 3896, 3628, 3297, 3448, 6292, 6252, 4692, 3398, 1502, 484, -1907, -3761, -7149, -11430, -15485, -19273, -22761, -28593, -18860, -2357, 459, 938, 1854, 10972, 16630, 14205, 21159, 15336, 1269, -6813, -10818, -5654, -10138, -14643, -12997, -15782, -10622, -3317, 8761, 17718, 12338, 12302, 13946, 13854, 12789, 7380, 4339, -2458, -8701, -9547, -8416, -4250, -3016, -442, 3352, 5560, 11338, 14216, 14299, 12096, 6893, 5386, 2675, -1998, -3146, -3315, -4917, -5463, -3029, -1109, -2427, -5326, -6619, -10539, -13084, -14352, -25250, -18305, 394, 375, 3638, 3821, 5567, 15620, 10148, 13201, 12180, -4583, -10287, -14221, -9987, -8851, -13632, -6890, -6617, -3341, 4276, 10250, 18026, 12752, 7719, 6635, 3002, 1375, -2221, -3532, -6794, -9221, -4791, -372, 5149, 7873, 9029, 12318, 11657, 9903, 10304, 8726, 3989, -2610, -6542, -4359, -3802, -3737, -265, 654, 2450, 3299, 3231, 4834, 2497, -16, -4453, -11990, -17188, -19253, -25727, -32393, -14331, 7278, 9886, 9672, 7992, 15062, 18279, 10899, 14502, 5031, -14724, -22722, -22500, -11773, -8985, -8911, -1604, -1654, 3894, 15146, 21339, 19346, 9872, 5930, -256, -6893, -5729, -6893, -6346, -7156, -7560, -255, 6156, 13406, 15063, 11487, 12669, 9346, 6420, 5718, -196, -3896, -6795, -7708, -2278, 1096, 2196, 3096, 2455, 5485, 7959, 4828, 1305, -1929, -4341, -7456, -10013, -12847, -19411, -21903, -29466, -26797, 3633, 18203, 15110, 12282, 7308, 13808, 10802, 4930, 7956, -10269, -27393, -25838, -16776, -4219, -136, 4737, 9807, 9102, 13036, 17550, 19221, 11589, -3675, -11016, -12828, -13023, -10669, -5869, 94, 2709, 7159, 13659, 17609, 18812, 12010, 4240, 1006, -3245, -3244, -2120, -4247, -3323, -674, 3229, 5763, 4041, 4981, 6716, 3984, 3468, 2815, -1471, -555, -1805, -4523, -3065, -9429, -12179, -13343, -21024, -25300, -29925, -8630, 22836, 19869, 12154, 8023, 8104, 11641, 297, 1351, -2979, -25516, -27658, -18599, -6349, 4240, 8268, 14094, 11607, 8442, 11760, 15188, 11130, -3054, -10714, -14343, -14753, -7844, -2381, 5109, 7291, 7609, 12507, 13291, 13755, 7216, 1117, 1575, -3843, -4919, -2544, -2365, 1898, 3661, 3644, 5318, 5144, 3990, 3195, 3123, 1468, 1005, 1625, -1505, 459, 4065, 528, -2265, -6563, -10917, -14882, -22872, -25143, -26300, -15765, 13119, 23755, 17044, 12148, 8365, 6659, -3018, -8274, -5776, -16825, -23893, -18521, -5693, 10490, 13927, 14445, 15619, 9510, 3006, -688, 1096, -2326, -10718, -13844, -11854, -1047, 6265, 10328, 12933, 7081, 8120, 6776, 354, 1002, -3911, -3930, 625, -3526, 4115, 8153, 3352, 8239, 7416, 6714, 2714, -5041, 459, 2565, -1503, -377, 3032, 6023, 3102, -1763, -508, 1195, -1776, -7096, -10382, -12958, -18190, -21706, -27161, -14545, 19765, 27852, 16364, 11183, 2317, -2437, -7541, -9248, -4393, -14438, -21698, -12317, 2016, 15015, 16115, 15247, 13929, 2299, -9060, -10549, -4054, -1094, -5815, -6084, -1584, 3068, 8244, 11943, 14391, 7836, -1703, -3203, -5825, -5597, -771, 3032, 5995, 3318, 5644, 9378, 6242, 6521, 994, -3370, 740, -3891, -5281, 998, 6505, 8304, 5244, 3799, 4205, 1711, -2425, -2278, -1849, -6911, -13086, -13834, -12354, -16950, -26526, -22347, 13287, 29266, 14789, 10987, 6896, 435, -9490, -13836, -2919, -7664, -18507, -10427, 1846, 11573, 14630, 12640, 12606, 3487, -9422, -12661, -5183, -1320, -4458, -698, 2360, 2716, 3318, 5250, 10484, 7183, 878, -1843, -6938, -4831, 3044, 6946, 5433, 4834, 4843, 4146, 2292, 476, 1218, -29, 31, 1367, 696, 2313, 3344, 5633, 7761, 5786, 2518, -70, -2508, -4914, -2458, -753, -7507, -12563, -12946, -12619, -17539, -27463, -17032, 19656, 27916, 10922, 11039, 4774, -4252, -6573, -11696, -8497, -10240, -17143, -5938, 5367, 10125, 15364, 13818, 12666, 2232, -13433, -11956, -5187, -4258, -3333, 1776, 3883, 2263, 4581, 10326, 11075, 5513, -3005, -5581, -4752, -4291, 3735, 6524, 5747, 7872, 3778, 2328, 1643, 761, 365, -3479, -1513, 5878, 3615, 831, 2795, 5632, 9917, 3646, -1162, 1890, 1151, -2481, -2563, 1830, -2576, -11976, -16494, -18778, -18656, -22096, -22002, 10794, 30882, 16479, 13453, 3862, -6002, -7963, -13956, -8318, -8584, -17666, -9636, 3657, 11672, 17219, 17339, 12312, 1625, -10731, -13420, -10933, -6443, -1448, 2102, 4188, 3719, 4287, 11386, 15107, 1619, -5019, -3800, -8615, -5101, -2081, 6427, 14406, 9045, 6536, 4925, 62, -1328, -828, -2258, -1846, 169, 2769, 6089, 8328, 6672, 7776, 5878, -234, -1843, -1459, 349, 649, -394, -1692, -7873, -11205, -13209, -18339, -23237, -28547, -9782, 23029, 22518, 15731, 11222, -1674, -8166, -10776, -6828, -2469, -16250, -18498, -1463, 7305, 12396, 17365, 17127, 7641, -7089, -12278, -11321, -7838, -3851, -906, 4502, 1794, 4544, 13656, 12604, 6987, 432, -5813, -6555, -8102, -3468, 3661, 5990, 7825, 6703, 6688, 6193, 4810, 979, -4407, -2479, 661, 282, 4719, 8841, 6753, 4135, 3347, 3537, 1841, -2732, -4761, -1800, -166, -4188, -3351, -4268, -10211, -16294, -22606, -26959, -27201, -5497, 27078, 25799, 13216, 7612, -2487, -5670, -9299, -5476, -4636, -19451, -15049, 825, 7593, 16606, 18670, 13914, 5188, -9443, -9682, -4430, -4148, -8893, -4752, 4625, 3201, 10257, 16792, 11847, 4951, -3070, -2755, -1506, -7237, -4031, 630, 4219, 4459, 7643, 10019, 4157, 6370, 5094, -3237, -5304, 81, 1505, 3227, 4534, 2828, 7102, 5646, 4154, 4607, -635, -3641, -5459, -7282, -4591, -3334, -9414, -13244, -14425, -15880, -23097, -31057, -9643, 28648, 22510, 10872, 8377, -974, -1935, -6907, -982, -2364, -23930, -20169, -3214, 9208, 16096, 10734, 10575, 7552, 576, 1359, 5388, -4836, -17757, -9971, 982, 3224, 8886, 10273, 8583, 9265, 6554, 8156, 6549, -6047, -8484, -5192, -1115, 6123, 2644, 3877, 6976, 6451, 10042, 3867, -2187, 1078, -438, 1078, 969, -373, 5156, 5019, 4310, 6492, 2657, -2461, -4318, -4149, -6682, -7883, -9700, -13257, -14641, -16018, -16075, -24479, -21146, 17253, 24385, 7682, 6917, 3097, 10586, 2456, -5924, -670, -19567, -25784, -9231, 3625, 10412, 5390, 7844, 14722, 13024, 8450, 4049, 724, -15037, -16761, -3550, -776, -1211, -403, 6000, 11586, 12828, 12705, 9388, 2407, -4687, -3851, -2682, -2086, -3844, -5380, 1351, 6370, 8724, 9979, 5524, 5680, 6482, 2071, 1057, 620, -183, 438, 1946, 3409, 3682, 2722, 65, 1005, 1787, -4507, -11920, -12703, -14451, -18404, -18968, -18778, -25148, -13755, 19058, 18002, 7623, 8507, 9940, 16524, 3112, -5007, -4359, -20912, -22378, -9125, 2253, 2240, -2508, 9429, 15248, 17174, 14028, 4159, 1041, -8586, -10039, -3123, -5849, -10107, -8898, 4821, 11054, 9536, 12776, 10846, 7394, 5234, 3208, 2367, -4412, -9813, -6594, -1481, 1239, 248, 2756, 8726, 9244, 10925, 5877, 3925, 7146, 2567, 2247, 1818, 284, -1346, -3326, 1693, 881, -3740, -4752, -9774, -10489, -12122, -18153, -18753, -19959, -27727, -10369, 17495, 7852, 1231, 10208, 16745, 22258, 8997, 2682, -3198, -19011, -15487, -7149, -6190, -14799, -11873, 5333, 14602, 15830, 13643, 11141, 4594, 2265, 4834, 890, -5830, -15276, -11127, -315, 1299, 3495, 4580, 8135, 7945, 6075, 11365, 6615, 359, -2591, -1492, -1403, -4485, -5589, -1979, 5836, 4464, 5930, 5558, 6148, 12080, 7987, 6781, 5062, 1154, 1188, 102, 3252, -2594, -10276, -9640, -10227, -10974, -13869, -17906, -21461, -19294, -21977, -9898, 17830, 8091, -1305, 6224, 14188, 24860, 10597, 3506, -1756, -12956, -10802, -6369, -2206, -15429, -17964, -1825, 8302, 11760, 5982, 10834, 9890, 3479, 9166, 7906, 4911, -6781, -10870, 112, -1437, -2469, -2784, 2591, 5300, -617, 5781, 5568, 2310, 4416, 6372, 4669, -2015, -3925, 542, 6308, 4078, 1282, 1136, 1487, 5885, 7237, 8378, 5641, 3601, 3068, 2924, 5945, 896, -5112, -8872, -10753, -12170, -17312, -18800, -20632, -22054, -26518, -16667, 13010, 9674, -2115, 6765, 16981, 26536, 16860, 9562, 5722, -8698, -9200, -3226, -4248, -17576, -24075, -9674, 1510, 3065, 2433, 6532, 9935, 7609, 13721, 17709, 7760, 289, -3003, 1119, 4172, -5000, -8101, -5195, -3677, 542, -318, -1468, -1164, 555, 9971, 8607, 3786, 5537, 4365, 7211, 7880, 3198, 394, 789, 2226, 4557, 1833, -761, 2883, 2875, 3117, 2942, 1041, -1857, -5013, -5045, -9838, -13888, -16438, -19143, -22601, -28356, -12864, 3833, -3450, -5076, 5932, 20284, 20830, 17959, 19693, 7507, -266, 1466, 6203, -735, -21507, -21557, -11742, -5049, -5713, -9907, -2843, 1601, 4224, 13252, 16234, 9828, 6753, 10977, 11045, 6917, 1333, -768, -2756, -5882, -2429, -4708, -8789, -6367, -4041, 3000, 2812, 584, 5052, 7458, 9731, 11302, 7951, 5734, 5924, 6565, 6128, 1268, -2086, -1070, -1821, -1084, -2529, -5544, -6377, -7539, -7825, -8185, -8977, -10945, -16641, -22039, -15976, -198, -1596, -9757, -4942, 7218, 14357, 10446, 13075, 13382, 4474, 5578, 9813, 8984, -1664, -11838, -8955, -3903, -4885, -9729, -10942, -8567, -4622, 992, 4049, 5731, 3886, 7265, 14508, 13477, 10791, 8797, 6356, 4201, 3242, 2294, -4581, -8425, -6237, -4011, -4911, -5093, -2021, -188, 1982, 5234, 7294, 7805, 8104, 9594, 10714, 8774, 5430, 3718, 3200, 2021, -1304, -3287, -5143, -9089, -11039, -11437, -11627, -13274, -15672, -18823, -22341, -12589, -3286, -6666, -7096, -2610, 7854, 11890, 10248, 12464, 9821, 9458, 10729, 11627, 8338, -1768, -4218, -2555, -2416, -5995, -11765, -10398, -8526, -7950, -4865, -2089, -1320, -547, 5435, 10841, 12206, 12198, 11430, 10990, 10531, 11114, 6971, 1205, -1500, -2138, -1282, -4782, -6911, -6328, -4920, -1097, 307, 1455, 3740, 4862, 6963, 8633, 10362, 9492, 5536, 6580, 5979, 2044, -614, -3503, -5573, -9219, -11359, -11810, -15795, -19320, -22055, -17013, -8508, -12119, -13325, -7713, -695, 5008, 4549, 7826, 9675, 8847, 12031, 14476, 12969, 7054, 4442, 4979, 3958, 224, -4880, -7273, -9620, -9383, -6472, -6761, -8867, -9373, -4339, 2036, 4010, 5041, 6935, 9396, 10489, 12409, 13422, 9755, 6130, 5213, 5547, 2307, -839, -1317, -2206, -2878, -2481, -1633, -885, -44, 203, 2166, 3609, 3016, 3825, 4599, 4550, 2274, 718, 1468, -299, -4464, -7672, -7821, -7718, -10828, -14606, -15380, -10857, -9198, -11443, -10890, -7873, -3581, -1464, 269, 2331, 3502, 6008, 8028, 9843, 8813, 7750, 7732, 6281, 5440, 4086, 3500, 485, -3972, -3495, -2739, -3002, -5143, -6766, -4117, -2872, -1888, 623, 2175, 3554, 3169, 3992, 5872, 6271, 5901, 4945, 4481, 4286, 4687, 5331, 3833, 2443, 1946, 2024, 2782, 1628, 795, -86, -427, 1274, 1846, 1664, -187, -823, 237, 174, 779, -1135, -3700, -4278, -4976, -5279, -6989, -8916, -9378, -9096, -8099, -8052, -8349, -7099, -4924, -3437, -1807, -1188, -732, 946, 1578, 3067, 4839, 5015, 4430, 3282, 4795, 5351, 4331, 2532, 753, 718, 151, 588, -455, -1893, -1339, -1317, 584, 1459, 1536, 2534, 2149, 3058, 3318, 2377, 2680, 2117, 1664, 1073, 792, 2016, 2154, 1670, 1945, 2279, 3198, 3231, 2237, 1971, 2558, 2291, 1463, 1276, 1096, 799, 920, 886, 550, -182, -294, -359, -1313, -1841, -3130, -3701, -4726, -5859, -5492, -5937, -6628, -7586, -7177, -5568, -6128, -6091, -4654, -3123, -2870, -2820, -1073, 201, 1385, 1476, 1714, 2333, 2352, 3057, 2828, 2471, 2088, 1445, 1482, 1664, 1752, 1594, 1911, 2042, 2164, 2774, 2964, 3162, 2334, 2089, 2263, 2078, 1981, 1369, 1432, 1351, 1032, 1299, 971, 1247, 1628, 1216, 1451, 1042, 916, 1166, 1315, 805, 198, 318, 558, 558, 359, -84, -153, -323, -703, -886, -1200, -1834, -2537, -3299, -3167, -3302, -4442, -4799, -4831, -4362, -4481, -4356, -3847, -3635, -2497, -1906, -1763, -1682, -1156, -99, 317, -109, 10, -13, 677, 1433, 1518, 1761, 1571, 1549, 2177, 2856, 3221, 3010, 2484, 2833, 3336, 3282, 2769, 2653, 1700, 1224, 1032, 851, 573, 563, 727, 588, 627, 685, 875, 807, 497, 924, 1159, 1154, 951, 654, 1067, 852, 683, 604, 205, -167, -433, 409, 211, -744, -1265, -1672, -1378, -1067, -1726, -2599, -2859, -2513, -2635, -2929, -3102, -2718, -3011, -3104, -2513, -1909, -1672, -1881, -1094, -834, -596, 106, 393, 339, -248, 29, 886, 1097, 1094, 899, 1411, 1846, 1856, 2412, 2403, 2373, 2209, 2122, 1844, 1558, 1187, 1196, 841, 846, 904, 982, 1096, 781, 1094, 1060, 1080, 976, 1196, 1351, 1130, 1175, 1120, 852, 808, 583, 641, 370, 281, -330, -317, -440, -610, -854, -984, -972, -1506, -1735, -1532, -1234, -1125, -1286, -1831, -1568, -1729, -1617, -1963, -1899, -1786, -1641, -1417, -1235, -1015, -1177, -653, -800, -677, -776, -812, -586, -393, -503, -161, 128, 539, 711, 930, 1157, 1000, 1346, 1034, 1041, 912, 958, 519, 808, 589, 459, 672, 761, 547, 695, 1028, 1364, 1089, 1094, 1326, 1487, 1305, 1602, 1490, 1248, 1058, 972, 1000, 487, 425, 344, -70, -224, -481, -666, -555, -769, -747, -610, -805, -666, -870, -833, -752, -685, -995, -872, -1144, -758, -849, -849, -847, -724, -726, -640, -773, -1123, -998, -1362, -1117, -1291, -1093, -1091, -989, -593, -758, -278, -15, -325, -159, -222, -15, 141, -76, 80, 144, 360, 81, 464, 388, 532, 424, 526, 748, 823, 685, 768, 836, 1078, 1185, 916, 812, 1157, 1211, 1003, 969, 896, 695, 588, 685, 81, -91, -581, -179, -825, -784, -1021, -653, -854, -627, -622, -484, -453, -497, -78, 88, -99, 271, 218, -37, 205, 23, 172, -594, -131, -180, -446, -101, -531, -67, -550, -297, 112, -357, -205, -680, -234, -307, -141, -300, -584, -190, -666, -672, -880, -578, -627, -674, -539, -812, -425, 320, 258, 18, 737, 575, 666, 906, 1247, 893, 390, 864, 1133, 872, 617, 1308, 656, 919, 519, 503, 891, 352, 93, -644, -641, -1089, -1062, -877, -1114, -890, -341, -670, 71, -50, 388, -96, 93, 164, 188, -229, -432, -49, -289, -419, 265, -297, -91, -157, -299, -356, -278, -542, -463, -547, -390, 55, -894, -97, -265, -104, -91, -308, 28, -86, 50, -88, -102, 365, 308, 506, 886, 651, 724, 826, 1083, 880, 851, 1049, 700, 420, 201, 411, -104, 739, 443, 50, 265, 687, 502, 41, 315, -195, -375, -628, -688, -256, 54, -599, -370, -16, 429, -510, -586, 110, -821, -313, -622, -367, 737, 1657, 1041, 976, 519, 1161, 695, -256, -67, -18, -347, -443, 172, -412, -573, -406, 81, -362, -141, 93, -271, -2, -412, -433, -26, 388, 281, -328, 433, 330, 247, -226, 292, -63, -276, 96, -534, -450, -1222, -172, -580, -731, 21, 213, -83, 359, 1127, 1044, 144, -91, 320, -237, -115, -610, -450, -485, -326, -312, 274, 13, 179, 487, -242, 907, 409, 604, 323, 687, 575, 1211, 481, 365, -128, 112, -273, -763, -808, -1234, -1666, -1422, -1724, -2292, -1802, -2338, -2271, -2396, -1708, -2216, -2419, -1664, -1763, -1198, -1031, -891, -1153, -247, 0, 339, 271, 422, 753, 1286, 1495, 1149, 1026, 1563, 1953, 1679, 1740, 2438, 2365, 2156, 2409, 3071, 2333, 2339, 2107, 1567, 2010, 883, 1388, 515, 1506, -180, 800, -106, -214, -2034, -1909, -2799, -3115, -4929, -4614, -4914, -5222, -5117, -4646, -3971, -3930, -3615, -2904, -1907, -1008, -1157, -261, -362, 518, 886, 1291, 1614, 1440, 1295, 466, 1373, 1729, 1591, 1356, 398, 916, 1320, 1580, 1797, 1206, 1817, 1318, 2159, 2187, 2843, 2133, 1750, 2367, 2610, 2554, 2313, 1859, 2153, 2571, 2721, 2726, 2305, 2435, 1956, 2748, 1925, 1627, 1284, 1011, 403, 1461, 878, 357, -541, -1773, -2235, -2898, -3131, -4617, -6226, -7102, -7573, -7188, -5977, -5654, -5588, -6479, -4151, -2201, -196, 341, -453, 756, 1102, 2122, 3325, 3435, 2367, 1023, 1437, 2102, 2089, 1656, -310, -37, -291, 359, 698, 1219, 356, -455, 709, 2182, 2203, 2333, 1961, 2407, 2398, 2458, 3455, 3287, 1825, 1890, 1906, 2524, 2890, 1920, 2011, 2041, 2244, 2403, 2341, 1797, 1494, 1216, 1339, 1682, 1469, 766, 1156, 1097, 247, 106, -2021, -3086, -4778, -6141, -8162, -10388, -11485, -9786, -8383, -9224, -9438, -6995, -3648, -1547, 953, 2403, 3828, 4177, 4347, 7138, 7638, 6088, 3515, 1946, 2468, 1289, -206, -1076, -2253, -3354, -3940, -2336, -1583, -1750, -1076, -393, 2253, 2893, 3093, 4404, 3708, 3933, 4990, 5119, 4437, 3602, 2588, 2510, 2166, 3732, 3287, 2313, 2172, 2758, 4034, 4143, 4010, 2745, 2226, 2792, 2531, 2719, 1734, -760, -1378, -2554, -3159, -5865, -8183, -11276, -15106, -18141, -17766, -10341, -5917, -8045, -8670, -4096, 5192, 8719, 9000, 9971, 7542, 5666, 6357, 7226, 5528, -1625, -6680, -6390, -4752, -4578, -6185, -5617, -5383, -4032, 154, 4971, 6938, 5804, 4885, 7581, 9375, 8445, 5709, 2593, 893, -1084, -1690, -1291, -2586, -4388, -3375, -877, 1755, 2573, 4974, 7872, 8018, 7576, 7739, 9122, 7823, 5534, 4164, 3125, 1256, -10, -34, -510, -2054, -2432, -2606, -3201, -4670, -7172, -8685, -11562, -15870, -17856, -19143, -14901, -3925, -2110, -3739, -2935, 3729, 15237, 14930, 12372, 9961, 4705, 4247, 1841, 2175, -1891, -12706, -14674, -11784, -5695, -3692, -6669, -3320, -213, 4026, 9420, 11883, 12167, 7784, 5049, 7565, 6508, 2589, -2357, -5187, -5641, -6172, -5961, -3731, -3169, -3360, -857, 3688, 8873, 9281, 6813, 7990, 8739, 8216, 6797, 3841, 2615, -96, -631, 149, -917, -1830, -1705, 528, 2442, 2529, 2381, 846, -2192, -3622, -4878, -7541, -12838, -17904, -21107, -22651, -13529, 399, 1427, -2119, -2378, 7578, 21015, 18687, 12386, 7144, 1269, 321, -1943, -2688, -7963, -18526, -18683, -11620, -3503, -948, -2580, 1430, 7169, 13133, 16500, 14235, 10662, 5701, 2692, 2505, 138, -4742, -11130, -12005, -8237, -4695, -2705, -1640, 138, 3091, 6692, 10795, 11802, 9869, 6518, 4601, 4411, 3162, 677, -1500, -3924, -4106, -1523, 286, 1385, 953, 1773, 4063, 5284, 5773, 3377, 1021, -446, -2383, -3813, -7516, -11141, -14052, -18614, -20922, -20146, -14114, -1352, 7037, 5607, 4216, 8875, 17612, 21386, 14276, 4433, -1883, -5279, -6055, -8227, -11107, -14932, -16903, -11571, -2448, 4414, 5438, 5414, 9732, 14281, 15977, 12893, 6964, 2127, -2179, -4951, -6896, -8849, -10539, -11282, -9519, -3649, 1833, 4552, 6976, 8192, 9687, 11916, 10844, 8291, 3838, -1133, -2198, -2396, -4174, -5622, -5742, -3622, 88, 4032, 6763, 6680, 5774, 6987, 8068, 7354, 4696, 583, -2182, -4698, -6443, -6911, -8544, -9930, -12200, -15672, -18257, -17669, -11271, 635, 9914, 8560, 4523, 6573, 13330, 18106, 12623, 2894, -4828, -9024, -8466, -9026, -9995, -12263, -14627, -9632, -407, 7906, 10440, 7899, 8492, 11274, 13284, 10929, 4362, -1867, -6695, -8406, -8093, -7705, -7662, -7630, -5786, -393, 5732, 8890, 10343, 9133, 7794, 7831, 5627, 3287, -474, -5507, -7776, -8067, -5904, -3510, -1531, 373, 3339, 9570, 13943, 13140, 9153, 5338, 5399, 5370, 3136, -669, -6706, -8906, -7933, -6274, -4565, -6190, -9317, -11443, -12701, -11354, -8797, -5377, 494, 4588, 4635, 5214, 7021, 9643, 10859, 6623, 782, -3531, -6336, -6878, -6977, -7193, -7599, -7628, -4680, 534, 5110, 6979, 6281, 6515, 7757, 7838, 5302, 1773, -1792, -4372, -5089, -5752, -5143, -4179, -3821, -1224, 1633, 4537, 7490, 6856, 5575, 4706, 3023, 2289, 211, -2784, -3609, -3946, -4101, -3615, -2026, 1515, 4378, 7192, 10846, 12005, 10120, 7302, 5768, 5323, 2740, -1109, -4693, -5669, -3929, -4917, -6388, -7932, -9687, -9826, -10825, -11808, -11252, -9195, -3776, 3045, 5766, 5153, 6354, 8231, 10716, 9594, 2763, -1821, -5453, -7994, -7765, -8162, -7852, -7125, -5883, -1080, 5162, 8899, 8807, 6823, 6140, 6911, 5958, 1810, -2706, -5757, -6836, -6984, -6737, -4742, -1805, 659, 2606, 5412, 8529, 9330, 7419, 4313, 1804, 133, -1734, -3942, -6433, -7081, -6019, -3815, 123, 3131, 5365, 7284, 7894, 9500, 10698, 10755, 9856, 3942, -1081, -1013, -456, -1044, -4018, -7321, -6073, -2958, -1120, 484, -1510, -4563, -6089, -7968, -7468, -8130, -9670, -7849, -3506, 1727, 2843, 3279, 5042, 6632, 8271, 4903, 1026, -1357, -4453, -5133, -6588, -8672, -7943, -7388, -5687, -1430, 2003, 5308, 7498, 7193, 7888, 8542, 6854, 4068, -231, -3731, -5149, -5870, -6114, -5464, -3972, -2326, 365, 2867, 4651, 6101, 5696, 4984, 3911, 1349, -865, -2878, -4156, -4321, -3560, -2031, -372, 1394, 3427, 5659, 7276, 8203, 8412, 7968, 5734, 2951, 1063, 78, 341, 71, -877, -1581, -1182, -107, 119, -719, -3804, -7529, -10127, -12308, -12630, -12021, -9588, -2857, 2943, 4153, 4901, 5578, 8781, 12524, 8873, 3232, -2854, -7034, -6495, -7771, -9047, -8795, -7998, -4729, -601, 3510, 7313, 9722, 10036, 9000, 8268, 6726, 4125, 1073, -3047, -6737, -8362, -8849, -7166, -4409, -2440, 346, 2614, 3865, 6263, 7250, 5782, 4458, 1640, -545, -1721, -4862, -7028, -6826, -4984, -1768, 1226, 2818, 4146, 6164, 6904, 6468, 5680, 3823, 2628, 769, -2050, -3700, -4260, -3541, -1120, 1709, 2500, 3018, 4643, 6765, 9070, 8247, 4135, 617, -433, -294, -1274, -4398, -9032, -11463, -12614, -14213, -14562, -13677, -8870, 451, 7274, 7834, 7437, 7492, 11144, 15247, 10101, 1760, -6284, -10369, -8015, -8089, -9047, -8804, -8490, -3885, 2344, 6920, 10563, 10617, 8347, 6477, 3878, 1571, -2188, -6883, -10640, -12633, -10898, -7929, -3804, -200, 2281, 5584, 7843, 9929, 11989, 10739, 6958, 2771, -1907, -4206, -5175, -6636, -6468, -6344, -5695, -2998, 325, 3675, 6706, 7901, 7446, 7404, 6016, 4021, 1625, -2351, -4494, -5695, -6258, -5222, -4925, -3768, -1250, 883, 3657, 5490, 6115, 6481, 6308, 5847, 4221, 2378, -263, -1562, -545, -594, -146, 13, -3, 1268, 2050, 2909, 3131, 2515, 2261, 2089, 1157, -607, -3229, -7219, -10698, -13054, -14234, -14209, -11021, -3641, 1276, 4141, 5542, 6031, 11906, 14093, 10224, 4929, -3630, -7013, -6875, -8932, -9766, -10539, -9304, -4654, -308, 3541, 7406, 9581, 9446, 7828, 5438, 2685, 893, -1864, -5826, -7227, -7935, -6821, -3661, -1594, 836, 2938, 4958, 6739, 7545, 7067, 4932, 2411, -716, -3203, -5232, -6495, -6132, -5039, -3138, -1252, 765, 2948, 5433, 7276, 7683, 6987, 5034, 2976, 401, -1890, -3940, -5818, -5823, -5719, -5007, -2909, -718, 1883, 4019, 4950, 5734, 5769, 4588, 3594, 1791, -675, -2550, -4495, -5495, -5119, -3919, -2416, -990, 545, 1982, 3568, 4334, 4321, 4021, 2682, 1594, 269, -1393, -2269, -3166, -3307, -3013, -2448, -1062, 122, 1511, 2773, 3477, 3920, 3581, 2950, 2437, 1196, -294, -833, -1617, -2547, -2640, -2552, -1364, 234, 932, 1466, 1666, 2021, 2450, 2125, 1312, -102, -1610, -2669, -3429, -3911, -3670, -2463, -1239, -369, 347, 818, 1554, 2477, 2898, 2808, 2153, 1047, 386, -112, -489, -823, -1682, -2122, -2214, -1860, -794, -5, 549, 1162, 1146, 1573, 4159, 6411, 6041, 3589, 521, 3, 1735, 2607, 839, -2455, -4373, -3399, -843, -448, -2917, -6412, -9104, -9239, -8141, -7490, -5713, -1972, 1547, 4170, 5333, 5179, 6974, 7792, 5714, 2161, -3221, -6062, -6318, -6729, -6466, -6727, -6019, -3226, -271, 2818, 5571, 7007, 7398, 6356, 3964, 2133, 831, -716, -2619, -5086, -6581, -5708, -3466, -1203, 338, 1219, 2565, 4482, 5765, 5883, 4690, 2745, 831, -1054, -2654, -3601, -3830, -3619, -3195, -2578, -1343, 916, 3226, 4705, 4920, 4093, 3391, 2953, 2265, 938, -1042, -2981, -4036, -4080, -3464, -2445, -1468, -567, 528, 1760, 2953, 3831, 4062, 3532, 2453, 1148, -60, -998, -1703, -2284, -2724, -2797, -2346, -1344, -3, 1218, 2045, 2489, 2680, 2745, 2588, 2084, 1198, 36, -997, -1769, -2265, -2328, -2071, -1630, -1049, -390, 336, 1159, 1914, 2271, 2192, 1758, 1109, 420, -269, -981, -1688, -2245, -2484, -2375, -1966, -1354, -753, -143, 547, 1180, 1761, 2140, 2136, 1854, 1356, 711, 47, -638, -1263, -1709, -1989, -1992, -1722, -1253, -612, 6, 589, 1107, 1456, 1700, 1682, 1341, 828, 198, -347, -685, -925, -1078, -1149, -1128, -870, -451, 37, 537, 865, 1002, 1049, 1049, 948, 807, 481, -24, -367, -690, -391, 933, 1875, 2320, 2469, 1997, 2273, 3167, 3304, 2331, 450, -942, -781, -203, -334, -826, -1466, -1489, -830, -940, -1987, -4036, -6482, -7797, -8154, -7820, -5484, -1344, 1536, 3317, 3945, 3701, 6089, 7273, 5633, 2521, -2756, -5170, -5328, -5662, -5299, -5760, -5312, -2940, -247, 2498, 4857, 6154, 6528, 5774, 3731, 1851, 511, -953, -2636, -4687, -6135, -5552, -3461, -1240, 534, 1516, 2552, 4224, 5406, 5640, 4609, 2521, 458, -1346, -2836, -3701, -3998, -3849, -3253, -2453, -1162, 813, 2797, 4242, 4635, 4067, 3424, 2812, 1937, 651, -1206, -3023, -4003, -4117, -3508, -2515, -1549, -479, 791, 2119, 3357, 4167, 4256, 3737, 2721, 1378, 37, -1144, -2037, -2606, -2930, -2914, -2365, -1331, 41, 1383, 2284, 2784, 2924, 2813, 2531, 1859, 799, -354, -1318, -1932, -2161, -2097, -1750, -1144, -302, 623, 1386, 1917, 2149, 2102, 1768, 1063, 125, -831, -1580, -2023, -2253, -2261, -2019, -1461, -612, 261, 990, 1537, 1888, 2114, 2125, 1805, 1209, 420, -390, -1049, -1471, -1679, -1700, -1550, -1213, -667, -93, 453, 925, 1219, 1372, 1315, 1078, 683, 153, -354, -776, -1058, -1177, -1190, -1058, -774, -367, 80, 519, 1018, 1357, 1654, 1857, 1731, 1528, 1080, 945, 1222, 1179, 1114, 907, 688, 804, 1057, 1205, 1114, 925, 649, 544, 464, 167, -367, -1430, -2708, -4010, -5438, -6739, -7614, -7675, -6580, -3883, -521, 1859, 3477, 4143, 4688, 5687, 5073, 3091, -94, -3648, -5396, -6073, -5732, -4880, -4274, -2982, -1218, 1042, 3688, 5695, 6586, 6016, 4172, 2125, 657, -450, -1766, -3513, -5120, -5427, -4028, -1778, 352, 1744, 2567, 3513, 4351, 4680, 4227, 2782, 826, -1170, -2782, -3688, -3756, -3308, -2709, -1922, -1039, 391, 2245, 3732, 4545, 4248, 3221, 2218, 1331, 412, -703, -2140, -3396, -3719, -3190, -1963, -599, 320, 1143, 1823, 2414, 3044, 3226, 2692, 1524, 104, -1076, -1782, -2015, -1994, -1935, -1735, -1229, -359, 786, 1750, 2278, 2485, 2242, 1765, 1287, 518, -219, -810, -1344, -1508, -1500, -1295, -804, -101, 523, 774, 1138, 1347, 1247, 1218, 779, 127, -312, -597, -669, -692, -700, -596, -430, -226, -211, -252, -136, -235, -346, -370, -420, -351, -231, 96, 412, 640, 904, 925, 920, 878, 461, 2, -390, -942, -1276, -1375, -1502, -1292, -880, -524, 49, 563, 976, 1495, 1578, 1292, 971, 558, 279, -76, -484, -724, -1146, -1284, -886, -524, -47, 482, 693, 857, 1148, 1383, 1823, 2594, 2755, 2380, 2086, 1890, 2256, 2484, 2065, 1300, 427, 294, 459, 373, 47, -534, -838, -852, -942, -1325, -2334, -4330, -6972, -9211, -10703, -10953, -6854, -534, 2422, 3628, 2646, 2248, 6878, 9386, 7748, 2818, -4370, -6987, -6037, -5094, -5037, -6523, -7224, -5016, -1021, 2398, 5164, 6317, 6047, 5640, 3997, 2631, 1869, 114, -1888, -4317, -6255, -5425, -3200, -1234, 281, 640, 1524, 3635, 5365, 6218, 5321, 3078, 1086, -500, -1828, -2531, -3141, -3609, -3083, -2459, -1328, 794, 2398, 3599, 4127, 3502, 3099, 3015, 2461, 1412, -373, -2464, -3518, -3440, -2881, -2156, -1748, -1227, -88, 1360, 2705, 3315, 3268, 2800, 1976, 1083, 237, -576, -1313, -1786, -2224, -2445, -2005, -1058, 39, 818, 1227, 1615, 2133, 2380, 2260, 1846, 1018, 263, -344, -860, -1205, -1503, -1519, -1352, -1078, -571, 36, 529, 807, 997, 1071, 1010, 844, 479, -50, -558, -753, -823, -953, -943, -930, -773, -433, -183, 52, 297, 536, 636, 698, 825, 885, 946, 893, 594, 308, 135, -117, -346, -568, -786, -731, -539, -378, -279, -141, 830, 2313, 2890, 2740, 2403, 2544, 3409, 3575, 2568, 1172, 307, 248, 606, 602, -179, -666, -437, 107, 597, 557, -172, -1172, -2112, -3198, -4648, -6570, -8734, -10422, -11292, -10799, -6578, -432, 3442, 5010, 4471, 5007, 8344, 9958, 7437, 1409, -4377, -6554, -5752, -5440, -7115, -8112, -7263, -3568, 1081, 3791, 5599, 6601, 7011, 6706, 5063, 2956, 1023, -859, -3057, -5245, -6487, -5664, -3599, -1888, -836, 114, 2099, 4516, 5940, 5536, 3995, 2532, 1742, 1000, -708, -2445, -3455, -3021, -1299, -455, -157, 753, 2292, 4308, 5552, 4830, 3619, 3286, 2888, 2037, 247, -1825, -2523, -2174, -1930, -2101, -2106, -1312, 344, 1644, 1849, 1599, 1907, 2396, 2466, 1674, 234, -963, -1724, -2159, -2945, -2903, -1989, -1847, -1057, -159, 1383, 3716, 4575, 4182, 2860, 1968, 1286, 1263, 1006, -281, -565, -1041, -937, -91, 24, 302, 789, 817, 609, 601, 36, -927, -1737, -3221, -3933, -4253, -5065, -6373, -8744, -11209, -13050, -12740, -10045, -3537, 2893, 4989, 4862, 3560, 5003, 7974, 7661, 3115, -3193, -6346, -6279, -4596, -4526, -6089, -5573, -3347, 602, 3589, 4411, 4891, 5029, 4989, 3787, 1942, 305, -532, -872, -1919, -2753, -2536, -1024, 633, 1265, 1256, 1375, 2201, 2782, 2758, 2159, 1229, 1149, 1255, 979, 393, -2, 281, 846, 1226, 956, 821, 1054, 1279, 1794, 1705, 1364, 1232, 1081, 1219, 1346, 1351, 1050, 545, 315, 450, 737, 893, 1034, 932, 1109, 1341, 1403, 1771, 1625, 1068, 781, 791, 748, 909, 820, 96, -47, -240, -438, -641, -821, -808, -641, -317, -278, -219, 122, 878, 1495, 1714, 1711, 1281, 1209, 1119, 690, 269, -494, -1406, -1987, -2396, -2383, -2136, -1966, -1747, -1266, -1119, -1231, -1256, -1344, -1144, -804, -1240, -2047, -2404, -2497, -2635, -2907, -3138, -2959, -2622, -2602, -3412, -4245, -3992, -2857, -1675, -1594, -2279, -2258, -1211, 563, 1398, 1015, 343, 175, 922, 1649, 2058, 1748, 1580, 2123, 2828, 3644, 3859, 3625, 3325, 3255, 3510, 3774, 3860, 3562, 3164, 2930, 2696, 2159, 1672, 1080, 86, -571, -1006, -1591, -2321, -3099, -4214, -5584, -6773, -8143, -9297, -10143, -10318, -9039, -6420, -3050, -266, 1261, 1976, 2565, 3703, 3542, 1604, -1094, -2940, -2568, -1362, -593, -817, -430, 1276, 3344, 5003, 4692, 3711, 3157, 2951, 3070, 2849, 2360, 1893, 2026, 3018, 4162, 5130, 4992, 4068, 3209, 2857, 2683, 2315, 1321, 240, -151, 346, 1292, 1815, 1763, 1148, 1271, 2182, 2789, 2529, 1028, 169, 542, 1162, 1305, 492, -552, -570, -8, -10, -575, -1000, -1347, -1117, -971, -1313, -1354, -1193, -786, 86, 442, 258, 24, -232, 26, 550, 576, -351, -1461, -1628, -1133, -664, -825, -1438, -1609, -950, 3, 406, 370, 672, 799, 927, 726, 432, 425, 211, -250, -851, -1310, -1412, -1195, -1201, -1500, -1347, -935, -235, 131, -573, -1982, -3055, -3143, -2795, -2679, -3367, -4180, -4138, -3110, -1458, -321, -213, -805, -633, -26, 633, 856, 96, -690, -703, -235, 42, 47, -39, -36, 422, 1102, 1705, 2122, 1968, 1610, 1515, 1946, 2596, 2739, 2144, 1268, 1049, 1396, 1977, 1851, 830, 58, 67, 685, 1252, 833, -282, -1420, -1979, -1698, -1245, -1253, -1774, -2489, -2752, -2390, -1894, -1872, -2399, -2631, -2466, -2157, -1795, -1964, -2323, -2599, -2188, -1755, -1724, -1643, -1351, -515, 494, 1135, 894, 545, 924, 1326, 1597, 1291, 1114, 1310, 1852, 2622, 2794, 2859, 2557, 2193, 2185, 2167, 2177, 1972, 1539, 1558, 2414, 3331, 3670, 3583, 3078, 2643, 2680, 2432, 1479, 0, -893, -1255, -1248, -1440, -2164, -2321, -1747, -834, -602, -1276, -2393, -3343, -3773, -4143, -4231, -4291, -4174, -3753, -3610, -3318, -2662, -1729, -1195, -1146, -1018, -911, -425, 485, 890, 955, 802, 459, 357, 562, 1192, 1539, 1545, 1615, 2331, 3500, 3635, 2992, 2987, 3542, 4182, 3940, 2976, 2411, 2545, 3287, 3476, 2851, 2354, 2013, 2008, 2106, 1823, 1435, 690, 49, -149, 23, 71, -565, -1497, -2349, -2260, -2086, -2427, -2778, -3318, -3286, -2925, -2339, -2412, -3026, -3146, -3157, -2781, -2196, -1713, -1711, -1656, -1328, -510, 359, 269, 265, 203, 518, 1123, 1344, 1093, 670, 724, 1167, 1508, 1455, 1060, 1003, 1380, 2179, 2636, 2422, 2096, 2065, 2606, 3109, 2922, 2029, 1154, 963, 1174, 1404, 1226, 485, -385, -693, -476, -484, -1153, -2125, -2602, -2076, -1506, -1373, -1586, -2102, -2370, -2375, -2193, -1946, -2265, -2862, -2821, -2042, -1477, -1310, -1994, -2359, -1825, -893, -531, -937, -1034, -695, 271, 1039, 1076, 734, 614, 945, 1339, 1594, 1466, 1346, 1394, 1497, 1589, 1519, 1417, 1299, 1367, 1607, 1528, 1269, 797, 662, 953, 1156, 890, 349, 167, 435, 593, 477, 83, -104, -346, -396, -258, -206, -452, -692, -656, -596, -508, -409, -431, -418, -308, -194, -78};
+constexpr AdpcmEncoder::Encoded<example_synthesizer_length> example_synthesizer_data = AdpcmEncoder::Encode(example_synthesizer_pcm);
 
 static constexpr SamplePlayer16bit::Sample example_synthesizer = {
-    .data = example_synthesizer_data,
-    .length = example_synthesizer_length,
+    .data = example_synthesizer_data.data(),
+    .length = AdpcmEncoder::PaddedLength(example_synthesizer_length),
+    .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM,
 };
 
 }
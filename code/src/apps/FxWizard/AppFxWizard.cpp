@@ -24,9 +24,14 @@ SOFTWARE.
 */
 
 #include "AppFxWizard.hpp"
+#include <algorithm>
+#include <cmath>
+#include "common/core/Divider.hpp"
 #include "common/core/Kastle2.hpp"
 #include "common/core/MultiCore.hpp"
 #include "common/core/UserDataFile.hpp"
+#include "common/coredata.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/utils.hpp"
 #include "FxWizardParameterMaps.hpp"
 
@@ -38,10 +43,20 @@ SOFTWARE.
 
 using namespace kastle2;
 
-void AppFxWizard::Init()
+// Filters and clipper run by the second core, in its own SRAM bank
+CORE1_DATA SoftClipper AppFxWizard::feedback_clip_;
+CORE1_DATA AppFxWizard::FeedbackFilter AppFxWizard::feedback_filter_left_;
+CORE1_DATA AppFxWizard::FeedbackFilter AppFxWizard::feedback_filter_right_;
+CORE1_DATA DjFilter AppFxWizard::dj_filter_left_;
+CORE1_DATA DjFilter AppFxWizard::dj_filter_right_;
+
+COLDCODE void AppFxWizard::Init()
 {
     inited_ = false;
 
+    // Mode parameters of the file replace these when it has them
+    settings_file_.mode_parameters = &kDefaultModeParameters;
+
     // Load custom scales and rhythms (if available)
     if (LoadFile())
     {
@@ -85,38 +100,32 @@ void AppFxWizard::Init()
     mode_sh_trigger_ = false;
     time_sh_trigger_ = false;
 
-    feedback_delay_left_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(2000);  // 44ms
-    feedback_delay_right_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(2000); // 44ms
+    wet_tail_.Init(kDelayLength + kFeedbackDelayLength + kWetTailMargin);
+
+    feedback_delay_left_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(Kastle2::arena.Allocate<q15least_t>(kFeedbackDelayLength));
+    feedback_delay_right_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(Kastle2::arena.Allocate<q15least_t>(kFeedbackDelayLength));
 
     feedback_clip_.SetDrive(Q15_MAX);
 
-    feedback_filter_left_.Init(SAMPLE_RATE);
-    feedback_filter_left_.SetFrequency(kFeedbackFilterLeftFreq);
-    feedback_filter_left_.SetResonance(0.f, Svf::ForceValue::TRUE);
-    feedback_filter_left_.SetType(Svf::Type::HIGHPASS);
-    feedback_filter_left_.SetDrive(1.f);
-    feedback_filter_right_.Init(SAMPLE_RATE);
-    feedback_filter_right_.SetFrequency(kFeedbackFilterRightFreq);
-    feedback_filter_right_.SetResonance(0.f, Svf::ForceValue::TRUE);
-    feedback_filter_right_.SetType(Svf::Type::HIGHPASS);
-    feedback_filter_right_.SetDrive(1.f);
-
-    feedback_filter_lp_left_.Init(SAMPLE_RATE);
-    feedback_filter_lp_left_.SetFrequency(kFeedbackFilterLpLeftFreq);
-    feedback_filter_lp_left_.SetResonance(0.f, Svf::ForceValue::TRUE);
-    feedback_filter_lp_left_.SetType(Svf::Type::LOWPASS);
-    feedback_filter_lp_left_.SetDrive(1.f);
-    feedback_filter_lp_right_.Init(SAMPLE_RATE);
-    feedback_filter_lp_right_.SetFrequency(kFeedbackFilterLpRightFreq);
-    feedback_filter_lp_right_.SetResonance(0.f, Svf::ForceValue::TRUE);
-    feedback_filter_lp_right_.SetType(Svf::Type::LOWPASS);
-    feedback_filter_lp_right_.SetDrive(1.f);
+    // The type of each filter is fixed by the chain
+    auto init_feedback_filter = [](auto &filter, float frequency)
+    {
+        filter.Init(SAMPLE_RATE);
+        filter.SetParams({frequency, 0.f, 1.f, Svf::ForceValue::TRUE});
+    };
+    const FxWizardModeParameters &mode_parameters = *settings_file_.mode_parameters;
+    init_feedback_filter(feedback_filter_left_.Get<0>(), mode_parameters.feedback_lowpass_left);
+    init_feedback_filter(feedback_filter_left_.Get<1>(), mode_parameters.feedback_highpass_left);
+    init_feedback_filter(feedback_filter_right_.Get<0>(), mode_parameters.feedback_lowpass_right);
+    init_feedback_filter(feedback_filter_right_.Get<1>(), mode_parameters.feedback_highpass_right);
 
     delay_clip_.Init(SAMPLE_RATE);
     feedback_volume_ = Q15_ZERO;
     feedback_delay_ = 0;
     global_dry_wet_ = Q15_ZERO;
     global_dry_wet_queue_ = Q15_ZERO;
+    mode_fade_ = Q15_MAX;
+    mode_fade_step_ = 0;
     trigger_blink_counter = 0;
 
     dj_filter_left_.Init(SAMPLE_RATE);
@@ -193,11 +202,17 @@ void AppFxWizard::Init()
     shifter_env_.SetSustainLevel(Q31_ZERO);
     shifter_env_.SetReleaseTime(0.f);
     shifter_env_mod_ = Q15_ZERO;
+    shifter_env_value_ = 1;
     shifter_left_frequency_ = Q31_ZERO;
     shifter_right_frequency_ = Q31_ZERO;
 
-    delay_left_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(50800);
-    delay_right_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(50800);
+    std::span<DelaySample> delay_memory_left = Kastle2::arena.Allocate<DelaySample>(kDelayLength);
+    std::span<DelaySample> delay_memory_right = Kastle2::arena.Allocate<DelaySample>(kDelayLength);
+    delay_left_ = std::make_unique<DelayLine>(delay_memory_left);
+    delay_right_ = std::make_unique<DelayLine>(delay_memory_right);
+    // The pitch shifters use the same memory as 16-bit samples
+    pitch_shifter_left_.Init(std::span{reinterpret_cast<q15least_t *>(delay_memory_left.data()), kDelayMemoryLength});
+    pitch_shifter_right_.Init(std::span{reinterpret_cast<q15least_t *>(delay_memory_right.data()), kDelayMemoryLength});
     delay_compressor_.Init(SAMPLE_RATE / delay_peak_counter_max_);
     delay_compressor_.SetAttackTime(50.f / 1000.f);
     delay_compressor_.SetReleaseTime(100.f / 1000.f);
@@ -221,8 +236,12 @@ void AppFxWizard::Init()
     delay_time_left_prev_ = 0;
     delay_time_right_prev_ = 0;
 
+    pitch_tracker_.Reset();
+    pitch_ = {};
+
     lfo_left_.Init(SAMPLE_RATE);
     lfo_right_.Init(SAMPLE_RATE);
+    panner_lfos_.Init(SAMPLE_RATE);
 
     slicer_env_left_.Init(SAMPLE_RATE);
     slicer_env_left_.SetAttackTime(0.01f);
@@ -243,48 +262,48 @@ void AppFxWizard::Init()
     slicer_flip_bit_ = false;
 
     // Normal layer
-    pots_[Pot::TIME_MOD] = FancyPot::Create(
+    pots_[Pot::TIME_MOD] = FancyPot(
         {.pot = Hardware::Pot::POT_1,
          .layer = Hardware::Layer::NORMAL,
          .initial_value = POT_HALF,
          .midi_cc = cc::TIME_MOD,
          .deadzone = true});
-    pots_[Pot::FEEDBACK_MOD] = FancyPot::Create(
+    pots_[Pot::FEEDBACK_MOD] = FancyPot(
         {.pot = Hardware::Pot::POT_2,
          .layer = Hardware::Layer::NORMAL,
          .initial_value = POT_HALF,
          .midi_cc = cc::FEEDBACK_MOD,
          .deadzone = true});
-    pots_[Pot::AMOUNT] = FancyPot::Create(
+    pots_[Pot::AMOUNT] = FancyPot(
         {.pot = Hardware::Pot::POT_4,
          .layer = Hardware::Layer::NORMAL,
          .initial_value = POT_HALF,
          .midi_cc = cc::AMOUNT});
-    pots_[Pot::TIME] = FancyPot::Create(
+    pots_[Pot::TIME] = FancyPot(
         {.pot = Hardware::Pot::POT_5,
          .layer = Hardware::Layer::NORMAL,
          .initial_value = POT_HALF,
          .midi_cc = cc::TIME,
          .freeze = true});
-    pots_[Pot::FEEDBACK] = FancyPot::Create(
+    pots_[Pot::FEEDBACK] = FancyPot(
         {.pot = Hardware::Pot::POT_6,
          .layer = Hardware::Layer::NORMAL,
          .initial_value = POT_MIN,
          .midi_cc = cc::FEEDBACK});
 
     // Shift layer
-    pots_[Pot::STEREO] = FancyPot::Create(
+    pots_[Pot::STEREO] = FancyPot(
         {.pot = Hardware::Pot::POT_2,
          .layer = Hardware::Layer::SHIFT,
          .initial_value = POT_MIN,
          .midi_cc = cc::STEREO,
          .freeze = true});
-    pots_[Pot::AMOUNT_MOD] = FancyPot::Create(
+    pots_[Pot::AMOUNT_MOD] = FancyPot(
         {.pot = Hardware::Pot::POT_4,
          .layer = Hardware::Layer::SHIFT,
          .initial_value = POT_MAX,
          .midi_cc = cc::AMOUNT_MOD});
-    pots_[Pot::FILTER] = FancyPot::Create(
+    pots_[Pot::FILTER] = FancyPot(
         {.pot = Hardware::Pot::POT_6,
          .layer = Hardware::Layer::SHIFT,
          .initial_value = POT_HALF,
@@ -292,51 +311,63 @@ void AppFxWizard::Init()
          .deadzone = true});
 
     // Mode layer
-    pots_[Pot::MODE_MOD] = FancyPot::Create(
+    pots_[Pot::MODE_MOD] = FancyPot(
         {.pot = Hardware::Pot::POT_4,
          .layer = Hardware::Layer::MODE,
          .initial_value = POT_MAX,
          .midi_cc = cc::MODE_MOD});
 
-    // Init pots
-    for (auto &pot : pots_)
-    {
-        pot->Init(AUDIO_LOOP_RATE);
-    }
+    // Init pots, their autofreeze runs in the control-rate scheduler
+    pots_.Init(ControlScheduler::GetRate(kPotDivisor));
+    Kastle2::base.GetScheduler().Add<FancyPotBank<Pot>, &FancyPotBank<Pot>::Process>(&pots_, kPotDivisor);
 
     // This disables the next change when the pots are moved
     // or when the current layer time is over the specified number of ticks
     mode_selector_.DisableNextChangeWhen(pots_, kModeShortPressUnder);
 
-    // Set up the second core
-    second_core_processed_samples_ = 0;
-
     // Set up MODE
     mode_selector_.Init();
     mode_ = static_cast<Mode>(mode_selector_.GetMode());
+    Kastle2::base.GetScheduler().Add<FancyMode, &FancyMode::Process>(&mode_selector_);
     ModeInit();
 
+    probe_mode_ = Kastle2::probes.Add("mode");
+
+    // The DJ filter starts on the second core, the balancer measures the load of core 0 from here
+    dj_filter_balancer_.Reset(1);
+    StageBalancer::InitCore();
+
+    // The second core loop runs the meter when it waits for work
+    meter_color_ = WS2812::NONE;
+    Kastle2::meter.SetEnabled(true);
+
     inited_ = true;
 }
 
 void AppFxWizard::DeInit()
 {
     inited_ = false;
+    Kastle2::base.GetScheduler().Clear();
+    Kastle2::meter.SetEnabled(false);
+    Kastle2::hw.StopLedAnimation(Hardware::Led::LED_2);
+
+    // Delay lines use the arena memory, release them before the arena
+    feedback_delay_left_.reset();
+    feedback_delay_right_.reset();
+    delay_left_.reset();
+    delay_right_.reset();
+    Kastle2::arena.Reset();
 }
 
-FASTCODE void AppFxWizard::AudioLoop(q15_t *input, q15_t *output, size_t size)
+FASTCODE_APP(fx_wizard) void AppFxWizard::AudioLoop(q15_t *input, q15_t *output, size_t size)
 {
     if (!inited_)
     {
         return;
     }
-
-    // Autofreeze pots
-    for (auto &pot : pots_)
-    {
-        pot->Process();
-    }
-    mode_selector_.Process();
+    const uint32_t block_start = StageBalancer::Now();
+    const Mode block_mode = mode_;
+    bus_counters_.Begin();
 
     // Process clock triggers etc.
     if (Kastle2::base.GetClock().IsNowTrigger())
@@ -345,7 +376,7 @@ FASTCODE void AppFxWizard::AudioLoop(q15_t *input, q15_t *output, size_t size)
     }
 
     // Process triggers
-    if (trigger_detect_.Process(Kastle2::hw.GetTriggerIn()))
+    if (trigger_edges_.Process() > 0)
     {
         trigger_trigger_ = true;
     }
@@ -362,95 +393,69 @@ FASTCODE void AppFxWizard::AudioLoop(q15_t *input, q15_t *output, size_t size)
         mode_sh_trigger_ = true;
     }
 
-    // Set data for the second core
-    input_buffer_ = input;
-    output_buffer_ = output;
-    buffer_size_ = size;
-
-    // Tell the second core we're starting a new block
-    MultiCore::SendMessage(MultiCore::MessageType::BEGIN);
-
-    // Do the processing for each sample
-    for (size_t i = 0; i < size; i++)
+    // Switch between lockstep and pipelined processing only between blocks
+    // The switch comes with a mode change, while the render is dry, the block of latency is crossfaded
+    q15_t *dry = input;
+    if (pipelined_ != pipelined_requested_)
     {
-        input_left_ = input[2 * i];
-        input_right_ = input[2 * i + 1];
-        // Because of performance requirements, some things need to be calculated only a few times per buffer
-        sample_being_processed_ = i;
-        if (mode_ != Mode::DELAY && mode_ != Mode::REPLAYER && mode_ != Mode::FREEZER)
+        pipelined_ = pipelined_requested_;
+        if (pipelined_)
         {
-            input_left_ = q15_add(
-                q15_mult(q15_div(feedback_delay_left_->Read(), 27853), feedback_volume_),
-                q15_mult(input_left_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
-            input_right_ = q15_add(
-                q15_mult(q15_div(feedback_delay_right_->Read(), 27853), feedback_volume_),
-                q15_mult(input_right_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
+            pipeline_.Enter(input, size);
         }
-
-        // Output resetting just to be sure there is no junk there
-        output_left_ = 0;
-        output_right_ = 0;
-
-        WorkLongDelay();
-
-        switch (mode_)
+        else
         {
-        case Mode::CRUSHER:
-            ModeCrusher();
-            break;
-
-        case Mode::FLANGER:
-            ModeFlanger();
-            break;
-
-        case Mode::PANNER:
-            ModePanner();
-            break;
-
-        case Mode::FREEZER:
-            ModeFreezer();
-            break;
-
-        case Mode::REPLAYER:
-            ModeReplayer();
-            output_left_ = q15_add(
-                q15_mult(q15_div(feedback_delay_left_->Read(), 27853), feedback_volume_),
-                q15_mult(output_left_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
-            output_right_ = q15_add(
-                q15_mult(q15_div(feedback_delay_right_->Read(), 27853), feedback_volume_),
-                q15_mult(output_right_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
-            break;
-
-        case Mode::PITCHER:
-            ModePitcher();
-            break;
-
-        case Mode::DELAY:
-            ModeDelay();
-            break;
-
-        case Mode::SLICER:
-            ModeSlicer();
-            break;
+            dry = pipeline_.Leave(input, size);
+        }
+    }
+    else if (!pipelined_)
+    {
+        pipeline_.Track(input, size);
+    }
 
-        case Mode::SHIFTER:
-            ModeShifter();
-            break;
+    // Nothing comes in and everything the delays hold has decayed, skip the whole processing
+    // (the pipelined modes keep a block in flight, they always process)
+    if (kModes[block_mode].idle_bypass && !pipelined_ && mode_fade_step_ == 0 &&
+        Kastle2::base.IsInputSilent() && wet_tail_.IsSilent())
+    {
+        std::fill_n(output, 2 * size, 0);
+        if (trigger_blink_counter > 0)
+        {
+            trigger_blink_counter--;
         }
+        return;
+    }
 
-        // Write the output.
-        // The second core will continue with the output.
-        // See above that output_buffer_ = output
-        output[2 * i] = output_left_;
-        output[2 * i + 1] = output_right_;
+    // Place the DJ filter for this block
+    dj_filter_on_core0_ = !pipelined_ && dj_filter_balancer_.GetCore() == 0;
 
-        // Waiting for dry/wet change?
-        CheckDryWet();
+    // Set data for the second core
+    q15_t *render = output;
+    input_buffer_ = dry;
+    output_buffer_ = output;
+    mode_fade_dry_ = dry;
+    buffer_size_ = size;
+    if (pipelined_)
+    {
+        // Previous block goes to the output, we render the current one into the stage buffer
+        render = pipeline_.Begin(input, output, size);
+        input_buffer_ = pipeline_.GetDryInput();
+    }
 
-        // Tell the second core it can process this sample
-        MultiCore::SendMessage(MultiCore::MessageType::SAMPLE_REQUEST, i);
+    // Tell the second core we're starting a new block
+    MultiCore::BeginBlock(size);
+    if (pipelined_)
+    {
+        // The whole previous block is ready
+        MultiCore::PublishFrames(size);
     }
 
+    // Do the processing for each sample, the mode is resolved once per block
+    const uint32_t mode_start = StageBalancer::Now();
+    (this->*kModes[block_mode].block)(input, render, size);
+    const uint32_t mode_cycles = StageBalancer::Since(mode_start);
+    Kastle2::probes.TapBlock(probe_mode_, render, size);
+
     // Process counters and timers
     if (trigger_blink_counter > 0)
     {
@@ -458,34 +463,40 @@ FASTCODE void AppFxWizard::AudioLoop(q15_t *input, q15_t *output, size_t size)
     }
 
     // Wait for samples to finish processing
-    MultiCore::WaitForMessage(MultiCore::MessageType::DONE);
+    const uint32_t core0_cycles = StageBalancer::Since(block_start);
+    MultiCore::WaitForBlock();
+
+    // Both cores are done, the DJ filter can move for the next block
+    wcet_.Commit(static_cast<size_t>(block_mode), core0_cycles, second_core_cycles_);
+    bus_counters_.Commit(static_cast<size_t>(block_mode));
+    dj_filter_balancer_.Commit(mode_cycles, second_core_cycles_, dj_filter_cycles_);
+    second_core_cycles_ = 0;
+    dj_filter_cycles_ = 0;
 }
 
-FASTCODE void AppFxWizard::SecondCoreProcess(size_t index)
+FASTCODE_APP(fx_wizard) void AppFxWizard::SecondCoreProcess(size_t index)
 {
     // Read samples from the buffer
     q15_t left = output_buffer_[2 * index];
     q15_t right = output_buffer_[2 * index + 1];
 
-    // Apply DJ filter
-    left = dj_filter_left_.Process(left);
-    right = dj_filter_right_.Process(right);
+    if (pitch_tracking_)
+    {
+        pitch_tracker_.Write((input_buffer_[2 * index] + input_buffer_[2 * index + 1]) / 2);
+    }
 
-    // Compensate filter volume drop
-    left = q15_div(left, Q15_HALF);
-    right = q15_div(right, Q15_HALF);
+    // Apply DJ filter, unless core 0 did it already
+    if (!dj_filter_on_core0_)
+    {
+        DjFilterStage(left, right);
+    }
 
     // Write back feedback (after DJ filter)
     if (mode_ != Mode::DELAY && mode_ != Mode::FREEZER)
     {
-        // feedback_delay_left_->Write(feedback_filter_lp_left_.Process(feedback_filter_left_.Process(feedback_clip_.Process(left))));
-        // feedback_delay_right_->Write(feedback_filter_lp_right_.Process(feedback_filter_right_.Process(feedback_clip_.Process(right))));
-
-        feedback_delay_left_->Write(feedback_filter_left_.Process(feedback_filter_lp_left_.Process(feedback_clip_.Process(left))));
-        feedback_delay_right_->Write(feedback_filter_right_.Process(feedback_filter_lp_right_.Process(feedback_clip_.Process(right))));
-
-        // feedback_delay_left_->Write(feedback_clip_.Process(feedback_filter_left_.Process(feedback_filter_lp_left_.Process(left))));
-        // feedback_delay_right_->Write(feedback_clip_.Process(feedback_filter_right_.Process(feedback_filter_lp_right_.Process(right))));
+        // Clipper, then the low-pass and high-pass chain
+        feedback_delay_left_->Write(feedback_filter_left_.Process(feedback_clip_.Process(left)));
+        feedback_delay_right_->Write(feedback_filter_right_.Process(feedback_clip_.Process(right)));
     }
 
     // Do DryWet and write the processed samples back to the output buffer
@@ -493,33 +504,61 @@ FASTCODE void AppFxWizard::SecondCoreProcess(size_t index)
     output_buffer_[2 * index + 1] = q15_add(q15_mult(input_buffer_[2 * index + 1], Q15_MAX - global_dry_wet_), q15_mult(right, global_dry_wet_));
 }
 
-FASTCODE void AppFxWizard::SecondCoreWorker()
+FASTCODE_APP(fx_wizard) void AppFxWizard::DjFilterStage(q15_t &left, q15_t &right)
 {
+    const uint32_t start = StageBalancer::Now();
+
+    left = dj_filter_left_.Process(left);
+    right = dj_filter_right_.Process(right);
+
+    // Compensate filter volume drop
+    left = q15_div_by<Q15_HALF>(left);
+    right = q15_div_by<Q15_HALF>(right);
+
+    dj_filter_cycles_ += StageBalancer::Since(start);
+}
+
+FASTCODE_APP(fx_wizard) void AppFxWizard::SecondCoreWorker()
+{
+    StageBalancer::InitCore();
+
     while (inited_)
     {
-        if (MultiCore::HasMessage())
+        size_t from, to;
+        if (MultiCore::GetPublishedFrames(from, to))
         {
             // Monitoring second core performance
             Kastle2::hw.SetDebugPin(1, 1);
 
-            MultiCore::Message m = MultiCore::GetMessage();
-            switch (m.type)
+            Profiler::Start(Profiler::Section::SECOND_CORE);
+            Trace::Begin(TraceSpan::SECOND_CORE, static_cast<int32_t>(from | to << 16));
+            const uint32_t start = StageBalancer::Now();
+            for (size_t i = from; i < to; i++)
             {
-            case MultiCore::MessageType::BEGIN:
-                second_core_processed_samples_ = 0;
-                break;
-            case MultiCore::MessageType::SAMPLE_REQUEST:
-                SecondCoreProcess(m.data);
-                second_core_processed_samples_++;
-                if (second_core_processed_samples_ == buffer_size_)
-                {
-                    MultiCore::SendMessage(MultiCore::MessageType::DONE);
-                }
-                break;
+                SecondCoreProcess(i);
+            }
+            second_core_cycles_ += StageBalancer::Since(start);
+            Trace::End(TraceSpan::SECOND_CORE, static_cast<int32_t>(from | to << 16));
+            Profiler::Stop(Profiler::Section::SECOND_CORE);
+            if (to == buffer_size_)
+            {
+                Profiler::Commit(Profiler::Section::SECOND_CORE);
+            }
+            MultiCore::MarkFramesProcessed(to);
+
+            // A step of the pitch analysis per block, core 0 isn't waiting for it
+            PitchTracker::Estimate estimate;
+            if (to == buffer_size_ && pitch_tracking_ && pitch_tracker_.Process(estimate))
+            {
+                pitch_queue_.Push(estimate);
             }
 
             Kastle2::hw.SetDebugPin(1, 0);
         }
+        else
+        {
+            MultiCore::WaitForWork();
+        }
     }
 }
 
@@ -558,11 +597,11 @@ void AppFxWizard::CheckDryWet()
 
 void AppFxWizard::UiLoop()
 {
-    for (auto &pot : pots_)
-    {
-        pot->ReadValue();
-    }
+    pots_.ReadValues();
     mode_selector_.ReadValue();
+    wcet_.Process(Kastle2::debug);
+    bus_counters_.Process(Kastle2::debug);
+    ReadPitch();
 
     // Enable zero cross update if volume not low
     Kastle2::codec.SetZeroCrossUpdate(Kastle2::base.GetInputEnvelopeFollower().GetEnvelope() > q15(0.05f));
@@ -604,25 +643,28 @@ void AppFxWizard::UiLoop()
         cv_step_ = Kastle2::hw.GetAnalogValue(CV_STEP);
     }
 
-    int32_t feedback = pots_[Pot::FEEDBACK]->GetValue();
-    feedback += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_FEEDBACK), pots_[Pot::FEEDBACK_MOD]->GetValue());
+    int32_t feedback = pots_[Pot::FEEDBACK].GetValue();
+    feedback += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_FEEDBACK), pots_[Pot::FEEDBACK_MOD].GetValue());
     feedback = constrain(feedback, POT_MIN, POT_MAX);
 
     feedback_delay_left_->SetDelay(feedback_delay_);
     feedback_delay_right_->SetDelay(feedback_delay_);
 
-    int32_t filter = pots_[Pot::FILTER]->GetValue();
-    int32_t filter_crossfade = curve_map(filter, kMapDjFilter);
-    dj_filter_left_.SetCrossfade(filter_crossfade);
-    dj_filter_right_.SetCrossfade(filter_crossfade);
+    int32_t filter = pots_[Pot::FILTER].GetValue();
+    if (filter_param_.Changed({filter}))
+    {
+        int32_t filter_crossfade = curve_map(filter, kMapDjFilter);
+        dj_filter_left_.SetCrossfade(filter_crossfade);
+        dj_filter_right_.SetCrossfade(filter_crossfade);
+    }
 
-    int32_t dry_wet = pots_[Pot::AMOUNT]->GetValue();
-    dry_wet += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_DRYWET), pots_[Pot::AMOUNT_MOD]->GetValue());
+    int32_t dry_wet = pots_[Pot::AMOUNT].GetValue();
+    dry_wet += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_DRYWET), pots_[Pot::AMOUNT_MOD].GetValue());
     dry_wet = constrain(dry_wet, POT_MIN, POT_MAX);
 
-    int32_t time = pots_[Pot::TIME]->GetValue();
-    int32_t stereo = pots_[Pot::STEREO]->GetValue();
-    int32_t time_mod = pots_[Pot::TIME_MOD]->GetValue();
+    int32_t time = pots_[Pot::TIME].GetValue();
+    int32_t stereo = pots_[Pot::STEREO].GetValue();
+    int32_t time_mod = pots_[Pot::TIME_MOD].GetValue();
     time += apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_FREE), time_mod);
     time += apply_pot_mod_attenuvert(cv_step_, time_mod);
     time = constrain(time, POT_MIN, POT_MAX);
@@ -631,6 +673,29 @@ void AppFxWizard::UiLoop()
     size_t delay_time_left;
     size_t delay_time_right;
 
+    // Mode is the selected + offset (by CV)
+    // The render is faded out to the dry input first, then the new mode starts and fades in
+    Mode selected_mode = static_cast<Mode>(mode_selector_.GetMode());
+    bool mode_switched = false;
+    if (selected_mode != mode_)
+    {
+        if (mode_fade_ == Q15_ZERO)
+        {
+            mode_ = selected_mode;
+            ModeInit();
+            mode_switched = true;
+        }
+        else
+        {
+            mode_fade_step_ = -kModeFadeStep;
+        }
+    }
+    else if (mode_fade_step_ < 0)
+    {
+        // Back to the current mode before it faded out
+        mode_fade_step_ = kModeFadeStep;
+    }
+
     switch (mode_)
     {
     case Mode::CRUSHER:
@@ -671,13 +736,13 @@ void AppFxWizard::UiLoop()
         feedback_volume_ = curve_map(feedback, kMapPannerGlobalFeedbackVolume);
         panner_depth_ = curve_map(dry_wet, kMapPannerDepth);
         panner_stereo_mix_ = curve_map(stereo, kMapPannerStereoMix);
-        panner_clip_.SetDrive(curve_map(pots_[Pot::AMOUNT]->GetValue(), kMapPannerDistortion));
+        panner_clip_.SetDrive(curve_map(pots_[Pot::AMOUNT].GetValue(), kMapPannerDistortion));
 
         panner_frequency_ = curve_map(time, kMapPannerFrequency, MapClamp::TRUE, MapSafe::TRUE);
         panner_stereo_left_ = curve_map(stereo, kMapPannerStereoLeft, MapClamp::TRUE, MapSafe::TRUE) * curve_map(time, kMapPannerStereoTimeAdjust);
         panner_stereo_right_ = curve_map(stereo, kMapPannerStereoRight, MapClamp::TRUE, MapSafe::TRUE) * curve_map(time, kMapPannerStereoTimeAdjust);
-        lfo_left_.SetNativeFrequency(q31_add(panner_frequency_, panner_stereo_left_));
-        lfo_right_.SetNativeFrequency(q31_add(panner_frequency_, panner_stereo_right_));
+        panner_lfos_.SetNativeFrequency(kPannerLfoLeft, q31_add(panner_frequency_, panner_stereo_left_));
+        panner_lfos_.SetNativeFrequency(kPannerLfoRight, q31_add(panner_frequency_, panner_stereo_right_));
         break;
 
     case Mode::FREEZER:
@@ -758,8 +823,7 @@ void AppFxWizard::UiLoop()
         pitcher_depth_ = q15_to_q31(curve_map(dry_wet, kMapPitcherDepth));
         pitcher_frequency_ = curve_map(time, kMapPitcherFrequency, MapClamp::TRUE, MapSafe::TRUE);
         pitcher_stereo_mix_ = q15_to_q31(curve_map(stereo, kMapPitcherStereoMix));
-        lfo_left_.SetNativeFrequency(pitcher_frequency_);
-        lfo_right_.SetNativeFrequency(q31_add(pitcher_frequency_, curve_map(stereo, kMapPitcherStereoFrequency, MapClamp::TRUE, MapSafe::TRUE)));
+        pitcher_right_frequency_ = q31_add(pitcher_frequency_, curve_map(stereo, kMapPitcherStereoFrequency, MapClamp::TRUE, MapSafe::TRUE));
         pitcher_env_depth_ = curve_map(dry_wet, kMapPitcherEnvDepth, MapClamp::TRUE);
         break;
 
@@ -771,7 +835,7 @@ void AppFxWizard::UiLoop()
         delay_wet_ = curve_map(dry_wet, kMapDelayWet);
         delay_feedback_ = curve_map(feedback, kMapDelayFeedback);
 
-        mapped_time = curve_map(time, kMapDelayLength);
+        mapped_time = curve_map(time, settings_file_.mode_parameters->delay_length);
 
         if (delay_ticks_time_ > kDelayTicksSyncUpperLimit || ((delay_ticks_time_ > (delay_ticks_time_last_ * 2 + delay_ticks_time_last_ / 2)) && !delay_synced_first_measurement_))
         {
@@ -815,6 +879,10 @@ void AppFxWizard::UiLoop()
             // select it
             delay_length_ = delay_synced_times_[i];
         }
+        else if (pitch_follow_)
+        {
+            delay_length_ = TunedDelayLength(mapped_time);
+        }
         else
         {
             delay_length_ = mapped_time;
@@ -889,13 +957,13 @@ void AppFxWizard::UiLoop()
         break;
     }
 
-    // Mode is the selected + offset (by CV)
-    mode_ = static_cast<Mode>(mode_selector_.GetMode());
-
-    if (mode_ != mode_prev_)
+    if (mode_switched)
     {
-        mode_prev_ = mode_;
-        ModeInit();
+#if NEAR_ZERO_DRYWET
+        // Only the dry input is heard now, no need to wait for the signals to meet
+        global_dry_wet_ = global_dry_wet_queue_;
+#endif
+        mode_fade_step_ = kModeFadeStep;
     }
 
     // do Mode triggers
@@ -915,44 +983,89 @@ void AppFxWizard::UiLoop()
             color = WS2812::ApplyBrightness(color, 128);
         }
 
-        Kastle2::hw.SetLed(Hardware::Led::LED_1, color);
+        Kastle2::hw.SetLed(Hardware::Led::LED_1, tuner_ ? TunerColor() : color);
         Kastle2::hw.SetLed(Hardware::Led::LED_2, color);
+
+        // The meter follows the mode color, played again only when it changes
+        const uint32_t meter_color = kLedColors[mode_];
+        if (meter_color != meter_color_)
+        {
+            const uint32_t low_color = WS2812::ApplyBrightness(meter_color, kMeterLowBrightness);
+            Kastle2::hw.PlayLedAnimation(Hardware::Led::LED_2, LedAnimator::Animation::Meter(meter_color, low_color, kMeterBand));
+            meter_color_ = meter_color;
+        }
+    }
+    else if (meter_color_ != WS2812::NONE)
+    {
+        // The other layers show their own colors
+        Kastle2::hw.StopLedAnimation(Hardware::Led::LED_2);
+        meter_color_ = WS2812::NONE;
+    }
+}
+
+void AppFxWizard::ReadPitch()
+{
+    PitchTracker::Estimate estimate;
+    while (pitch_queue_.Pop(estimate))
+    {
+        if (estimate.period != 0 && estimate.confidence >= kPitchMinConfidence)
+        {
+            pitch_ = estimate;
+            pitch_timeout_ = make_timeout_time_ms(kPitchTimeoutMs);
+        }
+    }
+    if (pitch_.period != 0 && absolute_time_diff_us(pitch_timeout_, get_absolute_time()) >= 0)
+    {
+        pitch_ = {};
     }
 }
 
+size_t AppFxWizard::TunedDelayLength(const size_t length) const
+{
+    if (pitch_.period == 0)
+    {
+        return length;
+    }
+    // Periods are in 1/256 of a sample
+    const uint64_t period = pitch_.period;
+    const uint64_t periods = std::max<uint64_t>((static_cast<uint64_t>(length) * 256 + period / 2) / period, 1);
+    return static_cast<size_t>((periods * period + 128) >> 8);
+}
+
+uint32_t AppFxWizard::TunerColor() const
+{
+    if (pitch_.period == 0)
+    {
+        return WS2812::BLACK;
+    }
+    // Cents from the nearest equal tempered note
+    const float note = 12.0f * std::log2(PitchTracker::GetFrequency(pitch_.period, SAMPLE_RATE) / 440.0f);
+    const int32_t cents = static_cast<int32_t>(std::lround((note - std::round(note)) * 100.0f));
+    if (std::abs(cents) <= kTunerInTuneCents)
+    {
+        return WS2812::GREEN;
+    }
+    const uint8_t brightness = static_cast<uint8_t>(std::min<int32_t>(std::abs(cents) * 255 / 50, 255));
+    return WS2812::ApplyBrightness(cents < 0 ? WS2812::RED : WS2812::BLUE, brightness);
+}
+
 void AppFxWizard::ModeInit()
 {
     mode_selector_.SendMidi();
-    switch (mode_)
+    Kastle2::SetUnderrunTag(static_cast<uint32_t>(mode_));
+#if PIPELINED_HEAVY_MODES
+    pipelined_requested_ = (mode_ == Mode::PITCHER || mode_ == Mode::SHIFTER);
+#endif
+#ifdef FX_WIZARD_LONG_LOOPS
+    const bool shifted = mode_ == Mode::PITCHER || mode_ == Mode::SHIFTER;
+    if (delay_memory_shifted_ && !shifted)
     {
-    case Mode::CRUSHER:
-        ModeCrusherInit();
-        break;
-    case Mode::FLANGER:
-        ModeFlangerInit();
-        break;
-    case Mode::PANNER:
-        ModePannerInit();
-        break;
-    case Mode::FREEZER:
-        ModeFreezerInit();
-        break;
-    case Mode::REPLAYER:
-        ModeReplayerInit();
-        break;
-    case Mode::PITCHER:
-        ModePitcherInit();
-        break;
-    case Mode::DELAY:
-        ModeDelayInit();
-        break;
-    case Mode::SLICER:
-        ModeSlicerInit();
-        break;
-    case Mode::SHIFTER:
-        ModeShifterInit();
-        break;
+        delay_left_->Reset();
+        delay_right_->Reset();
     }
+    delay_memory_shifted_ = shifted;
+#endif
+    (this->*kModes[mode_].init)();
 
     // reset oversampling and direction of the long delay
     if (mode_ != Mode::REPLAYER)
@@ -1017,28 +1130,30 @@ void AppFxWizard::ModeTrigger()
 
     case Mode::PANNER:
         // reset the LFOs to the next zero crossing
-        if (lfo_left_.GetPhase() > Q31_ZERO)
+        if (panner_lfos_.GetPhase(kPannerLfoLeft) > Q31_ZERO)
         {
-            lfo_left_.Reset(Q31_MIN / 2);
+            panner_lfos_.Reset(kPannerLfoLeft, Q31_MIN / 2);
         }
-        else if (lfo_left_.GetPhase() < Q31_ZERO)
+        else if (panner_lfos_.GetPhase(kPannerLfoLeft) < Q31_ZERO)
         {
-            lfo_left_.Reset(Q31_MAX / 2);
+            panner_lfos_.Reset(kPannerLfoLeft, Q31_MAX / 2);
         }
 
-        if (lfo_right_.GetPhase() > Q31_ZERO)
+        if (panner_lfos_.GetPhase(kPannerLfoRight) > Q31_ZERO)
         {
-            lfo_right_.Reset(Q31_MIN / 2);
+            panner_lfos_.Reset(kPannerLfoRight, Q31_MIN / 2);
         }
-        else if (lfo_right_.GetPhase() < Q31_ZERO)
+        else if (panner_lfos_.GetPhase(kPannerLfoRight) < Q31_ZERO)
         {
-            lfo_right_.Reset(Q31_ZERO / 2);
+            panner_lfos_.Reset(kPannerLfoRight, Q31_ZERO / 2);
         }
         break;
 
     case Mode::PITCHER:
         pitcher_env_.Trigger();
-        [[fallthrough]]; // purposelly keeping fallthrough
+        pitch_shifter_left_.ResetPhase();
+        pitch_shifter_right_.ResetPhase();
+        break;
 
     case Mode::FLANGER:
         lfo_left_.Reset();
@@ -1047,31 +1162,11 @@ void AppFxWizard::ModeTrigger()
     }
 }
 
-void AppFxWizard::WorkLongDelay()
-{
-    // the delay has to be fed with newest data when not directly being used
-
-    switch (mode_)
-    {
-    case Mode::FREEZER:
-    case Mode::REPLAYER:
-    case Mode::DELAY:
-    case Mode::FLANGER:
-    case Mode::PITCHER:
-    case Mode::SLICER:
-    case Mode::SHIFTER:
-        break;
-
-    default:
-        delay_left_->Write(input_left_);
-        delay_right_->Write(input_right_);
-    }
-}
-
 void AppFxWizard::ModeCrusherInit()
 {
-    lfo_left_.SetWaveform(Oscillator::Waveform::RAMP);
-    lfo_right_.SetWaveform(Oscillator::Waveform::RAMP);
+    const auto waveform = static_cast<Oscillator::Waveform>(settings_file_.mode_parameters->crusher_waveform);
+    lfo_left_.SetWaveform(waveform);
+    lfo_right_.SetWaveform(waveform);
 }
 
 void AppFxWizard::ModeCrusher()
@@ -1105,8 +1200,9 @@ void AppFxWizard::ModeCrusher()
 
 void AppFxWizard::ModeFlangerInit()
 {
-    lfo_left_.SetWaveform(Oscillator::Waveform::TRI);
-    lfo_right_.SetWaveform(Oscillator::Waveform::TRI);
+    const auto waveform = static_cast<Oscillator::Waveform>(settings_file_.mode_parameters->flanger_waveform);
+    lfo_left_.SetWaveform(waveform);
+    lfo_right_.SetWaveform(waveform);
 }
 
 void AppFxWizard::ModeFlanger()
@@ -1135,15 +1231,14 @@ void AppFxWizard::ModeFlanger()
 
 void AppFxWizard::ModePannerInit()
 {
-    lfo_left_.SetWaveform(Oscillator::Waveform::SINE);
-    lfo_right_.SetWaveform(Oscillator::Waveform::SINE);
+    panner_lfos_.SetWaveform(static_cast<Oscillator::Waveform>(settings_file_.mode_parameters->panner_waveform));
 }
 
 void AppFxWizard::ModePanner()
 {
     // change it to 0 to 1 waveform in q15
-    q15_t lfo_l = q31_to_q15(lfo_left_.Process());
-    q15_t lfo_r = q15_mult(lfo_l, panner_stereo_mix_) + q15_mult(q31_to_q15(lfo_right_.Process()), Q15_MAX - panner_stereo_mix_);
+    q15_t lfo_l = q31_to_q15(panner_lfo_values_[kPannerLfoLeft][sample_being_processed_]);
+    q15_t lfo_r = q15_mult(lfo_l, panner_stereo_mix_) + q15_mult(q31_to_q15(panner_lfo_values_[kPannerLfoRight][sample_being_processed_]), Q15_MAX - panner_stereo_mix_);
     lfo_l = q15_add(q15_mult(panner_clip_.Process(lfo_l), Q15_HALF), Q15_HALF);
     lfo_r = q15_add(q15_mult(panner_clip_.Process(lfo_r), Q15_HALF), Q15_HALF);
     q15_t left_mod = q15_sub(Q15_MAX, q15_mult(lfo_l, panner_depth_));
@@ -1157,8 +1252,8 @@ void AppFxWizard::ModeFreezerInit()
 {
     freezer_grab_buffer_ = false;
     freezer_grab_prev_ = freezer_grab_buffer_;
-    delay_left_->SetOversampling(AdvancedDynamicDelayLine<q15least_t>::kDefaultSampling);
-    delay_right_->SetOversampling(AdvancedDynamicDelayLine<q15least_t>::kDefaultSampling);
+    delay_left_->SetOversampling(DelayLine::kDefaultSampling);
+    delay_right_->SetOversampling(DelayLine::kDefaultSampling);
     delay_left_->SetDelaySnap(0);
     delay_right_->SetDelaySnap(0);
 }
@@ -1271,8 +1366,8 @@ void AppFxWizard::ModeReplayerInit()
 {
     delay_left_->SetLengthBothToMax();
     delay_right_->SetLengthBothToMax();
-    delay_left_->SetDelay(50800);
-    delay_right_->SetDelay(50800);
+    delay_left_->SetDelay(kDelayLength);
+    delay_right_->SetDelay(kDelayLength);
 }
 
 void AppFxWizard::ModeReplayer()
@@ -1316,162 +1411,71 @@ void AppFxWizard::ModeReplayer()
 
 void AppFxWizard::ModePitcherInit()
 {
-    lfo_left_.SetWaveform(Oscillator::Waveform::SAW);
-    lfo_right_.SetWaveform(Oscillator::Waveform::SAW);
+    pitch_shifter_left_.ResetPhase();
+    pitch_shifter_right_.ResetPhase();
 }
 
-void AppFxWizard::ModePitcher()
+void AppFxWizard::SetPitcherSweep(PitchShifter &shifter, const q31_t frequency)
 {
-    delay_left_->Write(input_left_);
-    delay_right_->Write(input_right_);
-
-    q31_t lfo_l = lfo_left_.Process();
-    q31_t lfo_r = q31_mult(lfo_l, pitcher_stereo_mix_) + q31_mult(lfo_right_.Process(), Q31_MAX - pitcher_stereo_mix_);
+    // One sweep per LFO period, over up to 4 periods of delay, the pitch goes up
+    const q31_t native = constrain(frequency, 1, Q31_MAX / 4);
+    const uint32_t ticks = Q31_MAX / native;
+    shifter.SetWindow(4 * q31_mult(ticks, pitcher_depth_modulated_));
+    shifter.SetIncrement(-2 * native);
+}
 
-    // modulate modulation depth with pitcher envelope
-    if (sample_being_processed_ == 0)
+void AppFxWizard::ModePitcher()
+{
+    // modulate modulation depth with pitcher envelope, the sweeps follow it
+    if (sample_being_processed_ == kPitcherEnvFrame)
     {
         q31_t tmp = q31_mult(pitcher_env_.Process(), q31(0.8f));
         pitcher_depth_modulated_ = q31_mult(pitcher_depth_, Q31_MAX - tmp);
-    }
-    // control modulation depth
-    lfo_l = q31_mult(lfo_l / 2 + Q31_HALF, q31_mult(lfo_left_.GetTicks(), pitcher_depth_modulated_));
-    lfo_r = q31_mult(lfo_r / 2 + Q31_HALF, q31_mult(lfo_right_.GetTicks(), pitcher_depth_modulated_));
-
-    // increase modulation depth
-    lfo_l *= 4;
-    lfo_r *= 4;
-
-    // limit the range for the effect to not drop out
-    lfo_l %= delay_left_->GetMaxLength();
-    lfo_r %= delay_right_->GetMaxLength();
 
-    delay_left_->SetDelaySnap(lfo_l);
-    delay_right_->SetDelaySnap(lfo_r);
-
-    int32_t left = delay_left_->Read();
-    int32_t right = delay_right_->Read();
-
-    // fade the volume near the lfo phase reset to remove clicks - left channel
-    int32_t remaining_ticks = lfo_left_.GetTicks() - lfo_left_.GetElapsedTicks();
-    if (remaining_ticks < 0)
-    {
-        remaining_ticks = 0;
-    }
-    size_t elapsed_ticks = lfo_left_.GetElapsedTicks();
-    if (elapsed_ticks < 64)
-    {
-        left = q15_mult(left, elapsed_ticks << (15 - 6));
-    }
-    else if (remaining_ticks < 64)
-    {
-        left = q15_mult(left, remaining_ticks << (15 - 6));
-    }
-    // fade the volume near the lfo phase reset to remove clicks - right channel
-    remaining_ticks = lfo_right_.GetTicks() - lfo_right_.GetElapsedTicks();
-    if (remaining_ticks < 0)
-    {
-        remaining_ticks = 0;
-    }
-    elapsed_ticks = lfo_right_.GetElapsedTicks();
-    if (elapsed_ticks < 64)
-    {
-        right = q15_mult(right, elapsed_ticks << (15 - 6));
-    }
-    else if (remaining_ticks < 64)
-    {
-        right = q15_mult(right, remaining_ticks << (15 - 6));
+        SetPitcherSweep(pitch_shifter_left_, pitcher_frequency_);
+        SetPitcherSweep(pitch_shifter_right_, q31_mult(pitcher_frequency_, pitcher_stereo_mix_) +
+                                                  q31_mult(pitcher_right_frequency_, Q31_MAX - pitcher_stereo_mix_));
     }
 
+    const q15_t left = pitch_shifter_left_.Process(input_left_);
+    const q15_t right = pitch_shifter_right_.Process(input_right_);
+
     output_left_ = q15_mult(input_left_, Q15_MAX - pitcher_dry_wet_) + q15_mult(left, pitcher_dry_wet_);
     output_right_ = q15_mult(input_right_, Q15_MAX - pitcher_dry_wet_) + q15_mult(right, pitcher_dry_wet_);
 }
 
 void AppFxWizard::ModeShifterInit()
 {
-    // nothing to init
+    pitch_shifter_left_.SetWindow(kShifterWindow);
+    pitch_shifter_right_.SetWindow(kShifterWindow);
+}
+
+void AppFxWizard::SetShifterSweep(PitchShifter &shifter, const q31_t frequency)
+{
+    // One sweep over the window per LFO period, up when the time is over the half
+    const int32_t increment = 2 * constrain(q31_saturate(static_cast<int64_t>(frequency) * shifter_env_value_), 0, Q31_MAX / 4);
+    shifter.SetIncrement(shifter_direction_ ? -increment : increment);
 }
 
 void AppFxWizard::ModeShifter()
 {
-    if (sample_being_processed_ == 0)
+    // The envelope and the frequency updates go in two frames of the block
+    if (sample_being_processed_ == kShifterLeftFrame)
     {
         q15_t env = q15_mult(q31_to_q15(shifter_env_.Process()), shifter_env_mod_);
-        env = constrain(env, 1, 100);
-        int64_t lf = (int64_t)shifter_left_frequency_ * (int64_t)env;
-        int64_t rf = (int64_t)shifter_right_frequency_ * (int64_t)env;
-        lfo_left_.SetNativeFrequency(q31_saturate(lf));
-        lfo_right_.SetNativeFrequency(q31_saturate(rf));
+        shifter_env_value_ = constrain(env, 1, 100);
+        SetShifterSweep(pitch_shifter_left_, shifter_left_frequency_);
     }
-
-    if (shifter_direction_)
+    if (sample_being_processed_ == kShifterRightFrame)
     {
-        lfo_left_.SetWaveform(Oscillator::Waveform::SAW);
-        lfo_right_.SetWaveform(Oscillator::Waveform::SAW);
+        SetShifterSweep(pitch_shifter_right_, shifter_right_frequency_);
     }
-    else
-    {
-        lfo_left_.SetWaveform(Oscillator::Waveform::RAMP);
-        lfo_right_.SetWaveform(Oscillator::Waveform::RAMP);
-    }
-
-    delay_left_->Write(input_left_);
-    delay_right_->Write(input_right_);
-
-    // scale lfo to +-255
-    q15_t lfo_l = 255 + (q31_to_q15(lfo_left_.Process()) / 128);
-    q15_t lfo_r = 255 + (q31_to_q15(lfo_right_.Process()) / 128);
-
-    // lfo_l = q15_mult(lfo_l, Q15_MAX - shifter_dry_);
-    // lfo_r = q15_mult(lfo_r, Q15_MAX - shifter_dry_);
 
-    /*if (shifter_direction_ == 0)
-    {
-        lfo_l = 0;
-        lfo_r = 0;
-    }*/
-
-    delay_left_->SetDelaySnap(lfo_l);
-    delay_right_->SetDelaySnap(lfo_r);
-
-    int32_t left = delay_left_->Read();
-    int32_t right = delay_right_->Read();
-
-    // fade the volume near the lfo phase reset to remove clicks - left channel
-    int32_t remaining_ticks = lfo_left_.GetTicks() - lfo_left_.GetElapsedTicks();
-    if (remaining_ticks < 0)
-    {
-        remaining_ticks = 0;
-    }
-    size_t elapsed_ticks = lfo_left_.GetElapsedTicks();
-    if (elapsed_ticks < 64)
-    {
-        left = q15_mult(left, elapsed_ticks << (15 - 6));
-    }
-    else if (remaining_ticks < 64)
-    {
-        left = q15_mult(left, remaining_ticks << (15 - 6));
-    }
-    // fade the volume near the lfo phase reset to remove clicks - right channel
-    remaining_ticks = lfo_right_.GetTicks() - lfo_right_.GetElapsedTicks();
-    if (remaining_ticks < 0)
-    {
-        remaining_ticks = 0;
-    }
-    elapsed_ticks = lfo_right_.GetElapsedTicks();
-    if (elapsed_ticks < 64)
-    {
-        right = q15_mult(right, elapsed_ticks << (15 - 6));
-    }
-    else if (remaining_ticks < 64)
-    {
-        right = q15_mult(right, remaining_ticks << (15 - 6));
-    }
+    const q15_t left = pitch_shifter_left_.Process(input_left_);
+    const q15_t right = pitch_shifter_right_.Process(input_right_);
 
     output_left_ = q15_mult(input_left_, shifter_dry_) + q15_mult(left, Q15_MAX - shifter_dry_);
     output_right_ = q15_mult(input_right_, shifter_dry_) + q15_mult(right, Q15_MAX - shifter_dry_);
-    // output_left_ = left;
-    // output_right_ = right;
 }
 
 void AppFxWizard::ModeDelayInit()
@@ -1516,8 +1520,8 @@ void AppFxWizard::ModeDelay()
     tmp_left = q15_mult(tmp_left, compress_amount_);
     tmp_right = q15_mult(tmp_right, compress_amount_);
 
-    delay_left_->Write(q15_div(tmp_left, Q15_HALF));
-    delay_right_->Write(q15_div(tmp_right, Q15_HALF));
+    delay_left_->Write(q15_div_by<Q15_HALF>(tmp_left));
+    delay_right_->Write(q15_div_by<Q15_HALF>(tmp_right));
 
     output_left_ = q15_add(q15_mult(input_left_, delay_dry_), q15_mult(delay_reading_l, delay_wet_));
     output_right_ = q15_add(q15_mult(input_right_, delay_dry_), q15_mult(delay_reading_r, delay_wet_));
@@ -1568,18 +1572,159 @@ void AppFxWizard::ModeSlicer()
     output_right_ = q15_mult(input_right_, q31_to_q15(slicer_env_right_.Process()));
 }
 
-void AppFxWizard::MemoryInitialization()
+template <AppFxWizard::Mode kMode>
+FASTCODE_APP(fx_wizard) void AppFxWizard::ModeBlock(const q15_t *input, q15_t *render, size_t size)
+{
+    // OR of the absolute wet samples, for the tail tracking
+    q15_t wet_level = 0;
+
+    // These modes have their own feedback, the others get the feedback delay mixed into the input
+    constexpr bool kFeedbackInput = kMode != Mode::DELAY && kMode != Mode::REPLAYER && kMode != Mode::FREEZER;
+    // The long delay has to be fed with newest data when not directly being used
+    constexpr bool kFeedLongDelay = kMode == Mode::CRUSHER || kMode == Mode::PANNER;
+
+    if constexpr (kMode == Mode::PANNER)
+    {
+        panner_lfos_.Process(panner_lfo_values_, size);
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+        input_left_ = input[2 * i];
+        input_right_ = input[2 * i + 1];
+        // Because of performance requirements, some things need to be calculated only a few times per buffer
+        sample_being_processed_ = i;
+        if constexpr (kFeedbackInput)
+        {
+            input_left_ = q15_add(
+                q15_mult(q15_div_by<27853>(feedback_delay_left_->Read()), feedback_volume_),
+                q15_mult(input_left_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
+            input_right_ = q15_add(
+                q15_mult(q15_div_by<27853>(feedback_delay_right_->Read()), feedback_volume_),
+                q15_mult(input_right_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
+        }
+
+        // Output resetting just to be sure there is no junk there
+        output_left_ = 0;
+        output_right_ = 0;
+
+        if constexpr (kFeedLongDelay)
+        {
+            delay_left_->Write(input_left_);
+            delay_right_->Write(input_right_);
+        }
+
+        if constexpr (kMode == Mode::CRUSHER)
+        {
+            ModeCrusher();
+        }
+        else if constexpr (kMode == Mode::FLANGER)
+        {
+            ModeFlanger();
+        }
+        else if constexpr (kMode == Mode::PANNER)
+        {
+            ModePanner();
+        }
+        else if constexpr (kMode == Mode::FREEZER)
+        {
+            ModeFreezer();
+        }
+        else if constexpr (kMode == Mode::REPLAYER)
+        {
+            ModeReplayer();
+            output_left_ = q15_add(
+                q15_mult(q15_div_by<27853>(feedback_delay_left_->Read()), feedback_volume_),
+                q15_mult(output_left_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
+            output_right_ = q15_add(
+                q15_mult(q15_div_by<27853>(feedback_delay_right_->Read()), feedback_volume_),
+                q15_mult(output_right_, (Q15_MAX - feedback_volume_) / 2 + Q15_HALF));
+        }
+        else if constexpr (kMode == Mode::PITCHER)
+        {
+            ModePitcher();
+        }
+        else if constexpr (kMode == Mode::DELAY)
+        {
+            ModeDelay();
+        }
+        else if constexpr (kMode == Mode::SLICER)
+        {
+            ModeSlicer();
+        }
+        else if constexpr (kMode == Mode::SHIFTER)
+        {
+            ModeShifter();
+        }
+
+        // Write the output.
+        // The second core will continue with the output.
+        // See above that output_buffer_ = output
+        // When pipelined, this goes to the stage buffer and the second core gets it next block
+        q15_t left = output_left_;
+        q15_t right = output_right_;
+
+        // Mode change in progress, crossfade the render with the dry input
+        if (mode_fade_step_ != 0)
+        {
+            mode_fade_ = constrain(mode_fade_ + mode_fade_step_, Q15_ZERO, Q15_MAX);
+            if (mode_fade_ == Q15_MAX)
+            {
+                mode_fade_step_ = 0;
+            }
+            left = q15_add(q15_mult(mode_fade_dry_[2 * i], Q15_MAX - mode_fade_), q15_mult(left, mode_fade_));
+            right = q15_add(q15_mult(mode_fade_dry_[2 * i + 1], Q15_MAX - mode_fade_), q15_mult(right, mode_fade_));
+        }
+
+        // DJ filter moved from the second core
+        if (dj_filter_on_core0_)
+        {
+            DjFilterStage(left, right);
+        }
+
+        render[2 * i] = left;
+        render[2 * i + 1] = right;
+        wet_level |= q15_abs(left) | q15_abs(right);
+
+        // Waiting for dry/wet change?
+        CheckDryWet();
+
+        // Hand the finished sub-block over to the second core
+        if (!pipelined_)
+        {
+            MultiCore::PublishFrame(i);
+        }
+    }
+
+    wet_tail_.Process(wet_level, size);
+}
+
+const EnumArray<AppFxWizard::Mode, AppFxWizard::ModeEntry> AppFxWizard::kModes = {
+    ModeEntry{&AppFxWizard::ModeDelayInit, &AppFxWizard::ModeBlock<Mode::DELAY>, true},
+    ModeEntry{&AppFxWizard::ModeFlangerInit, &AppFxWizard::ModeBlock<Mode::FLANGER>, true},
+    ModeEntry{&AppFxWizard::ModeFreezerInit, &AppFxWizard::ModeBlock<Mode::FREEZER>, false},
+    ModeEntry{&AppFxWizard::ModePannerInit, &AppFxWizard::ModeBlock<Mode::PANNER>, true},
+    ModeEntry{&AppFxWizard::ModeCrusherInit, &AppFxWizard::ModeBlock<Mode::CRUSHER>, true},
+    ModeEntry{&AppFxWizard::ModeSlicerInit, &AppFxWizard::ModeBlock<Mode::SLICER>, true},
+    ModeEntry{&AppFxWizard::ModePitcherInit, &AppFxWizard::ModeBlock<Mode::PITCHER>, true},
+    ModeEntry{&AppFxWizard::ModeReplayerInit, &AppFxWizard::ModeBlock<Mode::REPLAYER>, false},
+    ModeEntry{&AppFxWizard::ModeShifterInit, &AppFxWizard::ModeBlock<Mode::SHIFTER>, true},
+};
+
+COLDCODE void AppFxWizard::MemoryInitialization()
 {
     Kastle2::memory.Write8(kMemMode, 0);
 }
 
 void AppFxWizard::MidiCallback(midi::Message *msg)
 {
-    for (auto &pot : pots_)
+    pots_.MidiCallback(msg);
+    mode_selector_.MidiCallback(msg);
+    if (msg->IsControlChange() && (msg->GetData1() == cc::PITCH_FOLLOW || msg->GetData1() == cc::TUNER))
     {
-        pot->MidiCallback(msg);
+        (msg->GetData1() == cc::PITCH_FOLLOW ? pitch_follow_ : tuner_) = msg->GetData2() >= 64;
+        pitch_tracking_ = pitch_follow_ || tuner_;
     }
-    mode_selector_.MidiCallback(msg);
     if (msg->IsNoteOn())
     {
         uint8_t note = msg->GetData1();
@@ -1601,7 +1746,7 @@ bool AppFxWizard::LoadFile()
     }
 
     // Read the header data
-    file_reader.Read(&settings_file_, 10);
+    file_reader.Read(&settings_file_, 11);
 
     // Validate counts (it's also checked by the file reader, but just in case)
     if (!between(settings_file_.num_rhythms, 1, UserDataFile::kMaxRhythms))
@@ -1625,5 +1770,58 @@ bool AppFxWizard::LoadFile()
         return false;
     }
 
+    // Mode parameters are optional, a file without valid ones keeps the defaults
+    MapModeParameters(file_reader);
+
+    return true;
+}
+
+bool AppFxWizard::MapModeParameters(const UserDataFile &file_reader)
+{
+    if ((settings_file_.flags & kFxWizardFlagModeParameters) == 0)
+    {
+        return false;
+    }
+
+    // Right after the rhythms, 4-byte aligned like them
+    const size_t offset = 20 + settings_file_.num_rhythms * sizeof(TriggerGenerator::Rhythm);
+    const FxWizardModeParameters *parameters = file_reader.Map<FxWizardModeParameters>(offset);
+    if (parameters == nullptr)
+    {
+        return false;
+    }
+
+    // The modes use them as they are, check everything once here
+    const auto &delay_length = parameters->delay_length;
+    for (size_t i = 0; i < delay_length.size(); i++)
+    {
+        if (!between(delay_length.input[i], 0, POT_MAX) || (i > 0 && delay_length.input[i] <= delay_length.input[i - 1]))
+        {
+            return false;
+        }
+        if (!between(delay_length.output[i], 1, static_cast<int32_t>(kDelayLength) - 1))
+        {
+            return false;
+        }
+    }
+
+    constexpr auto kWaveforms = static_cast<uint8_t>(Oscillator::Waveform::COUNT);
+    if (parameters->crusher_waveform >= kWaveforms || parameters->flanger_waveform >= kWaveforms ||
+        parameters->panner_waveform >= kWaveforms)
+    {
+        return false;
+    }
+
+    auto valid_frequency = [](const uint16_t frequency)
+    {
+        return between(frequency, kModeParametersMinFrequency, kModeParametersMaxFrequency);
+    };
+    if (!valid_frequency(parameters->feedback_highpass_left) || !valid_frequency(parameters->feedback_highpass_right) ||
+        !valid_frequency(parameters->feedback_lowpass_left) || !valid_frequency(parameters->feedback_lowpass_right))
+    {
+        return false;
+    }
+
+    settings_file_.mode_parameters = parameters;
     return true;
 }
\ No newline at end of file
@@ -25,22 +25,40 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include "common/controls/DerivedParameter.hpp"
 #include "common/controls/FancyMode.hpp"
-#include "common/controls/FancyPot.hpp"
+#include "common/controls/FancyPotBank.hpp"
 #include "common/core/App.hpp"
+#include "common/core/Arena.hpp"
+#include "common/core/FrameSlots.hpp"
 #include "common/core/Hardware.hpp"
+#include "common/core/InputEdges.hpp"
+#include "common/core/MultiCoreQueue.hpp"
+#include "common/core/SecondCorePipeline.hpp"
+#include "common/core/StageBalancer.hpp"
+#include "common/core/UserDataFile.hpp"
+#include "common/debug/BusCounters.hpp"
+#include "common/debug/WcetTracker.hpp"
 #include "common/dsp/control/AdsrEnv.hpp"
 #include "common/dsp/control/BeatDetector.hpp"
 #include "common/dsp/control/EnvelopeFollower.hpp"
+#include "common/dsp/control/LfoBank.hpp"
+#include "common/dsp/control/PitchTracker.hpp"
+#include "common/dsp/effects/PitchShifter.hpp"
 #include "common/dsp/effects/SoftClipper.hpp"
 #include "common/dsp/filters/DjFilter.hpp"
+#include "common/dsp/filters/Svf.hpp"
 #include "common/dsp/math/Fraction.hpp"
 #include "common/dsp/math/qmath.hpp"
 #include "common/dsp/synthesis/Oscillator.hpp"
 #include "common/dsp/utility/AdvancedDynamicDelayLine.hpp"
 #include "common/dsp/utility/AutoFreeze.hpp"
+#include "common/dsp/utility/Chain.hpp"
+#include "common/dsp/utility/MuLawSample.hpp"
+#include "common/dsp/utility/TailTracker.hpp"
 #include "common/fastcode.hpp"
 #include "common/peripherals/WS2812.hpp"
 #include "FxWizardFile.hpp"
@@ -52,6 +70,11 @@ SOFTWARE.
 // disable this feature by writing a 0 below.
 #define NEAR_ZERO_DRYWET 1
 
+// Heavy modes (PITCHER, SHIFTER) run the second core one block behind core 0,
+// which gives both cores the whole block period at the cost of ~1.1 ms of latency.
+// Write a 0 below to always run the cores in lockstep.
+#define PIPELINED_HEAVY_MODES 1
+
 namespace kastle2
 {
 
@@ -63,7 +86,7 @@ namespace kastle2
  * @date 2024-07-16
  */
 
-class AppFxWizard : public virtual App
+class AppFxWizard final : public App
 {
 public:
     /**
@@ -99,6 +122,45 @@ public:
         WS2812::LIGHT_PINK,
     };
 
+#ifdef FX_WIZARD_LONG_LOOPS
+    /**
+     * @brief Sample type of the main delay lines, µ-law keeps twice the time in the same memory (fx-wizard-long-loops).
+     */
+    using DelaySample = MuLawSample;
+#else
+    /**
+     * @brief Sample type of the main delay lines.
+     */
+    using DelaySample = q15least_t;
+#endif
+    using DelayLine = AdvancedDynamicDelayLine<DelaySample, DelaySlew::BITS_32>;
+
+    /**
+     * @brief Memory of each main delay line in 16-bit samples, shared with the pitch shifter (1.15s at 44 kHz).
+     */
+    static constexpr size_t kDelayMemoryLength = 50800;
+
+    /**
+     * @brief Length of the main delay lines in samples.
+     */
+    static constexpr size_t kDelayLength = kDelayMemoryLength * sizeof(q15least_t) / sizeof(DelaySample);
+
+    /**
+     * @brief Length of the feedback delay lines in samples (44ms).
+     */
+    static constexpr size_t kFeedbackDelayLength = 2000;
+
+    /**
+     * @brief Frames added to the delay lengths in the tail of the wet signal, for the resonant filters ringing out (93ms).
+     */
+    static constexpr size_t kWetTailMargin = 4096;
+
+    /**
+     * @brief Size of Kastle2::arena, all the buffers allocated in Init().
+     */
+    static constexpr size_t kArenaSize = 2 * Arena::Footprint<DelaySample>(kDelayLength) +
+                                         2 * Arena::Footprint<q15least_t>(kFeedbackDelayLength);
+
     /**
      * @brief Initializes all the parameters, memory, etc.
      */
@@ -115,7 +177,7 @@ public:
      * @param output Output buffer.
      * @param size Number of sample pairs in the buffer (real size of the buffer is 2*size).
      */
-    FASTCODE void AudioLoop(q15_t *input, q15_t *output, size_t size);
+    FASTCODE_APP(fx_wizard) void AudioLoop(q15_t *input, q15_t *output, size_t size);
 
     /**
      * @brief Called each time AudioLoop isn't busy.
@@ -125,7 +187,7 @@ public:
     /**
      * @brief Called only ONCE when the app is started.
      */
-    FASTCODE void SecondCoreWorker();
+    FASTCODE_APP(fx_wizard) void SecondCoreWorker();
 
     /**
      * @brief Called when the app is first loaded - initializes the memory values.
@@ -150,6 +212,9 @@ public:
 private:
     bool inited_ = false;
 
+    // Probe of the mode's render, before the second core (see AudioProbes)
+    uint8_t probe_mode_ = Probes::kNoProbe;
+
     static constexpr Hardware::AnalogInput CV_FREE = Hardware::AnalogInput::PITCH_1;
     static constexpr Hardware::AnalogInput CV_STEP = Hardware::AnalogInput::PITCH_2;
     static constexpr Hardware::AnalogInput CV_DRYWET = Hardware::AnalogInput::PARAM_3;
@@ -174,18 +239,28 @@ private:
             .end = kMidiMinNote},
     });
     Mode mode_ = Mode::DELAY;
-    Mode mode_prev_ = Mode::DELAY;
 
     size_t trigger_blink_counter = 0;
 
+    // LED_2 meters the output (LevelMeter on the second core), from the dimmed mode color at silence
+    static constexpr uint8_t kMeterBand = 1; // 200 Hz to 1 kHz
+    static constexpr uint8_t kMeterLowBrightness = 48;
+    uint32_t meter_color_ = WS2812::NONE; // Color of the playing meter animation, NONE when stopped
+
     q15_t input_left_ = Q15_ZERO;
     q15_t input_right_ = Q15_ZERO;
     q15_t output_left_ = Q15_ZERO;
     q15_t output_right_ = Q15_ZERO;
 
-    EdgeDetector trigger_detect_ = EdgeDetector(EdgeDetector::Type::RISING);
+    InputEdges trigger_edges_ = InputEdges(Hardware::DigitalInput::TRIG_IN); // Catches the triggers shorter than a block
     size_t sample_being_processed_ = 0;
 
+    // Once per block work of the modes, spread over the block so the first frames reach the second core on time
+    using ModeControlSlots = FrameSlots<2>;
+    static constexpr size_t kPitcherEnvFrame = ModeControlSlots::Frame(0);
+    static constexpr size_t kShifterLeftFrame = ModeControlSlots::Frame(0);
+    static constexpr size_t kShifterRightFrame = ModeControlSlots::Frame(1);
+
     bool trigger_trigger_ = false;
     bool clock_trigger_ = false;
     bool mode_sh_trigger_ = false;
@@ -209,7 +284,8 @@ private:
         MODE_MOD,
         COUNT
     };
-    EnumArray<Pot, std::unique_ptr<FancyPot>> pots_;
+    FancyPotBank<Pot> pots_;
+    DerivedParameter<1> filter_param_; // DJ filter coefficients are computed in float, only when the pot changes
 
     int32_t cv_mode_ = 0;
     int32_t cv_mode_prev_ = 0;
@@ -251,6 +327,11 @@ private:
     q15_t panner_stereo_mix_ = Q15_ZERO;
     q31_t panner_stereo_left_ = Q31_ZERO;
     q31_t panner_stereo_right_ = Q31_ZERO;
+    // Both panner LFOs are rendered for the whole block at its start
+    static constexpr size_t kPannerLfoLeft = 0;
+    static constexpr size_t kPannerLfoRight = 1;
+    LfoBank<2> panner_lfos_;
+    std::array<std::array<q31_t, AUDIO_BUFFER_SIZE>, 2> panner_lfo_values_ = {};
 
     // freezer
     size_t freezer_length_left_ = 0;
@@ -281,6 +362,7 @@ private:
     q15_t pitcher_dry_wet_ = Q15_ZERO;
     q31_t pitcher_depth_ = Q31_ZERO;
     q31_t pitcher_stereo_mix_ = Q15_ZERO;
+    q31_t pitcher_right_frequency_ = Q31_ZERO;
     AdsrEnv pitcher_env_;
     q15_t pitcher_env_depth_ = Q15_ZERO;
     q15_t pitcher_depth_modulated_ = Q15_ZERO;
@@ -293,6 +375,8 @@ private:
     q31_t shifter_right_frequency_ = Q31_ZERO;
     AdsrEnv shifter_env_;
     q15_t shifter_env_mod_ = Q15_ZERO;
+    q15_t shifter_env_value_ = 1; // envelope of the block, taken at kShifterLeftFrame
+    static constexpr size_t kShifterWindow = 510;
 
     // delay
     q15_t delay_wet_ = Q15_ZERO;
@@ -328,23 +412,57 @@ private:
     uint16_t slicer_chance_ = 0;
     bool slicer_flip_bit_ = false;
 
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> feedback_delay_left_;
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> feedback_delay_right_;
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_left_;
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_right_;
-    SoftClipper feedback_clip_;
-    Svf feedback_filter_left_;
-    Svf feedback_filter_right_;
-    Svf feedback_filter_lp_left_;
-    Svf feedback_filter_lp_right_;
-    DjFilter dj_filter_left_;
-    DjFilter dj_filter_right_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> feedback_delay_left_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> feedback_delay_right_;
+    std::unique_ptr<DelayLine> delay_left_;
+    std::unique_ptr<DelayLine> delay_right_;
+    // PITCHER and SHIFTER, over the memory of delay_left_ and delay_right_, which they don't use
+    PitchShifter pitch_shifter_left_;
+    PitchShifter pitch_shifter_right_;
+#ifdef FX_WIZARD_LONG_LOOPS
+    // The pitch shifters left their 16-bit samples in the memory, the µ-law delay lines would play them as noise
+    bool delay_memory_shifted_ = false;
+#endif
+
+    // Second core (SecondCoreProcess) state, placed in SCRATCH_X (see AppFxWizard.cpp)
+    static SoftClipper feedback_clip_;
+    // Feedback low-pass then high-pass, one chain per channel
+    using FeedbackFilter = Chain<FixedSvf<Svf::Type::LOWPASS>, FixedSvf<Svf::Type::HIGHPASS>>;
+    static FeedbackFilter feedback_filter_left_;
+    static FeedbackFilter feedback_filter_right_;
+    static DjFilter dj_filter_left_;
+    static DjFilter dj_filter_right_;
+
     Oscillator lfo_left_;
     Oscillator lfo_right_;
 
     void ModeInit();
     void ModeTrigger();
-    void WorkLongDelay();
+
+    /**
+     * @brief Renders a block in one mode, everything mode specific is resolved at compile time.
+     * @param input Input buffer.
+     * @param render Buffer for the processed block (the output or the pipeline stage buffer).
+     * @param size Number of sample pairs in the buffers.
+     */
+    template <Mode kMode>
+    FASTCODE_APP(fx_wizard) void ModeBlock(const q15_t *input, q15_t *render, size_t size);
+
+    /**
+     * @brief Description of a mode: its init and its block renderer, so the mode is dispatched once per block.
+     * Modes playing back what they recorded (FREEZER, REPLAYER) make sound without input, so they never bypass.
+     */
+    struct ModeEntry
+    {
+        void (AppFxWizard::*init)();
+        void (AppFxWizard::*block)(const q15_t *input, q15_t *render, size_t size);
+        bool idle_bypass;
+    };
+
+    /**
+     * @brief All the modes, in the order of the Mode enum.
+     */
+    static const EnumArray<Mode, ModeEntry> kModes;
 
     void ModeCrusherInit();
     void ModeCrusher();
@@ -358,10 +476,18 @@ private:
     void ModeReplayer();
     void ModePitcherInit();
     void ModePitcher();
+    /**
+     * @brief Sets the PITCHER sweep of one shifter from the LFO frequency and the modulated depth.
+     */
+    void SetPitcherSweep(PitchShifter &shifter, q31_t frequency);
     void ModeSlicerInit();
     void ModeSlicer();
     void ModeShifterInit();
     void ModeShifter();
+    /**
+     * @brief Sets the SHIFTER sweep of one shifter from the LFO frequency, the envelope and the direction.
+     */
+    void SetShifterSweep(PitchShifter &shifter, q31_t frequency);
     void ModeDelayInit();
     void ModeDelay();
 
@@ -371,9 +497,93 @@ private:
     void SecondCoreProcess(size_t index);
 
     /**
-     * @brief How many samples are processed by the second core
+     * @brief Pitch of the input, tracked by the second core while the delay follows it or the tuner shows it.
+     * @details The second core writes the dry input of its frames and runs a step of the analysis
+     *          after the last frame of the block, the estimates come to the UI through pitch_queue_.
+     */
+    PitchTracker pitch_tracker_;
+    MultiCoreQueue<PitchTracker::Estimate, 4> pitch_queue_;
+    volatile bool pitch_tracking_ = false;
+    bool pitch_follow_ = false; // cc::PITCH_FOLLOW
+    bool tuner_ = false;        // cc::TUNER
+    PitchTracker::Estimate pitch_ = {};
+    absolute_time_t pitch_timeout_ = 0;
+
+    /**
+     * @brief Takes the newest estimate of the second core, forgets it after kPitchTimeoutMs.
+     */
+    void ReadPitch();
+
+    /**
+     * @brief Delay length rounded to a whole number of periods of the tracked pitch (a comb tuned to the input).
+     * @param length Delay length in samples.
+     * @return The tuned length, length itself without a pitch.
+     */
+    size_t TunedDelayLength(size_t length) const;
+
+    /**
+     * @brief Color of the tuner LED: green in tune, red flat, blue sharp, off without a pitch.
+     */
+    uint32_t TunerColor() const;
+
+    /**
+     * @brief DJ filter and its volume compensation, runs on the core chosen by dj_filter_balancer_.
+     */
+    void DjFilterStage(q15_t &left, q15_t &right);
+
+    /**
+     * @brief Moves the DJ filter stage to the less loaded core (lockstep modes only).
+     * @details The pipelined modes keep it on the second core, it processes the previous block there.
+     */
+    StageBalancer dj_filter_balancer_;
+
+    /**
+     * @brief The DJ filter runs on core 0 (end of the mode block) in the current block, set before BeginBlock.
+     */
+    bool dj_filter_on_core0_ = false;
+
+    /**
+     * @brief Wet render of the mode, the whole processing is skipped once it decayed and the input is silent.
+     * @details The tail covers the long delay, the feedback delay and the filters ringing out.
+     */
+    TailTracker wet_tail_;
+
+    /**
+     * @brief Busy cycles of the second core in the current block.
+     */
+    uint32_t second_core_cycles_ = 0;
+
+    /**
+     * @brief Worst-case busy cycles of each mode on both cores, printed with 'w' over USB serial.
      */
-    size_t second_core_processed_samples_ = 0;
+    WcetTracker<static_cast<size_t>(Mode::COUNT)> wcet_{
+        {"DELAY", "FLANGER", "FREEZER", "PANNER", "CRUSHER", "SLICER", "PITCHER", "REPLAYER", "SHIFTER"}};
+
+    /**
+     * @brief XIP cache hits and bus contention of each mode, printed with 'b' over USB serial.
+     */
+    BusCounters<static_cast<size_t>(Mode::COUNT)> bus_counters_{
+        {"DELAY", "FLANGER", "FREEZER", "PANNER", "CRUSHER", "SLICER", "PITCHER", "REPLAYER", "SHIFTER"}};
+
+    /**
+     * @brief Cycles of DjFilterStage in the current block, on whichever core it runs.
+     */
+    uint32_t dj_filter_cycles_ = 0;
+
+    /**
+     * @brief Second core runs one block behind core 0 (see SecondCorePipeline).
+     */
+    bool pipelined_ = false;
+
+    /**
+     * @brief Set by the mode init, latched by the audio loop at the start of the next block.
+     */
+    volatile bool pipelined_requested_ = false;
+
+    /**
+     * @brief Stage buffers for the pipelined mode.
+     */
+    SecondCorePipeline pipeline_;
 
     /**
      * @brief Total samples second core should process
@@ -405,9 +615,21 @@ private:
     static constexpr size_t kDryWetChangeCounterMax = 200;
     static constexpr q15_t kLowSignal = 3277; // (0.1)
 
+    /**
+     * @brief Mode change crossfade, the render is mixed with the dry input by this amount (Q15_MAX = render only)
+     * The UI fades out, switches the mode when fully faded and fades back in, the audio loop does the ramp
+     */
+    q15_t mode_fade_ = Q15_MAX;
+    int32_t mode_fade_step_ = 0;
+    const q15_t *mode_fade_dry_ = nullptr; // The block input, or its crossfade from the block left in the pipeline
+    static constexpr int32_t kModeFadeStep = Q15_MAX / kModeFadeSamples;
+
     // For the mode change you need to press it shorter than 1.5s
     static constexpr size_t kModeShortPressUnder = s2alr(1.5f);
 
+    // Pot autofreeze runs every 4th audio block
+    static constexpr size_t kPotDivisor = 4;
+
     /**
      * @brief Structure which contains rhythms and other settings loaded from file
      */
@@ -418,5 +640,11 @@ private:
      * @return true if loading was successful, false otherwise
      */
     bool LoadFile();
+
+    /**
+     * @brief Maps the mode parameters of the file in place when it has valid ones
+     * @return true if the file's mode parameters are used, false when the defaults stay
+     */
+    bool MapModeParameters(const UserDataFile &file_reader);
 };
 }
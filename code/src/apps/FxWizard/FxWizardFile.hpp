@@ -25,6 +25,8 @@ SOFTWARE.
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
+#include "common/dsp/math/math_utils.hpp"
 #include "common/dsp/utility/TriggerGenerator.hpp"
 
 namespace kastle2
@@ -35,13 +37,36 @@ namespace kastle2
  * @see https://github.com/bastl-instruments/kastle2/blob/main/code/src/apps/FxWizard/FX_WIZARD_FILE_FORMAT.md
  */
 
+// Mode parameters as stored in the file, mapped right from the flash and read by the modes in place
+typedef struct FxWizardModeParameters
+{
+    MapDef<int32_t, 5> delay_length; // TIME pot to the delay length in samples
+    uint8_t crusher_waveform;        // Oscillator::Waveform of the crusher LFOs
+    uint8_t flanger_waveform;        // Oscillator::Waveform of the flanger LFOs
+    uint8_t panner_waveform;         // Oscillator::Waveform of the panner LFOs
+    uint8_t reserved;
+    uint16_t feedback_highpass_left;  // Hz
+    uint16_t feedback_highpass_right; // Hz
+    uint16_t feedback_lowpass_left;   // Hz
+    uint16_t feedback_lowpass_right;  // Hz
+} FxWizardModeParameters;
+
+static_assert(sizeof(FxWizardModeParameters) == 52, "Mode parameters are 52 bytes in the file");
+static_assert(std::is_trivially_copyable_v<FxWizardModeParameters>, "Mode parameters are used in place");
+
+// Flags of the main header
+static constexpr uint8_t kFxWizardFlagModeParameters = 0x01; // The mode parameters follow the rhythms
+
 typedef struct FxWizardFile
 {
     char magic_string[4];
     uint32_t file_size;
     uint8_t num_rhythms;
     uint8_t sequencer_length;
+    uint8_t flags; // kFxWizardFlag...
     TriggerGenerator::Rhythm *rhythms;
+    // Points to the file in flash, or to the defaults when the file has none
+    const FxWizardModeParameters *mode_parameters;
     char end_marker[4];
 } FxWizardFile;
 
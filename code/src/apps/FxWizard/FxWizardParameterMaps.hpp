@@ -31,6 +31,8 @@ SOFTWARE.
 #include "common/dsp/math/Fraction.hpp"
 #include "common/dsp/math/math_utils.hpp"
 #include "common/dsp/math/qmath.hpp"
+#include "common/dsp/synthesis/Oscillator.hpp"
+#include "FxWizardFile.hpp"
 
 namespace kastle2
 {
@@ -41,6 +43,9 @@ static constexpr float kFeedbackFilterRightFreq = 50.f;
 static constexpr float kFeedbackFilterLpLeftFreq = 15000.f;
 static constexpr float kFeedbackFilterLpRightFreq = 15000.f;
 
+// Mode changes crossfade the wet signal to dry and back in (in seconds), each half takes this
+static constexpr size_t kModeFadeSamples = s2sr(0.01f);
+
 
 /*
     All maps are defined using MapDef from math_utils.
@@ -425,6 +430,31 @@ static constexpr auto kMapSlicerChance = MapDef<int32_t, 2>{
     {pot(0.0f), pot(1.0f)},
     {q15(0.0f), q15(0.9f)}};
 
+// --- MODE PARAMETERS ---
+// Used when the file has no mode parameters, same layout as the file (see FX_WIZARD_FILE_FORMAT.md)
+static constexpr FxWizardModeParameters kDefaultModeParameters = {
+    .delay_length = kMapDelayLength,
+    .crusher_waveform = static_cast<uint8_t>(Oscillator::Waveform::RAMP),
+    .flanger_waveform = static_cast<uint8_t>(Oscillator::Waveform::TRI),
+    .panner_waveform = static_cast<uint8_t>(Oscillator::Waveform::SINE),
+    .reserved = 0,
+    .feedback_highpass_left = static_cast<uint16_t>(kFeedbackFilterLeftFreq),
+    .feedback_highpass_right = static_cast<uint16_t>(kFeedbackFilterRightFreq),
+    .feedback_lowpass_left = static_cast<uint16_t>(kFeedbackFilterLpLeftFreq),
+    .feedback_lowpass_right = static_cast<uint16_t>(kFeedbackFilterLpRightFreq)};
+
+// Limits of the mode parameters loaded from the file
+static constexpr uint16_t kModeParametersMinFrequency = 10;
+static constexpr uint16_t kModeParametersMaxFrequency = 20000;
+
+// --- PITCH TRACKING ---
+// The estimate is dropped this long after the last one with a pitch (the second core skips a silent input)
+static constexpr uint32_t kPitchTimeoutMs = 250;
+// Estimates less sure than this don't tune the delay or the tuner
+static constexpr q15_t kPitchMinConfidence = q15(0.85f);
+// Tuner LED green within this many cents of the note, full red (flat) or blue (sharp) at 50 cents
+static constexpr int32_t kTunerInTuneCents = 5;
+
 // --- SEQUENCER
 static constexpr size_t kFxSequencerLength = 8; ///< See Sequencer.hpp for the max length
 
@@ -33,6 +33,10 @@ namespace kastle2
 namespace cc
 {
 
+// Own inline namespace, so the CCs of the apps can be included together (the multi-app image)
+inline namespace fx_wizard
+{
+
 static constexpr uint8_t MODE = 1;          // mapped across x number of values (0-127 mapped to 1-6 etc)
 static constexpr uint8_t TIME = 14;         // top right knob
 static constexpr uint8_t TIME_MOD = 15;     // top left knob
@@ -43,8 +47,11 @@ static constexpr uint8_t AMOUNT_MOD = 19;   // shift + center knob
 static constexpr uint8_t FILTER = 20;       // shift + mid right knob
 static constexpr uint8_t STEREO = 21;       // shift + mid left knob
 static constexpr uint8_t MODE_MOD = 26;     // mode + center knob
+static constexpr uint8_t PITCH_FOLLOW = 27; // 64-127: DELAY times in whole periods of the input pitch
+static constexpr uint8_t TUNER = 28;        // 64-127: top LED shows the tuning of the input pitch
 
 static constexpr uint8_t OUT_MODE = 1; // FX mode output
 
+}
 }
 }
\ No newline at end of file
@@ -13,13 +13,14 @@
 
 /*
  * Samples made using TTS Maker (voice 178 - Chloe) and sped up by 1.05x
- * Sample rate is 11025 Hz.
+ * Sample rate is 11025 Hz, stored as IMA-ADPCM (encoded at compile time).
  */
 
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
+#include "common/dsp/sampling/AdpcmEncoder.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 
 namespace kastle2
@@ -29,11 +30,13 @@ namespace version
 {
 
 static constexpr size_t fx_wizard_length = 11777;
-const int16_t fx_wizard_data[fx_wizard_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 2, -1, 2, -2, 2, -1, 1, -1, 2, -2, 2, -1, 3, -1, 2, -2, 3, -1, 1, -3, 2, -1, 1, -4, 2, -2, 0, -4, 1, -3, 0, -3, 5, 0, 4, -1, 4, 1, 2, -3, 0, -7, 2, -3, 0, -3, 3, 1, 2, -6, 5, 2, 3, -3, -1, -4, -1, -5, 5, -8, -4, -3, -2, -6, -2, -8, 1, -3, 0, -13, -9, -1, 9, 6, 13, 0, 4, 8, 11, 2, -2, -8, 5, -1, 2, -6, 3, 12, 14, 4, 2, -11, 4, 9, 8, -6, -1, 1, 4, 2, 14, 1, -2, 3, 12, -7, -11, -10, 7, 0, -5, -13, 1, 5, 14, 4, 8, 9, 11, 2, 1, -9, 0, -15, -12, -12, -15, -16, -10, -6, 2, -8, 3, 9, 19, 3, -7, -13, 7, 9, -4, -26, -17, 1, 4, -24, -8, 6, 3, -3, 5, -15, -17, -6, 22, 4, -22, -19, -12, 6, 37, 7, 5, 0, 11, 12, -17, -27, -9, 4, 23, -10, -1, 24, 34, 53, 58, 7, -1, 3, 18, 13, 2, 4, 3, -2, 19, -25, -18, 10, -5, -15, -11, -22, -12, -18, 20, 11, -22, -6, 12, 6, 11, -14, 19, 10, -29, -34, -37, -32, -7, -19, 3, 1, 38, 65, 27, 6, 15, 5, -8, -28, -11, -29, -43, -29, 18, -13, -57, -37, -3, -2, -29, -49, -1, 29, 57, -5, -54, -13, 3, -17, 19, 24, 9, 0, 26, 44, 14, 3, 8, -23, 16, -20, -34, 14, 65, 107, 72, 19, 11, 43, 82, 1, 9, 37, -26, -94, -45, 7, -44, -50, 15, -10, -15, 13, 28, 33, 47, 17, -23, -64, -41, -41, -3, 49, 15, 9, 14, -30, 1, -14, -40, -68, -69, -41, 6, 31, 59, 46, 90, 122, 16, -17, -26, -96, -52, -93, -87, -117, -120, 33, 8, -71, 27, 62, 72, 14, 39, 107, -72, -110, 108, 53, 9, -43, -30, 30, -19, 83, 52, 28, 105, -87, -144, -18, 61, 39, 39, 36, 120, 172, 80, 112, 191, 264, 74, -129, -124, -148, -177, -23, -55, -152, -3, -194, -235, 168, 342, 13, 29, 268, 138, -309, -111, 162, 190, -68, -564, -352, -115, -53, 20, 25, 72, -107, 13, 166, 170, 159, 169, 123, -24, 155, 21, 11, 112, 101, 305, 374, 390, -19, -393, -139, -20, -188, -251, -124, 177, 335, 511, 477, 275, 261, 411, 231, 727, 607, 1161, 2958, 1265, -944, -412, 7, -495, -1404, -1064, -324, -1154, -401, 358, -234, 41, -490, -317, -266, -1289, -719, -383, -242, 96, -368, 470, 981, 954, 2034, 966, -370, -512, -582, 494, 855, 1019, 663, 668, 1516, 1674, 1495, 655, 656, 1706, 1391, 526, -548, -964, 233, 688, -478, -5210, -10643, -16623, -13883, 2900, 8719, 4364, 2359, 3137, 5651, 3030, 846, -4314, -12745, -10179, -1509, 2438, 3713, 3215, 3742, 5463, 3322, 2395, -832, -4497, -1795, 1189, 2638, 1929, 1435, 2319, 3541, 4918, 2719, 135, 757, 1657, 1820, 1859, 1432, -737, -5256, -10315, -13540, -15024, -11535, 1198, 10045, 7871, 4331, 3476, 4599, 2356, -2233, -5613, -9737, -8970, -1847, 5107, 8269, 6846, 5098, 5786, 5091, 2711, -2198, -5646, -3781, -1749, 2230, 5191, 4234, 4252, 3979, 3975, 2058, -1964, -2508, -1968, -876, -471, -5444, -12037, -17306, -16036, -605, 12323, 8695, 3249, 2042, 2355, 2697, 1573, -2310, -9492, -9804, -2338, 3630, 7296, 9020, 6626, 4027, 4479, 3290, -207, -3909, -3643, -341, 1390, 4132, 4949, 3810, 3550, 2644, 158, -2910, -3727, -4327, -3752, -4432, -8431, -12452, -10491, 2597, 10265, 6717, 2719, -885, -429, 1037, 957, -2364, -8736, -8249, -3052, 2284, 7340, 9015, 6628, 3472, 2828, 2762, 1009, -1040, -2108, -2467, 51, 4711, 6362, 4779, 2977, 1602, 151, -2742, -3820, -4687, -9567, -9917, -9435, -11353, -433, 11182, 10207, 7213, 1780, -2530, -2331, -2835, -5394, -8491, -7958, -3465, 4216, 9457, 9180, 8267, 5788, 2509, 1124, -1773, -3231, -428, 1619, 3720, 6459, 6326, 4089, 1269, -1149, -1170, -1132, -4348, -9172, -12282, -11277, -13227, -7764, 10058, 14207, 7082, 3280, 1109, -663, -3078, -5106, -7927, -10383, -5681, 2344, 8185, 12695, 10337, 4888, 2104, 919, 1552, -693, -2161, -95, 1709, 4475, 6516, 5552, 1700, -581, -1252, -4328, -6469, -8557, -10286, -12031, -17613, -6812, 11862, 13055, 10772, 5029, 292, 142, -4725, -6737, -12180, -13972, -3062, 6132, 10751, 12233, 10225, 6902, 4629, 3847, -248, -5121, -2510, 3339, 5794, 6501, 4520, 641, -202, -1631, -3184, -3791, -8364, -12988, -16895, -16043, -2012, 12191, 11991, 5469, 1674, 1292, 1377, 599, -4856, -13581, -13406, -3534, 6660, 10509, 8472, 7231, 7295, 6248, 4140, 867, -1329, -1730, 1128, 4405, 5584, 4852, 1883, -819, -2115, -3720, -8361, -11896, -12021, -16286, -13023, 4362, 14509, 13401, 6771, 1491, -3, -1573, -3680, -8669, -12798, -9759, -1557, 8998, 14399, 10887, 6818, 5416, 4675, 2231, -1547, -3461, -2826, 518, 4185, 6834, 5485, 777, -1618, -3836, -6370, -10039, -14687, -16633, -12355, 84, 12268, 15984, 10491, 3271, -1392, -1619, -3326, -9997, -13241, -9973, -1972, 9335, 15214, 12404, 6962, 1976, 1934, 3115, 704, 384, 315, 910, 4481, 6110, 4989, -165, -5802, -9666, -10505, -10034, -13651, -12979, -2969, 7377, 12991, 13674, 9023, 19, -4930, -3881, -6449, -10676, -11076, -5012, 3408, 9182, 12789, 11104, 4871, 636, -315, 428, 1065, -194, 1311, 4785, 6336, 5393, 1424, -2713, -7809, -13274, -16971, -17767, -10506, 1876, 11691, 15221, 12556, 7503, 2934, 577, -3609, -10356, -13242, -10567, -4939, 2697, 10713, 13031, 8064, 3710, 3265, 673, -2336, -2161, 569, 4253, 4437, 4365, 4106, 1527, -2709, -8838, -14633, -19354, -18773, -5747, 7747, 12886, 12790, 10943, 8546, 3230, -1965, -7899, -13398, -12337, -5739, 1840, 7307, 10430, 10078, 6318, 3266, 2586, 313, -2864, -3138, 703, 4609, 5109, 4470, 1393, -2831, -6605, -11957, -15204, -15609, -9894, -68, 8472, 14559, 13937, 9954, 4051, -2213, -7278, -11454, -11340, -7253, -1319, 6238, 10542, 11428, 9004, 4868, 1081, -2989, -3425, -516, 1066, 3645, 3784, 3124, 1734, -1136, -5971, -12042, -17324, -18023, -8521, 1882, 8800, 12979, 11892, 9699, 5201, -1066, -6578, -11560, -11593, -6144, 669, 7324, 9931, 10017, 8767, 4518, 195, -1680, -1853, -1567, 119, 2064, 5111, 5274, 1294, -3795, -10107, -14939, -15468, -11088, -3207, 2662, 6906, 10090, 10913, 8506, 3536, -2258, -7894, -11129, -8894, -2334, 3018, 6997, 9607, 9001, 6482, 2959, 929, -1081, -3056, -1512, 2190, 4422, 4775, 3426, -1687, -8955, -14264, -14921, -11832, -4953, 1476, 5896, 9293, 10013, 9153, 5120, -1918, -8776, -11168, -8189, -3553, 1686, 6692, 8840, 9193, 8022, 5291, 1697, -2103, -2975, -977, 940, 3728, 5060, 3534, -1880, -9332, -13783, -14275, -11683, -3980, 2365, 5844, 6781, 9307, 9680, 5278, -479, -7887, -11970, -9176, -4104, 3090, 7613, 8208, 7513, 5668, 4233, 2415, -236, -1543, -1405, 1612, 4314, 4996, 2310, -5174, -11397, -12757, -12321, -8148, -2276, 2306, 6065, 7349, 9382, 9265, 3651, -4144, -8887, -9754, -6704, -2228, 2658, 6637, 7985, 7281, 5731, 2928, 849, -535, -151, 1063, 2478, 4197, 3340, -754, -7983, -13150, -13583, -11542, -3869, 2199, 5983, 7096, 7464, 9098, 5530, -1214, -6616, -9889, -7825, -3722, 1122, 5306, 6632, 7200, 6316, 4313, 1845, -601, -1170, -336, 2001, 3699, 3198, 333, -6465, -11852, -12799, -10769, -4642, 1596, 5408, 6480, 6922, 8050, 6289, 1016, -5238, -9135, -8821, -4726, 471, 4926, 6909, 7775, 6983, 4951, 2197, -523, -1601, -970, 1264, 3030, 2571, -1167, -8727, -12803, -11667, -9307, -3035, 2185, 5384, 6087, 7048, 8557, 4757, -695, -5959, -8577, -6367, -2100, 2355, 5594, 6055, 6796, 5845, 3808, 1566, 32, -973, -930, 1435, 3122, 1925, -3514, -10898, -12996, -11808, -7837, -558, 3286, 5361, 7015, 6958, 8361, 4047, -792, -6093, -7197, -5157, -1570, 2118, 4560, 6204, 6378, 5427, 4087, 1531, -206, -1265, -911, 1161, 902, -852, -5178, -10724, -10301, -7332, -3926, 62, 2847, 4252, 5237, 5336, 5067, 2295, -1906, -4534, -3721, -1837, -173, 3505, 5034, 5676, 4725, 3224, 2551, 870, -559, -251, -552, -1100, -2060, -5839, -8482, -9239, -7607, -3511, 776, 3124, 3788, 4847, 4821, 4185, 1923, -1128, -3240, -2852, -1831, 99, 3098, 4891, 6132, 4920, 3506, 2995, 1258, -294, -1260, -2563, -3320, -4132, -7129, -8416, -7642, -5497, -1202, 2720, 3929, 4526, 3993, 4017, 3070, 119, -2502, -3371, -2262, -84, 2290, 4438, 5660, 5662, 4729, 3336, 2013, 280, -878, -2345, -4157, -4453, -6045, -7629, -7695, -5263, -2200, 442, 2873, 3776, 4078, 3493, 3639, 2159, -469, -2173, -2013, -1250, -160, 2535, 4143, 5406, 5367, 4152, 3688, 1591, -239, -1622, -3953, -6272, -8110, -7502, -6794, -5972, -2442, 2372, 4351, 4808, 4397, 3386, 2366, 471, -1243, -1636, -2496, -2171, 610, 2781, 4754, 5510, 4723, 4701, 3235, 1302, 18, -1874, -3256, -5176, -6397, -6751, -6911, -5179, -3536, 286, 2970, 4495, 4741, 3505, 2737, 1339, -170, -944, -2533, -2309, -757, 1486, 3876, 4877, 5119, 3919, 2780, 2149, 1044, -1062, -3553, -4560, -6226, -7148, -6661, -6037, -3220, 488, 2470, 4505, 4706, 4204, 3046, 1345, 379, -1125, -2205, -2123, -578, 2040, 3044, 4124, 4459, 3509, 3124, 1543, 205, -1902, -3556, -4039, -5157, -7292, -6425, -5650, -4098, -762, 1866, 4739, 5002, 4254, 4530, 3088, 1384, -483, -1131, -1361, -1820, 200, 2601, 3896, 4102, 3848, 3607, 2243, 540, -1204, -3180, -4760, -5642, -6314, -6469, -5800, -5233, -2783, 596, 3607, 4991, 5598, 4766, 4204, 2902, 1390, -12, -1672, -1551, -1083, 496, 2510, 3172, 3870, 3898, 3246, 947, -1411, -3120, -5118, -5571, -5876, -6209, -6181, -5883, -2798, -95, 2367, 4184, 4687, 4760, 4535, 3624, 2843, 1750, -345, -1392, -1079, 290, 2002, 2843, 3217, 3674, 3013, 1517, -661, -2403, -3615, -5034, -5974, -5849, -6520, -6619, -4704, -1376, 1812, 3629, 4778, 5093, 5055, 4447, 3409, 1904, -154, -1537, -1284, 159, 1039, 1748, 2827, 2618, 2706, 1328, 346, -1334, -3391, -3798, -4129, -4472, -4743, -5542, -4468, -2577, -542, 1762, 3170, 3407, 3568, 4168, 3486, 2423, 702, -105, -367, -175, 27, 863, 1399, 2043, 2522, 1736, 569, -672, -1929, -2289, -2631, -3070, -3043, -3663, -3476, -2304, -1774, -350, 1039, 1790, 2396, 2295, 2186, 1734, 893, 583, -66, 148, 554, 848, 1568, 1529, 1820, 1349, 499, -394, -1388, -1805, -1884, -1681, -1433, -1597, -2129, -1971, -1549, -1242, -308, 317, 753, 1272, 1371, 1429, 1315, 1066, 1062, 560, 15, 290, 510, 392, 572, 637, 855, 509, -40, -159, -199, -661, -828, -931, -1504, -1482, -1414, -879, -123, -148, 100, 158, 42, 258, 826, 814, 464, 13, 250, 619, 568, 518, 131, 197, 224, -76, -274, -562, -428, 149, 374, 355, 185, -341, -518, -579, -657, -674, -716, -844, -265, 20, 190, 505, -26, -17, 430, 255, 443, 573, 159, 425, 487, 366, 207, -275, -256, -317, -678, -414, -182, -105, -132, -329, -288, -67, -488, -670, -565, -770, -401, -473, -488, -416, -402, -213, -117, -155, 149, -117, -396, -292, -398, -596, -177, -241, 206, 427, 429, 564, 294, 258, -63, -207, -549, -348, -35, 471, 296, 265, -19, -143, 83, 30, 55, -63, 31, 189, 43, 129, -182, -163, -116, -237, -132, -110, 147, 422, 193, 109, -57, -256, -175, -342, -584, -593, -494, -208, 351, 143, 2, 161, 58, -36, -42, -92, 67, 180, 21, 106, 400, 640, 892, 775, 601, 636, 384, -56, -278, -478, -443, -407, -273, -221, 79, -53, -17, -109, -203, -351, -51, 58, 385, 637, 474, 462, 52, 226, 62, 248, 182, 232, 363, 360, 543, 435, 24, 27, -81, -343, -427, -464, -314, -83, -93, -35, 259, 404, 442, 467, 390, 204, 257, 173, 305, 377, 357, 179, 272, 344, 303, 208, 245, 273, 128, -22, -68, -87, -234, -353, -337, -271, -277, 114, 193, 387, 667, 746, 953, 812, 539, 382, 306, 77, -185, -265, -32, 65, 265, 190, 307, 470, 183, 96, -54, -153, -204, -258, -304, -2, -96, -156, 151, 133, 241, 276, 136, 146, 17, 16, 61, 172, 107, 243, 142, 210, 63, 99, 56, 94, 56, -68, 75, 5, -36, -219, -72, -122, 8, -104, 5, 118, -5, -40, 14, 66, -20, -140, -94, -60, -119, -79, -201, -131, -69, -28, -150, -52, -181, -164, -121, 27, -131, 39, -103, -138, 304, 100, 286, 25, 308, 241, 312, 16, -80, 82, -24, -101, -31, -20, 29, -101, -281, -304, -386, -604, -213, -414, -193, -327, 29, 316, 375, 265, 277, 129, 71, 181, 174, 135, -14, 151, -63, 175, 25, -71, -390, -5, -164, -136, -319, -270, -325, -339, -371, -387, -273, -258, -206, 181, 203, 122, -20, 94, -7, 155, 267, 337, 73, 232, 339, 187, 314, 126, -330, -99, -122, -335, -201, -433, -203, -306, -98, -295, -169, -230, -90, -152, -154, -46, -184, -80, 7, 48, 26, 202, 407, 432, 275, -52, 135, -161, -85, -94, 31, -5, -70, 80, -256, -309, -472, -276, -101, -354, -131, -419, -387, -276, -54, 191, 184, 293, 275, 245, 270, 343, 182, 136, 21, -53, 61, -76, -47, -24, 88, -143, -294, -79, -140, -112, -295, -101, -174, -251, -445, -304, -323, -156, 9, 116, 208, 336, 409, 294, 421, 238, -3, -235, -177, -110, 12, -12, 198, 141, 85, 240, -17, 156, -256, -363, -181, -443, -266, -229, -199, -61, 212, 154, 239, 2, 169, 94, -14, 36, 28, 251, 13, 83, 144, 96, 100, 36, -16, -258, 24, 183, 53, 109, -145, -169, 48, -270, -174, -351, -182, -84, -27, 15, 191, 56, 367, 148, -128, 220, 95, 11, -184, 38, 53, 213, 187, -229, -120, -262, 113, 182, 129, -37, 28, 264, -26, -120, 144, -192, -205, 133, -192, 263, 85, 38, 319, -175, 88, -208, -330, -295, -408, -158, 66, 5, 213, -116, 142, 94, 9, -23, -79, -152, 23, 212, -98, 130, 365, 114, 40, 12, 31, 93, -79, -87, -369, 112, 39, 45, 41, -341, 7, 131, 165, 144, 178, -82, 65, -109, 168, 42, -415, -151, 61, 209, -54, -22, -74, 171, 294, 104, -15, -84, 83, -93, 110, 57, -72, 49, 43, 128, 108, 131, 85, -142, -62, 18, -240, -10, -136, -291, -67, -77, -70, -1, -141, 117, 360, 182, 255, 83, 245, 358, 33, -67, -122, 180, -78, -9, 77, -41, -95, -92, 186, 129, -108, -154, -368, 15, -11, -328, -133, -243, 177, -211, -52, -184, 7, 23, 45, 48, 523, 386, 128, 112, 26, 79, 394, 82, -86, -61, 73, 232, 58, -28, -76, 71, -17, 30, -278, -337, 42, -170, -220, -423, -127, -301, -330, 55, 96, 284, 206, 221, 537, 583, 163, 154, 160, -181, 346, 265, -52, -205, 67, 104, -145, -213, -111, -240, -125, -65, 183, -109, -245, 266, 84, -356, 46, -212, -250, 437, 129, 168, -302, 173, 24, -78, 202, 21, -148, -8, 88, 360, 112, 138, 50, 60, 144, 30, -160, 173, 74, 102, 237, -25, -323, 248, -97, 10, -230, -40, 78, -171, -79, -161, -72, -48, -108, 132, 226, -151, 207, 429, 190, 61, -148, 361, 77, 33, -255, -211, 131, 69, 68, -308, -208, -411, -26, -619, -8, -268, 138, 58, -128, -131, -204, -108, 65, -21, 45, -131, 94, 109, 245, 490, 256, 189, -1, 169, 124, -87, -188, -80, -139, -623, -69, 440, 159, -205, -344, -361, -159, 819, 533, -46, -801, -200, 808, 1027, 201, -798, -257, 724, 326, -274, -580, -446, -75, 441, -88, 177, -347, -254, -666, 249, 313, -377, -670, -460, 222, 2, 157, -70, 23, -230, -205, -405, -88, 406, -168, -458, -215, -501, 288, 133, 475, -502, 120, 228, 426, 334, 3, -33, -28, 66, -66, -175, -532, -165, -44, -138, -16, -49, -196, 170, 20, -199, -383, 157, -172, -181, 18, 14, -81, 167, 30, 256, 19, -427, -194, -158, -287, -25, -129, -603, -486, 282, -379, -529, -472, 70, 461, -158, 410, 74, 18, 303, 240, 274, 112, 246, 66, 421, 556, 468, 222, 70, -36, 117, 87, -429, -216, -358, -480, -375, -439, -433, -737, -107, -160, -238, -314, -208, 64, 156, 317, 114, 235, 538, 343, 33, 866, 707, 672, 551, 479, 662, 884, 1043, 214, 43, 203, -34, 64, -682, -1327, -1635, -1406, -1601, -2057, -2079, -2190, -1562, -1319, -895, -736, -543, 158, 1315, 1567, 2229, 1842, 2118, 2633, 2725, 2845, 1626, 1885, 1168, 1206, 1638, 809, -487, -521, -1276, -1505, -2468, -3167, -4010, -5196, -6173, -6500, -4680, -3125, -2502, -975, 1059, 2461, 4458, 5510, 6491, 5438, 3534, 2303, 1982, 1675, 1307, 438, 582, 383, 2338, 3090, 3423, 2351, 656, -521, -1387, -2958, -4406, -6714, -8792, -8980, -6766, -3560, -2348, -424, 1572, 4572, 6623, 7271, 7670, 6599, 3665, 1080, 734, 794, 214, -1232, -1239, 852, 2257, 3907, 4794, 4000, 2615, 1952, 1205, -263, -3009, -6014, -8062, -8576, -10844, -10659, -6648, -3109, -705, 1218, 4163, 7766, 8466, 7590, 6693, 4524, 1736, -1642, -1820, -1126, -2249, -2608, -1093, 1801, 4858, 5857, 6168, 5660, 3855, 2318, 1856, -798, -4833, -8543, -10444, -10765, -11936, -12832, -7497, -1504, 1836, 3415, 5929, 10863, 11354, 8966, 7318, 3878, -538, -3876, -4749, -3735, -3599, -4450, -2577, 1974, 5515, 7414, 7652, 6817, 5951, 3498, 1447, -815, -5340, -8623, -10236, -11949, -12715, -14226, -9462, -1290, 1727, 5201, 6230, 9699, 12700, 10500, 8365, 3373, -704, -5166, -7344, -5593, -5154, -4515, -3340, -380, 5112, 8906, 11143, 8883, 6013, 5685, 3124, 767, -3949, -9273, -10632, -11858, -12572, -14146, -14589, -4819, 2769, 4115, 6433, 8941, 13648, 12751, 8079, 5548, 276, -4955, -8015, -7180, -5215, -5760, -4643, -289, 4826, 8627, 10445, 11074, 8975, 6040, 4832, 2011, -1194, -6533, -10540, -11697, -12214, -12234, -14954, -14188, -2596, 4891, 6340, 6727, 7449, 13614, 12817, 8118, 4637, -2568, -7105, -8345, -5818, -3863, -5607, -4149, 672, 7135, 12287, 11939, 9786, 7590, 5201, 4157, 929, -3187, -7855, -10634, -10864, -11481, -11529, -14087, -13124, -2368, 5824, 7874, 5872, 5514, 11234, 12317, 8244, 2708, -4079, -7864, -8365, -4396, -3004, -4816, -3055, 2059, 8739, 12491, 11768, 8546, 5487, 4768, 3939, 807, -3212, -7617, -9441, -8328, -7379, -9699, -12098, -13440, -6724, 5609, 7780, 4877, 3254, 6325, 10881, 9314, 4825, -2297, -8198, -8646, -5298, -2230, -3780, -4378, -4, 6412, 11247, 11766, 9924, 6241, 2974, 4393, 3641, -1492, -6054, -7396, -6158, -5643, -6323, -8448, -11038, -11053, -4646, 5270, 6836, 2791, 1790, 5879, 10063, 8221, 3333, -3221, -8332, -7792, -4894, -2103, -3581, -3828, 1305, 6397, 10916, 11569, 8650, 5510, 3083, 3997, 3524, -2032, -5808, -5442, -4292, -4271, -5080, -6178, -9146, -10875, -7689, 905, 6517, 3393, 948, 3403, 8094, 8628, 4986, 279, -5768, -8088, -5571, -1828, -1834, -4569, -2267, 3522, 8574, 11320, 8523, 5997, 3402, 2682, 4963, 1995, -2936, -5184, -4631, -2500, -2635, -4423, -7547, -10305, -11203, -5994, 4497, 5824, 1392, 850, 4626, 9710, 8020, 3378, -2685, -8363, -7781, -3753, -1332, -3504, -4967, 564, 6804, 10099, 10293, 7484, 4633, 2728, 3955, 3239, -1085, -4773, -5010, -2723, -2343, -2967, -5754, -8979, -10093, -8759, 928, 6598, 2449, 528, 2214, 7725, 8588, 4547, -266, -6168, -7928, -5695, -1928, -1567, -4562, -1744, 4936, 8759, 9674, 7705, 5331, 2963, 2068, 3126, 625, -3124, -4033, -2293, -1005, -1299, -3682, -6841, -8537, -10233, -6274, 3577, 4273, 301, 301, 4946, 9825, 7434, 2151, -3129, -6419, -6599, -4565, -2719, -4199, -4299, 1335, 7450, 9968, 8811, 6407, 4538, 2678, 2982, 1808, -2270, -4566, -3542, -2166, -1237, -1725, -4818, -7001, -8472, -9212, -1326, 5742, 3125, -81, 621, 7164, 9524, 4776, -426, -5259, -6089, -5353, -3136, -2008, -3997, -2033, 4380, 9295, 9695, 6362, 5259, 3637, 2129, 2804, -89, -3565, -4524, -3278, -651, -1022, -3434, -5315, -7194, -9040, -8654, 709, 5595, 1444, -32, 3117, 9493, 8165, 2653, -1139, -5003, -5905, -5502, -3498, -2783, -3673, 225, 6539, 9343, 8593, 6825, 5301, 3106, 2173, 1521, -1370, -4342, -4176, -2341, -1525, -2249, -3664, -5372, -7684, -9838, -5734, 3751, 4446, 1071, 177, 4957, 9438, 6241, 2154, -3108, -5757, -5810, -4735, -1990, -3303, -2681, 2292, 7408, 10034, 8195, 6033, 4369, 2434, 1729, 304, -2383, -3528, -3201, -1556, -1199, -2345, -3682, -6461, -8016, -9444, -3521, 4138, 2551, 604, 589, 6314, 8825, 4366, 138, -4606, -5708, -5064, -3363, -1665, -3293, -814, 4934, 9547, 9884, 7053, 4892, 3392, 2133, 970, -793, -3297, -3951, -2948, -1206, -1095, -2276, -4934, -7035, -8980, -8318, 367, 3705, 1224, -755, 2138, 8722, 7266, 2966, -1401, -4288, -4693, -5302, -2292, -2053, -3552, 564, 5671, 9662, 8216, 5746, 5085, 4205, 3176, 827, -1982, -3221, -3809, -2001, -573, -1335, -2742, -6050, -7442, -9109, -5446, 2262, 1137, -1148, -582, 5511, 9564, 5727, 1802, -1850, -3405, -4520, -3489, -1508, -3766, -3651, 1691, 6599, 8023, 5993, 4914, 4924, 4606, 3042, 592, -1535, -2946, -1835, -823, -1037, -2765, -4932, -6535, -8188, -9609, -3377, 1660, 438, -513, 1718, 8539, 8892, 4543, 309, -1763, -2921, -4021, -2970, -3081, -4211, -1778, 3368, 6567, 6498, 4634, 4658, 5236, 4756, 2499, -433, -2282, -1609, -608, -397, -1713, -3677, -5342, -7075, -9838, -9585, -2081, 513, -438, -524, 4224, 10218, 8158, 4404, 1155, -669, -3176, -3932, -2997, -4198, -4766, -1403, 3435, 6087, 5089, 5112, 6251, 5746, 4422, 1711, -102, -1403, -1150, -574, -704, -2352, -4307, -6140, -7923, -10567, -7029, -784, -584, -953, 419, 7202, 10053, 6604, 3257, 729, -1157, -2901, -2829, -3665, -5419, -4575, -12, 4068, 4559, 3775, 4804, 5872, 5537, 3892, 1732, -181, -348, 527, 820, -682, -2831, -4521, -6551, -9554, -11220, -5864, -1687, -1354, -1288, 1614, 9148, 9905, 6869, 3438, 289, -772, -2717, -2500, -4541, -5906, -3380, 342, 4024, 3893, 3502, 4790, 5537, 5970, 3147, 533, -347, -134, 1042, 145, -1004, -2179, -4160, -6523, -10448, -9677, -4187, -1217, -964, -1837, 2770, 8866, 9239, 5875, 1873, 347, -977, -2331, -3294, -5167, -4918, -2825, 1097, 3453, 3706, 4750, 5622, 7048, 5147, 2798, 876, 455, 368, -374, -1027, -1638, -2307, -4559, -7868, -11127, -9237, -3354, -1073, -1925, -2532, 3334, 10281, 9738, 5227, 1399, 1076, 518, -1951, -3436, -5603, -5049, -2851, 220, 2422, 2546, 4043, 5189, 6282, 5635, 3690, 2233, 1187, 1155, 857, -14, -979, -2987, -4985, -8091, -11477, -8669, -4157, -2132, -3523, -2543, 4943, 9397, 7974, 4121, 2521, 2457, 684, -1635, -2956, -4411, -4458, -3067, -253, 1561, 2348, 4167, 5222, 5396, 4523, 3821, 3398, 2155, 1658, 1025, 406, -735, -3052, -4630, -8134, -11079, -8455, -5558, -3275, -4657, -2316, 4329, 7410, 7895, 4564, 3776, 3487, 1762, 45, -2835, -3980, -4698, -2976, -568, -200, 1188, 2509, 4533, 4730, 4268, 4283, 3476, 3180, 2660, 1826, 1295, -550, -2023, -4394, -7597, -10426, -9435, -6580, -4541, -5083, -3034, 2271, 5893, 6931, 4560, 4728, 4723, 3626, 1419, -992, -1767, -2445, -1638, -1222, -793, -52, 597, 2284, 2882, 3064, 3091, 3285, 3629, 2992, 2794, 2929, 1612, -858, -4246, -7000, -9176, -8640, -7231, -6501, -6759, -4739, 47, 3724, 4542, 2822, 3721, 5187, 5476, 3708, 1413, 1129, 852, 820, 9, -225, -393, -662, 507, 792, 1491, 1771, 2238, 2314, 2168, 2797, 3014, 1849, -403, -2483, -3994, -5611, -6592, -6125, -5726, -5526, -5391, -2841, -107, 1009, 581, 1162, 3151, 4088, 3808, 2540, 2946, 2897, 2414, 1819, 1645, 1154, 247, 469, 549, 602, 190, 247, 872, 1072, 903, 688, 814, 389, -427, -1327, -2279, -2959, -3573, -3595, -3139, -3238, -3234, -2740, -1419, -527, -856, -649, 210, 1371, 1464, 1307, 1509, 1977, 2388, 1974, 1982, 1855, 2020, 1577, 1331, 1345, 848, 807, 394, 184, 208, 342, 426, 201, -194, -233, -277, -441, -912, -1008, -977, -1078, -1098, -1227, -1217, -1356, -1366, -1323, -1142, -989, -743, -596, -293, -135, 273, 544, 588, 694, 684, 1148, 992, 924, 791, 648, 707, 562, 891, 691, 253, -2, 293, 778, 741, 317, 182, 283, 354, 183, -320, -548, -527, -619, -543, -441, -337, -463, -540, -314, -106, -63, -195, -256, -244, -382, -377, -369, -379, -440, -590, -401, -417, -536, -442, -260, 144, 236, 280, 367, 378, 273, 276, 233, 167, -115, -268, -45, 64, 100, -64, 75, 152, 366, 481, 389, 390, 179, 274, 269, 238, 137, 0, -228, -180, -301, -181, -386, -661, -607, -781, -489, -479, -329, -213, -185, -89, -173, -181, -172, -157, -172, -243, -86, -23, -40, 69, -48, 186, 77, 167, 172, 202, 314, 240, 265, 113, 340, 278, 360, 434, 358, 235, -14, 6, 127, -26, -298, -520, -434, -203, -184, -267, -313, -221, -127, -141, -196, -269, -287, -348, -39, -90, -159, -187, -75, 160, 77, 66, 82, 135, 194, 292, 313, 525, 450, 436, 346, 333, 274, 81, -135, -284, -188, 8, -119, -83, -129, -47, 57, 28, 157, -33, -173, -232, -178, -111, -238, -317, -310, -216, -132, 13, 55, 42, 36, 189, 408, 469, 266, 282, 337, 341, 271, 173, 52, -126, -304, -296, -335, -256, -189, -134, -132, -24, 192, 198, 85, -23, 34, 90, 82, 61, 88, 3, -71, -111, -92, -110, -193, -142, -84, -45, 11, 95, 246, 239, 197, 67, 188, 120, 80, -132, -270, -212, -206, -130, -131, -154, -138, -137, -61, 69, 87, 102, 32, 180, 229, 209, 70, -20, -20, -132, -135, -141, -107, -68, -92, -30, 65, 101, 116, 50, 65, 70, 54, -37, -171, -214, -277, -293, -327, -287, -231, -130, -49, 14, 95, 198, 250, 241, 212, 137, 4, -63, -66, -120, -203, -277, -254, -125, -19, -4, 37, 97, 175, 225, 215, 164, 60, -115, -230, -249, -317, -371, -469, -410, -301, -99, 33, 98, 140, 150, 169, 130, 102, 42, -77, -149, -179, -182, -178, -196, -181, -121, 20, 166, 227, 276, 304, 337, 276, 192, 56, -20, -174, -199, -284, -320, -386, -336, -276, -88, -20, 144, 298, 33, -64, -185, 236, 222, 16, -269, -311, -110, -137, -145, -202, -114, -32, 95, 317, 377, 483, 349, 384, 275, 276, 163, -14, -200, -349, -329, -271, -282, -139, -63, 31, 155, 183, 329, 236, 164, 136, 84, 77, -146, -156, -194, -178, -204, -169, -41, 61, 24, 175, 132, 278, 228, 363, 281, 177, -125, 306, -331, -806, -554, 244, 440, -19, -582, -338, 319, 679, 601, 48, -99, -39, 126, 117, 50, -81, -91, 15, 214, 78, 140, -5, 250, 304, 229, 223, 212, 157, 79, 79, 177, 148, 38, -256, -337, -509, -37, 675, 731, -73, -763, -55, 468, 709, -87, -558, -363, 223, 230, -118, -328, -119, 232, 356, 472, -196, -279, -250, 434, 901, 857, -313, 92, -125, 624, -194, -508, -635, -269, 29, 121, -502, -651, -84, 694, 444, 26, -290, -341, 334, 92, -41, -348, -437, -159, -182, -128, -346, -394, 56, -107, 333, 117, 238, 634, 498, 399, -407, 112, -92, -213, -437, -726, -324, -315, 236, -122, 80, 469, 524, 242, -2, 64, 271, 10, 465, -187, 26, -576, -331, 51, -184, -183, -58, 6, -75, 254, -137, 102, -245, 48, -609, 565, -245, 416, -693, -552, -692, 942, 1385, 893, -646, -349, -45, 1046, -287, -480, -1205, -43, 403, 513, -242, -69, -348, 774, 454, 263, 220, -513, 121, -46, -709, -472, -703, -219, -270, -141, -314, -340, -624, -386, 382, -445, 196, -308, 268, -208, 313, 17, 473, 216, 498, 216, 890, -12, 658, -239, 106, -596, 319, -795, 51, -915, 519, -844, 761, -180, 515, -672, 349, 196, 373, -206, 67, -557, 195, -462, -87, -329, -673, -410, -394, 905, -193, 1016, -731, 110, -423, 819, -71, 169, -631, 288, -594, 652, -886, -68, 209, 133, 675, 83, -300, -610, 815, -108, 345, -1093, 450, -246, -216, -559, 141, -628, 483, -938, 1718, -383, 36, 193, 464, 340, 530, -398, -718, 477, 133, 638, -1002, 178, -449, 897, -249, 520, -741, -458, -259, 1131, 382, 630, -1127, -253, -53, 873, -270, -299, -1166, -75, 49, 40, -222, -169, -486, -420, 541, 371, -200, -1031, -333, 592, 206, 310, -473, -211, 150, 126, 878, -1043, 53, -826, 439, 72, 2, -34, -99, -300, 90, -7, 159, -387, -804, -196, 100, 361, 136, -606, -125, -379, 605, -198, 997, -1118, 1097, -515, 899, -565, 96, -905, 217, -288, 565, -358, 156, -829, 507, 12, 556, -120, 395, -140, 299, 50, -167, -532, -210, -554, 475, -113, -7, -341, 34, -250, 184, -199, 134, -105, 319, 82, 402, -25, -199, 48, 66, 106, 187, -477, 36, -316, 486, -45, 289, -72, 203, -239, 472, -256, 204, 75, -190, -132, 133, -154, 100, -384, -185, -74, 14, 143, -126, -15, -127, -84, 56, 397, -144, 140, -22, 292, 85, -38, 47, -136, -262, 397, -93, 80, 64, -231, 350, 95, 163, 0, -182, 269, -243, 230, -223, 155, -440, 191, -309, 324, -82, 127, 58, -41, 286, 143, 142, 262, -127, 47, 86, 9, 192, -139, -289, 4, -128, 204, -406, 559, -343, 273, 212, -1, 298, 20, 9, -132, -260, 9, 58, 23, 59, -162, -34, 149, 309, 57, 199, 193, 93, 222, 37, -5, 193, -338, -234, -84, 131, 52, -19, -126, 143, -25, 337, 91, 240, -68, 84, 137, 246, 198, 21, -311, 254, -86, -22, 285, -306, -165, 254, 284, 25, 204, 224, -21, 193, 108, 96, -312, 60, -221, 188, -177, 95, -128, 54, -48, 288, -21, -84, 256, 181, -172, 122, 222, 17, -278, -102, -120, 200, -67, 19, -144, 285, -119, 4, -119, 388, -60, 318, -193, 183, -212, -33, -283, 401, -251, -301, 140, -78, 185, -66, -140, -586, 594, 94, -111, -150, -197, 266, -257, 136, -238, -77, -230, 66, -398, 286, -27, -122, 264, -186, -8, -95, 242, 95, -213, 114, -26, -5, -190, 335, -63, -74, -359, 480, -403, 6, 121, -157, -123, -66, 13, 74, -12, -36, -67, 3, -11, 252, -106, -77, -271, -109, 115, 267, 83, -94, 108, 162, 59, -103, -95, -160, -361, 201, -384, 311, -396, 227, -89, 104, -212, 473, -220, 92, -194, 90, -339, 64, -142, -77, -237, 299, -325, 20, -136, 7, -58, -106, 110, 215, 88, -242, 400, -67, 411, -397, -21, -255, 112, -382, 131, -319, -47, -325, 262, 35, 99, -216, 231, -56, -124, 121, -78, -57, -54, -319, 257, -105, 31, -387, 117, -71, 181, 4, 128, 4, 49, 280, -121, 334, -176, 36, -142, -38, -136, 156, -125, 33, -229, 191, 103, -250, 10, -215, 77, 54, -25, -370, -96, 27, -247, 388, -153, -80, -319, 91, -209, 218, -87, -80, -78, 17, 48, 282, -206, 182, -239, 54, -212, 323, -223, -53, -147, -385, 349, -65, -39, -64, -220, -33, 101, 40, -23, 22, -311, -127, 172, 199, 11, -130, -176, -233, 3, 309, -179, 24, -78, 336, -171, 8, 174, 50, 159, -259, 177, -214, 54, -142, -102, -47, -23, -81, 424, -42, -9, -153, 187, 26, -94, 0, -177, 366, -527, 134, -99, 158, -240, -52, 138, -17, -65, 412, 34, 120, -125, 221, 43, 17, 272, -282, -20, -290, 194, -294, -9, 12, 65, -311, 315, 66, -47, -67, 172, -219, -2, 119, 105, -236, 206, -220, 289, -180, 323, 240, -222, 9, -151, 410, -158, -77, -57, 10, -42, -60, -267, 275, -136, 100, -240, 392, -110, -15, -263, 413, -296, -25, 128, 17, -104, 49, -335, 234, -197, -39, 135, 116, -225, 264, -106, 25, -135, 431, 51, -92, -335, 344, -46, 98, -380, 102, -66, -42, 88, -95, -87, 86, -298, 117, 120, -3, -291, 264, 72, 174, 34, -66, -28, 59, 68, 14, 104, -209, 186, 20, 102, -128, 47, 71, 367, 89, -254, 14, 114, -198, 506, -534, 251, -192, 85, -262, -328, 195, -326, 243, 58, -32, 238, -16, 131, -205, 254, -116, 321, -157, 1, 89, 263, -81, 391, -346, 187, -320, 49, -18, 105, -148, -65, -14, 93, -99, -59, 333, -182, 353, -473, 321, -510, 544, -369, -2, -139, 314, -355, 74, -74, 204, -222, 229, -91, -10, 549, -251, 66, -84, 7, -343, 252, -90, 182, 111, -358, -267, -221, -53, 106, -86, 125, 112, -17, 550, -824, 332, -577, 286, -339, 346, -660, 614, 254, -14, -530, -244, 111, 106, 288, -297, -375, 411, -448, 62, -184, 139, -243, 29, -135, 4, 158, 352, -329, -55, -387, 337, -70, 18, -127, -129, -429, 200, -38, 159, -278, -353, 645, -72, 720, -490, 406, -169, 244, 180, -324, 457, -35, 205, -260, 258, -39, 464, -388, 215, -277, -77, 293, 170, -302, 112, -214, 208, 30, -126, -69, -246, 163, 6, 187, -411, 504, -421, 1024, -980, 289, -340, -56, 297, -592, 421, -241, 38, -100, 506, 220, 532, -362, -248, 315, -91, 387, -208, -363, 368, -295, 396, -211, -91, 329, -370, 587, -894, 424, -399, -74, 161, -77, 342, -369, 848, -455, 1483, -899, 992, -835, 723, -510, 429, -192, 315, -457, 231, -554, 626, -307, 274, 170, 30, 444, -1006, 606, -83, 558, -598, 933, 444, 983, 105, 356, 540, -9, 164, -440, -204, -148, 19, 268, -334, 190, -622, 329, -202, 515, -416, 322, -265, 464, -10, 159, -412, 647, -411, 238, -133, -183, 357, -324, 142, -633, 467, -510, 776, -1238, 154, -633, 203, -9, -579, -76, 110, -100, 91, 308, -6, 234, -216, 490, -284, -76, -106, -721, -516, 249, -201, 206, -176, -562, 309, -742, 370, -269, -162, 64, 5, -346, 362, -657, 319, -257, -186, -35, 46, 175, -201, 25, 2, -131, 1, -45, 292, -207, 124, 8, 174, 236, -347, 287, -280, -116, -90, -342, -333, -292, -861, -200, -469, -599, -145, -1154, -296, 59, -863, 745, -482, -82, -318, 88, 1072, 445, 619, 914, 450, 913, 772, 592, 1058, 274, 806, 603, 466, 813, 135, 102, 576, -541, 121, -807, -589, -1292, -1130, -1544, -1752, -2399, -3089, -2666, -3017, -2336, -3044, -2181, -2212, -1286, -1060, -127, 774, 1177, 1748, 2266, 2674, 3545, 3521, 3899, 3676, 3499, 3550, 3034, 3116, 2579, 2542, 1974, 1636, 1412, 1154, 394, -394, -740, -1485, -1503, -2765, -3067, -3762, -4700, -4660, -5018, -4594, -4032, -3738, -2881, -1838, -1875, -1006, -613, 488, 1177, 1915, 2664, 2931, 3642, 3744, 4268, 4085, 4229, 3704, 3450, 2899, 2807, 2360, 2094, 1816, 1650, 1334, 1364, 1473, 925, 1250, 858, 1051, 525, 90, -708, -698, -2264, -2900, -4212, -4677, -5260, -5503, -5154, -4776, -3829, -3069, -2179, -1897, -1244, -789, 24, 408, 1164, 1691, 2357, 2751, 3270, 3980, 3835, 3678, 3340, 2966, 2929, 1868, 1960, 1455, 1272, 907, 698, 586, 815, 688, 1004, 771, 1122, 1161, 938, 539, 64, -633, -1190, -2375, -3392, -4159, -5197, -5715, -5753, -5692, -4944, -4044, -3241, -1789, -1572, -468, 90, 493, 846, 841, 1492, 1448, 1592, 2073, 2589, 2874, 2926, 2524, 2570, 2134, 1720, 1464, 1154, 921, 827, 929, 1298, 1306, 1248, 1440, 1521, 1867, 1917, 1754, 1680, 1190, 942, 128, -259, -961, -2010, -3184, -4195, -4938, -5435, -5938, -5575, -5521, -4202, -3482, -2161, -1189, -279, 199, 740, 1036, 1108, 962, 710, 510, 669, 1062, 1494, 1897, 1837, 1855, 1971, 1553, 1682, 1398, 1400, 1131, 1065, 1368, 1530, 1849, 1954, 2104, 2574, 2513, 2531, 2403, 1947, 1822, 1141, 732, 162, -684, -1131, -1927, -2928, -3997, -4392, -4992, -5094, -5534, -5162, -4746, -3969, -2957, -2220, -1288, -579, -219, 369, 348, 440, 375, 240, 522, 657, 1188, 1548, 1671, 1903, 1891, 2006, 2095, 1860, 1767, 1747, 1566, 1648, 1626, 2025, 2159, 2405, 2544, 2567, 2392, 2347, 2125, 1800, 1442, 1152, 763, 191, -578, -1251, -2027, -2604, -3741, -4326, -4776, -5141, -5358, -5110, -4760, -3864, -2913, -2201, -1358, -815, -217, 225, 465, 481, 344, 198, 251, 266, 599, 958, 1163, 1365, 1350, 1597, 1908, 1919, 1828, 1677, 1594, 1780, 1745, 2074, 2359, 2414, 2678, 2612, 2775, 2746, 2566, 2427, 2151, 1892, 1407, 968, 317, -280, -1058, -1567, -2265, -3309, -3976, -4349, -4625, -4859, -4840, -4680, -4111, -3616, -3106, -2510, -1782, -1232, -857, -647, -521, -529, -371, -249, -98, 347, 722, 1234, 1541, 1657, 1905, 1978, 1989, 2038, 1753, 1808, 1869, 2061, 2187, 2378, 2624, 2835, 2931, 2888, 2735, 2514, 2338, 2189, 1940, 1646, 1406, 1040, 472, 29, -595, -1122, -1770, -2537, -3311, -4088, -4338, -4593, -4835, -4786, -4732, -4242, -3662, -3078, -2364, -1903, -1273, -877, -721, -541, -486, -242, -131, 157, 629, 1074, 1462, 1774, 1938, 2122, 2171, 2116, 1957, 1847, 1867, 1840, 1908, 2071, 2334, 2587, 2516, 2690, 2594, 2508, 2450, 2279, 2078, 1828, 1557, 1364, 1138, 758, 409, -9, -448, -1003, -1505, -2222, -3121, -3746, -4199, -4582, -4773, -4765, -4655, -4251, -3816, -3117, -2428, -1800, -1223, -909, -563, -337, -240, -3, 178, 497, 762, 1270, 1626, 1646, 1653, 1668, 1680, 1706, 1605, 1596, 1602, 1701, 1790, 1872, 2116, 2346, 2393, 2516, 2547, 2434, 2341, 2314, 2236, 2061, 1812, 1673, 1369, 1080, 702, 379, -23, -600, -1110, -1669, -2362, -3105, -3710, -4208, -4495, -4607, -4520, -4322, -3979, -3468, -2801, -2178, -1661, -1134, -871, -594, -413, -110, 114, 270, 466, 824, 1218, 1430, 1358, 1368, 1420, 1508, 1474, 1507, 1501, 1543, 1572, 1703, 1918, 2194, 2381, 2353, 2482, 2518, 2485, 2374, 2298, 2253, 2056, 1885, 1621, 1403, 1180, 881, 655, 304, -141, -585, -1134, -1748, -2550, -3235, -3774, -4195, -4493, -4524, -4426, -4129, -3797, -3301, -2749, -2275, -1816, -1390, -1134, -855, -638, -245, 44, 332, 728, 1036, 1308, 1317, 1271, 1390, 1526, 1621, 1525, 1407, 1509, 1674, 1715, 1872, 2153, 2383, 2503, 2577, 2611, 2607, 2559, 2488, 2405, 2204, 1931, 1762, 1531, 1269, 993, 800, 458, 84, -431, -917, -1412, -1919, -2663, -3277, -3806, -4279, -4536, -4555, -4378, -4080, -3723, -3274, -2683, -2180, -1579, -1234, -992, -761, -587, -178, 81, 261, 654, 989, 1263, 1387, 1401, 1565, 1547, 1583, 1525, 1607, 1769, 1779, 1762, 2019, 2228, 2514, 2589, 2620, 2684, 2600, 2521, 2398, 2343, 2138, 1818, 1532, 1352, 1207, 889, 750, 433, 4, -395, -991, -1491, -2014, -2533, -3170, -3859, -4296, -4598, -4672, -4494, -4276, -3869, -3295, -2714, -1976, -1524, -1095, -759, -451, -268, -86, 199, 451, 671, 1054, 1465, 1602, 1544, 1610, 1623, 1664, 1676, 1544, 1528, 1667, 1706, 1820, 1921, 2121, 2254, 2235, 2327, 2183, 2087, 1989, 1814, 1776, 1541, 1354, 1174, 953, 824, 583, 485, 404, -33, -347, -874, -1406, -1849, -2349, -2945, -3610, -4152, -4391, -4431, -4284, -4149, -3783, -3140, -2443, -1764, -1268, -817, -454, -227, -63, 15, 268, 473, 651, 999, 1368, 1557, 1538, 1464, 1550, 1512, 1516, 1438, 1332, 1463, 1545, 1626, 1749, 1866, 2073, 2050, 2028, 2034, 1957, 1878, 1830, 1785, 1563, 1350, 1146, 965, 861, 635, 580, 393, 101, -219, -587, -1013, -1525, -2070, -2638, -3415, -3909, -4106, -4286, -4260, -4107, -3852, -3255, -2665, -1877, -1187, -721, -179, -9, 133, 211, 275, 441, 525, 845, 1287, 1621, 1675, 1570, 1564, 1532, 1442, 1380, 1202, 1173, 1146, 1261, 1377, 1440, 1659, 1892, 1905, 2062, 2030, 1878, 1807, 1765, 1707, 1570, 1444, 1309, 1183, 904, 691, 627, 535, 163, -319, -844, -1454, -1922, -2436, -3215, -3944, -4177, -4274, -4267, -4102, -3835, -3264, -2529, -1898, -1083, -649, -175, 104, 224, 383, 379, 535, 621, 898, 1321, 1635, 1739, 1534, 1374, 1303, 1283, 1092, 806, 835, 845, 873, 886, 958, 1431, 1734, 1839, 1743, 1889, 2040, 1825, 1869, 1705, 1501, 1535, 1340, 1318, 1139, 948, 805, 742, 396, -140, -574, -1014, -1553, -2368, -3276, -4105, -4355, -4449, -4581, -4387, -4333, -3726, -3049, -2336, -1283, -969, -303, 296, 236, 460, 334, 571, 961, 848, 1221, 1544, 1625, 1648, 1431, 1397, 1011, 739, 619, 630, 743, 722, 1027, 1240, 1401, 1855, 2013, 2194, 2180, 2041, 2128, 1941, 1914, 1758, 1586, 1562, 1264, 1090, 808, 749, 679, 134, -401, -1002, -1568, -2213, -3446, -4476, -4832, -5006, -5062, -4833, -4613, -3837, -2797, -2145, -1305, -814, -314, 384, 453, 714, 865, 995, 1263, 1268, 1535, 1909, 1982, 1710, 1578, 1215, 672, 474, 58, 138, 213, 221, 697, 1015, 1357, 1804, 2138, 2208, 2238, 2304, 2217, 2319, 2216, 2114, 2055, 1964, 1898, 1678, 1212, 986, 630, -162, -744, -1484, -2341, -3232, -4524, -5215, -5621, -6137, -5618, -5244, -4599, -3407, -2830, -1450, -755, -272, 565, 533, 1320, 1552, 1853, 2479, 2174, 2609, 2657, 2412, 2102, 1415, 852, 36, -506, -787, -827, -384, 19, 475, 794, 1114, 1474, 1656, 1846, 2026, 2296, 2659, 2751, 3112, 3253, 3039, 2683, 2020, 1649, 1369, 617, -121, -923, -1672, -2284, -3506, -4600, -5542, -6587, -6836, -6584, -6373, -5273, -4256, -3250, -1476, -841, 246, 1034, 1227, 2300, 2589, 3362, 3843, 3815, 4124, 3664, 3135, 2267, 1278, 323, -542, -1315, -1471, -1345, -1396, -910, -793, -857, -488, 158, 501, 1324, 2537, 3038, 4608, 5076, 4920, 5406, 4365, 3665, 2952, 1337, 916, 271, -886, -1557, -2914, -4341, -6058, -8383, -9586, -9501, -9076, -7703, -6019, -4297, -1744, -988, -258, 1038, 1188, 2460, 3202, 4229, 5662, 6333, 6829, 5717, 4442, 2496, 850, -230, -1734, -2030, -2272, -2174, -1999, -2251, -1758, -1844, -1787, -1151, -324, 1648, 3231, 4589, 6427, 6704, 6896, 6519, 5229, 4574, 3553, 2616, 2080, 1017, -708, -2080, -3998, -6112, -7790, -11095, -11551, -10344, -10340, -7226, -5759, -3426, -990, -2316, 230, 1254, 1959, 4739, 5281, 7387, 7529, 6881, 6609, 4683, 2818, 90, -745, -1366, -2421, -2297, -2737, -2619, -3359, -4507, -3963, -3132, -1929, 45, 1735, 3835, 5907, 6558, 7350, 7161, 6542, 6488, 5888, 5518, 5056, 4076, 2836, 392, -2125, -4563, -7836, -9660, -11762, -12482, -10549, -10909, -8297, -6297, -5388, -2789, -2990, 264, 2066, 3677, 6382, 7096, 9722, 8174, 6848, 6166, 3812, 3181, 1012, 406, -577, -2939, -3920, -5431, -5876, -6057, -5762, -3793, -2106, -721, 783, 2370, 4037, 5482, 7016, 8143, 8813, 8722, 8263, 7838, 6174, 4280, 2949, 1426, -1000, -3377, -5776, -8071, -10013, -13600, -12658, -10525, -10616, -7853, -7376, -4568, -2054, -2411, 2314, 4428, 6915, 8286, 7716, 8858, 6343, 5672, 4256, 3125, 2731, -132, -649, -2911, -5754, -6040, -6626, -5942, -4853, -4640, -2176, -627, -114, 2460, 4000, 6493, 7521, 7630, 9343, 8213, 7558, 7026, 5190, 4110, 2562, 742, -1076, -3263, -6358, -8155, -10057, -13599, -11462, -9317, -8695, -5941, -6752, -3636, -1776, -822, 4304, 5636, 8364, 7824, 7477, 7802, 5179, 5216, 3107, 3146, 1459, -2445, -2816, -5674, -6767, -6716, -6645, -3965, -3282, -2611, -1327, -110, 3279, 5186, 6828, 8462, 8246, 8324, 7830, 7127, 5825, 4956, 3471, 1790, 607, -2592, -3965, -6269, -9342, -10662, -13398, -10610, -8250, -8525, -5152, -5064, -1183, 367, 110, 5481, 5934, 8251, 7556, 5958, 7525, 4915, 4273, 2485, 1129, -1448, -5260, -5486, -7172, -7005, -6482, -5642, -2688, -2661, -1800, 763, 3248, 5619, 7477, 9082, 9458, 9107, 8256, 7647, 7127, 5271, 3603, 1730, -516, -3233, -5180, -6282, -8995, -10344, -13688, -13887, -8433, -8175, -5839, -4849, -3006, 2196, 1444, 6430, 8784, 8723, 9412, 5832, 7570, 5090, 2682, 2278, -914, -1957, -6128, -7397, -6459, -7092, -6840, -6750, -3908, -1970, -721, 2520, 5202, 7773, 8558, 8505, 10255, 9918, 8535, 7940, 5755, 4112, 1877, -273, -584, -3712, -6204, -8210, -10853, -11662, -14710, -11487, -6285, -6540, -4094, -5389, -736, 3846, 3357, 9921, 8782, 8856, 7305, 4242, 8275, 4016, 2078, -144, -4196, -4805, -7918, -7219, -7143, -7967, -7220, -6006, -2940, -1061, 1161, 4227, 7212, 8506, 9045, 10429, 10507, 10325, 8381, 6596, 5887, 2982, 1419, -127, -3744, -5398, -7478, -10948, -11759, -14643, -12946, -6988, -7328, -5772, -5223, -1537, 4630, 5912, 9631, 9219, 8770, 8298, 6739, 8540, 5989, 2923, -878, -4333, -4541, -6678, -7822, -8795, -9848, -8774, -7033, -3565, -821, 1363, 4315, 6621, 9472, 11172, 11882, 12081, 10482, 8287, 7196, 5318, 2493, -14, -4445, -6227, -8644, -12718, -14705, -17757, -12178, -7643, -8960, -7224, -6450, 2077, 5958, 6282, 11337, 9664, 10772, 9599, 9704, 10682, 4225, 1078, -2560, -3395, -4527, -9177, -9351, -10184, -10107, -7975, -5517, -1865, -338, 2362, 7560, 9622, 11159, 12297, 11504, 12019, 10149, 8043, 6639, 1833, -983, -4732, -9870, -12898, -16381, -14038, -12975, -15059, -12054, -8905, -2887, -74, 3119, 8505, 8875, 11376, 11209, 12319, 11895, 7957, 6444, 2383, 455, -4061, -6794, -7220, -11246, -9328, -8678, -7092, -4475, -4588, 2322, 5809, 7097, 9390, 8651, 12650, 11851, 9357, 8937, 3833, 3362, -1737, -8095, -11809, -15501, -9696, -11963, -14817, -12822, -9141, -510, -1796, 364, 4626, 7756, 11487, 9560, 12069, 11289, 7492, 4630, 1880, 2282, -710, -5676, -8516, -7486, -5718, -5898, -7071, -5419, 75, 2997, 6181, 6660, 6367, 8917, 8452, 9912, 7208, 2677, 1893, -3118, -6544, -10749, -11100, -6943, -11289, -13419, -12377, -6638, -441, -1961, 663, 3572, 7367, 10422, 10366, 11203, 8411, 5763, 4443, 3828, 2099, -1431, -4550, -5847, -5634, -5820, -5178, -5135, -3600, 153, 4058, 5551, 4418, 4652, 6183, 8045, 6872, 6095, 3616, -956, -5815, -10917, -6197, -5011, -8524, -13206, -14946, -5825, -4542, -2240, -435, 107, 5436, 4199, 9088, 10575, 7586, 7461, 4752, 7468, 3885, -705, 421, -1127, -1273, -3835, -3643, -2732, -4916, -3044, 137, 3516, 3532, 2091, 2792, 3898, 5139, 3349, -285, -5456, -6953, -2608, -1620, -4638, -10576, -10304, -4974, -2578, -31, -1229, -461, 707, 2535, 7018, 6074, 5065, 3089, 3355, 4684, 3433, 4239, 1005, -1412, -2523, -1329, 2679, 337, -592, -2467, -1195, 2816, 1764, 3767, 1152, 730, 1342, -3304, -4125, -7064, -4285, -2580, -7040, -6564, -7199, -2992, -680, -1416, 1369, 25, 1825, 3710, 6113, 7839, 4274, 3199, 2747, 3551, 3563, 2209, 1434, -863, -1535, -1179, 736, 2268, 604, 178, 127, 1672, 3249, 2498, 2796, 604, -1484, -3198, -6140, -5119, -4909, -6080, -7925, -9967, -5807, -2766, -1468, -705, -1502, 1010, 1979, 4361, 7115, 6779, 5699, 3320, 3985, 5437, 5459, 4065, 831, -535, -689, 1013, 1661, -122, -483, -1692, -225, 984, 1519, 2849, -701, -2234, -4479, -6160, -3882, -4490, -3939, -6891, -8925, -4617, -3111, -305, -391, -1326, 1142, 1005, 4220, 5757, 5007, 5415, 3434, 4038, 4464, 3957, 4703, 1872, 185, 903, 2171, 2988, 339, -112, 160, 470, 1466, 1533, 1136, -2627, -5027, -6121, -6107, -4929, -6288, -6292, -7990, -7769, -4142, -2984, -109, -577, -308, 1586, 1888, 6378, 6579, 5574, 5170, 4020, 6200, 5064, 4160, 3811, 1374, 1244, 1057, 1946, 1752, -385, -326, 329, 1216, 1474, 1212, -522, -2880, -4720, -5494, -4427, -4728, -5240, -6391, -7937, -6713, -5554, -3420, -1689, -2364, -699, 22, 1875, 5062, 5257, 6127, 4843, 4882, 6699, 5796, 6096, 4695, 3286, 3270, 1938, 2205, 1496, -54, -661, -717, 381, 320, -1585, -3266, -4284, -5005, -4086, -3437, -4096, -5069, -6392, -4965, -3696, -3796, -2702, -2369, -1224, -565, -115, 2578, 3498, 3338, 3485, 3814, 5692, 5562, 4376, 4680, 4397, 4486, 3645, 2478, 2367, 1355, 753, 663, 94, -8, -913, -2709, -3349, -4538, -4632, -4063, -4687, -4524, -5394, -5725, -4640, -4318, -2781, -2549, -2898, -1687, -631, 1705, 2884, 3094, 3452, 3141, 3921, 5229, 5542, 4910, 3874, 3135, 3456, 2756, 2125, 1874, 948, 756, 220, 118, 996, 74, -1366, -2200, -2390, -1732, -3018, -3945, -3484, -3868, -4312, -4996, -4775, -3672, -4415, -4128, -3062, -1978, -226, 49, 1567, 2332, 2629, 3890, 4565, 5192, 4937, 4754, 4520, 3991, 3444, 3231, 2587, 1317, 1194, 730, 281, 475, 118, 277, -978, -1491, -1136, -2012, -1955, -2546, -2432, -2882, -4139, -3733, -3783, -3768, -3699, -3564, -2706, -2146, -1437, -275, 62, 672, 1655, 2617, 3066, 3224, 3474, 3586, 3387, 3045, 3525, 3154, 2353, 2116, 1785, 1862, 1231, 1254, 1418, 795, 748, 64, -155, -503, -1408, -1516, -2212, -2394, -2580, -3421, -3610, -3828, -3610, -3683, -3624, -2974, -2191, -1655, -1286, -573, 176, 866, 1671, 2232, 2729, 2588, 2637, 2783, 2769, 2623, 2399, 2378, 2123, 1449, 1321, 1440, 1740, 1540, 818, 903, 1255, 1094, 350, -171, -253, -550, -1298, -1503, -1520, -2044, -2787, -3186, -2922, -2982, -3296, -3111, -2967, -2606, -2358, -1571, -1103, -692, -213, 515, 1282, 1654, 1865, 2005, 2037, 2209, 2367, 2515, 1930, 1657, 1644, 1680, 1452, 1359, 1319, 1295, 984, 562, 551, 504, 305, 56, -98, -215, -511, -828, -1138, -1575, -1640, -2040, -2215, -2416, -2462, -2408, -2300, -2309, -2035, -1744, -1241, -956, -763, -464, 65, 517, 730, 729, 1004, 1313, 1707, 1432, 1551, 1474, 1594, 1516, 1543, 1623, 1161, 1005, 849, 1156, 1316, 920, 964, 790, 783, 642, 485, 421, -252, -313, -676, -887, -1160, -1575, -1773, -2014, -2276, -2237, -2153, -2115, -2190, -1855, -1754, -1572, -1293, -884, -621, -530, -185, 289, 623, 1054, 1257, 1514, 1471, 1543, 1679, 1845, 1486, 1585, 1576, 1756, 1498, 1461, 1461, 1202, 1130, 1030, 1149, 840, 594, 278, 182, -98, -417, -696, -922, -1190, -1377, -1845, -1849, -2032, -2090, -2464, -2399, -2274, -1947, -1826, -1480, -1140, -825, -500, -134, 257, 555, 706, 773, 972, 1139, 1332, 1297, 1245, 1246, 1467, 1426, 1339, 1394, 1455, 1430, 1197, 1359, 1248, 1060, 967, 713, 618, 449, 39, -99, -359, -559, -981, -1182, -1257, -1467, -1448, -1685, -1591, -1541, -1272, -1301, -1179, -1111, -927, -914, -629, -634, -409, -395, -254, -90, -3, 126, 232, 428, 652, 549, 749, 985, 961, 1081, 983, 1170, 1111, 1121, 954, 1132, 866, 673, 726, 523, 416, 82, 16, -178, -214, -518, -640, -583, -782, -582, -815, -647, -674, -626, -696, -685, -499, -422, -293, -520, -339, -146, -131, -230, -205, -65, -120, -128, 11, -39, 52, 175, 282, 173, 298, 478, 508, 600, 512, 534, 421, 612, 332, 340, 373, 198, 57, 149, -26, -229, -233, -204, -262, -144, -203, -308, 17, -188, -91, -79, 231, -46, -175, 198, 146, 128, -102, -38, 45, 71, 58, -89, 91, 18, -40, 279, 368, 257, 209, 271, 322, 482, 165, 199, 123, 88, -121, -8, -416, -531, -426, -516, -431, -308, -287, -126, -87, -75, 316, 31, 267, 263, 311, 335, 487, 334, 508, 414, 295, 526, 304, 199, 346, 328, -24, 117, -162, 134, -259, -144, -47, -76, -273, -174, -204, -135, -208, -338, -473, -417, -368, -367, -272, -265, -138, -140, 191, 74, -18, 100, 186, 101, 75, 517, 168, 101, -27, 69, 395, 29, 396, 14, 97, 118, 233, -249, -54, 72, 137, -46, 127, -207, 39, 15, -217, 67, -19, -267, -236, -168, -10, -180, -372, -328, -104, -74, -162, 112, 96, -155, 123, 44, -48, 7, 64, 58, 98, 179, -54, -309, -70, 135, -495, -310, -181, -388, -514, -240, -400, -285, -765, 2, -98, -30, -17, 408, 99, 280, 160, 365, 157, 290, 243, 234, 26, 46, -116, -203, -122, 145, 49, -269, -64, 84, 147, -166, 87, -173, 100, -759, -184, -179, -269, -433, -227, 104, -571, -851, 36, -246, -357, -430, -449, 42, -249, 203, 105, 300, 167, 389, 667, 475, 596, 533, 411, 254, 69, 520, 458, -89, 78, -55, -72, 65, 285, -377, -321, -68, -265, -172, 38, -555, -515, -17, -531, -379, -612, -311, -270, -139, 141, -40, -377, -209, 43, -33, -257, 352, 171, -166, 193, 90, 410, 346, 408, 552, 996, 303, 590, 129, 514, 437, 174, 296, 162, 33, -55, 3, -154, -457, -439, -582, -43, -856, -751, -483, -598, -477, -521, -422, -814, -263, -322, -38, -743, -397, -422, -362, -394, 197, -116, 101, 963, 839, 1662, 838, 1114, 1236, 1049, 386, 906, 595, 367, -214, 601, 219, 498, -45, 86, -68, -80, -231, 36, -532, -705, -1070, -1564, -1652, -1389, -3018, -1971, -2801, -2260, -2264, -2287, -2278, -1778, -1465, -744, -1072, 15, -179, 988, 723, 1383, 1514, 2043, 1974, 2304, 2275, 2962, 2141, 3483, 2503, 3154, 2291, 2182, 2380, 1283, 875, -133, -616, -1000, -2242, -3276, -4169, -4964, -3883, -3816, -4222, -4166, -4172, -3202, -1820, -1178, 37, -122, 89, 590, 1691, 3169, 2906, 2160, 1139, 1554, 1796, 2081, 2176, 1273, 730, 364, 1312, 1583, 1589, 2312, 1599, 2018, 2278, 3121, 3291, 2393, 2405, 1726, 1347, -28, -1605, -3700, -5472, -5428, -4244, -4924, -5975, -7153, -5053, -3166, -1695, -382, -125, 330, 1530, 3294, 6028, 5304, 3529, 3036, 3446, 4129, 3573, 2311, 689, -353, -281, 10, 162, -424, -848, 151, 840, 1725, 2429, 2677, 3076, 2646, 2844, 1461, -414, -3502, -6104, -6899, -5239, -4511, -7079, -8256, -7310, -3532, -1306, -67, 1373, 1103, 1644, 4333, 7676, 7382, 5267, 3515, 3662, 4643, 3545, 2945, 1227, -1349, -1860, -683, -132, -687, -1394, -741, 176, 1774, 1984, 2844, 3089, 1877, 1850, 563, -1486, -4692, -9011, -8290, -3679, -5426, -5954, -8016, -4910, -172, -98, 3803, 4103, 3083, 4177, 4639, 8572, 6424, 3014, 1800, 1173, 2139, 342, 88, -1602, -3766, -2382, -1048, 685, 272, 169, 2797, 3373, 5029, 4664, 5202, 4313, 2466, 2907, 459, -3234, -5711, -10961, -12068, -7524, -6378, -7967, -7553, -7028, 115, 2791, 4818, 8048, 5480, 6114, 6730, 8992, 8802, 2092, 369, -1571, -1926, -1641, -3859, -3809, -4956, -5648, -1232, 277, 2058, 1807, 3446, 6841, 7144, 7634, 6864, 5578, 5395, 3115, 1082, -1461, -7149, -9754, -12478, -15316, -9170, -6977, -9735, -7165, -6165, 3088, 6789, 5973, 9834, 6692, 7425, 8099, 8335, 8322, 299, -3141, -3585, -3647, -3902, -6541, -6704, -6672, -4426, -298, 2281, 3366, 3733, 6056, 9051, 9763, 8531, 6153, 5055, 3847, 3361, 922, -3007, -7219, -11063, -11990, -14698, -15399, -6391, -7282, -7922, -3168, -708, 9437, 9087, 8139, 11269, 7311, 8551, 7043, 4531, 2196, -4578, -5826, -4528, -6203, -6553, -8856, -6934, -3359, -1402, 3342, 5409, 5571, 6749, 8249, 10507, 9466, 6008, 4608, 2757, 1753, 913, -1961, -5075, -7252, -10829, -11676, -13641, -13266, -4660, -3866, -5852, -1278, 1625, 9955, 10445, 6979, 8165, 5906, 6213, 4682, 1788, -918, -6572, -7530, -5608, -4837, -5368, -7035, -5347, -1033, 653, 3932, 6145, 6009, 6368, 6954, 8681, 8075, 4716, 1851, 477, 507, 1130, -400, -2515, -5196, -7825, -7928, -9033, -10419, -6778, -2236, -3671, -2804, -169, 3978, 9723, 6212, 4779, 5555, 3923, 4372, 1497, -581, -2084, -6521, -5265, -3836, -3873, -3969, -5617, -2809, 1015, 2154, 3547, 4836, 4830, 5279, 6405, 6484, 5757, 3254, 1348, 1000, 334, -529, -1526, -1194, -1335, -2239, -4327, -7045, -8335, -8929, -5905, -510, -1470, -4519, -3363, 664, 7557, 8184, 4655, 2919, 1998, 4100, 4200, 1921, -1269, -5063, -5755, -4109, -2650, -3367, -4565, -4739, -1927, 2535, 3545, 3573, 3643, 3031, 4768, 6860, 5715, 4104, 2358, 601, 1644, 2522, 1037, -826, -1650, -1061, -325, -1328, -2527, -4393, -6057, -6013, -5969, -4773, -1220, -995, -2300, -1096, 251, 4855, 6987, 3910, 2637, 1476, 2123, 2545, -197, -1944, -3096, -4372, -4385, -3607, -2753, -2526, -2841, -1201, 935, 2023, 2560, 2974, 4042, 5042, 5280, 3939, 2366, 1561, 1187, 1854, 2551, 1073, -469, -1153, -1775, -704, 540, 414, 58, -2474, -5722, -6925, -6522, -2074, 1862, -1251, -4287, -4333, 402, 7309, 6862, 3001, 58, 922, 3250, 2158, -154, -2390, -3657, -4020, -4085, -3770, -2557, -2281, -2328, -451, 2806, 4039, 2504, 2443, 3602, 4927, 5225, 2973, 1374, 637, 361, 1084, 797, 83, 192, -397, -413, 643, 1132, 1403, 515, -1349, -3259, -5236, -7148, -8624, -4940, 106, -1049, -3480, -3741, 713, 7809, 8834, 5372, 1558, 1035, 3397, 3207, 298, -3087, -5913, -6218, -4295, -3900, -3198, -2442, -2723, -395, 2632, 4826, 5681, 3423, 1092, 2677, 4945, 5096, 3017, -282, -1110, 588, 1752, 1087, 414, -232, 28, 1477, 1552, 1054, -529, -905, -118, -1015, -3199, -6916, -9405, -8093, -1948, 1964, -608, -3902, -4719, 2228, 9631, 8960, 4264, -769, -119, 3738, 4203, 897, -3831, -6277, -5685, -3851, -2658, -1460, -1857, -3133, -1512, 1428, 3809, 3946, 1978, 1634, 3644, 4724, 2574, -365, -1160, 633, 2437, 2661, 836, -1196, -258, 1121, 2479, 3598, 2386, 674, -350, -57, -643, -2915, -5313, -8793, -9199, -4409, -1112, -1514, -3579, -4008, 1622, 8358, 9206, 5382, 1718, 1653, 3579, 3920, 748, -2704, -4454, -5148, -4499, -4185, -3891, -2375, -1250, -1142, 163, 2407, 3565, 3695, 2609, 1967, 2804, 3607, 2769, 118, -1410, -725, 101, 462, -194, -588, 895, 1873, 2034, 2173, 1445, 2212, 3181, 2070, 2393, 1461, -3268, -7252, -10512, -10293, -4125, 119, -1017, -4381, -5651, -67, 6818, 9313, 7561, 2155, -9, 1981, 2696, 1246, -2326, -5902, -6456, -4433, -3516, -3440, -2744, -1419, 1734, 4431, 5563, 6135, 4340, 1612, 1007, 1465, 2217, 1370, -2852, -5911, -5228, -2053, 1309, 2069, 767, 542, 2850, 5363, 6743, 6179, 3573, 1923, 946, 5, -25, 306, -1107, -5554, -9983, -13111, -12535, -4506, 1710, 990, -1397, -4306, 631, 11490, 14044, 9767, 1197, -4219, 1001, 4118, 658, -4741, -10988, -9992, -4627, -2973, -1861, -1540, -833, 2218, 4053, 5341, 6554, 5770, 3902, 1618, -632, -936, -475, -962, -2920, -4659, -4266, -2904, -161, 2017, 2214, 2603, 3329, 4471, 5882, 6583, 4865, 1957, 111, -617, -244, -389, -1053, -1255, -2731, -5292, -8241, -10817, -7082, 1459, 4363, 1808, -2775, -4135, 3708, 11154, 10777, 4478, -3810, -5119, -823, 1085, -737, -6026, -10039, -8010, -4180, -1382, -174, -1163, -482, 2077, 4277, 6573, 7425, 5507, 2196, -158, -387, 888, 1744, -164, -4484, -6443, -4570, -984, 2233, 1865, 302, 614, 2022, 4455, 5133, 3493, 1608, 83, 311, 1803, 1815, -76, -2003, -2561, -1300, 1083, 2566, 1916, 923, 1360, 1912, 2790, 2719, 93, -2177, -4510, -6487, -5547, -4561, -3435, -2007, -3046, -4011, -2981, -3, 3703, 4605, 2985, 144, -734, 2024, 3900, 3313, 277, -3755, -4219, -2538, -1398, -1075, -2440, -2946, -1527, 336, 2044, 1813, 1230, 1235, 1250, 2557, 3273, 2650, 1532, -138, -266, -91, -1064, -889, -651, -375, 780, -681, -2603, -1787, -459, 1227, 2112, 359, -1087, -357, 754, 1549, 2307, 1573, 402, 410, -112, 97, 1022, 25, -150, 404, -63, 122, -318, -1151, -1248, -1701, -1449, -227, 920, 390, -928, -1133, -437, 3181, 6508, 5775, 4528, 2478, 1249, 3451, 4330, 2388, -245, -3709, -5108, -3078, -2895, -6135, -10176, -12908, -9344, -40, 5367, 3991, 108, -2136, 3251, 11207, 12071, 6400, -2201, -5732, -1574, 2410, 1026, -5486, -10907, -10380, -4921, 731, 2199, 1263, 508, 1284, 4069, 5930, 5910, 4988, 3129, 837, -850, -1574, -2080, -2435, -3292, -4791, -3981, -1237, 1302, 2692, 1655, 66, 889, 3480, 5017, 4115, 1016, -2851, -4336, -3009, -1221, -499, -1674, -3302, -2532, 143, 3380, 5876, 6050, 5503, 5041, 3811, 2796, 1852, 408, -1267, -2509, -2896, -3522, -5116, -8038, -10764, -9175, -3495, 1836, 3428, 1047, -677, 3183, 8885, 10412, 6762, -583, -4644, -2283, 332, 216, -3649, -8640, -8063, -3146, 931, 2387, 972, 73, 2500, 5660, 6724, 5011, 1792, -544, -1043, -705, -1178, -2363, -3900, -5192, -4955, -3135, -193, 2463, 2924, 1719, 847, 1775, 3472, 4299, 3692, 1326, -958, -2053, -2571, -2097, -2026, -3011, -2933, -1717, -157, 1613, 1670, 1529, 3895, 6245, 6789, 4924, 1531, 934, 2045, 1498, -480, -3258, -3853, -2148, -2080, -4540, -8580, -9958, -6315, -389, 4003, 3466, 129, -1092, 2683, 8460, 9786, 5474, -1487, -4741, -2670, -347, -633, -4258, -7580, -6646, -3473, -141, 1616, 1229, 1221, 2104, 3543, 4867, 4079, 2256, 281, -1360, -1784, -2179, -2182, -2367, -3402, -3560, -2762, -366, 2532, 3553, 3117, 2164, 2000, 3070, 3711, 2671, 291, -1600, -2113, -2013, -1878, -2244, -2703, -1956, -688, 621, 1338, 1198, 1551, 1572, 1603, 1734, 813, 451, 173, 624, 2152, 2046, 1828, 1690, 1264, 2480, 2944, 1936, 494, -1237, -1680, -1516, -3141, -6080, -8370, -8924, -5798, -1032, 677, 611, -68, 977, 5549, 8443, 7882, 4666, 249, -735, 351, -207, -2428, -6032, -8451, -7118, -4224, -1796, -404, -356, 579, 2968, 4806, 6042, 6069, 4354, 2726, 1006, -969, -1419, -2145, -3619, -4438, -4839, -3688, -1466, -69, 569, 1164, 2028, 3445, 4605, 4035, 2713, 1098, -665, -1284, -1572, -2329, -2681, -2994, -2909, -1498, -104, 1383, 2564, 2310, 2427, 2690, 2710, 2726, 1532, 70, -1086, -2167, -2372, -2575, -2710, -2417, -2104, -1427, -331, 945, 1753, 2365, 2761, 2728, 2841, 2340, 1316, 293, -715, -1523, -2046, -2409, -2427, -1963, -1232, -272, 491, 846, 1152, 1490, 2053, 2373, 2198, 1464, 230, -534, -1345, -1961, -1899, -2679, -2812, -2584, -2095, 801, 2894, 3522, 3828, 3243, 3782, 4845, 4258, 2103, -232, -2172, -2450, -2222, -4787, -8027, -9999, -9138, -3649, 964, 1643, 865, 247, 3629, 9117, 10023, 6920, 1743, -2092, -1069, 348, -1459, -4879, -8259, -8503, -4906, -1825, -777, -367, 62, 2169, 5095, 5858, 5153, 3842, 1909, 1340, 722, -860, -1683, -2949, -4276, -4005, -3085, -1615, -43, 397, 431, 1457, 3228, 4737, 5008, 3375, 1173, -233, -723, -817, -1691, -3045, -3958, -3807, -2462, -796, 4, 562, 1535, 2251, 3119, 3646, 3183, 2462, 1605, 713, -191, -1352, -2593, -3263, -3265, -2716, -1999, -1569, -902, 159, 1326, 2582, 3313, 3178, 2693, 2196, 1321, 517, -288, -1526, -2215, -2465, -2735, -2559, -2259, -1675, -819, -15, 1074, 2014, 2162, 2021, 1729, 1395, 1547, 1355, 441, -484, -1401, -1528, -1011, -1004, -1337, -1447, -1182, -500, 171, 385, 504, 861, 1389, 1978, 1862, 1220, 604, 176, 406, 573, -139, -1332, -2033, -1746, -849, -122, -538, -1344, -1738, -1465, 891, 3857, 3870, 2598, 1641, 1578, 3722, 4499, 2419, -173, -1149, -358, -281, -2462, -6554, -9150, -8208, -4364, -631, -470, -2177, -2293, 1376, 7040, 9299, 6913, 2251, -702, 557, 2359, 872, -3066, -6728, -7287, -5135, -3106, -2499, -2536, -1694, 529, 3130, 4716, 5005, 4407, 3237, 2549, 2280, 1514, -412, -3130, -4595, -4209, -2838, -1596, -1405, -1758, -1393, 233, 2225, 3640, 3710, 2844, 2115, 1833, 1803, 1079, -544, -2136, -3189, -3041, -2241, -1734, -1329, -1279, -708, 697, 2120, 3250, 3233, 2559, 1661, 965, 667, 121, -736, -1775, -2212, -2231, -2261, -2028, -1629, -457, 520, 1158, 2147, 2342, 2299, 2463, 2276, 2099, 1392, 130, -921, -1419, -1542, -1669, -1944, -2135, -1805, -1108, -380, 337, 751, 860, 794, 1252, 2275, 2187, 1039, -7, -567, -286, -513, -1208, -2074, -2693, -643, 1721, 1998, 1315, 966, 2273, 4368, 5394, 3761, 1342, 395, 401, -49, -2806, -6697, -9217, -8578, -4947, -1680, -1431, -3430, -3466, 1226, 7614, 9984, 7002, 2391, 845, 2902, 4174, 1746, -3077, -6893, -7145, -5103, -3459, -3298, -3810, -3185, -625, 2944, 5486, 5658, 4408, 3148, 3390, 4552, 4082, 1582, -2030, -4326, -3922, -2764, -2790, -3981, -4258, -2819, -589, 1425, 2202, 2195, 2808, 3803, 4180, 3582, 2393, 933, -420, -1416, -1988, -2321, -3138, -3687, -3238, -2114, -612, 294, 571, 964, 1910, 2929, 3304, 2937, 1941, 798, -186, -721, -845, -1390, -2201, -2634, -2305, -1384, -643, -265, 576, 1618, 2195, 2230, 2001, 2098, 2213, 1881, 928, -378, -1262, -1567, -1524, -1646, -1818, -1846, -1503, -603, 149, 452, 611, 1110, 1792, 2144, 1695, 759, -59, -280, 1227, 1789, 561, -46, 281, 1710, 2546, 2152, 1443, 563, 362, 261, -1228, -4142, -7067, -8636, -7041, -3156, -1070, -2491, -4097, -1539, 4314, 8634, 7911, 4215, 2359, 3634, 5024, 3024, -826, -4496, -6570, -5837, -4594, -4153, -4262, -4412, -2925, 205, 3228, 4541, 4071, 3748, 4636, 5327, 4563, 2428, -63, -1667, -2108, -2459, -3272, -4269, -4713, -3966, -2427, -671, 463, 848, 1493, 2708, 4076, 4483, 3687, 2538, 1581, 1052, 302, -1227, -2796, -3693, -3386, -2446, -1870, -1482, -873, 266, 1654, 2634, 3245, 3139, 2459, 2106, 1943, 1244, -117, -1552, -2124, -2122, -2267, -2425, -2328, -1793, -773, 247, 847, 1191, 1582, 2224, 2892, 2807, 2069, 1186, 587, 119, -635, -1394, -1901, -2071, -2106, -2211, -1976, -1215, -245, 505, 1130, 1596, 2118, 2689, 2832, 2932, 3151, 2701, 1749, 901, 289, 157, 16, -255, -770, -1645, -2136, -3658, -5950, -7210, -5867, -1926, -540, -2574, -3765, -1286, 4088, 6639, 4980, 2543, 1873, 3484, 4373, 2779, -406, -3488, -4155, -3262, -2681, -3220, -4712, -4780, -2495, 743, 2654, 2089, 1201, 2065, 4451, 5948, 4743, 1877, -175, -159, 195, -701, -2140, -3525, -3982, -3039, -1832, -1293, -1459, -1282, 216, 2120, 3244, 3207, 2388, 1984, 2598, 3038, 2366, 456, -1584, -2001, -1370, -1144, -2023, -3250, -3044, -1720, -78, 1012, 831, 544, 1039, 2105, 3075, 2887, 1592, 424, 119, 238, 208, -590, -1890, -2351, -1869, -1334, -1227, -1414, -1233, -579, 332, 1137, 1414, 1395, 1315, 1531, 2171, 2135, 1320, 344, -415, -688, -566, -453, -820, -1491, -1821, -1113, 257, 1020, 1245, 1312, 1426, 1882, 2310, 2350, 2110, 1428, 617, -7, -814, -1870, -3023, -4556, -5789, -5333, -3543, -2304, -2581, -2835, -1605, 521, 2633, 3210, 2598, 2223, 2514, 3416, 3290, 2008, 649, -495, -828, -939, -1238, -1859, -2708, -2907, -2355, -1307, -523, -509, -484, 62, 1300, 2122, 1886, 1497, 1201, 1295, 1481, 1104, 444, -380, -793, -765, -769, -886, -1130, -1113, -874, -456, 156, 380, 445, 545, 842, 1353, 1464, 1176, 797, 557, 518, 418, 231, -181, -673, -867, -821, -705, -660, -748, -669, -445, -132, 274, 536, 560, 618, 759, 942, 1007, 777, 610, 565, 460, 353, 136, -24, -175, -359, -429, -407, -434, -515, -510, -291, 46, 199, 159, 246, 540, 811, 860, 799, 624, 473, 429, 462, 534, 460, 211, 47, 69, 263, 335, 164, -86, -414, -713, -944, -1124, -1096, -1168, -1524, -1929, -1977, -1543, -1140, -1174, -1288, -1194, -717, -245, -109, -71, -130, -41, 282, 542, 600, 298, 140, 343, 543, 594, 497, 487, 600, 633, 732, 754, 746, 782, 724, 662, 481, 253, 157, 22, -77, -186, -286, -313, -343, -421, -425, -334, -193, -67, -28, 11, 116, 189, 227, 202, 144, 162, 263, 275, 168, 73, 82, 135, 160, 78, -6, -26, -39, -41, -21, -6, -5, -54, -97, -116, -94, -40, -4, -20, -34, 17, 143, 180, 149, 190, 278, 320, 324, 356, 464, 469, 398, 390, 446, 469, 394, 289, 236, 233, 245, 210, 182, 123, 123, 110, 75, 73, 33, -76, -232, -462, -646, -823, -922, -926, -1029, -1240, -1408, -1396, -1196, -1064, -1010, -956, -843, -642, -470, -362, -266, -209, -139, -98, -41, 20, 77, 155, 175, 205, 311, 423, 569, 582, 573, 605, 632, 687, 681, 642, 604, 518, 454, 350, 249, 170, 139, 117, 34, -60, -75, -55, 6, 38, 50, 60, 86, 73, 85, 110, 103, 51, -13, -56, -57, -101, -152, -182, -156, -110, -87, -62, -16, 14, 46, 101, 199, 229, 222, 260, 321, 369, 393, 390, 479, 605, 695, 721, 708, 727, 749, 745, 710, 614, 550, 463, 334, 210, 107, 90, 58, -60, -212, -389, -448, -484, -595, -798, -1077, -1286, -1332, -1317, -1343, -1507, -1642, -1585, -1333, -1052, -933, -961, -921, -732, -467, -251, -163, -110, -59, -25, 45, 181, 344, 419, 432, 446, 581, 741, 874, 890, 860, 893, 966, 977, 912, 801, 733, 679, 604, 502, 420, 396, 351, 235, 131, 67, 63, 39, -20, -83, -65, -52, -43, -51, -45, 1, 5, -6, -9, -10, -3, -38, -44, -15, -3, 46, 83, 122, 168, 218, 327, 387, 425, 458, 498, 568, 595, 535, 395, 265, 205, 135, -38, -292, -543, -723, -851, -1046, -1246, -1387, -1471, -1524, -1612, -1650, -1585, -1457, -1310, -1226, -1106, -928, -701, -482, -282, -128, -39, -43, -29, 93, 170, 132, 91, 80, 154, 243, 288, 343, 408, 466, 598, 749, 878, 982, 1017, 1052, 1087, 1092, 1113, 1054, 944, 845, 769, 725, 642, 487, 395, 334, 317, 284, 215, 170, 165, 204, 188, 151, 84, 35, -16, -93, -138, -237, -347, -472, -536, -550, -613, -675, -748, -747, -708, -713, -654, -588, -547, -513, -444, -222, -44, 9, 71, 171, 261, 302, 342, 388, 424, 368, 335, 386, 429, 475, 516, 574, 654, 771, 960, 1230, 1312, 1280, 1367, 1157, 851, 543, 436, 398, 465, 512, 89, -308, -479, -390, -337, -582, -754, -913, -994, -907, -1015, -1229, -1511, -1633, -1365, -1256, -1410, -1781, -1844, -1405, -896, -636, -655, -675, -289, 203, 562, 697, 656, 630, 627, 674, 783, 597, 293, 127, 50, 152, 435, 816, 968, 736, 866, 1251, 1619, 1537, 1219, 1083, 958, 903, 894, 794, 580, 137, -50, -47, -26, -262, -766, -1017, -1054, -1252, -1803, -2317, -2546, -2999, -3703, -3878, -2801, -1828, -2225, -2313, -1548, -111, 495, 567, 731, 624, 693, 908, 1479, 1456, 580, -166, -288, 2, -5, -489, -890, -1046, -838, -394, 82, 301, 308, 405, 946, 1728, 2111, 1955, 1657, 1679, 1826, 1803, 1416, 871, 362, 194, 227, 223, 75, -156, -261, -205, 224, 490, 564, 442, 523, 850, 911, 887, 765, 690, 521, 339, 361, 214, -181, -574, -915, -995, -1310, -1617, -1789, -1795, -1606, -1646, -1643, -1563, -1218, -661, -350, -246, -288, -64, 333, 491, 397, 198, 94, -32, -55, 132, 157, -68, -214, 40, 532, 654, 609, 617, 869, 1141, 1376, 1536, 1394, 1143, 1165, 1219, 1058, 532, 7, -220, -555, -1026, -1588, -2124, -2645, -3206, -3780, -4122, -4451, -4333, -3911, -3192, -1913, -825, 189, 710, 1543, 2037, 2163, 1878, 1515, 1273, 873, 494, 106, -301, -634, -635, -460, -277, -212, -56, 368, 904, 1451, 1888, 2074, 2271, 2497, 2812, 2915, 2574, 2105, 1842, 1715, 1540, 1160, 760, 571, 399, 320, 324, 426, 333, 288, 411, 480, 427, 255, 270, 269, 226, -30, -320, -501, -527, -651, -962, -1437, -1618, -1658, -1267, -1408, -1464, -1389, -1256, -599, -645, -467, -546, 195, 553, 601, 594, 662, 835, 632, 434, 561, 595, 238, 120, 453, 763, 764, 610, 799, 1062, 1103, 1001, 956, 935, 831, 743, 712, 454, 233, 7, -63, -152, -379, -550, -665, -814, -915, -1023, -1123, -1335, -1518, -1601, -1608, -1813, -1945, -2002, -1962, -1938, -1928, -1642, -1228, -851, -680, -420, -79, 165, 273, 305, 382, 506, 661, 740, 907, 905, 956, 999, 1159, 1225, 1261, 1309, 1385, 1507, 1556, 1580, 1570, 1501, 1429, 1363, 1229, 1051, 908, 788, 703, 581, 435, 283, 192, 43, -154, -410, -663, -915, -1168, -1392, -1605, -1746, -1723, -1715, -1714, -1693, -1592, -1576, -1416, -1379, -1143, -857, -698, -329, -146, 141, 241, 289, 294, 309, 420, 380, 376, 410, 716, 874, 891, 879, 999, 1190, 1384, 1438, 1399, 1434, 1432, 1549, 1546, 1354, 1151, 1068, 1088, 1037, 768, 447, 300, 249, 203, 15, -285, -541, -754, -828, -895, -1077, -1310, -1646, -1772, -1852, -1927, -1941, -1971, -1985, -1876, -1575, -1318, -1240, -1139, -990, -462, -271, -189, -81, 70, 324, 446, 548, 636, 776, 932, 917, 901, 1019, 1097, 1105, 1028, 1157, 1278, 1370, 1319, 1275, 1280, 1188, 1131, 989, 931, 815, 666, 603, 519, 531, 403, 333, 231, 68, -81, -282, -403, -571, -772, -886, -935, -956, -1108, -1210, -1241, -1308, -1369, -1464, -1323, -1161, -1095, -1086, -1007, -857, -744, -581, -496, -443, -261, -42, 263, 247, 260, 486, 673, 816, 712, 590, 612, 733, 838, 856, 876, 871, 882, 913, 996, 999, 994, 855, 806, 759, 708, 618, 500, 345, 296, 190, 39, -147, -225, -268, -396, -602, -842, -863, -926, -960, -1001, -1001, -1066, -1155, -1187, -1046, -937, -945, -988, -913, -743, -714, -765, -747, -650, -481, -376, -310, -115, 110, 270, 280, 379, 543, 608, 682, 761, 777, 845, 797, 891, 915, 892, 795, 714, 714, 686, 725, 740, 671, 654, 577, 591, 482, 349, 219, 161, 69, -84, -189, -334, -355, -416, -444, -490, -634, -696, -763, -728, -707, -768, -888, -934, -783, -628, -614, -682, -642, -488, -395, -314, -262, -214, -143, -18, 124, 216, 247, 292, 378, 453, 477, 463, 466, 445, 405, 411, 458, 518, 483, 445, 463, 492, 501, 417, 395, 373, 284, 240, 250, 256, 159, 90, 27, 44, -9, -114, -186, -200, -200, -216, -301, -345, -414, -435, -424, -404, -421, -461, -476, -407, -316, -227, -212, -217, -211, -164, -88, -72, -105, -77, -12, 70, 73, 56, 85, 129, 163, 177, 164, 150, 159, 222, 258, 292, 285, 254, 247, 240, 241, 229, 184, 139, 102, 86, 35, 21, 19, 27, 16, -6, -41, -72, -91, -81, -92, -112, -159, -182, -215, -201, -177, -167, -160, -193, -206, -181, -152, -127, -110, -93, -95, -60, -54, -24, -6, 11, 46, 92, 75, 67, 74, 107, 149, 149, 127, 92, 63, 95, 101, 88, 52, 27, 18, 45, 66, 100, 84, 40, 15, 24, 39, 39, 7, 3, 1, 10, -1, -14, -45, -51, -53, -32, -38, -58, -61, -54, -48, -29, -31, -39, -60, -60, -37, -11, -19, -32, -28, -7, -4, 3, -2, -3, -8, 9, 27, 39, 27, 16, 18, 31, 38, 35, 17, 7, -6, -1, 0, 18, 7, 9, -5, 3, -9, -5, -2, 1, -6, -3, 7, 16, 14, 16, 10, 18, 6, 2, -3, 1, -6, -7, -10, -4, -16, -14, -18, -14, -13, -2, -5, -4, -8, 6, 13, 16, 2, 7, 6, 13, 8, 13, 14, 11, 7, 16, 21, 20, 7, 3, -10, -8, -13, -10, -16, -16, -23, -14, -20, -16, -17, -9, -6, -1, -6, 3, -1, 11, 20, 31, 19, 9, -1, 5, 0, 0, -7, -10, -21, -19, -21, -10, -14, -11, -17, -10, -9, -1, -2, 1, -6, -3, -10, -5, -10, -7, -11, -2, 0, 4, -1, 2, 0, 7, 6, 11, 6, 12, 4, 8, 3, 7, -4, -7, -15, -9, -11, -4, -6, 2, 0, 10, 13, 21, 19, 25, 21, 24, 17, 23, 17, 15, 5, 7, 3, 3, -3, -1, -5, 2, -3, 1, -4, -2, -8, -5, -12, -10, -16, -13, -20, -15, -17, -11, -14, -7, -8, -2, -5, 0, -3, 1, -3, -1, -5, -1, -6, -3, -10, -7, -14, -8, -11, -6, -9, -2, -2, 7, 5, 13, 9, 14, 10, 14, 10, 14, 9, 12, 7, 10, 5, 10, 4, 7, 2, 5, -1, 3, -4, 0, -7, -4, -11, -9, -14, -12, -17, -13, -17, -12, -16, -9, -13, -7, -10, -4, -6, 1, -2, 3, 0, 5, 1, 5, -1, 3, -1, 3, -1, 4, 0, 4, 1, 6, 3, 9, 6, 10, 5, 9, 4, 8, 3, 5, 1, 4, 0, 4, -1, 3, -1, 3, -1, 3, -1, 2, -2, 2, -3, 1, -4, -1, -5, -1, -5, -1, -5, -1, -5, -1, -4, -1, -4, -1, -4, 0, -3, 0, -3, 1, -2, 2, -1, 2, 0, 3, 1, 4, 1, 4, 2, 4, 2, 4, 2, 4, 2, 3, 1, 3, 0, 2, 0, 2, 0, 1, 0, 1, 0, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t fx_wizard_pcm[fx_wizard_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 2, -1, 2, -2, 2, -1, 1, -1, 2, -2, 2, -1, 3, -1, 2, -2, 3, -1, 1, -3, 2, -1, 1, -4, 2, -2, 0, -4, 1, -3, 0, -3, 5, 0, 4, -1, 4, 1, 2, -3, 0, -7, 2, -3, 0, -3, 3, 1, 2, -6, 5, 2, 3, -3, -1, -4, -1, -5, 5, -8, -4, -3, -2, -6, -2, -8, 1, -3, 0, -13, -9, -1, 9, 6, 13, 0, 4, 8, 11, 2, -2, -8, 5, -1, 2, -6, 3, 12, 14, 4, 2, -11, 4, 9, 8, -6, -1, 1, 4, 2, 14, 1, -2, 3, 12, -7, -11, -10, 7, 0, -5, -13, 1, 5, 14, 4, 8, 9, 11, 2, 1, -9, 0, -15, -12, -12, -15, -16, -10, -6, 2, -8, 3, 9, 19, 3, -7, -13, 7, 9, -4, -26, -17, 1, 4, -24, -8, 6, 3, -3, 5, -15, -17, -6, 22, 4, -22, -19, -12, 6, 37, 7, 5, 0, 11, 12, -17, -27, -9, 4, 23, -10, -1, 24, 34, 53, 58, 7, -1, 3, 18, 13, 2, 4, 3, -2, 19, -25, -18, 10, -5, -15, -11, -22, -12, -18, 20, 11, -22, -6, 12, 6, 11, -14, 19, 10, -29, -34, -37, -32, -7, -19, 3, 1, 38, 65, 27, 6, 15, 5, -8, -28, -11, -29, -43, -29, 18, -13, -57, -37, -3, -2, -29, -49, -1, 29, 57, -5, -54, -13, 3, -17, 19, 24, 9, 0, 26, 44, 14, 3, 8, -23, 16, -20, -34, 14, 65, 107, 72, 19, 11, 43, 82, 1, 9, 37, -26, -94, -45, 7, -44, -50, 15, -10, -15, 13, 28, 33, 47, 17, -23, -64, -41, -41, -3, 49, 15, 9, 14, -30, 1, -14, -40, -68, -69, -41, 6, 31, 59, 46, 90, 122, 16, -17, -26, -96, -52, -93, -87, -117, -120, 33, 8, -71, 27, 62, 72, 14, 39, 107, -72, -110, 108, 53, 9, -43, -30, 30, -19, 83, 52, 28, 105, -87, -144, -18, 61, 39, 39, 36, 120, 172, 80, 112, 191, 264, 74, -129, -124, -148, -177, -23, -55, -152, -3, -194, -235, 168, 342, 13, 29, 268, 138, -309, -111, 162, 190, -68, -564, -352, -115, -53, 20, 25, 72, -107, 13, 166, 170, 159, 169, 123, -24, 155, 21, 11, 112, 101, 305, 374, 390, -19, -393, -139, -20, -188, -251, -124, 177, 335, 511, 477, 275, 261, 411, 231, 727, 607, 1161, 2958, 1265, -944, -412, 7, -495, -1404, -1064, -324, -1154, -401, 358, -234, 41, -490, -317, -266, -1289, -719, -383, -242, 96, -368, 470, 981, 954, 2034, 966, -370, -512, -582, 494, 855, 1019, 663, 668, 1516, 1674, 1495, 655, 656, 1706, 1391, 526, -548, -964, 233, 688, -478, -5210, -10643, -16623, -13883, 2900, 8719, 4364, 2359, 3137, 5651, 3030, 846, -4314, -12745, -10179, -1509, 2438, 3713, 3215, 3742, 5463, 3322, 2395, -832, -4497, -1795, 1189, 2638, 1929, 1435, 2319, 3541, 4918, 2719, 135, 757, 1657, 1820, 1859, 1432, -737, -5256, -10315, -13540, -15024, -11535, 1198, 10045, 7871, 4331, 3476, 4599, 2356, -2233, -5613, -9737, -8970, -1847, 5107, 8269, 6846, 5098, 5786, 5091, 2711, -2198, -5646, -3781, -1749, 2230, 5191, 4234, 4252, 3979, 3975, 2058, -1964, -2508, -1968, -876, -471, -5444, -12037, -17306, -16036, -605, 12323, 8695, 3249, 2042, 2355, 2697, 1573, -2310, -9492, -9804, -2338, 3630, 7296, 9020, 6626, 4027, 4479, 3290, -207, -3909, -3643, -341, 1390, 4132, 4949, 3810, 3550, 2644, 158, -2910, -3727, -4327, -3752, -4432, -8431, -12452, -10491, 2597, 10265, 6717, 2719, -885, -429, 1037, 957, -2364, -8736, -8249, -3052, 2284, 7340, 9015, 6628, 3472, 2828, 2762, 1009, -1040, -2108, -2467, 51, 4711, 6362, 4779, 2977, 1602, 151, -2742, -3820, -4687, -9567, -9917, -9435, -11353, -433, 11182, 10207, 7213, 1780, -2530, -2331, -2835, -5394, -8491, -7958, -3465, 4216, 9457, 9180, 8267, 5788, 2509, 1124, -1773, -3231, -428, 1619, 3720, 6459, 6326, 4089, 1269, -1149, -1170, -1132, -4348, -9172, -12282, -11277, -13227, -7764, 10058, 14207, 7082, 3280, 1109, -663, -3078, -5106, -7927, -10383, -5681, 2344, 8185, 12695, 10337, 4888, 2104, 919, 1552, -693, -2161, -95, 1709, 4475, 6516, 5552, 1700, -581, -1252, -4328, -6469, -8557, -10286, -12031, -17613, -6812, 11862, 13055, 10772, 5029, 292, 142, -4725, -6737, -12180, -13972, -3062, 6132, 10751, 12233, 10225, 6902, 4629, 3847, -248, -5121, -2510, 3339, 5794, 6501, 4520, 641, -202, -1631, -3184, -3791, -8364, -12988, -16895, -16043, -2012, 12191, 11991, 5469, 1674, 1292, 1377, 599, -4856, -13581, -13406, -3534, 6660, 10509, 8472, 7231, 7295, 6248, 4140, 867, -1329, -1730, 1128, 4405, 5584, 4852, 1883, -819, -2115, -3720, -8361, -11896, -12021, -16286, -13023, 4362, 14509, 13401, 6771, 1491, -3, -1573, -3680, -8669, -12798, -9759, -1557, 8998, 14399, 10887, 6818, 5416, 4675, 2231, -1547, -3461, -2826, 518, 4185, 6834, 5485, 777, -1618, -3836, -6370, -10039, -14687, -16633, -12355, 84, 12268, 15984, 10491, 3271, -1392, -1619, -3326, -9997, -13241, -9973, -1972, 9335, 15214, 12404, 6962, 1976, 1934, 3115, 704, 384, 315, 910, 4481, 6110, 4989, -165, -5802, -9666, -10505, -10034, -13651, -12979, -2969, 7377, 12991, 13674, 9023, 19, -4930, -3881, -6449, -10676, -11076, -5012, 3408, 9182, 12789, 11104, 4871, 636, -315, 428, 1065, -194, 1311, 4785, 6336, 5393, 1424, -2713, -7809, -13274, -16971, -17767, -10506, 1876, 11691, 15221, 12556, 7503, 2934, 577, -3609, -10356, -13242, -10567, -4939, 2697, 10713, 13031, 8064, 3710, 3265, 673, -2336, -2161, 569, 4253, 4437, 4365, 4106, 1527, -2709, -8838, -14633, -19354, -18773, -5747, 7747, 12886, 12790, 10943, 8546, 3230, -1965, -7899, -13398, -12337, -5739, 1840, 7307, 10430, 10078, 6318, 3266, 2586, 313, -2864, -3138, 703, 4609, 5109, 4470, 1393, -2831, -6605, -11957, -15204, -15609, -9894, -68, 8472, 14559, 13937, 9954, 4051, -2213, -7278, -11454, -11340, -7253, -1319, 6238, 10542, 11428, 9004, 4868, 1081, -2989, -3425, -516, 1066, 3645, 3784, 3124, 1734, -1136, -5971, -12042, -17324, -18023, -8521, 1882, 8800, 12979, 11892, 9699, 5201, -1066, -6578, -11560, -11593, -6144, 669, 7324, 9931, 10017, 8767, 4518, 195, -1680, -1853, -1567, 119, 2064, 5111, 5274, 1294, -3795, -10107, -14939, -15468, -11088, -3207, 2662, 6906, 10090, 10913, 8506, 3536, -2258, -7894, -11129, -8894, -2334, 3018, 6997, 9607, 9001, 6482, 2959, 929, -1081, -3056, -1512, 2190, 4422, 4775, 3426, -1687, -8955, -14264, -14921, -11832, -4953, 1476, 5896, 9293, 10013, 9153, 5120, -1918, -8776, -11168, -8189, -3553, 1686, 6692, 8840, 9193, 8022, 5291, 1697, -2103, -2975, -977, 940, 3728, 5060, 3534, -1880, -9332, -13783, -14275, -11683, -3980, 2365, 5844, 6781, 9307, 9680, 5278, -479, -7887, -11970, -9176, -4104, 3090, 7613, 8208, 7513, 5668, 4233, 2415, -236, -1543, -1405, 1612, 4314, 4996, 2310, -5174, -11397, -12757, -12321, -8148, -2276, 2306, 6065, 7349, 9382, 9265, 3651, -4144, -8887, -9754, -6704, -2228, 2658, 6637, 7985, 7281, 5731, 2928, 849, -535, -151, 1063, 2478, 4197, 3340, -754, -7983, -13150, -13583, -11542, -3869, 2199, 5983, 7096, 7464, 9098, 5530, -1214, -6616, -9889, -7825, -3722, 1122, 5306, 6632, 7200, 6316, 4313, 1845, -601, -1170, -336, 2001, 3699, 3198, 333, -6465, -11852, -12799, -10769, -4642, 1596, 5408, 6480, 6922, 8050, 6289, 1016, -5238, -9135, -8821, -4726, 471, 4926, 6909, 7775, 6983, 4951, 2197, -523, -1601, -970, 1264, 3030, 2571, -1167, -8727, -12803, -11667, -9307, -3035, 2185, 5384, 6087, 7048, 8557, 4757, -695, -5959, -8577, -6367, -2100, 2355, 5594, 6055, 6796, 5845, 3808, 1566, 32, -973, -930, 1435, 3122, 1925, -3514, -10898, -12996, -11808, -7837, -558, 3286, 5361, 7015, 6958, 8361, 4047, -792, -6093, -7197, -5157, -1570, 2118, 4560, 6204, 6378, 5427, 4087, 1531, -206, -1265, -911, 1161, 902, -852, -5178, -10724, -10301, -7332, -3926, 62, 2847, 4252, 5237, 5336, 5067, 2295, -1906, -4534, -3721, -1837, -173, 3505, 5034, 5676, 4725, 3224, 2551, 870, -559, -251, -552, -1100, -2060, -5839, -8482, -9239, -7607, -3511, 776, 3124, 3788, 4847, 4821, 4185, 1923, -1128, -3240, -2852, -1831, 99, 3098, 4891, 6132, 4920, 3506, 2995, 1258, -294, -1260, -2563, -3320, -4132, -7129, -8416, -7642, -5497, -1202, 2720, 3929, 4526, 3993, 4017, 3070, 119, -2502, -3371, -2262, -84, 2290, 4438, 5660, 5662, 4729, 3336, 2013, 280, -878, -2345, -4157, -4453, -6045, -7629, -7695, -5263, -2200, 442, 2873, 3776, 4078, 3493, 3639, 2159, -469, -2173, -2013, -1250, -160, 2535, 4143, 5406, 5367, 4152, 3688, 1591, -239, -1622, -3953, -6272, -8110, -7502, -6794, -5972, -2442, 2372, 4351, 4808, 4397, 3386, 2366, 471, -1243, -1636, -2496, -2171, 610, 2781, 4754, 5510, 4723, 4701, 3235, 1302, 18, -1874, -3256, -5176, -6397, -6751, -6911, -5179, -3536, 286, 2970, 4495, 4741, 3505, 2737, 1339, -170, -944, -2533, -2309, -757, 1486, 3876, 4877, 5119, 3919, 2780, 2149, 1044, -1062, -3553, -4560, -6226, -7148, -6661, -6037, -3220, 488, 2470, 4505, 4706, 4204, 3046, 1345, 379, -1125, -2205, -2123, -578, 2040, 3044, 4124, 4459, 3509, 3124, 1543, 205, -1902, -3556, -4039, -5157, -7292, -6425, -5650, -4098, -762, 1866, 4739, 5002, 4254, 4530, 3088, 1384, -483, -1131, -1361, -1820, 200, 2601, 3896, 4102, 3848, 3607, 2243, 540, -1204, -3180, -4760, -5642, -6314, -6469, -5800, -5233, -2783, 596, 3607, 4991, 5598, 4766, 4204, 2902, 1390, -12, -1672, -1551, -1083, 496, 2510, 3172, 3870, 3898, 3246, 947, -1411, -3120, -5118, -5571, -5876, -6209, -6181, -5883, -2798, -95, 2367, 4184, 4687, 4760, 4535, 3624, 2843, 1750, -345, -1392, -1079, 290, 2002, 2843, 3217, 3674, 3013, 1517, -661, -2403, -3615, -5034, -5974, -5849, -6520, -6619, -4704, -1376, 1812, 3629, 4778, 5093, 5055, 4447, 3409, 1904, -154, -1537, -1284, 159, 1039, 1748, 2827, 2618, 2706, 1328, 346, -1334, -3391, -3798, -4129, -4472, -4743, -5542, -4468, -2577, -542, 1762, 3170, 3407, 3568, 4168, 3486, 2423, 702, -105, -367, -175, 27, 863, 1399, 2043, 2522, 1736, 569, -672, -1929, -2289, -2631, -3070, -3043, -3663, -3476, -2304, -1774, -350, 1039, 1790, 2396, 2295, 2186, 1734, 893, 583, -66, 148, 554, 848, 1568, 1529, 1820, 1349, 499, -394, -1388, -1805, -1884, -1681, -1433, -1597, -2129, -1971, -1549, -1242, -308, 317, 753, 1272, 1371, 1429, 1315, 1066, 1062, 560, 15, 290, 510, 392, 572, 637, 855, 509, -40, -159, -199, -661, -828, -931, -1504, -1482, -1414, -879, -123, -148, 100, 158, 42, 258, 826, 814, 464, 13, 250, 619, 568, 518, 131, 197, 224, -76, -274, -562, -428, 149, 374, 355, 185, -341, -518, -579, -657, -674, -716, -844, -265, 20, 190, 505, -26, -17, 430, 255, 443, 573, 159, 425, 487, 366, 207, -275, -256, -317, -678, -414, -182, -105, -132, -329, -288, -67, -488, -670, -565, -770, -401, -473, -488, -416, -402, -213, -117, -155, 149, -117, -396, -292, -398, -596, -177, -241, 206, 427, 429, 564, 294, 258, -63, -207, -549, -348, -35, 471, 296, 265, -19, -143, 83, 30, 55, -63, 31, 189, 43, 129, -182, -163, -116, -237, -132, -110, 147, 422, 193, 109, -57, -256, -175, -342, -584, -593, -494, -208, 351, 143, 2, 161, 58, -36, -42, -92, 67, 180, 21, 106, 400, 640, 892, 775, 601, 636, 384, -56, -278, -478, -443, -407, -273, -221, 79, -53, -17, -109, -203, -351, -51, 58, 385, 637, 474, 462, 52, 226, 62, 248, 182, 232, 363, 360, 543, 435, 24, 27, -81, -343, -427, -464, -314, -83, -93, -35, 259, 404, 442, 467, 390, 204, 257, 173, 305, 377, 357, 179, 272, 344, 303, 208, 245, 273, 128, -22, -68, -87, -234, -353, -337, -271, -277, 114, 193, 387, 667, 746, 953, 812, 539, 382, 306, 77, -185, -265, -32, 65, 265, 190, 307, 470, 183, 96, -54, -153, -204, -258, -304, -2, -96, -156, 151, 133, 241, 276, 136, 146, 17, 16, 61, 172, 107, 243, 142, 210, 63, 99, 56, 94, 56, -68, 75, 5, -36, -219, -72, -122, 8, -104, 5, 118, -5, -40, 14, 66, -20, -140, -94, -60, -119, -79, -201, -131, -69, -28, -150, -52, -181, -164, -121, 27, -131, 39, -103, -138, 304, 100, 286, 25, 308, 241, 312, 16, -80, 82, -24, -101, -31, -20, 29, -101, -281, -304, -386, -604, -213, -414, -193, -327, 29, 316, 375, 265, 277, 129, 71, 181, 174, 135, -14, 151, -63, 175, 25, -71, -390, -5, -164, -136, -319, -270, -325, -339, -371, -387, -273, -258, -206, 181, 203, 122, -20, 94, -7, 155, 267, 337, 73, 232, 339, 187, 314, 126, -330, -99, -122, -335, -201, -433, -203, -306, -98, -295, -169, -230, -90, -152, -154, -46, -184, -80, 7, 48, 26, 202, 407, 432, 275, -52, 135, -161, -85, -94, 31, -5, -70, 80, -256, -309, -472, -276, -101, -354, -131, -419, -387, -276, -54, 191, 184, 293, 275, 245, 270, 343, 182, 136, 21, -53, 61, -76, -47, -24, 88, -143, -294, -79, -140, -112, -295, -101, -174, -251, -445, -304, -323, -156, 9, 116, 208, 336, 409, 294, 421, 238, -3, -235, -177, -110, 12, -12, 198, 141, 85, 240, -17, 156, -256, -363, -181, -443, -266, -229, -199, -61, 212, 154, 239, 2, 169, 94, -14, 36, 28, 251, 13, 83, 144, 96, 100, 36, -16, -258, 24, 183, 53, 109, -145, -169, 48, -270, -174, -351, -182, -84, -27, 15, 191, 56, 367, 148, -128, 220, 95, 11, -184, 38, 53, 213, 187, -229, -120, -262, 113, 182, 129, -37, 28, 264, -26, -120, 144, -192, -205, 133, -192, 263, 85, 38, 319, -175, 88, -208, -330, -295, -408, -158, 66, 5, 213, -116, 142, 94, 9, -23, -79, -152, 23, 212, -98, 130, 365, 114, 40, 12, 31, 93, -79, -87, -369, 112, 39, 45, 41, -341, 7, 131, 165, 144, 178, -82, 65, -109, 168, 42, -415, -151, 61, 209, -54, -22, -74, 171, 294, 104, -15, -84, 83, -93, 110, 57, -72, 49, 43, 128, 108, 131, 85, -142, -62, 18, -240, -10, -136, -291, -67, -77, -70, -1, -141, 117, 360, 182, 255, 83, 245, 358, 33, -67, -122, 180, -78, -9, 77, -41, -95, -92, 186, 129, -108, -154, -368, 15, -11, -328, -133, -243, 177, -211, -52, -184, 7, 23, 45, 48, 523, 386, 128, 112, 26, 79, 394, 82, -86, -61, 73, 232, 58, -28, -76, 71, -17, 30, -278, -337, 42, -170, -220, -423, -127, -301, -330, 55, 96, 284, 206, 221, 537, 583, 163, 154, 160, -181, 346, 265, -52, -205, 67, 104, -145, -213, -111, -240, -125, -65, 183, -109, -245, 266, 84, -356, 46, -212, -250, 437, 129, 168, -302, 173, 24, -78, 202, 21, -148, -8, 88, 360, 112, 138, 50, 60, 144, 30, -160, 173, 74, 102, 237, -25, -323, 248, -97, 10, -230, -40, 78, -171, -79, -161, -72, -48, -108, 132, 226, -151, 207, 429, 190, 61, -148, 361, 77, 33, -255, -211, 131, 69, 68, -308, -208, -411, -26, -619, -8, -268, 138, 58, -128, -131, -204, -108, 65, -21, 45, -131, 94, 109, 245, 490, 256, 189, -1, 169, 124, -87, -188, -80, -139, -623, -69, 440, 159, -205, -344, -361, -159, 819, 533, -46, -801, -200, 808, 1027, 201, -798, -257, 724, 326, -274, -580, -446, -75, 441, -88, 177, -347, -254, -666, 249, 313, -377, -670, -460, 222, 2, 157, -70, 23, -230, -205, -405, -88, 406, -168, -458, -215, -501, 288, 133, 475, -502, 120, 228, 426, 334, 3, -33, -28, 66, -66, -175, -532, -165, -44, -138, -16, -49, -196, 170, 20, -199, -383, 157, -172, -181, 18, 14, -81, 167, 30, 256, 19, -427, -194, -158, -287, -25, -129, -603, -486, 282, -379, -529, -472, 70, 461, -158, 410, 74, 18, 303, 240, 274, 112, 246, 66, 421, 556, 468, 222, 70, -36, 117, 87, -429, -216, -358, -480, -375, -439, -433, -737, -107, -160, -238, -314, -208, 64, 156, 317, 114, 235, 538, 343, 33, 866, 707, 672, 551, 479, 662, 884, 1043, 214, 43, 203, -34, 64, -682, -1327, -1635, -1406, -1601, -2057, -2079, -2190, -1562, -1319, -895, -736, -543, 158, 1315, 1567, 2229, 1842, 2118, 2633, 2725, 2845, 1626, 1885, 1168, 1206, 1638, 809, -487, -521, -1276, -1505, -2468, -3167, -4010, -5196, -6173, -6500, -4680, -3125, -2502, -975, 1059, 2461, 4458, 5510, 6491, 5438, 3534, 2303, 1982, 1675, 1307, 438, 582, 383, 2338, 3090, 3423, 2351, 656, -521, -1387, -2958, -4406, -6714, -8792, -8980, -6766, -3560, -2348, -424, 1572, 4572, 6623, 7271, 7670, 6599, 3665, 1080, 734, 794, 214, -1232, -1239, 852, 2257, 3907, 4794, 4000, 2615, 1952, 1205, -263, -3009, -6014, -8062, -8576, -10844, -10659, -6648, -3109, -705, 1218, 4163, 7766, 8466, 7590, 6693, 4524, 1736, -1642, -1820, -1126, -2249, -2608, -1093, 1801, 4858, 5857, 6168, 5660, 3855, 2318, 1856, -798, -4833, -8543, -10444, -10765, -11936, -12832, -7497, -1504, 1836, 3415, 5929, 10863, 11354, 8966, 7318, 3878, -538, -3876, -4749, -3735, -3599, -4450, -2577, 1974, 5515, 7414, 7652, 6817, 5951, 3498, 1447, -815, -5340, -8623, -10236, -11949, -12715, -14226, -9462, -1290, 1727, 5201, 6230, 9699, 12700, 10500, 8365, 3373, -704, -5166, -7344, -5593, -5154, -4515, -3340, -380, 5112, 8906, 11143, 8883, 6013, 5685, 3124, 767, -3949, -9273, -10632, -11858, -12572, -14146, -14589, -4819, 2769, 4115, 6433, 8941, 13648, 12751, 8079, 5548, 276, -4955, -8015, -7180, -5215, -5760, -4643, -289, 4826, 8627, 10445, 11074, 8975, 6040, 4832, 2011, -1194, -6533, -10540, -11697, -12214, -12234, -14954, -14188, -2596, 4891, 6340, 6727, 7449, 13614, 12817, 8118, 4637, -2568, -7105, -8345, -5818, -3863, -5607, -4149, 672, 7135, 12287, 11939, 9786, 7590, 5201, 4157, 929, -3187, -7855, -10634, -10864, -11481, -11529, -14087, -13124, -2368, 5824, 7874, 5872, 5514, 11234, 12317, 8244, 2708, -4079, -7864, -8365, -4396, -3004, -4816, -3055, 2059, 8739, 12491, 11768, 8546, 5487, 4768, 3939, 807, -3212, -7617, -9441, -8328, -7379, -9699, -12098, -13440, -6724, 5609, 7780, 4877, 3254, 6325, 10881, 9314, 4825, -2297, -8198, -8646, -5298, -2230, -3780, -4378, -4, 6412, 11247, 11766, 9924, 6241, 2974, 4393, 3641, -1492, -6054, -7396, -6158, -5643, -6323, -8448, -11038, -11053, -4646, 5270, 6836, 2791, 1790, 5879, 10063, 8221, 3333, -3221, -8332, -7792, -4894, -2103, -3581, -3828, 1305, 6397, 10916, 11569, 8650, 5510, 3083, 3997, 3524, -2032, -5808, -5442, -4292, -4271, -5080, -6178, -9146, -10875, -7689, 905, 6517, 3393, 948, 3403, 8094, 8628, 4986, 279, -5768, -8088, -5571, -1828, -1834, -4569, -2267, 3522, 8574, 11320, 8523, 5997, 3402, 2682, 4963, 1995, -2936, -5184, -4631, -2500, -2635, -4423, -7547, -10305, -11203, -5994, 4497, 5824, 1392, 850, 4626, 9710, 8020, 3378, -2685, -8363, -7781, -3753, -1332, -3504, -4967, 564, 6804, 10099, 10293, 7484, 4633, 2728, 3955, 3239, -1085, -4773, -5010, -2723, -2343, -2967, -5754, -8979, -10093, -8759, 928, 6598, 2449, 528, 2214, 7725, 8588, 4547, -266, -6168, -7928, -5695, -1928, -1567, -4562, -1744, 4936, 8759, 9674, 7705, 5331, 2963, 2068, 3126, 625, -3124, -4033, -2293, -1005, -1299, -3682, -6841, -8537, -10233, -6274, 3577, 4273, 301, 301, 4946, 9825, 7434, 2151, -3129, -6419, -6599, -4565, -2719, -4199, -4299, 1335, 7450, 9968, 8811, 6407, 4538, 2678, 2982, 1808, -2270, -4566, -3542, -2166, -1237, -1725, -4818, -7001, -8472, -9212, -1326, 5742, 3125, -81, 621, 7164, 9524, 4776, -426, -5259, -6089, -5353, -3136, -2008, -3997, -2033, 4380, 9295, 9695, 6362, 5259, 3637, 2129, 2804, -89, -3565, -4524, -3278, -651, -1022, -3434, -5315, -7194, -9040, -8654, 709, 5595, 1444, -32, 3117, 9493, 8165, 2653, -1139, -5003, -5905, -5502, -3498, -2783, -3673, 225, 6539, 9343, 8593, 6825, 5301, 3106, 2173, 1521, -1370, -4342, -4176, -2341, -1525, -2249, -3664, -5372, -7684, -9838, -5734, 3751, 4446, 1071, 177, 4957, 9438, 6241, 2154, -3108, -5757, -5810, -4735, -1990, -3303, -2681, 2292, 7408, 10034, 8195, 6033, 4369, 2434, 1729, 304, -2383, -3528, -3201, -1556, -1199, -2345, -3682, -6461, -8016, -9444, -3521, 4138, 2551, 604, 589, 6314, 8825, 4366, 138, -4606, -5708, -5064, -3363, -1665, -3293, -814, 4934, 9547, 9884, 7053, 4892, 3392, 2133, 970, -793, -3297, -3951, -2948, -1206, -1095, -2276, -4934, -7035, -8980, -8318, 367, 3705, 1224, -755, 2138, 8722, 7266, 2966, -1401, -4288, -4693, -5302, -2292, -2053, -3552, 564, 5671, 9662, 8216, 5746, 5085, 4205, 3176, 827, -1982, -3221, -3809, -2001, -573, -1335, -2742, -6050, -7442, -9109, -5446, 2262, 1137, -1148, -582, 5511, 9564, 5727, 1802, -1850, -3405, -4520, -3489, -1508, -3766, -3651, 1691, 6599, 8023, 5993, 4914, 4924, 4606, 3042, 592, -1535, -2946, -1835, -823, -1037, -2765, -4932, -6535, -8188, -9609, -3377, 1660, 438, -513, 1718, 8539, 8892, 4543, 309, -1763, -2921, -4021, -2970, -3081, -4211, -1778, 3368, 6567, 6498, 4634, 4658, 5236, 4756, 2499, -433, -2282, -1609, -608, -397, -1713, -3677, -5342, -7075, -9838, -9585, -2081, 513, -438, -524, 4224, 10218, 8158, 4404, 1155, -669, -3176, -3932, -2997, -4198, -4766, -1403, 3435, 6087, 5089, 5112, 6251, 5746, 4422, 1711, -102, -1403, -1150, -574, -704, -2352, -4307, -6140, -7923, -10567, -7029, -784, -584, -953, 419, 7202, 10053, 6604, 3257, 729, -1157, -2901, -2829, -3665, -5419, -4575, -12, 4068, 4559, 3775, 4804, 5872, 5537, 3892, 1732, -181, -348, 527, 820, -682, -2831, -4521, -6551, -9554, -11220, -5864, -1687, -1354, -1288, 1614, 9148, 9905, 6869, 3438, 289, -772, -2717, -2500, -4541, -5906, -3380, 342, 4024, 3893, 3502, 4790, 5537, 5970, 3147, 533, -347, -134, 1042, 145, -1004, -2179, -4160, -6523, -10448, -9677, -4187, -1217, -964, -1837, 2770, 8866, 9239, 5875, 1873, 347, -977, -2331, -3294, -5167, -4918, -2825, 1097, 3453, 3706, 4750, 5622, 7048, 5147, 2798, 876, 455, 368, -374, -1027, -1638, -2307, -4559, -7868, -11127, -9237, -3354, -1073, -1925, -2532, 3334, 10281, 9738, 5227, 1399, 1076, 518, -1951, -3436, -5603, -5049, -2851, 220, 2422, 2546, 4043, 5189, 6282, 5635, 3690, 2233, 1187, 1155, 857, -14, -979, -2987, -4985, -8091, -11477, -8669, -4157, -2132, -3523, -2543, 4943, 9397, 7974, 4121, 2521, 2457, 684, -1635, -2956, -4411, -4458, -3067, -253, 1561, 2348, 4167, 5222, 5396, 4523, 3821, 3398, 2155, 1658, 1025, 406, -735, -3052, -4630, -8134, -11079, -8455, -5558, -3275, -4657, -2316, 4329, 7410, 7895, 4564, 3776, 3487, 1762, 45, -2835, -3980, -4698, -2976, -568, -200, 1188, 2509, 4533, 4730, 4268, 4283, 3476, 3180, 2660, 1826, 1295, -550, -2023, -4394, -7597, -10426, -9435, -6580, -4541, -5083, -3034, 2271, 5893, 6931, 4560, 4728, 4723, 3626, 1419, -992, -1767, -2445, -1638, -1222, -793, -52, 597, 2284, 2882, 3064, 3091, 3285, 3629, 2992, 2794, 2929, 1612, -858, -4246, -7000, -9176, -8640, -7231, -6501, -6759, -4739, 47, 3724, 4542, 2822, 3721, 5187, 5476, 3708, 1413, 1129, 852, 820, 9, -225, -393, -662, 507, 792, 1491, 1771, 2238, 2314, 2168, 2797, 3014, 1849, -403, -2483, -3994, -5611, -6592, -6125, -5726, -5526, -5391, -2841, -107, 1009, 581, 1162, 3151, 4088, 3808, 2540, 2946, 2897, 2414, 1819, 1645, 1154, 247, 469, 549, 602, 190, 247, 872, 1072, 903, 688, 814, 389, -427, -1327, -2279, -2959, -3573, -3595, -3139, -3238, -3234, -2740, -1419, -527, -856, -649, 210, 1371, 1464, 1307, 1509, 1977, 2388, 1974, 1982, 1855, 2020, 1577, 1331, 1345, 848, 807, 394, 184, 208, 342, 426, 201, -194, -233, -277, -441, -912, -1008, -977, -1078, -1098, -1227, -1217, -1356, -1366, -1323, -1142, -989, -743, -596, -293, -135, 273, 544, 588, 694, 684, 1148, 992, 924, 791, 648, 707, 562, 891, 691, 253, -2, 293, 778, 741, 317, 182, 283, 354, 183, -320, -548, -527, -619, -543, -441, -337, -463, -540, -314, -106, -63, -195, -256, -244, -382, -377, -369, -379, -440, -590, -401, -417, -536, -442, -260, 144, 236, 280, 367, 378, 273, 276, 233, 167, -115, -268, -45, 64, 100, -64, 75, 152, 366, 481, 389, 390, 179, 274, 269, 238, 137, 0, -228, -180, -301, -181, -386, -661, -607, -781, -489, -479, -329, -213, -185, -89, -173, -181, -172, -157, -172, -243, -86, -23, -40, 69, -48, 186, 77, 167, 172, 202, 314, 240, 265, 113, 340, 278, 360, 434, 358, 235, -14, 6, 127, -26, -298, -520, -434, -203, -184, -267, -313, -221, -127, -141, -196, -269, -287, -348, -39, -90, -159, -187, -75, 160, 77, 66, 82, 135, 194, 292, 313, 525, 450, 436, 346, 333, 274, 81, -135, -284, -188, 8, -119, -83, -129, -47, 57, 28, 157, -33, -173, -232, -178, -111, -238, -317, -310, -216, -132, 13, 55, 42, 36, 189, 408, 469, 266, 282, 337, 341, 271, 173, 52, -126, -304, -296, -335, -256, -189, -134, -132, -24, 192, 198, 85, -23, 34, 90, 82, 61, 88, 3, -71, -111, -92, -110, -193, -142, -84, -45, 11, 95, 246, 239, 197, 67, 188, 120, 80, -132, -270, -212, -206, -130, -131, -154, -138, -137, -61, 69, 87, 102, 32, 180, 229, 209, 70, -20, -20, -132, -135, -141, -107, -68, -92, -30, 65, 101, 116, 50, 65, 70, 54, -37, -171, -214, -277, -293, -327, -287, -231, -130, -49, 14, 95, 198, 250, 241, 212, 137, 4, -63, -66, -120, -203, -277, -254, -125, -19, -4, 37, 97, 175, 225, 215, 164, 60, -115, -230, -249, -317, -371, -469, -410, -301, -99, 33, 98, 140, 150, 169, 130, 102, 42, -77, -149, -179, -182, -178, -196, -181, -121, 20, 166, 227, 276, 304, 337, 276, 192, 56, -20, -174, -199, -284, -320, -386, -336, -276, -88, -20, 144, 298, 33, -64, -185, 236, 222, 16, -269, -311, -110, -137, -145, -202, -114, -32, 95, 317, 377, 483, 349, 384, 275, 276, 163, -14, -200, -349, -329, -271, -282, -139, -63, 31, 155, 183, 329, 236, 164, 136, 84, 77, -146, -156, -194, -178, -204, -169, -41, 61, 24, 175, 132, 278, 228, 363, 281, 177, -125, 306, -331, -806, -554, 244, 440, -19, -582, -338, 319, 679, 601, 48, -99, -39, 126, 117, 50, -81, -91, 15, 214, 78, 140, -5, 250, 304, 229, 223, 212, 157, 79, 79, 177, 148, 38, -256, -337, -509, -37, 675, 731, -73, -763, -55, 468, 709, -87, -558, -363, 223, 230, -118, -328, -119, 232, 356, 472, -196, -279, -250, 434, 901, 857, -313, 92, -125, 624, -194, -508, -635, -269, 29, 121, -502, -651, -84, 694, 444, 26, -290, -341, 334, 92, -41, -348, -437, -159, -182, -128, -346, -394, 56, -107, 333, 117, 238, 634, 498, 399, -407, 112, -92, -213, -437, -726, -324, -315, 236, -122, 80, 469, 524, 242, -2, 64, 271, 10, 465, -187, 26, -576, -331, 51, -184, -183, -58, 6, -75, 254, -137, 102, -245, 48, -609, 565, -245, 416, -693, -552, -692, 942, 1385, 893, -646, -349, -45, 1046, -287, -480, -1205, -43, 403, 513, -242, -69, -348, 774, 454, 263, 220, -513, 121, -46, -709, -472, -703, -219, -270, -141, -314, -340, -624, -386, 382, -445, 196, -308, 268, -208, 313, 17, 473, 216, 498, 216, 890, -12, 658, -239, 106, -596, 319, -795, 51, -915, 519, -844, 761, -180, 515, -672, 349, 196, 373, -206, 67, -557, 195, -462, -87, -329, -673, -410, -394, 905, -193, 1016, -731, 110, -423, 819, -71, 169, -631, 288, -594, 652, -886, -68, 209, 133, 675, 83, -300, -610, 815, -108, 345, -1093, 450, -246, -216, -559, 141, -628, 483, -938, 1718, -383, 36, 193, 464, 340, 530, -398, -718, 477, 133, 638, -1002, 178, -449, 897, -249, 520, -741, -458, -259, 1131, 382, 630, -1127, -253, -53, 873, -270, -299, -1166, -75, 49, 40, -222, -169, -486, -420, 541, 371, -200, -1031, -333, 592, 206, 310, -473, -211, 150, 126, 878, -1043, 53, -826, 439, 72, 2, -34, -99, -300, 90, -7, 159, -387, -804, -196, 100, 361, 136, -606, -125, -379, 605, -198, 997, -1118, 1097, -515, 899, -565, 96, -905, 217, -288, 565, -358, 156, -829, 507, 12, 556, -120, 395, -140, 299, 50, -167, -532, -210, -554, 475, -113, -7, -341, 34, -250, 184, -199, 134, -105, 319, 82, 402, -25, -199, 48, 66, 106, 187, -477, 36, -316, 486, -45, 289, -72, 203, -239, 472, -256, 204, 75, -190, -132, 133, -154, 100, -384, -185, -74, 14, 143, -126, -15, -127, -84, 56, 397, -144, 140, -22, 292, 85, -38, 47, -136, -262, 397, -93, 80, 64, -231, 350, 95, 163, 0, -182, 269, -243, 230, -223, 155, -440, 191, -309, 324, -82, 127, 58, -41, 286, 143, 142, 262, -127, 47, 86, 9, 192, -139, -289, 4, -128, 204, -406, 559, -343, 273, 212, -1, 298, 20, 9, -132, -260, 9, 58, 23, 59, -162, -34, 149, 309, 57, 199, 193, 93, 222, 37, -5, 193, -338, -234, -84, 131, 52, -19, -126, 143, -25, 337, 91, 240, -68, 84, 137, 246, 198, 21, -311, 254, -86, -22, 285, -306, -165, 254, 284, 25, 204, 224, -21, 193, 108, 96, -312, 60, -221, 188, -177, 95, -128, 54, -48, 288, -21, -84, 256, 181, -172, 122, 222, 17, -278, -102, -120, 200, -67, 19, -144, 285, -119, 4, -119, 388, -60, 318, -193, 183, -212, -33, -283, 401, -251, -301, 140, -78, 185, -66, -140, -586, 594, 94, -111, -150, -197, 266, -257, 136, -238, -77, -230, 66, -398, 286, -27, -122, 264, -186, -8, -95, 242, 95, -213, 114, -26, -5, -190, 335, -63, -74, -359, 480, -403, 6, 121, -157, -123, -66, 13, 74, -12, -36, -67, 3, -11, 252, -106, -77, -271, -109, 115, 267, 83, -94, 108, 162, 59, -103, -95, -160, -361, 201, -384, 311, -396, 227, -89, 104, -212, 473, -220, 92, -194, 90, -339, 64, -142, -77, -237, 299, -325, 20, -136, 7, -58, -106, 110, 215, 88, -242, 400, -67, 411, -397, -21, -255, 112, -382, 131, -319, -47, -325, 262, 35, 99, -216, 231, -56, -124, 121, -78, -57, -54, -319, 257, -105, 31, -387, 117, -71, 181, 4, 128, 4, 49, 280, -121, 334, -176, 36, -142, -38, -136, 156, -125, 33, -229, 191, 103, -250, 10, -215, 77, 54, -25, -370, -96, 27, -247, 388, -153, -80, -319, 91, -209, 218, -87, -80, -78, 17, 48, 282, -206, 182, -239, 54, -212, 323, -223, -53, -147, -385, 349, -65, -39, -64, -220, -33, 101, 40, -23, 22, -311, -127, 172, 199, 11, -130, -176, -233, 3, 309, -179, 24, -78, 336, -171, 8, 174, 50, 159, -259, 177, -214, 54, -142, -102, -47, -23, -81, 424, -42, -9, -153, 187, 26, -94, 0, -177, 366, -527, 134, -99, 158, -240, -52, 138, -17, -65, 412, 34, 120, -125, 221, 43, 17, 272, -282, -20, -290, 194, -294, -9, 12, 65, -311, 315, 66, -47, -67, 172, -219, -2, 119, 105, -236, 206, -220, 289, -180, 323, 240, -222, 9, -151, 410, -158, -77, -57, 10, -42, -60, -267, 275, -136, 100, -240, 392, -110, -15, -263, 413, -296, -25, 128, 17, -104, 49, -335, 234, -197, -39, 135, 116, -225, 264, -106, 25, -135, 431, 51, -92, -335, 344, -46, 98, -380, 102, -66, -42, 88, -95, -87, 86, -298, 117, 120, -3, -291, 264, 72, 174, 34, -66, -28, 59, 68, 14, 104, -209, 186, 20, 102, -128, 47, 71, 367, 89, -254, 14, 114, -198, 506, -534, 251, -192, 85, -262, -328, 195, -326, 243, 58, -32, 238, -16, 131, -205, 254, -116, 321, -157, 1, 89, 263, -81, 391, -346, 187, -320, 49, -18, 105, -148, -65, -14, 93, -99, -59, 333, -182, 353, -473, 321, -510, 544, -369, -2, -139, 314, -355, 74, -74, 204, -222, 229, -91, -10, 549, -251, 66, -84, 7, -343, 252, -90, 182, 111, -358, -267, -221, -53, 106, -86, 125, 112, -17, 550, -824, 332, -577, 286, -339, 346, -660, 614, 254, -14, -530, -244, 111, 106, 288, -297, -375, 411, -448, 62, -184, 139, -243, 29, -135, 4, 158, 352, -329, -55, -387, 337, -70, 18, -127, -129, -429, 200, -38, 159, -278, -353, 645, -72, 720, -490, 406, -169, 244, 180, -324, 457, -35, 205, -260, 258, -39, 464, -388, 215, -277, -77, 293, 170, -302, 112, -214, 208, 30, -126, -69, -246, 163, 6, 187, -411, 504, -421, 1024, -980, 289, -340, -56, 297, -592, 421, -241, 38, -100, 506, 220, 532, -362, -248, 315, -91, 387, -208, -363, 368, -295, 396, -211, -91, 329, -370, 587, -894, 424, -399, -74, 161, -77, 342, -369, 848, -455, 1483, -899, 992, -835, 723, -510, 429, -192, 315, -457, 231, -554, 626, -307, 274, 170, 30, 444, -1006, 606, -83, 558, -598, 933, 444, 983, 105, 356, 540, -9, 164, -440, -204, -148, 19, 268, -334, 190, -622, 329, -202, 515, -416, 322, -265, 464, -10, 159, -412, 647, -411, 238, -133, -183, 357, -324, 142, -633, 467, -510, 776, -1238, 154, -633, 203, -9, -579, -76, 110, -100, 91, 308, -6, 234, -216, 490, -284, -76, -106, -721, -516, 249, -201, 206, -176, -562, 309, -742, 370, -269, -162, 64, 5, -346, 362, -657, 319, -257, -186, -35, 46, 175, -201, 25, 2, -131, 1, -45, 292, -207, 124, 8, 174, 236, -347, 287, -280, -116, -90, -342, -333, -292, -861, -200, -469, -599, -145, -1154, -296, 59, -863, 745, -482, -82, -318, 88, 1072, 445, 619, 914, 450, 913, 772, 592, 1058, 274, 806, 603, 466, 813, 135, 102, 576, -541, 121, -807, -589, -1292, -1130, -1544, -1752, -2399, -3089, -2666, -3017, -2336, -3044, -2181, -2212, -1286, -1060, -127, 774, 1177, 1748, 2266, 2674, 3545, 3521, 3899, 3676, 3499, 3550, 3034, 3116, 2579, 2542, 1974, 1636, 1412, 1154, 394, -394, -740, -1485, -1503, -2765, -3067, -3762, -4700, -4660, -5018, -4594, -4032, -3738, -2881, -1838, -1875, -1006, -613, 488, 1177, 1915, 2664, 2931, 3642, 3744, 4268, 4085, 4229, 3704, 3450, 2899, 2807, 2360, 2094, 1816, 1650, 1334, 1364, 1473, 925, 1250, 858, 1051, 525, 90, -708, -698, -2264, -2900, -4212, -4677, -5260, -5503, -5154, -4776, -3829, -3069, -2179, -1897, -1244, -789, 24, 408, 1164, 1691, 2357, 2751, 3270, 3980, 3835, 3678, 3340, 2966, 2929, 1868, 1960, 1455, 1272, 907, 698, 586, 815, 688, 1004, 771, 1122, 1161, 938, 539, 64, -633, -1190, -2375, -3392, -4159, -5197, -5715, -5753, -5692, -4944, -4044, -3241, -1789, -1572, -468, 90, 493, 846, 841, 1492, 1448, 1592, 2073, 2589, 2874, 2926, 2524, 2570, 2134, 1720, 1464, 1154, 921, 827, 929, 1298, 1306, 1248, 1440, 1521, 1867, 1917, 1754, 1680, 1190, 942, 128, -259, -961, -2010, -3184, -4195, -4938, -5435, -5938, -5575, -5521, -4202, -3482, -2161, -1189, -279, 199, 740, 1036, 1108, 962, 710, 510, 669, 1062, 1494, 1897, 1837, 1855, 1971, 1553, 1682, 1398, 1400, 1131, 1065, 1368, 1530, 1849, 1954, 2104, 2574, 2513, 2531, 2403, 1947, 1822, 1141, 732, 162, -684, -1131, -1927, -2928, -3997, -4392, -4992, -5094, -5534, -5162, -4746, -3969, -2957, -2220, -1288, -579, -219, 369, 348, 440, 375, 240, 522, 657, 1188, 1548, 1671, 1903, 1891, 2006, 2095, 1860, 1767, 1747, 1566, 1648, 1626, 2025, 2159, 2405, 2544, 2567, 2392, 2347, 2125, 1800, 1442, 1152, 763, 191, -578, -1251, -2027, -2604, -3741, -4326, -4776, -5141, -5358, -5110, -4760, -3864, -2913, -2201, -1358, -815, -217, 225, 465, 481, 344, 198, 251, 266, 599, 958, 1163, 1365, 1350, 1597, 1908, 1919, 1828, 1677, 1594, 1780, 1745, 2074, 2359, 2414, 2678, 2612, 2775, 2746, 2566, 2427, 2151, 1892, 1407, 968, 317, -280, -1058, -1567, -2265, -3309, -3976, -4349, -4625, -4859, -4840, -4680, -4111, -3616, -3106, -2510, -1782, -1232, -857, -647, -521, -529, -371, -249, -98, 347, 722, 1234, 1541, 1657, 1905, 1978, 1989, 2038, 1753, 1808, 1869, 2061, 2187, 2378, 2624, 2835, 2931, 2888, 2735, 2514, 2338, 2189, 1940, 1646, 1406, 1040, 472, 29, -595, -1122, -1770, -2537, -3311, -4088, -4338, -4593, -4835, -4786, -4732, -4242, -3662, -3078, -2364, -1903, -1273, -877, -721, -541, -486, -242, -131, 157, 629, 1074, 1462, 1774, 1938, 2122, 2171, 2116, 1957, 1847, 1867, 1840, 1908, 2071, 2334, 2587, 2516, 2690, 2594, 2508, 2450, 2279, 2078, 1828, 1557, 1364, 1138, 758, 409, -9, -448, -1003, -1505, -2222, -3121, -3746, -4199, -4582, -4773, -4765, -4655, -4251, -3816, -3117, -2428, -1800, -1223, -909, -563, -337, -240, -3, 178, 497, 762, 1270, 1626, 1646, 1653, 1668, 1680, 1706, 1605, 1596, 1602, 1701, 1790, 1872, 2116, 2346, 2393, 2516, 2547, 2434, 2341, 2314, 2236, 2061, 1812, 1673, 1369, 1080, 702, 379, -23, -600, -1110, -1669, -2362, -3105, -3710, -4208, -4495, -4607, -4520, -4322, -3979, -3468, -2801, -2178, -1661, -1134, -871, -594, -413, -110, 114, 270, 466, 824, 1218, 1430, 1358, 1368, 1420, 1508, 1474, 1507, 1501, 1543, 1572, 1703, 1918, 2194, 2381, 2353, 2482, 2518, 2485, 2374, 2298, 2253, 2056, 1885, 1621, 1403, 1180, 881, 655, 304, -141, -585, -1134, -1748, -2550, -3235, -3774, -4195, -4493, -4524, -4426, -4129, -3797, -3301, -2749, -2275, -1816, -1390, -1134, -855, -638, -245, 44, 332, 728, 1036, 1308, 1317, 1271, 1390, 1526, 1621, 1525, 1407, 1509, 1674, 1715, 1872, 2153, 2383, 2503, 2577, 2611, 2607, 2559, 2488, 2405, 2204, 1931, 1762, 1531, 1269, 993, 800, 458, 84, -431, -917, -1412, -1919, -2663, -3277, -3806, -4279, -4536, -4555, -4378, -4080, -3723, -3274, -2683, -2180, -1579, -1234, -992, -761, -587, -178, 81, 261, 654, 989, 1263, 1387, 1401, 1565, 1547, 1583, 1525, 1607, 1769, 1779, 1762, 2019, 2228, 2514, 2589, 2620, 2684, 2600, 2521, 2398, 2343, 2138, 1818, 1532, 1352, 1207, 889, 750, 433, 4, -395, -991, -1491, -2014, -2533, -3170, -3859, -4296, -4598, -4672, -4494, -4276, -3869, -3295, -2714, -1976, -1524, -1095, -759, -451, -268, -86, 199, 451, 671, 1054, 1465, 1602, 1544, 1610, 1623, 1664, 1676, 1544, 1528, 1667, 1706, 1820, 1921, 2121, 2254, 2235, 2327, 2183, 2087, 1989, 1814, 1776, 1541, 1354, 1174, 953, 824, 583, 485, 404, -33, -347, -874, -1406, -1849, -2349, -2945, -3610, -4152, -4391, -4431, -4284, -4149, -3783, -3140, -2443, -1764, -1268, -817, -454, -227, -63, 15, 268, 473, 651, 999, 1368, 1557, 1538, 1464, 1550, 1512, 1516, 1438, 1332, 1463, 1545, 1626, 1749, 1866, 2073, 2050, 2028, 2034, 1957, 1878, 1830, 1785, 1563, 1350, 1146, 965, 861, 635, 580, 393, 101, -219, -587, -1013, -1525, -2070, -2638, -3415, -3909, -4106, -4286, -4260, -4107, -3852, -3255, -2665, -1877, -1187, -721, -179, -9, 133, 211, 275, 441, 525, 845, 1287, 1621, 1675, 1570, 1564, 1532, 1442, 1380, 1202, 1173, 1146, 1261, 1377, 1440, 1659, 1892, 1905, 2062, 2030, 1878, 1807, 1765, 1707, 1570, 1444, 1309, 1183, 904, 691, 627, 535, 163, -319, -844, -1454, -1922, -2436, -3215, -3944, -4177, -4274, -4267, -4102, -3835, -3264, -2529, -1898, -1083, -649, -175, 104, 224, 383, 379, 535, 621, 898, 1321, 1635, 1739, 1534, 1374, 1303, 1283, 1092, 806, 835, 845, 873, 886, 958, 1431, 1734, 1839, 1743, 1889, 2040, 1825, 1869, 1705, 1501, 1535, 1340, 1318, 1139, 948, 805, 742, 396, -140, -574, -1014, -1553, -2368, -3276, -4105, -4355, -4449, -4581, -4387, -4333, -3726, -3049, -2336, -1283, -969, -303, 296, 236, 460, 334, 571, 961, 848, 1221, 1544, 1625, 1648, 1431, 1397, 1011, 739, 619, 630, 743, 722, 1027, 1240, 1401, 1855, 2013, 2194, 2180, 2041, 2128, 1941, 1914, 1758, 1586, 1562, 1264, 1090, 808, 749, 679, 134, -401, -1002, -1568, -2213, -3446, -4476, -4832, -5006, -5062, -4833, -4613, -3837, -2797, -2145, -1305, -814, -314, 384, 453, 714, 865, 995, 1263, 1268, 1535, 1909, 1982, 1710, 1578, 1215, 672, 474, 58, 138, 213, 221, 697, 1015, 1357, 1804, 2138, 2208, 2238, 2304, 2217, 2319, 2216, 2114, 2055, 1964, 1898, 1678, 1212, 986, 630, -162, -744, -1484, -2341, -3232, -4524, -5215, -5621, -6137, -5618, -5244, -4599, -3407, -2830, -1450, -755, -272, 565, 533, 1320, 1552, 1853, 2479, 2174, 2609, 2657, 2412, 2102, 1415, 852, 36, -506, -787, -827, -384, 19, 475, 794, 1114, 1474, 1656, 1846, 2026, 2296, 2659, 2751, 3112, 3253, 3039, 2683, 2020, 1649, 1369, 617, -121, -923, -1672, -2284, -3506, -4600, -5542, -6587, -6836, -6584, -6373, -5273, -4256, -3250, -1476, -841, 246, 1034, 1227, 2300, 2589, 3362, 3843, 3815, 4124, 3664, 3135, 2267, 1278, 323, -542, -1315, -1471, -1345, -1396, -910, -793, -857, -488, 158, 501, 1324, 2537, 3038, 4608, 5076, 4920, 5406, 4365, 3665, 2952, 1337, 916, 271, -886, -1557, -2914, -4341, -6058, -8383, -9586, -9501, -9076, -7703, -6019, -4297, -1744, -988, -258, 1038, 1188, 2460, 3202, 4229, 5662, 6333, 6829, 5717, 4442, 2496, 850, -230, -1734, -2030, -2272, -2174, -1999, -2251, -1758, -1844, -1787, -1151, -324, 1648, 3231, 4589, 6427, 6704, 6896, 6519, 5229, 4574, 3553, 2616, 2080, 1017, -708, -2080, -3998, -6112, -7790, -11095, -11551, -10344, -10340, -7226, -5759, -3426, -990, -2316, 230, 1254, 1959, 4739, 5281, 7387, 7529, 6881, 6609, 4683, 2818, 90, -745, -1366, -2421, -2297, -2737, -2619, -3359, -4507, -3963, -3132, -1929, 45, 1735, 3835, 5907, 6558, 7350, 7161, 6542, 6488, 5888, 5518, 5056, 4076, 2836, 392, -2125, -4563, -7836, -9660, -11762, -12482, -10549, -10909, -8297, -6297, -5388, -2789, -2990, 264, 2066, 3677, 6382, 7096, 9722, 8174, 6848, 6166, 3812, 3181, 1012, 406, -577, -2939, -3920, -5431, -5876, -6057, -5762, -3793, -2106, -721, 783, 2370, 4037, 5482, 7016, 8143, 8813, 8722, 8263, 7838, 6174, 4280, 2949, 1426, -1000, -3377, -5776, -8071, -10013, -13600, -12658, -10525, -10616, -7853, -7376, -4568, -2054, -2411, 2314, 4428, 6915, 8286, 7716, 8858, 6343, 5672, 4256, 3125, 2731, -132, -649, -2911, -5754, -6040, -6626, -5942, -4853, -4640, -2176, -627, -114, 2460, 4000, 6493, 7521, 7630, 9343, 8213, 7558, 7026, 5190, 4110, 2562, 742, -1076, -3263, -6358, -8155, -10057, -13599, -11462, -9317, -8695, -5941, -6752, -3636, -1776, -822, 4304, 5636, 8364, 7824, 7477, 7802, 5179, 5216, 3107, 3146, 1459, -2445, -2816, -5674, -6767, -6716, -6645, -3965, -3282, -2611, -1327, -110, 3279, 5186, 6828, 8462, 8246, 8324, 7830, 7127, 5825, 4956, 3471, 1790, 607, -2592, -3965, -6269, -9342, -10662, -13398, -10610, -8250, -8525, -5152, -5064, -1183, 367, 110, 5481, 5934, 8251, 7556, 5958, 7525, 4915, 4273, 2485, 1129, -1448, -5260, -5486, -7172, -7005, -6482, -5642, -2688, -2661, -1800, 763, 3248, 5619, 7477, 9082, 9458, 9107, 8256, 7647, 7127, 5271, 3603, 1730, -516, -3233, -5180, -6282, -8995, -10344, -13688, -13887, -8433, -8175, -5839, -4849, -3006, 2196, 1444, 6430, 8784, 8723, 9412, 5832, 7570, 5090, 2682, 2278, -914, -1957, -6128, -7397, -6459, -7092, -6840, -6750, -3908, -1970, -721, 2520, 5202, 7773, 8558, 8505, 10255, 9918, 8535, 7940, 5755, 4112, 1877, -273, -584, -3712, -6204, -8210, -10853, -11662, -14710, -11487, -6285, -6540, -4094, -5389, -736, 3846, 3357, 9921, 8782, 8856, 7305, 4242, 8275, 4016, 2078, -144, -4196, -4805, -7918, -7219, -7143, -7967, -7220, -6006, -2940, -1061, 1161, 4227, 7212, 8506, 9045, 10429, 10507, 10325, 8381, 6596, 5887, 2982, 1419, -127, -3744, -5398, -7478, -10948, -11759, -14643, -12946, -6988, -7328, -5772, -5223, -1537, 4630, 5912, 9631, 9219, 8770, 8298, 6739, 8540, 5989, 2923, -878, -4333, -4541, -6678, -7822, -8795, -9848, -8774, -7033, -3565, -821, 1363, 4315, 6621, 9472, 11172, 11882, 12081, 10482, 8287, 7196, 5318, 2493, -14, -4445, -6227, -8644, -12718, -14705, -17757, -12178, -7643, -8960, -7224, -6450, 2077, 5958, 6282, 11337, 9664, 10772, 9599, 9704, 10682, 4225, 1078, -2560, -3395, -4527, -9177, -9351, -10184, -10107, -7975, -5517, -1865, -338, 2362, 7560, 9622, 11159, 12297, 11504, 12019, 10149, 8043, 6639, 1833, -983, -4732, -9870, -12898, -16381, -14038, -12975, -15059, -12054, -8905, -2887, -74, 3119, 8505, 8875, 11376, 11209, 12319, 11895, 7957, 6444, 2383, 455, -4061, -6794, -7220, -11246, -9328, -8678, -7092, -4475, -4588, 2322, 5809, 7097, 9390, 8651, 12650, 11851, 9357, 8937, 3833, 3362, -1737, -8095, -11809, -15501, -9696, -11963, -14817, -12822, -9141, -510, -1796, 364, 4626, 7756, 11487, 9560, 12069, 11289, 7492, 4630, 1880, 2282, -710, -5676, -8516, -7486, -5718, -5898, -7071, -5419, 75, 2997, 6181, 6660, 6367, 8917, 8452, 9912, 7208, 2677, 1893, -3118, -6544, -10749, -11100, -6943, -11289, -13419, -12377, -6638, -441, -1961, 663, 3572, 7367, 10422, 10366, 11203, 8411, 5763, 4443, 3828, 2099, -1431, -4550, -5847, -5634, -5820, -5178, -5135, -3600, 153, 4058, 5551, 4418, 4652, 6183, 8045, 6872, 6095, 3616, -956, -5815, -10917, -6197, -5011, -8524, -13206, -14946, -5825, -4542, -2240, -435, 107, 5436, 4199, 9088, 10575, 7586, 7461, 4752, 7468, 3885, -705, 421, -1127, -1273, -3835, -3643, -2732, -4916, -3044, 137, 3516, 3532, 2091, 2792, 3898, 5139, 3349, -285, -5456, -6953, -2608, -1620, -4638, -10576, -10304, -4974, -2578, -31, -1229, -461, 707, 2535, 7018, 6074, 5065, 3089, 3355, 4684, 3433, 4239, 1005, -1412, -2523, -1329, 2679, 337, -592, -2467, -1195, 2816, 1764, 3767, 1152, 730, 1342, -3304, -4125, -7064, -4285, -2580, -7040, -6564, -7199, -2992, -680, -1416, 1369, 25, 1825, 3710, 6113, 7839, 4274, 3199, 2747, 3551, 3563, 2209, 1434, -863, -1535, -1179, 736, 2268, 604, 178, 127, 1672, 3249, 2498, 2796, 604, -1484, -3198, -6140, -5119, -4909, -6080, -7925, -9967, -5807, -2766, -1468, -705, -1502, 1010, 1979, 4361, 7115, 6779, 5699, 3320, 3985, 5437, 5459, 4065, 831, -535, -689, 1013, 1661, -122, -483, -1692, -225, 984, 1519, 2849, -701, -2234, -4479, -6160, -3882, -4490, -3939, -6891, -8925, -4617, -3111, -305, -391, -1326, 1142, 1005, 4220, 5757, 5007, 5415, 3434, 4038, 4464, 3957, 4703, 1872, 185, 903, 2171, 2988, 339, -112, 160, 470, 1466, 1533, 1136, -2627, -5027, -6121, -6107, -4929, -6288, -6292, -7990, -7769, -4142, -2984, -109, -577, -308, 1586, 1888, 6378, 6579, 5574, 5170, 4020, 6200, 5064, 4160, 3811, 1374, 1244, 1057, 1946, 1752, -385, -326, 329, 1216, 1474, 1212, -522, -2880, -4720, -5494, -4427, -4728, -5240, -6391, -7937, -6713, -5554, -3420, -1689, -2364, -699, 22, 1875, 5062, 5257, 6127, 4843, 4882, 6699, 5796, 6096, 4695, 3286, 3270, 1938, 2205, 1496, -54, -661, -717, 381, 320, -1585, -3266, -4284, -5005, -4086, -3437, -4096, -5069, -6392, -4965, -3696, -3796, -2702, -2369, -1224, -565, -115, 2578, 3498, 3338, 3485, 3814, 5692, 5562, 4376, 4680, 4397, 4486, 3645, 2478, 2367, 1355, 753, 663, 94, -8, -913, -2709, -3349, -4538, -4632, -4063, -4687, -4524, -5394, -5725, -4640, -4318, -2781, -2549, -2898, -1687, -631, 1705, 2884, 3094, 3452, 3141, 3921, 5229, 5542, 4910, 3874, 3135, 3456, 2756, 2125, 1874, 948, 756, 220, 118, 996, 74, -1366, -2200, -2390, -1732, -3018, -3945, -3484, -3868, -4312, -4996, -4775, -3672, -4415, -4128, -3062, -1978, -226, 49, 1567, 2332, 2629, 3890, 4565, 5192, 4937, 4754, 4520, 3991, 3444, 3231, 2587, 1317, 1194, 730, 281, 475, 118, 277, -978, -1491, -1136, -2012, -1955, -2546, -2432, -2882, -4139, -3733, -3783, -3768, -3699, -3564, -2706, -2146, -1437, -275, 62, 672, 1655, 2617, 3066, 3224, 3474, 3586, 3387, 3045, 3525, 3154, 2353, 2116, 1785, 1862, 1231, 1254, 1418, 795, 748, 64, -155, -503, -1408, -1516, -2212, -2394, -2580, -3421, -3610, -3828, -3610, -3683, -3624, -2974, -2191, -1655, -1286, -573, 176, 866, 1671, 2232, 2729, 2588, 2637, 2783, 2769, 2623, 2399, 2378, 2123, 1449, 1321, 1440, 1740, 1540, 818, 903, 1255, 1094, 350, -171, -253, -550, -1298, -1503, -1520, -2044, -2787, -3186, -2922, -2982, -3296, -3111, -2967, -2606, -2358, -1571, -1103, -692, -213, 515, 1282, 1654, 1865, 2005, 2037, 2209, 2367, 2515, 1930, 1657, 1644, 1680, 1452, 1359, 1319, 1295, 984, 562, 551, 504, 305, 56, -98, -215, -511, -828, -1138, -1575, -1640, -2040, -2215, -2416, -2462, -2408, -2300, -2309, -2035, -1744, -1241, -956, -763, -464, 65, 517, 730, 729, 1004, 1313, 1707, 1432, 1551, 1474, 1594, 1516, 1543, 1623, 1161, 1005, 849, 1156, 1316, 920, 964, 790, 783, 642, 485, 421, -252, -313, -676, -887, -1160, -1575, -1773, -2014, -2276, -2237, -2153, -2115, -2190, -1855, -1754, -1572, -1293, -884, -621, -530, -185, 289, 623, 1054, 1257, 1514, 1471, 1543, 1679, 1845, 1486, 1585, 1576, 1756, 1498, 1461, 1461, 1202, 1130, 1030, 1149, 840, 594, 278, 182, -98, -417, -696, -922, -1190, -1377, -1845, -1849, -2032, -2090, -2464, -2399, -2274, -1947, -1826, -1480, -1140, -825, -500, -134, 257, 555, 706, 773, 972, 1139, 1332, 1297, 1245, 1246, 1467, 1426, 1339, 1394, 1455, 1430, 1197, 1359, 1248, 1060, 967, 713, 618, 449, 39, -99, -359, -559, -981, -1182, -1257, -1467, -1448, -1685, -1591, -1541, -1272, -1301, -1179, -1111, -927, -914, -629, -634, -409, -395, -254, -90, -3, 126, 232, 428, 652, 549, 749, 985, 961, 1081, 983, 1170, 1111, 1121, 954, 1132, 866, 673, 726, 523, 416, 82, 16, -178, -214, -518, -640, -583, -782, -582, -815, -647, -674, -626, -696, -685, -499, -422, -293, -520, -339, -146, -131, -230, -205, -65, -120, -128, 11, -39, 52, 175, 282, 173, 298, 478, 508, 600, 512, 534, 421, 612, 332, 340, 373, 198, 57, 149, -26, -229, -233, -204, -262, -144, -203, -308, 17, -188, -91, -79, 231, -46, -175, 198, 146, 128, -102, -38, 45, 71, 58, -89, 91, 18, -40, 279, 368, 257, 209, 271, 322, 482, 165, 199, 123, 88, -121, -8, -416, -531, -426, -516, -431, -308, -287, -126, -87, -75, 316, 31, 267, 263, 311, 335, 487, 334, 508, 414, 295, 526, 304, 199, 346, 328, -24, 117, -162, 134, -259, -144, -47, -76, -273, -174, -204, -135, -208, -338, -473, -417, -368, -367, -272, -265, -138, -140, 191, 74, -18, 100, 186, 101, 75, 517, 168, 101, -27, 69, 395, 29, 396, 14, 97, 118, 233, -249, -54, 72, 137, -46, 127, -207, 39, 15, -217, 67, -19, -267, -236, -168, -10, -180, -372, -328, -104, -74, -162, 112, 96, -155, 123, 44, -48, 7, 64, 58, 98, 179, -54, -309, -70, 135, -495, -310, -181, -388, -514, -240, -400, -285, -765, 2, -98, -30, -17, 408, 99, 280, 160, 365, 157, 290, 243, 234, 26, 46, -116, -203, -122, 145, 49, -269, -64, 84, 147, -166, 87, -173, 100, -759, -184, -179, -269, -433, -227, 104, -571, -851, 36, -246, -357, -430, -449, 42, -249, 203, 105, 300, 167, 389, 667, 475, 596, 533, 411, 254, 69, 520, 458, -89, 78, -55, -72, 65, 285, -377, -321, -68, -265, -172, 38, -555, -515, -17, -531, -379, -612, -311, -270, -139, 141, -40, -377, -209, 43, -33, -257, 352, 171, -166, 193, 90, 410, 346, 408, 552, 996, 303, 590, 129, 514, 437, 174, 296, 162, 33, -55, 3, -154, -457, -439, -582, -43, -856, -751, -483, -598, -477, -521, -422, -814, -263, -322, -38, -743, -397, -422, -362, -394, 197, -116, 101, 963, 839, 1662, 838, 1114, 1236, 1049, 386, 906, 595, 367, -214, 601, 219, 498, -45, 86, -68, -80, -231, 36, -532, -705, -1070, -1564, -1652, -1389, -3018, -1971, -2801, -2260, -2264, -2287, -2278, -1778, -1465, -744, -1072, 15, -179, 988, 723, 1383, 1514, 2043, 1974, 2304, 2275, 2962, 2141, 3483, 2503, 3154, 2291, 2182, 2380, 1283, 875, -133, -616, -1000, -2242, -3276, -4169, -4964, -3883, -3816, -4222, -4166, -4172, -3202, -1820, -1178, 37, -122, 89, 590, 1691, 3169, 2906, 2160, 1139, 1554, 1796, 2081, 2176, 1273, 730, 364, 1312, 1583, 1589, 2312, 1599, 2018, 2278, 3121, 3291, 2393, 2405, 1726, 1347, -28, -1605, -3700, -5472, -5428, -4244, -4924, -5975, -7153, -5053, -3166, -1695, -382, -125, 330, 1530, 3294, 6028, 5304, 3529, 3036, 3446, 4129, 3573, 2311, 689, -353, -281, 10, 162, -424, -848, 151, 840, 1725, 2429, 2677, 3076, 2646, 2844, 1461, -414, -3502, -6104, -6899, -5239, -4511, -7079, -8256, -7310, -3532, -1306, -67, 1373, 1103, 1644, 4333, 7676, 7382, 5267, 3515, 3662, 4643, 3545, 2945, 1227, -1349, -1860, -683, -132, -687, -1394, -741, 176, 1774, 1984, 2844, 3089, 1877, 1850, 563, -1486, -4692, -9011, -8290, -3679, -5426, -5954, -8016, -4910, -172, -98, 3803, 4103, 3083, 4177, 4639, 8572, 6424, 3014, 1800, 1173, 2139, 342, 88, -1602, -3766, -2382, -1048, 685, 272, 169, 2797, 3373, 5029, 4664, 5202, 4313, 2466, 2907, 459, -3234, -5711, -10961, -12068, -7524, -6378, -7967, -7553, -7028, 115, 2791, 4818, 8048, 5480, 6114, 6730, 8992, 8802, 2092, 369, -1571, -1926, -1641, -3859, -3809, -4956, -5648, -1232, 277, 2058, 1807, 3446, 6841, 7144, 7634, 6864, 5578, 5395, 3115, 1082, -1461, -7149, -9754, -12478, -15316, -9170, -6977, -9735, -7165, -6165, 3088, 6789, 5973, 9834, 6692, 7425, 8099, 8335, 8322, 299, -3141, -3585, -3647, -3902, -6541, -6704, -6672, -4426, -298, 2281, 3366, 3733, 6056, 9051, 9763, 8531, 6153, 5055, 3847, 3361, 922, -3007, -7219, -11063, -11990, -14698, -15399, -6391, -7282, -7922, -3168, -708, 9437, 9087, 8139, 11269, 7311, 8551, 7043, 4531, 2196, -4578, -5826, -4528, -6203, -6553, -8856, -6934, -3359, -1402, 3342, 5409, 5571, 6749, 8249, 10507, 9466, 6008, 4608, 2757, 1753, 913, -1961, -5075, -7252, -10829, -11676, -13641, -13266, -4660, -3866, -5852, -1278, 1625, 9955, 10445, 6979, 8165, 5906, 6213, 4682, 1788, -918, -6572, -7530, -5608, -4837, -5368, -7035, -5347, -1033, 653, 3932, 6145, 6009, 6368, 6954, 8681, 8075, 4716, 1851, 477, 507, 1130, -400, -2515, -5196, -7825, -7928, -9033, -10419, -6778, -2236, -3671, -2804, -169, 3978, 9723, 6212, 4779, 5555, 3923, 4372, 1497, -581, -2084, -6521, -5265, -3836, -3873, -3969, -5617, -2809, 1015, 2154, 3547, 4836, 4830, 5279, 6405, 6484, 5757, 3254, 1348, 1000, 334, -529, -1526, -1194, -1335, -2239, -4327, -7045, -8335, -8929, -5905, -510, -1470, -4519, -3363, 664, 7557, 8184, 4655, 2919, 1998, 4100, 4200, 1921, -1269, -5063, -5755, -4109, -2650, -3367, -4565, -4739, -1927, 2535, 3545, 3573, 3643, 3031, 4768, 6860, 5715, 4104, 2358, 601, 1644, 2522, 1037, -826, -1650, -1061, -325, -1328, -2527, -4393, -6057, -6013, -5969, -4773, -1220, -995, -2300, -1096, 251, 4855, 6987, 3910, 2637, 1476, 2123, 2545, -197, -1944, -3096, -4372, -4385, -3607, -2753, -2526, -2841, -1201, 935, 2023, 2560, 2974, 4042, 5042, 5280, 3939, 2366, 1561, 1187, 1854, 2551, 1073, -469, -1153, -1775, -704, 540, 414, 58, -2474, -5722, -6925, -6522, -2074, 1862, -1251, -4287, -4333, 402, 7309, 6862, 3001, 58, 922, 3250, 2158, -154, -2390, -3657, -4020, -4085, -3770, -2557, -2281, -2328, -451, 2806, 4039, 2504, 2443, 3602, 4927, 5225, 2973, 1374, 637, 361, 1084, 797, 83, 192, -397, -413, 643, 1132, 1403, 515, -1349, -3259, -5236, -7148, -8624, -4940, 106, -1049, -3480, -3741, 713, 7809, 8834, 5372, 1558, 1035, 3397, 3207, 298, -3087, -5913, -6218, -4295, -3900, -3198, -2442, -2723, -395, 2632, 4826, 5681, 3423, 1092, 2677, 4945, 5096, 3017, -282, -1110, 588, 1752, 1087, 414, -232, 28, 1477, 1552, 1054, -529, -905, -118, -1015, -3199, -6916, -9405, -8093, -1948, 1964, -608, -3902, -4719, 2228, 9631, 8960, 4264, -769, -119, 3738, 4203, 897, -3831, -6277, -5685, -3851, -2658, -1460, -1857, -3133, -1512, 1428, 3809, 3946, 1978, 1634, 3644, 4724, 2574, -365, -1160, 633, 2437, 2661, 836, -1196, -258, 1121, 2479, 3598, 2386, 674, -350, -57, -643, -2915, -5313, -8793, -9199, -4409, -1112, -1514, -3579, -4008, 1622, 8358, 9206, 5382, 1718, 1653, 3579, 3920, 748, -2704, -4454, -5148, -4499, -4185, -3891, -2375, -1250, -1142, 163, 2407, 3565, 3695, 2609, 1967, 2804, 3607, 2769, 118, -1410, -725, 101, 462, -194, -588, 895, 1873, 2034, 2173, 1445, 2212, 3181, 2070, 2393, 1461, -3268, -7252, -10512, -10293, -4125, 119, -1017, -4381, -5651, -67, 6818, 9313, 7561, 2155, -9, 1981, 2696, 1246, -2326, -5902, -6456, -4433, -3516, -3440, -2744, -1419, 1734, 4431, 5563, 6135, 4340, 1612, 1007, 1465, 2217, 1370, -2852, -5911, -5228, -2053, 1309, 2069, 767, 542, 2850, 5363, 6743, 6179, 3573, 1923, 946, 5, -25, 306, -1107, -5554, -9983, -13111, -12535, -4506, 1710, 990, -1397, -4306, 631, 11490, 14044, 9767, 1197, -4219, 1001, 4118, 658, -4741, -10988, -9992, -4627, -2973, -1861, -1540, -833, 2218, 4053, 5341, 6554, 5770, 3902, 1618, -632, -936, -475, -962, -2920, -4659, -4266, -2904, -161, 2017, 2214, 2603, 3329, 4471, 5882, 6583, 4865, 1957, 111, -617, -244, -389, -1053, -1255, -2731, -5292, -8241, -10817, -7082, 1459, 4363, 1808, -2775, -4135, 3708, 11154, 10777, 4478, -3810, -5119, -823, 1085, -737, -6026, -10039, -8010, -4180, -1382, -174, -1163, -482, 2077, 4277, 6573, 7425, 5507, 2196, -158, -387, 888, 1744, -164, -4484, -6443, -4570, -984, 2233, 1865, 302, 614, 2022, 4455, 5133, 3493, 1608, 83, 311, 1803, 1815, -76, -2003, -2561, -1300, 1083, 2566, 1916, 923, 1360, 1912, 2790, 2719, 93, -2177, -4510, -6487, -5547, -4561, -3435, -2007, -3046, -4011, -2981, -3, 3703, 4605, 2985, 144, -734, 2024, 3900, 3313, 277, -3755, -4219, -2538, -1398, -1075, -2440, -2946, -1527, 336, 2044, 1813, 1230, 1235, 1250, 2557, 3273, 2650, 1532, -138, -266, -91, -1064, -889, -651, -375, 780, -681, -2603, -1787, -459, 1227, 2112, 359, -1087, -357, 754, 1549, 2307, 1573, 402, 410, -112, 97, 1022, 25, -150, 404, -63, 122, -318, -1151, -1248, -1701, -1449, -227, 920, 390, -928, -1133, -437, 3181, 6508, 5775, 4528, 2478, 1249, 3451, 4330, 2388, -245, -3709, -5108, -3078, -2895, -6135, -10176, -12908, -9344, -40, 5367, 3991, 108, -2136, 3251, 11207, 12071, 6400, -2201, -5732, -1574, 2410, 1026, -5486, -10907, -10380, -4921, 731, 2199, 1263, 508, 1284, 4069, 5930, 5910, 4988, 3129, 837, -850, -1574, -2080, -2435, -3292, -4791, -3981, -1237, 1302, 2692, 1655, 66, 889, 3480, 5017, 4115, 1016, -2851, -4336, -3009, -1221, -499, -1674, -3302, -2532, 143, 3380, 5876, 6050, 5503, 5041, 3811, 2796, 1852, 408, -1267, -2509, -2896, -3522, -5116, -8038, -10764, -9175, -3495, 1836, 3428, 1047, -677, 3183, 8885, 10412, 6762, -583, -4644, -2283, 332, 216, -3649, -8640, -8063, -3146, 931, 2387, 972, 73, 2500, 5660, 6724, 5011, 1792, -544, -1043, -705, -1178, -2363, -3900, -5192, -4955, -3135, -193, 2463, 2924, 1719, 847, 1775, 3472, 4299, 3692, 1326, -958, -2053, -2571, -2097, -2026, -3011, -2933, -1717, -157, 1613, 1670, 1529, 3895, 6245, 6789, 4924, 1531, 934, 2045, 1498, -480, -3258, -3853, -2148, -2080, -4540, -8580, -9958, -6315, -389, 4003, 3466, 129, -1092, 2683, 8460, 9786, 5474, -1487, -4741, -2670, -347, -633, -4258, -7580, -6646, -3473, -141, 1616, 1229, 1221, 2104, 3543, 4867, 4079, 2256, 281, -1360, -1784, -2179, -2182, -2367, -3402, -3560, -2762, -366, 2532, 3553, 3117, 2164, 2000, 3070, 3711, 2671, 291, -1600, -2113, -2013, -1878, -2244, -2703, -1956, -688, 621, 1338, 1198, 1551, 1572, 1603, 1734, 813, 451, 173, 624, 2152, 2046, 1828, 1690, 1264, 2480, 2944, 1936, 494, -1237, -1680, -1516, -3141, -6080, -8370, -8924, -5798, -1032, 677, 611, -68, 977, 5549, 8443, 7882, 4666, 249, -735, 351, -207, -2428, -6032, -8451, -7118, -4224, -1796, -404, -356, 579, 2968, 4806, 6042, 6069, 4354, 2726, 1006, -969, -1419, -2145, -3619, -4438, -4839, -3688, -1466, -69, 569, 1164, 2028, 3445, 4605, 4035, 2713, 1098, -665, -1284, -1572, -2329, -2681, -2994, -2909, -1498, -104, 1383, 2564, 2310, 2427, 2690, 2710, 2726, 1532, 70, -1086, -2167, -2372, -2575, -2710, -2417, -2104, -1427, -331, 945, 1753, 2365, 2761, 2728, 2841, 2340, 1316, 293, -715, -1523, -2046, -2409, -2427, -1963, -1232, -272, 491, 846, 1152, 1490, 2053, 2373, 2198, 1464, 230, -534, -1345, -1961, -1899, -2679, -2812, -2584, -2095, 801, 2894, 3522, 3828, 3243, 3782, 4845, 4258, 2103, -232, -2172, -2450, -2222, -4787, -8027, -9999, -9138, -3649, 964, 1643, 865, 247, 3629, 9117, 10023, 6920, 1743, -2092, -1069, 348, -1459, -4879, -8259, -8503, -4906, -1825, -777, -367, 62, 2169, 5095, 5858, 5153, 3842, 1909, 1340, 722, -860, -1683, -2949, -4276, -4005, -3085, -1615, -43, 397, 431, 1457, 3228, 4737, 5008, 3375, 1173, -233, -723, -817, -1691, -3045, -3958, -3807, -2462, -796, 4, 562, 1535, 2251, 3119, 3646, 3183, 2462, 1605, 713, -191, -1352, -2593, -3263, -3265, -2716, -1999, -1569, -902, 159, 1326, 2582, 3313, 3178, 2693, 2196, 1321, 517, -288, -1526, -2215, -2465, -2735, -2559, -2259, -1675, -819, -15, 1074, 2014, 2162, 2021, 1729, 1395, 1547, 1355, 441, -484, -1401, -1528, -1011, -1004, -1337, -1447, -1182, -500, 171, 385, 504, 861, 1389, 1978, 1862, 1220, 604, 176, 406, 573, -139, -1332, -2033, -1746, -849, -122, -538, -1344, -1738, -1465, 891, 3857, 3870, 2598, 1641, 1578, 3722, 4499, 2419, -173, -1149, -358, -281, -2462, -6554, -9150, -8208, -4364, -631, -470, -2177, -2293, 1376, 7040, 9299, 6913, 2251, -702, 557, 2359, 872, -3066, -6728, -7287, -5135, -3106, -2499, -2536, -1694, 529, 3130, 4716, 5005, 4407, 3237, 2549, 2280, 1514, -412, -3130, -4595, -4209, -2838, -1596, -1405, -1758, -1393, 233, 2225, 3640, 3710, 2844, 2115, 1833, 1803, 1079, -544, -2136, -3189, -3041, -2241, -1734, -1329, -1279, -708, 697, 2120, 3250, 3233, 2559, 1661, 965, 667, 121, -736, -1775, -2212, -2231, -2261, -2028, -1629, -457, 520, 1158, 2147, 2342, 2299, 2463, 2276, 2099, 1392, 130, -921, -1419, -1542, -1669, -1944, -2135, -1805, -1108, -380, 337, 751, 860, 794, 1252, 2275, 2187, 1039, -7, -567, -286, -513, -1208, -2074, -2693, -643, 1721, 1998, 1315, 966, 2273, 4368, 5394, 3761, 1342, 395, 401, -49, -2806, -6697, -9217, -8578, -4947, -1680, -1431, -3430, -3466, 1226, 7614, 9984, 7002, 2391, 845, 2902, 4174, 1746, -3077, -6893, -7145, -5103, -3459, -3298, -3810, -3185, -625, 2944, 5486, 5658, 4408, 3148, 3390, 4552, 4082, 1582, -2030, -4326, -3922, -2764, -2790, -3981, -4258, -2819, -589, 1425, 2202, 2195, 2808, 3803, 4180, 3582, 2393, 933, -420, -1416, -1988, -2321, -3138, -3687, -3238, -2114, -612, 294, 571, 964, 1910, 2929, 3304, 2937, 1941, 798, -186, -721, -845, -1390, -2201, -2634, -2305, -1384, -643, -265, 576, 1618, 2195, 2230, 2001, 2098, 2213, 1881, 928, -378, -1262, -1567, -1524, -1646, -1818, -1846, -1503, -603, 149, 452, 611, 1110, 1792, 2144, 1695, 759, -59, -280, 1227, 1789, 561, -46, 281, 1710, 2546, 2152, 1443, 563, 362, 261, -1228, -4142, -7067, -8636, -7041, -3156, -1070, -2491, -4097, -1539, 4314, 8634, 7911, 4215, 2359, 3634, 5024, 3024, -826, -4496, -6570, -5837, -4594, -4153, -4262, -4412, -2925, 205, 3228, 4541, 4071, 3748, 4636, 5327, 4563, 2428, -63, -1667, -2108, -2459, -3272, -4269, -4713, -3966, -2427, -671, 463, 848, 1493, 2708, 4076, 4483, 3687, 2538, 1581, 1052, 302, -1227, -2796, -3693, -3386, -2446, -1870, -1482, -873, 266, 1654, 2634, 3245, 3139, 2459, 2106, 1943, 1244, -117, -1552, -2124, -2122, -2267, -2425, -2328, -1793, -773, 247, 847, 1191, 1582, 2224, 2892, 2807, 2069, 1186, 587, 119, -635, -1394, -1901, -2071, -2106, -2211, -1976, -1215, -245, 505, 1130, 1596, 2118, 2689, 2832, 2932, 3151, 2701, 1749, 901, 289, 157, 16, -255, -770, -1645, -2136, -3658, -5950, -7210, -5867, -1926, -540, -2574, -3765, -1286, 4088, 6639, 4980, 2543, 1873, 3484, 4373, 2779, -406, -3488, -4155, -3262, -2681, -3220, -4712, -4780, -2495, 743, 2654, 2089, 1201, 2065, 4451, 5948, 4743, 1877, -175, -159, 195, -701, -2140, -3525, -3982, -3039, -1832, -1293, -1459, -1282, 216, 2120, 3244, 3207, 2388, 1984, 2598, 3038, 2366, 456, -1584, -2001, -1370, -1144, -2023, -3250, -3044, -1720, -78, 1012, 831, 544, 1039, 2105, 3075, 2887, 1592, 424, 119, 238, 208, -590, -1890, -2351, -1869, -1334, -1227, -1414, -1233, -579, 332, 1137, 1414, 1395, 1315, 1531, 2171, 2135, 1320, 344, -415, -688, -566, -453, -820, -1491, -1821, -1113, 257, 1020, 1245, 1312, 1426, 1882, 2310, 2350, 2110, 1428, 617, -7, -814, -1870, -3023, -4556, -5789, -5333, -3543, -2304, -2581, -2835, -1605, 521, 2633, 3210, 2598, 2223, 2514, 3416, 3290, 2008, 649, -495, -828, -939, -1238, -1859, -2708, -2907, -2355, -1307, -523, -509, -484, 62, 1300, 2122, 1886, 1497, 1201, 1295, 1481, 1104, 444, -380, -793, -765, -769, -886, -1130, -1113, -874, -456, 156, 380, 445, 545, 842, 1353, 1464, 1176, 797, 557, 518, 418, 231, -181, -673, -867, -821, -705, -660, -748, -669, -445, -132, 274, 536, 560, 618, 759, 942, 1007, 777, 610, 565, 460, 353, 136, -24, -175, -359, -429, -407, -434, -515, -510, -291, 46, 199, 159, 246, 540, 811, 860, 799, 624, 473, 429, 462, 534, 460, 211, 47, 69, 263, 335, 164, -86, -414, -713, -944, -1124, -1096, -1168, -1524, -1929, -1977, -1543, -1140, -1174, -1288, -1194, -717, -245, -109, -71, -130, -41, 282, 542, 600, 298, 140, 343, 543, 594, 497, 487, 600, 633, 732, 754, 746, 782, 724, 662, 481, 253, 157, 22, -77, -186, -286, -313, -343, -421, -425, -334, -193, -67, -28, 11, 116, 189, 227, 202, 144, 162, 263, 275, 168, 73, 82, 135, 160, 78, -6, -26, -39, -41, -21, -6, -5, -54, -97, -116, -94, -40, -4, -20, -34, 17, 143, 180, 149, 190, 278, 320, 324, 356, 464, 469, 398, 390, 446, 469, 394, 289, 236, 233, 245, 210, 182, 123, 123, 110, 75, 73, 33, -76, -232, -462, -646, -823, -922, -926, -1029, -1240, -1408, -1396, -1196, -1064, -1010, -956, -843, -642, -470, -362, -266, -209, -139, -98, -41, 20, 77, 155, 175, 205, 311, 423, 569, 582, 573, 605, 632, 687, 681, 642, 604, 518, 454, 350, 249, 170, 139, 117, 34, -60, -75, -55, 6, 38, 50, 60, 86, 73, 85, 110, 103, 51, -13, -56, -57, -101, -152, -182, -156, -110, -87, -62, -16, 14, 46, 101, 199, 229, 222, 260, 321, 369, 393, 390, 479, 605, 695, 721, 708, 727, 749, 745, 710, 614, 550, 463, 334, 210, 107, 90, 58, -60, -212, -389, -448, -484, -595, -798, -1077, -1286, -1332, -1317, -1343, -1507, -1642, -1585, -1333, -1052, -933, -961, -921, -732, -467, -251, -163, -110, -59, -25, 45, 181, 344, 419, 432, 446, 581, 741, 874, 890, 860, 893, 966, 977, 912, 801, 733, 679, 604, 502, 420, 396, 351, 235, 131, 67, 63, 39, -20, -83, -65, -52, -43, -51, -45, 1, 5, -6, -9, -10, -3, -38, -44, -15, -3, 46, 83, 122, 168, 218, 327, 387, 425, 458, 498, 568, 595, 535, 395, 265, 205, 135, -38, -292, -543, -723, -851, -1046, -1246, -1387, -1471, -1524, -1612, -1650, -1585, -1457, -1310, -1226, -1106, -928, -701, -482, -282, -128, -39, -43, -29, 93, 170, 132, 91, 80, 154, 243, 288, 343, 408, 466, 598, 749, 878, 982, 1017, 1052, 1087, 1092, 1113, 1054, 944, 845, 769, 725, 642, 487, 395, 334, 317, 284, 215, 170, 165, 204, 188, 151, 84, 35, -16, -93, -138, -237, -347, -472, -536, -550, -613, -675, -748, -747, -708, -713, -654, -588, -547, -513, -444, -222, -44, 9, 71, 171, 261, 302, 342, 388, 424, 368, 335, 386, 429, 475, 516, 574, 654, 771, 960, 1230, 1312, 1280, 1367, 1157, 851, 543, 436, 398, 465, 512, 89, -308, -479, -390, -337, -582, -754, -913, -994, -907, -1015, -1229, -1511, -1633, -1365, -1256, -1410, -1781, -1844, -1405, -896, -636, -655, -675, -289, 203, 562, 697, 656, 630, 627, 674, 783, 597, 293, 127, 50, 152, 435, 816, 968, 736, 866, 1251, 1619, 1537, 1219, 1083, 958, 903, 894, 794, 580, 137, -50, -47, -26, -262, -766, -1017, -1054, -1252, -1803, -2317, -2546, -2999, -3703, -3878, -2801, -1828, -2225, -2313, -1548, -111, 495, 567, 731, 624, 693, 908, 1479, 1456, 580, -166, -288, 2, -5, -489, -890, -1046, -838, -394, 82, 301, 308, 405, 946, 1728, 2111, 1955, 1657, 1679, 1826, 1803, 1416, 871, 362, 194, 227, 223, 75, -156, -261, -205, 224, 490, 564, 442, 523, 850, 911, 887, 765, 690, 521, 339, 361, 214, -181, -574, -915, -995, -1310, -1617, -1789, -1795, -1606, -1646, -1643, -1563, -1218, -661, -350, -246, -288, -64, 333, 491, 397, 198, 94, -32, -55, 132, 157, -68, -214, 40, 532, 654, 609, 617, 869, 1141, 1376, 1536, 1394, 1143, 1165, 1219, 1058, 532, 7, -220, -555, -1026, -1588, -2124, -2645, -3206, -3780, -4122, -4451, -4333, -3911, -3192, -1913, -825, 189, 710, 1543, 2037, 2163, 1878, 1515, 1273, 873, 494, 106, -301, -634, -635, -460, -277, -212, -56, 368, 904, 1451, 1888, 2074, 2271, 2497, 2812, 2915, 2574, 2105, 1842, 1715, 1540, 1160, 760, 571, 399, 320, 324, 426, 333, 288, 411, 480, 427, 255, 270, 269, 226, -30, -320, -501, -527, -651, -962, -1437, -1618, -1658, -1267, -1408, -1464, -1389, -1256, -599, -645, -467, -546, 195, 553, 601, 594, 662, 835, 632, 434, 561, 595, 238, 120, 453, 763, 764, 610, 799, 1062, 1103, 1001, 956, 935, 831, 743, 712, 454, 233, 7, -63, -152, -379, -550, -665, -814, -915, -1023, -1123, -1335, -1518, -1601, -1608, -1813, -1945, -2002, -1962, -1938, -1928, -1642, -1228, -851, -680, -420, -79, 165, 273, 305, 382, 506, 661, 740, 907, 905, 956, 999, 1159, 1225, 1261, 1309, 1385, 1507, 1556, 1580, 1570, 1501, 1429, 1363, 1229, 1051, 908, 788, 703, 581, 435, 283, 192, 43, -154, -410, -663, -915, -1168, -1392, -1605, -1746, -1723, -1715, -1714, -1693, -1592, -1576, -1416, -1379, -1143, -857, -698, -329, -146, 141, 241, 289, 294, 309, 420, 380, 376, 410, 716, 874, 891, 879, 999, 1190, 1384, 1438, 1399, 1434, 1432, 1549, 1546, 1354, 1151, 1068, 1088, 1037, 768, 447, 300, 249, 203, 15, -285, -541, -754, -828, -895, -1077, -1310, -1646, -1772, -1852, -1927, -1941, -1971, -1985, -1876, -1575, -1318, -1240, -1139, -990, -462, -271, -189, -81, 70, 324, 446, 548, 636, 776, 932, 917, 901, 1019, 1097, 1105, 1028, 1157, 1278, 1370, 1319, 1275, 1280, 1188, 1131, 989, 931, 815, 666, 603, 519, 531, 403, 333, 231, 68, -81, -282, -403, -571, -772, -886, -935, -956, -1108, -1210, -1241, -1308, -1369, -1464, -1323, -1161, -1095, -1086, -1007, -857, -744, -581, -496, -443, -261, -42, 263, 247, 260, 486, 673, 816, 712, 590, 612, 733, 838, 856, 876, 871, 882, 913, 996, 999, 994, 855, 806, 759, 708, 618, 500, 345, 296, 190, 39, -147, -225, -268, -396, -602, -842, -863, -926, -960, -1001, -1001, -1066, -1155, -1187, -1046, -937, -945, -988, -913, -743, -714, -765, -747, -650, -481, -376, -310, -115, 110, 270, 280, 379, 543, 608, 682, 761, 777, 845, 797, 891, 915, 892, 795, 714, 714, 686, 725, 740, 671, 654, 577, 591, 482, 349, 219, 161, 69, -84, -189, -334, -355, -416, -444, -490, -634, -696, -763, -728, -707, -768, -888, -934, -783, -628, -614, -682, -642, -488, -395, -314, -262, -214, -143, -18, 124, 216, 247, 292, 378, 453, 477, 463, 466, 445, 405, 411, 458, 518, 483, 445, 463, 492, 501, 417, 395, 373, 284, 240, 250, 256, 159, 90, 27, 44, -9, -114, -186, -200, -200, -216, -301, -345, -414, -435, -424, -404, -421, -461, -476, -407, -316, -227, -212, -217, -211, -164, -88, -72, -105, -77, -12, 70, 73, 56, 85, 129, 163, 177, 164, 150, 159, 222, 258, 292, 285, 254, 247, 240, 241, 229, 184, 139, 102, 86, 35, 21, 19, 27, 16, -6, -41, -72, -91, -81, -92, -112, -159, -182, -215, -201, -177, -167, -160, -193, -206, -181, -152, -127, -110, -93, -95, -60, -54, -24, -6, 11, 46, 92, 75, 67, 74, 107, 149, 149, 127, 92, 63, 95, 101, 88, 52, 27, 18, 45, 66, 100, 84, 40, 15, 24, 39, 39, 7, 3, 1, 10, -1, -14, -45, -51, -53, -32, -38, -58, -61, -54, -48, -29, -31, -39, -60, -60, -37, -11, -19, -32, -28, -7, -4, 3, -2, -3, -8, 9, 27, 39, 27, 16, 18, 31, 38, 35, 17, 7, -6, -1, 0, 18, 7, 9, -5, 3, -9, -5, -2, 1, -6, -3, 7, 16, 14, 16, 10, 18, 6, 2, -3, 1, -6, -7, -10, -4, -16, -14, -18, -14, -13, -2, -5, -4, -8, 6, 13, 16, 2, 7, 6, 13, 8, 13, 14, 11, 7, 16, 21, 20, 7, 3, -10, -8, -13, -10, -16, -16, -23, -14, -20, -16, -17, -9, -6, -1, -6, 3, -1, 11, 20, 31, 19, 9, -1, 5, 0, 0, -7, -10, -21, -19, -21, -10, -14, -11, -17, -10, -9, -1, -2, 1, -6, -3, -10, -5, -10, -7, -11, -2, 0, 4, -1, 2, 0, 7, 6, 11, 6, 12, 4, 8, 3, 7, -4, -7, -15, -9, -11, -4, -6, 2, 0, 10, 13, 21, 19, 25, 21, 24, 17, 23, 17, 15, 5, 7, 3, 3, -3, -1, -5, 2, -3, 1, -4, -2, -8, -5, -12, -10, -16, -13, -20, -15, -17, -11, -14, -7, -8, -2, -5, 0, -3, 1, -3, -1, -5, -1, -6, -3, -10, -7, -14, -8, -11, -6, -9, -2, -2, 7, 5, 13, 9, 14, 10, 14, 10, 14, 9, 12, 7, 10, 5, 10, 4, 7, 2, 5, -1, 3, -4, 0, -7, -4, -11, -9, -14, -12, -17, -13, -17, -12, -16, -9, -13, -7, -10, -4, -6, 1, -2, 3, 0, 5, 1, 5, -1, 3, -1, 3, -1, 4, 0, 4, 1, 6, 3, 9, 6, 10, 5, 9, 4, 8, 3, 5, 1, 4, 0, 4, -1, 3, -1, 3, -1, 3, -1, 2, -2, 2, -3, 1, -4, -1, -5, -1, -5, -1, -5, -1, -5, -1, -4, -1, -4, -1, -4, 0, -3, 0, -3, 1, -2, 2, -1, 2, 0, 3, 1, 4, 1, 4, 2, 4, 2, 4, 2, 4, 2, 3, 1, 3, 0, 2, 0, 2, 0, 1, 0, 1, 0, 1, -1, 1, -1, 1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr AdpcmEncoder::Encoded<fx_wizard_length> fx_wizard_data = AdpcmEncoder::Encode(fx_wizard_pcm);
 
 static constexpr SamplePlayer16bit::Sample fx_wizard = {
-    .data = fx_wizard_data,
-    .length = fx_wizard_length,
+    .data = fx_wizard_data.data(),
+    .length = AdpcmEncoder::PaddedLength(fx_wizard_length),
+    .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM,
 };
 
 }
@@ -0,0 +1,259 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Main stuff
+#include <algorithm>
+#include <array>
+#include <new>
+#include "common/core/Kastle2.hpp"
+#include "common/core/Kastle2_cc.hpp"
+#include "common/testmode/VersionChainGenerator.hpp"
+#include "apps/ExampleSynth/AppExampleSynth.hpp"
+#include "apps/FxWizard/AppFxWizard.hpp"
+#include "apps/Template/AppTemplate.hpp"
+#include "apps/WaveBard/AppWaveBard.hpp"
+#include "hardware/watchdog.h"
+
+using namespace kastle2;
+
+/**
+ * @file main.cpp
+ * @brief Main entry point for the Kastle 2 multi-app firmware.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * One image with several apps, the last selected one starts (stored in the EEPROM base space):
+ * - Hold SHIFT on power-up to step to the next app, the LEDs blink in its color.
+ * - Or send cc::APP_SELECT with the app number (0 = FX Wizard, 1 = Wave Bard, 2 = Example Synth, 3 = Template),
+ *   it's stored and the Kastle 2 restarts into that app.
+ *
+ * The core (Kastle2, Base, drivers) is shared. Only the selected app is constructed, in storage
+ * sized for the biggest one, and only its buffers are allocated from the arena (sized for the biggest one too).
+ * Its FASTCODE_APP functions are copied to RAM from its overlay by Kastle2::RegisterApp, next to the common .fastcode.
+ *
+ * @note Each app clears the EEPROM app space when it starts after another one (Kastle2::RegisterApp),
+ *       so the app settings don't survive a switch. Presets in the flash do.
+ */
+
+#define APP_VERSION "1.0"
+
+FASTCODE_OVERLAY_DECLARE(fx_wizard);
+FASTCODE_OVERLAY_DECLARE(wave_bard);
+FASTCODE_OVERLAY_DECLARE(example_synth);
+FASTCODE_OVERLAY_DECLARE(template);
+
+namespace
+{
+
+/**
+ * @brief What runs on the second core with the app.
+ */
+enum class SecondCore
+{
+    NONE,       ///< Free, the UI runs there
+    APP_WORKER, ///< App::SecondCoreWorker()
+    JOB_WORKER, ///< MultiCore::JobWorker, for the app jobs
+};
+
+/**
+ * @brief App of the image, with what its own main.cpp would do.
+ */
+struct AppSlot
+{
+    App *(*create)(void *storage); ///< Constructs the app in the shared storage
+    uint32_t color;                ///< LED color shown when it gets selected
+    SecondCore second_core;        ///< Second core usage
+    bool user_data_upload;         ///< User data can be updated over USB (UserDataUploader)
+    bool sysex_transfer;           ///< User data or presets can be sent over MIDI SysEx
+    FastcodeOverlay fastcode;      ///< FASTCODE_APP functions of the app, loaded by Kastle2::RegisterApp
+};
+
+constexpr std::array<AppSlot, 4> kSlots = {{
+    {.create = [](void *storage) -> App *
+     {
+         return new (storage) AppFxWizard();
+     },
+     .color = WS2812::BLUE,
+     .second_core = SecondCore::APP_WORKER,
+     .user_data_upload = false,
+     .sysex_transfer = false,
+     .fastcode = FASTCODE_OVERLAY(fx_wizard),
+    },
+    {.create = [](void *storage) -> App *
+     {
+         return new (storage) AppWaveBard();
+     },
+     .color = WS2812::GREEN,
+     .second_core = SecondCore::APP_WORKER,
+     .user_data_upload = true,
+     .sysex_transfer = true,
+     .fastcode = FASTCODE_OVERLAY(wave_bard),
+    },
+    {.create = [](void *storage) -> App *
+     {
+         return new (storage) AppExampleSynth();
+     },
+     .color = WS2812::ORANGE,
+     .second_core = SecondCore::JOB_WORKER,
+     .user_data_upload = false,
+     .sysex_transfer = true,
+     .fastcode = FASTCODE_OVERLAY(example_synth),
+    },
+    {.create = [](void *storage) -> App *
+     {
+         return new (storage) AppTemplate();
+     },
+     .color = WS2812::WHITE,
+     .second_core = SecondCore::NONE,
+     .user_data_upload = false,
+     .sysex_transfer = false,
+     .fastcode = FASTCODE_OVERLAY(template),
+    },
+}};
+
+constexpr uint32_t kRebootDelayMs = 100;
+constexpr size_t kSelectBlinks = 3;
+constexpr uint32_t kSelectBlinkMs = 150;
+
+// Storage of the selected app, the apps are never destroyed (switching restarts the Kastle 2)
+alignas(std::max({alignof(AppFxWizard), alignof(AppWaveBard), alignof(AppExampleSynth), alignof(AppTemplate)})) uint8_t app_storage[std::max({sizeof(AppFxWizard), sizeof(AppWaveBard), sizeof(AppExampleSynth), sizeof(AppTemplate)})];
+
+App *app = nullptr;
+
+}
+
+KASTLE2_ARENA(std::max(AppFxWizard::kArenaSize, AppWaveBard::kArenaSize));
+
+static void process_audio(q15_t *input, q15_t *output, size_t size)
+{
+    app->AudioLoop(input, output, size);
+}
+
+static void second_core()
+{
+    app->SecondCoreWorker();
+}
+
+static void midi_callback(midi::Message *msg)
+{
+    // Switching the app stores it and restarts, the next boot starts it
+    if (msg->IsControlChange() && msg->GetData1() == cc::APP_SELECT)
+    {
+        if (msg->GetData2() < kSlots.size())
+        {
+            Kastle2::memory.Write8(Memory::ADDR_APP_SLOT, msg->GetData2());
+            watchdog_reboot(0, 0, kRebootDelayMs);
+        }
+        return;
+    }
+    app->MidiCallback(msg);
+}
+
+static void ui_loop()
+{
+    app->UiLoop();
+}
+
+/**
+ * @brief Reads the stored app, SHIFT held on power-up steps to the next one.
+ */
+static size_t select_slot()
+{
+    uint8_t slot = 0;
+    if (!Kastle2::memory.Read8(Memory::ADDR_APP_SLOT, &slot) || slot >= kSlots.size())
+    {
+        slot = 0;
+    }
+
+    if (Kastle2::hw.Pressed(Hardware::Button::SHIFT))
+    {
+        slot = (slot + 1) % kSlots.size();
+        Kastle2::memory.Write8(Memory::ADDR_APP_SLOT, slot);
+
+        // Shows which app starts, then waits for the release so the app doesn't see the press
+        for (size_t i = 0; i < kSelectBlinks; i++)
+        {
+            Kastle2::hw.SetLed(Hardware::Led::LED_1, kSlots[slot].color);
+            Kastle2::hw.SetLed(Hardware::Led::LED_2, kSlots[slot].color);
+            Kastle2::hw.SetLed(Hardware::Led::LED_3, kSlots[slot].color);
+            Kastle2::hw.LatchLeds();
+            sleep_ms(kSelectBlinkMs);
+            Kastle2::hw.SetLed(Hardware::Led::LED_1, WS2812::NONE);
+            Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::NONE);
+            Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::NONE);
+            Kastle2::hw.LatchLeds();
+            sleep_ms(kSelectBlinkMs);
+        }
+        while (Kastle2::hw.Pressed(Hardware::Button::SHIFT))
+        {
+            Kastle2::ReadInputs();
+        }
+    }
+
+    return slot;
+}
+
+int main()
+{
+    // Initializes the hardware, passing the version chain of the image (test mode starts before any app)
+    Kastle2::Init(VersionChainGenerator::Generate(version::kastle2, APP_VERSION));
+
+    const AppSlot &slot = kSlots[select_slot()];
+
+    // Only the selected app is constructed, it allocates its buffers from the arena in Init
+    app = slot.create(app_storage);
+
+    // Register it with the Kastle 2, with its fast code overlay copied to RAM
+    // Clears the EEPROM app space if the ID is different
+    Kastle2::RegisterApp(app, slot.fastcode);
+
+    // Initialize the app
+    app->Init();
+
+    // Updates of the user data or presets, before the second core starts
+    Kastle2::uploader.SetEnabled(slot.user_data_upload);
+    Kastle2::sysex_transfer.SetEnabled(slot.sysex_transfer);
+
+    // Start second core
+    switch (slot.second_core)
+    {
+    case SecondCore::APP_WORKER:
+        Kastle2::StartSecondCore(second_core);
+        break;
+    case SecondCore::JOB_WORKER:
+        Kastle2::StartSecondCore(MultiCore::JobWorker);
+        break;
+    case SecondCore::NONE:
+        break;
+    }
+
+    // Start I2S
+    Kastle2::StartAudio(process_audio);
+
+    // Set the MIDI callback
+    Kastle2::SetAppMidiCallback(midi_callback);
+
+    // Infinite program loop, with the second core free the UI runs there
+    Kastle2::RunUi(ui_loop, slot.second_core == SecondCore::NONE ? Kastle2::UiCore::CORE_1 : Kastle2::UiCore::CORE_0);
+}
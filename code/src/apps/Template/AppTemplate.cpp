@@ -36,15 +36,19 @@ void AppTemplate::Init()
     // disable audio chain, we are doing it ourselves
     Kastle2::base.SetFeatureEnabled(Base::Feature::AUDIO_CHAIN, false);
 
+    // light load, let the clock drop to save the battery
+    Kastle2::governor.SetEnabled(true);
+
     inited_ = true;
 }
 
 void AppTemplate::DeInit()
 {
     inited_ = false;
+    Kastle2::governor.SetEnabled(false);
 }
 
-FASTCODE void AppTemplate::AudioLoop(q15_t *input, q15_t *output, size_t size)
+FASTCODE_APP(template) void AppTemplate::AudioLoop(q15_t *input, q15_t *output, size_t size)
 {
     if (!inited_)
     {
@@ -41,7 +41,7 @@ namespace kastle2
  * @author Marek Mach (Bastl Instruments)
  * @date 2024-11-14
  */
-class AppTemplate : public virtual App
+class AppTemplate final : public App
 {
 public:
     /**
@@ -71,7 +71,7 @@ public:
      * @param output Output buffer.
      * @param size Number of sample pairs in the buffer (real size of the buffer is 2*size).
      */
-    FASTCODE void AudioLoop(q15_t *input, q15_t *output, size_t size);
+    FASTCODE_APP(template) void AudioLoop(q15_t *input, q15_t *output, size_t size);
 
     /**
      * @brief Called each time AudioLoop isn't busy.
@@ -38,14 +38,9 @@ using namespace kastle2;
 
 AppTemplate app;
 
-static void process_audio(q15_t *input, q15_t *output, size_t size)
+static void ui_loop()
 {
-    app.AudioLoop(input, output, size);
-}
-
-static void midi_callback(midi::Message *msg)
-{
-    app.MidiCallback(msg);
+    app.UiLoop();
 }
 
 int main()
@@ -60,18 +55,12 @@ int main()
     // Initialize the app
     app.Init();
 
-    // Start I2S
-    Kastle2::StartAudio(process_audio);
+    // Start I2S, the audio interrupt calls the app directly
+    Kastle2::StartAudio<app>();
 
     // Set the MIDI callback
-    Kastle2::SetAppMidiCallback(midi_callback);
-
-    // Infinite program loop
-    while (true)
-    {
-        Kastle2::ReadInputs();
-        app.UiLoop();
-    }
+    Kastle2::SetAppMidiCallback<app>();
 
-    return 0;
+    // Infinite program loop, the app doesn't use the second core so the UI runs there
+    Kastle2::RunUi(ui_loop, Kastle2::UiCore::CORE_1);
 }
@@ -28,6 +28,9 @@ SOFTWARE.
 #include "common/core/Kastle2.hpp"
 #include "common/core/MultiCore.hpp"
 #include "common/core/UserDataFile.hpp"
+#include "common/coredata.hpp"
+#include "common/debug/Trace.hpp"
+#include "common/dsp/math/lookup_generators.hpp"
 #include "common/peripherals/WS2812.hpp"
 #include "common/utils.hpp"
 #include "WaveBardParameterMaps.hpp"
@@ -39,20 +42,34 @@ SOFTWARE.
 #define QUANTIZER_ROOT_TRANSPOSES                     // comment out to use the original style of quantizer control, where the root selection only transposes the scale, not the pitch
 #define FILTER_VOLUME_COMPENSATION                    // increases the overall volume when filter is not active
 #define PLAYBACK_CLIPPER                              // used eg. for FX Chorus distortion
+// #define PLAYBACK_CLIPPER_OVERSAMPLING              // runs the playback clipper at 2x against aliasing, costs about 3x the clipper
 #define PASSTHROUGH_MIDI_NOTE                         // if enabled the MIDI note is passed through to the sample playback, otherwise the patch pitch MIDI note is used
 #define LOWEST_TWO_MIDI_OCTAVES_SELECT_ORIGINAL_PITCH // if enabled, the lowest two octaves (0-23) select the original pitch of the sample, otherwise the pitch kept as it is
 
-// Currently we only support this
-#define SUPPORTED_BIT_DEPTH 16
-
 using namespace kastle2;
 
-void AppWaveBard::Init()
+// SecondCoreProcess working set, in the second core's own SRAM bank
+CORE1_DATA DjFilterStereo AppWaveBard::filter_;
+CORE1_DATA Slewer AppWaveBard::filter_volume_compensation_slewer_;
+CORE1_DATA int32_t AppWaveBard::filter_volume_compensation_;
+CORE1_DATA SoftClipper AppWaveBard::playback_clipper_;
+#ifdef PLAYBACK_CLIPPER_OVERSAMPLING
+CORE1_DATA Oversampler<2> AppWaveBard::playback_oversamplers_[2];
+#endif
+CORE1_DATA SoftClipper AppWaveBard::soft_clipper_;
+CORE1_DATA Compressor AppWaveBard::fx_compressor_;
+
+// Equal-power fade out of the stolen voices in 64 steps, plus the guard entry of the interpolation
+static constexpr size_t kStealFadeSteps = 64;
+FASTDATA static const std::array<int16_t, kStealFadeSteps + 2> steal_fade =
+    lookup_equal_power_fade_table<int16_t, kStealFadeSteps + 1, 1>(32767.0);
+
+COLDCODE void AppWaveBard::Init()
 {
     inited_ = false;
 
     // Fail if the samples are not loaded
-    if (!LoadSamples() || samples_.bit_depth != SUPPORTED_BIT_DEPTH)
+    if (!LoadSamples())
     {
         Kastle2::base.SetAllFeaturesEnabled(false);
         Kastle2::hw.SetLed(Hardware::Led::LED_3, 0);
@@ -88,17 +105,38 @@ void AppWaveBard::Init()
     // Fake Tempo and LFO LEDs
     Kastle2::base.GetFakeBlinker().SetEnabled(true);
 
-    // We have two players to prevent clicks when retrigerring/switching samples
-    for (auto &player : players_)
+    // A pool of voices, so the retriggered samples ring out instead of cutting
+    // The streamed ones read the sample through their own SRAM cache, so they don't fight over the XIP cache
+    for (size_t i = 0; i < kVoiceCount; i++)
     {
+        auto &voice = voices_[i];
+        if (i < kStreamedVoices)
+        {
+            streams_[i].Init();
+            voice.player.SetStream(&streams_[i]);
+        }
+        voice.player.SetAdpcmDecoder(&voice.adpcm_decoder);
+
         // Samples sample-rate is stored in the Wave Bard file
         // Can (and usually is) be different from the system sample rate
-        player.Init(SAMPLE_RATE, samples_.sample_rate);
-        player.SetHifi(true);
+        voice.player.Init(SAMPLE_RATE, samples_.sample_rate);
+        voice.player.SetHifi(true);
+        voice.fade = 0;
+        voice.age = 0;
+        voice.warm_start = kWarmStartSets;
     }
 
-    // The active player is the one which is currently outputting audio
-    active_player_ = PlayerDeck::A;
+    // The active voice is the one which plays with envelope_ and follows the controls
+    active_voice_ = 0;
+    pending_voice_ = kVoiceCount;
+    voice_starts_ = 0;
+
+    // The warm starts are filled by the UI loop once the bank is known, whole words for each sample
+    for (WarmStart &warm_start : warm_starts_)
+    {
+        warm_start.bank = kNoBank;
+    }
+    warm_start_bytes_ = (kWarmStartBytes / samples_.num_samples) & ~3u;
 
     // Quantizer stuff
     quantizer_.Init();
@@ -107,96 +145,99 @@ void AppWaveBard::Init()
 
     // Initialize the bank selector
     bank_select_.Init(samples_.num_banks);
+
+    // What the MIDI notes do depends on the number of samples in a bank
+    BuildMidiNoteMap();
     input_audio_through_fx_ = Kastle2::memory.Get8(kMemAudioRouting) != 0;
 
     // POTS
 
     // Normal layer
-    pots_[Pot::PITCH_MOD] = FancyPot::Create({
+    pots_[Pot::PITCH_MOD] = FancyPot({
         .pot = Hardware::Pot::POT_1,
         .layer = Hardware::Layer::NORMAL,
         .midi_cc = cc::PITCH_MOD,
         .deadzone = true,
     });
-    pots_[Pot::SAMPLE_MOD] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
-                                               .layer = Hardware::Layer::NORMAL,
-                                               .midi_cc = cc::SAMPLE_MOD,
-                                               .deadzone = true,
-                                               .freeze = true});
-    pots_[Pot::ENVELOPE] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
-                                             .layer = Hardware::Layer::NORMAL,
-                                             .midi_cc = cc::LENGTH,
-                                             .deadzone = true});
-    pots_[Pot::PITCH] = FancyPot::Create({.pot = Hardware::Pot::POT_5,
-                                          .layer = Hardware::Layer::NORMAL,
-                                          .midi_cc = cc::PITCH});
-    pots_[Pot::SAMPLE] = FancyPot::Create({.pot = Hardware::Pot::POT_6,
-                                           .layer = Hardware::Layer::NORMAL,
-                                           .map_size = samples_.num_samples,
-                                           .midi_cc = cc::SAMPLE,
-                                           .midi_note_control = {
-                                               .start = 0,                       // Start at note 0
-                                               .repeat = kMidiNoteControlRepeat, // Repeat each 12 notes
-                                               .end = kMidiMinNote,              // End at note 36 (exclusive)
-                                           },
-                                           .freeze = true});
-
-    // Shift layer
-    pots_[Pot::ENVELOPE_MOD] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
-                                                 .layer = Hardware::Layer::SHIFT,
-                                                 .initial_value = POT_MAX,
-                                                 .midi_cc = cc::LENGTH_MOD,
-                                                 .deadzone = true});
-    pots_[Pot::FX] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
-                                       .layer = Hardware::Layer::SHIFT,
-                                       .midi_cc = cc::FX,
+    pots_[Pot::SAMPLE_MOD] = FancyPot({.pot = Hardware::Pot::POT_2,
+                                       .layer = Hardware::Layer::NORMAL,
+                                       .midi_cc = cc::SAMPLE_MOD,
                                        .deadzone = true,
                                        .freeze = true});
-    pots_[Pot::FILTER] = FancyPot::Create({.pot = Hardware::Pot::POT_6,
-                                           .layer = Hardware::Layer::SHIFT,
-                                           .midi_cc = cc::FILTER,
-                                           .deadzone = true});
+    pots_[Pot::ENVELOPE] = FancyPot({.pot = Hardware::Pot::POT_4,
+                                     .layer = Hardware::Layer::NORMAL,
+                                     .midi_cc = cc::LENGTH,
+                                     .deadzone = true});
+    pots_[Pot::PITCH] = FancyPot({.pot = Hardware::Pot::POT_5,
+                                  .layer = Hardware::Layer::NORMAL,
+                                  .midi_cc = cc::PITCH});
+    pots_[Pot::SAMPLE] = FancyPot({.pot = Hardware::Pot::POT_6,
+                                   .layer = Hardware::Layer::NORMAL,
+                                   .map_size = samples_.num_samples,
+                                   .midi_cc = cc::SAMPLE,
+                                   .midi_note_control = {
+                                       .start = 0,                       // Start at note 0
+                                       .repeat = kMidiNoteControlRepeat, // Repeat each 12 notes
+                                       .end = kMidiMinNote,              // End at note 36 (exclusive)
+                                   },
+                                   .freeze = true});
+
+    // Shift layer
+    pots_[Pot::ENVELOPE_MOD] = FancyPot({.pot = Hardware::Pot::POT_4,
+                                         .layer = Hardware::Layer::SHIFT,
+                                         .initial_value = POT_MAX,
+                                         .midi_cc = cc::LENGTH_MOD,
+                                         .deadzone = true});
+    pots_[Pot::FX] = FancyPot({.pot = Hardware::Pot::POT_2,
+                               .layer = Hardware::Layer::SHIFT,
+                               .midi_cc = cc::FX,
+                               .deadzone = true,
+                               .freeze = true});
+    pots_[Pot::FILTER] = FancyPot({.pot = Hardware::Pot::POT_6,
+                                   .layer = Hardware::Layer::SHIFT,
+                                   .midi_cc = cc::FILTER,
+                                   .deadzone = true});
 
     // Mode layer
-    pots_[Pot::PITCH_SCALE] = FancyPot::Create({.pot = Hardware::Pot::POT_1,
-                                                .layer = Hardware::Layer::MODE,
-                                                .map_size = samples_.num_scales,
-                                                .midi_cc = cc::SCALE,
-                                                .deadzone = true,
-                                                .memory_addr = kMemPotScale});
-    pots_[Pot::PITCH_ROOT] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
-                                               .layer = Hardware::Layer::MODE,
-                                               .initial_value = POT_MIN,
-                                               .map_size = 12, // 12 semitones
-                                               .midi_cc = cc::ROOT,
-                                               .memory_addr = kMemPotRoot});
-    pots_[Pot::PITCH_FINE] = FancyPot::Create({.pot = Hardware::Pot::POT_3,
-                                               .layer = Hardware::Layer::MODE,
-                                               .midi_cc = cc::FINE,
-                                               .deadzone = true,
-                                               .memory_addr = kMemPotFine});
-    pots_[Pot::BANK_MOD] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
-                                             .layer = Hardware::Layer::MODE,
-                                             .initial_value = POT_MAX,
-                                             .midi_cc = cc::BANK_MOD});
-    pots_[Pot::PITCH_QUANTIZED] = FancyPot::Create({.pot = Hardware::Pot::POT_5,
-                                                    .layer = Hardware::Layer::MODE});
+    pots_[Pot::PITCH_SCALE] = FancyPot({.pot = Hardware::Pot::POT_1,
+                                        .layer = Hardware::Layer::MODE,
+                                        .map_size = samples_.num_scales,
+                                        .midi_cc = cc::SCALE,
+                                        .deadzone = true,
+                                        .memory_addr = kMemPotScale});
+    pots_[Pot::PITCH_ROOT] = FancyPot({.pot = Hardware::Pot::POT_2,
+                                       .layer = Hardware::Layer::MODE,
+                                       .initial_value = POT_MIN,
+                                       .map_size = 12, // 12 semitones
+                                       .midi_cc = cc::ROOT,
+                                       .memory_addr = kMemPotRoot});
+    pots_[Pot::PITCH_FINE] = FancyPot({.pot = Hardware::Pot::POT_3,
+                                       .layer = Hardware::Layer::MODE,
+                                       .midi_cc = cc::FINE,
+                                       .deadzone = true,
+                                       .memory_addr = kMemPotFine});
+    pots_[Pot::BANK_MOD] = FancyPot({.pot = Hardware::Pot::POT_4,
+                                     .layer = Hardware::Layer::MODE,
+                                     .initial_value = POT_MAX,
+                                     .midi_cc = cc::BANK_MOD});
+    pots_[Pot::PITCH_QUANTIZED] = FancyPot({.pot = Hardware::Pot::POT_5,
+                                            .layer = Hardware::Layer::MODE});
 
     // Advanced settings
-    pots_[Pot::AUDIO_ROUTE] = FancyPot::Create({.pot = Hardware::Pot::POT_5,
-                                                .layer = Hardware::Layer::SETTINGS});
+    pots_[Pot::AUDIO_ROUTE] = FancyPot({.pot = Hardware::Pot::POT_5,
+                                        .layer = Hardware::Layer::SETTINGS});
 
-    for (auto &pot : pots_)
-    {
-        pot->Init(AUDIO_LOOP_RATE);
-    }
+    // Pot autofreeze runs in the control-rate scheduler
+    pots_.Init(ControlScheduler::GetRate(kPotDivisor));
+    Kastle2::base.GetScheduler().Add<FancyPotBank<Pot>, &FancyPotBank<Pot>::Process>(&pots_, kPotDivisor);
+    Kastle2::base.GetScheduler().Add<FancyMode, &FancyMode::Process>(&bank_select_);
 
     // This disables the next change when the pots are moved
     // or when the current layer time is over the specified number of ticks
     bank_select_.DisableNextChangeWhen(pots_, kModeShortPressUnder);
 
     // Disable Length CC pot sending - we send our own length manually as split values
-    Kastle2::base.SetMidiOutPotEnabled(pots_[Pot::ENVELOPE]->GetPot(), false);
+    Kastle2::base.SetMidiOutPotEnabled(pots_[Pot::ENVELOPE].GetPot(), false);
 
     sample_bank_selected_ = bank_select_.GetMode();
     sample_num_selected_ = 0;
@@ -214,21 +255,25 @@ void AppWaveBard::Init()
     quantization_enabled_ = false;
 
     delay_feedback_ = Q15_ZERO;
-    delay_mix_ = Q15_ZERO;
+    delay_mix_ramp_.Init(Q15_ZERO);
     delay_stereo_left_ = 0;
     delay_stereo_right_ = 0;
 
     ui_indicate_change_time_ = 0;
 
-    delay_left_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(22000);
-    delay_right_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(22000);
+    delay_left_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(Kastle2::arena.Allocate<q15least_t>(kDelayLength));
+    delay_right_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(Kastle2::arena.Allocate<q15least_t>(kDelayLength));
 
 #ifdef PLAYBACK_CLIPPER
     playback_clipper_.Init(SAMPLE_RATE);
     playback_clipper_.SetDrive(0);
+#ifdef PLAYBACK_CLIPPER_OVERSAMPLING
+    for (auto &oversampler : playback_oversamplers_)
+    {
+        oversampler.Reset();
+    }
+#endif
 #endif
-    fx_input_clipper_.Init(SAMPLE_RATE);
-    fx_input_clipper_.SetDrive(0);
     soft_clipper_.Init(SAMPLE_RATE);
     soft_clipper_.SetDrive(0);
     filter_.Init(SAMPLE_RATE);
@@ -236,10 +281,15 @@ void AppWaveBard::Init()
     // Filter volume compensation because of the resonance
     filter_volume_compensation_slewer_.Init();
     filter_volume_compensation_slewer_.SetSpeed(3);
+    filter_volume_compensation_slewer_.SetValue(q15(0.768f));
+    filter_volume_compensation_slewer_.Jump();
+    filter_volume_compensation_ = q15_reciprocal(filter_volume_compensation_slewer_.GetValue());
 
-    fx_compressor_.Init(SAMPLE_RATE);
+    // The compressor gain is updated once per second core sub-block
+    fx_compressor_.Init(SAMPLE_RATE / MultiCore::kSubBlockSize);
     fx_compressor_.SetAttackTime(kCompressorAttack);
     fx_compressor_.SetReleaseTime(kCompressorRelease);
+    fx_compressor_.SetCurve(float_to_q15(kCompressorThreshold), float_to_q15(kCompressorFullLevel), float_to_q15(kCompressorMinGain));
 
     envelope_.Init(SAMPLE_RATE);
     envelope_.SetAttackTime(0.001f);
@@ -260,13 +310,6 @@ void AppWaveBard::Init()
     envelope_out_.SetDecayTime(0.7);
     envelope_out_.SetNonResetting(AdsrEnv::NonResetting::NONE);
 
-    // Fadeout envelope that prevents clicks
-    fadeout_envelope_.Init(SAMPLE_RATE);
-    fadeout_envelope_.SetAttackTime(0.0000001f);
-    fadeout_envelope_.SetDecayTime(0.01f);
-    fadeout_envelope_.SetNonResetting(AdsrEnv::NonResetting::NONE);
-    fadeout_envelope_max_ = Q15_MAX;
-
     note_sender_.Init(AUDIO_LOOP_RATE);
     note_sender_.SetDuration(1.0f);
 
@@ -279,37 +322,48 @@ void AppWaveBard::Init()
 
     pitch_source_ = PitchSource::PATCH;
 
+    probe_filter_ = Kastle2::probes.Add("filter");
+
     inited_ = true;
 }
 
 void AppWaveBard::DeInit()
 {
     inited_ = false;
+    Kastle2::base.GetScheduler().Clear();
+
+    for (auto &stream : streams_)
+    {
+        stream.DeInit();
+    }
+
+    // Delay lines and the sample banks use the arena memory, release them before the arena
+    delay_left_.reset();
+    delay_right_.reset();
+    samples_.index = nullptr;
+    samples_.slices = nullptr;
+    Kastle2::arena.Reset();
 }
 
-FASTCODE void AppWaveBard::AudioLoop(q15_t *input, q15_t *output, size_t size)
+FASTCODE_APP(wave_bard) void AppWaveBard::AudioLoop(q15_t *input, q15_t *output, size_t size)
 {
     if (!inited_)
     {
         return;
     }
 
-    for (auto &pot : pots_)
-    {
-        pot->Process();
-    }
-
-    bank_select_.Process();
-
-    if (trigger_.Process(Kastle2::hw.GetTriggerIn()))
+    if (trigger_.Process() > 0)
     {
+        // The edges start the sample at their frame (eg. the ratchets of the sequencer gate)
+        const uint32_t trigger_frame = Kastle2::GetAudioFrame() + trigger_.GetFrame() + kTriggerLatencyFrames;
 #ifndef DONT_RETRIGGER_IN_REVERSE
-        Trigger();
+        TriggerAt(trigger_frame);
 #else
         // Trigger the sample (if not in reverse playback)
-        if (!(players_[active_player_].IsPlaying() && players_[active_player_].GetReverse()))
+        const auto &player = voices_[active_voice_].player;
+        if (!(player.IsPlaying() && player.GetReverse()))
         {
-            Trigger();
+            TriggerAt(trigger_frame);
         }
 #endif
     }
@@ -322,17 +376,11 @@ FASTCODE void AppWaveBard::AudioLoop(q15_t *input, q15_t *output, size_t size)
     output_buffer_ = output;
     buffer_size_ = size;
 
-    // Update the compressor
-    q15_t peak;
-    // cut off anything that's below the distortion threshold
-    peak = std::max(fx_compressor_max_ - q15(0.166f), Q15_ZERO);
-    // expand it to full-range
-    peak = q15_div(peak, q15(0.4f));
-    fx_compressor_.UpdatePeak(peak);
-    fx_compressor_max_ = Q15_ZERO;
+    // Parameters ramped over the block
+    delay_mix_ramp_.Start(size);
 
     // Tell the second core we're starting a new block
-    MultiCore::SendMessage(MultiCore::MessageType::BEGIN);
+    MultiCore::BeginBlock(size);
 
     // Envelope indicator and out envelope can be processed in interrupt rate (not audio rate)
     envelope_indicator_.Process();
@@ -346,59 +394,80 @@ FASTCODE void AppWaveBard::AudioLoop(q15_t *input, q15_t *output, size_t size)
     lfo_value = (lfo_value >> 22) + 512;
     chorus_lfo_val_ = lfo_value;
 
-    // Go through all buffer
-    for (size_t i = 0; i < size; i++)
+    // The voice loaded by the last trigger takes over envelope_, the voices are rendered one second core sub-block at a time
+    StartPendingVoice(size);
+
+    // Aligned for the packed stereo loads (q15x2_load)
+    alignas(4) int16_t voice_frames[2 * MultiCore::kSubBlockSize];
+    for (size_t offset = 0; offset < size; offset += MultiCore::kSubBlockSize)
     {
-        q15_t left = 0;
-        q15_t right = 0;
+        const size_t count = std::min(MultiCore::kSubBlockSize, size - offset);
 
-        envelope_.Process();
-        fadeout_envelope_.Process();
+        // Amplitude envelope of the active voice, exact every few samples
+        q31_t envelope[MultiCore::kSubBlockSize];
+        envelope_.ProcessBlock(envelope, count);
 
-        // Main player
-        auto &main_player = players_[active_player_];
-        if (main_player.IsPlaying())
+        // Both channels of each frame packed in one word, the active voice is mixed first
+        q15x2_t frames[MultiCore::kSubBlockSize] = {};
+        for (size_t n = 0; n < kVoiceCount; n++)
         {
-            // Read sample
-            main_player.Process();
-            left = main_player.GetLeft();
-            right = main_player.GetRight();
-
-            // Apply envelope
-            q15_t env = q31_to_q15(envelope_.GetOutput());
-            left = q15_mult(left, env);
-            right = q15_mult(right, env);
-        }
+            const size_t index = (active_voice_ + n) % kVoiceCount;
+            Voice &voice = voices_[index];
+            if (!voice.player.IsPlaying())
+            {
+                continue;
+            }
+            voice.player.ProcessBlock<kSampleInterpolation>(voice_frames, count);
 
-        // Other player
-        auto &other_player = players_[EnumIncrement<PlayerDeck>(active_player_)];
-        if (other_player.IsPlaying() && fadeout_envelope_.IsActive())
-        {
-            // Read sample
-            other_player.Process();
-            q15_t other_left = other_player.GetLeft();
-            q15_t other_right = other_player.GetRight();
-
-            // Apply envelope
-            q15_t e = q31_to_q15(fadeout_envelope_.GetOutput());
-            other_left = q15_mult(other_left, e);
-            other_right = q15_mult(other_right, e);
-
-            // Apply max
-            other_left = q15_mult(other_left, fadeout_envelope_max_);
-            other_right = q15_mult(other_right, fadeout_envelope_max_);
-
-            // Mix (hopefully won't clip much...)
-            left = q15_add(left, other_left);
-            right = q15_add(right, other_right);
+            if (index == active_voice_)
+            {
+                for (size_t j = 0; j < count; j++)
+                {
+                    // Apply envelope
+                    q15_t env = q31_to_q15(envelope[j]);
+                    frames[j] = q15x2_add(frames[j], q15x2_mult(q15x2_load(voice_frames + 2 * j), env));
+                }
+                continue;
+            }
+
+            // Ringing voice, with the envelope it had when retriggered and the fade out when stolen
+            q31_t ring_envelope[MultiCore::kSubBlockSize];
+            voice.envelope.ProcessBlock(ring_envelope, count);
+            for (size_t j = 0; j < count; j++)
+            {
+                q15_t env = q31_to_q15(ring_envelope[j]);
+                if (voice.fade > 0)
+                {
+                    env = q15_mult(env, StealFadeGain(kStealFadeFrames - voice.fade + j));
+                }
+                frames[j] = q15x2_add(frames[j], q15x2_mult(q15x2_load(voice_frames + 2 * j), env));
+            }
+
+            // Free the voice once it's silent
+            if (voice.fade > 0)
+            {
+                voice.fade = voice.fade > count ? voice.fade - count : 0;
+                if (voice.fade == 0)
+                {
+                    voice.player.Reset();
+                }
+            }
+            else if (!voice.envelope.IsActive())
+            {
+                voice.player.Reset();
+            }
         }
 
-        // Fill the output buffer
-        output[2 * i] = left;
-        output[2 * i + 1] = right;
+        for (size_t j = 0; j < count; j++)
+        {
+            // Fill the output buffer
+            const size_t i = offset + j;
+            output[2 * i] = q15x2_left(frames[j]);
+            output[2 * i + 1] = q15x2_right(frames[j]);
 
-        // Tell the second core it can process this sample
-        MultiCore::SendMessage(MultiCore::MessageType::SAMPLE_REQUEST, i);
+            // Hand the finished sub-block over to the second core
+            MultiCore::PublishFrame(i);
+        }
     }
 
     // Do time-precise addition for counters
@@ -408,210 +477,175 @@ FASTCODE void AppWaveBard::AudioLoop(q15_t *input, q15_t *output, size_t size)
     }
 
     // Wait for samples to finish processing
-    MultiCore::WaitForMessage(MultiCore::MessageType::DONE);
+    MultiCore::WaitForBlock();
 }
 
-FASTCODE void AppWaveBard::SecondCoreProcess(size_t index)
+FASTCODE_APP(wave_bard) void AppWaveBard::SecondCoreProcess(size_t from, size_t to)
 {
-    bool has_audio_input = Kastle2::hw.IsAudioInJackProbablyPlugged();
-
-    // Clean input
-    q15_t left_input = 0;
-    q15_t right_input = 0;
-
-    // Read samples from the input
-    if (has_audio_input)
-    {
-        left_input = input_buffer_[2 * index];
-        right_input = input_buffer_[2 * index + 1];
-    }
-
-    // Read samples from the output
-    q15_t left = output_buffer_[2 * index];
-    q15_t right = output_buffer_[2 * index + 1];
+    const bool has_audio_input = Kastle2::hw.IsAudioInJackProbablyPlugged();
+    const bool input_before_fx = has_audio_input && input_audio_through_fx_;
+    const bool input_after_fx = has_audio_input && !input_audio_through_fx_;
 
-    // get the loudest sample for the compressor and update it
-    q15_t combined_input = q15_mult(left_input, q15(0.7f)) + q15_mult(left, q15(0.3f));
-    if (q15_abs(combined_input) > fx_compressor_max_)
-    {
-        fx_compressor_max_ = combined_input;
-    }
-    combined_input = q15_mult(right_input, q15(0.7f)) + q15_mult(right, q15(0.3f));
-    if (q15_abs(combined_input) > fx_compressor_max_)
-    {
-        fx_compressor_max_ = combined_input;
-    }
-
-    // Compress the input
-    compress_amount_ = q15_inv(fx_compressor_.CalculateEnvelope());
-    if (compress_amount_ < q15(0.5f))
-    {
-        compress_amount_ = q15_add(compress_amount_, q15(0.5f));
-    }
-    else
-    {
-        compress_amount_ = q15(1.0f);
-    }
-
-    // Mix input before other effects if it's set to that
-    // the input is too hot for some reason so I have to turn it down first (it's exactly 2 times as loud)
-    left_input = q15_mult(left_input, Q15_HALF);
-    right_input = q15_mult(right_input, Q15_HALF);
+    // Expands the mix back after the compression, (the compression is much more aggressive than the previous "above 0.5")
+    constexpr int32_t kMixExpand = q15_reciprocal(q15(0.3f));
+#ifndef FILTER_VOLUME_COMPENSATION
+    // 0.768016042 is compensation for the filter gain, adjusted for resonance to not clip
+    // (calculated by measuring the output of the filter and comparing it to the input)
+    constexpr int32_t kFilterCompensation = q15_reciprocal(q15(0.768016042f));
+#endif
 
-    if (has_audio_input && input_audio_through_fx_)
+    // The stages run over one sub-block at a time, so the working buffers stay small
+    for (size_t offset = from; offset < to; offset += MultiCore::kSubBlockSize)
     {
-        // make the sum of signals equal to 1
-        left_input = q15_mult(left_input, q15(0.7f));
-        right_input = q15_mult(right_input, q15(0.7f));
-        left = q15_mult(left, q15(0.3f));
-        right = q15_mult(right, q15(0.3f));
-
-        // sum them
-        left = q15_add(left, left_input);
-        right = q15_add(right, right_input);
+        const size_t size = std::min(MultiCore::kSubBlockSize, to - offset);
+        const size_t samples = 2 * size;
+        q15_t *output = output_buffer_ + 2 * offset;
 
-        // compress them
-        left = q15_mult(left, compress_amount_);
-        right = q15_mult(right, compress_amount_);
+        // Clean input, unless something is plugged in
+        q15_t input[2 * MultiCore::kSubBlockSize];
+        for (size_t i = 0; i < samples; i++)
+        {
+            input[i] = has_audio_input ? input_buffer_[2 * offset + i] : 0;
+        }
 
-        // expand them back (the compression is much more aggressive than the previous "above 0.5")
-        left = q15_div(left, q15(0.3f));
-        right = q15_div(right, q15(0.3f));
+        // Compress the input mix, measured on the sidechain of this sub-block
+        // (nothing to compress when no input is mixed in)
+        int32_t compress_gain[MultiCore::kSubBlockSize];
+        if (has_audio_input)
+        {
+            fx_compressor_.Detect(input, q15(0.7f), output, q15(0.3f), samples);
+            fx_compressor_.Update(size);
+            fx_compressor_.ProcessGain(compress_gain, size);
+        }
 
-        // if the input is routed through the effects, apply distortion here (fx distortion has an envelope which we don't want here)
-        left_input = fx_input_clipper_.Process(left_input);
-        right_input = fx_input_clipper_.Process(right_input);
-        left_input = q15_mult(left_input, fx_volume_compensation_);
-        right_input = q15_mult(right_input, fx_volume_compensation_);
-    }
+        // Mix input before other effects if it's set to that
+        // the input is too hot for some reason so I have to turn it down first (it's exactly 2 times as loud)
+        if (input_before_fx)
+        {
+            for (size_t i = 0; i < samples; i++)
+            {
+                output[i] = MixInput(output[i], q15_mult(input[i], Q15_HALF), compress_gain[i / 2], kMixExpand);
+            }
+        }
 
 #ifdef PLAYBACK_CLIPPER
-    // Apply clipping
-    left = playback_clipper_.Process(left);
-    right = playback_clipper_.Process(right);
+        // Apply clipping
+#ifdef PLAYBACK_CLIPPER_OVERSAMPLING
+        playback_oversamplers_[0].ProcessBlock(playback_clipper_, output, output, size, 2);
+        playback_oversamplers_[1].ProcessBlock(playback_clipper_, output + 1, output + 1, size, 2);
+#else
+        playback_clipper_.ProcessBlock(output, output, samples);
+#endif
 #endif
-    left = q15_mult(left, fx_volume_compensation_);
-    right = q15_mult(right, fx_volume_compensation_);
-
 
-    // Apply DJ filter
-    filter_.Process(left, right);
+        // Apply DJ filter, with the volume compensation using slewer to avoid zipper noise
+        // (the slewer moves the value by a few LSBs per frame, one division per sub-block while it moves)
 #ifdef FILTER_VOLUME_COMPENSATION
-    // Process filter volume compensation using slewer to avoid zipper noise
-    q15_t comp = filter_volume_compensation_slewer_.Process();
-    left = q15_div(filter_.GetLeft(), comp);
-    right = q15_div(filter_.GetRight(), comp);
+        if (filter_volume_compensation_slewer_.ProcessBlock(size))
+        {
+            filter_volume_compensation_ = q15_reciprocal(filter_volume_compensation_slewer_.GetValue());
+        }
+        const int32_t filter_compensation = filter_volume_compensation_;
 #else
-    // 0.768016042 is compensation for the filter gain, adjusted for resonance to not clip
-    // (calculated by measuring the output of the filter and comparing it to the input)
-    left = q15_div(filter_.GetLeft(), q15(0.768016042f));
-    right = q15_div(filter_.GetRight(), q15(0.768016042f));
+        const int32_t filter_compensation = kFilterCompensation;
 #endif
+        for (size_t i = 0; i < samples; i++)
+        {
+            output[i] = q15_mult(output[i], fx_volume_compensation_);
+        }
+        filter_.ProcessBlock(output, output, size);
+        for (size_t i = 0; i < samples; i++)
+        {
+            output[i] = q15_mult_reciprocal(output[i], filter_compensation);
+        }
+        Kastle2::probes.TapBlock(probe_filter_, output, size);
+
+        // Apply Delay
+        q15_t delay_mix[MultiCore::kSubBlockSize];
+        delay_mix_ramp_.Process(delay_mix, size);
+        for (size_t i = 0; i < size; i++)
+        {
+            q15_t *frame = output + 2 * i;
+            // save delayed sample and prevent hard clipping
+            q15_t delayed_left = soft_clipper_.Process(q15_saturate(delay_left_->Read() * 2));
+            q15_t delayed_right = soft_clipper_.Process(q15_saturate(delay_right_->Read() * 2));
+            // update delay with feedback
+            delay_left_->Write(q15_mult(frame[0], Q15_HALF) + q15_mult(delayed_left, delay_feedback_ / 2));
+            delay_right_->Write(q15_mult(frame[1], Q15_HALF) + q15_mult(delayed_right, delay_feedback_ / 2));
+            // add delay to output
+            frame[0] = q15_mult(frame[0], Q15_MAX - delay_mix[i]) + q15_mult(delayed_left, delay_mix[i]);
+            frame[1] = q15_mult(frame[1], Q15_MAX - delay_mix[i]) + q15_mult(delayed_right, delay_mix[i]);
+        }
 
-    // Apply Delay
-    // save delayed sample and prevent hard clipping
-    q15_t delayed_left = soft_clipper_.Process(q15_div(delay_left_->Read(), Q15_HALF));
-    q15_t delayed_right = soft_clipper_.Process(q15_div(delay_right_->Read(), Q15_HALF));
-    // update delay with feedback
-    delay_left_->Write(q15_mult(left, Q15_HALF) + q15_mult(delayed_left, delay_feedback_ / 2));
-    delay_right_->Write(q15_mult(right, Q15_HALF) + q15_mult(delayed_right, delay_feedback_ / 2));
-    // add delay to output
-    left = q15_mult(left, Q15_MAX - delay_mix_) + q15_mult(delayed_left, delay_mix_);
-    right = q15_mult(right, Q15_MAX - delay_mix_) + q15_mult(delayed_right, delay_mix_);
-
-    // Mix input after effects if it's set to that
-    if (has_audio_input && !input_audio_through_fx_)
-    {
-
-        // make the sum of signals equal to 1
-        left_input = q15_mult(left_input, q15(0.7f));
-        right_input = q15_mult(right_input, q15(0.7f));
-        left = q15_mult(left, q15(0.3f));
-        right = q15_mult(right, q15(0.3f));
-        // sum them
-        left = q15_add(left, left_input);
-        right = q15_add(right, right_input);
-        // compress them
-        left = q15_mult(left, compress_amount_);
-        right = q15_mult(right, compress_amount_);
-        // expand them back (the compression is much more aggressive than the previous "above 0.5")
-        left = q15_div(left, q15(0.3f));
-        right = q15_div(right, q15(0.3f));
-    }
-
-    // Write the samples back to the buffer
-    output_buffer_[2 * index] = left;
-    output_buffer_[2 * index + 1] = right;
+        // Mix input after effects if it's set to that
+        if (input_after_fx)
+        {
+            for (size_t i = 0; i < samples; i++)
+            {
+                output[i] = MixInput(output[i], q15_mult(input[i], Q15_HALF), compress_gain[i / 2], kMixExpand);
+            }
+        }
+    }
 }
 
-FASTCODE void AppWaveBard::SecondCoreWorker()
+inline q15_t AppWaveBard::MixInput(q15_t playback, q15_t input, q15_t gain, int32_t expand)
+{
+    // make the sum of signals equal to 1
+    const q15_t sum = q15_add(q15_mult(playback, q15(0.3f)), q15_mult(input, q15(0.7f)));
+    // compress them and expand them back
+    return q15_mult_reciprocal(q15_mult_fast(sum, gain), expand);
+}
+
+FASTCODE_APP(wave_bard) void AppWaveBard::SecondCoreWorker()
 {
     while (inited_)
     {
-        if (MultiCore::HasMessage())
+        size_t from, to;
+        if (MultiCore::GetPublishedFrames(from, to))
         {
             // Monitoring second core performance
             Kastle2::hw.SetDebugPin(1, 1);
 
-            MultiCore::Message m = MultiCore::GetMessage();
-            switch (m.type)
+            Profiler::Start(Profiler::Section::SECOND_CORE);
+            Trace::Begin(TraceSpan::SECOND_CORE, static_cast<int32_t>(from | to << 16));
+            SecondCoreProcess(from, to);
+            Trace::End(TraceSpan::SECOND_CORE, static_cast<int32_t>(from | to << 16));
+            Profiler::Stop(Profiler::Section::SECOND_CORE);
+            if (to == buffer_size_)
             {
-            case MultiCore::MessageType::BEGIN:
-                second_core_processed_samples_ = 0;
-                break;
-            case MultiCore::MessageType::SAMPLE_REQUEST:
-                SecondCoreProcess(m.data);
-                second_core_processed_samples_++;
-                if (second_core_processed_samples_ == buffer_size_)
-                {
-                    MultiCore::SendMessage(MultiCore::MessageType::DONE);
-                }
-                break;
+                Profiler::Commit(Profiler::Section::SECOND_CORE);
             }
+            MultiCore::MarkFramesProcessed(to);
 
             Kastle2::hw.SetDebugPin(1, 0);
         }
+        else
+        {
+            MultiCore::WaitForWork();
+        }
     }
 }
 
 void AppWaveBard::MidiCallback(midi::Message *msg)
 {
     // Pass the message to all pots so they can handle CCs
-    for (auto &pot : pots_)
-    {
-        pot->MidiCallback(msg);
-    }
+    pots_.MidiCallback(msg);
 
     // Pass the message to the bank selector
     bank_select_.MidiCallback(msg);
 
-    // Note playing
+    // Note playing, the sample switching notes are handled by the pot
     if (msg->IsNoteOn())
     {
-        uint32_t note = msg->GetData1();
-
-        // Kinda ugly since we do the similar thing in the FancyPot but whatever
-        if (note < kMidiMinNote && (note % kMidiNoteControlRepeat < samples_.num_samples))
+        const MidiNoteMapping &mapping = midi_note_map_[msg->GetData1() % kMidiNotes];
+        if (mapping.pitch_note != kNoPitchNote)
         {
-#ifdef LOWEST_TWO_MIDI_OCTAVES_SELECT_ORIGINAL_PITCH
-            // If below this note, select the base note
-            if (note < kMidiTriggerOriginalPitchBelow)
-            {
-                midi_note_ = kMidiBaseNote;
-                pitch_source_ = PitchSource::MIDI;
-            }
-#endif
-
-            // Switching samples notes - trigger
-            // Sample switching is handled by pot
-            Trigger();
+            midi_note_ = mapping.pitch_note;
+            pitch_source_ = PitchSource::MIDI;
         }
-        else if (note >= kMidiMinNote)
+        if (mapping.triggers)
         {
-            // Normal play notes
-            midi_note_ = note;
-            pitch_source_ = PitchSource::MIDI;
-            Trigger();
+            TriggerMidi(msg);
         }
     }
 
@@ -622,9 +656,40 @@ void AppWaveBard::MidiCallback(midi::Message *msg)
     }
 }
 
+COLDCODE void AppWaveBard::BuildMidiNoteMap()
+{
+    for (size_t note = 0; note < kMidiNotes; note++)
+    {
+        MidiNoteMapping &mapping = midi_note_map_[note];
+        const int32_t relative_note = static_cast<int32_t>(note) - static_cast<int32_t>(kMidiBaseNote);
+        mapping.pitch = std::pow(2.0f, relative_note / 12.0f);
+        mapping.pitch_note = kNoPitchNote;
+        mapping.triggers = false;
+
+        if (note >= kMidiMinNote)
+        {
+            // Normal play notes
+            mapping.pitch_note = static_cast<uint8_t>(note);
+            mapping.triggers = true;
+        }
+        else if (note % kMidiNoteControlRepeat < samples_.num_samples)
+        {
+            // Switching samples notes - trigger (same as the note control of the sample pot)
+            mapping.triggers = true;
+#ifdef LOWEST_TWO_MIDI_OCTAVES_SELECT_ORIGINAL_PITCH
+            // If below this note, select the base note
+            if (note < kMidiTriggerOriginalPitchBelow)
+            {
+                mapping.pitch_note = kMidiBaseNote;
+            }
+#endif
+        }
+    }
+}
+
 void AppWaveBard::UpdateQuantizedPot()
 {
-    pots_[Pot::PITCH_QUANTIZED]->ForceValue(pots_[Pot::PITCH]->GetValue(), false);
+    pots_[Pot::PITCH_QUANTIZED].ForceValue(pots_[Pot::PITCH].GetValue(), false);
 }
 
 void AppWaveBard::UiLoop()
@@ -633,14 +698,14 @@ void AppWaveBard::UiLoop()
     bool now_triggered = triggered_;
     triggered_ = false;
 
-    for (auto &pot : pots_)
-    {
-        pot->ReadValue();
-    }
+    pots_.ReadValues();
 
     // Read the bank selector, does the button switching etc.
     bank_select_.ReadValue();
 
+    // The first trigger in the newly selected bank starts from SRAM
+    PrefetchBank();
+
     // Do switching magic
     if (Kastle2::hw.GetLayer() != Kastle2::base.GetPrevLayer())
     {
@@ -655,20 +720,20 @@ void AppWaveBard::UiLoop()
 
     // Knob change detection
     // pitch knob
-    if (pots_[Pot::PITCH]->HasChanged())
+    if (pots_[Pot::PITCH].HasChanged())
     {
         quantization_enabled_ = false;
         change_to_patch_source = true;
         UpdateQuantizedPot();
     }
     // octave knob
-    if (pots_[Pot::PITCH_QUANTIZED]->HasChanged())
+    if (pots_[Pot::PITCH_QUANTIZED].HasChanged())
     {
         change_to_patch_source = true;
         quantization_enabled_ = true;
     }
     // scale knob
-    if (pots_[Pot::PITCH_SCALE]->HasChanged())
+    if (pots_[Pot::PITCH_SCALE].HasChanged())
     {
         change_to_patch_source = true;
         if (!quantization_enabled_)
@@ -678,7 +743,7 @@ void AppWaveBard::UiLoop()
         }
     }
     // root knob
-    if (pots_[Pot::PITCH_ROOT]->HasChanged())
+    if (pots_[Pot::PITCH_ROOT].HasChanged())
     {
         change_to_patch_source = true;
         if (!quantization_enabled_)
@@ -710,14 +775,14 @@ void AppWaveBard::UiLoop()
     quantizer_.SetEnabled(quantization_enabled_);
 
     // Quantizer Scale selection
-    int32_t quantizer_scale = pots_[Pot::PITCH_SCALE]->GetMappedValue();
+    int32_t quantizer_scale = pots_[Pot::PITCH_SCALE].GetMappedValue();
     quantizer_.SetScale(quantizer_scale >= 0 ? quantizer_scale : 0);
     // Change indication
     if (quantizer_scale != quantizer_scale_prev_)
     {
         change_to_patch_source = true;
         quantizer_scale_prev_ = quantizer_scale;
-        if (pots_[Pot::PITCH_ROOT]->GetSource() == FancyPot::Source::INTERNAL)
+        if (pots_[Pot::PITCH_ROOT].GetSource() == FancyPot::Source::INTERNAL)
         {
             bank_select_.DisableNextChange();
             UiIndicateChange();
@@ -725,7 +790,7 @@ void AppWaveBard::UiLoop()
     }
 
     // Quantizer Scale Root selection
-    int32_t quantizer_root = pots_[Pot::PITCH_ROOT]->GetMappedValue();
+    int32_t quantizer_root = pots_[Pot::PITCH_ROOT].GetMappedValue();
 
 #ifdef QUANTIZER_ROOT_TRANSPOSES
 // We don't select the root inside quantizer,
@@ -740,7 +805,7 @@ void AppWaveBard::UiLoop()
     {
         change_to_patch_source = true;
         quantizer_root_prev_ = quantizer_root;
-        if (pots_[Pot::PITCH_ROOT]->GetSource() == FancyPot::Source::INTERNAL)
+        if (pots_[Pot::PITCH_ROOT].GetSource() == FancyPot::Source::INTERNAL)
         {
             bank_select_.DisableNextChange();
             UiIndicateChange();
@@ -754,7 +819,7 @@ void AppWaveBard::UiLoop()
     {
 #ifdef QUANTIZER_ROOT_TRANSPOSES
         // trigger on octave change
-        base_pitch = step_map(pots_[Pot::PITCH_QUANTIZED]->GetValue(), kMapPitchOctaves);
+        base_pitch = step_map(pots_[Pot::PITCH_QUANTIZED].GetValue(), kMapPitchOctaves);
         if (diff(base_pitch, trigger_base_pitch_prev_) > 0.01f)
         {
             trigger_base_pitch_prev_ = base_pitch;
@@ -772,12 +837,13 @@ void AppWaveBard::UiLoop()
     }
     else
     {
-        base_pitch = curve_map(pots_[Pot::PITCH]->GetValue(), kMapPitch);
+        base_pitch = curve_map(pots_[Pot::PITCH].GetValue(), kMapPitch);
     }
 
-    int32_t pitch_mod_pot = curve_map(pots_[Pot::PITCH_MOD]->GetValue(), kMapPitchMod);
-    float pitch_note_cv_modded = apply_pot_mod_attenuvert(pitch_note_cv_, pitch_mod_pot);
-    base_pitch *= std::pow(2.0f, pitch_note_cv_modded / static_cast<float>(ADC_1V)); // proper 1V/octave scaling
+    int32_t pitch_mod_pot = curve_map(pots_[Pot::PITCH_MOD].GetValue(), kMapPitchMod);
+    const int32_t pitch_note_cv_modded = apply_pot_mod_attenuvert(pitch_note_cv_, pitch_mod_pot);
+    base_pitch *= note_pitch_mod_.Get({pitch_note_cv_modded}, [&]
+                                      { return std::pow(2.0f, pitch_note_cv_modded / static_cast<float>(ADC_1V)); }); // proper 1V/octave scaling
     base_pitch = quantizer_.ProcessMultiplier(base_pitch);
 #ifdef QUANTIZER_ROOT_TRANSPOSES
     if (quantization_enabled_)
@@ -793,9 +859,10 @@ void AppWaveBard::UiLoop()
     patch_pitch_midi_note_ = midi_note_to_send;
 
     // Finish with free and fine pitch modulation
-    float pitch_free_cv_modded = apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_PITCH_FREE), pitch_mod_pot);
-    float free_pitch_mod = std::pow(2.0f, pitch_free_cv_modded / static_cast<float>(ADC_1V)); // proper 1V/octave scaling
-    float fine_pitch_mod = curve_map(pots_[Pot::PITCH_FINE]->GetValue(), kMapPitchFine);
+    const int32_t pitch_free_cv_modded = apply_pot_mod_attenuvert(Kastle2::hw.GetAnalogValue(CV_PITCH_FREE), pitch_mod_pot);
+    float free_pitch_mod = free_pitch_mod_.Get({pitch_free_cv_modded}, [&]
+                                               { return std::pow(2.0f, pitch_free_cv_modded / static_cast<float>(ADC_1V)); }); // proper 1V/octave scaling
+    float fine_pitch_mod = curve_map(pots_[Pot::PITCH_FINE].GetValue(), kMapPitchFine);
     base_pitch *= free_pitch_mod;
     base_pitch *= fine_pitch_mod;
 
@@ -822,8 +889,7 @@ void AppWaveBard::UiLoop()
     }
 
     // Calculate the MIDI pitch
-    float relative_midi_note = static_cast<int32_t>(midi_note_) - static_cast<int32_t>(kMidiBaseNote);
-    float midi_pitch = std::pow(2.0f, relative_midi_note / 12.0f);
+    float midi_pitch = midi_note_map_[midi_note_ % kMidiNotes].pitch;
     midi_pitch *= midi_pitch_bend_multiplier_;
     midi_pitch *= free_pitch_mod;
     midi_pitch *= fine_pitch_mod;
@@ -832,10 +898,12 @@ void AppWaveBard::UiLoop()
     switch (pitch_source_)
     {
     case PitchSource::PATCH:
-        players_[active_player_].SetSpeed(base_pitch);
+        ForEachControlledPlayer([&](SamplePlayer16bit &player)
+                                { player.SetSpeed(base_pitch); });
         break;
     case PitchSource::MIDI:
-        players_[active_player_].SetSpeed(midi_pitch);
+        ForEachControlledPlayer([&](SamplePlayer16bit &player)
+                                { player.SetSpeed(midi_pitch); });
         break;
     }
 
@@ -846,7 +914,7 @@ void AppWaveBard::UiLoop()
     }
 
     // Sample modulation
-    int32_t smp = pots_[Pot::SAMPLE_MOD]->GetValue();
+    int32_t smp = pots_[Pot::SAMPLE_MOD].GetValue();
     if (smp < POT_HALF)
     {
         sample_play_on_change_ = false;
@@ -867,11 +935,11 @@ void AppWaveBard::UiLoop()
 #else
     envelope_cv_ = Kastle2::hw.GetAnalogValue(CV_ENVELOPE);
 #endif
-    int32_t base_envelope = pots_[Pot::ENVELOPE]->GetValue();
-    base_envelope += apply_pot_mod_attenuvert(envelope_cv_, pots_[Pot::ENVELOPE_MOD]->GetValue());
+    int32_t base_envelope = pots_[Pot::ENVELOPE].GetValue();
+    base_envelope += apply_pot_mod_attenuvert(envelope_cv_, pots_[Pot::ENVELOPE_MOD].GetValue());
     base_envelope = constrain(base_envelope, POT_MIN, POT_MAX);
     prev_base_envelope_ = base_envelope;
-    if (pots_[Pot::ENVELOPE]->HasMoved(FancyPot::Move::TWEAK))
+    if (pots_[Pot::ENVELOPE].HasMoved(FancyPot::Move::TWEAK))
     {
         SendMidiLength(false);
     }
@@ -886,12 +954,17 @@ void AppWaveBard::UiLoop()
     if (base_envelope < POT_HALF)
     {
         // Reverse playback section
-        players_[active_player_].SetReverse(true);
-        int32_t attack_ticks = players_[active_player_].GetLengthSpeedAdjusted() - (attack_time + hold_time) * SAMPLE_RATE;
+        const size_t length = voices_[active_voice_].player.GetLengthSpeedAdjusted();
+        int32_t attack_ticks = length - (attack_time + hold_time) * SAMPLE_RATE;
         // Stretch out the length to compensate for pitch changes,
         // then adjust the start point with the envelope attack length,
         // and then stretch it back down to samples without pitch change to start playback from the correct point
-        players_[active_player_].SetStartSpeedAdjusted(constrain(attack_ticks, 0, players_[active_player_].GetLengthSpeedAdjusted()));
+        ForEachControlledPlayer(
+            [&](SamplePlayer16bit &player)
+            {
+                player.SetReverse(true);
+                player.SetStartSpeedAdjusted(constrain(attack_ticks, 0, length));
+            });
         if (ui_loop_counter_ == 0) // runs each 8th ui loop to save some CPU
         {
             envelope_indicator_.SetAttackTime(attack_time + decay_time < trigger_spacing ? attack_time : trigger_spacing);
@@ -903,7 +976,7 @@ void AppWaveBard::UiLoop()
             // Set the output envelope to have no hold time,
             // only attack and to be as long as the sample (makes it more usable for pitch sweeps)
             float scaled_attack_time = attack_time + hold_time;
-            float sample_length = (float)players_[active_player_].GetLengthSpeedAdjusted() / SAMPLE_RATE;
+            float sample_length = (float)voices_[active_voice_].player.GetLengthSpeedAdjusted() / SAMPLE_RATE;
             scaled_attack_time = scaled_attack_time > sample_length ? sample_length : scaled_attack_time;
             envelope_out_.SetAttackTime(scaled_attack_time);
             envelope_out_.SetDecayTime(0.001f);
@@ -913,8 +986,12 @@ void AppWaveBard::UiLoop()
     else
     {
         // Forward playback section
-        players_[active_player_].SetReverse(false);
-        players_[active_player_].SetStart(0);
+        ForEachControlledPlayer(
+            [](SamplePlayer16bit &player)
+            {
+                player.SetReverse(false);
+                player.SetStart(0);
+            });
         if (ui_loop_counter_ == 0) // runs each 8th ui loop to save some CPU
         {
             envelope_indicator_.SetAttackTime(attack_time + decay_time < trigger_spacing ? attack_time : 0.f);
@@ -928,7 +1005,7 @@ void AppWaveBard::UiLoop()
             // Set the output envelope to have no hold time,
             // Only decay and to be as long as the sample (makes it more usable for pitch sweeps)
             float scaled_decay_time = decay_time + hold_time;
-            float sample_length = (float)players_[active_player_].GetLengthSpeedAdjusted() / SAMPLE_RATE;
+            float sample_length = (float)voices_[active_voice_].player.GetLengthSpeedAdjusted() / SAMPLE_RATE;
             scaled_decay_time = scaled_decay_time > sample_length ? sample_length : scaled_decay_time;
             envelope_out_.SetAttackTime(0.001f);
             envelope_out_.SetDecayTime(scaled_decay_time);
@@ -939,21 +1016,23 @@ void AppWaveBard::UiLoop()
     note_sender_.SetDuration(dur);
 
     // SoftClipper
-    int32_t fx_pot = pots_[Pot::FX]->GetValue();
+    int32_t fx_pot = pots_[Pot::FX].GetValue();
     playback_clipper_.SetDrive(q15_mult(curve_map(fx_pot, kMapDistortionAmount), q31_to_q15(envelope_.GetOutput())));
-    fx_input_clipper_.SetDrive(curve_map(fx_pot, kMapInputDistortionAmount));
     fx_volume_compensation_ = curve_map(fx_pot, kMapFXVolumeCompensation);
 
     // DJ style filter
-    int32_t filter_pot = pots_[Pot::FILTER]->GetValue();
-    filter_.SetCrossfade(map(filter_pot, POT_MIN, POT_MAX, Q15_MIN, Q15_MAX));
+    int32_t filter_pot = pots_[Pot::FILTER].GetValue();
+    if (filter_param_.Changed({filter_pot}))
+    {
+        filter_.SetCrossfade(map(filter_pot, POT_MIN, POT_MAX, Q15_MIN, Q15_MAX));
+    }
 
     // because of the resonance we need to make the volume lower at some point
     // set target value for slewer to avoid zipper noise
     filter_volume_compensation_slewer_.SetValue(curve_map(filter_pot, kMapFilterVolumeCompensation));
 
     // Delay
-    delay_mix_ = curve_map(fx_pot, kMapDelayMix);
+    delay_mix_ramp_.SetValue(curve_map(fx_pot, kMapDelayMix));
     delay_feedback_ = curve_map(fx_pot, kMapDelayFeedback);
 
     int32_t delay_left_val = 0;
@@ -1027,7 +1106,7 @@ void AppWaveBard::UiLoop()
     // Writes the envelope state to the ENV output on the patchbay
 #ifdef OUT_ENVELOPE_SCALING
     Kastle2::hw.SetEnvOut(envelope_out_.GetOutput() >> (31 - 10));
-    // Kastle2::hw.SetEnvOut(compress_amount_ >> (15 - 10));
+    // Kastle2::hw.SetEnvOut(fx_compressor_.GetGain() >> (15 - 10));
 #else
     Kastle2::hw.SetEnvOut(envelope_.GetOutput() >> (31 - 10));
 #endif
@@ -1041,9 +1120,9 @@ void AppWaveBard::UiLoop()
     // ADVANCED SETTINGS LAYER - set the audio routing (more stuff will be added later)
     if (Kastle2::hw.GetLayer() == Hardware::Layer::SETTINGS)
     {
-        if (pots_[Pot::AUDIO_ROUTE]->HasChanged())
+        if (pots_[Pot::AUDIO_ROUTE].HasChanged())
         {
-            input_audio_through_fx_ = pots_[Pot::AUDIO_ROUTE]->GetValue() < POT_HALF;
+            input_audio_through_fx_ = pots_[Pot::AUDIO_ROUTE].GetValue() < POT_HALF;
         }
     }
 
@@ -1102,7 +1181,7 @@ inline size_t AppWaveBard::GetPatchedSample()
     int32_t mod_sample = sticky_map(sample_cv_, -SampleCvMaxValue(), SampleCvMaxValue(), -samples_.num_samples, samples_.num_samples, sticky_sample_mod_);
     int32_t max_value = samples_.num_samples - 1;
     mod_sample = constrain(mod_sample, -max_value, max_value);
-    return (samples_.num_samples + pots_[Pot::SAMPLE]->GetMappedValue() + mod_sample) % samples_.num_samples;
+    return (samples_.num_samples + pots_[Pot::SAMPLE].GetMappedValue() + mod_sample) % samples_.num_samples;
 }
 
 inline size_t AppWaveBard::GetContinousPatchedSample()
@@ -1110,7 +1189,7 @@ inline size_t AppWaveBard::GetContinousPatchedSample()
     // This function is trying to approximate the simple function above using linear values
     // It's really ugly and I'm sorry for that but it somehow works
     int32_t mod_sample = map(sample_cv_, -SampleCvMaxValue(), SampleCvMaxValue(), POT_MIN, POT_MAX, MapClamp::TRUE);
-    int32_t continous_value = ((POT_MAX + 1) + mod_sample + pots_[Pot::SAMPLE]->GetValue()) % (POT_MAX + 1);
+    int32_t continous_value = ((POT_MAX + 1) + mod_sample + pots_[Pot::SAMPLE].GetValue()) % (POT_MAX + 1);
     continous_value = sticky_map(continous_value, 0, POT_MAX, 0, 127, sticky_sample_continous_mod_);
 
     // Diff it with patched sample - check whether we are close enough (less than half of the cc range)
@@ -1136,6 +1215,18 @@ inline void AppWaveBard::Trigger(bool manual)
     trigger_was_manual_ = manual;
 }
 
+inline void AppWaveBard::TriggerMidi(const midi::Message *msg)
+{
+    TriggerAt(Kastle2::TimeToAudioFrame(msg->GetTime()) + Kastle2::kMidiLatencyFrames);
+}
+
+inline void AppWaveBard::TriggerAt(uint32_t frame)
+{
+    trigger_frame_ = frame;
+    trigger_frame_pending_ = true;
+    Trigger();
+}
+
 inline void AppWaveBard::TriggerCheck()
 {
 #ifdef PASSTHROUGH_MIDI_NOTE
@@ -1159,7 +1250,7 @@ inline void AppWaveBard::TriggerCheck()
     }
 }
 
-FASTCODE void AppWaveBard::ActualTrigger(bool force)
+FASTCODE_APP(wave_bard) void AppWaveBard::ActualTrigger(bool force)
 {
     // Check for last trigger time to prevent double triggering
     absolute_time_t now = get_absolute_time();
@@ -1176,28 +1267,22 @@ FASTCODE void AppWaveBard::ActualTrigger(bool force)
     UpdateSelectedSample();
     UpdateSelectedBank();
 
-    // If needed, store the current envelope value and trigger fadeout envelope
-    if (players_[active_player_].IsPlaying() && envelope_.IsActive())
+    // Load the new sample on a free voice, the AudioLoop starts it with envelope_ and the previous voice rings out
+    const size_t voice = FindFreeVoice();
+    voices_[voice].player.Reset();
+    voices_[voice].player.SetSample(GetSample());
+    voices_[voice].warm_start = FindWarmStart(sample_bank_selected_);
+    // MIDI notes and TRIG edges start at their frame, the AudioLoop delays the voice
+    if (trigger_frame_pending_)
     {
-        fadeout_envelope_max_ = q31_to_q15(envelope_.GetOutput());
-        fadeout_envelope_.Trigger();
-
-        // Disable hifi mode for fadeout
-        // Processing two samples using hifi mode is too much for the CPU
-        // and it's not really hearable anyway
-        players_[active_player_].SetHifi(false);
+        trigger_frame_pending_ = false;
+        start_frame_ = trigger_frame_;
+        start_frame_pending_ = true;
     }
+    __dmb();
+    pending_voice_ = voice;
 
-    // Switch to the other deck before loading the new sample
-    active_player_ = EnumIncrement<PlayerDeck>(active_player_);
-
-    // Load the new sample and start playing
-    players_[active_player_].SetSample(GetSample());
-    players_[active_player_].SetHifi(true);
-    players_[active_player_].Play();
-
-    // Trigger envelope
-    envelope_.Trigger();
+    // Trigger envelopes (envelope_ starts with the voice)
     envelope_indicator_.Trigger();
     envelope_out_.Trigger();
     next_time_send_note_on_ = true;
@@ -1215,6 +1300,110 @@ FASTCODE void AppWaveBard::ActualTrigger(bool force)
     triggered_ = true;
 }
 
+size_t AppWaveBard::FindFreeVoice() const
+{
+    // The streamed voices come first
+    for (size_t i = 0; i < kVoiceCount; i++)
+    {
+        if (!voices_[i].player.IsPlaying() && i != pending_voice_)
+        {
+            return i;
+        }
+    }
+
+    // Retriggered faster than the steal fade: the one furthest in the fade, otherwise the oldest ringing one
+    size_t voice = active_voice_ == 0 ? 1 : 0;
+    for (size_t i = 0; i < kVoiceCount; i++)
+    {
+        if (i == active_voice_)
+        {
+            continue;
+        }
+        const Voice &candidate = voices_[i];
+        const Voice &best = voices_[voice];
+        const size_t candidate_fade = candidate.fade > 0 ? candidate.fade : SIZE_MAX;
+        const size_t best_fade = best.fade > 0 ? best.fade : SIZE_MAX;
+        if (candidate_fade < best_fade || (candidate_fade == best_fade && candidate.age < best.age))
+        {
+            voice = i;
+        }
+    }
+    return voice;
+}
+
+FASTCODE_APP(wave_bard) void AppWaveBard::StartPendingVoice(size_t size)
+{
+    const size_t index = pending_voice_;
+    if (index >= kVoiceCount)
+    {
+        return;
+    }
+    pending_voice_ = kVoiceCount;
+
+    // The retriggered voice rings out with the envelope it had, a silent one just stops
+    if (index != active_voice_)
+    {
+        Voice &previous = voices_[active_voice_];
+        if (previous.player.IsPlaying() && envelope_.IsActive())
+        {
+            previous.envelope = envelope_;
+        }
+        else
+        {
+            previous.player.Reset();
+        }
+    }
+
+    // MIDI notes and TRIG edges start at their frame (late ones start right away)
+    size_t start_delay = 0;
+    if (start_frame_pending_)
+    {
+        start_frame_pending_ = false;
+        const int32_t delay = static_cast<int32_t>(start_frame_ - Kastle2::GetAudioFrame());
+        start_delay = delay > 0 && delay <= static_cast<int32_t>(Kastle2::kMidiLatencyFrames + size) ? delay : 0;
+    }
+
+    Voice &voice = voices_[index];
+    active_voice_ = index;
+    voice.fade = 0;
+    voice.age = ++voice_starts_;
+    voice.player.SetStartDelay(start_delay);
+    voice.player.Play();
+    // The envelope starts with the voice
+    envelope_.TriggerAt(start_delay);
+
+    // All the voices busy: the oldest ringing one fades out before the next trigger can come (kTimeBetweenTriggers)
+    Voice *oldest = nullptr;
+    for (Voice &ringing : voices_)
+    {
+        if (!ringing.player.IsPlaying() || ringing.fade > 0)
+        {
+            return;
+        }
+        if (&ringing != &voice && (oldest == nullptr || ringing.age < oldest->age))
+        {
+            oldest = &ringing;
+        }
+    }
+    if (oldest != nullptr)
+    {
+        oldest->fade = kStealFadeFrames;
+    }
+}
+
+inline q15_t AppWaveBard::StealFadeGain(size_t frame)
+{
+    static_assert(kStealFadeFrames % kStealFadeSteps == 0);
+    constexpr size_t kStepFrames = kStealFadeFrames / kStealFadeSteps;
+
+    // Linear between the table steps, silent after the end
+    frame = std::min(frame, kStealFadeFrames);
+    const size_t step = frame / kStepFrames;
+    const q15_t a = steal_fade[step];
+    const q15_t b = steal_fade[step + 1];
+    return a + (b - a) * static_cast<q15_t>(frame % kStepFrames) / static_cast<q15_t>(kStepFrames);
+}
+
 void AppWaveBard::SendMidiLength(bool force)
 {
     if (prev_base_envelope_ < POT_HALF)
@@ -1255,21 +1444,107 @@ void AppWaveBard::SendMidiSample(bool force)
     Kastle2::midi.SendCc(cc::OUT_SAMPLE_CONTINOUS, GetContinousPatchedSample(), force);
 }
 
+inline const uint8_t *AppWaveBard::GetHeader(size_t bank, size_t entry) const
+{
+    return reinterpret_cast<const uint8_t *>(USER_DATA_SECTION_BEGIN + samples_.index[bank * (samples_.num_samples + 1) + entry]);
+}
+
 inline SamplePlayer16bit::Sample AppWaveBard::GetSample() const
 {
-    auto &source_sample = samples_.banks[sample_bank_selected_].samples[sample_num_selected_];
+    // The header is read from flash, the sample data follows it
+    const uint8_t *header = GetHeader(sample_bank_selected_, sample_num_selected_ + 1);
+    WaveBardSample source_sample;
+    memcpy(&source_sample, header, sizeof(source_sample));
+    const SamplePlayer16bit::Channels channels = source_sample.channels == 2 ? SamplePlayer16bit::STEREO : SamplePlayer16bit::MONO;
+
+    // Start points snap to the slice points, when the file has them
+    const uint8_t *slices = nullptr;
+    if (samples_.slices != nullptr)
+    {
+        const size_t offset = samples_.slices[sample_bank_selected_ * samples_.num_samples + sample_num_selected_];
+        slices = reinterpret_cast<const uint8_t *>(USER_DATA_SECTION_BEGIN + offset);
+    }
+
+    // The sample start from SRAM, when the bank was prefetched
+    const uint8_t *warm = nullptr;
+    size_t warm_bytes = 0;
+    const size_t warm_start = FindWarmStart(sample_bank_selected_);
+    if (warm_start < kWarmStartSets)
+    {
+        warm = warm_starts_[warm_start].bytes.data() + sample_num_selected_ * warm_start_bytes_;
+        warm_bytes = std::min<size_t>(warm_start_bytes_, source_sample.size);
+    }
     return SamplePlayer16bit::Sample{
-        .data = (int16_t *)source_sample.data,
-        .length = source_sample.size / (samples_.bit_depth / 8) / source_sample.channels,
-        .channels = source_sample.channels == 2 ? SamplePlayer16bit::STEREO : SamplePlayer16bit::MONO};
+        .data = header + sizeof(WaveBardSample),
+        .length = SamplePlayer16bit::FramesInBytes(source_sample.size, channels, sample_encoding_),
+        .channels = channels,
+        .encoding = sample_encoding_,
+        .slices = slices,
+        .warm = warm,
+        .warm_bytes = warm_bytes};
+}
+
+inline size_t AppWaveBard::FindWarmStart(size_t bank) const
+{
+    for (size_t i = 0; i < kWarmStartSets; i++)
+    {
+        if (warm_starts_[i].bank == bank)
+        {
+            return i;
+        }
+    }
+    return kWarmStartSets;
+}
+
+void AppWaveBard::PrefetchBank()
+{
+    const size_t bank = bank_select_.GetMode();
+    if (FindWarmStart(bank) < kWarmStartSets)
+    {
+        return;
+    }
+
+    // A set no voice reads from (the audio core may be in the middle of it), the one of the last triggered bank last
+    size_t target = kWarmStartSets;
+    for (size_t i = 0; i < kWarmStartSets; i++)
+    {
+        bool used = false;
+        for (size_t j = 0; j < kVoiceCount; j++)
+        {
+            used |= voices_[j].warm_start == i && (voices_[j].player.IsPlaying() || j == pending_voice_);
+        }
+        if (!used && (target == kWarmStartSets || warm_starts_[target].bank == sample_bank_selected_))
+        {
+            target = i;
+        }
+    }
+    if (target == kWarmStartSets)
+    {
+        return;
+    }
+
+    // No DMA channel is left for this, the UI core copies through the alias which doesn't evict the code from the XIP cache
+    WarmStart &warm_start = warm_starts_[target];
+    warm_start.bank = kNoBank;
+    for (size_t i = 0; i < samples_.num_samples; i++)
+    {
+        const uint8_t *header = GetHeader(bank, i + 1);
+        WaveBardSample sample;
+        memcpy(&sample, header, sizeof(sample));
+        memcpy(warm_start.bytes.data() + i * warm_start_bytes_, XipStream::Uncached(header + sizeof(WaveBardSample)),
+               std::min<size_t>(warm_start_bytes_, sample.size));
+    }
+    warm_start.bank = bank;
 }
 
 inline uint32_t AppWaveBard::GetColor(size_t bank) const
 {
-    return samples_.banks[bank].color.r << 16 | samples_.banks[bank].color.g << 8 | samples_.banks[bank].color.b;
+    WaveBardBank header;
+    memcpy(&header, GetHeader(bank, 0), sizeof(header));
+    return header.color.r << 16 | header.color.g << 8 | header.color.b;
 }
 
-void AppWaveBard::MemoryInitialization()
+COLDCODE void AppWaveBard::MemoryInitialization()
 {
     // TODO: Move this to the FancyPot (add MemoryInitialization method)
     Kastle2::memory.Write8(kMemBank, 0);
@@ -1293,7 +1568,33 @@ bool AppWaveBard::LoadSamples()
     }
 
     // Read the header data
-    file_reader.Read(&samples_, 18);
+    file_reader.Read(&samples_, 20);
+
+    // Sample encoding (16-bit and 12-bit are linear, 8-bit is companded, 4-bit is IMA-ADPCM)
+    if (samples_.bit_depth == 16 && samples_.encoding == 0)
+    {
+        sample_encoding_ = SamplePlayer16bit::Encoding::PCM;
+    }
+    else if (samples_.bit_depth == 12 && samples_.encoding == 0)
+    {
+        sample_encoding_ = SamplePlayer16bit::Encoding::PCM12;
+    }
+    else if (samples_.bit_depth == 8 && samples_.encoding == 1)
+    {
+        sample_encoding_ = SamplePlayer16bit::Encoding::MU_LAW;
+    }
+    else if (samples_.bit_depth == 8 && samples_.encoding == 2)
+    {
+        sample_encoding_ = SamplePlayer16bit::Encoding::A_LAW;
+    }
+    else if (samples_.bit_depth == 4 && samples_.encoding == 3)
+    {
+        sample_encoding_ = SamplePlayer16bit::Encoding::IMA_ADPCM;
+    }
+    else
+    {
+        return false;
+    }
 
     // Validate sequencer length
     if (!between(samples_.sequencer_length, Sequencer::kMinLength, Sequencer::kMaxLength))
@@ -1306,8 +1607,8 @@ bool AppWaveBard::LoadSamples()
     if (
         !between(samples_.num_rhythms, 1, UserDataFile::kMaxRhythms) ||
         !between(samples_.num_scales, 1, UserDataFile::kMaxScales) ||
-        !between(samples_.num_banks, 1, 32) ||
-        !between(samples_.num_samples, 1, 32))
+        !between(samples_.num_banks, 1, kMaxBanks) ||
+        !between(samples_.num_samples, 1, kMaxSamples))
     {
         return false;
     }
@@ -1330,32 +1631,164 @@ bool AppWaveBard::LoadSamples()
         return false;
     }
 
-    // Load the banks and samples
-    samples_.banks = new WaveBardBank[samples_.num_banks];
+    // Each file is checked only once, the next boots find its CRC in the EEPROM and skip the checks
+    const bool verified = file_reader.IsVerified();
 
-    for (size_t i = 0; i < samples_.num_banks; i++)
+    // Sample index: mapped from the file when it has a valid one, otherwise built by walking the headers
+    if (!MapSampleIndex(file_reader) ||
+        (!verified && !CheckSampleIndex(file_reader, reinterpret_cast<uintptr_t>(samples_.index) - USER_DATA_SECTION_BEGIN)))
     {
-        WaveBardBank *bank = &samples_.banks[i];
+        BuildSampleIndex(file_reader);
+        if (!verified && !CheckSampleIndex(file_reader, samples_.file_size - UserDataFile::kEndMarkerSize))
+        {
+            delete[] samples_.scales;
+            delete[] samples_.rhythms;
+            return false;
+        }
+    }
 
-        // Read bank header (11 bytes)
-        file_reader.Read(reinterpret_cast<uint8_t *>(bank), 11);
-        file_reader.Advance(1); // Skip 1 reserved byte
+    // Slice tables which don't fit the file are left out, the file is then checked on each boot
+    if (MapSliceTables(file_reader, verified))
+    {
+        file_reader.SetVerified();
+    }
 
-        // Read samples
-        bank->samples = new WaveBardSample[samples_.num_samples];
-        for (size_t j = 0; j < samples_.num_samples; j++)
+    return true;
+}
+
+bool AppWaveBard::MapSampleIndex(const UserDataFile &file_reader)
+{
+    if ((samples_.flags & kWaveBardFlagSampleIndex) == 0)
+    {
+        return false;
+    }
+
+    // The index is right before the end marker, the file is padded to a multiple of 4 bytes
+    const size_t entries = samples_.num_banks * (samples_.num_samples + 1);
+    const size_t index_size = entries * sizeof(uint32_t);
+    if (samples_.file_size < 20 + UserDataFile::kEndMarkerSize + index_size)
+    {
+        return false;
+    }
+    const uint32_t *index = file_reader.Map<uint32_t>(samples_.file_size - UserDataFile::kEndMarkerSize - index_size, entries);
+    if (index == nullptr)
+    {
+        return false;
+    }
+
+    samples_.index = index;
+    return true;
+}
+
+bool AppWaveBard::MapSliceTables(const UserDataFile &file_reader, const bool verified)
+{
+    static_assert(kWaveBardSliceFrames == SamplePlayer16bit::kSliceFrames, "The slice steps of the file and of the player");
+
+    samples_.slices = nullptr;
+    if ((samples_.flags & kWaveBardFlagSliceTable) == 0)
+    {
+        return true;
+    }
+
+    // The offsets are right before the sample index (or the end marker), the tables anywhere after the samples
+    const size_t entries = samples_.num_banks * samples_.num_samples;
+    const size_t offsets_size = entries * sizeof(uint32_t);
+    size_t offsets_end = samples_.file_size - UserDataFile::kEndMarkerSize;
+    if (samples_.flags & kWaveBardFlagSampleIndex)
+    {
+        offsets_end -= samples_.num_banks * (samples_.num_samples + 1) * sizeof(uint32_t);
+    }
+    if (offsets_end > samples_.file_size || offsets_end < 20 + offsets_size)
+    {
+        return false;
+    }
+    const uint32_t *offsets = file_reader.Map<uint32_t>(offsets_end - offsets_size, entries);
+    if (offsets == nullptr)
+    {
+        return false;
+    }
+
+    // One byte per step of each sample, checked once for each file like the sample index
+    if (!verified)
+    {
+        const size_t tables_end = offsets_end - offsets_size;
+        for (size_t i = 0; i < samples_.num_banks; i++)
         {
-            WaveBardSample *sample = &bank->samples[j];
+            for (size_t j = 0; j < samples_.num_samples; j++)
+            {
+                WaveBardSample sample;
+                memcpy(&sample, GetHeader(i, j + 1), sizeof(sample));
+                const SamplePlayer16bit::Channels channels = sample.channels == 2 ? SamplePlayer16bit::STEREO : SamplePlayer16bit::MONO;
+                const size_t frames = SamplePlayer16bit::FramesInBytes(sample.size, channels, sample_encoding_);
+                const size_t steps = (frames + kWaveBardSliceFrames - 1) / kWaveBardSliceFrames;
+                const size_t offset = offsets[i * samples_.num_samples + j];
+                if (offset < 20 || offset > tables_end || tables_end - offset < steps)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    samples_.slices = offsets;
+    return true;
+}
 
-            // Read sample header (5 bytes: size + channels)
-            file_reader.Read(reinterpret_cast<uint8_t *>(sample), 5);
-            file_reader.Advance(11); // Skip name (8) + reserved (3) bytes
+void AppWaveBard::BuildSampleIndex(UserDataFile &file_reader)
+{
+    const size_t entries = samples_.num_banks * (samples_.num_samples + 1);
+    uint32_t *index = Kastle2::arena.Allocate<uint32_t>(entries).data();
+    samples_.index = index;
 
-            // Point the sample data to the correct memory location (don't copy the data since it won't fit)
-            sample->data = file_reader.GetCurrentMemoryPointer();
-            file_reader.Advance(sample->size);
+    for (size_t i = 0; i < samples_.num_banks; i++)
+    {
+        // Bank header (12 bytes)
+        *index++ = file_reader.GetOffset() - USER_DATA_SECTION_BEGIN;
+        file_reader.Advance(sizeof(WaveBardBank));
+
+        for (size_t j = 0; j < samples_.num_samples; j++)
+        {
+            // Sample header (16 bytes), the data is padded to an even number of bytes
+            WaveBardSample sample;
+            *index++ = file_reader.GetOffset() - USER_DATA_SECTION_BEGIN;
+            file_reader.Read(&sample, sizeof(sample));
+            file_reader.Advance((sample.size + 1) & ~1u);
         }
     }
+}
+
+bool AppWaveBard::CheckSampleIndex(const UserDataFile &file_reader, const size_t data_end) const
+{
+    if (data_end < 20 || !file_reader.IsInFile(20, data_end - 20))
+    {
+        return false;
+    }
+
+    const uint32_t *index = samples_.index;
+    for (size_t i = 0; i < samples_.num_banks; i++)
+    {
+        // Bank header
+        const size_t bank = *index++;
+        if (bank < 20 || bank > data_end || data_end - bank < sizeof(WaveBardBank))
+        {
+            return false;
+        }
 
+        for (size_t j = 0; j < samples_.num_samples; j++)
+        {
+            // Sample header and its data
+            const size_t offset = *index++;
+            if (offset < 20 || offset > data_end || data_end - offset < sizeof(WaveBardSample))
+            {
+                return false;
+            }
+            WaveBardSample sample;
+            memcpy(&sample, reinterpret_cast<const void *>(USER_DATA_SECTION_BEGIN + offset), sizeof(sample));
+            if (sample.size > data_end - offset - sizeof(WaveBardSample))
+            {
+                return false;
+            }
+        }
+    }
     return true;
 }
\ No newline at end of file
@@ -25,18 +25,24 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include "common/EnumTools.hpp"
+#include "common/controls/DerivedParameter.hpp"
 #include "common/controls/DirtyInputsHandler.hpp"
 #include "common/controls/FancyMode.hpp"
-#include "common/controls/FancyPot.hpp"
+#include "common/controls/FancyPotBank.hpp"
 #include "common/core/App.hpp"
+#include "common/core/Arena.hpp"
 #include "common/core/Hardware.hpp"
+#include "common/core/InputEdges.hpp"
+#include "common/core/UserDataFile.hpp"
+#include "common/core/XipStream.hpp"
 #include "common/core/midi/Message.hpp"
 #include "common/core/midi/NoteSender.hpp"
 #include "common/dsp/control/AdsrEnv.hpp"
-#include "common/dsp/control/EnvelopeFollower.hpp"
+#include "common/dsp/effects/Compressor.hpp"
 #include "common/dsp/effects/HardClipper.hpp"
 #include "common/dsp/effects/SoftClipper.hpp"
 #include "common/dsp/filters/DjFilterStereo.hpp"
@@ -44,6 +50,8 @@ SOFTWARE.
 #include "common/dsp/synthesis/Oscillator.hpp"
 #include "common/dsp/utility/AdvancedDynamicDelayLine.hpp"
 #include "common/dsp/utility/AutoFreeze.hpp"
+#include "common/dsp/utility/BlockRamp.hpp"
+#include "common/dsp/utility/Oversampler.hpp"
 #include "common/dsp/utility/Quantizer.hpp"
 #include "common/dsp/utility/Slewer.hpp"
 #include "common/fastcode.hpp"
@@ -61,9 +69,36 @@ namespace kastle2
  * @author Marek Mach (Bastl Instruments), Vaclav Mach (Bastl Instruments)
  * @date 2024-11-14
  */
-class AppWaveBard : public virtual App
+class AppWaveBard final : public App
 {
 public:
+    /**
+     * @brief Length of the FX delay lines in samples.
+     */
+    static constexpr size_t kDelayLength = 22000;
+
+    /**
+     * @brief Maximum number of banks in the samples file.
+     */
+    static constexpr size_t kMaxBanks = 32;
+
+    /**
+     * @brief Maximum number of samples per bank in the samples file.
+     */
+    static constexpr size_t kMaxSamples = 32;
+
+    /**
+     * @brief Interpolation of the sample voices. HERMITE removes most of the imaging of pitched down samples,
+     *        but costs about twice as much as LINEAR on the audio core (see the SamplePlayer kernels of the Benchmark app).
+     */
+    static constexpr SamplePlayer16bit::Interpolation kSampleInterpolation = SamplePlayer16bit::Interpolation::LINEAR;
+
+    /**
+     * @brief Size of Kastle2::arena: the delay lines and the sample index of the largest samples file without one.
+     */
+    static constexpr size_t kArenaSize = 2 * Arena::Footprint<q15least_t>(kDelayLength) +
+                                         Arena::Footprint<uint32_t>(kMaxBanks * (kMaxSamples + 1));
+
     /**
      * @brief Initializes all the parameters etc.
      */
@@ -80,7 +115,7 @@ public:
      * @param output Output buffer.
      * @param size Number of sample pairs in the buffer (real size of the buffer is 2*size).
      */
-    FASTCODE void AudioLoop(q15_t *input, q15_t *output, size_t size);
+    FASTCODE_APP(wave_bard) void AudioLoop(q15_t *input, q15_t *output, size_t size);
 
     /**
      * @brief Called whenever CPU is not busy with audio processing. Implement ADC processing and all user inputs here.
@@ -90,7 +125,7 @@ public:
     /**
      * @brief Called once on the startup of the app - while(true) loop isß be implemented inside.
      */
-    FASTCODE void SecondCoreWorker();
+    FASTCODE_APP(wave_bard) void SecondCoreWorker();
 
     /**
      * @brief When the load is freshly loaded this function initializes the memory.
@@ -172,13 +207,57 @@ private:
     };
 
     /**
-     * @brief There are two decks which prevents clicks when retrigerring/switching samples.
+     * @brief Sample voices. The retriggered sample rings out with its envelope on its voice, the new one starts on a free voice.
+     */
+    static constexpr size_t kVoiceCount = 4;
+
+    /**
+     * @brief Voices streaming through their own SRAM cache, the others read the flash through the XIP cache.
+     * @details Each stream holds a DMA channel and the audio, the ADC, the LEDs and the controls hold the rest,
+     *          so the new sample starts on a streamed voice whenever one is free.
+     */
+    static constexpr size_t kStreamedVoices = 2;
+
+    /**
+     * @brief Frames of the equal-power fade out of a stolen voice (about 12 ms, shorter than kTimeBetweenTriggers).
+     */
+    static constexpr size_t kStealFadeFrames = 512;
+
+    /**
+     * @brief SRAM for the warm starts of one bank, split between its samples (512 bytes each with 8 samples).
+     */
+    static constexpr size_t kWarmStartBytes = 4096;
+
+    /**
+     * @brief Banks with warm starts: the selected one and the previous one, which may still be ringing.
+     */
+    static constexpr size_t kWarmStartSets = 2;
+
+    /**
+     * @brief Bank of a warm start set being filled or empty.
+     */
+    static constexpr size_t kNoBank = SIZE_MAX;
+
+    /**
+     * @brief First bytes of the samples of a bank, copied to SRAM when the bank is selected.
+     */
+    struct WarmStart
+    {
+        alignas(4) std::array<uint8_t, kWarmStartBytes> bytes; ///< warm_start_bytes_ of each sample, sample by sample
+        size_t bank = kNoBank;                                  ///< Bank the bytes are from
+    };
+
+    /**
+     * @brief One sample voice of the pool.
      */
-    enum class PlayerDeck
+    struct Voice
     {
-        A,
-        B,
-        COUNT
+        SamplePlayer16bit player;           ///< Playback of the sample
+        AdpcmDecoder adpcm_decoder;         ///< Decoded IMA-ADPCM blocks (unused with the other encodings)
+        AdsrEnv envelope;                   ///< Envelope of a ringing voice, taken over from envelope_ (the active voice plays with envelope_)
+        size_t fade = 0;                    ///< Frames into the steal fade out, 0 when not stolen
+        uint32_t age = 0;                   ///< Number of the trigger which started the voice, the lowest one is the oldest
+        size_t warm_start = kWarmStartSets; ///< Warm start set the sample reads, kWarmStartSets for none
     };
 
     /**
@@ -205,16 +284,32 @@ private:
      */
     int32_t fx_volume_compensation_ = Q15_ZERO;
 
+    /**
+     * @brief Probe after the DJ filter (see AudioProbes).
+     */
+    uint8_t probe_filter_ = Probes::kNoProbe;
+
     /**
      * @brief Array of smart pot controllers for all app parameters.
      */
-    EnumArray<Pot, std::unique_ptr<FancyPot>> pots_;
+    FancyPotBank<Pot> pots_;
 
     /**
      * @brief Previous base pitch value for change detection.
      */
     float base_pitch_prev_ = 0;
 
+    /**
+     * @brief 1V/oct multipliers of the modulated CVs and of the MIDI note, computed again only when they change.
+     */
+    DerivedValue<float, 1> note_pitch_mod_;
+    DerivedValue<float, 1> free_pitch_mod_;
+
+    /**
+     * @brief The DJ filter is set only when its pot changes (the coefficients are computed in float).
+     */
+    DerivedParameter<1> filter_param_;
+
     /**
      * @brief Previous trigger base pitch value for trigger detection.
      */
@@ -335,9 +430,9 @@ private:
     q15_t delay_feedback_ = Q15_ZERO;
 
     /**
-     * @brief Delay wet/dry mix (0.0 to 1.0 in Q15 format).
+     * @brief Delay wet/dry mix (0.0 to 1.0 in Q15 format), ramped over each block to avoid zipper noise.
      */
-    q15_t delay_mix_ = Q15_ZERO;
+    BlockRamp delay_mix_ramp_;
 
     /**
      * @brief Left channel delay stereo offset.
@@ -359,11 +454,6 @@ private:
      */
     int32_t prev_delay_right_val_ = 0;
 
-    /**
-     * @brief Maximum compressor gain for FX processing.
-     */
-    q15_t fx_compressor_max_ = Q15_ZERO;
-
     /**
      * @brief Delay time in audio samples.
      */
@@ -385,24 +475,39 @@ private:
     AdsrEnv envelope_out_;
 
     /**
-     * @brief ADSR envelope for sample fadeout transitions.
+     * @brief Pool of the sample voices.
+     */
+    std::array<Voice, kVoiceCount> voices_;
+
+    /**
+     * @brief SRAM streaming caches of the first kStreamedVoices voices, prefetched from the flash by DMA.
+     */
+    std::array<XipStream, kStreamedVoices> streams_;
+
+    /**
+     * @brief Voice which plays with envelope_ and follows the controls.
+     */
+    size_t active_voice_ = 0;
+
+    /**
+     * @brief Voice loaded by ActualTrigger(), the AudioLoop makes it the active one (kVoiceCount when none).
      */
-    AdsrEnv fadeout_envelope_;
+    volatile size_t pending_voice_ = kVoiceCount;
 
     /**
-     * @brief Maximum value for fadeout envelope.
+     * @brief Counter of the started voices, for their age.
      */
-    q15_t fadeout_envelope_max_ = 0;
+    uint32_t voice_starts_ = 0;
 
     /**
-     * @brief Array of sample players for seamless switching between samples.
+     * @brief Warm starts of the recently selected banks.
      */
-    EnumArray<PlayerDeck, SamplePlayer16bit> players_;
+    std::array<WarmStart, kWarmStartSets> warm_starts_;
 
     /**
-     * @brief Currently active player deck (A or B).
+     * @brief Bytes of each sample in a warm start set, kWarmStartBytes split between the samples of a bank.
      */
-    PlayerDeck active_player_ = PlayerDeck::A;
+    size_t warm_start_bytes_ = 0;
 
     /**
      * @brief Pitch quantizer for musical scales.
@@ -411,43 +516,49 @@ private:
 
     /**
      * @brief Stereo DJ-style filter for frequency shaping.
+     * @note This and the other SecondCoreProcess state are static, placed in SCRATCH_X (see AppWaveBard.cpp).
      */
-    DjFilterStereo filter_;
+    static DjFilterStereo filter_;
 
     /**
      * @brief Slewer for smooth filter volume compensation transitions.
      */
-    Slewer filter_volume_compensation_slewer_;
+    static Slewer filter_volume_compensation_slewer_;
+
+    /**
+     * @brief q15_reciprocal() of the slewed filter volume compensation, recalculated only while it slews.
+     */
+    static int32_t filter_volume_compensation_;
 
     /**
      * @brief Soft clipper for playback audio processing.
      */
-    SoftClipper playback_clipper_;
+    static SoftClipper playback_clipper_;
 
     /**
-     * @brief Soft clipper for FX input processing.
+     * @brief Oversampling of the playback clipper (left, right), with PLAYBACK_CLIPPER_OVERSAMPLING.
      */
-    SoftClipper fx_input_clipper_;
+    static Oversampler<2> playback_oversamplers_[2];
 
     /**
      * @brief General purpose soft clipper.
      */
-    SoftClipper soft_clipper_;
+    static SoftClipper soft_clipper_;
 
     /**
      * @brief Dynamic delay line for left channel processing.
      */
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_left_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> delay_left_;
 
     /**
      * @brief Dynamic delay line for right channel processing.
      */
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_right_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> delay_right_;
 
     /**
-     * @brief Envelope follower for FX compression.
+     * @brief Compressor of the input mix, measured on a sidechain of the input and the playback.
      */
-    EnvelopeFollower fx_compressor_;
+    static Compressor fx_compressor_;
 
     /**
      * @brief Resets the timer keeping time of LED flash length.
@@ -456,13 +567,20 @@ private:
 
     /**
      * @brief Here the second core processes the audio. It is called by the SecondCoreWorker.
+     * @details Runs the FX chain as block stages, one second core sub-block at a time.
+     * @param from First frame to process
+     * @param to One past the last frame to process
      */
-    FASTCODE void SecondCoreProcess(size_t index);
+    FASTCODE_APP(wave_bard) void SecondCoreProcess(size_t from, size_t to);
 
     /**
-     * @brief How many samples are processed by the second core.
+     * @brief Mixes the input with the playback and compresses the sum.
+     * @param playback Playback sample
+     * @param input Input sample (already turned down)
+     * @param gain Compressor gain of the frame
+     * @param expand Reciprocal of the gain to expand the compressed mix back with
      */
-    size_t second_core_processed_samples_ = 0;
+    static inline q15_t MixInput(q15_t playback, q15_t input, q15_t gain, int32_t expand);
 
     /**
      * @brief Total samples second core should process.
@@ -507,20 +625,77 @@ private:
      */
     inline void Trigger(bool manual = false);
 
+    /**
+     * @brief Triggers sample playback from a MIDI note, the sample starts at the frame the note arrived.
+     * @param msg The MIDI message (its arrival time).
+     */
+    inline void TriggerMidi(const midi::Message *msg);
+
+    /**
+     * @brief Triggers sample playback starting at the given audio frame (the MIDI notes, the TRIG input edges).
+     * @param frame Audio frame the sample starts at, the late ones start right away.
+     */
+    inline void TriggerAt(uint32_t frame);
+
     /**
      * @brief Checks for trigger conditions and executes trigger if needed.
      */
     inline void TriggerCheck();
 
     /**
-     * @brief Performs the actual sample trigger with deck switching.
+     * @brief Performs the actual sample trigger, loads the sample on a free voice.
      * @param force True to force trigger regardless of timing constraints.
      */
-    FASTCODE void ActualTrigger(bool force);
+    FASTCODE_APP(wave_bard) void ActualTrigger(bool force);
+
+    /**
+     * @brief Returns the voice for the next sample: a free one (a streamed one first), otherwise the one closest to silence.
+     */
+    size_t FindFreeVoice() const;
+
+    /**
+     * @brief Makes the voice loaded by ActualTrigger() the active one, the previous one rings out.
+     * @details When no voice is left free, the oldest ringing one fades out, so there's one for the next trigger.
+     * @param size Number of frames of the block (for the MIDI note start).
+     */
+    FASTCODE_APP(wave_bard) void StartPendingVoice(size_t size);
+
+    /**
+     * @brief Returns the gain of the equal-power steal fade out.
+     * @param frame Frames since the fade started.
+     */
+    static inline q15_t StealFadeGain(size_t frame);
+
+    /**
+     * @brief Calls the function with the player of the active voice and of the free voices, the ones the controls apply to.
+     * @details The next trigger starts a free voice, so it plays with the current pitch and direction right away.
+     */
+    template <typename Function>
+    void ForEachControlledPlayer(Function &&function)
+    {
+        for (size_t i = 0; i < kVoiceCount; i++)
+        {
+            if (i == active_voice_ || !voices_[i].player.IsPlaying())
+            {
+                function(voices_[i].player);
+            }
+        }
+    }
+
+    /**
+     * @brief Copies the sample starts of the bank selected by the controls to a warm start set, unless one holds them.
+     * @details A set read by a playing voice is kept, with no other set free the copy waits for the next call.
+     */
+    void PrefetchBank();
+
+    /**
+     * @brief Returns the warm start set holding the bank, kWarmStartSets when none does.
+     */
+    inline size_t FindWarmStart(size_t bank) const;
 
     /**
      * @brief Returns the current sample data structure for the player.
-     * @return Sample data with pointer, length, and channel configuration.
+     * @return Sample data with pointer, length, channel configuration and encoding.
      */
     inline SamplePlayer16bit::Sample GetSample() const;
 
@@ -532,9 +707,17 @@ private:
     inline uint32_t GetColor(size_t bank) const;
 
     /**
-     * @brief Edge detector for trigger input processing (rising edge).
+     * @brief Returns the header of a bank or a sample in the file, using the sample index.
+     * @param bank Bank index.
+     * @param entry 0 for the bank header, 1 + sample number for the sample headers.
+     * @return Pointer to the header in flash.
+     */
+    inline const uint8_t *GetHeader(size_t bank, size_t entry) const;
+
+    /**
+     * @brief Trigger input edges, from the GPIO interrupt so the triggers shorter than a block aren't missed.
      */
-    EdgeDetector trigger_ = EdgeDetector(EdgeDetector::Type::RISING);
+    InputEdges trigger_ = InputEdges(Hardware::DigitalInput::TRIG_IN);
 
     /**
      * @brief Flag indicating whether a trigger has occurred.
@@ -546,6 +729,18 @@ private:
      */
     bool trigger_was_manual_ = false;
 
+    /**
+     * @brief Audio frame of the last timed trigger (TriggerAt()), the MIDI notes and the TRIG input edges.
+     */
+    uint32_t trigger_frame_ = 0;
+    bool trigger_frame_pending_ = false;
+
+    /**
+     * @brief Frame the new voice starts at, passed from ActualTrigger() to the AudioLoop.
+     */
+    uint32_t start_frame_ = 0;
+    volatile bool start_frame_pending_ = false;
+
     /**
      * @brief Spacing between triggers in microseconds.
      */
@@ -562,14 +757,14 @@ private:
     bool input_audio_through_fx_ = false;
 
     /**
-     * @brief Amount of compression to apply (Q15 format).
+     * @brief Sample file manager for loading and accessing wave data and other settings.
      */
-    int32_t compress_amount_ = Q15_MAX;
+    WaveBardFile samples_;
 
     /**
-     * @brief Sample file manager for loading and accessing wave data and other settings.
+     * @brief Encoding of all the samples, given by the bit depth and the encoding in the file header.
      */
-    WaveBardFile samples_;
+    SamplePlayer16bit::Encoding sample_encoding_ = SamplePlayer16bit::Encoding::PCM;
 
     /**
      * @brief Loads sample files and other settings from USER_DATA memory section.
@@ -577,6 +772,35 @@ private:
      */
     bool LoadSamples();
 
+    /**
+     * @brief Uses the sample index stored in the file, when it has one.
+     * @param file_reader Validated reader.
+     * @return True if the index can be used, false when the headers have to be walked.
+     */
+    bool MapSampleIndex(const UserDataFile &file_reader);
+
+    /**
+     * @brief Uses the slice tables stored in the file, when it has them.
+     * @param file_reader Validated reader.
+     * @param verified The file passed the checks before, the tables are not checked again.
+     * @return False when the file has slice tables which don't fit it, they are not used then.
+     */
+    bool MapSliceTables(const UserDataFile &file_reader, bool verified);
+
+    /**
+     * @brief Walks the bank and sample headers and fills the sample index in the arena.
+     * @param file_reader Reader positioned at the first bank header.
+     */
+    void BuildSampleIndex(UserDataFile &file_reader);
+
+    /**
+     * @brief Checks that each bank and sample of the index fits the file, so a broken file can't read past it.
+     * @param file_reader Validated reader.
+     * @param data_end Offset where the sample data ends (the stored index or the end marker).
+     * @return True if all the entries are fine.
+     */
+    bool CheckSampleIndex(const UserDataFile &file_reader, size_t data_end) const;
+
     /**
      * @brief LFO oscillator for chorus/modulation effects.
      */
@@ -625,6 +849,36 @@ private:
      */
     static constexpr float kPitchBendRange = 7.0f;
 
+    /**
+     * @brief Number of the MIDI notes.
+     */
+    static constexpr size_t kMidiNotes = 128;
+
+    /**
+     * @brief MidiNoteMapping::pitch_note of the notes which keep the current pitch.
+     */
+    static constexpr uint8_t kNoPitchNote = 0xFF;
+
+    /**
+     * @brief What a MIDI note does, looked up by the note number.
+     */
+    struct MidiNoteMapping
+    {
+        float pitch = 1.0f;                ///< Playback speed of the note as midi_note_, relative to kMidiBaseNote
+        uint8_t pitch_note = kNoPitchNote; ///< Note the playback pitch switches to, kNoPitchNote when it stays
+        bool triggers = false;             ///< The note triggers the sample
+    };
+
+    /**
+     * @brief Maps the notes to the trigger, the pitch and the playback speed, built by BuildMidiNoteMap().
+     */
+    std::array<MidiNoteMapping, kMidiNotes> midi_note_map_;
+
+    /**
+     * @brief Builds midi_note_map_ for the number of samples in the file.
+     */
+    void BuildMidiNoteMap();
+
     // MIDI variables
 
     /**
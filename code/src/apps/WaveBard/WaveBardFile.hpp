@@ -36,14 +36,17 @@ namespace kastle2
  * @see https://github.com/bastl-instruments/kastle2/blob/main/code/src/apps/WaveBard/WAVE_BARD_FORMAT.md
  */
 
+// Sample header as stored in the file, the sample data follows it
+// The headers are only 2-byte aligned, read them with memcpy
 typedef struct WaveBardSample
 {
     uint32_t size;    // size in real bytes (not number of actual 16-bit samples)
     uint8_t channels; // 1 = mono, 2 = stereo
-    // char name[8]; // Don't need to load the name, to save RAM
-    uint8_t *data;
+    char name[8];
+    uint8_t reserved[3];
 } WaveBardSample;
 
+// Bank header as stored in the file, the bank's samples follow it
 typedef struct WaveBardBank
 {
     char name[8];
@@ -53,9 +56,19 @@ typedef struct WaveBardBank
         uint8_t g;
         uint8_t b;
     } color;
-    WaveBardSample *samples;
+    uint8_t reserved;
 } WaveBardBank;
 
+static_assert(sizeof(WaveBardSample) == 16, "Sample header is 16 bytes in the file");
+static_assert(sizeof(WaveBardBank) == 12, "Bank header is 12 bytes in the file");
+
+// Flags of the main header
+static constexpr uint8_t kWaveBardFlagSampleIndex = 0x01; // The sample index is stored before the end marker
+static constexpr uint8_t kWaveBardFlagSliceTable = 0x02;  // The slice tables are stored before the sample index
+
+// Frames of one step of the slice tables, one byte per step
+static constexpr uint32_t kWaveBardSliceFrames = 256;
+
 typedef struct WaveBardFile
 {
     char magic_string[4];
@@ -67,9 +80,16 @@ typedef struct WaveBardFile
     uint8_t num_scales;
     uint8_t num_rhythms;
     uint8_t sequencer_length;
+    uint8_t encoding; // 0 = linear, 1 = µ-law, 2 = A-law (8-bit), 3 = IMA-ADPCM (4-bit)
+    uint8_t flags;    // kWaveBardFlag...
     Quantizer::Scale *scales;
     TriggerGenerator::Rhythm *rhythms;
-    WaveBardBank *banks;
+    // Sample index, for each bank the offset of its header and of its samples' headers from the file begin
+    // Points to the file in flash, or to the arena when the file has none
+    const uint32_t *index;
+    // Offsets of the samples' slice tables from the file begin, sample by sample and bank by bank
+    // Points to the file in flash, nullptr when the file has none
+    const uint32_t *slices;
     char end_marker[4];
 } WaveBardFile;
 
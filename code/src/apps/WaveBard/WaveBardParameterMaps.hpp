@@ -40,17 +40,22 @@ namespace kastle2
 
 // ---SETTINGS---
 static constexpr uint32_t kTimeBetweenTriggers = 20000;          // 20ms (please leave at 20 ms, to prevent glitches when modulating eg. both Sample Mod and TRIG)
+static constexpr uint32_t kTriggerLatencyFrames = AUDIO_BUFFER_SIZE; // TRIG edges start the sample at their frame one block later, the UI loop loads the voice in between
 static constexpr int32_t kPotMoveDetectThreshold = pot(0.1f);    // 10%
 static constexpr int32_t kCVChangeDetectThreshold = pot(0.1f);   // 10%
 static constexpr uint32_t kUiIndicateChangeTime = s2alr(0.035f); // 35ms
 static constexpr uint32_t kUiIndicateChangeColor = WS2812::NONE; // Dip to none color when indicating scale/root change
 static constexpr uint32_t kModeShortPressUnder = s2alr(1.5f);    // For the bank change you need to press it for less than 1.5s
+static constexpr size_t kPotDivisor = 4;                          // Pot autofreeze runs every 4th audio block
 
 // ---INPUT SIDECHAIN / COMPRESSOR---
 static constexpr float kSidechainAttack = 0.005f;  // Sidechain attack time in seconds (must be short, if it's slow it clips)
 static constexpr float kSidechainRelease = 0.04f;  // Sidechain release time in seconds
 static constexpr float kCompressorAttack = 0.005f; // Compressor attack time in seconds (must be set correctly, to not follow the signal too closely - causes ring mod)
 static constexpr float kCompressorRelease = 0.4f;  // Compressor release time in seconds
+static constexpr float kCompressorThreshold = 0.366f; // Sidechain peak where the compression starts
+static constexpr float kCompressorFullLevel = 0.566f; // Sidechain peak where the compression reaches the minimum gain
+static constexpr float kCompressorMinGain = 0.5f;     // Gain of the loudest input
 
 // ---FX DELAY---
 static constexpr auto kMapLowerVolumeWithInput = MapDef<int32_t, 3>{
@@ -98,10 +103,6 @@ static constexpr auto kMapDistortionAmount = MapDef<int32_t, 5>{
     // The clipper always drops output a little, we just pust it little bit higher with 0.003.
     {q15(0.003f), q15(0.003f), q15(0.04f), q15(0.25f), q15(0.6f)}};
 
-static constexpr auto kMapInputDistortionAmount = MapDef<int32_t, 4>{
-    {pot(0.0f), pot(0.55f), pot(0.85f), pot(1.0f)},
-    {q15(0.0f), q15(0.0f), q15(0.04f), q15(0.3f)}};
-
 static constexpr auto kMapFXVolumeCompensation = MapDef<int32_t, 5>{
     {pot(0.0f), pot(0.55f), pot(0.85f), pot(0.95f), pot(1.0f)},
     {q15(1.0f), q15(1.0f), q15(0.55f), q15(0.45f), q15(0.45f)}};
@@ -33,6 +33,10 @@ namespace kastle2
 namespace cc
 {
 
+// Own inline namespace, so the CCs of the apps can be included together (the multi-app image)
+inline namespace wave_bard
+{
+
 // Receive
 static constexpr uint8_t BANK = 1;        // mapped across x number of values (0-127 mapped to 1-6 etc)
 static constexpr uint8_t PITCH = 14;      // top right knob
@@ -56,5 +60,6 @@ static constexpr uint8_t OUT_BANK = 32;             // 0x20
 static constexpr uint8_t OUT_SAMPLE_CONTINOUS = 33; // 0x21
 static constexpr uint8_t OUT_SAMPLE_SIMPLE = 34;    // 0x22
 
+}
 }
 }
\ No newline at end of file
@@ -40,21 +40,7 @@ using namespace kastle2;
 
 #define APP_VERSION "1.6"
 AppWaveBard app;
-
-static void process_audio(q15_t *input, q15_t *output, size_t size)
-{
-    app.AudioLoop(input, output, size);
-}
-
-static void second_core()
-{
-    app.SecondCoreWorker();
-}
-
-static void midi_callback(midi::Message *msg)
-{
-    app.MidiCallback(msg);
-}
+KASTLE2_ARENA(AppWaveBard::kArenaSize);
 
 int main()
 {
@@ -68,14 +54,19 @@ int main()
     // Initialize the app
     app.Init();
 
+    // Sample banks can be updated over USB (scripts/user_data_upload.py), before the second core starts
+    Kastle2::uploader.SetEnabled(true);
+    // Or over MIDI SysEx, for the setups without the USB serial (scripts/sysex_upload.py)
+    Kastle2::sysex_transfer.SetEnabled(true);
+
     // Start second core
-    Kastle2::StartSecondCore(second_core);
+    Kastle2::StartSecondCore<app>();
 
-    // Start I2S
-    Kastle2::StartAudio(process_audio);
+    // Start I2S, the audio interrupt calls the app directly
+    Kastle2::StartAudio<app>();
 
     // Set the MIDI callback
-    Kastle2::SetAppMidiCallback(midi_callback);
+    Kastle2::SetAppMidiCallback<app>();
 
     // Infinite program loop
     while (true)
@@ -13,13 +13,14 @@
 
 /*
  * Samples made using TTS Maker (voice 178 - Chloe) and sped up by 1.05x
- * Sample rate is 11025 Hz.
+ * Sample rate is 11025 Hz, stored as IMA-ADPCM (encoded at compile time).
  */
 
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
+#include "common/dsp/sampling/AdpcmEncoder.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 
 namespace kastle2
@@ -29,11 +30,13 @@ namespace version
 {
 
 static constexpr size_t wave_bard_length = 10092;
-const int16_t wave_bard_data[wave_bard_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 1, 0, 0, -1, 0, -1, -1, -1, -2, -3, -2, -2, -2, -3, -2, -1, 0, 0, 1, 2, 2, 1, 2, 1, 1, 3, 3, 6, 7, 9, 10, 12, 15, 21, 21, 26, 28, 30, 31, 32, 37, 40, 40, 39, 39, 37, 39, 40, 41, 34, 34, 28, 26, 32, 31, 34, 40, 33, 30, 36, 35, 41, 40, 33, 23, 12, 11, 7, 3, -2, 0, 1, -3, -1, -4, -3, -2, -3, -2, -6, -4, -7, -7, -5, -4, -7, -11, -15, -18, -21, -22, -23, -23, -26, -26, -26, -28, -22, -18, -12, -14, -10, -8, -7, -5, -1, 0, 0, 7, 8, 5, -1, 0, -1, -1, -3, -3, -1, -6, -6, -8, -8, -14, -15, -18, -20, -12, -16, -16, -12, -10, -12, -12, -11, -9, -9, -5, -11, -10, -11, -7, -12, -8, -13, -10, -11, -11, -12, -11, -11, -12, -15, -10, -5, -6, -8, -5, -2, 0, 0, 2, 5, 13, 13, 13, 10, 13, 10, 10, 13, 14, 13, 11, 7, 5, 1, 2, -1, 0, -6, -8, -11, -10, -12, -11, -12, -16, -20, -10, -14, -4, -1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 3, 2, 4, 3, 0, 7, 9, 16, 16, 20, 20, 29, 32, 33, 41, 43, 45, 53, 47, 46, 45, 54, 54, 54, 45, 42, 37, 35, 34, 36, 31, 29, 29, 32, 34, 26, 32, 36, 45, 51, 54, 68, 76, 91, 105, 130, 145, 167, 181, 188, 199, 204, 208, 213, 206, 195, 189, 172, 147, 127, 106, 84, 56, 29, 7, -14, -38, -57, -77, -103, -118, -142, -157, -170, -181, -188, -201, -207, -206, -194, -192, -179, -172, -158, -156, -148, -135, -123, -116, -115, -104, -97, -91, -86, -71, -65, -61, -58, -58, -46, -53, -61, -74, -99, -125, -147, -184, -221, -254, -281, -310, -327, -364, -379, -399, -410, -414, -421, -432, -443, -460, -468, -459, -457, -466, -440, -403, -343, -256, -178, -46, 100, 176, 324, 470, 557, 650, 732, 817, 927, 981, 1060, 1143, 1173, 1288, 1439, 1534, 1612, 1625, 1645, 1674, 1619, 1572, 1498, 1333, 1174, 1015, 784, 581, 351, 53, -276, -690, -1248, -1893, -2619, -3224, -3740, -4293, -4751, -4970, -4735, -4239, -3876, -3482, -3061, -2758, -2465, -2173, -1774, -1397, -1177, -918, -641, -455, -236, 52, 437, 879, 1270, 1686, 2188, 2566, 2923, 3330, 3637, 3918, 4179, 4473, 4722, 4752, 4649, 4473, 4145, 3754, 3356, 3006, 2661, 2316, 1932, 1516, 1034, 502, -73, -743, -1497, -2223, -2907, -3506, -4043, -4544, -4911, -4960, -4673, -4333, -4131, -3973, -3875, -3752, -3609, -3444, -3126, -2786, -2402, -1958, -1548, -1109, -633, -137, 434, 1027, 1501, 1993, 2503, 2959, 3418, 3820, 4166, 4480, 4712, 4955, 5169, 5238, 5228, 5111, 4843, 4519, 4102, 3700, 3356, 2987, 2582, 2141, 1656, 1140, 592, -29, -681, -1423, -2199, -2903, -3552, -4180, -4787, -5293, -5508, -5369, -5241, -5213, -5145, -5110, -5009, -4816, -4539, -4095, -3579, -3053, -2477, -1948, -1436, -947, -436, 160, 712, 1168, 1704, 2249, 2806, 3333, 3791, 4243, 4572, 4845, 5137, 5277, 5323, 5354, 5288, 5169, 4970, 4607, 4259, 3937, 3546, 3148, 2705, 2176, 1625, 945, 278, -373, -1074, -1844, -2614, -3306, -3925, -4555, -5202, -5715, -5910, -5906, -5938, -5935, -5804, -5640, -5424, -5179, -4775, -4279, -3712, -3107, -2527, -1995, -1512, -1023, -441, 152, 678, 1176, 1724, 2285, 2866, 3423, 3927, 4344, 4678, 4972, 5221, 5400, 5504, 5537, 5436, 5284, 5073, 4797, 4468, 4146, 3794, 3365, 2859, 2318, 1719, 1112, 482, -152, -882, -1667, -2427, -3097, -3730, -4336, -4938, -5520, -5906, -6019, -6079, -6148, -6113, -6028, -5826, -5540, -5191, -4687, -4177, -3642, -3076, -2496, -1944, -1442, -920, -328, 204, 689, 1229, 1825, 2439, 3020, 3617, 4175, 4641, 5068, 5446, 5731, 5949, 6062, 6083, 6038, 5915, 5675, 5311, 4921, 4577, 4133, 3600, 3063, 2495, 1823, 1116, 418, -292, -1007, -1797, -2577, -3273, -3883, -4441, -5033, -5588, -5949, -6100, -6244, -6378, -6421, -6410, -6249, -5945, -5568, -5100, -4555, -3943, -3325, -2698, -2051, -1483, -917, -310, 240, 739, 1286, 1895, 2504, 3138, 3732, 4297, 4816, 5268, 5652, 5959, 6175, 6302, 6368, 6353, 6172, 5912, 5581, 5247, 4855, 4380, 3865, 3322, 2707, 2062, 1383, 684, -89, -870, -1637, -2399, -3130, -3751, -4300, -4881, -5500, -6013, -6284, -6436, -6592, -6714, -6729, -6631, -6377, -6033, -5599, -5053, -4468, -3851, -3187, -2470, -1795, -1228, -629, -39, 481, 998, 1573, 2194, 2818, 3422, 4036, 4565, 5050, 5508, 5908, 6230, 6426, 6501, 6545, 6487, 6290, 5999, 5607, 5182, 4783, 4332, 3800, 3215, 2565, 1908, 1260, 531, -279, -990, -1746, -2530, -3276, -3901, -4463, -5017, -5564, -6075, -6392, -6567, -6757, -6877, -6881, -6791, -6541, -6164, -5685, -5141, -4605, -4016, -3359, -2668, -2013, -1423, -830, -188, 382, 896, 1487, 2108, 2735, 3327, 3908, 4482, 5008, 5466, 5868, 6193, 6428, 6578, 6621, 6566, 6398, 6143, 5821, 5422, 4998, 4506, 3997, 3469, 2857, 2219, 1549, 876, 161, -582, -1281, -1960, -2664, -3334, -3956, -4492, -5045, -5609, -6092, -6409, -6595, -6754, -6888, -6886, -6728, -6432, -6050, -5553, -4990, -4410, -3822, -3167, -2441, -1770, -1224, -646, -31, 522, 1013, 1594, 2244, 2844, 3382, 3958, 4525, 5017, 5440, 5795, 6071, 6289, 6405, 6441, 6389, 6242, 6021, 5701, 5326, 4912, 4427, 3926, 3381, 2798, 2198, 1581, 949, 262, -427, -1078, -1732, -2388, -3023, -3591, -4127, -4699, -5204, -5663, -6013, -6224, -6458, -6648, -6680, -6607, -6393, -6088, -5678, -5206, -4683, -4092, -3460, -2819, -2176, -1551, -945, -331, 205, 706, 1263, 1866, 2454, 2975, 3519, 4025, 4543, 5019, 5384, 5637, 5897, 6109, 6235, 6218, 6115, 5927, 5635, 5288, 4880, 4460, 3979, 3461, 2916, 2405, 1887, 1310, 699, 35, -594, -1210, -1757, -2364, -2991, -3517, -4020, -4539, -5029, -5544, -5812, -5971, -6134, -6258, -6273, -6126, -5886, -5567, -5138, -4681, -4258, -3763, -3170, -2524, -1891, -1398, -928, -311, 256, 747, 1225, 1747, 2304, 2784, 3275, 3734, 4187, 4562, 4899, 5234, 5467, 5575, 5665, 5722, 5648, 5421, 5070, 4762, 4413, 3971, 3520, 3057, 2604, 2154, 1697, 1144, 613, 99, -421, -972, -1585, -2136, -2657, -3209, -3727, -4254, -4712, -5118, -5385, -5554, -5707, -5762, -5763, -5657, -5444, -5117, -4769, -4390, -3965, -3538, -3039, -2504, -1986, -1390, -789, -273, 126, 598, 1212, 1744, 2194, 2640, 3167, 3636, 4083, 4413, 4774, 5055, 5340, 5461, 5473, 5468, 5353, 5146, 4906, 4559, 4191, 3893, 3421, 2993, 2533, 2040, 1494, 887, 365, -135, -637, -1279, -1838, -2487, -3117, -3591, -4060, -4576, -5082, -5422, -5636, -5706, -5809, -5843, -5697, -5469, -5101, -4691, -4301, -3807, -3223, -2845, -2424, -1877, -1333, -853, -400, 120, 603, 935, 1389, 1896, 2435, 2868, 3216, 3741, 4159, 4417, 4662, 4804, 4884, 4951, 4926, 4932, 4741, 4564, 4261, 3886, 3479, 3226, 2763, 2339, 1885, 1392, 949, 376, -139, -747, -1466, -2066, -2740, -3262, -3736, -4254, -4667, -5118, -5370, -5406, -5506, -5524, -5362, -5042, -4617, -4142, -3664, -3094, -2459, -2133, -1756, -1268, -861, -407, 96, 795, 1297, 1699, 2146, 2643, 3239, 3538, 3912, 4334, 4516, 4606, 4666, 4679, 4765, 4626, 4489, 4294, 3876, 3462, 3335, 2976, 2423, 2190, 2033, 1829, 933, 26, -934, -1757, -2435, -3155, -3791, -4610, -5203, -5560, -5757, -5799, -5778, -5559, -5137, -4576, -4076, -3556, -2768, -2134, -1655, -1117, -779, -173, 95, 345, 911, 1563, 2367, 3018, 3511, 3717, 4014, 4316, 4416, 4315, 4140, 4004, 3886, 3724, 3608, 3763, 3553, 3410, 3299, 3015, 2707, 2451, 2024, 1406, 905, 41, -909, -2028, -3015, -3786, -4810, -5762, -6709, -7187, -7789, -8055, -7743, -7541, -6558, -5536, -4490, -3028, -1772, -509, 370, 1127, 1736, 2261, 2698, 2969, 3628, 4264, 5084, 5393, 5474, 5804, 5285, 4916, 4513, 3689, 3014, 2186, 1722, 1708, 1652, 1666, 1791, 2033, 1945, 1572, 1340, 830, 63, -858, -1868, -2547, -3338, -4343, -5262, -6255, -7682, -8632, -9150, -9676, -8879, -7822, -6452, -4382, -3019, -1499, -6, 894, 2072, 3283, 4043, 5251, 6542, 7506, 8810, 9482, 9324, 8886, 7574, 5895, 4324, 2686, 1747, 1055, 757, 715, 126, -223, -799, -1361, -1541, -1695, -1770, -1410, -990, -1383, -2070, -3481, -5272, -7199, -10032, -11434, -11237, -10746, -8900, -6333, -4045, -2080, -692, 431, 1620, 2493, 4092, 6916, 9333, 11249, 12623, 13008, 12418, 10380, 8070, 6576, 4867, 3327, 2645, 1837, 428, -1159, -2703, -3873, -4605, -4750, -3495, -1791, -789, -478, -1146, -2602, -5084, -8201, -11000, -11538, -10047, -8854, -6897, -5096, -3998, -3274, -3165, -1434, 1247, 3857, 6728, 9839, 11756, 11588, 10212, 8623, 7487, 5930, 5650, 6450, 5905, 4509, 2479, -81, -2656, -3782, -3371, -2262, -1306, -1078, -668, -1013, -2927, -4797, -5596, -6341, -8066, -10597, -10787, -9206, -9809, -9293, -6659, -3934, -1496, 198, 2988, 5936, 7324, 8604, 10299, 10862, 10467, 9777, 8400, 6981, 5298, 4341, 3948, 2189, 236, -672, -955, -1770, -1884, -670, -592, -1039, -795, -225, -889, -2644, -3079, -4520, -7321, -11269, -16324, -14779, -10514, -9414, -6378, -3155, -1767, -1602, -127, 4705, 9299, 11776, 12958, 12661, 9752, 6754, 5730, 6213, 6219, 5202, 4501, 1801, -1619, -3183, -2375, 390, 1810, 1903, 1834, 870, -539, -9, 2093, 1987, 291, -2712, -7832, -12992, -18465, -17712, -11104, -9339, -7427, -4639, -4413, -3007, -50, 6913, 13643, 15038, 13350, 10372, 7390, 5038, 5532, 7628, 6449, 2145, -1780, -3739, -4069, -2045, 1361, 2952, 2473, 1008, 152, 569, 1474, 3666, 4579, 1270, -3532, -8041, -11481, -13413, -17633, -17832, -10951, -9236, -9451, -6118, -2316, 3061, 7269, 11476, 16305, 15555, 11006, 9124, 8457, 6802, 5154, 3659, 1441, -2472, -4560, -3365, -1235, 537, 1614, 1890, 1555, 2447, 3717, 4936, 5338, 3749, 1445, -2184, -5805, -8944, -11723, -16239, -22552, -19097, -11931, -11096, -7306, -2440, 1576, 6678, 9531, 13800, 17244, 14507, 10357, 8215, 5651, 2714, 1354, 558, -2251, -4914, -4587, -2273, 440, 1681, 2842, 4463, 5477, 5801, 6184, 7007, 5085, 1998, -750, -4720, -8300, -11177, -16867, -24040, -21356, -12355, -8945, -6427, -2118, 3136, 8722, 11607, 15439, 19192, 15879, 9172, 6168, 4107, 843, -877, -2182, -4963, -7445, -6062, -1629, 1823, 3276, 3676, 5105, 7093, 7245, 7757, 7878, 4157, -116, -3199, -6986, -10669, -14768, -22645, -26983, -18634, -9611, -6735, -3692, 293, 6783, 12648, 16098, 19590, 18815, 11762, 4749, 3210, 3378, 955, -2800, -5061, -6617, -6914, -2375, 3183, 5554, 5396, 5728, 8401, 9583, 8476, 7842, 5159, 19, -4590, -7907, -11035, -15862, -21987, -27864, -23097, -10327, -6117, -4746, 245, 6673, 13144, 16498, 18095, 17456, 10678, 1618, 14, 962, -2216, -5330, -7051, -7106, -5591, -587, 5886, 8539, 8196, 8407, 10807, 10692, 8675, 7682, 4492, -1239, -6779, -9457, -12627, -17955, -23378, -26885, -18343, -5777, -3161, -1231, 3903, 10822, 16815, 18611, 18235, 13014, 4228, -1664, -2694, -2245, -4127, -7706, -7963, -5843, -3176, 2872, 7611, 8648, 8728, 9416, 10799, 9928, 6693, 3975, 1409, -4173, -9356, -12656, -15904, -18683, -25693, -25362, -10002, -957, -777, 1281, 6991, 15545, 18545, 17801, 15432, 7303, -1143, -4229, -2921, -3647, -7459, -8824, -6698, -2491, 3722, 8862, 11316, 12455, 13188, 13703, 11063, 6481, 2905, -534, -5790, -10608, -12736, -16372, -19298, -23068, -23153, -9482, 50, 67, 1745, 6838, 15153, 17989, 16173, 12240, 3220, -4230, -5669, -5442, -7156, -9390, -8856, -5324, -1703, 4208, 10617, 13427, 14067, 13584, 13774, 12191, 7388, 2766, -1043, -6141, -9871, -12691, -18407, -21004, -24789, -22627, -6545, 940, 1049, 3528, 9442, 19194, 20731, 15939, 10725, 3453, -3289, -5438, -5926, -7685, -9958, -9475, -3077, 1270, 5084, 10301, 11566, 13602, 15269, 13358, 10149, 4956, 933, -1879, -8852, -13671, -16782, -21352, -24350, -24448, -12191, 77, -256, 703, 7849, 16745, 20101, 16325, 12227, 6416, -1668, -5575, -7085, -8496, -10377, -9445, -2855, -335, 2455, 8924, 12196, 13361, 12911, 12860, 10839, 6002, 2306, -2195, -7294, -10463, -13856, -17612, -23911, -24032, -7871, 450, -1419, 2279, 8790, 17459, 18047, 13862, 12014, 4836, -2242, -2663, -4634, -10553, -12071, -8288, -3642, -1726, 2031, 7740, 10039, 11405, 9944, 8305, 7976, 3772, 597, -2782, -8356, -10278, -12654, -19267, -22782, -13698, -1654, -516, -1403, 4483, 13897, 17882, 13999, 11277, 8815, 2469, -1182, -3017, -6308, -7939, -6806, -4407, -2228, 3122, 7609, 8093, 9662, 9419, 8513, 6809, 2159, -1231, -4710, -7560, -10950, -15151, -18340, -21565, -13956, -1927, -219, -983, 2698, 11564, 17384, 15650, 11824, 6789, 2487, 57, -1911, -4549, -8278, -7928, -2429, 312, 3005, 7235, 8212, 9228, 10221, 8764, 5673, 2295, -1371, -5642, -9589, -12078, -13315, -18275, -23003, -15123, -3251, -288, -519, 3708, 12962, 17291, 14932, 12310, 7692, 2613, 476, -1561, -5729, -7621, -5257, -2201, -961, 2702, 9067, 11542, 10417, 8935, 8582, 6735, 1606, -3416, -7785, -12309, -14274, -17173, -23859, -19876, -5865, -843, -1636, 2240, 10962, 16997, 15436, 12321, 8790, 3398, -1322, -3243, -4295, -8396, -8095, -2967, -681, 3029, 6127, 9036, 12168, 11344, 9745, 7355, 4269, -558, -7428, -12188, -13629, -17710, -24801, -20648, -7291, -896, 270, 3918, 11205, 16423, 15584, 14321, 12313, 4719, -446, -1307, -5247, -8568, -6979, -3256, -1199, 1325, 4574, 7391, 9595, 9290, 8618, 6291, 2315, -1745, -6582, -10113, -14123, -18829, -22205, -17302, -6406, -3023, -1893, 2575, 11570, 17098, 12559, 11825, 11079, 4377, 1453, -23, -4550, -6647, -3480, 111, 991, 3008, 6848, 8350, 7372, 6507, 7063, 4868, -1308, -5408, -8130, -10799, -15350, -21040, -17488, -8365, -4116, -2960, 875, 7682, 12313, 12057, 10936, 9596, 5536, 2645, 49, -4126, -5070, -1953, 378, 645, 1952, 5321, 8103, 7563, 6652, 5375, 1475, -2065, -5374, -9126, -12091, -16366, -18085, -12567, -6442, -2388, 1313, 3975, 7978, 10988, 11018, 9952, 5754, 2647, 1891, -2600, -5696, -3290, 392, 1457, 532, 3632, 7650, 8010, 7915, 6672, 3408, -596, -3843, -6917, -10860, -14737, -17254, -14230, -7751, -3659, -1529, 2796, 9106, 10802, 10075, 9927, 8218, 5150, 1011, -2355, -3871, -3243, -1652, -942, 118, 1793, 4093, 6813, 6357, 3926, 1656, 12, -3197, -8500, -11816, -14382, -12953, -7374, -4679, -4843, -1096, 6018, 9214, 8919, 8005, 8878, 8346, 5609, 3524, 242, -853, -327, -205, -126, 270, 1871, 3307, 3452, 1542, 428, -782, -3146, -6020, -10464, -12116, -12635, -9946, -4217, -3867, -2233, 2695, 8022, 8497, 5835, 7632, 7834, 5834, 2301, 805, 453, -693, 1186, 2096, 2102, 2467, 3722, 4254, 3626, 2188, -1299, -3802, -6141, -8345, -10151, -13442, -11899, -5433, -4281, -3139, 814, 4221, 6982, 6432, 7160, 7344, 5885, 4661, 2184, 575, -135, 938, 1653, 1520, 2757, 3351, 3893, 2980, 1174, 384, -2010, -5718, -8224, -8988, -11285, -9708, -3726, -4064, -4127, 754, 5103, 5942, 3760, 5401, 7920, 5434, 2142, 1607, 1324, 979, 1193, 898, 1348, 1588, 2711, 3858, 1248, -843, -1460, -3047, -6377, -10132, -9951, -8463, -5707, -3366, -3772, -645, 4158, 6235, 5359, 5040, 6637, 6642, 4401, 1245, 1346, 2119, 1205, 1334, 1132, 1948, 4177, 3197, 583, 307, -1180, -3062, -5914, -10525, -10453, -10362, -9142, -4312, -4655, -3046, 2254, 5419, 7660, 5455, 5429, 8334, 6498, 3790, 1825, 1846, 2161, 1825, 2056, 1151, 2283, 3181, 2806, 1367, -1575, -3012, -4738, -7776, -10953, -12170, -10353, -5119, -3949, -5676, -1251, 3826, 7550, 6589, 4176, 7665, 8123, 4551, 3511, 2375, 1491, 2417, 1845, 1303, 1516, 2529, 3374, 1402, -519, -1020, -2694, -6705, -9238, -10618, -9847, -5235, -5726, -6068, -2312, 1057, 4681, 4223, 4542, 6627, 6711, 6295, 3957, 2973, 3015, 2469, 1972, 574, 910, 2866, 2062, -1007, -1315, -363, -1493, -6116, -10153, -8834, -7573, -4889, -4093, -6163, -2650, 2427, 5768, 4191, 3000, 6960, 7429, 5170, 3664, 2840, 3288, 2355, 1131, 1755, 1574, 1516, 1360, 331, -222, -1354, -3615, -5886, -8244, -10523, -8651, -4943, -5549, -6856, -3574, 2269, 4800, 4158, 5506, 8039, 7321, 5294, 5894, 4893, 2130, 1701, 1383, 1485, 1591, 247, 82, -18, -549, -938, -4003, -7624, -7935, -7644, -6526, -5136, -6514, -4662, -885, 1556, 3046, 3656, 6489, 6885, 5247, 5382, 5523, 4806, 2808, 2045, 2400, 1822, 1441, 450, -1093, -1030, -1035, -2849, -6124, -8064, -8265, -7623, -5773, -5760, -4991, -2414, 699, 3241, 3316, 5380, 8206, 6567, 4826, 6271, 5240, 3340, 2398, 1745, 2229, 1048, 439, 401, -1866, -3576, -2419, -4102, -7986, -8753, -8987, -4956, -4166, -7497, -2997, 660, 2258, 2894, 3616, 7956, 8092, 5426, 6599, 6778, 3871, 3509, 3047, 2005, 528, 104, 752, -1383, -3334, -3419, -3434, -6981, -8886, -8407, -6149, -4395, -6941, -4367, -538, 1736, 2389, 2752, 6812, 7756, 5939, 6021, 6608, 5112, 4556, 3984, 2628, 1698, 1017, 387, -662, -2281, -3113, -3229, -7559, -8603, -8588, -8452, -4860, -6637, -5869, -2030, 1147, 2819, 2661, 5465, 7846, 7361, 5812, 7108, 6587, 4541, 3998, 2764, 1670, 738, 389, -1110, -2260, -2435, -2975, -5772, -8231, -8044, -6476, -4989, -6780, -5803, -2637, 444, 1978, 1365, 4475, 6990, 6464, 6095, 6472, 6205, 5497, 4562, 2697, 2068, 1217, 189, -263, -2570, -3188, -3387, -6325, -7591, -7954, -6364, -4836, -7098, -5025, -1016, 1128, 1405, 1645, 5814, 6876, 5607, 6198, 6388, 5747, 4838, 4095, 3351, 1321, 69, 374, -1122, -2812, -3203, -4960, -7059, -7189, -7316, -6393, -5890, -5898, -2833, -869, 1310, 2236, 3523, 6885, 6817, 6138, 6159, 7255, 5673, 3214, 3272, 2688, 1205, -886, -1201, -2065, -3538, -4073, -6312, -7252, -7897, -7428, -4906, -5790, -4762, -1875, 404, 2847, 2701, 4648, 7615, 7175, 6038, 6761, 6352, 5106, 4045, 2269, 2478, 788, -1234, -1124, -2683, -4464, -5398, -7131, -7831, -8683, -8873, -4883, -5328, -5350, -1430, 1534, 4247, 3057, 5512, 8996, 7496, 6931, 6705, 6586, 5180, 2703, 2523, 1467, -145, -1055, -2114, -3302, -4527, -5602, -7596, -8111, -7692, -6110, -5688, -6010, -2653, 116, 2098, 2787, 4466, 7968, 7878, 6685, 7011, 7290, 5633, 3388, 2207, 2282, 342, -1887, -1534, -2621, -3805, -5349, -7406, -6946, -7315, -6894, -5577, -6250, -2953, -496, 866, 2853, 3489, 7500, 7958, 6419, 7385, 7428, 6612, 4206, 2915, 2666, 929, -1162, -1555, -2455, -4459, -4969, -6333, -7601, -7978, -7482, -5198, -5568, -5206, -1422, 1167, 2455, 3200, 5729, 8270, 7687, 7036, 7587, 7160, 5306, 3928, 2474, 1360, -118, -2140, -2848, -4791, -5489, -6601, -8792, -8305, -7856, -5633, -5601, -5414, -1322, 1244, 3154, 3256, 5674, 8866, 7867, 7351, 7682, 7477, 5736, 3660, 2796, 1661, -395, -2109, -3040, -4414, -5873, -7344, -8729, -8960, -8616, -6981, -5631, -5504, -2626, 1273, 3427, 3704, 5987, 9369, 9038, 7907, 7963, 8436, 6290, 3853, 2928, 1641, -245, -2197, -3590, -5247, -5926, -7427, -9077, -9556, -8935, -6279, -6132, -5650, -2025, 1219, 3392, 3566, 6463, 9941, 8807, 8229, 8761, 8234, 6181, 3909, 3007, 1409, -1129, -2654, -3739, -5796, -6739, -7612, -9131, -9373, -8628, -6139, -5515, -5422, -1312, 2415, 3305, 3878, 7132, 10081, 9051, 7701, 8429, 8029, 5636, 3822, 2379, 376, -1778, -2896, -4639, -6445, -7268, -8463, -8985, -9170, -7697, -5803, -5521, -2979, 457, 2589, 4232, 5802, 8688, 9573, 8576, 8907, 7873, 6521, 4827, 2995, 1179, -1134, -2149, -3984, -5887, -7028, -7732, -8886, -9415, -8650, -6851, -5517, -4778, -1520, 1612, 3794, 4935, 7248, 10002, 9667, 8638, 8490, 8027, 5777, 3194, 1452, -70, -1860, -3936, -5888, -6748, -7276, -8665, -9358, -8996, -6999, -5464, -5022, -2531, 848, 3753, 4723, 6425, 9714, 10763, 9213, 8326, 8577, 6784, 4058, 1594, -107, -1854, -3727, -5488, -7433, -8061, -8333, -9026, -9461, -7835, -5012, -4530, -3764, 116, 3656, 4951, 5455, 8253, 10858, 9778, 8753, 8299, 7133, 4989, 2470, 346, -1890, -3302, -4979, -6845, -7679, -8399, -8952, -9234, -8239, -5528, -5020, -4129, -377, 2711, 4692, 5285, 7996, 10458, 9832, 9292, 8715, 7336, 5081, 3457, 998, -1773, -3222, -4646, -6454, -8234, -8611, -8867, -9569, -8594, -5975, -4833, -4471, -1016, 2761, 4236, 5190, 7655, 10229, 9933, 9021, 9168, 7822, 5417, 3775, 1669, -820, -3090, -4752, -6419, -7711, -8572, -9386, -9448, -9048, -6566, -5083, -4767, -1585, 1722, 4236, 5154, 6942, 9951, 10159, 9383, 8888, 8159, 6238, 3977, 1741, -709, -2760, -4261, -6002, -7580, -8668, -9488, -8666, -8813, -7491, -5324, -4344, -1420, 859, 3718, 5604, 6925, 9104, 9647, 9549, 8841, 8096, 6237, 4136, 2224, -120, -2369, -4234, -5941, -7297, -8461, -9445, -9174, -9409, -7816, -5284, -4668, -2600, 522, 3865, 5415, 6326, 8898, 10089, 10100, 9091, 8147, 6819, 4629, 2807, 97, -2287, -3837, -5647, -7006, -8204, -9176, -8942, -8987, -8080, -5768, -4809, -2804, -97, 2535, 4929, 6187, 8309, 9047, 9455, 9571, 8368, 6670, 4583, 3443, 1097, -1727, -3512, -4887, -6376, -7692, -8581, -8907, -8891, -8325, -5824, -4532, -3490, -753, 2010, 4492, 5467, 7244, 8828, 8907, 8864, 8260, 6980, 4764, 3342, 1650, -656, -2947, -4509, -5763, -6913, -7357, -8162, -8347, -7937, -5704, -4160, -3651, -1465, 962, 3214, 4565, 6060, 7579, 7757, 7740, 7810, 6600, 4855, 3336, 1638, -177, -1986, -3119, -4533, -5755, -5779, -5942, -6404, -6789, -5671, -3716, -3150, -2187, -677, 1131, 2794, 3662, 5380, 5919, 5661, 5937, 5548, 4439, 2984, 1824, 733, -774, -1986, -2560, -3401, -3927, -3946, -3795, -3817, -3666, -2631, -1949, -1526, -908, -22, 731, 993, 1924, 2786, 2638, 2623, 2897, 2450, 1813, 1342, 1094, 624, -277, -288, -316, -671, -863, -914, -957, -1221, -1117, -859, -877, -1089, -857, -478, -617, -745, -272, 153, 142, 302, 300, 469, 527, 388, 577, 614, 758, 995, 944, 1052, 1268, 1222, 961, 559, 403, 292, -216, -690, -846, -1042, -1389, -1664, -1501, -1201, -940, -811, -556, 1, 290, 718, 1091, 1230, 1391, 1575, 1655, 1601, 1392, 1174, 1051, 605, 213, -168, -565, -786, -1130, -1382, -1597, -1704, -1631, -1441, -1251, -917, -591, -341, 163, 618, 941, 1089, 1372, 1627, 1539, 1593, 1386, 1148, 846, 457, 187, -369, -684, -856, -1079, -1226, -1297, -1352, -1203, -1069, -776, -435, -460, -86, 218, 553, 755, 752, 1119, 1162, 1243, 1216, 930, 904, 635, 396, 111, -302, -505, -741, -941, -1004, -1183, -1103, -986, -966, -650, -594, -323, -17, 119, 477, 466, 658, 815, 802, 1007, 814, 732, 614, 389, 342, 37, -196, -331, -567, -600, -712, -857, -849, -912, -723, -712, -762, -508, -378, -53, 80, 137, 368, 477, 782, 764, 721, 764, 636, 524, 400, 210, 61, -211, -423, -505, -672, -673, -782, -780, -743, -775, -633, -604, -430, -250, -171, 15, 124, 401, 519, 618, 727, 752, 804, 740, 589, 422, 260, 4, -163, -423, -573, -763, -865, -841, -895, -854, -809, -665, -469, -332, -82, 35, 197, 386, 520, 691, 761, 813, 808, 769, 708, 571, 306, 170, -25, -246, -510, -701, -716, -808, -891, -866, -759, -623, -518, -377, -113, 64, 249, 387, 534, 668, 731, 779, 766, 661, 621, 485, 318, 136, -55, -184, -422, -604, -702, -757, -801, -820, -750, -589, -506, -342, -156, 31, 241, 383, 536, 646, 733, 776, 734, 674, 595, 454, 339, 147, -26, -200, -364, -482, -573, -613, -655, -678, -567, -490, -416, -276, -115, 68, 198, 341, 461, 576, 677, 709, 704, 672, 581, 481, 315, 140, -19, -181, -322, -481, -592, -640, -651, -633, -556, -462, -355, -247, -99, 65, 223, 377, 492, 544, 611, 664, 663, 594, 513, 446, 308, 143, -28, -184, -332, -460, -572, -672, -696, -671, -605, -539, -389, -232, -109, 55, 219, 367, 475, 547, 600, 606, 593, 557, 474, 407, 323, 208, 55, -58, -138, -241, -371, -436, -441, -494, -518, -521, -426, -357, -302, -186, -58, 64, 156, 244, 344, 384, 396, 406, 392, 342, 287, 241, 186, 128, 90, 64, -3, -52, -88, -113, -155, -208, -221, -261, -293, -278, -269, -234, -196, -142, -68, -14, 59, 124, 180, 240, 290, 297, 308, 323, 318, 283, 245, 213, 161, 58, -31, -99, -170, -230, -267, -291, -313, -295, -254, -204, -164, -98, -16, 47, 94, 144, 180, 189, 213, 225, 231, 230, 212, 176, 139, 88, 18, -65, -134, -193, -246, -295, -302, -282, -254, -206, -160, -94, -22, 39, 103, 159, 212, 232, 239, 253, 257, 241, 193, 142, 91, 23, -49, -130, -198, -244, -270, -302, -300, -261, -222, -177, -111, -25, 46, 122, 203, 259, 290, 304, 317, 299, 250, 206, 157, 87, -8, -100, -177, -248, -308, -346, -355, -344, -307, -237, -160, -75, 16, 98, 181, 246, 305, 364, 401, 401, 374, 339, 299, 222, 108, -5, -106, -216, -342, -442, -505, -557, -583, -568, -510, -426, -308, -177, -14, 151, 299, 441, 551, 646, 702, 695, 647, 559, 453, 327, 188, 32, -111, -259, -397, -506, -606, -671, -700, -682, -603, -496, -372, -226, -83, 61, 177, 272, 355, 427, 490, 525, 549, 547, 510, 435, 336, 229, 110, -18, -137, -259, -357, -440, -499, -530, -514, -467, -384, -280, -173, -61, 33, 106, 176, 231, 275, 298, 308, 320, 318, 295, 249, 207, 164, 110, 63, 24, -18, -42, -60, -64, -52, -35, -5, 21, 61, 99, 104, 94, 101, 84, 52, -1, -47, -90, -124, -144, -148, -144, -136, -117, -81, -53, -28, -5, 29, 77, 129, 184, 240, 307, 355, 370, 358, 326, 279, 212, 118, 19, -59, -136, -221, -288, -340, -372, -393, -396, -383, -369, -328, -285, -231, -165, -92, 3, 94, 180, 251, 294, 313, 306, 292, 261, 217, 163, 104, 37, -24, -86, -136, -192, -250, -292, -311, -327, -342, -332, -314, -288, -249, -208, -150, -92, -35, 25, 58, 81, 98, 98, 106, 111, 109, 102, 85, 80, 81, 80, 75, 58, 45, 26, 6, -17, -31, -41, -50, -62, -58, -54, -53, -51, -52, -65, -75, -84, -86, -94, -97, -99, -70, -41, -16, 10, 39, 74, 104, 117, 133, 147, 163, 171, 171, 181, 194, 180, 167, 149, 108, 57, 12, -17, -66, -114, -128, -136, -139, -140, -126, -106, -93, -93, -68, -66, -77, -85, -81, -70, -60, -30, 5, 23, 55, 81, 101, 95, 86, 93, 102, 93, 83, 100, 123, 121, 120, 121, 119, 100, 72, 51, 27, 4, -24, -50, -56, -77, -69, -72, -68, -67, -67, -64, -56, -56, -57, -34, -3, 23, 41, 72, 119, 144, 162, 182, 190, 176, 165, 149, 128, 92, 64, 49, 31, 1, -18, -28, -45, -68, -68, -68, -77, -76, -47, -34, -22, -12, 19, 43, 60, 75, 90, 96, 93, 79, 74, 70, 75, 72, 68, 72, 76, 73, 58, 53, 54, 29, 12, 14, 17, 9, 2, 19, 35, 32, 36, 46, 44, 15, -4, -12, -24, -48, -54, -47, -46, -62, -57, -51, -56, -67, -69, -63, -53, -41, -16, -5, 10, 46, 59, 54, 67, 70, 55, 32, 26, 17, -3, -16, -19, -20, -21, -36, -36, -37, -49, -57, -47, -51, -55, -51, -42, -50, -45, -33, -30, -33, -36, -37, -44, -72, -77, -87, -94, -92, -87, -66, -43, -29, -8, 8, 27, 39, 65, 85, 111, 141, 171, 191, 197, 185, 181, 162, 131, 86, 54, 18, -11, -65, -105, -120, -138, -155, -168, -167, -170, -171, -151, -121, -101, -74, -34, 8, 46, 66, 102, 141, 153, 166, 187, 184, 163, 147, 151, 126, 91, 77, 77, 47, 9, -2, -9, -33, -60, -55, -50, -58, -61, -39, -26, -35, -35, -32, -35, -75, -89, -94, -94, -104, -106, -92, -71, -64, -49, -13, 19, 39, 61, 89, 132, 153, 159, 180, 202, 211, 189, 162, 141, 105, 56, 4, -40, -94, -143, -180, -204, -220, -225, -217, -212, -198, -182, -155, -119, -82, -28, 15, 59, 105, 150, 174, 193, 194, 193, 166, 139, 103, 68, 24, -4, -42, -61, -80, -112, -128, -132, -127, -130, -129, -106, -89, -73, -57, -20, 10, 29, 44, 60, 67, 65, 48, 36, 7, -7, -26, -45, -40, -40, -44, -46, -46, -28, -10, -4, 18, 64, 88, 114, 135, 162, 178, 173, 168, 157, 132, 98, 58, 11, -46, -83, -130, -163, -195, -221, -232, -237, -241, -230, -210, -190, -142, -92, -56, -12, 37, 89, 118, 146, 176, 201, 195, 178, 168, 141, 95, 57, 26, 1, -38, -63, -83, -101, -124, -131, -135, -124, -124, -105, -77, -55, -38, -18, 2, 31, 55, 74, 78, 71, 41, 25, 17, 16, 17, 20, 21, 18, -2, -15, -20, -17, -21, -9, -1, 0, 2, 13, 15, 13, 10, 9, -2, -13, -30, -55, -87, -101, -114, -119, -115, -101, -103, -100, -95, -91, -86, -76, -69, -48, -35, -26, -11, 2, -2, 2, 8, 12, 8, 15, 19, 8, -13, -8, -15, -29, -23, -9, -5, 9, 19, 29, 25, 18, 15, 18, 6, 5, 16, 20, 2, -6, -4, -8, -30, -31, -26, -35, -47, -44, -39, -27, -32, -19, -10, -10, -17, -17, -15, -11, -6, 0, -26, -26, -18, -25, -17, -3, 0, 14, 17, 26, 42, 46, 37, 43, 34, 19, 6, -3, -14, -5, -20, -16, -20, -33, -20, -23, -32, -3, 7, 34, 37, 48, 59, 62, 85, 105, 124, 141, 135, 112, 93, 87, 85, 70, 39, 12, -13, -31, -62, -84, -108, -111, -121, -120, -90, -58, -60, -71, -83, -94, -85, -62, -68, -47, -19, -12, -11, -37, -75, -76, -66, -67, -4, 90, 121, 236, 388, 451, 593, 794, 989, 1372, 1816, 2524, 3644, 4867, 4951, 4391, 4147, 3583, 3396, 3201, 2632, 2287, 1217, -18, -705, -1443, -1713, -1416, -1840, -2304, -2344, -2293, -1967, -1708, -1359, -815, -609, -319, -325, -540, -454, -733, -1151, -860, -819, -1529, -1455, -1602, -1783, -1401, -1295, -990, -611, -778, -766, -558, -921, -1401, -1268, -1509, -2017, -2441, -2511, -2354, -2706, -2898, -2195, -2141, -2470, -1973, -1570, -1592, -1160, -619, -439, -7, 15, 92, 265, 193, 62, 326, 428, 648, 700, 362, -216, -1111, -1909, -2273, -2391, -2517, -2501, -2893, -3789, -5179, -7026, -8635, -9734, -8911, -6464, -3731, -419, 2476, 3814, 4039, 4318, 4778, 4838, 4726, 4543, 3248, 1680, 827, 431, 912, 2114, 3214, 4341, 4530, 3165, 2082, 11, -2794, -4719, -6554, -9203, -12235, -16503, -19588, -14525, -8282, -2122, 9225, 16398, 16419, 15303, 11687, 7420, 3475, -966, -503, 455, -2093, -2374, -1052, -2183, -279, 4592, 8768, 11526, 12217, 12570, 9962, 4233, 1158, -1948, -6249, -7731, -8477, -12912, -18558, -23751, -21046, -10185, -1908, 11176, 24108, 25316, 21842, 16022, 8962, 2422, -4049, -5319, -3752, -5112, -5646, -2966, -2239, -1258, 4748, 11548, 15707, 15922, 14852, 11863, 4528, -1008, -4103, -7281, -8907, -9929, -12615, -17688, -25015, -28990, -16696, -215, 12598, 26804, 31706, 28551, 19404, 6341, -3727, -10244, -13947, -10789, -6531, -8704, -7215, -2944, -333, 6628, 15393, 22504, 24233, 18688, 12581, 4953, -3727, -8578, -9436, -10259, -11050, -12228, -17132, -24977, -30620, -20852, 749, 15620, 27520, 32543, 28783, 17640, 1839, -10012, -14708, -18462, -14497, -5251, -5873, -4366, 1415, 3211, 9634, 17713, 21327, 23560, 16881, 8254, 708, -8723, -11380, -9985, -9510, -7198, -5974, -12285, -20972, -27980, -23109, -2296, 12372, 23232, 31491, 27305, 15504, 1829, -9933, -15673, -19043, -15786, -5862, -4057, -3078, 3781, 6602, 10615, 17401, 19845, 19403, 12705, 4328, -1750, -9638, -10823, -7240, -6194, -4841, -5149, -11939, -21044, -28046, -25322, -6099, 10044, 20877, 30264, 27209, 15151, 1827, -9487, -15590, -17784, -14807, -6493, -3717, -1900, 4529, 7830, 10466, 16661, 19142, 16633, 9959, 1414, -4274, -9777, -9816, -5043, -3479, -2733, -3595, -10269, -19490, -26968, -25717, -7636, 9039, 18978, 28871, 26351, 14825, 2038, -9752, -15963, -16930, -14238, -6938, -2147, -769, 4947, 9165, 10984, 16065, 17918, 14212, 7397, 329, -4424, -8085, -6371, -2332, -1346, -1642, -5556, -13456, -22543, -29610, -26260, -5679, 11874, 21278, 30089, 27046, 13353, -396, -11082, -16711, -18296, -13744, -4888, -1094, 887, 8144, 11632, 11965, 15836, 15220, 10170, 4255, -1494, -5192, -6259, -2994, 480, 58, -2158, -7047, -14849, -23400, -28117, -19778, 241, 14430, 23407, 29126, 21577, 6903, -5366, -15125, -19279, -17532, -10537, -1717, 2142, 5361, 11911, 13342, 11959, 13827, 11333, 4965, -227, -3353, -4803, -3569, 216, 3360, 3055, -1326, -8090, -16729, -24579, -28207, -18247, 2687, 15592, 24454, 29644, 20337, 4400, -7930, -16974, -20729, -17309, -8426, 898, 4944, 9550, 13784, 11970, 12032, 11513, 6298, 2123, -1193, -3293, -3283, -1141, 2568, 4390, 2243, -3341, -11040, -19255, -26541, -27778, -11863, 9176, 19115, 28090, 30268, 15234, -2223, -13194, -21238, -22333, -15344, -2943, 6304, 8392, 13210, 14615, 9354, 10221, 9179, 2506, -11, -1609, -3803, -2664, 1177, 4816, 4451, 29, -5541, -13085, -22062, -27600, -20878, -1539, 12280, 21676, 29835, 23453, 5593, -9988, -18867, -22110, -18729, -8370, 4331, 9899, 11742, 13773, 9745, 5896, 6490, 3721, 60, 535, 273, -1451, 594, 4458, 4081, -30, -4507, -10886, -19642, -26042, -23705, -8505, 8331, 18768, 27925, 27246, 10831, -6569, -16831, -21969, -20529, -11417, 2923, 11085, 11551, 12935, 11005, 5672, 4053, 2944, 449, -408, -202, 35, 1268, 3623, 4521, 1792, -3742, -10245, -16900, -23075, -24052, -12253, 5306, 15757, 22818, 25824, 15186, -3365, -15200, -18681, -18706, -13488, -98, 11098, 11999, 12325, 12877, 6621, 1744, 1651, -181, -1686, 597, 2509, 2749, 4043, 4450, 1198, -5846, -12534, -17472, -22595, -22794, -9860, 7312, 15207, 21627, 24456, 12974, -3704, -13909, -18207, -18340, -11970, 1068, 11841, 14464, 14744, 13241, 5374, -462, -1421, -2202, -1809, 1872, 4988, 5862, 6834, 4798, -1285, -8840, -15271, -19189, -21284, -18752, -4618, 11243, 16972, 20550, 21196, 7950, -8553, -16063, -17580, -15467, -7704, 4556, 13065, 14492, 12825, 9332, 2871, -921, -1556, -743, 1827, 4814, 6292, 6890, 5305, 1106, -5545, -13234, -18452, -20175, -20379, -13787, 2473, 15303, 19905, 21818, 16064, -18, -13501, -17656, -16520, -11969, -1147, 10284, 14186, 13296, 10127, 4385, -878, -2767, -1033, 2087, 5167, 8815, 8947, 5842, 1446, -4729, -11932, -17116, -20364, -20916, -14903, -759, 11569, 17887, 21583, 16222, 2141, -8966, -14723, -16812, -12658, -3000, 7795, 12305, 11726, 10648, 5346, -1567, -1992, 381, 2389, 4907, 8064, 8785, 5310, 978, -2823, -9084, -15480, -18007, -19434, -16738, -4242, 8907, 15477, 20427, 18515, 5974, -7209, -14338, -17255, -15080, -5095, 6998, 12288, 13173, 11883, 5880, -1282, -3404, -1923, 358, 4323, 8553, 8684, 6059, 2655, -3101, -10894, -15314, -16825, -19065, -14106, 838, 11837, 16106, 19510, 14653, -32, -11199, -15015, -15438, -11286, -753, 10719, 13686, 11667, 9528, 3372, -2920, -4248, -2728, 1661, 5284, 6673, 7912, 6087, 573, -6427, -12658, -16031, -18596, -17039, -4522, 9211, 14837, 19221, 17885, 4094, -9606, -15249, -16955, -14093, -3897, 8884, 14893, 14244, 12002, 5449, -1898, -3750, -3549, -1336, 4230, 7811, 7153, 5300, 1741, -5625, -12978, -15981, -17711, -16627, -4322, 9491, 15164, 19205, 16897, 2573, -10154, -15293, -16454, -12281, -2131, 9234, 13872, 13004, 10772, 4036, -2454, -3212, -1906, 37, 4012, 7188, 6605, 4341, 1314, -3968, -10650, -14707, -16647, -15401, -4996, 7442, 13027, 16486, 14384, 3081, -7461, -12332, -13849, -9950, -976, 7318, 11205, 11150, 7925, 2204, -2755, -3662, -2179, 259, 3947, 6174, 5213, 3167, 43, -6127, -12051, -14747, -15205, -10192, 108, 8647, 14324, 15763, 8348, -1928, -7924, -11709, -11410, -4437, 4506, 9411, 9634, 8590, 4336, -1863, -4121, -2197, -533, 1055, 5063, 6360, 2888, -67, -3649, -9891, -14050, -15311, -13040, -3386, 7507, 13317, 16107, 13013, 2736, -6836, -11530, -11599, -6219, 1463, 8410, 11182, 10139, 6656, 456, -4008, -3587, -2214, -817, 3472, 6240, 3802, -100, -3892, -9498, -14529, -15029, -11432, -3375, 5515, 11703, 15945, 12333, 2159, -4535, -8746, -11110, -5783, 2663, 8085, 10514, 10216, 6452, 492, -3273, -2988, -1557, -260, 3000, 4669, 2216, -1031, -4890, -9984, -13567, -13755, -10720, -3035, 6112, 11821, 14264, 10775, 2088, -5205, -8884, -9397, -4345, 3996, 9012, 9793, 8846, 5800, -258, -3758, -2048, -620, 846, 4139, 4886, 2083, -2310, -6889, -10660, -13038, -13408, -9584, -739, 7187, 11865, 14201, 8970, -902, -6800, -9450, -8959, -2104, 6485, 10482, 10908, 8970, 3889, -2057, -4070, -2218, -183, 2782, 5844, 4525, -45, -4658, -8859, -12264, -13866, -11805, -4932, 3041, 8563, 12761, 11491, 2991, -4209, -7436, -9353, -5654, 3243, 8600, 9845, 9822, 6336, 438, -3017, -2194, -166, 2325, 5505, 5176, 1075, -3028, -7284, -11486, -13314, -12582, -8472, -253, 7145, 11044, 12097, 6399, -2696, -7564, -8928, -7387, -494, 7855, 10125, 8878, 7212, 2180, -2727, -2014, 856, 1939, 4151, 5180, 1510, -2780, -5626, -8547, -11042, -11396, -8131, -1999, 3459, 8675, 11737, 6663, -919, -4985, -7661, -7146, -1737, 5459, 9532, 8592, 6547, 3468, -1734, -3002, -174, 1455, 3342, 5028, 2458, -1908, -5457, -8805, -10765, -10587, -7332, -341, 5851, 9135, 10257, 5163, -2541, -6445, -8355, -6754, 344, 7661, 10109, 8717, 6151, 1192, -4003, -3203, 553, 1671, 3696, 4983, 697, -4216, -6127, -8485, -10632, -9343, -4546, 1549, 5805, 9336, 9901, 2935, -4089, -6121, -7605, -6752, 940, 8848, 8931, 7194, 7156, 1280, -5075, -2315, 1107, 852, 4193, 5738, -190, -5596, -8446, -10898, -11600, -9706, -2720, 5413, 8730, 11528, 10901, 1820, -6057, -7963, -7774, -4921, 2547, 10188, 9937, 6073, 4800, -274, -5950, -2550, 2030, 1699, 3807, 4643, -2138, -7812, -8613, -10127, -11417, -7686, 582, 6577, 8872, 11311, 8903, 394, -5457, -6604, -6581, -3131, 4483, 9064, 8010, 6051, 3207, -1795, -3747, -733, 1442, 1787, 2556, 332, -5594, -9010, -9429, -10353, -9360, -3042, 5134, 8781, 10166, 10315, 4010, -3772, -5818, -5771, -5268, 838, 8356, 8618, 6191, 4772, 166, -3933, -2281, 692, 1328, 2758, 2474, -2984, -7903, -9563, -11256, -11806, -7289, 1772, 8619, 10651, 11775, 8227, -1511, -6796, -5860, -6016, -2392, 7248, 10849, 6831, 5122, 2828, -3806, -5137, 40, 2085, 1606, 3179, 835, -6738, -10538, -10399, -11981, -11219, -2023, 8239, 10994, 11778, 11223, 2686, -6695, -8136, -6673, -4441, 3631, 11132, 10170, 6596, 4270, -1264, -6039, -3600, 409, 1444, 2254, 1687, -3254, -8411, -10289, -11405, -11501, -5820, 4370, 10205, 12117, 13007, 7102, -2890, -7837, -7946, -6185, -817, 7241, 11468, 9283, 5171, 1456, -3913, -6277, -2478, 795, 1786, 2905, 752, -6072, -10688, -11614, -12804, -10537, -250, 10194, 13054, 13147, 10975, 1972, -7261, -8340, -5667, -3027, 3733, 10942, 10890, 6211, 2150, -1956, -5796, -4969, -518, 2496, 2942, 1349, -3085, -8977, -12508, -13544, -11528, -3256, 7031, 11864, 12951, 10329, 1622, -6410, -8376, -6303, -1681, 5069, 10650, 11523, 8015, 2893, -1766, -4995, -4749, -1012, 2212, 3275, 2066, -2392, -8178, -11763, -13451, -13261, -6719, 5700, 13206, 13030, 11802, 6065, -6091, -12576, -9282, -5033, 316, 9309, 14382, 11544, 6157, 1900, -2426, -5354, -2829, 1354, 1963, 1727, 569, -5004, -10501, -11970, -12803, -11665, -2904, 8555, 13330, 13872, 11275, 2030, -8481, -11907, -9100, -3812, 3824, 11399, 13770, 8916, 2154, -1759, -4292, -4035, 890, 4391, 4299, 3581, -977, -8719, -12533, -13379, -14161, -10046, 1984, 12615, 14754, 13491, 8993, -1992, -11850, -12505, -8246, -2545, 6169, 14049, 14150, 7406, 1664, -2263, -6165, -5098, 1217, 5025, 4781, 3189, -1278, -7510, -11889, -14114, -14383, -9468, 2223, 12936, 15998, 14860, 9844, -1971, -12459, -13671, -9654, -3135, 5772, 12930, 14091, 8498, 1234, -2587, -4537, -4676, -85, 4303, 4474, 3240, -328, -7523, -12802, -14720, -16132, -10532, 4246, 15078, 16835, 16145, 9971, -3453, -12718, -12730, -8975, -2768, 5642, 11529, 12011, 7454, 1728, -2252, -5405, -4876, -57, 2985, 4002, 4990, 2105, -5415, -11857, -14571, -15332, -11762, 199, 13271, 17134, 15013, 10690, 372, -11173, -13141, -8638, -3780, 3497, 10496, 11272, 6536, 1319, -1785, -3148, -3243, -1025, 2851, 4786, 3848, 1908, -1821, -8589, -14270, -16275, -14216, -4743, 8808, 16833, 17491, 14088, 4641, -8566, -14653, -11725, -6144, 167, 7494, 11629, 9263, 3722, -405, -1490, -1750, -1333, 809, 2835, 3430, 3700, 2500, -2601, -8786, -13354, -17365, -17571, -7073, 10391, 20431, 20294, 16073, 6158, -8994, -18002, -15177, -8048, -639, 6899, 10914, 9697, 5331, 1058, -1339, -1569, -669, 681, 2041, 2472, 2814, 3401, 1689, -3106, -8108, -12820, -16345, -15618, -8597, 4872, 17888, 22231, 19305, 11142, -2957, -15469, -18586, -15299, -7478, 3280, 9248, 10085, 10273, 7021, 704, -2008, -847, -9, -121, 205, 432, 469, 1990, 2819, 855, -2500, -7147, -12205, -14001, -13601, -9586, 3841, 17963, 20437, 17335, 11738, -2111, -15641, -18496, -14219, -6298, 2960, 7465, 8830, 10184, 7475, 1179, -973, 1571, 1524, -1457, -1551, -21, 254, 1538, 3356, 2021, -1068, -6106, -12855, -14793, -12494, -8867, 1397, 16279, 21598, 16287, 9220, -1163, -13520, -19217, -15439, -6644, 2463, 7497, 7805, 8483, 8577, 5287, 2078, 1108, -218, -3430, -4785, -1917, 3088, 5988, 6394, 5660, 1584, -5019, -10716, -13052, -12211, -10118, -6967, 1123, 13520, 19227, 14436, 6933, -482, -9270, -16353, -15728, -7828, 1086, 5250, 6288, 8684, 9005, 4707, 587, -439, -258, -1182, -1684, 642, 4966, 7594, 6879, 4026, 820, -2618, -9013, -13750, -11208, -6520, -4949, -4712, -2569, 5266, 15997, 16480, 8551, 3705, -3281, -15223, -20178, -13398, -2913, 4205, 5906, 6820, 10481, 9811, 2785, -502, 1963, 134, -4628, -3041, 747, 2034, 4940, 7106, 3806, 1246, -384, -4241, -5101, -3423, -3555, -4083, -5030, -8099, -10411, -7542, 3033, 14775, 16822, 12030, 5200, -4453, -12923, -15981, -12658, -4156, 3131, 4701, 6827, 9864, 7277, 2407, 1458, 2289, -206, -3447, -3006, -112, 2548, 3781, 3785, 2321, 411, -2834, -5047, -1763, 1111, -100, 409, 1914, -2046, -9154, -14234, -14463, -5837, 8265, 16500, 15112, 11688, 5859, -5416, -13863, -14000, -8833, -3265, -351, 2984, 7758, 8233, 4819, 3626, 4367, 4268, 1125, -4289, -5754, -2308, -286, 1389, 4748, 5125, 3031, -491, -3948, -3989, -1567, 875, 2558, 3048, 1655, -2647, -8242, -12902, -15689, -10108, 4518, 14579, 15833, 14551, 8296, -4888, -14409, -14937, -10712, -3391, 2051, 3403, 5903, 7503, 5490, 4156, 4376, 4276, 1509, -4094, -6384, -3146, 776, 3512, 4615, 3786, 2981, 311, -3273, -3620, -920, 2730, 4375, 3013, 402, -1809, -5890, -11487, -14554, -15315, -11165, 2409, 16971, 19292, 15477, 11281, 461, -11346, -16143, -14806, -8012, 585, 1209, -197, 5047, 8832, 9211, 9942, 8194, 1997, -5422, -10078, -9032, -3111, 3105, 7130, 8706, 8743, 5046, -596, -3699, -3976, -2951, -2608, -927, 1706, 2615, 806, -2493, -6293, -10332, -12480, -12912, -9436, 2789, 17353, 20468, 16484, 8969, -5307, -14076, -14982, -14052, -7620, 1311, 3926, 4953, 8542, 9289, 7453, 5189, 2688, -1358, -5752, -7396, -4786, 755, 4371, 5930, 5859, 5018, 2482, -1379, -3000, -2195, -166, 865, 2113, 3916, 3814, 1354, -1769, -6245, -12262, -14986, -16451, -16374, -5639, 13992, 24945, 22506, 16930, 6739, -5471, -13423, -18520, -16747, -8532, -6217, -6750, 828, 10560, 15690, 15632, 12156, 9010, 2782, -8200, -15115, -12353, -5263, 568, 4388, 6421, 8313, 9167, 5514, 297, 590, 3792, 3044, -286, -2389, -2061, -748, -1569, -3858, -6184, -8982, -10353, -11169, -11606, -2247, 15201, 21839, 16816, 9208, -1599, -9583, -14243, -17833, -12382, -3150, -1627, -122, 5823, 9977, 12017, 10425, 5579, 1666, -2430, -8943, -12944, -8034, 507, 6827, 9911, 9546, 7610, 4106, 744, -2047, -2781, -754, 1735, 2715, 1810, 1968, 3422, 3282, -363, -4984, -10077, -13328, -12121, -13466, -15865, -8568, 9830, 22738, 22951, 17282, 4387, -7802, -12557, -15821, -14343, -6391, -2474, -3220, -2006, 2177, 9546, 14285, 13795, 11011, 5382, -1842, -9166, -13759, -12862, -4678, 4193, 5915, 6986, 9276, 8450, 5946, 3497, 251, -2961, -2907, -458, 3038, 6587, 7168, 3923, 1483, 822, -3949, -10006, -12933, -13773, -14665, -16328, -15597, -4545, 17983, 29695, 23954, 13026, -210, -9370, -12745, -15130, -14342, -9249, -6849, -5723, -2942, 2751, 13501, 20066, 16938, 7989, -526, -6723, -10617, -9592, -5397, -808, 1159, 719, -74, 2712, 9695, 12949, 10997, 7364, 2538, -2063, -4147, -4722, -2713, 2470, 5317, 3877, 1332, -272, -1258, -2184, -3387, -5871, -9567, -14372, -19712, -20268, -8950, 12710, 27472, 24930, 14247, 3111, -4201, -7719, -11391, -13024, -10079, -7692, -8032, -7759, -3641, 6943, 16223, 17216, 13334, 7795, 608, -5942, -9529, -11664, -9328, -2797, 1458, 1718, 2582, 6184, 10515, 15396, 16030, 9080, 1467, -2765, -7221, -9242, -7164, -4022, 859, 5248, 5910, 3744, 2598, 3257, 2034, -1644, -5440, -9472, -13038, -15275, -19205, -19439, -6358, 13368, 23960, 23230, 15589, 4338, -2688, -6775, -12371, -15011, -12369, -9502, -8423, -6745, -1167, 9381, 19030, 21346, 14377, 4159, -2616, -6420, -9620, -10825, -8984, -5471, -951, 1490, 3770, 10075, 16245, 16544, 11633, 4369, -1989, -5376, -7228, -6039, -2197, 1499, 3958, 4136, 1953, 269, 508, 793, 1361, 622, -1827, -5224, -10264, -15434, -19626, -20243, -11632, 4978, 17045, 20081, 16303, 7330, -175, -4359, -8390, -11027, -10023, -8800, -7705, -5857, -2468, 5759, 14110, 15880, 10778, 2967, -3151, -5547, -5966, -5795, -3485, 42, 2501, 3413, 4205, 5389, 7718, 10583, 10160, 6169, 2033, -1523, -3725, -2190, 1177, 2824, 2870, 2216, -255, -2133, -2100, -2321, -2563, -5049, -10365, -15628, -17892, -12552, 1564, 15150, 18944, 14482, 6057, -429, -2268, -3223, -5420, -7525, -9302, -9656, -7350, -5278, -677, 7197, 12119, 12911, 10636, 5830, 1232, -814, -2320, -4282, -5167, -5048, -4527, -2933, -65, 3117, 5764, 6432, 4140, -630, -5497, -7076, -4865, -819, 3552, 5763, 5527, 4334, 3757, 5567, 6758, 5663, 2294, -3205, -7657, -8411, -7723, -7659, -6065, -4917, -4275, -2698, -1361, 1275, 6745, 11880, 11834, 6545, -1586, -6717, -7227, -6623, -5723, -5476, -5104, -2817, 562, 3209, 6531, 9658, 10022, 7347, 1850, -2919, -4649, -4838, -5328, -6515, -6857, -4592, -195, 4737, 8672, 11137, 12662, 12738, 10265, 5946, 1589, -2804, -5284, -6632, -8212, -8241, -8016, -7795, -7662, -7584, -6968, -4781, -675, 4533, 8394, 8492, 6769, 3577, 2267, 3072, 1637, -1628, -6312, -9783, -9519, -6639, -3791, -358, 2377, 3391, 4852, 4930, 5016, 5966, 6031, 3907, -10, -4011, -6759, -6105, -4604, -2975, -1426, -890, 535, 2316, 4129, 5728, 6827, 6477, 5123, 2650, -1029, -3319, -5313, -6168, -6103, -6113, -4070, -298, 4625, 9100, 11497, 12260, 12059, 10433, 7792, 3828, -964, -4429, -7238, -9154, -10273, -10959, -10995, -10611, -9848, -8348, -4461, 894, 6271, 9166, 8626, 7184, 5497, 5061, 3776, -174, -4320, -8192, -9989, -9005, -7318, -5004, -1842, 1269, 3796, 5478, 6581, 7615, 8633, 7421, 3895, -92, -4256, -5592, -5678, -6136, -5271, -4510, -2243, 963, 3271, 5958, 8036, 8532, 7822, 4954, 946, -1269, -2956, -4971, -6623, -8392, -8237, -5274, -2197, 1290, 5216, 8670, 13136, 14962, 13303, 10053, 4957, 1378, -1058, -4505, -8304, -11354, -12729, -11708, -9957, -9757, -9010, -6694, -2245, 4953, 9114, 9172, 8173, 5148, 4620, 5201, 2405, -1011, -5981, -10002, -9902, -8376, -6071, -2857, -656, 1409, 4137, 5540, 6906, 8535, 8213, 6506, 3721, -910, -4071, -5267, -6471, -5915, -5417, -4770, -2475, -456, 1890, 5135, 7514, 8164, 8072, 5982, 3204, 1625, -1245, -4530, -7211, -9083, -8292, -5699, -3046, -553, 2519, 6221, 10190, 13632, 13547, 10658, 7362, 3651, 1154, -1312, -5267, -8581, -10864, -11751, -10863, -10062, -9445, -7354, -3988, 289, 5058, 7509, 8157, 8313, 6912, 5709, 3716, 34, -3286, -6291, -8776, -9655, -9289, -8128, -4795, -1101, 1566, 4080, 5575, 7254, 9403, 9772, 7786, 4528, 461, -2595, -4001, -5571, -6650, -6963, -6298, -4217, -1636, 832, 3346, 6012, 7795, 8345, 7482, 5322, 2585, -40, -2412, -4904, -6303, -7043, -7308, -5838, -3729, -803, 2872, 6079, 8498, 10603, 11706, 10884, 9372, 5963, 2111, -767, -4683, -7768, -10151, -12364, -12510, -11268, -9866, -7621, -4625, -1539, 3132, 7334, 9158, 10291, 9333, 7560, 6601, 3575, -560, -4037, -8318, -10423, -9804, -9820, -7526, -4838, -3186, 889, 4179, 6504, 9323, 10033, 9050, 7705, 4581, 1061, -1022, -3630, -5553, -6321, -7589, -7167, -4900, -2174, 1072, 3670, 5073, 5930, 6357, 6085, 5043, 2966, 355, -2045, -4337, -5615, -5998, -6147, -5023, -3653, -1345, 2521, 6088, 9986, 11597, 10870, 9782, 7509, 5807, 3292, -997, -5777, -10486, -13441, -13575, -12299, -11509, -9485, -6818, -3138, 2815, 6846, 9544, 11153, 10559, 10015, 8235, 4780, 669, -3592, -7837, -10539, -11370, -11484, -9185, -6527, -4112, -393, 3174, 7050, 10670, 11664, 10286, 8344, 5583, 2966, 557, -3099, -6302, -8532, -9534, -8827, -7147, -4758, -1839, 1152, 3971, 6566, 8120, 8915, 8573, 6828, 4562, 1596, -1207, -3758, -5868, -7169, -7611, -6674, -5231, -3072, -802, 1317, 3550, 5480, 7477, 8339, 9428, 9846, 7603, 5333, 2916, 945, 607, -612, -3862, -6560, -8013, -8324, -6705, -6345, -7615, -7329, -5597, -2753, 1372, 3524, 3499, 4159, 4187, 5028, 5659, 3722, 1471, -1218, -3093, -3631, -4099, -4619, -4885, -4939, -4168, -2117, -306, 1865, 3596, 3983, 3964, 3742, 3385, 3134, 2816, 903, -1282, -2927, -3901, -3317, -3141, -3637, -3499, -2769, -1272, 1108, 2572, 2991, 3620, 3588, 3453, 3585, 2832, 1427, -142, -1724, -2919, -3191, -2762, -2647, -2123, -1397, -851, 1147, 2678, 3343, 3826, 3185, 2972, 2704, 2545, 1699, 729, 2331, 2696, 2748, 2912, 1877, 2844, 3908, 3526, 1252, -1571, -3979, -5559, -5980, -8555, -10466, -10354, -9169, -5030, -1510, 200, 2229, 3754, 6132, 8557, 8312, 6262, 3584, 1189, -708, -1949, -4476, -6741, -7014, -7986, -6810, -4605, -2994, 134, 2537, 3792, 5211, 6332, 6577, 6600, 4965, 2058, 134, -1941, -3314, -4201, -5949, -6433, -5636, -4509, -2115, 160, 1793, 3880, 4992, 5444, 5967, 5495, 4393, 2680, 495, -1826, -3539, -4092, -4532, -4460, -3944, -3141, -1573, 264, 2396, 3927, 5009, 5791, 4845, 4688, 4306, 2771, 3558, 2569, 461, -461, -1819, -759, 881, 687, -870, -2004, -2233, -1853, -1734, -4625, -7014, -7683, -6817, -3781, -2262, -2201, -1517, 160, 2961, 6071, 6604, 4910, 4022, 3113, 2543, 2052, -964, -3781, -4703, -5486, -4906, -4172, -4258, -3399, -1839, 169, 2110, 3458, 3851, 3666, 3455, 2995, 2466, 1469, -295, -2190, -3584, -4042, -3512, -2993, -2530, -2004, -1083, 862, 2580, 3869, 4272, 3937, 3810, 2929, 1965, 988, -515, -1707, -2562, -2826, -2579, -1960, -1444, -984, 201, 1514, 2846, 3606, 3441, 2787, 2359, 1784, 483, -438, -1479, -2112, -2654, -2749, -2424, -1668, 1962, 4257, 5334, 6221, 5893, 7482, 8452, 6848, 3034, -892, -3876, -6069, -7862, -11372, -13455, -13222, -11062, -6973, -3834, -1539, 1232, 5334, 9504, 11897, 11565, 8958, 6813, 4899, 2364, -1148, -5989, -9585, -10735, -10644, -9727, -8870, -7725, -4515, -276, 4095, 6903, 7630, 8483, 8847, 9236, 8571, 5662, 2051, -1789, -3969, -4899, -5978, -6913, -7931, -7560, -5127, -2017, 744, 2506, 3753, 5128, 6591, 7279, 6353, 4519, 2254, 445, -1052, -2703, -3929, -4786, -4676, -3777, -2368, -1141, 87, 1822, 3046, 4251, 4896, 4704, 4087, 3159, 1987, 235, -1197, -2696, -3833, -4239, -4850, -4568, -3295, -1385, 5, 876, 1803, 3003, 7221, 10237, 9220, 6538, 3535, 3876, 4786, 2994, -1348, -5418, -6112, -5967, -6103, -8396, -11403, -11238, -8109, -3588, -691, -315, -381, 2117, 6662, 9752, 9253, 5772, 2881, 2251, 2265, 520, -3263, -6947, -8383, -7253, -5751, -5241, -4978, -3560, -672, 2498, 4641, 5149, 5028, 5311, 5873, 5700, 4032, 1346, -1101, -2145, -2500, -3061, -4003, -5085, -5038, -3573, -1632, -227, 509, 1037, 2133, 3939, 4890, 4744, 3842, 2857, 2453, 1516, 252, -1329, -2363, -1950, -1956, -2026, -2256, -2245, -706, 825, 1911, 1921, 1520, 1958, 2425, 2776, 2061, 615, -220, -780, -1143, -1626, -2477, -2730, -2545, -2074, -1279, -1046, -548, -26, 376, 1420, 1273, 1389, 3071, 4400, 4924, 3973, 3567, 3959, 4145, 3982, 1395, -664, -1905, -3306, -4342, -6959, -9301, -10240, -9337, -7031, -4850, -3262, -2415, -252, 3439, 7114, 8748, 7801, 6000, 5051, 5198, 4096, 1018, -2925, -5525, -6362, -6858, -7496, -8406, -7431, -5125, -2524, 183, 1414, 3061, 5553, 7598, 8691, 7802, 5939, 4329, 3537, 2671, 147, -2828, -5259, -6150, -5700, -5796, -5590, -5088, -3560, -763, 1240, 2960, 4010, 4856, 6248, 6741, 6211, 4477, 2597, 1533, 397, -877, -2365, -4107, -4830, -4304, -3598, -2874, -2581, -2196, -766, 917, 1972, 2245, 2292, 2489, 3079, 3452, 2795, 1650, 620, 124, 18, -430, -1379, -2339, -2706, -2052, -1101, -988, -1112, -798, 75, 1446, 2117, 1899, 1502, 1280, 1822, 1981, 1279, 273, -665, 636, 2094, 1885, 1714, 1417, 2371, 3753, 3999, 2865, 877, 99, -702, -2047, -4373, -7177, -8472, -8904, -8293, -7362, -6410, -4938, -2984, -457, 1976, 4283, 6109, 7343, 7567, 7176, 6511, 4952, 3044, 446, -1764, -3338, -5164, -6760, -7931, -7712, -6539, -5253, -4031, -2662, -440, 2001, 4167, 5619, 6250, 6650, 6922, 6984, 6222, 4167, 1717, -125, -1365, -2618, -4366, -5991, -6852, -6547, -5342, -4504, -3729, -2522, -590, 1706, 3370, 4369, 4642, 5061, 5641, 5706, 5059, 3457, 1912, 820, -102, -1306, -2957, -4034, -4426, -4274, -3786, -3563, -2952, -1828, -449, 903, 1832, 2653, 3086, 3569, 4016, 3789, 3191, 2218, 1548, 1089, 245, -872, -2098, -2550, -2185, -1928, -2119, -2443, -2227, -1148, 103, 788, 1011, 1059, 1704, 2664, 2855, 2210, 1047, 564, 734, 1580, 2258, 676, -543, 379, 2459, 3269, 1682, 804, 1070, 2171, 2164, -401, -2870, -4090, -3731, -4138, -6149, -7779, -8311, -6566, -4397, -3673, -3658, -2659, 282, 2988, 4330, 4574, 4811, 5873, 6732, 6454, 4617, 2699, 1659, 890, -273, -2284, -4171, -5216, -5174, -4759, -4884, -4904, -4399, -2995, -1051, 424, 1415, 2141, 3274, 4713, 5372, 5085, 4237, 3641, 3419, 2727, 1410, -402, -1923, -2548, -2872, -3320, -4132, -4682, -4200, -3114, -2066, -1497, -942, 234, 1726, 2856, 3248, 3284, 3657, 4189, 4064, 3239, 2123, 1291, 754, -6, -1057, -2230, -2918, -3106, -3193, -3160, -3027, -2479, -1687, -1098, -356, 545, 1347, 2028, 2408, 2717, 2923, 2878, 2738, 2206, 1559, 987, 377, -170, -891, -1439, -1751, -2015, -2010, -1838, -1470, -1111, -892, -430, 168, 702, 1157, 1311, 1462, 1628, 1624, 1514, 998, 616, 376, -144, -657, -1096, -1125, -1235, -1505, -1053, -171, 415, 395, 639, 1690, 2545, 2753, 2650, 2722, 2873, 2470, 1713, 838, -315, -1710, -2989, -3595, -3685, -4046, -5051, -5795, -5260, -3761, -2563, -2540, -2659, -1591, 494, 2135, 2296, 1988, 2197, 3017, 3663, 3348, 2456, 1477, 1063, 1101, 835, 116, -862, -1478, -1431, -1139, -1034, -1371, -1858, -1756, -1066, -349, -199, -563, -621, -166, 493, 800, 562, 287, 280, 586, 842, 718, 443, 222, 224, 437, 488, 297, 49, 48, 363, 611, 612, 417, 321, 532, 748, 724, 482, 223, 130, 122, 56, -76, -266, -407, -420, -381, -327, -378, -388, -258, -67, 155, 285, 363, 417, 547, 699, 685, 569, 464, 454, 388, 245, 35, -152, -213, -267, -280, -384, -446, -360, -278, -162, -200, -220, -87, 75, 238, 242, 257, 339, 360, 400, 345, 240, 158, 62, 14, -68, -161, -211, -301, -350, -318, -271, -152, -71, 64, 231, 242, 267, 323, 545, 709, 563, 446, 462, 642, 755, 610, 461, 361, 329, 321, 267, 203, 84, -31, -168, -391, -600, -792, -947, -1077, -1264, -1417, -1518, -1597, -1581, -1540, -1495, -1399, -1283, -1155, -1067, -993, -833, -699, -621, -559, -483, -361, -271, -141, 60, 218, 342, 496, 725, 932, 1035, 1140, 1232, 1260, 1245, 1159, 1062, 915, 720, 580, 470, 393, 276, 144, 142, 167, 198, 235, 260, 298, 252, 179, 148, 93, 26, -86, -151, -151, -173, -212, -299, -322, -266, -190, -110, -118, -128, -48, 68, 142, 91, -8, -33, 9, 84, 110, 67, 70, 145, 236, 310, 345, 355, 322, 264, 221, 170, 75, -31, -113, -124, -95, -5, 119, 219, 326, 426, 524, 589, 614, 607, 547, 439, 317, 211, 120, 54, 22, 6, 1, 35, 158, 294, 354, 334, 270, 252, 230, 160, 26, -162, -330, -480, -623, -786, -1006, -1198, -1372, -1485, -1537, -1572, -1613, -1667, -1659, -1570, -1437, -1321, -1243, -1150, -998, -816, -637, -478, -327, -152, 39, 225, 380, 491, 597, 696, 785, 868, 914, 929, 935, 962, 979, 988, 974, 933, 906, 875, 839, 793, 733, 668, 618, 572, 494, 418, 337, 245, 160, 91, 46, 19, -37, -76, -102, -119, -143, -188, -248, -283, -315, -322, -347, -344, -347, -345, -321, -274, -211, -162, -99, 16, 150, 282, 367, 422, 455, 482, 521, 523, 487, 417, 340, 296, 280, 249, 219, 201, 210, 270, 346, 394, 405, 407, 375, 353, 297, 194, 37, -96, -206, -288, -377, -454, -469, -471, -484, -429, -386, -334, -256, -169, -143, -123, -95, -57, -36, -48, -74, -88, -65, -43, -31, 1, 39, 47, 88, 166, 168, 155, 165, 190, 201, 157, 105, 97, 115, 118, 100, 101, 90, 99, 108, 131, 162, 155, 98, 71, 47, 42, 25, -49, -123, -157, -188, -151, -163, -269, -345, -329, -269, -232, -334, -454, -478, -454, -287, -90, 205, 171, -536, -53, 737, 621, 783, 835, 289, 283, 1194, 1355, 366, -162, 897, 2168, 2200, 574, -1287, -1566, -1012, -869, -1880, -3419, -3749, -2891, -1790, -1478, -2470, -2883, -1997, -440, 685, 922, 438, -49, 764, 2438, 3138, 2204, 1060, 772, 1187, 1663, 1844, 541, -978, -1251, -416, 165, -300, -987, -1224, -996, -3, 643, 453, -380, -524, 636, 1492, 1274, 416, 91, 728, 1281, 1593, 1225, 618, 283, 650, 1528, 1758, 1179, 459, 739, 1489, 1508, 1063, 825, 737, 340, -158, -374, -818, -1711, -2520, -3209, -4258, -6270, -8220, -8324, -6950, -4521, -3022, -2864, -2948, -1872, 1727, 4546, 5125, 4250, 3970, 4411, 4629, 4930, 4011, 1569, -1057, -2274, -1925, -2250, -3725, -4998, -5242, -4494, -3257, -1898, -1001, -389, 612, 2291, 4291, 5321, 4975, 4294, 4103, 4190, 3608, 2236, 516, -1272, -2384, -2694, -2810, -3358, -4153, -4134, -3280, -2139, -1086, -229, 366, 1061, 2405, 3854, 4383, 4005, 3696, 3653, 3520, 3046, 2156, 1204, 306, -468, -708, -677, -865, -1089, -959, -399, 404, 1067, 1465, 1674, 1999, 2371, 2417, 2246, 1901, 1417, 897, 345, 8, -472, -1257, -1691, -1761, -1760, -1658, -1643, -1662, -1583, -1230, -927, -934, -1092, -1222, -1050, -911, -948, -590, -230, -182, -281, -203, 14, 75, 98, 236, 370, 284, 157, 144, 298, 343, 82, 42, 305, 576, 742, 846, 1020, 1231, 1323, 1367, 1383, 1139, 714, 284, -160, -742, -1215, -1819, -2782, -3632, -3903, -4166, -4989, -5992, -5954, -5124, -4833, -4087, -1750, 621, 1214, 1699, 3019, 4034, 3954, 3233, 2629, 1704, 613, 43, -340, -1083, -2151, -2664, -2392, -1989, -1931, -1610, -660, 330, 930, 1764, 2899, 3664, 3828, 4002, 4242, 3966, 3067, 2321, 1639, 798, -91, -711, -898, -1154, -1420, -1181, -523, -102, 222, 833, 1667, 2073, 2272, 2659, 2853, 2703, 2320, 1954, 1663, 1262, 626, -149, -504, -521, -745, -1205, -1247, -1061, -1083, -964, -698, -362, -99, -245, -55, 459, 330, -290, -376, -247, -608, -893, -1058, -1310, -1324, -1028, -867, -888, -927, -794, -427, 34, 48, -31, 140, 447, 629, 498, 377, 603, 394, 8, 217, 481, 416, 134, 194, 408, 547, 417, 273, 166, 55, -37, 30, 90, 96, -88, -269, -373, -630, -951, -1455, -1811, -1907, -2141, -2523, -2643, -2741, -2736, -2873, -3029, -3046, -2950, -2835, -2296, -1405, -861, -504, 377, 1025, 1232, 1548, 1764, 1529, 1176, 1053, 896, 1016, 1120, 830, 640, 645, 871, 1172, 1518, 1550, 1560, 2007, 2377, 2855, 3111, 2678, 2290, 2352, 2393, 1743, 1069, 563, 50, 3, 60, 45, -291, -630, -603, -518, -503, -741, -1169, -1431, -1245, -1056, -1303, -1575, -1698, -1656, -1495, -1390, -1502, -1845, -2047, -1740, -1167, -1030, -1211, -770, -287, 106, 673, 1083, 1173, 1323, 1674, 1683, 1592, 1499, 1529, 1668, 1560, 1173, 901, 933, 879, 920, 1143, 1263, 1189, 997, 996, 1233, 1394, 1257, 898, 529, 272, 181, 114, -150, -351, -572, -840, -956, -1005, -1169, -1379, -1674, -1977, -2107, -2004, -1990, -2183, -2268, -2035, -1576, -1320, -1171, -974, -814, -600, -262, -35, -247, -316, 29, 282, 194, 139, 224, 414, 629, 904, 1003, 1171, 1172, 1276, 1754, 1865, 1469, 1250, 1362, 1539, 1408, 1182, 972, 802, 753, 902, 983, 722, 472, 387, 264, 44, -197, -401, -417, -559, -900, -1127, -1203, -1238, -1334, -1405, -1535, -1699, -1694, -1583, -1536, -1640, -1648, -1437, -1235, -1252, -1217, -914, -707, -634, -582, -332, -93, 9, 161, 474, 850, 996, 933, 997, 1139, 1080, 969, 1045, 1186, 1084, 1003, 1062, 1147, 1136, 1147, 1272, 1379, 1284, 1041, 905, 965, 1000, 857, 560, 248, 72, -50, -149, -246, -323, -481, -669, -837, -901, -949, -1067, -1173, -1151, -1113, -1202, -1254, -1183, -1093, -1139, -1287, -1317, -1196, -1007, -828, -725, -591, -425, -189, 106, 407, 541, 499, 519, 649, 678, 728, 757, 637, 502, 547, 684, 711, 726, 837, 930, 921, 856, 890, 921, 830, 720, 657, 520, 355, 242, 189, 132, -20, -244, -443, -552, -589, -606, -588, -622, -715, -803, -729, -592, -538, -638, -720, -664, -573, -505, -435, -363, -396, -445, -334, -193, -83, -93, -201, -226, -100, 65, 202, 259, 252, 202, 302, 473, 574, 562, 514, 525, 617, 621, 576, 563, 506, 400, 287, 215, 151, 143, 147, 115, 71, 40, 31, 70, 30, -46, -116, -193, -215, -184, -117, -94, -154, -245, -320, -347, -362, -381, -413, -444, -416, -338, -241, -152, -129, -125, -101, -60, -21, 16, 33, 44, 84, 156, 208, 211, 149, 94, 86, 90, 43, -23, -41, 12, 89, 123, 133, 133, 93, 72, 77, 115, 115, 74, 8, -6, -18, -59, -85, -107, -174, -186, -158, -117, -100, -104, -125, -105, -55, -43, -97, -122, -126, -99, -53, -14, -31, -82, -96, -88, -54, -8, -1, -37, -71, -47, -19, -4, 11, 38, 53, 41, 37, 53, 57, 88, 112, 122, 100, 75, 66, 87, 88, 109, 91, 76, 79, 108, 136, 136, 126, 81, 13, -2, -1, -18, -28, -7, 0, 6, 15, 10, 15, 52, 53, 34, 33, 22, 18, 6, -17, -50, -72, -82, -102, -110, -99, -87, -64, -27, -6, 8, 26, 33, 44, 54, 50, 65, 80, 71, 52, 59, 64, 79, 68, 44, 24, 14, 17, 45, 63, 65, 73, 83, 81, 95, 92, 84, 68, 60, 38, 28, 8, 8, 17, 7, -14, -30, -42, -55, -62, -83, -95, -93, -83, -76, -57, -52, -40, -15, 11, 40, 74, 100, 128, 141, 127, 109, 87, 49, 7, -12, -16, -11, -24, -28, -26, -22, -12, -13, -24, -28, -30, -25, -10, 14, 44, 70, 82, 79, 71, 64, 52, 33, 13, -5, -8, -7, -8, -18, -13, -20, -21, -29, -30, -30, -33, -22, -21, -17, -19, -22, -25, -25, -22, -6, 5, 16, 7, -7, -32, -50, -64, -67, -83, -102, -115, -113, -107, -90, -70, -53, -37, -15, 6, 25, 33, 31, 36, 31, 24, 4, -19, -48, -79, -102, -112, -116, -99, -81, -52, -14, 35, 80, 114, 135, 145, 145, 134, 132, 115, 97, 75, 53, 36, 12, -5, -17, -29, -29, -19, -10, -4, 7, 9, 0, -14, -35, -53, -72, -102, -131, -146, -154, -166, -166, -172, -174, -182, -190, -190, -176, -158, -142, -114, -77, -43, -8, 7, 13, 18, 19, 16, 10, 8, 5, 4, 10, 10, 15, 13, 14, 2, -6, -9, -2, 10, 19, 33, 51, 72, 90, 109, 115, 110, 98, 90, 68, 42, 6, -25, -57, -79, -98, -108, -109, -109, -96, -86, -73, -56, -48, -39, -31, -18, -5, 2, 7, 10, 13, 14, 21, 31, 33, 27, 22, 13, 16, 20, 15, 19, 28, 38, 54, 73, 90, 110, 126, 147, 154, 159, 167, 170, 165, 156, 146, 129, 120, 98, 78, 72, 68, 67, 56, 46, 43, 37, 33, 31, 17, 1, -16, -35, -43, -57, -70, -79, -80, -75, -69, -70, -72, -62, -53, -42, -41, -33, -37, -37, -31, -19, -18, -15, -15, -8, 2, 7, 13, 18, 40, 50, 74, 90, 105, 118, 126, 130, 128, 119, 107, 98, 81, 68, 59, 54, 33, 26, 22, 16, 20, 16, 19, 23, 21, 16, 20, 17, 15, 2, 0, 1, 0, 4, -1, -5, -12, -22, -37, -46, -52, -61, -76, -79, -75, -67, -64, -54, -47, -44, -35, -26, -18, -9, -1, 18, 30, 40, 45, 53, 55, 48, 41, 29, 30, 26, 32, 21, 14, -2, -15, -33, -48, -63, -73, -77, -67, -58, -48, -32, -25, -6, 1, 5, 2, -2, -20, -39, -66, -91, -115, -138, -152, -165, -171, -181, -180, -175, -157, -142, -122, -105, -76, -49, -31, -13, -4, -2, -5, -7, -15, -24, -41, -56, -70, -77, -74, -76, -70, -64, -41, -22, -3, 14, 44, 62, 73, 70, 81, 78, 68, 52, 38, 29, 15, 6, -13, -27, -34, -43, -43, -34, -29, -24, -22, -17, -9, -10, -13, -16, -14, -15, -15, -28, -46, -60, -79, -98, -101, -109, -108, -102, -84, -72, -47, -26, -3, 11, 29, 39, 51, 59, 66, 61, 60, 62, 55, 42, 29, 19, 10, 0, -8, -10, -10, -9, -7, -2, 5, 11, 17, 22, 28, 30, 30, 26, 23, 18, 13, 5, 1, -5, -11, -16, -18, -19, -19, -20, -17, -15, -11, -10, -7, -4, 0, 2, 4, 5, 6, 6, 5, 4, 3, 1, -1, -2, -2, -2, -2, -2, -2, -1, 0, 1, 2, 3, 3, 3, 3, 3, 3, 2, 1, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr int16_t wave_bard_pcm[wave_bard_length] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 2, 2, 2, 1, 0, 0, -1, 0, -1, -1, -1, -2, -3, -2, -2, -2, -3, -2, -1, 0, 0, 1, 2, 2, 1, 2, 1, 1, 3, 3, 6, 7, 9, 10, 12, 15, 21, 21, 26, 28, 30, 31, 32, 37, 40, 40, 39, 39, 37, 39, 40, 41, 34, 34, 28, 26, 32, 31, 34, 40, 33, 30, 36, 35, 41, 40, 33, 23, 12, 11, 7, 3, -2, 0, 1, -3, -1, -4, -3, -2, -3, -2, -6, -4, -7, -7, -5, -4, -7, -11, -15, -18, -21, -22, -23, -23, -26, -26, -26, -28, -22, -18, -12, -14, -10, -8, -7, -5, -1, 0, 0, 7, 8, 5, -1, 0, -1, -1, -3, -3, -1, -6, -6, -8, -8, -14, -15, -18, -20, -12, -16, -16, -12, -10, -12, -12, -11, -9, -9, -5, -11, -10, -11, -7, -12, -8, -13, -10, -11, -11, -12, -11, -11, -12, -15, -10, -5, -6, -8, -5, -2, 0, 0, 2, 5, 13, 13, 13, 10, 13, 10, 10, 13, 14, 13, 11, 7, 5, 1, 2, -1, 0, -6, -8, -11, -10, -12, -11, -12, -16, -20, -10, -14, -4, -1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 3, 2, 4, 3, 0, 7, 9, 16, 16, 20, 20, 29, 32, 33, 41, 43, 45, 53, 47, 46, 45, 54, 54, 54, 45, 42, 37, 35, 34, 36, 31, 29, 29, 32, 34, 26, 32, 36, 45, 51, 54, 68, 76, 91, 105, 130, 145, 167, 181, 188, 199, 204, 208, 213, 206, 195, 189, 172, 147, 127, 106, 84, 56, 29, 7, -14, -38, -57, -77, -103, -118, -142, -157, -170, -181, -188, -201, -207, -206, -194, -192, -179, -172, -158, -156, -148, -135, -123, -116, -115, -104, -97, -91, -86, -71, -65, -61, -58, -58, -46, -53, -61, -74, -99, -125, -147, -184, -221, -254, -281, -310, -327, -364, -379, -399, -410, -414, -421, -432, -443, -460, -468, -459, -457, -466, -440, -403, -343, -256, -178, -46, 100, 176, 324, 470, 557, 650, 732, 817, 927, 981, 1060, 1143, 1173, 1288, 1439, 1534, 1612, 1625, 1645, 1674, 1619, 1572, 1498, 1333, 1174, 1015, 784, 581, 351, 53, -276, -690, -1248, -1893, -2619, -3224, -3740, -4293, -4751, -4970, -4735, -4239, -3876, -3482, -3061, -2758, -2465, -2173, -1774, -1397, -1177, -918, -641, -455, -236, 52, 437, 879, 1270, 1686, 2188, 2566, 2923, 3330, 3637, 3918, 4179, 4473, 4722, 4752, 4649, 4473, 4145, 3754, 3356, 3006, 2661, 2316, 1932, 1516, 1034, 502, -73, -743, -1497, -2223, -2907, -3506, -4043, -4544, -4911, -4960, -4673, -4333, -4131, -3973, -3875, -3752, -3609, -3444, -3126, -2786, -2402, -1958, -1548, -1109, -633, -137, 434, 1027, 1501, 1993, 2503, 2959, 3418, 3820, 4166, 4480, 4712, 4955, 5169, 5238, 5228, 5111, 4843, 4519, 4102, 3700, 3356, 2987, 2582, 2141, 1656, 1140, 592, -29, -681, -1423, -2199, -2903, -3552, -4180, -4787, -5293, -5508, -5369, -5241, -5213, -5145, -5110, -5009, -4816, -4539, -4095, -3579, -3053, -2477, -1948, -1436, -947, -436, 160, 712, 1168, 1704, 2249, 2806, 3333, 3791, 4243, 4572, 4845, 5137, 5277, 5323, 5354, 5288, 5169, 4970, 4607, 4259, 3937, 3546, 3148, 2705, 2176, 1625, 945, 278, -373, -1074, -1844, -2614, -3306, -3925, -4555, -5202, -5715, -5910, -5906, -5938, -5935, -5804, -5640, -5424, -5179, -4775, -4279, -3712, -3107, -2527, -1995, -1512, -1023, -441, 152, 678, 1176, 1724, 2285, 2866, 3423, 3927, 4344, 4678, 4972, 5221, 5400, 5504, 5537, 5436, 5284, 5073, 4797, 4468, 4146, 3794, 3365, 2859, 2318, 1719, 1112, 482, -152, -882, -1667, -2427, -3097, -3730, -4336, -4938, -5520, -5906, -6019, -6079, -6148, -6113, -6028, -5826, -5540, -5191, -4687, -4177, -3642, -3076, -2496, -1944, -1442, -920, -328, 204, 689, 1229, 1825, 2439, 3020, 3617, 4175, 4641, 5068, 5446, 5731, 5949, 6062, 6083, 6038, 5915, 5675, 5311, 4921, 4577, 4133, 3600, 3063, 2495, 1823, 1116, 418, -292, -1007, -1797, -2577, -3273, -3883, -4441, -5033, -5588, -5949, -6100, -6244, -6378, -6421, -6410, -6249, -5945, -5568, -5100, -4555, -3943, -3325, -2698, -2051, -1483, -917, -310, 240, 739, 1286, 1895, 2504, 3138, 3732, 4297, 4816, 5268, 5652, 5959, 6175, 6302, 6368, 6353, 6172, 5912, 5581, 5247, 4855, 4380, 3865, 3322, 2707, 2062, 1383, 684, -89, -870, -1637, -2399, -3130, -3751, -4300, -4881, -5500, -6013, -6284, -6436, -6592, -6714, -6729, -6631, -6377, -6033, -5599, -5053, -4468, -3851, -3187, -2470, -1795, -1228, -629, -39, 481, 998, 1573, 2194, 2818, 3422, 4036, 4565, 5050, 5508, 5908, 6230, 6426, 6501, 6545, 6487, 6290, 5999, 5607, 5182, 4783, 4332, 3800, 3215, 2565, 1908, 1260, 531, -279, -990, -1746, -2530, -3276, -3901, -4463, -5017, -5564, -6075, -6392, -6567, -6757, -6877, -6881, -6791, -6541, -6164, -5685, -5141, -4605, -4016, -3359, -2668, -2013, -1423, -830, -188, 382, 896, 1487, 2108, 2735, 3327, 3908, 4482, 5008, 5466, 5868, 6193, 6428, 6578, 6621, 6566, 6398, 6143, 5821, 5422, 4998, 4506, 3997, 3469, 2857, 2219, 1549, 876, 161, -582, -1281, -1960, -2664, -3334, -3956, -4492, -5045, -5609, -6092, -6409, -6595, -6754, -6888, -6886, -6728, -6432, -6050, -5553, -4990, -4410, -3822, -3167, -2441, -1770, -1224, -646, -31, 522, 1013, 1594, 2244, 2844, 3382, 3958, 4525, 5017, 5440, 5795, 6071, 6289, 6405, 6441, 6389, 6242, 6021, 5701, 5326, 4912, 4427, 3926, 3381, 2798, 2198, 1581, 949, 262, -427, -1078, -1732, -2388, -3023, -3591, -4127, -4699, -5204, -5663, -6013, -6224, -6458, -6648, -6680, -6607, -6393, -6088, -5678, -5206, -4683, -4092, -3460, -2819, -2176, -1551, -945, -331, 205, 706, 1263, 1866, 2454, 2975, 3519, 4025, 4543, 5019, 5384, 5637, 5897, 6109, 6235, 6218, 6115, 5927, 5635, 5288, 4880, 4460, 3979, 3461, 2916, 2405, 1887, 1310, 699, 35, -594, -1210, -1757, -2364, -2991, -3517, -4020, -4539, -5029, -5544, -5812, -5971, -6134, -6258, -6273, -6126, -5886, -5567, -5138, -4681, -4258, -3763, -3170, -2524, -1891, -1398, -928, -311, 256, 747, 1225, 1747, 2304, 2784, 3275, 3734, 4187, 4562, 4899, 5234, 5467, 5575, 5665, 5722, 5648, 5421, 5070, 4762, 4413, 3971, 3520, 3057, 2604, 2154, 1697, 1144, 613, 99, -421, -972, -1585, -2136, -2657, -3209, -3727, -4254, -4712, -5118, -5385, -5554, -5707, -5762, -5763, -5657, -5444, -5117, -4769, -4390, -3965, -3538, -3039, -2504, -1986, -1390, -789, -273, 126, 598, 1212, 1744, 2194, 2640, 3167, 3636, 4083, 4413, 4774, 5055, 5340, 5461, 5473, 5468, 5353, 5146, 4906, 4559, 4191, 3893, 3421, 2993, 2533, 2040, 1494, 887, 365, -135, -637, -1279, -1838, -2487, -3117, -3591, -4060, -4576, -5082, -5422, -5636, -5706, -5809, -5843, -5697, -5469, -5101, -4691, -4301, -3807, -3223, -2845, -2424, -1877, -1333, -853, -400, 120, 603, 935, 1389, 1896, 2435, 2868, 3216, 3741, 4159, 4417, 4662, 4804, 4884, 4951, 4926, 4932, 4741, 4564, 4261, 3886, 3479, 3226, 2763, 2339, 1885, 1392, 949, 376, -139, -747, -1466, -2066, -2740, -3262, -3736, -4254, -4667, -5118, -5370, -5406, -5506, -5524, -5362, -5042, -4617, -4142, -3664, -3094, -2459, -2133, -1756, -1268, -861, -407, 96, 795, 1297, 1699, 2146, 2643, 3239, 3538, 3912, 4334, 4516, 4606, 4666, 4679, 4765, 4626, 4489, 4294, 3876, 3462, 3335, 2976, 2423, 2190, 2033, 1829, 933, 26, -934, -1757, -2435, -3155, -3791, -4610, -5203, -5560, -5757, -5799, -5778, -5559, -5137, -4576, -4076, -3556, -2768, -2134, -1655, -1117, -779, -173, 95, 345, 911, 1563, 2367, 3018, 3511, 3717, 4014, 4316, 4416, 4315, 4140, 4004, 3886, 3724, 3608, 3763, 3553, 3410, 3299, 3015, 2707, 2451, 2024, 1406, 905, 41, -909, -2028, -3015, -3786, -4810, -5762, -6709, -7187, -7789, -8055, -7743, -7541, -6558, -5536, -4490, -3028, -1772, -509, 370, 1127, 1736, 2261, 2698, 2969, 3628, 4264, 5084, 5393, 5474, 5804, 5285, 4916, 4513, 3689, 3014, 2186, 1722, 1708, 1652, 1666, 1791, 2033, 1945, 1572, 1340, 830, 63, -858, -1868, -2547, -3338, -4343, -5262, -6255, -7682, -8632, -9150, -9676, -8879, -7822, -6452, -4382, -3019, -1499, -6, 894, 2072, 3283, 4043, 5251, 6542, 7506, 8810, 9482, 9324, 8886, 7574, 5895, 4324, 2686, 1747, 1055, 757, 715, 126, -223, -799, -1361, -1541, -1695, -1770, -1410, -990, -1383, -2070, -3481, -5272, -7199, -10032, -11434, -11237, -10746, -8900, -6333, -4045, -2080, -692, 431, 1620, 2493, 4092, 6916, 9333, 11249, 12623, 13008, 12418, 10380, 8070, 6576, 4867, 3327, 2645, 1837, 428, -1159, -2703, -3873, -4605, -4750, -3495, -1791, -789, -478, -1146, -2602, -5084, -8201, -11000, -11538, -10047, -8854, -6897, -5096, -3998, -3274, -3165, -1434, 1247, 3857, 6728, 9839, 11756, 11588, 10212, 8623, 7487, 5930, 5650, 6450, 5905, 4509, 2479, -81, -2656, -3782, -3371, -2262, -1306, -1078, -668, -1013, -2927, -4797, -5596, -6341, -8066, -10597, -10787, -9206, -9809, -9293, -6659, -3934, -1496, 198, 2988, 5936, 7324, 8604, 10299, 10862, 10467, 9777, 8400, 6981, 5298, 4341, 3948, 2189, 236, -672, -955, -1770, -1884, -670, -592, -1039, -795, -225, -889, -2644, -3079, -4520, -7321, -11269, -16324, -14779, -10514, -9414, -6378, -3155, -1767, -1602, -127, 4705, 9299, 11776, 12958, 12661, 9752, 6754, 5730, 6213, 6219, 5202, 4501, 1801, -1619, -3183, -2375, 390, 1810, 1903, 1834, 870, -539, -9, 2093, 1987, 291, -2712, -7832, -12992, -18465, -17712, -11104, -9339, -7427, -4639, -4413, -3007, -50, 6913, 13643, 15038, 13350, 10372, 7390, 5038, 5532, 7628, 6449, 2145, -1780, -3739, -4069, -2045, 1361, 2952, 2473, 1008, 152, 569, 1474, 3666, 4579, 1270, -3532, -8041, -11481, -13413, -17633, -17832, -10951, -9236, -9451, -6118, -2316, 3061, 7269, 11476, 16305, 15555, 11006, 9124, 8457, 6802, 5154, 3659, 1441, -2472, -4560, -3365, -1235, 537, 1614, 1890, 1555, 2447, 3717, 4936, 5338, 3749, 1445, -2184, -5805, -8944, -11723, -16239, -22552, -19097, -11931, -11096, -7306, -2440, 1576, 6678, 9531, 13800, 17244, 14507, 10357, 8215, 5651, 2714, 1354, 558, -2251, -4914, -4587, -2273, 440, 1681, 2842, 4463, 5477, 5801, 6184, 7007, 5085, 1998, -750, -4720, -8300, -11177, -16867, -24040, -21356, -12355, -8945, -6427, -2118, 3136, 8722, 11607, 15439, 19192, 15879, 9172, 6168, 4107, 843, -877, -2182, -4963, -7445, -6062, -1629, 1823, 3276, 3676, 5105, 7093, 7245, 7757, 7878, 4157, -116, -3199, -6986, -10669, -14768, -22645, -26983, -18634, -9611, -6735, -3692, 293, 6783, 12648, 16098, 19590, 18815, 11762, 4749, 3210, 3378, 955, -2800, -5061, -6617, -6914, -2375, 3183, 5554, 5396, 5728, 8401, 9583, 8476, 7842, 5159, 19, -4590, -7907, -11035, -15862, -21987, -27864, -23097, -10327, -6117, -4746, 245, 6673, 13144, 16498, 18095, 17456, 10678, 1618, 14, 962, -2216, -5330, -7051, -7106, -5591, -587, 5886, 8539, 8196, 8407, 10807, 10692, 8675, 7682, 4492, -1239, -6779, -9457, -12627, -17955, -23378, -26885, -18343, -5777, -3161, -1231, 3903, 10822, 16815, 18611, 18235, 13014, 4228, -1664, -2694, -2245, -4127, -7706, -7963, -5843, -3176, 2872, 7611, 8648, 8728, 9416, 10799, 9928, 6693, 3975, 1409, -4173, -9356, -12656, -15904, -18683, -25693, -25362, -10002, -957, -777, 1281, 6991, 15545, 18545, 17801, 15432, 7303, -1143, -4229, -2921, -3647, -7459, -8824, -6698, -2491, 3722, 8862, 11316, 12455, 13188, 13703, 11063, 6481, 2905, -534, -5790, -10608, -12736, -16372, -19298, -23068, -23153, -9482, 50, 67, 1745, 6838, 15153, 17989, 16173, 12240, 3220, -4230, -5669, -5442, -7156, -9390, -8856, -5324, -1703, 4208, 10617, 13427, 14067, 13584, 13774, 12191, 7388, 2766, -1043, -6141, -9871, -12691, -18407, -21004, -24789, -22627, -6545, 940, 1049, 3528, 9442, 19194, 20731, 15939, 10725, 3453, -3289, -5438, -5926, -7685, -9958, -9475, -3077, 1270, 5084, 10301, 11566, 13602, 15269, 13358, 10149, 4956, 933, -1879, -8852, -13671, -16782, -21352, -24350, -24448, -12191, 77, -256, 703, 7849, 16745, 20101, 16325, 12227, 6416, -1668, -5575, -7085, -8496, -10377, -9445, -2855, -335, 2455, 8924, 12196, 13361, 12911, 12860, 10839, 6002, 2306, -2195, -7294, -10463, -13856, -17612, -23911, -24032, -7871, 450, -1419, 2279, 8790, 17459, 18047, 13862, 12014, 4836, -2242, -2663, -4634, -10553, -12071, -8288, -3642, -1726, 2031, 7740, 10039, 11405, 9944, 8305, 7976, 3772, 597, -2782, -8356, -10278, -12654, -19267, -22782, -13698, -1654, -516, -1403, 4483, 13897, 17882, 13999, 11277, 8815, 2469, -1182, -3017, -6308, -7939, -6806, -4407, -2228, 3122, 7609, 8093, 9662, 9419, 8513, 6809, 2159, -1231, -4710, -7560, -10950, -15151, -18340, -21565, -13956, -1927, -219, -983, 2698, 11564, 17384, 15650, 11824, 6789, 2487, 57, -1911, -4549, -8278, -7928, -2429, 312, 3005, 7235, 8212, 9228, 10221, 8764, 5673, 2295, -1371, -5642, -9589, -12078, -13315, -18275, -23003, -15123, -3251, -288, -519, 3708, 12962, 17291, 14932, 12310, 7692, 2613, 476, -1561, -5729, -7621, -5257, -2201, -961, 2702, 9067, 11542, 10417, 8935, 8582, 6735, 1606, -3416, -7785, -12309, -14274, -17173, -23859, -19876, -5865, -843, -1636, 2240, 10962, 16997, 15436, 12321, 8790, 3398, -1322, -3243, -4295, -8396, -8095, -2967, -681, 3029, 6127, 9036, 12168, 11344, 9745, 7355, 4269, -558, -7428, -12188, -13629, -17710, -24801, -20648, -7291, -896, 270, 3918, 11205, 16423, 15584, 14321, 12313, 4719, -446, -1307, -5247, -8568, -6979, -3256, -1199, 1325, 4574, 7391, 9595, 9290, 8618, 6291, 2315, -1745, -6582, -10113, -14123, -18829, -22205, -17302, -6406, -3023, -1893, 2575, 11570, 17098, 12559, 11825, 11079, 4377, 1453, -23, -4550, -6647, -3480, 111, 991, 3008, 6848, 8350, 7372, 6507, 7063, 4868, -1308, -5408, -8130, -10799, -15350, -21040, -17488, -8365, -4116, -2960, 875, 7682, 12313, 12057, 10936, 9596, 5536, 2645, 49, -4126, -5070, -1953, 378, 645, 1952, 5321, 8103, 7563, 6652, 5375, 1475, -2065, -5374, -9126, -12091, -16366, -18085, -12567, -6442, -2388, 1313, 3975, 7978, 10988, 11018, 9952, 5754, 2647, 1891, -2600, -5696, -3290, 392, 1457, 532, 3632, 7650, 8010, 7915, 6672, 3408, -596, -3843, -6917, -10860, -14737, -17254, -14230, -7751, -3659, -1529, 2796, 9106, 10802, 10075, 9927, 8218, 5150, 1011, -2355, -3871, -3243, -1652, -942, 118, 1793, 4093, 6813, 6357, 3926, 1656, 12, -3197, -8500, -11816, -14382, -12953, -7374, -4679, -4843, -1096, 6018, 9214, 8919, 8005, 8878, 8346, 5609, 3524, 242, -853, -327, -205, -126, 270, 1871, 3307, 3452, 1542, 428, -782, -3146, -6020, -10464, -12116, -12635, -9946, -4217, -3867, -2233, 2695, 8022, 8497, 5835, 7632, 7834, 5834, 2301, 805, 453, -693, 1186, 2096, 2102, 2467, 3722, 4254, 3626, 2188, -1299, -3802, -6141, -8345, -10151, -13442, -11899, -5433, -4281, -3139, 814, 4221, 6982, 6432, 7160, 7344, 5885, 4661, 2184, 575, -135, 938, 1653, 1520, 2757, 3351, 3893, 2980, 1174, 384, -2010, -5718, -8224, -8988, -11285, -9708, -3726, -4064, -4127, 754, 5103, 5942, 3760, 5401, 7920, 5434, 2142, 1607, 1324, 979, 1193, 898, 1348, 1588, 2711, 3858, 1248, -843, -1460, -3047, -6377, -10132, -9951, -8463, -5707, -3366, -3772, -645, 4158, 6235, 5359, 5040, 6637, 6642, 4401, 1245, 1346, 2119, 1205, 1334, 1132, 1948, 4177, 3197, 583, 307, -1180, -3062, -5914, -10525, -10453, -10362, -9142, -4312, -4655, -3046, 2254, 5419, 7660, 5455, 5429, 8334, 6498, 3790, 1825, 1846, 2161, 1825, 2056, 1151, 2283, 3181, 2806, 1367, -1575, -3012, -4738, -7776, -10953, -12170, -10353, -5119, -3949, -5676, -1251, 3826, 7550, 6589, 4176, 7665, 8123, 4551, 3511, 2375, 1491, 2417, 1845, 1303, 1516, 2529, 3374, 1402, -519, -1020, -2694, -6705, -9238, -10618, -9847, -5235, -5726, -6068, -2312, 1057, 4681, 4223, 4542, 6627, 6711, 6295, 3957, 2973, 3015, 2469, 1972, 574, 910, 2866, 2062, -1007, -1315, -363, -1493, -6116, -10153, -8834, -7573, -4889, -4093, -6163, -2650, 2427, 5768, 4191, 3000, 6960, 7429, 5170, 3664, 2840, 3288, 2355, 1131, 1755, 1574, 1516, 1360, 331, -222, -1354, -3615, -5886, -8244, -10523, -8651, -4943, -5549, -6856, -3574, 2269, 4800, 4158, 5506, 8039, 7321, 5294, 5894, 4893, 2130, 1701, 1383, 1485, 1591, 247, 82, -18, -549, -938, -4003, -7624, -7935, -7644, -6526, -5136, -6514, -4662, -885, 1556, 3046, 3656, 6489, 6885, 5247, 5382, 5523, 4806, 2808, 2045, 2400, 1822, 1441, 450, -1093, -1030, -1035, -2849, -6124, -8064, -8265, -7623, -5773, -5760, -4991, -2414, 699, 3241, 3316, 5380, 8206, 6567, 4826, 6271, 5240, 3340, 2398, 1745, 2229, 1048, 439, 401, -1866, -3576, -2419, -4102, -7986, -8753, -8987, -4956, -4166, -7497, -2997, 660, 2258, 2894, 3616, 7956, 8092, 5426, 6599, 6778, 3871, 3509, 3047, 2005, 528, 104, 752, -1383, -3334, -3419, -3434, -6981, -8886, -8407, -6149, -4395, -6941, -4367, -538, 1736, 2389, 2752, 6812, 7756, 5939, 6021, 6608, 5112, 4556, 3984, 2628, 1698, 1017, 387, -662, -2281, -3113, -3229, -7559, -8603, -8588, -8452, -4860, -6637, -5869, -2030, 1147, 2819, 2661, 5465, 7846, 7361, 5812, 7108, 6587, 4541, 3998, 2764, 1670, 738, 389, -1110, -2260, -2435, -2975, -5772, -8231, -8044, -6476, -4989, -6780, -5803, -2637, 444, 1978, 1365, 4475, 6990, 6464, 6095, 6472, 6205, 5497, 4562, 2697, 2068, 1217, 189, -263, -2570, -3188, -3387, -6325, -7591, -7954, -6364, -4836, -7098, -5025, -1016, 1128, 1405, 1645, 5814, 6876, 5607, 6198, 6388, 5747, 4838, 4095, 3351, 1321, 69, 374, -1122, -2812, -3203, -4960, -7059, -7189, -7316, -6393, -5890, -5898, -2833, -869, 1310, 2236, 3523, 6885, 6817, 6138, 6159, 7255, 5673, 3214, 3272, 2688, 1205, -886, -1201, -2065, -3538, -4073, -6312, -7252, -7897, -7428, -4906, -5790, -4762, -1875, 404, 2847, 2701, 4648, 7615, 7175, 6038, 6761, 6352, 5106, 4045, 2269, 2478, 788, -1234, -1124, -2683, -4464, -5398, -7131, -7831, -8683, -8873, -4883, -5328, -5350, -1430, 1534, 4247, 3057, 5512, 8996, 7496, 6931, 6705, 6586, 5180, 2703, 2523, 1467, -145, -1055, -2114, -3302, -4527, -5602, -7596, -8111, -7692, -6110, -5688, -6010, -2653, 116, 2098, 2787, 4466, 7968, 7878, 6685, 7011, 7290, 5633, 3388, 2207, 2282, 342, -1887, -1534, -2621, -3805, -5349, -7406, -6946, -7315, -6894, -5577, -6250, -2953, -496, 866, 2853, 3489, 7500, 7958, 6419, 7385, 7428, 6612, 4206, 2915, 2666, 929, -1162, -1555, -2455, -4459, -4969, -6333, -7601, -7978, -7482, -5198, -5568, -5206, -1422, 1167, 2455, 3200, 5729, 8270, 7687, 7036, 7587, 7160, 5306, 3928, 2474, 1360, -118, -2140, -2848, -4791, -5489, -6601, -8792, -8305, -7856, -5633, -5601, -5414, -1322, 1244, 3154, 3256, 5674, 8866, 7867, 7351, 7682, 7477, 5736, 3660, 2796, 1661, -395, -2109, -3040, -4414, -5873, -7344, -8729, -8960, -8616, -6981, -5631, -5504, -2626, 1273, 3427, 3704, 5987, 9369, 9038, 7907, 7963, 8436, 6290, 3853, 2928, 1641, -245, -2197, -3590, -5247, -5926, -7427, -9077, -9556, -8935, -6279, -6132, -5650, -2025, 1219, 3392, 3566, 6463, 9941, 8807, 8229, 8761, 8234, 6181, 3909, 3007, 1409, -1129, -2654, -3739, -5796, -6739, -7612, -9131, -9373, -8628, -6139, -5515, -5422, -1312, 2415, 3305, 3878, 7132, 10081, 9051, 7701, 8429, 8029, 5636, 3822, 2379, 376, -1778, -2896, -4639, -6445, -7268, -8463, -8985, -9170, -7697, -5803, -5521, -2979, 457, 2589, 4232, 5802, 8688, 9573, 8576, 8907, 7873, 6521, 4827, 2995, 1179, -1134, -2149, -3984, -5887, -7028, -7732, -8886, -9415, -8650, -6851, -5517, -4778, -1520, 1612, 3794, 4935, 7248, 10002, 9667, 8638, 8490, 8027, 5777, 3194, 1452, -70, -1860, -3936, -5888, -6748, -7276, -8665, -9358, -8996, -6999, -5464, -5022, -2531, 848, 3753, 4723, 6425, 9714, 10763, 9213, 8326, 8577, 6784, 4058, 1594, -107, -1854, -3727, -5488, -7433, -8061, -8333, -9026, -9461, -7835, -5012, -4530, -3764, 116, 3656, 4951, 5455, 8253, 10858, 9778, 8753, 8299, 7133, 4989, 2470, 346, -1890, -3302, -4979, -6845, -7679, -8399, -8952, -9234, -8239, -5528, -5020, -4129, -377, 2711, 4692, 5285, 7996, 10458, 9832, 9292, 8715, 7336, 5081, 3457, 998, -1773, -3222, -4646, -6454, -8234, -8611, -8867, -9569, -8594, -5975, -4833, -4471, -1016, 2761, 4236, 5190, 7655, 10229, 9933, 9021, 9168, 7822, 5417, 3775, 1669, -820, -3090, -4752, -6419, -7711, -8572, -9386, -9448, -9048, -6566, -5083, -4767, -1585, 1722, 4236, 5154, 6942, 9951, 10159, 9383, 8888, 8159, 6238, 3977, 1741, -709, -2760, -4261, -6002, -7580, -8668, -9488, -8666, -8813, -7491, -5324, -4344, -1420, 859, 3718, 5604, 6925, 9104, 9647, 9549, 8841, 8096, 6237, 4136, 2224, -120, -2369, -4234, -5941, -7297, -8461, -9445, -9174, -9409, -7816, -5284, -4668, -2600, 522, 3865, 5415, 6326, 8898, 10089, 10100, 9091, 8147, 6819, 4629, 2807, 97, -2287, -3837, -5647, -7006, -8204, -9176, -8942, -8987, -8080, -5768, -4809, -2804, -97, 2535, 4929, 6187, 8309, 9047, 9455, 9571, 8368, 6670, 4583, 3443, 1097, -1727, -3512, -4887, -6376, -7692, -8581, -8907, -8891, -8325, -5824, -4532, -3490, -753, 2010, 4492, 5467, 7244, 8828, 8907, 8864, 8260, 6980, 4764, 3342, 1650, -656, -2947, -4509, -5763, -6913, -7357, -8162, -8347, -7937, -5704, -4160, -3651, -1465, 962, 3214, 4565, 6060, 7579, 7757, 7740, 7810, 6600, 4855, 3336, 1638, -177, -1986, -3119, -4533, -5755, -5779, -5942, -6404, -6789, -5671, -3716, -3150, -2187, -677, 1131, 2794, 3662, 5380, 5919, 5661, 5937, 5548, 4439, 2984, 1824, 733, -774, -1986, -2560, -3401, -3927, -3946, -3795, -3817, -3666, -2631, -1949, -1526, -908, -22, 731, 993, 1924, 2786, 2638, 2623, 2897, 2450, 1813, 1342, 1094, 624, -277, -288, -316, -671, -863, -914, -957, -1221, -1117, -859, -877, -1089, -857, -478, -617, -745, -272, 153, 142, 302, 300, 469, 527, 388, 577, 614, 758, 995, 944, 1052, 1268, 1222, 961, 559, 403, 292, -216, -690, -846, -1042, -1389, -1664, -1501, -1201, -940, -811, -556, 1, 290, 718, 1091, 1230, 1391, 1575, 1655, 1601, 1392, 1174, 1051, 605, 213, -168, -565, -786, -1130, -1382, -1597, -1704, -1631, -1441, -1251, -917, -591, -341, 163, 618, 941, 1089, 1372, 1627, 1539, 1593, 1386, 1148, 846, 457, 187, -369, -684, -856, -1079, -1226, -1297, -1352, -1203, -1069, -776, -435, -460, -86, 218, 553, 755, 752, 1119, 1162, 1243, 1216, 930, 904, 635, 396, 111, -302, -505, -741, -941, -1004, -1183, -1103, -986, -966, -650, -594, -323, -17, 119, 477, 466, 658, 815, 802, 1007, 814, 732, 614, 389, 342, 37, -196, -331, -567, -600, -712, -857, -849, -912, -723, -712, -762, -508, -378, -53, 80, 137, 368, 477, 782, 764, 721, 764, 636, 524, 400, 210, 61, -211, -423, -505, -672, -673, -782, -780, -743, -775, -633, -604, -430, -250, -171, 15, 124, 401, 519, 618, 727, 752, 804, 740, 589, 422, 260, 4, -163, -423, -573, -763, -865, -841, -895, -854, -809, -665, -469, -332, -82, 35, 197, 386, 520, 691, 761, 813, 808, 769, 708, 571, 306, 170, -25, -246, -510, -701, -716, -808, -891, -866, -759, -623, -518, -377, -113, 64, 249, 387, 534, 668, 731, 779, 766, 661, 621, 485, 318, 136, -55, -184, -422, -604, -702, -757, -801, -820, -750, -589, -506, -342, -156, 31, 241, 383, 536, 646, 733, 776, 734, 674, 595, 454, 339, 147, -26, -200, -364, -482, -573, -613, -655, -678, -567, -490, -416, -276, -115, 68, 198, 341, 461, 576, 677, 709, 704, 672, 581, 481, 315, 140, -19, -181, -322, -481, -592, -640, -651, -633, -556, -462, -355, -247, -99, 65, 223, 377, 492, 544, 611, 664, 663, 594, 513, 446, 308, 143, -28, -184, -332, -460, -572, -672, -696, -671, -605, -539, -389, -232, -109, 55, 219, 367, 475, 547, 600, 606, 593, 557, 474, 407, 323, 208, 55, -58, -138, -241, -371, -436, -441, -494, -518, -521, -426, -357, -302, -186, -58, 64, 156, 244, 344, 384, 396, 406, 392, 342, 287, 241, 186, 128, 90, 64, -3, -52, -88, -113, -155, -208, -221, -261, -293, -278, -269, -234, -196, -142, -68, -14, 59, 124, 180, 240, 290, 297, 308, 323, 318, 283, 245, 213, 161, 58, -31, -99, -170, -230, -267, -291, -313, -295, -254, -204, -164, -98, -16, 47, 94, 144, 180, 189, 213, 225, 231, 230, 212, 176, 139, 88, 18, -65, -134, -193, -246, -295, -302, -282, -254, -206, -160, -94, -22, 39, 103, 159, 212, 232, 239, 253, 257, 241, 193, 142, 91, 23, -49, -130, -198, -244, -270, -302, -300, -261, -222, -177, -111, -25, 46, 122, 203, 259, 290, 304, 317, 299, 250, 206, 157, 87, -8, -100, -177, -248, -308, -346, -355, -344, -307, -237, -160, -75, 16, 98, 181, 246, 305, 364, 401, 401, 374, 339, 299, 222, 108, -5, -106, -216, -342, -442, -505, -557, -583, -568, -510, -426, -308, -177, -14, 151, 299, 441, 551, 646, 702, 695, 647, 559, 453, 327, 188, 32, -111, -259, -397, -506, -606, -671, -700, -682, -603, -496, -372, -226, -83, 61, 177, 272, 355, 427, 490, 525, 549, 547, 510, 435, 336, 229, 110, -18, -137, -259, -357, -440, -499, -530, -514, -467, -384, -280, -173, -61, 33, 106, 176, 231, 275, 298, 308, 320, 318, 295, 249, 207, 164, 110, 63, 24, -18, -42, -60, -64, -52, -35, -5, 21, 61, 99, 104, 94, 101, 84, 52, -1, -47, -90, -124, -144, -148, -144, -136, -117, -81, -53, -28, -5, 29, 77, 129, 184, 240, 307, 355, 370, 358, 326, 279, 212, 118, 19, -59, -136, -221, -288, -340, -372, -393, -396, -383, -369, -328, -285, -231, -165, -92, 3, 94, 180, 251, 294, 313, 306, 292, 261, 217, 163, 104, 37, -24, -86, -136, -192, -250, -292, -311, -327, -342, -332, -314, -288, -249, -208, -150, -92, -35, 25, 58, 81, 98, 98, 106, 111, 109, 102, 85, 80, 81, 80, 75, 58, 45, 26, 6, -17, -31, -41, -50, -62, -58, -54, -53, -51, -52, -65, -75, -84, -86, -94, -97, -99, -70, -41, -16, 10, 39, 74, 104, 117, 133, 147, 163, 171, 171, 181, 194, 180, 167, 149, 108, 57, 12, -17, -66, -114, -128, -136, -139, -140, -126, -106, -93, -93, -68, -66, -77, -85, -81, -70, -60, -30, 5, 23, 55, 81, 101, 95, 86, 93, 102, 93, 83, 100, 123, 121, 120, 121, 119, 100, 72, 51, 27, 4, -24, -50, -56, -77, -69, -72, -68, -67, -67, -64, -56, -56, -57, -34, -3, 23, 41, 72, 119, 144, 162, 182, 190, 176, 165, 149, 128, 92, 64, 49, 31, 1, -18, -28, -45, -68, -68, -68, -77, -76, -47, -34, -22, -12, 19, 43, 60, 75, 90, 96, 93, 79, 74, 70, 75, 72, 68, 72, 76, 73, 58, 53, 54, 29, 12, 14, 17, 9, 2, 19, 35, 32, 36, 46, 44, 15, -4, -12, -24, -48, -54, -47, -46, -62, -57, -51, -56, -67, -69, -63, -53, -41, -16, -5, 10, 46, 59, 54, 67, 70, 55, 32, 26, 17, -3, -16, -19, -20, -21, -36, -36, -37, -49, -57, -47, -51, -55, -51, -42, -50, -45, -33, -30, -33, -36, -37, -44, -72, -77, -87, -94, -92, -87, -66, -43, -29, -8, 8, 27, 39, 65, 85, 111, 141, 171, 191, 197, 185, 181, 162, 131, 86, 54, 18, -11, -65, -105, -120, -138, -155, -168, -167, -170, -171, -151, -121, -101, -74, -34, 8, 46, 66, 102, 141, 153, 166, 187, 184, 163, 147, 151, 126, 91, 77, 77, 47, 9, -2, -9, -33, -60, -55, -50, -58, -61, -39, -26, -35, -35, -32, -35, -75, -89, -94, -94, -104, -106, -92, -71, -64, -49, -13, 19, 39, 61, 89, 132, 153, 159, 180, 202, 211, 189, 162, 141, 105, 56, 4, -40, -94, -143, -180, -204, -220, -225, -217, -212, -198, -182, -155, -119, -82, -28, 15, 59, 105, 150, 174, 193, 194, 193, 166, 139, 103, 68, 24, -4, -42, -61, -80, -112, -128, -132, -127, -130, -129, -106, -89, -73, -57, -20, 10, 29, 44, 60, 67, 65, 48, 36, 7, -7, -26, -45, -40, -40, -44, -46, -46, -28, -10, -4, 18, 64, 88, 114, 135, 162, 178, 173, 168, 157, 132, 98, 58, 11, -46, -83, -130, -163, -195, -221, -232, -237, -241, -230, -210, -190, -142, -92, -56, -12, 37, 89, 118, 146, 176, 201, 195, 178, 168, 141, 95, 57, 26, 1, -38, -63, -83, -101, -124, -131, -135, -124, -124, -105, -77, -55, -38, -18, 2, 31, 55, 74, 78, 71, 41, 25, 17, 16, 17, 20, 21, 18, -2, -15, -20, -17, -21, -9, -1, 0, 2, 13, 15, 13, 10, 9, -2, -13, -30, -55, -87, -101, -114, -119, -115, -101, -103, -100, -95, -91, -86, -76, -69, -48, -35, -26, -11, 2, -2, 2, 8, 12, 8, 15, 19, 8, -13, -8, -15, -29, -23, -9, -5, 9, 19, 29, 25, 18, 15, 18, 6, 5, 16, 20, 2, -6, -4, -8, -30, -31, -26, -35, -47, -44, -39, -27, -32, -19, -10, -10, -17, -17, -15, -11, -6, 0, -26, -26, -18, -25, -17, -3, 0, 14, 17, 26, 42, 46, 37, 43, 34, 19, 6, -3, -14, -5, -20, -16, -20, -33, -20, -23, -32, -3, 7, 34, 37, 48, 59, 62, 85, 105, 124, 141, 135, 112, 93, 87, 85, 70, 39, 12, -13, -31, -62, -84, -108, -111, -121, -120, -90, -58, -60, -71, -83, -94, -85, -62, -68, -47, -19, -12, -11, -37, -75, -76, -66, -67, -4, 90, 121, 236, 388, 451, 593, 794, 989, 1372, 1816, 2524, 3644, 4867, 4951, 4391, 4147, 3583, 3396, 3201, 2632, 2287, 1217, -18, -705, -1443, -1713, -1416, -1840, -2304, -2344, -2293, -1967, -1708, -1359, -815, -609, -319, -325, -540, -454, -733, -1151, -860, -819, -1529, -1455, -1602, -1783, -1401, -1295, -990, -611, -778, -766, -558, -921, -1401, -1268, -1509, -2017, -2441, -2511, -2354, -2706, -2898, -2195, -2141, -2470, -1973, -1570, -1592, -1160, -619, -439, -7, 15, 92, 265, 193, 62, 326, 428, 648, 700, 362, -216, -1111, -1909, -2273, -2391, -2517, -2501, -2893, -3789, -5179, -7026, -8635, -9734, -8911, -6464, -3731, -419, 2476, 3814, 4039, 4318, 4778, 4838, 4726, 4543, 3248, 1680, 827, 431, 912, 2114, 3214, 4341, 4530, 3165, 2082, 11, -2794, -4719, -6554, -9203, -12235, -16503, -19588, -14525, -8282, -2122, 9225, 16398, 16419, 15303, 11687, 7420, 3475, -966, -503, 455, -2093, -2374, -1052, -2183, -279, 4592, 8768, 11526, 12217, 12570, 9962, 4233, 1158, -1948, -6249, -7731, -8477, -12912, -18558, -23751, -21046, -10185, -1908, 11176, 24108, 25316, 21842, 16022, 8962, 2422, -4049, -5319, -3752, -5112, -5646, -2966, -2239, -1258, 4748, 11548, 15707, 15922, 14852, 11863, 4528, -1008, -4103, -7281, -8907, -9929, -12615, -17688, -25015, -28990, -16696, -215, 12598, 26804, 31706, 28551, 19404, 6341, -3727, -10244, -13947, -10789, -6531, -8704, -7215, -2944, -333, 6628, 15393, 22504, 24233, 18688, 12581, 4953, -3727, -8578, -9436, -10259, -11050, -12228, -17132, -24977, -30620, -20852, 749, 15620, 27520, 32543, 28783, 17640, 1839, -10012, -14708, -18462, -14497, -5251, -5873, -4366, 1415, 3211, 9634, 17713, 21327, 23560, 16881, 8254, 708, -8723, -11380, -9985, -9510, -7198, -5974, -12285, -20972, -27980, -23109, -2296, 12372, 23232, 31491, 27305, 15504, 1829, -9933, -15673, -19043, -15786, -5862, -4057, -3078, 3781, 6602, 10615, 17401, 19845, 19403, 12705, 4328, -1750, -9638, -10823, -7240, -6194, -4841, -5149, -11939, -21044, -28046, -25322, -6099, 10044, 20877, 30264, 27209, 15151, 1827, -9487, -15590, -17784, -14807, -6493, -3717, -1900, 4529, 7830, 10466, 16661, 19142, 16633, 9959, 1414, -4274, -9777, -9816, -5043, -3479, -2733, -3595, -10269, -19490, -26968, -25717, -7636, 9039, 18978, 28871, 26351, 14825, 2038, -9752, -15963, -16930, -14238, -6938, -2147, -769, 4947, 9165, 10984, 16065, 17918, 14212, 7397, 329, -4424, -8085, -6371, -2332, -1346, -1642, -5556, -13456, -22543, -29610, -26260, -5679, 11874, 21278, 30089, 27046, 13353, -396, -11082, -16711, -18296, -13744, -4888, -1094, 887, 8144, 11632, 11965, 15836, 15220, 10170, 4255, -1494, -5192, -6259, -2994, 480, 58, -2158, -7047, -14849, -23400, -28117, -19778, 241, 14430, 23407, 29126, 21577, 6903, -5366, -15125, -19279, -17532, -10537, -1717, 2142, 5361, 11911, 13342, 11959, 13827, 11333, 4965, -227, -3353, -4803, -3569, 216, 3360, 3055, -1326, -8090, -16729, -24579, -28207, -18247, 2687, 15592, 24454, 29644, 20337, 4400, -7930, -16974, -20729, -17309, -8426, 898, 4944, 9550, 13784, 11970, 12032, 11513, 6298, 2123, -1193, -3293, -3283, -1141, 2568, 4390, 2243, -3341, -11040, -19255, -26541, -27778, -11863, 9176, 19115, 28090, 30268, 15234, -2223, -13194, -21238, -22333, -15344, -2943, 6304, 8392, 13210, 14615, 9354, 10221, 9179, 2506, -11, -1609, -3803, -2664, 1177, 4816, 4451, 29, -5541, -13085, -22062, -27600, -20878, -1539, 12280, 21676, 29835, 23453, 5593, -9988, -18867, -22110, -18729, -8370, 4331, 9899, 11742, 13773, 9745, 5896, 6490, 3721, 60, 535, 273, -1451, 594, 4458, 4081, -30, -4507, -10886, -19642, -26042, -23705, -8505, 8331, 18768, 27925, 27246, 10831, -6569, -16831, -21969, -20529, -11417, 2923, 11085, 11551, 12935, 11005, 5672, 4053, 2944, 449, -408, -202, 35, 1268, 3623, 4521, 1792, -3742, -10245, -16900, -23075, -24052, -12253, 5306, 15757, 22818, 25824, 15186, -3365, -15200, -18681, -18706, -13488, -98, 11098, 11999, 12325, 12877, 6621, 1744, 1651, -181, -1686, 597, 2509, 2749, 4043, 4450, 1198, -5846, -12534, -17472, -22595, -22794, -9860, 7312, 15207, 21627, 24456, 12974, -3704, -13909, -18207, -18340, -11970, 1068, 11841, 14464, 14744, 13241, 5374, -462, -1421, -2202, -1809, 1872, 4988, 5862, 6834, 4798, -1285, -8840, -15271, -19189, -21284, -18752, -4618, 11243, 16972, 20550, 21196, 7950, -8553, -16063, -17580, -15467, -7704, 4556, 13065, 14492, 12825, 9332, 2871, -921, -1556, -743, 1827, 4814, 6292, 6890, 5305, 1106, -5545, -13234, -18452, -20175, -20379, -13787, 2473, 15303, 19905, 21818, 16064, -18, -13501, -17656, -16520, -11969, -1147, 10284, 14186, 13296, 10127, 4385, -878, -2767, -1033, 2087, 5167, 8815, 8947, 5842, 1446, -4729, -11932, -17116, -20364, -20916, -14903, -759, 11569, 17887, 21583, 16222, 2141, -8966, -14723, -16812, -12658, -3000, 7795, 12305, 11726, 10648, 5346, -1567, -1992, 381, 2389, 4907, 8064, 8785, 5310, 978, -2823, -9084, -15480, -18007, -19434, -16738, -4242, 8907, 15477, 20427, 18515, 5974, -7209, -14338, -17255, -15080, -5095, 6998, 12288, 13173, 11883, 5880, -1282, -3404, -1923, 358, 4323, 8553, 8684, 6059, 2655, -3101, -10894, -15314, -16825, -19065, -14106, 838, 11837, 16106, 19510, 14653, -32, -11199, -15015, -15438, -11286, -753, 10719, 13686, 11667, 9528, 3372, -2920, -4248, -2728, 1661, 5284, 6673, 7912, 6087, 573, -6427, -12658, -16031, -18596, -17039, -4522, 9211, 14837, 19221, 17885, 4094, -9606, -15249, -16955, -14093, -3897, 8884, 14893, 14244, 12002, 5449, -1898, -3750, -3549, -1336, 4230, 7811, 7153, 5300, 1741, -5625, -12978, -15981, -17711, -16627, -4322, 9491, 15164, 19205, 16897, 2573, -10154, -15293, -16454, -12281, -2131, 9234, 13872, 13004, 10772, 4036, -2454, -3212, -1906, 37, 4012, 7188, 6605, 4341, 1314, -3968, -10650, -14707, -16647, -15401, -4996, 7442, 13027, 16486, 14384, 3081, -7461, -12332, -13849, -9950, -976, 7318, 11205, 11150, 7925, 2204, -2755, -3662, -2179, 259, 3947, 6174, 5213, 3167, 43, -6127, -12051, -14747, -15205, -10192, 108, 8647, 14324, 15763, 8348, -1928, -7924, -11709, -11410, -4437, 4506, 9411, 9634, 8590, 4336, -1863, -4121, -2197, -533, 1055, 5063, 6360, 2888, -67, -3649, -9891, -14050, -15311, -13040, -3386, 7507, 13317, 16107, 13013, 2736, -6836, -11530, -11599, -6219, 1463, 8410, 11182, 10139, 6656, 456, -4008, -3587, -2214, -817, 3472, 6240, 3802, -100, -3892, -9498, -14529, -15029, -11432, -3375, 5515, 11703, 15945, 12333, 2159, -4535, -8746, -11110, -5783, 2663, 8085, 10514, 10216, 6452, 492, -3273, -2988, -1557, -260, 3000, 4669, 2216, -1031, -4890, -9984, -13567, -13755, -10720, -3035, 6112, 11821, 14264, 10775, 2088, -5205, -8884, -9397, -4345, 3996, 9012, 9793, 8846, 5800, -258, -3758, -2048, -620, 846, 4139, 4886, 2083, -2310, -6889, -10660, -13038, -13408, -9584, -739, 7187, 11865, 14201, 8970, -902, -6800, -9450, -8959, -2104, 6485, 10482, 10908, 8970, 3889, -2057, -4070, -2218, -183, 2782, 5844, 4525, -45, -4658, -8859, -12264, -13866, -11805, -4932, 3041, 8563, 12761, 11491, 2991, -4209, -7436, -9353, -5654, 3243, 8600, 9845, 9822, 6336, 438, -3017, -2194, -166, 2325, 5505, 5176, 1075, -3028, -7284, -11486, -13314, -12582, -8472, -253, 7145, 11044, 12097, 6399, -2696, -7564, -8928, -7387, -494, 7855, 10125, 8878, 7212, 2180, -2727, -2014, 856, 1939, 4151, 5180, 1510, -2780, -5626, -8547, -11042, -11396, -8131, -1999, 3459, 8675, 11737, 6663, -919, -4985, -7661, -7146, -1737, 5459, 9532, 8592, 6547, 3468, -1734, -3002, -174, 1455, 3342, 5028, 2458, -1908, -5457, -8805, -10765, -10587, -7332, -341, 5851, 9135, 10257, 5163, -2541, -6445, -8355, -6754, 344, 7661, 10109, 8717, 6151, 1192, -4003, -3203, 553, 1671, 3696, 4983, 697, -4216, -6127, -8485, -10632, -9343, -4546, 1549, 5805, 9336, 9901, 2935, -4089, -6121, -7605, -6752, 940, 8848, 8931, 7194, 7156, 1280, -5075, -2315, 1107, 852, 4193, 5738, -190, -5596, -8446, -10898, -11600, -9706, -2720, 5413, 8730, 11528, 10901, 1820, -6057, -7963, -7774, -4921, 2547, 10188, 9937, 6073, 4800, -274, -5950, -2550, 2030, 1699, 3807, 4643, -2138, -7812, -8613, -10127, -11417, -7686, 582, 6577, 8872, 11311, 8903, 394, -5457, -6604, -6581, -3131, 4483, 9064, 8010, 6051, 3207, -1795, -3747, -733, 1442, 1787, 2556, 332, -5594, -9010, -9429, -10353, -9360, -3042, 5134, 8781, 10166, 10315, 4010, -3772, -5818, -5771, -5268, 838, 8356, 8618, 6191, 4772, 166, -3933, -2281, 692, 1328, 2758, 2474, -2984, -7903, -9563, -11256, -11806, -7289, 1772, 8619, 10651, 11775, 8227, -1511, -6796, -5860, -6016, -2392, 7248, 10849, 6831, 5122, 2828, -3806, -5137, 40, 2085, 1606, 3179, 835, -6738, -10538, -10399, -11981, -11219, -2023, 8239, 10994, 11778, 11223, 2686, -6695, -8136, -6673, -4441, 3631, 11132, 10170, 6596, 4270, -1264, -6039, -3600, 409, 1444, 2254, 1687, -3254, -8411, -10289, -11405, -11501, -5820, 4370, 10205, 12117, 13007, 7102, -2890, -7837, -7946, -6185, -817, 7241, 11468, 9283, 5171, 1456, -3913, -6277, -2478, 795, 1786, 2905, 752, -6072, -10688, -11614, -12804, -10537, -250, 10194, 13054, 13147, 10975, 1972, -7261, -8340, -5667, -3027, 3733, 10942, 10890, 6211, 2150, -1956, -5796, -4969, -518, 2496, 2942, 1349, -3085, -8977, -12508, -13544, -11528, -3256, 7031, 11864, 12951, 10329, 1622, -6410, -8376, -6303, -1681, 5069, 10650, 11523, 8015, 2893, -1766, -4995, -4749, -1012, 2212, 3275, 2066, -2392, -8178, -11763, -13451, -13261, -6719, 5700, 13206, 13030, 11802, 6065, -6091, -12576, -9282, -5033, 316, 9309, 14382, 11544, 6157, 1900, -2426, -5354, -2829, 1354, 1963, 1727, 569, -5004, -10501, -11970, -12803, -11665, -2904, 8555, 13330, 13872, 11275, 2030, -8481, -11907, -9100, -3812, 3824, 11399, 13770, 8916, 2154, -1759, -4292, -4035, 890, 4391, 4299, 3581, -977, -8719, -12533, -13379, -14161, -10046, 1984, 12615, 14754, 13491, 8993, -1992, -11850, -12505, -8246, -2545, 6169, 14049, 14150, 7406, 1664, -2263, -6165, -5098, 1217, 5025, 4781, 3189, -1278, -7510, -11889, -14114, -14383, -9468, 2223, 12936, 15998, 14860, 9844, -1971, -12459, -13671, -9654, -3135, 5772, 12930, 14091, 8498, 1234, -2587, -4537, -4676, -85, 4303, 4474, 3240, -328, -7523, -12802, -14720, -16132, -10532, 4246, 15078, 16835, 16145, 9971, -3453, -12718, -12730, -8975, -2768, 5642, 11529, 12011, 7454, 1728, -2252, -5405, -4876, -57, 2985, 4002, 4990, 2105, -5415, -11857, -14571, -15332, -11762, 199, 13271, 17134, 15013, 10690, 372, -11173, -13141, -8638, -3780, 3497, 10496, 11272, 6536, 1319, -1785, -3148, -3243, -1025, 2851, 4786, 3848, 1908, -1821, -8589, -14270, -16275, -14216, -4743, 8808, 16833, 17491, 14088, 4641, -8566, -14653, -11725, -6144, 167, 7494, 11629, 9263, 3722, -405, -1490, -1750, -1333, 809, 2835, 3430, 3700, 2500, -2601, -8786, -13354, -17365, -17571, -7073, 10391, 20431, 20294, 16073, 6158, -8994, -18002, -15177, -8048, -639, 6899, 10914, 9697, 5331, 1058, -1339, -1569, -669, 681, 2041, 2472, 2814, 3401, 1689, -3106, -8108, -12820, -16345, -15618, -8597, 4872, 17888, 22231, 19305, 11142, -2957, -15469, -18586, -15299, -7478, 3280, 9248, 10085, 10273, 7021, 704, -2008, -847, -9, -121, 205, 432, 469, 1990, 2819, 855, -2500, -7147, -12205, -14001, -13601, -9586, 3841, 17963, 20437, 17335, 11738, -2111, -15641, -18496, -14219, -6298, 2960, 7465, 8830, 10184, 7475, 1179, -973, 1571, 1524, -1457, -1551, -21, 254, 1538, 3356, 2021, -1068, -6106, -12855, -14793, -12494, -8867, 1397, 16279, 21598, 16287, 9220, -1163, -13520, -19217, -15439, -6644, 2463, 7497, 7805, 8483, 8577, 5287, 2078, 1108, -218, -3430, -4785, -1917, 3088, 5988, 6394, 5660, 1584, -5019, -10716, -13052, -12211, -10118, -6967, 1123, 13520, 19227, 14436, 6933, -482, -9270, -16353, -15728, -7828, 1086, 5250, 6288, 8684, 9005, 4707, 587, -439, -258, -1182, -1684, 642, 4966, 7594, 6879, 4026, 820, -2618, -9013, -13750, -11208, -6520, -4949, -4712, -2569, 5266, 15997, 16480, 8551, 3705, -3281, -15223, -20178, -13398, -2913, 4205, 5906, 6820, 10481, 9811, 2785, -502, 1963, 134, -4628, -3041, 747, 2034, 4940, 7106, 3806, 1246, -384, -4241, -5101, -3423, -3555, -4083, -5030, -8099, -10411, -7542, 3033, 14775, 16822, 12030, 5200, -4453, -12923, -15981, -12658, -4156, 3131, 4701, 6827, 9864, 7277, 2407, 1458, 2289, -206, -3447, -3006, -112, 2548, 3781, 3785, 2321, 411, -2834, -5047, -1763, 1111, -100, 409, 1914, -2046, -9154, -14234, -14463, -5837, 8265, 16500, 15112, 11688, 5859, -5416, -13863, -14000, -8833, -3265, -351, 2984, 7758, 8233, 4819, 3626, 4367, 4268, 1125, -4289, -5754, -2308, -286, 1389, 4748, 5125, 3031, -491, -3948, -3989, -1567, 875, 2558, 3048, 1655, -2647, -8242, -12902, -15689, -10108, 4518, 14579, 15833, 14551, 8296, -4888, -14409, -14937, -10712, -3391, 2051, 3403, 5903, 7503, 5490, 4156, 4376, 4276, 1509, -4094, -6384, -3146, 776, 3512, 4615, 3786, 2981, 311, -3273, -3620, -920, 2730, 4375, 3013, 402, -1809, -5890, -11487, -14554, -15315, -11165, 2409, 16971, 19292, 15477, 11281, 461, -11346, -16143, -14806, -8012, 585, 1209, -197, 5047, 8832, 9211, 9942, 8194, 1997, -5422, -10078, -9032, -3111, 3105, 7130, 8706, 8743, 5046, -596, -3699, -3976, -2951, -2608, -927, 1706, 2615, 806, -2493, -6293, -10332, -12480, -12912, -9436, 2789, 17353, 20468, 16484, 8969, -5307, -14076, -14982, -14052, -7620, 1311, 3926, 4953, 8542, 9289, 7453, 5189, 2688, -1358, -5752, -7396, -4786, 755, 4371, 5930, 5859, 5018, 2482, -1379, -3000, -2195, -166, 865, 2113, 3916, 3814, 1354, -1769, -6245, -12262, -14986, -16451, -16374, -5639, 13992, 24945, 22506, 16930, 6739, -5471, -13423, -18520, -16747, -8532, -6217, -6750, 828, 10560, 15690, 15632, 12156, 9010, 2782, -8200, -15115, -12353, -5263, 568, 4388, 6421, 8313, 9167, 5514, 297, 590, 3792, 3044, -286, -2389, -2061, -748, -1569, -3858, -6184, -8982, -10353, -11169, -11606, -2247, 15201, 21839, 16816, 9208, -1599, -9583, -14243, -17833, -12382, -3150, -1627, -122, 5823, 9977, 12017, 10425, 5579, 1666, -2430, -8943, -12944, -8034, 507, 6827, 9911, 9546, 7610, 4106, 744, -2047, -2781, -754, 1735, 2715, 1810, 1968, 3422, 3282, -363, -4984, -10077, -13328, -12121, -13466, -15865, -8568, 9830, 22738, 22951, 17282, 4387, -7802, -12557, -15821, -14343, -6391, -2474, -3220, -2006, 2177, 9546, 14285, 13795, 11011, 5382, -1842, -9166, -13759, -12862, -4678, 4193, 5915, 6986, 9276, 8450, 5946, 3497, 251, -2961, -2907, -458, 3038, 6587, 7168, 3923, 1483, 822, -3949, -10006, -12933, -13773, -14665, -16328, -15597, -4545, 17983, 29695, 23954, 13026, -210, -9370, -12745, -15130, -14342, -9249, -6849, -5723, -2942, 2751, 13501, 20066, 16938, 7989, -526, -6723, -10617, -9592, -5397, -808, 1159, 719, -74, 2712, 9695, 12949, 10997, 7364, 2538, -2063, -4147, -4722, -2713, 2470, 5317, 3877, 1332, -272, -1258, -2184, -3387, -5871, -9567, -14372, -19712, -20268, -8950, 12710, 27472, 24930, 14247, 3111, -4201, -7719, -11391, -13024, -10079, -7692, -8032, -7759, -3641, 6943, 16223, 17216, 13334, 7795, 608, -5942, -9529, -11664, -9328, -2797, 1458, 1718, 2582, 6184, 10515, 15396, 16030, 9080, 1467, -2765, -7221, -9242, -7164, -4022, 859, 5248, 5910, 3744, 2598, 3257, 2034, -1644, -5440, -9472, -13038, -15275, -19205, -19439, -6358, 13368, 23960, 23230, 15589, 4338, -2688, -6775, -12371, -15011, -12369, -9502, -8423, -6745, -1167, 9381, 19030, 21346, 14377, 4159, -2616, -6420, -9620, -10825, -8984, -5471, -951, 1490, 3770, 10075, 16245, 16544, 11633, 4369, -1989, -5376, -7228, -6039, -2197, 1499, 3958, 4136, 1953, 269, 508, 793, 1361, 622, -1827, -5224, -10264, -15434, -19626, -20243, -11632, 4978, 17045, 20081, 16303, 7330, -175, -4359, -8390, -11027, -10023, -8800, -7705, -5857, -2468, 5759, 14110, 15880, 10778, 2967, -3151, -5547, -5966, -5795, -3485, 42, 2501, 3413, 4205, 5389, 7718, 10583, 10160, 6169, 2033, -1523, -3725, -2190, 1177, 2824, 2870, 2216, -255, -2133, -2100, -2321, -2563, -5049, -10365, -15628, -17892, -12552, 1564, 15150, 18944, 14482, 6057, -429, -2268, -3223, -5420, -7525, -9302, -9656, -7350, -5278, -677, 7197, 12119, 12911, 10636, 5830, 1232, -814, -2320, -4282, -5167, -5048, -4527, -2933, -65, 3117, 5764, 6432, 4140, -630, -5497, -7076, -4865, -819, 3552, 5763, 5527, 4334, 3757, 5567, 6758, 5663, 2294, -3205, -7657, -8411, -7723, -7659, -6065, -4917, -4275, -2698, -1361, 1275, 6745, 11880, 11834, 6545, -1586, -6717, -7227, -6623, -5723, -5476, -5104, -2817, 562, 3209, 6531, 9658, 10022, 7347, 1850, -2919, -4649, -4838, -5328, -6515, -6857, -4592, -195, 4737, 8672, 11137, 12662, 12738, 10265, 5946, 1589, -2804, -5284, -6632, -8212, -8241, -8016, -7795, -7662, -7584, -6968, -4781, -675, 4533, 8394, 8492, 6769, 3577, 2267, 3072, 1637, -1628, -6312, -9783, -9519, -6639, -3791, -358, 2377, 3391, 4852, 4930, 5016, 5966, 6031, 3907, -10, -4011, -6759, -6105, -4604, -2975, -1426, -890, 535, 2316, 4129, 5728, 6827, 6477, 5123, 2650, -1029, -3319, -5313, -6168, -6103, -6113, -4070, -298, 4625, 9100, 11497, 12260, 12059, 10433, 7792, 3828, -964, -4429, -7238, -9154, -10273, -10959, -10995, -10611, -9848, -8348, -4461, 894, 6271, 9166, 8626, 7184, 5497, 5061, 3776, -174, -4320, -8192, -9989, -9005, -7318, -5004, -1842, 1269, 3796, 5478, 6581, 7615, 8633, 7421, 3895, -92, -4256, -5592, -5678, -6136, -5271, -4510, -2243, 963, 3271, 5958, 8036, 8532, 7822, 4954, 946, -1269, -2956, -4971, -6623, -8392, -8237, -5274, -2197, 1290, 5216, 8670, 13136, 14962, 13303, 10053, 4957, 1378, -1058, -4505, -8304, -11354, -12729, -11708, -9957, -9757, -9010, -6694, -2245, 4953, 9114, 9172, 8173, 5148, 4620, 5201, 2405, -1011, -5981, -10002, -9902, -8376, -6071, -2857, -656, 1409, 4137, 5540, 6906, 8535, 8213, 6506, 3721, -910, -4071, -5267, -6471, -5915, -5417, -4770, -2475, -456, 1890, 5135, 7514, 8164, 8072, 5982, 3204, 1625, -1245, -4530, -7211, -9083, -8292, -5699, -3046, -553, 2519, 6221, 10190, 13632, 13547, 10658, 7362, 3651, 1154, -1312, -5267, -8581, -10864, -11751, -10863, -10062, -9445, -7354, -3988, 289, 5058, 7509, 8157, 8313, 6912, 5709, 3716, 34, -3286, -6291, -8776, -9655, -9289, -8128, -4795, -1101, 1566, 4080, 5575, 7254, 9403, 9772, 7786, 4528, 461, -2595, -4001, -5571, -6650, -6963, -6298, -4217, -1636, 832, 3346, 6012, 7795, 8345, 7482, 5322, 2585, -40, -2412, -4904, -6303, -7043, -7308, -5838, -3729, -803, 2872, 6079, 8498, 10603, 11706, 10884, 9372, 5963, 2111, -767, -4683, -7768, -10151, -12364, -12510, -11268, -9866, -7621, -4625, -1539, 3132, 7334, 9158, 10291, 9333, 7560, 6601, 3575, -560, -4037, -8318, -10423, -9804, -9820, -7526, -4838, -3186, 889, 4179, 6504, 9323, 10033, 9050, 7705, 4581, 1061, -1022, -3630, -5553, -6321, -7589, -7167, -4900, -2174, 1072, 3670, 5073, 5930, 6357, 6085, 5043, 2966, 355, -2045, -4337, -5615, -5998, -6147, -5023, -3653, -1345, 2521, 6088, 9986, 11597, 10870, 9782, 7509, 5807, 3292, -997, -5777, -10486, -13441, -13575, -12299, -11509, -9485, -6818, -3138, 2815, 6846, 9544, 11153, 10559, 10015, 8235, 4780, 669, -3592, -7837, -10539, -11370, -11484, -9185, -6527, -4112, -393, 3174, 7050, 10670, 11664, 10286, 8344, 5583, 2966, 557, -3099, -6302, -8532, -9534, -8827, -7147, -4758, -1839, 1152, 3971, 6566, 8120, 8915, 8573, 6828, 4562, 1596, -1207, -3758, -5868, -7169, -7611, -6674, -5231, -3072, -802, 1317, 3550, 5480, 7477, 8339, 9428, 9846, 7603, 5333, 2916, 945, 607, -612, -3862, -6560, -8013, -8324, -6705, -6345, -7615, -7329, -5597, -2753, 1372, 3524, 3499, 4159, 4187, 5028, 5659, 3722, 1471, -1218, -3093, -3631, -4099, -4619, -4885, -4939, -4168, -2117, -306, 1865, 3596, 3983, 3964, 3742, 3385, 3134, 2816, 903, -1282, -2927, -3901, -3317, -3141, -3637, -3499, -2769, -1272, 1108, 2572, 2991, 3620, 3588, 3453, 3585, 2832, 1427, -142, -1724, -2919, -3191, -2762, -2647, -2123, -1397, -851, 1147, 2678, 3343, 3826, 3185, 2972, 2704, 2545, 1699, 729, 2331, 2696, 2748, 2912, 1877, 2844, 3908, 3526, 1252, -1571, -3979, -5559, -5980, -8555, -10466, -10354, -9169, -5030, -1510, 200, 2229, 3754, 6132, 8557, 8312, 6262, 3584, 1189, -708, -1949, -4476, -6741, -7014, -7986, -6810, -4605, -2994, 134, 2537, 3792, 5211, 6332, 6577, 6600, 4965, 2058, 134, -1941, -3314, -4201, -5949, -6433, -5636, -4509, -2115, 160, 1793, 3880, 4992, 5444, 5967, 5495, 4393, 2680, 495, -1826, -3539, -4092, -4532, -4460, -3944, -3141, -1573, 264, 2396, 3927, 5009, 5791, 4845, 4688, 4306, 2771, 3558, 2569, 461, -461, -1819, -759, 881, 687, -870, -2004, -2233, -1853, -1734, -4625, -7014, -7683, -6817, -3781, -2262, -2201, -1517, 160, 2961, 6071, 6604, 4910, 4022, 3113, 2543, 2052, -964, -3781, -4703, -5486, -4906, -4172, -4258, -3399, -1839, 169, 2110, 3458, 3851, 3666, 3455, 2995, 2466, 1469, -295, -2190, -3584, -4042, -3512, -2993, -2530, -2004, -1083, 862, 2580, 3869, 4272, 3937, 3810, 2929, 1965, 988, -515, -1707, -2562, -2826, -2579, -1960, -1444, -984, 201, 1514, 2846, 3606, 3441, 2787, 2359, 1784, 483, -438, -1479, -2112, -2654, -2749, -2424, -1668, 1962, 4257, 5334, 6221, 5893, 7482, 8452, 6848, 3034, -892, -3876, -6069, -7862, -11372, -13455, -13222, -11062, -6973, -3834, -1539, 1232, 5334, 9504, 11897, 11565, 8958, 6813, 4899, 2364, -1148, -5989, -9585, -10735, -10644, -9727, -8870, -7725, -4515, -276, 4095, 6903, 7630, 8483, 8847, 9236, 8571, 5662, 2051, -1789, -3969, -4899, -5978, -6913, -7931, -7560, -5127, -2017, 744, 2506, 3753, 5128, 6591, 7279, 6353, 4519, 2254, 445, -1052, -2703, -3929, -4786, -4676, -3777, -2368, -1141, 87, 1822, 3046, 4251, 4896, 4704, 4087, 3159, 1987, 235, -1197, -2696, -3833, -4239, -4850, -4568, -3295, -1385, 5, 876, 1803, 3003, 7221, 10237, 9220, 6538, 3535, 3876, 4786, 2994, -1348, -5418, -6112, -5967, -6103, -8396, -11403, -11238, -8109, -3588, -691, -315, -381, 2117, 6662, 9752, 9253, 5772, 2881, 2251, 2265, 520, -3263, -6947, -8383, -7253, -5751, -5241, -4978, -3560, -672, 2498, 4641, 5149, 5028, 5311, 5873, 5700, 4032, 1346, -1101, -2145, -2500, -3061, -4003, -5085, -5038, -3573, -1632, -227, 509, 1037, 2133, 3939, 4890, 4744, 3842, 2857, 2453, 1516, 252, -1329, -2363, -1950, -1956, -2026, -2256, -2245, -706, 825, 1911, 1921, 1520, 1958, 2425, 2776, 2061, 615, -220, -780, -1143, -1626, -2477, -2730, -2545, -2074, -1279, -1046, -548, -26, 376, 1420, 1273, 1389, 3071, 4400, 4924, 3973, 3567, 3959, 4145, 3982, 1395, -664, -1905, -3306, -4342, -6959, -9301, -10240, -9337, -7031, -4850, -3262, -2415, -252, 3439, 7114, 8748, 7801, 6000, 5051, 5198, 4096, 1018, -2925, -5525, -6362, -6858, -7496, -8406, -7431, -5125, -2524, 183, 1414, 3061, 5553, 7598, 8691, 7802, 5939, 4329, 3537, 2671, 147, -2828, -5259, -6150, -5700, -5796, -5590, -5088, -3560, -763, 1240, 2960, 4010, 4856, 6248, 6741, 6211, 4477, 2597, 1533, 397, -877, -2365, -4107, -4830, -4304, -3598, -2874, -2581, -2196, -766, 917, 1972, 2245, 2292, 2489, 3079, 3452, 2795, 1650, 620, 124, 18, -430, -1379, -2339, -2706, -2052, -1101, -988, -1112, -798, 75, 1446, 2117, 1899, 1502, 1280, 1822, 1981, 1279, 273, -665, 636, 2094, 1885, 1714, 1417, 2371, 3753, 3999, 2865, 877, 99, -702, -2047, -4373, -7177, -8472, -8904, -8293, -7362, -6410, -4938, -2984, -457, 1976, 4283, 6109, 7343, 7567, 7176, 6511, 4952, 3044, 446, -1764, -3338, -5164, -6760, -7931, -7712, -6539, -5253, -4031, -2662, -440, 2001, 4167, 5619, 6250, 6650, 6922, 6984, 6222, 4167, 1717, -125, -1365, -2618, -4366, -5991, -6852, -6547, -5342, -4504, -3729, -2522, -590, 1706, 3370, 4369, 4642, 5061, 5641, 5706, 5059, 3457, 1912, 820, -102, -1306, -2957, -4034, -4426, -4274, -3786, -3563, -2952, -1828, -449, 903, 1832, 2653, 3086, 3569, 4016, 3789, 3191, 2218, 1548, 1089, 245, -872, -2098, -2550, -2185, -1928, -2119, -2443, -2227, -1148, 103, 788, 1011, 1059, 1704, 2664, 2855, 2210, 1047, 564, 734, 1580, 2258, 676, -543, 379, 2459, 3269, 1682, 804, 1070, 2171, 2164, -401, -2870, -4090, -3731, -4138, -6149, -7779, -8311, -6566, -4397, -3673, -3658, -2659, 282, 2988, 4330, 4574, 4811, 5873, 6732, 6454, 4617, 2699, 1659, 890, -273, -2284, -4171, -5216, -5174, -4759, -4884, -4904, -4399, -2995, -1051, 424, 1415, 2141, 3274, 4713, 5372, 5085, 4237, 3641, 3419, 2727, 1410, -402, -1923, -2548, -2872, -3320, -4132, -4682, -4200, -3114, -2066, -1497, -942, 234, 1726, 2856, 3248, 3284, 3657, 4189, 4064, 3239, 2123, 1291, 754, -6, -1057, -2230, -2918, -3106, -3193, -3160, -3027, -2479, -1687, -1098, -356, 545, 1347, 2028, 2408, 2717, 2923, 2878, 2738, 2206, 1559, 987, 377, -170, -891, -1439, -1751, -2015, -2010, -1838, -1470, -1111, -892, -430, 168, 702, 1157, 1311, 1462, 1628, 1624, 1514, 998, 616, 376, -144, -657, -1096, -1125, -1235, -1505, -1053, -171, 415, 395, 639, 1690, 2545, 2753, 2650, 2722, 2873, 2470, 1713, 838, -315, -1710, -2989, -3595, -3685, -4046, -5051, -5795, -5260, -3761, -2563, -2540, -2659, -1591, 494, 2135, 2296, 1988, 2197, 3017, 3663, 3348, 2456, 1477, 1063, 1101, 835, 116, -862, -1478, -1431, -1139, -1034, -1371, -1858, -1756, -1066, -349, -199, -563, -621, -166, 493, 800, 562, 287, 280, 586, 842, 718, 443, 222, 224, 437, 488, 297, 49, 48, 363, 611, 612, 417, 321, 532, 748, 724, 482, 223, 130, 122, 56, -76, -266, -407, -420, -381, -327, -378, -388, -258, -67, 155, 285, 363, 417, 547, 699, 685, 569, 464, 454, 388, 245, 35, -152, -213, -267, -280, -384, -446, -360, -278, -162, -200, -220, -87, 75, 238, 242, 257, 339, 360, 400, 345, 240, 158, 62, 14, -68, -161, -211, -301, -350, -318, -271, -152, -71, 64, 231, 242, 267, 323, 545, 709, 563, 446, 462, 642, 755, 610, 461, 361, 329, 321, 267, 203, 84, -31, -168, -391, -600, -792, -947, -1077, -1264, -1417, -1518, -1597, -1581, -1540, -1495, -1399, -1283, -1155, -1067, -993, -833, -699, -621, -559, -483, -361, -271, -141, 60, 218, 342, 496, 725, 932, 1035, 1140, 1232, 1260, 1245, 1159, 1062, 915, 720, 580, 470, 393, 276, 144, 142, 167, 198, 235, 260, 298, 252, 179, 148, 93, 26, -86, -151, -151, -173, -212, -299, -322, -266, -190, -110, -118, -128, -48, 68, 142, 91, -8, -33, 9, 84, 110, 67, 70, 145, 236, 310, 345, 355, 322, 264, 221, 170, 75, -31, -113, -124, -95, -5, 119, 219, 326, 426, 524, 589, 614, 607, 547, 439, 317, 211, 120, 54, 22, 6, 1, 35, 158, 294, 354, 334, 270, 252, 230, 160, 26, -162, -330, -480, -623, -786, -1006, -1198, -1372, -1485, -1537, -1572, -1613, -1667, -1659, -1570, -1437, -1321, -1243, -1150, -998, -816, -637, -478, -327, -152, 39, 225, 380, 491, 597, 696, 785, 868, 914, 929, 935, 962, 979, 988, 974, 933, 906, 875, 839, 793, 733, 668, 618, 572, 494, 418, 337, 245, 160, 91, 46, 19, -37, -76, -102, -119, -143, -188, -248, -283, -315, -322, -347, -344, -347, -345, -321, -274, -211, -162, -99, 16, 150, 282, 367, 422, 455, 482, 521, 523, 487, 417, 340, 296, 280, 249, 219, 201, 210, 270, 346, 394, 405, 407, 375, 353, 297, 194, 37, -96, -206, -288, -377, -454, -469, -471, -484, -429, -386, -334, -256, -169, -143, -123, -95, -57, -36, -48, -74, -88, -65, -43, -31, 1, 39, 47, 88, 166, 168, 155, 165, 190, 201, 157, 105, 97, 115, 118, 100, 101, 90, 99, 108, 131, 162, 155, 98, 71, 47, 42, 25, -49, -123, -157, -188, -151, -163, -269, -345, -329, -269, -232, -334, -454, -478, -454, -287, -90, 205, 171, -536, -53, 737, 621, 783, 835, 289, 283, 1194, 1355, 366, -162, 897, 2168, 2200, 574, -1287, -1566, -1012, -869, -1880, -3419, -3749, -2891, -1790, -1478, -2470, -2883, -1997, -440, 685, 922, 438, -49, 764, 2438, 3138, 2204, 1060, 772, 1187, 1663, 1844, 541, -978, -1251, -416, 165, -300, -987, -1224, -996, -3, 643, 453, -380, -524, 636, 1492, 1274, 416, 91, 728, 1281, 1593, 1225, 618, 283, 650, 1528, 1758, 1179, 459, 739, 1489, 1508, 1063, 825, 737, 340, -158, -374, -818, -1711, -2520, -3209, -4258, -6270, -8220, -8324, -6950, -4521, -3022, -2864, -2948, -1872, 1727, 4546, 5125, 4250, 3970, 4411, 4629, 4930, 4011, 1569, -1057, -2274, -1925, -2250, -3725, -4998, -5242, -4494, -3257, -1898, -1001, -389, 612, 2291, 4291, 5321, 4975, 4294, 4103, 4190, 3608, 2236, 516, -1272, -2384, -2694, -2810, -3358, -4153, -4134, -3280, -2139, -1086, -229, 366, 1061, 2405, 3854, 4383, 4005, 3696, 3653, 3520, 3046, 2156, 1204, 306, -468, -708, -677, -865, -1089, -959, -399, 404, 1067, 1465, 1674, 1999, 2371, 2417, 2246, 1901, 1417, 897, 345, 8, -472, -1257, -1691, -1761, -1760, -1658, -1643, -1662, -1583, -1230, -927, -934, -1092, -1222, -1050, -911, -948, -590, -230, -182, -281, -203, 14, 75, 98, 236, 370, 284, 157, 144, 298, 343, 82, 42, 305, 576, 742, 846, 1020, 1231, 1323, 1367, 1383, 1139, 714, 284, -160, -742, -1215, -1819, -2782, -3632, -3903, -4166, -4989, -5992, -5954, -5124, -4833, -4087, -1750, 621, 1214, 1699, 3019, 4034, 3954, 3233, 2629, 1704, 613, 43, -340, -1083, -2151, -2664, -2392, -1989, -1931, -1610, -660, 330, 930, 1764, 2899, 3664, 3828, 4002, 4242, 3966, 3067, 2321, 1639, 798, -91, -711, -898, -1154, -1420, -1181, -523, -102, 222, 833, 1667, 2073, 2272, 2659, 2853, 2703, 2320, 1954, 1663, 1262, 626, -149, -504, -521, -745, -1205, -1247, -1061, -1083, -964, -698, -362, -99, -245, -55, 459, 330, -290, -376, -247, -608, -893, -1058, -1310, -1324, -1028, -867, -888, -927, -794, -427, 34, 48, -31, 140, 447, 629, 498, 377, 603, 394, 8, 217, 481, 416, 134, 194, 408, 547, 417, 273, 166, 55, -37, 30, 90, 96, -88, -269, -373, -630, -951, -1455, -1811, -1907, -2141, -2523, -2643, -2741, -2736, -2873, -3029, -3046, -2950, -2835, -2296, -1405, -861, -504, 377, 1025, 1232, 1548, 1764, 1529, 1176, 1053, 896, 1016, 1120, 830, 640, 645, 871, 1172, 1518, 1550, 1560, 2007, 2377, 2855, 3111, 2678, 2290, 2352, 2393, 1743, 1069, 563, 50, 3, 60, 45, -291, -630, -603, -518, -503, -741, -1169, -1431, -1245, -1056, -1303, -1575, -1698, -1656, -1495, -1390, -1502, -1845, -2047, -1740, -1167, -1030, -1211, -770, -287, 106, 673, 1083, 1173, 1323, 1674, 1683, 1592, 1499, 1529, 1668, 1560, 1173, 901, 933, 879, 920, 1143, 1263, 1189, 997, 996, 1233, 1394, 1257, 898, 529, 272, 181, 114, -150, -351, -572, -840, -956, -1005, -1169, -1379, -1674, -1977, -2107, -2004, -1990, -2183, -2268, -2035, -1576, -1320, -1171, -974, -814, -600, -262, -35, -247, -316, 29, 282, 194, 139, 224, 414, 629, 904, 1003, 1171, 1172, 1276, 1754, 1865, 1469, 1250, 1362, 1539, 1408, 1182, 972, 802, 753, 902, 983, 722, 472, 387, 264, 44, -197, -401, -417, -559, -900, -1127, -1203, -1238, -1334, -1405, -1535, -1699, -1694, -1583, -1536, -1640, -1648, -1437, -1235, -1252, -1217, -914, -707, -634, -582, -332, -93, 9, 161, 474, 850, 996, 933, 997, 1139, 1080, 969, 1045, 1186, 1084, 1003, 1062, 1147, 1136, 1147, 1272, 1379, 1284, 1041, 905, 965, 1000, 857, 560, 248, 72, -50, -149, -246, -323, -481, -669, -837, -901, -949, -1067, -1173, -1151, -1113, -1202, -1254, -1183, -1093, -1139, -1287, -1317, -1196, -1007, -828, -725, -591, -425, -189, 106, 407, 541, 499, 519, 649, 678, 728, 757, 637, 502, 547, 684, 711, 726, 837, 930, 921, 856, 890, 921, 830, 720, 657, 520, 355, 242, 189, 132, -20, -244, -443, -552, -589, -606, -588, -622, -715, -803, -729, -592, -538, -638, -720, -664, -573, -505, -435, -363, -396, -445, -334, -193, -83, -93, -201, -226, -100, 65, 202, 259, 252, 202, 302, 473, 574, 562, 514, 525, 617, 621, 576, 563, 506, 400, 287, 215, 151, 143, 147, 115, 71, 40, 31, 70, 30, -46, -116, -193, -215, -184, -117, -94, -154, -245, -320, -347, -362, -381, -413, -444, -416, -338, -241, -152, -129, -125, -101, -60, -21, 16, 33, 44, 84, 156, 208, 211, 149, 94, 86, 90, 43, -23, -41, 12, 89, 123, 133, 133, 93, 72, 77, 115, 115, 74, 8, -6, -18, -59, -85, -107, -174, -186, -158, -117, -100, -104, -125, -105, -55, -43, -97, -122, -126, -99, -53, -14, -31, -82, -96, -88, -54, -8, -1, -37, -71, -47, -19, -4, 11, 38, 53, 41, 37, 53, 57, 88, 112, 122, 100, 75, 66, 87, 88, 109, 91, 76, 79, 108, 136, 136, 126, 81, 13, -2, -1, -18, -28, -7, 0, 6, 15, 10, 15, 52, 53, 34, 33, 22, 18, 6, -17, -50, -72, -82, -102, -110, -99, -87, -64, -27, -6, 8, 26, 33, 44, 54, 50, 65, 80, 71, 52, 59, 64, 79, 68, 44, 24, 14, 17, 45, 63, 65, 73, 83, 81, 95, 92, 84, 68, 60, 38, 28, 8, 8, 17, 7, -14, -30, -42, -55, -62, -83, -95, -93, -83, -76, -57, -52, -40, -15, 11, 40, 74, 100, 128, 141, 127, 109, 87, 49, 7, -12, -16, -11, -24, -28, -26, -22, -12, -13, -24, -28, -30, -25, -10, 14, 44, 70, 82, 79, 71, 64, 52, 33, 13, -5, -8, -7, -8, -18, -13, -20, -21, -29, -30, -30, -33, -22, -21, -17, -19, -22, -25, -25, -22, -6, 5, 16, 7, -7, -32, -50, -64, -67, -83, -102, -115, -113, -107, -90, -70, -53, -37, -15, 6, 25, 33, 31, 36, 31, 24, 4, -19, -48, -79, -102, -112, -116, -99, -81, -52, -14, 35, 80, 114, 135, 145, 145, 134, 132, 115, 97, 75, 53, 36, 12, -5, -17, -29, -29, -19, -10, -4, 7, 9, 0, -14, -35, -53, -72, -102, -131, -146, -154, -166, -166, -172, -174, -182, -190, -190, -176, -158, -142, -114, -77, -43, -8, 7, 13, 18, 19, 16, 10, 8, 5, 4, 10, 10, 15, 13, 14, 2, -6, -9, -2, 10, 19, 33, 51, 72, 90, 109, 115, 110, 98, 90, 68, 42, 6, -25, -57, -79, -98, -108, -109, -109, -96, -86, -73, -56, -48, -39, -31, -18, -5, 2, 7, 10, 13, 14, 21, 31, 33, 27, 22, 13, 16, 20, 15, 19, 28, 38, 54, 73, 90, 110, 126, 147, 154, 159, 167, 170, 165, 156, 146, 129, 120, 98, 78, 72, 68, 67, 56, 46, 43, 37, 33, 31, 17, 1, -16, -35, -43, -57, -70, -79, -80, -75, -69, -70, -72, -62, -53, -42, -41, -33, -37, -37, -31, -19, -18, -15, -15, -8, 2, 7, 13, 18, 40, 50, 74, 90, 105, 118, 126, 130, 128, 119, 107, 98, 81, 68, 59, 54, 33, 26, 22, 16, 20, 16, 19, 23, 21, 16, 20, 17, 15, 2, 0, 1, 0, 4, -1, -5, -12, -22, -37, -46, -52, -61, -76, -79, -75, -67, -64, -54, -47, -44, -35, -26, -18, -9, -1, 18, 30, 40, 45, 53, 55, 48, 41, 29, 30, 26, 32, 21, 14, -2, -15, -33, -48, -63, -73, -77, -67, -58, -48, -32, -25, -6, 1, 5, 2, -2, -20, -39, -66, -91, -115, -138, -152, -165, -171, -181, -180, -175, -157, -142, -122, -105, -76, -49, -31, -13, -4, -2, -5, -7, -15, -24, -41, -56, -70, -77, -74, -76, -70, -64, -41, -22, -3, 14, 44, 62, 73, 70, 81, 78, 68, 52, 38, 29, 15, 6, -13, -27, -34, -43, -43, -34, -29, -24, -22, -17, -9, -10, -13, -16, -14, -15, -15, -28, -46, -60, -79, -98, -101, -109, -108, -102, -84, -72, -47, -26, -3, 11, 29, 39, 51, 59, 66, 61, 60, 62, 55, 42, 29, 19, 10, 0, -8, -10, -10, -9, -7, -2, 5, 11, 17, 22, 28, 30, 30, 26, 23, 18, 13, 5, 1, -5, -11, -16, -18, -19, -19, -20, -17, -15, -11, -10, -7, -4, 0, 2, 4, 5, 6, 6, 5, 4, 3, 1, -1, -2, -2, -2, -2, -2, -2, -1, 0, 1, 2, 3, 3, 3, 3, 3, 3, 2, 1, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+constexpr AdpcmEncoder::Encoded<wave_bard_length> wave_bard_data = AdpcmEncoder::Encode(wave_bard_pcm);
 
 static constexpr SamplePlayer16bit::Sample wave_bard = {
-    .data = wave_bard_data,
-    .length = wave_bard_length,
+    .data = wave_bard_data.data(),
+    .length = AdpcmEncoder::PaddedLength(wave_bard_length),
+    .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM,
 };
 
 }
@@ -23,8 +23,10 @@ SOFTWARE.
 */
 
 #include <array>
+#include <bit>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <type_traits>
 #include <utility>
@@ -52,7 +54,7 @@ public:
     /**
      * @brief Default constructor. Initializes all elements with their default values.
      */
-    EnumArray() = default;
+    constexpr EnumArray() = default;
 
     /**
      * @brief Constructor that initializes the array with an initializer list.
@@ -60,7 +62,7 @@ public:
      *
      * @param init Initializer list of values to fill the array with.
      */
-    EnumArray(std::initializer_list<T> init)
+    constexpr EnumArray(std::initializer_list<T> init)
     {
         // Runtime check that will assert if the sizes don't match
         if (init.size() != Size)
@@ -83,7 +85,7 @@ public:
      * @param e Enum value used as the index.
      * @return Reference to the element at the given index.
      */
-    T &operator[](Enum e)
+    constexpr T &operator[](Enum e)
     {
         return data_[to_index(e)];
     }
@@ -94,7 +96,7 @@ public:
      * @param e Enum value used as the index.
      * @return Const reference to the element at the given index.
      */
-    const T &operator[](Enum e) const
+    constexpr const T &operator[](Enum e) const
     {
         return data_[to_index(e)];
     }
@@ -104,35 +106,35 @@ public:
      *
      * @return Iterator to the beginning.
      */
-    auto begin() { return data_.begin(); }
+    constexpr auto begin() { return data_.begin(); }
 
     /**
      * @brief Returns an iterator to the end of the array.
      *
      * @return Iterator to the end.
      */
-    auto end() { return data_.end(); }
+    constexpr auto end() { return data_.end(); }
 
     /**
      * @brief Returns a const iterator to the beginning of the array.
      *
      * @return Const iterator to the beginning.
      */
-    auto begin() const { return data_.begin(); }
+    constexpr auto begin() const { return data_.begin(); }
 
     /**
      * @brief Returns a const iterator to the end of the array.
      *
      * @return Const iterator to the end.
      */
-    auto end() const { return data_.end(); }
+    constexpr auto end() const { return data_.end(); }
 
     /**
      * @brief Fills the array with the specified value.
      *
      * @param value Value to fill the array with.
      */
-    void fill(const T &value)
+    constexpr void fill(const T &value)
     {
         data_.fill(value);
     }
@@ -141,7 +143,7 @@ public:
      * @brief Returns a pointer to the underlying data array.
      * @return Pointer to the underlying data array.
      */
-    T *data()
+    constexpr T *data()
     {
         return data_.data();
     }
@@ -150,7 +152,7 @@ public:
      * @brief Accesses the element at the specified index.
      * @param index Index of the element to access.
      */
-    T &at(size_t index)
+    constexpr T &at(size_t index)
     {
         return data_.at(index);
     }
@@ -159,7 +161,7 @@ public:
      * @brief Accesses the element at the specified index.
      * @param index Index of the element to access.
      */
-    const T &at(size_t index) const
+    constexpr const T &at(size_t index) const
     {
         return data_.at(index);
     }
@@ -207,21 +209,21 @@ public:
          *
          * @param index Starting index for the iterator.
          */
-        explicit Iterator(size_t index) : index_(index) {}
+        constexpr explicit Iterator(size_t index) : index_(index) {}
 
         /**
          * @brief Dereferences the iterator to get the current enum value.
          *
          * @return Enum value at the current iterator position.
          */
-        Enum operator*() const { return static_cast<Enum>(index_); }
+        constexpr Enum operator*() const { return static_cast<Enum>(index_); }
 
         /**
          * @brief Advances the iterator to the next position.
          *
          * @return Reference to the updated iterator.
          */
-        Iterator &operator++()
+        constexpr Iterator &operator++()
         {
             ++index_;
             return *this;
@@ -233,7 +235,7 @@ public:
          * @param other Iterator to compare with.
          * @return True if the iterators are not equal, false otherwise.
          */
-        bool operator!=(const Iterator &other) const { return index_ != other.index_; }
+        constexpr bool operator!=(const Iterator &other) const { return index_ != other.index_; }
 
     private:
         size_t index_; ///< Current index of the iterator.
@@ -244,14 +246,214 @@ public:
      *
      * @return Iterator to the beginning.
      */
-    Iterator begin() const { return Iterator(0); }
+    constexpr Iterator begin() const { return Iterator(0); }
 
     /**
      * @brief Returns an iterator to the end of the enum range.
      *
      * @return Iterator to the end.
      */
-    Iterator end() const { return Iterator(std::to_underlying(Enum::COUNT)); }
+    constexpr Iterator end() const { return Iterator(std::to_underlying(Enum::COUNT)); }
+};
+
+/**
+ * @brief Calls the function for each enum value, unrolled at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The function gets a `std::integral_constant<Enum, value>`, which converts to Enum, and its
+ * `decltype(e)::value` is a constant expression, so `if constexpr` on it picks the code of each value
+ * and per-value branches of short hot loops (eg. ADC inputs) disappear:
+ * @code
+ * EnumForEach<Input>(
+ *     [&](auto input)
+ *     {
+ *         if constexpr (decltype(input)::value == Input::PITCH)
+ *         ...
+ *     });
+ * @endcode
+ * @tparam Enum Enum type with a COUNT value.
+ * @param function Called with each value, in order.
+ */
+template <typename Enum, typename Function>
+constexpr void EnumForEach(Function &&function)
+{
+    [&]<size_t... kIndices>(std::index_sequence<kIndices...>)
+    {
+        (function(std::integral_constant<Enum, static_cast<Enum>(kIndices)>{}), ...);
+    }(std::make_index_sequence<std::to_underlying(Enum::COUNT)>{});
+}
+
+/**
+ * @class EnumBitset
+ * @ingroup utils
+ * @brief EnumBitset: enum-indexed bools in one word.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * For the flags kept per enum value (pressed buttons, pots with MIDI, pots that freeze...). Compared to
+ * `EnumArray<Enum, bool>` it's a word instead of a byte per value, whole sets change in one operation
+ * (`pressed ^ previous` are the edges) and iterating visits only the set values, lowest first:
+ * @code
+ * for (Pot pot : frozen_pots_)
+ * @endcode
+ * A word is read and written at once, so a set written by one core or interrupt and read by another
+ * is always consistent.
+ * @tparam Enum Enum type used as the index.
+ * @tparam Size Number of values, defaulting to the number of enum values (up to 64).
+ */
+template <typename Enum, size_t Size = std::to_underlying(Enum::COUNT)>
+class EnumBitset
+{
+    static_assert(Size <= 64, "EnumBitset keeps the bits in one word");
+
+public:
+    using word_type = std::conditional_t<(Size <= 32), uint32_t, uint64_t>; ///< Storage of the bits.
+
+    /**
+     * @brief Mask of all the values.
+     */
+    static constexpr word_type kAll = Size == sizeof(word_type) * 8 ? ~word_type{0} : (word_type{1} << Size) - 1;
+
+    /**
+     * @brief Iterator over the set values.
+     */
+    class Iterator
+    {
+    public:
+        constexpr explicit Iterator(word_type bits) : bits_(bits) {}
+
+        constexpr Enum operator*() const { return static_cast<Enum>(std::countr_zero(bits_)); }
+
+        constexpr Iterator &operator++()
+        {
+            bits_ &= bits_ - 1; // Clears the lowest set bit
+            return *this;
+        }
+
+        constexpr bool operator!=(const Iterator &other) const { return bits_ != other.bits_; }
+
+    private:
+        word_type bits_; ///< Values not visited yet.
+    };
+
+    /**
+     * @brief Default constructor, no value is set.
+     */
+    constexpr EnumBitset() = default;
+
+    /**
+     * @brief Constructs the set from its bits, bit n is the enum value n.
+     * @param bits The bits, the ones above Size are dropped.
+     */
+    constexpr explicit EnumBitset(word_type bits) : bits_(bits & kAll) {}
+
+    /**
+     * @brief Constructs the set of the listed values.
+     * @param values Values to set.
+     */
+    constexpr EnumBitset(std::initializer_list<Enum> values)
+    {
+        for (Enum e : values)
+        {
+            set(e);
+        }
+    }
+
+    /**
+     * @brief Returns whether the value is set.
+     */
+    constexpr bool test(Enum e) const
+    {
+        return (bits_ >> to_index(e)) & 1;
+    }
+
+    /**
+     * @brief Returns whether the value is set, same as test().
+     */
+    constexpr bool operator[](Enum e) const
+    {
+        return test(e);
+    }
+
+    /**
+     * @brief Sets or clears the value.
+     */
+    constexpr void set(Enum e, bool value = true)
+    {
+        const word_type bit = word_type{1} << to_index(e);
+        bits_ = value ? (bits_ | bit) : (bits_ & ~bit);
+    }
+
+    /**
+     * @brief Sets all the values.
+     */
+    constexpr void set()
+    {
+        bits_ = kAll;
+    }
+
+    /**
+     * @brief Clears the value.
+     */
+    constexpr void reset(Enum e)
+    {
+        set(e, false);
+    }
+
+    /**
+     * @brief Clears all the values.
+     */
+    constexpr void reset()
+    {
+        bits_ = 0;
+    }
+
+    constexpr bool any() const { return bits_ != 0; }
+    constexpr bool none() const { return bits_ == 0; }
+    constexpr bool all() const { return bits_ == kAll; }
+    constexpr size_t count() const { return std::popcount(bits_); }
+    constexpr size_t size() const { return Size; }
+
+    /**
+     * @brief Returns the bits, bit n is the enum value n.
+     */
+    constexpr word_type to_word() const
+    {
+        return bits_;
+    }
+
+    constexpr EnumBitset operator&(const EnumBitset &other) const { return EnumBitset(bits_ & other.bits_); }
+    constexpr EnumBitset operator|(const EnumBitset &other) const { return EnumBitset(bits_ | other.bits_); }
+    constexpr EnumBitset operator^(const EnumBitset &other) const { return EnumBitset(bits_ ^ other.bits_); }
+    constexpr EnumBitset operator~() const { return EnumBitset(~bits_); }
+    constexpr EnumBitset &operator&=(const EnumBitset &other)
+    {
+        bits_ &= other.bits_;
+        return *this;
+    }
+    constexpr EnumBitset &operator|=(const EnumBitset &other)
+    {
+        bits_ |= other.bits_;
+        return *this;
+    }
+    constexpr EnumBitset &operator^=(const EnumBitset &other)
+    {
+        bits_ ^= other.bits_;
+        return *this;
+    }
+    constexpr bool operator==(const EnumBitset &other) const = default;
+
+    constexpr Iterator begin() const { return Iterator(bits_); }
+    constexpr Iterator end() const { return Iterator(0); }
+
+private:
+    static constexpr size_t to_index(Enum e)
+    {
+        return static_cast<size_t>(std::to_underlying(e));
+    }
+
+    word_type bits_ = 0; ///< Bit n is the enum value n.
 };
 
 /**
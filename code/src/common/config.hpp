@@ -39,24 +39,74 @@ namespace kastle2
 {
 
 /**
- * Kastle 2's 8MB memory is divided into 2 sections:
+ * Kastle 2's 8MB memory is divided into 3 sections:
  * 512 KB for the main code
- * 7.5 MB for the user data (eg. samples)
+ * 7.4 MB for the user data (eg. samples)
+ * 64 KB for the presets (see PresetStore), written by the firmware
  */
 #define USER_DATA_SECTION __attribute__((section(".user_data")))
+#ifndef USER_DATA_SECTION_BEGIN
 #define USER_DATA_SECTION_BEGIN 0x10080000 // at 512 KB
+#endif
+#define USER_DATA_SECTION_SIZE (7616 * 1024) // 7.4 MB, up to the presets
+#ifndef PRESET_SECTION_BEGIN
+#define PRESET_SECTION_BEGIN 0x107F0000 // last 64 KB of the flash
+#endif
+#define PRESET_SECTION_SIZE (64 * 1024)
+
+/**
+ * RAM region of board/memmap_kastle2.ld, the static data, the arena and the heap (the fast code and the stacks are separate)
+ */
+static constexpr size_t RAM_SIZE = 240 * 1024;
+
+/**
+ * Arena budget of the app's memory manifest (APP_ARENA_BUDGET in its CMakeLists.txt), checked by KASTLE2_ARENA.
+ * 0 when not set, the arena then only has to fit RAM_SIZE.
+ * The rest of the manifest (heap, stacks, FASTCODE, FASTDATA) is checked by the linker script.
+ */
+#ifndef KASTLE2_ARENA_BUDGET
+#define KASTLE2_ARENA_BUDGET 0
+#endif
 
 /**
  * Close to 44100 - "weird" frequency, because we need the RP2040 to run at
  * a multiplied frequency and frequencies of RP2040 are limited
  * (need to be calculated by rp2040_freq.py in scrpts folder and confirmed by vcocalc.py in Pico SDK).
+ * @note 44000 by default, apps can choose 48000 or 96000 with APP_SAMPLE_RATE in their CMakeLists.txt.
+ *       Everything derived from it (AUDIO_LOOP_RATE, s2sr, the DSP constants...) is computed at compile time.
+ */
+#ifndef KASTLE2_SAMPLE_RATE
+#define KASTLE2_SAMPLE_RATE 44000
+#endif
+static_assert(KASTLE2_SAMPLE_RATE == 44000 || KASTLE2_SAMPLE_RATE == 48000 || KASTLE2_SAMPLE_RATE == 96000,
+              "Sample rate must be 44000, 48000 or 96000");
+
+/**
+ * Sample rate of the codec, the I2S and the USB audio
  */
-static constexpr float SAMPLE_RATE = 44000.0f;
+static constexpr float I2S_SAMPLE_RATE = static_cast<float>(KASTLE2_SAMPLE_RATE);
+
+/**
+ * Processing rate divider, 1 by default.
+ * The "lo-fi economy" mode (2, APP_RATE_DIVIDER in the app CMakeLists.txt) runs the app and the common code
+ * at half of I2S_SAMPLE_RATE (22 kHz), Kastle2::AudioCallback() decimates the input and interpolates
+ * the output by half-band filters. About twice the cycles per processed sample, the bandwidth is 10 kHz.
+ */
+#ifndef KASTLE2_RATE_DIVIDER
+#define KASTLE2_RATE_DIVIDER 1
+#endif
+static_assert(KASTLE2_RATE_DIVIDER == 1 || KASTLE2_RATE_DIVIDER == 2, "Rate divider must be 1 or 2");
+static constexpr size_t RATE_DIVIDER = KASTLE2_RATE_DIVIDER;
+
+/**
+ * Processing sample rate, I2S_SAMPLE_RATE / RATE_DIVIDER
+ */
+static constexpr float SAMPLE_RATE = I2S_SAMPLE_RATE / static_cast<float>(RATE_DIVIDER);
 
 /**
  * Seconds to sample rate samples (s * SAMPLE_RATE)
  * @param s Seconds to convert
- * @return Number of samples in SAMPLE_RATE (44000 Hz)
+ * @return Number of samples in SAMPLE_RATE (44000 Hz by default)
  */
 static consteval size_t s2sr(float s)
 {
@@ -66,11 +116,14 @@ static consteval size_t s2sr(float s)
 /**
  * Audio buffer frames for Kastle 2 in stereo
  * Actually is 96 "real" frames (2*48 frames)
+ * @note 48 by default, apps can choose 16, 32, 96 or 128 with APP_AUDIO_BUFFER_SIZE in their CMakeLists.txt.
+ *       Everything derived from it (AUDIO_LOOP_RATE, s2alr...) is computed at compile time.
+ *       These are the frames at SAMPLE_RATE, I2S::kAudioBufferSize / RATE_DIVIDER (the block time is the same).
  */
-static constexpr size_t AUDIO_BUFFER_SIZE = I2S::kAudioBufferSize;
+static constexpr size_t AUDIO_BUFFER_SIZE = I2S::kAudioBufferSize / RATE_DIVIDER;
 
 /**
- * Basically SAMPLE_RATE / buffer size (48)
+ * Basically SAMPLE_RATE / buffer size (48 by default)
  */
 static constexpr float AUDIO_LOOP_RATE = SAMPLE_RATE / static_cast<float>(AUDIO_BUFFER_SIZE);
 
@@ -97,8 +150,20 @@ static consteval size_t hz2alr(float hz)
 /**
  * Because SYSTEM_CLOCK_KHZ / SAMPLE_RATE needs to be round number
  * Slightly overclocked (base is 133 MHz), but should be all right
+ * 192 MHz for 48 and 96 kHz, the same cycles per sample as 176 MHz at 44 kHz (for 48 kHz)
+ */
+static constexpr uint32_t DEFAULT_SYSTEM_CLOCK_KHZ = KASTLE2_SAMPLE_RATE == 44000 ? 176000 : 192000;
+
+/**
+ * System clock in kHz
+ * @note DEFAULT_SYSTEM_CLOCK_KHZ by default, apps can choose another validated plan (see ClockPlan.hpp)
+ *       with APP_SYSTEM_CLOCK_KHZ in their CMakeLists.txt, or all apps with -DKASTLE2_SYSTEM_CLOCK_KHZ=...
  */
-static constexpr uint32_t SYSTEM_CLOCK_KHZ = 176000;
+#ifdef KASTLE2_SYSTEM_CLOCK_KHZ
+static constexpr uint32_t SYSTEM_CLOCK_KHZ = KASTLE2_SYSTEM_CLOCK_KHZ;
+#else
+static constexpr uint32_t SYSTEM_CLOCK_KHZ = DEFAULT_SYSTEM_CLOCK_KHZ;
+#endif
 
 /**
  * Max value of the DAC output (PWM-based, filtered)
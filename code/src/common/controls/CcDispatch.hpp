@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kastle2
+{
+
+/**
+ * @class CcDispatch
+ * @ingroup controls
+ * @brief Table from the 128 MIDI CC numbers to the controls listening to them.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Built once from the configurations (Add() for each control), a received CC is then one lookup
+ * instead of comparing it with every control. The controls sharing a CC are chained, ForEach() visits them
+ * in the order they were added. The channel doesn't matter here, midi::Handler passes only the messages
+ * of the set (or learned) channel.
+ *
+ * @tparam kSize Number of the controls, indexed 0 to kSize - 1
+ */
+template <size_t kSize>
+class CcDispatch
+{
+    static_assert(kSize < 0xFF, "The indexes are bytes, 0xFF is none");
+
+public:
+    static constexpr size_t kCcs = 128;
+
+    CcDispatch()
+    {
+        Clear();
+    }
+
+    /**
+     * @brief Removes all the controls
+     */
+    void Clear()
+    {
+        first_.fill(kNone);
+        next_.fill(kNone);
+    }
+
+    /**
+     * @brief Adds the control to the CC, call in the order of the controls
+     * @param cc The CC number, the others (eg. FancyPot::NO_MIDI) are ignored
+     * @param index The control
+     */
+    void Add(const uint8_t cc, const size_t index)
+    {
+        if (cc >= kCcs || index >= kSize)
+        {
+            return;
+        }
+        uint8_t *link = &first_[cc];
+        while (*link != kNone)
+        {
+            link = &next_[*link];
+        }
+        *link = static_cast<uint8_t>(index);
+    }
+
+    /**
+     * @brief Calls the function with the index of each control of the CC
+     */
+    template <typename Function>
+    void ForEach(const uint8_t cc, Function &&function) const
+    {
+        if (cc >= kCcs)
+        {
+            return;
+        }
+        for (uint8_t index = first_[cc]; index != kNone; index = next_[index])
+        {
+            function(static_cast<size_t>(index));
+        }
+    }
+
+private:
+    static constexpr uint8_t kNone = 0xFF;
+
+    std::array<uint8_t, kCcs> first_;  // First control of each CC
+    std::array<uint8_t, kSize> next_;  // Next control of the same CC
+};
+
+}
@@ -0,0 +1,160 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kastle2
+{
+
+/**
+ * @class DerivedParameter
+ * @ingroup controls
+ * @brief Change tracking for a DSP parameter computed from a few inputs, so it's recomputed only when they change.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The UI loop recomputes its derived parameters every time, even when the pots and CVs didn't move.
+ * Filter coefficients and 1V/oct exponentials are computed in soft float, which makes most of the loop.
+ * The parameter lists the inputs it's computed from, and recomputes only when one of them moves
+ * over the threshold (since the last recompute, so slow movements add up):
+ *
+ * @code
+ * if (filter_param_.Changed({pots_[Pot::FILTER].GetValue()}))
+ * {
+ *     filter_.SetCrossfade(...);
+ * }
+ * @endcode
+ *
+ * The first call always reports a change.
+ *
+ * @note The threshold is in the units of the inputs. 0 recomputes with any change, so the results are the same as
+ *       recomputing every time. FancyPot::TWEAK_THRESHOLD matches what FancyPot::HasChanged() reports,
+ *       don't use it for pitch, it's about a third of a semitone of the CV.
+ * @tparam kInputs Number of the inputs.
+ */
+template <size_t kInputs>
+class DerivedParameter
+{
+public:
+    /**
+     * @brief Constructor
+     * @param threshold How much an input has to move to recompute, 0 for any change
+     */
+    explicit DerivedParameter(const uint32_t threshold = 0) : threshold_(threshold) {}
+
+    /**
+     * @brief Checks the inputs, call it with the current values before recomputing
+     * @param inputs The current input values, in the same order each time
+     * @return True when the parameter should be recomputed (the values are stored then)
+     */
+    bool Changed(const std::array<int32_t, kInputs> &inputs)
+    {
+        bool changed = !valid_;
+        for (size_t i = 0; i < kInputs && !changed; i++)
+        {
+            const int64_t difference = static_cast<int64_t>(inputs[i]) - inputs_[i];
+            changed = static_cast<uint64_t>(difference < 0 ? -difference : difference) > threshold_;
+        }
+        if (changed)
+        {
+            inputs_ = inputs;
+            valid_ = true;
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Forces a recompute with the next Changed() (mode switch etc.)
+     */
+    void Invalidate()
+    {
+        valid_ = false;
+    }
+
+private:
+    std::array<int32_t, kInputs> inputs_{};
+    uint32_t threshold_;
+    bool valid_ = false;
+};
+
+/**
+ * @class DerivedValue
+ * @ingroup controls
+ * @brief DerivedParameter that also keeps the computed value.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * @code
+ * const float free_pitch_mod = free_pitch_mod_.Get({cv, pitch_mod_pot}, [&]
+ *                                                  { return std::pow(2.0f, cv / static_cast<float>(ADC_1V)); });
+ * @endcode
+ *
+ * @tparam T The type of the value.
+ * @tparam kInputs Number of the inputs.
+ */
+template <typename T, size_t kInputs>
+class DerivedValue
+{
+public:
+    /**
+     * @brief Constructor
+     * @param threshold How much an input has to move to recompute, 0 for any change
+     */
+    explicit DerivedValue(const uint32_t threshold = 0) : parameter_(threshold) {}
+
+    /**
+     * @brief Returns the value, computed again only when the inputs changed
+     * @param inputs The current input values, in the same order each time
+     * @param compute Computes the value from the inputs (the captured values, not the array)
+     * @return The value
+     */
+    template <typename Compute>
+    const T &Get(const std::array<int32_t, kInputs> &inputs, Compute &&compute)
+    {
+        if (parameter_.Changed(inputs))
+        {
+            value_ = compute();
+        }
+        return value_;
+    }
+
+    /**
+     * @brief Forces a recompute with the next Get()
+     */
+    void Invalidate()
+    {
+        parameter_.Invalidate();
+    }
+
+private:
+    DerivedParameter<kInputs> parameter_;
+    T value_{};
+};
+
+}
@@ -25,6 +25,7 @@ SOFTWARE.
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 #include <vector>
 #include "common/core/Hardware.hpp"
 #include "common/core/Kastle2.hpp"
@@ -179,7 +180,7 @@ public:
 
     /**
      * @brief Disables the next change when any MODE layer pot is moved, or when the current layer time is over the specified number of ticks.
-     * @tparam Container Type of container holding FancyPot pointers (e.g., EnumArray)
+     * @tparam Container Type of container holding FancyPot pointers (e.g., EnumArray) or FancyPots (FancyPotBank)
      * @param all_pots Container with all pots the app uses (the function filters them automatically by the MODE layer)
      * @param over_ticks If set, disables the next change when the current layer time is over this number of ticks
      */
@@ -189,9 +190,18 @@ public:
         tweak_pots_.clear();
         for (const auto &pot : all_pots)
         {
-            if (pot && pot->GetLayer() == Hardware::Layer::MODE)
+            const FancyPot *pointer = nullptr;
+            if constexpr (std::is_same_v<std::decay_t<decltype(pot)>, FancyPot>)
             {
-                tweak_pots_.push_back(pot.get());
+                pointer = &pot;
+            }
+            else
+            {
+                pointer = pot.get();
+            }
+            if (pointer && pointer->GetLayer() == Hardware::Layer::MODE)
+            {
+                tweak_pots_.push_back(pointer);
             }
         }
         over_ticks_ = over_ticks;
@@ -226,7 +236,7 @@ private:
     uint32_t mode_ = 0;                ///< Output mode, generated based on inputs and selected mode
     bool disable_next_change_ = false; ///< Whether to disable the next change (when changing mode pots etc)
 
-    std::vector<FancyPot *> tweak_pots_; ///< If defined we will disable next change when the pots are moved
+    std::vector<const FancyPot *> tweak_pots_; ///< If defined we will disable next change when the pots are moved
     uint32_t over_ticks_ = 0;            ///< If defined we will disable next change when the current layer time is over this number of ticks
 
     uint32_t adc_input_value_ = 0; ///< Current input value from the ADC, used for mode calculation
@@ -41,9 +41,11 @@ FancyPot::FancyPot(Config config) : config_(config)
     values_[Source::INTERNAL] = config.initial_value;
     values_[Source::MIDI_CC] = 0;
     values_[Source::MIDI_NOTES] = 0;
+    values_[Source::PRESET] = 0;
     mapped_values_[Source::INTERNAL] = 0;
     mapped_values_[Source::MIDI_CC] = 0;
     mapped_values_[Source::MIDI_NOTES] = 0;
+    mapped_values_[Source::PRESET] = 0;
 
     UpdateInternalMappedValue();
     UpdatePreviousFromCurrent();
@@ -159,12 +161,29 @@ void FancyPot::ReadValue()
     }
 
     // Send CCs
-    if (config_.midi_output_cc != NO_MIDI)
+    const bool high_res_cc = config_.midi_output_cc != NO_MIDI && config_.midi_output_high_res;
+    if (config_.midi_output_cc != NO_MIDI && !high_res_cc)
     {
         int32_t value = GetValue();
         value = sticky_map(value, POT_MIN, POT_MAX, 0, 127, prev_midi_sticky_value_);
         Kastle2::midi.SendCc(config_.midi_output_cc, value);
     }
+
+    // 14-bit CC and NRPN, the full 12-bit resolution of the pot
+    if (high_res_cc || config_.midi_output_nrpn != NO_NRPN)
+    {
+        int32_t value = GetValue();
+        value = sticky_map(value, POT_MIN, POT_MAX, POT_MIN, POT_MAX, prev_midi_high_res_sticky_value_, MIDI_HIGH_RES_HYSTERESIS);
+        const uint16_t value14 = (value << 2) | (value >> 10);
+        if (high_res_cc)
+        {
+            Kastle2::midi.SendCc14(config_.midi_output_cc, value14);
+        }
+        if (config_.midi_output_nrpn != NO_NRPN)
+        {
+            Kastle2::midi.SendNrpn(config_.midi_output_nrpn, value14);
+        }
+    }
 }
 
 void FancyPot::ClearMidi()
@@ -201,6 +220,16 @@ void FancyPot::UpdateInternalMappedValue()
     }
 }
 
+void FancyPot::SetMidiValue(const uint16_t value)
+{
+    values_[Source::MIDI_CC] = value >> 2; // Convert 14-bit to 12-bit
+    if (config_.map_size > 0)
+    {
+        mapped_values_[Source::MIDI_CC] = map(value, 0, midi::Message::kValue14Max + 1, 0, config_.map_size);
+    }
+    value_source_ = Source::MIDI_CC;
+}
+
 void FancyPot::ForceValue(const int32_t value, const bool force_changed)
 {
     for (auto &v : values_)
@@ -243,15 +272,16 @@ void FancyPot::MidiCallback(midi::Message *msg)
         // Handle MIDI CC changes
         if (msg->GetData1() == config_.midi_cc)
         {
-            values_[Source::MIDI_CC] = msg->GetData2() << 5; // Convert 7-bit to 12-bit
-            if (config_.map_size > 0)
-            {
-                mapped_values_[Source::MIDI_CC] = map(msg->GetData2(), 0, 128, 0, config_.map_size);
-            }
-            value_source_ = Source::MIDI_CC;
+            SetMidiValue(msg->GetValue14());
         }
     }
 
+    // Handle MIDI NRPN changes (if configured)
+    if (msg->IsNrpn() && config_.midi_nrpn != NO_NRPN && msg->GetNrpnParameter() == config_.midi_nrpn)
+    {
+        SetMidiValue(msg->GetValue14());
+    }
+
     // Handle MIDI notes (if configured)
     if (msg->IsNoteOn() && config_.midi_note_control.IsEnabled())
     {
@@ -273,6 +303,14 @@ void FancyPot::MidiCallback(midi::Message *msg)
     }
 }
 
+void FancyPot::SetSnapshot(const Snapshot &snapshot)
+{
+    values_[Source::PRESET] = constrain(snapshot.value, POT_MIN, POT_MAX);
+    mapped_values_[Source::PRESET] = config_.map_size > 0 ? constrain(snapshot.mapped_value, 0, static_cast<int32_t>(config_.map_size) - 1) : 0;
+    value_source_ = Source::PRESET;
+    ForceChanged();
+}
+
 void FancyPot::LoadFromMemory()
 {
     if (UseMemory())
@@ -47,6 +47,8 @@ class FancyPot
 public:
     static constexpr size_t NO_MEMORY = std::numeric_limits<size_t>::max();
     static constexpr uint8_t NO_MIDI = 0xFF;
+    static constexpr uint16_t NO_NRPN = 0xFFFF;
+    static constexpr int32_t MIDI_HIGH_RES_HYSTERESIS = 4;             // of the 12-bit value, for 14-bit CC and NRPN output
     static constexpr uint32_t DEFAULT_LAYER_TIME = 64;                  // approx 64ms
     static constexpr uint32_t SHIFT_LAYER_TIME = kShiftShortPressTicks; // for shift layer
     static constexpr uint32_t TWEAK_THRESHOLD = 24;                     // 0.5%;
@@ -54,13 +56,14 @@ public:
     static constexpr uint32_t NO_MAPPING = 0;                           // Don't map by default, use 0 for no mapping
 
     /**
-     * @brief Can be INTERNAL (from the pot) or MIDI (from MIDI CCs)
+     * @brief Can be INTERNAL (from the pot), MIDI (from MIDI CCs or notes) or PRESET (recalled snapshot)
      */
     enum class Source
     {
         INTERNAL,
         MIDI_CC,
         MIDI_NOTES,
+        PRESET,
         COUNT
     };
 
@@ -107,12 +110,24 @@ public:
         size_t map_size = NO_MAPPING;               // Use GetMappedValue() to get the value in range 0 to map_size - 1
         uint8_t midi_cc = NO_MIDI;                       // For MIDI control change (0xFF = no MIDI CC)
         uint8_t midi_output_cc = NO_MIDI;                // For MIDI control change output (0xFF = no MIDI CC)
+        bool midi_output_high_res = false;               // Outputs midi_output_cc (0-31) as a 14-bit CC pair
+        uint16_t midi_nrpn = NO_NRPN;                    // For MIDI NRPN (0xFFFF = no NRPN)
+        uint16_t midi_output_nrpn = NO_NRPN;             // For MIDI NRPN output (0xFFFF = no NRPN)
         MidiNoteControl midi_note_control = {};          // MIDI note control, use NO_MIDI (0xFF) for no MIDI notes
         bool deadzone = false;                           // Center deadzone
         bool freeze = false;                             // Freezes the value after a while, useful for getting rid of noise etc.
         size_t memory_addr = NO_MEMORY;             // For saving and loading (0 = no memory)
     };
 
+    /**
+     * @brief Value of the pot stored in a preset (see PresetStore)
+     */
+    struct Snapshot
+    {
+        int32_t value;        // GetValue()
+        int32_t mapped_value; // GetMappedValue()
+    };
+
     /**
      * @brief Creates a FancyPot instance with the given configuration
      * @param config The configuration for the FancyPot
@@ -127,6 +142,11 @@ public:
      */
     FancyPot(Config config);
 
+    /**
+     * @brief Default configuration, for pots stored by value (FancyPotBank)
+     */
+    FancyPot() : FancyPot(Config{}) {}
+
     /**
      * @brief Initializes the FancyPot with the given sample rate
      * @param sample_rate The sample rate to use for freezing
@@ -154,7 +174,7 @@ public:
     void ForceValue(const int32_t value, const bool force_changed = false);
 
     /**
-     * @brief Handles incoming MIDI message (= parses CCs from it)
+     * @brief Handles incoming MIDI message (= parses CCs and NRPNs from it, with their 14-bit values)
      * @param msg The MIDI message to handle
      */
     void MidiCallback(midi::Message *msg);
@@ -217,6 +237,15 @@ public:
      */
     void ForceChanged();
 
+    /**
+     * @brief Returns the configuration of the pot
+     * @return The configuration given to the constructor
+     */
+    const Config &GetConfig() const
+    {
+        return config_;
+    }
+
     /**
      * @brief Returns the layer this pot is configured for
      * @return The layer this pot is configured for
@@ -226,6 +255,21 @@ public:
         return config_.layer;
     }
 
+    /**
+     * @brief Returns the current value for a preset
+     * @return The value and the mapped value of the current source
+     */
+    Snapshot GetSnapshot() const
+    {
+        return {GetValue(), GetMappedValue()};
+    }
+
+    /**
+     * @brief Recalls a value of a preset, it holds until the pot is moved (like a MIDI value)
+     * @param snapshot Value from GetSnapshot()
+     */
+    void SetSnapshot(const Snapshot &snapshot);
+
     /**
      * @brief Saves the current value to memory (if configured)
      */
@@ -265,6 +309,12 @@ private:
      */
     void UpdateInternalMappedValue();
 
+    /**
+     * @brief Sets the MIDI CC value source from a 14-bit value
+     * @param value 0 to midi::Message::kValue14Max
+     */
+    void SetMidiValue(const uint16_t value);
+
     // Configuration
     Config config_;
 
@@ -284,6 +334,7 @@ private:
     int32_t prev_midi_cc_value_ = INT32_MAX;
     int32_t prev_midi_notes_value_ = INT32_MAX;
     int32_t prev_midi_sticky_value_ = INT32_MAX;
+    int32_t prev_midi_high_res_sticky_value_ = INT32_MAX;
 
     int32_t prev_internal_map_sticky_value_ = INT32_MAX;
 
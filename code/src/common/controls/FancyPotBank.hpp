@@ -0,0 +1,221 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "CcDispatch.hpp"
+#include "FancyPot.hpp"
+#include "common/EnumTools.hpp"
+#include "common/core/Kastle2_cc.hpp"
+#include "common/core/midi/Message.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class FancyPotBank
+ * @ingroup controls
+ * @brief All the FancyPots of an app in one block, processed together.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Replaces `EnumArray<Pot, std::unique_ptr<FancyPot>>`: the pots are stored by value next to each other,
+ * and the fields the bulk calls need are copied to small arrays by Init():
+ * - Process() runs only the pots that freeze, as one scheduler task instead of one per pot.
+ * - MidiCallback() looks the CC up in a CcDispatch table, compares the NRPN numbers of all pots in one pass
+ *   and passes the message only to the pots it's meant for.
+ * - ReadValues() reads all the pots in one loop.
+ *
+ * The per-pot accessors stay on FancyPot, `pots_[Pot::PITCH].GetValue()`.
+ * The pots are configured by assigning them, `pots_[Pot::PITCH] = FancyPot({...})`, before Init().
+ *
+ * @tparam Enum The app's pot enum, with COUNT.
+ */
+template <typename Enum, size_t kSize = std::to_underlying(Enum::COUNT)>
+class FancyPotBank
+{
+    static_assert(kSize > 0 && kSize <= 64, "The pot sets are EnumBitsets");
+
+public:
+    /**
+     * @brief Values of all the pots, for the presets (see PresetStore)
+     */
+    using Snapshot = std::array<FancyPot::Snapshot, kSize>;
+
+    /**
+     * @brief Initializes all the pots and collects their MIDI and freezing configuration
+     * @param sample_rate The rate Process() is called at (see FancyPot::Init())
+     * @note Call after all the pots are configured, the configuration is not read again.
+     */
+    void Init(const float sample_rate)
+    {
+        freeze_.reset();
+        notes_.reset();
+        cc_dispatch_.Clear();
+        for (size_t i = 0; i < kSize; i++)
+        {
+            pots_[i].Init(sample_rate);
+
+            const FancyPot::Config &config = pots_[i].GetConfig();
+            cc_dispatch_.Add(config.midi_cc, i);
+            midi_nrpn_[i] = config.midi_nrpn;
+            freeze_.set(static_cast<Enum>(i), config.freeze);
+            notes_.set(static_cast<Enum>(i), config.midi_note_control.IsEnabled());
+        }
+    }
+
+    /**
+     * @brief Processes the freezing of all the pots, add it to the control scheduler
+     */
+    void Process()
+    {
+        for (const Enum pot : freeze_)
+        {
+            (*this)[pot].Process();
+        }
+    }
+
+    /**
+     * @brief Reads the values of all the pots
+     * @note Call this at the beginning of your UI loop!
+     */
+    void ReadValues()
+    {
+        for (auto &pot : pots_)
+        {
+            pot.ReadValue();
+        }
+    }
+
+    /**
+     * @brief Passes a MIDI message to the pots it's meant for
+     * @param msg The MIDI message
+     */
+    void MidiCallback(midi::Message *msg)
+    {
+        if (msg->IsControlChange() || msg->IsNrpn())
+        {
+            if (msg->IsControlChange() && msg->GetData1() == cc::RESET_CONTROLLERS)
+            {
+                for (auto &pot : pots_)
+                {
+                    pot.ClearMidi();
+                }
+                return;
+            }
+
+            if (msg->IsControlChange())
+            {
+                cc_dispatch_.ForEach(msg->GetData1(), [this, msg](const size_t i)
+                                     { pots_[i].MidiCallback(msg); });
+            }
+            else
+            {
+                // Unused numbers are NO_NRPN, out of the range of the messages
+                const uint16_t nrpn = msg->GetNrpnParameter();
+                for (size_t i = 0; i < kSize; i++)
+                {
+                    if (midi_nrpn_[i] == nrpn)
+                    {
+                        pots_[i].MidiCallback(msg);
+                    }
+                }
+            }
+        }
+
+        if (msg->IsNoteOn())
+        {
+            for (const Enum pot : notes_)
+            {
+                (*this)[pot].MidiCallback(msg);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current values of all the pots
+     */
+    Snapshot GetSnapshot() const
+    {
+        Snapshot snapshot;
+        for (size_t i = 0; i < kSize; i++)
+        {
+            snapshot[i] = pots_[i].GetSnapshot();
+        }
+        return snapshot;
+    }
+
+    /**
+     * @brief Recalls the values of all the pots, each holds until its pot is moved
+     * @param snapshot Values from GetSnapshot()
+     */
+    void SetSnapshot(const Snapshot &snapshot)
+    {
+        for (size_t i = 0; i < kSize; i++)
+        {
+            pots_[i].SetSnapshot(snapshot[i]);
+        }
+    }
+
+    /**
+     * @brief Accesses the pot
+     * @param pot The pot
+     * @return The pot
+     */
+    FancyPot &operator[](const Enum pot)
+    {
+        return pots_[std::to_underlying(pot)];
+    }
+
+    /**
+     * @brief Accesses the pot (const version)
+     * @param pot The pot
+     * @return The pot
+     */
+    const FancyPot &operator[](const Enum pot) const
+    {
+        return pots_[std::to_underlying(pot)];
+    }
+
+    auto begin() { return pots_.begin(); }
+    auto end() { return pots_.end(); }
+    auto begin() const { return pots_.begin(); }
+    auto end() const { return pots_.end(); }
+
+private:
+    std::array<FancyPot, kSize> pots_;
+
+    // Copied from the configurations by Init()
+    CcDispatch<kSize> cc_dispatch_;
+    std::array<uint16_t, kSize> midi_nrpn_{};
+    EnumBitset<Enum, kSize> freeze_; // The pots that freeze
+    EnumBitset<Enum, kSize> notes_;  // The pots with MIDI note control
+};
+
+}
@@ -40,6 +40,9 @@ namespace kastle2
  * @brief Interface for the Kastle 2 apps. Implement this interface to create a new app.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2023-11-28
+ *
+ * Declare the app `final` and bind it with Kastle2::StartAudio<app>() etc. in `main.cpp`,
+ * the audio interrupt then calls its AudioLoop() directly instead of through the vtable.
  */
 class App
 {
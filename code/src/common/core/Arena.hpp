@@ -0,0 +1,137 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <type_traits>
+#include "pico/stdlib.h"
+
+namespace kastle2
+{
+
+/**
+ * @class Arena
+ * @ingroup core
+ * @brief Static memory arena for the big app buffers (delay lines, tables, FFT buffers...).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Works over a fixed buffer reserved at build time (see KASTLE2_ARENA), so the RAM used by the app
+ * buffers is visible in the linked binary and the link fails if it doesn't fit the RAM.
+ * Allocations are just bumping a pointer, memory can only be released all at once by Reset().
+ *
+ * Apps describe their usage with Footprint() as a constexpr sum and reserve exactly that,
+ * running out of the arena means an allocation is missing in that sum and panics right away.
+ *
+ * @note Destructors are not called by Reset(), so only trivially destructible types can be allocated.
+ */
+class Arena
+{
+public:
+    /**
+     * @brief Alignment of every allocation.
+     */
+    static constexpr size_t kAlignment = 8;
+
+    /**
+     * @brief Creates the arena over the given storage.
+     * @param storage Storage of at least capacity bytes, aligned to kAlignment.
+     * @param capacity Size of the storage in bytes.
+     */
+    constexpr Arena(uint8_t *storage, const size_t capacity) : storage_(storage), capacity_(capacity)
+    {
+    }
+
+    /**
+     * @brief Bytes taken by an allocation of count elements, including the alignment padding.
+     * @param count Number of elements.
+     * @return Bytes used in the arena.
+     */
+    template <typename T>
+    static constexpr size_t Footprint(const size_t count)
+    {
+        return (sizeof(T) * count + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    /**
+     * @brief Allocates count value-initialized elements (zeros for numbers).
+     * @param count Number of elements.
+     * @return The allocated elements. Panics (does not return) when the arena is full.
+     */
+    template <typename T>
+    std::span<T> Allocate(const size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena doesn't call destructors");
+        static_assert(alignof(T) <= kAlignment, "Type needs a bigger alignment than the arena gives");
+
+        const size_t size = Footprint<T>(count);
+        if (size > capacity_ - used_)
+        {
+            panic("Arena full: %u + %u > %u bytes", static_cast<unsigned>(used_), static_cast<unsigned>(size), static_cast<unsigned>(capacity_));
+        }
+
+        T *elements = reinterpret_cast<T *>(storage_ + used_);
+        used_ += size;
+        for (size_t i = 0; i < count; i++)
+        {
+            new (&elements[i]) T();
+        }
+        return std::span<T>(elements, count);
+    }
+
+    /**
+     * @brief Releases all the allocations at once. Nothing allocated before may be used after this.
+     */
+    void Reset()
+    {
+        used_ = 0;
+    }
+
+    /**
+     * @brief Returns the bytes currently allocated.
+     */
+    size_t GetUsed() const
+    {
+        return used_;
+    }
+
+    /**
+     * @brief Returns the size of the arena in bytes.
+     */
+    size_t GetCapacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    uint8_t *storage_;
+    size_t capacity_;
+    size_t used_ = 0;
+};
+
+}
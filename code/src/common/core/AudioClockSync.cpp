@@ -0,0 +1,119 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AudioClockSync.hpp"
+#include <algorithm>
+#ifndef KASTLE2_HOST
+#include "hardware/structs/usb.h"
+#endif
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+FASTCODE void AudioClockSync::Block(const size_t frames)
+{
+#if KASTLE2_USB_AUDIO && !defined(KASTLE2_HOST)
+    // TinyUSB reads the frame numbers itself when it needs them
+    if (usb_hw->inte & USB_INTE_DEV_SOF_BITS)
+    {
+        return;
+    }
+    const uint32_t frame = usb_hw->sof_rd & USB_SOF_RD_BITS;
+    if (!started_)
+    {
+        // Both counts start at this frame number
+        started_ = true;
+        usb_frame_ = frame;
+        usb_frames_ = 0;
+        i2s_frames_ = 0;
+        silent_blocks_ = 0;
+        window_sum_ = 0;
+        window_blocks_ = 0;
+        return;
+    }
+
+    // 11-bit frame number, a block is much shorter than its wrap (2 s)
+    const uint32_t elapsed = (frame - usb_frame_) & USB_SOF_RD_BITS;
+    usb_frame_ = frame;
+    usb_frames_ += elapsed;
+    i2s_frames_ += frames;
+    silent_blocks_ = elapsed == 0 ? silent_blocks_ + 1 : 0;
+
+    // The counts wrap together, their difference doesn't
+    const int32_t error = static_cast<int32_t>(i2s_frames_ - usb_frames_ * UsbAudio::kFramesPerUsbFrame);
+    if (silent_blocks_ > kMaxSilentBlocks || error > kMaxErrorFrames || error < -kMaxErrorFrames)
+    {
+        stopped_ = true;
+        started_ = false;
+        return;
+    }
+
+    window_sum_ += error;
+    if (++window_blocks_ >= kWindowBlocks)
+    {
+        // Process() hasn't taken the previous one, this one is dropped
+        if (!closed_ready_)
+        {
+            closed_error_ = (window_sum_ << 4) / static_cast<int32_t>(window_blocks_);
+            closed_ready_ = true;
+        }
+        window_sum_ = 0;
+        window_blocks_ = 0;
+    }
+#else
+    (void)frames;
+#endif
+}
+
+void AudioClockSync::Process(I2S &i2s)
+{
+#if KASTLE2_USB_AUDIO
+    if (stopped_)
+    {
+        // Back at the nominal dividers until the frames lock again
+        stopped_ = false;
+        closed_ready_ = false;
+        if (locked_)
+        {
+            locked_ = false;
+            integral_ = 0;
+            i2s.SetClockTrim(0);
+        }
+        return;
+    }
+    if (!closed_ready_)
+    {
+        return;
+    }
+    const int32_t error = closed_error_;
+    closed_ready_ = false;
+
+    // The I2S ahead of the host (a positive error) slows down
+    integral_ = std::clamp(integral_ - error * kIntegralPpb / 16, -kMaxTrimPpb, kMaxTrimPpb);
+    i2s.SetClockTrim(std::clamp(integral_ - error * kProportionalPpb / 16, -kMaxTrimPpb, kMaxTrimPpb));
+    locked_ = true;
+#else
+    (void)i2s;
+#endif
+}
@@ -0,0 +1,118 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "common/core/UsbAudio.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AudioClockSync
+ * @ingroup core
+ * @brief Locks the I2S clock to the USB frames of the host (SOF, 1 kHz) by trimming the PIO dividers.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The audio callback counts the I2S frames against the USB frames, their difference is the phase error
+ * in the frames. Each window of about a second, Process() passes the average error through a PI loop
+ * (about 10 s to settle) to I2S::SetClockTrim(). Locked, the I2S runs at exactly I2S_SAMPLE_RATE of the host's
+ * clock, so the UsbAudio rings stay at their fill and neither side needs a sample rate converter.
+ *
+ * When the frames stop (no host, a suspended bus) or the phase runs away, the trim goes back to zero
+ * and the lock starts again with the next frames.
+ *
+ * @note Reading the frame number acknowledges the SOF interrupt, the sync waits while TinyUSB has that interrupt enabled.
+ *       Only with the USB audio (KASTLE2_USB_AUDIO), otherwise it does nothing.
+ */
+class AudioClockSync
+{
+public:
+    /**
+     * @brief Blocks per window, about a second.
+     */
+    static constexpr uint32_t kWindowBlocks = static_cast<uint32_t>(I2S_SAMPLE_RATE) / I2S::kAudioBufferSize;
+
+    /**
+     * @brief Largest trim, the USB frames of a host are within 500 ppm.
+     */
+    static constexpr int32_t kMaxTrimPpb = 500000;
+
+    /**
+     * @brief Counts the frames of a block against the USB frames, called by the audio callback.
+     * @param frames Frames of the block (at I2S_SAMPLE_RATE).
+     */
+    void Block(const size_t frames);
+
+    /**
+     * @brief Updates the trim after each window, call from the UI task.
+     * @param i2s The trimmed I2S driver.
+     */
+    void Process(I2S &i2s);
+
+    /**
+     * @brief Whether the I2S follows the USB frames.
+     * @return A window has been measured since the frames started.
+     */
+    bool IsLocked() const
+    {
+        return locked_;
+    }
+
+private:
+    // PI loop gains, ppb per frame of the average phase error (proportional) and per frame each window (integral)
+    static constexpr int32_t kProportionalPpb = 3200;
+    static constexpr int32_t kIntegralPpb = 230;
+
+    // Phase error which restarts the lock, ~45 ms
+    static constexpr int32_t kMaxErrorFrames = 2048;
+
+    // Blocks without a new USB frame before the frames count as stopped, ~15 ms
+    static constexpr uint32_t kMaxSilentBlocks = 16;
+
+    // Audio callback
+    bool started_ = false;        ///< A USB frame has been seen
+    uint32_t usb_frame_ = 0;      ///< Last frame number
+    uint32_t usb_frames_ = 0;     ///< USB frames since the start
+    uint32_t i2s_frames_ = 0;     ///< I2S frames since the start
+    uint32_t silent_blocks_ = 0;  ///< Blocks since the last new frame number
+    int32_t window_sum_ = 0;      ///< Summed phase errors of the window
+    uint32_t window_blocks_ = 0;  ///< Blocks in the window
+
+    // Audio callback -> Process()
+    volatile int32_t closed_error_ = 0;  ///< Average phase error of the last window, 1/16 frames
+    volatile bool closed_ready_ = false; ///< A window is waiting for Process()
+    volatile bool stopped_ = false;      ///< The frames stopped or the phase ran away
+
+    // UI task
+    bool locked_ = false;
+    int32_t integral_ = 0; ///< Frequency part of the trim, ppb
+};
+
+}
@@ -23,15 +23,17 @@ SOFTWARE.
 */
 
 #include "Base.hpp"
+#include <algorithm>
 #include "hardware/watchdog.h"
 #include "common/core/midi/Handler.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/utils.hpp"
 #include "Kastle2.hpp"
 #include "Kastle2_cc.hpp"
 
 using namespace kastle2;
 
-void Base::Init()
+COLDCODE void Base::Init()
 {
     // By default, enable all features
     SetAllFeaturesEnabled(true);
@@ -57,8 +59,10 @@ void Base::Init()
     sequencer_.SetTriggerGeneratorTable(kBaseRhythmTable);
 
     // Set up gains
-    sw_input_gain_ = Q15_HALF;
-    sw_output_gain_ = Q15_MAX;
+    sw_input_gain_ = sw_input_gain_target_ = Q15_HALF;
+    sw_output_gain_ = sw_output_gain_target_ = Q15_MAX;
+    hw_input_gain_ = INT32_MAX;
+    hw_volume_ = INT32_MAX;
     SetMaxVolume(kDefaultMaxVolume);
 
     // POTS
@@ -98,10 +102,13 @@ void Base::Init()
                                                .layer = Hardware::Layer::SETTINGS,
                                                .deadzone = true});
 
-    // Init pots
-    for (auto &pot : pots_)
+    // Init pots, BeforeUiLoop() handles all of them the first time
+    ui_refresh_ = true;
+    cc_dispatch_.Clear();
+    for (auto pot_type : EnumRange<Pot>())
     {
-        pot->Init(AUDIO_LOOP_RATE);
+        pots_[pot_type]->Init(AUDIO_LOOP_RATE);
+        cc_dispatch_.Add(pots_[pot_type]->GetConfig().midi_cc, static_cast<size_t>(pot_type));
     }
 
     // Force changed to init stuff
@@ -111,31 +118,38 @@ void Base::Init()
     // MIDI Out Pots
     midi_pots_[Hardware::Pot::POT_1] = FancyPot::Create({.pot = Hardware::Pot::POT_1,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_1});
+                                                         .midi_output_cc = cc::OUT_POT_1,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_2] = FancyPot::Create({.pot = Hardware::Pot::POT_2,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_2});
+                                                         .midi_output_cc = cc::OUT_POT_2,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_3] = FancyPot::Create({.pot = Hardware::Pot::POT_3,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_3});
+                                                         .midi_output_cc = cc::OUT_POT_3,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_4] = FancyPot::Create({.pot = Hardware::Pot::POT_4,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_4});
+                                                         .midi_output_cc = cc::OUT_POT_4,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_5] = FancyPot::Create({.pot = Hardware::Pot::POT_5,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_5});
+                                                         .midi_output_cc = cc::OUT_POT_5,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_6] = FancyPot::Create({.pot = Hardware::Pot::POT_6,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_6});
+                                                         .midi_output_cc = cc::OUT_POT_6,
+                                                         .midi_output_high_res = true});
     midi_pots_[Hardware::Pot::POT_7] = FancyPot::Create({.pot = Hardware::Pot::POT_7,
                                                          .layer = Hardware::Layer::NORMAL,
-                                                         .midi_output_cc = cc::OUT_POT_7});
+                                                         .midi_output_cc = cc::OUT_POT_7,
+                                                         .midi_output_high_res = true});
     for (auto pot_type : EnumRange<Hardware::Pot>())
     {
         // Init pot
         midi_pots_[pot_type]->Init(AUDIO_LOOP_RATE);
         // Enable pot
-        midi_pots_enabled_.set(static_cast<size_t>(pot_type), true);
+        midi_pots_enabled_.set(pot_type);
     }
 
     // Other LFO stuff
@@ -153,6 +167,7 @@ void Base::Init()
             mono_setting_ = static_cast<Memory::MonoSetting>(mono_setting_byte);
         }
     }
+    SelectPreStage();
     uint8_t sync_setting_byte;
     if (Kastle2::memory.Read8(Memory::ADDR_SYNC_SETTINGS, &sync_setting_byte))
     {
@@ -165,7 +180,6 @@ void Base::Init()
     clock_.LoadFromMemory();
 
     // Default sync stuff
-    prev_reset_ = false;
     sync_thru_ = kBaseSyncThru;
 
     // Settings stuff
@@ -188,16 +202,18 @@ void Base::Init()
 void Base::SetMaxVolume(size_t max_volume)
 {
     max_volume_ = max_volume <= 63 ? max_volume : 63;
+    ui_refresh_ = true;
 }
 
 void Base::SetFeatureEnabled(Feature feature, bool enabled)
 {
-    features_enabled_.set(static_cast<size_t>(feature), enabled);
+    features_enabled_.set(feature, enabled);
+    ui_refresh_ = true;
 }
 
 bool Base::IsFeatureEnabled(Feature feature) const
 {
-    return features_enabled_.test(static_cast<size_t>(feature));
+    return features_enabled_.test(feature);
 }
 
 void Base::SetAllFeaturesEnabled(bool enabled)
@@ -210,14 +226,127 @@ void Base::SetAllFeaturesEnabled(bool enabled)
     {
         features_enabled_.reset(); // Reset all bits to false
     }
+    ui_refresh_ = true;
+}
+
+template <Hardware::Version kVersion, Memory::MonoSetting kMono, bool kEnvelope>
+FASTCODE q15_t Base::PreStage(q15_t *input, const size_t size, const q15_t gain_from, const q15_t gain_to, const q15_t envelope)
+{
+    // Kastle 2 copies the used channel, Citadel mixes both (halved for LEFT, saturated for RIGHT)
+    constexpr bool kCopy = kVersion == Hardware::Version::KASTLE2 && kMono != Memory::MonoSetting::STEREO;
+    constexpr bool kMix = kVersion == Hardware::Version::CITADEL && kMono != Memory::MonoSetting::STEREO;
+
+    // The gain ramps linearly over the block in 16.16, one add per frame (zero step when it doesn't change)
+    int32_t gain_ramp = GainRampStart(gain_from);
+    const int32_t gain_step = GainStep(gain_from, gain_to, size);
+
+    q15_t peak = 0;
+    for (size_t i = 0; i < 2 * size; i += 2)
+    {
+        gain_ramp += gain_step;
+        const int32_t gain = gain_ramp >> 16;
+        q15_t left = 0;
+        q15_t right = 0;
+        if constexpr (!kCopy || kMono == Memory::MonoSetting::LEFT)
+        {
+            left = q15_saturate((input[i] * gain) >> (15 - kInputGainShiftLeft));
+            if constexpr (kEnvelope)
+            {
+                left = q15_saturate((left * envelope) >> 15);
+            }
+        }
+        if constexpr (!kCopy || kMono == Memory::MonoSetting::RIGHT)
+        {
+            right = q15_saturate((input[i + 1] * gain) >> (15 - kInputGainShiftLeft));
+            if constexpr (kEnvelope)
+            {
+                right = q15_saturate((right * envelope) >> 15);
+            }
+        }
+
+        if constexpr (kCopy && kMono == Memory::MonoSetting::LEFT)
+        {
+            right = left;
+        }
+        else if constexpr (kCopy)
+        {
+            left = right;
+        }
+        else if constexpr (kMix && kMono == Memory::MonoSetting::LEFT)
+        {
+            left = right = left / 2 + right / 2;
+        }
+        else if constexpr (kMix)
+        {
+            left = right = q15_add(left, right);
+        }
+
+        input[i] = left;
+        input[i + 1] = right;
+        peak = std::max(peak, std::max(q15_abs(left), q15_abs(right)));
+    }
+    return peak;
+}
+
+template <bool kGain, bool kMix>
+FASTCODE void Base::PostStage(const q15_t *input, q15_t *output, const size_t size, const q15_t gain_from, const q15_t gain_to)
+{
+    int32_t gain_ramp = GainRampStart(gain_from);
+    const int32_t gain_step = GainStep(gain_from, gain_to, size);
+
+    for (size_t i = 0; i < 2 * size; i++)
+    {
+        // Both channels of a frame get the same gain
+        if ((i & 1) == 0)
+        {
+            gain_ramp += gain_step;
+        }
+        q15_t sample = output[i];
+        if constexpr (kGain)
+        {
+            sample = q15_saturate((sample * (gain_ramp >> 16)) >> 15);
+        }
+        if constexpr (kMix)
+        {
+            sample = q15_add(input[i], sample);
+        }
+        output[i] = sample;
+    }
+}
+
+template <bool kEnvelope>
+Base::PreStageFunction Base::FindPreStage() const
+{
+    const bool citadel = Kastle2::hw.GetVersion() == Hardware::Version::CITADEL;
+    switch (mono_setting_)
+    {
+    case Memory::MonoSetting::LEFT:
+        return citadel ? &PreStage<Hardware::Version::CITADEL, Memory::MonoSetting::LEFT, kEnvelope>
+                       : &PreStage<Hardware::Version::KASTLE2, Memory::MonoSetting::LEFT, kEnvelope>;
+    case Memory::MonoSetting::RIGHT:
+        return citadel ? &PreStage<Hardware::Version::CITADEL, Memory::MonoSetting::RIGHT, kEnvelope>
+                       : &PreStage<Hardware::Version::KASTLE2, Memory::MonoSetting::RIGHT, kEnvelope>;
+    default:
+        return &PreStage<Hardware::Version::KASTLE2, Memory::MonoSetting::STEREO, kEnvelope>;
+    }
+}
+
+void Base::SelectPreStage()
+{
+    pre_stage_ = FindPreStage<false>();
+    pre_stage_envelope_ = FindPreStage<true>();
 }
 
 // Ticking LFO and TEMPO in precise timings.
 FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
 {
+    // App control-rate tasks run even with the base features disabled
+    scheduler_.Process();
+
     if (!IsFeatureEnabled(Feature::BASE))
     {
         // If all features are disabled, just return
+        input_peak_ = Q15_MAX;
         return;
     }
 
@@ -232,90 +361,45 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
     //     pot->Process();
     // }
 
-    // Do the input gain
-    q15_scale_buffer(input, sw_input_gain_, kInputGainShiftLeft, 2 * size);
-
     // apply startup volume fade in to avoid clicks in buffer
     if (startup_env_state_ != StartupEnvState::FINISHED)
     {
         startup_env_.Process();
     }
+
+    // The input gain (ramped to the UI loop one), the startup fade, the mono setting and the peak in one pass
+    const q15_t input_gain_from = sw_input_gain_;
+    sw_input_gain_ = sw_input_gain_target_;
     if (startup_env_state_ == StartupEnvState::OUTPUT)
     {
         // Zero input
-        for (uint32_t i = 0; i < 2 * size; i++)
-        {
-            input[i] = 0;
-        }
+        std::fill(input, input + 2 * size, 0);
+        input_peak_ = 0;
     }
-    if (startup_env_state_ == StartupEnvState::INPUT)
+    else if (startup_env_state_ == StartupEnvState::INPUT)
     {
         if (startup_env_.GetState() == AdsrEnv::State::DECAY)
         {
             startup_env_state_ = StartupEnvState::FINISHED;
         }
-        q15_scale_buffer(input, q31_to_q15(startup_env_.GetOutput()), 0, 2 * size);
+        input_peak_ = pre_stage_envelope_(input, size, input_gain_from, sw_input_gain_, q31_to_q15(startup_env_.GetOutput()));
     }
-
-    // MONO SETTING FOR KASTLE2
-    if (Kastle2::hw.GetVersion() == Hardware::Version::KASTLE2)
-    {
-
-        // Copy the left channel into the right
-        if (mono_setting_ == Memory::MonoSetting::LEFT)
-        {
-            for (size_t i = 0; i < size; i++)
-            {
-                input[i * 2 + 1] = input[i * 2];
-            }
-        }
-        // Copy the right channel into the left
-        else if (mono_setting_ == Memory::MonoSetting::RIGHT)
-        {
-            for (size_t i = 0; i < size; i++)
-            {
-                input[i * 2] = input[i * 2 + 1];
-            }
-        }
-    }
-    // MONO SETTING FOR CITADEL
-    else if (Kastle2::hw.GetVersion() == Hardware::Version::CITADEL)
+    else
     {
-        // Halve and mix
-        if (mono_setting_ == Memory::MonoSetting::LEFT)
-        {
-            for (size_t i = 0; i < size; i++)
-            {
-                q15_t mixed = input[i * 2] / 2 + input[i * 2 + 1] / 2;
-                input[i * 2] = mixed;
-                input[i * 2 + 1] = mixed;
-            }
-        }
-        // Mix and clip
-        else if (mono_setting_ == Memory::MonoSetting::RIGHT)
-        {
-            for (size_t i = 0; i < size; i++)
-            {
-                q15_t mixed = q15_add(input[i * 2], input[i * 2 + 1]);
-                input[i * 2] = mixed;
-                input[i * 2 + 1] = mixed;
-            }
-        }
+        input_peak_ = pre_stage_(input, size, input_gain_from, sw_input_gain_, Q15_MAX);
     }
 
     // Update the input loudness indication envelope follower
     if (IsFeatureEnabled(Feature::INPUT_INDICATION))
     {
-        input_envelope_follower_.TrackBlock(input, size * 2);
+        input_envelope_follower_.Track(input_peak_);
     }
 
     // Received Reset, jump to middle of phase
-    bool reset = Kastle2::hw.GetResetIn();
-    if (reset && !prev_reset_)
+    if (reset_in_edges_.Process() > 0)
     {
         lfo_.SetPhase(Q31_ZERO);
     }
-    prev_reset_ = reset;
 
     // Receive the value from the Oscillator as a 32-bit signed integer
     int32_t lfo_value = lfo_.Process();
@@ -329,12 +413,12 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
 
     // Tap tempo
     bool tap_state = Kastle2::hw.GetLayer() == Hardware::Layer::SHIFT &&
-                     Kastle2::hw.GetRawButtonState(Hardware::Button::MODE);
+                     Kastle2::hw.Pressed(Hardware::Button::MODE);
 
     // Set external sync
     bool sync_enabled = sync_setting_ != Memory::SyncSetting::EXTERNAL_DISABLED;
     clock_.SetSyncJackPlugged(sync_enabled && Kastle2::hw.IsSyncInJackProbablyPlugged());
-    bool sync_in = sync_enabled && Kastle2::hw.GetSyncIn();
+    sync_in_edges_.Process(sync_enabled);
 
     // Reset sequencer?
     bool do_cv_update = false;
@@ -347,8 +431,10 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
     }
 
     // Check clock for the new clock tick
-    if (clock_.Process(tap_state, sync_in, clock_midi_pulse_))
+    if (clock_.Process(tap_state, Kastle2::hw.PressedTimeUs(Hardware::Button::MODE), sync_in_edges_))
     {
+        clock_frame_ = clock_.GetTriggerFrame();
+
         // Clock received a reset?
         bool now_reset = clock_.IsNowReset();
         if (now_reset)
@@ -396,10 +482,12 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
             do_cv_update = true;
         }
 
+        // Gate out of the new step
+        PlanGateEdges();
+
         // clocked LFO sync
         lfo_.SyncWithClock();
     }
-    clock_midi_pulse_ = false;
 
     if (lfo_.IsSynced())
     {
@@ -444,11 +532,12 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
         // If externally synced, just copy the input (if sync_thru_ is enabled)
         if (clock_.GetSyncType() == Clock::Sync::EXTERNAL && sync_thru_)
         {
+            output_states_[Hardware::DigitalOutput::SYNC_OUT] = Kastle2::hw.GetSyncIn();
             Kastle2::hw.SetSyncOut(Kastle2::hw.GetSyncIn());
         }
         else
         {
-            Kastle2::hw.SetSyncOut(clock_.GetSyncOutput());
+            ScheduleOutput(Hardware::DigitalOutput::SYNC_OUT, clock_.GetSyncOutput());
         }
     }
 
@@ -474,8 +563,6 @@ FASTCODE void Base::BeforeAudioLoop(q15_t *input, size_t size)
     {
         input_clipping_counter_--;
     }
-
-    midi_number_flasher_.Process();
 }
 
 void Base::UpdateCvOut()
@@ -486,38 +573,92 @@ void Base::UpdateCvOut()
     }
 }
 
+void Base::PlanGateEdges()
+{
+    // Clock ticks are audio blocks
+    const uint32_t step_frames = clock_.GetTargetTicks() * AUDIO_BUFFER_SIZE;
+    const uint32_t step_frame = Kastle2::GetAudioFrame() + clock_frame_;
+
+    std::array<uint32_t, Sequencer::kMaxRatchets> frames;
+    uint32_t gate_frames = 0;
+    const size_t triggers = sequencer_.GetStepTriggerFrames(step_frames, frames, gate_frames);
+    const uint32_t gate_length = std::max<uint32_t>((gate_frames * kBaseGateLength) / 100, 1);
+
+    gate_edges_count_ = 0;
+    gate_edge_next_ = 0;
+    // The gate of the previous step still on (the tempo went up) ends with it
+    if (output_states_[Hardware::DigitalOutput::GATE_OUT])
+    {
+        gate_edges_[gate_edges_count_++] = {.frame = step_frame, .state = false};
+    }
+    for (size_t i = 0; i < triggers; i++)
+    {
+        gate_edges_[gate_edges_count_++] = {.frame = step_frame + frames[i], .state = true};
+        gate_edges_[gate_edges_count_++] = {.frame = step_frame + frames[i] + gate_length, .state = false};
+    }
+}
+
 void Base::UpdateGateOut()
 {
-    bool gate_enabled = clock_.GetPercentageState() < kBaseGateLength;
-    Kastle2::hw.SetGateOut(
-        clock_.IsOutputEnabled() &&
-        gate_enabled &&
-        sequencer_.GetTriggerOutput());
+    if (!clock_.IsOutputEnabled())
+    {
+        gate_edge_next_ = gate_edges_count_;
+        ScheduleOutput(Hardware::DigitalOutput::GATE_OUT, false);
+        return;
+    }
+
+    // The edges of the step falling into this block go out at their frames (ratchets, swing)
+    const uint32_t block_end = Kastle2::GetAudioFrame() + AUDIO_BUFFER_SIZE;
+    while (gate_edge_next_ < gate_edges_count_ &&
+           static_cast<int32_t>(gate_edges_[gate_edge_next_].frame - block_end) < 0)
+    {
+        const GateEdge &edge = gate_edges_[gate_edge_next_++];
+        ScheduleOutputAt(Hardware::DigitalOutput::GATE_OUT, edge.state, edge.frame);
+    }
+}
+
+void Base::ScheduleOutput(const Hardware::DigitalOutput output, const bool state)
+{
+    ScheduleOutputAt(output, state, Kastle2::GetAudioFrame() + clock_frame_);
 }
 
-FASTCODE void Base::AfterAudioLoop(q15_t *input, q15_t *output, size_t size)
+void Base::ScheduleOutputAt(const Hardware::DigitalOutput output, const bool state, const uint32_t frame)
 {
-    if (!IsFeatureEnabled(Feature::BASE))
+    if (output_states_[output] == state)
     {
-        // If all features are disabled, just return
         return;
     }
+    output_states_[output] = state;
+    Kastle2::hw.ScheduleDigitalOut(output, state, Kastle2::AudioFrameToOutputTime(frame));
+}
 
-    // apply sw volume
-    if (sw_output_gain_ != Q15_MAX)
+FASTCODE void Base::AfterAudioLoop(q15_t *input, q15_t *output, size_t size)
+{
+    if (!IsFeatureEnabled(Feature::BASE))
     {
-        q15_scale_buffer(output, sw_output_gain_, 0, 2 * size);
+        // If all features are disabled, just return
+        return;
     }
 
-    // mix in input audio
+    // apply sw volume and mix in input audio, in one pass
     // since the output volume is also harware based,
     // it's not completely independent of the volume control
-    if (IsFeatureEnabled(Feature::AUDIO_CHAIN) && Kastle2::hw.IsAudioInJackProbablyPlugged())
+    // the volume ramps from the previous block to the UI loop one, so the volume rides don't zipper
+    const q15_t output_gain_from = sw_output_gain_;
+    sw_output_gain_ = sw_output_gain_target_;
+    const bool gain = output_gain_from != Q15_MAX || sw_output_gain_ != Q15_MAX;
+    const bool mix = IsFeatureEnabled(Feature::AUDIO_CHAIN) && Kastle2::hw.IsAudioInJackProbablyPlugged();
+    if (gain && mix)
     {
-        for (size_t i = 0; i < 2 * size; i++)
-        {
-            output[i] = q15_add(input[i], output[i]);
-        }
+        PostStage<true, true>(input, output, size, output_gain_from, sw_output_gain_);
+    }
+    else if (gain)
+    {
+        PostStage<true, false>(input, output, size, output_gain_from, sw_output_gain_);
+    }
+    else if (mix)
+    {
+        PostStage<false, true>(input, output, size, output_gain_from, sw_output_gain_);
     }
 
     // apply startup volume fade in (so the user can react to too high volume)
@@ -623,11 +764,45 @@ void Base::LayersHandling()
 
     if (prev_layer_ != Kastle2::hw.GetLayer())
     {
+        Trace::Emit<TraceLevel::EVENT>(TracePoint::BASE_LAYER, static_cast<int32_t>(Kastle2::hw.GetLayer()), static_cast<int32_t>(prev_layer_));
         prev_layer_timer_ = layer_timer_;
         layer_timer_ = 0;
     }
 }
 
+EnumBitset<Base::UiEvent> Base::CollectUiEvents()
+{
+    EnumBitset<UiEvent> events;
+    if (ui_refresh_)
+    {
+        events.set();
+        ui_refresh_ = false;
+    }
+
+    // The layers and settings act on the edges, and count the ticks of both buttons held
+    if (Kastle2::hw.HasButtonEdges() ||
+        (Kastle2::hw.Pressed(Hardware::Button::SHIFT) && Kastle2::hw.Pressed(Hardware::Button::MODE)))
+    {
+        events.set(UiEvent::BUTTONS);
+    }
+
+    const auto changed = [&events](const UiEvent event, const int32_t value, int32_t &last)
+    {
+        if (value != last)
+        {
+            last = value;
+            events.set(event);
+        }
+    };
+    changed(UiEvent::INPUT_GAIN, pots_[Pot::INPUT]->GetValue(), ui_input_pot_);
+    changed(UiEvent::OUTPUT_GAIN, pots_[Pot::OUTPUT]->GetValue(), ui_output_pot_);
+    changed(UiEvent::TEMPO, pots_[Pot::TEMPO]->GetValue(), ui_tempo_pot_);
+    changed(UiEvent::LFO, pots_[Pot::LFO]->GetValue(), ui_lfo_inputs_[0]);
+    changed(UiEvent::LFO, pots_[Pot::LFO_MOD]->GetValue(), ui_lfo_inputs_[1]);
+    changed(UiEvent::LFO, Kastle2::hw.GetAnalogValue(Hardware::AnalogInput::PARAM_2), ui_lfo_inputs_[2]);
+    return events;
+}
+
 void Base::BeforeUiLoop()
 {
     if (!IsFeatureEnabled(Feature::BASE))
@@ -641,58 +816,142 @@ void Base::BeforeUiLoop()
     {
         pot->ReadValue();
     }
-    for (auto pot_type : EnumRange<Hardware::Pot>())
+    for (auto pot_type : midi_pots_enabled_)
     {
-        if (midi_pots_enabled_.test(static_cast<size_t>(pot_type)))
-        {
-            midi_pots_[pot_type]->ReadValue();
-        }
+        midi_pots_[pot_type]->ReadValue();
     }
 
+    // Only what changed is handled, the idle loop is a few compares and the LEDs
+    const EnumBitset<UiEvent> events = CollectUiEvents();
+
     // Switch layers
-    LayersHandling();
+    if (events.test(UiEvent::BUTTONS))
+    {
+        LayersHandling();
+    }
+    else
+    {
+        // What LayersHandling() does with both buttons released and no edges
+        settings_toggled_ = false;
+        shift_and_mode_pressed_count_ = 0;
+        prev_layer_ = Kastle2::hw.GetLayer();
+    }
+
+    UpdateGains(events);
+
+    // Input envelope follower from ENV out by default
+    if (IsFeatureEnabled(Feature::ENV_OUT))
+    {
+        // downsize to 10 bits - resolution of the DAC)
+        Kastle2::hw.SetEnvOut(input_envelope_follower_.GetEnvelope() >> (15 - 10));
+    }
+
+    // TEMPO
+    if (events.test(UiEvent::TEMPO))
+    {
+        clock_.SetPot(pots_[Pot::TEMPO]->GetValue());
+    }
+
+    UpdateLfo(events);
+
+    // Generate triggers/rhytmhs
+    if (pots_[Pot::RHYTHM]->HasChanged())
+    {
+        sequencer_.GenerateTriggersUsingTable(
+            pot_to_q15(pots_[Pot::RHYTHM]->GetValue()));
+    }
+
+    leds_should_be_off_ = shift_and_mode_pressed_count_ > 1000;
+
+    ShowLeds();
+
+    // Clipping counter (visible across all layers)
+    if (input_envelope_follower_.GetEnvelope() > q15(0.9f))
+    {
+        input_clipping_counter_ = kClippingShowTicks;
+    }
+
+    UpdateSyncLinkRole();
 
+    // Settings layer stuff
+    SettingsLayer(events);
+
+    // Memory clear (Factory reset)
+    if (shift_and_mode_pressed_count_ > kBaseTicksClearMemory)
+    {
+        FactoryReset();
+    }
+}
+
+void Base::UpdateSyncLinkRole()
+{
+    // The passed through sync jack goes out as it comes, the master couldn't lead its pulses
+    SyncLink::Role role = SyncLink::Role::OFF;
+    if (IsFeatureEnabled(Feature::MIDI_CLOCK) && sync_setting_ != Memory::SyncSetting::MIDI_DISABLED)
+    {
+        switch (clock_.GetSyncType())
+        {
+        case Clock::Sync::MIDI:
+            role = SyncLink::Role::FOLLOWER;
+            break;
+        case Clock::Sync::EXTERNAL:
+            role = sync_thru_ ? SyncLink::Role::OFF : SyncLink::Role::MASTER;
+            break;
+        default:
+            role = SyncLink::Role::MASTER;
+            break;
+        }
+    }
+    if (role != Kastle2::sync_link.GetRole())
+    {
+        Kastle2::sync_link.SetRole(role);
+    }
+}
+
+void Base::UpdateGains(const EnumBitset<UiEvent> events)
+{
     // INPUT AND OUTPUT GAINS
     // Combining software volume and codec setting
 
     // INPUT
-    if (IsFeatureEnabled(Feature::INPUT_GAIN))
+    if (IsFeatureEnabled(Feature::INPUT_GAIN) && events.test(UiEvent::INPUT_GAIN))
     {
         uint32_t input_pot = pots_[Pot::INPUT]->GetValue();
-        Kastle2::codec.SetInputGain(input_pot >> 6); // hw gain
-        sw_input_gain_ = pot_to_q15(input_pot);      // sw gain
+        // hw gain, written to the codec only when the step changes (with a bit of hysteresis against pot noise)
+        const int32_t hw_input_gain = hw_input_gain_;
+        if (sticky_map(input_pot, POT_MIN, POT_MAX, 0, kMaxInputGain, hw_input_gain_, kCodecGainHysteresis) != hw_input_gain)
+        {
+            Kastle2::codec.SetInputGain(hw_input_gain_);
+        }
+        sw_input_gain_target_ = pot_to_q15(input_pot); // sw gain, ramped in the audio loop
     }
 
     // OUTPUT
-    if (IsFeatureEnabled(Feature::OUTPUT_GAIN))
+    if (IsFeatureEnabled(Feature::OUTPUT_GAIN) && events.test(UiEvent::OUTPUT_GAIN))
     {
         uint32_t output_pot = pots_[Pot::OUTPUT]->GetValue();
         if (output_pot < POT_HALF)
         {
             // if less than half, apply digital volume lowering of the volume
-            sw_output_gain_ = pot_to_q15(output_pot * 2);
+            sw_output_gain_target_ = pot_to_q15(output_pot * 2);
         }
         else
         {
-            sw_output_gain_ = Q15_MAX; // sw to max
+            sw_output_gain_target_ = Q15_MAX; // sw to max
         }
         // scaling 0-1023 into 0-52 range (63 is the max, but we don't want to go that high)
         // POT_MAX + 10 to prevent noise when pot all the way to the max
-        uint32_t hp_volume = map(output_pot, POT_MIN, POT_MAX + 10, 0, max_volume_);
-        Kastle2::codec.SetHpVolume(hp_volume); // hw
-    }
-
-    // Input envelope follower from ENV out by default
-    if (IsFeatureEnabled(Feature::ENV_OUT))
-    {
-        // downsize to 10 bits - resolution of the DAC)
-        Kastle2::hw.SetEnvOut(input_envelope_follower_.GetEnvelope() >> (15 - 10));
+        // hw, written only when the step changes
+        const int32_t hw_volume = hw_volume_;
+        if (sticky_map(output_pot, POT_MIN, POT_MAX + 10, 0, max_volume_, hw_volume_, kCodecGainHysteresis) != hw_volume)
+        {
+            Kastle2::codec.SetHpVolume(hw_volume_);
+        }
     }
+}
 
-    // TEMPO
-    uint32_t tempo_pot = pots_[Pot::TEMPO]->GetValue();
-    clock_.SetPot(tempo_pot);
-
+void Base::UpdateLfo(const EnumBitset<UiEvent> events)
+{
     // LFO
     int32_t lfo_mod = pots_[Pot::LFO_MOD]->GetValue() - POT_HALF;
     int32_t lfo_pot = pots_[Pot::LFO]->GetValue();
@@ -707,9 +966,14 @@ void Base::BeforeUiLoop()
         lfo_sync_ = true;
     }
 
-    // LFO in free mode (non-synced)
+    // LFO in free mode (non-synced), a function of the pots and the CV only
     if (!lfo_sync_)
     {
+        if (!events.test(UiEvent::LFO) && !lfo_.IsSynced())
+        {
+            return;
+        }
+
         float freq = curve_map(lfo_pot, kBaseLfoMap);
 
         // Apply mod (proper 1V/Oct)
@@ -790,16 +1054,10 @@ void Base::BeforeUiLoop()
         lfo_.DisableSlowingDown(lfo_self_patched_ >= 1);
         lfo_.SetRatio(kBaseLfoRatios[ratio]);
     }
+}
 
-    // Generate triggers/rhytmhs
-    if (pots_[Pot::RHYTHM]->HasChanged())
-    {
-        sequencer_.GenerateTriggersUsingTable(
-            pot_to_q15(pots_[Pot::RHYTHM]->GetValue()));
-    }
-
-    leds_should_be_off_ = shift_and_mode_pressed_count_ > 1000;
-
+void Base::ShowLeds()
+{
     if (Kastle2::hw.HasLedsJustUpdated())
     {
         fake_blinker_.Process();
@@ -886,17 +1144,17 @@ void Base::BeforeUiLoop()
             Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::NONE);
         }
     }
+}
 
-    // Clipping counter (visible across all layers)
-    if (input_envelope_follower_.GetEnvelope() > q15(0.9f))
-    {
-        input_clipping_counter_ = kClippingShowTicks;
-    }
-
-    // Settings layer stuff
+void Base::SettingsLayer(const EnumBitset<UiEvent> events)
+{
     if (Kastle2::hw.GetLayer() == Hardware::Layer::SETTINGS)
     {
-        MidiAdvancedSettings();
+        // The learning and tapping only follow the buttons (and the MODE hold)
+        if (events.test(UiEvent::BUTTONS) || Kastle2::hw.Pressed(Hardware::Button::MODE))
+        {
+            MidiAdvancedSettings();
+        }
 
         // Other settings
         Memory::MonoSetting prev_mono_setting = mono_setting_;
@@ -938,6 +1196,7 @@ void Base::BeforeUiLoop()
         if (prev_mono_setting != mono_setting_)
         {
             Kastle2::memory.Write8(Memory::ADDR_MONO_SETTINGS, static_cast<unsigned int>(mono_setting_));
+            SelectPreStage();
         }
         if (prev_sync_setting != sync_setting_)
         {
@@ -978,38 +1237,37 @@ void Base::BeforeUiLoop()
         Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::NONE);
         Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::ApplyBrightness(sync_color, brightness));
     }
+}
 
-    // Memory clear (Factory reset)
-    if (shift_and_mode_pressed_count_ > kBaseTicksClearMemory)
+COLDCODE void Base::FactoryReset()
+{
+    sleep_ms(200);
+    if (Kastle2::memory.WriteDefaultSettings())
     {
-        sleep_ms(200);
-        if (Kastle2::memory.WriteDefaultSettings())
+        if (Kastle2::app != nullptr)
         {
-            if (Kastle2::app != nullptr)
-            {
-                Kastle2::app->MemoryInitialization();
-            }
-            // Blink all LEDs green until both buttons are released
-            while (Kastle2::hw.GetRawButtonState(Hardware::Button::SHIFT) || Kastle2::hw.GetRawButtonState(Hardware::Button::MODE))
-            {
-                Kastle2::hw.SetLed(Hardware::Led::LED_1, WS2812::GREEN);
-                Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::GREEN);
-                Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::GREEN);
-                Kastle2::hw.LatchLeds();
-                sleep_ms(200);
-                Kastle2::hw.SetLed(Hardware::Led::LED_1, WS2812::NONE);
-                Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::NONE);
-                Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::NONE);
-                Kastle2::hw.LatchLeds();
-                sleep_ms(200);
-            }
+            Kastle2::app->MemoryInitialization();
         }
-        else
+        // Blink all LEDs green until both buttons are released
+        while (Kastle2::hw.GetRawButtonState(Hardware::Button::SHIFT) || Kastle2::hw.GetRawButtonState(Hardware::Button::MODE))
         {
-            Kastle2::hw.ShowStartupMessage(Hardware::StartupMessage::EEPROM_INIT_FAIL);
+            Kastle2::hw.SetLed(Hardware::Led::LED_1, WS2812::GREEN);
+            Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::GREEN);
+            Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::GREEN);
+            Kastle2::hw.LatchLeds();
+            sleep_ms(200);
+            Kastle2::hw.SetLed(Hardware::Led::LED_1, WS2812::NONE);
+            Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::NONE);
+            Kastle2::hw.SetLed(Hardware::Led::LED_3, WS2812::NONE);
+            Kastle2::hw.LatchLeds();
+            sleep_ms(200);
         }
-        watchdog_reboot(0, 0, 10);
     }
+    else
+    {
+        Kastle2::hw.ShowStartupMessage(Hardware::StartupMessage::EEPROM_INIT_FAIL);
+    }
+    watchdog_reboot(0, 0, 10);
 }
 
 void Base::AfterUiLoop()
@@ -1033,11 +1291,12 @@ void Base::AfterUiLoop()
             Kastle2::hw.SetLed(Hardware::Led::LED_2, WS2812::ORANGE);
             break;
         }
-        // This actually overrides the value set by the app
-        if (midi_number_flasher_.IsActive())
-        {
-            Kastle2::hw.SetLed(Hardware::Led::LED_2, midi_number_flasher_.GetLedState() ? WS2812::ORANGE : WS2812::NONE);
-        }
+    }
+    else if (midi_channel_flashing_)
+    {
+        // The flashed channel plays over the app's LED, only in the settings
+        Kastle2::hw.StopLedAnimation(Hardware::Led::LED_2);
+        midi_channel_flashing_ = false;
     }
 
     // Show red clipping LED in non-SHIFT layers
@@ -1051,7 +1310,7 @@ void Base::AfterUiLoop()
     }
 }
 
-void Base::MidiAdvancedSettings()
+COLDCODE void Base::MidiAdvancedSettings()
 {
     // MIDI LEARN
 
@@ -1072,7 +1331,7 @@ void Base::MidiAdvancedSettings()
         // Stop MIDI learn
         if (Kastle2::midi.StopLearning())
         {
-            midi_number_flasher_.FlashNumber(Kastle2::midi.GetChannel() + 1);
+            FlashMidiChannel();
         }
     }
 
@@ -1101,18 +1360,37 @@ void Base::MidiAdvancedSettings()
                 // -1 because MIDI channels are 0-15, but we tap 1-16
                 if (Kastle2::midi.SetChannel(midi_channel_taps_ - 1))
                 {
-                    midi_number_flasher_.FlashNumber(Kastle2::midi.GetChannel() + 1);
+                    FlashMidiChannel();
                 }
             }
         }
     }
 }
 
+void Base::FlashMidiChannel()
+{
+    // Rendered with the LED frames, over the learn LED (it's blank between the flashes)
+    Kastle2::hw.PlayLedAnimation(Hardware::Led::LED_2,
+                                 LedAnimator::Animation::FlashNumber(WS2812::ORANGE, WS2812::NONE, Kastle2::midi.GetChannel() + 1));
+    midi_channel_flashing_ = true;
+}
+
 void Base::MidiCallback(midi::Message *msg)
 {
-    for (auto &pot : pots_)
+    if (msg->IsControlChange())
     {
-        pot->MidiCallback(msg);
+        if (msg->GetData1() == cc::RESET_CONTROLLERS)
+        {
+            for (auto &pot : pots_)
+            {
+                pot->ClearMidi();
+            }
+        }
+        else
+        {
+            cc_dispatch_.ForEach(msg->GetData1(), [this, msg](const size_t pot)
+                                 { pots_[static_cast<Pot>(pot)]->MidiCallback(msg); });
+        }
     }
 
     if (IsFeatureEnabled(Feature::MIDI_CLOCK) &&
@@ -1129,7 +1407,7 @@ void Base::MidiCallback(midi::Message *msg)
             {
                 if (msg->IsClock())
                 {
-                    clock_midi_pulse_ = true;
+                    clock_.AddMidiPulse(msg->GetTime() != 0 ? msg->GetTime() : time_us_32());
                 }
                 if (msg->IsStart())
                 {
@@ -1157,6 +1435,11 @@ Clock &Base::GetClock()
     return clock_;
 }
 
+ControlScheduler &Base::GetScheduler()
+{
+    return scheduler_;
+}
+
 Sequencer &Base::GetSequencer()
 {
     return sequencer_;
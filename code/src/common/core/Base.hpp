@@ -24,14 +24,18 @@ SOFTWARE.
 
 #pragma once
 
-#include <bitset>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include "common/controls/CcDispatch.hpp"
 #include "common/controls/FancyPot.hpp"
 #include "common/core/Clock.hpp"
 #include "common/core/Codec.hpp"
+#include "common/core/Divider.hpp"
+#include "common/core/ControlScheduler.hpp"
 #include "common/core/FakeBlinker.hpp"
 #include "common/core/Hardware.hpp"
+#include "common/core/InputEdges.hpp"
 #include "common/core/Kastle2_parameters.hpp"
 #include "common/core/Memory.hpp"
 #include "common/core/midi/Message.hpp"
@@ -40,8 +44,8 @@ SOFTWARE.
 #include "common/dsp/control/Lfo.hpp"
 #include "common/dsp/math/Fraction.hpp"
 #include "common/dsp/math/math_utils.hpp"
-#include "common/dsp/utility/NumberFlasher.hpp"
 #include "common/dsp/utility/Sequencer.hpp"
+#include "common/dsp/utility/TailTracker.hpp"
 #include "common/fastcode.hpp"
 
 namespace kastle2
@@ -152,6 +156,13 @@ public:
      */
     Lfo &GetLfo();
 
+    /**
+     * Returns the control-rate scheduler, run at the start of every audio block.
+     * Apps register their pots, mode selectors etc. there instead of processing them in AudioLoop.
+     * @return ControlScheduler& Reference to the scheduler.
+     */
+    ControlScheduler &GetScheduler();
+
     /**
      * @brief Set the HP amp output volume in range 0-63. Ideally keep it under 60 to prevent noise etc.
      * @note Default is set by `kDefaultMaxVolume` which is 53.
@@ -211,7 +222,7 @@ public:
      */
     void SetMidiOutPotEnabled(Hardware::Pot pot, bool enabled)
     {
-        midi_pots_enabled_.set(static_cast<size_t>(pot), enabled);
+        midi_pots_enabled_.set(pot, enabled);
     }
 
     /**
@@ -232,6 +243,25 @@ public:
         return input_envelope_follower_;
     }
 
+    /**
+     * @brief Returns the peak of the current input block (after the input gain), measured in BeforeAudioLoop().
+     * @note It stays at Q15_MAX with the BASE feature disabled, as the input isn't measured then.
+     * @return q15_t The loudest sample of both channels.
+     */
+    inline q15_t GetInputPeak() const
+    {
+        return input_peak_;
+    }
+
+    /**
+     * @brief Returns true when the current input block is below the noise floor, so the effects can bypass.
+     * @see TailTracker
+     */
+    inline bool IsInputSilent() const
+    {
+        return input_peak_ < TailTracker::kSilenceFloor;
+    }
+
 private:
     // How much amplify the input volume
     static constexpr int8_t kInputGainShiftLeft = 3;
@@ -248,9 +278,11 @@ private:
     uint32_t lfo_change_timer_ = 0;
     bool lfo_last_timer_source_ = false;
 
+    // Control-rate tasks of the app
+    ControlScheduler scheduler_;
+
     // Main tempo of the device
     Clock clock_;
-    bool clock_midi_pulse_ = false;
 
     // Fake blinker to prevent interferences when LFO/Tempo is too fast
     FakeBlinker fake_blinker_;
@@ -259,12 +291,39 @@ private:
     void UpdateCvOut();
     void UpdateGateOut();
 
+    /**
+     * @brief Schedules the output edge at the frame of the last clock tick, so it goes out with the audio
+     *        and the pulses keep their length. Only the changes are scheduled.
+     */
+    void ScheduleOutput(const Hardware::DigitalOutput output, const bool state);
+
+    /**
+     * @brief Schedules the output edge at the given audio frame, only the changes are scheduled.
+     */
+    void ScheduleOutputAt(const Hardware::DigitalOutput output, const bool state, const uint32_t frame);
+    EnumArray<Hardware::DigitalOutput, bool> output_states_ = {};
+    uint32_t clock_frame_ = 0; // Frame of the last clock tick within its block
+
+    /**
+     * @brief Gate out edges of the current step (Sequencer::GetStepTriggerFrames()), sent by UpdateGateOut()
+     *        in the block they fall into.
+     */
+    struct GateEdge
+    {
+        uint32_t frame; ///< Audio frame of the edge
+        bool state;     ///< Gate state from the edge on
+    };
+    void PlanGateEdges();
+    std::array<GateEdge, 2 * Sequencer::kMaxRatchets + 1> gate_edges_ = {};
+    size_t gate_edges_count_ = 0;
+    size_t gate_edge_next_ = 0;
+
     // Keeping the value here to handle hysteresis
     bool lfo_sync_ = false;
     uint32_t lfo_pot_ratio_ = 0;
 
     // Features
-    std::bitset<static_cast<unsigned int>(Feature::COUNT)> features_enabled_;
+    EnumBitset<Feature> features_enabled_;
 
     // Current LFO 10-bits value (0-1023)
     uint32_t lfo_triangle_value_ = 0;
@@ -275,9 +334,17 @@ private:
     Sequencer sequencer_;
     EdgeDetector sequencer_edge_detector_{EdgeDetector::Type::RISING};
 
-    // Volumes
+    // Volumes, set by the UI loop (target), each audio block ramps from the gain of the previous block to them
     q15_t sw_input_gain_ = 0;
     q15_t sw_output_gain_ = 0;
+    q15_t sw_input_gain_target_ = 0;
+    q15_t sw_output_gain_target_ = 0;
+
+    // Codec gain steps (sticky_map state), the codec is written only when they change
+    static constexpr int32_t kMaxInputGain = 63;
+    static constexpr int32_t kCodecGainHysteresis = 16;
+    int32_t hw_input_gain_ = INT32_MAX;
+    int32_t hw_volume_ = INT32_MAX;
 
     AdsrEnv startup_env_;
 
@@ -306,23 +373,96 @@ private:
         COUNT
     };
     EnumArray<Pot, std::unique_ptr<FancyPot>> pots_;
+    CcDispatch<static_cast<size_t>(Pot::COUNT)> cc_dispatch_; // The pots listen to their CCs only
 
     // MIDI Out Pot stuff
     EnumArray<Hardware::Pot, std::unique_ptr<FancyPot>> midi_pots_;
-    std::bitset<static_cast<unsigned int>(Hardware::Pot::COUNT)> midi_pots_enabled_;
+    EnumBitset<Hardware::Pot> midi_pots_enabled_;
 
     // Input states
-    bool prev_reset_ = false;
+    InputEdges reset_in_edges_ = InputEdges(Hardware::DigitalInput::RESET_IN);
+    InputEdges sync_in_edges_ = InputEdges(Hardware::DigitalInput::SYNC_IN);
 
     // Settings (audio, sync)
     Memory::MonoSetting mono_setting_ = Memory::MonoSetting::STEREO;
     Memory::SyncSetting sync_setting_ = Memory::SyncSetting::NONE_DISABLED;
 
+    /**
+     * @brief Input stage of BeforeAudioLoop() in one pass: the input gain, the startup envelope (kEnvelope),
+     *        the mono setting of the hardware version and the peak of the block.
+     * @return Peak of the block
+     */
+    template <Hardware::Version kVersion, Memory::MonoSetting kMono, bool kEnvelope>
+    static q15_t PreStage(q15_t *input, size_t size, q15_t gain_from, q15_t gain_to, q15_t envelope);
+    using PreStageFunction = q15_t (*)(q15_t *input, size_t size, q15_t gain_from, q15_t gain_to, q15_t envelope);
+
+    /**
+     * @brief Output stage of AfterAudioLoop() in one pass: the output gain (kGain) and the input mix (kMix).
+     */
+    template <bool kGain, bool kMix>
+    static void PostStage(const q15_t *input, q15_t *output, size_t size, q15_t gain_from, q15_t gain_to);
+
+    /**
+     * @brief Returns the 16.16 start of a gain ramp, rounded so the last frame gets gain_to exactly.
+     */
+    static constexpr int32_t GainRampStart(const q15_t gain_from)
+    {
+        return (gain_from << 16) + 0x8000;
+    }
+
+    /**
+     * @brief Returns the 16.16 per frame step of a gain ramp over the block.
+     */
+    static inline int32_t GainStep(const q15_t gain_from, const q15_t gain_to, const size_t size)
+    {
+        if (gain_from == gain_to)
+        {
+            return 0;
+        }
+        return Divider::Quotient<int32_t>((gain_to - gain_from) * 65536, static_cast<int32_t>(size));
+    }
+
+    /**
+     * @brief Selects the input stages of the hardware version and mono setting, on each change of the setting.
+     */
+    void SelectPreStage();
+    template <bool kEnvelope>
+    PreStageFunction FindPreStage() const;
+    PreStageFunction pre_stage_ = &PreStage<Hardware::Version::KASTLE2, Memory::MonoSetting::STEREO, false>;
+    PreStageFunction pre_stage_envelope_ = &PreStage<Hardware::Version::KASTLE2, Memory::MonoSetting::STEREO, true>;
+
     // Sync stuff
     bool sync_thru_ = false; // Whether to pass the sync signal through or whether to generate it (dividers/multipliers)
 
     // Layers stuff
     void LayersHandling();
+
+    /**
+     * @brief What changed since the last BeforeUiLoop(), the parts of it for the rest are skipped
+     */
+    enum class UiEvent
+    {
+        BUTTONS,     ///< A button edge, or both buttons held (layers, settings, factory reset)
+        INPUT_GAIN,  ///< The input gain pot
+        OUTPUT_GAIN, ///< The output gain pot
+        TEMPO,       ///< The tempo pot
+        LFO,         ///< The LFO pots or the LFO mod CV (the free running LFO only, the synced one runs each loop)
+        COUNT
+    };
+    EnumBitset<UiEvent> CollectUiEvents();
+    void UpdateGains(EnumBitset<UiEvent> events);
+    void UpdateLfo(EnumBitset<UiEvent> events);
+    void ShowLeds();
+    void UpdateSyncLinkRole(); // SyncLink follows the clock source and the sync settings
+    void SettingsLayer(EnumBitset<UiEvent> events);
+    void FactoryReset();
+
+    // Values handled by the last BeforeUiLoop(), the refresh handles all of them again
+    int32_t ui_input_pot_ = -1;
+    int32_t ui_output_pot_ = -1;
+    int32_t ui_tempo_pot_ = -1;
+    std::array<int32_t, 3> ui_lfo_inputs_ = {-1, -1, -1}; // LFO pot, LFO mod pot, PARAM_2 CV
+    bool ui_refresh_ = true;                               // After Init() and a change of the features or the max volume
     size_t shift_and_mode_pressed_count_ = 0;
     bool settings_toggled_ = false;
     bool leds_should_be_off_ = false;
@@ -333,6 +473,7 @@ private:
     // Input loudness indication
     static constexpr size_t kClippingShowTicks = 300;
     EnvelopeFollower input_envelope_follower_;
+    q15_t input_peak_ = Q15_MAX;
     size_t input_clipping_counter_ = 0;
 
     // Settings stuff
@@ -341,7 +482,8 @@ private:
 
     // MIDI stuff
     void MidiAdvancedSettings();
-    NumberFlasher midi_number_flasher_;
+    void FlashMidiChannel();
+    bool midi_channel_flashing_ = false; // The LED_2 animation is the channel, it belongs to the settings layer
     uint32_t midi_channel_taps_ = 0;
     bool midi_channel_tapping_active = false;
     bool midi_learn_start_allowed_ = false;
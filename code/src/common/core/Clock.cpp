@@ -25,28 +25,18 @@ SOFTWARE.
 #include "Clock.hpp"
 
 #include <cstdint>
-#include <memory>
 #include "common/core/Kastle2.hpp"
 #include "common/core/Kastle2_parameters.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/dsp/math/math_utils.hpp"
 
-#include "common/core/clocks/ExternalClockSource.hpp"
-#include "common/core/clocks/InternalClockSource.hpp"
-#include "common/core/clocks/MidiClockSource.hpp"
-
 namespace kastle2
 {
 
 void Clock::Init(float sample_rate)
 {
-    clocks_[Sync::INTERNAL] = std::make_unique<InternalClockSource>();
-    clocks_[Sync::EXTERNAL] = std::make_unique<ExternalClockSource>();
-    clocks_[Sync::MIDI] = std::make_unique<MidiClockSource>();
-
-    for (auto &clock_impl : clocks_)
-    {
-        clock_impl->Init(sample_rate);
-    }
+    ForEach([sample_rate](auto &clock)
+            { clock.Init(sample_rate); });
     SetSyncType(Sync::INTERNAL);
 }
 
@@ -80,24 +70,26 @@ void Clock::ClearTaps()
 
 void Clock::SetSyncJackPlugged(bool jack_plugged)
 {
-    for (auto &clock_impl : clocks_)
-    {
-        clock_impl->SetSyncJackPlugged(jack_plugged);
-    }
+    ForEach([jack_plugged](auto &clock)
+            { clock.SetSyncJackPlugged(jack_plugged); });
 }
 
-bool Clock::Process(bool raw_tap_input, bool raw_sync_input, bool midi_pulse_input)
+void Clock::AddMidiPulse(const uint32_t time_us)
+{
+    midi_clock_.AddPulse(Kastle2::TimeToAudioFrame(time_us));
+}
+
+bool Clock::Process(bool raw_tap_input, uint32_t tap_time_us, const InputEdges &sync_input)
 {
     now_reset_ = false;
 
-    for (auto &clock_impl : clocks_)
-    {
-        clock_impl->Process(raw_sync_input, midi_pulse_input);
-    }
+    ForEach([&sync_input](auto &clock)
+            { clock.Process(sync_input); });
 
     for (Sync type : EnumRange<Sync>())
     {
-        if (clocks_[type]->GetState() != ClockSource::State::UNAVAILABLE)
+        if (Visit(type, [](const auto &clock)
+                  { return clock.GetState(); }) != ClockSource::State::UNAVAILABLE)
         {
             SetSyncType(type);
             break;
@@ -116,7 +108,7 @@ bool Clock::Process(bool raw_tap_input, bool raw_sync_input, bool midi_pulse_inp
         midi_source_ = midi::Message::Source::NONE;
     }
 
-    ProcessTapTempo(raw_tap_input);
+    ProcessTapTempo(raw_tap_input, tap_time_us);
 
     bool now_trigger = IsNowTrigger();
     if (now_trigger)
@@ -138,6 +130,7 @@ bool Clock::Process(bool raw_tap_input, bool raw_sync_input, bool midi_pulse_inp
     {
         now_reset_ = true;
         next_cycle_reset_ = false;
+        Trace::Emit<TraceLevel::EVENT>(TracePoint::CLOCK_RESET, static_cast<int32_t>(sync_type_));
     }
 
     HandleMidiOutClock();
@@ -175,25 +168,22 @@ void Clock::SetPot(int32_t pot_value)
     {
         return;
     }
-    clocks_[sync_type_]->SetPot(pot_value);
+    Visit([pot_value](auto &clock)
+          { clock.SetPot(pot_value); });
     prev_pot_value_ = pot_value;
     pot_state_ = PotState::ACTIVE;
 }
 
 void Clock::LoadFromMemory()
 {
-    for (auto &clock_impl : clocks_)
-    {
-        clock_impl->LoadFromMemory();
-    }
+    ForEach([](auto &clock)
+            { clock.LoadFromMemory(); });
 }
 
 void Clock::SaveToMemory()
 {
-    for (auto &clock_impl : clocks_)
-    {
-        clock_impl->SaveToMemory();
-    }
+    ForEach([](auto &clock)
+            { clock.SaveToMemory(); });
 }
 
 void Clock::SetSyncType(Sync sync_type)
@@ -202,6 +192,7 @@ void Clock::SetSyncType(Sync sync_type)
     {
         return;
     }
+    Trace::Emit<TraceLevel::EVENT>(TracePoint::CLOCK_SYNC_TYPE, static_cast<int32_t>(sync_type), static_cast<int32_t>(sync_type_));
     sync_type_ = sync_type;
     avg_target_ticks_.Reset();
     if (pot_state_ == PotState::ACTIVE)
@@ -210,7 +201,7 @@ void Clock::SetSyncType(Sync sync_type)
     }
 }
 
-void Clock::ProcessTapTempo(bool raw_tap_input)
+void Clock::ProcessTapTempo(bool raw_tap_input, uint32_t tap_time_us)
 {
     if (tap_ticks_ < UINT32_MAX)
     {
@@ -227,16 +218,25 @@ void Clock::ProcessTapTempo(bool raw_tap_input)
         // Prevent boucing etc.Add commentMore actions
         if (tap_ticks_ > kTapTempoMinTicks)
         {
-            clocks_[sync_type_]->TapResetsTicks(tap_state_ == TapState::WAITING_FOR_SECOND_TAP);
+            const bool force = tap_state_ == TapState::WAITING_FOR_SECOND_TAP;
+            Visit([force](auto &clock)
+                  { clock.TapResetsTicks(force); });
+
+            // The period from the press timestamps, the ticks only find the edge
+            const uint32_t frame = Kastle2::TimeToAudioFrame(tap_time_us);
+            const uint32_t period_frames = frame - tap_frame_;
+            tap_frame_ = frame;
 
             // Are we in allowed range?
             if (tap_ticks_ <= kTapTempoMaxTicks && tap_state_ != TapState::NONE)
             {
                 // If so, add to the measurements
-                tap_tempo_values_.Add(tap_ticks_);
+                tap_tempo_values_.Add(period_frames);
                 tap_state_ = TapState::ACTIVE;
-                uint32_t result = tap_tempo_values_.GetAverage() / kTapTempoMultiplier;
-                clocks_[sync_type_]->SetTapTicks(result);
+                uint32_t result = tap_tempo_values_.GetAverage() / (kTapTempoMultiplier * AUDIO_BUFFER_SIZE);
+                Visit([result](auto &clock)
+                      { clock.SetTapTicks(result); });
+                Trace::Emit<TraceLevel::EVENT>(TracePoint::CLOCK_TAP, period_frames, result);
                 pot_state_ = PotState::REQUIRES_THRESHOLD;
             }
             else
@@ -244,6 +244,7 @@ void Clock::ProcessTapTempo(bool raw_tap_input)
                 // If not, reset the measurements
                 ClearTaps();
                 tap_state_ = TapState::WAITING_FOR_SECOND_TAP;
+                Trace::Emit<TraceLevel::EVENT>(TracePoint::CLOCK_TAP, period_frames, 0);
             }
             tap_ticks_ = 0;
         }
@@ -267,7 +268,7 @@ void Clock::HandleMidiOutClock()
     // Send start/stop messages if the clock state changes
     if (sync_type_ == Sync::EXTERNAL)
     {
-        ClockSource::State clock_state = clocks_[Sync::EXTERNAL]->GetState();
+        ClockSource::State clock_state = external_clock_.GetState();
         if (clock_state == ClockSource::State::RUNNING &&
             midi_prev_clock_state_ != ClockSource::State::RUNNING)
         {
@@ -281,26 +282,47 @@ void Clock::HandleMidiOutClock()
         midi_prev_clock_state_ = clock_state;
     }
 
+    // The SyncLink master sends the pulses ahead of their output, those of the next cycle too
+    const uint32_t lead_frames = Kastle2::sync_link.GetLeadFrames();
+    const uint32_t block_frame = Kastle2::GetAudioFrame();
     if (IsNowTrigger())
     {
-        midi_pulses_sent_ = 0;
-        if (IsNowReset())
+        // The pulses sent ahead from the predicted trigger stay, unless the cycle starts again
+        const bool reset = IsNowReset();
+        midi_pulses_sent_ = !reset && midi_pulses_sent_ >= kOutputMidiPulseMultiplier ? midi_pulses_sent_ - kOutputMidiPulseMultiplier : 0;
+        midi_cycle_frame_ = block_frame + GetTriggerFrame();
+        if (reset)
         {
             Kastle2::midi.SendClockReset();
         }
     }
 
-    // Get the divided target MIDI ticks
-    uint32_t target_midi_ticks = GetTargetTicks() / kOutputMidiPulseMultiplier;
-    uint32_t current_ticks = GetCurrentTicks();
-
-    // Check if it's time to send the next MIDI clock pulse
-    if (current_ticks >= midi_pulses_sent_ * target_midi_ticks &&
-        midi_pulses_sent_ < kOutputMidiPulseMultiplier)
+    // The pulses split the cycle evenly from the frame of its trigger, each one computed from the start,
+    // so the block and the division don't round them. Queued with their output time once their frame is rendered.
+    const uint64_t cycle_frames = static_cast<uint64_t>(GetTargetTicks()) * AUDIO_BUFFER_SIZE;
+    const size_t max_pulses = lead_frames > 0 ? 2 * kOutputMidiPulseMultiplier : kOutputMidiPulseMultiplier;
+    const uint32_t lead_us = Kastle2::sync_link.GetLeadUs();
+    while (midi_pulses_sent_ < max_pulses)
     {
-        Kastle2::midi.SendClockPulse();
+        const uint32_t frame = midi_cycle_frame_ +
+                               static_cast<uint32_t>(cycle_frames * midi_pulses_sent_ / kOutputMidiPulseMultiplier);
+        if (static_cast<int32_t>(frame - block_frame) >= static_cast<int32_t>(AUDIO_BUFFER_SIZE + lead_frames))
+        {
+            break;
+        }
+        Kastle2::midi.SendClockPulse(Kastle2::AudioFrameToOutputTime(frame) - lead_us);
         midi_pulses_sent_++;
     }
 }
 
+uint32_t Clock::GetMidiPulsePeriodUs() const
+{
+    if (!IsOutputEnabled() || sync_type_ == Sync::MIDI)
+    {
+        return 0;
+    }
+    const uint64_t pulse_frames = static_cast<uint64_t>(GetTargetTicks()) * AUDIO_BUFFER_SIZE;
+    return static_cast<uint32_t>(pulse_frames * 16 * 1000000 / (kOutputMidiPulseMultiplier * static_cast<uint32_t>(SAMPLE_RATE)));
+}
+
 }
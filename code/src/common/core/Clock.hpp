@@ -24,8 +24,12 @@ SOFTWARE.
 
 #pragma once
 
+#include <utility>
 #include "common/EnumTools.hpp"
 #include "common/core/clocks/ClockSource.hpp"
+#include "common/core/clocks/ExternalClockSource.hpp"
+#include "common/core/clocks/InternalClockSource.hpp"
+#include "common/core/clocks/MidiClockSource.hpp"
 #include "common/core/midi/Message.hpp"
 #include "common/dsp/math/RunningAverage.hpp"
 #include "common/dsp/utility/EdgeDetector.hpp"
@@ -39,11 +43,13 @@ namespace kastle2
  * @brief Wrapper for different clock implementations, handles switching between them and provides a unified interface.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2025-05-21
+ *
+ * The clock sources are members of the final types, the calls go through Visit() (a switch on the sync type),
+ * so they are direct calls the compiler can inline instead of virtual calls on each audio block.
  */
 
 class Clock
 {
-
 public:
     /**
      * @brief Various clock sources with their implementations.
@@ -57,6 +63,69 @@ public:
         COUNT,
     };
 
+private:
+    /**
+     * @brief Calls the function with the clock source of the sync type.
+     * Defined above the inline getters, which need its deduced return type.
+     * @param type Sync type of the clock source.
+     * @param function Called with the source as its final type, so the calls are not virtual.
+     * @return What the function returns.
+     */
+    template <typename Function>
+    inline decltype(auto) Visit(const Sync type, Function &&function)
+    {
+        switch (type)
+        {
+        case Sync::MIDI:
+            return function(midi_clock_);
+        case Sync::EXTERNAL:
+            return function(external_clock_);
+        default:
+            return function(internal_clock_);
+        }
+    }
+
+    template <typename Function>
+    inline decltype(auto) Visit(const Sync type, Function &&function) const
+    {
+        switch (type)
+        {
+        case Sync::MIDI:
+            return function(midi_clock_);
+        case Sync::EXTERNAL:
+            return function(external_clock_);
+        default:
+            return function(internal_clock_);
+        }
+    }
+
+    /**
+     * @brief Calls the function with the current clock source.
+     */
+    template <typename Function>
+    inline decltype(auto) Visit(Function &&function)
+    {
+        return Visit(sync_type_, std::forward<Function>(function));
+    }
+
+    template <typename Function>
+    inline decltype(auto) Visit(Function &&function) const
+    {
+        return Visit(sync_type_, std::forward<Function>(function));
+    }
+
+    /**
+     * @brief Calls the function with each clock source, in the priority order.
+     */
+    template <typename Function>
+    inline void ForEach(Function &&function)
+    {
+        function(midi_clock_);
+        function(external_clock_);
+        function(internal_clock_);
+    }
+
+public:
     /**
      * @brief Tap tempo state handling.
      */
@@ -89,7 +158,8 @@ public:
      */
     inline uint32_t GetTargetTicks() const
     {
-        return clocks_[sync_type_]->GetTargetTicks();
+        return Visit([](const auto &clock)
+                     { return clock.GetTargetTicks(); });
     }
 
     /**
@@ -124,7 +194,8 @@ public:
      */
     inline uint32_t GetCurrentTicks() const
     {
-        return clocks_[sync_type_]->GetCurrentTicks();
+        return Visit([](const auto &clock)
+                     { return clock.GetCurrentTicks(); });
     }
 
     /**
@@ -133,7 +204,8 @@ public:
      */
     inline bool IsReachingNextCycle() const
     {
-        return clocks_[sync_type_]->IsReachingNextCycle();
+        return Visit([](const auto &clock)
+                     { return clock.IsReachingNextCycle(); });
     }
 
     /**
@@ -142,7 +214,9 @@ public:
      */
     inline bool IsNowReset() const
     {
-        return clocks_[sync_type_]->IsNowReset() || now_reset_;
+        return Visit([](const auto &clock)
+                     { return clock.IsNowReset(); }) ||
+               now_reset_;
     }
 
     /**
@@ -151,7 +225,8 @@ public:
      */
     inline ClockSource::State GetState() const
     {
-        return clocks_[sync_type_]->GetState();
+        return Visit([](const auto &clock)
+                     { return clock.GetState(); });
     }
 
     /**
@@ -159,7 +234,8 @@ public:
      */
     inline void Stop()
     {
-        clocks_[sync_type_]->Stop();
+        Visit([](auto &clock)
+              { clock.Stop(); });
     }
 
     /**
@@ -167,7 +243,8 @@ public:
      */
     inline void Start()
     {
-        clocks_[sync_type_]->Start();
+        Visit([](auto &clock)
+              { clock.Start(); });
     }
 
     /**
@@ -175,7 +252,8 @@ public:
      */
     inline void Resume()
     {
-        clocks_[sync_type_]->Resume();
+        Visit([](auto &clock)
+              { clock.Resume(); });
     }
 
     /**
@@ -192,6 +270,17 @@ public:
      */
     bool IsNowTrigger() const;
 
+    /**
+     * @brief Frame of the audio block at which the clock ticked (MIDI clock is placed within the block).
+     * @return Frame offset in the block, valid when IsNowTrigger() is true.
+     * @note Use this in the audio loop, eg. to start a sound exactly on the beat.
+     */
+    inline uint32_t GetTriggerFrame() const
+    {
+        return Visit([](const auto &clock)
+                     { return clock.GetTriggerFrame(); });
+    }
+
     /**
      * @brief Gets the sync out jack (and patchbay) output state.
      * @return Short pulse for sync out jack and patchbay.
@@ -204,6 +293,12 @@ public:
      */
     bool GetHalfDutyOutput() const;
 
+    /**
+     * @brief Period of the MIDI clock pulses this clock sends (the SyncLink tempo).
+     * @return Microseconds with 4 fractional bits, 0 when it doesn't send them (stopped, following the MIDI clock)
+     */
+    uint32_t GetMidiPulsePeriodUs() const;
+
     /**
      * @brief Clears the tap tempo values and resets the tap state.
      */
@@ -218,10 +313,16 @@ public:
     /**
      * @brief The main processing function for the clock.
      * @param raw_tap_input Raw tap input (handled by this class).
-     * @param raw_sync_input Raw sync input (passed to the clock implementation).
-     * @param midi_pulse_input Incoming MIDI pulse input (passed to the clock implementation).
+     * @param tap_time_us time_us_32() time of the last tap press, measures the tapping more precisely than the ticks.
+     * @param sync_input Sync input edges (passed to the clock implementation).
      */
-    bool Process(bool raw_tap_input, bool raw_sync_input, bool midi_pulse_input);
+    bool Process(bool raw_tap_input, uint32_t tap_time_us, const InputEdges &sync_input);
+
+    /**
+     * @brief Passes an incoming MIDI clock pulse to the MIDI clock. Call it in the UI loop (MIDI callback).
+     * @param time_us Arrival time of the pulse, see midi::Message::GetTime()
+     */
+    void AddMidiPulse(uint32_t time_us);
 
     /**
      * @brief Checks if the MIDI source is either same as the current one or not set yet.
@@ -280,10 +381,14 @@ private:
     /**
      * @brief Processes the tap tempo logic.
      * @param raw_tap_input The raw tap input (handled by this class).
+     * @param tap_time_us Time of the last tap press.
      * @note The tapping is "multiplied" by `kTapTempoMultiplier` - runs x-times faster than the tapping.
      */
-    void ProcessTapTempo(bool raw_tap_input);
+    void ProcessTapTempo(bool raw_tap_input, uint32_t tap_time_us);
 
+    /**
+     * @brief Sends the MIDI clock (6 pulses per cycle) and the start/stop, placed at the frames of the pulses.
+     */
     void HandleMidiOutClock();
 
     // Shared stuff
@@ -296,19 +401,22 @@ private:
 
     // Clocks
     Sync sync_type_ = Sync::COUNT; ///< Default is COUNT, will be set in Init()
-    EnumArray<Sync, std::unique_ptr<ClockSource>> clocks_;
+    MidiClockSource midi_clock_;
+    ExternalClockSource external_clock_;
+    InternalClockSource internal_clock_;
 
     // Reset state (for sequencer aligning etc.)
     bool now_reset_ = false;
 
     // Averaging (for delays etc)
-    RunningAverage<uint32_t> avg_target_ticks_ = RunningAverage<uint32_t>(8);
+    RunningAverage<uint32_t, 8> avg_target_ticks_;
 
     // Tap tempo stuff
     TapState tap_state_ = TapState::NONE;
     uint32_t tap_ticks_ = 0;
     EdgeDetector tap_edge_ = EdgeDetector(EdgeDetector::Type::RISING);
-    RunningAverage<uint32_t> tap_tempo_values_ = RunningAverage<uint32_t>(8);
+    RunningAverage<uint32_t, 8> tap_tempo_values_; ///< Tap periods in audio frames
+    uint32_t tap_frame_ = 0;                       ///< Audio frame of the last tap
 
     static constexpr int32_t kPotChangeThreshold = 32; ///< The threshold for pot change detection.
 
@@ -318,6 +426,7 @@ private:
     // Midi out stuff
     static constexpr size_t kOutputMidiPulseMultiplier = 6;
     size_t midi_pulses_sent_ = 0;
+    uint32_t midi_cycle_frame_ = 0; // Audio frame of the last trigger, the pulses are placed from it
     bool next_cycle_reset_ = false;
     ClockSource::State midi_prev_clock_state_ = ClockSource::State::UNAVAILABLE;
     Sync prev_sync_type_ = Sync::INTERNAL;
@@ -0,0 +1,134 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "ClockGovernor.hpp"
+#include <algorithm>
+#include "hardware/clocks.h"
+#ifndef KASTLE2_HOST
+#include "hardware/structs/clocks.h"
+#endif
+#include "common/core/StageBalancer.hpp"
+#include "Kastle2.hpp"
+
+using namespace kastle2;
+
+void ClockGovernor::Init()
+{
+    level_ = 0;
+    base_clock_hz_ = clock_get_hz(clk_sys);
+    budget_cycles_ = static_cast<uint32_t>(static_cast<float>(base_clock_hz_) / AUDIO_LOOP_RATE);
+#ifndef KASTLE2_HOST
+    // clk_peri runs from clk_sys by default, keep it on the full frequency
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, base_clock_hz_, base_clock_hz_);
+#endif
+    StageBalancer::InitCore();
+    // The levels down to the first one without exact I2S dividers at this clock and sample rate
+    levels_ = 0;
+    while (levels_ < kLevels && base_clock_hz_ % kDividers[levels_] == 0 &&
+           I2S::IsExactSystemClock(base_clock_hz_ / kDividers[levels_], I2S_SAMPLE_RATE))
+    {
+        i2s_dividers_[levels_] = Kastle2::hw.GetI2S().GetClockDividers(base_clock_hz_ / kDividers[levels_]);
+        levels_++;
+    }
+}
+
+void ClockGovernor::SetEnabled(const bool enabled)
+{
+    window_max_ = 0;
+    window_blocks_ = 0;
+    hold_blocks_ = kHoldBlocks;
+    enabled_ = enabled;
+}
+
+void ClockGovernor::BeginBlock()
+{
+    if (boost_)
+    {
+        boost_ = false;
+        hold_blocks_ = kHoldBlocks;
+        window_max_ = 0;
+        window_blocks_ = 0;
+        if (level_ != 0)
+        {
+            SetLevel(0);
+        }
+    }
+    if (!enabled_ && level_ != 0)
+    {
+        SetLevel(0);
+    }
+    start_ = StageBalancer::Now();
+}
+
+void ClockGovernor::EndBlock()
+{
+    if (!enabled_)
+    {
+        return;
+    }
+
+    const uint32_t cycles = StageBalancer::Since(start_);
+    const uint32_t budget = budget_cycles_ / kDividers[level_];
+    if (level_ != 0 && cycles * 100 > budget * kRaisePercent)
+    {
+        SetLevel(0);
+        hold_blocks_ = kHoldBlocks;
+        window_max_ = 0;
+        window_blocks_ = 0;
+        return;
+    }
+
+    if (hold_blocks_ > 0)
+    {
+        hold_blocks_--;
+        return;
+    }
+
+    // The cycles of a block stay about the same on another clock, the budget scales with it
+    window_max_ = std::max(window_max_, cycles);
+    if (++window_blocks_ < kWindowBlocks)
+    {
+        return;
+    }
+    const size_t next = level_ + 1;
+    if (next < levels_ && window_max_ * 100 < budget_cycles_ / kDividers[next] * kLowerPercent)
+    {
+        SetLevel(next);
+    }
+    window_max_ = 0;
+    window_blocks_ = 0;
+}
+
+void ClockGovernor::SetLevel(const size_t level)
+{
+    level_ = level;
+#ifndef KASTLE2_HOST
+    // The integer divider of clk_sys changes without a glitch, the PIO dividers follow it right away
+    clocks_hw->clk[clk_sys].div = kDividers[level] << CLOCKS_CLK_SYS_DIV_INT_LSB;
+    Kastle2::hw.GetI2S().SetClockDividers(i2s_dividers_[level]);
+    clock_set_reported_hz(clk_sys, GetClockHz());
+    Kastle2::hw.SetSystemClock(GetClockHz());
+#endif
+}
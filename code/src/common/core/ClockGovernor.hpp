@@ -0,0 +1,161 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class ClockGovernor
+ * @ingroup core
+ * @brief Lowers the system clock while the audio load is low, to save the battery.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The PLL stays at SYSTEM_CLOCK_KHZ and clk_sys is divided by one of kDividers, Init() keeps the levels
+ * with exact I2S dividers at the clock and I2S_SAMPLE_RATE (see also scripts/rp2040_freq.py). clk_peri moves
+ * to the PLL directly, so the UART baud rate doesn't change with the level.
+ *
+ * Kastle2::AudioCallback() measures the core 0 cycles of each block (BeginBlock() / EndBlock()):
+ * - A block over kRaisePercent of the budget of the current level goes back to the full clock right away
+ *   and stays there for kHoldBlocks.
+ * - When the busiest block of a kWindowBlocks window would fit in kLowerPercent of the budget
+ *   of the next level, the clock drops by one level.
+ * The switch happens at the start of a block, after the DMA moved to the other buffer,
+ * and the I2S and LED dividers follow it.
+ *
+ * Disabled by default, an app with light (and single core) audio enables it in its Init() and disables it in DeInit().
+ * It calls Boost() before a heavier mode starts, so its first blocks don't run on the low clock.
+ * @note On the lower levels the PWM outputs have a lower carrier, I2C runs slower and the Profiler counts
+ *       the cycles of the lower clock.
+ */
+class ClockGovernor
+{
+public:
+    /**
+     * @brief Dividers of clk_sys, the first one is the full clock.
+     * @note 4 (44 MHz) is exact too, but it leaves the PWM outputs with a 43 kHz carrier.
+     */
+    static constexpr std::array<uint32_t, 2> kDividers = {1, 2};
+    static constexpr size_t kLevels = kDividers.size();
+
+    /**
+     * @brief Block load (percent of the current level budget) which raises the clock to full.
+     */
+    static constexpr uint32_t kRaisePercent = 70;
+
+    /**
+     * @brief The clock drops a level if the busiest block fits in this percent of the next level budget.
+     */
+    static constexpr uint32_t kLowerPercent = 40;
+
+    /**
+     * @brief Blocks measured for one lowering decision (~140 ms).
+     */
+    static constexpr uint32_t kWindowBlocks = 128;
+
+    /**
+     * @brief Blocks on the full clock after a raise or Boost() (~2 s).
+     */
+    static constexpr uint32_t kHoldBlocks = static_cast<uint32_t>(2.0f * AUDIO_LOOP_RATE);
+
+    /**
+     * @brief Moves clk_peri to the PLL and prepares the levels of the current system clock.
+     * @note Call after the I2S is initialized, before the audio starts, and again after ClockPlan::FallBack().
+     */
+    void Init();
+
+    /**
+     * @brief Enables the clock scaling, disabling goes back to the full clock at the next block.
+     */
+    void SetEnabled(const bool enabled);
+
+    /**
+     * @brief Whether the clock scaling is enabled.
+     */
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    /**
+     * @brief Raises the clock to full at the next block and holds it for kHoldBlocks.
+     * @note Can be called from the UI loop, eg. when a heavy mode is selected.
+     */
+    void Boost()
+    {
+        boost_ = true;
+    }
+
+    /**
+     * @brief Applies Boost() or disabling and starts measuring the block, called at the start of the audio callback.
+     */
+    void BeginBlock();
+
+    /**
+     * @brief Measures the block and decides the level for the next ones, called at the end of the audio callback.
+     */
+    void EndBlock();
+
+    /**
+     * @brief Returns the current level (index to kDividers).
+     */
+    size_t GetLevel() const
+    {
+        return level_;
+    }
+
+    /**
+     * @brief Returns the current system clock in Hz.
+     */
+    uint32_t GetClockHz() const
+    {
+        return base_clock_hz_ / kDividers[level_];
+    }
+
+private:
+    void SetLevel(const size_t level);
+
+    std::array<I2S::ClockDividers, kLevels> i2s_dividers_{};
+    uint32_t base_clock_hz_ = SYSTEM_CLOCK_KHZ * 1000;
+    uint32_t budget_cycles_ = 0;
+    size_t levels_ = 1;
+    size_t level_ = 0;
+    volatile bool enabled_ = false;
+    volatile bool boost_ = false;
+    uint32_t start_ = 0;
+    uint32_t window_max_ = 0;
+    uint32_t window_blocks_ = 0;
+    uint32_t hold_blocks_ = 0;
+};
+
+}
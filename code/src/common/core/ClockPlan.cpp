@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "ClockPlan.hpp"
+#include "hardware/clocks.h"
+#ifndef KASTLE2_HOST
+#include "hardware/structs/ssi.h"
+#include "hardware/sync.h"
+#include "hardware/vreg.h"
+#include "pico/stdlib.h"
+#endif
+
+using namespace kastle2;
+
+#ifndef KASTLE2_HOST
+static constexpr uint32_t kVoltageSettleUs = 1000;
+
+static void SetCoreVoltage(const uint32_t millivolts)
+{
+    // The regulator steps by 50 mV from 0.85 V
+    vreg_set_voltage(static_cast<vreg_voltage>(VREG_VOLTAGE_0_85 + (millivolts - 850) / 50));
+}
+#endif
+
+void ClockPlan::Apply()
+{
+#ifndef KASTLE2_HOST
+    const Plan &plan = *Find(SYSTEM_CLOCK_KHZ);
+    // Voltage and flash clock first, they're safe on the boot clock too (the plans only raise them)
+    if (plan.core_mv != kBootCoreMv)
+    {
+        SetCoreVoltage(plan.core_mv);
+        busy_wait_us(kVoltageSettleUs);
+    }
+    if (plan.flash_divider != kBootFlashDivider)
+    {
+        SetFlashDivider(plan.flash_divider);
+    }
+
+    set_sys_clock_pll(plan.vco_hz, plan.post_div1, plan.post_div2);
+#endif
+}
+
+void ClockPlan::FallBack()
+{
+#ifndef KASTLE2_HOST
+    const Plan &plan = *Find(FallbackKhz());
+    set_sys_clock_pll(plan.vco_hz, plan.post_div1, plan.post_div2);
+#endif
+}
+
+uint32_t ClockPlan::MeasureSystemClockKhz()
+{
+#ifndef KASTLE2_HOST
+    return frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS);
+#else
+    return SYSTEM_CLOCK_KHZ;
+#endif
+}
+
+#ifndef KASTLE2_HOST
+void __no_inline_not_in_flash_func(ClockPlan::SetFlashDivider)(const uint32_t divider)
+{
+    const uint32_t interrupts = save_and_disable_interrupts();
+    // Let the current XIP transfer finish, the SSI takes a new divider only while disabled
+    while (ssi_hw->sr & SSI_SR_BUSY_BITS)
+    {
+    }
+    ssi_hw->ssienr = 0;
+    ssi_hw->baudr = divider;
+    ssi_hw->ssienr = 1;
+    restore_interrupts(interrupts);
+}
+#else
+void ClockPlan::SetFlashDivider(const uint32_t)
+{
+}
+#endif
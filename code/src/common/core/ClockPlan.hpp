@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class ClockPlan
+ * @ingroup core
+ * @brief Validated system clock plans (PLL, flash clock and core voltage) with exact I2S dividers.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * SYSTEM_CLOCK_KHZ selects one of kPlans at compile time (APP_SYSTEM_CLOCK_KHZ in the app CMakeLists.txt).
+ * Each plan is checked at compile time: the PLL settings give the clock from the 12 MHz crystal
+ * and the flash clock stays under kMaxFlashKhz. The selected plan needs exact I2S PIO dividers
+ * at I2S_SAMPLE_RATE (see scripts/rp2040_freq.py), not all plans have them at all the rates.
+ *
+ * Apply() in Kastle2::Init() raises the core voltage and slows the flash first, then switches the PLL.
+ * The plans over kNominalKhz are overclocking, Kastle2::StartAudio() checks the clock and the audio timing
+ * against the crystal and falls back to FallbackKhz() (showing Hardware::StartupMessage::I2S_FAIL) when they're off.
+ */
+class ClockPlan
+{
+public:
+    /**
+     * @brief One system clock plan.
+     */
+    struct Plan
+    {
+        uint32_t system_clock_khz; ///< Resulting clk_sys
+        uint32_t vco_hz;           ///< PLL VCO frequency (multiple of the crystal, 750 to 1600 MHz)
+        uint32_t post_div1;        ///< PLL post divider 1 (1 to 7)
+        uint32_t post_div2;        ///< PLL post divider 2 (1 to 7, at most post_div1)
+        uint32_t flash_divider;    ///< SSI clock divider of the XIP flash (even, at least the boot2 one)
+        uint32_t core_mv;          ///< Core voltage in mV (1100 is the reset value)
+    };
+
+    /**
+     * @brief Clock of the released firmware (44 kHz), the ones over it are overclocking.
+     */
+    static constexpr uint32_t kNominalKhz = 176000;
+
+    /**
+     * @brief Validated plans
+     * - 144 MHz: exact for 48 and 96 kHz, the fallback of their builds.
+     * - 176 MHz: 44 kHz.
+     * - 192 MHz: 48 and 96 kHz.
+     * - 220 and 264 MHz: the heavier apps (264 MHz is exact for all three rates).
+     * @note The PLL settings are the ones vcocalc.py of the Pico SDK picks (highest VCO).
+     */
+    static constexpr std::array<Plan, 5> kPlans = {{
+        {144000, 1440000000, 5, 2, 2, 1100},
+        {176000, 1584000000, 3, 3, 2, 1100},
+        {192000, 1536000000, 4, 2, 2, 1150},
+        {220000, 1320000000, 6, 1, 4, 1150},
+        {264000, 1584000000, 6, 1, 4, 1200},
+    }};
+
+    static constexpr uint32_t kCrystalHz = 12000000;
+    static constexpr uint32_t kMaxFlashKhz = 100000;
+    static constexpr uint32_t kBootFlashDivider = 2; ///< PICO_FLASH_SPI_CLKDIV of boot2
+    static constexpr uint32_t kBootCoreMv = 1100;
+
+    /**
+     * @brief Checks the plan against the PLL and flash limits.
+     */
+    static constexpr bool IsValid(const Plan &plan)
+    {
+        const uint32_t clock_hz = plan.system_clock_khz * 1000;
+        return plan.vco_hz % kCrystalHz == 0 && plan.vco_hz >= 750000000 && plan.vco_hz <= 1600000000 &&
+               plan.post_div1 >= 1 && plan.post_div1 <= 7 && plan.post_div2 >= 1 && plan.post_div2 <= plan.post_div1 &&
+               plan.vco_hz / (plan.post_div1 * plan.post_div2) == clock_hz && plan.vco_hz % (plan.post_div1 * plan.post_div2) == 0 &&
+               plan.flash_divider >= kBootFlashDivider && plan.flash_divider % 2 == 0 && plan.system_clock_khz / plan.flash_divider <= kMaxFlashKhz &&
+               plan.core_mv >= 1100 && plan.core_mv <= 1300 && plan.core_mv % 50 == 0;
+    }
+
+    /**
+     * @brief Whether the clock gives exact I2S dividers and whole cycles per sample at I2S_SAMPLE_RATE.
+     */
+    static constexpr bool IsExact(const uint32_t system_clock_khz)
+    {
+        const uint32_t clock_hz = system_clock_khz * 1000;
+        return clock_hz % KASTLE2_SAMPLE_RATE == 0 && I2S::IsExactSystemClock(clock_hz, I2S_SAMPLE_RATE);
+    }
+
+    /**
+     * @brief The highest exact plan up to kNominalKhz, used when an overclocked plan fails the self-test.
+     */
+    static constexpr uint32_t FallbackKhz()
+    {
+        uint32_t fallback = 0;
+        for (const Plan &plan : kPlans)
+        {
+            if (plan.system_clock_khz <= kNominalKhz && IsExact(plan.system_clock_khz))
+            {
+                fallback = std::max(fallback, plan.system_clock_khz);
+            }
+        }
+        return fallback;
+    }
+
+    /**
+     * @brief Whether there is a plan of the clock.
+     */
+    static constexpr bool HasPlan(const uint32_t system_clock_khz)
+    {
+        return std::ranges::any_of(kPlans, [system_clock_khz](const Plan &plan)
+                                   { return plan.system_clock_khz == system_clock_khz; });
+    }
+
+    /**
+     * @brief Returns the plan of the clock, nullptr if there is none.
+     */
+    static constexpr const Plan *Find(const uint32_t system_clock_khz)
+    {
+        for (const Plan &plan : kPlans)
+        {
+            if (plan.system_clock_khz == system_clock_khz)
+            {
+                return &plan;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Whether SYSTEM_CLOCK_KHZ is over kNominalKhz, so StartAudio() runs the self-test.
+     */
+    static constexpr bool IsOverclocked()
+    {
+        return SYSTEM_CLOCK_KHZ > kNominalKhz;
+    }
+
+    /**
+     * @brief Switches from the boot clock to the plan of SYSTEM_CLOCK_KHZ, call first thing at the startup.
+     * @note The voltage and the flash clock are safe for both clocks during the switch.
+     */
+    static void Apply();
+
+    /**
+     * @brief Switches the PLL to FallbackKhz(), after a failed self-test.
+     * @note Keeps the voltage and the flash divider (safe on a lower clock), so it can run while the other core
+     *       executes from the flash. The caller moves the I2S and LED dividers to the new clock.
+     */
+    static void FallBack();
+
+    /**
+     * @brief Measures clk_sys against the crystal with the frequency counter.
+     * @return Measured clock in kHz (SYSTEM_CLOCK_KHZ on the host).
+     */
+    static uint32_t MeasureSystemClockKhz();
+
+private:
+    /**
+     * @brief Sets the SSI divider of the flash, runs from RAM since XIP stops meanwhile.
+     */
+    static void SetFlashDivider(const uint32_t divider);
+};
+
+static_assert(std::ranges::all_of(ClockPlan::kPlans, ClockPlan::IsValid), "Each clock plan needs valid PLL and flash settings");
+static_assert(ClockPlan::HasPlan(SYSTEM_CLOCK_KHZ), "SYSTEM_CLOCK_KHZ needs a plan in ClockPlan::kPlans");
+static_assert(ClockPlan::IsExact(SYSTEM_CLOCK_KHZ), "SYSTEM_CLOCK_KHZ needs exact I2S dividers at I2S_SAMPLE_RATE");
+static_assert(ClockPlan::FallbackKhz() != 0, "I2S_SAMPLE_RATE needs an exact plan up to ClockPlan::kNominalKhz");
+
+}
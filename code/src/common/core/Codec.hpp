@@ -49,16 +49,23 @@ public:
         NAU88C22
     };
 
+    using EqBand = NAU88C22::EqBand;
+    using EqCutoff = NAU88C22::EqCutoff;
+    using EqWidth = NAU88C22::EqWidth;
+    using EqPath = NAU88C22::EqPath;
+    using HighPass = NAU88C22::HighPass;
+
     /**
      * @brief Initializes the codec.
-     * @param i2c_inst_t I2C instance
+     * @param bus I2C bus shared with the EEPROM
+     * @param sample_rate Sample rate of the I2S
      * @return True if the initialization was successful
      */
-    inline bool Init(i2c_inst_t *i2c_inst)
+    inline bool Init(I2cBus &bus, const float sample_rate)
     {
         // Possible autodetection of codec type can be added here in the future...
 
-        bool inited = nau88c22_.Init(i2c_inst);
+        bool inited = nau88c22_.Init(bus, sample_rate);
         if (inited)
         {
             type_ = Type::NAU88C22;
@@ -109,6 +116,83 @@ public:
         }
     }
 
+    /**
+     * @brief Sets one band of the hardware 5-band equalizer.
+     * @param band Band
+     * @param cutoff Cutoff frequency, see the NAU88C22 datasheet
+     * @param gain Gain in dB (-12 to 12)
+     * @param width Bandwidth (bands 2-4 only)
+     */
+    inline void SetEqBand(EqBand band, EqCutoff cutoff, int8_t gain, EqWidth width)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            nau88c22_.SetEqBand(band, cutoff, gain, width);
+            break;
+        }
+    }
+
+    /**
+     * @brief Sets whether the equalizer works on the input or the output.
+     * @param path Input or output
+     */
+    inline void SetEqPath(EqPath path)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            nau88c22_.SetEqPath(path);
+            break;
+        }
+    }
+
+    /**
+     * @brief Sets the hardware high-pass filter of the input, eg. DC blocking instead of doing it in the audio loop.
+     * @param high_pass Off, DC blocking or a cutoff
+     */
+    inline void SetInputHighPass(HighPass high_pass)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            nau88c22_.SetInputHighPass(high_pass);
+            break;
+        }
+    }
+
+    /**
+     * @brief Sets the hardware level control of the input, it takes over the input gain while enabled.
+     * @param enabled True to enable
+     * @param target Target level in range 0-15 (-22.5 to -1.5 dB)
+     * @param limiter True for the limiter mode, false for the level control
+     */
+    inline void SetInputAlc(bool enabled, uint8_t target, bool limiter)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            nau88c22_.SetInputAlc(enabled, target, limiter);
+            break;
+        }
+    }
+
+    /**
+     * @brief Sets the hardware limiter of the output, eg. instead of a limiter in the audio loop.
+     * @param enabled True to enable
+     * @param threshold Threshold in range 0-5 (-1 to -6 dB)
+     * @param boost Gain under the threshold in range 0-12 dB
+     */
+    inline void SetOutputLimiter(bool enabled, uint8_t threshold, uint8_t boost)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            nau88c22_.SetOutputLimiter(enabled, threshold, boost);
+            break;
+        }
+    }
+
     /**
      * @brief When updating volume, zero cross helps to avoid clicks. Disabled by default.
      * @param enabled True to enable, false to disable
@@ -126,6 +210,7 @@ public:
 
     /**
      * @brief Finishes writing to the codec registers. This is called after all the settings are set.
+     *        The changed registers are queued on the I2C bus, it doesn't wait for them.
      */
     inline void Update()
     {
@@ -137,6 +222,35 @@ public:
         }
     }
 
+    /**
+     * @brief Queues a read of the codec ID, doesn't wait for it.
+     * @param job Followed by the caller, IsProbeValid() is valid once it's done
+     * @return false if the bus queue is full
+     */
+    inline bool QueueProbe(I2cBus::Job *job)
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            return nau88c22_.QueueProbe(job);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Checks the codec ID read by QueueProbe().
+     * @return true if the codec answered with its ID
+     */
+    inline bool IsProbeValid() const
+    {
+        switch (type_)
+        {
+        case Type::NAU88C22:
+            return nau88c22_.IsProbeValid();
+        }
+        return false;
+    }
+
 private:
     NAU88C22 nau88c22_;
     Type type_ = Type::NAU88C22;
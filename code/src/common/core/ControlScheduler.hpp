@@ -0,0 +1,184 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class ControlScheduler
+ * @ingroup core
+ * @brief Runs control-rate work (pots, modes, parameter updates) once every N audio blocks.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Tasks are registered with a divisor (1 = every block, 2 = every other block... up to kMaxDivisor).
+ * Each task gets the phase with the least work, so tasks with the same divisor are spread over
+ * the blocks instead of all running in one (eg. 8 pots with divisor 4 run 2 per block).
+ * Kastle2::base runs it at the start of each audio block, before the app's AudioLoop.
+ *
+ * A task running at divisor N is called at GetRate(N), use that when initializing its timing
+ * (eg. `pot->Init(ControlScheduler::GetRate(kPotDivisor))`).
+ *
+ * @note Register the tasks in the app's Init() and Clear() them in DeInit(), while the objects exist.
+ */
+class ControlScheduler
+{
+public:
+    /**
+     * @brief Task function, called with the context given to Add().
+     */
+    using Callback = void (*)(void *context);
+
+    /**
+     * @brief Maximum number of tasks.
+     */
+    static constexpr size_t kMaxTasks = 32;
+
+    /**
+     * @brief Largest divisor. Divisors must be powers of two up to this.
+     */
+    static constexpr size_t kMaxDivisor = 8;
+
+    /**
+     * @brief Rate at which a task with the given divisor is called.
+     * @param divisor Task divisor.
+     * @return Calls per second.
+     */
+    static constexpr float GetRate(const size_t divisor)
+    {
+        return AUDIO_LOOP_RATE / static_cast<float>(divisor);
+    }
+
+    /**
+     * @brief Registers a task.
+     * @param callback Function to call.
+     * @param context Passed to the callback.
+     * @param divisor Run every divisor blocks (1, 2, 4 or 8).
+     * @return False if there is no space left or the divisor is not supported.
+     */
+    bool Add(const Callback callback, void *context, const size_t divisor = 1)
+    {
+        if (count_ >= kMaxTasks || divisor == 0 || divisor > kMaxDivisor || (divisor & (divisor - 1)) != 0)
+        {
+            return false;
+        }
+
+        // Pick the phase whose busiest block has the least tasks
+        uint8_t best_phase = 0;
+        uint8_t best_load = UINT8_MAX;
+        for (size_t phase = 0; phase < divisor; phase++)
+        {
+            uint8_t load = 0;
+            for (size_t block = phase; block < kMaxDivisor; block += divisor)
+            {
+                load = load > load_[block] ? load : load_[block];
+            }
+            if (load < best_load)
+            {
+                best_load = load;
+                best_phase = static_cast<uint8_t>(phase);
+            }
+        }
+        for (size_t block = best_phase; block < kMaxDivisor; block += divisor)
+        {
+            load_[block]++;
+        }
+
+        // Fill the task before making it visible to Process()
+        tasks_[count_] = Task{.callback = callback,
+                              .context = context,
+                              .mask = static_cast<uint8_t>(divisor - 1),
+                              .phase = best_phase};
+        count_ = count_ + 1;
+        return true;
+    }
+
+    /**
+     * @brief Registers a method of an object as a task.
+     * @code
+     * scheduler.Add<FancyPot, &FancyPot::Process>(pot.get(), 4);
+     * @endcode
+     * @param object Object to call the method on.
+     * @param divisor Run every divisor blocks (1, 2, 4 or 8).
+     * @return False if there is no space left or the divisor is not supported.
+     */
+    template <typename T, void (T::*Method)()>
+    bool Add(T *object, const size_t divisor = 1)
+    {
+        return Add([](void *context)
+                   { (static_cast<T *>(context)->*Method)(); },
+                   object,
+                   divisor);
+    }
+
+    /**
+     * @brief Removes all the tasks.
+     */
+    void Clear()
+    {
+        count_ = 0;
+        load_.fill(0);
+    }
+
+    /**
+     * @brief Runs the tasks due in this block. Called once per audio block.
+     */
+    FASTCODE void Process()
+    {
+        const uint8_t block = static_cast<uint8_t>(block_++ % kMaxDivisor);
+        const size_t count = count_;
+        for (size_t i = 0; i < count; i++)
+        {
+            const Task &task = tasks_[i];
+            if ((block & task.mask) == task.phase)
+            {
+                task.callback(task.context);
+            }
+        }
+    }
+
+private:
+    struct Task
+    {
+        Callback callback;
+        void *context;
+        uint8_t mask;  ///< divisor - 1
+        uint8_t phase; ///< Block (modulo divisor) the task runs in
+    };
+
+    std::array<Task, kMaxTasks> tasks_{};
+    volatile size_t count_ = 0;
+    uint32_t block_ = 0;
+    std::array<uint8_t, kMaxDivisor> load_{};
+};
+
+}
@@ -0,0 +1,245 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "Crc.hpp"
+#include <algorithm>
+#include <array>
+#ifndef KASTLE2_HOST
+#include "hardware/dma.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/structs/xip_ctrl.h"
+#endif
+
+using namespace kastle2;
+
+namespace
+{
+
+constexpr std::array<uint32_t, 256> kCrcTable = []
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+#ifndef KASTLE2_HOST
+// The words only pass the sniffer, they all land here
+uint32_t dma_sink;
+
+constexpr uint32_t Reverse(uint32_t value)
+{
+    value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+    value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+    value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+    value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+    return (value >> 16) | (value << 16);
+}
+
+bool IsInFlash(const uint8_t *data)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+    return address >= XIP_MAIN_BASE && address < XIP_NOALLOC_BASE;
+}
+#endif
+
+}
+
+uint32_t Crc::Crc32(const uint8_t *data, size_t size, uint32_t crc)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = kCrcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+uint32_t Crc::Compute(const void *data, size_t size, uint32_t crc)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+#ifndef KASTLE2_HOST
+    int channel;
+    if (Acquire(bytes, size, channel, crc))
+    {
+        const size_t words = size / 4;
+        Transfer(channel, bytes, words);
+        dma_channel_wait_for_finish_blocking(channel);
+        crc = ReadResult();
+        Release(channel);
+        bytes += words * 4;
+        size -= words * 4;
+    }
+#endif
+    return Crc32(bytes, size, crc);
+}
+
+void Crc::Start(const void *data, size_t size)
+{
+    Cancel();
+    data_ = static_cast<const uint8_t *>(data);
+    size_ = size;
+    position_ = 0;
+    result_ = 0;
+    done_ = false;
+    running_ = true;
+#ifndef KASTLE2_HOST
+    if (!Acquire(data_, size_, channel_, 0))
+    {
+        channel_ = -1;
+    }
+#endif
+}
+
+bool Crc::Process()
+{
+    if (!running_)
+    {
+        return done_;
+    }
+
+#ifndef KASTLE2_HOST
+    if (channel_ >= 0)
+    {
+        if (pending_)
+        {
+            if (dma_channel_is_busy(channel_))
+            {
+                return false;
+            }
+            pending_ = false;
+        }
+
+        const size_t words = std::min(kChunkBytes, size_ - position_) / 4;
+        if (words > 0)
+        {
+            Transfer(channel_, data_ + position_, words);
+            position_ += words * 4;
+            pending_ = true;
+            return false;
+        }
+
+        // All the whole words are in, the rest goes through the CPU
+        result_ = ReadResult();
+        Release(channel_);
+        channel_ = -1;
+    }
+#endif
+
+    const size_t bytes = std::min(kChunkBytes, size_ - position_);
+    result_ = Crc32(data_ + position_, bytes, result_);
+    position_ += bytes;
+    if (position_ == size_)
+    {
+        running_ = false;
+        done_ = true;
+    }
+    return done_;
+}
+
+void Crc::Cancel()
+{
+#ifndef KASTLE2_HOST
+    if (channel_ >= 0)
+    {
+        dma_channel_abort(channel_);
+        xip_ctrl_hw->stream_ctr = 0;
+        Release(channel_);
+        channel_ = -1;
+    }
+#endif
+    running_ = false;
+    pending_ = false;
+}
+
+#ifndef KASTLE2_HOST
+bool Crc::Acquire(const uint8_t *data, size_t size, int &channel, uint32_t crc)
+{
+    if (sniffer_busy_ || size < 4 || reinterpret_cast<uintptr_t>(data) % 4 != 0)
+    {
+        return false;
+    }
+    channel = dma_claim_unused_channel(false);
+    if (channel < 0)
+    {
+        return false;
+    }
+    sniffer_busy_ = true;
+
+    // The sniffer computes the CRC of the bit reversed words, so its accumulator is the reversed zlib register
+    dma_sniffer_enable(channel, DMA_SNIFF_CTRL_CALC_VALUE_CRC32R, true);
+    dma_sniffer_set_data_accumulator(Reverse(~crc));
+    return true;
+}
+
+void Crc::Release(int channel)
+{
+    dma_sniffer_disable();
+    dma_channel_unclaim(channel);
+    sniffer_busy_ = false;
+}
+
+void Crc::Transfer(int channel, const uint8_t *data, size_t words)
+{
+    dma_channel_config config = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_sniff_enable(&config, true);
+
+    const void *source = data;
+    if (IsInFlash(data))
+    {
+        // Stop the previous stream and drop what it left in the FIFO, then stream the words
+        xip_ctrl_hw->stream_ctr = 0;
+        while ((xip_ctrl_hw->stat & XIP_STAT_FIFO_EMPTY_BITS) == 0)
+        {
+            (void)xip_ctrl_hw->stream_fifo;
+        }
+        xip_ctrl_hw->stream_addr = reinterpret_cast<uintptr_t>(data);
+        xip_ctrl_hw->stream_ctr = words;
+
+        source = reinterpret_cast<const void *>(XIP_AUX_BASE);
+        channel_config_set_read_increment(&config, false);
+        channel_config_set_dreq(&config, DREQ_XIP_STREAM);
+    }
+    else
+    {
+        channel_config_set_read_increment(&config, true);
+    }
+    dma_channel_configure(channel, &config, &dma_sink, source, words, true);
+}
+
+uint32_t Crc::ReadResult()
+{
+    return ~Reverse(dma_sniffer_get_data_accumulator());
+}
+#endif
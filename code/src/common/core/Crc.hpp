@@ -0,0 +1,138 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace kastle2
+{
+
+/**
+ * @class Crc
+ * @ingroup core
+ * @brief CRC32 (zlib, IEEE 802.3) of the flash or RAM with the RP2040 DMA CRC sniffer.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The DMA reads the data and the sniffer computes the CRC on the way, the CPU only starts the transfers.
+ * The flash is read through the XIP stream FIFO, in continuous bursts instead of a QSPI transaction per word,
+ * and without touching the XIP cache, so a check of the whole user data doesn't slow down the code running from flash.
+ *
+ * - Compute() checksums the data right away, eg. a flash sector.
+ * - Start() and Process() checksum a large region in the background, one chunk per UI loop.
+ * - Crc32() is the CPU version for small buffers.
+ *
+ * There is one sniffer and one XIP stream, so one DMA checksum runs at a time. Compute() falls back to the CPU
+ * while a background checksum runs. The whole words of word aligned data go through the DMA, the rest through
+ * the CPU. Don't write the flash during a background checksum of the flash, finish or Cancel() it first.
+ * The host build uses the CPU version only.
+ */
+class Crc
+{
+public:
+    /**
+     * @brief Bytes checksummed by one Process() call.
+     */
+    static constexpr size_t kChunkBytes = 16 * 1024;
+
+    /**
+     * @brief CRC32 of the data on the CPU.
+     * @param crc CRC32 of the preceding data, to continue a checksum split into parts
+     */
+    static uint32_t Crc32(const uint8_t *data, size_t size, uint32_t crc = 0);
+
+    /**
+     * @brief CRC32 of the data with the DMA, waits for the result.
+     * @param crc CRC32 of the preceding data, to continue a checksum split into parts
+     */
+    static uint32_t Compute(const void *data, size_t size, uint32_t crc = 0);
+
+    /**
+     * @brief Starts a background checksum of the data, Process() then advances it.
+     * Cancels the checksum of this object if one runs. When the DMA is busy with another checksum,
+     * the chunks are checksummed on the CPU.
+     */
+    void Start(const void *data, size_t size);
+
+    /**
+     * @brief Starts the next chunk when the previous one finished, called from the UI loop.
+     * @return true when the checksum is done
+     */
+    bool Process();
+
+    /**
+     * @brief Stops the background checksum and releases the DMA.
+     */
+    void Cancel();
+
+    /**
+     * @brief Returns true while a background checksum runs.
+     */
+    bool IsRunning() const
+    {
+        return running_;
+    }
+
+    /**
+     * @brief Returns true when the last started checksum finished.
+     */
+    bool IsDone() const
+    {
+        return done_;
+    }
+
+    /**
+     * @brief Returns the CRC32 of the last finished checksum.
+     */
+    uint32_t GetResult() const
+    {
+        return result_;
+    }
+
+private:
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    size_t position_ = 0;
+    uint32_t result_ = 0;
+    bool running_ = false;
+    bool done_ = false;
+    // DMA channel of the background checksum, -1 when it runs on the CPU
+    int channel_ = -1;
+    // The DMA transfer of the current chunk is running
+    bool pending_ = false;
+
+#ifndef KASTLE2_HOST
+    static inline bool sniffer_busy_ = false;
+
+    static bool Acquire(const uint8_t *data, size_t size, int &channel, uint32_t crc);
+    static void Release(int channel);
+    static void Transfer(int channel, const uint8_t *data, size_t words);
+    static uint32_t ReadResult();
+#endif
+};
+
+}
@@ -0,0 +1,146 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#ifndef KASTLE2_HOST
+#include "hardware/divider.h"
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class Divider
+ * @ingroup core
+ * @brief Integer divisions on the RP2040 SIO hardware divider, inlined.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The M0+ has no divide instruction, a plain `/` or `%` calls the pico-sdk division routine (__aeabi_idiv),
+ * which uses the same divider but costs a call and its own checks. These do the 8 cycle division in place,
+ * for divisors known only at runtime (buffer lengths, tick counts). Divisions by constants are cheaper
+ * with q15_div_by() or a multiply by the reciprocal.
+ *
+ * The divider is one per core and IRQ handlers use it too. Its unread result is marked dirty, so if
+ * the calling code interrupted a division in progress, the divider state is saved and restored around
+ * ours - the same protocol as the pico-sdk routine, so both can be mixed freely.
+ *
+ * @note Division by zero doesn't fault on the hardware, the result is meaningless. Don't rely on it,
+ *       the host build (plain C++ operators) doesn't survive it.
+ */
+class Divider
+{
+public:
+    struct Result
+    {
+        int32_t quotient;
+        int32_t remainder;
+    };
+
+    struct ResultUnsigned
+    {
+        uint32_t quotient;
+        uint32_t remainder;
+    };
+
+    /**
+     * @brief Signed division, the quotient is rounded towards zero like the `/` operator.
+     */
+    static inline Result DivMod(const int32_t dividend, const int32_t divisor)
+    {
+#ifndef KASTLE2_HOST
+        Result result;
+        hw_divider_state_t state;
+        const bool dirty = sio_hw->div_csr & SIO_DIV_CSR_DIRTY_BITS;
+        if (dirty)
+        {
+            hw_divider_save_state(&state);
+        }
+        sio_hw->div_sdividend = dividend;
+        sio_hw->div_sdivisor = divisor;
+        hw_divider_wait_ready();
+        // Reading the quotient clears the dirty flag, so it goes last
+        result.remainder = static_cast<int32_t>(sio_hw->div_remainder);
+        result.quotient = static_cast<int32_t>(sio_hw->div_quotient);
+        if (dirty)
+        {
+            hw_divider_restore_state(&state);
+        }
+        return result;
+#else
+        return {dividend / divisor, dividend % divisor};
+#endif
+    }
+
+    /**
+     * @brief Unsigned division.
+     */
+    static inline ResultUnsigned DivMod(const uint32_t dividend, const uint32_t divisor)
+    {
+#ifndef KASTLE2_HOST
+        ResultUnsigned result;
+        hw_divider_state_t state;
+        const bool dirty = sio_hw->div_csr & SIO_DIV_CSR_DIRTY_BITS;
+        if (dirty)
+        {
+            hw_divider_save_state(&state);
+        }
+        sio_hw->div_udividend = dividend;
+        sio_hw->div_udivisor = divisor;
+        hw_divider_wait_ready();
+        result.remainder = sio_hw->div_remainder;
+        result.quotient = sio_hw->div_quotient;
+        if (dirty)
+        {
+            hw_divider_restore_state(&state);
+        }
+        return result;
+#else
+        return {dividend / divisor, dividend % divisor};
+#endif
+    }
+
+    /**
+     * @brief Same as `dividend / divisor`.
+     */
+    template <typename T>
+    static inline T Quotient(const T dividend, const T divisor)
+    {
+        return DivMod(dividend, divisor).quotient;
+    }
+
+    /**
+     * @brief Same as `dividend % divisor`.
+     */
+    template <typename T>
+    static inline T Remainder(const T dividend, const T divisor)
+    {
+        return DivMod(dividend, divisor).remainder;
+    }
+};
+
+}
@@ -0,0 +1,90 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "DmaFill.hpp"
+#include <algorithm>
+#include <cstring>
+#ifndef KASTLE2_HOST
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#endif
+
+using namespace kastle2;
+
+DmaFill::Ticket DmaFill::Start(void *buffer, const size_t bytes, const uint8_t value)
+{
+    uint8_t *data = static_cast<uint8_t *>(buffer);
+#ifndef KASTLE2_HOST
+    if (bytes >= kMinBytes)
+    {
+        if (channel_ < 0)
+        {
+            channel_ = dma_claim_unused_channel(false);
+        }
+        else
+        {
+            Wait(ticket_);
+        }
+    }
+
+    if (bytes >= kMinBytes && channel_ >= 0)
+    {
+        // The ends outside the whole words right away, the words by the DMA
+        const size_t head = std::min(bytes, static_cast<size_t>(-reinterpret_cast<uintptr_t>(data) & 3));
+        const size_t words = (bytes - head) / sizeof(uint32_t);
+        const size_t tail = head + words * sizeof(uint32_t);
+        std::memset(data, value, head);
+        std::memset(data + tail, value, bytes - tail);
+
+        // The previous ticket retires before the channel and the geometry change, IsFilled() (from an interrupt too)
+        // reads it as done from here on. Nobody holds the new one until it's returned, when the channel runs already
+        const Ticket ticket = ticket_ + 1;
+        ticket_ = ticket != 0 ? ticket : 1;
+        __dmb();
+
+        head_ = head;
+        words_ = words;
+        word_ = value * 0x01010101u;
+        dma_channel_config config = dma_channel_get_default_config(channel_);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+        channel_config_set_read_increment(&config, false);
+        channel_config_set_write_increment(&config, true);
+        dma_channel_configure(channel_, &config, data + head, &word_, words, true);
+        return ticket_;
+    }
+#endif
+    std::memset(data, value, bytes);
+    return 0;
+}
+
+void DmaFill::Wait(const Ticket ticket)
+{
+    while (!IsDone(ticket))
+    {
+#ifndef KASTLE2_HOST
+        tight_loop_contents();
+#endif
+    }
+}
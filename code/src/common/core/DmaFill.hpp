@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#ifndef KASTLE2_HOST
+#include "hardware/structs/dma.h"
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class DmaFill
+ * @ingroup core
+ * @brief Fills large buffers with a byte in the background, a memset by the RP2040 DMA.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The DMA writes a repeated word from RAM over the buffer at the full bus speed (about 100 kB in half a millisecond),
+ * the caller carries on right away. Start() returns a ticket, IsFilled() tells how far the fill got, so the owner
+ * of the buffer reads the not yet filled part as the fill value (see AdvancedDynamicDelayLine::Reset()).
+ * IsFilled() only reads a register, it's safe from the audio callback and with the flash being written.
+ *
+ * One fill runs at a time on one DMA channel claimed by the first Start(), the next Start() waits for the previous
+ * fill to finish. The unaligned ends, small buffers and everything without a free channel (or on the host)
+ * are filled on the CPU before Start() returns, with the ticket 0 (always filled).
+ * Don't free a buffer of a running fill, Wait() for it first.
+ */
+class DmaFill
+{
+public:
+    using Ticket = uint32_t;
+
+    /**
+     * @brief Buffers below this go through the CPU, the DMA setup isn't worth it.
+     */
+    static constexpr size_t kMinBytes = 256;
+
+    /**
+     * @brief Starts filling the buffer with the value, waits for the fill started before.
+     * @return Ticket of the fill for IsFilled(), 0 when it's done already
+     */
+    static Ticket Start(void *buffer, size_t bytes, uint8_t value = 0);
+
+    /**
+     * @brief Returns true when the first bytes of the ticket's buffer are filled.
+     */
+    static inline bool IsFilled(const Ticket ticket, [[maybe_unused]] const size_t bytes)
+    {
+        // The later fills start when the earlier ones are done
+        if (ticket == 0 || ticket != ticket_)
+        {
+            return true;
+        }
+#ifndef KASTLE2_HOST
+        const uint32_t remaining = dma_hw->ch[channel_].transfer_count;
+        return remaining == 0 || bytes <= head_ + (words_ - remaining) * sizeof(uint32_t);
+#else
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Returns true when the whole buffer of the ticket is filled.
+     */
+    static inline bool IsDone(const Ticket ticket)
+    {
+        return IsFilled(ticket, SIZE_MAX);
+    }
+
+    /**
+     * @brief Waits for the fill of the ticket to finish.
+     */
+    static void Wait(Ticket ticket);
+
+private:
+    static inline volatile Ticket ticket_ = 0;
+    static inline int channel_ = -1;
+    // Bytes filled on the CPU before the DMA words, the words of the DMA transfer
+    static inline size_t head_ = 0;
+    static inline size_t words_ = 0;
+    // The DMA reads the value from here, the whole transfer long
+    static inline uint32_t word_ = 0;
+};
+
+}
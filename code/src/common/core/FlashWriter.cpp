@@ -0,0 +1,261 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "FlashWriter.hpp"
+#include <cstdio>
+#include <cstring>
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#ifndef KASTLE2_HOST
+#include "hardware/regs/addressmap.h"
+#endif
+#include "common/config.hpp"
+#include "common/debug/PostMortem.hpp"
+
+using namespace kastle2;
+
+void FlashWriter::Enable()
+{
+    enabled_ = true;
+    InitCore();
+}
+
+void FlashWriter::InitCore()
+{
+    const uint core = get_core_num();
+    cores_ = cores_ | (1u << core);
+    if (enabled_ && !multicore_lockout_victim_is_initialized(core))
+    {
+        multicore_lockout_victim_init();
+    }
+}
+
+bool FlashWriter::CanWrite()
+{
+    // A running core which can't be parked would execute from the flash being written
+    const uint other_core = get_core_num() ^ 1;
+    return enabled_ && ((cores_ & (1u << other_core)) == 0 || multicore_lockout_victim_is_initialized(other_core));
+}
+
+bool FlashWriter::WriteUserDataSector(const uint32_t offset, const uint8_t *data)
+{
+    if (!CanWrite() || offset % kSectorSize != 0 || offset + kSectorSize > USER_DATA_SECTION_SIZE)
+    {
+        return false;
+    }
+
+    Write(USER_DATA_SECTION_BEGIN - XIP_BASE + offset, data, kSectorSize, true);
+
+    // The sdk flushes the XIP cache, so this reads the new content
+    return memcmp(reinterpret_cast<const void *>(USER_DATA_SECTION_BEGIN + offset), data, kSectorSize) == 0;
+}
+
+bool FlashWriter::ErasePresetSector(const uint32_t offset)
+{
+    if (!CanWrite() || offset % kSectorSize != 0 || offset + kSectorSize > PRESET_SECTION_SIZE)
+    {
+        return false;
+    }
+
+    Write(PRESET_SECTION_BEGIN - XIP_BASE + offset, nullptr, kSectorSize, true);
+
+    const uint8_t *flash = reinterpret_cast<const uint8_t *>(PRESET_SECTION_BEGIN + offset);
+    for (size_t i = 0; i < kSectorSize; i++)
+    {
+        if (flash[i] != 0xFF)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FlashWriter::ProgramPresetPage(const uint32_t offset, const uint8_t *data)
+{
+    if (!CanWrite() || offset % kPageSize != 0 || offset + kPageSize > PRESET_SECTION_SIZE)
+    {
+        return false;
+    }
+
+    Write(PRESET_SECTION_BEGIN - XIP_BASE + offset, data, kPageSize, false);
+
+    // Programming only clears bits, the 0xFF bytes keep what was there
+    const uint8_t *flash = reinterpret_cast<const uint8_t *>(PRESET_SECTION_BEGIN + offset);
+    for (size_t i = 0; i < kPageSize; i++)
+    {
+        if (data[i] != 0xFF && flash[i] != data[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FlashWriter::Write(const uint32_t flash_offset, const uint8_t *data, const size_t size, const bool erase)
+{
+    const bool lockout = IsOtherCoreRunning();
+    if (!lockout && IsAudioSafe())
+    {
+        WriteWithAudio(flash_offset, data, size, erase);
+        return;
+    }
+
+    // The audio stops meanwhile, a long erase would run out the audio deadline
+    PostMortem::Suspend();
+
+    // Interrupts first: an audio interrupt waiting for a job of the parked core would never end
+    const uint32_t interrupts = save_and_disable_interrupts();
+    if (lockout)
+    {
+        multicore_lockout_start_blocking();
+    }
+    if (erase)
+    {
+        flash_range_erase(flash_offset, size);
+    }
+    if (data != nullptr)
+    {
+        flash_range_program(flash_offset, data, size);
+    }
+    if (lockout)
+    {
+        multicore_lockout_end_blocking();
+    }
+    restore_interrupts(interrupts);
+    PostMortem::Resume();
+}
+
+FlashWriter::AudioPath FlashWriter::CheckAudioPath(const uint32_t blocks)
+{
+#ifndef KASTLE2_HOST
+    // The NVIC is per core, the audio interrupt is enabled only on the core which started the audio
+    if (!irq_is_enabled(DMA_IRQ_0))
+    {
+        return audio_path_ = AudioPath::OTHER_CORE;
+    }
+    if (IsOtherCoreRunning())
+    {
+        return audio_path_ = AudioPath::SECOND_CORE;
+    }
+    // The I2S handler runs before AudioBegin(), so it's checked by its address
+    if (!IsInRam(reinterpret_cast<uintptr_t>(irq_get_vtable_handler(DMA_IRQ_0))))
+    {
+        return audio_path_ = AudioPath::FLASH;
+    }
+
+    check_accesses_ = 0;
+    __dmb();
+    check_blocks_ = blocks;
+    const absolute_time_t timeout = make_timeout_time_ms(kCheckTimeoutMs);
+    while (check_blocks_ != 0 && absolute_time_diff_us(get_absolute_time(), timeout) > 0)
+    {
+        tight_loop_contents();
+    }
+    if (check_blocks_ != 0)
+    {
+        check_blocks_ = 0;
+        return audio_path_ = AudioPath::NOT_RUNNING;
+    }
+    // Any access (hit or miss of the XIP cache) would fault or stall while the flash is being written
+    return audio_path_ = check_accesses_ == 0 ? AudioPath::RAM : AudioPath::FLASH;
+#else
+    (void)blocks;
+    return audio_path_ = AudioPath::UNKNOWN;
+#endif
+}
+
+const char *FlashWriter::GetAudioPathName(const AudioPath path)
+{
+    switch (path)
+    {
+    case AudioPath::RAM:
+        return "in RAM, keeps running during the writes";
+    case AudioPath::FLASH:
+        return "reads the flash, stalls during the writes";
+    case AudioPath::SECOND_CORE:
+        return "second core running, stalls during the writes";
+    case AudioPath::NOT_RUNNING:
+        return "not running";
+    case AudioPath::OTHER_CORE:
+        return "on the other core, check from the audio core";
+    default:
+        return "unknown, stalls during the writes";
+    }
+}
+
+void FlashWriter::Process(UsbSerial &serial)
+{
+    if (serial.ReceivedChar('f'))
+    {
+        const AudioPath path = CheckAudioPath();
+        char buff[96];
+        snprintf(buff, sizeof(buff), "Flash writes: audio %s (%lu XIP accesses in %lu blocks)",
+                 GetAudioPathName(path), static_cast<unsigned long>(check_accesses_),
+                 static_cast<unsigned long>(kCheckBlocks));
+        serial.PrintLine(buff);
+    }
+}
+
+bool FlashWriter::IsInRam(const uintptr_t address)
+{
+#ifndef KASTLE2_HOST
+    // The boot ROM is below the flash and never goes away
+    return address < XIP_BASE || (address >= SRAM_BASE && address < SRAM_END);
+#else
+    (void)address;
+    return false;
+#endif
+}
+
+void FlashWriter::WriteWithAudio(const uint32_t flash_offset, const uint8_t *data, const size_t size, const bool erase)
+{
+#ifndef KASTLE2_HOST
+    // The handlers in the flash are held off until the write ends, they run right after it.
+    // The shared handlers are held off too, the chain can have members in the flash.
+    uint32_t held = 0;
+    for (uint irq = 0; irq < NUM_IRQS; irq++)
+    {
+        if (irq_is_enabled(irq) &&
+            (irq_has_shared_handler(irq) || !IsInRam(reinterpret_cast<uintptr_t>(irq_get_vtable_handler(irq)))))
+        {
+            held |= 1u << irq;
+        }
+    }
+    irq_set_mask_enabled(held, false);
+#endif
+    if (erase)
+    {
+        flash_range_erase(flash_offset, size);
+    }
+    if (data != nullptr)
+    {
+        flash_range_program(flash_offset, data, size);
+    }
+#ifndef KASTLE2_HOST
+    irq_set_mask_enabled(held, true);
+#endif
+}
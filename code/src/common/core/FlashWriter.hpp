@@ -0,0 +1,227 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#ifndef KASTLE2_HOST
+#include "hardware/structs/xip_ctrl.h"
+#endif
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class FlashWriter
+ * @ingroup core
+ * @brief Erases and programs the user data and preset sections of the flash while the firmware runs.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The flash can't be read (XIP) while it's being erased or programmed, so the other core is parked
+ * in RAM with the pico-sdk multicore lockout and the interrupts of the writing core are disabled for
+ * the time of each sector (tens of ms, the audio stalls meanwhile).
+ *
+ * The audio keeps running during the writes when its whole path is RAM-resident (FASTCODE, the hot lists,
+ * FASTDATA). CheckAudioPath() measures it: it counts the XIP accesses of the audio callbacks for a while.
+ * If there are none, the writes keep the interrupts with handlers in RAM (the audio) enabled and hold off
+ * only the others. The check needs the audio interrupt on the writing core and no second core, because
+ * a parked core 1 with audio work would block the audio interrupt for good. The check measures the code
+ * paths which run meanwhile, so run it with the app in its usual state (the uploader runs it at the start
+ * of each session). Send 'f' over the debug serial to print the result.
+ *
+ * The lockout takes over the inter-core FIFO interrupt, so it's opt in: an app which writes the flash
+ * calls Enable() in its Init(), before the second core starts, and can't use the MultiCore FIFO messages.
+ */
+class FlashWriter
+{
+public:
+    static constexpr size_t kSectorSize = FLASH_SECTOR_SIZE;
+    static constexpr size_t kPageSize = FLASH_PAGE_SIZE;
+
+    /**
+     * @brief Audio blocks measured by CheckAudioPath().
+     */
+    static constexpr uint32_t kCheckBlocks = 64;
+
+    /**
+     * @brief Wait for the measured blocks before the audio counts as not running.
+     */
+    static constexpr uint32_t kCheckTimeoutMs = 500;
+
+    /**
+     * @brief Result of CheckAudioPath().
+     */
+    enum class AudioPath
+    {
+        UNKNOWN,     ///< Not checked yet, the writes stall the audio (also on the host)
+        RAM,         ///< RAM-resident, the audio keeps running during the writes
+        FLASH,       ///< Reads the flash (code, tables or samples), the writes stall the audio
+        SECOND_CORE, ///< The second core runs, it has to be parked, the writes stall the audio
+        NOT_RUNNING, ///< No audio blocks came during the check
+        OTHER_CORE,  ///< Checked from the core without the audio interrupt
+    };
+
+    /**
+     * @brief Enables the writes, makes the calling core a lockout victim.
+     * @note Call before the second core starts (Kastle2::StartSecondCore or Kastle2::RunUi on CORE_1).
+     */
+    static void Enable();
+
+    /**
+     * @brief Returns true if Enable() was called.
+     */
+    static bool IsEnabled()
+    {
+        return enabled_;
+    }
+
+    /**
+     * @brief Registers the calling core, called by Kastle2 at the start of each core.
+     */
+    static void InitCore();
+
+    /**
+     * @brief Returns true if the flash can be written now (enabled and the other core can be parked).
+     */
+    static bool CanWrite();
+
+    /**
+     * @brief Erases and programs one sector of the user data and verifies it.
+     * @param offset Offset in the user data section, a multiple of kSectorSize.
+     * @param data kSectorSize bytes, must not be in the flash.
+     * @return false if the write is not possible now or the sector doesn't read back the same.
+     */
+    static bool WriteUserDataSector(const uint32_t offset, const uint8_t *data);
+
+    /**
+     * @brief Erases one sector of the preset section (see PresetStore) and checks it's blank.
+     * @param offset Offset in the preset section, a multiple of kSectorSize.
+     * @return false if the erase is not possible now or the sector isn't blank.
+     */
+    static bool ErasePresetSector(const uint32_t offset);
+
+    /**
+     * @brief Programs one page of the preset section without erasing it and verifies it.
+     * @param offset Offset in the preset section, a multiple of kPageSize.
+     * @param data kPageSize bytes, must not be in the flash. 0xFF bytes leave the flash as it is.
+     * @return false if the write is not possible now or the page doesn't read back the same.
+     */
+    static bool ProgramPresetPage(const uint32_t offset, const uint8_t *data);
+
+    /**
+     * @brief Measures whether the audio callbacks run without any flash access, call from the UI loop.
+     * @param blocks Audio blocks to measure.
+     * @return The result, also kept for the writes (GetAudioPath()).
+     */
+    static AudioPath CheckAudioPath(const uint32_t blocks = kCheckBlocks);
+
+    /**
+     * @brief Returns the result of the last CheckAudioPath().
+     */
+    static AudioPath GetAudioPath()
+    {
+        return audio_path_;
+    }
+
+    /**
+     * @brief Returns true if the audio keeps running during the writes.
+     */
+    static bool IsAudioSafe()
+    {
+        return audio_path_ == AudioPath::RAM;
+    }
+
+    /**
+     * @brief Returns a readable description of the result.
+     */
+    static const char *GetAudioPathName(const AudioPath path);
+
+    /**
+     * @brief Runs the check and prints the result when 'f' is received.
+     */
+    static void Process(UsbSerial &serial);
+
+    /**
+     * @brief Start of the audio callback, called by Kastle2.
+     */
+    static inline void AudioBegin()
+    {
+#ifndef KASTLE2_HOST
+        if (check_blocks_ != 0)
+        {
+            check_start_ = xip_ctrl_hw->ctr_acc;
+        }
+#endif
+    }
+
+    /**
+     * @brief End of the audio callback, called by Kastle2.
+     */
+    static inline void AudioEnd()
+    {
+#ifndef KASTLE2_HOST
+        if (check_blocks_ != 0)
+        {
+            check_accesses_ = check_accesses_ + (xip_ctrl_hw->ctr_acc - check_start_);
+            check_blocks_ = check_blocks_ - 1;
+        }
+#endif
+    }
+
+private:
+    static inline bool enabled_ = false;
+    // Cores which run the firmware (bit per core)
+    static inline volatile uint32_t cores_ = 0;
+    static inline AudioPath audio_path_ = AudioPath::UNKNOWN;
+
+    // Measurement of the audio callbacks, blocks left and XIP accesses counted
+    static inline volatile uint32_t check_blocks_ = 0;
+    static inline volatile uint32_t check_accesses_ = 0;
+    static inline uint32_t check_start_ = 0;
+
+    static bool IsInRam(const uintptr_t address);
+
+    /**
+     * @brief Erases (if erase) and programs (if data) the flash range, parks the other core if it runs.
+     */
+    static void Write(const uint32_t flash_offset, const uint8_t *data, const size_t size, const bool erase);
+
+    /**
+     * @brief Write() with the interrupts whose handlers run from the flash held off.
+     */
+    static void WriteWithAudio(const uint32_t flash_offset, const uint8_t *data, const size_t size, const bool erase);
+
+    static bool IsOtherCoreRunning()
+    {
+        return (cores_ & (1u << (get_core_num() ^ 1))) != 0;
+    }
+};
+
+}
@@ -0,0 +1,79 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include "common/config.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class FrameSlots
+ * @ingroup core
+ * @brief Frames of an audio block for control-rate work, spread over the block instead of all at frame 0.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Work done once per block (envelopes, frequency updates with divisions) at frame 0 makes that frame late,
+ * and with it the handoff of the first frames to the second core (MultiCore::PublishFrame()).
+ * Give each piece of such work its own slot and run it when the per-sample loop reaches its frame:
+ * @code
+ * using Slots = FrameSlots<2>;
+ * for (size_t i = 0; i < size; i++)
+ * {
+ *     if (i == Slots::Frame(0)) { UpdateEnvelope(); }
+ *     if (i == Slots::Frame(1)) { UpdateFrequency(); }
+ *     ...
+ * }
+ * @endcode
+ * The slots are evenly spaced and centered, none of them is frame 0. The frames are compile-time constants,
+ * so the check is one compare per frame. The work in the frames before its slot sees the previous block's values,
+ * the same latency as running it at the end of the previous block.
+ *
+ * ControlScheduler spreads the work over the blocks, FrameSlots over the frames of one block.
+ *
+ * @tparam kSlots Number of slots in the block
+ * @tparam kFrames Frames in the block, the loop must run over all of them
+ */
+template <size_t kSlots, size_t kFrames = AUDIO_BUFFER_SIZE>
+class FrameSlots
+{
+    static_assert(kSlots > 0 && kSlots <= kFrames / 2, "Every slot needs its own frame, other than frame 0");
+
+public:
+    /**
+     * @brief Frame at which the slot runs.
+     * @param slot The slot (0 to kSlots - 1)
+     * @return Frame index in the block
+     */
+    static constexpr size_t Frame(const size_t slot)
+    {
+        return ((2 * slot + 1) * kFrames) / (2 * kSlots);
+    }
+};
+
+}
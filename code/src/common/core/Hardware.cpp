@@ -22,18 +22,24 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
 #include "hardware/i2c.h"
 #include "hardware/irq.h"
 #include "hardware/pwm.h"
 #include "hardware/sync.h"
+#include "hardware/timer.h"
 
 #include "common/core/Kastle2.hpp"
 #include "common/debug.hpp"
+#include "common/debug/Trace.hpp"
+#include "common/dsp/math/LinearFit.hpp"
 #include "common/dsp/math/math_utils.hpp"
 #include "common/peripherals/WS2812.hpp"
 #include "common/utils.hpp"
@@ -44,18 +50,18 @@ using namespace kastle2;
 
 WS2812 pixels = WS2812(Hardware::PIN_LEDS, 3, pio0, 3);
 
-EnumArray<Hardware::Button, size_t> ButtonsPins = {
+constexpr EnumArray<Hardware::Button, size_t> ButtonsPins = {
     Hardware::PIN_BUTTON_SHIFT,
     Hardware::PIN_BUTTON_MODE};
 
-EnumArray<Hardware::DigitalInput, size_t> DigitalInputsPins = {
+constexpr EnumArray<Hardware::DigitalInput, size_t> DigitalInputsPins = {
     Hardware::PIN_TRIG_IN,
     Hardware::PIN_RESET_IN,
     Hardware::PIN_SYNC_IN,
     Hardware::PIN_AUDIO_IN_DETECT,
     Hardware::PIN_SYNC_IN_DETECT};
 
-EnumArray<Hardware::Pot, Hardware::AnalogInput> PotToAnalogInputMap = {
+constexpr EnumArray<Hardware::Pot, Hardware::AnalogInput> PotToAnalogInputMap = {
     Hardware::AnalogInput::POT_1,
     Hardware::AnalogInput::POT_2,
     Hardware::AnalogInput::POT_3,
@@ -72,11 +78,44 @@ static void adc_irq_handler()
 {
     if (hardware_instance != nullptr)
     {
+        Trace::Begin(TraceSpan::ADC_IRQ);
         hardware_instance->AdcIrqHandler();
+        Trace::End(TraceSpan::ADC_IRQ);
     }
 }
 
-void Hardware::Init()
+#if ADC_DMA_ENABLED
+// ADC DMA interrupt handler
+static void adc_dma_irq_handler()
+{
+    if (hardware_instance != nullptr)
+    {
+        Trace::Begin(TraceSpan::ADC_IRQ);
+        hardware_instance->AdcDmaIrqHandler();
+        Trace::End(TraceSpan::ADC_IRQ);
+    }
+}
+#endif
+
+// Digital input edges GPIO callback
+static void digital_input_irq_callback(uint gpio, [[maybe_unused]] uint32_t events)
+{
+    if (hardware_instance != nullptr)
+    {
+        hardware_instance->DigitalInputIrqHandler(gpio);
+    }
+}
+
+// Scheduled output edges alarm callback
+static void output_edge_alarm_callback([[maybe_unused]] uint alarm_num)
+{
+    if (hardware_instance != nullptr)
+    {
+        hardware_instance->OutputEdgeAlarmHandler();
+    }
+}
+
+COLDCODE void Hardware::Init()
 {
     // Set handler access to this instance
     hardware_instance = this;
@@ -105,7 +144,7 @@ void Hardware::Init()
 
     // Init I2S driver
     i2s_.Init(
-        SAMPLE_RATE,
+        I2S_SAMPLE_RATE,
         {
             .mclk = PIN_MCLK,
             .dout = PIN_DOUT,
@@ -150,6 +189,34 @@ void Hardware::Init()
     adc_values_.fill(0);
     adc_dirty_counter_.fill(0);
 
+#if ADC_DMA_ENABLED
+    // Free running round robin over the four inputs, DMA moves the results from the FIFO
+    // I2S uses DMA_IRQ_0, the ADC gets DMA_IRQ_1
+    adc_fifo_setup(
+        true,  // Write each result to the FIFO
+        true,  // Enable DMA data request
+        1,     // DREQ at least 1 sample in FIFO
+        false, // No ERR bit
+        false  // Shift 12-bit to 8-bit (we want full 12-bit)
+    );
+    adc_dma_channel_ = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(adc_dma_channel_);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_dreq(&config, DREQ_ADC);
+    dma_channel_configure(adc_dma_channel_, &config, adc_dma_buffer_.data(), &adc_hw->fifo, kAdcDmaSamples, true);
+    dma_channel_set_irq1_enabled(adc_dma_channel_, true);
+    irq_set_exclusive_handler(DMA_IRQ_1, adc_dma_irq_handler);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    // Start with the first mux input and ADC0
+    current_adc_mux_ = 0;
+    SelectAdcMux_(current_adc_mux_);
+    adc_set_round_robin((1u << static_cast<size_t>(HwAnalogInput::COUNT)) - 1);
+    adc_select_input(static_cast<size_t>(HwAnalogInput::ADC0_COMMON));
+    adc_run(true);
+#else
     // Enable ADC FIFO and interrupts
     adc_fifo_setup(
         true,  // Write each result to the FIFO
@@ -166,6 +233,7 @@ void Hardware::Init()
 
     // Start first conversion
     StartAdcConversion();
+#endif
 
     // Init buttons
     for (Button b : EnumRange<Button>())
@@ -176,10 +244,14 @@ void Hardware::Init()
         gpio_set_pulls(pin, true, false);
     }
 
-    buttons_just_pressed_.fill(false);
-    buttons_just_released_.fill(false);
-    prev_buttons_pressed_.fill(false);
-    buttons_pressed_.fill(false);
+    buttons_just_pressed_.reset();
+    buttons_just_released_.reset();
+    buttons_pressed_.reset();
+    buttons_pressed_time_us_.fill(0);
+
+    // The PIO program reads the buttons as consecutive pins, PIO0 is taken by the I2S and the LEDs
+    static_assert(PIN_BUTTON_MODE == PIN_BUTTON_SHIFT + 1 && PioDebouncer::kPinCount == 2);
+    buttons_debouncer_.Init(pio1, PIN_BUTTON_SHIFT, kButtonLockoutUs, clock_get_hz(clk_sys));
 
     // Init LFO and ENV outs (they share the same PWM channel)
     gpio_set_function(PIN_LFO_OUT, GPIO_FUNC_PWM);
@@ -211,6 +283,11 @@ void Hardware::Init()
     gpio_set_dir(PIN_SYNC_OUT, GPIO_OUT);
     gpio_put(PIN_SYNC_OUT, true); // Setting it to 0 but it's inverse
 
+    // Scheduled output edges, the alarm interrupt runs on this core
+    output_edges_lock_ = spin_lock_instance(spin_lock_claim_unused(true));
+    hardware_alarm_claim(kOutputEdgeAlarm);
+    hardware_alarm_set_callback(kOutputEdgeAlarm, output_edge_alarm_callback);
+
     // Init digital Inputs
     for (DigitalInput i : EnumRange<DigitalInput>())
     {
@@ -220,6 +297,12 @@ void Hardware::Init()
         gpio_set_pulls(pin, pin == PIN_AUDIO_IN_DETECT ? false : true, false);
     }
 
+    // Timestamp the edges of the trigger, reset and sync, the inputs are inverted so the rising edge is the falling one
+    for (DigitalInput input : kEdgeCaptureInputs)
+    {
+        gpio_set_irq_enabled_with_callback(DigitalInputsPins[input], GPIO_IRQ_EDGE_FALL, true, digital_input_irq_callback);
+    }
+
     // Jack detect for audio in counter (for filtering)
     audio_in_jack_plugged_counter_ = 0;
 
@@ -247,7 +330,7 @@ void Hardware::ReadVersion()
     gpio_deinit(PIN_RX);
 }
 
-void Hardware::ShowStartupMessage(const StartupMessage message)
+COLDCODE void Hardware::ShowStartupMessage(const StartupMessage message)
 {
     uint32_t color = 0;
     size_t flashes = 3;
@@ -274,19 +357,27 @@ void Hardware::ShowStartupMessage(const StartupMessage message)
     case StartupMessage::I2S_FAIL:
         color = 0x6600FF;
         break;
+    case StartupMessage::WATCHDOG_RESET:
+        color = 0xFF00FF;
+        flashes = 5;
+        break;
     }
     for (size_t j = 0; j < flashes; j++)
     {
+        pixels.BeginFrame();
         for (Led led : EnumRange<Led>())
         {
             pixels.SetPixelColor(static_cast<size_t>(led), color);
         }
+        pixels.EndFrame();
         pixels.Show();
         sleep_ms(200);
+        pixels.BeginFrame();
         for (Led led : EnumRange<Led>())
         {
             pixels.SetPixelColor(static_cast<size_t>(led), 0x000000);
         }
+        pixels.EndFrame();
         pixels.Show();
         sleep_ms(200);
     }
@@ -294,9 +385,11 @@ void Hardware::ShowStartupMessage(const StartupMessage message)
 
 void Hardware::ReadButtons()
 {
+    const uint32_t gpio = ReadInputGpio_();
+
     // Input jack state can be also detected if a strong audio signal is present at patchbay (eg square wave from LFO)
     // With this hack we keep the jack plugged signal on to prevent quick toggling on square wave input via patchbay
-    if (gpio_get(DigitalInputsPins[DigitalInput::AUDIO_IN_JACK_DETECT]))
+    if ((gpio >> DigitalInputsPins[DigitalInput::AUDIO_IN_JACK_DETECT]) & 1u)
     {
         audio_in_jack_plugged_counter_ = 10;
     }
@@ -308,41 +401,70 @@ void Hardware::ReadButtons()
         }
     }
 
-    // Read buttons
-    for (Button b : EnumRange<Button>())
+    if (inputs_overridden_)
     {
-        prev_buttons_pressed_[b] = buttons_pressed_[b];
-        buttons_pressed_[b] = !gpio_get(ButtonsPins[b]);
-        buttons_just_pressed_[b] = buttons_pressed_[b] && !prev_buttons_pressed_[b];
-        buttons_just_released_[b] = !buttons_pressed_[b] && prev_buttons_pressed_[b];
-        if (buttons_just_pressed_[b])
-        {
-            buttons_pressed_time_[b] = get_absolute_time();
-        }
+        SetButtons_(ButtonsFromGpio_(gpio), time_us_32());
+        return;
     }
+
+    // The debounced changes, the pins of the events start at the first button pin
+    PioDebouncer::Event event;
+    while (buttons_debouncer_.Pop(event))
+    {
+        SetButtons_(ButtonsFromGpio_(event.pins << PIN_BUTTON_SHIFT), event.time_us);
+    }
+}
+
+void Hardware::SetButtons_(const EnumBitset<Button> pressed, const uint32_t time_us)
+{
+    // The changed bits are the edges, the press times go first as the audio loop reads them with the state (tap tempo)
+    const EnumBitset<Button> changed = pressed ^ buttons_pressed_;
+    for (Button b : changed & pressed)
+    {
+        buttons_pressed_time_us_[b] = time_us;
+    }
+    buttons_pressed_ = pressed;
+    buttons_just_pressed_ |= changed & pressed;
+    buttons_just_released_ |= changed & ~pressed;
+}
+
+EnumBitset<Hardware::Button> Hardware::ButtonsFromGpio_(const uint32_t gpio)
+{
+    EnumBitset<Button> buttons;
+    EnumForEach<Button>(
+        [&](const Button b)
+        {
+            buttons.set(b, !((gpio >> ButtonsPins[b]) & 1u));
+        });
+    return buttons;
 }
 
 bool Hardware::JustPressed(const Button button) const
 {
-    return buttons_just_pressed_[button];
+    return buttons_just_pressed_.test(button);
 }
 
 bool Hardware::JustReleased(const Button button) const
 {
-    return buttons_just_released_[button];
+    return buttons_just_released_.test(button);
 }
 
 bool Hardware::Pressed(const Button button) const
 {
-    return buttons_pressed_[button];
+    return buttons_pressed_.test(button);
+}
+
+uint32_t Hardware::PressedTimeUs(const Button button) const
+{
+    return buttons_pressed_time_us_[button];
 }
 
 uint32_t Hardware::PressedMillis(const Button button) const
 {
-    if (buttons_pressed_[button])
+    if (Pressed(button))
     {
         // If the button is pressed, return the time since it was pressed
-        return absolute_time_diff_us(buttons_pressed_time_[button], get_absolute_time()) / 1000;
+        return (time_us_32() - buttons_pressed_time_us_[button]) / 1000;
     }
     // If the button is not pressed, return 0
     return 0;
@@ -350,8 +472,8 @@ uint32_t Hardware::PressedMillis(const Button button) const
 
 void Hardware::ClearButtonJusts()
 {
-    buttons_just_pressed_.fill(false);
-    buttons_just_released_.fill(false);
+    buttons_just_pressed_.reset();
+    buttons_just_released_.reset();
 }
 
 int32_t Hardware::GetAnalogValue(const AnalogInput input) const
@@ -359,6 +481,20 @@ int32_t Hardware::GetAnalogValue(const AnalogInput input) const
     return adc_values_[input];
 }
 
+int32_t Hardware::GetPitchValueFine(const AnalogInput input) const
+{
+    return pitch_fine_values_[input == AnalogInput::PITCH_2 ? CalibratedAnalogInput::PITCH2 : CalibratedAnalogInput::PITCH1];
+}
+
+int32_t Hardware::DecimatePitch(const CalibratedAnalogInput pitch, const int32_t sum)
+{
+    PitchBoxcar &boxcar = pitch_boxcars_[pitch];
+    boxcar.total += sum - boxcar.sums[boxcar.pos];
+    boxcar.sums[boxcar.pos] = sum;
+    boxcar.pos = boxcar.pos + 1 < kPitchBoxcarSteps ? boxcar.pos + 1 : 0;
+    return (boxcar.total << kPitchFineBits) / kPitchBoxcarSamples;
+}
+
 void Hardware::SetAnalogOut(const AnalogOutput output, const int32_t val)
 {
     switch (output)
@@ -377,20 +513,157 @@ void Hardware::SetAnalogOut(const AnalogOutput output, const int32_t val)
 
 void Hardware::SetTriOut(const int32_t val)
 {
-    // triangle LFO out (inverted, that's why kPwmResolution - val)
-    pwm_set_chan_level(kLfoEnvSliceNum, kLfoPwmChannel, kPwmResolution - constrain(val, 0, kPwmResolution));
+    WriteAnalogLevel(AnalogOutput::TRI_OUT, val);
 }
 
 void Hardware::SetEnvOut(const int32_t val)
 {
-    // envelope out (inverted, that's why kPwmResolution - val)
-    pwm_set_chan_level(kLfoEnvSliceNum, kEnvPwmChannel, kPwmResolution - constrain(val, 0, kPwmResolution));
+    WriteAnalogLevel(AnalogOutput::ENV_OUT, val);
 }
 
 void Hardware::SetCvOut(const int32_t val)
 {
-    // CV out (inverted, that's why kPwmResolution - val)
-    pwm_set_chan_level(kCvSliceNum, kCvPwmChannel, kPwmResolution - constrain(val, 0, kPwmResolution));
+    WriteAnalogLevel(AnalogOutput::CV_OUT, val);
+}
+
+void Hardware::WriteAnalogLevel(const AnalogOutput output, const int32_t val)
+{
+    // The outputs are inverted, that's why kPwmResolution - val
+    const uint16_t level = static_cast<uint16_t>(kPwmResolution - constrain(val, 0, kPwmResolution));
+    analog_levels_[output] = level;
+
+    // A streamed slice gets the level with the next block
+    const size_t slice = StreamSlice(output);
+    if (IsSliceStreamed(slice))
+    {
+        return;
+    }
+    pwm_set_chan_level(kStreamSliceNums[slice], StreamChannelB(output) ? PWM_CHAN_B : PWM_CHAN_A, level);
+}
+
+void Hardware::SetAnalogStreamEnabled(const AnalogOutput output, const bool enabled)
+{
+    if (analog_streamed_[output] == enabled)
+    {
+        return;
+    }
+    if (analog_stream_timer_ < 0)
+    {
+        InitAnalogStreams();
+    }
+
+    // Starts with the last single value
+    analog_stream_levels_[output].fill(analog_levels_[output]);
+    analog_streamed_[output] = enabled;
+    analog_streaming_ = IsSliceStreamed(0) || IsSliceStreamed(1);
+
+    const size_t slice = StreamSlice(output);
+    if (!IsSliceStreamed(slice))
+    {
+        RestoreAnalogLevels(slice);
+    }
+}
+
+bool Hardware::IsSliceStreamed(const size_t slice) const
+{
+    if (slice == 0)
+    {
+        return analog_streamed_[AnalogOutput::TRI_OUT] || analog_streamed_[AnalogOutput::ENV_OUT];
+    }
+    return analog_streamed_[AnalogOutput::CV_OUT];
+}
+
+void Hardware::SetAnalogStream(const AnalogOutput output, std::span<const int32_t, kAnalogStreamFrames> values)
+{
+    std::array<uint16_t, kAnalogStreamFrames> &levels = analog_stream_levels_[output];
+    for (size_t i = 0; i < kAnalogStreamFrames; i++)
+    {
+        levels[i] = static_cast<uint16_t>(kPwmResolution - constrain(values[i], 0, kPwmResolution));
+    }
+}
+
+void Hardware::CommitAnalogStreams()
+{
+    if (!analog_streaming_)
+    {
+        return;
+    }
+
+    for (size_t slice = 0; slice < kStreamSlices; slice++)
+    {
+        const AnalogOutput output_a = slice == 0 ? AnalogOutput::TRI_OUT : AnalogOutput::CV_OUT;
+        if (!IsSliceStreamed(slice))
+        {
+            continue;
+        }
+        const bool streamed_a = analog_streamed_[output_a];
+        const bool streamed_b = slice == 0 && analog_streamed_[AnalogOutput::ENV_OUT];
+
+        // The last value of the previous block may still be pending when the block came a bit early
+        const uint channel = static_cast<uint>(analog_stream_channels_[slice]);
+        if (dma_channel_is_busy(channel))
+        {
+            dma_channel_abort(channel);
+        }
+
+        // Compare register: channel A in the low half, B in the high half (the unused B of the CV slice stays)
+        std::array<uint32_t, kAnalogStreamFrames> &words = analog_stream_words_[slice];
+        const uint32_t fixed_b = slice == 0 ? analog_levels_[AnalogOutput::ENV_OUT] : pwm_hw->slice[kCvSliceNum].cc >> 16;
+        for (size_t i = 0; i < kAnalogStreamFrames; i++)
+        {
+            const uint32_t a = streamed_a ? analog_stream_levels_[output_a][i] : analog_levels_[output_a];
+            const uint32_t b = streamed_b ? analog_stream_levels_[AnalogOutput::ENV_OUT][i] : fixed_b;
+            words[i] = a | (b << 16);
+        }
+        dma_channel_transfer_from_buffer_now(channel, words.data(), kAnalogStreamFrames);
+    }
+}
+
+void Hardware::InitAnalogStreams()
+{
+    analog_stream_timer_ = dma_claim_unused_timer(true);
+    SetAnalogStreamClock(clock_get_hz(clk_sys));
+
+    for (size_t slice = 0; slice < kStreamSlices; slice++)
+    {
+        analog_stream_channels_[slice] = dma_claim_unused_channel(true);
+        dma_channel_config config = dma_channel_get_default_config(analog_stream_channels_[slice]);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+        channel_config_set_read_increment(&config, true);
+        channel_config_set_write_increment(&config, false);
+        channel_config_set_dreq(&config, dma_get_timer_dreq(analog_stream_timer_));
+        dma_channel_configure(analog_stream_channels_[slice], &config, &pwm_hw->slice[kStreamSliceNums[slice]].cc,
+                              analog_stream_words_[slice].data(), kAnalogStreamFrames, false);
+    }
+}
+
+void Hardware::SetAnalogStreamClock(const uint32_t system_clock_hz)
+{
+    if (analog_stream_timer_ < 0)
+    {
+        return;
+    }
+    // One value per period of clk_sys cycles, whole cycles with the exact clock plans
+    const uint32_t period = static_cast<uint32_t>(static_cast<float>(system_clock_hz) / kAnalogStreamRate + 0.5f);
+    dma_timer_set_fraction(static_cast<uint>(analog_stream_timer_), 1, static_cast<uint16_t>(std::min<uint32_t>(period, UINT16_MAX)));
+}
+
+void Hardware::RestoreAnalogLevels(const size_t slice)
+{
+    const uint channel = static_cast<uint>(analog_stream_channels_[slice]);
+    if (dma_channel_is_busy(channel))
+    {
+        dma_channel_abort(channel);
+    }
+    if (slice == 0)
+    {
+        pwm_set_chan_level(kLfoEnvSliceNum, kLfoPwmChannel, analog_levels_[AnalogOutput::TRI_OUT]);
+        pwm_set_chan_level(kLfoEnvSliceNum, kEnvPwmChannel, analog_levels_[AnalogOutput::ENV_OUT]);
+    }
+    else
+    {
+        pwm_set_chan_level(kCvSliceNum, kCvPwmChannel, analog_levels_[AnalogOutput::CV_OUT]);
+    }
 }
 
 void Hardware::SetDebugPin(const size_t pin, const bool value)
@@ -425,6 +698,19 @@ void Hardware::SelectAdcMux_(const size_t mux)
     adc_discard_readings_counter_ = 16;
 }
 
+void Hardware::SelectNextAdcMux()
+{
+    current_adc_mux_ = (current_adc_mux_ + 1) % 8;
+    SelectAdcMux_(current_adc_mux_);
+
+    // Support for tri-state feed inputs, kinda hacky but it works
+    if (kTriStateFeedEnabled)
+    {
+        // Set the pullup for ADC0 if reading feed inputs (4, 5, 6 on the mux)
+        gpio_set_pulls(26, current_adc_mux_ >= 4 && current_adc_mux_ <= 6, false);
+    }
+}
+
 void Hardware::StartAdcConversion(const bool increment)
 {
     if (increment)
@@ -433,29 +719,15 @@ void Hardware::StartAdcConversion(const bool increment)
         // When starting to read ADC2, select new mux so it's ready when reading ADC0
         if (current_hw_adc_ == HwAnalogInput::ADC2_PITCH1)
         {
-            current_adc_mux_ = (current_adc_mux_ + 1) % 8;
-            SelectAdcMux_(current_adc_mux_);
-
             // Needs some time to settle down
             // We solve it by `adc_discard_readings_counter_`
-
-            // Support for tri-state feed inputs, kinda hacky but it works
-            if (kTriStateFeedEnabled)
-            {
-                // Set the pullup for ADC0 if reading feed inputs (4, 5, 6 on the mux)
-                gpio_set_pulls(26, current_adc_mux_ >= 4 && current_adc_mux_ <= 6, false);
-            }
+            SelectNextAdcMux();
+            // The LED frame goes out while the mux settles, those readings are discarded
+            SendLeds();
         }
         // Select the input
         adc_select_input(static_cast<size_t>(current_hw_adc_));
-
-        // Send LEDs
-        led_update_counter_++;
-        if (led_update_counter_ >= kLedUpdateInterval)
-        {
-            led_update_counter_ = 0;
-            SendLeds();
-        }
+        led_frame_counter_++;
     }
     hw_set_bits(&adc_hw->cs, ADC_CS_START_ONCE_BITS);
 }
@@ -474,9 +746,64 @@ void Hardware::AdcIrqHandler()
         return;
     }
 
+    StoreAdcResult(current_hw_adc_, result);
+
+    // Start the next conversion
+    StartAdcConversion();
+}
+
+#if ADC_DMA_ENABLED
+void Hardware::AdcDmaIrqHandler()
+{
+    dma_channel_acknowledge_irq1(adc_dma_channel_);
+
+    // Stop the round robin and drop the conversions after the DMA finished, it starts again from ADC0 with the next mux
+    adc_run(false);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS))
+    {
+        tight_loop_contents();
+    }
+    adc_fifo_drain();
+
+    // Only the last round is used for the multiplexed inputs, the mux had the rounds before to settle down
+    static constexpr size_t kInputs = static_cast<size_t>(HwAnalogInput::COUNT);
+    const uint16_t *round = &adc_dma_buffer_[kAdcDmaSamples - kInputs];
+    // Unrolled, the channel and the pitch input check are constants for each input
+    EnumForEach<HwAnalogInput>(
+        [&](auto hw_input)
+        {
+            constexpr HwAnalogInput kInput = decltype(hw_input)::value;
+            constexpr size_t kChannel = static_cast<size_t>(kInput);
+            int32_t result = round[kChannel];
+
+            // The pitch inputs aren't multiplexed, all their rounds go to the boxcar
+            if constexpr (kInput == HwAnalogInput::ADC2_PITCH1 || kInput == HwAnalogInput::ADC3_PITCH2)
+            {
+                result = 0;
+                for (size_t i = kChannel; i < kAdcDmaSamples; i += kInputs)
+                {
+                    result += adc_dma_buffer_[i];
+                }
+            }
+            StoreAdcResult(kInput, result);
+        });
+
+    SelectNextAdcMux();
+    adc_select_input(static_cast<size_t>(HwAnalogInput::ADC0_COMMON));
+    dma_channel_set_write_addr(adc_dma_channel_, adc_dma_buffer_.data(), true);
+    adc_run(true);
+
+    // The LED frame goes out during the first rounds of the new mux step, only the last one is used
+    led_frame_counter_ += kAdcDmaSamples;
+    SendLeds();
+}
+#endif
+
+void Hardware::StoreAdcResult(const HwAnalogInput hw_input, int32_t result)
+{
     // Process the result
     size_t index = 0;
-    switch (current_hw_adc_)
+    switch (hw_input)
     {
     case HwAnalogInput::ADC0_COMMON:
         index = static_cast<size_t>(AnalogInput::RESET) + current_adc_mux_;
@@ -493,23 +820,49 @@ void Hardware::AdcIrqHandler()
     }
 
     // Initialize srand if not already done
-    if (!srand_active_ && current_hw_adc_ == HwAnalogInput::ADC1_COMMON)
+    if (!srand_active_ && hw_input == HwAnalogInput::ADC1_COMMON)
     {
         srand(result);
         srand_active_ = true;
     }
 
-    result = NormalizeAdcResult((AnalogInput)index, result);
-    result = AverageAdcResult((AnalogInput)index, result);
+    if (hw_input == HwAnalogInput::ADC2_PITCH1 || hw_input == HwAnalogInput::ADC3_PITCH2)
+    {
+        // Pitches are filtered and calibrated in the fine resolution, GetAnalogValue() gets it rounded
+        const CalibratedAnalogInput pitch = hw_input == HwAnalogInput::ADC2_PITCH1 ? CalibratedAnalogInput::PITCH1
+                                                                                   : CalibratedAnalogInput::PITCH2;
+        const int32_t fine = NormalizeAdcResult((AnalogInput)index, DecimatePitch(pitch, result));
+        result = (fine + (1 << (kPitchFineBits - 1))) >> kPitchFineBits;
+        if (!inputs_overridden_)
+        {
+            pitch_fine_values_[pitch] = fine;
+        }
+    }
+    else
+    {
+        result = NormalizeAdcResult((AnalogInput)index, result);
+        result = AverageAdcResult((AnalogInput)index, result);
+    }
 
-    adc_values_.at(index) = result;
+    if (!inputs_overridden_)
+    {
+        adc_values_.at(index) = result;
+    }
     if (adc_dirty_counter_.at(index) > 0)
     {
         adc_dirty_counter_.at(index)--;
     }
 
+    // The last multiplexed input closes the pass over all the inputs
+    if (hw_input == HwAnalogInput::ADC1_COMMON && current_adc_mux_ == 7)
+    {
+        adc_cycles_ = adc_cycles_ + 1;
+        // Fresh inputs for the UI, wakes it from UiScheduler::Idle() on either core
+        UiScheduler::Post(UiScheduler::Event::ADC);
+    }
+
 #if MEASURE_ADC_CYCLE
-    if (current_hw_adc_ == HwAnalogInput::ADC0_COMMON && current_adc_mux_ == 0)
+    if (hw_input == HwAnalogInput::ADC0_COMMON && current_adc_mux_ == 0)
     {
         SetDebugPin(0, 1);
     }
@@ -518,9 +871,6 @@ void Hardware::AdcIrqHandler()
         SetDebugPin(0, 0);
     }
 #endif
-
-    // Start the next conversion
-    StartAdcConversion();
 }
 
 void Hardware::UpdateCalibrationMaps()
@@ -541,10 +891,15 @@ void Hardware::UpdateCalibrationMaps()
             values[i] = calibrations[static_cast<Calibration>(static_cast<int>(startCal) + i)];
         }
 
-        // Use 1V and 4V points as reference for slope calculation
+        // Least-squares slope of the 1V to 4V points, a noisy single point moves it much less than the 1V-4V line
         static constexpr size_t v1_index = 1;
         static constexpr size_t v4_index = 4;
-        float slope = static_cast<float>(values[v4_index] - values[v1_index]) / (v4_index - v1_index);
+        LinearFit fit;
+        for (size_t i = v1_index; i <= v4_index; i++)
+        {
+            fit.Add(static_cast<float>(i), static_cast<float>(values[i]));
+        }
+        const float slope = fit.GetSlope();
 
         // Extrapolate 5-7V using the slope from 1V-4V range
         for (size_t i = known_calibrations_count; i < kCalibrationMapSize; i++)
@@ -556,20 +911,76 @@ void Hardware::UpdateCalibrationMaps()
         return values;
     };
 
-    // Create maps for both pitch inputs using the helper function
-    calibration_maps_[CalibratedAnalogInput::PITCH1] = MapDef<int32_t, kCalibrationMapSize>(
-        createCalibratedArray(source_calibrations, Calibration::PITCH1_0V),
-        voltages_array);
+    // The pitches are calibrated in the fine resolution
+    auto toFine = [](std::array<int32_t, kCalibrationMapSize> values)
+    {
+        for (int32_t &value : values)
+        {
+            value <<= kPitchFineBits;
+        }
+        return values;
+    };
+
+    // Offsets and slopes of the segments between the points
+    auto createPitchCalibration = [](const std::array<int32_t, kCalibrationMapSize> &input,
+                                     const std::array<int32_t, kCalibrationMapSize> &output)
+    {
+        PitchCalibration calibration;
+        calibration.input = input;
+        calibration.ascending = input[0] <= input[kCalibrationMapSize - 1];
+        for (size_t i = 0; i < kCalibrationMapSize - 1; i++)
+        {
+            const int64_t in_range = input[i + 1] - input[i];
+            const int64_t out_range = output[i + 1] - output[i];
+            calibration.offset[i] = output[i];
+            calibration.gain[i] = in_range != 0 ? static_cast<int32_t>((out_range * 65536 + in_range / 2) / in_range) : 0;
+        }
+        return calibration;
+    };
+
+    PitchCalibrations &scratch = pitch_calibrations_[active_pitch_calibrations_ == &pitch_calibrations_[0] ? 1 : 0];
+    if (calibration_source_ == CalibrationSource::NONE)
+    {
+        // Without calibrations the raw value goes through unchanged
+        scratch[CalibratedAnalogInput::PITCH1] = createPitchCalibration(toFine(voltages_array), toFine(voltages_array));
+        scratch[CalibratedAnalogInput::PITCH2] = createPitchCalibration(toFine(voltages_array), toFine(voltages_array));
+    }
+    else
+    {
+        // Create maps for both pitch inputs using the helper functions
+        scratch[CalibratedAnalogInput::PITCH1] = createPitchCalibration(
+            toFine(createCalibratedArray(source_calibrations, Calibration::PITCH1_0V)),
+            toFine(voltages_array));
+
+        scratch[CalibratedAnalogInput::PITCH2] = createPitchCalibration(
+            toFine(createCalibratedArray(source_calibrations, Calibration::PITCH2_0V)),
+            toFine(voltages_array));
+    }
 
-    calibration_maps_[CalibratedAnalogInput::PITCH2] = MapDef<int32_t, kCalibrationMapSize>(
-        createCalibratedArray(source_calibrations, Calibration::PITCH2_0V),
-        voltages_array);
+    // The table must be in memory before the ADC interrupt can pick it
+    __dmb();
+    active_pitch_calibrations_ = &scratch;
+}
+
+int32_t Hardware::CalibratePitch(const CalibratedAnalogInput pitch, const int32_t raw) const
+{
+    const PitchCalibration &calibration = (*active_pitch_calibrations_)[pitch];
+
+    // Find the segment, values before the first or after the last point use the outer segments
+    size_t segment = 0;
+    while (segment < kCalibrationMapSize - 2 &&
+           (calibration.ascending ? raw > calibration.input[segment + 1] : raw < calibration.input[segment + 1]))
+    {
+        segment++;
+    }
+    const int64_t distance = raw - calibration.input[segment];
+    return calibration.offset[segment] + static_cast<int32_t>((distance * calibration.gain[segment]) >> 16);
 }
 
 /**
  * Because of using multiplexers, voltage dividers etc, the ADC result isn't always perfect 0-4095.
  * Pots are usually in 17-4078 range, pitch inputs on Kastle 2 are usually in 18-4005 range.
- * This function normalizes the ADC results.
+ * This function normalizes the ADC results. Pitch inputs come in the fine resolution (kPitchFineBits).
  */
 int32_t Hardware::NormalizeAdcResult(const AnalogInput input, const int32_t result)
 {
@@ -590,16 +1001,10 @@ int32_t Hardware::NormalizeAdcResult(const AnalogInput input, const int32_t resu
         output = constrain(output, POT_MIN, POT_MAX);
         break;
     case AnalogInput::PITCH_1:
-        if (calibration_source_ != CalibrationSource::NONE)
-        {
-            output = curve_map(output, calibration_maps_[CalibratedAnalogInput::PITCH1], MapClamp::FALSE, MapSafe::FALSE);
-        }
+        output = CalibratePitch(CalibratedAnalogInput::PITCH1, output);
         break;
     case AnalogInput::PITCH_2:
-        if (calibration_source_ != CalibrationSource::NONE)
-        {
-            output = curve_map(output, calibration_maps_[CalibratedAnalogInput::PITCH2], MapClamp::FALSE, MapSafe::FALSE);
-        }
+        output = CalibratePitch(CalibratedAnalogInput::PITCH2, output);
         break;
     case AnalogInput::PARAM_1:
     case AnalogInput::PARAM_2:
@@ -650,7 +1055,7 @@ int32_t Hardware::NormalizeAdcResult(const AnalogInput input, const int32_t resu
         {
         case Version::KASTLE2:
             // Clamp low values to 0 to prevent unwanted modulations
-            if (output < 20)
+            if (output < (20 << kPitchFineBits))
             {
                 output = 0;
             }
@@ -658,7 +1063,7 @@ int32_t Hardware::NormalizeAdcResult(const AnalogInput input, const int32_t resu
         case Version::CITADEL:
             // Kinda ugly solution but only way how to prevent noise without calibrations
             // When calibrations are valid, we can use the real values
-            if (calibration_source_ == CalibrationSource::REFERENCE && output < 10)
+            if (calibration_source_ == CalibrationSource::REFERENCE && output < (10 << kPitchFineBits))
             {
                 output = 0;
             }
@@ -669,10 +1074,10 @@ int32_t Hardware::NormalizeAdcResult(const AnalogInput input, const int32_t resu
         switch (version_)
         {
         case Version::KASTLE2:
-            output = constrain(output, ADC_0V, ADC_5V);
+            output = constrain(output, ADC_0V << kPitchFineBits, ADC_5V << kPitchFineBits);
             break;
         case Version::CITADEL:
-            output = constrain(output, ADC_N1V, ADC_8V);
+            output = constrain(output, ADC_N1V << kPitchFineBits, ADC_8V << kPitchFineBits);
             break;
         }
     }
@@ -714,6 +1119,11 @@ int32_t Hardware::AverageAdcResult(const AnalogInput input, const int32_t result
 }
 
 void Hardware::SetLed(const Led led, const uint32_t color)
+{
+    led_buffer_[led] = CorrectLedColor(color);
+}
+
+uint32_t Hardware::CorrectLedColor(const uint32_t color) const
 {
     // Apply the color correction based on the specific panel type
     if (panel_type_ == PanelType::YELLOWED)
@@ -727,11 +1137,10 @@ void Hardware::SetLed(const Led led, const uint32_t color)
         r = constrain(r, 0, 255);
         g = constrain(g, 0, 255);
         b = constrain(b, 0, 255);
-        led_buffer_[led] = WS2812::RGB(r, g, b);
-        return;
+        return WS2812::RGB(r, g, b);
     }
 
-    led_buffer_[led] = color;
+    return color;
 }
 
 void Hardware::SetLed(const Led led, const uint8_t r, const uint8_t g, const uint8_t b)
@@ -741,20 +1150,60 @@ void Hardware::SetLed(const Led led, const uint8_t r, const uint8_t g, const uin
 
 void Hardware::LatchLeds()
 {
-    // Disable interrupts during the critical LED data transfer
-    uint32_t interrupt_state = save_and_disable_interrupts();
+    // Only marks the frame dirty, the ADC interrupt sends it (WS2812::Update() copies the pixels first)
+    pixels.BeginFrame();
+    for (Led led : EnumRange<Led>())
+    {
+        led_latched_[led] = led_buffer_[led];
+        // The animated LEDs are written by the interrupt
+        if (!led_animator_.IsPlaying(static_cast<size_t>(led)))
+        {
+            pixels.SetPixelColor(static_cast<size_t>(led), led_buffer_[led]);
+        }
+    }
+    pixels.EndFrame();
+}
+
+void Hardware::RenderLedAnimations()
+{
+    if (led_animator_.IsIdle())
+    {
+        return;
+    }
+    const uint32_t now = time_us_32();
     for (Led led : EnumRange<Led>())
     {
-        pixels.SetPixelColor(static_cast<size_t>(led), led_buffer_[led]);
+        uint32_t color;
+        switch (led_animator_.Render(static_cast<size_t>(led), now, color))
+        {
+        case LedAnimator::Result::CHANGED:
+            pixels.SetPixelColor(static_cast<size_t>(led), CorrectLedColor(color));
+            break;
+        case LedAnimator::Result::FINISHED:
+            pixels.SetPixelColor(static_cast<size_t>(led), led_latched_[led]);
+            break;
+        case LedAnimator::Result::UNCHANGED:
+            break;
+        }
     }
-    // Restore interrupts
-    restore_interrupts(interrupt_state);
 }
 
 void Hardware::SendLeds()
 {
-    leds_just_updated_ = true;
-    pixels.Show();
+    if (led_frame_counter_ < kLedFrameInterval)
+    {
+        return;
+    }
+    RenderLedAnimations();
+    if (!pixels.IsDirty())
+    {
+        return;
+    }
+    if (pixels.Update())
+    {
+        led_frame_counter_ = 0;
+        leds_just_updated_ = true;
+    }
 }
 
 bool Hardware::GetDigitalIn(const DigitalInput input) const
@@ -778,17 +1227,98 @@ bool Hardware::GetDigitalIn(const DigitalInput input) const
 
 bool Hardware::GetTriggerIn() const
 {
-    return !gpio_get(DigitalInputsPins[DigitalInput::TRIG_IN]);
+    return !ReadInputPin_(DigitalInputsPins[DigitalInput::TRIG_IN]);
 }
 
 bool Hardware::GetResetIn() const
 {
-    return !gpio_get(DigitalInputsPins[DigitalInput::RESET_IN]);
+    return !ReadInputPin_(DigitalInputsPins[DigitalInput::RESET_IN]);
 }
 
 bool Hardware::GetSyncIn() const
 {
-    return !gpio_get(DigitalInputsPins[DigitalInput::SYNC_IN]);
+    return !ReadInputPin_(DigitalInputsPins[DigitalInput::SYNC_IN]);
+}
+
+Hardware::DigitalInputEdges Hardware::GetDigitalInEdges(const DigitalInput input) const
+{
+    const CapturedEdges &edges = input_edges_[input];
+    uint32_t sequence;
+    DigitalInputEdges result;
+    do
+    {
+        sequence = edges.sequence;
+        __dmb();
+        result.count = edges.count;
+        result.time_us = edges.time_us;
+        __dmb();
+    } while ((sequence & 1) || sequence != edges.sequence);
+    return result;
+}
+
+void Hardware::DigitalInputIrqHandler(const uint gpio)
+{
+    if (inputs_overridden_)
+    {
+        return;
+    }
+    const uint32_t now = time_us_32();
+    for (DigitalInput input : kEdgeCaptureInputs)
+    {
+        if (DigitalInputsPins[input] == gpio)
+        {
+            CapturedEdges &edges = input_edges_[input];
+            edges.sequence = edges.sequence + 1;
+            __dmb();
+            edges.time_us = now;
+            edges.count = edges.count + 1;
+            __dmb();
+            edges.sequence = edges.sequence + 1;
+            return;
+        }
+    }
+}
+
+void Hardware::GetInputSnapshot(InputSnapshot &snapshot) const
+{
+    snapshot.analog = adc_values_;
+    snapshot.pitch_fine = pitch_fine_values_;
+    snapshot.gpio = inputs_overridden_ ? override_gpio_ : gpio_get_all();
+    for (DigitalInput input : EnumRange<DigitalInput>())
+    {
+        snapshot.edges[input] = input_edges_[input].count;
+    }
+}
+
+void Hardware::OverrideInputs(const InputSnapshot &snapshot)
+{
+    // From now on StoreAdcResult() and the pin interrupt leave the values alone
+    inputs_overridden_ = true;
+    __dmb();
+    adc_values_ = snapshot.analog;
+    pitch_fine_values_ = snapshot.pitch_fine;
+    override_gpio_ = snapshot.gpio;
+
+    const uint32_t now = time_us_32();
+    for (DigitalInput input : kEdgeCaptureInputs)
+    {
+        CapturedEdges &edges = input_edges_[input];
+        if (edges.count == snapshot.edges[input])
+        {
+            continue;
+        }
+        edges.sequence = edges.sequence + 1;
+        __dmb();
+        edges.time_us = now;
+        edges.count = snapshot.edges[input];
+        __dmb();
+        edges.sequence = edges.sequence + 1;
+    }
+}
+
+void Hardware::ReleaseInputs()
+{
+    inputs_overridden_ = false;
 }
 
 bool Hardware::IsAudioInJackProbablyPlugged() const
@@ -798,7 +1328,7 @@ bool Hardware::IsAudioInJackProbablyPlugged() const
 
 bool Hardware::IsSyncInJackProbablyPlugged() const
 {
-    return !gpio_get(DigitalInputsPins[DigitalInput::SYNC_IN_JACK_DETECT]);
+    return !ReadInputPin_(DigitalInputsPins[DigitalInput::SYNC_IN_JACK_DETECT]);
 }
 
 void Hardware::SetDigitalOut(const DigitalOutput output, const bool state)
@@ -817,9 +1347,69 @@ void Hardware::SetDigitalOut(const DigitalOutput output, const bool state)
     }
 }
 
+bool Hardware::ScheduleDigitalOut(const DigitalOutput output, const bool state, const uint32_t time_us)
+{
+    const uint32_t irq_state = spin_lock_blocking(output_edges_lock_);
+    const bool scheduled = output_edges_count_ < kMaxOutputEdges;
+    if (scheduled)
+    {
+        // Insert sorted by time, after the edges with the same time
+        size_t index = output_edges_count_;
+        while (index > 0 && static_cast<int32_t>(output_edges_[index - 1].time_us - time_us) > 0)
+        {
+            output_edges_[index] = output_edges_[index - 1];
+            --index;
+        }
+        output_edges_[index] = {.time_us = time_us, .output = output, .state = state};
+        ++output_edges_count_;
+        ArmOutputEdgeAlarm();
+    }
+    else
+    {
+        SetDigitalOut(output, state);
+    }
+    spin_unlock(output_edges_lock_, irq_state);
+    return scheduled;
+}
+
+void Hardware::OutputEdgeAlarmHandler()
+{
+    const uint32_t irq_state = spin_lock_blocking(output_edges_lock_);
+    ArmOutputEdgeAlarm();
+    spin_unlock(output_edges_lock_, irq_state);
+}
+
+void Hardware::ArmOutputEdgeAlarm()
+{
+    size_t done = 0;
+    while (done < output_edges_count_)
+    {
+        const OutputEdge &edge = output_edges_[done];
+        const int32_t delay_us = static_cast<int32_t>(edge.time_us - time_us_32());
+
+        // Returns true when the time has already passed
+        if (delay_us > 0 && !hardware_alarm_set_target(kOutputEdgeAlarm, delayed_by_us(get_absolute_time(), delay_us)))
+        {
+            break;
+        }
+        SetDigitalOut(edge.output, edge.state);
+        ++done;
+    }
+
+    // Remove the edges that were set
+    if (done > 0)
+    {
+        for (size_t i = done; i < output_edges_count_; i++)
+        {
+            output_edges_[i - done] = output_edges_[i];
+        }
+        output_edges_count_ -= done;
+    }
+}
+
 bool Hardware::GetRawButtonState(const Button button) const
 {
-    return !gpio_get(ButtonsPins[button]);
+    return !ReadInputPin_(ButtonsPins[button]);
 }
 
 void Hardware::SetGateOut(const bool state)
@@ -849,6 +1439,13 @@ void Hardware::ChangeLayer(const Layer layer)
     FreezePots();
 }
 
+void Hardware::SetSystemClock(const uint32_t system_clock_hz)
+{
+    pixels.SetSystemClock(system_clock_hz);
+    buttons_debouncer_.SetSystemClock(system_clock_hz);
+    SetAnalogStreamClock(system_clock_hz);
+}
+
 void Hardware::FreezePots()
 {
     for (Pot p : EnumRange<Pot>())
@@ -924,12 +1521,11 @@ void Hardware::SetCalibrationsEnabled(const bool enabled)
     if (!enabled)
     {
         calibration_source_ = CalibrationSource::NONE;
-        return;
     }
-    if (custom_calibrations_[Calibration::PITCH1_1V] == 0 &&
-        custom_calibrations_[Calibration::PITCH1_4V] == 0 &&
-        custom_calibrations_[Calibration::PITCH2_1V] == 0 &&
-        custom_calibrations_[Calibration::PITCH2_4V] == 0)
+    else if (custom_calibrations_[Calibration::PITCH1_1V] == 0 &&
+             custom_calibrations_[Calibration::PITCH1_4V] == 0 &&
+             custom_calibrations_[Calibration::PITCH2_1V] == 0 &&
+             custom_calibrations_[Calibration::PITCH2_4V] == 0)
     {
         calibration_source_ = CalibrationSource::REFERENCE;
     }
@@ -937,6 +1533,7 @@ void Hardware::SetCalibrationsEnabled(const bool enabled)
     {
         calibration_source_ = CalibrationSource::CUSTOM;
     }
+    UpdateCalibrationMaps();
 }
 
 void Hardware::SetCustomCalibrations(const CalibrationsType &calibrations)
@@ -24,16 +24,33 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
+#include <span>
 #include "hardware/i2c.h"
 #include "hardware/pwm.h"
+#include "hardware/sync.h"
 #include "common/EnumTools.hpp"
 #include "common/config.hpp"
+#include "common/core/LedAnimator.hpp"
 #include "common/dsp/math/RunningAverage.hpp"
 #include "common/dsp/math/math_utils.hpp"
 #include "common/peripherals/NAU88C22.hpp"
+#include "common/peripherals/PioDebouncer.hpp"
 #include "I2S.hpp"
 #include "Kastle2_parameters.hpp"
 
+/**
+ * ADC sampling: 1 = round robin over the four ADC inputs filled by DMA, one interrupt per mux step,
+ * 0 = one interrupt per conversion. The host renderer emulates the ADC conversion by conversion.
+ */
+#ifndef ADC_DMA_ENABLED
+#ifdef KASTLE2_HOST
+#define ADC_DMA_ENABLED 0
+#else
+#define ADC_DMA_ENABLED 1
+#endif
+#endif
+
 namespace kastle2
 {
 
@@ -224,6 +241,7 @@ public:
         EEPROM_WILL_CLEAR,
         I2S_FAIL,
         CODEC_FAIL,
+        WATCHDOG_RESET,
         COUNT
     };
 
@@ -288,6 +306,10 @@ public:
 
     /**
      * @brief Reads the buttons, updates all the "pressed" and "released" states.
+     *
+     * The buttons are debounced and timestamped by PioDebouncer, this only takes its new events,
+     * so it can run often. The "just" states add up until ClearButtonJusts().
+     * With the inputs overridden the buttons come from the GPIO snapshot instead.
      */
     void ReadButtons();
 
@@ -319,6 +341,42 @@ public:
      */
     void SetLed(const Led led, const uint8_t r, const uint8_t g, const uint8_t b);
 
+    /**
+     * @brief Plays the animation on the LED, over the SetLed() color until it ends or StopLedAnimation().
+     * @details Rendered by the LED frame interrupt at its own rate, the UI loop doesn't update it.
+     * @param led LED to animate
+     * @param animation Animation made by the LedAnimator::Animation factories
+     */
+    void PlayLedAnimation(const Led led, const LedAnimator::Animation &animation)
+    {
+        led_animator_.Play(static_cast<size_t>(led), animation);
+    }
+
+    /**
+     * @brief Stops the animation of the LED, it shows the SetLed() color again.
+     */
+    void StopLedAnimation(const Led led)
+    {
+        led_animator_.Stop(static_cast<size_t>(led));
+    }
+
+    /**
+     * @brief Publishes the band levels for the meter animations (LedAnimator::Animation::Meter).
+     * @details Called by one core only, the LevelMeter on the second core.
+     */
+    void PublishLedMeter(const LedAnimator::MeterLevels &levels)
+    {
+        led_animator_.PublishMeter(levels);
+    }
+
+    /**
+     * @brief Returns true if an animation plays on the LED.
+     */
+    bool IsLedAnimating(const Led led) const
+    {
+        return led_animator_.IsPlaying(static_cast<size_t>(led));
+    }
+
     /**
      * @brief Checks if the button was just pressed.
      * @param button Button to check
@@ -340,6 +398,22 @@ public:
      */
     bool Pressed(const Button button) const;
 
+    /**
+     * @brief Checks if any button was just pressed or released.
+     * @return True if there is a "just" state since ClearButtonJusts()
+     */
+    bool HasButtonEdges() const
+    {
+        return buttons_just_pressed_.any() || buttons_just_released_.any();
+    }
+
+    /**
+     * @brief Time of the last press of the button, from the debouncer timestamp.
+     * @param button Button to check
+     * @return time_us_32() time of the first edge of the press
+     */
+    uint32_t PressedTimeUs(const Button button) const;
+
     /**
      * @brief Checks if the button is pressed and how long.
      * @param button Button to check
@@ -375,6 +449,27 @@ public:
      */
     bool GetSyncIn() const;
 
+    /**
+     * @brief Rising edges of a digital input counted by the GPIO interrupt (kEdgeCaptureInputs).
+     */
+    struct DigitalInputEdges
+    {
+        uint32_t count;   ///< Number of the rising edges since the start (wraps)
+        uint32_t time_us; ///< time_us_32() time of the last one
+    };
+
+    /**
+     * @brief Digital inputs timestamped by the GPIO interrupt, see InputEdges for reading them in the audio loop.
+     */
+    static constexpr std::array kEdgeCaptureInputs = {DigitalInput::TRIG_IN, DigitalInput::RESET_IN, DigitalInput::SYNC_IN};
+
+    /**
+     * @brief Reads the rising edges of a digital input, consistently from any core.
+     * @param input One of kEdgeCaptureInputs, the others have no edges
+     * @return Number of the edges and the time of the last one
+     */
+    DigitalInputEdges GetDigitalInEdges(const DigitalInput input) const;
+
     /**
      * @brief Whether Audio In jack is plugged in. On Citadel this is true if either left or right jack plugged.
      * @note BE CAREFUL! On Kastle 2 it can product false positives if a signal is patched into patch bay.
@@ -396,6 +491,16 @@ public:
      */
     void SetDigitalOut(const DigitalOutput output, const bool state);
 
+    /**
+     * @brief Sets the digital output at the given time, from a timer interrupt (precise to a few us).
+     * @param output Digital output to set
+     * @param state True for high, false for low
+     * @param time_us time_us_32() time of the edge, eg. Kastle2::AudioFrameToOutputTime(), past times are set right away
+     * @return False if kMaxOutputEdges edges are already waiting, the output is set right away then
+     * @note Callable from both cores, the edges of an output are set in the time order.
+     */
+    bool ScheduleDigitalOut(const DigitalOutput output, const bool state, const uint32_t time_us);
+
     /**
      * @brief Sets the top panel gate output.
      * @param state True for high, false for low
@@ -421,6 +526,36 @@ public:
      */
     bool GetRawButtonState(const Button button) const;
 
+    /**
+     * @brief Everything the apps read from the inputs, for recording and replaying them (see InputRecorder).
+     */
+    struct InputSnapshot
+    {
+        EnumArray<AnalogInput, int32_t> analog;               ///< GetAnalogValue()
+        EnumArray<CalibratedAnalogInput, int32_t> pitch_fine; ///< GetPitchValueFine()
+        uint32_t gpio;                                        ///< Levels of the button and digital input pins (gpio_get_all())
+        EnumArray<DigitalInput, uint32_t> edges;              ///< GetDigitalInEdges() counts
+    };
+
+    /**
+     * @brief Takes the current state of all the inputs.
+     * @param snapshot Filled with the inputs
+     */
+    void GetInputSnapshot(InputSnapshot &snapshot) const;
+
+    /**
+     * @brief Shows a snapshot to the apps instead of the real inputs, until ReleaseInputs().
+     * @details The ADC keeps running with the same timing (GetAdcCycles() still counts), its results are not stored.
+     *          Buttons, digital inputs and their edges come from the snapshot too, edges it adds are timestamped now.
+     * @param snapshot Inputs to show
+     */
+    void OverrideInputs(const InputSnapshot &snapshot);
+
+    /**
+     * @brief Goes back to the real inputs after OverrideInputs(). The edge counts continue from the snapshot.
+     */
+    void ReleaseInputs();
+
     /**
      * @brief Changes the UI layer, freezing the pots.
      * @param layer Layer to change to
@@ -462,6 +597,21 @@ public:
      */
     int32_t GetAnalogValue(const AnalogInput input) const;
 
+    /**
+     * @brief Fractional bits of GetPitchValueFine(), it returns 1/16 of the GetAnalogValue() step.
+     */
+    static constexpr size_t kPitchFineBits = 4;
+
+    /**
+     * @brief Returns a pitch input in a finer resolution than GetAnalogValue() (kPitchFineBits more bits).
+     * @details The pitch inputs aren't multiplexed, so the ADC converts them all the time. The conversions
+     *          of the last kPitchBoxcarSteps multiplexer steps are averaged (boxcar filter), which lowers
+     *          the noise and gives the extra resolution. Updated once per multiplexer step, no need to average it again.
+     * @param input AnalogInput::PITCH_1 or AnalogInput::PITCH_2
+     * @return int32_t Normalized and calibrated value in 1/16 of the ADC step (GetAnalogValue() << kPitchFineBits)
+     */
+    int32_t GetPitchValueFine(const AnalogInput input) const;
+
     /**
      * @brief Wrapper around Feed inputs (they are pulled up so we can get a tri-state). Labeled "GRC on Kastle 2".
      * @param input Feed input to read (1, 2, 3)
@@ -494,6 +644,40 @@ public:
      */
     void SetCvOut(const int32_t val);
 
+    /**
+     * @brief Values of a streamed analog output per audio block.
+     */
+    static constexpr size_t kAnalogStreamFrames = 16;
+
+    /**
+     * @brief Rate of the streamed analog outputs (AUDIO_LOOP_RATE * kAnalogStreamFrames, 14.7 kHz by default).
+     */
+    static constexpr float kAnalogStreamRate = AUDIO_LOOP_RATE * static_cast<float>(kAnalogStreamFrames);
+    static_assert(SYSTEM_CLOCK_KHZ * 1000.0f / kAnalogStreamRate <= 65535.0f, "The DMA timer period of the analog streams needs 16 bits");
+
+    /**
+     * @brief Streams the analog output at kAnalogStreamRate instead of one value per block.
+     * DMA paced by a DMA timer writes the values to the PWM compare register, no interrupt is involved.
+     * The streamed output ignores SetAnalogOut() and friends. The other output of the same PWM slice
+     * (TRI and ENV share one) keeps working, its changes go out with the next block.
+     * @param output Analog output to stream
+     * @param enabled True to stream, false to go back to the single values
+     */
+    void SetAnalogStreamEnabled(const AnalogOutput output, const bool enabled);
+
+    /**
+     * @brief Sets the values of a streamed output for the next block, call it from the audio loop.
+     * @param output Streamed analog output
+     * @param values kAnalogStreamFrames 10-bit values (range 0-1023), evenly spread over the block
+     */
+    void SetAnalogStream(const AnalogOutput output, std::span<const int32_t, kAnalogStreamFrames> values);
+
+    /**
+     * @brief Starts the streams of the values set during the last block.
+     * @note Called by Kastle2 at the start of each audio block, so the streams keep the audio timing.
+     */
+    void CommitAnalogStreams();
+
     /**
      * @brief Freezes the current pot values, so they need to be wiggled to receive new values
      */
@@ -554,9 +738,18 @@ public:
     }
 
     /**
-     * @brief Wait time between UI readings
+     * @brief Gets the number of finished passes of the ADC over all the analog inputs.
+     * @return Number of passes since Init(), wraps around.
      */
-    static constexpr size_t kUiRefreshWaitMs = 10;
+    uint32_t GetAdcCycles() const
+    {
+        return adc_cycles_;
+    }
+
+    /**
+     * @brief Time the buttons are ignored for after a change, hides the bouncing (see PioDebouncer)
+     */
+    static constexpr uint32_t kButtonLockoutUs = 10000;
 
     /**
      * @brief Pot not ready yet.
@@ -575,9 +768,30 @@ public:
     void StartAdcConversion(const bool increment = true);
 
     /**
-     * @brief Whether the LEDs were just updated. Useful for interefence handling.
+     * @brief Handler for the ADC DMA interrupts (ADC_DMA_ENABLED) - called from the global interrupt handler
+     */
+    void AdcDmaIrqHandler();
+
+    /**
+     * @brief Handler for the digital input GPIO interrupts - called from the global GPIO callback
+     * @param gpio Pin of the edge
+     */
+    void DigitalInputIrqHandler(const uint gpio);
+
+    /**
+     * @brief Handler for the output edge timer alarm - called from the global alarm callback
+     */
+    void OutputEdgeAlarmHandler();
+
+    /**
+     * @brief Timer alarm of the scheduled digital output edges (ScheduleDigitalOut()).
+     */
+    static constexpr uint kOutputEdgeAlarm = 0;
+
+    /**
+     * @brief Whether a new LED frame was just sent. Useful for interefence handling.
      * @note Can be called only once every time we want to get the result - the flag is cleared after the call.
-     * @return True if just updated, next update in few ms.
+     * @return True if just updated, frames are sent only when the LEDs change, at most every ~1 ms.
      */
     bool HasLedsJustUpdated()
     {
@@ -624,6 +838,12 @@ public:
         return i2s_;
     }
 
+    /**
+     * @brief Keeps the LED data rate, the analog stream rate and the button lockout after a system clock change (see ClockGovernor).
+     * @param system_clock_hz The new system clock.
+     */
+    void SetSystemClock(const uint32_t system_clock_hz);
+
     /**
      * @brief Override the detected hardware.
      * @note Use after Kastle2::Init();
@@ -647,6 +867,42 @@ private:
     EnumArray<AnalogInput, size_t> adc_dirty_counter_;
     static constexpr size_t kAdcDirtyCounterMax = 2; // Leave at least at 2!!!
     size_t adc_discard_readings_counter_ = 0;
+    volatile uint32_t adc_cycles_ = 0;
+    void SelectNextAdcMux();
+    void StoreAdcResult(const HwAnalogInput hw_input, int32_t result);
+
+    // ADC DMA: kAdcDmaRounds conversions of all four inputs per mux step, only the last round is used,
+    // the ones before let the mux settle (like adc_discard_readings_counter_)
+    static constexpr size_t kAdcDmaRounds = 5;
+    static constexpr size_t kAdcDmaSamples = kAdcDmaRounds * static_cast<size_t>(HwAnalogInput::COUNT);
+    std::array<uint16_t, kAdcDmaSamples> adc_dma_buffer_;
+    uint32_t adc_dma_channel_ = 0;
+
+    // Pitch boxcar: StoreAdcResult() gets the sum of kPitchSamplesPerStep conversions of a pitch input per mux step,
+    // the sums of the last kPitchBoxcarSteps steps are averaged
+#if ADC_DMA_ENABLED
+    static constexpr size_t kPitchSamplesPerStep = kAdcDmaRounds;
+#else
+    static constexpr size_t kPitchSamplesPerStep = 1;
+#endif
+    static constexpr size_t kPitchBoxcarSteps = 8;
+    static constexpr int32_t kPitchBoxcarSamples = kPitchSamplesPerStep * kPitchBoxcarSteps;
+    struct PitchBoxcar
+    {
+        std::array<int32_t, kPitchBoxcarSteps> sums{};
+        int32_t total = 0;
+        size_t pos = 0;
+    };
+    EnumArray<CalibratedAnalogInput, PitchBoxcar> pitch_boxcars_;
+    EnumArray<CalibratedAnalogInput, int32_t> pitch_fine_values_;
+
+    /**
+     * @brief Adds the conversions of one mux step to the pitch boxcar.
+     * @param pitch Pitch input
+     * @param sum Sum of kPitchSamplesPerStep conversions
+     * @return Average of the boxcar in the fine resolution (kPitchFineBits)
+     */
+    int32_t DecimatePitch(const CalibratedAnalogInput pitch, const int32_t sum);
 
     // DAC/ADC settings
     // static constexpr int32_t kAnalogInputMax = ADC_MAX;
@@ -662,20 +918,102 @@ private:
     static constexpr uint32_t kCvSliceNum = 3;
     static constexpr uint32_t kCvPwmChannel = PWM_CHAN_A;
 
+    /**
+     * @brief Writes the PWM level of the output, or keeps it for the next block when its slice is streamed.
+     */
+    void WriteAnalogLevel(const AnalogOutput output, const int32_t val);
+
+    // Analog output streams, one DMA channel per PWM slice: 0 is TRI (A) and ENV (B), 1 is CV (A)
+    static constexpr size_t kStreamSlices = 2;
+    static constexpr std::array<uint32_t, kStreamSlices> kStreamSliceNums = {kLfoEnvSliceNum, kCvSliceNum};
+    static constexpr size_t StreamSlice(const AnalogOutput output)
+    {
+        return output == AnalogOutput::CV_OUT ? 1 : 0;
+    }
+    static constexpr bool StreamChannelB(const AnalogOutput output)
+    {
+        return output == AnalogOutput::ENV_OUT;
+    }
+    bool IsSliceStreamed(const size_t slice) const;
+    void InitAnalogStreams();
+    void SetAnalogStreamClock(const uint32_t system_clock_hz);
+    void RestoreAnalogLevels(const size_t slice);
+    EnumArray<AnalogOutput, uint16_t> analog_levels_ = {kPwmResolution, kPwmResolution, kPwmResolution}; // PWM levels (inverted)
+    EnumArray<AnalogOutput, bool> analog_streamed_ = {};
+    EnumArray<AnalogOutput, std::array<uint16_t, kAnalogStreamFrames>> analog_stream_levels_ = {};
+    std::array<std::array<uint32_t, kAnalogStreamFrames>, kStreamSlices> analog_stream_words_ = {};
+    std::array<int, kStreamSlices> analog_stream_channels_ = {-1, -1};
+    int analog_stream_timer_ = -1;
+    bool analog_streaming_ = false;
+
     // FEED stuff
     static constexpr bool kTriStateFeedEnabled = true;  // default is true, but can be disabled to get regular ADC inputs
     static constexpr int32_t kFeedLowThreshold = 1000;  // minus (low)
     static constexpr int32_t kFeedHighThreshold = 2200; // plus (high)
     static constexpr int32_t kFeedCenterApprox = 1620;  // center (unconnected)
 
+    // Captured digital input edges, written by the GPIO interrupt, read with the sequence like a seqlock
+    struct CapturedEdges
+    {
+        volatile uint32_t sequence = 0;
+        volatile uint32_t count = 0;
+        volatile uint32_t time_us = 0;
+    };
+    EnumArray<DigitalInput, CapturedEdges> input_edges_;
+
+    // Inputs replaced by OverrideInputs(), the ADC results and the pin interrupts are ignored meanwhile
+    volatile bool inputs_overridden_ = false;
+    uint32_t override_gpio_ = 0;
+    bool ReadInputPin_(const size_t pin) const
+    {
+        return inputs_overridden_ ? (override_gpio_ >> pin) & 1 : gpio_get(pin);
+    }
+    // All the pins in one read
+    uint32_t ReadInputGpio_() const
+    {
+        return inputs_overridden_ ? override_gpio_ : gpio_get_all();
+    }
+
+    // Scheduled digital output edges, sorted by time, shared by the cores and the alarm
+    struct OutputEdge
+    {
+        uint32_t time_us;
+        DigitalOutput output;
+        bool state;
+    };
+    static constexpr size_t kMaxOutputEdges = 16;
+    std::array<OutputEdge, kMaxOutputEdges> output_edges_;
+    size_t output_edges_count_ = 0;
+    spin_lock_t *output_edges_lock_ = nullptr;
+
+    /**
+     * @brief Sets the due edges and arms the alarm for the next one, call with output_edges_lock_ held.
+     */
+    void ArmOutputEdgeAlarm();
+
     // LEDs
     EnumArray<Led, uint32_t> led_buffer_ = {0x000000, 0x000000, 0x000000};
-    bool leds_just_updated_ = false;                  // For faking quick LED blinking - preventing interferences
-    size_t led_update_counter_ = 0;                   // Counts how many ADC readings we have done since the last LED update
-    static constexpr size_t kLedUpdateInterval = 512; // Updated every 256 ADC readings
+    bool leds_just_updated_ = false;                 // For faking quick LED blinking, set when a frame was sent
+    size_t led_frame_counter_ = kLedFrameInterval;   // Counts how many ADC readings we have done since the last LED frame
+    static constexpr size_t kLedFrameInterval = 512; // At most one frame every 512 ADC readings (~1 ms)
+    EnumArray<Led, uint32_t> led_latched_ = {0x000000, 0x000000, 0x000000}; // Latched colors, shown when no animation plays
+    LedAnimator led_animator_;
+    static_assert(static_cast<size_t>(Led::COUNT) <= LedAnimator::kMaxLeds);
+
+    /**
+     * @brief Applies the color correction of the panel type.
+     */
+    uint32_t CorrectLedColor(const uint32_t color) const;
+
+    /**
+     * @brief Writes the colors of the playing animations to the LED frame, called by SendLeds().
+     */
+    void RenderLedAnimations();
 
     /**
-     * @brief Sends the LEDs. It's called automatically in the ADC loop. You don't need to call it manually.
+     * @brief Starts the DMA transfer of the LED frame if it changed and kLedFrameInterval passed since the last one.
+     * @note Called from the ADC interrupt right after a mux change, when the readings are thrown away anyway.
+     *       You don't need to call it manually.
      */
     void SendLeds();
 
@@ -703,27 +1041,36 @@ private:
      */
     int32_t AverageAdcResult(const AnalogInput input, const int32_t result);
 
+    /**
+     * @brief Precomputes the pitch calibrations from the active calibration source (identity when disabled).
+     * @note Builds the table the ADC interrupt isn't reading and swaps them when done.
+     */
     void UpdateCalibrationMaps();
 
+    /**
+     * @brief Applies the precomputed pitch calibration, called from the ADC interrupt.
+     * @param pitch Pitch input
+     * @param raw Raw value in the fine resolution (kPitchFineBits)
+     * @return Calibrated value in the fine resolution
+     */
+    int32_t CalibratePitch(const CalibratedAnalogInput pitch, const int32_t raw) const;
+
     // Pots (ADC abstraction)
     Layer layer_ = Layer::NORMAL;
     EnumArray<Pot, int32_t> pot_freeze_values_;
 
-    EnumArray<Pot, RunningAverage<int32_t>> pot_averages_ = {
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage),
-        RunningAverage<int32_t>(kBasePotsRunningAverage)};
+    EnumArray<Pot, RunningAverage<int32_t, kBasePotsRunningAverage>> pot_averages_;
 
     // Buttons (Fancy abstraction!)
-    EnumArray<Button, bool> buttons_pressed_;
-    EnumArray<Button, bool> prev_buttons_pressed_;
-    EnumArray<Button, bool> buttons_just_pressed_;
-    EnumArray<Button, bool> buttons_just_released_;
-    EnumArray<Button, absolute_time_t> buttons_pressed_time_;
+    EnumBitset<Button> buttons_pressed_;
+    EnumBitset<Button> buttons_just_pressed_;
+    EnumBitset<Button> buttons_just_released_;
+    EnumArray<Button, uint32_t> buttons_pressed_time_us_;
+    PioDebouncer buttons_debouncer_;
+    // Applies the new pressed state, adds the edges to the "just" states
+    void SetButtons_(const EnumBitset<Button> pressed, const uint32_t time_us);
+    // Gathers the buttons from the GPIO snapshot, the pins of ButtonsPins are active low
+    static EnumBitset<Button> ButtonsFromGpio_(const uint32_t gpio);
 
     // Calibrations
     enum class CalibrationSource
@@ -764,7 +1111,19 @@ private:
 
     // static constexpr size_t kCalibrationMapSize = static_cast<size_t>(Hardware::Calibration::COUNT) / 2;
     static constexpr size_t kCalibrationMapSize = 8; // ADC_0V to ADC_7V
-    EnumArray<CalibratedAnalogInput, MapDef<int32_t, kCalibrationMapSize>> calibration_maps_;
+    // Raw to calibrated pitch, piecewise linear through the calibration points and both in the fine resolution (kPitchFineBits).
+    // Each segment has its offset and slope ready, so the ADC interrupt doesn't divide. The outer segments extrapolate.
+    struct PitchCalibration
+    {
+        std::array<int32_t, kCalibrationMapSize> input;      // Raw value at the segment starts (ascending or descending)
+        std::array<int32_t, kCalibrationMapSize - 1> offset; // Calibrated value at the segment starts
+        std::array<int32_t, kCalibrationMapSize - 1> gain;   // Slope of the segments in Q16
+        bool ascending;
+    };
+    using PitchCalibrations = EnumArray<CalibratedAnalogInput, PitchCalibration>;
+    // UpdateCalibrationMaps() builds the spare table and then swaps the pointer, the ADC interrupt never sees a half built one
+    std::array<PitchCalibrations, 2> pitch_calibrations_;
+    const PitchCalibrations *volatile active_pitch_calibrations_ = &pitch_calibrations_[0];
 
     // Detecting audio in jack mechanism
     size_t audio_in_jack_plugged_counter_ = 0;
@@ -0,0 +1,69 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "InputEdges.hpp"
+#include "common/core/Kastle2.hpp"
+#include "common/dsp/math/math_utils.hpp"
+
+namespace kastle2
+{
+
+uint32_t InputEdges::Process(const bool enabled)
+{
+    const Hardware::DigitalInputEdges edges = Kastle2::hw.GetDigitalInEdges(input_);
+
+    // The edges before the first call don't count
+    if (!started_)
+    {
+        started_ = true;
+        count_ = edges.count;
+    }
+
+    const uint32_t new_edges = edges.count - count_;
+    count_ = edges.count;
+    edges_ = 0;
+    if (new_edges == 0)
+    {
+        return 0;
+    }
+
+    if (has_edge_)
+    {
+        period_us_ = (edges.time_us - time_us_) / new_edges;
+    }
+    has_edge_ = true;
+    time_us_ = edges.time_us;
+    if (!enabled)
+    {
+        return 0;
+    }
+
+    const int32_t frame = static_cast<int32_t>(Kastle2::TimeToAudioFrame(edges.time_us) + kLatencyFrames - Kastle2::GetAudioFrame());
+    frame_ = static_cast<uint32_t>(constrain(frame, 0, static_cast<int32_t>(AUDIO_BUFFER_SIZE) - 1));
+    edges_ = new_edges;
+    return edges_;
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include "common/core/Hardware.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class InputEdges
+ * @ingroup core
+ * @brief Rising edges of a digital input in the audio loop, from the GPIO interrupt timestamps.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Reading the input level once per block (with EdgeDetector) misses the pulses shorter than a block
+ * and places the edge anywhere within it. Here the GPIO interrupt counts the edges and timestamps them
+ * (Hardware::GetDigitalInEdges()), Process() reads the edges since the last block.
+ *
+ * The last edge is placed kLatencyFrames after its frame, so every edge lands at its own position
+ * within the block, one block late. The period between the edges is measured from the timestamps,
+ * so it works for the clocks faster than the audio blocks as well.
+ */
+class InputEdges
+{
+public:
+    /**
+     * @brief Delay of the edges, the edges captured during a block are placed into the next one
+     */
+    static constexpr uint32_t kLatencyFrames = AUDIO_BUFFER_SIZE;
+
+    /**
+     * @brief Constructor
+     * @param input One of Hardware::kEdgeCaptureInputs
+     */
+    explicit InputEdges(const Hardware::DigitalInput input) : input_(input) {}
+
+    /**
+     * @brief Reads the new edges, call it once per audio block
+     * @param enabled When false, the edges are read but not reported (eg. sync disabled in the settings)
+     * @return Number of the rising edges since the last call
+     */
+    uint32_t Process(const bool enabled = true);
+
+    /**
+     * @brief Number of the rising edges found by the last Process()
+     */
+    inline uint32_t GetEdges() const
+    {
+        return edges_;
+    }
+
+    /**
+     * @brief Frame of the last edge within the current block, valid when GetEdges() is not 0
+     * @return Frame offset (0 to AUDIO_BUFFER_SIZE - 1)
+     */
+    inline uint32_t GetFrame() const
+    {
+        return frame_;
+    }
+
+    /**
+     * @brief Period of the edges, averaged over the edges of the last block
+     * @return Period in microseconds, 0 until two edges arrived
+     */
+    inline uint32_t GetPeriodUs() const
+    {
+        return period_us_;
+    }
+
+private:
+    Hardware::DigitalInput input_;
+    bool started_ = false;
+    bool has_edge_ = false;
+    uint32_t count_ = 0;
+    uint32_t time_us_ = 0;
+    uint32_t edges_ = 0;
+    uint32_t frame_ = 0;
+    uint32_t period_us_ = 0;
+};
+
+}
@@ -0,0 +1,204 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#ifndef KASTLE2_HOST
+#include "hardware/interp.h"
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class Interp
+ * @ingroup core
+ * @brief Phase accumulation and table lookups on the RP2040 SIO interpolators.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Each core has two interpolators, which do add, shift, mask and table base add in one cycle:
+ * - interp0 is an oscillator: a 32 bit phase accumulator which returns the table entry of the current phase
+ *   and advances the phase on each PopOscillator() call.
+ * - interp1 looks up the table entry of any phase (eg. a phase modulated FM carrier).
+ *
+ * The phase is unsigned, the whole 32 bit range is one table period, the top table_bits select the entry.
+ * For the q31_t oscillators (-1 to 1 phase) use ToPhase(), which matches the q31_sine(phase / 2 + Q31_HALF)
+ * indexing.
+ *
+ * The interpolators are not saved or restored, so set them up at the start of each block and use them only
+ * from the audio code (nothing else on the same core must use them in the meantime).
+ * The host build runs the same thing in software.
+ */
+class Interp
+{
+public:
+    /**
+     * @brief Converts a q31_t oscillator phase (-1 to 1) to the unsigned interpolator phase (0 to 1).
+     */
+    static constexpr uint32_t ToPhase(const int32_t phase)
+    {
+        return static_cast<uint32_t>(phase) ^ 0x80000000u;
+    }
+
+    /**
+     * @brief Converts the unsigned interpolator phase back to the q31_t oscillator phase.
+     */
+    static constexpr int32_t FromPhase(const uint32_t phase)
+    {
+        return static_cast<int32_t>(phase ^ 0x80000000u);
+    }
+
+    /**
+     * @brief Sets up interp0 of the calling core as an oscillator reading the table.
+     * @param table Table with 2^table_bits entries.
+     * @param table_bits Number of bits of the table index.
+     * @param phase Starting phase.
+     * @param increment Phase increment per PopOscillator() call.
+     */
+    template <typename T>
+    static void SetupOscillator(const T *table, const uint32_t table_bits, const uint32_t phase, const uint32_t increment)
+    {
+#ifndef KASTLE2_HOST
+        ConfigureLane(interp0, table_bits, std::countr_zero(sizeof(T)), true);
+        interp0->accum[0] = phase;
+        interp0->base[0] = increment;
+        interp0->base[2] = reinterpret_cast<uintptr_t>(table);
+#else
+        oscillator_ = {reinterpret_cast<uintptr_t>(table), 32 - table_bits, phase, increment};
+#endif
+    }
+
+    /**
+     * @brief Returns the current phase of the interp0 oscillator.
+     */
+    static inline uint32_t GetPhase()
+    {
+#ifndef KASTLE2_HOST
+        return interp0->accum[0];
+#else
+        return oscillator_.phase;
+#endif
+    }
+
+    /**
+     * @brief Returns the table entry of the current interp0 phase and advances the phase.
+     */
+    template <typename T>
+    static inline T PopOscillator()
+    {
+#ifndef KASTLE2_HOST
+        return *reinterpret_cast<const T *>(interp0->pop[2]);
+#else
+        const T value = reinterpret_cast<const T *>(oscillator_.table)[oscillator_.phase >> oscillator_.shift];
+        oscillator_.phase += oscillator_.increment;
+        return value;
+#endif
+    }
+
+    /**
+     * @brief Returns the address of the table entry of the current interp0 phase and advances the phase.
+     * For tables read with interpolation, which need the following entry too.
+     */
+    template <typename T>
+    static inline const T *PopOscillatorAddress()
+    {
+#ifndef KASTLE2_HOST
+        return reinterpret_cast<const T *>(interp0->pop[2]);
+#else
+        const T *entry = reinterpret_cast<const T *>(oscillator_.table) + (oscillator_.phase >> oscillator_.shift);
+        oscillator_.phase += oscillator_.increment;
+        return entry;
+#endif
+    }
+
+    /**
+     * @brief Sets up interp1 of the calling core for lookups in the table.
+     * @param table Table with 2^table_bits entries.
+     * @param table_bits Number of bits of the table index.
+     */
+    template <typename T>
+    static void SetupLookup(const T *table, const uint32_t table_bits)
+    {
+#ifndef KASTLE2_HOST
+        ConfigureLane(interp1, table_bits, std::countr_zero(sizeof(T)), false);
+        interp1->base[2] = reinterpret_cast<uintptr_t>(table);
+#else
+        lookup_ = {reinterpret_cast<uintptr_t>(table), 32 - table_bits, 0, 0};
+#endif
+    }
+
+    /**
+     * @brief Returns the table entry of the phase using interp1.
+     */
+    template <typename T>
+    static inline T Lookup(const uint32_t phase)
+    {
+#ifndef KASTLE2_HOST
+        interp1->accum[0] = phase;
+        return *reinterpret_cast<const T *>(interp1->peek[2]);
+#else
+        return reinterpret_cast<const T *>(lookup_.table)[phase >> lookup_.shift];
+#endif
+    }
+
+private:
+#ifndef KASTLE2_HOST
+    /**
+     * @brief Lane 0 turns the phase into the byte offset of the entry, lane 1 adds nothing.
+     * The full result (PEEK2/POP2) is then the table base (BASE2) plus the offset.
+     * With add_raw, POP writes the phase plus BASE0 back to lane 0, which is the phase accumulation.
+     */
+    static void ConfigureLane(interp_hw_t *interp, const uint32_t table_bits, const uint32_t element_bits, const bool add_raw)
+    {
+        interp_config config = interp_default_config();
+        interp_config_set_shift(&config, 32 - table_bits - element_bits);
+        interp_config_set_mask(&config, element_bits, element_bits + table_bits - 1);
+        interp_config_set_add_raw(&config, add_raw);
+        interp_set_config(interp, 0, &config);
+
+        config = interp_default_config();
+        interp_set_config(interp, 1, &config);
+        interp->accum[1] = 0;
+        interp->base[1] = 0;
+    }
+#else
+    struct Unit
+    {
+        uintptr_t table;
+        uint32_t shift;
+        uint32_t phase;
+        uint32_t increment;
+    };
+
+    // The interpolators are per core, so are the core threads of the host build
+    static inline thread_local Unit oscillator_{};
+    static inline thread_local Unit lookup_{};
+#endif
+};
+
+}
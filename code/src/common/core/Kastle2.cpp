@@ -23,21 +23,139 @@ SOFTWARE.
 */
 
 #include "Kastle2.hpp"
+#include "hardware/adc.h"
+#include "hardware/uart.h"
 #include "common/debug.hpp"
+#include "common/debug/AudioClockMonitor.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/fastcode.hpp"
 #include "tusb.h"
 
 using namespace kastle2;
 
+#ifndef KASTLE2_HOST
+// Wakes the UI core for tud_task()
+static void usb_irq_handler()
+{
+    UiScheduler::Post(UiScheduler::Event::USB);
+}
+#endif
+
 void Kastle2::StartAudio(I2S::AudioCallback callback)
 {
     audio_callback_ = callback;
-    hw.GetI2S().StartAudio(AudioCallback);
+    StartI2S(AudioCallback);
+}
+
+void Kastle2::StartI2S(I2S::AudioCallback callback)
+{
+    hw.GetI2S().StartAudio(callback);
+
+    // An overclocked plan has to prove itself, otherwise the default one takes over
+    if (ClockPlan::IsOverclocked() && !CheckAudioTiming())
+    {
+        ClockPlan::FallBack();
+        const uint32_t clock_hz = clock_get_hz(clk_sys);
+        hw.GetI2S().SetClockDividers(hw.GetI2S().GetClockDividers(clock_hz));
+        hw.SetSystemClock(clock_hz);
+        governor.Init();
+        hw.ShowStartupMessage(Hardware::StartupMessage::I2S_FAIL);
+    }
+
+    // From now on only the audio callback keeps the chip running
+    PostMortem::Arm();
+}
+
+COLDCODE bool Kastle2::CheckAudioTiming()
+{
+#ifndef KASTLE2_HOST
+    // The system clock against the crystal
+    const uint32_t clock_khz = ClockPlan::MeasureSystemClockKhz();
+    if (clock_khz + SYSTEM_CLOCK_KHZ / kTimingTolerance < SYSTEM_CLOCK_KHZ || clock_khz > SYSTEM_CLOCK_KHZ + SYSTEM_CLOCK_KHZ / kTimingTolerance)
+    {
+        return false;
+    }
+
+    // The audio blocks against the timer (crystal too), from the first block on
+    const absolute_time_t timeout = make_timeout_time_ms(kTimingCheckTimeoutMs);
+    while (audio_block_frame_ == 0)
+    {
+        if (absolute_time_diff_us(get_absolute_time(), timeout) <= 0)
+        {
+            return false;
+        }
+        sleep_us(100);
+    }
+    uint32_t start_frame, start_us;
+    ReadAudioBlockClock(start_frame, start_us);
+    uint32_t frame = start_frame, time_us = start_us;
+    while (frame - start_frame < kTimingCheckFrames)
+    {
+        if (absolute_time_diff_us(get_absolute_time(), timeout) <= 0)
+        {
+            return false;
+        }
+        sleep_us(100);
+        ReadAudioBlockClock(frame, time_us);
+    }
+    const uint32_t expected_us = static_cast<uint32_t>(static_cast<uint64_t>(frame - start_frame) * 1000000 / static_cast<uint32_t>(SAMPLE_RATE));
+    const uint32_t elapsed_us = time_us - start_us;
+    return elapsed_us + expected_us / kTimingTolerance >= expected_us && elapsed_us <= expected_us + expected_us / kTimingTolerance;
+#else
+    // The renderer isn't real-time
+    return true;
+#endif
 }
 
 void Kastle2::StartSecondCore(MultiCore::Worker second_core_worker)
 {
-    MultiCore::StartSecondCore(second_core_worker);
+    second_core_worker_ = second_core_worker;
+    MultiCore::StartSecondCore(SecondCoreEntry);
+}
+
+void Kastle2::SecondCoreEntry()
+{
+    // Each core has its own SysTick and stack
+    Profiler::InitCore();
+    MemoryMonitor::InitCore();
+    FlashWriter::InitCore();
+    second_core_worker_();
+}
+
+void Kastle2::RunUi(UiLoop ui_loop, UiCore core)
+{
+    ui_loop_ = ui_loop;
+#ifndef KASTLE2_HOST
+    if (core == UiCore::CORE_1 && second_core_worker_ == nullptr)
+    {
+        MultiCore::StartSecondCore(UiCoreEntry);
+        // Core 0 is left to the audio and ADC interrupts
+        while (true)
+        {
+            __wfi();
+        }
+    }
+#else
+    (void)core;
+#endif
+    UiTask();
+}
+
+void Kastle2::UiCoreEntry()
+{
+    Profiler::InitCore();
+    MemoryMonitor::InitCore();
+    FlashWriter::InitCore();
+    UiTask();
+}
+
+void Kastle2::UiTask()
+{
+    while (true)
+    {
+        ReadInputs();
+        ui_loop_();
+    }
 }
 
 void Kastle2::SetAppMidiCallback(midi::Handler::Callback callback)
@@ -48,6 +166,13 @@ void Kastle2::SetAppMidiCallback(midi::Handler::Callback callback)
 void Kastle2::BaseMidiCallback(midi::Message *msg)
 {
     base.MidiCallback(msg);
+
+    // The same message for the audio callback, at the frame it arrived
+    if (app_audio_midi_callback_ != nullptr)
+    {
+        const uint32_t time_us = msg->GetTime() != 0 ? msg->GetTime() : time_us_32();
+        audio_midi_queue_.Push({.msg = *msg, .frame = TimeToAudioFrame(time_us) + kMidiLatencyFrames});
+    }
 }
 
 void Kastle2::TestModeMidiCallback(midi::Message *msg)
@@ -58,14 +183,31 @@ void Kastle2::TestModeMidiCallback(midi::Message *msg)
     }
 }
 
-void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
+COLDCODE void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
 {
     // Fast code lives in RAM and is much faster than executing from the QSPI flash
+#ifdef FASTCODE_ENABLED
     copy_fastcode_to_ram();
+#endif
+
+    // What the audio left behind when the watchdog reset the chip, before the snapshot starts again
+    PostMortem::Check();
 
     // Fix for Rpi Debug Probe
     fix_pi_probe_debugging();
 
+    // Cycle counter for the audio path measurements
+    Profiler::InitCore();
+
+    // Cores the flash writes have to park
+    FlashWriter::InitCore();
+
+    // Stack canary for the memory usage report
+    MemoryMonitor::InitCore();
+
+    // RTT up-buffers for the binary telemetry
+    Telemetry::Init();
+
     test_mode_enabled_ = false;
 
 // Binary info
@@ -75,12 +217,10 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
     bi_decl(bi_program_description("Kastle 2"));
 #endif
 
-// Set a custom RP2040 frequency (necessary for proper I2S clock)
-#if defined(PICO_SDK_VERSION_MAJOR) && PICO_SDK_VERSION_MAJOR >= 2
-    set_sys_clock_hz(SYSTEM_CLOCK_KHZ * 1000, true);
-#else
-    set_sys_clock_khz(SYSTEM_CLOCK_KHZ, true);
-#endif
+    // Set a custom RP2040 frequency (necessary for proper I2S clock), see ClockPlan for the PLL, flash and voltage
+    ClockPlan::Apply();
+    // The LED driver was set up by its constructor, on the boot clock
+    hw.SetSystemClock(clock_get_hz(clk_sys));
 
     // Initialize Tiny USB for both MIDI and CDC
     tusb_init();
@@ -88,8 +228,34 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
     // Init Hardware
     hw.Init();
 
+    // Clock scaling levels, needs the I2S sample rate
+    governor.Init();
+
+    // The audio interrupt preempts the rest, so a long ADC or USB interrupt can't make it late
+    irq_set_priority(DMA_IRQ_0, kAudioIrqPriority);
+#if ADC_DMA_ENABLED
+    irq_set_priority(DMA_IRQ_1, kAdcIrqPriority);
+#else
+    irq_set_priority(ADC_IRQ_FIFO, kAdcIrqPriority);
+#endif
+    irq_set_priority(USBCTRL_IRQ, kUsbIrqPriority);
+    irq_set_priority(UART0_IRQ, kUartIrqPriority);
+    irq_set_priority(TIMER_IRQ_0 + Hardware::kOutputEdgeAlarm, kOutputEdgeIrqPriority);
+    irq_set_priority(IO_IRQ_BANK0, kInputEdgeIrqPriority);
+
+    // Background work of the UI, ReadInputs() runs it
+    InitUiTasks();
+
+    // DC offset removal, done by the I2S driver while converting the samples
+    hw.GetI2S().SetInputDcBlocker(kInputDcBlocker);
+    if (hw.GetVersion() == Hardware::Version::CITADEL && kCitadelOutputDcOffsetRemove)
+    {
+        hw.GetI2S().SetOutputDcOffset(kCitadelOutputDcOffset);
+    }
+
     // Init Codec
-    if (!codec.Init(Hardware::I2C_INSTANCE))
+    i2c_bus.Init(Hardware::I2C_INSTANCE);
+    if (!codec.Init(i2c_bus, I2S_SAMPLE_RATE))
     {
         while (1)
         {
@@ -98,7 +264,7 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
     }
 
     // Init memory
-    Memory::State state = memory.Init(Hardware::I2C_INSTANCE);
+    Memory::State state = memory.Init(i2c_bus);
     switch (state)
     {
     case Memory::State::OK:
@@ -114,6 +280,12 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
         break;
     }
 
+    // The audio stopped in the last run, PostMortem prints what it left behind
+    if (PostMortem::HasReport())
+    {
+        hw.ShowStartupMessage(Hardware::StartupMessage::WATCHDOG_RESET);
+    }
+
     // Read & set calibrations
     Hardware::CalibrationsType calibrations;
     if (memory.ReadCalibrations(calibrations))
@@ -124,11 +296,13 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
     // Do some readings to make sure everything is working and srand is activated etc.
     ReadInputs();
 
-    // Allow some time for ADC to take readings
-    sleep_ms(100);
-
-    // Button reading timeout setup
-    timeout_read_buttons_ = get_absolute_time();
+    // Wait for the ADC readings of all the inputs instead of a fixed delay
+    const uint32_t adc_cycles = hw.GetAdcCycles();
+    const absolute_time_t adc_timeout = make_timeout_time_ms(kStartupAdcTimeoutMs);
+    while (hw.GetAdcCycles() - adc_cycles < kStartupAdcCycles && absolute_time_diff_us(get_absolute_time(), adc_timeout) > 0)
+    {
+        sleep_us(100);
+    }
 
     // Init Midi
     midi.Init();
@@ -155,11 +329,82 @@ void Kastle2::Init(std::span<const SamplePlayer16bit::Sample> version_chain)
 
     // Set the MIDI callback for the Base
     midi.SetBaseCallback(BaseMidiCallback);
+    midi.SetMonitorCallback([](midi::Message *msg)
+                            { recorder.RecordMidi(*msg); });
+    midi.SetSysExCallback([](const uint8_t *data, size_t size, bool start, bool end, midi::Message::Source)
+                          {
+                              sysex_transfer.Receive(data, size, start, end);
+                              sync_link.Receive(data, size, start, end);
+                          });
+    // The master's macros reach the follower's pots and app as the NRPNs of the same number
+    sync_link.SetMacroCallback([](uint8_t index, uint16_t value)
+                               {
+                                   midi::Message msg = midi::Message::CreateNrpn(midi::Message::kAllChannels, index, value);
+                                   midi.Inject(&msg);
+                               });
 
     // Init Base
     base.Init();
 }
 
+COLDCODE void Kastle2::InitUiTasks()
+{
+    // Ties run in this order, the USB first (MIDI packets, the host renderer's time)
+#ifdef KASTLE2_HOST
+    // The host renderer moves the time in tud_task(), it has to run in every pass
+    ui_scheduler_.Add([](void *)
+                      { tud_task(); }, nullptr, 0, kUiTaskPeriodUs);
+#else
+    ui_scheduler_.Add([](void *)
+                      { tud_task(); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs, UiScheduler::Wake(UiScheduler::Event::USB));
+    // Runs after the TinyUSB handler, which queues the events for tud_task()
+    irq_add_shared_handler(USBCTRL_IRQ, usb_irq_handler, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+#endif
+    ui_scheduler_.Add([](void *)
+                      { midi.Process(); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs,
+                      UiScheduler::Wake(UiScheduler::Event::USB) | UiScheduler::Wake(UiScheduler::Event::UART) |
+                          UiScheduler::Wake(UiScheduler::Event::MIDI_OUT));
+#if KASTLE2_USB_AUDIO
+    ui_scheduler_.Add([](void *)
+                      {
+                          usb_audio.Process();
+                          clock_sync.Process(hw.GetI2S());
+                      },
+                      nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs, UiScheduler::Wake(UiScheduler::Event::USB));
+#endif
+    // Before the debug commands, it claims the serial input for its session
+    ui_scheduler_.Add([](void *)
+                      { uploader.Process(debug); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs, UiScheduler::Wake(UiScheduler::Event::USB));
+    // After the MIDI, which receives its requests
+    ui_scheduler_.Add([](void *)
+                      { sysex_transfer.Process(midi, presets); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs,
+                      UiScheduler::Wake(UiScheduler::Event::USB) | UiScheduler::Wake(UiScheduler::Event::UART));
+    ui_scheduler_.Add([](void *)
+                      { sync_link.Process(midi, base.GetClock().GetMidiPulsePeriodUs()); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs,
+                      UiScheduler::Wake(UiScheduler::Event::USB) | UiScheduler::Wake(UiScheduler::Event::UART));
+    // Takes the button changes debounced by the PIO
+    ui_scheduler_.Add([](void *)
+                      { hw.ReadButtons(); }, nullptr, kUiTaskPeriodUs, kUiTaskPeriodUs);
+    ui_scheduler_.Add([](void *)
+                      { codec.Update(); }, nullptr, kUiTaskPeriodUs, 5 * kUiTaskPeriodUs);
+    ui_scheduler_.Add([](void *)
+                      { memory.ProcessQueue(); }, nullptr, kUiTaskPeriodUs, 10 * kUiTaskPeriodUs);
+    // Starts the queued codec and EEPROM writes one after another
+    ui_scheduler_.Add([](void *)
+                      { i2c_bus.Process(); }, nullptr, kUiTaskPeriodUs, 5 * kUiTaskPeriodUs);
+    ui_scheduler_.Add([](void *)
+                      {
+                          debug.Process();
+                          Profiler::Process(debug);
+                          AudioClockMonitor::Process();
+                          MemoryMonitor::Process(debug);
+                          PostMortem::Process(debug);
+                          FlashWriter::Process(debug);
+                          probes.Process(debug);
+                      },
+                      nullptr, kUiTaskPeriodUs, 10 * kUiTaskPeriodUs);
+}
+
 void Kastle2::ReadInputs()
 {
 #if MEASURE_UI_LOOP
@@ -168,82 +413,226 @@ void Kastle2::ReadInputs()
 
     // Weird to have it at beginning of the function, but we are in while(true) loop...
     base.AfterUiLoop();
+#if SHOW_AUDIO_UNDERRUNS
+    if (GetUnderrunCount() != shown_underrun_count_)
+    {
+        shown_underrun_count_ = GetUnderrunCount();
+        timeout_underrun_led_ = make_timeout_time_ms(kUnderrunLedMs);
+    }
+    if (absolute_time_diff_us(get_absolute_time(), timeout_underrun_led_) > 0)
+    {
+        hw.SetLed(Hardware::Led::LED_3, 0xFF0000);
+    }
+#endif
     hw.LatchLeds();
 
-    // Process TinyUSB tasks (including MIDI and CDC Serial)
-    tud_task();
-
     // Each loop clear "JustPressed" and "JustReleased"
     hw.ClearButtonJusts();
 
-    // Prevents buttons bouncing
-    if (absolute_time_diff_us(timeout_read_buttons_, get_absolute_time()) > 0)
+    // Background tasks until the ADC has new readings, sleeping when none is due
+    const absolute_time_t frame_timeout = make_timeout_time_us(kUiFrameTimeoutUs);
+    while (true)
     {
-        hw.ReadButtons();
-        // Wait kUiRefreshWaitMs before next button read
-        timeout_read_buttons_ = make_timeout_time_ms(Hardware::kUiRefreshWaitMs);
+        ui_scheduler_.Process();
+        const uint32_t adc_cycles = hw.GetAdcCycles();
+        if (adc_cycles != frame_adc_cycles_)
+        {
+            frame_adc_cycles_ = adc_cycles;
+            break;
+        }
+        if (absolute_time_diff_us(get_absolute_time(), frame_timeout) <= 0)
+        {
+            break;
+        }
+#if MEASURE_UI_LOOP
+        Kastle2::hw.SetDebugPin(0, 0);
+#endif
+        UiScheduler::Idle();
+#if MEASURE_UI_LOOP
+        Kastle2::hw.SetDebugPin(0, 1);
+#endif
     }
 
-    codec.Update();
-    midi.Process();
+    // The recording takes the inputs of this loop, the replay puts its own in their place
+    recorder.Process(hw, midi);
+
     base.BeforeUiLoop();
-    memory.ProcessQueue();
-    debug.Process();
 #if MEASURE_UI_LOOP
     Kastle2::hw.SetDebugPin(0, 0);
 #endif
 }
 
-void Kastle2::AudioCallback(q15_t *input, q15_t *output, size_t size)
+void Kastle2::BeginAudioCallback(q15_t *input, size_t size)
 {
 #if MEASURE_AUDIO_LOOP
     Kastle2::hw.SetDebugPin(0, 1);
 #endif
-
-    // Citadel DC offset removal
-    if constexpr (kCitadelInputDcOffsetRemove)
+    // The analog streams of the last block, at a steady point of the block
+    hw.CommitAnalogStreams();
+    governor.BeginBlock();
+    FlashWriter::AudioBegin();
+    AudioClockMonitor::Begin(hw.GetI2S().GetIrqTime());
+    Profiler::Start(Profiler::Section::AUDIO_CALLBACK);
+    Trace::Begin(TraceSpan::AUDIO_CALLBACK);
+
+    // The USB audio runs at I2S_SAMPLE_RATE, the rest at SAMPLE_RATE
+#if KASTLE2_USB_AUDIO
+    clock_sync.Block(size);
+    if (!test_mode_enabled_)
     {
-        if (Kastle2::hw.GetVersion() == Hardware::Version::CITADEL)
-        {
-            for (size_t i = 0; i < size * 2; i++)
-            {
-                input[i] = q15_add(input[i], kCitadelInputDcOffset);
-            }
-        }
+        usb_audio.ReadBlock(input, size);
     }
+#else
+    (void)input;
+    (void)size;
+#endif
+}
 
+void Kastle2::EndAudioCallback(q15_t *output, size_t size)
+{
+#if KASTLE2_USB_AUDIO
     if (!test_mode_enabled_)
     {
-        base.BeforeAudioLoop(input, size);
-        audio_callback_(input, output, size);
-        base.AfterAudioLoop(input, output, size);
+        usb_audio.WriteBlock(output, size);
     }
-    else
+#endif
+    meter.WriteBlock(output, size);
+
+    Trace::End(TraceSpan::AUDIO_CALLBACK);
+    Profiler::End(Profiler::Section::AUDIO_CALLBACK);
+    AudioClockMonitor::End();
+    PostMortem::AudioBlock(hw.GetI2S());
+    FlashWriter::AudioEnd();
+    governor.EndBlock();
+#if MEASURE_AUDIO_LOOP
+    Kastle2::hw.SetDebugPin(0, 0);
+#endif
+}
+
+bool Kastle2::BeginAudioBlock(q15_t *input, q15_t *output, size_t size)
+{
+    // Frame clock for TimeToAudioFrame(), the first block starts at frame 0
+    const bool first_block = audio_block_sequence_ == 0;
+    audio_block_sequence_ = audio_block_sequence_ + 1;
+    __dmb();
+    if (!first_block)
+    {
+        audio_block_frame_ = audio_block_frame_ + size;
+    }
+    audio_block_time_us_ = time_us_32();
+    __dmb();
+    audio_block_sequence_ = audio_block_sequence_ + 1;
+
+    if (test_mode_enabled_)
     {
         test_mode_->AudioLoop(input, output, size);
+        return false;
     }
 
-    // Citadel DC offset removal
-    if constexpr (kCitadelOutputDcOffsetRemove)
+    DeliverAudioMidi(size);
+
+    Profiler::Start(Profiler::Section::BEFORE_AUDIO_LOOP);
+    base.BeforeAudioLoop(input, size);
+    Profiler::End(Profiler::Section::BEFORE_AUDIO_LOOP);
+    return true;
+}
+
+void Kastle2::EndAudioBlock(q15_t *input, q15_t *output, size_t size)
+{
+    Profiler::Start(Profiler::Section::AFTER_AUDIO_LOOP);
+    base.AfterAudioLoop(input, output, size);
+    Profiler::End(Profiler::Section::AFTER_AUDIO_LOOP);
+}
+
+#if KASTLE2_RATE_DIVIDER > 1
+void Kastle2::DownsampleBlock(const q15_t *input, q15_t *output, const size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        const q15_t *frames = input + 4 * i;
+        output[2 * i] = decimators_[0].Downsample(frames[0], frames[2]);
+        output[2 * i + 1] = decimators_[1].Downsample(frames[1], frames[3]);
+    }
+}
+
+void Kastle2::UpsampleBlock(const q15_t *input, q15_t *output, const size_t size)
+{
+    for (size_t i = 0; i < size; i++)
     {
-        if (Kastle2::hw.GetVersion() == Hardware::Version::CITADEL)
+        q15_t *frames = output + 4 * i;
+        interpolators_[0].Upsample(input[2 * i], frames[0], frames[2]);
+        interpolators_[1].Upsample(input[2 * i + 1], frames[1], frames[3]);
+    }
+}
+#endif
+
+void Kastle2::DeliverAudioMidi(size_t size)
+{
+    TimedMidiMessage timed;
+    while (audio_midi_queue_.Peek(timed))
+    {
+        const int32_t frame = static_cast<int32_t>(timed.frame - audio_block_frame_);
+        if (frame >= static_cast<int32_t>(size))
+        {
+            // Due in a later block, the queue is in the arrival order
+            return;
+        }
+        audio_midi_queue_.Pop(timed);
+        if (app_audio_midi_callback_ != nullptr)
         {
-            for (size_t i = 0; i < size * 2; i++)
-            {
-                output[i] = q15_add(output[i], kCitadelOutputDcOffset);
-            }
+            app_audio_midi_callback_(&timed.msg, frame > 0 ? frame : 0);
         }
     }
+}
 
-#if MEASURE_AUDIO_LOOP
-    Kastle2::hw.SetDebugPin(0, 0);
-#endif
+void Kastle2::ReadAudioBlockClock(uint32_t &frame, uint32_t &time_us)
+{
+    uint32_t sequence;
+    do
+    {
+        sequence = audio_block_sequence_;
+        __dmb();
+        frame = audio_block_frame_;
+        time_us = audio_block_time_us_;
+        __dmb();
+    } while ((sequence & 1) || sequence != audio_block_sequence_);
 }
 
-bool Kastle2::RegisterApp(App *app_to_register)
+uint32_t Kastle2::TimeToAudioFrame(const uint32_t time_us)
 {
+    uint32_t frame, block_time_us;
+    ReadAudioBlockClock(frame, block_time_us);
+
+    const int64_t offset_us = static_cast<int32_t>(time_us - block_time_us);
+    return frame + static_cast<uint32_t>(offset_us * SAMPLE_RATE / 1000000);
+}
+
+uint32_t Kastle2::AudioFrameToOutputTime(const uint32_t frame)
+{
+    uint32_t block_frame, block_time_us;
+    ReadAudioBlockClock(block_frame, block_time_us);
+
+    const int64_t offset_frames = static_cast<int32_t>(frame + AUDIO_BUFFER_SIZE - block_frame);
+    return block_time_us + static_cast<uint32_t>(offset_frames * 1000000 / SAMPLE_RATE);
+}
+
+void Kastle2::SetAppAudioMidiCallback(AudioMidiCallback callback)
+{
+    app_audio_midi_callback_ = callback;
+}
+
+bool Kastle2::RegisterApp(App *app_to_register, const FastcodeOverlay &fastcode_overlay)
+{
+    // The app's own fast code in a multi-app image, before any of it runs
+#ifdef FASTCODE_ENABLED
+    copy_fastcode_overlay_to_ram(fastcode_overlay);
+#else
+    (void)fastcode_overlay;
+#endif
+
     app = app_to_register;
     uint8_t app_id = app->GetId();
+    PostMortem::SetAppId(app_id);
     uint8_t stored_id;
     if (!memory.Read8(Memory::ADDR_APP_ID, &stored_id))
     {
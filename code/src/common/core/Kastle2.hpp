@@ -24,21 +24,45 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 #include "pico/binary_info.h"
 #include "pico/stdlib.h"
 #include "hardware/clocks.h"
+#include "hardware/irq.h"
 #include "common/config.hpp"
 #include "common/core/App.hpp"
+#include "common/core/Arena.hpp"
+#include "common/core/AudioClockSync.hpp"
 #include "common/core/Base.hpp"
+#include "common/core/ClockGovernor.hpp"
+#include "common/core/ClockPlan.hpp"
 #include "common/core/Codec.hpp"
 #include "common/core/Hardware.hpp"
+#include "common/core/LevelMeter.hpp"
 #include "common/core/Memory.hpp"
 #include "common/core/MultiCore.hpp"
+#include "common/core/MultiCoreQueue.hpp"
+#include "common/core/PresetStore.hpp"
+#include "common/core/UiScheduler.hpp"
+#include "common/core/UsbAudio.hpp"
+#include "common/core/SyncLink.hpp"
+#include "common/core/SysExTransfer.hpp"
+#include "common/core/UserDataUploader.hpp"
 #include "common/core/midi/Handler.hpp"
 #include "common/debug.hpp"
+#include "common/debug/AudioProbes.hpp"
+#include "common/debug/InputRecorder.hpp"
+#include "common/debug/MemoryMonitor.hpp"
+#include "common/debug/PostMortem.hpp"
+#include "common/debug/Profiler.hpp"
+#include "common/debug/Telemetry.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/debug/UsbSerial.hpp"
+#include "common/dsp/utility/Oversampler.hpp"
+#include "common/fastcode.hpp"
+#include "common/peripherals/I2cBus.hpp"
 #include "common/testmode/TestMode.hpp"
 #include "I2S.hpp"
 
@@ -70,6 +94,11 @@ public:
      */
     static inline Memory memory;
 
+    /**
+     * @brief I2C bus of the codec and the EEPROM, queues their writes as DMA transfers.
+     */
+    static inline I2cBus i2c_bus;
+
     /**
      * @brief MIDI communication and parsing.
      */
@@ -86,11 +115,77 @@ public:
      */
     static inline UsbSerial debug;
 
+    /**
+     * @brief Named probes of the app's signal chain, captured over USB serial or RTT.
+     * @note Only with AUDIO_PROBES in debug.hpp, otherwise the taps compile to nothing.
+     */
+    static inline Probes probes;
+
+    /**
+     * @brief Records the inputs (pots, CVs, buttons, triggers, MIDI) and replays them instead of the real ones.
+     * @note Idle until `Kastle2::recorder.StartRecording(frames, midi_events)` with buffers from the app.
+     */
+    static inline InputRecorder recorder;
+
+    /**
+     * @brief USB audio interface, streams the output to the host and adds the host playback to the input.
+     * @note Only with the USB_AUDIO option of the app or the KASTLE2_USB_AUDIO build option, otherwise it does nothing.
+     */
+    static inline UsbAudio usb_audio;
+
+    /**
+     * @brief Locks the I2S clock to the USB frames of the host, for the USB audio.
+     * @note Only with the USB_AUDIO option of the app or the KASTLE2_USB_AUDIO build option, otherwise it does nothing.
+     */
+    static inline AudioClockSync clock_sync;
+
+    /**
+     * @brief Measures the output bands on the second core for the meter animations of the LEDs.
+     * @note Disabled by default, an app calls `Kastle2::meter.SetEnabled(true)` in its Init(). Needs a second core loop.
+     */
+    static inline LevelMeter meter;
+
+    /**
+     * @brief Updates the changed sectors of the user data over the USB serial (scripts/user_data_upload.py).
+     * @note Disabled by default, enable it with `Kastle2::uploader.SetEnabled(true)` before starting the second core.
+     */
+    static inline UserDataUploader uploader;
+
+    /**
+     * @brief Writes the user data and the presets received as MIDI SysEx (scripts/sysex_upload.py).
+     * @note Disabled by default, enable it with `Kastle2::sysex_transfer.SetEnabled(true)` before starting the second core.
+     */
+    static inline SysExTransfer sysex_transfer;
+
+    /**
+     * @brief Phase locks several units over MIDI, the master's clock, tempo and macros for the followers.
+     * @note Off by default, an app calls `Kastle2::sync_link.SetRole(...)`.
+     */
+    static inline SyncLink sync_link;
+
+    /**
+     * @brief Presets of the apps in the flash (eg. FancyPotBank snapshots).
+     * @note Unused by default, an app calls `Kastle2::presets.Init(GetId())` in its Init(), before starting the second core.
+     */
+    static inline PresetStore presets;
+
+    /**
+     * @brief Lowers the system clock while the audio load is low.
+     * @note Disabled by default, an app calls `Kastle2::governor.SetEnabled(true)` in its Init().
+     */
+    static inline ClockGovernor governor;
+
     /**
      * @brief Pointer to the current app.
      */
     static inline App *app = nullptr;
 
+    /**
+     * @brief Static memory for the app buffers, reserved by the app with KASTLE2_ARENA in its main.cpp.
+     * @note Only apps that reserve it can use it (link error otherwise).
+     */
+    static Arena arena;
+
     /**
      * @brief Initializes the Kastle 2 (HW, memory, base, etc.) together with test mode startup message (=version chain).
      * @details The version chain is passed here, because in test mode the RegisterApp isn't reached (TestMode hijacks the main thread).
@@ -113,6 +208,8 @@ public:
 
     /**
      * @brief Reads the digital inputs (incl. buttons) and updates the LEDs. Call this from the `main.cpp`.
+     * @details Runs the USB, MIDI, codec, EEPROM and debug tasks (UiScheduler) and sleeps when none is due,
+     *          until the ADC finished a new pass over the analog inputs. The UI loop then runs once per pass (~0.3 ms).
      */
     static void ReadInputs();
 
@@ -120,10 +217,24 @@ public:
      * @brief Starts audio callback.
      * @param callback Matches I2S::AudioCallback type.
      * @note Make sure to call this after all initialization has been done.
+     *       With an overclocked ClockPlan it checks the audio timing first (~50 ms).
      * @see I2S::AudioCallback
      */
     static void StartAudio(I2S::AudioCallback callback);
 
+    /**
+     * @brief Starts audio callback bound to the app at compile time.
+     * @details The audio interrupt calls the app's AudioLoop() directly from its own FASTCODE instance
+     *          of AudioCallback(), without the function pointer and the virtual call.
+     * @tparam kApp The app object (a global in `main.cpp`), eg. `Kastle2::StartAudio<app>()`.
+     * @note Same as StartAudio(I2S::AudioCallback) otherwise. Apps picked at run time (MultiApp) use that one.
+     */
+    template <auto &kApp>
+    static void StartAudio()
+    {
+        StartI2S(AudioCallback<AppAudioLoop<kApp>>);
+    }
+
     /**
      * @brief Starts the second core with a function. Call before StartAudio.
      * @note Call before StartAudio.
@@ -131,12 +242,105 @@ public:
      */
     static void StartSecondCore(MultiCore::Worker second_core_worker);
 
+    /**
+     * @brief Starts the second core with the app's SecondCoreWorker().
+     * @tparam kApp The app object, eg. `Kastle2::StartSecondCore<app>()`.
+     */
+    template <auto &kApp>
+    static void StartSecondCore()
+    {
+        StartSecondCore([]()
+                        { kApp.SecondCoreWorker(); });
+    }
+
+    /**
+     * @brief Core running the UI, see RunUi().
+     */
+    enum class UiCore
+    {
+        CORE_0, ///< Together with the audio interrupts
+        CORE_1, ///< On the second core, for apps which don't call StartSecondCore
+    };
+
+    /**
+     * @brief App UI loop, called after each ReadInputs().
+     */
+    using UiLoop = void (*)();
+
+    /**
+     * @brief Runs ReadInputs() and the app UI loop forever. Call it at the end of `main.cpp` instead of the while loop.
+     * @details With UiCore::CORE_1 the USB, MIDI, I2C (codec, EEPROM) and LED work moves off the audio core,
+     *          a slow UI loop then can't delay the audio interrupt. Core 0 only serves the interrupts.
+     * @note The UiLoop and AudioLoop of the app run in parallel then, keep the values shared between them word sized
+     *       (the same as with the audio interrupt preempting the UI). Falls back to core 0 when the second core is taken
+     *       and on the host build (the renderer drives the time from the UI).
+     * @param ui_loop App UI loop
+     * @param core Core to run the UI on
+     */
+    [[noreturn]] static void RunUi(UiLoop ui_loop, UiCore core = UiCore::CORE_0);
+
     /**
      * @brief Starts the midi interface with an app-localized callback function
      * @param callback Callback function which gets passed the data received
      */
     static void SetAppMidiCallback(midi::Handler::Callback callback);
 
+    /**
+     * @brief Sets the app's MidiCallback() as the MIDI callback.
+     * @tparam kApp The app object, eg. `Kastle2::SetAppMidiCallback<app>()`.
+     */
+    template <auto &kApp>
+    static void SetAppMidiCallback()
+    {
+        SetAppMidiCallback([](midi::Message *msg)
+                           { kApp.MidiCallback(msg); });
+    }
+
+    /**
+     * @brief Timed MIDI callback, called from the audio callback before the app's AudioLoop
+     * @param msg Received midi event
+     * @param frame Frame of the current audio block the event belongs to (0 to block size - 1)
+     */
+    using AudioMidiCallback = void (*)(midi::Message *msg, size_t frame);
+
+    /**
+     * @brief Delay of the timed MIDI events after their arrival, the time the UI needs to pass them to the audio.
+     * @details Constant instead of up to the UI loop period plus one audio block. Later events are delivered at frame 0.
+     */
+    static constexpr uint32_t kMidiLatencyFrames = 2 * AUDIO_BUFFER_SIZE;
+
+    /**
+     * @brief Sets the app callback getting the MIDI messages in the audio callback, at the frame they arrived
+     *        (plus kMidiLatencyFrames). The regular app MIDI callback keeps getting them in the UI loop.
+     * @param callback Callback function, nullptr to disable
+     */
+    static void SetAppAudioMidiCallback(AudioMidiCallback callback);
+
+    /**
+     * @brief Index of the first frame of the current audio block, counted since the audio start (wraps)
+     * @return Frame index
+     */
+    static inline uint32_t GetAudioFrame()
+    {
+        return audio_block_frame_;
+    }
+
+    /**
+     * @brief Converts a time_us_32() time to the audio frame index rendered then, see GetAudioFrame()
+     * @details Frames are rendered one block ahead of the output, a fixed offset, so the timing between events is kept.
+     * @param time_us Time in microseconds (eg. midi::Message::GetTime())
+     * @return Frame index
+     */
+    static uint32_t TimeToAudioFrame(const uint32_t time_us);
+
+    /**
+     * @brief Converts an audio frame index to the time_us_32() time it leaves the codec, one block after it's rendered
+     * @details For the digital outputs scheduled with the audio (Hardware::ScheduleDigitalOut()).
+     * @param frame Frame index, see GetAudioFrame()
+     * @return Time in microseconds
+     */
+    static uint32_t AudioFrameToOutputTime(const uint32_t frame);
+
     /**
      * @brief MIDI callback for base
      * @param msg Received midi event
@@ -151,10 +355,13 @@ public:
 
     /**
      * @brief Stores the custom App ID in the EEPROM. If there is a different app stored, call initialization.
+     * @details In a multi-app image it also copies the app's fast code overlay to RAM (see fastcode.hpp),
+     *          so register the app before its Init() and before anything runs its FASTCODE_APP functions.
      * @param app_to_register Main program class which inherits from App.
+     * @param fastcode_overlay FASTCODE_OVERLAY() of the app in a multi-app image, empty otherwise.
      * @return True if different to the stored version and new version stored successfully.
      */
-    static bool RegisterApp(App *app_to_register);
+    static bool RegisterApp(App *app_to_register, const FastcodeOverlay &fastcode_overlay = {});
 
     /**
      * @brief In case your UiLoop is too slow, you can call this function to keep the USB working.
@@ -164,6 +371,44 @@ public:
         tud_task();
     }
 
+    /**
+     * @brief Number of audio underruns (audio callback missing its deadline) since the start.
+     */
+    static inline uint32_t GetUnderrunCount()
+    {
+        return hw.GetI2S().GetUnderrunCount();
+    }
+
+    /**
+     * @brief Gets an event from the audio underrun log.
+     * @param age 0 for the newest event, 1 for the one before...
+     * @param event Event to fill.
+     * @return True if there is such event in the log.
+     */
+    static inline bool GetUnderrunEvent(const size_t age, I2S::UnderrunEvent &event)
+    {
+        return hw.GetI2S().GetUnderrunEvent(age, event);
+    }
+
+    /**
+     * @brief Clears the audio underrun count and log.
+     */
+    static inline void ClearUnderruns()
+    {
+        hw.GetI2S().ClearUnderruns();
+    }
+
+    /**
+     * @brief Sets a tag stored with each audio underrun event.
+     * @details Apps can set this to their mode (or anything else) to see what blew the deadline.
+     * @param tag Any app-specific value.
+     */
+    static inline void SetUnderrunTag(const uint32_t tag)
+    {
+        hw.GetI2S().SetUnderrunTag(tag);
+        PostMortem::SetTag(tag);
+    }
+
     /**
      * @brief Apps with this ID won't clear or affect the stored value in EEPROM.
      */
@@ -171,9 +416,55 @@ public:
 
 private:
     /**
-     * @brief When should the LEDs and buttons be updated again. Prevents overloading LEDs and buttons bounce.
+     * @brief Background work of the UI core, run by ReadInputs().
+     */
+    static inline UiScheduler ui_scheduler_;
+
+    /**
+     * @brief Period of the USB, MIDI, codec, EEPROM and debug tasks, the interrupts release some of them earlier.
+     */
+    static constexpr uint32_t kUiTaskPeriodUs = 1000;
+
+    /**
+     * @brief ReadInputs() returns after this even without a new ADC pass.
+     */
+    static constexpr uint32_t kUiFrameTimeoutUs = 2000;
+
+    /**
+     * @brief ADC pass (Hardware::GetAdcCycles()) the last ReadInputs() returned with.
+     */
+    static inline uint32_t frame_adc_cycles_ = 0;
+
+    /**
+     * @brief Registers the UI core tasks.
+     */
+    static void InitUiTasks();
+
+    /**
+     * @brief Interrupt priorities (lower is more urgent). The audio preempts everything but the input and output edges,
+     *        the ADC, MIDI UART (32 byte FIFO, 10 ms) and USB interrupts can wait for an audio block.
+     */
+    static constexpr uint8_t kOutputEdgeIrqPriority = PICO_HIGHEST_IRQ_PRIORITY; ///< A few us, the edges can't wait for a block
+    static constexpr uint8_t kInputEdgeIrqPriority = PICO_HIGHEST_IRQ_PRIORITY;  ///< Just a timestamp
+    static constexpr uint8_t kAudioIrqPriority = PICO_HIGHEST_IRQ_PRIORITY + 0x40;
+    static constexpr uint8_t kAdcIrqPriority = PICO_DEFAULT_IRQ_PRIORITY;
+    static constexpr uint8_t kUartIrqPriority = PICO_DEFAULT_IRQ_PRIORITY;
+    static constexpr uint8_t kUsbIrqPriority = PICO_LOWEST_IRQ_PRIORITY;
+
+    /**
+     * @brief How long is the underrun shown on the LEDs.
+     */
+    static constexpr uint32_t kUnderrunLedMs = 500;
+
+    /**
+     * @brief Underrun count when the LEDs were last checked.
+     */
+    static inline uint32_t shown_underrun_count_ = 0;
+
+    /**
+     * @brief When to stop showing the underrun on the LEDs.
      */
-    static inline absolute_time_t timeout_read_buttons_;
+    static inline absolute_time_t timeout_underrun_led_;
 
     /**
      * @brief Test mode object
@@ -186,16 +477,202 @@ private:
     static inline bool test_mode_enabled_ = false;
 
     /**
-     * @brief Audio callback for apps.
+     * @brief Starts the I2S with the audio callback, see StartAudio().
+     * @param callback One of the AudioCallback() instances.
+     */
+    static void StartI2S(I2S::AudioCallback callback);
+
+    /**
+     * @brief Audio callback for apps, the I2S calls it for each block.
+     * @tparam kAppLoop The app's audio loop, called directly. With nullptr it calls audio_callback_.
      * @param input Input buffer.
      * @param output Output buffer.
      * @param size Buffer size.
      */
-    static void AudioCallback(q15_t *input, q15_t *output, size_t size);
+    template <I2S::AudioCallback kAppLoop = nullptr>
+    FASTCODE static void AudioCallback(q15_t *input, q15_t *output, size_t size)
+    {
+        BeginAudioCallback(input, size);
+
+        // The app runs at SAMPLE_RATE, the I2S at I2S_SAMPLE_RATE
+#if KASTLE2_RATE_DIVIDER > 1
+        const size_t block_size = size / RATE_DIVIDER;
+        q15_t *block_input = rate_input_.data();
+        q15_t *block_output = rate_output_.data();
+        DownsampleBlock(input, block_input, block_size);
+#else
+        const size_t block_size = size;
+        q15_t *block_input = input;
+        q15_t *block_output = output;
+#endif
+
+        if (BeginAudioBlock(block_input, block_output, block_size))
+        {
+            Profiler::Start(Profiler::Section::AUDIO_LOOP);
+            Trace::Begin(TraceSpan::AUDIO_LOOP);
+            if constexpr (kAppLoop == nullptr)
+            {
+                audio_callback_(block_input, block_output, block_size);
+            }
+            else
+            {
+                kAppLoop(block_input, block_output, block_size);
+            }
+            Trace::End(TraceSpan::AUDIO_LOOP);
+            Profiler::End(Profiler::Section::AUDIO_LOOP);
+
+            EndAudioBlock(block_input, block_output, block_size);
+        }
+
+#if KASTLE2_RATE_DIVIDER > 1
+        UpsampleBlock(block_output, output, block_size);
+#endif
+        EndAudioCallback(output, size);
+    }
+
+    /**
+     * @brief Calls the AudioLoop() of the app, inlined into its AudioCallback() instance.
+     */
+    template <auto &kApp>
+    static inline void AppAudioLoop(q15_t *input, q15_t *output, size_t size)
+    {
+        kApp.AudioLoop(input, output, size);
+    }
 
     /**
      * @brief Audio callback function.
      */
     static inline I2S::AudioCallback audio_callback_;
+
+    /**
+     * @brief Start of the audio callback: profiling, the analog streams, the USB audio input.
+     * @param input Input buffer at I2S_SAMPLE_RATE.
+     * @param size Buffer size in frames at I2S_SAMPLE_RATE.
+     */
+    static void BeginAudioCallback(q15_t *input, size_t size);
+
+    /**
+     * @brief End of the audio callback: the USB audio output, profiling.
+     * @param output Output buffer at I2S_SAMPLE_RATE.
+     * @param size Buffer size in frames at I2S_SAMPLE_RATE.
+     */
+    static void EndAudioCallback(q15_t *output, size_t size);
+
+    /**
+     * @brief Starts one block at SAMPLE_RATE: the frame clock, the timed MIDI and the Base before the app.
+     * @details In the test mode it runs the test mode on the block instead.
+     * @param input Input buffer.
+     * @param output Output buffer.
+     * @param size Buffer size in frames at SAMPLE_RATE.
+     * @return True when the app's audio loop runs on the block (then call EndAudioBlock()).
+     */
+    static bool BeginAudioBlock(q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Ends the block of the app, the Base after the app.
+     * @param input Input buffer.
+     * @param output Output buffer.
+     * @param size Buffer size in frames at SAMPLE_RATE.
+     */
+    static void EndAudioBlock(q15_t *input, q15_t *output, size_t size);
+
+#if KASTLE2_RATE_DIVIDER > 1
+    /**
+     * @brief Decimates the I2S input block to SAMPLE_RATE.
+     * @param input Interleaved stereo at I2S_SAMPLE_RATE, 2 * size frames.
+     * @param output Interleaved stereo at SAMPLE_RATE.
+     * @param size Output frames.
+     */
+    static void DownsampleBlock(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Interpolates the processed block to the I2S output.
+     * @param input Interleaved stereo at SAMPLE_RATE.
+     * @param output Interleaved stereo at I2S_SAMPLE_RATE, 2 * size frames.
+     * @param size Input frames.
+     */
+    static void UpsampleBlock(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Half-band filters of the lo-fi economy mode (left and right) and the blocks at SAMPLE_RATE.
+     */
+    static inline std::array<HalfBand<4>, 2> decimators_{HalfBand<4>{HalfBandDesigns::kLow}, HalfBand<4>{HalfBandDesigns::kLow}};
+    static inline std::array<HalfBand<4>, 2> interpolators_{HalfBand<4>{HalfBandDesigns::kLow}, HalfBand<4>{HalfBandDesigns::kLow}};
+    static inline std::array<q15_t, 2 * AUDIO_BUFFER_SIZE> rate_input_{};
+    static inline std::array<q15_t, 2 * AUDIO_BUFFER_SIZE> rate_output_{};
+#endif
+
+    /**
+     * @brief Current audio block, written by the audio callback. The sequence is odd while the frame and time change.
+     */
+    static inline volatile uint32_t audio_block_sequence_ = 0;
+    static inline volatile uint32_t audio_block_frame_ = 0;
+    static inline volatile uint32_t audio_block_time_us_ = 0;
+
+    /**
+     * @brief Reads the frame and time of the current audio block consistently from any core.
+     */
+    static void ReadAudioBlockClock(uint32_t &frame, uint32_t &time_us);
+
+    /**
+     * @brief Self-test of the clock plan, compares the system clock and the audio frames with the crystal.
+     * @return True if both are within 1/kTimingTolerance.
+     */
+    static bool CheckAudioTiming();
+
+    /**
+     * @brief MIDI messages from the UI to the audio callback, with the frame they are due.
+     */
+    struct TimedMidiMessage
+    {
+        midi::Message msg;
+        uint32_t frame;
+    };
+    static inline MultiCoreQueue<TimedMidiMessage, 32> audio_midi_queue_;
+    static inline AudioMidiCallback app_audio_midi_callback_ = nullptr;
+
+    /**
+     * @brief Calls the app's AudioMidiCallback for the queued messages due in the current block.
+     * @param size Block size in frames.
+     */
+    static void DeliverAudioMidi(size_t size);
+
+    /**
+     * @brief Second core function of the app.
+     */
+    static inline MultiCore::Worker second_core_worker_ = nullptr;
+
+    /**
+     * @brief Entry point of the second core, sets up the core and runs the app worker.
+     */
+    static void SecondCoreEntry();
+
+    /**
+     * @brief App UI loop run by RunUi().
+     */
+    static inline UiLoop ui_loop_ = nullptr;
+
+    /**
+     * @brief Entry point of the second core when it runs the UI.
+     */
+    static void UiCoreEntry();
+
+    /**
+     * @brief Runs ReadInputs() and the app UI loop forever.
+     */
+    [[noreturn]] static void UiTask();
 };
 }
+
+/**
+ * @brief Reserves the app arena (Kastle2::arena) of the given size in bytes.
+ * Use once, in the app's main.cpp, outside of any function.
+ * The size is checked against APP_ARENA_BUDGET of the app's memory manifest (KASTLE2_ARENA_BUDGET), so a variant
+ * with longer delay lines fails the build instead of the boot.
+ */
+#define KASTLE2_ARENA(size)                                                                                  \
+    static_assert((size) <= kastle2::RAM_SIZE, "The app arena is larger than the RAM");                    \
+    static_assert(KASTLE2_ARENA_BUDGET == 0 || (size) <= KASTLE2_ARENA_BUDGET,                             \
+                  "The app arena is over APP_ARENA_BUDGET of the app's memory manifest (CMakeLists.txt)"); \
+    alignas(kastle2::Arena::kAlignment) static uint8_t kastle2_arena_storage[size];                        \
+    kastle2::Arena kastle2::Kastle2::arena(kastle2_arena_storage, sizeof(kastle2_arena_storage))
@@ -40,6 +40,24 @@ static constexpr uint8_t LFO_MOD = 23;    // lfo mod (bottom left knob)
 static constexpr uint8_t TEMPO = 24;      // tempo (shift+ bottom right knob)
 static constexpr uint8_t RHYTHM = 25;     // rhythm (shift + bottom left knob)
 
+// 14-bit CCs, the controllers 0-31 (MSB) have their LSB at CC + 32
+static constexpr uint8_t HIGH_RES_COUNT = 32; // controllers with LSB
+static constexpr uint8_t LSB_OFFSET = 32;     // LSB controller = MSB controller + LSB_OFFSET
+
+// NRPN, the parameter number is selected by the NRPN CCs, the value comes by the data entry
+static constexpr uint8_t DATA_ENTRY_MSB = 6;  // data entry (MSB of the value)
+static constexpr uint8_t DATA_ENTRY_LSB = 38; // data entry (LSB of the value)
+static constexpr uint8_t NRPN_LSB = 98;       // NRPN parameter number LSB
+static constexpr uint8_t NRPN_MSB = 99;       // NRPN parameter number MSB
+static constexpr uint8_t RPN_LSB = 100;       // RPN parameter number LSB (RPNs are not supported, deselects the NRPN)
+static constexpr uint8_t RPN_MSB = 101;       // RPN parameter number MSB (RPNs are not supported, deselects the NRPN)
+
+// Presets, the apps with presets recall them by program change
+static constexpr uint8_t PRESET_SAVE = 119; // saves the current sound to the preset of the value
+
+// Multi-app image, switches to the app of the value (stores it and restarts), see apps/MultiApp
+static constexpr uint8_t APP_SELECT = 118;
+
 static constexpr uint8_t RESET_CONTROLLERS = 121; // reset all controllers
 static constexpr uint8_t ALL_NOTES_OFF = 123;     // all notes off
 
@@ -166,6 +166,16 @@ static constexpr size_t kBaseTicksClearMemory = s2alr(10); // 10 seconds
 // Pots running average
 static constexpr size_t kBasePotsRunningAverage = 8;
 
+// At startup, wait until the ADC went through all the inputs this many times (one partial pass + filled running averages)
+// Takes a few ms, the timeout is the fixed delay used before
+static constexpr uint32_t kStartupAdcCycles = kBasePotsRunningAverage + 1;
+static constexpr uint32_t kStartupAdcTimeoutMs = 100;
+
+// Self-test of an overclocked plan (ClockPlan): the clock and 50 ms of audio frames within 1/kTimingTolerance of the crystal
+static constexpr uint32_t kTimingCheckFrames = s2sr(0.05f);
+static constexpr uint32_t kTimingCheckTimeoutMs = 200;
+static constexpr uint32_t kTimingTolerance = 100;
+
 // When switching to SHIFT layer, ignore pot readings for a while
 static constexpr size_t kShiftShortPressTicks = s2alr(0.2f);
 
@@ -173,12 +183,13 @@ static constexpr size_t kShiftShortPressTicks = s2alr(0.2f);
 static constexpr auto kMapDeadzone = MapDef<int32_t, 4>{{pot(0.0f), pot(0.45f), pot(0.55f), pot(1.0f)},
                                                         {pot(0.0f), pot(0.50f), pot(0.50f), pot(1.0f)}};
 
-// --- DC OFFSETS (Citadel only) ---
+// --- DC OFFSETS ---
 
-static constexpr bool kCitadelInputDcOffsetRemove = true;
-static constexpr bool kCitadelOutputDcOffsetRemove = true;
+// Input DC tracked and removed by the I2S driver (both versions), follows the unit and the temperature
+static constexpr bool kInputDcBlocker = true;
 
-static constexpr q15_t kCitadelInputDcOffset = q15(0.01f);
+// Output DC offset (Citadel only), after the DAC so it can't be measured
+static constexpr bool kCitadelOutputDcOffsetRemove = true;
 static constexpr q15_t kCitadelOutputDcOffset = q15(-0.008f);
 
 }
@@ -0,0 +1,148 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "LedAnimator.hpp"
+
+#include "common/peripherals/WS2812.hpp"
+
+using namespace kastle2;
+
+uint32_t LedAnimator::Animation::GetLength() const
+{
+    switch (type)
+    {
+    case Type::KEYFRAMES:
+    {
+        uint32_t length = 0;
+        for (size_t i = 0; i < keyframe_count; i++)
+        {
+            length += keyframes[i].time_ms;
+        }
+        return length;
+    }
+    case Type::PULSE:
+        return on_ms;
+    case Type::FLASH_NUMBER:
+        return number > 0 ? lead_ms + number * on_ms + (number - 1) * off_ms + tail_ms : 0;
+    case Type::METER:
+        return on_ms;
+    }
+    return 0;
+}
+
+uint32_t LedAnimator::Animation::GetColor(uint32_t time_ms) const
+{
+    switch (type)
+    {
+    case Type::KEYFRAMES:
+    {
+        uint32_t previous = keyframes[keyframe_count - 1].color;
+        for (size_t i = 0; i < keyframe_count; i++)
+        {
+            const Keyframe &keyframe = keyframes[i];
+            if (time_ms < keyframe.time_ms)
+            {
+                if (!keyframe.fade)
+                {
+                    return keyframe.color;
+                }
+                return WS2812::CrossfadeColors(previous, keyframe.color, static_cast<uint8_t>(time_ms * 255 / keyframe.time_ms));
+            }
+            time_ms -= keyframe.time_ms;
+            previous = keyframe.color;
+        }
+        return previous;
+    }
+    case Type::PULSE:
+    {
+        // Up in the first half of the period, down in the second
+        const uint32_t phase = time_ms * 510 / on_ms;
+        const uint32_t level = phase < 255 ? phase : 510 - phase;
+        return WS2812::CrossfadeColors(color2, color, static_cast<uint8_t>(level));
+    }
+    case Type::FLASH_NUMBER:
+    {
+        if (time_ms < lead_ms)
+        {
+            return color2;
+        }
+        time_ms -= lead_ms;
+        const uint32_t flash_period = on_ms + off_ms;
+        if (time_ms / flash_period < number && time_ms % flash_period < on_ms)
+        {
+            return color;
+        }
+        return color2;
+    }
+    case Type::METER:
+        // The level is in the animator, see GetMeterColor()
+        return color2;
+    }
+    return 0;
+}
+
+uint32_t LedAnimator::GetMeterColor(const Animation &animation)
+{
+    // Only the latest levels matter
+    MeterLevels levels;
+    while (meter_queue_.Pop(levels))
+    {
+        meter_ = levels;
+    }
+    const uint8_t level = animation.number < kMeterBands ? meter_[animation.number] : 0;
+    return WS2812::CrossfadeColors(animation.color2, animation.color, level);
+}
+
+LedAnimator::Result LedAnimator::Render(const size_t led, const uint32_t now_us, uint32_t &color)
+{
+    const uint32_t bit = 1u << led;
+    if (stopped_ & bit)
+    {
+        stopped_ = stopped_ & ~bit;
+        return Result::FINISHED;
+    }
+    if (!(playing_ & bit))
+    {
+        return Result::UNCHANGED;
+    }
+
+    Slot &slot = slots_[led];
+    const Animation &animation = slot.animation;
+    const uint32_t elapsed_ms = (now_us - slot.start_us) / 1000;
+    const uint32_t length = animation.GetLength();
+    if (animation.repeats > 0 && elapsed_ms >= length * animation.repeats)
+    {
+        playing_ = playing_ & ~bit;
+        return Result::FINISHED;
+    }
+
+    const uint32_t next = animation.type == Animation::Type::METER ? GetMeterColor(animation) : animation.GetColor(elapsed_ms % length);
+    if (next == slot.color)
+    {
+        return Result::UNCHANGED;
+    }
+    slot.color = next;
+    color = next;
+    return Result::CHANGED;
+}
@@ -0,0 +1,261 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include "common/core/MultiCoreQueue.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class LedAnimator
+ * @ingroup core
+ * @brief Declarative LED animations (keyframes, pulse, flashed number) rendered by the LED frame interrupt.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The UI posts an animation once with Play() instead of computing the color of the LED in every UI loop.
+ * Hardware renders the playing animations right before each LED frame (in the ADC interrupt, about 1 ms apart)
+ * and writes them to the WS2812 frame, over the color the UI set with SetLed(). When an animation ends,
+ * the LED shows the SetLed() color again.
+ *
+ * The animation timing is in milliseconds from Play(), so it doesn't depend on the UI loop or the audio block size.
+ *
+ * A meter animation shows the level of a band instead, published from the other core by PublishMeter()
+ * (LevelMeter on the second core) and taken by the LED frame interrupt.
+ */
+class LedAnimator
+{
+public:
+    /**
+     * @brief Number of animated LEDs (Hardware::Led::COUNT).
+     */
+    static constexpr size_t kMaxLeds = 3;
+
+    /**
+     * @brief Number of the meter bands (BandMeter::kBands).
+     */
+    static constexpr size_t kMeterBands = 4;
+
+    /**
+     * @brief Brightness of each meter band, 0 to 255.
+     */
+    using MeterLevels = std::array<uint8_t, kMeterBands>;
+
+    /**
+     * @brief One step of a keyframe animation.
+     */
+    struct Keyframe
+    {
+        uint32_t color;   ///< Color at the end of the step
+        uint16_t time_ms; ///< Length of the step
+        bool fade;        ///< Fade from the color of the previous step, otherwise hold the color
+    };
+
+    /**
+     * @brief Animation of one LED, made by the factory functions. Trivially copyable, so it can be constexpr.
+     */
+    struct Animation
+    {
+        enum class Type : uint8_t
+        {
+            KEYFRAMES,    ///< Steps of the keyframes array
+            PULSE,        ///< Triangle fade between the two colors
+            FLASH_NUMBER, ///< A flash per unit of the number, with blank space before and after
+            METER,        ///< Fade between the two colors by the level of a meter band (number)
+        };
+
+        Type type;
+        uint16_t repeats;          ///< How many times the animation plays, 0 forever
+        uint32_t color;            ///< Flash color, pulse peak
+        uint32_t color2;           ///< Color between the flashes, pulse bottom
+        uint16_t on_ms;            ///< Flash length, pulse period
+        uint16_t off_ms;           ///< Gap between the flashes
+        uint16_t lead_ms;          ///< Blank before the first flash
+        uint16_t tail_ms;          ///< Blank after the last flash
+        uint8_t number;            ///< Number of flashes
+        uint8_t keyframe_count;    ///< Number of keyframes
+        const Keyframe *keyframes; ///< Keyframes, must outlive the animation (a static or constexpr array)
+
+        /**
+         * @brief Keyframe animation, the steps follow each other and the color of the last one loops to the first.
+         */
+        static constexpr Animation Keyframes(const Keyframe *keyframes, const uint8_t count, const uint16_t repeats = 0)
+        {
+            return {Type::KEYFRAMES, repeats, 0, 0, 0, 0, 0, 0, 0, count, keyframes};
+        }
+
+        /**
+         * @brief Fades from low_color to color and back in each period.
+         */
+        static constexpr Animation Pulse(const uint32_t color, const uint32_t low_color, const uint16_t period_ms, const uint16_t repeats = 0)
+        {
+            return {Type::PULSE, repeats, color, low_color, period_ms, 0, 0, 0, 0, 0, nullptr};
+        }
+
+        /**
+         * @brief Flashes the number (eg. a MIDI channel), the LED shows off_color the rest of the time.
+         */
+        static constexpr Animation FlashNumber(const uint32_t color, const uint32_t off_color, const uint8_t number,
+                                               const uint16_t on_ms = 60, const uint16_t off_ms = 250,
+                                               const uint16_t lead_ms = 500, const uint16_t tail_ms = 1000, const uint16_t repeats = 1)
+        {
+            return {Type::FLASH_NUMBER, repeats, color, off_color, on_ms, off_ms, lead_ms, tail_ms, number, 0, nullptr};
+        }
+
+        /**
+         * @brief Shows the color once for the time.
+         */
+        static constexpr Animation Flash(const uint32_t color, const uint16_t time_ms)
+        {
+            return FlashNumber(color, 0, 1, time_ms, 0, 0, 0, 1);
+        }
+
+        /**
+         * @brief Fades from low_color (silence) to color (full scale) by the meter level of the band, until stopped.
+         */
+        static constexpr Animation Meter(const uint32_t color, const uint32_t low_color, const uint8_t band)
+        {
+            return {Type::METER, 0, color, low_color, 1, 0, 0, 0, band, 0, nullptr};
+        }
+
+        /**
+         * @brief Length of one pass of the animation in ms.
+         */
+        uint32_t GetLength() const;
+
+        /**
+         * @brief Color of the animation at the time of the pass (less than GetLength()).
+         */
+        uint32_t GetColor(uint32_t time_ms) const;
+    };
+
+    /**
+     * @brief What Render() did with the LED.
+     */
+    enum class Result
+    {
+        UNCHANGED, ///< Not playing, or the color is the same as in the last frame
+        CHANGED,   ///< New color of the animation
+        FINISHED,  ///< The animation ended, show the color of the UI again
+    };
+
+    /**
+     * @brief Starts the animation of the LED, replaces the one playing. Call from the UI loop.
+     */
+    void Play(const size_t led, const Animation &animation)
+    {
+        if (led >= kMaxLeds || animation.GetLength() == 0)
+        {
+            return;
+        }
+        // Rendered by the interrupt of this core, which must not see half of the slot
+        const uint32_t irq = save_and_disable_interrupts();
+        Slot &slot = slots_[led];
+        slot.animation = animation;
+        slot.start_us = time_us_32();
+        slot.color = ~0u;
+        playing_ = playing_ | (1u << led);
+        stopped_ = stopped_ & ~(1u << led);
+        restore_interrupts(irq);
+    }
+
+    /**
+     * @brief Stops the animation of the LED, the next frame shows the color of the UI.
+     */
+    void Stop(const size_t led)
+    {
+        if (led >= kMaxLeds)
+        {
+            return;
+        }
+        const uint32_t irq = save_and_disable_interrupts();
+        if (playing_ & (1u << led))
+        {
+            playing_ = playing_ & ~(1u << led);
+            stopped_ = stopped_ | (1u << led);
+        }
+        restore_interrupts(irq);
+    }
+
+    /**
+     * @brief Returns true if an animation plays on the LED (the UI color is hidden).
+     */
+    bool IsPlaying(const size_t led) const
+    {
+        return (playing_ & (1u << led)) != 0;
+    }
+
+    /**
+     * @brief Returns true if nothing plays and no LED waits to be restored.
+     */
+    bool IsIdle() const
+    {
+        return (playing_ | stopped_) == 0;
+    }
+
+    /**
+     * @brief Publishes the levels for the meter animations. Called by one core only (the producer of the queue).
+     * @details Dropped when the LED frames haven't taken the previous ones yet.
+     */
+    void PublishMeter(const MeterLevels &levels)
+    {
+        meter_queue_.Push(levels);
+    }
+
+    /**
+     * @brief Renders the animation of the LED for the next frame. Called by the LED frame interrupt.
+     * @param led LED to render
+     * @param now_us time_us_32() of the frame
+     * @param color Set to the color of the animation when CHANGED
+     */
+    Result Render(size_t led, uint32_t now_us, uint32_t &color);
+
+private:
+    struct Slot
+    {
+        Animation animation;
+        uint32_t start_us;
+        uint32_t color; // Last rendered color
+    };
+
+    /**
+     * @brief Color of a meter animation at the latest published levels.
+     */
+    uint32_t GetMeterColor(const Animation &animation);
+
+    std::array<Slot, kMaxLeds> slots_{};
+    MultiCoreQueue<MeterLevels, 4> meter_queue_; // PublishMeter() -> LED frames
+    MeterLevels meter_{};                        // Latest levels taken from the queue
+    volatile uint32_t playing_ = 0; // Bit per LED
+    volatile uint32_t stopped_ = 0; // Stopped by the UI, restored by the next frame
+};
+
+}
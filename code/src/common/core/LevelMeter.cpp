@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "LevelMeter.hpp"
+#include "common/core/Kastle2.hpp"
+#include "common/core/MultiCore.hpp"
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+COLDCODE void LevelMeter::SetEnabled(const bool enabled)
+{
+    if (enabled == enabled_)
+    {
+        return;
+    }
+    if (enabled)
+    {
+        bands_.Init(I2S_SAMPLE_RATE, static_cast<float>(kUpdateRate));
+        frames_ = 0;
+        enabled_ = true;
+        MultiCore::SetIdleTask(&LevelMeter::IdleTask);
+    }
+    else
+    {
+        // The meter animations keep the last levels
+        MultiCore::SetIdleTask(nullptr);
+        enabled_ = false;
+    }
+}
+
+FASTCODE bool LevelMeter::Process()
+{
+    Frame chunk[kChunkFrames];
+    const size_t count = ring_.PopBlock(chunk, kChunkFrames);
+    if (count == 0)
+    {
+        return false;
+    }
+
+    bands_.Process(&chunk[0].left, count);
+    frames_ += count;
+    if (frames_ >= kUpdateFrames)
+    {
+        frames_ -= kUpdateFrames;
+        bands_.Update();
+        LedAnimator::MeterLevels levels;
+        for (size_t i = 0; i < BandMeter::kBands; i++)
+        {
+            levels[i] = BandMeter::ToBrightness(bands_.GetLevel(i));
+        }
+        Kastle2::hw.PublishLedMeter(levels);
+    }
+    return count == kChunkFrames;
+}
+
+FASTCODE bool LevelMeter::IdleTask()
+{
+    return Kastle2::meter.Process();
+}
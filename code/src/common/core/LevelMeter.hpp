@@ -0,0 +1,122 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "common/core/MultiCoreQueue.hpp"
+#include "common/dsp/utility/BandMeter.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class LevelMeter
+ * @ingroup core
+ * @brief Levels of the output bands (BandMeter) for the meter animations of the LEDs, measured on the second core.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The audio callback only copies each output block into a ring (WriteBlock), the filters run on the second core
+ * in its idle time, as the MultiCore idle task of WaitForWork(). kUpdateRate times a second the held levels go
+ * to the LED animator, an app shows them with `hw.PlayLedAnimation(led, LedAnimator::Animation::Meter(...))`.
+ *
+ * When the second core is busy the ring fills up and the newest frames are dropped, the meter lags
+ * but the audio doesn't wait for it.
+ *
+ * @note Disabled by default, `Kastle2::meter.SetEnabled(true)`. Only for the apps with a second core loop
+ *       which calls MultiCore::WaitForWork() (eg. JobWorker), otherwise the levels stay at zero.
+ */
+class LevelMeter
+{
+public:
+    /**
+     * @brief Level updates per second.
+     */
+    static constexpr uint32_t kUpdateRate = 60;
+
+    /**
+     * @brief Frames the second core filters at once.
+     */
+    static constexpr size_t kChunkFrames = 32;
+
+    /**
+     * @brief Starts or stops the metering. Called by core 0.
+     * @param enabled True to meter the output.
+     */
+    void SetEnabled(const bool enabled);
+
+    /**
+     * @brief Whether the output is metered.
+     */
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    /**
+     * @brief Copies the output block for the meter, called by the audio callback.
+     * @param output Interleaved stereo output block
+     * @param size Number of frames
+     */
+    inline void WriteBlock(const q15_t *output, const size_t size)
+    {
+        if (enabled_)
+        {
+            ring_.PushBlock(reinterpret_cast<const Frame *>(output), size);
+        }
+    }
+
+    /**
+     * @brief Filters a chunk of the copied frames and publishes the levels when due. Called by the second core.
+     * @return True if there are more frames waiting.
+     */
+    bool Process();
+
+private:
+    struct Frame
+    {
+        q15_t left;
+        q15_t right;
+    };
+
+    static constexpr uint32_t kUpdateFrames = static_cast<uint32_t>(I2S_SAMPLE_RATE) / kUpdateRate;
+
+    // MultiCore::IdleTask of the second core
+    static bool IdleTask();
+
+    // Two of the largest blocks, the audio callback -> second core
+    static constexpr size_t kRingFrames = 256;
+    static_assert(kRingFrames >= 2 * I2S::kAudioBufferSize);
+
+    MultiCoreQueue<Frame, kRingFrames> ring_;
+    BandMeter bands_;
+    uint32_t frames_ = 0; ///< Frames since the last update
+    volatile bool enabled_ = false;
+};
+
+}
@@ -23,27 +23,33 @@ SOFTWARE.
 */
 
 #include "Memory.hpp"
+#include <bit>
+#include <cstring>
 #include <memory>
+#include "hardware/sync.h"
 #include "common/config.hpp"
 #include "common/core/Hardware.hpp"
 #include "common/core/midi/Message.hpp"
+#include "common/debug/Trace.hpp"
 
 using namespace kastle2;
 
-Memory::State Memory::Init(i2c_inst_t *i2c_inst)
+COLDCODE Memory::State Memory::Init(I2cBus &bus)
 {
     available_ = false;
-    ClearQueue();
+    dirty_pages_ = 0;
+    queued_page_ = -1;
+    queued_page_retries_ = 0;
+    shadow_.fill(0);
 
     // Initialize the EEPROM
-    eeprom_.Init(i2c_inst);
+    eeprom_.Init(bus);
 
-    // Try read from EEPROM
-    uint8_t readString[kTestStringLength];
+    // The whole EEPROM is read into the RAM shadow at once, all the reads are served from it
     bool initialized = true;
 
     // Available?
-    if (!eeprom_.Read(ADDR_INIT_MESSAGE, readString, kTestStringLength))
+    if (!eeprom_.Read(0, shadow_.data(), MEMORY_SIZE))
     {
         return State::MISSING;
     }
@@ -51,7 +57,7 @@ Memory::State Memory::Init(i2c_inst_t *i2c_inst)
     // Test string
     for (size_t i = 0; i < kTestStringLength; i++)
     {
-        if (kTestString[i] != readString[i])
+        if (kTestString[i] != shadow_[ADDR_INIT_MESSAGE + i])
         {
             initialized = false;
             break;
@@ -74,7 +80,7 @@ Memory::State Memory::Init(i2c_inst_t *i2c_inst)
     return State::OK;
 }
 
-bool Memory::FreshInitialize()
+COLDCODE bool Memory::FreshInitialize()
 {
     bool result = true;
 
@@ -95,7 +101,7 @@ bool Memory::FreshInitialize()
     return result;
 }
 
-bool Memory::WriteDefaultSettings()
+COLDCODE bool Memory::WriteDefaultSettings()
 {
     bool result = true;
     result &= Write8(ADDR_INPUT_GAIN, 160u);
@@ -111,7 +117,7 @@ bool Memory::WriteDefaultSettings()
     return result;
 }
 
-bool Memory::ClearAppSpace()
+COLDCODE bool Memory::ClearAppSpace()
 {
     uint8_t buffer[8] = {0, 0, 0, 0, 0, 0, 0, 0};
     int32_t to_write = APP_SPACE_SIZE;
@@ -129,76 +135,59 @@ bool Memory::ClearAppSpace()
 
 bool Memory::Read(uint16_t address, uint8_t *buffer, uint16_t length)
 {
-    if (!available_)
+    if (!available_ || address + length > MEMORY_SIZE)
     {
         return false;
     }
-    return eeprom_.Read(address, buffer, length);
+    memcpy(buffer, &shadow_[address], length);
+    return true;
 }
 
 uint8_t Memory::Get8(uint16_t address)
 {
-    if (!available_)
-    {
-        return 0;
-    }
     uint8_t result = 0;
-    eeprom_.ReadByte(address, &result);
+    Read(address, &result, 1);
     return result;
 }
 
 uint16_t Memory::Get16(uint16_t address)
 {
-    if (!available_)
-    {
-        return 0;
-    }
     uint8_t buffer[2] = {0, 0};
-    eeprom_.Read(address, buffer, 2);
+    Read(address, buffer, 2);
     return (buffer[1] << 8) | buffer[0];
 }
 
 uint32_t Memory::Get32(uint16_t address)
 {
-    if (!available_)
-    {
-        return 0;
-    }
     uint8_t buffer[4] = {0, 0, 0, 0};
-    eeprom_.Read(address, buffer, 3);
+    Read(address, buffer, 4);
     uint32_t read_value = (buffer[3] << 24) | (buffer[2] << 16) | (buffer[1] << 8) | buffer[0];
     return read_value;
 }
 
 bool Memory::Read8(uint16_t address, uint8_t *value)
 {
-    if (!available_)
-    {
-        return false;
-    }
-    return eeprom_.ReadByte(address, value);
+    return Read(address, value, 1);
 }
 
 bool Memory::Read16(uint16_t address, uint16_t *value)
 {
-    if (!available_)
+    uint8_t buffer[2] = {0, 0};
+    if (!Read(address, buffer, 2))
     {
         return false;
     }
-    uint8_t buffer[2] = {0, 0};
-    eeprom_.Read(address, buffer, 2);
     *value = (buffer[1] << 8) | buffer[0];
     return true;
 }
 
 bool Memory::Read32(uint16_t address, uint32_t *value)
 {
-    if (!available_)
+    uint8_t buffer[4] = {0, 0, 0, 0};
+    if (!Read(address, buffer, 4))
     {
         return false;
     }
-    uint8_t buffer[4] = {0, 0};
-    eeprom_.Read(address, buffer, 4);
     uint32_t read_value = (buffer[3] << 24) | (buffer[2] << 16) | (buffer[1] << 8) | buffer[0];
     *value = read_value;
     return true;
@@ -206,24 +195,22 @@ bool Memory::Read32(uint16_t address, uint32_t *value)
 
 bool Memory::Read8Into32(uint16_t address, uint32_t *value)
 {
-    if (!available_)
+    uint8_t buffer[1] = {0};
+    if (!Read(address, buffer, 1))
     {
         return false;
     }
-    uint8_t buffer[1] = {0};
-    eeprom_.ReadByte(address, buffer);
     *value = buffer[0];
     return true;
 }
 
 bool Memory::Read16Into32(uint16_t address, uint32_t *value)
 {
-    if (!available_)
+    uint8_t buffer[2] = {0, 0};
+    if (!Read(address, buffer, 2))
     {
         return false;
     }
-    uint8_t buffer[2] = {0, 0};
-    eeprom_.Read(address, buffer, 2);
     uint16_t read_value = (buffer[1] << 8) | buffer[0];
     *value = read_value;
     return true;
@@ -231,11 +218,17 @@ bool Memory::Read16Into32(uint16_t address, uint32_t *value)
 
 bool Memory::Write(uint16_t address, const uint8_t *data, uint16_t length, bool verify, uint32_t retries)
 {
-    if (!available_)
+    if (!available_ || address + length > MEMORY_SIZE)
     {
         return false;
     }
 
+    // The shadow holds the new data even if the write fails, the pages get written when it's queued again
+    if (data != &shadow_[address])
+    {
+        memcpy(&shadow_[address], data, length);
+    }
+
     bool result;
 
     do
@@ -249,15 +242,9 @@ bool Memory::Write(uint16_t address, const uint8_t *data, uint16_t length, bool
             break;
         }
 
-        if (length > MEMORY_SIZE)
-        {
-            // Maybe OK?
-            return true;
-        }
-
-        // Buffer for verification
+        // Buffer for verification, read back from the chip (not the shadow)
         std::unique_ptr<uint8_t[]> read_buffer = std::make_unique<uint8_t[]>(length);
-        Read(address, read_buffer.get(), length);
+        eeprom_.Read(address, read_buffer.get(), length);
 
         // Check if data matches what was written
         bool data_match = true;
@@ -355,7 +342,7 @@ bool Memory::Update32(uint16_t address, uint32_t value)
     return true;
 }
 
-bool Memory::WriteCalibrations(const Hardware::CalibrationsType &calibrations)
+COLDCODE bool Memory::WriteCalibrations(const Hardware::CalibrationsType &calibrations)
 {
     bool result = true;
     size_t i = 0;
@@ -369,7 +356,7 @@ bool Memory::WriteCalibrations(const Hardware::CalibrationsType &calibrations)
     return result;
 }
 
-bool Memory::ClearCalibrations()
+COLDCODE bool Memory::ClearCalibrations()
 {
     bool result = true;
     size_t i = 0;
@@ -409,75 +396,154 @@ bool Memory::ReadCalibrations(Hardware::CalibrationsType &calibrations)
 
 void Memory::QueueUpdate8(uint16_t address, uint8_t value)
 {
-    QueueItem item;
-    item.address = address;
-    item.value = value;
-    item.size = 1;
-    QueueAdd(item);
+    uint8_t data[1] = {value};
+    QueueWrite(address, data, 1);
 }
 
 void Memory::QueueUpdate16(uint16_t address, uint16_t value)
 {
-    QueueItem item;
-    item.address = address;
-    item.value = value;
-    item.size = 2;
-    QueueAdd(item);
+    uint8_t data[2] = {static_cast<uint8_t>(value & 0xFF),
+                       static_cast<uint8_t>((value >> 8) & 0xFF)};
+    QueueWrite(address, data, 2);
 }
 
 void Memory::QueueUpdate32(uint16_t address, uint32_t value)
 {
-    QueueItem item;
-    item.address = address;
-    item.value = value;
-    item.size = 4;
-    QueueAdd(item);
+    uint8_t data[4] = {static_cast<uint8_t>(value & 0xFF),
+                       static_cast<uint8_t>((value >> 8) & 0xFF),
+                       static_cast<uint8_t>((value >> 16) & 0xFF),
+                       static_cast<uint8_t>((value >> 24) & 0xFF)};
+    QueueWrite(address, data, 4);
 }
 
-void Memory::QueueAdd(QueueItem item)
+void Memory::QueueWrite(uint16_t address, const uint8_t *data, uint16_t length)
 {
-    while (queue_size_ >= UPDATE_QUEUE_MAX_SIZE)
+    if (!available_ || address + length > MEMORY_SIZE)
     {
-        ProcessQueue(); // Process the queue if it's full
+        return;
     }
 
-    // Add to the queue
-    uint32_t insert_position = (queue_index_ + queue_size_) % UPDATE_QUEUE_MAX_SIZE;
-    queue_[insert_position] = item;
-    queue_size_++;
+    // Only the changed bytes make their page dirty, unchanged values don't wear the EEPROM
+    uint32_t pages = 0;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        if (shadow_[address + i] != data[i])
+        {
+            shadow_[address + i] = data[i];
+            pages |= 1u << ((address + i) / PAGE_SIZE);
+        }
+    }
+    if (pages != 0)
+    {
+        MarkDirty(pages);
+    }
+}
+
+void Memory::MarkDirty(uint32_t pages)
+{
+    // Set from the UI and the clock callbacks, cleared by ProcessQueue()
+    const uint32_t interrupts = save_and_disable_interrupts();
+    dirty_pages_ = dirty_pages_ | pages;
+    restore_interrupts(interrupts);
+}
+
+bool Memory::ClearDirty(uint32_t page)
+{
+    // Read and clear in one go, so a page marked meanwhile isn't lost
+    const uint32_t interrupts = save_and_disable_interrupts();
+    const bool dirty = (dirty_pages_ & (1u << page)) != 0;
+    dirty_pages_ = dirty_pages_ & ~(1u << page);
+    restore_interrupts(interrupts);
+    return dirty;
 }
 
 void Memory::ProcessQueue()
 {
-    if (queue_size_ == 0)
+    if (queued_page_ >= 0)
+    {
+        if (queued_job_.IsPending())
+        {
+            return; // Still on the bus
+        }
+        if (!queued_page_read_)
+        {
+            // Read back from the chip (not the shadow), queued after the write cycle
+            queued_page_read_ = eeprom_.QueueRead(queued_page_ * PAGE_SIZE, verify_buffer_.data(), PAGE_SIZE, &queued_job_);
+            return;
+        }
+        VerifyQueuedPage();
+    }
+
+    if (dirty_pages_ == 0)
     {
         return; // Nothing to process
     }
 
-    // Get the item at the front of the queue
-    QueueItem item = queue_[queue_index_];
+    // One page per call, in a single I2C transaction
+    const uint32_t page = __builtin_ctz(dirty_pages_);
+    const uint16_t address = page * PAGE_SIZE;
+    // Cleared before the bus reads the shadow, a change from now on marks the page again
+    ClearDirty(page);
+    if (!eeprom_.QueuePageWrite(address, &shadow_[address], PAGE_SIZE, &queued_job_))
+    {
+        MarkDirty(1u << page);
+        Trace::Emit<TraceLevel::WARNING>(TracePoint::MEMORY_BUS_FULL, page);
+        return; // The bus queue is full, next time
+    }
+    Trace::Emit<TraceLevel::VERBOSE>(TracePoint::MEMORY_PAGE_WRITE, page, std::popcount(dirty_pages_));
+    queued_page_ = page;
+    queued_page_read_ = false;
+}
 
-    // Process based on size
-    switch (item.size)
+void Memory::VerifyQueuedPage()
+{
+    const uint32_t page = queued_page_;
+    const uint16_t address = page * PAGE_SIZE;
+    queued_page_ = -1;
+
+    // A page changed meanwhile is dirty already
+    const bool match = queued_job_.status == I2cBus::Status::DONE && memcmp(verify_buffer_.data(), &shadow_[address], PAGE_SIZE) == 0;
+    if (match)
+    {
+        queued_page_retries_ = 0;
+        return;
+    }
+    if (++queued_page_retries_ >= WRITE_RETRIES)
+    {
+        // Given up, the chip keeps the old content
+        Trace::Emit<TraceLevel::ERROR>(TracePoint::MEMORY_VERIFY_FAILED, page, queued_page_retries_);
+        queued_page_retries_ = 0;
+        return;
+    }
+    Trace::Emit<TraceLevel::WARNING>(TracePoint::MEMORY_VERIFY_FAILED, page, queued_page_retries_);
+    MarkDirty(1u << page);
+}
+
+bool Memory::QueueProbe(I2cBus::Job *job)
+{
+    if (!available_)
     {
-    case 1:
-        Update8(item.address, static_cast<uint8_t>(item.value));
-        break;
-    case 2:
-        Update16(item.address, static_cast<uint16_t>(item.value));
-        break;
-    case 4:
-        Update32(item.address, item.value);
-        break;
+        return false;
     }
+    probe_buffer_.fill(0);
+    return eeprom_.QueueRead(ADDR_INIT_MESSAGE, probe_buffer_.data(), kTestStringLength, job);
+}
 
-    // Move the index to next item (with wrap-around)
-    queue_index_ = (queue_index_ + 1) % UPDATE_QUEUE_MAX_SIZE;
-    queue_size_--;
+bool Memory::IsProbeValid() const
+{
+    return memcmp(probe_buffer_.data(), kTestString, kTestStringLength) == 0;
 }
 
 void Memory::ClearQueue()
 {
-    queue_index_ = 0;
-    queue_size_ = 0;
-}
\ No newline at end of file
+    // Drop the pending changes, the shadow gets the chip content back (a queued page is written already)
+    eeprom_.Wait(queued_job_);
+    queued_page_ = -1;
+    for (uint32_t page = 0; page < MEMORY_SIZE / PAGE_SIZE; page++)
+    {
+        if (ClearDirty(page))
+        {
+            eeprom_.Read(page * PAGE_SIZE, &shadow_[page * PAGE_SIZE], PAGE_SIZE);
+        }
+    }
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include "hardware/i2c.h"
 #include "common/core/Hardware.hpp"
@@ -38,6 +39,11 @@ namespace kastle2
  * @brief EEPROM memory abstraction.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-05-14
+ *
+ * The whole EEPROM is read into a RAM shadow by Init(), so all the reads are served from RAM without I2C traffic.
+ * Writes go to the chip right away and update the shadow. Queued updates only change the shadow
+ * and mark the page dirty, ProcessQueue() queues one dirty page per call on the I2C bus and verifies it
+ * on the later calls, so the queue never blocks the UI loop.
  */
 class Memory
 {
@@ -67,6 +73,9 @@ public:
     static constexpr size_t ADDR_CLOCK_MULTIPLIER = ADDR_BASE_SPACE + 0x0B;   // 8-bit number
     static constexpr size_t ADDR_CLOCK_MIDI_DIVIDER = ADDR_BASE_SPACE + 0x0C; // 8-bit number
     static constexpr size_t ADDR_MIDI_CHANNEL = ADDR_BASE_SPACE + 0x0D;       // 8-bit number
+    static constexpr size_t ADDR_USER_DATA_SIZE = ADDR_BASE_SPACE + 0x0E;     // 32-bit number (verified user data file)
+    static constexpr size_t ADDR_USER_DATA_CRC = ADDR_BASE_SPACE + 0x12;      // 32-bit number (verified user data file)
+    static constexpr size_t ADDR_APP_SLOT = ADDR_BASE_SPACE + 0x16;           // 8-bit number (selected app of the multi-app image)
 
     // APP SPACE
     // ... starts at ADDR_APP_SPACE (0x50) and defined by the application
@@ -107,10 +116,10 @@ public:
 
     /**
      * Starts the EEPROM.
-     * @param i2c_inst I2C instance
+     * @param bus I2C bus shared with the codec
      * @return OK, INIT_OK, INIT_FAIL, MISSING...
      */
-    State Init(i2c_inst_t *i2c_inst);
+    State Init(I2cBus &bus);
 
     /**
      * Initialize the EEPROM with default settings.
@@ -290,6 +299,7 @@ public:
 
     /**
      * @brief Queues a byte update to be written to the memory. Verifies the write.
+     *        The value is readable right away, the page is written later by ProcessQueue().
      * @param address Memory address
      * @param value Value to update
      * @warning The Factory Reset will not wait for the queue to empty, use Write8 instead.
@@ -298,6 +308,7 @@ public:
 
     /**
      * @brief Queues a 16-bit number update to be written to the memory. Verifies the write.
+     *        The value is readable right away, the page is written later by ProcessQueue().
      * @param address Memory address
      * @param value Value to update
      * @warning The Factory Reset will not wait for the queue to empty, use Write16 instead.
@@ -306,6 +317,7 @@ public:
 
     /**
      * @brief Queues a 32-bit number update to be written to the memory. Verifies the write.
+     *        The value is readable right away, the page is written later by ProcessQueue().
      * @param address Memory address
      * @param value Value to update
      * @warning The Factory Reset will not wait for the queue to empty, use Write32 instead.
@@ -313,16 +325,30 @@ public:
     void QueueUpdate32(uint16_t address, uint32_t value);
 
     /**
-     * @brief Takes the first item from the queue and writes it to the memory.
-     *        If the queue is empty, does nothing.
+     * @brief Queues the first dirty page on the I2C bus (page-aligned) and doesn't wait for it.
+     *        The previous page is read back and verified first, also without waiting, a mismatch makes it dirty again.
+     *        If no page is dirty, does nothing.
      */
     void ProcessQueue();
 
     /**
-     * @brief Clears the queue.
+     * @brief Clears the queue, the queued but unwritten values are read back from the memory.
      */
     void ClearQueue();
 
+    /**
+     * @brief Queues a read of the init message from the chip (not the shadow), doesn't wait for it.
+     * @param job Followed by the caller, IsProbeValid() is valid once it's done
+     * @return false if the memory isn't available or the bus queue is full
+     */
+    bool QueueProbe(I2cBus::Job *job);
+
+    /**
+     * @brief Checks the init message read by QueueProbe().
+     * @return true if the chip holds the init message
+     */
+    bool IsProbeValid() const;
+
     /**
      * @brief Writes calibrations array into the memory
      * @param calibrations 4 items array
@@ -351,21 +377,27 @@ public:
 
 private:
     static constexpr uint16_t MEMORY_SIZE = 256;
-    static constexpr uint32_t UPDATE_QUEUE_MAX_SIZE = 32;
+    static constexpr uint16_t PAGE_SIZE = 8; // AT24C02 write page
     static constexpr uint32_t WRITE_RETRIES = 10;
     static constexpr bool WRITE_VERIFY = true;
 
-    struct QueueItem
-    {
-        uint16_t address;
-        uint32_t value;
-        uint8_t size; // 1, 2, or 4 bytes
-    };
-
-    void QueueAdd(QueueItem item);
-    uint32_t queue_index_ = 0;
-    uint32_t queue_size_ = 0;
-    QueueItem queue_[UPDATE_QUEUE_MAX_SIZE];
+    // Dirty pages are tracked by bits of one word
+    static_assert(MEMORY_SIZE / PAGE_SIZE <= 32);
+
+    void QueueWrite(uint16_t address, const uint8_t *data, uint16_t length);
+    void MarkDirty(uint32_t pages);
+    bool ClearDirty(uint32_t page);
+    void VerifyQueuedPage();
+    std::array<uint8_t, MEMORY_SIZE> shadow_;
+    volatile uint32_t dirty_pages_ = 0;
+
+    // Page written by the bus, then read back and verified by the next ProcessQueue() calls (-1 for none)
+    int32_t queued_page_ = -1;
+    uint32_t queued_page_retries_ = 0;
+    bool queued_page_read_ = false;
+    I2cBus::Job queued_job_;
+    std::array<uint8_t, PAGE_SIZE> verify_buffer_;
+    std::array<uint8_t, kTestStringLength> probe_buffer_;
 
     AT24C eeprom_ = AT24C::AT24C02();
     bool available_ = false;
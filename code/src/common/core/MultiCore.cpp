@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "MultiCore.hpp"
+#include "common/debug/Profiler.hpp"
+#include "common/debug/Trace.hpp"
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+FASTCODE void MultiCore::ParallelFor(const RangeJob job, void *context, const size_t size, const size_t chunk)
+{
+    const size_t chunks = (size + chunk - 1) / chunk;
+    const size_t split = (chunks / 2) * chunk;
+
+    if (split < size)
+    {
+        range_ = {job, context, split, size};
+        Submit(RunRange, nullptr);
+    }
+    if (split > 0)
+    {
+        job(context, 0, split);
+    }
+    Join();
+}
+
+FASTCODE void MultiCore::RunRange(void *)
+{
+    range_.job(range_.context, range_.from, range_.to);
+}
+
+FASTCODE void MultiCore::JobWorker()
+{
+    uint32_t finished = job_.finished;
+    while (true)
+    {
+        const uint32_t submitted = job_.submitted;
+        if (submitted == finished)
+        {
+            WaitForWork();
+            continue;
+        }
+        // The job was written before the sequence
+        __dmb();
+
+        Profiler::Start(Profiler::Section::SECOND_CORE);
+        Trace::Begin(TraceSpan::SECOND_CORE);
+        job_.job(job_.context);
+        Trace::End(TraceSpan::SECOND_CORE);
+        Profiler::End(Profiler::Section::SECOND_CORE);
+
+        // The results must be in memory before core 0 sees the job finished
+        __dmb();
+        finished = submitted;
+        job_.finished = finished;
+        __sev();
+    }
+}
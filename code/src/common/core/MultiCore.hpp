@@ -27,6 +27,8 @@ SOFTWARE.
 #include <cstddef>
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "common/debug/Trace.hpp"
 
 namespace kastle2
 {
@@ -35,6 +37,22 @@ namespace kastle2
  * @class MultiCore
  * @ingroup core
  * @brief Helper for comunication between cores.
+ *
+ * There are three ways to hand audio work over to the second core:
+ * - jobs (Submit / ParallelFor / Join), the second core runs JobWorker() and executes the jobs core 0 submits,
+ *   no app specific second core loop is needed. For work which splits into parts independent on each other
+ *   (voices, channels, stages of the previous block).
+ * - block handoff (BeginBlock / PublishFrames / WaitForBlock), the second core follows core 0 frame by frame,
+ *   for stages which need the frames core 0 computes in the same block.
+ * - messages over the FIFO (SendMessage / GetMessage).
+ *
+ * The waiting core sleeps with `__wfe` instead of polling the shared memory and the FIFO, the other core ends
+ * each handover with `__sev` (PublishFrames, MarkFramesProcessed, Submit, a finished job, a FIFO push).
+ * Any other event (an interrupt, MultiCoreQueue, UiScheduler::Post) wakes it too, the waits check again.
+ * The second core worker loops call WaitForWork() when there's nothing published, it runs the idle task
+ * (SetIdleTask, eg. the LevelMeter) before it sleeps.
+ *
+ * @see MultiCoreQueue for passing larger payloads between cores.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-08-01
  */
@@ -51,11 +69,34 @@ public:
         DONE,           ///< Indicates that the second core has finished processing samples
     };
 
+    /**
+     * @brief How many frames core 0 hands over to the second core at once in the block handoff mode.
+     * @details The block handoff mode (BeginBlock / PublishFrames / WaitForBlock) replaces
+     *          per-sample SAMPLE_REQUEST messages with a shared-memory descriptor, so the FIFO
+     *          isn't touched at all during the audio loop.
+     */
+    static constexpr size_t kSubBlockSize = 8;
+
     /**
      * @brief Function type for the second core function.
      */
     using Worker = void (*)(void);
 
+    /**
+     * @brief Background work for the idle second core, returns true while there's more of it.
+     */
+    using IdleTask = bool (*)(void);
+
+    /**
+     * @brief Job for the second core, the context is passed from Submit().
+     */
+    using Job = void (*)(void *context);
+
+    /**
+     * @brief Job processing the items from (including) to (excluding) of a ParallelFor().
+     */
+    using RangeJob = void (*)(void *context, size_t from, size_t to);
+
     /**
      * @brief Message structure for communication between cores.
      * Contains the message type and data.
@@ -146,22 +187,255 @@ public:
         return message;
     }
 
+    /**
+     * @brief Starts a new block in the block handoff mode. Called by core 0.
+     * @note The previous block must be finished (see WaitForBlock) before calling this.
+     * @param size Number of frames in the block.
+     */
+    static void BeginBlock(size_t size)
+    {
+        handoff_.size = size;
+        handoff_.published = 0;
+        handoff_.processed = 0;
+        __dmb();
+        handoff_.sequence = handoff_.sequence + 1;
+        __dmb();
+    }
+
+    /**
+     * @brief Tells the second core that frames up to (excluding) `frames` are ready. Called by core 0.
+     * @param frames Number of frames from the start of the block which are ready.
+     */
+    static void PublishFrames(size_t frames)
+    {
+        // Make sure the frames are in memory before the counter moves
+        __dmb();
+        handoff_.published = frames;
+        __sev();
+    }
+
+    /**
+     * @brief Publishes the frame if it completes a sub-block (or the whole block). Called by core 0.
+     * @param index Index of the frame which was just finished.
+     */
+    static void PublishFrame(size_t index)
+    {
+        size_t frames = index + 1;
+        if ((frames % kSubBlockSize) == 0 || frames == handoff_.size)
+        {
+            PublishFrames(frames);
+        }
+    }
+
+    /**
+     * @brief Waits until the second core processes the whole block. Called by core 0.
+     */
+    static void WaitForBlock()
+    {
+        Trace::Begin(TraceSpan::WAIT_FOR_BLOCK);
+        while (handoff_.processed != handoff_.size)
+        {
+            __wfe();
+        }
+        Trace::End(TraceSpan::WAIT_FOR_BLOCK);
+        __dmb();
+    }
+
+    /**
+     * @brief Gets the range of frames the second core can process now. Called by core 1.
+     * @param from First frame to process.
+     * @param to One past the last frame to process.
+     * @return True if there are new frames to process.
+     */
+    static bool GetPublishedFrames(size_t &from, size_t &to)
+    {
+        // The sequence counter is read before and after the frame counter,
+        // so we never mix the frame counter of a new block with the position of the old one
+        uint32_t sequence = handoff_.sequence;
+        __dmb();
+        size_t published = handoff_.published;
+        __dmb();
+        if (sequence != handoff_.sequence)
+        {
+            return false;
+        }
+
+        if (sequence != worker_sequence_)
+        {
+            worker_sequence_ = sequence;
+            worker_position_ = 0;
+        }
+
+        if (published <= worker_position_)
+        {
+            return false;
+        }
+
+        from = worker_position_;
+        to = published;
+        return true;
+    }
+
+    /**
+     * @brief Marks frames up to (excluding) `to` as processed. Called by core 1.
+     * @param to One past the last processed frame.
+     */
+    static void MarkFramesProcessed(size_t to)
+    {
+        worker_position_ = to;
+        __dmb();
+        handoff_.processed = to;
+        __sev();
+    }
+
+    /**
+     * @brief Sleeps until the other core hands over more work (or any other event). Called by core 1.
+     * @details For the second core loops, when GetPublishedFrames() has nothing, it doesn't spin on the shared memory
+     *          meanwhile. The loop checks its exit condition and the frames again after it.
+     */
+    static void WaitForWork()
+    {
+        const IdleTask task = idle_task_;
+        if (task != nullptr && task())
+        {
+            // More idle work, the loop checks for the handed over work first
+            return;
+        }
+        __wfe();
+    }
+
+    /**
+     * @brief Sets the task WaitForWork() runs before it sleeps, nullptr for none. Called by core 0.
+     * @details The task runs in the gaps of the second core work, it should take a small step (well below
+     *          a block) and return, so the handed over work doesn't wait for it.
+     * @param task The task.
+     */
+    static void SetIdleTask(IdleTask task)
+    {
+        idle_task_ = task;
+        __sev();
+    }
+
+    /**
+     * @brief Runs the job on the second core and returns right away. Called by core 0.
+     * @details One job runs at a time, a previous job is joined first. The second core must run JobWorker().
+     * @param job The job.
+     * @param context Passed to the job (eg. the app).
+     */
+    static void Submit(Job job, void *context)
+    {
+        Join();
+        job_.job = job;
+        job_.context = context;
+        // The job must be complete before the second core sees the new sequence
+        __dmb();
+        job_.submitted = job_.submitted + 1;
+        __sev();
+    }
+
+    /**
+     * @brief Waits until the submitted job is finished. Called by core 0.
+     */
+    static void Join()
+    {
+        while (job_.finished != job_.submitted)
+        {
+            __wfe();
+        }
+        __dmb();
+    }
+
+    /**
+     * @brief Returns whether the submitted job is still running.
+     */
+    static bool IsBusy()
+    {
+        return job_.finished != job_.submitted;
+    }
+
+    /**
+     * @brief Splits the items between both cores, runs the job on them and waits for both halves.
+     * @details The items are split in whole chunks, core 0 takes the first half (fewer chunks when odd,
+     *          it handles the interrupts too), the second core the rest. The split is always the same
+     *          for the same size, so the state of one item (eg. a voice) is always processed by the same core.
+     * @param job The job, called once on each core with its range (unless the range is empty).
+     * @param context Passed to the job.
+     * @param size Number of items.
+     * @param chunk Items are split in multiples of this (eg. MultiCore::kSubBlockSize frames).
+     */
+    static void ParallelFor(RangeJob job, void *context, size_t size, size_t chunk = 1);
+
+    /**
+     * @brief The second core loop executing the jobs, pass it to StartSecondCore(). Never returns.
+     */
+    static void JobWorker();
+
     /**
      * @brief Waits until a message of the given type arrives.
      */
     static void WaitForMessage(MessageType message_type)
     {
-        while (true)
+        // GetMessage() sleeps until the push
+        while (GetMessage().type != message_type)
         {
-            if (HasMessage())
-            {
-                Message m = GetMessage();
-                if (m.type == message_type)
-                {
-                    break;
-                }
-            }
         }
     }
+
+private:
+    /**
+     * @brief Shared-memory descriptor for the block handoff mode.
+     */
+    struct BlockHandoff
+    {
+        volatile uint32_t sequence; ///< Incremented by core 0 each time a new block starts
+        volatile size_t size;       ///< Total frames in the current block
+        volatile size_t published;  ///< Frames finished by core 0
+        volatile size_t processed;  ///< Frames finished by core 1
+    };
+
+    static inline BlockHandoff handoff_;
+
+    /**
+     * @brief Shared-memory descriptor of the jobs.
+     */
+    struct JobSlot
+    {
+        Job job;                     ///< Job to run
+        void *context;               ///< Its context
+        volatile uint32_t submitted; ///< Incremented by core 0 for each job
+        volatile uint32_t finished;  ///< Set to submitted by the second core when the job is done
+    };
+
+    static inline JobSlot job_;
+
+    /**
+     * @brief Second core part of the current ParallelFor().
+     */
+    struct Range
+    {
+        RangeJob job;
+        void *context;
+        size_t from;
+        size_t to;
+    };
+
+    static inline Range range_;
+
+    static void RunRange(void *);
+
+    /**
+     * @brief Block sequence the second core is currently working on (core 1 only).
+     */
+    static inline uint32_t worker_sequence_ = 0;
+
+    /**
+     * @brief Next frame the second core will process (core 1 only).
+     */
+    static inline size_t worker_position_ = 0;
+
+    /**
+     * @brief Task run by WaitForWork() (set by core 0).
+     */
+    static inline volatile IdleTask idle_task_ = nullptr;
 };
 }
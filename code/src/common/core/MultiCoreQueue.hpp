@@ -0,0 +1,236 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+namespace kastle2
+{
+
+/**
+ * @class MultiCoreQueue
+ * @ingroup core
+ * @brief Lock-free single-producer/single-consumer queue for passing data between the cores.
+ * @details Unlike MultiCore messages, the payload can be any trivially copyable type
+ *          (parameter snapshots, MIDI events, audio chunks) and the capacity isn't limited
+ *          by the 8-word hardware FIFO. Exactly one core may push and exactly one core may pop.
+ *          Head and tail live in separate padded slots, so the producer and the consumer never
+ *          write the same bus word. Place the queue in regular (striped) SRAM, eg. as a static member.
+ *          Push signals an event (SEV), so the consumer can sleep in WaitPop using WFE.
+ * @tparam T Type of the items (copied by value).
+ * @tparam N Number of slots, must be a power of two (usable capacity is N).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+template <typename T, size_t N>
+class MultiCoreQueue
+{
+    static_assert(N > 1 && (N & (N - 1)) == 0, "MultiCoreQueue size must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "MultiCoreQueue items must be trivially copyable");
+
+public:
+    MultiCoreQueue() = default;
+
+    // Shared between cores, never copy it
+    MultiCoreQueue(const MultiCoreQueue &) = delete;
+    MultiCoreQueue &operator=(const MultiCoreQueue &) = delete;
+
+    /**
+     * @brief Pushes an item into the queue. Called by the producer core only.
+     * @param item The item to push.
+     * @return True if pushed, false if the queue is full.
+     */
+    bool Push(const T &item)
+    {
+        uint32_t tail = tail_.value;
+        if (tail - head_.value >= N)
+        {
+            return false;
+        }
+        buffer_[tail & kMask] = item;
+
+        // Item must be in memory before the consumer sees the new tail
+        __dmb();
+        tail_.value = tail + 1;
+
+        // Wake the other core if it sleeps in WaitPop
+        __sev();
+        return true;
+    }
+
+    /**
+     * @brief Pops an item from the queue. Called by the consumer core only.
+     * @param item Where to store the popped item.
+     * @return True if an item was popped, false if the queue is empty.
+     */
+    bool Pop(T &item)
+    {
+        uint32_t head = head_.value;
+        if (head == tail_.value)
+        {
+            return false;
+        }
+
+        // Don't read the item before we've seen the tail
+        __dmb();
+        item = buffer_[head & kMask];
+        __dmb();
+        head_.value = head + 1;
+        return true;
+    }
+
+    /**
+     * @brief Copies the oldest item without removing it. Called by the consumer core only.
+     * @param item Where to store the item.
+     * @return True if there was an item, false if the queue is empty.
+     */
+    bool Peek(T &item) const
+    {
+        uint32_t head = head_.value;
+        if (head == tail_.value)
+        {
+            return false;
+        }
+
+        // Don't read the item before we've seen the tail
+        __dmb();
+        item = buffer_[head & kMask];
+        return true;
+    }
+
+    /**
+     * @brief Pushes up to count items with (at most two) memcpy. Called by the producer core only.
+     * @param items The items to push.
+     * @param count Number of items.
+     * @return Number of items pushed, fewer than count if the queue got full.
+     */
+    size_t PushBlock(const T *items, size_t count)
+    {
+        uint32_t tail = tail_.value;
+        const size_t space = N - (tail - head_.value);
+        if (count > space)
+        {
+            count = space;
+        }
+        const size_t start = tail & kMask;
+        const size_t first = count < N - start ? count : N - start;
+        std::memcpy(&buffer_[start], items, first * sizeof(T));
+        std::memcpy(&buffer_[0], items + first, (count - first) * sizeof(T));
+
+        // Items must be in memory before the consumer sees the new tail
+        __dmb();
+        tail_.value = tail + count;
+        __sev();
+        return count;
+    }
+
+    /**
+     * @brief Pops up to count items with (at most two) memcpy. Called by the consumer core only.
+     * @param items Where to store the popped items.
+     * @param count Number of items.
+     * @return Number of items popped, fewer than count if the queue got empty.
+     */
+    size_t PopBlock(T *items, size_t count)
+    {
+        uint32_t head = head_.value;
+        const size_t available = tail_.value - head;
+        if (count > available)
+        {
+            count = available;
+        }
+
+        // Don't read the items before we've seen the tail
+        __dmb();
+        const size_t start = head & kMask;
+        const size_t first = count < N - start ? count : N - start;
+        std::memcpy(items, &buffer_[start], first * sizeof(T));
+        std::memcpy(items + first, &buffer_[0], (count - first) * sizeof(T));
+        __dmb();
+        head_.value = head + count;
+        return count;
+    }
+
+    /**
+     * @brief Pops an item, sleeping until the producer pushes one. Called by the consumer core only.
+     * @param item Where to store the popped item.
+     */
+    void WaitPop(T &item)
+    {
+        while (!Pop(item))
+        {
+            __wfe();
+        }
+    }
+
+    /**
+     * @brief Checks if the queue is empty (safe from both cores, may be stale).
+     * @return empty or not
+     */
+    bool IsEmpty() const
+    {
+        return head_.value == tail_.value;
+    }
+
+    /**
+     * @brief Number of items in the queue (safe from both cores, may be stale).
+     * @return Number of items.
+     */
+    size_t Size() const
+    {
+        return tail_.value - head_.value;
+    }
+
+    /**
+     * @brief Capacity of the queue.
+     * @return Number of usable slots.
+     */
+    static constexpr size_t Capacity()
+    {
+        return N;
+    }
+
+private:
+    static constexpr uint32_t kMask = N - 1;
+
+    /**
+     * @brief Index padded to its own 32-byte slot, so producer and consumer state don't share bus words.
+     */
+    struct alignas(32) PaddedIndex
+    {
+        volatile uint32_t value = 0;
+    };
+
+    // Free-running counters, wrapping is fine thanks to the power of two size
+    PaddedIndex head_; ///< Written by the consumer only
+    PaddedIndex tail_; ///< Written by the producer only
+    T buffer_[N];
+};
+
+}
@@ -0,0 +1,155 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "hardware/sync.h"
+
+namespace kastle2
+{
+
+/**
+ * @class ParamSnapshot
+ * @ingroup core
+ * @brief Triple buffered block of parameters, written by the UI loop and read by the audio (both cores).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The UI fills Edit() over its loop and Publish()es it. The audio side Flip()s once per block, at the block
+ * boundary (register it in the ControlScheduler, Kastle2::base runs it in BeforeAudioLoop()), and the whole
+ * block then reads one coherent copy with Get(), on both cores. No parameter changes in the middle of a block
+ * and no half written struct is ever seen, without disabling interrupts or locks:
+ * - three buffers, the one the audio reads, the latest published one and one the UI can write,
+ * - Publish() copies to a buffer which is neither the latest nor the read one and then moves `latest_` to it,
+ * - Flip() marks the latest one as read and checks it didn't move meanwhile, it retries only if the UI
+ *   published right in between (a few instructions), so it finishes in bounded time.
+ *
+ * @code
+ * // Init
+ * params_.Reset(Params{});
+ * Kastle2::base.GetScheduler().Add<ParamSnapshot<Params>, &ParamSnapshot<Params>::Flip>(&params_);
+ * // UiLoop
+ * params_.Edit().cutoff = cutoff;
+ * params_.Publish();
+ * // AudioLoop
+ * const Params &params = params_.Get();
+ * @endcode
+ *
+ * @tparam T The parameters, a plain struct (copied with =).
+ * @note One writer (the UI) and one reader side (the audio, which may span both cores within the block).
+ */
+template <typename T>
+class ParamSnapshot
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Parameters are copied between the buffers");
+
+public:
+    /**
+     * @brief Sets all the buffers to the values. Call before the audio runs.
+     * @param values The initial parameters, the state the audio side already has (no change is reported for them).
+     */
+    void Reset(const T &values)
+    {
+        edit_ = values;
+        buffers_.fill(values);
+        latest_ = 0;
+        reading_ = 0;
+        current_ = 0;
+        changed_ = false;
+    }
+
+    /**
+     * @brief Returns the UI copy of the parameters to change. UI side.
+     */
+    T &Edit()
+    {
+        return edit_;
+    }
+
+    /**
+     * @brief Publishes the UI copy, the audio gets it at the next block. UI side.
+     */
+    void Publish()
+    {
+        const uint8_t latest = latest_;
+        const uint8_t reading = reading_;
+        uint8_t free = 0;
+        while (free == latest || free == reading)
+        {
+            free++;
+        }
+        buffers_[free] = edit_;
+        // The values must be in memory before the audio can pick the buffer
+        __dmb();
+        latest_ = free;
+    }
+
+    /**
+     * @brief Takes the latest published parameters for the block. Audio side, once per block.
+     */
+    void Flip()
+    {
+        uint8_t latest;
+        do
+        {
+            latest = latest_;
+            reading_ = latest;
+            // The UI has to see the read buffer before we rely on the latest one staying untouched
+            __dmb();
+        } while (latest != latest_);
+
+        changed_ = latest != current_;
+        current_ = latest;
+    }
+
+    /**
+     * @brief Returns the parameters of the current block. Audio side.
+     */
+    const T &Get() const
+    {
+        return buffers_[current_];
+    }
+
+    /**
+     * @brief Returns whether the last Flip() brought new parameters (published since the last block).
+     */
+    bool HasChanged() const
+    {
+        return changed_;
+    }
+
+private:
+    std::array<T, 3> buffers_{};
+    T edit_{};
+    volatile uint8_t latest_ = 0;  ///< Written by the UI
+    volatile uint8_t reading_ = 0; ///< Written by the audio
+    uint8_t current_ = 0;
+    bool changed_ = false;
+};
+
+}
@@ -0,0 +1,331 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "PresetStore.hpp"
+#include <algorithm>
+#include <cstddef>
+#include "common/core/Crc.hpp"
+
+using namespace kastle2;
+
+void PresetStore::Init(const uint8_t app_id)
+{
+    app_id_ = app_id;
+    entry_count_ = 0;
+    FlashWriter::Enable();
+
+    // The head is the sector with the newest header, the ones with a broken header are erased
+    std::array<bool, kSectors> valid{};
+    bool found = false;
+    for (size_t sector = 0; sector < kSectors; sector++)
+    {
+        SectorHeader header;
+        valid[sector] = ReadSectorHeader(sector, header);
+        if (valid[sector])
+        {
+            if (!found || header.sequence > head_sequence_)
+            {
+                head_ = sector;
+                head_sequence_ = header.sequence;
+            }
+            found = true;
+        }
+        else if (!IsBlank(GetFlash(sector * kSectorSize), kSectorSize))
+        {
+            FlashWriter::ErasePresetSector(sector * kSectorSize);
+        }
+    }
+
+    if (!found)
+    {
+        // Empty store, the log starts in sector 0
+        head_ = kSectors - 1;
+        head_sequence_ = 0;
+        initialized_ = Advance();
+        return;
+    }
+
+    // From the oldest sector (after the head in the ring) to the head, newer records replace older ones
+    for (size_t i = 1; i <= kSectors; i++)
+    {
+        const size_t sector = (head_ + i) % kSectors;
+        if (valid[sector])
+        {
+            ScanSector(sector, sector == head_);
+        }
+    }
+
+    // The sector after the head has to be free for the next Advance(), it isn't after a cut compaction
+    const size_t next = (head_ + 1) % kSectors;
+    if (valid[next] && next != head_)
+    {
+        Compact(next);
+    }
+    initialized_ = true;
+}
+
+bool PresetStore::Save(const uint8_t slot, const void *data, const size_t size)
+{
+    if (!initialized_ || size == 0 || size > kMaxPresetSize)
+    {
+        return false;
+    }
+
+    const uint16_t key = GetKey(slot);
+    const size_t index = FindEntry(key);
+    if (index == entry_count_ && entry_count_ == kMaxPresets)
+    {
+        return false;
+    }
+    // Saves the flash from the same preset stored again and again
+    if (index < entry_count_ && entries_[index].size == size &&
+        std::memcmp(GetFlash(entries_[index].offset + sizeof(RecordHeader)), data, size) == 0)
+    {
+        return true;
+    }
+    return Append(key, static_cast<const uint8_t *>(data), size);
+}
+
+const uint8_t *PresetStore::Find(const uint8_t slot, size_t &size) const
+{
+    const size_t index = FindEntry(GetKey(slot));
+    if (index == entry_count_ || entries_[index].size == 0)
+    {
+        size = 0;
+        return nullptr;
+    }
+    size = entries_[index].size;
+    return GetFlash(entries_[index].offset + sizeof(RecordHeader));
+}
+
+bool PresetStore::Erase(const uint8_t slot)
+{
+    const uint16_t key = GetKey(slot);
+    const size_t index = FindEntry(key);
+    if (index == entry_count_ || entries_[index].size == 0)
+    {
+        return true;
+    }
+    return initialized_ && Append(key, nullptr, 0);
+}
+
+size_t PresetStore::GetCount() const
+{
+    return std::count_if(entries_.begin(), entries_.begin() + entry_count_, [](const Entry &entry)
+                         { return entry.size != 0; });
+}
+
+bool PresetStore::IsBlank(const uint8_t *data, const size_t size)
+{
+    return std::all_of(data, data + size, [](const uint8_t byte)
+                       { return byte == 0xFF; });
+}
+
+bool PresetStore::ReadSectorHeader(const size_t sector, SectorHeader &header)
+{
+    const uint8_t *flash = GetFlash(sector * kSectorSize);
+    std::memcpy(&header, flash, sizeof(header));
+    return header.magic == kSectorMagic &&
+           header.crc == Crc::Crc32(flash + offsetof(SectorHeader, sequence), sizeof(header) - offsetof(SectorHeader, sequence));
+}
+
+bool PresetStore::ReadRecord(const uint32_t offset, RecordHeader &header)
+{
+    const uint8_t *flash = GetFlash(offset);
+    std::memcpy(&header, flash, sizeof(header));
+    if (header.magic != kRecordMagic || header.size > kMaxPresetSize ||
+        offset % kSectorSize + Align(sizeof(header) + header.size) > kSectorSize)
+    {
+        return false;
+    }
+    const size_t covered = sizeof(header) - offsetof(RecordHeader, key) + header.size;
+    return header.crc == Crc::Crc32(flash + offsetof(RecordHeader, key), covered);
+}
+
+size_t PresetStore::FindEntry(const uint16_t key) const
+{
+    for (size_t i = 0; i < entry_count_; i++)
+    {
+        if (entries_[i].key == key)
+        {
+            return i;
+        }
+    }
+    return entry_count_;
+}
+
+void PresetStore::SetEntry(const uint16_t key, const uint16_t size, const uint32_t offset)
+{
+    size_t index = FindEntry(key);
+    if (index == entry_count_)
+    {
+        if (entry_count_ == kMaxPresets)
+        {
+            return;
+        }
+        entry_count_++;
+    }
+    entries_[index] = {key, size, offset};
+}
+
+void PresetStore::ScanSector(const size_t sector, const bool head)
+{
+    const uint32_t base = sector * kSectorSize;
+    uint32_t offset = sizeof(SectorHeader);
+    RecordHeader header;
+    while (offset + sizeof(RecordHeader) <= kSectorSize && ReadRecord(base + offset, header))
+    {
+        SetEntry(header.key, header.size, base + offset);
+        offset += Align(sizeof(RecordHeader) + header.size);
+    }
+    if (head)
+    {
+        // A record cut by a power off leaves programmed bytes, the rest of the sector is skipped then
+        head_offset_ = IsBlank(GetFlash(base + offset), kSectorSize - offset) ? offset : kSectorSize;
+    }
+}
+
+bool PresetStore::Append(const uint16_t key, const uint8_t *data, const size_t size)
+{
+    const uint32_t record_size = Align(sizeof(RecordHeader) + size);
+    for (size_t i = 0; i < kSectors; i++)
+    {
+        if (head_offset_ + record_size <= kSectorSize)
+        {
+            const uint32_t offset = head_ * kSectorSize + head_offset_;
+            if (!ProgramRecord(offset, key, data, size))
+            {
+                head_offset_ = kSectorSize;
+                return false;
+            }
+            head_offset_ += record_size;
+            SetEntry(key, size, offset);
+            return true;
+        }
+        if (!Advance())
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool PresetStore::ProgramRecord(const uint32_t offset, const uint16_t key, const uint8_t *data, const size_t size)
+{
+    const RecordHeader header = {kRecordMagic, 0, key, static_cast<uint16_t>(size), 0xFFFFFFFFu};
+    const size_t record_size = Align(sizeof(header) + size);
+    std::memcpy(record_.data(), &header, sizeof(header));
+    if (size > 0)
+    {
+        std::memcpy(record_.data() + sizeof(header), data, size);
+    }
+    std::fill(record_.begin() + sizeof(header) + size, record_.begin() + record_size, 0xFF);
+    const uint32_t crc = Crc::Crc32(record_.data() + offsetof(RecordHeader, key),
+                                                 sizeof(header) - offsetof(RecordHeader, key) + size);
+    std::memcpy(record_.data() + offsetof(RecordHeader, crc), &crc, sizeof(crc));
+
+    // From the last page, the record counts only once its header is there
+    const uint32_t first_page = offset / kPageSize * kPageSize;
+    uint32_t page = (offset + record_size - 1) / kPageSize * kPageSize;
+    while (true)
+    {
+        const uint32_t start = std::max(offset, page);
+        const uint32_t end = std::min<uint32_t>(offset + record_size, page + kPageSize);
+        page_.fill(0xFF);
+        std::memcpy(page_.data() + (start - page), record_.data() + (start - offset), end - start);
+        if (!FlashWriter::ProgramPresetPage(page, page_.data()))
+        {
+            return false;
+        }
+        if (page == first_page)
+        {
+            return true;
+        }
+        page -= kPageSize;
+    }
+}
+
+bool PresetStore::Advance()
+{
+    const size_t next = (head_ + 1) % kSectors;
+    SectorHeader header = {kSectorMagic, 0, head_sequence_ + 1, 0xFFFFFFFFu};
+    header.crc = Crc::Crc32(reinterpret_cast<const uint8_t *>(&header) + offsetof(SectorHeader, sequence),
+                                         sizeof(header) - offsetof(SectorHeader, sequence));
+    page_.fill(0xFF);
+    std::memcpy(page_.data(), &header, sizeof(header));
+    if (!FlashWriter::ProgramPresetPage(next * kSectorSize, page_.data()))
+    {
+        return false;
+    }
+    head_ = next;
+    head_offset_ = sizeof(SectorHeader);
+    head_sequence_ = header.sequence;
+
+    // The oldest sector follows, its live records move to the new head and it's erased to be the free one
+    const size_t oldest = (head_ + 1) % kSectors;
+    SectorHeader oldest_header;
+    if (ReadSectorHeader(oldest, oldest_header))
+    {
+        return Compact(oldest);
+    }
+    return true;
+}
+
+bool PresetStore::Compact(const size_t sector)
+{
+    const uint32_t base = sector * kSectorSize;
+    uint32_t offset = sizeof(SectorHeader);
+    RecordHeader header;
+    while (offset + sizeof(RecordHeader) <= kSectorSize && ReadRecord(base + offset, header))
+    {
+        const uint32_t record_offset = base + offset;
+        offset += Align(sizeof(RecordHeader) + header.size);
+
+        const size_t index = FindEntry(header.key);
+        if (index == entry_count_ || entries_[index].offset != record_offset)
+        {
+            // Replaced by a newer record
+            continue;
+        }
+        if (header.size == 0)
+        {
+            // Nothing older of the deleted key is left, the deletion itself can go
+            entries_[index] = entries_[--entry_count_];
+            continue;
+        }
+
+        const uint32_t record_size = Align(sizeof(RecordHeader) + header.size);
+        const uint32_t copy = head_ * kSectorSize + head_offset_;
+        if (head_offset_ + record_size > kSectorSize ||
+            !ProgramRecord(copy, header.key, GetFlash(record_offset + sizeof(RecordHeader)), header.size))
+        {
+            head_offset_ = kSectorSize;
+            return false;
+        }
+        head_offset_ += record_size;
+        entries_[index].offset = copy;
+    }
+    return FlashWriter::ErasePresetSector(base);
+}
@@ -0,0 +1,223 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "common/config.hpp"
+#include "common/core/FlashWriter.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class PresetStore
+ * @ingroup core
+ * @brief Presets of the apps (eg. FancyPotBank snapshots) in the preset section of the flash.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The EEPROM app space is far too small for whole presets, so they're kept in a log in the flash:
+ * - each save appends a record (key, size, CRC32, data) after the last one, nothing is rewritten in place
+ * - the newest record of a key wins, Init() scans the log once and keeps the address of each in a RAM index,
+ *   so a recall is a read of the flash (Find() gives the pointer)
+ * - the sectors are used as a ring, each starts with a header with a sequence number. When the head sector
+ *   is full, the log moves to the next (always erased) one, the live records of the oldest sector are copied
+ *   to it and the oldest sector is erased, which keeps one sector free and spreads the erases evenly
+ * - a record is programmed header page last and checked by its CRC, so a save cut by a power off
+ *   leaves the previous preset, Init() finishes an interrupted compaction
+ *
+ * The keys combine the app id with the slot, other apps' presets stay untouched. The writes go through
+ * FlashWriter (see there what happens with the audio), Init() enables it, call it in the app's Init()
+ * before the second core starts.
+ */
+class PresetStore
+{
+public:
+    static constexpr size_t kSectorSize = FlashWriter::kSectorSize;
+    static constexpr size_t kSectors = PRESET_SECTION_SIZE / kSectorSize;
+    static constexpr size_t kMaxPresets = 64;     // Of all the apps together
+    static constexpr size_t kMaxPresetSize = 512; // Bytes of data per preset
+
+    /**
+     * @brief Scans the log and builds the index, finishes an interrupted compaction.
+     * @param app_id Id of the app which uses the store (App::GetId()).
+     */
+    void Init(const uint8_t app_id);
+
+    /**
+     * @brief Stores the preset, unchanged data are not written again.
+     * @param slot Any number of the app's choice.
+     * @param data Preset data, must not be in the preset section.
+     * @param size Up to kMaxPresetSize bytes.
+     * @return false if the store is full, not initialized or the flash write failed.
+     * @note Takes a flash write or two (tens of ms, a sector erase when the log moves), call from the UI loop.
+     */
+    bool Save(const uint8_t slot, const void *data, const size_t size);
+
+    /**
+     * @brief Stores a trivially copyable value (eg. FancyPotBank::Snapshot).
+     */
+    template <typename T>
+    bool Save(const uint8_t slot, const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= kMaxPresetSize);
+        return Save(slot, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Returns the data of the preset in the flash.
+     * @param slot The slot.
+     * @param size Set to the size of the data.
+     * @return nullptr if the slot is empty.
+     * @note Valid until the next Save() or Erase(), they can move the record.
+     */
+    const uint8_t *Find(const uint8_t slot, size_t &size) const;
+
+    /**
+     * @brief Loads a value stored with Save(), only if the stored size matches.
+     * @return false if the slot is empty or holds something else.
+     */
+    template <typename T>
+    bool Load(const uint8_t slot, T &value) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        size_t size = 0;
+        const uint8_t *data = Find(slot, size);
+        if (data == nullptr || size != sizeof(T))
+        {
+            return false;
+        }
+        std::memcpy(&value, data, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Returns true if the slot holds a preset.
+     */
+    bool Has(const uint8_t slot) const
+    {
+        size_t size = 0;
+        return Find(slot, size) != nullptr;
+    }
+
+    /**
+     * @brief Deletes the preset of the slot.
+     * @return false if the flash write failed.
+     */
+    bool Erase(const uint8_t slot);
+
+    /**
+     * @brief Returns the number of presets of all the apps.
+     */
+    size_t GetCount() const;
+
+private:
+    static constexpr uint32_t kSectorMagic = 0x7370326B; // "k2ps"
+    static constexpr uint32_t kRecordMagic = 0x7270326B; // "k2pr"
+    static constexpr size_t kAlignment = 16;
+    static constexpr size_t kPageSize = FlashWriter::kPageSize;
+
+    // The CRC32 covers everything after it (the rest of the header and the data)
+    struct SectorHeader
+    {
+        uint32_t magic;
+        uint32_t crc;
+        uint32_t sequence;
+        uint32_t reserved;
+    };
+
+    struct RecordHeader
+    {
+        uint32_t magic;
+        uint32_t crc;
+        uint16_t key;
+        uint16_t size; // 0 deletes the key
+        uint32_t reserved;
+    };
+
+    static_assert(sizeof(SectorHeader) == kAlignment && sizeof(RecordHeader) == kAlignment);
+
+    static constexpr size_t kMaxRecordSize = sizeof(RecordHeader) + kMaxPresetSize;
+
+    // All the presets fit with one sector free, another one being compacted and a record wasted at each sector end
+    static_assert(kMaxPresets * kMaxRecordSize <= (kSectors - 2) * (kSectorSize - sizeof(SectorHeader) - kMaxRecordSize));
+
+    struct Entry
+    {
+        uint16_t key;
+        uint16_t size;   // 0 for a deleted key, until the compaction drops it
+        uint32_t offset; // Of the record in the preset section
+    };
+
+    static constexpr size_t Align(const size_t size)
+    {
+        return (size + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    static const uint8_t *GetFlash(const uint32_t offset)
+    {
+        return reinterpret_cast<const uint8_t *>(PRESET_SECTION_BEGIN + offset);
+    }
+
+    uint16_t GetKey(const uint8_t slot) const
+    {
+        return static_cast<uint16_t>((app_id_ << 8) | slot);
+    }
+
+    static bool IsBlank(const uint8_t *data, const size_t size);
+    static bool ReadSectorHeader(const size_t sector, SectorHeader &header);
+    static bool ReadRecord(const uint32_t offset, RecordHeader &header);
+
+    // Returns entry_count_ if the key has no entry
+    size_t FindEntry(const uint16_t key) const;
+    void SetEntry(const uint16_t key, const uint16_t size, const uint32_t offset);
+    void ScanSector(const size_t sector, const bool head);
+    bool Append(const uint16_t key, const uint8_t *data, const size_t size);
+    bool ProgramRecord(const uint32_t offset, const uint16_t key, const uint8_t *data, const size_t size);
+    bool Advance();
+    bool Compact(const size_t sector);
+
+    bool initialized_ = false;
+    uint8_t app_id_ = 0;
+
+    // Log head, writes go to head_offset_ in the head_ sector
+    size_t head_ = 0;
+    uint32_t head_offset_ = 0;
+    uint32_t head_sequence_ = 0;
+
+    std::array<Entry, kMaxPresets> entries_{};
+    size_t entry_count_ = 0;
+
+    // Record being programmed (the data can't be read from the flash while it's written)
+    std::array<uint8_t, kMaxRecordSize> record_{};
+    std::array<uint8_t, kPageSize> page_{};
+};
+
+}
@@ -0,0 +1,193 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "common/config.hpp"
+#include "common/core/MultiCore.hpp"
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class SecondCorePipeline
+ * @ingroup core
+ * @brief Opt-in pipelined mode for apps which split the audio processing between the cores.
+ * @details Normally the second core processes the block core 0 is rendering right now,
+ *          so core 0 waits at the end of AudioLoop until the second core finishes the tail.
+ *          In the pipelined mode the second core processes the previous block (N-1)
+ *          while core 0 already renders block N into an extra stage buffer, so each core
+ *          gets the whole block period. The cost is one extra block of latency
+ *          (AUDIO_BUFFER_SIZE frames, about 1.1 ms).
+ *
+ *          The I2S driver stays double-buffered, the stage buffers here act as the third buffer.
+ *          They also keep a copy of the dry input, because the I2S input buffer of the previous
+ *          block is already being overwritten by the DMA.
+ *
+ *          Usage in AudioLoop (core 0):
+ *          @code
+ *          q15_t *render = pipeline_.Begin(input, output, size);
+ *          // ...point the second core to `output` and pipeline_.GetDryInput()...
+ *          MultiCore::BeginBlock(size);
+ *          MultiCore::PublishFrames(size); // Second core starts on block N-1
+ *          // ...render block N into `render`...
+ *          MultiCore::WaitForBlock();
+ *          @endcode
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class SecondCorePipeline
+{
+public:
+    /**
+     * @brief Clears the stage buffers (the first pipelined block will be silent).
+     */
+    void Reset()
+    {
+        for (auto &stage : stages_)
+        {
+            stage.input.fill(Q15_ZERO);
+            stage.output.fill(Q15_ZERO);
+        }
+        current_ = 0;
+    }
+
+    /**
+     * @brief Keeps the input of a block processed without the pipeline, Enter() crossfades from it. Called by core 0.
+     * @param input Input buffer of the current block (interleaved stereo).
+     * @param size Number of frames in the block.
+     */
+    void Track(const q15_t *input, size_t size)
+    {
+        Stage &last = stages_[current_];
+        for (size_t i = 0; i < 2 * size; i++)
+        {
+            last.input[i] = input[i];
+        }
+    }
+
+    /**
+     * @brief Starts the pipeline without a silent block. Called by core 0 before Begin().
+     * @details The pipeline adds a block of latency. The first block it outputs crossfades from the current input
+     *          to the previous one (see Track()), so it joins both the last output and the next block.
+     *          It stands in for a dry render, switch while the app fades through its dry signal.
+     * @param input Input buffer of the current block (interleaved stereo).
+     * @param size Number of frames in the block.
+     */
+    void Enter(const q15_t *input, size_t size)
+    {
+        Stage &previous = stages_[current_];
+        const q15_t step = Q15_MAX / static_cast<q15_t>(size);
+        q15_t fade = Q15_ZERO;
+        for (size_t i = 0; i < 2 * size; i += 2)
+        {
+            fade += step;
+            for (size_t ch = i; ch < i + 2; ch++)
+            {
+                previous.input[ch] = q15_add(q15_mult(input[ch], Q15_MAX - fade), q15_mult(previous.input[ch], fade));
+                previous.output[ch] = previous.input[ch];
+            }
+        }
+    }
+
+    /**
+     * @brief Stops the pipeline without dropping the block in flight. Called by core 0, the block then runs without it.
+     * @details The last rendered block never reaches the output. Use the returned crossfade from its dry input
+     *          to the current one as the dry signal of this block, so the output joins the last pipelined block.
+     *          Like Enter(), switch during a dry render.
+     * @param input Input buffer of the current block (interleaved stereo).
+     * @param size Number of frames in the block.
+     * @return Dry input for the current block (interleaved stereo), valid until the next Begin() or Track().
+     */
+    q15_t *Leave(const q15_t *input, size_t size)
+    {
+        Stage &last = stages_[current_];
+        const q15_t step = Q15_MAX / static_cast<q15_t>(size);
+        q15_t fade = Q15_ZERO;
+        for (size_t i = 0; i < 2 * size; i += 2)
+        {
+            fade += step;
+            for (size_t ch = i; ch < i + 2; ch++)
+            {
+                last.output[ch] = q15_add(q15_mult(last.input[ch], Q15_MAX - fade), q15_mult(input[ch], fade));
+            }
+        }
+        return last.output.data();
+    }
+
+    /**
+     * @brief Moves the previous block to the output and stores the current input. Called by core 0.
+     * @note Afterwards point the second core to `output` and GetDryInput(), then publish the whole block
+     *       with MultiCore::BeginBlock(size) and MultiCore::PublishFrames(size).
+     * @param input Input buffer of the current block (interleaved stereo).
+     * @param output Output buffer of the current block (interleaved stereo), the second core finishes the previous block here.
+     * @param size Number of frames in the block.
+     * @return Buffer core 0 should render the current block into.
+     */
+    q15_t *Begin(const q15_t *input, q15_t *output, size_t size)
+    {
+        Stage &previous = stages_[current_];
+        for (size_t i = 0; i < 2 * size; i++)
+        {
+            output[i] = previous.output[i];
+        }
+        dry_input_ = previous.input.data();
+
+        current_ ^= 1;
+        Stage &next = stages_[current_];
+        for (size_t i = 0; i < 2 * size; i++)
+        {
+            next.input[i] = input[i];
+        }
+        return next.output.data();
+    }
+
+    /**
+     * @brief Dry input matching the block the second core is processing.
+     * @return Interleaved stereo buffer.
+     */
+    q15_t *GetDryInput()
+    {
+        return dry_input_;
+    }
+
+private:
+    /**
+     * @brief One block rendered by core 0 together with its dry input.
+     */
+    struct Stage
+    {
+        std::array<q15_t, 2 * AUDIO_BUFFER_SIZE> input;
+        std::array<q15_t, 2 * AUDIO_BUFFER_SIZE> output;
+    };
+
+    std::array<Stage, 2> stages_ = {};
+    size_t current_ = 0;
+    q15_t *dry_input_ = nullptr;
+};
+
+}
@@ -0,0 +1,163 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "hardware/structs/systick.h"
+
+namespace kastle2
+{
+
+/**
+ * @class StageBalancer
+ * @ingroup core
+ * @brief Decides on which core a movable processing stage runs, from the measured load of both cores.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * An app splitting its audio between the cores (see MultiCore) has stages which could run on either side,
+ * eg. a filter after the mode processing. Each block the app measures the busy cycles of both cores and
+ * of the movable stage (Now() / Since()) and passes them to Commit(). Every kWindow blocks the averages
+ * are compared and the stage moves to the other core if that makes the busier core lighter by more than
+ * 1/2^kHysteresisShift, so it doesn't jump back and forth between two similar loads.
+ *
+ * The app moves the stage only at a block boundary where no core is processing it (eg. after WaitForBlock)
+ * and keeps the stage state (filters) the same, so the audio is the same on both cores.
+ *
+ * The cycles come from the SysTick free-running counter of each core, the same as the Profiler uses,
+ * so it works with and without PROFILE_AUDIO_LOOP.
+ */
+class StageBalancer
+{
+public:
+    /**
+     * @brief Number of blocks averaged for one decision (power of two).
+     */
+    static constexpr uint32_t kWindowShift = 5;
+    static constexpr uint32_t kWindow = 1 << kWindowShift;
+
+    /**
+     * @brief The stage moves if the busier core gets lighter by more than 1/2^kHysteresisShift of its load.
+     */
+    static constexpr uint32_t kHysteresisShift = 3;
+
+    /**
+     * @brief Starts the SysTick counter of the CALLING core, call once on each core measuring its load.
+     * @note Same setup as Profiler::InitCore(), left as it is if it runs already.
+     */
+    static void InitCore()
+    {
+        if ((systick_hw->csr & M0PLUS_SYST_CSR_ENABLE_BITS) == 0)
+        {
+            systick_hw->csr = 0;
+            systick_hw->rvr = kSysTickMask;
+            systick_hw->cvr = 0;
+            systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+        }
+    }
+
+    /**
+     * @brief Returns the cycle counter of the calling core, for Since().
+     */
+    static inline uint32_t Now()
+    {
+        return systick_hw->cvr;
+    }
+
+    /**
+     * @brief Returns the cycles elapsed since Now() returned the start (up to 2^24 cycles).
+     */
+    static inline uint32_t Since(const uint32_t start)
+    {
+        // SysTick counts down
+        return (start - systick_hw->cvr) & kSysTickMask;
+    }
+
+    /**
+     * @brief Places the stage on the core and drops the measurements.
+     * @param core The core to start with (0 or 1).
+     */
+    void Reset(const size_t core)
+    {
+        core_ = core;
+        sums_ = {};
+        stage_sum_ = 0;
+        blocks_ = 0;
+    }
+
+    /**
+     * @brief Returns the core the stage runs on.
+     */
+    size_t GetCore() const
+    {
+        return core_;
+    }
+
+    /**
+     * @brief Adds the measurements of a block, decides once per kWindow blocks. Call when both cores are done.
+     * @param core0_cycles Busy cycles of core 0 in the block, with the stage if it ran there.
+     * @param core1_cycles Busy cycles of core 1 in the block, with the stage if it ran there.
+     * @param stage_cycles Cycles of the stage in the block.
+     * @return True when the stage moved to the other core.
+     */
+    bool Commit(const uint32_t core0_cycles, const uint32_t core1_cycles, const uint32_t stage_cycles)
+    {
+        sums_[0] += core0_cycles;
+        sums_[1] += core1_cycles;
+        stage_sum_ += stage_cycles;
+        if (++blocks_ < kWindow)
+        {
+            return false;
+        }
+
+        const uint32_t here = static_cast<uint32_t>(sums_[core_] >> kWindowShift);
+        const uint32_t there = static_cast<uint32_t>(sums_[1 - core_] >> kWindowShift);
+        const uint32_t stage = std::min(static_cast<uint32_t>(stage_sum_ >> kWindowShift), here);
+        Reset(core_);
+
+        const uint32_t busiest = std::max(here, there);
+        const uint32_t moved = std::max(here - stage, there + stage);
+        if (moved + (busiest >> kHysteresisShift) < busiest)
+        {
+            core_ = 1 - core_;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    static constexpr uint32_t kSysTickMask = 0x00FFFFFF;
+
+    std::array<uint64_t, 2> sums_{};
+    uint64_t stage_sum_ = 0;
+    uint32_t blocks_ = 0;
+    size_t core_ = 1;
+};
+
+}
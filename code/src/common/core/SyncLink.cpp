@@ -0,0 +1,282 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "SyncLink.hpp"
+#include <algorithm>
+#include <cstring>
+#include "common/core/Kastle2.hpp"
+
+using namespace kastle2;
+
+namespace
+{
+
+bool Reached(const absolute_time_t time)
+{
+    return absolute_time_diff_us(time, get_absolute_time()) >= 0;
+}
+
+uint32_t UsToFrames(const uint32_t us)
+{
+    return static_cast<uint32_t>(static_cast<float>(us) * (SAMPLE_RATE / 1000000.0f));
+}
+
+}
+
+void SyncLink::SetRole(const Role role)
+{
+    role_ = role;
+    macros_.fill(kNoMacro);
+    pong_count_ = 0;
+    next_tempo_ = get_absolute_time();
+    next_ping_ = get_absolute_time();
+    round_trip_count_ = 0;
+    round_trip_index_ = 0;
+    latency_us_ = 0;
+    lead_us_ = 0;
+    master_period_us_ = 0;
+    locked_ = false;
+    lead_frames_ = role == Role::MASTER ? UsToFrames(kDefaultLeadUs) : 0;
+    UpdateDelay();
+}
+
+bool SyncLink::SendMacro(const uint8_t index, const uint16_t value)
+{
+    if (role_ != Role::MASTER || index >= kMacros || value > midi::Message::kValue14Max)
+    {
+        return false;
+    }
+    macros_[index] = value;
+    return true;
+}
+
+void SyncLink::Receive(const uint8_t *data, const size_t size, const bool start, const bool end)
+{
+    // F0, the header, the command, the type, at least a packed byte and F7, all in one chunk
+    constexpr size_t kPrefix = 1 + SysExTransfer::kHeader.size() + 2;
+    if (role_ == Role::OFF || !start || !end || size < kPrefix + 2 || size > kMaxMessageSize ||
+        data[size - 1] != kSysExEnd || data[kPrefix - 2] != kCommand ||
+        !std::equal(SysExTransfer::kHeader.begin(), SysExTransfer::kHeader.end(), data + 1))
+    {
+        return;
+    }
+    const uint32_t now_us = time_us_32();
+
+    // The payload, each group of 7 bytes starts with their top bits
+    std::array<uint8_t, sizeof(Pong)> payload{};
+    size_t payload_size = 0;
+    for (size_t i = kPrefix; i < size - 1;)
+    {
+        if (payload_size == payload.size())
+        {
+            return;
+        }
+        const uint8_t bits = data[i++];
+        for (size_t j = 0; j < 7 && i < size - 1 && payload_size < payload.size(); j++)
+        {
+            payload[payload_size++] = data[i++] | (((bits >> j) & 1) << 7);
+        }
+    }
+
+    const MessageType type = static_cast<MessageType>(data[kPrefix - 1]);
+    if (role_ == Role::MASTER)
+    {
+        if (type == MessageType::PING && payload_size == sizeof(Ping) && pong_count_ < pongs_.size())
+        {
+            Ping ping;
+            std::memcpy(&ping, payload.data(), sizeof(ping));
+            pongs_[pong_count_++] = {.ping_us = ping.sent_us, .received_us = now_us, .sent_us = 0};
+        }
+        return;
+    }
+
+    switch (type)
+    {
+    case MessageType::PONG:
+        if (payload_size == sizeof(Pong))
+        {
+            Pong pong;
+            std::memcpy(&pong, payload.data(), sizeof(pong));
+            ReceivePong(pong, now_us);
+        }
+        break;
+    case MessageType::TEMPO:
+        if (payload_size == sizeof(Tempo))
+        {
+            Tempo tempo;
+            std::memcpy(&tempo, payload.data(), sizeof(tempo));
+            master_period_us_ = tempo.pulse_period_us;
+            lead_us_ = tempo.lead_us;
+            locked_ = true;
+            timeout_ = make_timeout_time_ms(kTimeoutMs);
+            UpdateDelay();
+        }
+        break;
+    case MessageType::MACRO:
+        if (payload_size == sizeof(Macro) && macro_callback_ != nullptr)
+        {
+            Macro macro;
+            std::memcpy(&macro, payload.data(), sizeof(macro));
+            if (macro.index < kMacros && macro.value <= midi::Message::kValue14Max)
+            {
+                macro_callback_(macro.index, macro.value);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void SyncLink::ReceivePong(const Pong &pong, const uint32_t now_us)
+{
+    // Another follower's answer, or one to an older ping
+    if (pong.ping_us != ping_us_)
+    {
+        return;
+    }
+    const uint32_t total = now_us - pong.ping_us;
+    const uint32_t turnaround = pong.sent_us - pong.received_us;
+    if (turnaround > total)
+    {
+        return;
+    }
+    round_trips_[round_trip_index_] = total - turnaround;
+    round_trip_index_ = (round_trip_index_ + 1) % round_trips_.size();
+    round_trip_count_ = std::min(round_trip_count_ + 1, round_trips_.size());
+
+    // The fastest one waited the least in the queues and the USB frames
+    latency_us_ = *std::min_element(round_trips_.begin(), round_trips_.begin() + round_trip_count_) / 2;
+    UpdateDelay();
+}
+
+void SyncLink::UpdateDelay()
+{
+    // The pulse arrives lead - latency before its output time, it fires kMidiLatencyFrames after its arrival
+    // and the block leaves the codec AUDIO_BUFFER_SIZE later
+    uint32_t delay = 0;
+    if (role_ == Role::FOLLOWER && locked_ && lead_us_ > latency_us_)
+    {
+        const uint32_t frames = UsToFrames(lead_us_ - latency_us_);
+        constexpr uint32_t kFixedFrames = Kastle2::kMidiLatencyFrames + AUDIO_BUFFER_SIZE;
+        delay = frames > kFixedFrames ? frames - kFixedFrames : 0;
+    }
+    delay_frames_ = delay;
+}
+
+void SyncLink::Process(midi::Handler &midi, const uint32_t pulse_period_us)
+{
+    switch (role_)
+    {
+    case Role::OFF:
+        return;
+    case Role::MASTER:
+    {
+        // A full output keeps the rest for the next pass
+        size_t sent = 0;
+        while (sent < pong_count_)
+        {
+            pongs_[sent].sent_us = time_us_32();
+            if (!Send(midi, MessageType::PONG, &pongs_[sent], sizeof(Pong)))
+            {
+                break;
+            }
+            sent++;
+        }
+        std::move(pongs_.begin() + sent, pongs_.begin() + pong_count_, pongs_.begin());
+        pong_count_ -= sent;
+
+        if (Reached(next_tempo_))
+        {
+            const Tempo tempo = {.pulse_period_us = pulse_period_us, .lead_us = kDefaultLeadUs};
+            if (Send(midi, MessageType::TEMPO, &tempo, sizeof(tempo)))
+            {
+                next_tempo_ = make_timeout_time_ms(kTempoIntervalMs);
+            }
+        }
+
+        for (size_t i = 0; i < kMacros; i++)
+        {
+            if (macros_[i] == kNoMacro)
+            {
+                continue;
+            }
+            const Macro macro = {.index = static_cast<uint8_t>(i), .reserved = 0, .value = macros_[i]};
+            if (!Send(midi, MessageType::MACRO, &macro, sizeof(macro)))
+            {
+                break;
+            }
+            macros_[i] = kNoMacro;
+        }
+        return;
+    }
+    case Role::FOLLOWER:
+        if (Reached(next_ping_))
+        {
+            const Ping ping = {.sent_us = time_us_32()};
+            if (Send(midi, MessageType::PING, &ping, sizeof(ping)))
+            {
+                ping_us_ = ping.sent_us;
+                next_ping_ = make_timeout_time_ms(kPingIntervalMs);
+            }
+        }
+        if (locked_ && Reached(timeout_))
+        {
+            locked_ = false;
+            master_period_us_ = 0;
+            UpdateDelay();
+        }
+        return;
+    }
+}
+
+bool SyncLink::Send(midi::Handler &midi, const MessageType type, const void *payload, const size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(payload);
+    std::array<uint8_t, kMaxMessageSize> message;
+    size_t message_size = 0;
+    message[message_size++] = kSysExStart;
+    for (const uint8_t byte : SysExTransfer::kHeader)
+    {
+        message[message_size++] = byte;
+    }
+    message[message_size++] = kCommand;
+    message[message_size++] = static_cast<uint8_t>(type);
+    for (size_t i = 0; i < size; i += 7)
+    {
+        const size_t group = std::min<size_t>(7, size - i);
+        uint8_t bits = 0;
+        for (size_t j = 0; j < group; j++)
+        {
+            bits |= (bytes[i + j] >> 7) << j;
+        }
+        message[message_size++] = bits;
+        for (size_t j = 0; j < group; j++)
+        {
+            message[message_size++] = bytes[i + j] & 0x7F;
+        }
+    }
+    message[message_size++] = kSysExEnd;
+    return midi.SendSysEx(message.data(), message_size);
+}
@@ -0,0 +1,279 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "pico/stdlib.h"
+#include "common/config.hpp"
+#include "common/core/SysExTransfer.hpp"
+#include "common/core/midi/Handler.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class SyncLink
+ * @ingroup core
+ * @brief Keeps several units phase locked over MIDI: the master's MIDI clock leads its output by a fixed time,
+ *        each follower delays the pulses by the rest of it after its measured link latency.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The master queues its MIDI clock pulses kDefaultLeadUs before their output time (Clock::HandleMidiOutClock),
+ * the followers lock their MidiClockSource DLL to them as to any MIDI clock and fire each pulse
+ * lead - latency after its arrival, so the pulses of the whole rack leave the codecs at the master's output time.
+ * A chain of units (a USB host forwarding the clock) doesn't add up the skews, each follower measures its own link.
+ *
+ * The messages are SysEx, F0, SysExTransfer::kHeader, kCommand, the MessageType, the payload packed to 7 bits
+ * and F7 (as SysExTransfer), each fits one midi::Handler SysEx chunk.
+ * - PING from a follower with its time, each kPingIntervalMs
+ * - PONG from the master with the follower's time, its receive and send times. The follower keeps the fastest
+ *   round trip of the last kPingWindow pings, half of it is the link latency (the way there is the way back)
+ * - TEMPO from the master each kTempoIntervalMs, the pulse period and the lead
+ * - MACRO from the master, an app parameter (SendMacro()) for the followers' SetMacroCallback()
+ *
+ * The TRS has no MIDI output, a follower answers over USB only. A follower without the answers (TRS only)
+ * assumes no latency. A reset of the master reaches the followers with the lead late for the first pulse.
+ *
+ * Kastle2::base sets the role from the clock: a follower while synced to the MIDI clock, the master while it
+ * sends the MIDI clock and off with the MIDI sync disabled (Memory::SyncSetting) or the sync jack passed through.
+ * The follower's MidiClockSource locks to GetMasterPulsePeriodUs() from the first pulse, Kastle2 injects
+ * the received macros as the NRPNs of their number.
+ */
+class SyncLink
+{
+public:
+    /**
+     * @brief Command byte after SysExTransfer::kHeader, SysExTransfer ignores it.
+     */
+    static constexpr uint8_t kCommand = 'S';
+
+    /**
+     * @brief How long the master's MIDI clock leads its output, the followers' link latency has to fit it.
+     * @details The follower needs the latency, kMidiLatencyFrames and its output block in it.
+     */
+    static constexpr uint32_t kDefaultLeadUs = 10000;
+
+    static constexpr uint32_t kPingIntervalMs = 500;
+    static constexpr size_t kPingWindow = 8;
+    static constexpr uint32_t kTempoIntervalMs = 250;
+
+    /**
+     * @brief Without a TEMPO for this long the follower stops delaying the pulses.
+     */
+    static constexpr uint32_t kTimeoutMs = 2000;
+
+    /**
+     * @brief Number of the parameter macros.
+     */
+    static constexpr size_t kMacros = 16;
+
+    enum class Role
+    {
+        OFF,      ///< Plain MIDI clock
+        MASTER,   ///< Leads the MIDI clock, answers the pings, sends the tempo and the macros
+        FOLLOWER, ///< Pings the master, delays the MIDI clock pulses by the lead after the latency
+    };
+
+    enum class MessageType : uint8_t
+    {
+        PING = 'p',
+        PONG = 'o',
+        TEMPO = 't',
+        MACRO = 'm',
+    };
+
+    struct __attribute__((packed)) Ping
+    {
+        uint32_t sent_us; ///< Follower's time_us_32()
+    };
+
+    struct __attribute__((packed)) Pong
+    {
+        uint32_t ping_us;     ///< Ping::sent_us
+        uint32_t received_us; ///< Master's time at the ping
+        uint32_t sent_us;     ///< Master's time at the answer
+    };
+
+    struct __attribute__((packed)) Tempo
+    {
+        uint32_t pulse_period_us; ///< MIDI clock pulse period, 4 fractional bits, 0 while stopped
+        uint32_t lead_us;         ///< The master's lead
+    };
+
+    struct __attribute__((packed)) Macro
+    {
+        uint8_t index;
+        uint8_t reserved;
+        uint16_t value; ///< 14-bit value
+    };
+
+    static_assert(sizeof(Pong) == 12 && sizeof(Tempo) == 8 && sizeof(Macro) == 4);
+
+    /**
+     * @brief Receives the macros of the master, called from the UI loop.
+     * @param index Macro index (less than kMacros)
+     * @param value 14-bit value
+     */
+    typedef void (*MacroCallback)(uint8_t index, uint16_t value);
+
+    /**
+     * @brief Sets the role of this unit, the link starts again.
+     */
+    void SetRole(const Role role);
+
+    Role GetRole() const
+    {
+        return role_;
+    }
+
+    /**
+     * @brief Sets the follower's callback of the macros, nullptr ignores them.
+     */
+    void SetMacroCallback(MacroCallback callback)
+    {
+        macro_callback_ = callback;
+    }
+
+    /**
+     * @brief Sends a macro to the followers with the next Process(), master only.
+     * @details Only the latest value of each macro waits, as the CCs of midi::Handler.
+     * @param index Macro index (less than kMacros)
+     * @param value 14-bit value
+     * @return False for an invalid macro or when not the master
+     */
+    bool SendMacro(const uint8_t index, const uint16_t value);
+
+    /**
+     * @brief Takes a chunk of a received SysEx message, the midi::Handler SysEx sink.
+     * @details The master's answers to the pings go with the next Process().
+     */
+    void Receive(const uint8_t *data, const size_t size, const bool start, const bool end);
+
+    /**
+     * @brief Sends the pings, the tempo and the macros, called from the UI loop by Kastle2.
+     * @param midi Sends the messages.
+     * @param pulse_period_us The master's MIDI clock pulse period (4 fractional bits), 0 while stopped.
+     */
+    void Process(midi::Handler &midi, const uint32_t pulse_period_us);
+
+    /**
+     * @brief How far ahead the master's MIDI clock pulses go, read by the audio callback (Clock).
+     * @return Frames at SAMPLE_RATE, 0 when not the master
+     */
+    uint32_t GetLeadFrames() const
+    {
+        return lead_frames_;
+    }
+
+    /**
+     * @brief GetLeadFrames() in microseconds.
+     */
+    uint32_t GetLeadUs() const
+    {
+        return lead_frames_ > 0 ? kDefaultLeadUs : 0;
+    }
+
+    /**
+     * @brief How much later the follower fires the MIDI clock pulses, read by the audio callback (MidiClockSource).
+     * @return Frames at SAMPLE_RATE, 0 when not a locked follower
+     */
+    uint32_t GetPulseDelayFrames() const
+    {
+        return delay_frames_;
+    }
+
+    /**
+     * @brief The follower's link latency, half of the fastest round trip of the window.
+     * @return Microseconds, 0 until measured
+     */
+    uint32_t GetLatencyUs() const
+    {
+        return latency_us_;
+    }
+
+    /**
+     * @brief Whether the follower gets the master's tempo.
+     */
+    bool IsLocked() const
+    {
+        return locked_;
+    }
+
+    /**
+     * @brief The master's tempo as the follower got it.
+     * @return MIDI clock pulse period in microseconds, 4 fractional bits, 0 while stopped or unlocked
+     */
+    uint32_t GetMasterPulsePeriodUs() const
+    {
+        return locked_ ? master_period_us_ : 0;
+    }
+
+private:
+    static constexpr uint8_t kSysExStart = 0xF0;
+    static constexpr uint8_t kSysExEnd = 0xF7;
+
+    // Largest message: F0, the header, the command, the type, the packed Pong and F7
+    static constexpr size_t kMaxMessageSize = 1 + SysExTransfer::kHeader.size() + 2 + SysExTransfer::PackedSize(sizeof(Pong)) + 1;
+    static_assert(kMaxMessageSize <= midi::Handler::kSysExChunkSize);
+
+    static constexpr uint16_t kNoMacro = UINT16_MAX;
+
+    // Pings of the followers in one UI loop pass, the others ping again
+    static constexpr size_t kPendingPongs = 4;
+
+    bool Send(midi::Handler &midi, const MessageType type, const void *payload, const size_t size);
+    void ReceivePong(const Pong &pong, const uint32_t now_us);
+    void UpdateDelay();
+
+    Role role_ = Role::OFF;
+    MacroCallback macro_callback_ = nullptr;
+
+    // Master
+    std::array<uint16_t, kMacros> macros_{}; ///< Waiting values, kNoMacro if none
+    absolute_time_t next_tempo_;
+    std::array<Pong, kPendingPongs> pongs_{}; ///< Pings waiting for their answers
+    size_t pong_count_ = 0;
+
+    // Follower
+    absolute_time_t next_ping_;
+    absolute_time_t timeout_;
+    uint32_t ping_us_ = 0; ///< Time of the last ping, its pong is the one echoing it
+    std::array<uint32_t, kPingWindow> round_trips_{};
+    size_t round_trip_count_ = 0;
+    size_t round_trip_index_ = 0;
+    uint32_t latency_us_ = 0;
+    uint32_t lead_us_ = 0;
+    volatile uint32_t master_period_us_ = 0; ///< Read by the audio callback (MidiClockSource) too
+    volatile bool locked_ = false;
+
+    // Audio callback
+    volatile uint32_t lead_frames_ = 0;
+    volatile uint32_t delay_frames_ = 0;
+};
+
+}
@@ -0,0 +1,337 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "SysExTransfer.hpp"
+#include <algorithm>
+#include <cstring>
+#include "hardware/watchdog.h"
+#include "common/config.hpp"
+#include "common/core/Crc.hpp"
+#include "tusb.h"
+
+using namespace kastle2;
+
+namespace
+{
+
+// Time for the last answer to leave before the reboot
+constexpr uint32_t kRebootDelayMs = 100;
+
+constexpr uint8_t kSysExStart = 0xF0;
+constexpr uint8_t kSysExEnd = 0xF7;
+
+}
+
+void SysExTransfer::SetEnabled(const bool enabled)
+{
+    enabled_ = enabled;
+    if (enabled_)
+    {
+        FlashWriter::Enable();
+    }
+}
+
+void SysExTransfer::Receive(const uint8_t *data, const size_t size, const bool start, const bool end)
+{
+    if (!enabled_)
+    {
+        return;
+    }
+
+    size_t i = 0;
+    if (start)
+    {
+        // A new request while the last one waits, the sender times out and repeats it
+        if (pending_)
+        {
+            frame_state_ = FrameState::IGNORED;
+            return;
+        }
+        frame_state_ = FrameState::HEADER;
+        header_received_ = 0;
+        frame_size_ = 0;
+        group_index_ = 0;
+        // Skip the 0xF0
+        i = 1;
+    }
+
+    // The 0xF7 is the last byte of a complete message, a message cut by another status has none
+    size_t data_end = size;
+    const bool complete = end && size > 0 && data[size - 1] == kSysExEnd;
+    if (complete)
+    {
+        data_end--;
+    }
+
+    for (; i < data_end && frame_state_ != FrameState::IGNORED; i++)
+    {
+        const uint8_t byte = data[i];
+        if (frame_state_ == FrameState::HEADER)
+        {
+            if (header_received_ < kHeader.size())
+            {
+                if (byte != kHeader[header_received_])
+                {
+                    frame_state_ = FrameState::IGNORED;
+                }
+                header_received_++;
+                continue;
+            }
+            command_ = static_cast<Command>(byte);
+            if (!(command_ == Command::INFO || command_ == Command::BLOCK ||
+                  command_ == Command::PRESET || command_ == Command::END))
+            {
+                frame_state_ = FrameState::IGNORED;
+                continue;
+            }
+            if (!IsActive())
+            {
+                Begin();
+            }
+            frame_state_ = FrameState::PAYLOAD;
+            continue;
+        }
+
+        // The payload, each group of 7 bytes starts with their top bits
+        if (group_index_ == 0)
+        {
+            group_bits_ = byte;
+        }
+        else
+        {
+            if (frame_size_ == kFrameSize)
+            {
+                frame_state_ = FrameState::IGNORED;
+                continue;
+            }
+            frame_[frame_size_++] = byte | (((group_bits_ >> (group_index_ - 1)) & 1) << 7);
+        }
+        group_index_ = (group_index_ + 1) % 8;
+    }
+
+    if (end)
+    {
+        if (complete && frame_state_ == FrameState::PAYLOAD)
+        {
+            pending_ = true;
+        }
+        frame_state_ = FrameState::IGNORED;
+    }
+}
+
+void SysExTransfer::Process(midi::Handler &midi, PresetStore &presets)
+{
+    if (!enabled_ || !IsActive())
+    {
+        return;
+    }
+
+    if (pending_)
+    {
+        timeout_ = make_timeout_time_ms(kTimeoutMs);
+        Execute(midi, presets);
+        pending_ = false;
+    }
+    else if (absolute_time_diff_us(timeout_, get_absolute_time()) > 0)
+    {
+        End();
+    }
+}
+
+void SysExTransfer::Begin()
+{
+    frame_ = std::make_unique<uint8_t[]>(kFrameSize);
+    sector_ = std::make_unique<uint8_t[]>(kSectorSize);
+    next_offset_ = kNoOffset;
+    rewinding_ = false;
+    written_ = false;
+    timeout_ = make_timeout_time_ms(kTimeoutMs);
+}
+
+void SysExTransfer::End()
+{
+    frame_.reset();
+    sector_.reset();
+    frame_state_ = FrameState::IGNORED;
+    pending_ = false;
+}
+
+void SysExTransfer::Execute(midi::Handler &midi, PresetStore &presets)
+{
+    switch (command_)
+    {
+    case Command::INFO:
+        // Decides whether the audio keeps running during the writes of this session
+        FlashWriter::CheckAudioPath();
+        Reply(midi, Status::OK, kBlockSize | (kWindow << 16), USER_DATA_SECTION_SIZE, kMaxPresetSize);
+        break;
+
+    case Command::BLOCK:
+        ExecuteBlock(midi);
+        break;
+
+    case Command::PRESET:
+    {
+        PresetHeader header;
+        std::memcpy(&header, frame_.get(), sizeof(header));
+        const uint8_t *data = frame_.get() + sizeof(header);
+        if (frame_size_ < sizeof(header) || header.size > kMaxPresetSize || frame_size_ != sizeof(header) + header.size)
+        {
+            Reply(midi, Status::BAD_REQUEST, header.slot);
+            break;
+        }
+        if (Crc::Crc32(data, header.size) != header.crc)
+        {
+            Reply(midi, Status::BAD_CRC, header.slot);
+            break;
+        }
+        const bool saved = presets.Save(header.slot, data, header.size);
+        Reply(midi, saved ? Status::OK : Status::WRITE_FAILED, header.slot);
+        break;
+    }
+
+    case Command::END:
+    {
+        uint32_t reboot = 0;
+        std::memcpy(&reboot, frame_.get(), std::min(frame_size_, sizeof(reboot)));
+        Reply(midi, Status::OK);
+        const bool restart = reboot != 0 && written_;
+        End();
+        if (restart)
+        {
+            // The app has the old data mapped (sample index etc.), start over with the new one
+            watchdog_reboot(0, 0, kRebootDelayMs);
+            while (true)
+            {
+                tud_task();
+                midi.Process();
+            }
+        }
+        break;
+    }
+    }
+}
+
+void SysExTransfer::ExecuteBlock(midi::Handler &midi)
+{
+    BlockHeader header;
+    std::memcpy(&header, frame_.get(), sizeof(header));
+    const uint8_t *data = frame_.get() + sizeof(header);
+    if (frame_size_ != sizeof(header) + kBlockSize || header.offset % kBlockSize != 0 ||
+        static_cast<uint64_t>(header.offset) + kBlockSize > USER_DATA_SECTION_SIZE)
+    {
+        Reply(midi, Status::BAD_REQUEST, header.offset);
+        return;
+    }
+
+    // After an error only the block to go back to counts, the ones in flight after the bad one are dropped
+    const uint32_t sector_offset = header.offset - header.offset % kSectorSize;
+    if (rewinding_ && header.offset != next_offset_)
+    {
+        return;
+    }
+    if (Crc::Crc32(data, kBlockSize) != header.crc)
+    {
+        rewinding_ = true;
+        next_offset_ = next_offset_ == kNoOffset ? sector_offset : next_offset_;
+        Reply(midi, Status::BAD_CRC, next_offset_);
+        return;
+    }
+    // A sector starts with its first block
+    if (header.offset == sector_offset)
+    {
+        next_offset_ = sector_offset;
+    }
+    if (header.offset != next_offset_)
+    {
+        rewinding_ = true;
+        next_offset_ = next_offset_ == kNoOffset ? sector_offset : next_offset_;
+        Reply(midi, Status::OUT_OF_ORDER, next_offset_);
+        return;
+    }
+    rewinding_ = false;
+
+    std::memcpy(sector_.get() + header.offset % kSectorSize, data, kBlockSize);
+    next_offset_ += kBlockSize;
+    if (next_offset_ % kSectorSize != 0)
+    {
+        // Within the window, answered with the whole sector
+        return;
+    }
+
+    const uint8_t *flash = reinterpret_cast<const uint8_t *>(USER_DATA_SECTION_BEGIN) + sector_offset;
+    // Also makes sending a sector again after a lost answer harmless
+    if (std::memcmp(flash, sector_.get(), kSectorSize) == 0)
+    {
+        Reply(midi, Status::UNCHANGED, next_offset_, Crc::Compute(flash, kSectorSize));
+        return;
+    }
+    const bool written = FlashWriter::WriteUserDataSector(sector_offset, sector_.get());
+    written_ = written_ || written;
+    if (!written)
+    {
+        // The whole sector again
+        next_offset_ = sector_offset;
+    }
+    Reply(midi, written ? Status::OK : Status::WRITE_FAILED, next_offset_, Crc::Compute(flash, kSectorSize));
+}
+
+void SysExTransfer::Reply(midi::Handler &midi, const Status status, const uint32_t value0, const uint32_t value1,
+                          const uint32_t value2)
+{
+    const Response response = {
+        .command = command_,
+        .status = status,
+        .reserved = {0, 0},
+        .value = {value0, value1, value2},
+    };
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&response);
+
+    std::array<uint8_t, 1 + kHeader.size() + 1 + PackedSize(sizeof(Response)) + 1> message;
+    size_t size = 0;
+    message[size++] = kSysExStart;
+    for (const uint8_t byte : kHeader)
+    {
+        message[size++] = byte;
+    }
+    message[size++] = kReply;
+    for (size_t i = 0; i < sizeof(Response); i += 7)
+    {
+        const size_t group = std::min<size_t>(7, sizeof(Response) - i);
+        uint8_t bits = 0;
+        for (size_t j = 0; j < group; j++)
+        {
+            bits |= (bytes[i + j] >> 7) << j;
+        }
+        message[size++] = bits;
+        for (size_t j = 0; j < group; j++)
+        {
+            message[size++] = bytes[i + j] & 0x7F;
+        }
+    }
+    message[size++] = kSysExEnd;
+
+    // A lost answer (full output) is recovered by the sender's timeout
+    midi.SendSysEx(message.data(), size);
+}
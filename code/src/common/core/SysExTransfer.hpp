@@ -0,0 +1,193 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "pico/stdlib.h"
+#include "common/core/FlashWriter.hpp"
+#include "common/core/PresetStore.hpp"
+#include "common/core/midi/Handler.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class SysExTransfer
+ * @ingroup core
+ * @brief Writes the user data (eg. the k2wb sample banks) and the presets received as MIDI SysEx.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * For the setups connected only by MIDI (TRS or a USB MIDI host), driven by scripts/sysex_upload.py.
+ * The messages come from the midi::Handler SysEx sink and are decoded as their chunks arrive,
+ * the writes are done by FlashWriter from Process() in the UI loop.
+ *
+ * Each message is F0, kHeader, a Command byte, the payload packed to 7 bits and F7. The payload is a
+ * header struct and the data, little endian. The packing takes groups of 7 bytes and sends a byte with
+ * their top bits first (bit 0 for the first byte), then the 7 bytes without them.
+ * - INFO starts a session, answered with the block size and the window, the user data size and the preset size
+ * - BLOCK sends kBlockSize bytes of a sector, the sectors are sent block by block from their start. Up to kWindow
+ *   blocks (a whole sector) go without waiting, the last one is answered after the sector is written, with
+ *   the offset to continue from. A bad CRC or a missing block is answered right away with the offset to go back
+ *   to, the blocks in flight after it are dropped without an answer
+ * - PRESET stores the data in a slot of the running app's presets (Kastle2::presets)
+ * - END ends the session, a non zero value reboots the device if any sector was written
+ *
+ * The answers (Response, packed the same way after kHeader and kReply) go to the USB MIDI only, the TRS has
+ * no MIDI output. A sender connected by TRS only paces itself (--paced): it waits kSectorWriteMs after each sector.
+ * A lost answer is recovered by sending the sector again, an unchanged sector is not written twice.
+ *
+ * Disabled by default, an app enables it with Kastle2::sysex_transfer.SetEnabled(true) before starting the second core.
+ */
+class SysExTransfer
+{
+public:
+    static constexpr std::array<uint8_t, 3> kHeader{0x7D, 'K', '2'}; ///< Non-commercial manufacturer ID, "K2"
+    static constexpr uint8_t kReply = 'R';
+    static constexpr size_t kSectorSize = FlashWriter::kSectorSize;
+    static constexpr size_t kBlockSize = 256;
+    static constexpr size_t kWindow = kSectorSize / kBlockSize;
+    static constexpr size_t kMaxPresetSize = PresetStore::kMaxPresetSize;
+    static constexpr uint32_t kTimeoutMs = 5000;
+    static constexpr uint32_t kSectorWriteMs = 200;
+
+    enum class Command : uint8_t
+    {
+        INFO = 'I',   ///< value: block size | window << 16, user data size, max preset size
+        BLOCK = 'B',  ///< BlockHeader and the data, value: offset of the next block, CRC32 of the written sector
+        PRESET = 'P', ///< PresetHeader and the data, value: slot
+        END = 'E',    ///< uint32_t, non zero reboots the device
+    };
+
+    enum class Status : uint8_t
+    {
+        OK,
+        UNCHANGED,    ///< The sector already had the data, not written
+        BAD_REQUEST,  ///< Unknown command, wrong size, offset out of the user data
+        BAD_CRC,      ///< The received data don't match their CRC, value: offset to go back to
+        WRITE_FAILED, ///< The flash can't be written now or didn't read back the same
+        OUT_OF_ORDER, ///< Not the next block of the sector, value: offset to go back to
+    };
+
+    struct __attribute__((packed)) BlockHeader
+    {
+        uint32_t offset; ///< In the user data, a multiple of kBlockSize
+        uint32_t crc;    ///< CRC32 of the block data
+    };
+
+    struct __attribute__((packed)) PresetHeader
+    {
+        uint8_t slot;
+        uint8_t reserved[3];
+        uint32_t size; ///< Up to kMaxPresetSize
+        uint32_t crc;  ///< CRC32 of the preset data
+    };
+
+    struct __attribute__((packed)) Response
+    {
+        Command command;
+        Status status;
+        uint8_t reserved[2];
+        uint32_t value[3];
+    };
+
+    static_assert(sizeof(BlockHeader) == 8 && sizeof(PresetHeader) == 12 && sizeof(Response) == 16);
+
+    /**
+     * @brief Number of bytes of the data packed to 7 bits.
+     */
+    static constexpr size_t PackedSize(const size_t size)
+    {
+        return size + (size + 6) / 7;
+    }
+
+    /**
+     * @brief Enables the transfers (and the flash writes).
+     * @note Call before the second core starts, see FlashWriter::Enable().
+     */
+    void SetEnabled(const bool enabled);
+
+    /**
+     * @brief Returns true during a transfer session.
+     */
+    bool IsActive() const
+    {
+        return frame_ != nullptr;
+    }
+
+    /**
+     * @brief Takes a chunk of a received SysEx message, the midi::Handler SysEx sink.
+     */
+    void Receive(const uint8_t *data, const size_t size, const bool start, const bool end);
+
+    /**
+     * @brief Executes the received request, called from the UI loop by Kastle2.
+     * @param midi Sends the answers.
+     * @param presets Store of the PRESET requests.
+     */
+    void Process(midi::Handler &midi, PresetStore &presets);
+
+private:
+    enum class FrameState
+    {
+        IGNORED, ///< Not for us, cut or too long
+        HEADER,
+        PAYLOAD,
+    };
+
+    static constexpr size_t kFrameSize = sizeof(PresetHeader) + kMaxPresetSize;
+    static constexpr uint32_t kNoOffset = UINT32_MAX;
+
+    bool enabled_ = false;
+
+    // Message being received, the payload unpacked to frame_
+    FrameState frame_state_ = FrameState::IGNORED;
+    size_t header_received_ = 0;
+    Command command_ = Command::INFO;
+    size_t frame_size_ = 0;
+    uint8_t group_index_ = 0;
+    uint8_t group_bits_ = 0;
+    bool pending_ = false;
+
+    // Session, the buffers are allocated for it only
+    std::unique_ptr<uint8_t[]> frame_;
+    std::unique_ptr<uint8_t[]> sector_;
+    uint32_t next_offset_ = kNoOffset;
+    bool rewinding_ = false;
+    bool written_ = false;
+    absolute_time_t timeout_;
+
+    void Begin();
+    void End();
+    void Execute(midi::Handler &midi, PresetStore &presets);
+    void ExecuteBlock(midi::Handler &midi);
+    void Reply(midi::Handler &midi, const Status status, const uint32_t value0 = 0, const uint32_t value1 = 0,
+               const uint32_t value2 = 0);
+};
+
+}
@@ -0,0 +1,219 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "common/EnumTools.hpp"
+#include "common/debug/Trace.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class UiScheduler
+ * @ingroup core
+ * @brief Cooperative scheduler of the UI core background work (USB, MIDI, I2C, buttons, debug).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Each task has a period and a relative deadline in microseconds. A task is released when its period
+ * has passed since the last release, or earlier when one of its wake events was posted by an interrupt.
+ * The released tasks run earliest deadline first, the order of Add() breaks the ties.
+ * Period 0 releases the task in every Process().
+ *
+ * When nothing is due, Idle() sleeps the core with `__wfe` until an interrupt or a posted event.
+ * Post() ends with `__sev`, so it also wakes the other core. The ADC posts Event::ADC after every pass
+ * over the inputs (~0.3 ms), which bounds the sleep, so the periods should be longer than that.
+ *
+ * Kastle2::ReadInputs() runs it until the inputs are fresh, see Kastle2::Init() for the tasks.
+ */
+class UiScheduler
+{
+public:
+    /**
+     * @brief Task function, called with the context given to Add().
+     */
+    using Callback = void (*)(void *context);
+
+    /**
+     * @brief Maximum number of tasks.
+     */
+    static constexpr size_t kMaxTasks = 16;
+
+    /**
+     * @brief Events posted from the interrupts.
+     */
+    enum class Event
+    {
+        ADC,  ///< A pass over all the analog inputs finished
+        USB,  ///< USB controller interrupt
+        UART, ///< MIDI UART received data
+        MIDI_OUT, ///< A scheduled MIDI output is due (midi::Handler timer alarm)
+        COUNT
+    };
+
+    /**
+     * @brief Wake mask of an event for Add(), masks can be combined with `|`.
+     * @param event The event.
+     * @return Mask with the event bit set.
+     */
+    static constexpr uint32_t Wake(const Event event)
+    {
+        return 1u << static_cast<uint32_t>(event);
+    }
+
+    /**
+     * @brief Posts an event, the tasks waiting for it are released in the next Process(). Safe to call from interrupts.
+     * @param event The event.
+     */
+    static inline void Post(const Event event)
+    {
+        pending_[event] = true;
+        __sev();
+    }
+
+    /**
+     * @brief Registers a task, it is released in the first Process().
+     * @param callback Function to call.
+     * @param context Passed to the callback.
+     * @param period_us Longest time between two releases (0 = every Process()).
+     * @param deadline_us Time after the release the task should run by, orders the released tasks.
+     * @param wake Events releasing the task before its period (see Wake()).
+     * @return False if there is no space left.
+     */
+    bool Add(const Callback callback, void *context, const uint32_t period_us, const uint32_t deadline_us, const uint32_t wake = 0)
+    {
+        if (count_ >= kMaxTasks)
+        {
+            return false;
+        }
+        tasks_[count_] = Task{.callback = callback,
+                              .context = context,
+                              .period_us = period_us,
+                              .deadline_us = deadline_us,
+                              .wake = wake,
+                              .next_release = time_us_32(),
+                              .deadline = 0,
+                              .released = false};
+        count_++;
+        return true;
+    }
+
+    /**
+     * @brief Releases the due tasks and runs all the released ones, earliest deadline first.
+     * @note Events posted while the tasks run are handled in the next call.
+     */
+    void Process()
+    {
+        uint32_t events = 0;
+        for (auto event : EnumRange<Event>())
+        {
+            if (pending_[event])
+            {
+                pending_[event] = false;
+                events |= Wake(event);
+            }
+        }
+
+        const uint32_t now = time_us_32();
+        for (size_t i = 0; i < count_; i++)
+        {
+            Task &task = tasks_[i];
+            if (!task.released && ((task.wake & events) || static_cast<int32_t>(now - task.next_release) >= 0))
+            {
+                task.released = true;
+                task.deadline = now + task.deadline_us;
+                task.next_release = now + task.period_us;
+            }
+        }
+
+        while (true)
+        {
+            // Deadlines are compared relative to now, so the wrap of the timer doesn't matter
+            Task *next = nullptr;
+            for (size_t i = 0; i < count_; i++)
+            {
+                Task &task = tasks_[i];
+                if (task.released && (next == nullptr || static_cast<int32_t>(task.deadline - next->deadline) < 0))
+                {
+                    next = &task;
+                }
+            }
+            if (next == nullptr)
+            {
+                return;
+            }
+            if (static_cast<int32_t>(time_us_32() - next->deadline) > 0)
+            {
+                missed_deadlines_++;
+            }
+            next->released = false;
+            const int32_t index = static_cast<int32_t>(next - tasks_.data());
+            Trace::Begin(TraceSpan::UI_TASK, index);
+            next->callback(next->context);
+            Trace::End(TraceSpan::UI_TASK, index);
+        }
+    }
+
+    /**
+     * @brief Sleeps until an interrupt or a posted event. Call when there is nothing else to do after Process().
+     */
+    static inline void Idle()
+    {
+        __wfe();
+    }
+
+    /**
+     * @brief Number of tasks started after their deadline, since the start.
+     */
+    uint32_t GetMissedDeadlines() const
+    {
+        return missed_deadlines_;
+    }
+
+private:
+    struct Task
+    {
+        Callback callback;
+        void *context;
+        uint32_t period_us;
+        uint32_t deadline_us;
+        uint32_t wake;         ///< Wake() mask
+        uint32_t next_release; ///< time_us_32() of the next periodic release
+        uint32_t deadline;     ///< time_us_32() the released task should run by
+        bool released;
+    };
+
+    static inline EnumArray<Event, volatile bool> pending_{};
+    std::array<Task, kMaxTasks> tasks_{};
+    size_t count_ = 0;
+    uint32_t missed_deadlines_ = 0;
+};
+
+}
@@ -0,0 +1,243 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "UsbAudio.hpp"
+#include <algorithm>
+#include "common/core/Kastle2.hpp"
+#include "common/fastcode.hpp"
+#include "tusb.h"
+
+using namespace kastle2;
+
+// Feedback gain, the frames per USB frame (16.16) per frame of the playback fill error (in 1/16 frames)
+static constexpr int32_t kFeedbackGain = 16;
+// At most a quarter of a frame per USB frame off the nominal rate
+static constexpr int32_t kFeedbackRange = 1 << 14;
+
+void UsbAudio::Process()
+{
+#if KASTLE2_USB_AUDIO
+    ProcessRecording();
+    ProcessPlayback();
+#endif
+}
+
+FASTCODE void UsbAudio::ReadBlock(q15_t *input, const size_t size)
+{
+    if (!playing_)
+    {
+        return;
+    }
+    if (!playback_primed_)
+    {
+        if (playback_ring_.Size() < kPlaybackTargetFrames)
+        {
+            return;
+        }
+        playback_primed_ = true;
+    }
+
+    Frame frames[I2S::kAudioBufferSize];
+    const size_t count = playback_ring_.PopBlock(frames, std::min(size, I2S::kAudioBufferSize));
+    Frame *block = reinterpret_cast<Frame *>(input);
+    for (size_t i = 0; i < count; i++)
+    {
+        block[i].left = q15_saturate(block[i].left + frames[i].left);
+        block[i].right = q15_saturate(block[i].right + frames[i].right);
+    }
+    if (count < size)
+    {
+        // Ran empty, wait for the ring to fill again
+        playback_primed_ = false;
+        xruns_ = xruns_ + 1;
+    }
+}
+
+FASTCODE void UsbAudio::WriteBlock(const q15_t *output, const size_t size)
+{
+    if (!recording_)
+    {
+        return;
+    }
+    if (record_ring_.PushBlock(reinterpret_cast<const Frame *>(output), size) < size)
+    {
+        xruns_ = xruns_ + 1;
+    }
+}
+
+void UsbAudio::SetInterface(const uint8_t interface, const uint8_t alt)
+{
+#if KASTLE2_USB_AUDIO
+    if (interface == USB_AUDIO_ITF_RECORD)
+    {
+        recording_ = alt != 0;
+    }
+    if (interface == USB_AUDIO_ITF_PLAYBACK)
+    {
+        playing_ = alt != 0;
+        playback_primed_ = false;
+        playback_fill_ = kPlaybackTargetFrames << 4;
+    }
+#else
+    (void)interface;
+    (void)alt;
+#endif
+}
+
+#if KASTLE2_USB_AUDIO
+
+void UsbAudio::ProcessRecording()
+{
+    if (!recording_)
+    {
+        // Drop what the audio callback wrote before the host stopped
+        Frame frame;
+        while (record_ring_.Pop(frame))
+        {
+        }
+        return;
+    }
+
+    // Two USB frames at most, TinyUSB sends what it has (up to the endpoint size) in each frame
+    Frame frames[2 * (kFramesPerUsbFrame + 1)];
+    int16_t samples[2 * (kFramesPerUsbFrame + 1) * 2];
+    const size_t count = record_ring_.PopBlock(frames, std::size(frames));
+    for (size_t i = 0; i < count; i++)
+    {
+        samples[2 * i] = static_cast<int16_t>(frames[i].left);
+        samples[2 * i + 1] = static_cast<int16_t>(frames[i].right);
+    }
+    tud_audio_write(samples, static_cast<uint16_t>(count * 2 * sizeof(int16_t)));
+}
+
+void UsbAudio::ProcessPlayback()
+{
+    if (!playing_)
+    {
+        return;
+    }
+
+    // The whole frames TinyUSB received, as many as fit the ring
+    int16_t samples[2 * (kFramesPerUsbFrame + 1) * 2];
+    Frame frames[2 * (kFramesPerUsbFrame + 1)];
+    const size_t space = kRingFrames - playback_ring_.Size();
+    size_t count = std::min<size_t>(tud_audio_available() / (2 * sizeof(int16_t)), std::min(space, std::size(frames)));
+    count = tud_audio_read(samples, static_cast<uint16_t>(count * 2 * sizeof(int16_t))) / (2 * sizeof(int16_t));
+    for (size_t i = 0; i < count; i++)
+    {
+        frames[i].left = samples[2 * i];
+        frames[i].right = samples[2 * i + 1];
+    }
+    playback_ring_.PushBlock(frames, count);
+
+    // Feedback: the host sends more when the ring is below the target, less when above
+    const int32_t fill = static_cast<int32_t>(playback_ring_.Size()) << 4;
+    playback_fill_ += (fill - playback_fill_) >> 5;
+    const int32_t error = (static_cast<int32_t>(kPlaybackTargetFrames) << 4) - playback_fill_;
+    const int32_t correction = std::clamp(error * kFeedbackGain, -kFeedbackRange, kFeedbackRange);
+    // 16.16 frames per USB frame, TinyUSB converts it to the 10.14 of the full speed
+    tud_audio_fb_set(static_cast<uint32_t>((static_cast<int32_t>(kFramesPerUsbFrame) << 16) + correction));
+}
+
+//--------------------------------------------------------------------+
+// TinyUSB audio callbacks
+//--------------------------------------------------------------------+
+
+// Invoked when the host selects an alternate setting of a streaming interface
+bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const *p_request)
+{
+    (void)rhport;
+    Kastle2::usb_audio.SetInterface(tu_u16_low(p_request->wIndex), tu_u16_low(p_request->wValue));
+    return true;
+}
+
+// Invoked before the endpoints of a streaming interface are closed
+bool tud_audio_set_itf_close_EP_cb(uint8_t rhport, tusb_control_request_t const *p_request)
+{
+    (void)rhport;
+    Kastle2::usb_audio.SetInterface(tu_u16_low(p_request->wIndex), 0);
+    return true;
+}
+
+// Invoked on a GET request to an entity, only the clock source has controls (fixed I2S_SAMPLE_RATE)
+bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request)
+{
+    const uint8_t entity = tu_u16_high(p_request->wIndex);
+    const uint8_t control = tu_u16_high(p_request->wValue);
+    if (entity != USB_AUDIO_ENTITY_CLOCK)
+    {
+        return false;
+    }
+
+    if (control == AUDIO_CS_CTRL_SAM_FREQ)
+    {
+        if (p_request->bRequest == AUDIO_CS_REQ_CUR)
+        {
+            audio_control_cur_4_t current = {.bCur = static_cast<int32_t>(I2S_SAMPLE_RATE)};
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &current, sizeof(current));
+        }
+        if (p_request->bRequest == AUDIO_CS_REQ_RANGE)
+        {
+            audio_control_range_4_n_t(1) range = {};
+            range.wNumSubRanges = 1;
+            range.subrange[0].bMin = static_cast<int32_t>(I2S_SAMPLE_RATE);
+            range.subrange[0].bMax = static_cast<int32_t>(I2S_SAMPLE_RATE);
+            range.subrange[0].bRes = 0;
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &range, sizeof(range));
+        }
+    }
+    else if (control == AUDIO_CS_CTRL_CLK_VALID && p_request->bRequest == AUDIO_CS_REQ_CUR)
+    {
+        audio_control_cur_1_t valid = {.bCur = 1};
+        return tud_audio_buffer_and_schedule_control_xfer(rhport, p_request, &valid, sizeof(valid));
+    }
+    return false;
+}
+
+// Invoked on a SET request to an entity, the host may only set the one sample rate
+bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request, uint8_t *buffer)
+{
+    (void)rhport;
+    const uint8_t entity = tu_u16_high(p_request->wIndex);
+    const uint8_t control = tu_u16_high(p_request->wValue);
+    if (entity == USB_AUDIO_ENTITY_CLOCK && control == AUDIO_CS_CTRL_SAM_FREQ &&
+        p_request->bRequest == AUDIO_CS_REQ_CUR && p_request->wLength == sizeof(audio_control_cur_4_t))
+    {
+        return reinterpret_cast<audio_control_cur_4_t *>(buffer)->bCur == static_cast<int32_t>(I2S_SAMPLE_RATE);
+    }
+    return false;
+}
+
+#else
+
+void UsbAudio::ProcessRecording()
+{
+}
+
+void UsbAudio::ProcessPlayback()
+{
+}
+
+#endif
@@ -0,0 +1,170 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/config.hpp"
+#include "common/core/MultiCoreQueue.hpp"
+#include "common/dsp/math/qmath.hpp"
+
+/**
+ * @brief USB audio streaming (UAC2, stereo in and out), set per app (USB_AUDIO in create_kastle2_app) or for all apps (-DKASTLE2_USB_AUDIO=ON).
+ */
+#ifndef KASTLE2_USB_AUDIO
+#define KASTLE2_USB_AUDIO 0
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class UsbAudio
+ * @ingroup core
+ * @brief USB audio interface (UAC2, 16-bit stereo at I2S_SAMPLE_RATE) next to the USB MIDI and CDC.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The host records the output of the Kastle and can play into its input, so an app like FxWizard
+ * can be inserted as an effect in a DAW. The audio callback only copies its blocks to and from the rings,
+ * Process() converts them from and to the USB packets in the UI task.
+ *
+ * Both endpoints are asynchronous, the I2S_SAMPLE_RATE of the I2S clock is the master. The recording sends
+ * what the audio callback wrote (44 frames per USB frame on average, a bit more or less with the drift).
+ * The playback reports the fill of its ring with the feedback endpoint, so the host sends ahead or behind.
+ * Kastle2::clock_sync trims the I2S clock to the USB frames, so both settle at the nominal frames per USB frame.
+ *
+ * @note Disabled unless the build enables it (KASTLE2_USB_AUDIO), the descriptors are in usb_descriptors.c.
+ */
+class UsbAudio
+{
+public:
+    /**
+     * @brief Stereo frame, the same layout as the interleaved I2S blocks
+     */
+    struct Frame
+    {
+        q15_t left;
+        q15_t right;
+    };
+
+    /**
+     * @brief Frames in each ring, ~11.6 ms
+     */
+    static constexpr size_t kRingFrames = 512;
+
+    /**
+     * @brief Playback ring fill the feedback keeps, ~5.8 ms of latency
+     */
+    static constexpr size_t kPlaybackTargetFrames = kRingFrames / 2;
+
+    /**
+     * @brief Nominal frames per USB frame (1 ms), I2S_SAMPLE_RATE is a multiple of 1 kHz
+     */
+    static constexpr uint32_t kFramesPerUsbFrame = static_cast<uint32_t>(I2S_SAMPLE_RATE) / 1000;
+
+    /**
+     * @brief Moves the audio between the rings and TinyUSB and updates the feedback, call every 1 ms from the UI task
+     */
+    void Process();
+
+    /**
+     * @brief Adds the host playback to the input block, called by the audio callback
+     * @param input Interleaved stereo input block
+     * @param size Number of frames
+     */
+    void ReadBlock(q15_t *input, const size_t size);
+
+    /**
+     * @brief Copies the output block for the host recording, called by the audio callback
+     * @param output Interleaved stereo output block
+     * @param size Number of frames
+     */
+    void WriteBlock(const q15_t *output, const size_t size);
+
+    /**
+     * @brief Sets the streaming state after the host selects an alternate setting (TinyUSB callbacks)
+     * @param interface The interface number
+     * @param alt The alternate setting, 0 stops the streaming
+     */
+    void SetInterface(const uint8_t interface, const uint8_t alt);
+
+    /**
+     * @brief Whether the host records the output
+     * @return Recording interface is streaming
+     */
+    bool IsRecording() const
+    {
+        return recording_;
+    }
+
+    /**
+     * @brief Whether the host plays into the input
+     * @return Playback interface is streaming
+     */
+    bool IsPlaying() const
+    {
+        return playing_;
+    }
+
+    /**
+     * @brief Blocks the audio callback couldn't fill from the playback or write to the recording
+     * @return Count since the start
+     */
+    uint32_t GetXrunCount() const
+    {
+        return xruns_;
+    }
+
+private:
+    // Audio callback -> Process(), the host recording
+    MultiCoreQueue<Frame, kRingFrames> record_ring_;
+    // Process() -> audio callback, the host playback
+    MultiCoreQueue<Frame, kRingFrames> playback_ring_;
+
+    volatile bool recording_ = false;
+    volatile bool playing_ = false;
+
+    // The playback starts after the ring fills to kPlaybackTargetFrames, stops when it runs empty
+    volatile bool playback_primed_ = false;
+
+    // Smoothed playback fill in 1/16 frames, for the feedback
+    int32_t playback_fill_ = kPlaybackTargetFrames << 4;
+
+    volatile uint32_t xruns_ = 0;
+
+    /**
+     * @brief Sends the recording to TinyUSB
+     */
+    void ProcessRecording();
+
+    /**
+     * @brief Takes the playback from TinyUSB and sets the feedback
+     */
+    void ProcessPlayback();
+};
+
+}
@@ -0,0 +1,82 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "UserDataFile.hpp"
+#include "common/core/Crc.hpp"
+#include "common/core/Kastle2.hpp"
+
+using namespace kastle2;
+
+bool UserDataFile::Validate(const char *expected_magic)
+{
+    valid_ = false;
+    verified_ = false;
+    memory_offset_ = 0;
+
+    // The header is read in place, the user data section starts at a flash sector
+    const uintptr_t begin = USER_DATA_SECTION_BEGIN;
+    if (begin % alignof(Header) != 0)
+    {
+        return false;
+    }
+    header_ = reinterpret_cast<const Header *>(begin);
+
+    if (memcmp(header_->magic, expected_magic, 4) != 0)
+    {
+        return false;
+    }
+
+    // A broken size must not send the end marker check outside the user data
+    const size_t file_size = header_->file_size;
+    if (!between(file_size, sizeof(Header) + kEndMarkerSize, USER_DATA_SECTION_SIZE))
+    {
+        return false;
+    }
+
+    if (memcmp(reinterpret_cast<const void *>(begin + file_size - kEndMarkerSize), "ahoj", kEndMarkerSize) != 0)
+    {
+        return false;
+    }
+
+    // Same size and CRC as the file verified before, the flash didn't change since
+    crc_ = Crc::Compute(reinterpret_cast<const void *>(begin), file_size);
+    verified_ = Kastle2::memory.Get32(Memory::ADDR_USER_DATA_SIZE) == file_size &&
+                Kastle2::memory.Get32(Memory::ADDR_USER_DATA_CRC) == crc_;
+
+    valid_ = true;
+    memory_offset_ = begin;
+    return true;
+}
+
+void UserDataFile::SetVerified()
+{
+    if (!valid_ || verified_)
+    {
+        return;
+    }
+    verified_ = true;
+    Kastle2::memory.QueueUpdate32(Memory::ADDR_USER_DATA_SIZE, header_->file_size);
+    Kastle2::memory.QueueUpdate32(Memory::ADDR_USER_DATA_CRC, crc_);
+}
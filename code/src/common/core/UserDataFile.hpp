@@ -40,17 +40,32 @@ namespace kastle2
  * @brief Parsing user data section from flash memory into usable structures.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2026-01-15
+ *
+ * Validate() maps the file header right from the flash and checks the magic, the file size and the end marker.
+ * It also computes the CRC32 of the whole file (Crc::Compute(), at the flash read speed)
+ * and compares it with the one cached in the EEPROM. A match means the flash holds the same file which
+ * passed the app's checks before, IsVerified() then lets the app skip its deeper checks.
+ * The app calls SetVerified() after its checks pass, which caches the CRC for the next boots.
  */
 class UserDataFile
 {
-private:
-    /** Current memory offset within the user data section */
-    size_t memory_offset_ = 0;
+public:
+    /**
+     * @brief Start of every user data file, mapped right from the flash.
+     */
+    struct Header
+    {
+        char magic[4];      ///< File type, eg. "k2wb"
+        uint32_t file_size; ///< Size of the whole file, including the end marker
+    };
 
-    /** Flag indicating if the file is valid */
-    bool valid_ = false;
+    static_assert(sizeof(Header) == 8);
+
+    /**
+     * @brief Size of the "ahoj" end marker, the last bytes of the file
+     */
+    static constexpr size_t kEndMarkerSize = 4;
 
-public:
     /**
      * @brief Maximum number of scales supported
      */
@@ -62,41 +77,68 @@ public:
     static constexpr size_t kMaxRhythms = 64;
 
     /**
-     * @brief Initialize and validate the file header with magic string and end marker
+     * @brief Validates the file header with magic string and end marker, checks the file CRC against the EEPROM
      * @param expected_magic 4-character magic string (e.g., "k2ac", "k2wb")
-     * @param file_size_offset Offset in header where file_size is stored
      * @return true if file is valid and ready for reading
      * @warning This functions resets the memory offset to the beginning of the user data section.
      */
-    bool Validate(const char *expected_magic,
-                  size_t file_size_offset = 4)
+    bool Validate(const char *expected_magic);
+
+    /**
+     * @brief Returns the header mapped in the flash, valid after a successful Validate()
+     */
+    const Header &GetHeader() const
     {
-        valid_ = false;
-        memory_offset_ = 0;
+        return *header_;
+    }
 
-        // Read magic string from the beginning
-        char magic[4];
-        memcpy(magic, reinterpret_cast<const void *>(USER_DATA_SECTION_BEGIN), 4);
-        if (memcmp(magic, expected_magic, 4) != 0)
-        {
-            return false;
-        }
+    /**
+     * @brief Returns true when the file is the one which passed the app's checks before (see SetVerified())
+     */
+    bool IsVerified() const
+    {
+        return verified_;
+    }
 
-        // Read file size
-        uint32_t file_size;
-        memcpy(&file_size, reinterpret_cast<const void *>(USER_DATA_SECTION_BEGIN + file_size_offset), 4);
+    /**
+     * @brief Caches the CRC of the file in the EEPROM, so the next boots get IsVerified() until the file changes.
+     * Call after the app's own checks of the file passed.
+     */
+    void SetVerified();
 
-        // Read and validate end marker
-        char end_marker[4];
-        memcpy(end_marker, reinterpret_cast<const void *>(USER_DATA_SECTION_BEGIN + file_size - 4), 4);
-        if (memcmp(end_marker, "ahoj", 4) != 0)
+    /**
+     * @brief Returns the CRC32 (zlib) of the whole file, valid after a successful Validate()
+     */
+    uint32_t GetCrc() const
+    {
+        return crc_;
+    }
+
+    /**
+     * @brief Maps an array of the file in place, an offset resolved once is then used without any copying
+     * @tparam T Type of the items, the offset must be aligned to it
+     * @param offset Offset from the file begin
+     * @param count Number of items
+     * @return Pointer into the flash, nullptr when the items are misaligned or don't fit before the end marker
+     */
+    template <typename T>
+    const T *Map(size_t offset, size_t count = 1) const
+    {
+        const uintptr_t address = USER_DATA_SECTION_BEGIN + offset;
+        if (!valid_ || address % alignof(T) != 0 || !IsInFile(offset, sizeof(T) * count))
         {
-            return false;
+            return nullptr;
         }
+        return reinterpret_cast<const T *>(address);
+    }
 
-        valid_ = true;
-        memory_offset_ = USER_DATA_SECTION_BEGIN;
-        return true;
+    /**
+     * @brief Checks that the bytes from the offset fit the file before the end marker
+     */
+    bool IsInFile(size_t offset, size_t bytes) const
+    {
+        const size_t data_end = header_->file_size - kEndMarkerSize;
+        return offset <= data_end && bytes <= data_end - offset;
     }
 
     /**
@@ -153,14 +195,14 @@ public:
      */
     Quantizer::Scale *LoadScales(size_t num_scales, size_t max_scales = kMaxScales)
     {
-        if (!valid_ || !between(num_scales, 1, max_scales))
+        const size_t total_bytes = sizeof(Quantizer::Scale) * num_scales;
+        if (!valid_ || !between(num_scales, 1, max_scales) || !IsInFile(memory_offset_ - USER_DATA_SECTION_BEGIN, total_bytes))
         {
             return nullptr;
         }
 
         // Allocate and load scales
         Quantizer::Scale *scales = new Quantizer::Scale[num_scales];
-        size_t total_bytes = sizeof(Quantizer::Scale) * num_scales;
         memcpy(scales, reinterpret_cast<const void *>(memory_offset_), total_bytes);
         memory_offset_ += total_bytes;
 
@@ -176,14 +218,14 @@ public:
      */
     TriggerGenerator::Rhythm *LoadRhythms(size_t num_rhythms, size_t max_rhythms = kMaxRhythms)
     {
-        if (!valid_ || !between(num_rhythms, 1, max_rhythms))
+        const size_t total_bytes = sizeof(TriggerGenerator::Rhythm) * num_rhythms;
+        if (!valid_ || !between(num_rhythms, 1, max_rhythms) || !IsInFile(memory_offset_ - USER_DATA_SECTION_BEGIN, total_bytes))
         {
             return nullptr;
         }
 
         // Allocate and load rhythms
         TriggerGenerator::Rhythm *rhythms = new TriggerGenerator::Rhythm[num_rhythms];
-        size_t total_bytes = sizeof(TriggerGenerator::Rhythm) * num_rhythms;
         memcpy(rhythms, reinterpret_cast<const void *>(memory_offset_), total_bytes);
         memory_offset_ += total_bytes;
 
@@ -207,6 +249,22 @@ public:
         memcpy(dest, reinterpret_cast<const void *>(memory_offset_), byte_count);
         memory_offset_ += byte_count;
     }
+
+private:
+    /** Current memory offset within the user data section */
+    size_t memory_offset_ = 0;
+
+    /** Flag indicating if the file is valid */
+    bool valid_ = false;
+
+    /** Flag indicating if the file passed the app's checks before */
+    bool verified_ = false;
+
+    /** Header of the file in the flash */
+    const Header *header_ = nullptr;
+
+    /** CRC32 of the whole file */
+    uint32_t crc_ = 0;
 };
 
 } // namespace kastle2
\ No newline at end of file
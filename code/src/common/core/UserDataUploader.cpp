@@ -0,0 +1,254 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "UserDataUploader.hpp"
+#include <array>
+#include <cstring>
+#include "hardware/watchdog.h"
+#include "common/config.hpp"
+#include "common/core/Crc.hpp"
+#include "tusb.h"
+
+using namespace kastle2;
+
+namespace
+{
+
+// Longest wait for the rest of a started request, in the UI loop
+constexpr uint32_t kReceiveWaitUs = 20000;
+
+// Time for the last response to leave before the reboot
+constexpr uint32_t kRebootDelayMs = 100;
+
+}
+
+void UserDataUploader::SetEnabled(const bool enabled)
+{
+    enabled_ = enabled;
+    if (enabled_)
+    {
+        FlashWriter::Enable();
+    }
+}
+
+void UserDataUploader::Process(UsbSerial &serial)
+{
+    if (!enabled_ || !tud_cdc_connected())
+    {
+        if (state_ != State::IDLE)
+        {
+            End(serial);
+        }
+        return;
+    }
+
+    if (state_ == State::IDLE)
+    {
+        // Only the sync character starts a session, the rest is left to the debug commands
+        uint8_t first;
+        if (!tud_cdc_peek(&first) || first != kSync)
+        {
+            return;
+        }
+        tud_cdc_read(&first, 1);
+        Begin(serial);
+    }
+
+    // A started request is received at once, the host sends it in one go
+    absolute_time_t receive_timeout = make_timeout_time_us(kReceiveWaitUs);
+    while (state_ != State::IDLE)
+    {
+        if (tud_cdc_available() == 0)
+        {
+            if (received_ == 0 || absolute_time_diff_us(receive_timeout, get_absolute_time()) > 0)
+            {
+                break;
+            }
+            tud_task();
+            continue;
+        }
+        timeout_ = make_timeout_time_ms(kTimeoutMs);
+        receive_timeout = make_timeout_time_us(kReceiveWaitUs);
+        if (state_ == State::REQUEST)
+        {
+            received_ += tud_cdc_read(reinterpret_cast<uint8_t *>(&request_) + received_, sizeof(Request) - received_);
+            if (received_ == sizeof(Request))
+            {
+                received_ = 0;
+                if (request_.command == Command::WRITE)
+                {
+                    state_ = State::SECTOR;
+                }
+                else
+                {
+                    Execute(serial);
+                }
+            }
+        }
+        else
+        {
+            received_ += tud_cdc_read(sector_.get() + received_, kSectorSize - received_);
+            if (received_ == kSectorSize)
+            {
+                received_ = 0;
+                state_ = State::REQUEST;
+                Execute(serial);
+            }
+        }
+    }
+
+    if (state_ != State::IDLE && absolute_time_diff_us(timeout_, get_absolute_time()) > 0)
+    {
+        End(serial);
+    }
+}
+
+void UserDataUploader::Begin(UsbSerial &serial)
+{
+    sector_ = std::make_unique<uint8_t[]>(kSectorSize);
+    state_ = State::REQUEST;
+    received_ = 0;
+    timeout_ = make_timeout_time_ms(kTimeoutMs);
+    serial.SetInputClaimed(true);
+}
+
+void UserDataUploader::End(UsbSerial &serial)
+{
+    sector_.reset();
+    state_ = State::IDLE;
+    received_ = 0;
+    serial.SetInputClaimed(false);
+}
+
+void UserDataUploader::Execute(UsbSerial &serial)
+{
+    const uint32_t offset = request_.offset;
+    const uint8_t *flash = reinterpret_cast<const uint8_t *>(USER_DATA_SECTION_BEGIN);
+
+    switch (request_.command)
+    {
+    case Command::INFO:
+        // Decides whether the audio keeps running during the writes of this session
+        FlashWriter::CheckAudioPath();
+        Reply(Status::OK, kSectorSize, USER_DATA_SECTION_SIZE, kMaxChecksums);
+        break;
+
+    case Command::CHECKSUMS:
+    {
+        const uint32_t sectors = request_.length;
+        if (sectors > kMaxChecksums || !IsInUserData(offset, sectors))
+        {
+            Reply(Status::BAD_REQUEST);
+            break;
+        }
+        Reply(Status::OK, sectors);
+        for (uint32_t i = 0; i < sectors; i++)
+        {
+            const uint32_t crc = Crc::Compute(flash + offset + i * kSectorSize, kSectorSize);
+            Send(&crc, sizeof(crc));
+        }
+        break;
+    }
+
+    case Command::WRITE:
+    {
+        if (!IsInUserData(offset, 1))
+        {
+            Reply(Status::BAD_REQUEST);
+            break;
+        }
+        if (Crc::Compute(sector_.get(), kSectorSize) != request_.crc)
+        {
+            Reply(Status::BAD_CRC);
+            break;
+        }
+        // Also makes resending a sector after a lost response harmless
+        if (memcmp(flash + offset, sector_.get(), kSectorSize) == 0)
+        {
+            Reply(Status::UNCHANGED, request_.crc);
+            break;
+        }
+        const bool written = FlashWriter::WriteUserDataSector(offset, sector_.get());
+        Reply(written ? Status::OK : Status::WRITE_FAILED, Crc::Compute(flash + offset, kSectorSize));
+        break;
+    }
+
+    case Command::END:
+    {
+        const bool reboot = request_.length != 0;
+        Reply(Status::OK);
+        End(serial);
+        if (reboot)
+        {
+            // The app has the old data mapped (sample index etc.), start over with the new one
+            watchdog_reboot(0, 0, kRebootDelayMs);
+            while (true)
+            {
+                tud_task();
+            }
+        }
+        break;
+    }
+
+    default:
+        Reply(Status::BAD_REQUEST);
+        break;
+    }
+    tud_cdc_write_flush();
+}
+
+void UserDataUploader::Reply(const Status status, const uint32_t value0, const uint32_t value1, const uint32_t value2)
+{
+    const Response response = {
+        .command = request_.command,
+        .status = status,
+        .reserved = {0, 0},
+        .value = {value0, value1, value2},
+    };
+    Send(&response, sizeof(response));
+}
+
+bool UserDataUploader::IsInUserData(const uint32_t offset, const uint32_t sectors)
+{
+    return offset % kSectorSize == 0 && sectors > 0 &&
+           static_cast<uint64_t>(offset) + static_cast<uint64_t>(sectors) * kSectorSize <= USER_DATA_SECTION_SIZE;
+}
+
+void UserDataUploader::Send(const void *data, size_t size)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    while (size > 0 && tud_cdc_connected())
+    {
+        const uint32_t written = tud_cdc_write(bytes, size);
+        bytes += written;
+        size -= written;
+        if (size > 0)
+        {
+            // Full, let the USB stack send it
+            tud_task();
+            tud_cdc_write_flush();
+        }
+    }
+}
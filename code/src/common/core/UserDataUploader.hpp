@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "pico/stdlib.h"
+#include "common/core/FlashWriter.hpp"
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class UserDataUploader
+ * @ingroup core
+ * @brief Updates the user data (eg. the WaveBard samples) over the USB serial, only the sectors which changed.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Driven by scripts/user_data_upload.py: it reads the CRC32 of each 4 kB sector of the user data,
+ * compares them with the new file and sends only the sectors which differ, each with its CRC32.
+ * The sectors are written by FlashWriter from the UI loop, the device reboots at the end to load the new data.
+ *
+ * Protocol over the USB serial, little endian:
+ * - the host sends kSync (STX, never a debug command character), the uploader takes over the serial input
+ * - then requests, each a Request followed by kSectorSize bytes for WRITE, each answered by a Response
+ *   (followed by the CRCs for CHECKSUMS)
+ * - the session ends with END or after kTimeoutMs without any data
+ *
+ * Disabled by default, an app enables it with Kastle2::uploader.SetEnabled(true) before starting the second core.
+ */
+class UserDataUploader
+{
+public:
+    static constexpr uint8_t kSync = 0x02;
+    static constexpr size_t kSectorSize = FlashWriter::kSectorSize;
+    static constexpr size_t kMaxChecksums = 32;
+    static constexpr uint32_t kTimeoutMs = 2000;
+
+    enum class Command : uint8_t
+    {
+        INFO = 'I',      ///< value: sector size, user data size, max checksums per request
+        CHECKSUMS = 'C', ///< offset, length (sectors), CRC32 of each sector follow the response
+        WRITE = 'W',     ///< offset, crc of the sector data that follows, value: CRC32 of the flash after
+        END = 'E',       ///< length non zero reboots the device
+    };
+
+    enum class Status : uint8_t
+    {
+        OK,
+        UNCHANGED,    ///< The sector already had the data, not written
+        BAD_REQUEST,  ///< Unknown command, offset or length out of the user data
+        BAD_CRC,      ///< The received sector doesn't match its CRC
+        WRITE_FAILED, ///< The flash can't be written now or didn't read back the same
+    };
+
+    struct __attribute__((packed)) Request
+    {
+        Command command;
+        uint8_t reserved[3];
+        uint32_t offset;
+        uint32_t length;
+        uint32_t crc;
+    };
+
+    struct __attribute__((packed)) Response
+    {
+        Command command;
+        Status status;
+        uint8_t reserved[2];
+        uint32_t value[3];
+    };
+
+    static_assert(sizeof(Request) == 16 && sizeof(Response) == 16);
+
+    /**
+     * @brief Enables the uploader (and the flash writes).
+     * @note Call before the second core starts, see FlashWriter::Enable().
+     */
+    void SetEnabled(const bool enabled);
+
+    /**
+     * @brief Returns true during an upload session.
+     */
+    bool IsActive() const
+    {
+        return state_ != State::IDLE;
+    }
+
+    /**
+     * @brief Handles the received data, called from the UI loop by Kastle2.
+     * @param serial The debug serial, its input is claimed for the session.
+     */
+    void Process(UsbSerial &serial);
+
+private:
+    enum class State
+    {
+        IDLE,
+        REQUEST,
+        SECTOR,
+    };
+
+    bool enabled_ = false;
+    State state_ = State::IDLE;
+    Request request_;
+    size_t received_ = 0;
+    // Sector being received, allocated for the session only
+    std::unique_ptr<uint8_t[]> sector_;
+    absolute_time_t timeout_;
+
+    void Begin(UsbSerial &serial);
+    void End(UsbSerial &serial);
+    void Execute(UsbSerial &serial);
+    void Reply(const Status status, const uint32_t value0 = 0, const uint32_t value1 = 0, const uint32_t value2 = 0);
+    static bool IsInUserData(const uint32_t offset, const uint32_t sectors);
+    static void Send(const void *data, size_t size);
+};
+
+}
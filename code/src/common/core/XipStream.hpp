@@ -0,0 +1,238 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "common/fastcode.hpp"
+#ifndef KASTLE2_HOST
+#include "hardware/dma.h"
+#include "hardware/regs/addressmap.h"
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class XipStream
+ * @ingroup core
+ * @brief Streams a sample from the QSPI flash into a small SRAM cache with a DMA channel, ahead of the playhead.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Reading the samples through XIP works, but two decks playing far apart regions (or in reverse) evict each other
+ * from the 16 KB XIP cache and every miss stalls the core for a QSPI transaction.
+ * The stream keeps kChunks chunks of kChunkBytes in SRAM, direct mapped by the chunk number, and Prefetch() copies
+ * the missing chunks ahead of the playhead in the playback direction. The DMA reads the non-caching flash alias,
+ * so the streamed data doesn't evict the code from the XIP cache either.
+ *
+ * The stream is addressed in bytes, so packed or companded samples stream the same way as the 16-bit ones.
+ * Find() only returns resident chunks, the reader falls back to the plain XIP read otherwise, so a late or
+ * missing prefetch costs time, never wrong data. One DMA transfer runs at a time, Prefetch() is meant to be
+ * called once per rendered block. The host build copies the chunks immediately.
+ */
+class XipStream
+{
+public:
+    /**
+     * @brief Size of one cached chunk in bytes.
+     */
+    static constexpr size_t kChunkBytes = 512;
+
+    /**
+     * @brief Number of cached chunks (power of two), one is kept behind the playhead for the interpolation.
+     */
+    static constexpr size_t kChunks = 8;
+
+    /**
+     * @brief Claims the DMA channel.
+     */
+    void Init()
+    {
+#ifndef KASTLE2_HOST
+        dma_channel_ = dma_claim_unused_channel(true);
+#endif
+        Invalidate();
+        pending_ = false;
+    }
+
+    /**
+     * @brief Waits for the running transfer and releases the DMA channel.
+     */
+    void DeInit()
+    {
+#ifndef KASTLE2_HOST
+        dma_channel_wait_for_finish_blocking(dma_channel_);
+        dma_channel_unclaim(dma_channel_);
+#endif
+        pending_ = false;
+        source_ = nullptr;
+    }
+
+    /**
+     * @brief Sets the streamed data and drops the cached chunks.
+     * @param data Start of the data (XIP flash or any other memory)
+     * @param bytes Size of the data in bytes
+     */
+    void SetSource(const void *data, size_t bytes)
+    {
+        // Stream through the alias which neither checks nor allocates the XIP cache
+        source_ = Uncached(data);
+        chunks_ = bytes == 0 ? 0 : ((bytes - 1) >> kChunkShift) + 1;
+        size_bytes_ = bytes;
+        Invalidate();
+    }
+
+    /**
+     * @brief Returns the alias of XIP flash data which neither checks nor allocates the XIP cache.
+     * For data read once (streamed or copied to SRAM), which would evict the code from the cache.
+     * @param data XIP flash data, any other memory is returned as it is
+     */
+    static const uint8_t *Uncached(const void *data)
+    {
+#ifndef KASTLE2_HOST
+        const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+        if (address >= XIP_MAIN_BASE && address < XIP_NOALLOC_BASE)
+        {
+            return reinterpret_cast<const uint8_t *>(address - XIP_MAIN_BASE + XIP_NOCACHE_NOALLOC_BASE);
+        }
+#endif
+        return static_cast<const uint8_t *>(data);
+    }
+
+    /**
+     * @brief Returns the cached bytes offset to offset + bytes - 1, when they are all in one resident chunk.
+     * @return Pointer to the byte at the offset, nullptr when the bytes have to be read from the source.
+     */
+    inline const uint8_t *Find(size_t offset, size_t bytes) const
+    {
+        const size_t chunk = offset >> kChunkShift;
+        if (((offset + bytes - 1) >> kChunkShift) != chunk)
+        {
+            return nullptr;
+        }
+        const size_t slot = chunk & (kChunks - 1);
+        if (tags_[slot] != chunk)
+        {
+            return nullptr;
+        }
+        return buffer_[slot].data() + (offset & (kChunkBytes - 1));
+    }
+
+    /**
+     * @brief Completes the finished transfer and starts the next missing chunk in the playback direction.
+     * @param offset Byte offset of the playhead
+     * @param reverse True when playing backwards
+     */
+    FASTCODE void Prefetch(size_t offset, bool reverse)
+    {
+        if (pending_)
+        {
+#ifndef KASTLE2_HOST
+            if (dma_channel_is_busy(dma_channel_))
+            {
+                return;
+            }
+#endif
+            pending_ = false;
+            if (pending_source_ == source_)
+            {
+                tags_[pending_slot_] = pending_chunk_;
+            }
+        }
+        if (source_ == nullptr || chunks_ == 0)
+        {
+            return;
+        }
+
+        const size_t current = offset >> kChunkShift;
+        for (size_t ahead = 0; ahead < kChunks - 1; ahead++)
+        {
+            if (reverse ? ahead > current : current + ahead >= chunks_)
+            {
+                return;
+            }
+            const size_t chunk = reverse ? current - ahead : current + ahead;
+            const size_t slot = chunk & (kChunks - 1);
+            if (tags_[slot] != chunk)
+            {
+                Fetch(chunk, slot);
+                return;
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kInvalidChunk = SIZE_MAX;
+    static constexpr size_t kChunkShift = std::countr_zero(kChunkBytes);
+
+    void Invalidate()
+    {
+        tags_.fill(kInvalidChunk);
+    }
+
+    /**
+     * @brief Starts copying the chunk into the slot, the slot becomes resident when the transfer completes.
+     */
+    FASTCODE void Fetch(size_t chunk, size_t slot)
+    {
+        const size_t offset = chunk * kChunkBytes;
+        const size_t bytes = std::min(kChunkBytes, size_bytes_ - offset);
+        tags_[slot] = kInvalidChunk;
+        pending_slot_ = slot;
+        pending_chunk_ = chunk;
+        pending_source_ = source_;
+        pending_ = true;
+#ifndef KASTLE2_HOST
+        // The data is only guaranteed to be aligned to its sample size, the widest transfer that fits is used
+        const uintptr_t alignment = reinterpret_cast<uintptr_t>(source_ + offset) | bytes;
+        const size_t transfer_shift = (alignment & 3) == 0 ? 2 : ((alignment & 1) == 0 ? 1 : 0);
+        dma_channel_config config = dma_channel_get_default_config(dma_channel_);
+        channel_config_set_transfer_data_size(&config, static_cast<dma_channel_transfer_size>(transfer_shift));
+        channel_config_set_read_increment(&config, true);
+        channel_config_set_write_increment(&config, true);
+        dma_channel_configure(dma_channel_, &config, buffer_[slot].data(), source_ + offset, bytes >> transfer_shift, true);
+#else
+        memcpy(buffer_[slot].data(), source_ + offset, bytes);
+#endif
+    }
+
+    alignas(4) std::array<std::array<uint8_t, kChunkBytes>, kChunks> buffer_;
+    std::array<size_t, kChunks> tags_;
+    const uint8_t *source_ = nullptr;
+    const uint8_t *pending_source_ = nullptr;
+    size_t size_bytes_ = 0;
+    size_t chunks_ = 0;
+    size_t pending_slot_ = 0;
+    size_t pending_chunk_ = 0;
+    bool pending_ = false;
+    size_t dma_channel_ = 0;
+};
+
+}
@@ -29,6 +29,8 @@ SOFTWARE.
 namespace kastle2
 {
 
+class InputEdges;
+
 /**
  * @class ClockSource
  * @ingroup core_clocks
@@ -91,10 +93,15 @@ public:
 
     /**
      * @brief Processes the clock source. Should be called in each audio loop.
-     * @param raw_sync_input Raw sync input (the implementation needs to handle the edge detection).
-     * @param midi_pulse_input Incoming MIDI pulse input from the MIDI clock.
+     * @param sync_input Sync input edges of this block (no edges when the sync is disabled).
+     */
+    virtual void Process(const InputEdges &sync_input) = 0;
+
+    /**
+     * @brief Frame of the current audio block at which the clock ticked, valid when the current ticks are 0.
+     * @return Frame offset in the block (0 to AUDIO_BUFFER_SIZE - 1), 0 for the clocks running in whole blocks.
      */
-    virtual void Process(bool raw_sync_input, bool midi_pulse_input) = 0;
+    virtual uint32_t GetTriggerFrame() const = 0;
 
     /**
      * @brief Sets the desired tempo in ticks per cycle.
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #include "ExternalClockSource.hpp"
+#include "common/core/InputEdges.hpp"
 #include "common/core/Kastle2.hpp"
 #include "common/core/Kastle2_parameters.hpp"
 #include "common/dsp/math/math_utils.hpp"
@@ -51,11 +52,6 @@ void ExternalClockSource::Resume()
     state_ = State::RUNNING;
 }
 
-bool ExternalClockSource::IsNowReset() const
-{
-    return now_reset_;
-}
-
 void ExternalClockSource::SetPot(int32_t pot_value)
 {
     int32_t val = diff(pot_value, POT_HALF);
@@ -91,13 +87,20 @@ void ExternalClockSource::SetSyncJackPlugged(bool jack_plugged)
     }
 }
 
+uint32_t ExternalClockSource::PeriodTicks(const uint32_t period_us)
+{
+    // Rounded to the audio blocks, the timestamps don't jitter with the blocks like counting them
+    constexpr uint64_t kBlockUs = static_cast<uint64_t>(AUDIO_BUFFER_SIZE) * 1000000;
+    return static_cast<uint32_t>((static_cast<uint64_t>(period_us) * SAMPLE_RATE + kBlockUs / 2) / kBlockUs);
+}
+
 uint32_t ExternalClockSource::GetTotalSteps()
 {
     // this will overflow but idk is that a problem?
     return total_input_trigs_ * ext_multiplier_ / ext_divider_;
 }
 
-void ExternalClockSource::Process(bool raw_sync_input, [[maybe_unused]] bool midi_pulse_input)
+void ExternalClockSource::Process(const InputEdges &sync_input)
 {
     now_reset_ = false;
     if (ext_ticks_ < UINT32_MAX)
@@ -109,34 +112,39 @@ void ExternalClockSource::Process(bool raw_sync_input, [[maybe_unused]] bool mid
         ++current_ticks_;
     }
 
-    if (sync_input_.Process(raw_sync_input))
+    // Several edges in one block are the clocks faster than the audio blocks
+    const uint32_t edges = sync_input.GetEdges();
+    if (edges > 0)
     {
-        if (total_input_trigs_ < UINT32_MAX)
+        if (total_input_trigs_ < UINT32_MAX - edges)
         {
-            ++total_input_trigs_;
+            total_input_trigs_ += edges;
         }
         if (!first_analog_sync_)
         {
             if ((state_ == State::RUNNING) && ext_ticks_ < kExtClockProbablyStopped)
             {
-                ++current_division_;
+                current_division_ += edges;
                 if (current_division_ >= ext_divider_)
                 {
-                    target_ticks_ = ext_ticks_ * ext_divider_ / ext_multiplier_;
+                    target_ticks_ = PeriodTicks(sync_input.GetPeriodUs() * ext_divider_) / ext_multiplier_;
                     current_division_ = 0;
                     current_ticks_ = 0;
                     current_multiplication_ = 0;
+                    trigger_frame_ = sync_input.GetFrame();
                 }
             }
             else
             {
                 Start();
                 now_reset_ = true;
+                trigger_frame_ = sync_input.GetFrame();
             }
         }
         else
         {
             now_reset_ = true;
+            trigger_frame_ = sync_input.GetFrame();
         }
         prev_ext_ticks_ = ext_ticks_;
         ext_ticks_ = 0;
@@ -147,6 +155,7 @@ void ExternalClockSource::Process(bool raw_sync_input, [[maybe_unused]] bool mid
     {
         ++current_multiplication_;
         current_ticks_ = 0;
+        trigger_frame_ = 0;
     }
 
     if (!sync_jack_plugged_)
@@ -219,16 +228,6 @@ void ExternalClockSource::TapResetsTicks(bool force)
     }
 }
 
-uint32_t ExternalClockSource::GetTargetTicks() const
-{
-    return target_ticks_;
-}
-
-uint32_t ExternalClockSource::GetCurrentTicks() const
-{
-    return current_ticks_;
-}
-
 void ExternalClockSource::SaveToMemory()
 {
     Kastle2::memory.QueueUpdate8(Memory::ADDR_CLOCK_DIVIDER, ext_divider_);
@@ -270,11 +269,6 @@ void ExternalClockSource::LoadFromMemory()
     current_multiplication_ = 0;
 }
 
-ClockSource::State ExternalClockSource::GetState() const
-{
-    return state_;
-}
-
 void ExternalClockSource::SetExtDividerMultiplier(uint8_t ext_divider, uint8_t ext_multiplier)
 {
     if (ext_divider == ext_divider_ && ext_multiplier == ext_multiplier_)
@@ -24,7 +24,6 @@ SOFTWARE.
 
 #pragma once
 
-#include "common/dsp/utility/EdgeDetector.hpp"
 #include "ClockSource.hpp"
 #include <cstdint>
 
@@ -39,22 +38,38 @@ namespace kastle2
  * @date 2025-05-21
  */
 
-class ExternalClockSource : public ClockSource
+class ExternalClockSource final : public ClockSource
 {
 public:
     void Init(float sample_rate) override;
     void Start() override;
     void Stop() override;
     void Resume() override;
-    bool IsNowReset() const override;
+    inline bool IsNowReset() const override
+    {
+        return now_reset_;
+    }
     void SetSyncJackPlugged(bool jack_plugged) override;
     void SetPot(int32_t pot_value) override;
-    void Process(bool raw_sync_input, bool midi_pulse_input) override;
-    State GetState() const override;
+    void Process(const InputEdges &sync_input) override;
+    inline uint32_t GetTriggerFrame() const override
+    {
+        return trigger_frame_;
+    }
+    inline State GetState() const override
+    {
+        return state_;
+    }
     bool IsReachingNextCycle() const override;
     void SetTapTicks(uint32_t tap_ticks) override;
-    uint32_t GetTargetTicks() const override;
-    uint32_t GetCurrentTicks() const override;
+    inline uint32_t GetTargetTicks() const override
+    {
+        return target_ticks_;
+    }
+    inline uint32_t GetCurrentTicks() const override
+    {
+        return current_ticks_;
+    }
     void SaveToMemory() override;
     void LoadFromMemory() override;
     void TapResetsTicks(bool force) override;
@@ -62,6 +77,7 @@ public:
 
 private:
     void SetExtDividerMultiplier(uint8_t ext_divider, uint8_t ext_multiplier);
+    static uint32_t PeriodTicks(const uint32_t period_us);
 
     bool now_reset_ = false;
 
@@ -75,7 +91,7 @@ private:
     bool first_analog_sync_ = true;
 
     bool sync_jack_plugged_ = false;
-    EdgeDetector sync_input_ = EdgeDetector(EdgeDetector::Type::RISING);
+    uint32_t trigger_frame_ = 0;
 
     uint8_t ext_divider_ = 0;
     uint8_t ext_multiplier_ = 0;
@@ -49,11 +49,6 @@ void InternalClockSource::Resume()
 {
 }
 
-bool InternalClockSource::IsNowReset() const
-{
-    return false;
-}
-
 void InternalClockSource::SetSyncJackPlugged([[maybe_unused]] bool jack_plugged)
 {
 }
@@ -63,7 +58,7 @@ void InternalClockSource::SetPot(int32_t pot_value)
     target_ticks_ = curve_map(pot_value, kTempoMap);
 }
 
-void InternalClockSource::Process([[maybe_unused]] bool raw_sync_input, [[maybe_unused]] bool midi_pulse_input)
+void InternalClockSource::Process([[maybe_unused]] const InputEdges &sync_input)
 {
     ++current_ticks_;
     ++total_ticks_; // this will overflow but we don't care much
@@ -73,11 +68,6 @@ void InternalClockSource::Process([[maybe_unused]] bool raw_sync_input, [[maybe_
     }
 }
 
-ClockSource::State InternalClockSource::GetState() const
-{
-    return State::RUNNING;
-}
-
 bool InternalClockSource::IsReachingNextCycle() const
 {
     return current_ticks_ + 2 >= target_ticks_;
@@ -97,16 +87,6 @@ void InternalClockSource::TapResetsTicks(bool force)
     }
 }
 
-uint32_t InternalClockSource::GetTargetTicks() const
-{
-    return target_ticks_;
-}
-
-uint32_t InternalClockSource::GetCurrentTicks() const
-{
-    return current_ticks_;
-}
-
 uint32_t InternalClockSource::GetTotalSteps()
 {
     return total_ticks_;
@@ -114,7 +94,7 @@ uint32_t InternalClockSource::GetTotalSteps()
 
 void InternalClockSource::SaveToMemory()
 {
-    Kastle2::memory.QueueUpdate32(Memory::ADDR_CLOCK_TICKS, target_ticks_);
+    Kastle2::memory.QueueUpdate32(Memory::ADDR_CLOCK_TICKS, static_cast<uint32_t>(static_cast<uint64_t>(target_ticks_) * AUDIO_BUFFER_SIZE / kMemoryBlockSize));
 }
 
 void InternalClockSource::LoadFromMemory()
@@ -122,6 +102,7 @@ void InternalClockSource::LoadFromMemory()
     uint32_t ticks;
     if (Kastle2::memory.Read32(Memory::ADDR_CLOCK_TICKS, &ticks))
     {
+        ticks = static_cast<uint32_t>(static_cast<uint64_t>(ticks) * kMemoryBlockSize / AUDIO_BUFFER_SIZE);
         if (ticks > 0)
         {
             target_ticks_ = ticks;
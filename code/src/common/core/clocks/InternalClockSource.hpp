@@ -25,6 +25,7 @@ SOFTWARE.
 #pragma once
 
 #include "ClockSource.hpp"
+#include <cstddef>
 #include <cstdint>
 
 namespace kastle2
@@ -38,28 +39,49 @@ namespace kastle2
  * @date 2025-05-21
  */
 
-class InternalClockSource : public ClockSource
+class InternalClockSource final : public ClockSource
 {
 public:
     void Init(float sample_rate) override;
     void Start() override;
     void Stop() override;
     void Resume() override;
-    bool IsNowReset() const override;
+    inline bool IsNowReset() const override
+    {
+        return false;
+    }
     void SetSyncJackPlugged(bool jack_plugged) override;
     void SetPot(int32_t pot_value) override;
-    void Process(bool raw_sync_input, bool midi_pulse_input) override;
-    State GetState() const override;
+    void Process(const InputEdges &sync_input) override;
+    inline uint32_t GetTriggerFrame() const override
+    {
+        return 0;
+    }
+    inline State GetState() const override
+    {
+        return State::RUNNING;
+    }
     bool IsReachingNextCycle() const override;
     void SetTapTicks(uint32_t tap_ticks) override;
-    uint32_t GetTargetTicks() const override;
-    uint32_t GetCurrentTicks() const override;
+    inline uint32_t GetTargetTicks() const override
+    {
+        return target_ticks_;
+    }
+    inline uint32_t GetCurrentTicks() const override
+    {
+        return current_ticks_;
+    }
     void SaveToMemory() override;
     void LoadFromMemory() override;
     void TapResetsTicks(bool force) override;
     uint32_t GetTotalSteps() override;
 
 private:
+    /**
+     * @brief The tempo is stored in ticks of 48-frame blocks, so it survives a firmware with another block size.
+     */
+    static constexpr size_t kMemoryBlockSize = 48;
+
     uint32_t target_ticks_ = UINT32_MAX;
     uint32_t current_ticks_ = 0;
     uint32_t total_ticks_ = 0;
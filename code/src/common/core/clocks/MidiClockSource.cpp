@@ -23,8 +23,11 @@ SOFTWARE.
 */
 
 #include "MidiClockSource.hpp"
+
+#include <algorithm>
 #include "common/core/Kastle2.hpp"
 #include "common/core/Kastle2_parameters.hpp"
+#include "common/debug/Trace.hpp"
 #include "common/dsp/math/math_utils.hpp"
 
 namespace kastle2
@@ -52,14 +55,25 @@ uint32_t MidiClockSource::GetTotalSteps()
 void MidiClockSource::Start()
 {
     state_ = State::RUNNING;
+    Trace::Emit<TraceLevel::EVENT>(TracePoint::MIDI_CLOCK_START);
+
+    // The counters are reset in Process(), after the pulses that came before
+    pulses_.Push({.frame = 0, .start = true});
+}
+
+void MidiClockSource::Restart()
+{
     midi_beat_count_ = 0;
     midi_beat_total_ = 0;
     current_ticks_ = 0;
-    midi_ticks_ = 0;
-    prev_midi_ticks_ = 0;
+    fire_count_ = 0;
     first_sync_signal = true;
-    just_started_ = true;
-    now_reset_ = false;
+    now_reset_ = true;
+}
+
+void MidiClockSource::AddPulse(const uint32_t frame)
+{
+    pulses_.Push({.frame = frame, .start = false});
 }
 
 void MidiClockSource::Stop()
@@ -72,11 +86,6 @@ void MidiClockSource::Resume()
     state_ = State::RUNNING;
 }
 
-bool MidiClockSource::IsNowReset() const
-{
-    return now_reset_;
-}
-
 void MidiClockSource::SetSyncJackPlugged([[maybe_unused]] bool jack_plugged)
 {
 }
@@ -86,27 +95,92 @@ bool MidiClockSource::IsReachingNextCycle() const
     return current_ticks_ + 3 >= GetTargetTicks();
 }
 
-bool MidiClockSource::ClockNotArriving()
+bool MidiClockSource::ClockNotArriving() const
+{
+    if (!dll_locked_)
+    {
+        return false;
+    }
+    const uint32_t period = static_cast<uint32_t>(dll_period_) >> kFrameShift;
+    const uint32_t timeout = std::max(kUnavailableAfterMultiplier * period, kUnavailableMinFrames);
+    return Kastle2::GetAudioFrame() - last_pulse_frame_ >= timeout;
+}
+
+uint32_t MidiClockSource::FilterPulse(const uint32_t frame)
+{
+    const uint32_t time = frame << kFrameShift;
+    const uint32_t interval = frame - last_pulse_frame_;
+    const bool had_pulse = has_pulse_;
+    has_pulse_ = true;
+    last_pulse_frame_ = frame;
+
+    if (dll_locked_)
+    {
+        // Within half a period it's jitter, otherwise the tempo jumped or pulses got lost
+        const int32_t error = static_cast<int32_t>(time - dll_time_);
+        const int32_t half_period = dll_period_ / 2;
+        if (error < half_period && error > -half_period)
+        {
+            // The prediction is the filtered time of this pulse
+            const uint32_t filtered = dll_time_;
+            Trace::Emit<TraceLevel::VERBOSE>(TracePoint::MIDI_CLOCK_PULSE, frame, error);
+            // In 64 bits, a half period at the lowest tempos times kDllB doesn't fit 32 bits
+            const int32_t correction = static_cast<int32_t>(std::clamp<int64_t>((static_cast<int64_t>(error) * kDllB) >> 12, -half_period, half_period));
+            dll_time_ += static_cast<uint32_t>(dll_period_ + correction);
+            // Not longer than the longest interval it locks to
+            constexpr int32_t kMaxPeriod = static_cast<int32_t>(SAMPLE_RATE) << kFrameShift;
+            dll_period_ = std::clamp<int32_t>(dll_period_ + (error >> kDllCShift), 1, kMaxPeriod);
+            return filtered >> kFrameShift;
+        }
+    }
+
+    // (Re)lock to the SyncLink master's tempo, right from its first pulse, otherwise to the last interval
+    const int32_t master_period = MasterPeriod();
+    dll_locked_ = master_period > 0 || (had_pulse && interval > 0 && interval <= SAMPLE_RATE);
+    Trace::Emit<TraceLevel::WARNING>(TracePoint::MIDI_CLOCK_LOCK, interval, dll_locked_);
+    if (dll_locked_)
+    {
+        dll_period_ = master_period > 0 ? master_period : static_cast<int32_t>(interval << kFrameShift);
+        dll_time_ = time + static_cast<uint32_t>(dll_period_);
+    }
+    return frame;
+}
+
+int32_t MidiClockSource::MasterPeriod() const
 {
-    return (
-        prev_midi_ticks_ > 0 &&
-        midi_ticks_ >= kUnavailableAfterMultiplier * prev_midi_ticks_ &&
-        midi_ticks_ > 48 // To avoid glitching when clock too fast
-    );
+    // Microseconds with 4 fractional bits to frames with kFrameShift ones, 0 without a locked master
+    const uint64_t period_us = Kastle2::sync_link.GetMasterPulsePeriodUs();
+    const uint64_t period = period_us * static_cast<uint32_t>(SAMPLE_RATE) * (1u << kFrameShift) / (16 * 1000000);
+    return period <= (static_cast<uint64_t>(SAMPLE_RATE) << kFrameShift) ? static_cast<int32_t>(period) : 0;
 }
 
-void MidiClockSource::Process([[maybe_unused]] bool raw_sync_input, bool midi_pulse_input)
+uint32_t MidiClockSource::PulseTicks(const uint32_t pulses) const
+{
+    constexpr uint32_t kBlock = AUDIO_BUFFER_SIZE << kFrameShift;
+    return (static_cast<uint32_t>(dll_period_) * pulses + kBlock / 2) / kBlock;
+}
+
+void MidiClockSource::Process([[maybe_unused]] const InputEdges &sync_input)
 {
     now_reset_ = false;
-    if (just_started_)
+    trigger_frame_ = 0;
+
+    // Filter the new pulses, they fire after the MIDI latency
+    Pulse pulse;
+    while (fire_count_ < fire_frames_.size() && pulses_.Pop(pulse))
     {
-        now_reset_ = true;
-        just_started_ = false;
+        if (pulse.start)
+        {
+            Restart();
 
-        // We don't want to increment the ticks
-        // on the first clock signal etc.
-        return;
-    };
+            // We don't want to increment the ticks
+            // on the first clock signal etc.
+            return;
+        }
+        const size_t index = (fire_head_ + fire_count_) % fire_frames_.size();
+        fire_frames_[index] = FilterPulse(pulse.frame) + Kastle2::kMidiLatencyFrames + Kastle2::sync_link.GetPulseDelayFrames();
+        ++fire_count_;
+    }
 
     // For regular tempo calculation
     if (current_ticks_ < UINT32_MAX)
@@ -114,68 +188,74 @@ void MidiClockSource::Process([[maybe_unused]] bool raw_sync_input, bool midi_pu
         ++current_ticks_;
     }
 
-    // Just for detecting whether the clock is running
-    if (midi_ticks_ < UINT32_MAX)
-    {
-        ++midi_ticks_;
-    }
-
     // Are we getting clock?
     if (state_ == State::RUNNING && ClockNotArriving())
     {
         state_ = State::UNAVAILABLE;
         Kastle2::midi.ReportDisconnected();
+        Trace::Emit<TraceLevel::WARNING>(TracePoint::MIDI_CLOCK_LOST, Kastle2::GetAudioFrame() - last_pulse_frame_);
+        return;
+    }
+
+    // Is a pulse due in this block? Late ones fire at its start, one per block
+    const uint32_t block_frame = Kastle2::GetAudioFrame();
+    if (fire_count_ == 0 ||
+        static_cast<int32_t>(fire_frames_[fire_head_] - (block_frame + AUDIO_BUFFER_SIZE)) >= 0)
+    {
         return;
     }
+    const int32_t pulse_frame = static_cast<int32_t>(fire_frames_[fire_head_] - block_frame);
+    fire_head_ = (fire_head_ + 1) % fire_frames_.size();
+    --fire_count_;
 
     // WE GOT A CLOCK SIGNAL!
-    if (midi_pulse_input)
+    // Divider change?
+    // Doing it here to avoid changing the divider in the middle of the cycle
+    if (next_midi_beat_divider_ != midi_beat_divider_)
     {
-        // Divider change?
-        // Doing it here to avoid changing the divider in the middle of the cycle
-        if (next_midi_beat_divider_ != midi_beat_divider_)
+        midi_beat_divider_ = next_midi_beat_divider_;
+        if (dll_locked_)
         {
-            midi_beat_divider_ = next_midi_beat_divider_;
-            target_ticks_ = midi_ticks_ * midi_beat_divider_;
-
-            if (midi_beat_total_ < UINT32_MAX)
-            {
-                // Realign the divider itself
-                midi_beat_count_ = midi_beat_total_ % midi_beat_divider_;
-
-                // Realign the sequencer position
-                Kastle2::base.GetSequencer().RealignTo(midi_beat_total_ / midi_beat_divider_);
-            }
+            target_ticks_ = PulseTicks(midi_beat_divider_);
         }
 
-        // Increment the ticks and total steps
-        ++midi_beat_count_;
         if (midi_beat_total_ < UINT32_MAX)
         {
-            ++midi_beat_total_;
+            // Realign the divider itself
+            midi_beat_count_ = midi_beat_total_ % midi_beat_divider_;
+
+            // Realign the sequencer position
+            Kastle2::base.GetSequencer().RealignTo(midi_beat_total_ / midi_beat_divider_);
         }
+    }
+
+    // Increment the ticks and total steps
+    ++midi_beat_count_;
+    if (midi_beat_total_ < UINT32_MAX)
+    {
+        ++midi_beat_total_;
+    }
 
-        // We reached the next cycle...
-        if (midi_beat_count_ >= midi_beat_divider_)
+    // We reached the next cycle...
+    if (midi_beat_count_ >= midi_beat_divider_)
+    {
+        if (!first_sync_signal)
         {
-            if (!first_sync_signal)
+            // The filtered tempo, the counted blocks jitter by one
+            target_ticks_ = dll_locked_ ? PulseTicks(midi_beat_divider_) : current_ticks_;
+
+            // Some devices send clock even if stopped, we need to set it to running
+            // only when UNAVAILABLE on startup
+            if (state_ == State::UNAVAILABLE)
             {
-                prev_midi_ticks_ = midi_ticks_;
-                target_ticks_ = current_ticks_;
-
-                // Some devices send clock even if stopped, we need to set it to running
-                // only when UNAVAILABLE on startup
-                if (state_ == State::UNAVAILABLE)
-                {
-                    state_ = State::RUNNING;
-                }
+                state_ = State::RUNNING;
             }
-            midi_beat_count_ = 0;
-            current_ticks_ = 0;
         }
-        midi_ticks_ = 0;
-        first_sync_signal = false;
+        midi_beat_count_ = 0;
+        current_ticks_ = 0;
+        trigger_frame_ = pulse_frame > 0 ? static_cast<uint32_t>(pulse_frame) : 0;
     }
+    first_sync_signal = false;
 }
 
 void MidiClockSource::TapResetsTicks([[maybe_unused]] bool force)
@@ -203,7 +283,7 @@ void MidiClockSource::SetTapTicks(uint32_t tap_ticks)
     for (auto divider : kMidiTempoDividers)
     {
         // Are we close to tap ticks?
-        uint32_t result = diff(prev_midi_ticks_ * divider, tap_ticks);
+        uint32_t result = diff(PulseTicks(divider), tap_ticks);
         if (result < min_diff)
         {
             min_diff = result;
@@ -213,21 +293,6 @@ void MidiClockSource::SetTapTicks(uint32_t tap_ticks)
     SetDivider(closest_divider);
 }
 
-uint32_t MidiClockSource::GetTargetTicks() const
-{
-    return target_ticks_;
-}
-
-uint32_t MidiClockSource::GetCurrentTicks() const
-{
-    return current_ticks_;
-}
-
-ClockSource::State MidiClockSource::GetState() const
-{
-    return state_;
-}
-
 void MidiClockSource::SaveToMemory()
 {
     Kastle2::memory.QueueUpdate8(Memory::ADDR_CLOCK_MIDI_DIVIDER, midi_beat_divider_);
@@ -24,8 +24,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include "common/core/Kastle2_parameters.hpp"
+#include "common/core/MultiCoreQueue.hpp"
 #include "ClockSource.hpp"
 
 namespace kastle2
@@ -37,29 +39,65 @@ namespace kastle2
  * @brief Handles both USB MIDI and TRS MIDI (on Citadel) clock sources.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2025-05-21
+ *
+ * The MIDI clock bytes come with their arrival frames (AddPulse()). A delay-locked loop (DLL) filters them
+ * into a steady pulse period and phase, so the USB and UART delivery jitter doesn't move the clock.
+ * Each pulse fires kMidiLatencyFrames after its filtered time, at its frame in the audio block.
+ * A SyncLink follower fires them later still, by the master's lead after its link latency.
  */
 
-class MidiClockSource : public ClockSource
+class MidiClockSource final : public ClockSource
 {
 public:
     void Init(float sample_rate) override;
     void Start() override;
     void Stop() override;
     void Resume() override;
-    bool IsNowReset() const override;
+    inline bool IsNowReset() const override
+    {
+        return now_reset_;
+    }
     void SetSyncJackPlugged(bool jack_plugged) override;
     void SetPot(int32_t pot_value) override;
-    void Process(bool raw_sync_input, bool midi_pulse_input) override;
-    State GetState() const override;
+    void Process(const InputEdges &sync_input) override;
+    inline uint32_t GetTriggerFrame() const override
+    {
+        return trigger_frame_;
+    }
+    inline State GetState() const override
+    {
+        return state_;
+    }
     bool IsReachingNextCycle() const override;
     void SetTapTicks(uint32_t tap_ticks) override;
-    uint32_t GetTargetTicks() const override;
-    uint32_t GetCurrentTicks() const override;
+    inline uint32_t GetTargetTicks() const override
+    {
+        return target_ticks_;
+    }
+    inline uint32_t GetCurrentTicks() const override
+    {
+        return current_ticks_;
+    }
     void SaveToMemory() override;
     void LoadFromMemory() override;
     void TapResetsTicks(bool force) override;
     uint32_t GetTotalSteps() override;
 
+    /**
+     * @brief Adds an incoming MIDI clock pulse, call it from the UI loop (MIDI callback)
+     * @param frame Audio frame at which the pulse arrived, see Kastle2::TimeToAudioFrame()
+     */
+    void AddPulse(uint32_t frame);
+
+    /**
+     * @brief Filtered period of the MIDI clock pulses
+     * @return Period in audio frames with 8 fractional bits, 0 until the DLL locks
+     */
+    inline uint32_t GetPulsePeriod() const
+    {
+        return dll_locked_ ? static_cast<uint32_t>(dll_period_) : 0;
+    }
+
 private:
     uint32_t midi_beat_divider_ = kMidiTempoDividerDefault;
     uint32_t next_midi_beat_divider_ = kMidiTempoDividerDefault;
@@ -70,16 +108,42 @@ private:
     uint32_t target_ticks_ = 0;
 
     bool now_reset_ = false;
-    bool just_started_ = false;
 
     State state_ = State::UNAVAILABLE;
     bool first_sync_signal = true;
 
-    uint32_t midi_ticks_ = 0;
-    uint32_t prev_midi_ticks_ = 0;
     static constexpr uint32_t kUnavailableAfterMultiplier = 4;
-
-    inline bool ClockNotArriving();
+    static constexpr uint32_t kUnavailableMinFrames = SAMPLE_RATE / 20; ///< Jitter of a fast clock is not a disconnect
+
+    // DLL, times and periods in frames with 8 fractional bits
+    static constexpr uint32_t kFrameShift = 8;
+    static constexpr int32_t kDllB = 362;   ///< sqrt(2) * w in 12 bits, w = 0.0625 per pulse
+    static constexpr int32_t kDllCShift = 8; ///< w * w = 1 / 256
+    bool dll_locked_ = false;
+    uint32_t dll_time_ = 0;  ///< Predicted time of the next pulse
+    int32_t dll_period_ = 0; ///< Filtered pulse period
+    bool has_pulse_ = false;
+    uint32_t last_pulse_frame_ = 0; ///< Arrival frame of the last pulse
+
+    // Pulses from the UI loop in the arrival order, Start() is queued with them so it doesn't count the earlier ones
+    struct Pulse
+    {
+        uint32_t frame;
+        bool start;
+    };
+    MultiCoreQueue<Pulse, 16> pulses_;
+
+    // Filtered pulses waiting for their block
+    std::array<uint32_t, 8> fire_frames_ = {};
+    size_t fire_head_ = 0;
+    size_t fire_count_ = 0;
+    uint32_t trigger_frame_ = 0;
+
+    inline bool ClockNotArriving() const;
+    uint32_t FilterPulse(uint32_t frame);
+    int32_t MasterPeriod() const; ///< The SyncLink master's pulse period in the DLL units, 0 if none
+    uint32_t PulseTicks(uint32_t pulses) const;
+    void Restart();
     void SetDivider(const uint32_t divider);
 };
 
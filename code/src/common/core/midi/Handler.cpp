@@ -24,9 +24,13 @@ SOFTWARE.
 */
 
 #include "Handler.hpp"
+#include <algorithm>
+#include <cstring>
+#include "hardware/irq.h"
 #include "hardware/uart.h"
 #include "common/core/Kastle2.hpp"
 #include "common/core/Kastle2_cc.hpp"
+#include "common/debug/Trace.hpp"
 
 using namespace kastle2;
 using namespace kastle2::midi;
@@ -34,10 +38,31 @@ using namespace kastle2::midi;
 // MIDI uses 31,250 baud rate
 #define MIDI_BAUD_RATE 31250
 #define MIDI_UART uart0
+#define MIDI_UART_IRQ UART0_IRQ
 #define MIDI_RX_PIN 1 // MIDI IN on GPIO1
 
+// Used by the interrupt handler
+static Handler *handler_instance = nullptr;
+
+// UART RX interrupt handler
+static void midi_uart_irq_handler()
+{
+    if (handler_instance != nullptr)
+    {
+        handler_instance->UartIrqHandler();
+    }
+}
+
+// A realtime message queued ahead is due
+static void midi_realtime_alarm_callback([[maybe_unused]] uint alarm_num)
+{
+    UiScheduler::Post(UiScheduler::Event::MIDI_OUT);
+}
+
 void Handler::Init()
 {
+    handler_instance = this;
+
     // Initialize UART for MIDI
     uart_init(MIDI_UART, MIDI_BAUD_RATE);
 
@@ -47,92 +72,386 @@ void Handler::Init()
     // enable Tx and Rx fifos on UART
     uart_set_fifo_enabled(MIDI_UART, true);
 
+    // RX interrupt on the FIFO level or on the RX timeout, the bytes wait in uart_queue_ for Process()
+    irq_set_exclusive_handler(MIDI_UART_IRQ, midi_uart_irq_handler);
+    irq_set_enabled(MIDI_UART_IRQ, true);
+    uart_set_irq_enables(MIDI_UART, true, false);
+
     // Load MIDI channel from memory
     LoadFromMemory();
 
+    // Output queues
+    output_lock_ = spin_lock_instance(spin_lock_claim_unused(true));
+    usb_tokens_time_ = time_us_32();
+    realtime_alarm_ = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(static_cast<uint>(realtime_alarm_), midi_realtime_alarm_callback);
+
     // Set up the output CC cache and timing arrays
     for (size_t i = 0; i < output_cc_cache_.size(); ++i)
     {
         output_cc_cache_[i] = 255; // Initialize all CC values to 255 (=not set)
+        output_cc_pending_[i] = kNotPending;
 #if MIDI_CC_RATE_LIMIT
         output_cc_last_time_[i] = 0; // Initialize all last send times to 0
 #endif
     }
+    for (size_t i = 0; i < cc::HIGH_RES_COUNT; ++i)
+    {
+        output_cc14_pending_[i] = kValue14NotPending;
+        output_cc14_cache_[i] = kValue14NotPending;
+        input_cc_msb_[i] = kNotPending;
+    }
+}
+
+void Handler::UartIrqHandler()
+{
+    // Read before the FIFO is drained, which clears the timeout interrupt
+    const bool rx_timeout = (uart_get_hw(MIDI_UART)->mis & UART_UARTMIS_RTMIS_BITS) != 0;
+
+    // The FIFO holds up to 32 bytes, the last one read arrived just now (or the timeout ago) and the earlier ones a byte time apart each
+    std::array<uint8_t, 32> bytes;
+    size_t count = 0;
+    while (uart_is_readable(MIDI_UART) && count < bytes.size())
+    {
+        bytes[count++] = uart_getc(MIDI_UART);
+    }
+
+    const uint32_t now = time_us_32() - (rx_timeout ? kUartRxTimeoutUs : 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint32_t time_us = now - static_cast<uint32_t>(count - 1 - i) * kUartByteUs;
+        if (!uart_queue_.Push({.byte = bytes[i], .time_us = time_us}))
+        {
+            const uint32_t dropped = uart_dropped_ + 1;
+            uart_dropped_ = dropped;
+            Trace::Emit<TraceLevel::WARNING>(TracePoint::MIDI_UART_DROPPED, dropped);
+        }
+    }
+    UiScheduler::Post(UiScheduler::Event::UART);
 }
 
 void Handler::Process()
 {
     // Read MIDI messages
-    while (uart_is_readable(MIDI_UART)) // Handle UART MIDI (if there is any)
+    UartByte uart_byte;
+    while (uart_queue_.Pop(uart_byte)) // Handle UART MIDI (if there is any)
     {
-        uint8_t midi_byte_ = uart_getc(MIDI_UART);
+        ParseByte(trs_parser_, uart_byte.byte, uart_byte.time_us, Message::Source::TRS);
+    }
 
-        // Check if the byte is a status byte
-        if (midi_byte_ & 0x80)
+    // Handle USB MIDI (if there is any), the whole received packets at once. TinyUSB takes
+    // the bytes out of the packets by their CIN, so the SysEx data come without a call per packet
+    std::array<uint8_t, 64> usb_bytes;
+    uint32_t usb_count;
+    while (tud_midi_available() && (usb_count = tud_midi_stream_read(usb_bytes.data(), usb_bytes.size())) > 0)
+    {
+        const uint32_t now = time_us_32();
+        for (uint32_t i = 0; i < usb_count; i++)
         {
-            // Check if it's a realtime message
-            if ((midi_byte_ & Message::kRealTimeMask) == Message::kRealTimeMask)
-            {
-                std::array<uint8_t, 3> buff = {midi_byte_, 0, 0};
-                Message msg = Message::ParseFromTrs(buff);
-                Callbacks(&msg);
-            }
-            else // it's not a realtime message
+            ParseByte(usb_parser_, usb_bytes[i], now, Message::Source::USB);
+        }
+    }
+
+    // Send MIDI messages
+    ProcessOutput();
+}
+
+void Handler::ParseByte(Parser &parser, const uint8_t byte, const uint32_t time_us, const Message::Source source)
+{
+    if (byte & 0x80)
+    {
+        const Message::Status &status = Message::RetrieveStatus(byte);
+
+        // Real-time bytes can come anywhere, even between the data bytes of a message or in a SysEx,
+        // they are handled right away and the message being received continues after them
+        if ((byte & Message::kRealTimeMask) == Message::kRealTimeMask)
+        {
+            if (status.type != Message::Type::INVALID)
             {
-                msg_buffer_[0] = midi_byte_;
-                byte_counter_ = 0; // Reset byte counter
+                Receive({byte, 0, 0}, time_us, source);
             }
+            return;
         }
-        else
+
+        // Any other status byte ends a SysEx, the 0xF7 normally
+        if (parser.sysex.active)
         {
-            if (byte_counter_ == 0)
+            if (byte == static_cast<uint8_t>(Message::Type::SYSTEM_EXCLUSIVE_END))
             {
-                msg_buffer_[1] = midi_byte_;
-                byte_counter_ = 1; // Move to the next byte
+                PushSysExByte(parser.sysex, byte, source);
             }
-            else if (byte_counter_ == 1)
+            else
             {
-                msg_buffer_[2] = midi_byte_;
-                byte_counter_ = 2; // No more will come
+                Trace::Emit<TraceLevel::WARNING>(TracePoint::MIDI_SYSEX_CUT, byte, static_cast<int32_t>(source));
             }
+            EndSysEx(parser.sysex, source);
         }
 
-        if (byte_counter_ == Message::RetrieveNumBytes(msg_buffer_[0]))
+        // The system common messages and the SysEx cancel the running status, so do the undefined ones
+        parser.buffer = {static_cast<uint8_t>(status.channel_mask != 0 || status.data_bytes > 0 ? byte : 0), 0, 0};
+        parser.byte_counter = 0;
+        parser.data_bytes = status.data_bytes;
+
+        if (status.type == Message::Type::SYSTEM_EXCLUSIVE)
         {
-            // Reset the byte counter (this allows for Running Status to function properly)
-            byte_counter_ = 0;
+            parser.sysex.active = true;
+            parser.sysex.start = true;
+            parser.sysex.size = 0;
+            PushSysExByte(parser.sysex, byte, source);
+        }
+        else if (status.type == Message::Type::TUNE_REQUEST)
+        {
+            Receive({byte, 0, 0}, time_us, source);
+        }
+        return;
+    }
+
+    if (parser.sysex.active)
+    {
+        PushSysExByte(parser.sysex, byte, source);
+        return;
+    }
 
-            // Parse the message from the buffer
-            Message msg = Message::ParseFromTrs(msg_buffer_);
+    // Data byte without a status to belong to
+    if (parser.buffer[0] == 0)
+    {
+        return;
+    }
+
+    parser.buffer[1 + parser.byte_counter++] = byte;
+    if (parser.byte_counter == parser.data_bytes)
+    {
+        parser.byte_counter = 0;
+        const std::array<uint8_t, 3> data = parser.buffer;
 
-            // Call the base and app callback functions
-            Callbacks(&msg);
+        // The channel messages keep their status for the next data bytes (running status), the system ones don't
+        if (Message::RetrieveStatus(data[0]).channel_mask == 0)
+        {
+            parser.buffer[0] = 0;
         }
+
+        Receive(data, time_us, source);
+    }
+}
+
+void Handler::Receive(const std::array<uint8_t, 3> &data, const uint32_t time_us, const Message::Source source)
+{
+    Message msg = source == Message::Source::USB ? Message::ParseFromUsb({0, data[0], data[1], data[2]})
+                                                 : Message::ParseFromTrs(data);
+    msg.SetTime(time_us);
+    Trace::Emit<TraceLevel::VERBOSE>(TracePoint::MIDI_MESSAGE, data[0] | data[1] << 8 | data[2] << 16, static_cast<int32_t>(source));
+
+    // Call the base and app callback functions
+    Callbacks(&msg);
+}
+
+void Handler::PushSysExByte(SysExStream &stream, const uint8_t byte, const Message::Source source)
+{
+    if (sysex_callback_ == nullptr)
+    {
+        return;
+    }
+    // A full chunk is passed on with the next byte, so the end always comes with the last bytes (the 0xF7)
+    if (stream.size == stream.buffer.size())
+    {
+        sysex_callback_(stream.buffer.data(), stream.size, stream.start, false, source);
+        stream.size = 0;
+        stream.start = false;
     }
+    stream.buffer[stream.size++] = byte;
+}
 
-    while (tud_midi_available()) // Handle USB MIDI (if there is any)
+void Handler::EndSysEx(SysExStream &stream, const Message::Source source)
+{
+    stream.active = false;
+    if (sysex_callback_ != nullptr && stream.size > 0)
     {
-        std::array<uint8_t, 4> buff;
+        sysex_callback_(stream.buffer.data(), stream.size, stream.start, true, source);
+    }
+    stream.size = 0;
+    stream.start = false;
+}
 
-        // Read the USB MIDI message
-        tud_midi_packet_read(buff.data());
-        Message msg = Message::ParseFromUsb(buff);
+void Handler::ProcessOutput()
+{
+    // Kastle2 runs the UI tasks before Init()
+    if (output_lock_ == nullptr)
+    {
+        return;
+    }
 
-        // Call the base_and app callback functions
-        Callbacks(&msg);
+    // Refill the tokens, a full bucket doesn't save more for later
+    const uint32_t now = time_us_32();
+    const uint32_t refill = (now - usb_tokens_time_) / kUsbMessageUs;
+    usb_tokens_time_ += refill * kUsbMessageUs;
+    usb_tokens_ = std::min(usb_tokens_ + refill, kUsbBurst);
+    if (usb_tokens_ == kUsbBurst)
+    {
+        usb_tokens_time_ = now;
     }
 
-    // Send MIDI messages
-    while (!output_midi_buffer_.IsEmpty())
+#if MIDI_CC_RATE_LIMIT
+    const uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+#endif
+
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+
+    // Realtime messages are one byte each, they don't wait for the tokens, only for their time
+    while (!output_realtime_buffer_.IsEmpty() && usb_batch_size_ < usb_batch_.size() &&
+           static_cast<int32_t>(output_realtime_buffer_.Front()->time_us - now) <= 0)
+    {
+        AppendToBatch(output_realtime_buffer_.Pop()->packet);
+    }
+    ArmRealtimeAlarm();
+
+    // The rest in their order
+    while (!output_midi_buffer_.IsEmpty() && HasOutputRoom(1))
+    {
+        AppendToBatch(*output_midi_buffer_.Pop());
+        usb_tokens_--;
+    }
+
+    // The latest CC values, round robin so a sweeping controller can't starve the others
+    for (size_t i = 0; i < output_cc_pending_.size() && HasOutputRoom(1); i++)
+    {
+        const size_t controller = output_cc_next_;
+        output_cc_next_ = (output_cc_next_ + 1) % output_cc_pending_.size();
+        if (output_cc_pending_[controller] == kNotPending)
+        {
+            continue;
+        }
+#if MIDI_CC_RATE_LIMIT
+        // Too soon after the last send of this CC, the value waits
+        if (now_ms - output_cc_last_time_[controller] < kCcRateLimit)
+        {
+            continue;
+        }
+        output_cc_last_time_[controller] = now_ms;
+#endif
+        AppendCc(controller, output_cc_pending_[controller]);
+        output_cc_pending_[controller] = kNotPending;
+    }
+
+    // 14-bit CCs, the MSB and the LSB together
+    for (size_t i = 0; i < output_cc14_pending_.size() && HasOutputRoom(2); i++)
+    {
+        const size_t controller = output_cc14_next_;
+        output_cc14_next_ = (output_cc14_next_ + 1) % output_cc14_pending_.size();
+        const uint16_t value = output_cc14_pending_[controller];
+        if (value == kValue14NotPending)
+        {
+            continue;
+        }
+#if MIDI_CC_RATE_LIMIT
+        if (now_ms - output_cc_last_time_[controller] < kCcRateLimit)
+        {
+            continue;
+        }
+        output_cc_last_time_[controller] = now_ms;
+#endif
+        AppendCc(controller, value >> 7);
+        AppendCc(controller + cc::LSB_OFFSET, value & 0x7F);
+        output_cc14_pending_[controller] = kValue14NotPending;
+    }
+
+    // NRPNs, the parameter number only when it changes
+    for (size_t i = 0; i < output_nrpn_.size(); i++)
     {
-        auto packet = output_midi_buffer_.Pop();
-        if (packet.has_value())
+        NrpnSlot &slot = output_nrpn_[output_nrpn_next_];
+        const bool select = slot.parameter != output_nrpn_selected_;
+        if (slot.pending == kValue14NotPending)
+        {
+            output_nrpn_next_ = (output_nrpn_next_ + 1) % output_nrpn_.size();
+            continue;
+        }
+        if (!HasOutputRoom(select ? 4 : 2))
         {
-            tud_midi_packet_write(packet->data);
+            break;
         }
+        output_nrpn_next_ = (output_nrpn_next_ + 1) % output_nrpn_.size();
+#if MIDI_CC_RATE_LIMIT
+        if (now_ms - slot.time_ms < kCcRateLimit)
+        {
+            continue;
+        }
+        slot.time_ms = now_ms;
+#endif
+        if (select)
+        {
+            AppendCc(cc::NRPN_MSB, slot.parameter >> 7);
+            AppendCc(cc::NRPN_LSB, slot.parameter & 0x7F);
+            output_nrpn_selected_ = slot.parameter;
+        }
+        AppendCc(cc::DATA_ENTRY_MSB, slot.pending >> 7);
+        AppendCc(cc::DATA_ENTRY_LSB, slot.pending & 0x7F);
+        slot.pending = kValue14NotPending;
+    }
+
+    if (output_pitch_bend_pending_ != kPitchBendNotPending && HasOutputRoom(1))
+    {
+        Message msg = Message(
+            Message::Type::PITCH_BEND,
+            channel_,
+            output_pitch_bend_pending_ & 0x7F,         // LSB
+            (output_pitch_bend_pending_ >> 7) & 0x7F); // MSB
+        AppendToBatch(msg.GetUsbPacket(0));
+        output_pitch_bend_pending_ = kPitchBendNotPending;
+        usb_tokens_--;
+    }
+
+    spin_unlock(output_lock_, irq_state);
+
+    if (usb_batch_size_ == 0)
+    {
+        return;
+    }
+
+    // Not connected, the messages are dropped (they would be stale by then)
+    if (!tud_mounted())
+    {
+        usb_batch_size_ = 0;
+        return;
+    }
+
+    // TinyUSB takes what fits its FIFO, the rest is written next time (it keeps the state of a split message)
+    const uint32_t written = tud_midi_stream_write(0, usb_batch_.data(), usb_batch_size_);
+    usb_batch_size_ -= written;
+    if (usb_batch_size_ > 0)
+    {
+        std::memmove(usb_batch_.data(), usb_batch_.data() + written, usb_batch_size_);
     }
 }
 
+void Handler::AppendCc(const uint8_t controller, const uint8_t value)
+{
+    Message msg = Message(
+        Message::Type::CONTROL_CHANGE,
+        channel_,
+        controller,
+        value);
+    AppendToBatch(msg.GetUsbPacket(0));
+    usb_tokens_--;
+}
+
+bool Handler::SendSysEx(const uint8_t *data, const size_t size)
+{
+    // The batch is only touched from Process(), the SysEx goes after the messages already in it
+    if (usb_batch_size_ + size > usb_batch_.size())
+    {
+        return false;
+    }
+    std::memcpy(usb_batch_.data() + usb_batch_size_, data, size);
+    usb_batch_size_ += size;
+    return true;
+}
+
+void Handler::AppendToBatch(const Message::UsbPacket &packet)
+{
+    const size_t size = 1 + Message::RetrieveNumBytes(packet.data[1]);
+    std::memcpy(usb_batch_.data() + usb_batch_size_, packet.data + 1, size);
+    usb_batch_size_ += size;
+}
+
 void Handler::SetBaseCallback(Callback callback)
 {
     base_callback_ = callback;
@@ -143,6 +462,21 @@ void Handler::SetAppCallback(Callback callback)
     app_callback_ = callback;
 }
 
+void Handler::SetMonitorCallback(Callback callback)
+{
+    monitor_callback_ = callback;
+}
+
+void Handler::SetSysExCallback(SysExCallback callback)
+{
+    sysex_callback_ = callback;
+}
+
+void Handler::Inject(Message *midi_message)
+{
+    Callbacks(midi_message, true);
+}
+
 void Handler::StartLearning()
 {
     if (!learning_)
@@ -201,8 +535,20 @@ bool Handler::SetChannel(size_t channel)
     return false;
 }
 
-void Handler::Callbacks(Message *midi_message)
+void Handler::Callbacks(Message *midi_message, const bool injected)
 {
+    if (!injected)
+    {
+        if (input_muted_)
+        {
+            return;
+        }
+        if (monitor_callback_ != nullptr)
+        {
+            monitor_callback_(midi_message);
+        }
+    }
+
     uint8_t ch = midi_message->GetChannel();
 
     // Learning? Store the channel
@@ -220,6 +566,12 @@ void Handler::Callbacks(Message *midi_message)
         return;
     }
 
+    Deliver(midi_message);
+    ParseHighResolution(midi_message);
+}
+
+void Handler::Deliver(Message *midi_message)
+{
     // check for nullptr
     if (app_callback_ != nullptr)
     {
@@ -231,6 +583,86 @@ void Handler::Callbacks(Message *midi_message)
     }
 }
 
+void Handler::ParseHighResolution(Message *midi_message)
+{
+    if (!midi_message->IsControlChange())
+    {
+        return;
+    }
+
+    const uint8_t controller = midi_message->GetData1();
+    const uint8_t value = midi_message->GetData2();
+    switch (controller)
+    {
+    case cc::NRPN_MSB:
+        input_nrpn_msb_ = value;
+        input_nrpn_value_msb_ = kNotPending;
+        return;
+    case cc::NRPN_LSB:
+        input_nrpn_lsb_ = value;
+        input_nrpn_value_msb_ = kNotPending;
+        return;
+    case cc::RPN_MSB:
+    case cc::RPN_LSB:
+        input_nrpn_msb_ = kNotPending;
+        input_nrpn_lsb_ = kNotPending;
+        return;
+    case cc::DATA_ENTRY_MSB:
+    case cc::DATA_ENTRY_LSB:
+    {
+        if (input_nrpn_msb_ == kNotPending || input_nrpn_lsb_ == kNotPending)
+        {
+            return;
+        }
+        // The MSB alone is a value with the LSB 0, the LSB refines it
+        uint16_t nrpn_value = value << 7;
+        if (controller == cc::DATA_ENTRY_MSB)
+        {
+            input_nrpn_value_msb_ = value;
+        }
+        else if (input_nrpn_value_msb_ != kNotPending)
+        {
+            nrpn_value = (input_nrpn_value_msb_ << 7) | value;
+        }
+        else
+        {
+            return;
+        }
+        Message nrpn = Message::CreateNrpn(midi_message->GetChannel(), (input_nrpn_msb_ << 7) | input_nrpn_lsb_, nrpn_value);
+        nrpn.SetTime(midi_message->GetTime());
+        Deliver(&nrpn);
+        return;
+    }
+    case cc::RESET_CONTROLLERS:
+        input_cc_msb_.fill(kNotPending);
+        input_nrpn_msb_ = kNotPending;
+        input_nrpn_lsb_ = kNotPending;
+        input_nrpn_value_msb_ = kNotPending;
+        return;
+    default:
+        break;
+    }
+
+    // 14-bit CCs: the MSB is delivered as it is (GetValue14() with the LSB 0), the LSB again as the MSB controller
+    if (controller < cc::HIGH_RES_COUNT)
+    {
+        input_cc_msb_[controller] = value;
+    }
+    else if (controller < cc::HIGH_RES_COUNT + cc::LSB_OFFSET)
+    {
+        const uint8_t msb_controller = controller - cc::LSB_OFFSET;
+        if (input_cc_msb_[msb_controller] == kNotPending)
+        {
+            return;
+        }
+        Message msb = *midi_message;
+        msb.SetData1(msb_controller);
+        msb.SetData2(input_cc_msb_[msb_controller]);
+        msb.SetValue14((input_cc_msb_[msb_controller] << 7) | value);
+        Deliver(&msb);
+    }
+}
+
 void Handler::ReportDisconnected()
 {
     Message msg = Message(
@@ -246,10 +678,57 @@ bool Handler::Send(Message *midi_message)
     {
         return false; // Cannot send null message
     }
+    if (midi_message->IsNrpn())
+    {
+        return SendNrpn(midi_message->GetNrpnParameter(), midi_message->GetValue14());
+    }
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
     // Push the message to the output buffer
     // We aren't sending it immediately because it can come from different threads/callbacks etc.
     // The data is send in the Process() function
-    return output_midi_buffer_.Push(midi_message->GetUsbPacket(0));
+    const Message::UsbPacket packet = midi_message->GetUsbPacket(0);
+    const bool realtime = (packet.data[1] & Message::kRealTimeMask) == Message::kRealTimeMask;
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    const bool pushed = realtime ? output_realtime_buffer_.Push({.packet = packet, .time_us = time_us_32()})
+                                 : output_midi_buffer_.Push(packet);
+    spin_unlock(output_lock_, irq_state);
+    return pushed;
+}
+
+bool Handler::SendRealtime(const Message::Type type, const uint32_t time_us)
+{
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
+    Message msg = Message(type, channel_);
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    const bool first = output_realtime_buffer_.IsEmpty();
+    const bool pushed = output_realtime_buffer_.Push({.packet = msg.GetUsbPacket(0), .time_us = time_us});
+    if (pushed && first)
+    {
+        ArmRealtimeAlarm();
+    }
+    spin_unlock(output_lock_, irq_state);
+    return pushed;
+}
+
+void Handler::ArmRealtimeAlarm()
+{
+    if (output_realtime_buffer_.IsEmpty())
+    {
+        return;
+    }
+    // Returns true when the time has already passed, Process() runs with the next period then
+    const int32_t delay_us = static_cast<int32_t>(output_realtime_buffer_.Front()->time_us - time_us_32());
+    if (delay_us <= 0 ||
+        hardware_alarm_set_target(static_cast<uint>(realtime_alarm_), delayed_by_us(get_absolute_time(), delay_us)))
+    {
+        UiScheduler::Post(UiScheduler::Event::MIDI_OUT);
+    }
 }
 
 bool Handler::SendCc(const uint8_t controller, const uint8_t value, const bool force)
@@ -264,31 +743,85 @@ bool Handler::SendCc(const uint8_t controller, const uint8_t value, const bool f
     {
         return true;
     }
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
 
-#if MIDI_CC_RATE_LIMIT
-    // Check if enough time has passed since last send of this CC
-    uint32_t current_time = to_ms_since_boot(get_absolute_time());
-    if (!force && (current_time - output_cc_last_time_[controller] < kCcRateLimit))
+    // Load the value into the cache, the output sends the latest one (MIDI_CC_RATE_LIMIT apart)
+    output_cc_cache_[controller] = value;
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    output_cc_pending_[controller] = value;
+    spin_unlock(output_lock_, irq_state);
+    return true;
+}
+
+bool Handler::SendCc14(const uint8_t controller, const uint16_t value, const bool force)
+{
+    if (controller >= cc::HIGH_RES_COUNT || value > Message::kValue14Max)
     {
-        // Skip sending, too soon after last send
         return false;
     }
-#endif
 
-    // Load the value into the cache and update the timestamp
-    output_cc_cache_[controller] = value;
+    // No need to send if the value is the same as the last sent value
+    if (!force && output_cc14_cache_[controller] == value)
+    {
+        return true;
+    }
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
 
-#if MIDI_CC_RATE_LIMIT
-    output_cc_last_time_[controller] = current_time;
-#endif
+    output_cc14_cache_[controller] = value;
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    output_cc14_pending_[controller] = value;
+    spin_unlock(output_lock_, irq_state);
+    return true;
+}
 
-    // Create the MIDI message
-    Message msg = Message(
-        Message::Type::CONTROL_CHANGE,
-        channel_,
-        controller,
-        value);
-    return Send(&msg);
+bool Handler::SendNrpn(const uint16_t parameter, const uint16_t value, const bool force)
+{
+    if (parameter > Message::kValue14Max || value > Message::kValue14Max)
+    {
+        return false;
+    }
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
+
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    // The slot of the parameter, or a free one (one without a waiting value)
+    NrpnSlot *slot = nullptr;
+    for (auto &s : output_nrpn_)
+    {
+        if (s.parameter == parameter)
+        {
+            slot = &s;
+            break;
+        }
+        if (slot == nullptr && s.pending == kValue14NotPending)
+        {
+            slot = &s;
+        }
+    }
+    bool queued = slot != nullptr;
+    if (queued)
+    {
+        if (slot->parameter != parameter)
+        {
+            *slot = NrpnSlot{.parameter = parameter};
+        }
+        // No need to send if the value is the same as the last sent value
+        if (force || slot->cache != value)
+        {
+            slot->cache = value;
+            slot->pending = value;
+        }
+    }
+    spin_unlock(output_lock_, irq_state);
+    return queued;
 }
 
 bool Handler::SendNoteOn(const uint8_t note, const uint8_t velocity)
@@ -335,17 +868,17 @@ bool Handler::SendPitchBend(const int32_t value, const bool force, const uint32_
     {
         return true;
     }
+    if (output_lock_ == nullptr)
+    {
+        return false; // Not initialized yet
+    }
     output_pitch_bend_cache_ = value;
 
-    // Shift to 0-16383 range
-    uint16_t midi_value = static_cast<uint32_t>(value - Message::kPitchBendMin);
-
-    Message msg = Message(
-        Message::Type::PITCH_BEND,
-        channel_,
-        midi_value & 0x7F,         // LSB
-        (midi_value >> 7) & 0x7F); // MSB
-    return Send(&msg);
+    // Shift to 0-16383 range, the output sends the latest one
+    const uint32_t irq_state = spin_lock_blocking(output_lock_);
+    output_pitch_bend_pending_ = value - Message::kPitchBendMin;
+    spin_unlock(output_lock_, irq_state);
+    return true;
 }
 
 bool Handler::SendClockPulse()
@@ -354,6 +887,11 @@ bool Handler::SendClockPulse()
     return Send(&msg);
 }
 
+bool Handler::SendClockPulse(const uint32_t time_us)
+{
+    return SendRealtime(Message::Type::CLOCK, time_us);
+}
+
 bool Handler::SendClockStop()
 {
     Message msg = Message(Message::Type::STOP, channel_);
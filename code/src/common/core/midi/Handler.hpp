@@ -28,11 +28,14 @@ SOFTWARE.
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include "common/core/Kastle2_cc.hpp"
+#include "common/core/MultiCoreQueue.hpp"
 #include "common/dsp/utility/RingBuffer.hpp"
+#include "hardware/sync.h"
 #include "Message.hpp"
 #include "tusb.h"
 
-// Set this number to limit how often the same CC can be sent (in ms)
+// Set this number to limit how often the same CC can be sent (in ms), the latest value waits for it
 // Set to 0 to disable rate limiting
 #define MIDI_CC_RATE_LIMIT 2
 
@@ -48,6 +51,19 @@ namespace midi
  * @author Marek Mach (Bastl Instruments), Vaclav Mach (Bastl Instruments)
  * @date 2025-03-18
  * @note TinyUSB tud_init() and tud_task() are called in `Kastle2` class since they are used for multiple things.
+ *
+ * The output is sent in batches from Process(): the realtime messages (clock, start, stop) first, then the other
+ * messages in their order and then the CCs and the pitch bend. Those keep only their latest value until sent,
+ * so a parameter sweep can't overflow the output or delay the clock.
+ * The clock pulses can be queued ahead with their time (SendClockPulse(uint32_t)), a timer alarm wakes Process()
+ * when the first one is due, so the host gets it in the next USB frame, not with the block or the UI period.
+ *
+ * The 14-bit CCs (MSB 0-31, LSB at CC + 32) and the NRPNs are supported both ways. The incoming LSB is delivered
+ * again as its MSB controller with the full Message::GetValue14(), the NRPNs as Message::Type::NRPN messages. The USB port is limited by a token bucket
+ * (kUsbBurst messages, one per kUsbMessageUs) and the batch is written with one tud_midi_stream_write().
+ *
+ * The UART input is parsed with the status table of Message, with the running status and the real-time bytes
+ * anywhere in a message. The SysEx messages of both inputs are streamed to the SetSysExCallback() sink in chunks.
  */
 class Handler
 {
@@ -58,6 +74,21 @@ public:
      */
     typedef void (*Callback)(Message *midi_message);
 
+    /**
+     * @brief Type definition for the SysEx sink, which gets the SysEx messages in chunks as they arrive
+     * @param data Raw bytes of the message, 0xF0 first and 0xF7 last (if the message wasn't cut by another status)
+     * @param size Number of bytes, 1 to kSysExChunkSize
+     * @param start The chunk starts the message (0xF0)
+     * @param end The chunk ends the message, complete if its last byte is 0xF7
+     * @param source TRS or USB, the messages of the two are streamed independently
+     */
+    typedef void (*SysExCallback)(const uint8_t *data, size_t size, bool start, bool end, Message::Source source);
+
+    /**
+     * @brief Maximum number of bytes passed to the SysEx sink at once
+     */
+    static constexpr size_t kSysExChunkSize = 32;
+
     /**
      * @brief MIDI learning states
      */
@@ -76,10 +107,25 @@ public:
     /**
      * @brief Listens for and processes the incoming MIDI messages
      * @details This function is called in the main loop to process incoming MIDI messages.
-     *          It handles both USB and UART MIDI messages.
+     *          It handles both USB and UART MIDI messages. The UART bytes come from the queue filled by the RX interrupt.
      */
     void Process();
 
+    /**
+     * @brief Handler for the UART RX interrupt - called from the global interrupt handler
+     * @details Moves the received bytes to the queue with their arrival times and wakes the UI (UiScheduler::Event::UART).
+     */
+    void UartIrqHandler();
+
+    /**
+     * @brief Number of UART bytes lost because the queue was full (Process() not called for too long)
+     * @return Dropped bytes since the start
+     */
+    uint32_t GetUartDroppedCount() const
+    {
+        return uart_dropped_;
+    }
+
     /**
      * @brief Sets the address of the Base-wide MIDI callback function
      * @param callback Pointer to the callback function
@@ -94,6 +140,35 @@ public:
      */
     void SetAppCallback(Callback callback);
 
+    /**
+     * @brief Sets a function that sees every received message first, before the channel filter (see InputRecorder)
+     * @param callback Pointer to the callback function, nullptr to remove it
+     */
+    void SetMonitorCallback(Callback callback);
+
+    /**
+     * @brief Sets the SysEx sink, nullptr ignores the SysEx messages
+     * @param callback Pointer to the callback function
+     * @details The sink is called from Process() with every full chunk and with the end of each message,
+     *          so the SysEx messages of any length pass without a message sized buffer.
+     */
+    void SetSysExCallback(SysExCallback callback);
+
+    /**
+     * @brief Handles a message as if it was received (channel filter, callbacks, high resolution parsing)
+     * @param midi_message The message, the monitor callback doesn't see it
+     */
+    void Inject(Message *midi_message);
+
+    /**
+     * @brief Ignores the received messages, only the injected ones are handled (replay)
+     * @param muted True to ignore the received messages
+     */
+    void SetInputMuted(const bool muted)
+    {
+        input_muted_ = muted;
+    }
+
     /**
      * @brief Reports that the MIDI interface is disconnected using int
      */
@@ -156,6 +231,7 @@ public:
      * @brief Writes a MIDI message to the output buffer
      * @param midi_message Pointer to the MIDI message to output
      * @note The message is not sent immediately, it is queued for sending in the Process() function.
+     *       Can be called from both cores and the audio interrupt.
      * @return True if the message was added to the send queue
      */
     bool Send(Message *midi_message);
@@ -164,11 +240,33 @@ public:
      * @brief Sends a MIDI CC message
      * @param controller The controller number (0-127)
      * @param value The value of the controller (0-127)
-     * @param force If true, the message will be sent even if the value is close to the last sent value
-     * @return True if the message was successfully sent (or not since it was cached), false otherwise
+     * @param force If true, the message will be sent even if the value is the same as the last sent value
+     * @return True if the value was queued (or not since it was cached), false for invalid values
+     * @note Replaces the value of the same controller still waiting in the output.
      */
     bool SendCc(const uint8_t controller, const uint8_t value, const bool force = false);
 
+    /**
+     * @brief Sends a 14-bit MIDI CC (the MSB controller, then the LSB one at controller + 32)
+     * @param controller The MSB controller number (0-31)
+     * @param value The 14-bit value (0 to Message::kValue14Max)
+     * @param force If true, the message will be sent even if the value is the same as the last sent value
+     * @return True if the value was queued (or not since it was cached), false for invalid values
+     * @note Replaces the value of the same controller still waiting in the output.
+     */
+    bool SendCc14(const uint8_t controller, const uint16_t value, const bool force = false);
+
+    /**
+     * @brief Sends a MIDI NRPN (the parameter number CCs, skipped if the same as the last one, and the data entry CCs)
+     * @param parameter The parameter number (0-16383)
+     * @param value The 14-bit value (0 to Message::kValue14Max)
+     * @param force If true, the message will be sent even if the value is the same as the last sent value
+     * @return True if the value was queued (or not since it was cached), false for invalid values
+     *         or if kNrpnSlots other parameters are waiting
+     * @note Replaces the value of the same parameter still waiting in the output.
+     */
+    bool SendNrpn(const uint16_t parameter, const uint16_t value, const bool force = false);
+
     /**
      * @brief Sends a MIDI Note On message
      * @param note The note number (0-127)
@@ -190,16 +288,34 @@ public:
      * @param value The pitch bend value (range: -8192 to 8191)
      * @param force If true, the message will be sent even if the value is close to the last sent value
      * @param min_diff Minimum difference between the last sent value and the new value to send the message (ignored if force is true)
-     * @return True if the message was added to the send queue
+     * @return True if the value was queued (or not since it was cached), false for invalid values
+     * @note Replaces the pitch bend still waiting in the output.
      */
     bool SendPitchBend(const int32_t value, const bool force = false, const uint32_t min_diff = 1);
 
+    /**
+     * @brief Sends a SysEx message over USB, with the next batch of Process()
+     * @param data The whole message, 0xF0 to 0xF7
+     * @param size Number of bytes
+     * @return True if the message fits the batch now
+     * @note Call from the UI loop only (the core which runs Process()), there is no TRS output.
+     */
+    bool SendSysEx(const uint8_t *data, const size_t size);
+
     /**
      * @brief Sends a MIDI Clock Pulse message
      * @return True if the message was added to the send queue
      */
     bool SendClockPulse();
 
+    /**
+     * @brief Sends a MIDI Clock Pulse message at the given time
+     * @param time_us time_us_32() time of the pulse, eg. Kastle2::AudioFrameToOutputTime(), past times are sent right away
+     * @return True if the message was added to the send queue
+     * @note The realtime messages keep their order, queue the pulses in their time order.
+     */
+    bool SendClockPulse(const uint32_t time_us);
+
     /**
      * @brief Sends a MIDI Clock Stop message
      * @return True if the message was added to the send queue
@@ -219,12 +335,111 @@ public:
     bool SendClockReset();
 
 private:
+    // SysEx message being received from one source, buffered up to a chunk for the sink
+    struct SysExStream
+    {
+        std::array<uint8_t, kSysExChunkSize> buffer;
+        size_t size = 0;
+        bool active = false;
+        bool start = false; ///< The buffered bytes start the message
+    };
+
+    // Byte stream parser of one input, buffer[0] is the running status (0 if none)
+    struct Parser
+    {
+        std::array<uint8_t, 3> buffer{0, 0, 0};
+        size_t byte_counter = 0;
+        size_t data_bytes = 0; ///< Of the status in buffer[0]
+        SysExStream sysex;
+    };
+
+    /**
+     * @brief Parses a byte of the MIDI stream (running status, the real-time bytes between the data bytes, SysEx)
+     * @param parser State of the input
+     * @param byte The received byte
+     * @param time_us time_us_32() at its arrival
+     * @param source TRS or USB
+     */
+    void ParseByte(Parser &parser, const uint8_t byte, const uint32_t time_us, const Message::Source source);
+
+    /**
+     * @brief Delivers a parsed message of the input
+     * @param data Status and data bytes
+     * @param time_us time_us_32() at the arrival of the last byte
+     * @param source TRS or USB
+     */
+    void Receive(const std::array<uint8_t, 3> &data, const uint32_t time_us, const Message::Source source);
+
+    /**
+     * @brief Adds a byte to the SysEx stream, passes the chunk to the sink when full
+     */
+    void PushSysExByte(SysExStream &stream, const uint8_t byte, const Message::Source source);
+
+    /**
+     * @brief Ends the SysEx message of the stream (0xF7 or another status byte) and passes the rest to the sink
+     */
+    void EndSysEx(SysExStream &stream, const Message::Source source);
+
     /**
      * @brief Calls the registered callbacks with the received MIDI message
      * @param midi_message Pointer to the received MIDI message
+     * @param injected From Inject(), not received (skips the mute and the monitor)
      * @details This function calls both the base and application callbacks with the received MIDI message.
      */
-    void Callbacks(Message *midi_message);
+    void Callbacks(Message *midi_message, const bool injected = false);
+
+    /**
+     * @brief Calls the app and base callbacks
+     * @param midi_message Pointer to the MIDI message
+     */
+    void Deliver(Message *midi_message);
+
+    /**
+     * @brief Assembles the 14-bit CCs and the NRPNs from the received CCs and delivers them
+     * @param midi_message Pointer to the received MIDI message (delivered already)
+     */
+    void ParseHighResolution(Message *midi_message);
+
+    /**
+     * @brief Whether the USB batch can take more messages now
+     * @param count Number of 3 byte messages
+     * @return There are the tokens and the space in the batch
+     */
+    bool HasOutputRoom(const uint32_t count) const
+    {
+        return usb_tokens_ >= count && usb_batch_size_ + 3 * count <= usb_batch_.size();
+    }
+
+    /**
+     * @brief Appends a CC to the USB batch and takes its token, check HasOutputRoom() first
+     * @param controller The controller number (0-127)
+     * @param value The value (0-127)
+     */
+    void AppendCc(const uint8_t controller, const uint8_t value);
+
+    /**
+     * @brief Moves the queued messages to the USB batch as the tokens allow and writes it
+     */
+    void ProcessOutput();
+
+    /**
+     * @brief Queues a realtime message, sent by Process() when its time comes
+     * @param type Realtime message type
+     * @param time_us time_us_32() time to send it at
+     * @return True if the message was added to the send queue
+     */
+    bool SendRealtime(const Message::Type type, const uint32_t time_us);
+
+    /**
+     * @brief Arms the alarm for the first waiting realtime message, call with output_lock_ held
+     */
+    void ArmRealtimeAlarm();
+
+    /**
+     * @brief Appends the bytes of a packet to the USB batch
+     * @param packet USB MIDI packet, the CIN byte is dropped
+     */
+    void AppendToBatch(const Message::UsbPacket &packet);
 
 #if MIDI_CC_RATE_LIMIT > 0
     // Minimum time interval between sending the same CC (in ms)
@@ -234,22 +449,91 @@ private:
     std::array<uint32_t, 128> output_cc_last_time_{};
 #endif
 
-    // MIDI parsing stuff
-    std::array<uint8_t, 3> msg_buffer_{0, 0, 0};
-    size_t byte_counter_ = 0;
+    // UART bytes from the RX interrupt, 128 bytes is ~40 ms of a saturated MIDI stream
+    struct UartByte
+    {
+        uint8_t byte;
+        uint32_t time_us; ///< time_us_32() at the arrival
+    };
+    static constexpr size_t kUartQueueSize = 128;
+    MultiCoreQueue<UartByte, kUartQueueSize> uart_queue_;
+    volatile uint32_t uart_dropped_ = 0;
+
+    // One byte at 31250 baud (start + 8 data + stop bits), for the arrival times of the bytes read together
+    static constexpr uint32_t kUartByteUs = 320;
+    // The RX timeout interrupt fires 32 bit times (at 31250 baud) after the last byte arrived
+    static constexpr uint32_t kUartRxTimeoutUs = 1024;
+
+    // MIDI parsing stuff, the USB packets are read as a byte stream too (tud_midi_stream_read)
+    Parser trs_parser_;
+    Parser usb_parser_;
+    SysExCallback sysex_callback_ = nullptr;
 
     // Callbacks when a MIDI message is received
     Callback base_callback_ = nullptr;
     Callback app_callback_ = nullptr;
+    Callback monitor_callback_ = nullptr;
+    bool input_muted_ = false;
 
     // Channel stuff
     size_t channel_ = Message::kAllChannels;
     size_t learning_channel_ = Message::kAllChannels;
     bool learning_ = false;
 
-    // Buffer for output MIDI messages
+    // Output queues, Send() is called from both cores and the audio interrupt, output_lock_ guards them
+    spin_lock_t *output_lock_ = nullptr;
+    struct TimedPacket
+    {
+        Message::UsbPacket packet;
+        uint32_t time_us; ///< time_us_32() to send it at
+    };
+    RingBuffer<TimedPacket, 16> output_realtime_buffer_;
+    int realtime_alarm_ = -1; ///< Timer alarm waking Process() for the realtime messages queued ahead
     RingBuffer<Message::UsbPacket, 32> output_midi_buffer_;
 
+    // Latest CC values (kNotPending if none) and pitch bend waiting in the output, sent round robin
+    static constexpr uint8_t kNotPending = 255;
+    std::array<uint8_t, 128> output_cc_pending_;
+    size_t output_cc_next_ = 0;
+    static constexpr int32_t kPitchBendNotPending = -1;
+    int32_t output_pitch_bend_pending_ = kPitchBendNotPending;
+
+    // 14-bit CCs waiting in the output (kValue14NotPending if none) and the last sent values
+    static constexpr uint16_t kValue14NotPending = 0xFFFF;
+    std::array<uint16_t, cc::HIGH_RES_COUNT> output_cc14_pending_;
+    std::array<uint16_t, cc::HIGH_RES_COUNT> output_cc14_cache_;
+    size_t output_cc14_next_ = 0;
+
+    // NRPNs waiting in the output, a slot keeps its parameter and last sent value after sending
+    static constexpr uint16_t kNrpnNone = 0xFFFF;
+    static constexpr size_t kNrpnSlots = 8;
+    struct NrpnSlot
+    {
+        uint16_t parameter = kNrpnNone;
+        uint16_t pending = kValue14NotPending;
+        uint16_t cache = kValue14NotPending;
+        uint32_t time_ms = 0; ///< Last send, for MIDI_CC_RATE_LIMIT
+    };
+    std::array<NrpnSlot, kNrpnSlots> output_nrpn_;
+    size_t output_nrpn_next_ = 0;
+    uint16_t output_nrpn_selected_ = kNrpnNone; // the receivers keep the selected parameter
+
+    // 14-bit CC and NRPN input, the received MSBs and the selected NRPN (kNotPending until received)
+    std::array<uint8_t, cc::HIGH_RES_COUNT> input_cc_msb_;
+    uint8_t input_nrpn_msb_ = kNotPending;
+    uint8_t input_nrpn_lsb_ = kNotPending;
+    uint8_t input_nrpn_value_msb_ = kNotPending;
+
+    // USB token bucket, the burst is what fits the TinyUSB TX FIFO (64 bytes, 16 packets)
+    static constexpr uint32_t kUsbBurst = 16;
+    static constexpr uint32_t kUsbMessageUs = 125;
+    uint32_t usb_tokens_ = kUsbBurst;
+    uint32_t usb_tokens_time_ = 0;
+
+    // Bytes not taken by TinyUSB yet, a full batch of messages (3 bytes each) and the realtime ones
+    std::array<uint8_t, 64> usb_batch_;
+    size_t usb_batch_size_ = 0;
+
     // Value of the last sent CC for each controller (0-127)
     std::array<uint8_t, 128> output_cc_cache_;
 
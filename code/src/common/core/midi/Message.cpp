@@ -29,61 +29,71 @@ SOFTWARE.
 using namespace kastle2;
 using namespace kastle2::midi;
 
-Message::Type Message::RetrieveType(const uint8_t message_first_byte)
+namespace
+{
+// Status table: the channel messages by their high nibble, the system ones by the whole byte
+constexpr std::array<Message::Status, 256> MakeStatusTable()
 {
-    Type type = Type::INVALID;
-    // System common messages
-    if ((message_first_byte & kSystemMessageMask) == kSystemMessageMask)
+    using Type = Message::Type;
+    std::array<Message::Status, 256> table{};
+    for (auto &entry : table)
     {
-        for (const uint8_t &message : kReservedMessages)
-        {
-            if (message_first_byte == message)
-            {
-                break;
-            }
-            type = static_cast<Type>(message_first_byte);
-        }
+        entry = {Type::INVALID, 0, 0};
     }
-    else
+
+    constexpr std::array<Message::Status, 7> kChannelMessages{{
+        {Type::NOTE_OFF, 2, 0x0F},
+        {Type::NOTE_ON, 2, 0x0F},
+        {Type::AFTER_TOUCH_POLY, 2, 0x0F},
+        {Type::CONTROL_CHANGE, 2, 0x0F},
+        {Type::PROGRAM_CHANGE, 1, 0x0F},
+        {Type::AFTER_TOUCH_GLOBAL, 1, 0x0F},
+        {Type::PITCH_BEND, 2, 0x0F},
+    }};
+    for (size_t i = 0; i < kChannelMessages.size(); i++)
     {
-        type = static_cast<Type>(message_first_byte & kSystemMessageMask);
+        for (size_t channel = 0; channel < 16; channel++)
+        {
+            table[0x80 + i * 16 + channel] = kChannelMessages[i];
+        }
     }
-    return type;
+
+    // 0xF4, 0xF5, 0xF9 and 0xFD are reserved and stay INVALID
+    table[0xF0] = {Type::SYSTEM_EXCLUSIVE, 0, 0};
+    table[0xF1] = {Type::TIME_CODE_QUARTER_FRAME, 1, 0};
+    table[0xF2] = {Type::SONG_POSITION, 2, 0};
+    table[0xF3] = {Type::SONG_SELECT, 1, 0};
+    table[0xF6] = {Type::TUNE_REQUEST, 0, 0};
+    table[0xF7] = {Type::SYSTEM_EXCLUSIVE_END, 0, 0};
+    table[0xF8] = {Type::CLOCK, 0, 0};
+    table[0xFA] = {Type::START, 0, 0};
+    table[0xFB] = {Type::CONTINUE, 0, 0};
+    table[0xFC] = {Type::STOP, 0, 0};
+    table[0xFE] = {Type::ACTIVE_SENSING, 0, 0};
+    table[0xFF] = {Type::SYSTEM_RESET, 0, 0};
+    return table;
 }
 
-uint32_t Message::RetrieveNumBytes(const uint8_t message_first_byte)
+constexpr std::array<Message::Status, 256> kStatusTable = MakeStatusTable();
+
+static_assert(kStatusTable[0x9F].type == Message::Type::NOTE_ON && kStatusTable[0x9F].data_bytes == 2);
+static_assert(kStatusTable[0xD3].type == Message::Type::AFTER_TOUCH_GLOBAL && kStatusTable[0xD3].data_bytes == 1);
+static_assert(kStatusTable[0xF5].type == Message::Type::INVALID && kStatusTable[0x7F].type == Message::Type::INVALID);
+}
+
+const Message::Status &Message::RetrieveStatus(const uint8_t status_byte)
 {
-    Type type = RetrieveType(message_first_byte);
-    switch (type)
-    {
-    // types with 2 data bytes
-    case Type::NOTE_ON:
-    case Type::NOTE_OFF:
-    case Type::AFTER_TOUCH_POLY:
-    case Type::CONTROL_CHANGE:
-    case Type::PITCH_BEND:
-    case Type::SYSTEM_EXCLUSIVE:
-    case Type::SONG_POSITION:
-        return 2;
-    // types with 1 data byte
-    case Type::PROGRAM_CHANGE:
-    case Type::AFTER_TOUCH_GLOBAL:
-    case Type::TIME_CODE_QUARTER_FRAME:
-    case Type::SONG_SELECT:
-        return 1;
-    // types with no data bytes
-    case Type::TUNE_REQUEST:
-    case Type::CLOCK:
-    case Type::START:
-    case Type::CONTINUE:
-    case Type::STOP:
-    case Type::ACTIVE_SENSING:
-    case Type::SYSTEM_RESET:
-    case Type::INVALID:
-        return 0;
-    };
+    return kStatusTable[status_byte];
+}
+
+Message::Type Message::RetrieveType(const uint8_t message_first_byte)
+{
+    return kStatusTable[message_first_byte].type;
+}
 
-    return 0;
+uint32_t Message::RetrieveNumBytes(const uint8_t message_first_byte)
+{
+    return kStatusTable[message_first_byte].data_bytes;
 }
 
 Message Message::ParseFromTrs(const std::array<uint8_t, 3> &data)
@@ -130,13 +140,9 @@ void Message::StoreChannelAndType()
 
 void Message::ParseChannelAndType()
 {
-    uint8_t channel = Message::kAllChannels;
-    if ((data_[0] & 0xF0) != 0xF0)
-    {
-        channel = data_[0] & 0x0F; // Extract channel from the first byte
-    }
-    type_ = RetrieveType(data_[0]);
-    channel_ = channel; // Set the channel
+    const Status &status = kStatusTable[data_[0]];
+    type_ = status.type;
+    channel_ = status.channel_mask != 0 ? (data_[0] & status.channel_mask) : kAllChannels;
 }
 
 Message::UsbPacket Message::GetUsbPacket(const uint8_t cable_number)
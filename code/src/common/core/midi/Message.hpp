@@ -68,6 +68,11 @@ public:
      */
     static constexpr int16_t kPitchBendMax = 8191;
 
+    /**
+     * @brief Maximum value of the 14-bit CC pairs and NRPNs
+     */
+    static constexpr uint16_t kValue14Max = 16383;
+
     /**
      * @enum Type
      * @brief MIDI message types, with corresponding values
@@ -93,6 +98,7 @@ public:
         STOP = 0xFC,                    ///< System Real Time - Stop
         ACTIVE_SENSING = 0xFE,          ///< System Real Time - Active Sensing
         SYSTEM_RESET = 0xFF,            ///< System Real Time - System Reset
+        NRPN = 0x01,                    ///< NRPN parameter change, assembled by the Handler from the CCs (not sent)
         INVALID = 0x00                  ///< For notifying errors
     };
 
@@ -119,6 +125,24 @@ public:
         uint8_t data[4]; ///< USB packet data (4 bytes)
     };
 
+    /**
+     * @struct Status
+     * @brief What a status byte starts, one entry of the 256 entry status table
+     */
+    struct Status
+    {
+        Type type;            ///< INVALID for the data bytes and the reserved status bytes
+        uint8_t data_bytes;   ///< Number of data bytes that follow (0 for the SysEx, which is variable)
+        uint8_t channel_mask; ///< 0x0F for the channel messages, 0 for the system ones
+    };
+
+    /**
+     * @brief Looks up the status byte in the status table
+     * @param status_byte Any byte, the data bytes (0-127) return an INVALID entry
+     * @return The type, the number of data bytes and the channel mask
+     */
+    static const Status &RetrieveStatus(const uint8_t status_byte);
+
     /**
      * @brief Returns the MIDI message type based on the first byte of the message
      * @param message_first_byte The first byte of the MIDI message
@@ -209,6 +233,50 @@ public:
         return data_[2];
     }
 
+    /**
+     * @brief Returns the 14-bit value of a CC or NRPN message
+     * @return 0 to kValue14Max, the CC value shifted up for messages without the LSB
+     * @note The Handler sets it for the CCs 0-31 when their LSB (CC + 32) arrives, and for the NRPNs.
+     */
+    inline uint16_t GetValue14() const
+    {
+        return has_value14_ ? value14_ : static_cast<uint16_t>(data_[2] << 7);
+    }
+
+    /**
+     * @brief Sets the 14-bit value of a CC or NRPN message
+     * @param value 0 to kValue14Max
+     */
+    void SetValue14(const uint16_t value)
+    {
+        value14_ = value;
+        has_value14_ = true;
+    }
+
+    /**
+     * @brief Returns the parameter number of an NRPN message
+     * @return 0 to 16383
+     */
+    inline uint16_t GetNrpnParameter() const
+    {
+        return nrpn_parameter_;
+    }
+
+    /**
+     * @brief Creates an NRPN message, as assembled by the Handler
+     * @param channel MIDI channel (0-15) or kAllChannels
+     * @param parameter The parameter number (0-16383)
+     * @param value The 14-bit value (0 to kValue14Max)
+     * @return The NRPN message
+     */
+    static Message CreateNrpn(const uint8_t channel, const uint16_t parameter, const uint16_t value)
+    {
+        Message msg(Type::NRPN, channel);
+        msg.nrpn_parameter_ = parameter;
+        msg.SetValue14(value);
+        return msg;
+    }
+
     /**
      * @brief Returns if the received message type is Note on
      * @return True if the message type is Note on and it has a non-zero velocity, false otherwise
@@ -281,6 +349,24 @@ public:
         return GetType() == Type::PITCH_BEND;
     }
 
+    /**
+     * @brief Returns if the received message type is a program change
+     * @return True if the message type is a program change, false otherwise
+     */
+    inline bool IsProgramChange() const
+    {
+        return GetType() == Type::PROGRAM_CHANGE;
+    }
+
+    /**
+     * @brief Returns if the message is an NRPN parameter change
+     * @return True if the message type is NRPN, false otherwise
+     */
+    inline bool IsNrpn() const
+    {
+        return GetType() == Type::NRPN;
+    }
+
     /**
      * @brief Returns the source of the MIDI message
      * @return The source of the MIDI message in Source enum format
@@ -290,6 +376,24 @@ public:
         return source_;
     }
 
+    /**
+     * @brief Returns when the MIDI message was received
+     * @return time_us_32() at the arrival of the last byte (TRS) or of the packet (USB), 0 if not received
+     */
+    inline uint32_t GetTime() const
+    {
+        return time_us_;
+    }
+
+    /**
+     * @brief Sets when the MIDI message was received
+     * @param time_us time_us_32() at the arrival
+     */
+    void SetTime(uint32_t time_us)
+    {
+        time_us_ = time_us;
+    }
+
     /**
      * @brief Sets the type of the MIDI message
      * @param type NoteOn etc.
@@ -345,12 +449,14 @@ public:
     UsbPacket GetUsbPacket(const uint8_t cable_number);
 
 private:
-    static constexpr std::array<uint8_t, 4> kReservedMessages{0xF4, 0xF5, 0xF9, 0xFD};
-
     Type type_ = Type::INVALID;
     uint8_t channel_ = kAllChannels;
     uint8_t data_[3] = {0, 0, 0};
     Source source_ = Source::NONE;
+    uint32_t time_us_ = 0;
+    uint16_t value14_ = 0;
+    uint16_t nrpn_parameter_ = 0;
+    bool has_value14_ = false;
 
     /**
      * @brief Parses the `type_` and `channel_` from the first byte of the MIDI message
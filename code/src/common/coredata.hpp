@@ -0,0 +1,56 @@
+/*
+MIT License
+
+Copyright (c) 2025 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+/**
+ * @file coredata.hpp
+ * @ingroup core
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ * @brief Places the hot state of one core in its own scratch SRAM bank.
+ *
+ * The main SRAM is striped over four banks shared by both cores and the DMA, so the audio
+ * loops of the two cores stall each other there. SCRATCH_X and SCRATCH_Y (4k each) are separate
+ * banks: data marked with CORE1_DATA goes to SCRATCH_X, data marked with CORE0_DATA to SCRATCH_Y.
+ *
+ * Only variables with static storage can be placed, so the marked state of an app is
+ * declared as static members and defined in the app's .cpp file. The sections are initialized
+ * at startup like regular .data, constructors run as usual.
+ *
+ * @note Each bank also holds the stack of its core (2k), the remaining 2k is shared by all marked data.
+ * The linker fails if that space overflows.
+ */
+
+/**
+ * @brief Places a variable in SCRATCH_X, next to the second core stack.
+ * Use for data accessed mostly by the second core.
+ */
+#define CORE1_DATA __attribute__((section(".scratch_x.core1")))
+
+/**
+ * @brief Places a variable in SCRATCH_Y, next to the main core stack.
+ * Use for data accessed mostly by the main core.
+ */
+#define CORE0_DATA __attribute__((section(".scratch_y.core0")))
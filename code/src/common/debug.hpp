@@ -42,6 +42,34 @@ namespace kastle2
 #define MEASURE_UI_LOOP 0
 #define MEASURE_ADC_CYCLE 0
 
+// Cycle counts of the audio path printed over USB serial (see Profiler), the host build turns it on
+#ifndef PROFILE_AUDIO_LOOP
+#define PROFILE_AUDIO_LOOP 0
+#endif
+
+// Binary records (profiler cycles, values, scope snippets) over SEGGER RTT (see Telemetry)
+#define TELEMETRY 0
+
+// Jitter of the I2S interrupt, the callback timing and the audio clock drift as Telemetry records (see AudioClockMonitor),
+// needs TELEMETRY
+#define AUDIO_CLOCK_TELEMETRY 0
+
+// Trace points of the core modules as Telemetry records (see Trace), the ones above the level compile to nothing:
+// 0 none, 1 errors, 2 warnings (lost clock, dropped bytes), 3 events (sync changes, taps), 4 verbose (every pulse)
+#define TRACE_LEVEL 0
+
+// Named probes of the signal chain captured for live inspection (see AudioProbes)
+#define AUDIO_PROBES 0
+
+// RAM usage (sections, heap, stacks) printed periodically over USB serial (see MemoryMonitor)
+#define REPORT_MEMORY_USAGE 0
+
+// Flash the bottom LED red when the audio callback misses its deadline
+#define SHOW_AUDIO_UNDERRUNS 0
+
+// Reset by the watchdog when the audio callback stops, the last blocks reported on the next boot (see PostMortem)
+#define AUDIO_WATCHDOG 1
+
 // Which debug output to use
 #define DEBUG_ONE_USING_SYNC_OUT 0
 #define DEBUG_ONE_USING_TX 1
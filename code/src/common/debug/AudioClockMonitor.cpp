@@ -0,0 +1,106 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AudioClockMonitor.hpp"
+#ifndef KASTLE2_HOST
+#include "hardware/structs/usb.h"
+#endif
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+FASTCODE void AudioClockMonitor::CountUsbFrames(const uint32_t irq_us)
+{
+#ifndef KASTLE2_HOST
+    // TinyUSB reads the frame numbers itself when it needs them
+    if (usb_hw->inte & USB_INTE_DEV_SOF_BITS)
+    {
+        return;
+    }
+    const uint32_t frame = usb_hw->sof_rd & USB_SOF_RD_BITS;
+    if (frame == usb_frame_)
+    {
+        return;
+    }
+    if (usb_started_)
+    {
+        // 11-bit frame number, a block is much shorter than its wrap (2 s)
+        usb_frames_ += (frame - usb_frame_) & USB_SOF_RD_BITS;
+        usb_us_ += irq_us - usb_last_us_;
+    }
+    usb_started_ = true;
+    usb_frame_ = frame;
+    usb_last_us_ = irq_us;
+#else
+    (void)irq_us;
+#endif
+}
+
+FASTCODE void AudioClockMonitor::CloseWindow()
+{
+    window_.i2s_us = i2s_us_;
+    window_.i2s_periods = irq_count_ - 1;
+    window_.usb_us = usb_us_;
+    window_.usb_frames = usb_frames_;
+
+    // The UI loop hasn't written the previous one, this one is dropped
+    if (!closed_ready_)
+    {
+        closed_ = window_;
+        closed_ready_ = true;
+    }
+    window_ = kEmptyWindow;
+}
+
+void AudioClockMonitor::Process()
+{
+    if constexpr (kEnabled)
+    {
+        if (!closed_ready_)
+        {
+            return;
+        }
+        const Window window = closed_;
+        closed_ready_ = false;
+
+        Telemetry::Clock(static_cast<uint8_t>(Stat::PERIOD), static_cast<int32_t>(window.period_min),
+                         static_cast<int32_t>(window.period_max));
+        Telemetry::Clock(static_cast<uint8_t>(Stat::START_LATENCY), static_cast<int32_t>(window.start.max),
+                         static_cast<int32_t>((window.start.sum << 4) / window.start.count));
+        Telemetry::Clock(static_cast<uint8_t>(Stat::DURATION), static_cast<int32_t>(window.duration.max),
+                         static_cast<int32_t>((window.duration.sum << 4) / window.duration.count));
+
+        // Positive when the clock runs fast, more periods or frames than the timer expects
+        const double i2s_rate = window.i2s_us > 0 ? window.i2s_periods * kBlockPeriodUs / window.i2s_us - 1.0 : 0.0;
+        Telemetry::Clock(static_cast<uint8_t>(Stat::I2S_RATE), static_cast<int32_t>(i2s_rate * 1e9),
+                         static_cast<int32_t>(window.i2s_us / 1000000));
+        if (window.usb_us > 0)
+        {
+            const double usb_rate = window.usb_frames * 1000.0 / window.usb_us - 1.0;
+            Telemetry::Clock(static_cast<uint8_t>(Stat::USB_RATE),
+                             static_cast<int32_t>(((1.0 + i2s_rate) / (1.0 + usb_rate) - 1.0) * 1e9),
+                             static_cast<int32_t>(usb_rate * 1e9));
+        }
+    }
+}
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "hardware/timer.h"
+#include "common/config.hpp"
+#include "common/debug.hpp"
+#include "common/debug/Telemetry.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AudioClockMonitor
+ * @ingroup debug
+ * @brief Jitter of the I2S interrupt, the callback timing and the drift of the audio clock, as Telemetry records.
+ * @details Kastle2::BeginAudioCallback() passes the time_us_32() of the DMA interrupt entry (I2S::GetIrqTime()),
+ *          the callback start and end are taken here. Each kWindowBlocks, Process() writes the window
+ *          as Type::CLOCK records (Stat is the id), decode them with scripts/telemetry_decode.py:
+ *          - PERIOD: shortest and longest time between the interrupts, in us (the jitter is the difference).
+ *          - START_LATENCY: longest time from the interrupt entry to the callback, in us, the average in 1/16 us.
+ *          - DURATION: longest callback, in us, the average in 1/16 us.
+ *          - I2S_RATE: error of the I2S block rate (derived from the system clock by the PIO dividers)
+ *            against the timer, in ppb (positive is fast), since the start, and the seconds measured.
+ *          - USB_RATE: error of the I2S against the USB frames (SOF of the host, 1 kHz) in ppb, and of the USB
+ *            frames against the timer. 0 until the host sends the frames.
+ *          The USB frames are counted from the SOF frame number of the controller at each interrupt, so their
+ *          ends are off by up to a block, the error shrinks with the time (~2 ppm after 20 minutes at 48 frames).
+ *          Enable it with AUDIO_CLOCK_TELEMETRY and TELEMETRY in debug.hpp. When disabled, all the calls compile to nothing.
+ * @note Reading the frame number acknowledges the SOF interrupt, it's skipped while TinyUSB has that interrupt enabled.
+ *       The ClockGovernor levels round the I2S dividers differently, so their switches move I2S_RATE.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class AudioClockMonitor
+{
+public:
+    /**
+     * @brief The CLOCK records, the record id (keep scripts/telemetry_decode.py in sync).
+     */
+    enum class Stat : uint8_t
+    {
+        PERIOD,        ///< Shortest and longest interrupt period, us
+        START_LATENCY, ///< Longest and average (1/16 us) time from the interrupt to the callback
+        DURATION,      ///< Longest and average (1/16 us) callback
+        I2S_RATE,      ///< I2S block rate against the timer in ppb, seconds measured
+        USB_RATE,      ///< I2S against the USB frames in ppb, USB frames against the timer in ppb
+    };
+
+    /**
+     * @brief Enabled by AUDIO_CLOCK_TELEMETRY and TELEMETRY in debug.hpp.
+     */
+    static constexpr bool kEnabled = AUDIO_CLOCK_TELEMETRY && TELEMETRY;
+
+    /**
+     * @brief Blocks per window, about a second.
+     */
+    static constexpr uint32_t kWindowBlocks = static_cast<uint32_t>(I2S_SAMPLE_RATE) / I2S::kAudioBufferSize;
+
+    /**
+     * @brief Nominal time between the interrupts.
+     */
+    static constexpr double kBlockPeriodUs = I2S::kAudioBufferSize * 1000000.0 / I2S_SAMPLE_RATE;
+
+    /**
+     * @brief Called at the start of the audio callback.
+     * @param irq_us time_us_32() of the DMA interrupt entry.
+     */
+    static inline void Begin(const uint32_t irq_us)
+    {
+        if constexpr (kEnabled)
+        {
+            callback_us_ = time_us_32();
+            Add(window_.start, callback_us_ - irq_us);
+            if (irq_count_ > 0)
+            {
+                const uint32_t period = irq_us - last_irq_us_;
+                i2s_us_ += period;
+                window_.period_min = period < window_.period_min ? period : window_.period_min;
+                window_.period_max = period > window_.period_max ? period : window_.period_max;
+            }
+            last_irq_us_ = irq_us;
+            irq_count_++;
+            CountUsbFrames(irq_us);
+        }
+        else
+        {
+            (void)irq_us;
+        }
+    }
+
+    /**
+     * @brief Called at the end of the audio callback, closes the window after kWindowBlocks.
+     */
+    static inline void End()
+    {
+        if constexpr (kEnabled)
+        {
+            Add(window_.duration, time_us_32() - callback_us_);
+            if (window_.duration.count >= kWindowBlocks)
+            {
+                CloseWindow();
+            }
+        }
+    }
+
+    /**
+     * @brief Writes the records of the closed window. Call from the UI loop.
+     */
+    static void Process();
+
+private:
+    /**
+     * @brief Longest and summed times of a window.
+     */
+    struct Times
+    {
+        uint32_t max;
+        uint32_t sum;
+        uint32_t count;
+    };
+
+    /**
+     * @brief Statistics of a window, the totals since the start at its end.
+     */
+    struct Window
+    {
+        uint32_t period_min;
+        uint32_t period_max;
+        Times start;
+        Times duration;
+        uint64_t i2s_us;      ///< Time from the first interrupt to the last one
+        uint32_t i2s_periods; ///< Interrupt periods in i2s_us
+        uint64_t usb_us;      ///< Time from the first USB frame change to the last one
+        uint32_t usb_frames;  ///< USB frames in usb_us
+    };
+
+    static constexpr Window kEmptyWindow = {UINT32_MAX, 0, {}, {}, 0, 0, 0, 0};
+
+    static inline void Add(Times &times, const uint32_t us)
+    {
+        times.max = us > times.max ? us : times.max;
+        times.sum += us;
+        times.count++;
+    }
+
+    /**
+     * @brief Counts the elapsed USB frames, seen at the interrupt.
+     */
+    static void CountUsbFrames(uint32_t irq_us);
+
+    /**
+     * @brief Copies the window for Process() and starts a new one.
+     */
+    static void CloseWindow();
+
+    static inline Window window_ = kEmptyWindow;
+    static inline Window closed_ = kEmptyWindow;
+    static inline volatile bool closed_ready_ = false;
+
+    static inline uint32_t callback_us_ = 0;
+    static inline uint32_t last_irq_us_ = 0;
+    static inline uint32_t irq_count_ = 0;
+    static inline uint64_t i2s_us_ = 0;
+
+    static inline bool usb_started_ = false; ///< A USB frame change has been seen
+    static inline uint32_t usb_frame_ = 0;   ///< Last frame number
+    static inline uint32_t usb_last_us_ = 0; ///< Interrupt time of the last change
+    static inline uint32_t usb_frames_ = 0;  ///< Frames since the first change
+    static inline uint64_t usb_us_ = 0;      ///< Time from the first change to the last one
+};
+
+}
@@ -0,0 +1,352 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "hardware/sync.h"
+#include "common/debug.hpp"
+#include "common/debug/Telemetry.hpp"
+#include "common/debug/UsbSerial.hpp"
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AudioProbes
+ * @ingroup debug
+ * @brief Named points of an app's signal chain, one of them captured to a ring buffer for live inspection.
+ * @details The app adds its probes once in Init() and taps the signal in the audio loop:
+ *          @code
+ *          probe_filter_ = Kastle2::probes.Add("filter");
+ *          ...
+ *          Kastle2::probes.TapBlock(probe_filter_, output, size);
+ *          @endcode
+ *          Only the selected probe is recorded. Arm() starts the capture, either at once or when the left
+ *          channel rises through a threshold, with kPretriggerFrames kept from before the trigger.
+ *          The finished capture is uploaded by Process(), as Telemetry scope records when TELEMETRY is on
+ *          (ids 2 * probe and 2 * probe + 1), otherwise as CSV lines over USB serial.
+ *          Over USB serial 'p' lists the probes and a digit captures that probe at once.
+ *          Enable it with AUDIO_PROBES in debug.hpp (the Probes alias). When disabled, the buffer is zero sized
+ *          and the taps compile to nothing.
+ * @note Tap from one place per block (core 0 or core 1, not both), the UI core only reads a finished capture.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+template <bool kEnabled>
+class AudioProbes
+{
+public:
+    /**
+     * @brief Capture start condition.
+     */
+    enum class Trigger
+    {
+        IMMEDIATE, ///< Start with the next tapped frame
+        RISING,    ///< Left channel rising through the threshold
+    };
+
+    /**
+     * @brief Returned by Add() when no more probes fit, its taps do nothing.
+     */
+    static constexpr uint8_t kNoProbe = 0xFF;
+
+    /**
+     * @brief Number of probes an app can add.
+     */
+    static constexpr size_t kMaxProbes = 8;
+
+    /**
+     * @brief Length of the capture in stereo frames.
+     */
+    static constexpr size_t kCaptureFrames = 1024;
+
+    /**
+     * @brief Frames before the trigger kept in the capture (RISING only).
+     */
+    static constexpr size_t kPretriggerFrames = kCaptureFrames / 4;
+
+    /**
+     * @brief Adds a named probe. Call from the app's Init().
+     * @param name Name printed in the capture, must stay valid (a string literal).
+     * @return Id for the taps, kNoProbe when full.
+     */
+    uint8_t Add(const char *name)
+    {
+        if constexpr (kEnabled)
+        {
+            for (size_t i = 0; i < count_; i++)
+            {
+                // The app was initialized again
+                if (names_[i] == name)
+                {
+                    return static_cast<uint8_t>(i);
+                }
+            }
+            if (count_ >= kMaxProbes)
+            {
+                return kNoProbe;
+            }
+            names_[count_] = name;
+            return static_cast<uint8_t>(count_++);
+        }
+        else
+        {
+            (void)name;
+            return kNoProbe;
+        }
+    }
+
+    /**
+     * @brief Selects the probe and starts a new capture. Call from the UI loop.
+     * @param probe Id returned by Add().
+     * @param trigger Start condition.
+     * @param threshold Level of the RISING trigger.
+     */
+    void Arm(const uint8_t probe, const Trigger trigger = Trigger::IMMEDIATE, const q15_t threshold = Q15_ZERO)
+    {
+        if constexpr (kEnabled)
+        {
+            if (probe >= count_ || state_ != State::IDLE)
+            {
+                return;
+            }
+            selected_ = probe;
+            threshold_ = threshold;
+            write_ = 0;
+            armed_frames_ = 0;
+            remaining_ = kCaptureFrames;
+            previous_ = Q15_MAX;
+            __dmb();
+            state_ = trigger == Trigger::IMMEDIATE ? State::TRIGGERED : State::ARMED;
+        }
+        else
+        {
+            (void)probe;
+            (void)trigger;
+            (void)threshold;
+        }
+    }
+
+    /**
+     * @brief Taps one frame of the signal.
+     * @param probe Id returned by Add().
+     */
+    inline void Tap(const uint8_t probe, const q15_t left, const q15_t right)
+    {
+        if constexpr (kEnabled)
+        {
+            if (probe == selected_ && (state_ == State::ARMED || state_ == State::TRIGGERED))
+            {
+                Record(left, right);
+            }
+        }
+        else
+        {
+            (void)probe;
+            (void)left;
+            (void)right;
+        }
+    }
+
+    /**
+     * @brief Taps a block of the signal.
+     * @param probe Id returned by Add().
+     * @param block Interleaved stereo frames.
+     * @param size Number of frames.
+     */
+    inline void TapBlock(const uint8_t probe, const q15_t *block, const size_t size)
+    {
+        if constexpr (kEnabled)
+        {
+            if (probe == selected_ && (state_ == State::ARMED || state_ == State::TRIGGERED))
+            {
+                for (size_t i = 0; i < size && state_ != State::DONE; i++)
+                {
+                    Record(block[2 * i], block[2 * i + 1]);
+                }
+            }
+        }
+        else
+        {
+            (void)probe;
+            (void)block;
+            (void)size;
+        }
+    }
+
+    /**
+     * @brief Returns true while a capture is armed, recording or being uploaded.
+     */
+    bool IsBusy() const
+    {
+        return state_ != State::IDLE;
+    }
+
+    /**
+     * @brief Handles the serial commands and uploads a finished capture, a chunk per call. Call from the UI loop.
+     * @param serial Serial for the commands and the CSV upload.
+     */
+    void Process(UsbSerial &serial)
+    {
+        if constexpr (kEnabled)
+        {
+            if (serial.ReceivedChar('p'))
+            {
+                char buff[48];
+                for (size_t i = 0; i < count_; i++)
+                {
+                    snprintf(buff, sizeof(buff), "Probe %u: %s", static_cast<unsigned>(i), names_[i]);
+                    serial.PrintLine(buff);
+                }
+            }
+            for (size_t i = 0; i < count_; i++)
+            {
+                if (serial.ReceivedChar(static_cast<char>('0' + i)))
+                {
+                    Arm(static_cast<uint8_t>(i));
+                }
+            }
+
+            if (state_ == State::DONE)
+            {
+                Upload(serial);
+            }
+        }
+        else
+        {
+            (void)serial;
+        }
+    }
+
+private:
+    enum class State : uint8_t
+    {
+        IDLE,      // Nothing selected, the taps return at once
+        ARMED,     // Recording the ring, waiting for the trigger
+        TRIGGERED, // Recording the rest of the capture
+        DONE,      // Capture finished, being uploaded
+    };
+
+    // Frames uploaded per Process() call
+    static constexpr size_t kUploadChunk = Telemetry::kEnabled ? Telemetry::kMaxScopeSamples : 16;
+    static constexpr size_t kStorageFrames = kEnabled ? kCaptureFrames : 0;
+
+    inline void Record(const q15_t left, const q15_t right)
+    {
+        frames_[write_][0] = static_cast<int16_t>(left);
+        frames_[write_][1] = static_cast<int16_t>(right);
+        write_ = write_ + 1 < kCaptureFrames ? write_ + 1 : 0;
+
+        if (state_ == State::ARMED)
+        {
+            // The pretrigger part has to be filled first
+            if (armed_frames_ < kPretriggerFrames)
+            {
+                armed_frames_++;
+            }
+            else if (previous_ < threshold_ && left >= threshold_)
+            {
+                remaining_ = kCaptureFrames - kPretriggerFrames - 1;
+                state_ = State::TRIGGERED;
+            }
+            previous_ = left;
+            return;
+        }
+
+        if (--remaining_ == 0)
+        {
+            // The oldest frame is at the write position
+            upload_start_ = write_;
+            upload_position_ = 0;
+            __dmb();
+            state_ = State::DONE;
+        }
+    }
+
+    void Upload(UsbSerial &serial)
+    {
+        const uint8_t probe = selected_;
+        if (upload_position_ == 0 && !Telemetry::kEnabled)
+        {
+            char buff[64];
+            snprintf(buff, sizeof(buff), "Probe %s: %u frames", names_[probe], static_cast<unsigned>(kCaptureFrames));
+            serial.PrintLine(buff);
+        }
+
+        std::array<std::array<int32_t, 2>, kUploadChunk> chunk;
+        for (size_t i = 0; i < kUploadChunk; i++)
+        {
+            const auto &frame = frames_[(upload_start_ + upload_position_ + i) % kCaptureFrames];
+            chunk[i] = {frame[0], frame[1]};
+        }
+        if constexpr (Telemetry::kEnabled)
+        {
+            Telemetry::Scope(static_cast<uint8_t>(2 * probe), &chunk[0][0], kUploadChunk, 2);
+            Telemetry::Scope(static_cast<uint8_t>(2 * probe + 1), &chunk[0][1], kUploadChunk, 2);
+        }
+        else
+        {
+            char buff[48];
+            for (size_t i = 0; i < kUploadChunk; i++)
+            {
+                snprintf(buff, sizeof(buff), "%u,%ld,%ld", static_cast<unsigned>(upload_position_ + i),
+                         static_cast<long>(chunk[i][0]), static_cast<long>(chunk[i][1]));
+                serial.PrintLine(buff);
+            }
+        }
+
+        upload_position_ += kUploadChunk;
+        if (upload_position_ >= kCaptureFrames)
+        {
+            state_ = State::IDLE;
+        }
+    }
+
+    std::array<const char *, kMaxProbes> names_ = {};
+    size_t count_ = 0;
+
+    std::array<std::array<int16_t, 2>, kStorageFrames> frames_;
+    volatile State state_ = State::IDLE;
+    volatile uint8_t selected_ = kNoProbe;
+    q15_t threshold_ = Q15_ZERO;
+    q15_t previous_ = Q15_MAX;
+    size_t write_ = 0;
+    size_t armed_frames_ = 0;
+    size_t remaining_ = 0;
+    size_t upload_start_ = 0;
+    size_t upload_position_ = 0;
+};
+
+/**
+ * @brief The probes of the firmware, enabled by AUDIO_PROBES in debug.hpp.
+ */
+using Probes = AudioProbes<AUDIO_PROBES>;
+
+}
@@ -0,0 +1,218 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#ifndef KASTLE2_HOST
+#include "hardware/structs/busctrl.h"
+#include "hardware/structs/xip_ctrl.h"
+#endif
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class BusCounters
+ * @ingroup debug
+ * @brief XIP cache hits and bus fabric contention of an app's audio block per mode.
+ * @details The app calls Begin() at the start of its audio block and Commit() with the mode when it's done,
+ *          the counters of the block are summed per mode:
+ *          - XIP cache hits and accesses, from the XIP controller counters (the cached flash reads only).
+ *          - Contested and all accesses of one SRAM bank, from the BUSCTRL perf counters. There are just four
+ *            counters, so the bank changes each block and goes through SRAM0 to SRAM5 (0-3 are striped main
+ *            memory, 4 and 5 the scratch banks with the core stacks).
+ *          - Contested XIP accesses, the other core or the DMA wanted the flash at the same time.
+ *          - Accesses of the fast peripherals (the PIO FIFOs the I2S and LED DMA feed), as the DMA bus usage,
+ *            the bus fabric doesn't count the accesses by master.
+ *          The counters count the accesses of both cores and the DMA, whoever runs at the time.
+ *          Send 'b' over USB serial to print the table, 'B' to clear it. A FASTCODE or FASTDATA move shows up
+ *          as fewer XIP accesses or a better hit rate, a table in the wrong bank as more contention.
+ * @note Owns the BUSCTRL perf counters. The host build has no counters, the table stays at zero.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+template <size_t kModes>
+class BusCounters
+{
+public:
+    static constexpr size_t kSramBanks = 6;
+
+    /**
+     * @brief Sums of one mode.
+     */
+    struct Entry
+    {
+        uint64_t xip_hits;                               ///< XIP cache hits
+        uint64_t xip_accesses;                           ///< Cached XIP accesses
+        uint64_t xip_contested;                          ///< XIP accesses which waited for another master
+        uint64_t fastperi_accesses;                      ///< PIO and other fast peripheral accesses
+        std::array<uint64_t, kSramBanks> sram_contested; ///< Contested accesses of each SRAM bank
+        std::array<uint64_t, kSramBanks> sram_accesses;  ///< All accesses of each SRAM bank
+        uint32_t blocks;                                 ///< Number of blocks measured in the mode
+    };
+
+    /**
+     * @param names Names of the modes for the report
+     */
+    explicit BusCounters(const std::array<const char *, kModes> &names) : names_(names)
+    {
+        entries_.fill(Entry{});
+    }
+
+    /**
+     * @brief Starts counting the block, call at the start of the audio loop.
+     */
+    inline void Begin()
+    {
+#ifndef KASTLE2_HOST
+        // The XIP counters are shared with FlashWriter, so they are not cleared, only the difference counts
+        xip_hits_start_ = xip_ctrl_hw->ctr_hit;
+        xip_accesses_start_ = xip_ctrl_hw->ctr_acc;
+
+        // Writing a counter clears it, they saturate at 24 bits which a block never reaches
+        bank_ = bank_ + 1 < kSramBanks ? bank_ + 1 : 0;
+        busctrl_hw->counter[0].sel = kSramContested[bank_];
+        busctrl_hw->counter[1].sel = kSramContested[bank_] + 1; // the access event follows the contested one
+        busctrl_hw->counter[2].sel = arbiter_xip_main_perf_event_access_contested;
+        busctrl_hw->counter[3].sel = arbiter_fastperi_perf_event_access;
+        for (auto &counter : busctrl_hw->counter)
+        {
+            counter.value = 0;
+        }
+#endif
+        started_ = true;
+    }
+
+    /**
+     * @brief Adds the counters of the block to the mode, call when both cores are done with the block.
+     * @param mode Mode the block ran in
+     */
+    inline void Commit(const size_t mode)
+    {
+        if (clear_)
+        {
+            entries_.fill(Entry{});
+            clear_ = false;
+        }
+        if (!started_)
+        {
+            return;
+        }
+        started_ = false;
+
+        Entry &entry = entries_[mode];
+#ifndef KASTLE2_HOST
+        entry.xip_hits += xip_ctrl_hw->ctr_hit - xip_hits_start_;
+        entry.xip_accesses += xip_ctrl_hw->ctr_acc - xip_accesses_start_;
+        entry.sram_contested[bank_] += busctrl_hw->counter[0].value;
+        entry.sram_accesses[bank_] += busctrl_hw->counter[1].value;
+        entry.xip_contested += busctrl_hw->counter[2].value;
+        entry.fastperi_accesses += busctrl_hw->counter[3].value;
+#endif
+        entry.blocks++;
+    }
+
+    /**
+     * @brief Clears the table at the next block.
+     */
+    void Clear()
+    {
+        clear_ = true;
+    }
+
+    /**
+     * @brief Prints the table on 'b' and clears it on 'B'. Call from the UI loop.
+     */
+    void Process(UsbSerial &serial)
+    {
+        if (serial.ReceivedChar('b'))
+        {
+            Print(serial);
+        }
+        if (serial.ReceivedChar('B'))
+        {
+            Clear();
+        }
+    }
+
+    /**
+     * @brief Prints the averages per block of each measured mode.
+     */
+    void Print(UsbSerial &serial) const
+    {
+        char buff[128];
+        serial.PrintLine("Bus: per block, XIP hit rate, contested XIP, PIO/DMA accesses, SRAM0-5 contested");
+        for (size_t mode = 0; mode < kModes; mode++)
+        {
+            const Entry entry = entries_[mode];
+            if (entry.blocks == 0)
+            {
+                continue;
+            }
+            int length = snprintf(buff, sizeof(buff), "%s: XIP %lu (%lu.%lu%% hits) contested %lu PIO %lu SRAM",
+                                  names_[mode],
+                                  static_cast<unsigned long>(entry.xip_accesses / entry.blocks),
+                                  static_cast<unsigned long>(Permille(entry.xip_hits, entry.xip_accesses) / 10),
+                                  static_cast<unsigned long>(Permille(entry.xip_hits, entry.xip_accesses) % 10),
+                                  static_cast<unsigned long>(entry.xip_contested / entry.blocks),
+                                  static_cast<unsigned long>(entry.fastperi_accesses / entry.blocks));
+            for (size_t bank = 0; bank < kSramBanks && length > 0 && static_cast<size_t>(length) < sizeof(buff); bank++)
+            {
+                const uint32_t permille = Permille(entry.sram_contested[bank], entry.sram_accesses[bank]);
+                length += snprintf(buff + length, sizeof(buff) - length, " %lu.%lu%%",
+                                   static_cast<unsigned long>(permille / 10), static_cast<unsigned long>(permille % 10));
+            }
+            serial.PrintLine(buff);
+        }
+    }
+
+private:
+    static uint32_t Permille(const uint64_t part, const uint64_t total)
+    {
+        return total > 0 ? static_cast<uint32_t>(part * 1000 / total) : 0;
+    }
+
+#ifndef KASTLE2_HOST
+    static constexpr std::array<uint32_t, kSramBanks> kSramContested = {
+        arbiter_sram0_perf_event_access_contested, arbiter_sram1_perf_event_access_contested,
+        arbiter_sram2_perf_event_access_contested, arbiter_sram3_perf_event_access_contested,
+        arbiter_sram4_perf_event_access_contested, arbiter_sram5_perf_event_access_contested};
+
+    uint32_t xip_hits_start_ = 0;
+    uint32_t xip_accesses_start_ = 0;
+#endif
+
+    std::array<const char *, kModes> names_;
+    std::array<Entry, kModes> entries_;
+    size_t bank_ = 0;
+    bool started_ = false;
+    volatile bool clear_ = false;
+};
+
+}
@@ -0,0 +1,194 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "InputRecorder.hpp"
+#include <algorithm>
+
+using namespace kastle2;
+
+void InputRecorder::StartRecording(std::span<Frame> frames, std::span<MidiEvent> midi_events)
+{
+    frames_ = frames;
+    midi_events_ = midi_events;
+    recorded_frames_ = 0;
+    recorded_midi_ = 0;
+    mode_ = Mode::RECORDING;
+}
+
+void InputRecorder::StartReplay(const bool loop)
+{
+    if (GetFrameCount() == 0)
+    {
+        return;
+    }
+    loop_ = loop;
+    replay_frame_ = FirstFrame();
+    replay_midi_ = FirstMidi();
+    replayed_frames_ = 0;
+    mode_ = Mode::REPLAYING;
+}
+
+void InputRecorder::Stop()
+{
+    mode_ = Mode::IDLE;
+}
+
+size_t InputRecorder::GetFrameCount() const
+{
+    return recorded_frames_ - FirstFrame();
+}
+
+void InputRecorder::Process(Hardware &hw, midi::Handler &midi)
+{
+    if (mode_ != Mode::REPLAYING && overriding_)
+    {
+        Release(hw, midi);
+    }
+
+    if (mode_ == Mode::RECORDING)
+    {
+        CaptureFrame(hw);
+    }
+    else if (mode_ == Mode::REPLAYING)
+    {
+        ReplayFrame(hw, midi);
+    }
+}
+
+void InputRecorder::RecordMidi(const midi::Message &msg)
+{
+    if (mode_ != Mode::RECORDING || midi_events_.empty())
+    {
+        return;
+    }
+    midi_events_[recorded_midi_ % midi_events_.size()] = {.frame = recorded_frames_, .msg = msg};
+    recorded_midi_++;
+}
+
+uint32_t InputRecorder::FirstFrame() const
+{
+    return recorded_frames_ > frames_.size() ? recorded_frames_ - frames_.size() : 0;
+}
+
+uint32_t InputRecorder::FirstMidi() const
+{
+    return recorded_midi_ > midi_events_.size() ? recorded_midi_ - midi_events_.size() : 0;
+}
+
+void InputRecorder::CaptureFrame(Hardware &hw)
+{
+    if (frames_.empty())
+    {
+        return;
+    }
+
+    Hardware::InputSnapshot snapshot;
+    hw.GetInputSnapshot(snapshot);
+    // The edges before the recording don't count
+    if (recorded_frames_ == 0)
+    {
+        last_edges_ = snapshot.edges;
+    }
+
+    Frame &frame = frames_[recorded_frames_ % frames_.size()];
+    for (Hardware::AnalogInput input : EnumRange<Hardware::AnalogInput>())
+    {
+        frame.analog[input] = static_cast<int16_t>(snapshot.analog[input]);
+    }
+    frame.pitch_fine = snapshot.pitch_fine;
+    frame.gpio = snapshot.gpio;
+    for (Hardware::DigitalInput input : EnumRange<Hardware::DigitalInput>())
+    {
+        // More than 255 edges in one UI loop would be a few hundred kHz, they saturate
+        const uint32_t edges = std::min<uint32_t>(snapshot.edges[input] - last_edges_[input], UINT8_MAX);
+        frame.edges[input] = static_cast<uint8_t>(edges);
+        last_edges_[input] += edges;
+    }
+    recorded_frames_++;
+}
+
+void InputRecorder::ReplayFrame(Hardware &hw, midi::Handler &midi)
+{
+    if (!overriding_)
+    {
+        // The replayed edges continue from the real counts
+        hw.GetInputSnapshot(snapshot_);
+        midi.SetInputMuted(true);
+        overriding_ = true;
+    }
+
+    // MIDI messages that arrived before this frame, the ones older than the kept frames are skipped
+    while (replay_midi_ < recorded_midi_)
+    {
+        const MidiEvent &event = midi_events_[replay_midi_ % midi_events_.size()];
+        if (event.frame > replay_frame_)
+        {
+            break;
+        }
+        replay_midi_++;
+        if (event.frame == replay_frame_)
+        {
+            midi::Message msg = event.msg;
+            msg.SetTime(0); // arrived now
+            midi.Inject(&msg);
+        }
+    }
+
+    const Frame &frame = frames_[replay_frame_ % frames_.size()];
+    for (Hardware::AnalogInput input : EnumRange<Hardware::AnalogInput>())
+    {
+        snapshot_.analog[input] = frame.analog[input];
+    }
+    snapshot_.pitch_fine = frame.pitch_fine;
+    snapshot_.gpio = frame.gpio;
+    for (Hardware::DigitalInput input : EnumRange<Hardware::DigitalInput>())
+    {
+        snapshot_.edges[input] += frame.edges[input];
+    }
+    hw.OverrideInputs(snapshot_);
+
+    replay_frame_++;
+    replayed_frames_++;
+    if (replay_frame_ == recorded_frames_)
+    {
+        if (loop_)
+        {
+            replay_frame_ = FirstFrame();
+            replay_midi_ = FirstMidi();
+        }
+        else
+        {
+            // The real inputs come back at the next Process()
+            mode_ = Mode::IDLE;
+        }
+    }
+}
+
+void InputRecorder::Release(Hardware &hw, midi::Handler &midi)
+{
+    hw.ReleaseInputs();
+    midi.SetInputMuted(false);
+    overriding_ = false;
+}
@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "common/EnumTools.hpp"
+#include "common/core/Hardware.hpp"
+#include "common/core/midi/Handler.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class InputRecorder
+ * @ingroup debug
+ * @brief Records the inputs of a performance and plays them back in place of the real ones.
+ * @details Once per UI loop (right after the ADC has new readings) the recording takes a frame:
+ *          all the analog values, the button and digital input pins and the new edges of the digital inputs.
+ *          Received MIDI messages are stored with the frame they arrived before. The buffers are rings,
+ *          a long recording keeps the last frames.
+ *
+ *          The replay shows the frames to Hardware (Hardware::OverrideInputs()) instead of the ADC and the pins,
+ *          and injects the MIDI messages into the handler, the received ones are ignored meanwhile.
+ *          The app sees the same inputs at the same UI loops, so the worst-case profiler times (Profiler)
+ *          of the same performance can be compared between firmware versions.
+ * @note The resolution is one UI loop, edges inside a loop are replayed at its start.
+ *       The buffers are passed in, eg. from Kastle2::arena or a static array. A frame is 56 bytes.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class InputRecorder
+{
+public:
+    enum class Mode
+    {
+        IDLE,
+        RECORDING,
+        REPLAYING,
+    };
+
+    /**
+     * @brief Inputs of one UI loop.
+     */
+    struct Frame
+    {
+        EnumArray<Hardware::AnalogInput, int16_t> analog;               ///< Hardware::GetAnalogValue()
+        EnumArray<Hardware::CalibratedAnalogInput, int32_t> pitch_fine; ///< Hardware::GetPitchValueFine()
+        uint32_t gpio;                                                  ///< Pin levels
+        EnumArray<Hardware::DigitalInput, uint8_t> edges;               ///< Edges since the previous frame
+    };
+
+    /**
+     * @brief MIDI message received before the frame.
+     */
+    struct MidiEvent
+    {
+        uint32_t frame;
+        midi::Message msg;
+    };
+
+    /**
+     * @brief Starts recording, the previous recording is lost.
+     * @param frames Ring of the frames
+     * @param midi_events Ring of the MIDI messages
+     */
+    void StartRecording(std::span<Frame> frames, std::span<MidiEvent> midi_events);
+
+    /**
+     * @brief Replays the recording from its beginning.
+     * @param loop Starts over at the end, otherwise the real inputs come back
+     */
+    void StartReplay(const bool loop = false);
+
+    /**
+     * @brief Stops recording or replaying, the recording stays for another replay.
+     */
+    void Stop();
+
+    Mode GetMode() const
+    {
+        return mode_;
+    }
+
+    /**
+     * @brief Number of the frames in the recording (at most the size of the ring).
+     */
+    size_t GetFrameCount() const;
+
+    /**
+     * @brief Number of the frames replayed since StartReplay() (counts on when looping).
+     */
+    uint32_t GetReplayedFrames() const
+    {
+        return replayed_frames_;
+    }
+
+    /**
+     * @brief Records or replays one frame, call it once per UI loop after the ADC pass (Kastle2::ReadInputs()).
+     */
+    void Process(Hardware &hw, midi::Handler &midi);
+
+    /**
+     * @brief Adds a received MIDI message to the recording, for Handler::SetMonitorCallback().
+     */
+    void RecordMidi(const midi::Message &msg);
+
+private:
+    uint32_t FirstFrame() const;
+    uint32_t FirstMidi() const;
+    void CaptureFrame(Hardware &hw);
+    void ReplayFrame(Hardware &hw, midi::Handler &midi);
+    void Release(Hardware &hw, midi::Handler &midi);
+
+    Mode mode_ = Mode::IDLE;
+    bool loop_ = false;
+    bool overriding_ = false;
+
+    std::span<Frame> frames_;
+    std::span<MidiEvent> midi_events_;
+
+    // Recording: frames and MIDI messages taken so far (the last ones are in the rings)
+    uint32_t recorded_frames_ = 0;
+    uint32_t recorded_midi_ = 0;
+    EnumArray<Hardware::DigitalInput, uint32_t> last_edges_{};
+
+    // Replay: the next frame and MIDI message, and the snapshot shown to Hardware
+    uint32_t replay_frame_ = 0;
+    uint32_t replay_midi_ = 0;
+    uint32_t replayed_frames_ = 0;
+    Hardware::InputSnapshot snapshot_{};
+};
+
+}
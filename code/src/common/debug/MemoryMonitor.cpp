@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "MemoryMonitor.hpp"
+#include <cstdio>
+#include <malloc.h>
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+using namespace kastle2;
+
+// The host build has no linker script sections and no stacks of its own, everything reads as 0
+#ifndef KASTLE2_HOST
+
+// External symbols defined in the linker script
+extern uint8_t __fastcode_start__;
+extern uint8_t __fastcode_end__;
+extern uint8_t __data_start__;
+extern uint8_t __data_end__;
+extern uint8_t __bss_start__;
+extern uint8_t __bss_end__;
+extern uint8_t __end__;
+extern uint8_t __StackLimit;
+extern uint8_t __StackBottom;
+extern uint8_t __StackTop;
+extern uint8_t __StackOneBottom;
+extern uint8_t __StackOneTop;
+
+static uint32_t *stack_bottom(const uint core)
+{
+    return reinterpret_cast<uint32_t *>(core == 0 ? &__StackBottom : &__StackOneBottom);
+}
+
+static uint32_t stack_size(const uint core)
+{
+    return core == 0 ? &__StackTop - &__StackBottom : &__StackOneTop - &__StackOneBottom;
+}
+
+#endif
+
+void MemoryMonitor::InitCore()
+{
+#ifndef KASTLE2_HOST
+    // Everything below the current frame is free, keep a margin for this function and its callees
+    const uint8_t *limit = static_cast<const uint8_t *>(__builtin_frame_address(0)) - kPaintMargin;
+    for (uint32_t *word = stack_bottom(get_core_num()); reinterpret_cast<uint8_t *>(word) < limit; word++)
+    {
+        *word = kCanary;
+    }
+#endif
+}
+
+MemoryMonitor::Usage MemoryMonitor::GetUsage()
+{
+    Usage usage = {};
+#ifndef KASTLE2_HOST
+    usage.fastcode = &__fastcode_end__ - &__fastcode_start__;
+    usage.data = &__data_end__ - &__data_start__;
+    usage.bss = &__bss_end__ - &__bss_start__;
+    usage.heap_size = &__StackLimit - &__end__;
+
+    const struct mallinfo heap = mallinfo();
+    usage.heap_peak = heap.arena;
+    usage.heap_used = heap.uordblks;
+
+    for (uint core = 0; core < usage.stacks.size(); core++)
+    {
+        // The stack grows down, count the untouched canaries from the bottom
+        const uint32_t size = stack_size(core);
+        const uint32_t *word = stack_bottom(core);
+        uint32_t untouched = 0;
+        while (untouched < size && *word == kCanary)
+        {
+            untouched += sizeof(uint32_t);
+            word++;
+        }
+        usage.stacks[core] = Stack{.size = size, .peak = size - untouched};
+    }
+#endif
+    return usage;
+}
+
+void MemoryMonitor::Print(UsbSerial &serial)
+{
+    const Usage usage = GetUsage();
+    char buff[96];
+    snprintf(buff, sizeof(buff), "Memory: fastcode %lu, data %lu, bss %lu bytes",
+             static_cast<unsigned long>(usage.fastcode),
+             static_cast<unsigned long>(usage.data),
+             static_cast<unsigned long>(usage.bss));
+    serial.PrintLine(buff);
+    snprintf(buff, sizeof(buff), "Heap: used %lu, peak %lu of %lu bytes",
+             static_cast<unsigned long>(usage.heap_used),
+             static_cast<unsigned long>(usage.heap_peak),
+             static_cast<unsigned long>(usage.heap_size));
+    serial.PrintLine(buff);
+    for (size_t core = 0; core < usage.stacks.size(); core++)
+    {
+        snprintf(buff, sizeof(buff), "Stack core %u: peak %lu of %lu bytes",
+                 static_cast<unsigned>(core),
+                 static_cast<unsigned long>(usage.stacks[core].peak),
+                 static_cast<unsigned long>(usage.stacks[core].size));
+        serial.PrintLine(buff);
+    }
+}
+
+void MemoryMonitor::Process(UsbSerial &serial)
+{
+    bool print = serial.ReceivedChar('m');
+    if constexpr (kEnabled)
+    {
+        if (absolute_time_diff_us(report_timeout_, get_absolute_time()) >= 0)
+        {
+            report_timeout_ = make_timeout_time_ms(kReportIntervalMs);
+            print = true;
+        }
+    }
+    if (print)
+    {
+        Print(serial);
+    }
+}
@@ -0,0 +1,118 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "common/debug.hpp"
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class MemoryMonitor
+ * @ingroup debug
+ * @brief RAM usage of the firmware: sections, heap high-water mark and stack depth of both cores.
+ * @details The free part of each core's stack is filled with a canary pattern by InitCore,
+ *          the deepest overwritten word gives the stack peak. The heap peak is the amount
+ *          newlib requested from sbrk (it never gives memory back).
+ *          Send 'm' over USB serial to print the report, or enable REPORT_MEMORY_USAGE
+ *          in debug.hpp to print it every kReportIntervalMs. The test mode prints it with its results.
+ * @note Stacks are 2k per core (SCRATCH_Y for core 0, SCRATCH_X for core 1). On the host build all values are 0.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class MemoryMonitor
+{
+public:
+    /**
+     * @brief Stack of one core.
+     */
+    struct Stack
+    {
+        uint32_t size; ///< Stack size in bytes
+        uint32_t peak; ///< Deepest stack use seen in bytes
+    };
+
+    /**
+     * @brief Snapshot of the RAM usage, all in bytes.
+     */
+    struct Usage
+    {
+        uint32_t fastcode;            ///< .fastcode section (code copied to RAM)
+        uint32_t data;                ///< .data section
+        uint32_t bss;                 ///< .bss section (including the app arena)
+        uint32_t heap_size;           ///< Space between the end of .bss and the end of RAM
+        uint32_t heap_peak;           ///< Heap requested from the system so far (high-water mark)
+        uint32_t heap_used;           ///< Heap allocated right now
+        std::array<Stack, 2> stacks;  ///< Stacks of core 0 and core 1
+    };
+
+    /**
+     * @brief Enabled by REPORT_MEMORY_USAGE in debug.hpp.
+     */
+    static constexpr bool kEnabled = REPORT_MEMORY_USAGE;
+
+    /**
+     * @brief How often the report is printed when enabled.
+     */
+    static constexpr uint32_t kReportIntervalMs = 5000;
+
+    /**
+     * @brief Fills the free stack of the CALLING core with the canary. Call once on each core, as early as possible.
+     */
+    static void InitCore();
+
+    /**
+     * @brief Measures the current RAM usage.
+     * @note Sweeps both stacks, takes tens of microseconds. Don't call from the audio loop.
+     */
+    static Usage GetUsage();
+
+    /**
+     * @brief Prints the report.
+     * @param serial Serial to print the report to.
+     */
+    static void Print(UsbSerial &serial);
+
+    /**
+     * @brief Prints the report when 'm' is received or every kReportIntervalMs when enabled. Call from the UI loop.
+     * @param serial Serial to print the report to.
+     */
+    static void Process(UsbSerial &serial);
+
+private:
+    static constexpr uint32_t kCanary = 0xCA57CA57;
+
+    /**
+     * @brief Bytes below the current stack pointer left untouched by InitCore (its own frame and callees).
+     */
+    static constexpr uint32_t kPaintMargin = 64;
+
+    static inline absolute_time_t report_timeout_ = 0;
+};
+
+}
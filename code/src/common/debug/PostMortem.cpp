@@ -0,0 +1,167 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "PostMortem.hpp"
+#include <cstdio>
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+// The startup code clears .bss, the snapshot has to survive the reset
+#ifndef KASTLE2_HOST
+__attribute__((section(".uninitialized_data.post_mortem"))) PostMortem::Snapshot PostMortem::snapshot_;
+#else
+PostMortem::Snapshot PostMortem::snapshot_ = {};
+#endif
+
+COLDCODE void PostMortem::Check()
+{
+    if constexpr (kEnabled)
+    {
+#ifndef KASTLE2_HOST
+        // watchdog_reboot() sets the reason too, only the timeout of watchdog_enable() is ours
+        if (watchdog_enable_caused_reboot() && snapshot_.magic == kMagic)
+        {
+            report_ = snapshot_;
+            has_report_ = true;
+        }
+#endif
+        // Random after a power cycle
+        snapshot_ = {};
+    }
+}
+
+COLDCODE void PostMortem::Arm()
+{
+    if constexpr (kEnabled)
+    {
+#ifndef KASTLE2_HOST
+        snapshot_.magic = kMagic;
+        watchdog_enable(kTimeoutMs, true);
+        armed_ = true;
+#endif
+    }
+}
+
+void PostMortem::Suspend()
+{
+    if constexpr (kEnabled)
+    {
+#ifndef KASTLE2_HOST
+        if (armed_)
+        {
+            hw_clear_bits(&watchdog_hw->ctrl, WATCHDOG_CTRL_ENABLE_BITS);
+        }
+#endif
+    }
+}
+
+void PostMortem::Resume()
+{
+    if constexpr (kEnabled)
+    {
+#ifndef KASTLE2_HOST
+        if (armed_)
+        {
+            watchdog_hw->load = kLoad;
+            hw_set_bits(&watchdog_hw->ctrl, WATCHDOG_CTRL_ENABLE_BITS);
+        }
+#endif
+    }
+}
+
+FASTCODE void PostMortem::CopyUnderruns(const I2S &i2s)
+{
+    snapshot_.underrun_count = i2s.GetUnderrunCount();
+    for (size_t age = 0; age < snapshot_.underruns.size(); age++)
+    {
+        if (!i2s.GetUnderrunEvent(age, snapshot_.underruns[age]))
+        {
+            snapshot_.underruns[age] = {};
+        }
+    }
+}
+
+void PostMortem::Print(UsbSerial &serial)
+{
+    if (!has_report_)
+    {
+        serial.PrintLine("Post-mortem: no watchdog reset");
+        return;
+    }
+
+    char buff[128];
+    snprintf(buff, sizeof(buff), "Post-mortem: audio stopped, watchdog reset after %lu blocks, app %lu, tag %lu",
+             static_cast<unsigned long>(report_.blocks),
+             static_cast<unsigned long>(report_.app_id),
+             static_cast<unsigned long>(report_.tag));
+    serial.PrintLine(buff);
+
+    snprintf(buff, sizeof(buff), "Underruns: %lu", static_cast<unsigned long>(report_.underrun_count));
+    serial.PrintLine(buff);
+    const size_t underruns = report_.underrun_count < report_.underruns.size() ? report_.underrun_count : report_.underruns.size();
+    for (size_t age = 0; age < underruns; age++)
+    {
+        const I2S::UnderrunEvent &event = report_.underruns[age];
+        snprintf(buff, sizeof(buff), "  at %lu us: %lu us, tag %lu",
+                 static_cast<unsigned long>(event.timestamp_us),
+                 static_cast<unsigned long>(event.duration_us),
+                 static_cast<unsigned long>(event.tag));
+        serial.PrintLine(buff);
+    }
+
+    // The oldest first, the period is the time since the previous interrupt
+    const size_t frames = report_.blocks < kFrames ? report_.blocks : kFrames;
+    serial.PrintLine("Last callbacks (interrupt time, period, duration in us):");
+    for (size_t i = 0; i < frames; i++)
+    {
+        const uint32_t block = report_.blocks - frames + i;
+        const Frame &frame = report_.frames[block % kFrames];
+        const uint32_t period = i > 0 ? frame.irq_us - report_.frames[(block - 1) % kFrames].irq_us : 0;
+        snprintf(buff, sizeof(buff), "  %lu %lu %lu",
+                 static_cast<unsigned long>(frame.irq_us),
+                 static_cast<unsigned long>(period),
+                 static_cast<unsigned long>(frame.duration_us));
+        serial.PrintLine(buff);
+    }
+}
+
+void PostMortem::Process(UsbSerial &serial)
+{
+    bool print = serial.ReceivedChar('d');
+    if constexpr (kEnabled)
+    {
+        if (has_report_ && !report_printed_ && to_ms_since_boot(get_absolute_time()) >= kReportDelayMs)
+        {
+            report_printed_ = true;
+            print = true;
+        }
+    }
+    if (print)
+    {
+        Print(serial);
+    }
+}
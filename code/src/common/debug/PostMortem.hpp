@@ -0,0 +1,223 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "hardware/timer.h"
+#include "hardware/watchdog.h"
+#include "common/config.hpp"
+#include "common/debug.hpp"
+#include "common/debug/UsbSerial.hpp"
+#include "I2S.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class PostMortem
+ * @ingroup debug
+ * @brief Audio deadline on the hardware watchdog, with the last audio blocks kept over the reset it causes.
+ * @details Arm() starts the watchdog once the audio runs, only the audio callback feeds it (AudioBlock()).
+ *          When the callback misses kDeadlineBlocks blocks in a row (a hung interrupt, a deadlock of the cores),
+ *          the chip resets. Each block also writes a snapshot to the RAM the startup code doesn't clear:
+ *          the last kFrames callbacks (interrupt time and duration), the I2S underrun log, the app id
+ *          and the tag of Kastle2::SetUnderrunTag() (the app mode). Check() takes the snapshot over
+ *          on the next boot when the watchdog caused it, Kastle2::Init() blinks WATCHDOG_RESET and
+ *          Process() prints the report over USB serial a few seconds later, or on 'd'.
+ *          Enable it with AUDIO_WATCHDOG in debug.hpp. When disabled, all the calls compile to nothing.
+ * @note The stalling flash writes (FlashWriter::Write) stop the audio, they Suspend() the watchdog meanwhile.
+ *       The watchdog_reboot() of the updates and the app switch isn't reported, nor is a power cycle or the RUN pin.
+ *       The watchdog pauses while a debugger halts the cores. On the host build nothing is armed or reported.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class PostMortem
+{
+public:
+    /**
+     * @brief Enabled by AUDIO_WATCHDOG in debug.hpp.
+     */
+    static constexpr bool kEnabled = AUDIO_WATCHDOG;
+
+    /**
+     * @brief Audio callbacks in a row that may be missed before the reset.
+     */
+    static constexpr uint32_t kDeadlineBlocks = 64;
+
+    /**
+     * @brief Watchdog timeout, kDeadlineBlocks callback periods.
+     */
+    static constexpr uint32_t kTimeoutMs = static_cast<uint32_t>(kDeadlineBlocks * I2S::kAudioBufferSize * 1000.0f / I2S_SAMPLE_RATE) + 1;
+
+    /**
+     * @brief Callbacks kept in the snapshot.
+     */
+    static constexpr size_t kFrames = 16;
+
+    /**
+     * @brief How long after the boot the report is printed by itself, so the USB serial has time to connect.
+     */
+    static constexpr uint32_t kReportDelayMs = 5000;
+
+    /**
+     * @brief One audio callback.
+     */
+    struct Frame
+    {
+        uint32_t irq_us;      ///< time_us_32() of the DMA interrupt entry
+        uint32_t duration_us; ///< From the interrupt entry to the end of the callback
+    };
+
+    /**
+     * @brief What the audio left behind, kept over the reset.
+     */
+    struct Snapshot
+    {
+        uint32_t magic;                                          ///< kMagic while the snapshot is being written
+        uint32_t app_id;                                         ///< App::GetId() of the running app
+        uint32_t tag;                                            ///< Last Kastle2::SetUnderrunTag() value
+        uint32_t blocks;                                         ///< Audio callbacks since Arm()
+        uint32_t underrun_count;                                 ///< I2S::GetUnderrunCount()
+        std::array<I2S::UnderrunEvent, I2S::kUnderrunLogSize> underruns; ///< Underrun log, the newest first
+        std::array<Frame, kFrames> frames;                       ///< Ring of the last callbacks
+    };
+
+    /**
+     * @brief Takes the snapshot of the last run over if the watchdog reset the chip. Call first thing on the boot.
+     */
+    static void Check();
+
+    /**
+     * @brief Whether Check() found a watchdog reset, Kastle2::Init() shows it on the LEDs.
+     */
+    static bool HasReport()
+    {
+        return has_report_;
+    }
+
+    /**
+     * @brief Starts the watchdog. Call once the audio runs.
+     */
+    static void Arm();
+
+    /**
+     * @brief Stops the watchdog while the audio can't run (a flash write with the interrupts off).
+     */
+    static void Suspend();
+
+    /**
+     * @brief Restarts the watchdog after Suspend(), with the full timeout.
+     */
+    static void Resume();
+
+    /**
+     * @brief Sets the app id written to the snapshot.
+     */
+    static void SetAppId(const uint32_t app_id)
+    {
+        if constexpr (kEnabled)
+        {
+            snapshot_.app_id = app_id;
+        }
+        else
+        {
+            (void)app_id;
+        }
+    }
+
+    /**
+     * @brief Sets the tag written to the snapshot, the app mode etc.
+     */
+    static void SetTag(const uint32_t tag)
+    {
+        if constexpr (kEnabled)
+        {
+            snapshot_.tag = tag;
+        }
+        else
+        {
+            (void)tag;
+        }
+    }
+
+    /**
+     * @brief Called at the end of the audio callback, feeds the watchdog and writes the snapshot.
+     * @param i2s Source of the interrupt time and the underrun log.
+     */
+    static inline void AudioBlock(const I2S &i2s)
+    {
+        if constexpr (kEnabled)
+        {
+            // Straight to the register, watchdog_update() runs from the flash
+            if (armed_)
+            {
+                watchdog_hw->load = kLoad;
+            }
+            const uint32_t irq_us = i2s.GetIrqTime();
+            snapshot_.frames[snapshot_.blocks % kFrames] = Frame{.irq_us = irq_us, .duration_us = time_us_32() - irq_us};
+            snapshot_.blocks++;
+            if (i2s.GetUnderrunCount() != snapshot_.underrun_count)
+            {
+                CopyUnderruns(i2s);
+            }
+        }
+        else
+        {
+            (void)i2s;
+        }
+    }
+
+    /**
+     * @brief Prints the report of the last reset.
+     * @param serial Serial to print the report to.
+     */
+    static void Print(UsbSerial &serial);
+
+    /**
+     * @brief Prints the report when 'd' is received, or once kReportDelayMs after a watchdog reset. Call from the UI loop.
+     * @param serial Serial to print the report to.
+     */
+    static void Process(UsbSerial &serial);
+
+private:
+    static constexpr uint32_t kMagic = 0x4B32574Du; // "K2WM"
+
+    /**
+     * @brief The load value of kTimeoutMs, the RP2040 counts down twice per tick (erratum RP2040-E1).
+     */
+    static constexpr uint32_t kLoad = kTimeoutMs * 1000 * 2;
+    static_assert(kLoad <= 0xFFFFFF, "the watchdog counter has 24 bits");
+
+    static void CopyUnderruns(const I2S &i2s);
+
+    static Snapshot snapshot_;
+    static inline Snapshot report_ = {};
+    static inline bool has_report_ = false;
+    static inline bool armed_ = false;
+    static inline bool report_printed_ = false;
+};
+
+}
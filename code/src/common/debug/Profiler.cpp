@@ -0,0 +1,92 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "Profiler.hpp"
+#include <cstdio>
+
+using namespace kastle2;
+
+static const EnumArray<Profiler::Section, const char *> kSectionNames = {
+    "core 0 AudioCallback",
+    "core 0 BeforeAudioLoop",
+    "core 0 AudioLoop",
+    "core 0 AfterAudioLoop",
+    "core 1 SecondCoreProcess",
+};
+
+void Profiler::InitCore()
+{
+    if constexpr (kEnabled)
+    {
+        // Free-running 24-bit counter clocked by the processor clock
+        systick_hw->csr = 0;
+        systick_hw->rvr = kSysTickMask;
+        systick_hw->cvr = 0;
+        systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+        ResetStats();
+        totals_ = stats_;
+    }
+}
+
+void Profiler::ResetStats()
+{
+    for (auto &stats : stats_)
+    {
+        stats = Stats{.min = UINT32_MAX, .max = 0, .sum = 0, .count = 0};
+    }
+}
+
+void Profiler::Process(UsbSerial &serial)
+{
+    if constexpr (kEnabled)
+    {
+        if (absolute_time_diff_us(report_timeout_, get_absolute_time()) < 0)
+        {
+            return;
+        }
+        report_timeout_ = make_timeout_time_ms(kReportIntervalMs);
+
+        char buff[96];
+        snprintf(buff, sizeof(buff), "Profiler: %lu cycles per block", static_cast<unsigned long>(kBlockBudgetCycles));
+        serial.PrintLine(buff);
+        for (auto section : EnumRange<Section>())
+        {
+            const Stats stats = stats_[section];
+            if (stats.count == 0)
+            {
+                continue;
+            }
+            uint32_t avg = stats.sum / stats.count;
+            int32_t headroom = 100 - static_cast<int32_t>((static_cast<uint64_t>(stats.max) * 100) / kBlockBudgetCycles);
+            snprintf(buff, sizeof(buff), "%s: min %lu avg %lu max %lu (headroom %ld%%)",
+                     kSectionNames[section],
+                     static_cast<unsigned long>(stats.min),
+                     static_cast<unsigned long>(avg),
+                     static_cast<unsigned long>(stats.max),
+                     static_cast<long>(headroom));
+            serial.PrintLine(buff);
+        }
+        ResetStats();
+    }
+}
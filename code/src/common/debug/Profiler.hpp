@@ -0,0 +1,211 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "hardware/structs/systick.h"
+#include "common/EnumTools.hpp"
+#include "common/config.hpp"
+#include "common/debug.hpp"
+#include "common/debug/Telemetry.hpp"
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class Profiler
+ * @ingroup debug
+ * @brief Cycle-accurate min/avg/max measurements of the audio path on both cores.
+ * @details Uses the SysTick counter of each core (24-bit, running at the system clock),
+ *          so no scope is needed. Results are compared against the block deadline
+ *          (kBlockBudgetCycles) and printed over USB serial every kReportIntervalMs.
+ *          Enable it with PROFILE_AUDIO_LOOP in debug.hpp and Kastle2::debug.SetEnabled(true).
+ *          With TELEMETRY enabled too, the cycles of every block are also sent as Telemetry records.
+ *          When disabled, all the calls compile to nothing.
+ * @note Each section must be measured on one core only. The stats are approximate,
+ *       the UI loop reads them while the audio interrupt and the second core write them.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class Profiler
+{
+public:
+    /**
+     * @brief Measured parts of the audio path.
+     */
+    enum class Section
+    {
+        AUDIO_CALLBACK,    ///< Whole Kastle2::AudioCallback (core 0)
+        BEFORE_AUDIO_LOOP, ///< Base::BeforeAudioLoop (core 0)
+        AUDIO_LOOP,        ///< App AudioLoop (core 0)
+        AFTER_AUDIO_LOOP,  ///< Base::AfterAudioLoop (core 0)
+        SECOND_CORE,       ///< SecondCoreProcess calls or MultiCore jobs summed over the block (core 1)
+        COUNT
+    };
+
+    /**
+     * @brief Statistics of one section.
+     */
+    struct Stats
+    {
+        uint32_t min;   ///< Minimal cycles per block
+        uint32_t max;   ///< Maximal cycles per block
+        uint64_t sum;   ///< Sum of cycles (for average)
+        uint32_t count; ///< Number of measured blocks
+    };
+
+    /**
+     * @brief Enabled by PROFILE_AUDIO_LOOP in debug.hpp.
+     */
+    static constexpr bool kEnabled = PROFILE_AUDIO_LOOP;
+
+    /**
+     * @brief Cycles available for one audio block.
+     */
+    static constexpr uint32_t kBlockBudgetCycles = static_cast<uint32_t>(SYSTEM_CLOCK_KHZ * 1000.0f / AUDIO_LOOP_RATE);
+
+    /**
+     * @brief How often the results are printed.
+     */
+    static constexpr uint32_t kReportIntervalMs = 1000;
+
+    /**
+     * @brief Starts the SysTick counter of the CALLING core. Call once on each core.
+     */
+    static void InitCore();
+
+    /**
+     * @brief Starts measuring the section.
+     */
+    static inline void Start(Section section)
+    {
+        if constexpr (kEnabled)
+        {
+            start_[section] = ReadCounter();
+        }
+    }
+
+    /**
+     * @brief Stops measuring the section, adds the elapsed cycles to the current block.
+     * @note Start/Stop can be called multiple times per block, call Commit at the end of the block.
+     */
+    static inline void Stop(Section section)
+    {
+        if constexpr (kEnabled)
+        {
+            // SysTick counts down
+            accumulated_[section] += (start_[section] - ReadCounter()) & kSysTickMask;
+        }
+    }
+
+    /**
+     * @brief Stores the cycles accumulated in the current block to the stats.
+     */
+    static inline void Commit(Section section)
+    {
+        if constexpr (kEnabled)
+        {
+            uint32_t cycles = accumulated_[section];
+            accumulated_[section] = 0;
+            Add(stats_[section], cycles);
+            Add(totals_[section], cycles);
+            Telemetry::Profile(static_cast<uint8_t>(section), cycles);
+        }
+    }
+
+    /**
+     * @brief Stops measuring the section and commits it (section measured once per block).
+     */
+    static inline void End(Section section)
+    {
+        Stop(section);
+        Commit(section);
+    }
+
+    /**
+     * @brief Gets the statistics of the section.
+     * @return Stats since the last report.
+     */
+    static Stats GetStats(Section section)
+    {
+        return stats_[section];
+    }
+
+    /**
+     * @brief Gets the statistics of the section since InitCore(), the reports don't clear them.
+     * @return Stats of the whole run (the host renderer prints them with -p).
+     */
+    static Stats GetTotals(Section section)
+    {
+        return totals_[section];
+    }
+
+    /**
+     * @brief Prints the stats every kReportIntervalMs and starts a new window. Call from the UI loop.
+     * @param serial Serial to print the report to.
+     */
+    static void Process(UsbSerial &serial);
+
+private:
+    static constexpr uint32_t kSysTickMask = 0x00FFFFFF;
+
+    // SysTick of the calling core, the host has a stand-in counting instructions or CPU time
+    static inline uint32_t ReadCounter()
+    {
+#ifdef KASTLE2_HOST
+        return kastle2_host_profiler_counter();
+#else
+        return systick_hw->cvr;
+#endif
+    }
+
+    static inline void Add(Stats &stats, const uint32_t cycles)
+    {
+        if (cycles < stats.min)
+        {
+            stats.min = cycles;
+        }
+        if (cycles > stats.max)
+        {
+            stats.max = cycles;
+        }
+        stats.sum += cycles;
+        stats.count++;
+    }
+
+    /**
+     * @brief Clears the statistics of all sections.
+     */
+    static void ResetStats();
+
+    static inline EnumArray<Section, volatile uint32_t> start_;
+    static inline EnumArray<Section, uint32_t> accumulated_;
+    static inline EnumArray<Section, Stats> stats_;
+    static inline EnumArray<Section, Stats> totals_;
+    static inline absolute_time_t report_timeout_ = 0;
+};
+
+}
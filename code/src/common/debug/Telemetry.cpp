@@ -0,0 +1,105 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "Telemetry.hpp"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "common/debug/SEGGER_RTT.h"
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+void Telemetry::Init()
+{
+    if constexpr (kBuffersEnabled)
+    {
+        SEGGER_RTT_ConfigUpBuffer(kChannel, "Telemetry core 0", buffers_[0].data(), kBufferSize, SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+        SEGGER_RTT_ConfigUpBuffer(kChannel + 1, "Telemetry core 1", buffers_[1].data(), kBufferSize, SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    }
+}
+
+FASTCODE Telemetry::Record Telemetry::MakeRecord(const Type type, const uint8_t id)
+{
+    Record record;
+    record.sync = kSync;
+    record.type = type;
+    record.id = id;
+    record.sequence = 0; // set by Write()
+    record.timestamp = time_us_32();
+    return record;
+}
+
+FASTCODE void Telemetry::Scope(const uint8_t id, const int32_t *samples, size_t size, const size_t stride)
+{
+    if constexpr (kEnabled)
+    {
+        if (size > kMaxScopeSamples)
+        {
+            size = kMaxScopeSamples;
+        }
+        std::array<Record, kMaxScopeSamples / 4> records;
+        const size_t count = (size + 3) / 4;
+        const Record header = MakeRecord(Type::SCOPE, id);
+        for (size_t i = 0; i < count; i++)
+        {
+            records[i] = header;
+            for (size_t j = 0; j < 4; j++)
+            {
+                const size_t index = i * 4 + j;
+                records[i].samples[j] = index < size ? static_cast<int16_t>(samples[index * stride]) : 0;
+            }
+        }
+        Write(records.data(), count);
+    }
+    else
+    {
+        (void)id;
+        (void)samples;
+        (void)size;
+        (void)stride;
+    }
+}
+
+FASTCODE void Telemetry::Write(Record *records, const size_t count)
+{
+    if constexpr (kBuffersEnabled)
+    {
+        const uint core = get_core_num();
+        // Only this core writes its buffer, the audio interrupt must not cut into a record of the UI loop
+        const uint32_t interrupts = save_and_disable_interrupts();
+        for (size_t i = 0; i < count; i++)
+        {
+            // Counts the dropped records too, the decoder sees them as a gap
+            records[i].sequence = sequences_[core]++;
+        }
+        SEGGER_RTT_WriteSkipNoLock(kChannel + core, records, count * sizeof(Record));
+        restore_interrupts(interrupts);
+    }
+    else
+    {
+        (void)records;
+        (void)count;
+    }
+}
@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/debug.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class Telemetry
+ * @ingroup debug
+ * @brief Binary records of the DSP internals streamed over SEGGER RTT, cheap enough for the audio loop.
+ * @details Each record is 16 bytes (Record), copied as is to an RTT up-buffer, nothing is formatted on the device.
+ *          Each core writes its own up-buffer (kChannel + core number), so the cores never wait for each other,
+ *          only the interrupts of the writing core are held off for the copy. A record that doesn't fit
+ *          the buffer is dropped whole, the host sees the gap in the sequence numbers.
+ *          Read the channels with a J-Link (JLinkRTTLogger) or OpenOCD (rtt server) and decode them
+ *          with scripts/telemetry_decode.py.
+ *          Enable it with TELEMETRY in debug.hpp. When disabled, all the calls compile to nothing.
+ *          The trace points (Trace, TRACE_LEVEL in debug.hpp) use the same buffers even without TELEMETRY.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class Telemetry
+{
+public:
+    /**
+     * @brief What the record carries.
+     */
+    enum class Type : uint8_t
+    {
+        PROFILER = 1, ///< Cycles of a block, id is the Profiler::Section, values[0] the cycles
+        VALUE = 2,    ///< Parameter or internal value, id chosen by the app, values[0] and values[1]
+        SCOPE = 3,    ///< Four samples of a snippet, the records of one snippet share the id and timestamp
+        TRACE = 4,    ///< Trace point of a core module, id is the TracePoint, values[0] and values[1]
+        CLOCK = 5,    ///< Audio clock statistics of a window, id is the AudioClockMonitor::Stat, values[0] and values[1]
+    };
+
+    /**
+     * @brief One record, little endian as in the RAM of the RP2040.
+     */
+    struct Record
+    {
+        uint8_t sync;       ///< Always kSync, lets the decoder find the records in a stream cut anywhere
+        Type type;          ///< What the record carries
+        uint8_t id;         ///< Section, value or probe id
+        uint8_t sequence;   ///< Counts the records of the channel, gaps are dropped records
+        uint32_t timestamp; ///< time_us_32() of the write, of the first sample for SCOPE
+        union
+        {
+            int32_t values[2];
+            int16_t samples[4];
+        };
+    };
+    static_assert(sizeof(Record) == 16, "The decoder expects 16 byte records");
+
+    /**
+     * @brief Enabled by TELEMETRY in debug.hpp.
+     */
+    static constexpr bool kEnabled = TELEMETRY;
+
+    /**
+     * @brief The up-buffers exist for the telemetry or the trace points (TRACE_LEVEL in debug.hpp).
+     */
+    static constexpr bool kBuffersEnabled = TELEMETRY || TRACE_LEVEL > 0;
+
+    /**
+     * @brief First byte of each record.
+     */
+    static constexpr uint8_t kSync = 0xA5;
+
+    /**
+     * @brief RTT up-buffer of core 0, core 1 writes the next one (0 is the RTT terminal).
+     */
+    static constexpr unsigned kChannel = 1;
+
+    /**
+     * @brief Size of the up-buffer of each core, 256 records.
+     */
+    static constexpr size_t kBufferSize = kBuffersEnabled ? 256 * sizeof(Record) : 0;
+
+    /**
+     * @brief Longest snippet Scope() writes in one go, longer ones are cut.
+     */
+    static constexpr size_t kMaxScopeSamples = 64;
+
+    /**
+     * @brief Registers the up-buffers of both cores. Call once at startup.
+     */
+    static void Init();
+
+    /**
+     * @brief Writes the cycles of a profiled section, called by Profiler::Commit().
+     */
+    static inline void Profile(const uint8_t section, const uint32_t cycles)
+    {
+        if constexpr (kEnabled)
+        {
+            Record record = MakeRecord(Type::PROFILER, section);
+            record.values[0] = static_cast<int32_t>(cycles);
+            record.values[1] = 0;
+            Write(&record, 1);
+        }
+    }
+
+    /**
+     * @brief Writes a value.
+     * @param id Id of the value, the decoder prints it, the meaning is up to the app.
+     * @param value First value.
+     * @param value2 Second value (eg. the target of a smoothed parameter).
+     */
+    static inline void Value(const uint8_t id, const int32_t value, const int32_t value2 = 0)
+    {
+        if constexpr (kEnabled)
+        {
+            Record record = MakeRecord(Type::VALUE, id);
+            record.values[0] = value;
+            record.values[1] = value2;
+            Write(&record, 1);
+        }
+    }
+
+    /**
+     * @brief Writes a trace point, called by Trace::Emit().
+     */
+    static inline void Event(const uint8_t id, const int32_t value, const int32_t value2)
+    {
+        if constexpr (kBuffersEnabled)
+        {
+            Record record = MakeRecord(Type::TRACE, id);
+            record.values[0] = value;
+            record.values[1] = value2;
+            Write(&record, 1);
+        }
+    }
+
+    /**
+     * @brief Writes the audio clock statistics, called by AudioClockMonitor::Process().
+     */
+    static inline void Clock(const uint8_t id, const int32_t value, const int32_t value2)
+    {
+        if constexpr (kEnabled)
+        {
+            Record record = MakeRecord(Type::CLOCK, id);
+            record.values[0] = value;
+            record.values[1] = value2;
+            Write(&record, 1);
+        }
+    }
+
+    /**
+     * @brief Writes a snippet of 16-bit samples, eg. a channel of the audio block.
+     * @param id Id of the snippet.
+     * @param samples First sample.
+     * @param size Number of samples, at most kMaxScopeSamples.
+     * @param stride Distance of the samples, 2 picks one channel of an interleaved stereo block.
+     */
+    static void Scope(uint8_t id, const int32_t *samples, size_t size, size_t stride = 1);
+
+private:
+    static Record MakeRecord(Type type, uint8_t id);
+
+    /**
+     * @brief Copies the records to the up-buffer of the calling core, all or nothing.
+     */
+    static void Write(Record *records, size_t count);
+
+    static inline std::array<std::array<uint8_t, kBufferSize>, 2> buffers_;
+    static inline std::array<uint8_t, 2> sequences_ = {};
+};
+
+}
@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include "common/debug.hpp"
+#include "common/debug/Telemetry.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Severity of a trace point, the ones above TRACE_LEVEL (debug.hpp) compile to nothing.
+ * @ingroup debug
+ */
+enum class TraceLevel : uint8_t
+{
+    ERROR = 1,   ///< Something failed (eg. an EEPROM page didn't verify)
+    WARNING = 2, ///< Recovered trouble (lost clock, dropped bytes, a cut SysEx)
+    EVENT = 3,   ///< State changes (sync source, taps, layers)
+    VERBOSE = 4, ///< Every pulse, message and queued page
+};
+
+/**
+ * @brief Trace points of the core modules, the record id (keep scripts/telemetry_decode.py in sync).
+ * @ingroup debug
+ */
+enum class TracePoint : uint8_t
+{
+    CLOCK_SYNC_TYPE,      ///< Clock: new sync type, previous one
+    CLOCK_TAP,            ///< Clock: tapped period in frames, ticks (0 if the taps were reset)
+    CLOCK_RESET,          ///< Clock: sequencer reset at the trigger, sync type
+    MIDI_CLOCK_START,     ///< MidiClockSource: Start received
+    MIDI_CLOCK_PULSE,     ///< MidiClockSource: pulse frame, its error against the prediction in 1/256 frames
+    MIDI_CLOCK_LOCK,      ///< MidiClockSource: (re)locked or unlocked, pulse interval in frames, locked
+    MIDI_CLOCK_LOST,      ///< MidiClockSource: no pulses, frames since the last one
+    MEMORY_PAGE_WRITE,    ///< Memory::ProcessQueue: page queued for the write, dirty pages left
+    MEMORY_BUS_FULL,      ///< Memory::ProcessQueue: the I2C queue is full, page
+    MEMORY_VERIFY_FAILED, ///< Memory::ProcessQueue: page read back different, retries
+    MIDI_MESSAGE,         ///< midi::Handler: status | data1 << 8 | data2 << 16, source
+    MIDI_UART_DROPPED,    ///< midi::Handler: UART byte dropped (full queue), dropped count
+    MIDI_SYSEX_CUT,       ///< midi::Handler: SysEx ended by another status byte, the status, source
+    BASE_LAYER,           ///< Base::LayersHandling: new layer, previous one
+    SPAN_BEGIN,           ///< Trace::Begin(): TraceSpan, its detail
+    SPAN_END,             ///< Trace::End(): TraceSpan, its detail
+};
+
+/**
+ * @brief Timeline spans, what each core is busy with (scripts/trace_to_chrome.py draws them per core).
+ * @ingroup debug
+ */
+enum class TraceSpan : uint8_t
+{
+    AUDIO_CALLBACK, ///< DMA IRQ of the I2S, the whole Kastle2::AudioCallback (core 0)
+    AUDIO_LOOP,     ///< App AudioLoop (core 0)
+    ADC_IRQ,        ///< ADC FIFO or ADC DMA interrupt (core 0)
+    UI_TASK,        ///< UiScheduler task, detail is its index in the order of Add() (core 0)
+    WAIT_FOR_BLOCK, ///< Core 0 waiting for the second core at the end of the block (MultiCore::WaitForBlock)
+    SECOND_CORE,    ///< Frames processed by the second core, detail is from | to << 16, or a MultiCore job (core 1)
+};
+
+/**
+ * @class Trace
+ * @ingroup debug
+ * @brief Compile time filtered trace points, written as binary Telemetry records to the RTT.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * A trace point is a 16 byte record (timestamp, point and two values), so it costs about as much as
+ * a Telemetry::Value() and doesn't change the timing of what it watches. The points above TRACE_LEVEL
+ * compile to nothing, keep the values free of side effects so their computation goes away too.
+ * Read them with scripts/telemetry_decode.py, like the Telemetry.
+ */
+class Trace
+{
+public:
+    static constexpr int kLevel = TRACE_LEVEL;
+
+    /**
+     * @brief Returns true if the points of the level are compiled in.
+     */
+    static constexpr bool IsEnabled(const TraceLevel level)
+    {
+        return static_cast<int>(level) <= kLevel;
+    }
+
+    /**
+     * @brief Writes the trace point if its level is compiled in.
+     */
+    template <TraceLevel level>
+    static inline void Emit(const TracePoint point, const int32_t value = 0, const int32_t value2 = 0)
+    {
+        if constexpr (IsEnabled(level))
+        {
+            Telemetry::Event(static_cast<uint8_t>(point), value, value2);
+        }
+        else
+        {
+            (void)point;
+            (void)value;
+            (void)value2;
+        }
+    }
+
+    /**
+     * @brief Starts a timeline span of the calling core, end it with End() on the same core.
+     * @note The spans come often (each block, task or interrupt), so they are VERBOSE.
+     */
+    static inline void Begin(const TraceSpan span, const int32_t detail = 0)
+    {
+        Emit<TraceLevel::VERBOSE>(TracePoint::SPAN_BEGIN, static_cast<int32_t>(span), detail);
+    }
+
+    /**
+     * @brief Ends the timeline span started by Begin().
+     */
+    static inline void End(const TraceSpan span, const int32_t detail = 0)
+    {
+        Emit<TraceLevel::VERBOSE>(TracePoint::SPAN_END, static_cast<int32_t>(span), detail);
+    }
+};
+
+}
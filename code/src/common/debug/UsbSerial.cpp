@@ -24,6 +24,8 @@ SOFTWARE.
 */
 
 #include "UsbSerial.hpp"
+#include <algorithm>
+#include <cstdio>
 
 using namespace kastle2;
 
@@ -54,17 +56,28 @@ void UsbSerial::Process()
     // Run TinyUSB task to process any pending USB events
     tud_task();
 
-    // Only process if USB CDC is connected
+    // Only process if USB CDC is connected, the log messages are dropped meanwhile
     if (!tud_cdc_connected())
     {
+        LogEntry entry;
+        for (auto &queue : log_queues_)
+        {
+            while (queue.Pop(entry))
+            {
+            }
+        }
         return;
     }
 
     // Flush the data
     Flush();
+    if (ProcessLog())
+    {
+        tud_cdc_write_flush();
+    }
 
     // Process any available incoming data
-    if (tud_cdc_available())
+    if (!input_claimed_ && tud_cdc_available())
     {
         usb_got_char_ = tud_cdc_read_char();
     }
@@ -212,6 +225,138 @@ void UsbSerial::FlushInternalBuffer()
     }
 }
 
+void UsbSerial::PushLog(const LogEntry &entry)
+{
+    // The core's own queue, only its interrupts can push at the same time
+    const uint32_t core = get_core_num();
+    const uint32_t irq_state = save_and_disable_interrupts();
+    if (!log_queues_[core].Push(entry))
+    {
+        log_dropped_[core] = log_dropped_[core] + 1;
+    }
+    restore_interrupts(irq_state);
+}
+
+bool UsbSerial::ProcessLog()
+{
+    char line[kLogLineSize + 2];
+    bool written = false;
+
+    const uint32_t dropped = GetLogDroppedCount();
+    if (dropped != log_dropped_reported_ && tud_cdc_write_available() >= kLogLineSize + 2)
+    {
+        const int size = snprintf(line, sizeof(line), "Log: %lu messages dropped\n\r",
+                                  static_cast<unsigned long>(dropped - log_dropped_reported_));
+        tud_cdc_write(line, size);
+        log_dropped_reported_ = dropped;
+        written = true;
+    }
+
+    // Only as much as fits the FIFO now, the rest waits in the queues
+    for (auto &queue : log_queues_)
+    {
+        LogEntry entry;
+        while (tud_cdc_write_available() >= kLogLineSize + 2 && queue.Pop(entry))
+        {
+            size_t size = FormatLog(entry, line, kLogLineSize);
+            line[size++] = '\n';
+            line[size++] = '\r';
+            tud_cdc_write(line, size);
+            written = true;
+        }
+    }
+    return written;
+}
+
+size_t UsbSerial::FormatLog(const LogEntry &entry, char *line, const size_t size)
+{
+    // Each conversion is formatted on its own, with the argument converted back to its type
+    size_t length = 0;
+    size_t arg = 0;
+    const char *p = entry.format;
+    while (*p != 0 && length < size - 1)
+    {
+        if (*p != '%')
+        {
+            line[length++] = *p++;
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            line[length++] = '%';
+            p += 2;
+            continue;
+        }
+
+        const char *start = p++;
+        while (*p != 0 && std::strchr("diouxXcsfFeEgGaAp", *p) == nullptr)
+        {
+            p++;
+        }
+        char spec[16];
+        const size_t spec_size = p - start + 1;
+        if (*p == 0 || spec_size >= sizeof(spec) || arg == entry.arg_count)
+        {
+            break;
+        }
+        std::memcpy(spec, start, spec_size);
+        spec[spec_size] = 0;
+        p++;
+
+        const uintptr_t value = entry.args[arg];
+        const bool is_float = (entry.float_mask >> arg) & 1;
+        arg++;
+        char *out = line + length;
+        const size_t space = size - length;
+        int written;
+        switch (spec[spec_size - 1])
+        {
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            float f = 0.0f;
+            if (is_float)
+            {
+                const uint32_t bits = static_cast<uint32_t>(value);
+                std::memcpy(&f, &bits, sizeof(f));
+            }
+            written = snprintf(out, space, spec, static_cast<double>(f));
+            break;
+        }
+        case 's':
+            written = snprintf(out, space, spec, value != 0 ? reinterpret_cast<const char *>(value) : "(null)");
+            break;
+        case 'p':
+            written = snprintf(out, space, spec, reinterpret_cast<void *>(value));
+            break;
+        default:
+            // long, size_t and ptrdiff_t are as wide as uintptr_t, the rest fits an int
+            if (std::strpbrk(spec, "lzt") != nullptr)
+            {
+                written = snprintf(out, space, spec, static_cast<unsigned long>(value));
+            }
+            else
+            {
+                written = snprintf(out, space, spec, static_cast<unsigned int>(value));
+            }
+            break;
+        }
+        if (written < 0)
+        {
+            break;
+        }
+        length += std::min(static_cast<size_t>(written), space - 1);
+    }
+    line[length] = 0;
+    return length;
+}
+
 bool UsbSerial::ReceivedChar(const char character)
 {
     if (!enabled_)
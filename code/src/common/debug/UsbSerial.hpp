@@ -25,7 +25,14 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "hardware/sync.h"
 #include "tusb.h"
+#include "common/core/MultiCoreQueue.hpp"
 
 namespace kastle2
 {
@@ -37,6 +44,12 @@ namespace kastle2
  * @author Marek Mach (Bastl Instruments), Vaclav Mach (Bastl Instruments)
  * @note Use through Kastle2::debug. Call SetEnabled(true) to enable the communication.
  * @date 2025-03-4
+ *
+ * Print() and PrintLine() are for the UI loop, they wait for the USB when the output is full.
+ * Log() can be called from anywhere (both cores, the audio callback, interrupts) and never waits:
+ * it stores the format pointer and the arguments to a queue of the calling core and Process() formats
+ * them later, as much as the USB takes without waiting. Full queues drop the messages, Process() reports
+ * the number of the dropped ones.
  */
 class UsbSerial
 {
@@ -55,6 +68,15 @@ public:
         enabled_ = enabled;
     }
 
+    /**
+     * @brief Leaves the received data to a binary protocol (eg. UserDataUploader), no characters are read meanwhile
+     * @param claimed If true, Process() doesn't read the received data
+     */
+    void SetInputClaimed(bool claimed)
+    {
+        input_claimed_ = claimed;
+    }
+
     /**
      * @brief Task to be called in the main loop repeatedly, handles USB event and serial receiving / filtering
      */
@@ -83,6 +105,52 @@ public:
      */
     void PrintLine(const char *data, const size_t size = 0);
 
+    /**
+     * @brief Maximum number of Log() arguments.
+     */
+    static constexpr size_t kLogMaxArgs = 4;
+
+    /**
+     * @brief Messages waiting in the queue of each core.
+     */
+    static constexpr size_t kLogQueueSize = 32;
+
+    /**
+     * @brief Longest formatted Log() message, longer ones are cut.
+     */
+    static constexpr size_t kLogLineSize = 96;
+
+    /**
+     * @brief Logs a printf-like message without waiting, from any core or interrupt.
+     * @param format Format string, must stay valid (a literal), it's formatted later in Process()
+     * @param args Up to kLogMaxArgs integers, floats, enums or pointers. Strings (%s) must stay valid too.
+     * @note The 64-bit conversions (%lld, %jd) and the * width are not supported.
+     */
+    template <typename... Args>
+    void Log(const char *format, const Args... args)
+    {
+        static_assert(sizeof...(Args) <= kLogMaxArgs, "Too many Log() arguments");
+        if (!enabled_)
+        {
+            return;
+        }
+        LogEntry entry;
+        entry.format = format;
+        entry.arg_count = sizeof...(Args);
+        entry.float_mask = 0;
+        [[maybe_unused]] size_t index = 0;
+        (StoreArg(entry, index++, args), ...);
+        PushLog(entry);
+    }
+
+    /**
+     * @brief Number of Log() messages dropped since the start because the queue was full.
+     */
+    uint32_t GetLogDroppedCount() const
+    {
+        return log_dropped_[0] + log_dropped_[1];
+    }
+
     /**
      * @brief Flushes the USB serial output buffer
      * @note This is useful if you want to ensure the data is sent ASAP
@@ -109,12 +177,56 @@ private:
 
     // RX stuff
     char usb_got_char_ = 0;
+    bool input_claimed_ = false;
 
     // TX stuff
     static constexpr size_t TX_BUFFER_SIZE = 256;
     char tx_buffer_[TX_BUFFER_SIZE];
     size_t tx_buffer_pos_ = 0;
 
+    // Log() message, formatted in Process()
+    struct LogEntry
+    {
+        const char *format;
+        std::array<uintptr_t, kLogMaxArgs> args;
+        uint8_t arg_count;
+        uint8_t float_mask; ///< Bit per argument stored as float bits
+    };
+
+    // Queue per core, the core's interrupts are held off for the push only
+    std::array<MultiCoreQueue<LogEntry, kLogQueueSize>, 2> log_queues_;
+    std::array<volatile uint32_t, 2> log_dropped_ = {0, 0};
+    uint32_t log_dropped_reported_ = 0;
+
+    template <typename T>
+    static void StoreArg(LogEntry &entry, const size_t index, const T value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            const float f = static_cast<float>(value);
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            entry.args[index] = bits;
+            entry.float_mask |= 1u << index;
+        }
+        else if constexpr (std::is_pointer_v<T>)
+        {
+            entry.args[index] = reinterpret_cast<uintptr_t>(value);
+        }
+        else
+        {
+            static_assert((std::is_integral_v<T> || std::is_enum_v<T>) && sizeof(T) <= sizeof(uintptr_t),
+                          "Log() takes integers, floats, enums and pointers");
+            entry.args[index] = static_cast<uintptr_t>(value);
+        }
+    }
+
+    void PushLog(const LogEntry &entry);
+
+    // Formats the queued messages while the USB FIFO has room, returns false when it got full
+    bool ProcessLog();
+    static size_t FormatLog(const LogEntry &entry, char *line, const size_t size);
+
     // Helper method to flush the internal buffer
     void FlushInternalBuffer();
 };
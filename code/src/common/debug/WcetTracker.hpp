@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include "common/debug/Profiler.hpp"
+#include "common/debug/UsbSerial.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class WcetTracker
+ * @ingroup debug
+ * @brief Worst-case busy cycles of an app's audio block per mode, on both cores.
+ * @details The app measures the busy cycles of each core in the block (eg. StageBalancer::Now() / Since(),
+ *          without the waiting for the other core) and passes them to Commit() with the mode of the block.
+ *          Send 'w' over USB serial to print the table against the block budget, 'W' to clear it.
+ *          It works without PROFILE_AUDIO_LOOP, the cost is a few compares per block.
+ * @note The maximums only grow, the startup and the mode switches are included.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+template <size_t kModes>
+class WcetTracker
+{
+public:
+    static constexpr size_t kCores = 2;
+
+    /**
+     * @brief Worst case of one mode.
+     */
+    struct Entry
+    {
+        std::array<uint32_t, kCores> max; ///< Maximal busy cycles per block of each core
+        uint32_t blocks;                  ///< Number of blocks measured in the mode
+    };
+
+    /**
+     * @param names Names of the modes for the report
+     */
+    explicit WcetTracker(const std::array<const char *, kModes> &names) : names_(names)
+    {
+        entries_.fill(Entry{});
+    }
+
+    /**
+     * @brief Adds a finished block, call from the audio loop when both cores are done with it.
+     * @param mode Mode the block ran in
+     * @param core0_cycles Busy cycles of core 0
+     * @param core1_cycles Busy cycles of core 1
+     */
+    inline void Commit(const size_t mode, const uint32_t core0_cycles, const uint32_t core1_cycles)
+    {
+        if (clear_)
+        {
+            entries_.fill(Entry{});
+            clear_ = false;
+        }
+        Entry &entry = entries_[mode];
+        entry.max[0] = std::max(entry.max[0], core0_cycles);
+        entry.max[1] = std::max(entry.max[1], core1_cycles);
+        entry.blocks++;
+    }
+
+    /**
+     * @brief Gets the worst case of a mode (read from the UI loop, the audio loop may be updating it).
+     */
+    Entry Get(const size_t mode) const
+    {
+        return entries_[mode];
+    }
+
+    /**
+     * @brief Clears the table at the next block.
+     */
+    void Clear()
+    {
+        clear_ = true;
+    }
+
+    /**
+     * @brief Prints the table on 'w' and clears it on 'W'. Call from the UI loop.
+     */
+    void Process(UsbSerial &serial)
+    {
+        if (serial.ReceivedChar('w'))
+        {
+            Print(serial);
+        }
+        if (serial.ReceivedChar('W'))
+        {
+            Clear();
+        }
+    }
+
+    /**
+     * @brief Prints the worst case of each measured mode, in cycles and in percent of the block budget.
+     */
+    void Print(UsbSerial &serial) const
+    {
+        char buff[96];
+        snprintf(buff, sizeof(buff), "WCET: %lu cycles per block", static_cast<unsigned long>(Profiler::kBlockBudgetCycles));
+        serial.PrintLine(buff);
+        for (size_t mode = 0; mode < kModes; mode++)
+        {
+            const Entry entry = entries_[mode];
+            if (entry.blocks == 0)
+            {
+                continue;
+            }
+            snprintf(buff, sizeof(buff), "%s: core 0 %lu (%lu%%) core 1 %lu (%lu%%) in %lu blocks",
+                     names_[mode],
+                     static_cast<unsigned long>(entry.max[0]), static_cast<unsigned long>(Percent(entry.max[0])),
+                     static_cast<unsigned long>(entry.max[1]), static_cast<unsigned long>(Percent(entry.max[1])),
+                     static_cast<unsigned long>(entry.blocks));
+            serial.PrintLine(buff);
+        }
+    }
+
+private:
+    static uint32_t Percent(const uint32_t cycles)
+    {
+        return static_cast<uint32_t>((static_cast<uint64_t>(cycles) * 100) / Profiler::kBlockBudgetCycles);
+    }
+
+    std::array<const char *, kModes> names_;
+    std::array<Entry, kModes> entries_;
+    volatile bool clear_ = false;
+};
+
+}
@@ -28,6 +28,7 @@ http://www.earlevel.com/main/2013/06/01/envelope-generators/
 */
 
 #include "AdsrEnv.hpp"
+#include <algorithm>
 #include <cmath>
 
 using namespace kastle2;
@@ -50,6 +51,10 @@ void AdsrEnv::Init(float sample_rate)
     target_ratioDR_log_ = 0.0f;
     target_ratioA_ = 0.0f;
     target_ratioDR_ = 0.0f;
+    target_ratioA_q_ = 0;
+    target_ratioDR_q_ = 0;
+    target_ratioA_log_q_ = 0;
+    target_ratioDR_log_q_ = 0;
     non_resetting_ = NonResetting::NONE;
     SetSustainLevel(0);
     SetReleaseTime(0);
@@ -66,6 +71,7 @@ void AdsrEnv::Reset()
     output_ = 0;
     hold_count_ = 0;
     next_trigger_ = false;
+    trigger_frame_ = 0;
 }
 
 void AdsrEnv::SetAttackTime(float time)
@@ -100,6 +106,43 @@ float AdsrEnv::CalcCoef(float rate, float targetRatioLog)
     return exp(targetRatioLog / rate);
 }
 
+// The bases are clamped to 0-Q31_MAX the same way float_to_q31 does in the float setters,
+// so both give the same curves
+void AdsrEnv::SetAttackQ(uint32_t samples)
+{
+    // base = (1.0 + target_ratio) * (1.0 - coef)
+    const q31_t one_minus_coef = CalcOneMinusCoefQ(samples, target_ratioA_log_q_);
+    const int64_t attack_base = one_minus_coef + (((int64_t)target_ratioA_q_ * one_minus_coef) >> 31);
+    attack_coef_ = Q31_MAX - one_minus_coef;
+    attack_base_ = attack_base > Q31_MAX ? Q31_MAX : (q31_t)attack_base;
+}
+
+void AdsrEnv::SetDecayQ(uint32_t samples)
+{
+    // base = (sustain_level - target_ratio) * (1.0 - coef)
+    const q31_t one_minus_coef = CalcOneMinusCoefQ(samples, target_ratioDR_log_q_);
+    const int64_t decay_base = ((int64_t)(sustain_level_ - target_ratioDR_q_) * one_minus_coef) >> 31;
+    decay_coef_ = Q31_MAX - one_minus_coef;
+    decay_base_ = decay_base < 0 ? 0 : (q31_t)decay_base;
+}
+
+void AdsrEnv::SetReleaseQ(uint32_t samples)
+{
+    // base = -target_ratio * (1.0 - coef), which is always clamped to zero
+    release_coef_ = Q31_MAX - CalcOneMinusCoefQ(samples, target_ratioDR_log_q_);
+    release_base_ = 0;
+}
+
+q31_t AdsrEnv::CalcOneMinusCoefQ(uint32_t samples, uint32_t target_ratio_log_q)
+{
+    // coef = exp(-target_ratio_log / samples), zero samples is an instant change (coef = 0)
+    if (samples == 0)
+    {
+        return Q31_MAX;
+    }
+    return q31_one_minus_exp(target_ratio_log_q / samples);
+}
+
 void AdsrEnv::SetNonResetting(NonResetting option)
 {
     non_resetting_ = option;
@@ -140,6 +183,8 @@ void AdsrEnv::SetTargetRatioA(float targetRatio)
         targetRatio = 0.000000001; // -180 dB
     target_ratioA_ = targetRatio;
     target_ratioA_log_ = -log((1.0 + target_ratioA_) / target_ratioA_);
+    target_ratioA_q_ = float_to_q31(target_ratioA_);
+    target_ratioA_log_q_ = -target_ratioA_log_ * (1 << 27);
 }
 
 void AdsrEnv::SetTargetRatioDR(float targetRatio)
@@ -148,11 +193,18 @@ void AdsrEnv::SetTargetRatioDR(float targetRatio)
         targetRatio = 0.000000001; // -180 dB
     target_ratioDR_ = targetRatio;
     target_ratioDR_log_ = -log((1.0 + target_ratioDR_) / target_ratioDR_);
+    target_ratioDR_q_ = float_to_q31(target_ratioDR_);
+    target_ratioDR_log_q_ = -target_ratioDR_log_ * (1 << 27);
 }
 
 FASTCODE q31_t AdsrEnv::Process()
 {
-    if (next_trigger_)
+    if (next_trigger_ && trigger_frame_ > 0)
+    {
+        // Not yet, TriggerAt() a later frame
+        trigger_frame_--;
+    }
+    else if (next_trigger_)
     {
         next_trigger_ = false;
 
@@ -237,9 +289,135 @@ FASTCODE q31_t AdsrEnv::Process()
     return output_;
 }
 
+FASTCODE void AdsrEnv::ProcessBlock(q31_t *out, size_t size, size_t step)
+{
+    step = std::max<size_t>(step, 1);
+    size_t done = 0;
+    if (next_trigger_ && trigger_frame_ > 0)
+    {
+        // The samples before the trigger still run the previous envelope
+        const size_t frames = std::min(trigger_frame_, size);
+        next_trigger_ = false;
+        ProcessSegment(out, frames, step);
+        next_trigger_ = true;
+        trigger_frame_ -= frames;
+        if (trigger_frame_ > 0)
+        {
+            return;
+        }
+        done = frames;
+    }
+    ProcessSegment(out != nullptr ? out + done : nullptr, size - done, step);
+}
+
+FASTCODE void AdsrEnv::ProcessSegment(q31_t *out, size_t size, size_t step)
+{
+    for (size_t offset = 0; offset < size; offset += step)
+    {
+        const size_t count = std::min(step, size - offset);
+        const q31_t start = output_;
+
+        // The stage changes land on their sample, the shorter last step too (no jump of that length)
+        if (count != step || !Step(count))
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const q31_t value = Process();
+                if (out != nullptr)
+                {
+                    out[offset + i] = value;
+                }
+            }
+            continue;
+        }
+
+        if (out != nullptr)
+        {
+            const q31_t delta = (output_ - start) / static_cast<q31_t>(count);
+            q31_t value = start;
+            for (size_t i = 0; i + 1 < count; i++)
+            {
+                value += delta;
+                out[offset + i] = value;
+            }
+            out[offset + count - 1] = output_;
+        }
+    }
+}
+
+FASTCODE bool AdsrEnv::Step(size_t steps)
+{
+    if (next_trigger_)
+    {
+        return false;
+    }
+
+    switch (state_)
+    {
+    case State::IDLE:
+        return !looping_;
+    case State::SUSTAIN:
+        return true;
+    case State::HOLD:
+        if (hold_count_ + static_cast<long>(steps) < hold_value_)
+        {
+            hold_count_ += steps;
+            return true;
+        }
+        return false;
+    case State::ATTACK:
+        return JumpStage(attack_jump_, attack_coef_, attack_base_, steps, output_, 0, Q31_MAX - 1);
+    case State::DECAY:
+        // The frozen decay rises back only within a range, per sample
+        return !decay_freeze_ && JumpStage(decay_jump_, decay_coef_, decay_base_, steps, output_, static_cast<int64_t>(sustain_level_) + 1, Q31_MAX);
+    case State::RELEASE:
+        return JumpStage(release_jump_, release_coef_, release_base_, steps, output_, 1, Q31_MAX);
+    }
+    return false;
+}
+
+bool AdsrEnv::JumpStage(Jump &jump, q31_t coef, q31_t base, size_t steps, q31_t &output, int64_t low, int64_t high)
+{
+    if (jump.coef != coef || jump.base != base || jump.steps != steps)
+    {
+        // (coef, base)^steps by squaring, the powers of one stage commute,
+        // 1.0 is exact in the 64 bits
+        int64_t coef_n = int64_t{1} << 31;
+        int64_t base_n = 0;
+        int64_t power_coef = coef;
+        int64_t power_base = base;
+        for (size_t n = steps; n > 0; n >>= 1)
+        {
+            if (n & 1)
+            {
+                base_n = ((base_n * power_coef) >> 31) + power_base;
+                coef_n = (coef_n * power_coef) >> 31;
+            }
+            power_base = ((power_base * power_coef) >> 31) + power_base;
+            power_coef = (power_coef * power_coef) >> 31;
+        }
+        jump = {coef, base, steps, coef_n, base_n};
+    }
+
+    const int64_t result = ((static_cast<int64_t>(output) * jump.coef_n) >> 31) + jump.base_n;
+    if (result < low || result > high)
+    {
+        return false;
+    }
+    output = static_cast<q31_t>(result);
+    return true;
+}
+
 FASTCODE void AdsrEnv::Trigger()
 {
     next_trigger_ = true;
+    trigger_frame_ = 0;
+}
+
+FASTCODE void AdsrEnv::TriggerAt(size_t frame)
+{
+    next_trigger_ = true;
+    trigger_frame_ = frame;
 }
 
 AdsrEnv::State AdsrEnv::GetState() const
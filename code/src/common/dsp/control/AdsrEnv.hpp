@@ -24,6 +24,7 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include "common/dsp/math/qmath.hpp"
 #include "common/fastcode.hpp"
@@ -41,6 +42,10 @@ namespace kastle2
  *
  * Based on ADSR envelope made by Nigel Redmon.
  * http://www.earlevel.com/main/2013/06/01/envelope-generators/
+ *
+ * For the envelopes which don't need the per sample curve (amplitudes, fades), ProcessBlock() computes
+ * the exact value every kBlockStep samples from the stage coefficients raised to the step (coef^N)
+ * and ramps linearly in between. The stage changes still happen at their sample.
  */
 class AdsrEnv
 {
@@ -69,6 +74,16 @@ public:
         ATTACK_AND_DECAY ///< Non-resetting attack and decay
     };
 
+    /**
+     * @brief Coefficients of one stage, computed by the time setters
+     * @details For computing them ahead (eg. in the UI loop, or stored in a preset) and setting them without any math.
+     */
+    struct Stage
+    {
+        q31_t coef = 0;
+        q31_t base = 0;
+    };
+
     /**
      * @brief How much linear/curved is the attack
      */
@@ -79,6 +94,11 @@ public:
      */
     static constexpr float kRatioDecay = 0.005f;
 
+    /**
+     * @brief Default samples between the exact values of ProcessBlock()
+     */
+    static constexpr size_t kBlockStep = 8;
+
     /**
      * @brief Reset the envelope to default values and idle state
      * @param sample_rate Sample rate of the audio processing
@@ -91,6 +111,16 @@ public:
      */
     FASTCODE q31_t Process(void);
 
+    /**
+     * @brief Processes a block, the values are exact every step samples and ramped linearly in between
+     * @details The steps with a stage change (or a trigger) are processed per sample. Triggers set
+     * by TriggerAt() start at their frame.
+     * @param out Envelope values (size of them), can be nullptr when only GetOutput() is needed
+     * @param size Number of samples
+     * @param step Samples between the exact values
+     */
+    FASTCODE void ProcessBlock(q31_t *out, size_t size, size_t step = kBlockStep);
+
     /**
      * @brief Get the current state of the envelope
      * @return Current state of the envelope
@@ -124,6 +154,59 @@ public:
      */
     void SetReleaseTime(float time);
 
+    /**
+     * @brief Set the attack time in samples, without any float math (fast enough for audio-rate modulation)
+     * @param samples Attack time in samples of the sample rate given to Init (time * sample_rate)
+     */
+    void SetAttackQ(uint32_t samples);
+
+    /**
+     * @brief Set the decay time in samples, without any float math
+     * @param samples Decay time in samples of the sample rate given to Init
+     * @note Uses the current sustain level, set it first
+     */
+    void SetDecayQ(uint32_t samples);
+
+    /**
+     * @brief Set the release time in samples, without any float math
+     * @param samples Release time in samples of the sample rate given to Init
+     */
+    void SetReleaseQ(uint32_t samples);
+
+    /**
+     * @brief Returns the attack coefficients (of the last SetAttackTime() or SetAttackQ())
+     */
+    Stage GetAttack() const
+    {
+        return {attack_coef_, attack_base_};
+    }
+
+    /**
+     * @brief Sets the attack coefficients from GetAttack() of an envelope with the same sample rate and ratios
+     */
+    void SetAttack(const Stage &stage)
+    {
+        attack_coef_ = stage.coef;
+        attack_base_ = stage.base;
+    }
+
+    /**
+     * @brief Returns the decay coefficients (of the last SetDecayTime() or SetDecayQ())
+     */
+    Stage GetDecay() const
+    {
+        return {decay_coef_, decay_base_};
+    }
+
+    /**
+     * @brief Sets the decay coefficients from GetDecay() of an envelope with the same sample rate, ratios and sustain
+     */
+    void SetDecay(const Stage &stage)
+    {
+        decay_coef_ = stage.coef;
+        decay_base_ = stage.base;
+    }
+
     /**
      * @brief Set the sustain level in Q31 fixed point
      * @param level Sustain level between 0-Q31_MAX
@@ -187,6 +270,13 @@ public:
      */
     FASTCODE void Trigger();
 
+    /**
+     * @brief Trigger the envelope generator at a frame of the next processed block
+     * @param frame Samples from the start of the next ProcessBlock() (or Process() calls) to the trigger,
+     *              eg. the frame of Kastle2::AudioMidiCallback
+     */
+    FASTCODE void TriggerAt(size_t frame);
+
     /**
      * @brief Reset the envelope to idle state and zero output
      */
@@ -227,6 +317,12 @@ protected:
     float target_ratioA_log_ = 0.0f;
     float target_ratioDR_log_ = 0.0f;
 
+    // The same for the fixed point setters, ratios in Q31 and log((1.0 + target_ratio) / target_ratio) in unsigned Q27
+    q31_t target_ratioA_q_ = 0;
+    q31_t target_ratioDR_q_ = 0;
+    uint32_t target_ratioA_log_q_ = 0;
+    uint32_t target_ratioDR_log_q_ = 0;
+
     // Sustain settings
     q31_t sustain_level_ = 0;
 
@@ -242,18 +338,47 @@ protected:
     q31_t release_base_ = 0;
     q31_t decay_freeze_base_ = 0;
     q31_t decay_freeze_coef_ = 0;
+
+    // A stage advanced by steps samples at once: y = coef_n * y + base_n
+    struct Jump
+    {
+        q31_t coef = 0;
+        q31_t base = 0;
+        size_t steps = 0;
+        int64_t coef_n = 0;
+        int64_t base_n = 0;
+    };
+    Jump attack_jump_;
+    Jump decay_jump_;
+    Jump release_jump_;
+
     static inline float CalcCoef(float rate, float targetRatio);
 
+    // 1 - coefficient in Q31, from the lookup table
+    static inline q31_t CalcOneMinusCoefQ(uint32_t samples, uint32_t target_ratio_log_q);
+
     // Don't start attack from zero, removes "clicks"
     NonResetting non_resetting_ = NonResetting::NONE;
 
     // Trigger flag
     bool next_trigger_ = false;
 
+    // Samples until the pending trigger starts (TriggerAt)
+    size_t trigger_frame_ = 0;
+
     // Freeze in decay (as it currently is, or right after attack ends)
     bool decay_freeze_ = false;
 
     // Result = a + b * c;
     static inline q31_t MultAdd(q31_t a, q31_t b, q31_t c);
+
+    // Advances the stage by the jump when it stays within the stage, the value past the stage is not kept
+    static inline bool JumpStage(Jump &jump, q31_t coef, q31_t base, size_t steps, q31_t &output, int64_t low, int64_t high);
+
+    // Advances the envelope by steps samples at once, false when it would change the stage (nothing is changed)
+    FASTCODE bool Step(size_t steps);
+
+    // ProcessBlock() without the pending trigger frame
+    FASTCODE void ProcessSegment(q31_t *out, size_t size, size_t step);
 };
 }
@@ -23,6 +23,8 @@ SOFTWARE.
 */
 
 #include "BeatDetector.hpp"
+#include <algorithm>
+#include <bit>
 #include <numbers>
 #include "common/dsp/math/math_utils.hpp"
 #include "common/dsp/math/qmath.hpp"
@@ -33,7 +35,7 @@ using namespace kastle2;
 #define T_FILTER (1.0f / (2.0f * std::numbers::pi * FREQ_LP_BEAT)) // Low Pass filter time constant
 #define BEAT_RTIME 0.5f                                            // Release time of envelope detector in second
 
-void BeatDetector::Init(float sample_rate)
+void BeatDetector::Init(float sample_rate, uint32_t decimation)
 // Compute all sample frequency related coeffs
 {
     filter_1_out_ = Q15_ZERO;
@@ -42,6 +44,12 @@ void BeatDetector::Init(float sample_rate)
     beat_trigger_ = false;
     beat_pulse_prev = false;
 
+    decimation_ = std::bit_floor(std::max(decimation, 1u));
+    decimation_shift_ = std::countr_zero(decimation_);
+    sum_ = 0;
+    count_ = 0;
+    sample_rate /= static_cast<float>(decimation_);
+
     k_beat_filter_ = float_to_q15(1.f / (sample_rate * T_FILTER));
     beat_release_ = float_to_q15(exp(-1.0f / (sample_rate * BEAT_RTIME)));
 }
@@ -55,7 +63,7 @@ q15_t BeatDetector::AudioProcess(q15_t input)
     filter_1_out_ = q15_add(filter_1_out_, q15_mult(k_beat_filter_, (q15_sub(input, filter_1_out_))));
     filter_2_out_ = q15_add(filter_2_out_, q15_mult(k_beat_filter_, (q15_sub(filter_1_out_, filter_2_out_))));
     filter_3_out_ = q15_add(filter_3_out_, q15_mult(k_beat_filter_, (q15_sub(filter_2_out_, filter_3_out_))));
-    filter_3_out_ = q15_div(filter_3_out_, Q15_MAX - 100); // boost for better noise separation
+    filter_3_out_ = q15_div_by<Q15_MAX - 100>(filter_3_out_); // boost for better noise separation
 
     // Step 2 : peak detector
     env_in = q15_abs(filter_2_out_);
@@ -95,3 +103,19 @@ q15_t BeatDetector::AudioProcess(q15_t input)
 
     return beat_pulse_;
 }
+
+bool BeatDetector::ProcessBlock(const q15_t *input, size_t size, size_t stride)
+{
+    bool beat = false;
+    for (size_t i = 0; i < size; i++)
+    {
+        sum_ += input[i * stride];
+        if (++count_ == decimation_)
+        {
+            beat |= AudioProcess(sum_ >> decimation_shift_) != 0;
+            sum_ = 0;
+            count_ = 0;
+        }
+    }
+    return beat;
+}
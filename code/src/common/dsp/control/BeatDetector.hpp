@@ -24,6 +24,8 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include "common/dsp/math/qmath.hpp"
 
 namespace kastle2
@@ -35,6 +37,10 @@ namespace kastle2
  * @brief Audio beat detector for clock syncing and similar
  * @authors rf.eerf@retsaMPSD https://www.musicdsp.org/en/latest/Analysis/200-beat-detector-class.html, ported by Marek Mach (Bastl Instruments)
  * @date 2024-08-26
+ *
+ * The detector only follows the low end below 150 Hz, so it doesn't need the full audio rate.
+ * Init() with a decimation and ProcessBlock() run it on the means of each decimation samples of the block,
+ * (the mean is the anti-aliasing filter), with the coefficients for the lower rate.
  */
 
 class BeatDetector
@@ -49,13 +55,18 @@ private:
     bool beat_trigger_ = false;   // Schmitt trigger output
     bool beat_pulse_prev = false; // Rising edge memory
     bool beat_pulse_ = false;     // Beat detector output
+    int32_t sum_ = 0;             // Sum of the samples of the current mean
+    uint32_t count_ = 0;          // Samples of the current mean
+    uint32_t decimation_ = 1;     // Samples per mean, a power of two
+    uint8_t decimation_shift_ = 0;
 
 public:
     /**
      * @brief Initializes the envelope follower
-     * @param sample_rate How often is the AudioProcess() function called
+     * @param sample_rate How often is the AudioProcess() function called, or the sample rate of the ProcessBlock() input
+     * @param decimation Input samples per processed mean in ProcessBlock(), a power of two (eg. 8)
      */
-    void Init(float sample_rate);
+    void Init(float sample_rate, uint32_t decimation = 1);
 
     /**
      * @brief Processes the audio and returns if a bette was detected
@@ -63,5 +74,14 @@ public:
      * @return If a beat was detected or not, in bool format
      */
     q15_t AudioProcess(q15_t input);
+
+    /**
+     * @brief Processes a block at the decimated rate, the means continue over the blocks
+     * @param input Audio input
+     * @param size Number of samples
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo
+     * @return True if a beat was detected in the block
+     */
+    bool ProcessBlock(const q15_t *input, size_t size, size_t stride = 1);
 };
 }
@@ -0,0 +1,307 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/Fraction.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/synthesis/Oscillator.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class LfoBank
+ * @ingroup dsp_control
+ * @brief N low frequency oscillators sharing one phase engine, waveform and clock.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The phases and increments are kept as arrays and advanced together by one Process() call per block,
+ * which writes the values of all the lanes at once (per sample, per sub-block or once per block),
+ * instead of calling Oscillator::Process() of each modulator for every sample.
+ *
+ * Each lane either runs free (SetFrequency(), SetNativeFrequency()) or follows the shared clock
+ * (SetRatio() + SetClockTicks() + SyncWithClock() on each clock tick), 1:4 meaning one LFO cycle per 4 clock ticks.
+ * A synced lane does not snap to the clock: the phase error found at the sync point is spread over the
+ * increments until the next one.
+ *
+ * The waveforms match Oscillator (the square is 50% duty).
+ */
+template <size_t N>
+class LfoBank
+{
+public:
+    /**
+     * @brief Initializes all the lanes to free running at 1 Hz, starting at the beginning of the cycle.
+     * @param sample_rate Rate of the Process() samples
+     */
+    void Init(const float sample_rate)
+    {
+        sample_rate_ = sample_rate;
+        clock_ticks_ = 500;
+        for (size_t lane = 0; lane < N; lane++)
+        {
+            ratio_[lane] = {1, 1};
+            synced_[lane] = false;
+            reset_counter_[lane] = 0;
+            SetFrequency(lane, 1.0f);
+            Reset(lane);
+        }
+    }
+
+    /**
+     * @brief Sets the waveform of all the lanes.
+     */
+    void SetWaveform(const Oscillator::Waveform waveform)
+    {
+        waveform_ = waveform;
+    }
+
+    /**
+     * @brief Sets the lane free running at the frequency.
+     * @param lane Lane index
+     * @param frequency Frequency in Hz
+     */
+    void SetFrequency(const size_t lane, const float frequency)
+    {
+        SetNativeFrequency(lane, freq_to_q31(frequency, sample_rate_));
+    }
+
+    /**
+     * @brief Sets the lane free running at the relative frequency (see freq_to_q31).
+     * @param lane Lane index
+     * @param native_frequency Frequency relative to the sample rate in q31_t
+     */
+    void SetNativeFrequency(const size_t lane, const q31_t native_frequency)
+    {
+        synced_[lane] = false;
+        correction_[lane] = 0;
+        phase_inc_[lane] = Oscillator::CalcPhaseIncrement(native_frequency);
+    }
+
+    /**
+     * @brief Sets the length of the clock period for the synced lanes.
+     * @param clock_ticks Samples per clock tick
+     */
+    void SetClockTicks(const uint32_t clock_ticks)
+    {
+        clock_ticks_ = clock_ticks == 0 ? 1 : clock_ticks;
+        for (size_t lane = 0; lane < N; lane++)
+        {
+            if (synced_[lane])
+            {
+                UpdateSyncedIncrement(lane);
+            }
+        }
+    }
+
+    /**
+     * @brief Syncs the lane to the clock, the ratio is LFO cycles per clock ticks (2:3, 1:4 etc.).
+     * @param lane Lane index
+     * @param ratio Cycles (n) per clock ticks (d)
+     */
+    void SetRatio(const size_t lane, const Fraction &ratio)
+    {
+        if (!synced_[lane] || !(ratio_[lane] == ratio))
+        {
+            reset_counter_[lane] = 0;
+        }
+        ratio_[lane] = ratio;
+        synced_[lane] = true;
+        UpdateSyncedIncrement(lane);
+    }
+
+    /**
+     * @brief Call on each clock tick, brings the synced lanes back to the cycle start when a whole number
+     * of their cycles has passed.
+     */
+    FASTCODE void SyncWithClock()
+    {
+        for (size_t lane = 0; lane < N; lane++)
+        {
+            if (!synced_[lane])
+            {
+                continue;
+            }
+
+            // A lane slower than the clock or with a special ratio (2/3) is back at the start every n * d ticks
+            const uint32_t reset_delay_count = ratio_[lane].d == 1 ? 1 : ratio_[lane].n * ratio_[lane].d;
+            if (++reset_counter_[lane] < reset_delay_count)
+            {
+                continue;
+            }
+            reset_counter_[lane] = 0;
+
+            const uint32_t ticks_to_next = clock_ticks_ * reset_delay_count;
+            if (clock_ticks_ <= kMinSyncedTicks || ticks_to_next > static_cast<uint32_t>(INT32_MAX))
+            {
+                // Too fast to drift, or too slow to compute the drift
+                Reset(lane);
+                continue;
+            }
+
+            // Signed distance from the cycle start, spread over the samples until the next sync
+            const int32_t error = static_cast<int32_t>(static_cast<uint32_t>(phase_[lane]) - static_cast<uint32_t>(Q31_MIN));
+            correction_[lane] = -error / static_cast<int32_t>(ticks_to_next);
+        }
+    }
+
+    /**
+     * @brief Sets the phase of the lane.
+     * @param lane Lane index
+     * @param phase Phase from Q31_MIN (cycle start) to Q31_MAX
+     */
+    void Reset(const size_t lane, const q31_t phase = Q31_MIN)
+    {
+        phase_[lane] = phase;
+        correction_[lane] = 0;
+    }
+
+    /**
+     * @brief Returns the phase of the lane, from Q31_MIN to Q31_MAX.
+     */
+    q31_t GetPhase(const size_t lane) const
+    {
+        return phase_[lane];
+    }
+
+    /**
+     * @brief Returns the phase increment of the lane per sample.
+     */
+    q31_t GetPhaseIncrement(const size_t lane) const
+    {
+        return phase_inc_[lane];
+    }
+
+    /**
+     * @brief Returns if the lane follows the clock.
+     */
+    bool IsSynced(const size_t lane) const
+    {
+        return synced_[lane];
+    }
+
+    /**
+     * @brief Advances all the lanes by count * step samples and writes count values of each lane.
+     * Each value is the waveform at the start of its step, so step 1 gives the values per sample,
+     * step of the block size one value per block.
+     * @param out Values per lane, at least count of them
+     * @param count Number of values per lane
+     * @param step Samples per value
+     */
+    template <size_t kCapacity>
+    FASTCODE void Process(std::array<std::array<q31_t, kCapacity>, N> &out, const size_t count, const uint32_t step = 1)
+    {
+        switch (waveform_)
+        {
+        case Oscillator::Waveform::SINE:
+            ProcessLanes<Oscillator::Waveform::SINE>(out, count, step);
+            break;
+        case Oscillator::Waveform::TRI:
+            ProcessLanes<Oscillator::Waveform::TRI>(out, count, step);
+            break;
+        case Oscillator::Waveform::SAW:
+            ProcessLanes<Oscillator::Waveform::SAW>(out, count, step);
+            break;
+        case Oscillator::Waveform::RAMP:
+            ProcessLanes<Oscillator::Waveform::RAMP>(out, count, step);
+            break;
+        default:
+            ProcessLanes<Oscillator::Waveform::SQUARE>(out, count, step);
+            break;
+        }
+    }
+
+private:
+    template <Oscillator::Waveform kWaveform>
+    static inline q31_t Shape(const q31_t phase)
+    {
+        if constexpr (kWaveform == Oscillator::Waveform::SINE)
+        {
+            // -1:1 phase to the 0:1 sine table range
+            return q31_sine(phase / 2 + Q31_HALF);
+        }
+        else if constexpr (kWaveform == Oscillator::Waveform::TRI)
+        {
+            return phase < Q31_ZERO ? (phase + Q31_HALF) * 2 : (Q31_HALF - phase) * 2;
+        }
+        else if constexpr (kWaveform == Oscillator::Waveform::SAW)
+        {
+            return -phase;
+        }
+        else if constexpr (kWaveform == Oscillator::Waveform::RAMP)
+        {
+            return phase;
+        }
+        else
+        {
+            return phase < Q31_ZERO ? Q31_MAX : Q31_MIN;
+        }
+    }
+
+    template <Oscillator::Waveform kWaveform, size_t kCapacity>
+    FASTCODE void ProcessLanes(std::array<std::array<q31_t, kCapacity>, N> &out, const size_t count, const uint32_t step)
+    {
+        for (size_t lane = 0; lane < N; lane++)
+        {
+            // Unsigned, the phase wraps around at the end of the cycle
+            uint32_t phase = static_cast<uint32_t>(phase_[lane]);
+            const uint32_t increment = static_cast<uint32_t>(phase_inc_[lane] + correction_[lane]) * step;
+            q31_t *values = out[lane].data();
+            for (size_t i = 0; i < count; i++)
+            {
+                values[i] = Shape<kWaveform>(static_cast<q31_t>(phase));
+                phase += increment;
+            }
+            phase_[lane] = static_cast<q31_t>(phase);
+        }
+    }
+
+    void UpdateSyncedIncrement(const size_t lane)
+    {
+        const uint32_t ticks = clock_ticks_ * ratio_[lane].d / ratio_[lane].n;
+        phase_inc_[lane] = ticks < 2 ? Q31_MAX : Q31_MAX / static_cast<q31_t>(ticks / 2);
+    }
+
+    // Don't drift to the clock if too fast, reset instead
+    static constexpr uint32_t kMinSyncedTicks = 30;
+
+    float sample_rate_ = 0.0f;
+    Oscillator::Waveform waveform_ = Oscillator::Waveform::SINE;
+    uint32_t clock_ticks_ = 500;
+    std::array<q31_t, N> phase_ = {};
+    std::array<q31_t, N> phase_inc_ = {};
+    std::array<q31_t, N> correction_ = {};
+    std::array<Fraction, N> ratio_ = {};
+    std::array<uint32_t, N> reset_counter_ = {};
+    std::array<bool, N> synced_ = {};
+};
+
+}
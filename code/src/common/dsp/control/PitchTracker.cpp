@@ -0,0 +1,131 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "PitchTracker.hpp"
+#include <algorithm>
+#include "common/fastcode.hpp"
+
+using namespace kastle2;
+
+void PitchTracker::Reset()
+{
+    fill_ = 0;
+    lag_ = 0;
+    sum_ = 0;
+    count_ = 0;
+}
+
+FASTCODE bool PitchTracker::Process(Estimate &estimate)
+{
+    if (fill_ < kBufferSize)
+    {
+        return false;
+    }
+
+    if (lag_ == 0)
+    {
+        // The first step only checks the level, a quiet input has no pitch worth the work
+        uint64_t energy = 0;
+        for (size_t i = 0; i < kWindow; i++)
+        {
+            energy += static_cast<uint32_t>(buffer_[i] * buffer_[i]);
+        }
+        if (energy < static_cast<uint64_t>(kMinLevel) * kWindow)
+        {
+            estimate = Estimate{.period = 0, .confidence = 0};
+            fill_ = 0;
+            return true;
+        }
+        difference_sum_ = 0;
+        normalized_[0] = 1u << 16;
+        lag_ = 1;
+        return false;
+    }
+
+    const size_t end = std::min(lag_ + kLagsPerStep, normalized_.size());
+    for (; lag_ < end; lag_++)
+    {
+        const int16_t *a = buffer_.data();
+        const int16_t *b = a + lag_;
+        uint64_t difference = 0;
+        for (size_t i = 0; i < kWindow; i++)
+        {
+            const int32_t d = a[i] - b[i];
+            difference += static_cast<uint32_t>(d * d);
+        }
+
+        // Divided by the mean of the differences up to this lag
+        difference_sum_ += difference;
+        normalized_[lag_] = difference_sum_ == 0 ? 1u << 16 : static_cast<uint32_t>(std::min<uint64_t>((difference * lag_ << 16) / difference_sum_, UINT32_MAX));
+    }
+
+    if (lag_ < normalized_.size())
+    {
+        return false;
+    }
+    estimate = Finish();
+    fill_ = 0;
+    lag_ = 0;
+    return true;
+}
+
+PitchTracker::Estimate PitchTracker::Finish() const
+{
+    // The first dip under the threshold, down to its bottom (YIN)
+    size_t best = 0;
+    for (size_t lag = kMinLag; lag <= kMaxLag; lag++)
+    {
+        if (normalized_[lag] < kThreshold)
+        {
+            best = lag;
+            while (best < kMaxLag && normalized_[best + 1] < normalized_[best])
+            {
+                best++;
+            }
+            break;
+        }
+    }
+
+    // Or the deepest one, when it's deep enough
+    if (best == 0)
+    {
+        best = std::min_element(normalized_.begin() + kMinLag, normalized_.begin() + kMaxLag + 1) - normalized_.begin();
+        if (normalized_[best] > kUnvoiced)
+        {
+            return Estimate{.period = 0, .confidence = 0};
+        }
+    }
+
+    // Parabola through the neighbours for the fraction of the lag
+    const int64_t previous = normalized_[best - 1];
+    const int64_t current = normalized_[best];
+    const int64_t next = normalized_[best + 1];
+    const int64_t curvature = previous + next - 2 * current;
+    const int32_t offset = curvature > 0 ? static_cast<int32_t>(std::clamp<int64_t>((previous - next) * 128 / curvature, -128, 128)) : 0;
+
+    return Estimate{
+        .period = static_cast<uint32_t>((static_cast<int32_t>(best * 256) + offset) * static_cast<int32_t>(kDecimation)),
+        .confidence = std::min<q15_t>((65536 - std::min<uint32_t>(normalized_[best], 65536)) >> 1, Q15_MAX),
+    };
+}
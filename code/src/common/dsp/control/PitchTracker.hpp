@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class PitchTracker
+ * @ingroup dsp_control
+ * @brief Fundamental frequency of a monophonic input (YIN), in fixed point, the work spread over the audio blocks.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Write() takes the audio samples and keeps the means of each kDecimation of them (the mean is the anti-aliasing
+ * filter) until kBufferSize of them are there. Then each Process() computes kLagsPerStep lags of the cumulative
+ * mean normalized difference over a kWindow window, the last one picks the first dip under kThreshold,
+ * refines it with a parabola and gives the Estimate. The samples written meanwhile are skipped,
+ * so an estimate comes every ~60 ms at 48 kHz, and a block costs at most kLagsPerStep * kWindow multiplies.
+ * The lags cover kMinLag to kMaxLag of the decimated rate: 1 kHz down to 60 Hz at 48 kHz.
+ */
+class PitchTracker
+{
+public:
+    /**
+     * @brief Input samples per analyzed mean.
+     */
+    static constexpr size_t kDecimation = 4;
+
+    /**
+     * @brief Decimated samples the differences are summed over, longer than the longest period.
+     */
+    static constexpr size_t kWindow = 256;
+
+    /**
+     * @brief Shortest period (highest pitch) in decimated samples.
+     */
+    static constexpr size_t kMinLag = 12;
+
+    /**
+     * @brief Longest period (lowest pitch) in decimated samples.
+     */
+    static constexpr size_t kMaxLag = 200;
+
+    /**
+     * @brief Lags computed by one Process() call.
+     */
+    static constexpr size_t kLagsPerStep = 8;
+
+    /**
+     * @brief Decimated samples of one analysis, the window and the lags after it (one more for the parabola).
+     */
+    static constexpr size_t kBufferSize = kWindow + kMaxLag + 1;
+
+    /**
+     * @brief Normalized difference under which a dip is taken as the period (0.15 in 1/65536).
+     */
+    static constexpr uint32_t kThreshold = 9830;
+
+    /**
+     * @brief Normalized difference over which the deepest dip isn't a pitch either (0.4 in 1/65536).
+     */
+    static constexpr uint32_t kUnvoiced = 26214;
+
+    /**
+     * @brief Quieter input is not analyzed, mean square of the halved samples (-40 dBFS).
+     */
+    static constexpr uint32_t kMinLevel = 164 * 164;
+
+    /**
+     * @brief One analysis.
+     */
+    struct Estimate
+    {
+        uint32_t period;    ///< Period in input samples, 1/256 (Q24.8), 0 when there is no pitch
+        q15_t confidence;   ///< 1 minus the normalized difference at the period, 0 when there is no pitch
+    };
+
+    /**
+     * @brief Starts over with an empty buffer.
+     */
+    void Reset();
+
+    /**
+     * @brief Adds an input sample. Cheap, call for every sample.
+     * @param sample Audio input (mono).
+     */
+    inline void Write(const q15_t sample)
+    {
+        if (fill_ == kBufferSize)
+        {
+            // Analyzing
+            return;
+        }
+        sum_ += sample;
+        if (++count_ == kDecimation)
+        {
+            // Halved, so the difference of two samples squared fits 32 bits
+            buffer_[fill_++] = static_cast<int16_t>(sum_ / static_cast<int32_t>(2 * kDecimation));
+            sum_ = 0;
+            count_ = 0;
+        }
+    }
+
+    /**
+     * @brief Does one step of the analysis, once a block or so.
+     * @param estimate Set when the analysis ends.
+     * @return True when the estimate is set, the next buffer is being collected then.
+     */
+    bool Process(Estimate &estimate);
+
+    /**
+     * @brief Frequency of a period.
+     * @param period Estimate::period, not 0.
+     * @param sample_rate Rate of the input samples.
+     * @return Frequency in Hz.
+     */
+    static float GetFrequency(const uint32_t period, const float sample_rate)
+    {
+        return sample_rate * 256.0f / static_cast<float>(period);
+    }
+
+private:
+    /**
+     * @brief Picks the period from the normalized differences.
+     */
+    Estimate Finish() const;
+
+    std::array<int16_t, kBufferSize> buffer_ = {};
+    std::array<uint32_t, kMaxLag + 2> normalized_ = {}; // Cumulative mean normalized difference per lag, 1/65536
+    uint64_t difference_sum_ = 0;                      // Of the lags computed so far
+    size_t fill_ = 0;
+    size_t lag_ = 0; // Next lag to compute, 0 before the level check
+    int32_t sum_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace kastle2
@@ -24,6 +24,8 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
+#include "common/core/Divider.hpp"
 #include "common/dsp/math/math_utils.hpp"
 #include "common/dsp/math/qmath.hpp"
 #include "common/fastcode.hpp"
@@ -39,6 +41,8 @@ namespace kastle2
  * @date 2024-05-31
  *
  * Reduces the bit depth of the input signal and downsamples it.
+ * ProcessBlock() gives the same output as Process() per sample, it handles the frames between two
+ * decimated samples as one run: a plain fill when the two are the same (most of the time at low bit depths).
  */
 class BitCrusher
 {
@@ -60,6 +64,21 @@ public:
     {
         bit_depth = constrain(bit_depth, kMinBitDepth, kMaxBitDepth);
         shift_ = kMaxBitDepth - bit_depth;
+
+        // Loudness compensation, so it doesn't blow up the volume too much when in lowest bit depths
+        int32_t shift_up = shift_;
+        if (shift_ > 12)
+        {
+            shift_up -= 1;
+        }
+        if (shift_ > 13)
+        {
+            shift_up -= 1;
+        }
+
+        // (sample >> shift_) << shift_up as a mask and one shift
+        mask_ = ~((1 << shift_) - 1);
+        shift_down_ = shift_ - shift_up;
     }
 
     /**
@@ -83,35 +102,80 @@ public:
         if (counter_ >= Q15_MAX)
         {
             counter_ -= Q15_MAX;
+            last_sample_ = next_sample_;
+            next_sample_ = Crush(sample);
+        }
 
-            int32_t shift_up = shift_;
+        // Linear interpolation between last_sample_ and next_sample_
+        return q15_add(last_sample_, q15_mult((next_sample_ - last_sample_), counter_));
+    }
 
-            // Loudness compensation, so it doesn't blow up the volume too much when in lowest bit depths
-            if (shift_ > 12)
+    /**
+     * @brief Processes a block of samples, the same as Process() for each of them.
+     * @param input Input samples.
+     * @param output Output samples (can be the same as input).
+     * @param size Number of samples to process.
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo.
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1)
+    {
+        size_t i = 0;
+        while (i < size)
+        {
+            // Frames before the next decimated sample, while the counter stays below Q15_MAX
+            const size_t until_next = Divider::Quotient<uint32_t>(Q15_MAX - 1 - counter_, sample_rate_);
+            const size_t run = until_next < size - i ? until_next : size - i;
+            const q15_t difference = next_sample_ - last_sample_;
+            if (difference == 0)
+            {
+                // Held, no interpolation
+                for (size_t j = i; j < i + run; j++)
+                {
+                    output[j * stride] = last_sample_;
+                }
+                counter_ += static_cast<int32_t>(run) * sample_rate_;
+            }
+            else
             {
-                shift_up -= 1;
+                for (size_t j = i; j < i + run; j++)
+                {
+                    counter_ += sample_rate_;
+                    output[j * stride] = q15_add(last_sample_, q15_mult(difference, counter_));
+                }
             }
-            if (shift_ > 13)
+            i += run;
+            if (i == size)
             {
-                shift_up -= 1;
+                break;
             }
 
+            // The decimated sample
+            counter_ += sample_rate_ - Q15_MAX;
             last_sample_ = next_sample_;
-            next_sample_ = (sample >> shift_) << shift_up;
+            next_sample_ = Crush(input[i * stride]);
+            output[i * stride] = q15_add(last_sample_, q15_mult((next_sample_ - last_sample_), counter_));
+            i++;
         }
-
-        // Linear interpolation between last_sample_ and next_sample_
-        return q15_add(last_sample_, q15_mult((next_sample_ - last_sample_), counter_));
     }
 
     static constexpr uint32_t kMinBitDepth = 1;
     static constexpr uint32_t kMaxBitDepth = 16;
 
-    static constexpr q15_t kMaxSampleRate = Q15_MAX;      // 44kHz, no downsampling
-    static constexpr q15_t kMinSampleRate = Q15_MAX / 64; // Approx 687.5 Hz for 44kHz sample rate
+    static constexpr q15_t kMaxSampleRate = Q15_MAX;      // SAMPLE_RATE, no downsampling
+    static constexpr q15_t kMinSampleRate = Q15_MAX / 64; // SAMPLE_RATE / 64, approx 687.5 Hz at 44 kHz
 
 private:
+    /**
+     * @brief Bit reduction of one sample, with the loudness compensation
+     */
+    inline q15_t Crush(q15_t sample) const
+    {
+        return (sample & mask_) >> shift_down_;
+    }
+
     int32_t shift_ = 0;
+    int32_t mask_ = -1;
+    int32_t shift_down_ = 0;
     q31_t sample_rate_ = 0;
     int32_t counter_ = 0;
     q15_t last_sample_ = 0;
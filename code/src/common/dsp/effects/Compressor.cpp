@@ -0,0 +1,173 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "Compressor.hpp"
+#include <algorithm>
+#include "common/core/Divider.hpp"
+#include "common/dsp/math/math_utils.hpp"
+
+using namespace kastle2;
+
+void Compressor::Init(const float update_rate, const Detector detector)
+{
+    envelope_.Init(update_rate);
+    gain_.Init(Q15_MAX);
+    detector_ = detector;
+    peak_ = 0;
+    squares_ = 0;
+    count_ = 0;
+}
+
+void Compressor::SetAttackTime(const float attack)
+{
+    envelope_.SetAttackTime(attack);
+}
+
+void Compressor::SetReleaseTime(const float release)
+{
+    envelope_.SetReleaseTime(release);
+}
+
+void Compressor::SetCurve(const q15_t threshold, const q15_t full_level, const q15_t min_gain)
+{
+    threshold_ = threshold;
+    full_level_ = std::max(full_level, threshold + 1);
+    min_gain_ = min_gain;
+    slope_ = static_cast<int32_t>(static_cast<float>(Q15_MAX - min_gain_) * 65536.0f / static_cast<float>(full_level_ - threshold_));
+}
+
+FASTCODE void Compressor::Detect(const q15_t *buffer, const size_t size)
+{
+    if (detector_ == Detector::PEAK)
+    {
+        q15_t peak = peak_;
+        for (size_t i = 0; i < size; i++)
+        {
+            peak = std::max(peak, q15_abs(buffer[i]));
+        }
+        peak_ = peak;
+    }
+    else
+    {
+        uint32_t squares = squares_;
+        for (size_t i = 0; i < size; i++)
+        {
+            squares += static_cast<uint32_t>(buffer[i] * buffer[i]) >> 15;
+        }
+        squares_ = squares;
+    }
+    count_ += size;
+}
+
+FASTCODE void Compressor::Detect(const q15_t *first, const q15_t first_gain, const q15_t *second, const q15_t second_gain, const size_t size)
+{
+    // The gains sum to 1 at most, so the mix doesn't need to saturate
+    if (detector_ == Detector::PEAK)
+    {
+        q15_t peak = peak_;
+        for (size_t i = 0; i < size; i++)
+        {
+            peak = std::max(peak, q15_abs(q15_mult_fast(first[i], first_gain) + q15_mult_fast(second[i], second_gain)));
+        }
+        peak_ = peak;
+    }
+    else
+    {
+        uint32_t squares = squares_;
+        for (size_t i = 0; i < size; i++)
+        {
+            const q15_t mix = q15_mult_fast(first[i], first_gain) + q15_mult_fast(second[i], second_gain);
+            squares += static_cast<uint32_t>(mix * mix) >> 15;
+        }
+        squares_ = squares;
+    }
+    count_ += size;
+}
+
+FASTCODE q15_t Compressor::Update(const size_t size)
+{
+    q15_t level = peak_;
+    if (detector_ == Detector::RMS && count_ > 0)
+    {
+        // Mean square in Q15, its root in Q15 is the root of the mean square shifted to Q30
+        level = static_cast<q15_t>(isqrt(Divider::Quotient<uint32_t>(squares_, count_) << 15));
+    }
+    peak_ = 0;
+    squares_ = 0;
+    count_ = 0;
+
+    envelope_.Track(level);
+    const q15_t envelope = envelope_.GetEnvelope();
+
+    q15_t gain = Q15_MAX;
+    if (envelope >= full_level_)
+    {
+        gain = min_gain_;
+    }
+    else if (envelope > threshold_)
+    {
+        // Below the full level the product stays under (Q15_MAX - min_gain_) << 16
+        gain = Q15_MAX - ((envelope - threshold_) * slope_ >> 16);
+    }
+
+    gain_.SetValue(gain);
+    gain_.Start(size);
+    return gain;
+}
+
+FASTCODE void Compressor::ProcessGain(int32_t *gain, const size_t count)
+{
+    gain_.Process(gain, count);
+}
+
+FASTCODE void Compressor::ProcessBlock(const q15_t *input, q15_t *output, const size_t frames, const size_t channels)
+{
+    if (!gain_.IsRamping())
+    {
+        const q15_t gain = gain_.GetValue();
+        for (size_t i = 0; i < frames * channels; i++)
+        {
+            output[i] = q15_mult_fast(input[i], gain);
+        }
+        return;
+    }
+
+    // The ramp in chunks, so any block size works with a small stack buffer
+    constexpr size_t kChunk = 16;
+    int32_t gain[kChunk];
+    for (size_t offset = 0; offset < frames; offset += kChunk)
+    {
+        const size_t count = std::min(kChunk, frames - offset);
+        gain_.Process(gain, count);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (size_t channel = 0; channel < channels; channel++)
+            {
+                const size_t index = (offset + i) * channels + channel;
+                output[index] = q15_mult_fast(input[index], gain[i]);
+            }
+        }
+    }
+}
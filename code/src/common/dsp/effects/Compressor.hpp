@@ -0,0 +1,178 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/fastcode.hpp"
+#include "common/dsp/control/EnvelopeFollower.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/utility/BlockRamp.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class Compressor
+ * @ingroup dsp_effects
+ * @brief Block rate compressor, one level measurement and one gain update per block.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * - Detect() measures the level of a block (peak or RMS) in one pass, it can be called more times
+ *   to measure a block processed in parts or a sidechain mix of two buffers.
+ * - Update() smooths the level with the attack and release of an EnvelopeFollower running at the block rate,
+ *   turns it to the gain and starts a linear gain ramp from the previous gain over the block.
+ * - ProcessBlock() applies the ramp to a block, ProcessGain() returns it for DSP loops mixing it in themselves.
+ *
+ * There is no lookahead, the gain of a block comes from the level of the same block (so it reacts to a block
+ * measured just before it is processed, one update later than a per sample compressor in the worst case).
+ *
+ * The gain is 1 below the threshold, falls linearly to the minimum gain at the full level and stays there above it.
+ *
+ * @code
+ * // Init
+ * compressor_.Init(SAMPLE_RATE / AUDIO_BUFFER_SIZE);
+ * compressor_.SetCurve(q15(0.5f), q15(0.9f), q15(0.5f));
+ * // AudioLoop
+ * compressor_.Detect(input, 2 * size);
+ * compressor_.Update(size);
+ * compressor_.ProcessBlock(input, output, size, 2);
+ * @endcode
+ */
+class Compressor
+{
+public:
+    /**
+     * @brief What Detect() measures.
+     */
+    enum class Detector : uint8_t
+    {
+        PEAK, ///< The loudest sample
+        RMS,  ///< The root mean square of the samples
+    };
+
+    /**
+     * @brief Initializes the compressor, the gain is at 1.
+     * @param update_rate How frequently Update() is called in Hz.
+     * @param detector Level measurement.
+     */
+    void Init(float update_rate, Detector detector = Detector::PEAK);
+
+    /**
+     * @brief Sets the rising response time of the level.
+     * @param attack Rising speed in seconds.
+     */
+    void SetAttackTime(float attack);
+
+    /**
+     * @brief Sets the falling response time of the level.
+     * @param release Falling speed in seconds.
+     */
+    void SetReleaseTime(float release);
+
+    /**
+     * @brief Sets the gain curve.
+     * @param threshold Level where the gain starts to fall.
+     * @param full_level Level where the gain reaches min_gain (above the threshold).
+     * @param min_gain Gain at and above the full level.
+     */
+    void SetCurve(q15_t threshold, q15_t full_level, q15_t min_gain);
+
+    /**
+     * @brief Measures the level of the samples, adding to the measurement since the last Update().
+     * @param buffer Samples (eg. an interleaved stereo block with 2 * frames samples).
+     * @param size Number of samples.
+     */
+    FASTCODE void Detect(const q15_t *buffer, size_t size);
+
+    /**
+     * @brief Measures the level of a mix of two buffers (eg. a sidechain of the input and the output).
+     * @param first First buffer.
+     * @param first_gain Gain of the first buffer.
+     * @param second Second buffer.
+     * @param second_gain Gain of the second buffer, the gains must sum to 1 at most.
+     * @param size Number of samples of each buffer.
+     */
+    FASTCODE void Detect(const q15_t *first, q15_t first_gain, const q15_t *second, q15_t second_gain, size_t size);
+
+    /**
+     * @brief Updates the level and the gain from the measurement, starts the gain ramp and resets the measurement.
+     * @param size Number of frames the gain ramps over.
+     * @return The gain at the end of the ramp.
+     */
+    FASTCODE q15_t Update(size_t size);
+
+    /**
+     * @brief Writes the next gains of the ramp.
+     * @param gain The gains, one per frame.
+     * @param count Number of frames.
+     */
+    FASTCODE void ProcessGain(int32_t *gain, size_t count);
+
+    /**
+     * @brief Applies the next gains of the ramp to a block.
+     * @param input Input frames.
+     * @param output Output frames (can be the same as input).
+     * @param frames Number of frames.
+     * @param channels Number of interleaved channels sharing the gain.
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t frames, size_t channels = 1);
+
+    /**
+     * @brief Returns the gain at the end of the current ramp.
+     */
+    q15_t GetGain() const
+    {
+        return gain_.GetValue();
+    }
+
+    /**
+     * @brief Returns the smoothed level.
+     */
+    q15_t GetLevel() const
+    {
+        return envelope_.GetEnvelope();
+    }
+
+private:
+    EnvelopeFollower envelope_;
+    BlockRamp gain_;
+    Detector detector_ = Detector::PEAK;
+
+    // Measurement since the last Update()
+    q15_t peak_ = 0;
+    uint32_t squares_ = 0;
+    uint32_t count_ = 0;
+
+    // Gain curve, the slope is the gain fall per level in 16.16
+    q15_t threshold_ = Q15_MAX;
+    q15_t full_level_ = Q15_MAX;
+    q15_t min_gain_ = Q15_MAX;
+    int32_t slope_ = 0;
+};
+
+}
@@ -72,3 +72,28 @@ FASTCODE q31_t CorrectingTrackAndHold::Process31(q31_t audio_input, q31_t contro
 
     return out_31_;
 }
+
+FASTCODE void CorrectingTrackAndHold::ProcessBlock(const q15_t *audio_input, const q31_t *control_input, q15_t *output, size_t size)
+{
+    // The state in registers for the whole block
+    const q31_t threshold = threshold_;
+    const bool correcting = threshold < Q31_MAX;
+    q31_t last_control_input = last_control_input_;
+    q15_t out = out_15_;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        const q31_t control = control_input[i];
+        // Tracks unless above the threshold or only just below it after almost reaching it (see Process())
+        const bool hold = control >= threshold || (correcting && control < last_control_input && last_control_input <= threshold);
+        if (!hold)
+        {
+            out = audio_input[i];
+        }
+        output[i] = out;
+        last_control_input = control;
+    }
+
+    last_control_input_ = last_control_input;
+    out_15_ = out;
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include "common/fastcode.hpp"
 #include "common/dsp/math/qmath.hpp"
 
@@ -68,6 +69,16 @@ public:
      */
     FASTCODE q31_t Process31(q31_t audio_input, q31_t control_input);
 
+    /**
+     * @brief Processes a block with the sample and hold, the same as Process() for each sample.
+     *        The held runs only store the held value.
+     * @param audio_input The audio input samples in Q15 format.
+     * @param control_input The control input samples in Q31 format.
+     * @param output The processed audio output samples in Q15 format (can be the same as audio_input).
+     * @param size Number of samples to process.
+     */
+    FASTCODE void ProcessBlock(const q15_t *audio_input, const q31_t *control_input, q15_t *output, size_t size);
+
 
 private:
     q31_t threshold_ = Q31_ZERO;
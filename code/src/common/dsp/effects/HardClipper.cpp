@@ -59,6 +59,26 @@ FASTCODE q15_t HardClipper::Process(q15_t input)
     return output;
 }
 
+FASTCODE void HardClipper::ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)
+{
+    const int32_t drive = drive_;
+    const bool compensation = compensation_;
+    const q15_t volume = Q15_MAX - (drive >> 1);
+
+    for (size_t i = 0; i < size * stride; i += stride)
+    {
+        int32_t val = input[i];
+        val = val + ((val * drive) >> 10);
+
+        q15_t out = q15_saturate(val);
+        if (compensation)
+        {
+            out = q15_mult(out, volume);
+        }
+        output[i] = out;
+    }
+}
+
 void HardClipper::DisableVolumeCompensation(bool disable)
 {
     compensation_ = !disable;
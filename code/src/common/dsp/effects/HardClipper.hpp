@@ -64,6 +64,16 @@ public:
      */
     FASTCODE q15_t Process(q15_t input);
 
+    /**
+     * @brief Processes a block of samples.
+     *
+     * @param input Input samples.
+     * @param output Output samples (can be the same as input).
+     * @param size Number of samples to process.
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo.
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1);
+
     /**
      * @brief Sets the drive level of the hard clipping.
      *
@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "PitchShifter.hpp"
+#include <algorithm>
+
+using namespace kastle2;
+
+void PitchShifter::Init(const size_t length)
+{
+    const size_t size = std::min(length, kMaxLength) + 1;
+    owned_buffer_ = std::make_unique<q15least_t[]>(size);
+    Init(std::span<q15least_t>(owned_buffer_.get(), size));
+}
+
+void PitchShifter::Init(std::span<q15least_t> buffer)
+{
+    buffer_ = buffer.data();
+    length_ = std::min(buffer.size() - 1, kMaxLength);
+    increment_ = 0;
+    Reset();
+    SetWindow(length_ / 2);
+}
+
+void PitchShifter::Reset()
+{
+    std::fill_n(buffer_, length_ + 1, 0);
+    write_ = 0;
+    phase_ = 0;
+}
+
+void PitchShifter::SetWindow(const size_t samples)
+{
+    window_ = std::min<uint32_t>(samples, length_ - 2);
+}
+
+void PitchShifter::SetRatio(const float ratio)
+{
+    // The delay changes by 1 - ratio samples per sample, one window is the whole phase
+    const float increment = window_ > 0 ? (1.0f - ratio) / window_ * 4294967296.0f : 0.0f;
+    increment_ = static_cast<int32_t>(std::clamp(increment, -2147483648.0f, 2147483520.0f));
+}
+
+FASTCODE void PitchShifter::ProcessBlock(const q15_t *input, q15_t *output, const size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        output[i] = Process(input[i]);
+    }
+}
@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "common/dsp/math/lookup_generators.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Crossfade of the PitchShifter heads over one sweep, sine squared so the two heads sum to one.
+ */
+FASTDATA_INLINE(pitch_shifter_window) inline constexpr auto pitch_shifter_window = lookup_tukey_window_table<int16_t, 256>(1.0, 32767.0);
+
+/**
+ * @class PitchShifter
+ * @ingroup dsp_effects
+ * @brief Time-domain pitch shifter with two crossfaded read heads.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The input is written to a ring buffer and read by two heads half a sweep apart. A head delay sweeps
+ * over the window and wraps, which shifts the pitch by the speed of the sweep. Each head is faded
+ * by the window table over its sweep, so it is silent when it wraps, and the other head is at full
+ * volume at that time. The heads read between the samples with linear interpolation.
+ *
+ * The sweep is a 32-bit phase, the whole range is one sweep over the window:
+ * - a positive increment makes the delay grow, the pitch goes down,
+ * - a negative increment makes it shrink, the pitch goes up.
+ * SetRatio() computes the increment of a pitch ratio for the current window.
+ *
+ * @note The buffer is allocated on the heap by Init(length), or passed from the app arena (Kastle2::arena).
+ *       One extra sample keeps a copy of the first one for the interpolation, up to kMaxLength samples are used.
+ */
+class PitchShifter
+{
+public:
+    /**
+     * @brief Longest usable buffer (16.16 read heads).
+     */
+    static constexpr size_t kMaxLength = 0xFFFF;
+
+    /**
+     * @brief Initializes the shifter and allocates the buffer on the heap.
+     * @param length Buffer length in samples, the window can be up to two samples shorter.
+     */
+    void Init(size_t length);
+
+    /**
+     * @brief Initializes the shifter over an existing buffer (eg. from Kastle2::arena).
+     * @param buffer The buffer, one sample longer than the delay line. Must outlive the shifter.
+     */
+    void Init(std::span<q15least_t> buffer);
+
+    /**
+     * @brief Clears the buffer and restarts the sweep.
+     */
+    void Reset();
+
+    /**
+     * @brief Restarts the sweep (the first head at zero delay).
+     */
+    void ResetPhase()
+    {
+        phase_ = 0;
+    }
+
+    /**
+     * @brief Sets the range of the head delays.
+     * @param samples Size of the window, up to the buffer length minus two.
+     */
+    void SetWindow(size_t samples);
+
+    /**
+     * @brief Sets the sweep speed directly.
+     * @param increment Phase increment per sample, positive lowers the pitch, see the class description.
+     */
+    void SetIncrement(const int32_t increment)
+    {
+        increment_ = increment;
+    }
+
+    /**
+     * @brief Sets the sweep speed of a pitch ratio for the current window.
+     * @param ratio Playback speed, 2.0 is an octave up, 0.5 an octave down.
+     */
+    void SetRatio(float ratio);
+
+    /**
+     * @brief Processes one sample.
+     * @param input Input sample.
+     * @return The shifted sample.
+     */
+    inline q15_t Process(const q15_t input)
+    {
+        buffer_[write_] = static_cast<q15least_t>(input);
+        if (write_ == 0)
+        {
+            buffer_[length_] = buffer_[0];
+        }
+        const uint32_t newest = write_ << 16;
+        if (++write_ == length_)
+        {
+            write_ = 0;
+        }
+
+        const uint32_t phase = phase_;
+        phase_ = phase + static_cast<uint32_t>(increment_);
+
+        const q15_t first = ReadHead(newest, phase);
+        const q15_t second = ReadHead(newest, phase + 0x80000000u);
+        return q15_mult_fast(first, pitch_shifter_window[phase >> kWindowShift]) +
+               q15_mult_fast(second, pitch_shifter_window[(phase + 0x80000000u) >> kWindowShift]);
+    }
+
+    /**
+     * @brief Processes a block of mono samples.
+     * @param input Input samples
+     * @param output Output samples (can be the same as input)
+     * @param size Number of samples
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size);
+
+private:
+    static constexpr uint32_t kWindowShift = 32 - 8;
+
+    /**
+     * @brief Reads the head of the phase, newest is the 16.16 position of the last written sample.
+     */
+    inline q15_t ReadHead(const uint32_t newest, const uint32_t phase) const
+    {
+        const uint32_t delay = window_ * (phase >> 16); // 16.16
+        const uint32_t position = newest >= delay ? newest - delay : newest + (length_ << 16) - delay;
+        const uint32_t index = position >> 16;
+        const q15_t near = buffer_[index];
+        return near + q15_mult_fast(buffer_[index + 1] - near, (position & 0xFFFF) >> 1);
+    }
+
+    std::unique_ptr<q15least_t[]> owned_buffer_;
+    q15least_t *buffer_ = nullptr;
+    uint32_t length_ = 0;
+    uint32_t write_ = 0;
+    uint32_t window_ = 0;
+    uint32_t phase_ = 0;
+    int32_t increment_ = 0;
+};
+}
@@ -0,0 +1,255 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "PlateReverb.hpp"
+#include <algorithm>
+#include "pico/stdlib.h"
+#include "common/core/MultiCore.hpp"
+
+using namespace kastle2;
+
+void PlateReverb::Init()
+{
+    owned_memory_ = std::make_unique<q15least_t[]>(kMemorySize);
+    Init(std::span<q15least_t>(owned_memory_.get(), kMemorySize));
+}
+
+void PlateReverb::Init(std::span<q15least_t> memory)
+{
+    if (memory.size() < kMemorySize)
+    {
+        panic("PlateReverb needs %u samples, got %u", static_cast<unsigned>(kMemorySize), static_cast<unsigned>(memory.size()));
+    }
+
+    // Each line holds one block more than its delay, see the class description
+    for (size_t i = 0; i < input_lines_.size(); i++)
+    {
+        input_lines_[i] = TakeLine(memory, kInputDelays[i] + kMaxBlockSize);
+    }
+    for (size_t i = 0; i < halves_.size(); i++)
+    {
+        Half &half = halves_[i];
+        half.modulated = TakeLine(memory, kModulatedDelays[i] + kExcursion + 2 + kMaxBlockSize);
+        half.first = TakeLine(memory, kFirstDelays[i] + kMaxBlockSize);
+        half.allpass = TakeLine(memory, kAllpassDelays[i] + kMaxBlockSize);
+        half.second = TakeLine(memory, kSecondDelays[i] + kMaxBlockSize);
+        half.delay = kModulatedDelays[i] << 16;
+    }
+
+    lfo_phase_ = 0;
+    lfo_increment_ = static_cast<uint32_t>(kLfoFrequency / SAMPLE_RATE * 4294967296.0f);
+    Clear();
+
+    SetDecay(q15(0.5f));
+    SetDamping(q15(0.3f));
+    SetWet(q15(0.3f));
+}
+
+PlateReverb::Line PlateReverb::TakeLine(std::span<q15least_t> &memory, const size_t size)
+{
+    Line line;
+    line.data = memory.data();
+    line.size = size;
+    line.position = 0;
+    memory = memory.subspan(size);
+    return line;
+}
+
+void PlateReverb::Clear()
+{
+    for (Line &line : input_lines_)
+    {
+        std::fill_n(line.data, line.size, 0);
+    }
+    for (Half &half : halves_)
+    {
+        for (Line *line : {&half.modulated, &half.first, &half.allpass, &half.second})
+        {
+            std::fill_n(line->data, line->size, 0);
+        }
+        half.damping_state = 0;
+    }
+    bandwidth_state_ = 0;
+}
+
+void PlateReverb::SetDecay(q15_t decay)
+{
+    decay_ = q15_mult(std::clamp(decay, 0, Q15_MAX), kMaxDecay);
+    // The second tank allpass follows the decay the way the paper suggests
+    decay_diffusion_2_ = std::clamp(decay_ + q15(0.15f), q15(0.25f), q15(0.5f));
+}
+
+void PlateReverb::SetDamping(q15_t damping)
+{
+    damping_coefficient_ = Q15_MAX - q15_mult(std::clamp(damping, 0, Q15_MAX), kMaxDamping);
+}
+
+void PlateReverb::SetWet(q15_t wet)
+{
+    wet_ = std::clamp(wet, 0, Q15_MAX);
+}
+
+FASTCODE void PlateReverb::ProcessBlock(const q15_t *input, q15_t *output, size_t size)
+{
+    while (size > 0)
+    {
+        const size_t block = std::min(size, kMaxBlockSize);
+        ProcessInput(input, block);
+        ProcessHalf(0, block);
+        ProcessHalf(1, block);
+        ProcessOutput(input, output, block);
+        input += 2 * block;
+        output += 2 * block;
+        size -= block;
+    }
+}
+
+FASTCODE void PlateReverb::ProcessBlockParallel(const q15_t *input, q15_t *output, size_t size)
+{
+    while (size > 0)
+    {
+        const size_t block = std::min(size, kMaxBlockSize);
+        ProcessInput(input, block);
+        block_size_ = block;
+        MultiCore::ParallelFor(ProcessHalvesJob, this, halves_.size());
+        ProcessOutput(input, output, block);
+        input += 2 * block;
+        output += 2 * block;
+        size -= block;
+    }
+}
+
+FASTCODE void PlateReverb::ProcessHalvesJob(void *context, const size_t from, const size_t to)
+{
+    PlateReverb *reverb = static_cast<PlateReverb *>(context);
+    for (size_t i = from; i < to; i++)
+    {
+        reverb->ProcessHalf(i, reverb->block_size_);
+    }
+}
+
+FASTCODE void PlateReverb::ProcessInput(const q15_t *input, const size_t size)
+{
+    q15_t state = bandwidth_state_;
+    for (size_t i = 0; i < size; i++)
+    {
+        const q15_t mono = (input[2 * i] + input[2 * i + 1]) >> 1;
+        state += q15_mult_fast(kBandwidth, mono - state);
+
+        q15_t x = Allpass(input_lines_[0], kInputDelays[0], kInputDiffusion1, state);
+        x = Allpass(input_lines_[1], kInputDelays[1], kInputDiffusion1, x);
+        x = Allpass(input_lines_[2], kInputDelays[2], kInputDiffusion2, x);
+        diffused_[i] = Allpass(input_lines_[3], kInputDelays[3], kInputDiffusion2, x);
+    }
+    bandwidth_state_ = state;
+
+    // Triangle LFO, the halves a quarter of the period apart, the delay glides to it over the block
+    lfo_phase_ += lfo_increment_ * size;
+    for (size_t i = 0; i < halves_.size(); i++)
+    {
+        const uint32_t phase = lfo_phase_ + i * 0x40000000u;
+        const uint32_t triangle = (phase & 0x80000000u) ? ~phase : phase;
+        halves_[i].delay_target = (kModulatedDelays[i] << 16) + (triangle >> 15) * kExcursion;
+
+        // The other half writes its end while this one reads it, so the position is taken here
+        const Line &other = halves_[1 - i].second;
+        const uint32_t delay = kSecondDelays[1 - i];
+        halves_[i].feedback_read = other.position >= delay ? other.position - delay : other.position + other.size - delay;
+    }
+}
+
+FASTCODE void PlateReverb::ProcessHalf(const size_t index, const size_t size)
+{
+    Half &half = halves_[index];
+    const q15least_t *feedback_data = halves_[1 - index].second.data;
+    const uint32_t feedback_size = halves_[1 - index].second.size;
+    uint32_t feedback_read = half.feedback_read;
+
+    const auto &positive_taps = kPositiveTaps[index];
+    const auto &negative_taps = kNegativeTaps[index];
+    const size_t own_channel = index;
+    const size_t opposite_channel = 1 - index;
+
+    const q15_t decay = decay_;
+    const q15_t decay_diffusion_2 = decay_diffusion_2_;
+    const q15_t damping_coefficient = damping_coefficient_;
+    q15_t damping_state = half.damping_state;
+    uint32_t delay = half.delay;
+    const int32_t delay_increment = static_cast<int32_t>(half.delay_target - half.delay) / static_cast<int32_t>(size);
+    q15_t *out = tank_output_[index].data();
+
+    for (size_t i = 0; i < size; i++)
+    {
+        // Output taps
+        out[2 * i + opposite_channel] = half.first.Tap(positive_taps[0]) + half.first.Tap(positive_taps[1]) -
+                                        half.allpass.Tap(positive_taps[2]) + half.second.Tap(positive_taps[3]);
+        out[2 * i + own_channel] = -(half.first.Tap(negative_taps[0]) + half.allpass.Tap(negative_taps[1]) +
+                                     half.second.Tap(negative_taps[2]));
+
+        // End of the other half
+        const q15_t feedback = feedback_data[feedback_read];
+        if (++feedback_read == feedback_size)
+        {
+            feedback_read = 0;
+        }
+        q15_t x = q15_saturate(diffused_[i] + q15_mult_fast(decay, feedback));
+
+        // Modulated allpass (negative gain in the paper), linear interpolation of the fractional delay
+        delay += delay_increment;
+        const uint32_t whole = delay >> 16;
+        const q15_t fraction = (delay & 0xFFFF) >> 1;
+        const q15_t near = half.modulated.Tap(whole);
+        const q15_t delayed = near + q15_mult_fast(half.modulated.Tap(whole + 1) - near, fraction);
+        const q15_t stored = q15_saturate(x - q15_mult_fast(kDecayDiffusion1, delayed));
+        half.modulated.Write(stored);
+        x = delayed + q15_mult_fast(kDecayDiffusion1, stored);
+
+        // Delay, damping and decay
+        const q15_t delayed_first = half.first.Tap(kFirstDelays[index]);
+        half.first.Write(x);
+        damping_state += q15_mult_fast(damping_coefficient, delayed_first - damping_state);
+        x = q15_mult_fast(damping_state, decay);
+
+        // Allpass and the delay feeding the other half
+        half.second.Write(Allpass(half.allpass, kAllpassDelays[index], decay_diffusion_2, x));
+    }
+
+    half.damping_state = damping_state;
+    half.delay = half.delay_target;
+}
+
+FASTCODE void PlateReverb::ProcessOutput(const q15_t *input, q15_t *output, const size_t size)
+{
+    const q15_t wet = wet_;
+    const q15_t dry = q15_inv(wet);
+    const q15_t *left_half = tank_output_[0].data();
+    const q15_t *right_half = tank_output_[1].data();
+
+    for (size_t i = 0; i < 2 * size; i++)
+    {
+        const q15_t reverb = q15_mult(q15_saturate(left_half[i] + right_half[i]), kOutputGain);
+        output[i] = q15_add(q15_mult(input[i], dry), q15_mult(reverb, wet));
+    }
+}
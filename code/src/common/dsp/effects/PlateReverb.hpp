@@ -0,0 +1,279 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "common/config.hpp"
+#include "common/dsp/math/math_utils.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Scales a length of the Dattorro paper (29761 Hz) to SAMPLE_RATE.
+ */
+inline constexpr size_t plate_reverb_scale(const size_t length)
+{
+    return static_cast<size_t>(length * SAMPLE_RATE / 29761.0f + 0.5f);
+}
+
+/**
+ * @brief Scales a delay of the Dattorro paper to SAMPLE_RATE and rounds it up to a prime.
+ */
+inline constexpr size_t plate_reverb_length(const size_t length)
+{
+    return next_prime(plate_reverb_scale(length));
+}
+
+/**
+ * @class PlateReverb
+ * @ingroup dsp_effects
+ * @brief Stereo plate reverb (Dattorro figure-of-eight tank) in fixed point.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The input is summed to mono, band limited and smeared by four input allpasses, then it feeds a tank
+ * of two halves. Each half is a modulated allpass, a delay, a damping lowpass, an allpass and another delay,
+ * the end of each half feeds the start of the other one. The stereo output is a sum of taps inside the tank.
+ *
+ * The delay lengths are the ones of the paper (29761 Hz) scaled to SAMPLE_RATE and rounded up to primes
+ * at compile time, so the echoes of the lines don't line up. Only the two tank allpasses are modulated
+ * (a slow triangle) and read with linear interpolation, everything else reads whole samples.
+ *
+ * Every line is longer than its delay by one audio block, so within a block the halves only read
+ * what the other half wrote in the previous blocks. The two halves are independent then
+ * and ProcessBlockParallel() runs each of them on one core.
+ *
+ * @note The line memory (kMemorySize samples) is allocated on the heap by Init(), or passed
+ *       from the app arena: add Arena::Footprint<q15least_t>(PlateReverb::kMemorySize) to kArenaSize.
+ */
+class PlateReverb
+{
+public:
+    /**
+     * @brief Longest block processed at once, longer blocks are split.
+     */
+    static constexpr size_t kMaxBlockSize = AUDIO_BUFFER_SIZE;
+
+    /**
+     * @brief Delays of the input allpasses.
+     */
+    static constexpr std::array<size_t, 4> kInputDelays = {plate_reverb_length(142), plate_reverb_length(107),
+                                                           plate_reverb_length(379), plate_reverb_length(277)};
+
+    /**
+     * @brief Modulation depth of the tank allpasses in samples.
+     */
+    static constexpr size_t kExcursion = plate_reverb_scale(16);
+
+    // Delays of the tank halves (left, right)
+    static constexpr std::array<size_t, 2> kModulatedDelays = {plate_reverb_length(672), plate_reverb_length(908)};
+    static constexpr std::array<size_t, 2> kFirstDelays = {plate_reverb_length(4453), plate_reverb_length(4217)};
+    static constexpr std::array<size_t, 2> kAllpassDelays = {plate_reverb_length(1800), plate_reverb_length(2656)};
+    static constexpr std::array<size_t, 2> kSecondDelays = {plate_reverb_length(3720), plate_reverb_length(3163)};
+
+    /**
+     * @brief Samples of line memory needed by one reverb.
+     */
+    static constexpr size_t kMemorySize = kInputDelays[0] + kInputDelays[1] + kInputDelays[2] + kInputDelays[3] +
+                                          kModulatedDelays[0] + kModulatedDelays[1] + 2 * (kExcursion + 2) +
+                                          kFirstDelays[0] + kFirstDelays[1] + kAllpassDelays[0] + kAllpassDelays[1] +
+                                          kSecondDelays[0] + kSecondDelays[1] + 12 * kMaxBlockSize;
+
+    /**
+     * @brief Initializes the reverb and allocates kMemorySize samples on the heap.
+     */
+    void Init();
+
+    /**
+     * @brief Initializes the reverb over existing memory (eg. from Kastle2::arena).
+     * @param memory At least kMemorySize samples.
+     */
+    void Init(std::span<q15least_t> memory);
+
+    /**
+     * @brief Silences the tank.
+     */
+    void Clear();
+
+    /**
+     * @brief Processes a block of interleaved stereo audio on the calling core.
+     * @param input Interleaved stereo input
+     * @param output Interleaved stereo output (can be the same as input)
+     * @param size Number of frames (left and right sample pairs) to process
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Same as ProcessBlock(), the tank halves run on both cores with MultiCore::ParallelFor().
+     * @note The second core must run MultiCore::JobWorker().
+     */
+    FASTCODE void ProcessBlockParallel(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Sets the decay of the tank.
+     * @param decay 0 is the shortest, Q15_MAX is the longest (kMaxDecay).
+     */
+    void SetDecay(q15_t decay);
+
+    /**
+     * @brief Sets the damping of the high frequencies in the tank.
+     * @param damping 0 is bright, Q15_MAX is dark.
+     */
+    void SetDamping(q15_t damping);
+
+    /**
+     * @brief Sets the wet/dry mix amount.
+     * @param wet Wet signal amount (0 = dry, Q15_MAX = fully wet)
+     */
+    void SetWet(q15_t wet);
+
+    /**
+     * @brief Longest decay, the gain of a tank round trip.
+     */
+    static constexpr q15_t kMaxDecay = q15(0.97f);
+
+    /**
+     * @brief Strongest damping, the lowpass keeps 1 - kMaxDamping of the new sample.
+     */
+    static constexpr q15_t kMaxDamping = q15(0.95f);
+
+private:
+    /**
+     * @brief Ring buffer of samples, delay N reads the sample written N writes ago.
+     */
+    struct Line
+    {
+        q15least_t *data = nullptr;
+        uint32_t size = 0;
+        uint32_t position = 0;
+
+        inline q15_t Tap(const uint32_t delay) const
+        {
+            return data[position >= delay ? position - delay : position + size - delay];
+        }
+
+        inline void Write(const q15_t x)
+        {
+            data[position] = static_cast<q15least_t>(q15_saturate(x));
+            if (++position == size)
+            {
+                position = 0;
+            }
+        }
+    };
+
+    /**
+     * @brief One half of the tank.
+     */
+    struct Half
+    {
+        Line modulated;
+        Line first;
+        Line allpass;
+        Line second;
+        q15_t damping_state = 0;
+        uint32_t delay = 0;         ///< Modulated delay, 16.16
+        uint32_t delay_target = 0;  ///< Modulated delay at the end of the block, 16.16
+        uint32_t feedback_read = 0; ///< Read position of the other half end at the block start
+    };
+
+    // Paper taps (29761 Hz) of each half: positive ones to the opposite channel (the allpass one subtracted),
+    // negative ones to the own channel
+    static constexpr std::array<std::array<size_t, 4>, 2> kPositiveTaps = {{
+        {plate_reverb_scale(353), plate_reverb_scale(3627), plate_reverb_scale(1228), plate_reverb_scale(2673)},
+        {plate_reverb_scale(266), plate_reverb_scale(2974), plate_reverb_scale(1913), plate_reverb_scale(1996)},
+    }};
+    static constexpr std::array<std::array<size_t, 3>, 2> kNegativeTaps = {{
+        {plate_reverb_scale(1990), plate_reverb_scale(187), plate_reverb_scale(1066)},
+        {plate_reverb_scale(2111), plate_reverb_scale(335), plate_reverb_scale(121)},
+    }};
+
+    static constexpr q15_t kInputDiffusion1 = q15(0.75f);
+    static constexpr q15_t kInputDiffusion2 = q15(0.625f);
+    static constexpr q15_t kDecayDiffusion1 = q15(0.7f);
+    static constexpr q15_t kBandwidth = q15(0.9995f);
+    static constexpr q15_t kOutputGain = q15(0.6f);
+    static constexpr float kLfoFrequency = 1.0f;
+
+    /**
+     * @brief Lattice allpass: stores x + gain * delayed, returns delayed - gain * stored.
+     */
+    static inline q15_t Allpass(Line &line, const uint32_t delay, const q15_t gain, const q15_t x)
+    {
+        const q15_t delayed = line.Tap(delay);
+        const q15_t stored = q15_saturate(x + q15_mult_fast(gain, delayed));
+        line.Write(stored);
+        return delayed - q15_mult_fast(gain, stored);
+    }
+
+    /**
+     * @brief Takes the line from the memory.
+     */
+    static Line TakeLine(std::span<q15least_t> &memory, size_t size);
+
+    /**
+     * @brief Band limits and diffuses the input to diffused_ and prepares the tank for the block.
+     */
+    FASTCODE void ProcessInput(const q15_t *input, size_t size);
+
+    /**
+     * @brief Runs one half of the tank over the block of diffused_, writes its taps to tank_output_.
+     */
+    FASTCODE void ProcessHalf(size_t index, size_t size);
+
+    /**
+     * @brief Mixes the taps of both halves with the dry input.
+     */
+    FASTCODE void ProcessOutput(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief MultiCore::ParallelFor() job over the halves.
+     */
+    FASTCODE static void ProcessHalvesJob(void *context, size_t from, size_t to);
+
+    std::unique_ptr<q15least_t[]> owned_memory_;
+    std::array<Line, 4> input_lines_;
+    std::array<Half, 2> halves_;
+    q15_t bandwidth_state_ = 0;
+    q15_t decay_ = 0;
+    q15_t decay_diffusion_2_ = 0;
+    q15_t damping_coefficient_ = 0;
+    q15_t wet_ = 0;
+    uint32_t lfo_phase_ = 0;
+    uint32_t lfo_increment_ = 0;
+    size_t block_size_ = 0;
+
+    std::array<q15_t, kMaxBlockSize> diffused_;
+    std::array<std::array<q15_t, kMaxBlockSize * 2>, 2> tank_output_;
+};
+}
@@ -28,6 +28,9 @@ SOFTWARE.
 
 using namespace kastle2;
 
+// Read for every sample, kept in RAM
+FASTDATA static const std::array<int16_t, kTanhTableSize> tanh_lut = tanh_table::Generate();
+
 void SoftClipper::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
@@ -47,7 +50,7 @@ FASTCODE q15_t SoftClipper::Process(q15_t input)
     q15_t output = q15_saturate(q31_abs(val));
 
     // Use tanh look up table
-    output = tanh_lut[output];
+    output = TanhLookup(tanh_lut.data(), output);
 
     // return signedness
     if (negative)
@@ -63,6 +66,31 @@ FASTCODE q15_t SoftClipper::Process(q15_t input)
     return output;
 }
 
+FASTCODE void SoftClipper::ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)
+{
+    const int32_t drive = drive_;
+    const bool compensation = compensation_;
+    const q15_t volume = Q15_MAX - (drive >> 1);
+
+    for (size_t i = 0; i < size * stride; i += stride)
+    {
+        int32_t val = q15_mult(input[i], 10431); // divide by pi (magic number = 1 / pi)
+        val = val + ((val * drive) >> 9);
+
+        q15_t out = TanhLookup(tanh_lut.data(), q15_saturate(q31_abs(val)));
+        if (val < Q15_ZERO)
+        {
+            out = -out;
+        }
+
+        if (compensation)
+        {
+            out = q15_mult(out, volume);
+        }
+        output[i] = out;
+    }
+}
+
 void SoftClipper::DisableVolumeCompensation(bool disable)
 {
     compensation_ = !disable;
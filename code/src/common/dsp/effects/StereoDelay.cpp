@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #include "StereoDelay.hpp"
+#include <algorithm>
 #include "common/dsp/math/math_utils.hpp"
 
 using namespace kastle2;
@@ -34,8 +35,8 @@ void StereoDelay::Init(float sample_rate)
     filter_l_.Init(sample_rate);
     filter_r_.Init(sample_rate);
 
-    delay_l_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(max_delay_);
-    delay_r_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t>>(max_delay_);
+    delay_l_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(max_delay_);
+    delay_r_ = std::make_unique<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>>(max_delay_);
 
     SetDelay(max_delay_ / 2, max_delay_ / 2);
     SetFeedback(q15(0.5f));
@@ -72,6 +73,67 @@ FASTCODE StereoDelay::Output StereoDelay::Process(q15_t left, q15_t right)
     return out_;
 }
 
+FASTCODE void StereoDelay::ProcessBlock(const q15_t *input, q15_t *output, size_t size)
+{
+    const q15_t feedback_l = feedback_l_;
+    const q15_t feedback_r = feedback_r_;
+    const q15_t wet = wet_;
+    const q15_t dry = q15_inv(wet);
+    AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32> &delay_l = *delay_l_;
+    AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32> &delay_r = *delay_r_;
+
+    // The filter is outside of the feedback path, so the delay lines can run ahead of it
+    q15_t delayed[kBlockChunkSize * 2];
+    for (size_t from = 0; from < size; from += kBlockChunkSize)
+    {
+        const size_t count = std::min(kBlockChunkSize, size - from);
+        const q15_t *in = input + from * 2;
+        q15_t *out = output + from * 2;
+
+        if (CanReadAhead(delay_l, count) && CanReadAhead(delay_r, count))
+        {
+            // The chunk doesn't reach the samples it writes, read it all and write it all with one wrap
+            q15_t feedback[kBlockChunkSize * 2];
+            delay_l.ReadBlock(delayed, count, 2);
+            delay_r.ReadBlock(delayed + 1, count, 2);
+            for (size_t i = 0; i < count; i++)
+            {
+                feedback[i * 2] = q15_add(q15_mult(delayed[i * 2], feedback_l), in[i * 2]);
+                feedback[i * 2 + 1] = q15_add(q15_mult(delayed[i * 2 + 1], feedback_r), in[i * 2 + 1]);
+            }
+            delay_l.WriteBlock(feedback, count, 2);
+            delay_r.WriteBlock(feedback + 1, count, 2);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                delayed[i * 2] = delay_l.Read();
+                delayed[i * 2 + 1] = delay_r.Read();
+                delay_l.Write(q15_add(q15_mult(delayed[i * 2], feedback_l), in[i * 2]));
+                delay_r.Write(q15_add(q15_mult(delayed[i * 2 + 1], feedback_r), in[i * 2 + 1]));
+            }
+        }
+
+        if (filter_enabled_)
+        {
+            filter_l_.ProcessBlock(delayed, delayed, count, 2);
+            filter_r_.ProcessBlock(delayed + 1, delayed + 1, count, 2);
+        }
+
+        for (size_t i = 0; i < count * 2; i++)
+        {
+            out[i] = q15_add(q15_mult(in[i], dry), q15_mult(delayed[i], wet));
+        }
+    }
+
+    if (size > 0)
+    {
+        out_.left = output[size * 2 - 2];
+        out_.right = output[size * 2 - 1];
+    }
+}
+
 StereoDelay::Output StereoDelay::GetOutput() const
 {
     return out_;
@@ -105,8 +167,24 @@ void StereoDelay::SetFilterResonance(float resonance)
     filter_r_.SetResonance(resonance);
 }
 
+void StereoDelay::SetFilterTopology(Svf::Topology topology)
+{
+    filter_l_.SetTopology(topology);
+    filter_r_.SetTopology(topology);
+}
+
 void StereoDelay::SetFilterCrossfade(q15_t crossfade)
 {
     filter_l_.SetCrossfade(crossfade);
     filter_r_.SetCrossfade(crossfade);
 }
+
+void StereoDelay::SetParams(const Params &params)
+{
+    SetDelay(params.delay_left, params.delay_right);
+    SetWet(params.wet);
+    SetFeedback(params.feedback_left, params.feedback_right);
+    SetFilterEnabled(params.filter_enabled);
+    filter_l_.SetParams(params.filter);
+    filter_r_.SetParams(params.filter);
+}
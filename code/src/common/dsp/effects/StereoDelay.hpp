@@ -59,6 +59,21 @@ public:
         q15_t right; ///< Right channel output sample
     };
 
+    /**
+     * @brief Delay, mix, feedback and feedback filter set together by SetParams()
+     * @details Plain data, so the UI loop can edit it in a ParamSnapshot and the audio callback apply it when it changed.
+     */
+    struct Params
+    {
+        size_t delay_left = 0;       ///< Delay time of the left channel in samples
+        size_t delay_right = 0;      ///< Delay time of the right channel in samples
+        q15_t wet = 0;               ///< 0 = dry, Q15_MAX = fully wet
+        q15_t feedback_left = 0;     ///< Feedback of the left channel
+        q15_t feedback_right = 0;    ///< Feedback of the right channel
+        bool filter_enabled = false; ///< Filter in the feedback path
+        DjFilter::Params filter;     ///< Crossfade and resonance of both feedback filters
+    };
+
     /**
      * @brief Construct a new StereoDelay object
      * @param max_delay Maximum delay time in samples (default: kMaxDelay)
@@ -81,6 +96,14 @@ public:
      */
     FASTCODE Output Process(q15_t left, q15_t right);
 
+    /**
+     * @brief Process a block of interleaved stereo audio through the delay effect
+     * @param input Interleaved stereo input
+     * @param output Interleaved stereo output (can be the same as input)
+     * @param size Number of frames (left and right sample pairs) to process
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size);
+
     /**
      * @brief Set the delay time for left and right channels
      * @param delay_left Delay time for left channel in samples
@@ -119,12 +142,24 @@ public:
      */
     void SetFilterResonance(float resonance);
 
+    /**
+     * @brief Set the structure of the feedback filters (see Svf::SetTopology)
+     * @param topology DOUBLE_SAMPLED, ZDF or ZDF_QUADRATIC_DRIVE
+     */
+    void SetFilterTopology(Svf::Topology topology);
+
     /**
      * @brief Set the crossfade between lowpass and highpass filters
      * @param crossfade -1.0 is lowpass, 0.0 is bandpass, 1.0 is highpass
      */
     void SetFilterCrossfade(q15_t crossfade);
 
+    /**
+     * @brief Set all the parameters at once, each feedback filter recomputes its coefficients once (see DjFilter::SetParams)
+     * @param params The parameters, eg. from a ParamSnapshot when it has changed
+     */
+    void SetParams(const Params &params);
+
     /**
      * @brief Get the last processed output
      * @return Output struct containing the last processed left and right samples
@@ -150,7 +185,16 @@ private:
     bool filter_enabled_ = false;
     DjFilter filter_l_;
     DjFilter filter_r_;
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_l_;
-    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t>> delay_r_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> delay_l_;
+    std::unique_ptr<AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32>> delay_r_;
+
+    // Block processing works on the stack in chunks of this many frames
+    static constexpr size_t kBlockChunkSize = 16;
+
+    // A settled delay of at least the chunk reads only what was written before the chunk
+    static bool CanReadAhead(const AdvancedDynamicDelayLine<q15least_t, DelaySlew::BITS_32> &delay, const size_t count)
+    {
+        return delay.IsDelaySettled() && delay.GetDelay() >= count;
+    }
 };
 }
@@ -24,4115 +24,87 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace kastle2
 {
 
-/* from tanhLUT.py (written by chatgpt 4o)
- * tanh (hyperbolic tangent) is a goniometric function and therefore
- * it plateaus at exactly positive and negative pi values, which is 
- * annoying for our use case. Therefore this is mapped to have that 
- * range from -1 to 1 (in fixed point values)
+/**
+ * @brief Compact tanh table, used by SoftClipper.
+ * @ingroup dsp_effects
+ *
+ * tanh plateaus at around plus and minus pi, which is the range we want for clipping.
+ * The table covers only the positive half, [0, pi] in kTanhTableSize - 1 steps,
+ * negative inputs are folded by the odd symmetry (tanh(-x) = -tanh(x)).
+ *
+ * It used to be a 32768 entry table (64 kB of flash), read at random by the audio loop
+ * through the XIP cache. 257 entries with linear interpolation stay within about half
+ * of an LSB of the real tanh and fit to RAM (see FASTDATA).
+ *
+ * The table is computed by the compiler, there is no generator script.
  */
+constexpr size_t kTanhTableBits = 8;
+constexpr size_t kTanhTableSize = (1 << kTanhTableBits) + 1;
+
+namespace tanh_table
+{
+
+// exp(x) for 0 <= x <= 2 * pi, the Taylor series has only positive terms there, so it converges without cancellation
+constexpr double Exp(const double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    for (int n = 1; n < 60; n++)
+    {
+        term *= x / n;
+        sum += term;
+    }
+    return sum;
+}
+
+// tanh(x) for 0 <= x <= pi
+constexpr double Tanh(const double x)
+{
+    const double e = Exp(2.0 * x);
+    return (e - 1.0) / (e + 1.0);
+}
+
+constexpr std::array<int16_t, kTanhTableSize> Generate()
+{
+    constexpr double kPi = 3.14159265358979323846;
+    // Q15_MAX is pi, the last entry is one step past it
+    constexpr double kStep = kPi * (1 << (15 - kTanhTableBits)) / 32767.0;
+    std::array<int16_t, kTanhTableSize> table{};
+    for (size_t i = 0; i < kTanhTableSize; i++)
+    {
+        // tanh is concave here, so the interpolation lines between the exact values would stay below it.
+        // Raising the entries by half of the worst gap (h^2 / 8 * |tanh''|) splits the error around the curve.
+        const double tanh = Tanh(kStep * i);
+        const double curvature = 2.0 * tanh * (1.0 - tanh * tanh);
+        const double value = (tanh + kStep * kStep * curvature / 16.0) * 32767.0;
+        table[i] = static_cast<int16_t>(value + 0.5);
+    }
+    return table;
+}
 
-#define LUT_SIZE 32768
+}
 
-const int16_t tanh_lut[LUT_SIZE] = {
-    1,     4,     7,     10,     13,     16,     19,     23,
-    26,     29,     32,     35,     38,     41,     45,     48,
-    51,     54,     57,     60,     63,     67,     70,     73,
-    76,     79,     82,     85,     89,     92,     95,     98,
-    101,     104,     107,     111,     114,     117,     120,     123,
-    126,     129,     133,     136,     139,     142,     145,     148,
-    151,     155,     158,     161,     164,     167,     170,     173,
-    176,     180,     183,     186,     189,     192,     195,     198,
-    202,     205,     208,     211,     214,     217,     220,     224,
-    227,     230,     233,     236,     239,     242,     246,     249,
-    252,     255,     258,     261,     264,     268,     271,     274,
-    277,     280,     283,     286,     290,     293,     296,     299,
-    302,     305,     308,     312,     315,     318,     321,     324,
-    327,     330,     334,     337,     340,     343,     346,     349,
-    352,     356,     359,     362,     365,     368,     371,     374,
-    378,     381,     384,     387,     390,     393,     396,     400,
-    403,     406,     409,     412,     415,     418,     422,     425,
-    428,     431,     434,     437,     440,     444,     447,     450,
-    453,     456,     459,     462,     465,     469,     472,     475,
-    478,     481,     484,     487,     491,     494,     497,     500,
-    503,     506,     509,     513,     516,     519,     522,     525,
-    528,     531,     535,     538,     541,     544,     547,     550,
-    553,     557,     560,     563,     566,     569,     572,     575,
-    579,     582,     585,     588,     591,     594,     597,     601,
-    604,     607,     610,     613,     616,     619,     623,     626,
-    629,     632,     635,     638,     641,     645,     648,     651,
-    654,     657,     660,     663,     666,     670,     673,     676,
-    679,     682,     685,     688,     692,     695,     698,     701,
-    704,     707,     710,     714,     717,     720,     723,     726,
-    729,     732,     736,     739,     742,     745,     748,     751,
-    754,     758,     761,     764,     767,     770,     773,     776,
-    780,     783,     786,     789,     792,     795,     798,     802,
-    805,     808,     811,     814,     817,     820,     823,     827,
-    830,     833,     836,     839,     842,     845,     849,     852,
-    855,     858,     861,     864,     867,     871,     874,     877,
-    880,     883,     886,     889,     893,     896,     899,     902,
-    905,     908,     911,     915,     918,     921,     924,     927,
-    930,     933,     937,     940,     943,     946,     949,     952,
-    955,     958,     962,     965,     968,     971,     974,     977,
-    980,     984,     987,     990,     993,     996,     999,     1002,
-    1006,     1009,     1012,     1015,     1018,     1021,     1024,     1028,
-    1031,     1034,     1037,     1040,     1043,     1046,     1050,     1053,
-    1056,     1059,     1062,     1065,     1068,     1071,     1075,     1078,
-    1081,     1084,     1087,     1090,     1093,     1097,     1100,     1103,
-    1106,     1109,     1112,     1115,     1119,     1122,     1125,     1128,
-    1131,     1134,     1137,     1141,     1144,     1147,     1150,     1153,
-    1156,     1159,     1162,     1166,     1169,     1172,     1175,     1178,
-    1181,     1184,     1188,     1191,     1194,     1197,     1200,     1203,
-    1206,     1210,     1213,     1216,     1219,     1222,     1225,     1228,
-    1231,     1235,     1238,     1241,     1244,     1247,     1250,     1253,
-    1257,     1260,     1263,     1266,     1269,     1272,     1275,     1279,
-    1282,     1285,     1288,     1291,     1294,     1297,     1301,     1304,
-    1307,     1310,     1313,     1316,     1319,     1322,     1326,     1329,
-    1332,     1335,     1338,     1341,     1344,     1348,     1351,     1354,
-    1357,     1360,     1363,     1366,     1370,     1373,     1376,     1379,
-    1382,     1385,     1388,     1391,     1395,     1398,     1401,     1404,
-    1407,     1410,     1413,     1417,     1420,     1423,     1426,     1429,
-    1432,     1435,     1438,     1442,     1445,     1448,     1451,     1454,
-    1457,     1460,     1464,     1467,     1470,     1473,     1476,     1479,
-    1482,     1486,     1489,     1492,     1495,     1498,     1501,     1504,
-    1507,     1511,     1514,     1517,     1520,     1523,     1526,     1529,
-    1533,     1536,     1539,     1542,     1545,     1548,     1551,     1554,
-    1558,     1561,     1564,     1567,     1570,     1573,     1576,     1580,
-    1583,     1586,     1589,     1592,     1595,     1598,     1602,     1605,
-    1608,     1611,     1614,     1617,     1620,     1623,     1627,     1630,
-    1633,     1636,     1639,     1642,     1645,     1649,     1652,     1655,
-    1658,     1661,     1664,     1667,     1670,     1674,     1677,     1680,
-    1683,     1686,     1689,     1692,     1696,     1699,     1702,     1705,
-    1708,     1711,     1714,     1717,     1721,     1724,     1727,     1730,
-    1733,     1736,     1739,     1743,     1746,     1749,     1752,     1755,
-    1758,     1761,     1764,     1768,     1771,     1774,     1777,     1780,
-    1783,     1786,     1789,     1793,     1796,     1799,     1802,     1805,
-    1808,     1811,     1815,     1818,     1821,     1824,     1827,     1830,
-    1833,     1836,     1840,     1843,     1846,     1849,     1852,     1855,
-    1858,     1862,     1865,     1868,     1871,     1874,     1877,     1880,
-    1883,     1887,     1890,     1893,     1896,     1899,     1902,     1905,
-    1908,     1912,     1915,     1918,     1921,     1924,     1927,     1930,
-    1934,     1937,     1940,     1943,     1946,     1949,     1952,     1955,
-    1959,     1962,     1965,     1968,     1971,     1974,     1977,     1980,
-    1984,     1987,     1990,     1993,     1996,     1999,     2002,     2006,
-    2009,     2012,     2015,     2018,     2021,     2024,     2027,     2031,
-    2034,     2037,     2040,     2043,     2046,     2049,     2052,     2056,
-    2059,     2062,     2065,     2068,     2071,     2074,     2078,     2081,
-    2084,     2087,     2090,     2093,     2096,     2099,     2103,     2106,
-    2109,     2112,     2115,     2118,     2121,     2124,     2128,     2131,
-    2134,     2137,     2140,     2143,     2146,     2149,     2153,     2156,
-    2159,     2162,     2165,     2168,     2171,     2174,     2178,     2181,
-    2184,     2187,     2190,     2193,     2196,     2200,     2203,     2206,
-    2209,     2212,     2215,     2218,     2221,     2225,     2228,     2231,
-    2234,     2237,     2240,     2243,     2246,     2250,     2253,     2256,
-    2259,     2262,     2265,     2268,     2271,     2275,     2278,     2281,
-    2284,     2287,     2290,     2293,     2296,     2300,     2303,     2306,
-    2309,     2312,     2315,     2318,     2321,     2325,     2328,     2331,
-    2334,     2337,     2340,     2343,     2346,     2350,     2353,     2356,
-    2359,     2362,     2365,     2368,     2371,     2375,     2378,     2381,
-    2384,     2387,     2390,     2393,     2396,     2400,     2403,     2406,
-    2409,     2412,     2415,     2418,     2421,     2425,     2428,     2431,
-    2434,     2437,     2440,     2443,     2446,     2450,     2453,     2456,
-    2459,     2462,     2465,     2468,     2471,     2475,     2478,     2481,
-    2484,     2487,     2490,     2493,     2496,     2500,     2503,     2506,
-    2509,     2512,     2515,     2518,     2521,     2525,     2528,     2531,
-    2534,     2537,     2540,     2543,     2546,     2550,     2553,     2556,
-    2559,     2562,     2565,     2568,     2571,     2574,     2578,     2581,
-    2584,     2587,     2590,     2593,     2596,     2599,     2603,     2606,
-    2609,     2612,     2615,     2618,     2621,     2624,     2628,     2631,
-    2634,     2637,     2640,     2643,     2646,     2649,     2653,     2656,
-    2659,     2662,     2665,     2668,     2671,     2674,     2678,     2681,
-    2684,     2687,     2690,     2693,     2696,     2699,     2702,     2706,
-    2709,     2712,     2715,     2718,     2721,     2724,     2727,     2731,
-    2734,     2737,     2740,     2743,     2746,     2749,     2752,     2756,
-    2759,     2762,     2765,     2768,     2771,     2774,     2777,     2780,
-    2784,     2787,     2790,     2793,     2796,     2799,     2802,     2805,
-    2809,     2812,     2815,     2818,     2821,     2824,     2827,     2830,
-    2833,     2837,     2840,     2843,     2846,     2849,     2852,     2855,
-    2858,     2862,     2865,     2868,     2871,     2874,     2877,     2880,
-    2883,     2886,     2890,     2893,     2896,     2899,     2902,     2905,
-    2908,     2911,     2915,     2918,     2921,     2924,     2927,     2930,
-    2933,     2936,     2939,     2943,     2946,     2949,     2952,     2955,
-    2958,     2961,     2964,     2967,     2971,     2974,     2977,     2980,
-    2983,     2986,     2989,     2992,     2996,     2999,     3002,     3005,
-    3008,     3011,     3014,     3017,     3020,     3024,     3027,     3030,
-    3033,     3036,     3039,     3042,     3045,     3048,     3052,     3055,
-    3058,     3061,     3064,     3067,     3070,     3073,     3077,     3080,
-    3083,     3086,     3089,     3092,     3095,     3098,     3101,     3105,
-    3108,     3111,     3114,     3117,     3120,     3123,     3126,     3129,
-    3133,     3136,     3139,     3142,     3145,     3148,     3151,     3154,
-    3157,     3161,     3164,     3167,     3170,     3173,     3176,     3179,
-    3182,     3185,     3189,     3192,     3195,     3198,     3201,     3204,
-    3207,     3210,     3213,     3217,     3220,     3223,     3226,     3229,
-    3232,     3235,     3238,     3241,     3245,     3248,     3251,     3254,
-    3257,     3260,     3263,     3266,     3269,     3273,     3276,     3279,
-    3282,     3285,     3288,     3291,     3294,     3297,     3301,     3304,
-    3307,     3310,     3313,     3316,     3319,     3322,     3325,     3329,
-    3332,     3335,     3338,     3341,     3344,     3347,     3350,     3353,
-    3357,     3360,     3363,     3366,     3369,     3372,     3375,     3378,
-    3381,     3385,     3388,     3391,     3394,     3397,     3400,     3403,
-    3406,     3409,     3412,     3416,     3419,     3422,     3425,     3428,
-    3431,     3434,     3437,     3440,     3444,     3447,     3450,     3453,
-    3456,     3459,     3462,     3465,     3468,     3472,     3475,     3478,
-    3481,     3484,     3487,     3490,     3493,     3496,     3499,     3503,
-    3506,     3509,     3512,     3515,     3518,     3521,     3524,     3527,
-    3531,     3534,     3537,     3540,     3543,     3546,     3549,     3552,
-    3555,     3558,     3562,     3565,     3568,     3571,     3574,     3577,
-    3580,     3583,     3586,     3590,     3593,     3596,     3599,     3602,
-    3605,     3608,     3611,     3614,     3617,     3621,     3624,     3627,
-    3630,     3633,     3636,     3639,     3642,     3645,     3648,     3652,
-    3655,     3658,     3661,     3664,     3667,     3670,     3673,     3676,
-    3679,     3683,     3686,     3689,     3692,     3695,     3698,     3701,
-    3704,     3707,     3711,     3714,     3717,     3720,     3723,     3726,
-    3729,     3732,     3735,     3738,     3742,     3745,     3748,     3751,
-    3754,     3757,     3760,     3763,     3766,     3769,     3773,     3776,
-    3779,     3782,     3785,     3788,     3791,     3794,     3797,     3800,
-    3804,     3807,     3810,     3813,     3816,     3819,     3822,     3825,
-    3828,     3831,     3835,     3838,     3841,     3844,     3847,     3850,
-    3853,     3856,     3859,     3862,     3865,     3869,     3872,     3875,
-    3878,     3881,     3884,     3887,     3890,     3893,     3896,     3900,
-    3903,     3906,     3909,     3912,     3915,     3918,     3921,     3924,
-    3927,     3931,     3934,     3937,     3940,     3943,     3946,     3949,
-    3952,     3955,     3958,     3961,     3965,     3968,     3971,     3974,
-    3977,     3980,     3983,     3986,     3989,     3992,     3996,     3999,
-    4002,     4005,     4008,     4011,     4014,     4017,     4020,     4023,
-    4026,     4030,     4033,     4036,     4039,     4042,     4045,     4048,
-    4051,     4054,     4057,     4061,     4064,     4067,     4070,     4073,
-    4076,     4079,     4082,     4085,     4088,     4091,     4095,     4098,
-    4101,     4104,     4107,     4110,     4113,     4116,     4119,     4122,
-    4125,     4129,     4132,     4135,     4138,     4141,     4144,     4147,
-    4150,     4153,     4156,     4159,     4163,     4166,     4169,     4172,
-    4175,     4178,     4181,     4184,     4187,     4190,     4193,     4197,
-    4200,     4203,     4206,     4209,     4212,     4215,     4218,     4221,
-    4224,     4227,     4231,     4234,     4237,     4240,     4243,     4246,
-    4249,     4252,     4255,     4258,     4261,     4265,     4268,     4271,
-    4274,     4277,     4280,     4283,     4286,     4289,     4292,     4295,
-    4298,     4302,     4305,     4308,     4311,     4314,     4317,     4320,
-    4323,     4326,     4329,     4332,     4336,     4339,     4342,     4345,
-    4348,     4351,     4354,     4357,     4360,     4363,     4366,     4369,
-    4373,     4376,     4379,     4382,     4385,     4388,     4391,     4394,
-    4397,     4400,     4403,     4406,     4410,     4413,     4416,     4419,
-    4422,     4425,     4428,     4431,     4434,     4437,     4440,     4443,
-    4447,     4450,     4453,     4456,     4459,     4462,     4465,     4468,
-    4471,     4474,     4477,     4480,     4484,     4487,     4490,     4493,
-    4496,     4499,     4502,     4505,     4508,     4511,     4514,     4517,
-    4521,     4524,     4527,     4530,     4533,     4536,     4539,     4542,
-    4545,     4548,     4551,     4554,     4558,     4561,     4564,     4567,
-    4570,     4573,     4576,     4579,     4582,     4585,     4588,     4591,
-    4595,     4598,     4601,     4604,     4607,     4610,     4613,     4616,
-    4619,     4622,     4625,     4628,     4631,     4635,     4638,     4641,
-    4644,     4647,     4650,     4653,     4656,     4659,     4662,     4665,
-    4668,     4671,     4675,     4678,     4681,     4684,     4687,     4690,
-    4693,     4696,     4699,     4702,     4705,     4708,     4711,     4715,
-    4718,     4721,     4724,     4727,     4730,     4733,     4736,     4739,
-    4742,     4745,     4748,     4751,     4755,     4758,     4761,     4764,
-    4767,     4770,     4773,     4776,     4779,     4782,     4785,     4788,
-    4791,     4795,     4798,     4801,     4804,     4807,     4810,     4813,
-    4816,     4819,     4822,     4825,     4828,     4831,     4834,     4838,
-    4841,     4844,     4847,     4850,     4853,     4856,     4859,     4862,
-    4865,     4868,     4871,     4874,     4877,     4881,     4884,     4887,
-    4890,     4893,     4896,     4899,     4902,     4905,     4908,     4911,
-    4914,     4917,     4920,     4924,     4927,     4930,     4933,     4936,
-    4939,     4942,     4945,     4948,     4951,     4954,     4957,     4960,
-    4963,     4967,     4970,     4973,     4976,     4979,     4982,     4985,
-    4988,     4991,     4994,     4997,     5000,     5003,     5006,     5010,
-    5013,     5016,     5019,     5022,     5025,     5028,     5031,     5034,
-    5037,     5040,     5043,     5046,     5049,     5052,     5056,     5059,
-    5062,     5065,     5068,     5071,     5074,     5077,     5080,     5083,
-    5086,     5089,     5092,     5095,     5098,     5102,     5105,     5108,
-    5111,     5114,     5117,     5120,     5123,     5126,     5129,     5132,
-    5135,     5138,     5141,     5144,     5147,     5151,     5154,     5157,
-    5160,     5163,     5166,     5169,     5172,     5175,     5178,     5181,
-    5184,     5187,     5190,     5193,     5196,     5200,     5203,     5206,
-    5209,     5212,     5215,     5218,     5221,     5224,     5227,     5230,
-    5233,     5236,     5239,     5242,     5245,     5249,     5252,     5255,
-    5258,     5261,     5264,     5267,     5270,     5273,     5276,     5279,
-    5282,     5285,     5288,     5291,     5294,     5298,     5301,     5304,
-    5307,     5310,     5313,     5316,     5319,     5322,     5325,     5328,
-    5331,     5334,     5337,     5340,     5343,     5346,     5349,     5353,
-    5356,     5359,     5362,     5365,     5368,     5371,     5374,     5377,
-    5380,     5383,     5386,     5389,     5392,     5395,     5398,     5401,
-    5405,     5408,     5411,     5414,     5417,     5420,     5423,     5426,
-    5429,     5432,     5435,     5438,     5441,     5444,     5447,     5450,
-    5453,     5456,     5460,     5463,     5466,     5469,     5472,     5475,
-    5478,     5481,     5484,     5487,     5490,     5493,     5496,     5499,
-    5502,     5505,     5508,     5511,     5514,     5518,     5521,     5524,
-    5527,     5530,     5533,     5536,     5539,     5542,     5545,     5548,
-    5551,     5554,     5557,     5560,     5563,     5566,     5569,     5572,
-    5576,     5579,     5582,     5585,     5588,     5591,     5594,     5597,
-    5600,     5603,     5606,     5609,     5612,     5615,     5618,     5621,
-    5624,     5627,     5630,     5633,     5637,     5640,     5643,     5646,
-    5649,     5652,     5655,     5658,     5661,     5664,     5667,     5670,
-    5673,     5676,     5679,     5682,     5685,     5688,     5691,     5694,
-    5697,     5701,     5704,     5707,     5710,     5713,     5716,     5719,
-    5722,     5725,     5728,     5731,     5734,     5737,     5740,     5743,
-    5746,     5749,     5752,     5755,     5758,     5761,     5764,     5768,
-    5771,     5774,     5777,     5780,     5783,     5786,     5789,     5792,
-    5795,     5798,     5801,     5804,     5807,     5810,     5813,     5816,
-    5819,     5822,     5825,     5828,     5831,     5834,     5837,     5841,
-    5844,     5847,     5850,     5853,     5856,     5859,     5862,     5865,
-    5868,     5871,     5874,     5877,     5880,     5883,     5886,     5889,
-    5892,     5895,     5898,     5901,     5904,     5907,     5910,     5914,
-    5917,     5920,     5923,     5926,     5929,     5932,     5935,     5938,
-    5941,     5944,     5947,     5950,     5953,     5956,     5959,     5962,
-    5965,     5968,     5971,     5974,     5977,     5980,     5983,     5986,
-    5989,     5992,     5996,     5999,     6002,     6005,     6008,     6011,
-    6014,     6017,     6020,     6023,     6026,     6029,     6032,     6035,
-    6038,     6041,     6044,     6047,     6050,     6053,     6056,     6059,
-    6062,     6065,     6068,     6071,     6074,     6077,     6081,     6084,
-    6087,     6090,     6093,     6096,     6099,     6102,     6105,     6108,
-    6111,     6114,     6117,     6120,     6123,     6126,     6129,     6132,
-    6135,     6138,     6141,     6144,     6147,     6150,     6153,     6156,
-    6159,     6162,     6165,     6168,     6171,     6174,     6178,     6181,
-    6184,     6187,     6190,     6193,     6196,     6199,     6202,     6205,
-    6208,     6211,     6214,     6217,     6220,     6223,     6226,     6229,
-    6232,     6235,     6238,     6241,     6244,     6247,     6250,     6253,
-    6256,     6259,     6262,     6265,     6268,     6271,     6274,     6277,
-    6280,     6283,     6287,     6290,     6293,     6296,     6299,     6302,
-    6305,     6308,     6311,     6314,     6317,     6320,     6323,     6326,
-    6329,     6332,     6335,     6338,     6341,     6344,     6347,     6350,
-    6353,     6356,     6359,     6362,     6365,     6368,     6371,     6374,
-    6377,     6380,     6383,     6386,     6389,     6392,     6395,     6398,
-    6401,     6404,     6407,     6410,     6414,     6417,     6420,     6423,
-    6426,     6429,     6432,     6435,     6438,     6441,     6444,     6447,
-    6450,     6453,     6456,     6459,     6462,     6465,     6468,     6471,
-    6474,     6477,     6480,     6483,     6486,     6489,     6492,     6495,
-    6498,     6501,     6504,     6507,     6510,     6513,     6516,     6519,
-    6522,     6525,     6528,     6531,     6534,     6537,     6540,     6543,
-    6546,     6549,     6552,     6555,     6558,     6561,     6564,     6567,
-    6570,     6573,     6576,     6580,     6583,     6586,     6589,     6592,
-    6595,     6598,     6601,     6604,     6607,     6610,     6613,     6616,
-    6619,     6622,     6625,     6628,     6631,     6634,     6637,     6640,
-    6643,     6646,     6649,     6652,     6655,     6658,     6661,     6664,
-    6667,     6670,     6673,     6676,     6679,     6682,     6685,     6688,
-    6691,     6694,     6697,     6700,     6703,     6706,     6709,     6712,
-    6715,     6718,     6721,     6724,     6727,     6730,     6733,     6736,
-    6739,     6742,     6745,     6748,     6751,     6754,     6757,     6760,
-    6763,     6766,     6769,     6772,     6775,     6778,     6781,     6784,
-    6787,     6790,     6793,     6796,     6799,     6802,     6805,     6808,
-    6811,     6814,     6817,     6820,     6823,     6826,     6829,     6832,
-    6835,     6838,     6841,     6844,     6847,     6850,     6853,     6856,
-    6859,     6862,     6865,     6868,     6871,     6874,     6877,     6880,
-    6883,     6886,     6889,     6892,     6895,     6898,     6901,     6904,
-    6907,     6910,     6913,     6916,     6919,     6922,     6925,     6928,
-    6931,     6934,     6937,     6940,     6943,     6946,     6949,     6952,
-    6955,     6958,     6961,     6964,     6967,     6970,     6973,     6976,
-    6979,     6982,     6985,     6988,     6991,     6994,     6997,     7000,
-    7003,     7006,     7009,     7012,     7015,     7018,     7021,     7024,
-    7027,     7030,     7033,     7036,     7039,     7042,     7045,     7048,
-    7051,     7054,     7057,     7060,     7063,     7066,     7069,     7072,
-    7075,     7078,     7081,     7084,     7087,     7090,     7093,     7096,
-    7099,     7102,     7105,     7108,     7111,     7114,     7117,     7120,
-    7123,     7126,     7129,     7132,     7135,     7138,     7141,     7144,
-    7147,     7150,     7153,     7156,     7159,     7162,     7165,     7168,
-    7171,     7174,     7177,     7180,     7183,     7186,     7189,     7192,
-    7195,     7198,     7201,     7204,     7207,     7210,     7213,     7216,
-    7219,     7222,     7225,     7228,     7231,     7234,     7237,     7240,
-    7243,     7246,     7249,     7252,     7255,     7258,     7261,     7264,
-    7267,     7270,     7273,     7276,     7279,     7282,     7285,     7288,
-    7291,     7294,     7297,     7300,     7303,     7306,     7309,     7312,
-    7315,     7318,     7321,     7324,     7326,     7329,     7332,     7335,
-    7338,     7341,     7344,     7347,     7350,     7353,     7356,     7359,
-    7362,     7365,     7368,     7371,     7374,     7377,     7380,     7383,
-    7386,     7389,     7392,     7395,     7398,     7401,     7404,     7407,
-    7410,     7413,     7416,     7419,     7422,     7425,     7428,     7431,
-    7434,     7437,     7440,     7443,     7446,     7449,     7452,     7455,
-    7458,     7461,     7464,     7467,     7470,     7473,     7476,     7479,
-    7482,     7484,     7487,     7490,     7493,     7496,     7499,     7502,
-    7505,     7508,     7511,     7514,     7517,     7520,     7523,     7526,
-    7529,     7532,     7535,     7538,     7541,     7544,     7547,     7550,
-    7553,     7556,     7559,     7562,     7565,     7568,     7571,     7574,
-    7577,     7580,     7583,     7586,     7589,     7592,     7595,     7598,
-    7601,     7603,     7606,     7609,     7612,     7615,     7618,     7621,
-    7624,     7627,     7630,     7633,     7636,     7639,     7642,     7645,
-    7648,     7651,     7654,     7657,     7660,     7663,     7666,     7669,
-    7672,     7675,     7678,     7681,     7684,     7687,     7690,     7693,
-    7696,     7699,     7702,     7704,     7707,     7710,     7713,     7716,
-    7719,     7722,     7725,     7728,     7731,     7734,     7737,     7740,
-    7743,     7746,     7749,     7752,     7755,     7758,     7761,     7764,
-    7767,     7770,     7773,     7776,     7779,     7782,     7785,     7788,
-    7790,     7793,     7796,     7799,     7802,     7805,     7808,     7811,
-    7814,     7817,     7820,     7823,     7826,     7829,     7832,     7835,
-    7838,     7841,     7844,     7847,     7850,     7853,     7856,     7859,
-    7862,     7865,     7867,     7870,     7873,     7876,     7879,     7882,
-    7885,     7888,     7891,     7894,     7897,     7900,     7903,     7906,
-    7909,     7912,     7915,     7918,     7921,     7924,     7927,     7930,
-    7933,     7936,     7939,     7941,     7944,     7947,     7950,     7953,
-    7956,     7959,     7962,     7965,     7968,     7971,     7974,     7977,
-    7980,     7983,     7986,     7989,     7992,     7995,     7998,     8001,
-    8004,     8006,     8009,     8012,     8015,     8018,     8021,     8024,
-    8027,     8030,     8033,     8036,     8039,     8042,     8045,     8048,
-    8051,     8054,     8057,     8060,     8063,     8066,     8068,     8071,
-    8074,     8077,     8080,     8083,     8086,     8089,     8092,     8095,
-    8098,     8101,     8104,     8107,     8110,     8113,     8116,     8119,
-    8122,     8125,     8127,     8130,     8133,     8136,     8139,     8142,
-    8145,     8148,     8151,     8154,     8157,     8160,     8163,     8166,
-    8169,     8172,     8175,     8178,     8181,     8183,     8186,     8189,
-    8192,     8195,     8198,     8201,     8204,     8207,     8210,     8213,
-    8216,     8219,     8222,     8225,     8228,     8231,     8234,     8236,
-    8239,     8242,     8245,     8248,     8251,     8254,     8257,     8260,
-    8263,     8266,     8269,     8272,     8275,     8278,     8281,     8284,
-    8286,     8289,     8292,     8295,     8298,     8301,     8304,     8307,
-    8310,     8313,     8316,     8319,     8322,     8325,     8328,     8331,
-    8334,     8336,     8339,     8342,     8345,     8348,     8351,     8354,
-    8357,     8360,     8363,     8366,     8369,     8372,     8375,     8378,
-    8381,     8383,     8386,     8389,     8392,     8395,     8398,     8401,
-    8404,     8407,     8410,     8413,     8416,     8419,     8422,     8425,
-    8427,     8430,     8433,     8436,     8439,     8442,     8445,     8448,
-    8451,     8454,     8457,     8460,     8463,     8466,     8469,     8471,
-    8474,     8477,     8480,     8483,     8486,     8489,     8492,     8495,
-    8498,     8501,     8504,     8507,     8510,     8512,     8515,     8518,
-    8521,     8524,     8527,     8530,     8533,     8536,     8539,     8542,
-    8545,     8548,     8551,     8553,     8556,     8559,     8562,     8565,
-    8568,     8571,     8574,     8577,     8580,     8583,     8586,     8589,
-    8592,     8594,     8597,     8600,     8603,     8606,     8609,     8612,
-    8615,     8618,     8621,     8624,     8627,     8630,     8632,     8635,
-    8638,     8641,     8644,     8647,     8650,     8653,     8656,     8659,
-    8662,     8665,     8668,     8670,     8673,     8676,     8679,     8682,
-    8685,     8688,     8691,     8694,     8697,     8700,     8703,     8706,
-    8708,     8711,     8714,     8717,     8720,     8723,     8726,     8729,
-    8732,     8735,     8738,     8741,     8743,     8746,     8749,     8752,
-    8755,     8758,     8761,     8764,     8767,     8770,     8773,     8776,
-    8778,     8781,     8784,     8787,     8790,     8793,     8796,     8799,
-    8802,     8805,     8808,     8811,     8813,     8816,     8819,     8822,
-    8825,     8828,     8831,     8834,     8837,     8840,     8843,     8845,
-    8848,     8851,     8854,     8857,     8860,     8863,     8866,     8869,
-    8872,     8875,     8878,     8880,     8883,     8886,     8889,     8892,
-    8895,     8898,     8901,     8904,     8907,     8910,     8912,     8915,
-    8918,     8921,     8924,     8927,     8930,     8933,     8936,     8939,
-    8942,     8944,     8947,     8950,     8953,     8956,     8959,     8962,
-    8965,     8968,     8971,     8974,     8976,     8979,     8982,     8985,
-    8988,     8991,     8994,     8997,     9000,     9003,     9005,     9008,
-    9011,     9014,     9017,     9020,     9023,     9026,     9029,     9032,
-    9034,     9037,     9040,     9043,     9046,     9049,     9052,     9055,
-    9058,     9061,     9064,     9066,     9069,     9072,     9075,     9078,
-    9081,     9084,     9087,     9090,     9093,     9095,     9098,     9101,
-    9104,     9107,     9110,     9113,     9116,     9119,     9122,     9124,
-    9127,     9130,     9133,     9136,     9139,     9142,     9145,     9148,
-    9150,     9153,     9156,     9159,     9162,     9165,     9168,     9171,
-    9174,     9177,     9179,     9182,     9185,     9188,     9191,     9194,
-    9197,     9200,     9203,     9205,     9208,     9211,     9214,     9217,
-    9220,     9223,     9226,     9229,     9232,     9234,     9237,     9240,
-    9243,     9246,     9249,     9252,     9255,     9258,     9260,     9263,
-    9266,     9269,     9272,     9275,     9278,     9281,     9284,     9286,
-    9289,     9292,     9295,     9298,     9301,     9304,     9307,     9310,
-    9312,     9315,     9318,     9321,     9324,     9327,     9330,     9333,
-    9336,     9338,     9341,     9344,     9347,     9350,     9353,     9356,
-    9359,     9362,     9364,     9367,     9370,     9373,     9376,     9379,
-    9382,     9385,     9387,     9390,     9393,     9396,     9399,     9402,
-    9405,     9408,     9411,     9413,     9416,     9419,     9422,     9425,
-    9428,     9431,     9434,     9436,     9439,     9442,     9445,     9448,
-    9451,     9454,     9457,     9460,     9462,     9465,     9468,     9471,
-    9474,     9477,     9480,     9483,     9485,     9488,     9491,     9494,
-    9497,     9500,     9503,     9506,     9508,     9511,     9514,     9517,
-    9520,     9523,     9526,     9529,     9531,     9534,     9537,     9540,
-    9543,     9546,     9549,     9552,     9554,     9557,     9560,     9563,
-    9566,     9569,     9572,     9575,     9577,     9580,     9583,     9586,
-    9589,     9592,     9595,     9598,     9600,     9603,     9606,     9609,
-    9612,     9615,     9618,     9621,     9623,     9626,     9629,     9632,
-    9635,     9638,     9641,     9643,     9646,     9649,     9652,     9655,
-    9658,     9661,     9664,     9666,     9669,     9672,     9675,     9678,
-    9681,     9684,     9687,     9689,     9692,     9695,     9698,     9701,
-    9704,     9707,     9709,     9712,     9715,     9718,     9721,     9724,
-    9727,     9729,     9732,     9735,     9738,     9741,     9744,     9747,
-    9750,     9752,     9755,     9758,     9761,     9764,     9767,     9770,
-    9772,     9775,     9778,     9781,     9784,     9787,     9790,     9792,
-    9795,     9798,     9801,     9804,     9807,     9810,     9813,     9815,
-    9818,     9821,     9824,     9827,     9830,     9833,     9835,     9838,
-    9841,     9844,     9847,     9850,     9853,     9855,     9858,     9861,
-    9864,     9867,     9870,     9873,     9875,     9878,     9881,     9884,
-    9887,     9890,     9893,     9895,     9898,     9901,     9904,     9907,
-    9910,     9912,     9915,     9918,     9921,     9924,     9927,     9930,
-    9932,     9935,     9938,     9941,     9944,     9947,     9950,     9952,
-    9955,     9958,     9961,     9964,     9967,     9970,     9972,     9975,
-    9978,     9981,     9984,     9987,     9989,     9992,     9995,     9998,
-    10001,     10004,     10007,     10009,     10012,     10015,     10018,     10021,
-    10024,     10027,     10029,     10032,     10035,     10038,     10041,     10044,
-    10046,     10049,     10052,     10055,     10058,     10061,     10064,     10066,
-    10069,     10072,     10075,     10078,     10081,     10083,     10086,     10089,
-    10092,     10095,     10098,     10100,     10103,     10106,     10109,     10112,
-    10115,     10118,     10120,     10123,     10126,     10129,     10132,     10135,
-    10137,     10140,     10143,     10146,     10149,     10152,     10154,     10157,
-    10160,     10163,     10166,     10169,     10172,     10174,     10177,     10180,
-    10183,     10186,     10189,     10191,     10194,     10197,     10200,     10203,
-    10206,     10208,     10211,     10214,     10217,     10220,     10223,     10225,
-    10228,     10231,     10234,     10237,     10240,     10242,     10245,     10248,
-    10251,     10254,     10257,     10259,     10262,     10265,     10268,     10271,
-    10274,     10276,     10279,     10282,     10285,     10288,     10291,     10293,
-    10296,     10299,     10302,     10305,     10308,     10310,     10313,     10316,
-    10319,     10322,     10325,     10327,     10330,     10333,     10336,     10339,
-    10342,     10344,     10347,     10350,     10353,     10356,     10359,     10361,
-    10364,     10367,     10370,     10373,     10375,     10378,     10381,     10384,
-    10387,     10390,     10392,     10395,     10398,     10401,     10404,     10407,
-    10409,     10412,     10415,     10418,     10421,     10424,     10426,     10429,
-    10432,     10435,     10438,     10440,     10443,     10446,     10449,     10452,
-    10455,     10457,     10460,     10463,     10466,     10469,     10471,     10474,
-    10477,     10480,     10483,     10486,     10488,     10491,     10494,     10497,
-    10500,     10502,     10505,     10508,     10511,     10514,     10517,     10519,
-    10522,     10525,     10528,     10531,     10533,     10536,     10539,     10542,
-    10545,     10548,     10550,     10553,     10556,     10559,     10562,     10564,
-    10567,     10570,     10573,     10576,     10579,     10581,     10584,     10587,
-    10590,     10593,     10595,     10598,     10601,     10604,     10607,     10609,
-    10612,     10615,     10618,     10621,     10624,     10626,     10629,     10632,
-    10635,     10638,     10640,     10643,     10646,     10649,     10652,     10654,
-    10657,     10660,     10663,     10666,     10669,     10671,     10674,     10677,
-    10680,     10683,     10685,     10688,     10691,     10694,     10697,     10699,
-    10702,     10705,     10708,     10711,     10713,     10716,     10719,     10722,
-    10725,     10727,     10730,     10733,     10736,     10739,     10741,     10744,
-    10747,     10750,     10753,     10755,     10758,     10761,     10764,     10767,
-    10769,     10772,     10775,     10778,     10781,     10784,     10786,     10789,
-    10792,     10795,     10798,     10800,     10803,     10806,     10809,     10812,
-    10814,     10817,     10820,     10823,     10826,     10828,     10831,     10834,
-    10837,     10839,     10842,     10845,     10848,     10851,     10853,     10856,
-    10859,     10862,     10865,     10867,     10870,     10873,     10876,     10879,
-    10881,     10884,     10887,     10890,     10893,     10895,     10898,     10901,
-    10904,     10907,     10909,     10912,     10915,     10918,     10921,     10923,
-    10926,     10929,     10932,     10935,     10937,     10940,     10943,     10946,
-    10948,     10951,     10954,     10957,     10960,     10962,     10965,     10968,
-    10971,     10974,     10976,     10979,     10982,     10985,     10988,     10990,
-    10993,     10996,     10999,     11001,     11004,     11007,     11010,     11013,
-    11015,     11018,     11021,     11024,     11027,     11029,     11032,     11035,
-    11038,     11040,     11043,     11046,     11049,     11052,     11054,     11057,
-    11060,     11063,     11066,     11068,     11071,     11074,     11077,     11079,
-    11082,     11085,     11088,     11091,     11093,     11096,     11099,     11102,
-    11104,     11107,     11110,     11113,     11116,     11118,     11121,     11124,
-    11127,     11129,     11132,     11135,     11138,     11141,     11143,     11146,
-    11149,     11152,     11154,     11157,     11160,     11163,     11166,     11168,
-    11171,     11174,     11177,     11179,     11182,     11185,     11188,     11191,
-    11193,     11196,     11199,     11202,     11204,     11207,     11210,     11213,
-    11216,     11218,     11221,     11224,     11227,     11229,     11232,     11235,
-    11238,     11241,     11243,     11246,     11249,     11252,     11254,     11257,
-    11260,     11263,     11265,     11268,     11271,     11274,     11277,     11279,
-    11282,     11285,     11288,     11290,     11293,     11296,     11299,     11301,
-    11304,     11307,     11310,     11313,     11315,     11318,     11321,     11324,
-    11326,     11329,     11332,     11335,     11337,     11340,     11343,     11346,
-    11348,     11351,     11354,     11357,     11360,     11362,     11365,     11368,
-    11371,     11373,     11376,     11379,     11382,     11384,     11387,     11390,
-    11393,     11395,     11398,     11401,     11404,     11406,     11409,     11412,
-    11415,     11418,     11420,     11423,     11426,     11429,     11431,     11434,
-    11437,     11440,     11442,     11445,     11448,     11451,     11453,     11456,
-    11459,     11462,     11464,     11467,     11470,     11473,     11475,     11478,
-    11481,     11484,     11486,     11489,     11492,     11495,     11498,     11500,
-    11503,     11506,     11509,     11511,     11514,     11517,     11520,     11522,
-    11525,     11528,     11531,     11533,     11536,     11539,     11542,     11544,
-    11547,     11550,     11553,     11555,     11558,     11561,     11564,     11566,
-    11569,     11572,     11575,     11577,     11580,     11583,     11586,     11588,
-    11591,     11594,     11597,     11599,     11602,     11605,     11608,     11610,
-    11613,     11616,     11619,     11621,     11624,     11627,     11630,     11632,
-    11635,     11638,     11640,     11643,     11646,     11649,     11651,     11654,
-    11657,     11660,     11662,     11665,     11668,     11671,     11673,     11676,
-    11679,     11682,     11684,     11687,     11690,     11693,     11695,     11698,
-    11701,     11704,     11706,     11709,     11712,     11715,     11717,     11720,
-    11723,     11726,     11728,     11731,     11734,     11736,     11739,     11742,
-    11745,     11747,     11750,     11753,     11756,     11758,     11761,     11764,
-    11767,     11769,     11772,     11775,     11778,     11780,     11783,     11786,
-    11788,     11791,     11794,     11797,     11799,     11802,     11805,     11808,
-    11810,     11813,     11816,     11819,     11821,     11824,     11827,     11829,
-    11832,     11835,     11838,     11840,     11843,     11846,     11849,     11851,
-    11854,     11857,     11860,     11862,     11865,     11868,     11870,     11873,
-    11876,     11879,     11881,     11884,     11887,     11890,     11892,     11895,
-    11898,     11900,     11903,     11906,     11909,     11911,     11914,     11917,
-    11920,     11922,     11925,     11928,     11930,     11933,     11936,     11939,
-    11941,     11944,     11947,     11949,     11952,     11955,     11958,     11960,
-    11963,     11966,     11969,     11971,     11974,     11977,     11979,     11982,
-    11985,     11988,     11990,     11993,     11996,     11998,     12001,     12004,
-    12007,     12009,     12012,     12015,     12018,     12020,     12023,     12026,
-    12028,     12031,     12034,     12037,     12039,     12042,     12045,     12047,
-    12050,     12053,     12056,     12058,     12061,     12064,     12066,     12069,
-    12072,     12075,     12077,     12080,     12083,     12085,     12088,     12091,
-    12094,     12096,     12099,     12102,     12104,     12107,     12110,     12113,
-    12115,     12118,     12121,     12123,     12126,     12129,     12132,     12134,
-    12137,     12140,     12142,     12145,     12148,     12151,     12153,     12156,
-    12159,     12161,     12164,     12167,     12169,     12172,     12175,     12178,
-    12180,     12183,     12186,     12188,     12191,     12194,     12197,     12199,
-    12202,     12205,     12207,     12210,     12213,     12215,     12218,     12221,
-    12224,     12226,     12229,     12232,     12234,     12237,     12240,     12243,
-    12245,     12248,     12251,     12253,     12256,     12259,     12261,     12264,
-    12267,     12270,     12272,     12275,     12278,     12280,     12283,     12286,
-    12288,     12291,     12294,     12297,     12299,     12302,     12305,     12307,
-    12310,     12313,     12315,     12318,     12321,     12324,     12326,     12329,
-    12332,     12334,     12337,     12340,     12342,     12345,     12348,     12350,
-    12353,     12356,     12359,     12361,     12364,     12367,     12369,     12372,
-    12375,     12377,     12380,     12383,     12386,     12388,     12391,     12394,
-    12396,     12399,     12402,     12404,     12407,     12410,     12412,     12415,
-    12418,     12421,     12423,     12426,     12429,     12431,     12434,     12437,
-    12439,     12442,     12445,     12447,     12450,     12453,     12455,     12458,
-    12461,     12464,     12466,     12469,     12472,     12474,     12477,     12480,
-    12482,     12485,     12488,     12490,     12493,     12496,     12498,     12501,
-    12504,     12506,     12509,     12512,     12515,     12517,     12520,     12523,
-    12525,     12528,     12531,     12533,     12536,     12539,     12541,     12544,
-    12547,     12549,     12552,     12555,     12557,     12560,     12563,     12565,
-    12568,     12571,     12574,     12576,     12579,     12582,     12584,     12587,
-    12590,     12592,     12595,     12598,     12600,     12603,     12606,     12608,
-    12611,     12614,     12616,     12619,     12622,     12624,     12627,     12630,
-    12632,     12635,     12638,     12640,     12643,     12646,     12648,     12651,
-    12654,     12656,     12659,     12662,     12664,     12667,     12670,     12673,
-    12675,     12678,     12681,     12683,     12686,     12689,     12691,     12694,
-    12697,     12699,     12702,     12705,     12707,     12710,     12713,     12715,
-    12718,     12721,     12723,     12726,     12729,     12731,     12734,     12737,
-    12739,     12742,     12745,     12747,     12750,     12753,     12755,     12758,
-    12761,     12763,     12766,     12769,     12771,     12774,     12777,     12779,
-    12782,     12785,     12787,     12790,     12793,     12795,     12798,     12801,
-    12803,     12806,     12809,     12811,     12814,     12816,     12819,     12822,
-    12824,     12827,     12830,     12832,     12835,     12838,     12840,     12843,
-    12846,     12848,     12851,     12854,     12856,     12859,     12862,     12864,
-    12867,     12870,     12872,     12875,     12878,     12880,     12883,     12886,
-    12888,     12891,     12894,     12896,     12899,     12902,     12904,     12907,
-    12909,     12912,     12915,     12917,     12920,     12923,     12925,     12928,
-    12931,     12933,     12936,     12939,     12941,     12944,     12947,     12949,
-    12952,     12955,     12957,     12960,     12963,     12965,     12968,     12970,
-    12973,     12976,     12978,     12981,     12984,     12986,     12989,     12992,
-    12994,     12997,     13000,     13002,     13005,     13008,     13010,     13013,
-    13015,     13018,     13021,     13023,     13026,     13029,     13031,     13034,
-    13037,     13039,     13042,     13045,     13047,     13050,     13053,     13055,
-    13058,     13060,     13063,     13066,     13068,     13071,     13074,     13076,
-    13079,     13082,     13084,     13087,     13089,     13092,     13095,     13097,
-    13100,     13103,     13105,     13108,     13111,     13113,     13116,     13119,
-    13121,     13124,     13126,     13129,     13132,     13134,     13137,     13140,
-    13142,     13145,     13148,     13150,     13153,     13155,     13158,     13161,
-    13163,     13166,     13169,     13171,     13174,     13177,     13179,     13182,
-    13184,     13187,     13190,     13192,     13195,     13198,     13200,     13203,
-    13205,     13208,     13211,     13213,     13216,     13219,     13221,     13224,
-    13227,     13229,     13232,     13234,     13237,     13240,     13242,     13245,
-    13248,     13250,     13253,     13255,     13258,     13261,     13263,     13266,
-    13269,     13271,     13274,     13276,     13279,     13282,     13284,     13287,
-    13290,     13292,     13295,     13297,     13300,     13303,     13305,     13308,
-    13311,     13313,     13316,     13318,     13321,     13324,     13326,     13329,
-    13332,     13334,     13337,     13339,     13342,     13345,     13347,     13350,
-    13353,     13355,     13358,     13360,     13363,     13366,     13368,     13371,
-    13373,     13376,     13379,     13381,     13384,     13387,     13389,     13392,
-    13394,     13397,     13400,     13402,     13405,     13407,     13410,     13413,
-    13415,     13418,     13421,     13423,     13426,     13428,     13431,     13434,
-    13436,     13439,     13441,     13444,     13447,     13449,     13452,     13455,
-    13457,     13460,     13462,     13465,     13468,     13470,     13473,     13475,
-    13478,     13481,     13483,     13486,     13488,     13491,     13494,     13496,
-    13499,     13502,     13504,     13507,     13509,     13512,     13515,     13517,
-    13520,     13522,     13525,     13528,     13530,     13533,     13535,     13538,
-    13541,     13543,     13546,     13548,     13551,     13554,     13556,     13559,
-    13561,     13564,     13567,     13569,     13572,     13574,     13577,     13580,
-    13582,     13585,     13587,     13590,     13593,     13595,     13598,     13600,
-    13603,     13606,     13608,     13611,     13613,     13616,     13619,     13621,
-    13624,     13626,     13629,     13632,     13634,     13637,     13639,     13642,
-    13645,     13647,     13650,     13652,     13655,     13658,     13660,     13663,
-    13665,     13668,     13671,     13673,     13676,     13678,     13681,     13684,
-    13686,     13689,     13691,     13694,     13697,     13699,     13702,     13704,
-    13707,     13709,     13712,     13715,     13717,     13720,     13722,     13725,
-    13728,     13730,     13733,     13735,     13738,     13741,     13743,     13746,
-    13748,     13751,     13754,     13756,     13759,     13761,     13764,     13766,
-    13769,     13772,     13774,     13777,     13779,     13782,     13785,     13787,
-    13790,     13792,     13795,     13797,     13800,     13803,     13805,     13808,
-    13810,     13813,     13816,     13818,     13821,     13823,     13826,     13828,
-    13831,     13834,     13836,     13839,     13841,     13844,     13847,     13849,
-    13852,     13854,     13857,     13859,     13862,     13865,     13867,     13870,
-    13872,     13875,     13878,     13880,     13883,     13885,     13888,     13890,
-    13893,     13896,     13898,     13901,     13903,     13906,     13908,     13911,
-    13914,     13916,     13919,     13921,     13924,     13926,     13929,     13932,
-    13934,     13937,     13939,     13942,     13944,     13947,     13950,     13952,
-    13955,     13957,     13960,     13962,     13965,     13968,     13970,     13973,
-    13975,     13978,     13980,     13983,     13986,     13988,     13991,     13993,
-    13996,     13998,     14001,     14004,     14006,     14009,     14011,     14014,
-    14016,     14019,     14022,     14024,     14027,     14029,     14032,     14034,
-    14037,     14040,     14042,     14045,     14047,     14050,     14052,     14055,
-    14057,     14060,     14063,     14065,     14068,     14070,     14073,     14075,
-    14078,     14081,     14083,     14086,     14088,     14091,     14093,     14096,
-    14098,     14101,     14104,     14106,     14109,     14111,     14114,     14116,
-    14119,     14121,     14124,     14127,     14129,     14132,     14134,     14137,
-    14139,     14142,     14144,     14147,     14150,     14152,     14155,     14157,
-    14160,     14162,     14165,     14167,     14170,     14173,     14175,     14178,
-    14180,     14183,     14185,     14188,     14190,     14193,     14196,     14198,
-    14201,     14203,     14206,     14208,     14211,     14213,     14216,     14219,
-    14221,     14224,     14226,     14229,     14231,     14234,     14236,     14239,
-    14241,     14244,     14247,     14249,     14252,     14254,     14257,     14259,
-    14262,     14264,     14267,     14269,     14272,     14275,     14277,     14280,
-    14282,     14285,     14287,     14290,     14292,     14295,     14297,     14300,
-    14303,     14305,     14308,     14310,     14313,     14315,     14318,     14320,
-    14323,     14325,     14328,     14331,     14333,     14336,     14338,     14341,
-    14343,     14346,     14348,     14351,     14353,     14356,     14358,     14361,
-    14364,     14366,     14369,     14371,     14374,     14376,     14379,     14381,
-    14384,     14386,     14389,     14391,     14394,     14397,     14399,     14402,
-    14404,     14407,     14409,     14412,     14414,     14417,     14419,     14422,
-    14424,     14427,     14429,     14432,     14435,     14437,     14440,     14442,
-    14445,     14447,     14450,     14452,     14455,     14457,     14460,     14462,
-    14465,     14467,     14470,     14472,     14475,     14478,     14480,     14483,
-    14485,     14488,     14490,     14493,     14495,     14498,     14500,     14503,
-    14505,     14508,     14510,     14513,     14515,     14518,     14520,     14523,
-    14526,     14528,     14531,     14533,     14536,     14538,     14541,     14543,
-    14546,     14548,     14551,     14553,     14556,     14558,     14561,     14563,
-    14566,     14568,     14571,     14573,     14576,     14578,     14581,     14584,
-    14586,     14589,     14591,     14594,     14596,     14599,     14601,     14604,
-    14606,     14609,     14611,     14614,     14616,     14619,     14621,     14624,
-    14626,     14629,     14631,     14634,     14636,     14639,     14641,     14644,
-    14646,     14649,     14651,     14654,     14656,     14659,     14662,     14664,
-    14667,     14669,     14672,     14674,     14677,     14679,     14682,     14684,
-    14687,     14689,     14692,     14694,     14697,     14699,     14702,     14704,
-    14707,     14709,     14712,     14714,     14717,     14719,     14722,     14724,
-    14727,     14729,     14732,     14734,     14737,     14739,     14742,     14744,
-    14747,     14749,     14752,     14754,     14757,     14759,     14762,     14764,
-    14767,     14769,     14772,     14774,     14777,     14779,     14782,     14784,
-    14787,     14789,     14792,     14794,     14797,     14799,     14802,     14804,
-    14807,     14809,     14812,     14814,     14817,     14819,     14822,     14824,
-    14827,     14829,     14832,     14834,     14837,     14839,     14842,     14844,
-    14847,     14849,     14852,     14854,     14857,     14859,     14862,     14864,
-    14867,     14869,     14872,     14874,     14877,     14879,     14882,     14884,
-    14887,     14889,     14892,     14894,     14897,     14899,     14902,     14904,
-    14907,     14909,     14912,     14914,     14917,     14919,     14922,     14924,
-    14927,     14929,     14932,     14934,     14937,     14939,     14942,     14944,
-    14947,     14949,     14952,     14954,     14956,     14959,     14961,     14964,
-    14966,     14969,     14971,     14974,     14976,     14979,     14981,     14984,
-    14986,     14989,     14991,     14994,     14996,     14999,     15001,     15004,
-    15006,     15009,     15011,     15014,     15016,     15019,     15021,     15024,
-    15026,     15029,     15031,     15033,     15036,     15038,     15041,     15043,
-    15046,     15048,     15051,     15053,     15056,     15058,     15061,     15063,
-    15066,     15068,     15071,     15073,     15076,     15078,     15081,     15083,
-    15086,     15088,     15090,     15093,     15095,     15098,     15100,     15103,
-    15105,     15108,     15110,     15113,     15115,     15118,     15120,     15123,
-    15125,     15128,     15130,     15133,     15135,     15137,     15140,     15142,
-    15145,     15147,     15150,     15152,     15155,     15157,     15160,     15162,
-    15165,     15167,     15170,     15172,     15174,     15177,     15179,     15182,
-    15184,     15187,     15189,     15192,     15194,     15197,     15199,     15202,
-    15204,     15207,     15209,     15211,     15214,     15216,     15219,     15221,
-    15224,     15226,     15229,     15231,     15234,     15236,     15239,     15241,
-    15243,     15246,     15248,     15251,     15253,     15256,     15258,     15261,
-    15263,     15266,     15268,     15271,     15273,     15275,     15278,     15280,
-    15283,     15285,     15288,     15290,     15293,     15295,     15298,     15300,
-    15303,     15305,     15307,     15310,     15312,     15315,     15317,     15320,
-    15322,     15325,     15327,     15330,     15332,     15334,     15337,     15339,
-    15342,     15344,     15347,     15349,     15352,     15354,     15357,     15359,
-    15361,     15364,     15366,     15369,     15371,     15374,     15376,     15379,
-    15381,     15383,     15386,     15388,     15391,     15393,     15396,     15398,
-    15401,     15403,     15405,     15408,     15410,     15413,     15415,     15418,
-    15420,     15423,     15425,     15428,     15430,     15432,     15435,     15437,
-    15440,     15442,     15445,     15447,     15449,     15452,     15454,     15457,
-    15459,     15462,     15464,     15467,     15469,     15471,     15474,     15476,
-    15479,     15481,     15484,     15486,     15489,     15491,     15493,     15496,
-    15498,     15501,     15503,     15506,     15508,     15511,     15513,     15515,
-    15518,     15520,     15523,     15525,     15528,     15530,     15532,     15535,
-    15537,     15540,     15542,     15545,     15547,     15549,     15552,     15554,
-    15557,     15559,     15562,     15564,     15567,     15569,     15571,     15574,
-    15576,     15579,     15581,     15584,     15586,     15588,     15591,     15593,
-    15596,     15598,     15601,     15603,     15605,     15608,     15610,     15613,
-    15615,     15618,     15620,     15622,     15625,     15627,     15630,     15632,
-    15635,     15637,     15639,     15642,     15644,     15647,     15649,     15652,
-    15654,     15656,     15659,     15661,     15664,     15666,     15668,     15671,
-    15673,     15676,     15678,     15681,     15683,     15685,     15688,     15690,
-    15693,     15695,     15698,     15700,     15702,     15705,     15707,     15710,
-    15712,     15714,     15717,     15719,     15722,     15724,     15727,     15729,
-    15731,     15734,     15736,     15739,     15741,     15743,     15746,     15748,
-    15751,     15753,     15756,     15758,     15760,     15763,     15765,     15768,
-    15770,     15772,     15775,     15777,     15780,     15782,     15785,     15787,
-    15789,     15792,     15794,     15797,     15799,     15801,     15804,     15806,
-    15809,     15811,     15813,     15816,     15818,     15821,     15823,     15826,
-    15828,     15830,     15833,     15835,     15838,     15840,     15842,     15845,
-    15847,     15850,     15852,     15854,     15857,     15859,     15862,     15864,
-    15866,     15869,     15871,     15874,     15876,     15878,     15881,     15883,
-    15886,     15888,     15890,     15893,     15895,     15898,     15900,     15902,
-    15905,     15907,     15910,     15912,     15914,     15917,     15919,     15922,
-    15924,     15926,     15929,     15931,     15934,     15936,     15938,     15941,
-    15943,     15946,     15948,     15950,     15953,     15955,     15958,     15960,
-    15962,     15965,     15967,     15970,     15972,     15974,     15977,     15979,
-    15982,     15984,     15986,     15989,     15991,     15994,     15996,     15998,
-    16001,     16003,     16006,     16008,     16010,     16013,     16015,     16018,
-    16020,     16022,     16025,     16027,     16029,     16032,     16034,     16037,
-    16039,     16041,     16044,     16046,     16049,     16051,     16053,     16056,
-    16058,     16061,     16063,     16065,     16068,     16070,     16072,     16075,
-    16077,     16080,     16082,     16084,     16087,     16089,     16092,     16094,
-    16096,     16099,     16101,     16103,     16106,     16108,     16111,     16113,
-    16115,     16118,     16120,     16122,     16125,     16127,     16130,     16132,
-    16134,     16137,     16139,     16142,     16144,     16146,     16149,     16151,
-    16153,     16156,     16158,     16161,     16163,     16165,     16168,     16170,
-    16172,     16175,     16177,     16180,     16182,     16184,     16187,     16189,
-    16191,     16194,     16196,     16199,     16201,     16203,     16206,     16208,
-    16210,     16213,     16215,     16218,     16220,     16222,     16225,     16227,
-    16229,     16232,     16234,     16237,     16239,     16241,     16244,     16246,
-    16248,     16251,     16253,     16255,     16258,     16260,     16263,     16265,
-    16267,     16270,     16272,     16274,     16277,     16279,     16282,     16284,
-    16286,     16289,     16291,     16293,     16296,     16298,     16300,     16303,
-    16305,     16308,     16310,     16312,     16315,     16317,     16319,     16322,
-    16324,     16326,     16329,     16331,     16333,     16336,     16338,     16341,
-    16343,     16345,     16348,     16350,     16352,     16355,     16357,     16359,
-    16362,     16364,     16367,     16369,     16371,     16374,     16376,     16378,
-    16381,     16383,     16385,     16388,     16390,     16392,     16395,     16397,
-    16400,     16402,     16404,     16407,     16409,     16411,     16414,     16416,
-    16418,     16421,     16423,     16425,     16428,     16430,     16432,     16435,
-    16437,     16440,     16442,     16444,     16447,     16449,     16451,     16454,
-    16456,     16458,     16461,     16463,     16465,     16468,     16470,     16472,
-    16475,     16477,     16479,     16482,     16484,     16486,     16489,     16491,
-    16494,     16496,     16498,     16501,     16503,     16505,     16508,     16510,
-    16512,     16515,     16517,     16519,     16522,     16524,     16526,     16529,
-    16531,     16533,     16536,     16538,     16540,     16543,     16545,     16547,
-    16550,     16552,     16554,     16557,     16559,     16561,     16564,     16566,
-    16568,     16571,     16573,     16575,     16578,     16580,     16582,     16585,
-    16587,     16589,     16592,     16594,     16596,     16599,     16601,     16604,
-    16606,     16608,     16611,     16613,     16615,     16618,     16620,     16622,
-    16625,     16627,     16629,     16632,     16634,     16636,     16639,     16641,
-    16643,     16645,     16648,     16650,     16652,     16655,     16657,     16659,
-    16662,     16664,     16666,     16669,     16671,     16673,     16676,     16678,
-    16680,     16683,     16685,     16687,     16690,     16692,     16694,     16697,
-    16699,     16701,     16704,     16706,     16708,     16711,     16713,     16715,
-    16718,     16720,     16722,     16725,     16727,     16729,     16732,     16734,
-    16736,     16739,     16741,     16743,     16746,     16748,     16750,     16752,
-    16755,     16757,     16759,     16762,     16764,     16766,     16769,     16771,
-    16773,     16776,     16778,     16780,     16783,     16785,     16787,     16790,
-    16792,     16794,     16797,     16799,     16801,     16803,     16806,     16808,
-    16810,     16813,     16815,     16817,     16820,     16822,     16824,     16827,
-    16829,     16831,     16834,     16836,     16838,     16840,     16843,     16845,
-    16847,     16850,     16852,     16854,     16857,     16859,     16861,     16864,
-    16866,     16868,     16871,     16873,     16875,     16877,     16880,     16882,
-    16884,     16887,     16889,     16891,     16894,     16896,     16898,     16901,
-    16903,     16905,     16907,     16910,     16912,     16914,     16917,     16919,
-    16921,     16924,     16926,     16928,     16930,     16933,     16935,     16937,
-    16940,     16942,     16944,     16947,     16949,     16951,     16953,     16956,
-    16958,     16960,     16963,     16965,     16967,     16970,     16972,     16974,
-    16976,     16979,     16981,     16983,     16986,     16988,     16990,     16993,
-    16995,     16997,     16999,     17002,     17004,     17006,     17009,     17011,
-    17013,     17016,     17018,     17020,     17022,     17025,     17027,     17029,
-    17032,     17034,     17036,     17038,     17041,     17043,     17045,     17048,
-    17050,     17052,     17054,     17057,     17059,     17061,     17064,     17066,
-    17068,     17071,     17073,     17075,     17077,     17080,     17082,     17084,
-    17087,     17089,     17091,     17093,     17096,     17098,     17100,     17103,
-    17105,     17107,     17109,     17112,     17114,     17116,     17119,     17121,
-    17123,     17125,     17128,     17130,     17132,     17135,     17137,     17139,
-    17141,     17144,     17146,     17148,     17150,     17153,     17155,     17157,
-    17160,     17162,     17164,     17166,     17169,     17171,     17173,     17176,
-    17178,     17180,     17182,     17185,     17187,     17189,     17191,     17194,
-    17196,     17198,     17201,     17203,     17205,     17207,     17210,     17212,
-    17214,     17217,     17219,     17221,     17223,     17226,     17228,     17230,
-    17232,     17235,     17237,     17239,     17242,     17244,     17246,     17248,
-    17251,     17253,     17255,     17257,     17260,     17262,     17264,     17267,
-    17269,     17271,     17273,     17276,     17278,     17280,     17282,     17285,
-    17287,     17289,     17291,     17294,     17296,     17298,     17301,     17303,
-    17305,     17307,     17310,     17312,     17314,     17316,     17319,     17321,
-    17323,     17325,     17328,     17330,     17332,     17334,     17337,     17339,
-    17341,     17344,     17346,     17348,     17350,     17353,     17355,     17357,
-    17359,     17362,     17364,     17366,     17368,     17371,     17373,     17375,
-    17377,     17380,     17382,     17384,     17386,     17389,     17391,     17393,
-    17395,     17398,     17400,     17402,     17405,     17407,     17409,     17411,
-    17414,     17416,     17418,     17420,     17423,     17425,     17427,     17429,
-    17432,     17434,     17436,     17438,     17441,     17443,     17445,     17447,
-    17450,     17452,     17454,     17456,     17459,     17461,     17463,     17465,
-    17468,     17470,     17472,     17474,     17477,     17479,     17481,     17483,
-    17486,     17488,     17490,     17492,     17495,     17497,     17499,     17501,
-    17504,     17506,     17508,     17510,     17512,     17515,     17517,     17519,
-    17521,     17524,     17526,     17528,     17530,     17533,     17535,     17537,
-    17539,     17542,     17544,     17546,     17548,     17551,     17553,     17555,
-    17557,     17560,     17562,     17564,     17566,     17569,     17571,     17573,
-    17575,     17577,     17580,     17582,     17584,     17586,     17589,     17591,
-    17593,     17595,     17598,     17600,     17602,     17604,     17607,     17609,
-    17611,     17613,     17615,     17618,     17620,     17622,     17624,     17627,
-    17629,     17631,     17633,     17636,     17638,     17640,     17642,     17644,
-    17647,     17649,     17651,     17653,     17656,     17658,     17660,     17662,
-    17665,     17667,     17669,     17671,     17673,     17676,     17678,     17680,
-    17682,     17685,     17687,     17689,     17691,     17694,     17696,     17698,
-    17700,     17702,     17705,     17707,     17709,     17711,     17714,     17716,
-    17718,     17720,     17722,     17725,     17727,     17729,     17731,     17734,
-    17736,     17738,     17740,     17742,     17745,     17747,     17749,     17751,
-    17754,     17756,     17758,     17760,     17762,     17765,     17767,     17769,
-    17771,     17773,     17776,     17778,     17780,     17782,     17785,     17787,
-    17789,     17791,     17793,     17796,     17798,     17800,     17802,     17804,
-    17807,     17809,     17811,     17813,     17816,     17818,     17820,     17822,
-    17824,     17827,     17829,     17831,     17833,     17835,     17838,     17840,
-    17842,     17844,     17847,     17849,     17851,     17853,     17855,     17858,
-    17860,     17862,     17864,     17866,     17869,     17871,     17873,     17875,
-    17877,     17880,     17882,     17884,     17886,     17888,     17891,     17893,
-    17895,     17897,     17899,     17902,     17904,     17906,     17908,     17910,
-    17913,     17915,     17917,     17919,     17922,     17924,     17926,     17928,
-    17930,     17933,     17935,     17937,     17939,     17941,     17944,     17946,
-    17948,     17950,     17952,     17955,     17957,     17959,     17961,     17963,
-    17965,     17968,     17970,     17972,     17974,     17976,     17979,     17981,
-    17983,     17985,     17987,     17990,     17992,     17994,     17996,     17998,
-    18001,     18003,     18005,     18007,     18009,     18012,     18014,     18016,
-    18018,     18020,     18023,     18025,     18027,     18029,     18031,     18033,
-    18036,     18038,     18040,     18042,     18044,     18047,     18049,     18051,
-    18053,     18055,     18058,     18060,     18062,     18064,     18066,     18069,
-    18071,     18073,     18075,     18077,     18079,     18082,     18084,     18086,
-    18088,     18090,     18093,     18095,     18097,     18099,     18101,     18103,
-    18106,     18108,     18110,     18112,     18114,     18117,     18119,     18121,
-    18123,     18125,     18127,     18130,     18132,     18134,     18136,     18138,
-    18141,     18143,     18145,     18147,     18149,     18151,     18154,     18156,
-    18158,     18160,     18162,     18164,     18167,     18169,     18171,     18173,
-    18175,     18178,     18180,     18182,     18184,     18186,     18188,     18191,
-    18193,     18195,     18197,     18199,     18201,     18204,     18206,     18208,
-    18210,     18212,     18214,     18217,     18219,     18221,     18223,     18225,
-    18227,     18230,     18232,     18234,     18236,     18238,     18240,     18243,
-    18245,     18247,     18249,     18251,     18254,     18256,     18258,     18260,
-    18262,     18264,     18266,     18269,     18271,     18273,     18275,     18277,
-    18279,     18282,     18284,     18286,     18288,     18290,     18292,     18295,
-    18297,     18299,     18301,     18303,     18305,     18308,     18310,     18312,
-    18314,     18316,     18318,     18321,     18323,     18325,     18327,     18329,
-    18331,     18334,     18336,     18338,     18340,     18342,     18344,     18346,
-    18349,     18351,     18353,     18355,     18357,     18359,     18362,     18364,
-    18366,     18368,     18370,     18372,     18374,     18377,     18379,     18381,
-    18383,     18385,     18387,     18390,     18392,     18394,     18396,     18398,
-    18400,     18402,     18405,     18407,     18409,     18411,     18413,     18415,
-    18417,     18420,     18422,     18424,     18426,     18428,     18430,     18433,
-    18435,     18437,     18439,     18441,     18443,     18445,     18448,     18450,
-    18452,     18454,     18456,     18458,     18460,     18463,     18465,     18467,
-    18469,     18471,     18473,     18475,     18478,     18480,     18482,     18484,
-    18486,     18488,     18490,     18493,     18495,     18497,     18499,     18501,
-    18503,     18505,     18508,     18510,     18512,     18514,     18516,     18518,
-    18520,     18523,     18525,     18527,     18529,     18531,     18533,     18535,
-    18537,     18540,     18542,     18544,     18546,     18548,     18550,     18552,
-    18555,     18557,     18559,     18561,     18563,     18565,     18567,     18569,
-    18572,     18574,     18576,     18578,     18580,     18582,     18584,     18587,
-    18589,     18591,     18593,     18595,     18597,     18599,     18601,     18604,
-    18606,     18608,     18610,     18612,     18614,     18616,     18618,     18621,
-    18623,     18625,     18627,     18629,     18631,     18633,     18635,     18638,
-    18640,     18642,     18644,     18646,     18648,     18650,     18652,     18655,
-    18657,     18659,     18661,     18663,     18665,     18667,     18669,     18672,
-    18674,     18676,     18678,     18680,     18682,     18684,     18686,     18689,
-    18691,     18693,     18695,     18697,     18699,     18701,     18703,     18705,
-    18708,     18710,     18712,     18714,     18716,     18718,     18720,     18722,
-    18725,     18727,     18729,     18731,     18733,     18735,     18737,     18739,
-    18741,     18744,     18746,     18748,     18750,     18752,     18754,     18756,
-    18758,     18760,     18763,     18765,     18767,     18769,     18771,     18773,
-    18775,     18777,     18779,     18782,     18784,     18786,     18788,     18790,
-    18792,     18794,     18796,     18798,     18801,     18803,     18805,     18807,
-    18809,     18811,     18813,     18815,     18817,     18820,     18822,     18824,
-    18826,     18828,     18830,     18832,     18834,     18836,     18838,     18841,
-    18843,     18845,     18847,     18849,     18851,     18853,     18855,     18857,
-    18859,     18862,     18864,     18866,     18868,     18870,     18872,     18874,
-    18876,     18878,     18880,     18883,     18885,     18887,     18889,     18891,
-    18893,     18895,     18897,     18899,     18901,     18904,     18906,     18908,
-    18910,     18912,     18914,     18916,     18918,     18920,     18922,     18924,
-    18927,     18929,     18931,     18933,     18935,     18937,     18939,     18941,
-    18943,     18945,     18948,     18950,     18952,     18954,     18956,     18958,
-    18960,     18962,     18964,     18966,     18968,     18970,     18973,     18975,
-    18977,     18979,     18981,     18983,     18985,     18987,     18989,     18991,
-    18993,     18996,     18998,     19000,     19002,     19004,     19006,     19008,
-    19010,     19012,     19014,     19016,     19018,     19021,     19023,     19025,
-    19027,     19029,     19031,     19033,     19035,     19037,     19039,     19041,
-    19043,     19046,     19048,     19050,     19052,     19054,     19056,     19058,
-    19060,     19062,     19064,     19066,     19068,     19070,     19073,     19075,
-    19077,     19079,     19081,     19083,     19085,     19087,     19089,     19091,
-    19093,     19095,     19097,     19100,     19102,     19104,     19106,     19108,
-    19110,     19112,     19114,     19116,     19118,     19120,     19122,     19124,
-    19126,     19129,     19131,     19133,     19135,     19137,     19139,     19141,
-    19143,     19145,     19147,     19149,     19151,     19153,     19155,     19158,
-    19160,     19162,     19164,     19166,     19168,     19170,     19172,     19174,
-    19176,     19178,     19180,     19182,     19184,     19186,     19189,     19191,
-    19193,     19195,     19197,     19199,     19201,     19203,     19205,     19207,
-    19209,     19211,     19213,     19215,     19217,     19219,     19222,     19224,
-    19226,     19228,     19230,     19232,     19234,     19236,     19238,     19240,
-    19242,     19244,     19246,     19248,     19250,     19252,     19254,     19256,
-    19259,     19261,     19263,     19265,     19267,     19269,     19271,     19273,
-    19275,     19277,     19279,     19281,     19283,     19285,     19287,     19289,
-    19291,     19293,     19296,     19298,     19300,     19302,     19304,     19306,
-    19308,     19310,     19312,     19314,     19316,     19318,     19320,     19322,
-    19324,     19326,     19328,     19330,     19332,     19334,     19337,     19339,
-    19341,     19343,     19345,     19347,     19349,     19351,     19353,     19355,
-    19357,     19359,     19361,     19363,     19365,     19367,     19369,     19371,
-    19373,     19375,     19377,     19379,     19382,     19384,     19386,     19388,
-    19390,     19392,     19394,     19396,     19398,     19400,     19402,     19404,
-    19406,     19408,     19410,     19412,     19414,     19416,     19418,     19420,
-    19422,     19424,     19426,     19428,     19430,     19432,     19435,     19437,
-    19439,     19441,     19443,     19445,     19447,     19449,     19451,     19453,
-    19455,     19457,     19459,     19461,     19463,     19465,     19467,     19469,
-    19471,     19473,     19475,     19477,     19479,     19481,     19483,     19485,
-    19487,     19489,     19491,     19493,     19496,     19498,     19500,     19502,
-    19504,     19506,     19508,     19510,     19512,     19514,     19516,     19518,
-    19520,     19522,     19524,     19526,     19528,     19530,     19532,     19534,
-    19536,     19538,     19540,     19542,     19544,     19546,     19548,     19550,
-    19552,     19554,     19556,     19558,     19560,     19562,     19564,     19566,
-    19568,     19570,     19572,     19574,     19577,     19579,     19581,     19583,
-    19585,     19587,     19589,     19591,     19593,     19595,     19597,     19599,
-    19601,     19603,     19605,     19607,     19609,     19611,     19613,     19615,
-    19617,     19619,     19621,     19623,     19625,     19627,     19629,     19631,
-    19633,     19635,     19637,     19639,     19641,     19643,     19645,     19647,
-    19649,     19651,     19653,     19655,     19657,     19659,     19661,     19663,
-    19665,     19667,     19669,     19671,     19673,     19675,     19677,     19679,
-    19681,     19683,     19685,     19687,     19689,     19691,     19693,     19695,
-    19697,     19699,     19701,     19703,     19705,     19707,     19709,     19711,
-    19713,     19715,     19717,     19719,     19721,     19723,     19725,     19727,
-    19729,     19731,     19733,     19735,     19737,     19739,     19741,     19743,
-    19745,     19747,     19749,     19751,     19753,     19755,     19757,     19759,
-    19761,     19763,     19765,     19767,     19769,     19771,     19773,     19775,
-    19777,     19779,     19781,     19783,     19785,     19787,     19789,     19791,
-    19793,     19795,     19797,     19799,     19801,     19803,     19805,     19807,
-    19809,     19811,     19813,     19815,     19817,     19819,     19821,     19823,
-    19825,     19827,     19829,     19831,     19833,     19835,     19837,     19839,
-    19841,     19843,     19845,     19847,     19849,     19851,     19853,     19855,
-    19857,     19859,     19861,     19863,     19865,     19867,     19869,     19871,
-    19873,     19875,     19877,     19879,     19881,     19883,     19885,     19887,
-    19889,     19891,     19893,     19895,     19897,     19899,     19901,     19903,
-    19905,     19907,     19909,     19911,     19913,     19915,     19917,     19919,
-    19921,     19923,     19925,     19926,     19928,     19930,     19932,     19934,
-    19936,     19938,     19940,     19942,     19944,     19946,     19948,     19950,
-    19952,     19954,     19956,     19958,     19960,     19962,     19964,     19966,
-    19968,     19970,     19972,     19974,     19976,     19978,     19980,     19982,
-    19984,     19986,     19988,     19990,     19992,     19994,     19996,     19998,
-    20000,     20002,     20004,     20006,     20007,     20009,     20011,     20013,
-    20015,     20017,     20019,     20021,     20023,     20025,     20027,     20029,
-    20031,     20033,     20035,     20037,     20039,     20041,     20043,     20045,
-    20047,     20049,     20051,     20053,     20055,     20057,     20059,     20061,
-    20063,     20065,     20066,     20068,     20070,     20072,     20074,     20076,
-    20078,     20080,     20082,     20084,     20086,     20088,     20090,     20092,
-    20094,     20096,     20098,     20100,     20102,     20104,     20106,     20108,
-    20110,     20112,     20114,     20115,     20117,     20119,     20121,     20123,
-    20125,     20127,     20129,     20131,     20133,     20135,     20137,     20139,
-    20141,     20143,     20145,     20147,     20149,     20151,     20153,     20155,
-    20157,     20158,     20160,     20162,     20164,     20166,     20168,     20170,
-    20172,     20174,     20176,     20178,     20180,     20182,     20184,     20186,
-    20188,     20190,     20192,     20194,     20196,     20197,     20199,     20201,
-    20203,     20205,     20207,     20209,     20211,     20213,     20215,     20217,
-    20219,     20221,     20223,     20225,     20227,     20229,     20231,     20233,
-    20234,     20236,     20238,     20240,     20242,     20244,     20246,     20248,
-    20250,     20252,     20254,     20256,     20258,     20260,     20262,     20264,
-    20266,     20267,     20269,     20271,     20273,     20275,     20277,     20279,
-    20281,     20283,     20285,     20287,     20289,     20291,     20293,     20295,
-    20297,     20298,     20300,     20302,     20304,     20306,     20308,     20310,
-    20312,     20314,     20316,     20318,     20320,     20322,     20324,     20326,
-    20327,     20329,     20331,     20333,     20335,     20337,     20339,     20341,
-    20343,     20345,     20347,     20349,     20351,     20353,     20355,     20356,
-    20358,     20360,     20362,     20364,     20366,     20368,     20370,     20372,
-    20374,     20376,     20378,     20380,     20382,     20383,     20385,     20387,
-    20389,     20391,     20393,     20395,     20397,     20399,     20401,     20403,
-    20405,     20407,     20408,     20410,     20412,     20414,     20416,     20418,
-    20420,     20422,     20424,     20426,     20428,     20430,     20432,     20433,
-    20435,     20437,     20439,     20441,     20443,     20445,     20447,     20449,
-    20451,     20453,     20455,     20456,     20458,     20460,     20462,     20464,
-    20466,     20468,     20470,     20472,     20474,     20476,     20478,     20479,
-    20481,     20483,     20485,     20487,     20489,     20491,     20493,     20495,
-    20497,     20499,     20500,     20502,     20504,     20506,     20508,     20510,
-    20512,     20514,     20516,     20518,     20520,     20521,     20523,     20525,
-    20527,     20529,     20531,     20533,     20535,     20537,     20539,     20541,
-    20542,     20544,     20546,     20548,     20550,     20552,     20554,     20556,
-    20558,     20560,     20562,     20563,     20565,     20567,     20569,     20571,
-    20573,     20575,     20577,     20579,     20581,     20582,     20584,     20586,
-    20588,     20590,     20592,     20594,     20596,     20598,     20600,     20601,
-    20603,     20605,     20607,     20609,     20611,     20613,     20615,     20617,
-    20619,     20620,     20622,     20624,     20626,     20628,     20630,     20632,
-    20634,     20636,     20638,     20639,     20641,     20643,     20645,     20647,
-    20649,     20651,     20653,     20655,     20656,     20658,     20660,     20662,
-    20664,     20666,     20668,     20670,     20672,     20674,     20675,     20677,
-    20679,     20681,     20683,     20685,     20687,     20689,     20691,     20692,
-    20694,     20696,     20698,     20700,     20702,     20704,     20706,     20708,
-    20709,     20711,     20713,     20715,     20717,     20719,     20721,     20723,
-    20724,     20726,     20728,     20730,     20732,     20734,     20736,     20738,
-    20740,     20741,     20743,     20745,     20747,     20749,     20751,     20753,
-    20755,     20756,     20758,     20760,     20762,     20764,     20766,     20768,
-    20770,     20772,     20773,     20775,     20777,     20779,     20781,     20783,
-    20785,     20787,     20788,     20790,     20792,     20794,     20796,     20798,
-    20800,     20802,     20803,     20805,     20807,     20809,     20811,     20813,
-    20815,     20817,     20818,     20820,     20822,     20824,     20826,     20828,
-    20830,     20832,     20833,     20835,     20837,     20839,     20841,     20843,
-    20845,     20847,     20848,     20850,     20852,     20854,     20856,     20858,
-    20860,     20861,     20863,     20865,     20867,     20869,     20871,     20873,
-    20875,     20876,     20878,     20880,     20882,     20884,     20886,     20888,
-    20889,     20891,     20893,     20895,     20897,     20899,     20901,     20903,
-    20904,     20906,     20908,     20910,     20912,     20914,     20916,     20917,
-    20919,     20921,     20923,     20925,     20927,     20929,     20930,     20932,
-    20934,     20936,     20938,     20940,     20942,     20943,     20945,     20947,
-    20949,     20951,     20953,     20955,     20956,     20958,     20960,     20962,
-    20964,     20966,     20968,     20969,     20971,     20973,     20975,     20977,
-    20979,     20981,     20982,     20984,     20986,     20988,     20990,     20992,
-    20994,     20995,     20997,     20999,     21001,     21003,     21005,     21006,
-    21008,     21010,     21012,     21014,     21016,     21018,     21019,     21021,
-    21023,     21025,     21027,     21029,     21031,     21032,     21034,     21036,
-    21038,     21040,     21042,     21043,     21045,     21047,     21049,     21051,
-    21053,     21055,     21056,     21058,     21060,     21062,     21064,     21066,
-    21067,     21069,     21071,     21073,     21075,     21077,     21078,     21080,
-    21082,     21084,     21086,     21088,     21090,     21091,     21093,     21095,
-    21097,     21099,     21101,     21102,     21104,     21106,     21108,     21110,
-    21112,     21113,     21115,     21117,     21119,     21121,     21123,     21124,
-    21126,     21128,     21130,     21132,     21134,     21135,     21137,     21139,
-    21141,     21143,     21145,     21146,     21148,     21150,     21152,     21154,
-    21156,     21157,     21159,     21161,     21163,     21165,     21167,     21168,
-    21170,     21172,     21174,     21176,     21178,     21179,     21181,     21183,
-    21185,     21187,     21189,     21190,     21192,     21194,     21196,     21198,
-    21200,     21201,     21203,     21205,     21207,     21209,     21210,     21212,
-    21214,     21216,     21218,     21220,     21221,     21223,     21225,     21227,
-    21229,     21231,     21232,     21234,     21236,     21238,     21240,     21241,
-    21243,     21245,     21247,     21249,     21251,     21252,     21254,     21256,
-    21258,     21260,     21261,     21263,     21265,     21267,     21269,     21271,
-    21272,     21274,     21276,     21278,     21280,     21281,     21283,     21285,
-    21287,     21289,     21291,     21292,     21294,     21296,     21298,     21300,
-    21301,     21303,     21305,     21307,     21309,     21311,     21312,     21314,
-    21316,     21318,     21320,     21321,     21323,     21325,     21327,     21329,
-    21330,     21332,     21334,     21336,     21338,     21339,     21341,     21343,
-    21345,     21347,     21349,     21350,     21352,     21354,     21356,     21358,
-    21359,     21361,     21363,     21365,     21367,     21368,     21370,     21372,
-    21374,     21376,     21377,     21379,     21381,     21383,     21385,     21386,
-    21388,     21390,     21392,     21394,     21395,     21397,     21399,     21401,
-    21403,     21404,     21406,     21408,     21410,     21412,     21413,     21415,
-    21417,     21419,     21421,     21422,     21424,     21426,     21428,     21430,
-    21431,     21433,     21435,     21437,     21439,     21440,     21442,     21444,
-    21446,     21448,     21449,     21451,     21453,     21455,     21457,     21458,
-    21460,     21462,     21464,     21466,     21467,     21469,     21471,     21473,
-    21475,     21476,     21478,     21480,     21482,     21483,     21485,     21487,
-    21489,     21491,     21492,     21494,     21496,     21498,     21500,     21501,
-    21503,     21505,     21507,     21509,     21510,     21512,     21514,     21516,
-    21517,     21519,     21521,     21523,     21525,     21526,     21528,     21530,
-    21532,     21534,     21535,     21537,     21539,     21541,     21542,     21544,
-    21546,     21548,     21550,     21551,     21553,     21555,     21557,     21559,
-    21560,     21562,     21564,     21566,     21567,     21569,     21571,     21573,
-    21575,     21576,     21578,     21580,     21582,     21583,     21585,     21587,
-    21589,     21591,     21592,     21594,     21596,     21598,     21599,     21601,
-    21603,     21605,     21607,     21608,     21610,     21612,     21614,     21615,
-    21617,     21619,     21621,     21622,     21624,     21626,     21628,     21630,
-    21631,     21633,     21635,     21637,     21638,     21640,     21642,     21644,
-    21646,     21647,     21649,     21651,     21653,     21654,     21656,     21658,
-    21660,     21661,     21663,     21665,     21667,     21669,     21670,     21672,
-    21674,     21676,     21677,     21679,     21681,     21683,     21684,     21686,
-    21688,     21690,     21691,     21693,     21695,     21697,     21699,     21700,
-    21702,     21704,     21706,     21707,     21709,     21711,     21713,     21714,
-    21716,     21718,     21720,     21721,     21723,     21725,     21727,     21729,
-    21730,     21732,     21734,     21736,     21737,     21739,     21741,     21743,
-    21744,     21746,     21748,     21750,     21751,     21753,     21755,     21757,
-    21758,     21760,     21762,     21764,     21765,     21767,     21769,     21771,
-    21772,     21774,     21776,     21778,     21779,     21781,     21783,     21785,
-    21786,     21788,     21790,     21792,     21793,     21795,     21797,     21799,
-    21800,     21802,     21804,     21806,     21807,     21809,     21811,     21813,
-    21814,     21816,     21818,     21820,     21821,     21823,     21825,     21827,
-    21828,     21830,     21832,     21834,     21835,     21837,     21839,     21841,
-    21842,     21844,     21846,     21848,     21849,     21851,     21853,     21855,
-    21856,     21858,     21860,     21862,     21863,     21865,     21867,     21869,
-    21870,     21872,     21874,     21876,     21877,     21879,     21881,     21883,
-    21884,     21886,     21888,     21889,     21891,     21893,     21895,     21896,
-    21898,     21900,     21902,     21903,     21905,     21907,     21909,     21910,
-    21912,     21914,     21916,     21917,     21919,     21921,     21922,     21924,
-    21926,     21928,     21929,     21931,     21933,     21935,     21936,     21938,
-    21940,     21942,     21943,     21945,     21947,     21949,     21950,     21952,
-    21954,     21955,     21957,     21959,     21961,     21962,     21964,     21966,
-    21968,     21969,     21971,     21973,     21974,     21976,     21978,     21980,
-    21981,     21983,     21985,     21987,     21988,     21990,     21992,     21993,
-    21995,     21997,     21999,     22000,     22002,     22004,     22006,     22007,
-    22009,     22011,     22012,     22014,     22016,     22018,     22019,     22021,
-    22023,     22024,     22026,     22028,     22030,     22031,     22033,     22035,
-    22037,     22038,     22040,     22042,     22043,     22045,     22047,     22049,
-    22050,     22052,     22054,     22055,     22057,     22059,     22061,     22062,
-    22064,     22066,     22067,     22069,     22071,     22073,     22074,     22076,
-    22078,     22079,     22081,     22083,     22085,     22086,     22088,     22090,
-    22091,     22093,     22095,     22097,     22098,     22100,     22102,     22103,
-    22105,     22107,     22109,     22110,     22112,     22114,     22115,     22117,
-    22119,     22121,     22122,     22124,     22126,     22127,     22129,     22131,
-    22133,     22134,     22136,     22138,     22139,     22141,     22143,     22144,
-    22146,     22148,     22150,     22151,     22153,     22155,     22156,     22158,
-    22160,     22162,     22163,     22165,     22167,     22168,     22170,     22172,
-    22173,     22175,     22177,     22179,     22180,     22182,     22184,     22185,
-    22187,     22189,     22190,     22192,     22194,     22196,     22197,     22199,
-    22201,     22202,     22204,     22206,     22207,     22209,     22211,     22213,
-    22214,     22216,     22218,     22219,     22221,     22223,     22224,     22226,
-    22228,     22230,     22231,     22233,     22235,     22236,     22238,     22240,
-    22241,     22243,     22245,     22246,     22248,     22250,     22252,     22253,
-    22255,     22257,     22258,     22260,     22262,     22263,     22265,     22267,
-    22268,     22270,     22272,     22274,     22275,     22277,     22279,     22280,
-    22282,     22284,     22285,     22287,     22289,     22290,     22292,     22294,
-    22296,     22297,     22299,     22301,     22302,     22304,     22306,     22307,
-    22309,     22311,     22312,     22314,     22316,     22317,     22319,     22321,
-    22322,     22324,     22326,     22328,     22329,     22331,     22333,     22334,
-    22336,     22338,     22339,     22341,     22343,     22344,     22346,     22348,
-    22349,     22351,     22353,     22354,     22356,     22358,     22359,     22361,
-    22363,     22364,     22366,     22368,     22370,     22371,     22373,     22375,
-    22376,     22378,     22380,     22381,     22383,     22385,     22386,     22388,
-    22390,     22391,     22393,     22395,     22396,     22398,     22400,     22401,
-    22403,     22405,     22406,     22408,     22410,     22411,     22413,     22415,
-    22416,     22418,     22420,     22421,     22423,     22425,     22426,     22428,
-    22430,     22431,     22433,     22435,     22436,     22438,     22440,     22441,
-    22443,     22445,     22446,     22448,     22450,     22451,     22453,     22455,
-    22456,     22458,     22460,     22461,     22463,     22465,     22466,     22468,
-    22470,     22471,     22473,     22475,     22476,     22478,     22480,     22481,
-    22483,     22485,     22486,     22488,     22490,     22491,     22493,     22495,
-    22496,     22498,     22500,     22501,     22503,     22505,     22506,     22508,
-    22510,     22511,     22513,     22515,     22516,     22518,     22520,     22521,
-    22523,     22525,     22526,     22528,     22530,     22531,     22533,     22535,
-    22536,     22538,     22539,     22541,     22543,     22544,     22546,     22548,
-    22549,     22551,     22553,     22554,     22556,     22558,     22559,     22561,
-    22563,     22564,     22566,     22568,     22569,     22571,     22573,     22574,
-    22576,     22577,     22579,     22581,     22582,     22584,     22586,     22587,
-    22589,     22591,     22592,     22594,     22596,     22597,     22599,     22601,
-    22602,     22604,     22606,     22607,     22609,     22610,     22612,     22614,
-    22615,     22617,     22619,     22620,     22622,     22624,     22625,     22627,
-    22629,     22630,     22632,     22633,     22635,     22637,     22638,     22640,
-    22642,     22643,     22645,     22647,     22648,     22650,     22652,     22653,
-    22655,     22656,     22658,     22660,     22661,     22663,     22665,     22666,
-    22668,     22670,     22671,     22673,     22674,     22676,     22678,     22679,
-    22681,     22683,     22684,     22686,     22688,     22689,     22691,     22692,
-    22694,     22696,     22697,     22699,     22701,     22702,     22704,     22706,
-    22707,     22709,     22710,     22712,     22714,     22715,     22717,     22719,
-    22720,     22722,     22723,     22725,     22727,     22728,     22730,     22732,
-    22733,     22735,     22737,     22738,     22740,     22741,     22743,     22745,
-    22746,     22748,     22750,     22751,     22753,     22754,     22756,     22758,
-    22759,     22761,     22763,     22764,     22766,     22767,     22769,     22771,
-    22772,     22774,     22776,     22777,     22779,     22780,     22782,     22784,
-    22785,     22787,     22789,     22790,     22792,     22793,     22795,     22797,
-    22798,     22800,     22801,     22803,     22805,     22806,     22808,     22810,
-    22811,     22813,     22814,     22816,     22818,     22819,     22821,     22823,
-    22824,     22826,     22827,     22829,     22831,     22832,     22834,     22835,
-    22837,     22839,     22840,     22842,     22844,     22845,     22847,     22848,
-    22850,     22852,     22853,     22855,     22856,     22858,     22860,     22861,
-    22863,     22865,     22866,     22868,     22869,     22871,     22873,     22874,
-    22876,     22877,     22879,     22881,     22882,     22884,     22885,     22887,
-    22889,     22890,     22892,     22893,     22895,     22897,     22898,     22900,
-    22902,     22903,     22905,     22906,     22908,     22910,     22911,     22913,
-    22914,     22916,     22918,     22919,     22921,     22922,     22924,     22926,
-    22927,     22929,     22930,     22932,     22934,     22935,     22937,     22938,
-    22940,     22942,     22943,     22945,     22946,     22948,     22950,     22951,
-    22953,     22954,     22956,     22958,     22959,     22961,     22962,     22964,
-    22966,     22967,     22969,     22970,     22972,     22974,     22975,     22977,
-    22978,     22980,     22982,     22983,     22985,     22986,     22988,     22990,
-    22991,     22993,     22994,     22996,     22998,     22999,     23001,     23002,
-    23004,     23006,     23007,     23009,     23010,     23012,     23013,     23015,
-    23017,     23018,     23020,     23021,     23023,     23025,     23026,     23028,
-    23029,     23031,     23033,     23034,     23036,     23037,     23039,     23041,
-    23042,     23044,     23045,     23047,     23048,     23050,     23052,     23053,
-    23055,     23056,     23058,     23060,     23061,     23063,     23064,     23066,
-    23067,     23069,     23071,     23072,     23074,     23075,     23077,     23079,
-    23080,     23082,     23083,     23085,     23086,     23088,     23090,     23091,
-    23093,     23094,     23096,     23098,     23099,     23101,     23102,     23104,
-    23105,     23107,     23109,     23110,     23112,     23113,     23115,     23117,
-    23118,     23120,     23121,     23123,     23124,     23126,     23128,     23129,
-    23131,     23132,     23134,     23135,     23137,     23139,     23140,     23142,
-    23143,     23145,     23146,     23148,     23150,     23151,     23153,     23154,
-    23156,     23157,     23159,     23161,     23162,     23164,     23165,     23167,
-    23168,     23170,     23172,     23173,     23175,     23176,     23178,     23179,
-    23181,     23183,     23184,     23186,     23187,     23189,     23190,     23192,
-    23194,     23195,     23197,     23198,     23200,     23201,     23203,     23205,
-    23206,     23208,     23209,     23211,     23212,     23214,     23215,     23217,
-    23219,     23220,     23222,     23223,     23225,     23226,     23228,     23230,
-    23231,     23233,     23234,     23236,     23237,     23239,     23240,     23242,
-    23244,     23245,     23247,     23248,     23250,     23251,     23253,     23255,
-    23256,     23258,     23259,     23261,     23262,     23264,     23265,     23267,
-    23269,     23270,     23272,     23273,     23275,     23276,     23278,     23279,
-    23281,     23283,     23284,     23286,     23287,     23289,     23290,     23292,
-    23293,     23295,     23297,     23298,     23300,     23301,     23303,     23304,
-    23306,     23307,     23309,     23311,     23312,     23314,     23315,     23317,
-    23318,     23320,     23321,     23323,     23324,     23326,     23328,     23329,
-    23331,     23332,     23334,     23335,     23337,     23338,     23340,     23342,
-    23343,     23345,     23346,     23348,     23349,     23351,     23352,     23354,
-    23355,     23357,     23359,     23360,     23362,     23363,     23365,     23366,
-    23368,     23369,     23371,     23372,     23374,     23376,     23377,     23379,
-    23380,     23382,     23383,     23385,     23386,     23388,     23389,     23391,
-    23392,     23394,     23396,     23397,     23399,     23400,     23402,     23403,
-    23405,     23406,     23408,     23409,     23411,     23412,     23414,     23416,
-    23417,     23419,     23420,     23422,     23423,     23425,     23426,     23428,
-    23429,     23431,     23432,     23434,     23436,     23437,     23439,     23440,
-    23442,     23443,     23445,     23446,     23448,     23449,     23451,     23452,
-    23454,     23455,     23457,     23459,     23460,     23462,     23463,     23465,
-    23466,     23468,     23469,     23471,     23472,     23474,     23475,     23477,
-    23478,     23480,     23481,     23483,     23485,     23486,     23488,     23489,
-    23491,     23492,     23494,     23495,     23497,     23498,     23500,     23501,
-    23503,     23504,     23506,     23507,     23509,     23510,     23512,     23514,
-    23515,     23517,     23518,     23520,     23521,     23523,     23524,     23526,
-    23527,     23529,     23530,     23532,     23533,     23535,     23536,     23538,
-    23539,     23541,     23542,     23544,     23545,     23547,     23548,     23550,
-    23552,     23553,     23555,     23556,     23558,     23559,     23561,     23562,
-    23564,     23565,     23567,     23568,     23570,     23571,     23573,     23574,
-    23576,     23577,     23579,     23580,     23582,     23583,     23585,     23586,
-    23588,     23589,     23591,     23592,     23594,     23595,     23597,     23599,
-    23600,     23602,     23603,     23605,     23606,     23608,     23609,     23611,
-    23612,     23614,     23615,     23617,     23618,     23620,     23621,     23623,
-    23624,     23626,     23627,     23629,     23630,     23632,     23633,     23635,
-    23636,     23638,     23639,     23641,     23642,     23644,     23645,     23647,
-    23648,     23650,     23651,     23653,     23654,     23656,     23657,     23659,
-    23660,     23662,     23663,     23665,     23666,     23668,     23669,     23671,
-    23672,     23674,     23675,     23677,     23678,     23680,     23681,     23683,
-    23684,     23686,     23687,     23689,     23690,     23692,     23693,     23695,
-    23696,     23698,     23699,     23701,     23702,     23704,     23705,     23707,
-    23708,     23710,     23711,     23713,     23714,     23716,     23717,     23719,
-    23720,     23722,     23723,     23725,     23726,     23728,     23729,     23731,
-    23732,     23734,     23735,     23737,     23738,     23740,     23741,     23743,
-    23744,     23746,     23747,     23749,     23750,     23752,     23753,     23755,
-    23756,     23758,     23759,     23761,     23762,     23764,     23765,     23767,
-    23768,     23770,     23771,     23772,     23774,     23775,     23777,     23778,
-    23780,     23781,     23783,     23784,     23786,     23787,     23789,     23790,
-    23792,     23793,     23795,     23796,     23798,     23799,     23801,     23802,
-    23804,     23805,     23807,     23808,     23810,     23811,     23813,     23814,
-    23816,     23817,     23819,     23820,     23821,     23823,     23824,     23826,
-    23827,     23829,     23830,     23832,     23833,     23835,     23836,     23838,
-    23839,     23841,     23842,     23844,     23845,     23847,     23848,     23850,
-    23851,     23853,     23854,     23855,     23857,     23858,     23860,     23861,
-    23863,     23864,     23866,     23867,     23869,     23870,     23872,     23873,
-    23875,     23876,     23878,     23879,     23881,     23882,     23884,     23885,
-    23886,     23888,     23889,     23891,     23892,     23894,     23895,     23897,
-    23898,     23900,     23901,     23903,     23904,     23906,     23907,     23909,
-    23910,     23911,     23913,     23914,     23916,     23917,     23919,     23920,
-    23922,     23923,     23925,     23926,     23928,     23929,     23931,     23932,
-    23933,     23935,     23936,     23938,     23939,     23941,     23942,     23944,
-    23945,     23947,     23948,     23950,     23951,     23952,     23954,     23955,
-    23957,     23958,     23960,     23961,     23963,     23964,     23966,     23967,
-    23969,     23970,     23971,     23973,     23974,     23976,     23977,     23979,
-    23980,     23982,     23983,     23985,     23986,     23988,     23989,     23990,
-    23992,     23993,     23995,     23996,     23998,     23999,     24001,     24002,
-    24004,     24005,     24006,     24008,     24009,     24011,     24012,     24014,
-    24015,     24017,     24018,     24020,     24021,     24022,     24024,     24025,
-    24027,     24028,     24030,     24031,     24033,     24034,     24036,     24037,
-    24038,     24040,     24041,     24043,     24044,     24046,     24047,     24049,
-    24050,     24051,     24053,     24054,     24056,     24057,     24059,     24060,
-    24062,     24063,     24065,     24066,     24067,     24069,     24070,     24072,
-    24073,     24075,     24076,     24078,     24079,     24080,     24082,     24083,
-    24085,     24086,     24088,     24089,     24091,     24092,     24093,     24095,
-    24096,     24098,     24099,     24101,     24102,     24104,     24105,     24106,
-    24108,     24109,     24111,     24112,     24114,     24115,     24116,     24118,
-    24119,     24121,     24122,     24124,     24125,     24127,     24128,     24129,
-    24131,     24132,     24134,     24135,     24137,     24138,     24139,     24141,
-    24142,     24144,     24145,     24147,     24148,     24150,     24151,     24152,
-    24154,     24155,     24157,     24158,     24160,     24161,     24162,     24164,
-    24165,     24167,     24168,     24170,     24171,     24172,     24174,     24175,
-    24177,     24178,     24180,     24181,     24182,     24184,     24185,     24187,
-    24188,     24190,     24191,     24192,     24194,     24195,     24197,     24198,
-    24200,     24201,     24202,     24204,     24205,     24207,     24208,     24210,
-    24211,     24212,     24214,     24215,     24217,     24218,     24220,     24221,
-    24222,     24224,     24225,     24227,     24228,     24230,     24231,     24232,
-    24234,     24235,     24237,     24238,     24240,     24241,     24242,     24244,
-    24245,     24247,     24248,     24249,     24251,     24252,     24254,     24255,
-    24257,     24258,     24259,     24261,     24262,     24264,     24265,     24267,
-    24268,     24269,     24271,     24272,     24274,     24275,     24276,     24278,
-    24279,     24281,     24282,     24284,     24285,     24286,     24288,     24289,
-    24291,     24292,     24293,     24295,     24296,     24298,     24299,     24301,
-    24302,     24303,     24305,     24306,     24308,     24309,     24310,     24312,
-    24313,     24315,     24316,     24317,     24319,     24320,     24322,     24323,
-    24325,     24326,     24327,     24329,     24330,     24332,     24333,     24334,
-    24336,     24337,     24339,     24340,     24341,     24343,     24344,     24346,
-    24347,     24348,     24350,     24351,     24353,     24354,     24355,     24357,
-    24358,     24360,     24361,     24363,     24364,     24365,     24367,     24368,
-    24370,     24371,     24372,     24374,     24375,     24377,     24378,     24379,
-    24381,     24382,     24384,     24385,     24386,     24388,     24389,     24391,
-    24392,     24393,     24395,     24396,     24398,     24399,     24400,     24402,
-    24403,     24405,     24406,     24407,     24409,     24410,     24412,     24413,
-    24414,     24416,     24417,     24419,     24420,     24421,     24423,     24424,
-    24426,     24427,     24428,     24430,     24431,     24433,     24434,     24435,
-    24437,     24438,     24439,     24441,     24442,     24444,     24445,     24446,
-    24448,     24449,     24451,     24452,     24453,     24455,     24456,     24458,
-    24459,     24460,     24462,     24463,     24465,     24466,     24467,     24469,
-    24470,     24471,     24473,     24474,     24476,     24477,     24478,     24480,
-    24481,     24483,     24484,     24485,     24487,     24488,     24490,     24491,
-    24492,     24494,     24495,     24496,     24498,     24499,     24501,     24502,
-    24503,     24505,     24506,     24508,     24509,     24510,     24512,     24513,
-    24514,     24516,     24517,     24519,     24520,     24521,     24523,     24524,
-    24526,     24527,     24528,     24530,     24531,     24532,     24534,     24535,
-    24537,     24538,     24539,     24541,     24542,     24543,     24545,     24546,
-    24548,     24549,     24550,     24552,     24553,     24554,     24556,     24557,
-    24559,     24560,     24561,     24563,     24564,     24566,     24567,     24568,
-    24570,     24571,     24572,     24574,     24575,     24577,     24578,     24579,
-    24581,     24582,     24583,     24585,     24586,     24587,     24589,     24590,
-    24592,     24593,     24594,     24596,     24597,     24598,     24600,     24601,
-    24603,     24604,     24605,     24607,     24608,     24609,     24611,     24612,
-    24614,     24615,     24616,     24618,     24619,     24620,     24622,     24623,
-    24624,     24626,     24627,     24629,     24630,     24631,     24633,     24634,
-    24635,     24637,     24638,     24640,     24641,     24642,     24644,     24645,
-    24646,     24648,     24649,     24650,     24652,     24653,     24655,     24656,
-    24657,     24659,     24660,     24661,     24663,     24664,     24665,     24667,
-    24668,     24669,     24671,     24672,     24674,     24675,     24676,     24678,
-    24679,     24680,     24682,     24683,     24684,     24686,     24687,     24689,
-    24690,     24691,     24693,     24694,     24695,     24697,     24698,     24699,
-    24701,     24702,     24703,     24705,     24706,     24708,     24709,     24710,
-    24712,     24713,     24714,     24716,     24717,     24718,     24720,     24721,
-    24722,     24724,     24725,     24726,     24728,     24729,     24731,     24732,
-    24733,     24735,     24736,     24737,     24739,     24740,     24741,     24743,
-    24744,     24745,     24747,     24748,     24749,     24751,     24752,     24753,
-    24755,     24756,     24758,     24759,     24760,     24762,     24763,     24764,
-    24766,     24767,     24768,     24770,     24771,     24772,     24774,     24775,
-    24776,     24778,     24779,     24780,     24782,     24783,     24784,     24786,
-    24787,     24788,     24790,     24791,     24793,     24794,     24795,     24797,
-    24798,     24799,     24801,     24802,     24803,     24805,     24806,     24807,
-    24809,     24810,     24811,     24813,     24814,     24815,     24817,     24818,
-    24819,     24821,     24822,     24823,     24825,     24826,     24827,     24829,
-    24830,     24831,     24833,     24834,     24835,     24837,     24838,     24839,
-    24841,     24842,     24843,     24845,     24846,     24847,     24849,     24850,
-    24851,     24853,     24854,     24855,     24857,     24858,     24859,     24861,
-    24862,     24863,     24865,     24866,     24867,     24869,     24870,     24871,
-    24873,     24874,     24875,     24877,     24878,     24879,     24881,     24882,
-    24883,     24885,     24886,     24887,     24889,     24890,     24891,     24893,
-    24894,     24895,     24897,     24898,     24899,     24901,     24902,     24903,
-    24905,     24906,     24907,     24909,     24910,     24911,     24913,     24914,
-    24915,     24917,     24918,     24919,     24921,     24922,     24923,     24925,
-    24926,     24927,     24928,     24930,     24931,     24932,     24934,     24935,
-    24936,     24938,     24939,     24940,     24942,     24943,     24944,     24946,
-    24947,     24948,     24950,     24951,     24952,     24954,     24955,     24956,
-    24958,     24959,     24960,     24962,     24963,     24964,     24965,     24967,
-    24968,     24969,     24971,     24972,     24973,     24975,     24976,     24977,
-    24979,     24980,     24981,     24983,     24984,     24985,     24987,     24988,
-    24989,     24990,     24992,     24993,     24994,     24996,     24997,     24998,
-    25000,     25001,     25002,     25004,     25005,     25006,     25008,     25009,
-    25010,     25011,     25013,     25014,     25015,     25017,     25018,     25019,
-    25021,     25022,     25023,     25025,     25026,     25027,     25028,     25030,
-    25031,     25032,     25034,     25035,     25036,     25038,     25039,     25040,
-    25042,     25043,     25044,     25045,     25047,     25048,     25049,     25051,
-    25052,     25053,     25055,     25056,     25057,     25059,     25060,     25061,
-    25062,     25064,     25065,     25066,     25068,     25069,     25070,     25072,
-    25073,     25074,     25075,     25077,     25078,     25079,     25081,     25082,
-    25083,     25085,     25086,     25087,     25088,     25090,     25091,     25092,
-    25094,     25095,     25096,     25098,     25099,     25100,     25101,     25103,
-    25104,     25105,     25107,     25108,     25109,     25111,     25112,     25113,
-    25114,     25116,     25117,     25118,     25120,     25121,     25122,     25124,
-    25125,     25126,     25127,     25129,     25130,     25131,     25133,     25134,
-    25135,     25136,     25138,     25139,     25140,     25142,     25143,     25144,
-    25145,     25147,     25148,     25149,     25151,     25152,     25153,     25155,
-    25156,     25157,     25158,     25160,     25161,     25162,     25164,     25165,
-    25166,     25167,     25169,     25170,     25171,     25173,     25174,     25175,
-    25176,     25178,     25179,     25180,     25182,     25183,     25184,     25185,
-    25187,     25188,     25189,     25191,     25192,     25193,     25194,     25196,
-    25197,     25198,     25200,     25201,     25202,     25203,     25205,     25206,
-    25207,     25209,     25210,     25211,     25212,     25214,     25215,     25216,
-    25218,     25219,     25220,     25221,     25223,     25224,     25225,     25226,
-    25228,     25229,     25230,     25232,     25233,     25234,     25235,     25237,
-    25238,     25239,     25241,     25242,     25243,     25244,     25246,     25247,
-    25248,     25249,     25251,     25252,     25253,     25255,     25256,     25257,
-    25258,     25260,     25261,     25262,     25263,     25265,     25266,     25267,
-    25269,     25270,     25271,     25272,     25274,     25275,     25276,     25277,
-    25279,     25280,     25281,     25283,     25284,     25285,     25286,     25288,
-    25289,     25290,     25291,     25293,     25294,     25295,     25297,     25298,
-    25299,     25300,     25302,     25303,     25304,     25305,     25307,     25308,
-    25309,     25311,     25312,     25313,     25314,     25316,     25317,     25318,
-    25319,     25321,     25322,     25323,     25324,     25326,     25327,     25328,
-    25329,     25331,     25332,     25333,     25335,     25336,     25337,     25338,
-    25340,     25341,     25342,     25343,     25345,     25346,     25347,     25348,
-    25350,     25351,     25352,     25353,     25355,     25356,     25357,     25359,
-    25360,     25361,     25362,     25364,     25365,     25366,     25367,     25369,
-    25370,     25371,     25372,     25374,     25375,     25376,     25377,     25379,
-    25380,     25381,     25382,     25384,     25385,     25386,     25387,     25389,
-    25390,     25391,     25392,     25394,     25395,     25396,     25397,     25399,
-    25400,     25401,     25402,     25404,     25405,     25406,     25408,     25409,
-    25410,     25411,     25413,     25414,     25415,     25416,     25418,     25419,
-    25420,     25421,     25423,     25424,     25425,     25426,     25428,     25429,
-    25430,     25431,     25433,     25434,     25435,     25436,     25438,     25439,
-    25440,     25441,     25443,     25444,     25445,     25446,     25447,     25449,
-    25450,     25451,     25452,     25454,     25455,     25456,     25457,     25459,
-    25460,     25461,     25462,     25464,     25465,     25466,     25467,     25469,
-    25470,     25471,     25472,     25474,     25475,     25476,     25477,     25479,
-    25480,     25481,     25482,     25484,     25485,     25486,     25487,     25489,
-    25490,     25491,     25492,     25493,     25495,     25496,     25497,     25498,
-    25500,     25501,     25502,     25503,     25505,     25506,     25507,     25508,
-    25510,     25511,     25512,     25513,     25515,     25516,     25517,     25518,
-    25519,     25521,     25522,     25523,     25524,     25526,     25527,     25528,
-    25529,     25531,     25532,     25533,     25534,     25536,     25537,     25538,
-    25539,     25540,     25542,     25543,     25544,     25545,     25547,     25548,
-    25549,     25550,     25552,     25553,     25554,     25555,     25556,     25558,
-    25559,     25560,     25561,     25563,     25564,     25565,     25566,     25568,
-    25569,     25570,     25571,     25572,     25574,     25575,     25576,     25577,
-    25579,     25580,     25581,     25582,     25584,     25585,     25586,     25587,
-    25588,     25590,     25591,     25592,     25593,     25595,     25596,     25597,
-    25598,     25599,     25601,     25602,     25603,     25604,     25606,     25607,
-    25608,     25609,     25610,     25612,     25613,     25614,     25615,     25617,
-    25618,     25619,     25620,     25621,     25623,     25624,     25625,     25626,
-    25628,     25629,     25630,     25631,     25632,     25634,     25635,     25636,
-    25637,     25639,     25640,     25641,     25642,     25643,     25645,     25646,
-    25647,     25648,     25649,     25651,     25652,     25653,     25654,     25656,
-    25657,     25658,     25659,     25660,     25662,     25663,     25664,     25665,
-    25666,     25668,     25669,     25670,     25671,     25673,     25674,     25675,
-    25676,     25677,     25679,     25680,     25681,     25682,     25683,     25685,
-    25686,     25687,     25688,     25690,     25691,     25692,     25693,     25694,
-    25696,     25697,     25698,     25699,     25700,     25702,     25703,     25704,
-    25705,     25706,     25708,     25709,     25710,     25711,     25712,     25714,
-    25715,     25716,     25717,     25719,     25720,     25721,     25722,     25723,
-    25725,     25726,     25727,     25728,     25729,     25731,     25732,     25733,
-    25734,     25735,     25737,     25738,     25739,     25740,     25741,     25743,
-    25744,     25745,     25746,     25747,     25749,     25750,     25751,     25752,
-    25753,     25755,     25756,     25757,     25758,     25759,     25761,     25762,
-    25763,     25764,     25765,     25767,     25768,     25769,     25770,     25771,
-    25773,     25774,     25775,     25776,     25777,     25779,     25780,     25781,
-    25782,     25783,     25785,     25786,     25787,     25788,     25789,     25791,
-    25792,     25793,     25794,     25795,     25797,     25798,     25799,     25800,
-    25801,     25802,     25804,     25805,     25806,     25807,     25808,     25810,
-    25811,     25812,     25813,     25814,     25816,     25817,     25818,     25819,
-    25820,     25822,     25823,     25824,     25825,     25826,     25828,     25829,
-    25830,     25831,     25832,     25833,     25835,     25836,     25837,     25838,
-    25839,     25841,     25842,     25843,     25844,     25845,     25847,     25848,
-    25849,     25850,     25851,     25852,     25854,     25855,     25856,     25857,
-    25858,     25860,     25861,     25862,     25863,     25864,     25865,     25867,
-    25868,     25869,     25870,     25871,     25873,     25874,     25875,     25876,
-    25877,     25879,     25880,     25881,     25882,     25883,     25884,     25886,
-    25887,     25888,     25889,     25890,     25892,     25893,     25894,     25895,
-    25896,     25897,     25899,     25900,     25901,     25902,     25903,     25904,
-    25906,     25907,     25908,     25909,     25910,     25912,     25913,     25914,
-    25915,     25916,     25917,     25919,     25920,     25921,     25922,     25923,
-    25924,     25926,     25927,     25928,     25929,     25930,     25932,     25933,
-    25934,     25935,     25936,     25937,     25939,     25940,     25941,     25942,
-    25943,     25944,     25946,     25947,     25948,     25949,     25950,     25951,
-    25953,     25954,     25955,     25956,     25957,     25958,     25960,     25961,
-    25962,     25963,     25964,     25965,     25967,     25968,     25969,     25970,
-    25971,     25972,     25974,     25975,     25976,     25977,     25978,     25979,
-    25981,     25982,     25983,     25984,     25985,     25986,     25988,     25989,
-    25990,     25991,     25992,     25993,     25995,     25996,     25997,     25998,
-    25999,     26000,     26002,     26003,     26004,     26005,     26006,     26007,
-    26009,     26010,     26011,     26012,     26013,     26014,     26016,     26017,
-    26018,     26019,     26020,     26021,     26023,     26024,     26025,     26026,
-    26027,     26028,     26030,     26031,     26032,     26033,     26034,     26035,
-    26036,     26038,     26039,     26040,     26041,     26042,     26043,     26045,
-    26046,     26047,     26048,     26049,     26050,     26051,     26053,     26054,
-    26055,     26056,     26057,     26058,     26060,     26061,     26062,     26063,
-    26064,     26065,     26066,     26068,     26069,     26070,     26071,     26072,
-    26073,     26075,     26076,     26077,     26078,     26079,     26080,     26081,
-    26083,     26084,     26085,     26086,     26087,     26088,     26090,     26091,
-    26092,     26093,     26094,     26095,     26096,     26098,     26099,     26100,
-    26101,     26102,     26103,     26104,     26106,     26107,     26108,     26109,
-    26110,     26111,     26112,     26114,     26115,     26116,     26117,     26118,
-    26119,     26121,     26122,     26123,     26124,     26125,     26126,     26127,
-    26129,     26130,     26131,     26132,     26133,     26134,     26135,     26137,
-    26138,     26139,     26140,     26141,     26142,     26143,     26145,     26146,
-    26147,     26148,     26149,     26150,     26151,     26153,     26154,     26155,
-    26156,     26157,     26158,     26159,     26160,     26162,     26163,     26164,
-    26165,     26166,     26167,     26168,     26170,     26171,     26172,     26173,
-    26174,     26175,     26176,     26178,     26179,     26180,     26181,     26182,
-    26183,     26184,     26186,     26187,     26188,     26189,     26190,     26191,
-    26192,     26193,     26195,     26196,     26197,     26198,     26199,     26200,
-    26201,     26203,     26204,     26205,     26206,     26207,     26208,     26209,
-    26210,     26212,     26213,     26214,     26215,     26216,     26217,     26218,
-    26219,     26221,     26222,     26223,     26224,     26225,     26226,     26227,
-    26229,     26230,     26231,     26232,     26233,     26234,     26235,     26236,
-    26238,     26239,     26240,     26241,     26242,     26243,     26244,     26245,
-    26247,     26248,     26249,     26250,     26251,     26252,     26253,     26254,
-    26256,     26257,     26258,     26259,     26260,     26261,     26262,     26263,
-    26265,     26266,     26267,     26268,     26269,     26270,     26271,     26272,
-    26274,     26275,     26276,     26277,     26278,     26279,     26280,     26281,
-    26282,     26284,     26285,     26286,     26287,     26288,     26289,     26290,
-    26291,     26293,     26294,     26295,     26296,     26297,     26298,     26299,
-    26300,     26302,     26303,     26304,     26305,     26306,     26307,     26308,
-    26309,     26310,     26312,     26313,     26314,     26315,     26316,     26317,
-    26318,     26319,     26320,     26322,     26323,     26324,     26325,     26326,
-    26327,     26328,     26329,     26331,     26332,     26333,     26334,     26335,
-    26336,     26337,     26338,     26339,     26341,     26342,     26343,     26344,
-    26345,     26346,     26347,     26348,     26349,     26351,     26352,     26353,
-    26354,     26355,     26356,     26357,     26358,     26359,     26360,     26362,
-    26363,     26364,     26365,     26366,     26367,     26368,     26369,     26370,
-    26372,     26373,     26374,     26375,     26376,     26377,     26378,     26379,
-    26380,     26382,     26383,     26384,     26385,     26386,     26387,     26388,
-    26389,     26390,     26391,     26393,     26394,     26395,     26396,     26397,
-    26398,     26399,     26400,     26401,     26402,     26404,     26405,     26406,
-    26407,     26408,     26409,     26410,     26411,     26412,     26413,     26415,
-    26416,     26417,     26418,     26419,     26420,     26421,     26422,     26423,
-    26424,     26426,     26427,     26428,     26429,     26430,     26431,     26432,
-    26433,     26434,     26435,     26437,     26438,     26439,     26440,     26441,
-    26442,     26443,     26444,     26445,     26446,     26448,     26449,     26450,
-    26451,     26452,     26453,     26454,     26455,     26456,     26457,     26458,
-    26460,     26461,     26462,     26463,     26464,     26465,     26466,     26467,
-    26468,     26469,     26470,     26472,     26473,     26474,     26475,     26476,
-    26477,     26478,     26479,     26480,     26481,     26482,     26484,     26485,
-    26486,     26487,     26488,     26489,     26490,     26491,     26492,     26493,
-    26494,     26496,     26497,     26498,     26499,     26500,     26501,     26502,
-    26503,     26504,     26505,     26506,     26507,     26509,     26510,     26511,
-    26512,     26513,     26514,     26515,     26516,     26517,     26518,     26519,
-    26520,     26522,     26523,     26524,     26525,     26526,     26527,     26528,
-    26529,     26530,     26531,     26532,     26533,     26535,     26536,     26537,
-    26538,     26539,     26540,     26541,     26542,     26543,     26544,     26545,
-    26546,     26548,     26549,     26550,     26551,     26552,     26553,     26554,
-    26555,     26556,     26557,     26558,     26559,     26560,     26562,     26563,
-    26564,     26565,     26566,     26567,     26568,     26569,     26570,     26571,
-    26572,     26573,     26574,     26576,     26577,     26578,     26579,     26580,
-    26581,     26582,     26583,     26584,     26585,     26586,     26587,     26588,
-    26589,     26591,     26592,     26593,     26594,     26595,     26596,     26597,
-    26598,     26599,     26600,     26601,     26602,     26603,     26604,     26606,
-    26607,     26608,     26609,     26610,     26611,     26612,     26613,     26614,
-    26615,     26616,     26617,     26618,     26619,     26621,     26622,     26623,
-    26624,     26625,     26626,     26627,     26628,     26629,     26630,     26631,
-    26632,     26633,     26634,     26635,     26637,     26638,     26639,     26640,
-    26641,     26642,     26643,     26644,     26645,     26646,     26647,     26648,
-    26649,     26650,     26651,     26652,     26654,     26655,     26656,     26657,
-    26658,     26659,     26660,     26661,     26662,     26663,     26664,     26665,
-    26666,     26667,     26668,     26669,     26671,     26672,     26673,     26674,
-    26675,     26676,     26677,     26678,     26679,     26680,     26681,     26682,
-    26683,     26684,     26685,     26686,     26687,     26689,     26690,     26691,
-    26692,     26693,     26694,     26695,     26696,     26697,     26698,     26699,
-    26700,     26701,     26702,     26703,     26704,     26705,     26706,     26708,
-    26709,     26710,     26711,     26712,     26713,     26714,     26715,     26716,
-    26717,     26718,     26719,     26720,     26721,     26722,     26723,     26724,
-    26725,     26726,     26728,     26729,     26730,     26731,     26732,     26733,
-    26734,     26735,     26736,     26737,     26738,     26739,     26740,     26741,
-    26742,     26743,     26744,     26745,     26746,     26747,     26749,     26750,
-    26751,     26752,     26753,     26754,     26755,     26756,     26757,     26758,
-    26759,     26760,     26761,     26762,     26763,     26764,     26765,     26766,
-    26767,     26768,     26769,     26771,     26772,     26773,     26774,     26775,
-    26776,     26777,     26778,     26779,     26780,     26781,     26782,     26783,
-    26784,     26785,     26786,     26787,     26788,     26789,     26790,     26791,
-    26792,     26793,     26794,     26796,     26797,     26798,     26799,     26800,
-    26801,     26802,     26803,     26804,     26805,     26806,     26807,     26808,
-    26809,     26810,     26811,     26812,     26813,     26814,     26815,     26816,
-    26817,     26818,     26819,     26820,     26821,     26823,     26824,     26825,
-    26826,     26827,     26828,     26829,     26830,     26831,     26832,     26833,
-    26834,     26835,     26836,     26837,     26838,     26839,     26840,     26841,
-    26842,     26843,     26844,     26845,     26846,     26847,     26848,     26849,
-    26850,     26851,     26853,     26854,     26855,     26856,     26857,     26858,
-    26859,     26860,     26861,     26862,     26863,     26864,     26865,     26866,
-    26867,     26868,     26869,     26870,     26871,     26872,     26873,     26874,
-    26875,     26876,     26877,     26878,     26879,     26880,     26881,     26882,
-    26883,     26884,     26885,     26886,     26888,     26889,     26890,     26891,
-    26892,     26893,     26894,     26895,     26896,     26897,     26898,     26899,
-    26900,     26901,     26902,     26903,     26904,     26905,     26906,     26907,
-    26908,     26909,     26910,     26911,     26912,     26913,     26914,     26915,
-    26916,     26917,     26918,     26919,     26920,     26921,     26922,     26923,
-    26924,     26925,     26926,     26927,     26928,     26929,     26930,     26931,
-    26933,     26934,     26935,     26936,     26937,     26938,     26939,     26940,
-    26941,     26942,     26943,     26944,     26945,     26946,     26947,     26948,
-    26949,     26950,     26951,     26952,     26953,     26954,     26955,     26956,
-    26957,     26958,     26959,     26960,     26961,     26962,     26963,     26964,
-    26965,     26966,     26967,     26968,     26969,     26970,     26971,     26972,
-    26973,     26974,     26975,     26976,     26977,     26978,     26979,     26980,
-    26981,     26982,     26983,     26984,     26985,     26986,     26987,     26988,
-    26989,     26990,     26991,     26992,     26993,     26994,     26995,     26996,
-    26997,     26998,     26999,     27000,     27001,     27002,     27003,     27004,
-    27005,     27006,     27007,     27008,     27009,     27010,     27012,     27013,
-    27014,     27015,     27016,     27017,     27018,     27019,     27020,     27021,
-    27022,     27023,     27024,     27025,     27026,     27027,     27028,     27029,
-    27030,     27031,     27032,     27033,     27034,     27035,     27036,     27037,
-    27038,     27039,     27040,     27041,     27042,     27043,     27044,     27045,
-    27046,     27047,     27048,     27049,     27050,     27051,     27052,     27053,
-    27054,     27055,     27056,     27057,     27058,     27059,     27060,     27061,
-    27062,     27063,     27064,     27065,     27066,     27067,     27068,     27069,
-    27070,     27071,     27072,     27073,     27074,     27075,     27076,     27077,
-    27078,     27079,     27080,     27081,     27082,     27083,     27084,     27085,
-    27086,     27087,     27088,     27089,     27090,     27091,     27092,     27093,
-    27094,     27095,     27095,     27096,     27097,     27098,     27099,     27100,
-    27101,     27102,     27103,     27104,     27105,     27106,     27107,     27108,
-    27109,     27110,     27111,     27112,     27113,     27114,     27115,     27116,
-    27117,     27118,     27119,     27120,     27121,     27122,     27123,     27124,
-    27125,     27126,     27127,     27128,     27129,     27130,     27131,     27132,
-    27133,     27134,     27135,     27136,     27137,     27138,     27139,     27140,
-    27141,     27142,     27143,     27144,     27145,     27146,     27147,     27148,
-    27149,     27150,     27151,     27152,     27153,     27154,     27155,     27156,
-    27157,     27158,     27159,     27160,     27161,     27162,     27163,     27164,
-    27165,     27166,     27167,     27168,     27169,     27170,     27171,     27172,
-    27173,     27173,     27174,     27175,     27176,     27177,     27178,     27179,
-    27180,     27181,     27182,     27183,     27184,     27185,     27186,     27187,
-    27188,     27189,     27190,     27191,     27192,     27193,     27194,     27195,
-    27196,     27197,     27198,     27199,     27200,     27201,     27202,     27203,
-    27204,     27205,     27206,     27207,     27208,     27209,     27210,     27211,
-    27212,     27213,     27214,     27215,     27216,     27216,     27217,     27218,
-    27219,     27220,     27221,     27222,     27223,     27224,     27225,     27226,
-    27227,     27228,     27229,     27230,     27231,     27232,     27233,     27234,
-    27235,     27236,     27237,     27238,     27239,     27240,     27241,     27242,
-    27243,     27244,     27245,     27246,     27247,     27248,     27249,     27250,
-    27250,     27251,     27252,     27253,     27254,     27255,     27256,     27257,
-    27258,     27259,     27260,     27261,     27262,     27263,     27264,     27265,
-    27266,     27267,     27268,     27269,     27270,     27271,     27272,     27273,
-    27274,     27275,     27276,     27277,     27278,     27279,     27279,     27280,
-    27281,     27282,     27283,     27284,     27285,     27286,     27287,     27288,
-    27289,     27290,     27291,     27292,     27293,     27294,     27295,     27296,
-    27297,     27298,     27299,     27300,     27301,     27302,     27303,     27304,
-    27304,     27305,     27306,     27307,     27308,     27309,     27310,     27311,
-    27312,     27313,     27314,     27315,     27316,     27317,     27318,     27319,
-    27320,     27321,     27322,     27323,     27324,     27325,     27326,     27327,
-    27327,     27328,     27329,     27330,     27331,     27332,     27333,     27334,
-    27335,     27336,     27337,     27338,     27339,     27340,     27341,     27342,
-    27343,     27344,     27345,     27346,     27347,     27348,     27348,     27349,
-    27350,     27351,     27352,     27353,     27354,     27355,     27356,     27357,
-    27358,     27359,     27360,     27361,     27362,     27363,     27364,     27365,
-    27366,     27367,     27368,     27368,     27369,     27370,     27371,     27372,
-    27373,     27374,     27375,     27376,     27377,     27378,     27379,     27380,
-    27381,     27382,     27383,     27384,     27385,     27386,     27386,     27387,
-    27388,     27389,     27390,     27391,     27392,     27393,     27394,     27395,
-    27396,     27397,     27398,     27399,     27400,     27401,     27402,     27403,
-    27404,     27404,     27405,     27406,     27407,     27408,     27409,     27410,
-    27411,     27412,     27413,     27414,     27415,     27416,     27417,     27418,
-    27419,     27420,     27420,     27421,     27422,     27423,     27424,     27425,
-    27426,     27427,     27428,     27429,     27430,     27431,     27432,     27433,
-    27434,     27435,     27436,     27436,     27437,     27438,     27439,     27440,
-    27441,     27442,     27443,     27444,     27445,     27446,     27447,     27448,
-    27449,     27450,     27451,     27451,     27452,     27453,     27454,     27455,
-    27456,     27457,     27458,     27459,     27460,     27461,     27462,     27463,
-    27464,     27465,     27466,     27466,     27467,     27468,     27469,     27470,
-    27471,     27472,     27473,     27474,     27475,     27476,     27477,     27478,
-    27479,     27479,     27480,     27481,     27482,     27483,     27484,     27485,
-    27486,     27487,     27488,     27489,     27490,     27491,     27492,     27493,
-    27493,     27494,     27495,     27496,     27497,     27498,     27499,     27500,
-    27501,     27502,     27503,     27504,     27505,     27506,     27506,     27507,
-    27508,     27509,     27510,     27511,     27512,     27513,     27514,     27515,
-    27516,     27517,     27518,     27519,     27519,     27520,     27521,     27522,
-    27523,     27524,     27525,     27526,     27527,     27528,     27529,     27530,
-    27531,     27531,     27532,     27533,     27534,     27535,     27536,     27537,
-    27538,     27539,     27540,     27541,     27542,     27543,     27543,     27544,
-    27545,     27546,     27547,     27548,     27549,     27550,     27551,     27552,
-    27553,     27554,     27555,     27555,     27556,     27557,     27558,     27559,
-    27560,     27561,     27562,     27563,     27564,     27565,     27566,     27566,
-    27567,     27568,     27569,     27570,     27571,     27572,     27573,     27574,
-    27575,     27576,     27577,     27577,     27578,     27579,     27580,     27581,
-    27582,     27583,     27584,     27585,     27586,     27587,     27588,     27588,
-    27589,     27590,     27591,     27592,     27593,     27594,     27595,     27596,
-    27597,     27598,     27598,     27599,     27600,     27601,     27602,     27603,
-    27604,     27605,     27606,     27607,     27608,     27609,     27609,     27610,
-    27611,     27612,     27613,     27614,     27615,     27616,     27617,     27618,
-    27619,     27619,     27620,     27621,     27622,     27623,     27624,     27625,
-    27626,     27627,     27628,     27629,     27629,     27630,     27631,     27632,
-    27633,     27634,     27635,     27636,     27637,     27638,     27639,     27639,
-    27640,     27641,     27642,     27643,     27644,     27645,     27646,     27647,
-    27648,     27648,     27649,     27650,     27651,     27652,     27653,     27654,
-    27655,     27656,     27657,     27658,     27658,     27659,     27660,     27661,
-    27662,     27663,     27664,     27665,     27666,     27667,     27667,     27668,
-    27669,     27670,     27671,     27672,     27673,     27674,     27675,     27676,
-    27676,     27677,     27678,     27679,     27680,     27681,     27682,     27683,
-    27684,     27685,     27685,     27686,     27687,     27688,     27689,     27690,
-    27691,     27692,     27693,     27694,     27694,     27695,     27696,     27697,
-    27698,     27699,     27700,     27701,     27702,     27702,     27703,     27704,
-    27705,     27706,     27707,     27708,     27709,     27710,     27711,     27711,
-    27712,     27713,     27714,     27715,     27716,     27717,     27718,     27719,
-    27719,     27720,     27721,     27722,     27723,     27724,     27725,     27726,
-    27727,     27728,     27728,     27729,     27730,     27731,     27732,     27733,
-    27734,     27735,     27736,     27736,     27737,     27738,     27739,     27740,
-    27741,     27742,     27743,     27744,     27744,     27745,     27746,     27747,
-    27748,     27749,     27750,     27751,     27752,     27752,     27753,     27754,
-    27755,     27756,     27757,     27758,     27759,     27760,     27760,     27761,
-    27762,     27763,     27764,     27765,     27766,     27767,     27768,     27768,
-    27769,     27770,     27771,     27772,     27773,     27774,     27775,     27775,
-    27776,     27777,     27778,     27779,     27780,     27781,     27782,     27783,
-    27783,     27784,     27785,     27786,     27787,     27788,     27789,     27790,
-    27790,     27791,     27792,     27793,     27794,     27795,     27796,     27797,
-    27798,     27798,     27799,     27800,     27801,     27802,     27803,     27804,
-    27805,     27805,     27806,     27807,     27808,     27809,     27810,     27811,
-    27812,     27812,     27813,     27814,     27815,     27816,     27817,     27818,
-    27819,     27820,     27820,     27821,     27822,     27823,     27824,     27825,
-    27826,     27827,     27827,     27828,     27829,     27830,     27831,     27832,
-    27833,     27834,     27834,     27835,     27836,     27837,     27838,     27839,
-    27840,     27841,     27841,     27842,     27843,     27844,     27845,     27846,
-    27847,     27847,     27848,     27849,     27850,     27851,     27852,     27853,
-    27854,     27854,     27855,     27856,     27857,     27858,     27859,     27860,
-    27861,     27861,     27862,     27863,     27864,     27865,     27866,     27867,
-    27868,     27868,     27869,     27870,     27871,     27872,     27873,     27874,
-    27874,     27875,     27876,     27877,     27878,     27879,     27880,     27881,
-    27881,     27882,     27883,     27884,     27885,     27886,     27887,     27887,
-    27888,     27889,     27890,     27891,     27892,     27893,     27894,     27894,
-    27895,     27896,     27897,     27898,     27899,     27900,     27900,     27901,
-    27902,     27903,     27904,     27905,     27906,     27906,     27907,     27908,
-    27909,     27910,     27911,     27912,     27913,     27913,     27914,     27915,
-    27916,     27917,     27918,     27919,     27919,     27920,     27921,     27922,
-    27923,     27924,     27925,     27925,     27926,     27927,     27928,     27929,
-    27930,     27931,     27931,     27932,     27933,     27934,     27935,     27936,
-    27937,     27937,     27938,     27939,     27940,     27941,     27942,     27943,
-    27943,     27944,     27945,     27946,     27947,     27948,     27949,     27949,
-    27950,     27951,     27952,     27953,     27954,     27955,     27955,     27956,
-    27957,     27958,     27959,     27960,     27961,     27961,     27962,     27963,
-    27964,     27965,     27966,     27967,     27967,     27968,     27969,     27970,
-    27971,     27972,     27973,     27973,     27974,     27975,     27976,     27977,
-    27978,     27978,     27979,     27980,     27981,     27982,     27983,     27984,
-    27984,     27985,     27986,     27987,     27988,     27989,     27990,     27990,
-    27991,     27992,     27993,     27994,     27995,     27995,     27996,     27997,
-    27998,     27999,     28000,     28001,     28001,     28002,     28003,     28004,
-    28005,     28006,     28006,     28007,     28008,     28009,     28010,     28011,
-    28012,     28012,     28013,     28014,     28015,     28016,     28017,     28017,
-    28018,     28019,     28020,     28021,     28022,     28023,     28023,     28024,
-    28025,     28026,     28027,     28028,     28028,     28029,     28030,     28031,
-    28032,     28033,     28033,     28034,     28035,     28036,     28037,     28038,
-    28039,     28039,     28040,     28041,     28042,     28043,     28044,     28044,
-    28045,     28046,     28047,     28048,     28049,     28049,     28050,     28051,
-    28052,     28053,     28054,     28055,     28055,     28056,     28057,     28058,
-    28059,     28060,     28060,     28061,     28062,     28063,     28064,     28065,
-    28065,     28066,     28067,     28068,     28069,     28070,     28070,     28071,
-    28072,     28073,     28074,     28075,     28075,     28076,     28077,     28078,
-    28079,     28080,     28080,     28081,     28082,     28083,     28084,     28085,
-    28085,     28086,     28087,     28088,     28089,     28090,     28090,     28091,
-    28092,     28093,     28094,     28095,     28095,     28096,     28097,     28098,
-    28099,     28100,     28100,     28101,     28102,     28103,     28104,     28105,
-    28105,     28106,     28107,     28108,     28109,     28110,     28110,     28111,
-    28112,     28113,     28114,     28115,     28115,     28116,     28117,     28118,
-    28119,     28119,     28120,     28121,     28122,     28123,     28124,     28124,
-    28125,     28126,     28127,     28128,     28129,     28129,     28130,     28131,
-    28132,     28133,     28134,     28134,     28135,     28136,     28137,     28138,
-    28138,     28139,     28140,     28141,     28142,     28143,     28143,     28144,
-    28145,     28146,     28147,     28148,     28148,     28149,     28150,     28151,
-    28152,     28152,     28153,     28154,     28155,     28156,     28157,     28157,
-    28158,     28159,     28160,     28161,     28162,     28162,     28163,     28164,
-    28165,     28166,     28166,     28167,     28168,     28169,     28170,     28171,
-    28171,     28172,     28173,     28174,     28175,     28175,     28176,     28177,
-    28178,     28179,     28180,     28180,     28181,     28182,     28183,     28184,
-    28184,     28185,     28186,     28187,     28188,     28189,     28189,     28190,
-    28191,     28192,     28193,     28193,     28194,     28195,     28196,     28197,
-    28198,     28198,     28199,     28200,     28201,     28202,     28202,     28203,
-    28204,     28205,     28206,     28206,     28207,     28208,     28209,     28210,
-    28211,     28211,     28212,     28213,     28214,     28215,     28215,     28216,
-    28217,     28218,     28219,     28219,     28220,     28221,     28222,     28223,
-    28224,     28224,     28225,     28226,     28227,     28228,     28228,     28229,
-    28230,     28231,     28232,     28232,     28233,     28234,     28235,     28236,
-    28236,     28237,     28238,     28239,     28240,     28241,     28241,     28242,
-    28243,     28244,     28245,     28245,     28246,     28247,     28248,     28249,
-    28249,     28250,     28251,     28252,     28253,     28253,     28254,     28255,
-    28256,     28257,     28257,     28258,     28259,     28260,     28261,     28261,
-    28262,     28263,     28264,     28265,     28266,     28266,     28267,     28268,
-    28269,     28270,     28270,     28271,     28272,     28273,     28274,     28274,
-    28275,     28276,     28277,     28278,     28278,     28279,     28280,     28281,
-    28282,     28282,     28283,     28284,     28285,     28286,     28286,     28287,
-    28288,     28289,     28290,     28290,     28291,     28292,     28293,     28294,
-    28294,     28295,     28296,     28297,     28298,     28298,     28299,     28300,
-    28301,     28302,     28302,     28303,     28304,     28305,     28306,     28306,
-    28307,     28308,     28309,     28310,     28310,     28311,     28312,     28313,
-    28314,     28314,     28315,     28316,     28317,     28317,     28318,     28319,
-    28320,     28321,     28321,     28322,     28323,     28324,     28325,     28325,
-    28326,     28327,     28328,     28329,     28329,     28330,     28331,     28332,
-    28333,     28333,     28334,     28335,     28336,     28337,     28337,     28338,
-    28339,     28340,     28340,     28341,     28342,     28343,     28344,     28344,
-    28345,     28346,     28347,     28348,     28348,     28349,     28350,     28351,
-    28352,     28352,     28353,     28354,     28355,     28356,     28356,     28357,
-    28358,     28359,     28359,     28360,     28361,     28362,     28363,     28363,
-    28364,     28365,     28366,     28367,     28367,     28368,     28369,     28370,
-    28370,     28371,     28372,     28373,     28374,     28374,     28375,     28376,
-    28377,     28378,     28378,     28379,     28380,     28381,     28381,     28382,
-    28383,     28384,     28385,     28385,     28386,     28387,     28388,     28389,
-    28389,     28390,     28391,     28392,     28392,     28393,     28394,     28395,
-    28396,     28396,     28397,     28398,     28399,     28399,     28400,     28401,
-    28402,     28403,     28403,     28404,     28405,     28406,     28407,     28407,
-    28408,     28409,     28410,     28410,     28411,     28412,     28413,     28414,
-    28414,     28415,     28416,     28417,     28417,     28418,     28419,     28420,
-    28421,     28421,     28422,     28423,     28424,     28424,     28425,     28426,
-    28427,     28428,     28428,     28429,     28430,     28431,     28431,     28432,
-    28433,     28434,     28435,     28435,     28436,     28437,     28438,     28438,
-    28439,     28440,     28441,     28441,     28442,     28443,     28444,     28445,
-    28445,     28446,     28447,     28448,     28448,     28449,     28450,     28451,
-    28452,     28452,     28453,     28454,     28455,     28455,     28456,     28457,
-    28458,     28459,     28459,     28460,     28461,     28462,     28462,     28463,
-    28464,     28465,     28465,     28466,     28467,     28468,     28469,     28469,
-    28470,     28471,     28472,     28472,     28473,     28474,     28475,     28475,
-    28476,     28477,     28478,     28479,     28479,     28480,     28481,     28482,
-    28482,     28483,     28484,     28485,     28485,     28486,     28487,     28488,
-    28489,     28489,     28490,     28491,     28492,     28492,     28493,     28494,
-    28495,     28495,     28496,     28497,     28498,     28498,     28499,     28500,
-    28501,     28502,     28502,     28503,     28504,     28505,     28505,     28506,
-    28507,     28508,     28508,     28509,     28510,     28511,     28511,     28512,
-    28513,     28514,     28514,     28515,     28516,     28517,     28518,     28518,
-    28519,     28520,     28521,     28521,     28522,     28523,     28524,     28524,
-    28525,     28526,     28527,     28527,     28528,     28529,     28530,     28530,
-    28531,     28532,     28533,     28534,     28534,     28535,     28536,     28537,
-    28537,     28538,     28539,     28540,     28540,     28541,     28542,     28543,
-    28543,     28544,     28545,     28546,     28546,     28547,     28548,     28549,
-    28549,     28550,     28551,     28552,     28552,     28553,     28554,     28555,
-    28555,     28556,     28557,     28558,     28559,     28559,     28560,     28561,
-    28562,     28562,     28563,     28564,     28565,     28565,     28566,     28567,
-    28568,     28568,     28569,     28570,     28571,     28571,     28572,     28573,
-    28574,     28574,     28575,     28576,     28577,     28577,     28578,     28579,
-    28580,     28580,     28581,     28582,     28583,     28583,     28584,     28585,
-    28586,     28586,     28587,     28588,     28589,     28589,     28590,     28591,
-    28592,     28592,     28593,     28594,     28595,     28595,     28596,     28597,
-    28598,     28598,     28599,     28600,     28601,     28601,     28602,     28603,
-    28604,     28604,     28605,     28606,     28607,     28607,     28608,     28609,
-    28610,     28610,     28611,     28612,     28613,     28613,     28614,     28615,
-    28616,     28616,     28617,     28618,     28619,     28619,     28620,     28621,
-    28621,     28622,     28623,     28624,     28624,     28625,     28626,     28627,
-    28627,     28628,     28629,     28630,     28630,     28631,     28632,     28633,
-    28633,     28634,     28635,     28636,     28636,     28637,     28638,     28639,
-    28639,     28640,     28641,     28642,     28642,     28643,     28644,     28645,
-    28645,     28646,     28647,     28647,     28648,     28649,     28650,     28650,
-    28651,     28652,     28653,     28653,     28654,     28655,     28656,     28656,
-    28657,     28658,     28659,     28659,     28660,     28661,     28662,     28662,
-    28663,     28664,     28664,     28665,     28666,     28667,     28667,     28668,
-    28669,     28670,     28670,     28671,     28672,     28673,     28673,     28674,
-    28675,     28676,     28676,     28677,     28678,     28678,     28679,     28680,
-    28681,     28681,     28682,     28683,     28684,     28684,     28685,     28686,
-    28687,     28687,     28688,     28689,     28689,     28690,     28691,     28692,
-    28692,     28693,     28694,     28695,     28695,     28696,     28697,     28698,
-    28698,     28699,     28700,     28700,     28701,     28702,     28703,     28703,
-    28704,     28705,     28706,     28706,     28707,     28708,     28708,     28709,
-    28710,     28711,     28711,     28712,     28713,     28714,     28714,     28715,
-    28716,     28717,     28717,     28718,     28719,     28719,     28720,     28721,
-    28722,     28722,     28723,     28724,     28725,     28725,     28726,     28727,
-    28727,     28728,     28729,     28730,     28730,     28731,     28732,     28733,
-    28733,     28734,     28735,     28735,     28736,     28737,     28738,     28738,
-    28739,     28740,     28740,     28741,     28742,     28743,     28743,     28744,
-    28745,     28746,     28746,     28747,     28748,     28748,     28749,     28750,
-    28751,     28751,     28752,     28753,     28754,     28754,     28755,     28756,
-    28756,     28757,     28758,     28759,     28759,     28760,     28761,     28761,
-    28762,     28763,     28764,     28764,     28765,     28766,     28766,     28767,
-    28768,     28769,     28769,     28770,     28771,     28772,     28772,     28773,
-    28774,     28774,     28775,     28776,     28777,     28777,     28778,     28779,
-    28779,     28780,     28781,     28782,     28782,     28783,     28784,     28784,
-    28785,     28786,     28787,     28787,     28788,     28789,     28789,     28790,
-    28791,     28792,     28792,     28793,     28794,     28794,     28795,     28796,
-    28797,     28797,     28798,     28799,     28799,     28800,     28801,     28802,
-    28802,     28803,     28804,     28804,     28805,     28806,     28807,     28807,
-    28808,     28809,     28809,     28810,     28811,     28812,     28812,     28813,
-    28814,     28814,     28815,     28816,     28817,     28817,     28818,     28819,
-    28819,     28820,     28821,     28822,     28822,     28823,     28824,     28824,
-    28825,     28826,     28827,     28827,     28828,     28829,     28829,     28830,
-    28831,     28832,     28832,     28833,     28834,     28834,     28835,     28836,
-    28836,     28837,     28838,     28839,     28839,     28840,     28841,     28841,
-    28842,     28843,     28844,     28844,     28845,     28846,     28846,     28847,
-    28848,     28849,     28849,     28850,     28851,     28851,     28852,     28853,
-    28853,     28854,     28855,     28856,     28856,     28857,     28858,     28858,
-    28859,     28860,     28861,     28861,     28862,     28863,     28863,     28864,
-    28865,     28865,     28866,     28867,     28868,     28868,     28869,     28870,
-    28870,     28871,     28872,     28872,     28873,     28874,     28875,     28875,
-    28876,     28877,     28877,     28878,     28879,     28879,     28880,     28881,
-    28882,     28882,     28883,     28884,     28884,     28885,     28886,     28886,
-    28887,     28888,     28889,     28889,     28890,     28891,     28891,     28892,
-    28893,     28893,     28894,     28895,     28896,     28896,     28897,     28898,
-    28898,     28899,     28900,     28900,     28901,     28902,     28903,     28903,
-    28904,     28905,     28905,     28906,     28907,     28907,     28908,     28909,
-    28910,     28910,     28911,     28912,     28912,     28913,     28914,     28914,
-    28915,     28916,     28916,     28917,     28918,     28919,     28919,     28920,
-    28921,     28921,     28922,     28923,     28923,     28924,     28925,     28925,
-    28926,     28927,     28928,     28928,     28929,     28930,     28930,     28931,
-    28932,     28932,     28933,     28934,     28934,     28935,     28936,     28937,
-    28937,     28938,     28939,     28939,     28940,     28941,     28941,     28942,
-    28943,     28943,     28944,     28945,     28946,     28946,     28947,     28948,
-    28948,     28949,     28950,     28950,     28951,     28952,     28952,     28953,
-    28954,     28955,     28955,     28956,     28957,     28957,     28958,     28959,
-    28959,     28960,     28961,     28961,     28962,     28963,     28963,     28964,
-    28965,     28966,     28966,     28967,     28968,     28968,     28969,     28970,
-    28970,     28971,     28972,     28972,     28973,     28974,     28974,     28975,
-    28976,     28976,     28977,     28978,     28979,     28979,     28980,     28981,
-    28981,     28982,     28983,     28983,     28984,     28985,     28985,     28986,
-    28987,     28987,     28988,     28989,     28989,     28990,     28991,     28992,
-    28992,     28993,     28994,     28994,     28995,     28996,     28996,     28997,
-    28998,     28998,     28999,     29000,     29000,     29001,     29002,     29002,
-    29003,     29004,     29004,     29005,     29006,     29006,     29007,     29008,
-    29009,     29009,     29010,     29011,     29011,     29012,     29013,     29013,
-    29014,     29015,     29015,     29016,     29017,     29017,     29018,     29019,
-    29019,     29020,     29021,     29021,     29022,     29023,     29023,     29024,
-    29025,     29025,     29026,     29027,     29028,     29028,     29029,     29030,
-    29030,     29031,     29032,     29032,     29033,     29034,     29034,     29035,
-    29036,     29036,     29037,     29038,     29038,     29039,     29040,     29040,
-    29041,     29042,     29042,     29043,     29044,     29044,     29045,     29046,
-    29046,     29047,     29048,     29048,     29049,     29050,     29050,     29051,
-    29052,     29052,     29053,     29054,     29054,     29055,     29056,     29056,
-    29057,     29058,     29058,     29059,     29060,     29060,     29061,     29062,
-    29063,     29063,     29064,     29065,     29065,     29066,     29067,     29067,
-    29068,     29069,     29069,     29070,     29071,     29071,     29072,     29073,
-    29073,     29074,     29075,     29075,     29076,     29077,     29077,     29078,
-    29079,     29079,     29080,     29081,     29081,     29082,     29083,     29083,
-    29084,     29085,     29085,     29086,     29087,     29087,     29088,     29089,
-    29089,     29090,     29091,     29091,     29092,     29093,     29093,     29094,
-    29095,     29095,     29096,     29097,     29097,     29098,     29099,     29099,
-    29100,     29101,     29101,     29102,     29103,     29103,     29104,     29104,
-    29105,     29106,     29106,     29107,     29108,     29108,     29109,     29110,
-    29110,     29111,     29112,     29112,     29113,     29114,     29114,     29115,
-    29116,     29116,     29117,     29118,     29118,     29119,     29120,     29120,
-    29121,     29122,     29122,     29123,     29124,     29124,     29125,     29126,
-    29126,     29127,     29128,     29128,     29129,     29130,     29130,     29131,
-    29132,     29132,     29133,     29134,     29134,     29135,     29136,     29136,
-    29137,     29138,     29138,     29139,     29139,     29140,     29141,     29141,
-    29142,     29143,     29143,     29144,     29145,     29145,     29146,     29147,
-    29147,     29148,     29149,     29149,     29150,     29151,     29151,     29152,
-    29153,     29153,     29154,     29155,     29155,     29156,     29157,     29157,
-    29158,     29158,     29159,     29160,     29160,     29161,     29162,     29162,
-    29163,     29164,     29164,     29165,     29166,     29166,     29167,     29168,
-    29168,     29169,     29170,     29170,     29171,     29172,     29172,     29173,
-    29173,     29174,     29175,     29175,     29176,     29177,     29177,     29178,
-    29179,     29179,     29180,     29181,     29181,     29182,     29183,     29183,
-    29184,     29185,     29185,     29186,     29186,     29187,     29188,     29188,
-    29189,     29190,     29190,     29191,     29192,     29192,     29193,     29194,
-    29194,     29195,     29196,     29196,     29197,     29198,     29198,     29199,
-    29199,     29200,     29201,     29201,     29202,     29203,     29203,     29204,
-    29205,     29205,     29206,     29207,     29207,     29208,     29208,     29209,
-    29210,     29210,     29211,     29212,     29212,     29213,     29214,     29214,
-    29215,     29216,     29216,     29217,     29218,     29218,     29219,     29219,
-    29220,     29221,     29221,     29222,     29223,     29223,     29224,     29225,
-    29225,     29226,     29227,     29227,     29228,     29228,     29229,     29230,
-    29230,     29231,     29232,     29232,     29233,     29234,     29234,     29235,
-    29235,     29236,     29237,     29237,     29238,     29239,     29239,     29240,
-    29241,     29241,     29242,     29243,     29243,     29244,     29244,     29245,
-    29246,     29246,     29247,     29248,     29248,     29249,     29250,     29250,
-    29251,     29251,     29252,     29253,     29253,     29254,     29255,     29255,
-    29256,     29257,     29257,     29258,     29258,     29259,     29260,     29260,
-    29261,     29262,     29262,     29263,     29264,     29264,     29265,     29265,
-    29266,     29267,     29267,     29268,     29269,     29269,     29270,     29271,
-    29271,     29272,     29272,     29273,     29274,     29274,     29275,     29276,
-    29276,     29277,     29278,     29278,     29279,     29279,     29280,     29281,
-    29281,     29282,     29283,     29283,     29284,     29284,     29285,     29286,
-    29286,     29287,     29288,     29288,     29289,     29290,     29290,     29291,
-    29291,     29292,     29293,     29293,     29294,     29295,     29295,     29296,
-    29296,     29297,     29298,     29298,     29299,     29300,     29300,     29301,
-    29302,     29302,     29303,     29303,     29304,     29305,     29305,     29306,
-    29307,     29307,     29308,     29308,     29309,     29310,     29310,     29311,
-    29312,     29312,     29313,     29313,     29314,     29315,     29315,     29316,
-    29317,     29317,     29318,     29318,     29319,     29320,     29320,     29321,
-    29322,     29322,     29323,     29323,     29324,     29325,     29325,     29326,
-    29327,     29327,     29328,     29328,     29329,     29330,     29330,     29331,
-    29332,     29332,     29333,     29333,     29334,     29335,     29335,     29336,
-    29337,     29337,     29338,     29338,     29339,     29340,     29340,     29341,
-    29342,     29342,     29343,     29343,     29344,     29345,     29345,     29346,
-    29347,     29347,     29348,     29348,     29349,     29350,     29350,     29351,
-    29352,     29352,     29353,     29353,     29354,     29355,     29355,     29356,
-    29356,     29357,     29358,     29358,     29359,     29360,     29360,     29361,
-    29361,     29362,     29363,     29363,     29364,     29365,     29365,     29366,
-    29366,     29367,     29368,     29368,     29369,     29369,     29370,     29371,
-    29371,     29372,     29373,     29373,     29374,     29374,     29375,     29376,
-    29376,     29377,     29377,     29378,     29379,     29379,     29380,     29381,
-    29381,     29382,     29382,     29383,     29384,     29384,     29385,     29386,
-    29386,     29387,     29387,     29388,     29389,     29389,     29390,     29390,
-    29391,     29392,     29392,     29393,     29393,     29394,     29395,     29395,
-    29396,     29397,     29397,     29398,     29398,     29399,     29400,     29400,
-    29401,     29401,     29402,     29403,     29403,     29404,     29405,     29405,
-    29406,     29406,     29407,     29408,     29408,     29409,     29409,     29410,
-    29411,     29411,     29412,     29412,     29413,     29414,     29414,     29415,
-    29416,     29416,     29417,     29417,     29418,     29419,     29419,     29420,
-    29420,     29421,     29422,     29422,     29423,     29423,     29424,     29425,
-    29425,     29426,     29426,     29427,     29428,     29428,     29429,     29429,
-    29430,     29431,     29431,     29432,     29433,     29433,     29434,     29434,
-    29435,     29436,     29436,     29437,     29437,     29438,     29439,     29439,
-    29440,     29440,     29441,     29442,     29442,     29443,     29443,     29444,
-    29445,     29445,     29446,     29446,     29447,     29448,     29448,     29449,
-    29449,     29450,     29451,     29451,     29452,     29453,     29453,     29454,
-    29454,     29455,     29456,     29456,     29457,     29457,     29458,     29459,
-    29459,     29460,     29460,     29461,     29462,     29462,     29463,     29463,
-    29464,     29465,     29465,     29466,     29466,     29467,     29468,     29468,
-    29469,     29469,     29470,     29471,     29471,     29472,     29472,     29473,
-    29474,     29474,     29475,     29475,     29476,     29477,     29477,     29478,
-    29478,     29479,     29480,     29480,     29481,     29481,     29482,     29483,
-    29483,     29484,     29484,     29485,     29486,     29486,     29487,     29487,
-    29488,     29489,     29489,     29490,     29490,     29491,     29491,     29492,
-    29493,     29493,     29494,     29494,     29495,     29496,     29496,     29497,
-    29497,     29498,     29499,     29499,     29500,     29500,     29501,     29502,
-    29502,     29503,     29503,     29504,     29505,     29505,     29506,     29506,
-    29507,     29508,     29508,     29509,     29509,     29510,     29511,     29511,
-    29512,     29512,     29513,     29514,     29514,     29515,     29515,     29516,
-    29516,     29517,     29518,     29518,     29519,     29519,     29520,     29521,
-    29521,     29522,     29522,     29523,     29524,     29524,     29525,     29525,
-    29526,     29527,     29527,     29528,     29528,     29529,     29529,     29530,
-    29531,     29531,     29532,     29532,     29533,     29534,     29534,     29535,
-    29535,     29536,     29537,     29537,     29538,     29538,     29539,     29539,
-    29540,     29541,     29541,     29542,     29542,     29543,     29544,     29544,
-    29545,     29545,     29546,     29547,     29547,     29548,     29548,     29549,
-    29549,     29550,     29551,     29551,     29552,     29552,     29553,     29554,
-    29554,     29555,     29555,     29556,     29557,     29557,     29558,     29558,
-    29559,     29559,     29560,     29561,     29561,     29562,     29562,     29563,
-    29564,     29564,     29565,     29565,     29566,     29566,     29567,     29568,
-    29568,     29569,     29569,     29570,     29571,     29571,     29572,     29572,
-    29573,     29573,     29574,     29575,     29575,     29576,     29576,     29577,
-    29578,     29578,     29579,     29579,     29580,     29580,     29581,     29582,
-    29582,     29583,     29583,     29584,     29584,     29585,     29586,     29586,
-    29587,     29587,     29588,     29589,     29589,     29590,     29590,     29591,
-    29591,     29592,     29593,     29593,     29594,     29594,     29595,     29595,
-    29596,     29597,     29597,     29598,     29598,     29599,     29600,     29600,
-    29601,     29601,     29602,     29602,     29603,     29604,     29604,     29605,
-    29605,     29606,     29606,     29607,     29608,     29608,     29609,     29609,
-    29610,     29611,     29611,     29612,     29612,     29613,     29613,     29614,
-    29615,     29615,     29616,     29616,     29617,     29617,     29618,     29619,
-    29619,     29620,     29620,     29621,     29621,     29622,     29623,     29623,
-    29624,     29624,     29625,     29625,     29626,     29627,     29627,     29628,
-    29628,     29629,     29629,     29630,     29631,     29631,     29632,     29632,
-    29633,     29633,     29634,     29635,     29635,     29636,     29636,     29637,
-    29637,     29638,     29639,     29639,     29640,     29640,     29641,     29641,
-    29642,     29643,     29643,     29644,     29644,     29645,     29645,     29646,
-    29647,     29647,     29648,     29648,     29649,     29649,     29650,     29651,
-    29651,     29652,     29652,     29653,     29653,     29654,     29655,     29655,
-    29656,     29656,     29657,     29657,     29658,     29659,     29659,     29660,
-    29660,     29661,     29661,     29662,     29663,     29663,     29664,     29664,
-    29665,     29665,     29666,     29666,     29667,     29668,     29668,     29669,
-    29669,     29670,     29670,     29671,     29672,     29672,     29673,     29673,
-    29674,     29674,     29675,     29676,     29676,     29677,     29677,     29678,
-    29678,     29679,     29679,     29680,     29681,     29681,     29682,     29682,
-    29683,     29683,     29684,     29685,     29685,     29686,     29686,     29687,
-    29687,     29688,     29688,     29689,     29690,     29690,     29691,     29691,
-    29692,     29692,     29693,     29694,     29694,     29695,     29695,     29696,
-    29696,     29697,     29697,     29698,     29699,     29699,     29700,     29700,
-    29701,     29701,     29702,     29703,     29703,     29704,     29704,     29705,
-    29705,     29706,     29706,     29707,     29708,     29708,     29709,     29709,
-    29710,     29710,     29711,     29711,     29712,     29713,     29713,     29714,
-    29714,     29715,     29715,     29716,     29716,     29717,     29718,     29718,
-    29719,     29719,     29720,     29720,     29721,     29722,     29722,     29723,
-    29723,     29724,     29724,     29725,     29725,     29726,     29727,     29727,
-    29728,     29728,     29729,     29729,     29730,     29730,     29731,     29732,
-    29732,     29733,     29733,     29734,     29734,     29735,     29735,     29736,
-    29737,     29737,     29738,     29738,     29739,     29739,     29740,     29740,
-    29741,     29741,     29742,     29743,     29743,     29744,     29744,     29745,
-    29745,     29746,     29746,     29747,     29748,     29748,     29749,     29749,
-    29750,     29750,     29751,     29751,     29752,     29753,     29753,     29754,
-    29754,     29755,     29755,     29756,     29756,     29757,     29757,     29758,
-    29759,     29759,     29760,     29760,     29761,     29761,     29762,     29762,
-    29763,     29764,     29764,     29765,     29765,     29766,     29766,     29767,
-    29767,     29768,     29768,     29769,     29770,     29770,     29771,     29771,
-    29772,     29772,     29773,     29773,     29774,     29775,     29775,     29776,
-    29776,     29777,     29777,     29778,     29778,     29779,     29779,     29780,
-    29781,     29781,     29782,     29782,     29783,     29783,     29784,     29784,
-    29785,     29785,     29786,     29787,     29787,     29788,     29788,     29789,
-    29789,     29790,     29790,     29791,     29791,     29792,     29793,     29793,
-    29794,     29794,     29795,     29795,     29796,     29796,     29797,     29797,
-    29798,     29799,     29799,     29800,     29800,     29801,     29801,     29802,
-    29802,     29803,     29803,     29804,     29804,     29805,     29806,     29806,
-    29807,     29807,     29808,     29808,     29809,     29809,     29810,     29810,
-    29811,     29812,     29812,     29813,     29813,     29814,     29814,     29815,
-    29815,     29816,     29816,     29817,     29817,     29818,     29819,     29819,
-    29820,     29820,     29821,     29821,     29822,     29822,     29823,     29823,
-    29824,     29824,     29825,     29826,     29826,     29827,     29827,     29828,
-    29828,     29829,     29829,     29830,     29830,     29831,     29831,     29832,
-    29833,     29833,     29834,     29834,     29835,     29835,     29836,     29836,
-    29837,     29837,     29838,     29838,     29839,     29840,     29840,     29841,
-    29841,     29842,     29842,     29843,     29843,     29844,     29844,     29845,
-    29845,     29846,     29846,     29847,     29848,     29848,     29849,     29849,
-    29850,     29850,     29851,     29851,     29852,     29852,     29853,     29853,
-    29854,     29855,     29855,     29856,     29856,     29857,     29857,     29858,
-    29858,     29859,     29859,     29860,     29860,     29861,     29861,     29862,
-    29863,     29863,     29864,     29864,     29865,     29865,     29866,     29866,
-    29867,     29867,     29868,     29868,     29869,     29869,     29870,     29870,
-    29871,     29872,     29872,     29873,     29873,     29874,     29874,     29875,
-    29875,     29876,     29876,     29877,     29877,     29878,     29878,     29879,
-    29879,     29880,     29881,     29881,     29882,     29882,     29883,     29883,
-    29884,     29884,     29885,     29885,     29886,     29886,     29887,     29887,
-    29888,     29888,     29889,     29890,     29890,     29891,     29891,     29892,
-    29892,     29893,     29893,     29894,     29894,     29895,     29895,     29896,
-    29896,     29897,     29897,     29898,     29898,     29899,     29900,     29900,
-    29901,     29901,     29902,     29902,     29903,     29903,     29904,     29904,
-    29905,     29905,     29906,     29906,     29907,     29907,     29908,     29908,
-    29909,     29909,     29910,     29911,     29911,     29912,     29912,     29913,
-    29913,     29914,     29914,     29915,     29915,     29916,     29916,     29917,
-    29917,     29918,     29918,     29919,     29919,     29920,     29920,     29921,
-    29922,     29922,     29923,     29923,     29924,     29924,     29925,     29925,
-    29926,     29926,     29927,     29927,     29928,     29928,     29929,     29929,
-    29930,     29930,     29931,     29931,     29932,     29932,     29933,     29934,
-    29934,     29935,     29935,     29936,     29936,     29937,     29937,     29938,
-    29938,     29939,     29939,     29940,     29940,     29941,     29941,     29942,
-    29942,     29943,     29943,     29944,     29944,     29945,     29945,     29946,
-    29946,     29947,     29948,     29948,     29949,     29949,     29950,     29950,
-    29951,     29951,     29952,     29952,     29953,     29953,     29954,     29954,
-    29955,     29955,     29956,     29956,     29957,     29957,     29958,     29958,
-    29959,     29959,     29960,     29960,     29961,     29961,     29962,     29962,
-    29963,     29963,     29964,     29965,     29965,     29966,     29966,     29967,
-    29967,     29968,     29968,     29969,     29969,     29970,     29970,     29971,
-    29971,     29972,     29972,     29973,     29973,     29974,     29974,     29975,
-    29975,     29976,     29976,     29977,     29977,     29978,     29978,     29979,
-    29979,     29980,     29980,     29981,     29981,     29982,     29982,     29983,
-    29983,     29984,     29985,     29985,     29986,     29986,     29987,     29987,
-    29988,     29988,     29989,     29989,     29990,     29990,     29991,     29991,
-    29992,     29992,     29993,     29993,     29994,     29994,     29995,     29995,
-    29996,     29996,     29997,     29997,     29998,     29998,     29999,     29999,
-    30000,     30000,     30001,     30001,     30002,     30002,     30003,     30003,
-    30004,     30004,     30005,     30005,     30006,     30006,     30007,     30007,
-    30008,     30008,     30009,     30009,     30010,     30010,     30011,     30011,
-    30012,     30012,     30013,     30013,     30014,     30014,     30015,     30016,
-    30016,     30017,     30017,     30018,     30018,     30019,     30019,     30020,
-    30020,     30021,     30021,     30022,     30022,     30023,     30023,     30024,
-    30024,     30025,     30025,     30026,     30026,     30027,     30027,     30028,
-    30028,     30029,     30029,     30030,     30030,     30031,     30031,     30032,
-    30032,     30033,     30033,     30034,     30034,     30035,     30035,     30036,
-    30036,     30037,     30037,     30038,     30038,     30039,     30039,     30040,
-    30040,     30041,     30041,     30042,     30042,     30043,     30043,     30044,
-    30044,     30045,     30045,     30046,     30046,     30047,     30047,     30048,
-    30048,     30049,     30049,     30050,     30050,     30051,     30051,     30052,
-    30052,     30053,     30053,     30054,     30054,     30055,     30055,     30056,
-    30056,     30057,     30057,     30058,     30058,     30059,     30059,     30060,
-    30060,     30061,     30061,     30062,     30062,     30063,     30063,     30064,
-    30064,     30065,     30065,     30066,     30066,     30067,     30067,     30068,
-    30068,     30069,     30069,     30070,     30070,     30071,     30071,     30072,
-    30072,     30073,     30073,     30074,     30074,     30075,     30075,     30076,
-    30076,     30077,     30077,     30077,     30078,     30078,     30079,     30079,
-    30080,     30080,     30081,     30081,     30082,     30082,     30083,     30083,
-    30084,     30084,     30085,     30085,     30086,     30086,     30087,     30087,
-    30088,     30088,     30089,     30089,     30090,     30090,     30091,     30091,
-    30092,     30092,     30093,     30093,     30094,     30094,     30095,     30095,
-    30096,     30096,     30097,     30097,     30098,     30098,     30099,     30099,
-    30100,     30100,     30101,     30101,     30102,     30102,     30103,     30103,
-    30104,     30104,     30105,     30105,     30106,     30106,     30107,     30107,
-    30107,     30108,     30108,     30109,     30109,     30110,     30110,     30111,
-    30111,     30112,     30112,     30113,     30113,     30114,     30114,     30115,
-    30115,     30116,     30116,     30117,     30117,     30118,     30118,     30119,
-    30119,     30120,     30120,     30121,     30121,     30122,     30122,     30123,
-    30123,     30124,     30124,     30125,     30125,     30126,     30126,     30127,
-    30127,     30127,     30128,     30128,     30129,     30129,     30130,     30130,
-    30131,     30131,     30132,     30132,     30133,     30133,     30134,     30134,
-    30135,     30135,     30136,     30136,     30137,     30137,     30138,     30138,
-    30139,     30139,     30140,     30140,     30141,     30141,     30142,     30142,
-    30142,     30143,     30143,     30144,     30144,     30145,     30145,     30146,
-    30146,     30147,     30147,     30148,     30148,     30149,     30149,     30150,
-    30150,     30151,     30151,     30152,     30152,     30153,     30153,     30154,
-    30154,     30155,     30155,     30156,     30156,     30156,     30157,     30157,
-    30158,     30158,     30159,     30159,     30160,     30160,     30161,     30161,
-    30162,     30162,     30163,     30163,     30164,     30164,     30165,     30165,
-    30166,     30166,     30167,     30167,     30167,     30168,     30168,     30169,
-    30169,     30170,     30170,     30171,     30171,     30172,     30172,     30173,
-    30173,     30174,     30174,     30175,     30175,     30176,     30176,     30177,
-    30177,     30178,     30178,     30178,     30179,     30179,     30180,     30180,
-    30181,     30181,     30182,     30182,     30183,     30183,     30184,     30184,
-    30185,     30185,     30186,     30186,     30187,     30187,     30188,     30188,
-    30188,     30189,     30189,     30190,     30190,     30191,     30191,     30192,
-    30192,     30193,     30193,     30194,     30194,     30195,     30195,     30196,
-    30196,     30197,     30197,     30197,     30198,     30198,     30199,     30199,
-    30200,     30200,     30201,     30201,     30202,     30202,     30203,     30203,
-    30204,     30204,     30205,     30205,     30206,     30206,     30206,     30207,
-    30207,     30208,     30208,     30209,     30209,     30210,     30210,     30211,
-    30211,     30212,     30212,     30213,     30213,     30214,     30214,     30214,
-    30215,     30215,     30216,     30216,     30217,     30217,     30218,     30218,
-    30219,     30219,     30220,     30220,     30221,     30221,     30222,     30222,
-    30222,     30223,     30223,     30224,     30224,     30225,     30225,     30226,
-    30226,     30227,     30227,     30228,     30228,     30229,     30229,     30229,
-    30230,     30230,     30231,     30231,     30232,     30232,     30233,     30233,
-    30234,     30234,     30235,     30235,     30236,     30236,     30236,     30237,
-    30237,     30238,     30238,     30239,     30239,     30240,     30240,     30241,
-    30241,     30242,     30242,     30243,     30243,     30243,     30244,     30244,
-    30245,     30245,     30246,     30246,     30247,     30247,     30248,     30248,
-    30249,     30249,     30250,     30250,     30250,     30251,     30251,     30252,
-    30252,     30253,     30253,     30254,     30254,     30255,     30255,     30256,
-    30256,     30256,     30257,     30257,     30258,     30258,     30259,     30259,
-    30260,     30260,     30261,     30261,     30262,     30262,     30262,     30263,
-    30263,     30264,     30264,     30265,     30265,     30266,     30266,     30267,
-    30267,     30268,     30268,     30268,     30269,     30269,     30270,     30270,
-    30271,     30271,     30272,     30272,     30273,     30273,     30274,     30274,
-    30274,     30275,     30275,     30276,     30276,     30277,     30277,     30278,
-    30278,     30279,     30279,     30279,     30280,     30280,     30281,     30281,
-    30282,     30282,     30283,     30283,     30284,     30284,     30285,     30285,
-    30285,     30286,     30286,     30287,     30287,     30288,     30288,     30289,
-    30289,     30290,     30290,     30290,     30291,     30291,     30292,     30292,
-    30293,     30293,     30294,     30294,     30295,     30295,     30296,     30296,
-    30296,     30297,     30297,     30298,     30298,     30299,     30299,     30300,
-    30300,     30301,     30301,     30301,     30302,     30302,     30303,     30303,
-    30304,     30304,     30305,     30305,     30306,     30306,     30306,     30307,
-    30307,     30308,     30308,     30309,     30309,     30310,     30310,     30311,
-    30311,     30311,     30312,     30312,     30313,     30313,     30314,     30314,
-    30315,     30315,     30315,     30316,     30316,     30317,     30317,     30318,
-    30318,     30319,     30319,     30320,     30320,     30320,     30321,     30321,
-    30322,     30322,     30323,     30323,     30324,     30324,     30325,     30325,
-    30325,     30326,     30326,     30327,     30327,     30328,     30328,     30329,
-    30329,     30329,     30330,     30330,     30331,     30331,     30332,     30332,
-    30333,     30333,     30334,     30334,     30334,     30335,     30335,     30336,
-    30336,     30337,     30337,     30338,     30338,     30338,     30339,     30339,
-    30340,     30340,     30341,     30341,     30342,     30342,     30342,     30343,
-    30343,     30344,     30344,     30345,     30345,     30346,     30346,     30347,
-    30347,     30347,     30348,     30348,     30349,     30349,     30350,     30350,
-    30351,     30351,     30351,     30352,     30352,     30353,     30353,     30354,
-    30354,     30355,     30355,     30355,     30356,     30356,     30357,     30357,
-    30358,     30358,     30359,     30359,     30359,     30360,     30360,     30361,
-    30361,     30362,     30362,     30363,     30363,     30363,     30364,     30364,
-    30365,     30365,     30366,     30366,     30367,     30367,     30367,     30368,
-    30368,     30369,     30369,     30370,     30370,     30371,     30371,     30371,
-    30372,     30372,     30373,     30373,     30374,     30374,     30375,     30375,
-    30375,     30376,     30376,     30377,     30377,     30378,     30378,     30378,
-    30379,     30379,     30380,     30380,     30381,     30381,     30382,     30382,
-    30382,     30383,     30383,     30384,     30384,     30385,     30385,     30386,
-    30386,     30386,     30387,     30387,     30388,     30388,     30389,     30389,
-    30389,     30390,     30390,     30391,     30391,     30392,     30392,     30393,
-    30393,     30393,     30394,     30394,     30395,     30395,     30396,     30396,
-    30397,     30397,     30397,     30398,     30398,     30399,     30399,     30400,
-    30400,     30400,     30401,     30401,     30402,     30402,     30403,     30403,
-    30404,     30404,     30404,     30405,     30405,     30406,     30406,     30407,
-    30407,     30407,     30408,     30408,     30409,     30409,     30410,     30410,
-    30410,     30411,     30411,     30412,     30412,     30413,     30413,     30414,
-    30414,     30414,     30415,     30415,     30416,     30416,     30417,     30417,
-    30417,     30418,     30418,     30419,     30419,     30420,     30420,     30420,
-    30421,     30421,     30422,     30422,     30423,     30423,     30424,     30424,
-    30424,     30425,     30425,     30426,     30426,     30427,     30427,     30427,
-    30428,     30428,     30429,     30429,     30430,     30430,     30430,     30431,
-    30431,     30432,     30432,     30433,     30433,     30433,     30434,     30434,
-    30435,     30435,     30436,     30436,     30436,     30437,     30437,     30438,
-    30438,     30439,     30439,     30439,     30440,     30440,     30441,     30441,
-    30442,     30442,     30443,     30443,     30443,     30444,     30444,     30445,
-    30445,     30446,     30446,     30446,     30447,     30447,     30448,     30448,
-    30449,     30449,     30449,     30450,     30450,     30451,     30451,     30452,
-    30452,     30452,     30453,     30453,     30454,     30454,     30455,     30455,
-    30455,     30456,     30456,     30457,     30457,     30458,     30458,     30458,
-    30459,     30459,     30460,     30460,     30460,     30461,     30461,     30462,
-    30462,     30463,     30463,     30463,     30464,     30464,     30465,     30465,
-    30466,     30466,     30466,     30467,     30467,     30468,     30468,     30469,
-    30469,     30469,     30470,     30470,     30471,     30471,     30472,     30472,
-    30472,     30473,     30473,     30474,     30474,     30475,     30475,     30475,
-    30476,     30476,     30477,     30477,     30477,     30478,     30478,     30479,
-    30479,     30480,     30480,     30480,     30481,     30481,     30482,     30482,
-    30483,     30483,     30483,     30484,     30484,     30485,     30485,     30486,
-    30486,     30486,     30487,     30487,     30488,     30488,     30488,     30489,
-    30489,     30490,     30490,     30491,     30491,     30491,     30492,     30492,
-    30493,     30493,     30494,     30494,     30494,     30495,     30495,     30496,
-    30496,     30496,     30497,     30497,     30498,     30498,     30499,     30499,
-    30499,     30500,     30500,     30501,     30501,     30502,     30502,     30502,
-    30503,     30503,     30504,     30504,     30504,     30505,     30505,     30506,
-    30506,     30507,     30507,     30507,     30508,     30508,     30509,     30509,
-    30509,     30510,     30510,     30511,     30511,     30512,     30512,     30512,
-    30513,     30513,     30514,     30514,     30514,     30515,     30515,     30516,
-    30516,     30517,     30517,     30517,     30518,     30518,     30519,     30519,
-    30519,     30520,     30520,     30521,     30521,     30522,     30522,     30522,
-    30523,     30523,     30524,     30524,     30524,     30525,     30525,     30526,
-    30526,     30527,     30527,     30527,     30528,     30528,     30529,     30529,
-    30529,     30530,     30530,     30531,     30531,     30532,     30532,     30532,
-    30533,     30533,     30534,     30534,     30534,     30535,     30535,     30536,
-    30536,     30536,     30537,     30537,     30538,     30538,     30539,     30539,
-    30539,     30540,     30540,     30541,     30541,     30541,     30542,     30542,
-    30543,     30543,     30543,     30544,     30544,     30545,     30545,     30546,
-    30546,     30546,     30547,     30547,     30548,     30548,     30548,     30549,
-    30549,     30550,     30550,     30550,     30551,     30551,     30552,     30552,
-    30553,     30553,     30553,     30554,     30554,     30555,     30555,     30555,
-    30556,     30556,     30557,     30557,     30557,     30558,     30558,     30559,
-    30559,     30559,     30560,     30560,     30561,     30561,     30562,     30562,
-    30562,     30563,     30563,     30564,     30564,     30564,     30565,     30565,
-    30566,     30566,     30566,     30567,     30567,     30568,     30568,     30568,
-    30569,     30569,     30570,     30570,     30571,     30571,     30571,     30572,
-    30572,     30573,     30573,     30573,     30574,     30574,     30575,     30575,
-    30575,     30576,     30576,     30577,     30577,     30577,     30578,     30578,
-    30579,     30579,     30579,     30580,     30580,     30581,     30581,     30581,
-    30582,     30582,     30583,     30583,     30583,     30584,     30584,     30585,
-    30585,     30586,     30586,     30586,     30587,     30587,     30588,     30588,
-    30588,     30589,     30589,     30590,     30590,     30590,     30591,     30591,
-    30592,     30592,     30592,     30593,     30593,     30594,     30594,     30594,
-    30595,     30595,     30596,     30596,     30596,     30597,     30597,     30598,
-    30598,     30598,     30599,     30599,     30600,     30600,     30600,     30601,
-    30601,     30602,     30602,     30602,     30603,     30603,     30604,     30604,
-    30604,     30605,     30605,     30606,     30606,     30606,     30607,     30607,
-    30608,     30608,     30608,     30609,     30609,     30610,     30610,     30610,
-    30611,     30611,     30612,     30612,     30612,     30613,     30613,     30614,
-    30614,     30614,     30615,     30615,     30616,     30616,     30616,     30617,
-    30617,     30618,     30618,     30618,     30619,     30619,     30620,     30620,
-    30620,     30621,     30621,     30622,     30622,     30622,     30623,     30623,
-    30624,     30624,     30624,     30625,     30625,     30626,     30626,     30626,
-    30627,     30627,     30628,     30628,     30628,     30629,     30629,     30630,
-    30630,     30630,     30631,     30631,     30632,     30632,     30632,     30633,
-    30633,     30634,     30634,     30634,     30635,     30635,     30635,     30636,
-    30636,     30637,     30637,     30637,     30638,     30638,     30639,     30639,
-    30639,     30640,     30640,     30641,     30641,     30641,     30642,     30642,
-    30643,     30643,     30643,     30644,     30644,     30645,     30645,     30645,
-    30646,     30646,     30647,     30647,     30647,     30648,     30648,     30648,
-    30649,     30649,     30650,     30650,     30650,     30651,     30651,     30652,
-    30652,     30652,     30653,     30653,     30654,     30654,     30654,     30655,
-    30655,     30656,     30656,     30656,     30657,     30657,     30658,     30658,
-    30658,     30659,     30659,     30659,     30660,     30660,     30661,     30661,
-    30661,     30662,     30662,     30663,     30663,     30663,     30664,     30664,
-    30665,     30665,     30665,     30666,     30666,     30666,     30667,     30667,
-    30668,     30668,     30668,     30669,     30669,     30670,     30670,     30670,
-    30671,     30671,     30672,     30672,     30672,     30673,     30673,     30674,
-    30674,     30674,     30675,     30675,     30675,     30676,     30676,     30677,
-    30677,     30677,     30678,     30678,     30679,     30679,     30679,     30680,
-    30680,     30680,     30681,     30681,     30682,     30682,     30682,     30683,
-    30683,     30684,     30684,     30684,     30685,     30685,     30686,     30686,
-    30686,     30687,     30687,     30687,     30688,     30688,     30689,     30689,
-    30689,     30690,     30690,     30691,     30691,     30691,     30692,     30692,
-    30692,     30693,     30693,     30694,     30694,     30694,     30695,     30695,
-    30696,     30696,     30696,     30697,     30697,     30697,     30698,     30698,
-    30699,     30699,     30699,     30700,     30700,     30701,     30701,     30701,
-    30702,     30702,     30702,     30703,     30703,     30704,     30704,     30704,
-    30705,     30705,     30706,     30706,     30706,     30707,     30707,     30707,
-    30708,     30708,     30709,     30709,     30709,     30710,     30710,     30710,
-    30711,     30711,     30712,     30712,     30712,     30713,     30713,     30714,
-    30714,     30714,     30715,     30715,     30715,     30716,     30716,     30717,
-    30717,     30717,     30718,     30718,     30718,     30719,     30719,     30720,
-    30720,     30720,     30721,     30721,     30722,     30722,     30722,     30723,
-    30723,     30723,     30724,     30724,     30725,     30725,     30725,     30726,
-    30726,     30726,     30727,     30727,     30728,     30728,     30728,     30729,
-    30729,     30729,     30730,     30730,     30731,     30731,     30731,     30732,
-    30732,     30733,     30733,     30733,     30734,     30734,     30734,     30735,
-    30735,     30736,     30736,     30736,     30737,     30737,     30737,     30738,
-    30738,     30739,     30739,     30739,     30740,     30740,     30740,     30741,
-    30741,     30742,     30742,     30742,     30743,     30743,     30743,     30744,
-    30744,     30745,     30745,     30745,     30746,     30746,     30746,     30747,
-    30747,     30748,     30748,     30748,     30749,     30749,     30749,     30750,
-    30750,     30751,     30751,     30751,     30752,     30752,     30752,     30753,
-    30753,     30754,     30754,     30754,     30755,     30755,     30755,     30756,
-    30756,     30757,     30757,     30757,     30758,     30758,     30758,     30759,
-    30759,     30760,     30760,     30760,     30761,     30761,     30761,     30762,
-    30762,     30763,     30763,     30763,     30764,     30764,     30764,     30765,
-    30765,     30766,     30766,     30766,     30767,     30767,     30767,     30768,
-    30768,     30768,     30769,     30769,     30770,     30770,     30770,     30771,
-    30771,     30771,     30772,     30772,     30773,     30773,     30773,     30774,
-    30774,     30774,     30775,     30775,     30776,     30776,     30776,     30777,
-    30777,     30777,     30778,     30778,     30778,     30779,     30779,     30780,
-    30780,     30780,     30781,     30781,     30781,     30782,     30782,     30783,
-    30783,     30783,     30784,     30784,     30784,     30785,     30785,     30785,
-    30786,     30786,     30787,     30787,     30787,     30788,     30788,     30788,
-    30789,     30789,     30790,     30790,     30790,     30791,     30791,     30791,
-    30792,     30792,     30792,     30793,     30793,     30794,     30794,     30794,
-    30795,     30795,     30795,     30796,     30796,     30797,     30797,     30797,
-    30798,     30798,     30798,     30799,     30799,     30799,     30800,     30800,
-    30801,     30801,     30801,     30802,     30802,     30802,     30803,     30803,
-    30803,     30804,     30804,     30805,     30805,     30805,     30806,     30806,
-    30806,     30807,     30807,     30807,     30808,     30808,     30809,     30809,
-    30809,     30810,     30810,     30810,     30811,     30811,     30811,     30812,
-    30812,     30813,     30813,     30813,     30814,     30814,     30814,     30815,
-    30815,     30815,     30816,     30816,     30817,     30817,     30817,     30818,
-    30818,     30818,     30819,     30819,     30819,     30820,     30820,     30821,
-    30821,     30821,     30822,     30822,     30822,     30823,     30823,     30823,
-    30824,     30824,     30825,     30825,     30825,     30826,     30826,     30826,
-    30827,     30827,     30827,     30828,     30828,     30829,     30829,     30829,
-    30830,     30830,     30830,     30831,     30831,     30831,     30832,     30832,
-    30832,     30833,     30833,     30834,     30834,     30834,     30835,     30835,
-    30835,     30836,     30836,     30836,     30837,     30837,     30838,     30838,
-    30838,     30839,     30839,     30839,     30840,     30840,     30840,     30841,
-    30841,     30841,     30842,     30842,     30843,     30843,     30843,     30844,
-    30844,     30844,     30845,     30845,     30845,     30846,     30846,     30846,
-    30847,     30847,     30848,     30848,     30848,     30849,     30849,     30849,
-    30850,     30850,     30850,     30851,     30851,     30851,     30852,     30852,
-    30853,     30853,     30853,     30854,     30854,     30854,     30855,     30855,
-    30855,     30856,     30856,     30856,     30857,     30857,     30858,     30858,
-    30858,     30859,     30859,     30859,     30860,     30860,     30860,     30861,
-    30861,     30861,     30862,     30862,     30862,     30863,     30863,     30864,
-    30864,     30864,     30865,     30865,     30865,     30866,     30866,     30866,
-    30867,     30867,     30867,     30868,     30868,     30868,     30869,     30869,
-    30870,     30870,     30870,     30871,     30871,     30871,     30872,     30872,
-    30872,     30873,     30873,     30873,     30874,     30874,     30874,     30875,
-    30875,     30876,     30876,     30876,     30877,     30877,     30877,     30878,
-    30878,     30878,     30879,     30879,     30879,     30880,     30880,     30880,
-    30881,     30881,     30882,     30882,     30882,     30883,     30883,     30883,
-    30884,     30884,     30884,     30885,     30885,     30885,     30886,     30886,
-    30886,     30887,     30887,     30887,     30888,     30888,     30889,     30889,
-    30889,     30890,     30890,     30890,     30891,     30891,     30891,     30892,
-    30892,     30892,     30893,     30893,     30893,     30894,     30894,     30894,
-    30895,     30895,     30896,     30896,     30896,     30897,     30897,     30897,
-    30898,     30898,     30898,     30899,     30899,     30899,     30900,     30900,
-    30900,     30901,     30901,     30901,     30902,     30902,     30902,     30903,
-    30903,     30904,     30904,     30904,     30905,     30905,     30905,     30906,
-    30906,     30906,     30907,     30907,     30907,     30908,     30908,     30908,
-    30909,     30909,     30909,     30910,     30910,     30910,     30911,     30911,
-    30911,     30912,     30912,     30913,     30913,     30913,     30914,     30914,
-    30914,     30915,     30915,     30915,     30916,     30916,     30916,     30917,
-    30917,     30917,     30918,     30918,     30918,     30919,     30919,     30919,
-    30920,     30920,     30920,     30921,     30921,     30921,     30922,     30922,
-    30923,     30923,     30923,     30924,     30924,     30924,     30925,     30925,
-    30925,     30926,     30926,     30926,     30927,     30927,     30927,     30928,
-    30928,     30928,     30929,     30929,     30929,     30930,     30930,     30930,
-    30931,     30931,     30931,     30932,     30932,     30932,     30933,     30933,
-    30933,     30934,     30934,     30934,     30935,     30935,     30936,     30936,
-    30936,     30937,     30937,     30937,     30938,     30938,     30938,     30939,
-    30939,     30939,     30940,     30940,     30940,     30941,     30941,     30941,
-    30942,     30942,     30942,     30943,     30943,     30943,     30944,     30944,
-    30944,     30945,     30945,     30945,     30946,     30946,     30946,     30947,
-    30947,     30947,     30948,     30948,     30948,     30949,     30949,     30949,
-    30950,     30950,     30950,     30951,     30951,     30951,     30952,     30952,
-    30953,     30953,     30953,     30954,     30954,     30954,     30955,     30955,
-    30955,     30956,     30956,     30956,     30957,     30957,     30957,     30958,
-    30958,     30958,     30959,     30959,     30959,     30960,     30960,     30960,
-    30961,     30961,     30961,     30962,     30962,     30962,     30963,     30963,
-    30963,     30964,     30964,     30964,     30965,     30965,     30965,     30966,
-    30966,     30966,     30967,     30967,     30967,     30968,     30968,     30968,
-    30969,     30969,     30969,     30970,     30970,     30970,     30971,     30971,
-    30971,     30972,     30972,     30972,     30973,     30973,     30973,     30974,
-    30974,     30974,     30975,     30975,     30975,     30976,     30976,     30976,
-    30977,     30977,     30977,     30978,     30978,     30978,     30979,     30979,
-    30979,     30980,     30980,     30980,     30981,     30981,     30981,     30982,
-    30982,     30982,     30983,     30983,     30983,     30984,     30984,     30984,
-    30985,     30985,     30985,     30986,     30986,     30986,     30987,     30987,
-    30987,     30988,     30988,     30988,     30989,     30989,     30989,     30990,
-    30990,     30990,     30991,     30991,     30991,     30992,     30992,     30992,
-    30993,     30993,     30993,     30994,     30994,     30994,     30995,     30995,
-    30995,     30996,     30996,     30996,     30997,     30997,     30997,     30998,
-    30998,     30998,     30999,     30999,     30999,     31000,     31000,     31000,
-    31001,     31001,     31001,     31002,     31002,     31002,     31003,     31003,
-    31003,     31004,     31004,     31004,     31005,     31005,     31005,     31006,
-    31006,     31006,     31007,     31007,     31007,     31007,     31008,     31008,
-    31008,     31009,     31009,     31009,     31010,     31010,     31010,     31011,
-    31011,     31011,     31012,     31012,     31012,     31013,     31013,     31013,
-    31014,     31014,     31014,     31015,     31015,     31015,     31016,     31016,
-    31016,     31017,     31017,     31017,     31018,     31018,     31018,     31019,
-    31019,     31019,     31020,     31020,     31020,     31021,     31021,     31021,
-    31022,     31022,     31022,     31023,     31023,     31023,     31024,     31024,
-    31024,     31024,     31025,     31025,     31025,     31026,     31026,     31026,
-    31027,     31027,     31027,     31028,     31028,     31028,     31029,     31029,
-    31029,     31030,     31030,     31030,     31031,     31031,     31031,     31032,
-    31032,     31032,     31033,     31033,     31033,     31034,     31034,     31034,
-    31035,     31035,     31035,     31035,     31036,     31036,     31036,     31037,
-    31037,     31037,     31038,     31038,     31038,     31039,     31039,     31039,
-    31040,     31040,     31040,     31041,     31041,     31041,     31042,     31042,
-    31042,     31043,     31043,     31043,     31044,     31044,     31044,     31045,
-    31045,     31045,     31045,     31046,     31046,     31046,     31047,     31047,
-    31047,     31048,     31048,     31048,     31049,     31049,     31049,     31050,
-    31050,     31050,     31051,     31051,     31051,     31052,     31052,     31052,
-    31053,     31053,     31053,     31054,     31054,     31054,     31054,     31055,
-    31055,     31055,     31056,     31056,     31056,     31057,     31057,     31057,
-    31058,     31058,     31058,     31059,     31059,     31059,     31060,     31060,
-    31060,     31061,     31061,     31061,     31061,     31062,     31062,     31062,
-    31063,     31063,     31063,     31064,     31064,     31064,     31065,     31065,
-    31065,     31066,     31066,     31066,     31067,     31067,     31067,     31068,
-    31068,     31068,     31068,     31069,     31069,     31069,     31070,     31070,
-    31070,     31071,     31071,     31071,     31072,     31072,     31072,     31073,
-    31073,     31073,     31074,     31074,     31074,     31074,     31075,     31075,
-    31075,     31076,     31076,     31076,     31077,     31077,     31077,     31078,
-    31078,     31078,     31079,     31079,     31079,     31080,     31080,     31080,
-    31080,     31081,     31081,     31081,     31082,     31082,     31082,     31083,
-    31083,     31083,     31084,     31084,     31084,     31085,     31085,     31085,
-    31086,     31086,     31086,     31086,     31087,     31087,     31087,     31088,
-    31088,     31088,     31089,     31089,     31089,     31090,     31090,     31090,
-    31091,     31091,     31091,     31091,     31092,     31092,     31092,     31093,
-    31093,     31093,     31094,     31094,     31094,     31095,     31095,     31095,
-    31096,     31096,     31096,     31096,     31097,     31097,     31097,     31098,
-    31098,     31098,     31099,     31099,     31099,     31100,     31100,     31100,
-    31101,     31101,     31101,     31101,     31102,     31102,     31102,     31103,
-    31103,     31103,     31104,     31104,     31104,     31105,     31105,     31105,
-    31105,     31106,     31106,     31106,     31107,     31107,     31107,     31108,
-    31108,     31108,     31109,     31109,     31109,     31110,     31110,     31110,
-    31110,     31111,     31111,     31111,     31112,     31112,     31112,     31113,
-    31113,     31113,     31114,     31114,     31114,     31114,     31115,     31115,
-    31115,     31116,     31116,     31116,     31117,     31117,     31117,     31118,
-    31118,     31118,     31118,     31119,     31119,     31119,     31120,     31120,
-    31120,     31121,     31121,     31121,     31122,     31122,     31122,     31122,
-    31123,     31123,     31123,     31124,     31124,     31124,     31125,     31125,
-    31125,     31126,     31126,     31126,     31126,     31127,     31127,     31127,
-    31128,     31128,     31128,     31129,     31129,     31129,     31130,     31130,
-    31130,     31130,     31131,     31131,     31131,     31132,     31132,     31132,
-    31133,     31133,     31133,     31134,     31134,     31134,     31134,     31135,
-    31135,     31135,     31136,     31136,     31136,     31137,     31137,     31137,
-    31137,     31138,     31138,     31138,     31139,     31139,     31139,     31140,
-    31140,     31140,     31141,     31141,     31141,     31141,     31142,     31142,
-    31142,     31143,     31143,     31143,     31144,     31144,     31144,     31144,
-    31145,     31145,     31145,     31146,     31146,     31146,     31147,     31147,
-    31147,     31148,     31148,     31148,     31148,     31149,     31149,     31149,
-    31150,     31150,     31150,     31151,     31151,     31151,     31151,     31152,
-    31152,     31152,     31153,     31153,     31153,     31154,     31154,     31154,
-    31154,     31155,     31155,     31155,     31156,     31156,     31156,     31157,
-    31157,     31157,     31157,     31158,     31158,     31158,     31159,     31159,
-    31159,     31160,     31160,     31160,     31160,     31161,     31161,     31161,
-    31162,     31162,     31162,     31163,     31163,     31163,     31163,     31164,
-    31164,     31164,     31165,     31165,     31165,     31166,     31166,     31166,
-    31166,     31167,     31167,     31167,     31168,     31168,     31168,     31169,
-    31169,     31169,     31169,     31170,     31170,     31170,     31171,     31171,
-    31171,     31172,     31172,     31172,     31172,     31173,     31173,     31173,
-    31174,     31174,     31174,     31175,     31175,     31175,     31175,     31176,
-    31176,     31176,     31177,     31177,     31177,     31178,     31178,     31178,
-    31178,     31179,     31179,     31179,     31180,     31180,     31180,     31180,
-    31181,     31181,     31181,     31182,     31182,     31182,     31183,     31183,
-    31183,     31183,     31184,     31184,     31184,     31185,     31185,     31185,
-    31186,     31186,     31186,     31186,     31187,     31187,     31187,     31188,
-    31188,     31188,     31188,     31189,     31189,     31189,     31190,     31190,
-    31190,     31191,     31191,     31191,     31191,     31192,     31192,     31192,
-    31193,     31193,     31193,     31193,     31194,     31194,     31194,     31195,
-    31195,     31195,     31196,     31196,     31196,     31196,     31197,     31197,
-    31197,     31198,     31198,     31198,     31198,     31199,     31199,     31199,
-    31200,     31200,     31200,     31201,     31201,     31201,     31201,     31202,
-    31202,     31202,     31203,     31203,     31203,     31203,     31204,     31204,
-    31204,     31205,     31205,     31205,     31206,     31206,     31206,     31206,
-    31207,     31207,     31207,     31208,     31208,     31208,     31208,     31209,
-    31209,     31209,     31210,     31210,     31210,     31210,     31211,     31211,
-    31211,     31212,     31212,     31212,     31213,     31213,     31213,     31213,
-    31214,     31214,     31214,     31215,     31215,     31215,     31215,     31216,
-    31216,     31216,     31217,     31217,     31217,     31217,     31218,     31218,
-    31218,     31219,     31219,     31219,     31219,     31220,     31220,     31220,
-    31221,     31221,     31221,     31221,     31222,     31222,     31222,     31223,
-    31223,     31223,     31224,     31224,     31224,     31224,     31225,     31225,
-    31225,     31226,     31226,     31226,     31226,     31227,     31227,     31227,
-    31228,     31228,     31228,     31228,     31229,     31229,     31229,     31230,
-    31230,     31230,     31230,     31231,     31231,     31231,     31232,     31232,
-    31232,     31232,     31233,     31233,     31233,     31234,     31234,     31234,
-    31234,     31235,     31235,     31235,     31236,     31236,     31236,     31236,
-    31237,     31237,     31237,     31238,     31238,     31238,     31238,     31239,
-    31239,     31239,     31240,     31240,     31240,     31240,     31241,     31241,
-    31241,     31242,     31242,     31242,     31242,     31243,     31243,     31243,
-    31244,     31244,     31244,     31244,     31245,     31245,     31245,     31246,
-    31246,     31246,     31246,     31247,     31247,     31247,     31248,     31248,
-    31248,     31248,     31249,     31249,     31249,     31250,     31250,     31250,
-    31250,     31251,     31251,     31251,     31252,     31252,     31252,     31252,
-    31253,     31253,     31253,     31254,     31254,     31254,     31254,     31255,
-    31255,     31255,     31256,     31256,     31256,     31256,     31257,     31257,
-    31257,     31258,     31258,     31258,     31258,     31259,     31259,     31259,
-    31260,     31260,     31260,     31260,     31261,     31261,     31261,     31261,
-    31262,     31262,     31262,     31263,     31263,     31263,     31263,     31264,
-    31264,     31264,     31265,     31265,     31265,     31265,     31266,     31266,
-    31266,     31267,     31267,     31267,     31267,     31268,     31268,     31268,
-    31269,     31269,     31269,     31269,     31270,     31270,     31270,     31270,
-    31271,     31271,     31271,     31272,     31272,     31272,     31272,     31273,
-    31273,     31273,     31274,     31274,     31274,     31274,     31275,     31275,
-    31275,     31276,     31276,     31276,     31276,     31277,     31277,     31277,
-    31277,     31278,     31278,     31278,     31279,     31279,     31279,     31279,
-    31280,     31280,     31280,     31281,     31281,     31281,     31281,     31282,
-    31282,     31282,     31282,     31283,     31283,     31283,     31284,     31284,
-    31284,     31284,     31285,     31285,     31285,     31286,     31286,     31286,
-    31286,     31287,     31287,     31287,     31287,     31288,     31288,     31288,
-    31289,     31289,     31289,     31289,     31290,     31290,     31290,     31291,
-    31291,     31291,     31291,     31292,     31292,     31292,     31292,     31293,
-    31293,     31293,     31294,     31294,     31294,     31294,     31295,     31295,
-    31295,     31295,     31296,     31296,     31296,     31297,     31297,     31297,
-    31297,     31298,     31298,     31298,     31299,     31299,     31299,     31299,
-    31300,     31300,     31300,     31300,     31301,     31301,     31301,     31302,
-    31302,     31302,     31302,     31303,     31303,     31303,     31303,     31304,
-    31304,     31304,     31305,     31305,     31305,     31305,     31306,     31306,
-    31306,     31306,     31307,     31307,     31307,     31308,     31308,     31308,
-    31308,     31309,     31309,     31309,     31309,     31310,     31310,     31310,
-    31311,     31311,     31311,     31311,     31312,     31312,     31312,     31312,
-    31313,     31313,     31313,     31314,     31314,     31314,     31314,     31315,
-    31315,     31315,     31315,     31316,     31316,     31316,     31317,     31317,
-    31317,     31317,     31318,     31318,     31318,     31318,     31319,     31319,
-    31319,     31320,     31320,     31320,     31320,     31321,     31321,     31321,
-    31321,     31322,     31322,     31322,     31323,     31323,     31323,     31323,
-    31324,     31324,     31324,     31324,     31325,     31325,     31325,     31326,
-    31326,     31326,     31326,     31327,     31327,     31327,     31327,     31328,
-    31328,     31328,     31328,     31329,     31329,     31329,     31330,     31330,
-    31330,     31330,     31331,     31331,     31331,     31331,     31332,     31332,
-    31332,     31333,     31333,     31333,     31333,     31334,     31334,     31334,
-    31334,     31335,     31335,     31335,     31335,     31336,     31336,     31336,
-    31337,     31337,     31337,     31337,     31338,     31338,     31338,     31338,
-    31339,     31339,     31339,     31340,     31340,     31340,     31340,     31341,
-    31341,     31341,     31341,     31342,     31342,     31342,     31342,     31343,
-    31343,     31343,     31344,     31344,     31344,     31344,     31345,     31345,
-    31345,     31345,     31346,     31346,     31346,     31346,     31347,     31347,
-    31347,     31348,     31348,     31348,     31348,     31349,     31349,     31349,
-    31349,     31350,     31350,     31350,     31350,     31351,     31351,     31351,
-    31352,     31352,     31352,     31352,     31353,     31353,     31353,     31353,
-    31354,     31354,     31354,     31354,     31355,     31355,     31355,     31355,
-    31356,     31356,     31356,     31357,     31357,     31357,     31357,     31358,
-    31358,     31358,     31358,     31359,     31359,     31359,     31359,     31360,
-    31360,     31360,     31361,     31361,     31361,     31361,     31362,     31362,
-    31362,     31362,     31363,     31363,     31363,     31363,     31364,     31364,
-    31364,     31364,     31365,     31365,     31365,     31366,     31366,     31366,
-    31366,     31367,     31367,     31367,     31367,     31368,     31368,     31368,
-    31368,     31369,     31369,     31369,     31369,     31370,     31370,     31370,
-    31370,     31371,     31371,     31371,     31372,     31372,     31372,     31372,
-    31373,     31373,     31373,     31373,     31374,     31374,     31374,     31374,
-    31375,     31375,     31375,     31375,     31376,     31376,     31376,     31377,
-    31377,     31377,     31377,     31378,     31378,     31378,     31378,     31379,
-    31379,     31379,     31379,     31380,     31380,     31380,     31380,     31381,
-    31381,     31381,     31381,     31382,     31382,     31382,     31382,     31383,
-    31383,     31383,     31384,     31384,     31384,     31384,     31385,     31385,
-    31385,     31385,     31386,     31386,     31386,     31386,     31387,     31387,
-    31387,     31387,     31388,     31388,     31388,     31388,     31389,     31389,
-    31389,     31389,     31390,     31390,     31390,     31391,     31391,     31391,
-    31391,     31392,     31392,     31392,     31392,     31393,     31393,     31393,
-    31393,     31394,     31394,     31394,     31394,     31395,     31395,     31395,
-    31395,     31396,     31396,     31396,     31396,     31397,     31397,     31397,
-    31397,     31398,     31398,     31398,     31399,     31399,     31399,     31399,
-    31400,     31400,     31400,     31400,     31401,     31401,     31401,     31401,
-    31402,     31402,     31402,     31402,     31403,     31403,     31403,     31403,
-    31404,     31404,     31404,     31404,     31405,     31405,     31405,     31405,
-    31406,     31406,     31406,     31406,     31407,     31407,     31407,     31407,
-    31408,     31408,     31408,     31408,     31409,     31409,     31409,     31410,
-    31410,     31410,     31410,     31411,     31411,     31411,     31411,     31412,
-    31412,     31412,     31412,     31413,     31413,     31413,     31413,     31414,
-    31414,     31414,     31414,     31415,     31415,     31415,     31415,     31416,
-    31416,     31416,     31416,     31417,     31417,     31417,     31417,     31418,
-    31418,     31418,     31418,     31419,     31419,     31419,     31419,     31420,
-    31420,     31420,     31420,     31421,     31421,     31421,     31421,     31422,
-    31422,     31422,     31422,     31423,     31423,     31423,     31423,     31424,
-    31424,     31424,     31424,     31425,     31425,     31425,     31425,     31426,
-    31426,     31426,     31426,     31427,     31427,     31427,     31427,     31428,
-    31428,     31428,     31428,     31429,     31429,     31429,     31429,     31430,
-    31430,     31430,     31430,     31431,     31431,     31431,     31432,     31432,
-    31432,     31432,     31433,     31433,     31433,     31433,     31434,     31434,
-    31434,     31434,     31435,     31435,     31435,     31435,     31436,     31436,
-    31436,     31436,     31437,     31437,     31437,     31437,     31438,     31438,
-    31438,     31438,     31439,     31439,     31439,     31439,     31440,     31440,
-    31440,     31440,     31440,     31441,     31441,     31441,     31441,     31442,
-    31442,     31442,     31442,     31443,     31443,     31443,     31443,     31444,
-    31444,     31444,     31444,     31445,     31445,     31445,     31445,     31446,
-    31446,     31446,     31446,     31447,     31447,     31447,     31447,     31448,
-    31448,     31448,     31448,     31449,     31449,     31449,     31449,     31450,
-    31450,     31450,     31450,     31451,     31451,     31451,     31451,     31452,
-    31452,     31452,     31452,     31453,     31453,     31453,     31453,     31454,
-    31454,     31454,     31454,     31455,     31455,     31455,     31455,     31456,
-    31456,     31456,     31456,     31457,     31457,     31457,     31457,     31458,
-    31458,     31458,     31458,     31459,     31459,     31459,     31459,     31460,
-    31460,     31460,     31460,     31461,     31461,     31461,     31461,     31462,
-    31462,     31462,     31462,     31462,     31463,     31463,     31463,     31463,
-    31464,     31464,     31464,     31464,     31465,     31465,     31465,     31465,
-    31466,     31466,     31466,     31466,     31467,     31467,     31467,     31467,
-    31468,     31468,     31468,     31468,     31469,     31469,     31469,     31469,
-    31470,     31470,     31470,     31470,     31471,     31471,     31471,     31471,
-    31472,     31472,     31472,     31472,     31473,     31473,     31473,     31473,
-    31473,     31474,     31474,     31474,     31474,     31475,     31475,     31475,
-    31475,     31476,     31476,     31476,     31476,     31477,     31477,     31477,
-    31477,     31478,     31478,     31478,     31478,     31479,     31479,     31479,
-    31479,     31480,     31480,     31480,     31480,     31481,     31481,     31481,
-    31481,     31481,     31482,     31482,     31482,     31482,     31483,     31483,
-    31483,     31483,     31484,     31484,     31484,     31484,     31485,     31485,
-    31485,     31485,     31486,     31486,     31486,     31486,     31487,     31487,
-    31487,     31487,     31487,     31488,     31488,     31488,     31488,     31489,
-    31489,     31489,     31489,     31490,     31490,     31490,     31490,     31491,
-    31491,     31491,     31491,     31492,     31492,     31492,     31492,     31493,
-    31493,     31493,     31493,     31493,     31494,     31494,     31494,     31494,
-    31495,     31495,     31495,     31495,     31496,     31496,     31496,     31496,
-    31497,     31497,     31497,     31497,     31498,     31498,     31498,     31498,
-    31499,     31499,     31499,     31499,     31499,     31500,     31500,     31500,
-    31500,     31501,     31501,     31501,     31501,     31502,     31502,     31502,
-    31502,     31503,     31503,     31503,     31503,     31504,     31504,     31504,
-    31504,     31504,     31505,     31505,     31505,     31505,     31506,     31506,
-    31506,     31506,     31507,     31507,     31507,     31507,     31508,     31508,
-    31508,     31508,     31508,     31509,     31509,     31509,     31509,     31510,
-    31510,     31510,     31510,     31511,     31511,     31511,     31511,     31512,
-    31512,     31512,     31512,     31513,     31513,     31513,     31513,     31513,
-    31514,     31514,     31514,     31514,     31515,     31515,     31515,     31515,
-    31516,     31516,     31516,     31516,     31517,     31517,     31517,     31517,
-    31517,     31518,     31518,     31518,     31518,     31519,     31519,     31519,
-    31519,     31520,     31520,     31520,     31520,     31520,     31521,     31521,
-    31521,     31521,     31522,     31522,     31522,     31522,     31523,     31523,
-    31523,     31523,     31524,     31524,     31524,     31524,     31524,     31525,
-    31525,     31525,     31525,     31526,     31526,     31526,     31526,     31527,
-    31527,     31527,     31527,     31528,     31528,     31528,     31528,     31528,
-    31529,     31529,     31529,     31529,     31530,     31530,     31530,     31530,
-    31531,     31531,     31531,     31531,     31531,     31532,     31532,     31532,
-    31532,     31533,     31533,     31533,     31533,     31534,     31534,     31534,
-    31534,     31534,     31535,     31535,     31535,     31535,     31536,     31536,
-    31536,     31536,     31537,     31537,     31537,     31537,     31537,     31538,
-    31538,     31538,     31538,     31539,     31539,     31539,     31539,     31540,
-    31540,     31540,     31540,     31540,     31541,     31541,     31541,     31541,
-    31542,     31542,     31542,     31542,     31543,     31543,     31543,     31543,
-    31543,     31544,     31544,     31544,     31544,     31545,     31545,     31545,
-    31545,     31546,     31546,     31546,     31546,     31546,     31547,     31547,
-    31547,     31547,     31548,     31548,     31548,     31548,     31549,     31549,
-    31549,     31549,     31549,     31550,     31550,     31550,     31550,     31551,
-    31551,     31551,     31551,     31552,     31552,     31552,     31552,     31552,
-    31553,     31553,     31553,     31553,     31554,     31554,     31554,     31554,
-    31554,     31555,     31555,     31555,     31555,     31556,     31556,     31556,
-    31556,     31557,     31557,     31557,     31557,     31557,     31558,     31558,
-    31558,     31558,     31559,     31559,     31559,     31559,     31559,     31560,
-    31560,     31560,     31560,     31561,     31561,     31561,     31561,     31562,
-    31562,     31562,     31562,     31562,     31563,     31563,     31563,     31563,
-    31564,     31564,     31564,     31564,     31564,     31565,     31565,     31565,
-    31565,     31566,     31566,     31566,     31566,     31567,     31567,     31567,
-    31567,     31567,     31568,     31568,     31568,     31568,     31569,     31569,
-    31569,     31569,     31569,     31570,     31570,     31570,     31570,     31571,
-    31571,     31571,     31571,     31571,     31572,     31572,     31572,     31572,
-    31573,     31573,     31573,     31573,     31573,     31574,     31574,     31574,
-    31574,     31575,     31575,     31575,     31575,     31576,     31576,     31576,
-    31576,     31576,     31577,     31577,     31577,     31577,     31578,     31578,
-    31578,     31578,     31578,     31579,     31579,     31579,     31579,     31580,
-    31580,     31580,     31580,     31580,     31581,     31581,     31581,     31581,
-    31582,     31582,     31582,     31582,     31582,     31583,     31583,     31583,
-    31583,     31584,     31584,     31584,     31584,     31584,     31585,     31585,
-    31585,     31585,     31586,     31586,     31586,     31586,     31586,     31587,
-    31587,     31587,     31587,     31588,     31588,     31588,     31588,     31588,
-    31589,     31589,     31589,     31589,     31590,     31590,     31590,     31590,
-    31590,     31591,     31591,     31591,     31591,     31592,     31592,     31592,
-    31592,     31592,     31593,     31593,     31593,     31593,     31594,     31594,
-    31594,     31594,     31594,     31595,     31595,     31595,     31595,     31596,
-    31596,     31596,     31596,     31596,     31597,     31597,     31597,     31597,
-    31598,     31598,     31598,     31598,     31598,     31599,     31599,     31599,
-    31599,     31599,     31600,     31600,     31600,     31600,     31601,     31601,
-    31601,     31601,     31601,     31602,     31602,     31602,     31602,     31603,
-    31603,     31603,     31603,     31603,     31604,     31604,     31604,     31604,
-    31605,     31605,     31605,     31605,     31605,     31606,     31606,     31606,
-    31606,     31607,     31607,     31607,     31607,     31607,     31608,     31608,
-    31608,     31608,     31608,     31609,     31609,     31609,     31609,     31610,
-    31610,     31610,     31610,     31610,     31611,     31611,     31611,     31611,
-    31612,     31612,     31612,     31612,     31612,     31613,     31613,     31613,
-    31613,     31613,     31614,     31614,     31614,     31614,     31615,     31615,
-    31615,     31615,     31615,     31616,     31616,     31616,     31616,     31617,
-    31617,     31617,     31617,     31617,     31618,     31618,     31618,     31618,
-    31618,     31619,     31619,     31619,     31619,     31620,     31620,     31620,
-    31620,     31620,     31621,     31621,     31621,     31621,     31621,     31622,
-    31622,     31622,     31622,     31623,     31623,     31623,     31623,     31623,
-    31624,     31624,     31624,     31624,     31625,     31625,     31625,     31625,
-    31625,     31626,     31626,     31626,     31626,     31626,     31627,     31627,
-    31627,     31627,     31628,     31628,     31628,     31628,     31628,     31629,
-    31629,     31629,     31629,     31629,     31630,     31630,     31630,     31630,
-    31631,     31631,     31631,     31631,     31631,     31632,     31632,     31632,
-    31632,     31632,     31633,     31633,     31633,     31633,     31634,     31634,
-    31634,     31634,     31634,     31635,     31635,     31635,     31635,     31635,
-    31636,     31636,     31636,     31636,     31636,     31637,     31637,     31637,
-    31637,     31638,     31638,     31638,     31638,     31638,     31639,     31639,
-    31639,     31639,     31639,     31640,     31640,     31640,     31640,     31641,
-    31641,     31641,     31641,     31641,     31642,     31642,     31642,     31642,
-    31642,     31643,     31643,     31643,     31643,     31643,     31644,     31644,
-    31644,     31644,     31645,     31645,     31645,     31645,     31645,     31646,
-    31646,     31646,     31646,     31646,     31647,     31647,     31647,     31647,
-    31648,     31648,     31648,     31648,     31648,     31649,     31649,     31649,
-    31649,     31649,     31650,     31650,     31650,     31650,     31650,     31651,
-    31651,     31651,     31651,     31652,     31652,     31652,     31652,     31652,
-    31653,     31653,     31653,     31653,     31653,     31654,     31654,     31654,
-    31654,     31654,     31655,     31655,     31655,     31655,     31655,     31656,
-    31656,     31656,     31656,     31657,     31657,     31657,     31657,     31657,
-    31658,     31658,     31658,     31658,     31658,     31659,     31659,     31659,
-    31659,     31659,     31660,     31660,     31660,     31660,     31661,     31661,
-    31661,     31661,     31661,     31662,     31662,     31662,     31662,     31662,
-    31663,     31663,     31663,     31663,     31663,     31664,     31664,     31664,
-    31664,     31664,     31665,     31665,     31665,     31665,     31666,     31666,
-    31666,     31666,     31666,     31667,     31667,     31667,     31667,     31667,
-    31668,     31668,     31668,     31668,     31668,     31669,     31669,     31669,
-    31669,     31669,     31670,     31670,     31670,     31670,     31670,     31671,
-    31671,     31671,     31671,     31672,     31672,     31672,     31672,     31672,
-    31673,     31673,     31673,     31673,     31673,     31674,     31674,     31674,
-    31674,     31674,     31675,     31675,     31675,     31675,     31675,     31676,
-    31676,     31676,     31676,     31676,     31677,     31677,     31677,     31677,
-    31677,     31678,     31678,     31678,     31678,     31679,     31679,     31679,
-    31679,     31679,     31680,     31680,     31680,     31680,     31680,     31681,
-    31681,     31681,     31681,     31681,     31682,     31682,     31682,     31682,
-    31682,     31683,     31683,     31683,     31683,     31683,     31684,     31684,
-    31684,     31684,     31684,     31685,     31685,     31685,     31685,     31685,
-    31686,     31686,     31686,     31686,     31686,     31687,     31687,     31687,
-    31687,     31687,     31688,     31688,     31688,     31688,     31689,     31689,
-    31689,     31689,     31689,     31690,     31690,     31690,     31690,     31690,
-    31691,     31691,     31691,     31691,     31691,     31692,     31692,     31692,
-    31692,     31692,     31693,     31693,     31693,     31693,     31693,     31694,
-    31694,     31694,     31694,     31694,     31695,     31695,     31695,     31695,
-    31695,     31696,     31696,     31696,     31696,     31696,     31697,     31697,
-    31697,     31697,     31697,     31698,     31698,     31698,     31698,     31698,
-    31699,     31699,     31699,     31699,     31699,     31700,     31700,     31700,
-    31700,     31700,     31701,     31701,     31701,     31701,     31701,     31702,
-    31702,     31702,     31702,     31702,     31703,     31703,     31703,     31703,
-    31703,     31704,     31704,     31704,     31704,     31704,     31705,     31705,
-    31705,     31705,     31705,     31706,     31706,     31706,     31706,     31706,
-    31707,     31707,     31707,     31707,     31707,     31708,     31708,     31708,
-    31708,     31708,     31709,     31709,     31709,     31709,     31709,     31710,
-    31710,     31710,     31710,     31710,     31711,     31711,     31711,     31711,
-    31711,     31712,     31712,     31712,     31712,     31712,     31713,     31713,
-    31713,     31713,     31713,     31714,     31714,     31714,     31714,     31714,
-    31715,     31715,     31715,     31715,     31715,     31716,     31716,     31716,
-    31716,     31716,     31717,     31717,     31717,     31717,     31717,     31718,
-    31718,     31718,     31718,     31718,     31719,     31719,     31719,     31719,
-    31719,     31720,     31720,     31720,     31720,     31720,     31721,     31721,
-    31721,     31721,     31721,     31722,     31722,     31722,     31722,     31722,
-    31723,     31723,     31723,     31723,     31723,     31724,     31724,     31724,
-    31724,     31724,     31725,     31725,     31725,     31725,     31725,     31725,
-    31726,     31726,     31726,     31726,     31726,     31727,     31727,     31727,
-    31727,     31727,     31728,     31728,     31728,     31728,     31728,     31729,
-    31729,     31729,     31729,     31729,     31730,     31730,     31730,     31730,
-    31730,     31731,     31731,     31731,     31731,     31731,     31732,     31732,
-    31732,     31732,     31732,     31733,     31733,     31733,     31733,     31733,
-    31734,     31734,     31734,     31734,     31734,     31734,     31735,     31735,
-    31735,     31735,     31735,     31736,     31736,     31736,     31736,     31736,
-    31737,     31737,     31737,     31737,     31737,     31738,     31738,     31738,
-    31738,     31738,     31739,     31739,     31739,     31739,     31739,     31740,
-    31740,     31740,     31740,     31740,     31741,     31741,     31741,     31741,
-    31741,     31741,     31742,     31742,     31742,     31742,     31742,     31743,
-    31743,     31743,     31743,     31743,     31744,     31744,     31744,     31744,
-    31744,     31745,     31745,     31745,     31745,     31745,     31746,     31746,
-    31746,     31746,     31746,     31746,     31747,     31747,     31747,     31747,
-    31747,     31748,     31748,     31748,     31748,     31748,     31749,     31749,
-    31749,     31749,     31749,     31750,     31750,     31750,     31750,     31750,
-    31751,     31751,     31751,     31751,     31751,     31751,     31752,     31752,
-    31752,     31752,     31752,     31753,     31753,     31753,     31753,     31753,
-    31754,     31754,     31754,     31754,     31754,     31755,     31755,     31755,
-    31755,     31755,     31755,     31756,     31756,     31756,     31756,     31756,
-    31757,     31757,     31757,     31757,     31757,     31758,     31758,     31758,
-    31758,     31758,     31759,     31759,     31759,     31759,     31759,     31759,
-    31760,     31760,     31760,     31760,     31760,     31761,     31761,     31761,
-    31761,     31761,     31762,     31762,     31762,     31762,     31762,     31763,
-    31763,     31763,     31763,     31763,     31763,     31764,     31764,     31764,
-    31764,     31764,     31765,     31765,     31765,     31765,     31765,     31766,
-    31766,     31766,     31766,     31766,     31767,     31767,     31767,     31767,
-    31767,     31767,     31768,     31768,     31768,     31768,     31768,     31769,
-    31769,     31769,     31769,     31769,     31770,     31770,     31770,     31770,
-    31770,     31770,     31771,     31771,     31771,     31771,     31771,     31772,
-    31772,     31772,     31772,     31772,     31773,     31773,     31773,     31773,
-    31773,     31773,     31774,     31774,     31774,     31774,     31774,     31775,
-    31775,     31775,     31775,     31775,     31776,     31776,     31776,     31776,
-    31776,     31776,     31777,     31777,     31777,     31777,     31777,     31778,
-    31778,     31778,     31778,     31778,     31779,     31779,     31779,     31779,
-    31779,     31779,     31780,     31780,     31780,     31780,     31780,     31781,
-    31781,     31781,     31781,     31781,     31782,     31782,     31782,     31782,
-    31782,     31782,     31783,     31783,     31783,     31783,     31783,     31784,
-    31784,     31784,     31784,     31784,     31784,     31785,     31785,     31785,
-    31785,     31785,     31786,     31786,     31786,     31786,     31786,     31787,
-    31787,     31787,     31787,     31787,     31787,     31788,     31788,     31788,
-    31788,     31788,     31789,     31789,     31789,     31789,     31789,     31789,
-    31790,     31790,     31790,     31790,     31790,     31791,     31791,     31791,
-    31791,     31791,     31792,     31792,     31792,     31792,     31792,     31792,
-    31793,     31793,     31793,     31793,     31793,     31794,     31794,     31794,
-    31794,     31794,     31794,     31795,     31795,     31795,     31795,     31795,
-    31796,     31796,     31796,     31796,     31796,     31796,     31797,     31797,
-    31797,     31797,     31797,     31798,     31798,     31798,     31798,     31798,
-    31798,     31799,     31799,     31799,     31799,     31799,     31800,     31800,
-    31800,     31800,     31800,     31800,     31801,     31801,     31801,     31801,
-    31801,     31802,     31802,     31802,     31802,     31802,     31802,     31803,
-    31803,     31803,     31803,     31803,     31804,     31804,     31804,     31804,
-    31804,     31804,     31805,     31805,     31805,     31805,     31805,     31806,
-    31806,     31806,     31806,     31806,     31806,     31807,     31807,     31807,
-    31807,     31807,     31808,     31808,     31808,     31808,     31808,     31808,
-    31809,     31809,     31809,     31809,     31809,     31810,     31810,     31810,
-    31810,     31810,     31810,     31811,     31811,     31811,     31811,     31811,
-    31812,     31812,     31812,     31812,     31812,     31812,     31813,     31813,
-    31813,     31813,     31813,     31814,     31814,     31814,     31814,     31814,
-    31814,     31815,     31815,     31815,     31815,     31815,     31816,     31816,
-    31816,     31816,     31816,     31816,     31817,     31817,     31817,     31817,
-    31817,     31817,     31818,     31818,     31818,     31818,     31818,     31819,
-    31819,     31819,     31819,     31819,     31819,     31820,     31820,     31820,
-    31820,     31820,     31821,     31821,     31821,     31821,     31821,     31821,
-    31822,     31822,     31822,     31822,     31822,     31822,     31823,     31823,
-    31823,     31823,     31823,     31824,     31824,     31824,     31824,     31824,
-    31824,     31825,     31825,     31825,     31825,     31825,     31826,     31826,
-    31826,     31826,     31826,     31826,     31827,     31827,     31827,     31827,
-    31827,     31827,     31828,     31828,     31828,     31828,     31828,     31829,
-    31829,     31829,     31829,     31829,     31829,     31830,     31830,     31830,
-    31830,     31830,     31830,     31831,     31831,     31831,     31831,     31831,
-    31832,     31832,     31832,     31832,     31832,     31832,     31833,     31833,
-    31833,     31833,     31833,     31833,     31834,     31834,     31834,     31834,
-    31834,     31835,     31835,     31835,     31835,     31835,     31835,     31836,
-    31836,     31836,     31836,     31836,     31836,     31837,     31837,     31837,
-    31837,     31837,     31838,     31838,     31838,     31838,     31838,     31838,
-    31839,     31839,     31839,     31839,     31839,     31839,     31840,     31840,
-    31840,     31840,     31840,     31841,     31841,     31841,     31841,     31841,
-    31841,     31842,     31842,     31842,     31842,     31842,     31842,     31843,
-    31843,     31843,     31843,     31843,     31843,     31844,     31844,     31844,
-    31844,     31844,     31845,     31845,     31845,     31845,     31845,     31845,
-    31846,     31846,     31846,     31846,     31846,     31846,     31847,     31847,
-    31847,     31847,     31847,     31847,     31848,     31848,     31848,     31848,
-    31848,     31849,     31849,     31849,     31849,     31849,     31849,     31850,
-    31850,     31850,     31850,     31850,     31850,     31851,     31851,     31851,
-    31851,     31851,     31851,     31852,     31852,     31852,     31852,     31852,
-    31853,     31853,     31853,     31853,     31853,     31853,     31854,     31854,
-    31854,     31854,     31854,     31854,     31855,     31855,     31855,     31855,
-    31855,     31855,     31856,     31856,     31856,     31856,     31856,     31856,
-    31857,     31857,     31857,     31857,     31857,     31858,     31858,     31858,
-    31858,     31858,     31858,     31859,     31859,     31859,     31859,     31859,
-    31859,     31860,     31860,     31860,     31860,     31860,     31860,     31861,
-    31861,     31861,     31861,     31861,     31861,     31862,     31862,     31862,
-    31862,     31862,     31862,     31863,     31863,     31863,     31863,     31863,
-    31864,     31864,     31864,     31864,     31864,     31864,     31865,     31865,
-    31865,     31865,     31865,     31865,     31866,     31866,     31866,     31866,
-    31866,     31866,     31867,     31867,     31867,     31867,     31867,     31867,
-    31868,     31868,     31868,     31868,     31868,     31868,     31869,     31869,
-    31869,     31869,     31869,     31869,     31870,     31870,     31870,     31870,
-    31870,     31870,     31871,     31871,     31871,     31871,     31871,     31872,
-    31872,     31872,     31872,     31872,     31872,     31873,     31873,     31873,
-    31873,     31873,     31873,     31874,     31874,     31874,     31874,     31874,
-    31874,     31875,     31875,     31875,     31875,     31875,     31875,     31876,
-    31876,     31876,     31876,     31876,     31876,     31877,     31877,     31877,
-    31877,     31877,     31877,     31878,     31878,     31878,     31878,     31878,
-    31878,     31879,     31879,     31879,     31879,     31879,     31879,     31880,
-    31880,     31880,     31880,     31880,     31880,     31881,     31881,     31881,
-    31881,     31881,     31881,     31882,     31882,     31882,     31882,     31882,
-    31882,     31883,     31883,     31883,     31883,     31883,     31883,     31884,
-    31884,     31884,     31884,     31884,     31884,     31885,     31885,     31885,
-    31885,     31885,     31885,     31886,     31886,     31886,     31886,     31886,
-    31886,     31887,     31887,     31887,     31887,     31887,     31887,     31888,
-    31888,     31888,     31888,     31888,     31888,     31889,     31889,     31889,
-    31889,     31889,     31889,     31890,     31890,     31890,     31890,     31890,
-    31890,     31891,     31891,     31891,     31891,     31891,     31891,     31892,
-    31892,     31892,     31892,     31892,     31892,     31893,     31893,     31893,
-    31893,     31893,     31893,     31894,     31894,     31894,     31894,     31894,
-    31894,     31895,     31895,     31895,     31895,     31895,     31895,     31896,
-    31896,     31896,     31896,     31896,     31896,     31897,     31897,     31897,
-    31897,     31897,     31897,     31898,     31898,     31898,     31898,     31898,
-    31898,     31899,     31899,     31899,     31899,     31899,     31899,     31900,
-    31900,     31900,     31900,     31900,     31900,     31900,     31901,     31901,
-    31901,     31901,     31901,     31901,     31902,     31902,     31902,     31902,
-    31902,     31902,     31903,     31903,     31903,     31903,     31903,     31903,
-    31904,     31904,     31904,     31904,     31904,     31904,     31905,     31905,
-    31905,     31905,     31905,     31905,     31906,     31906,     31906,     31906,
-    31906,     31906,     31907,     31907,     31907,     31907,     31907,     31907,
-    31908,     31908,     31908,     31908,     31908,     31908,     31908,     31909,
-    31909,     31909,     31909,     31909,     31909,     31910,     31910,     31910,
-    31910,     31910,     31910,     31911,     31911,     31911,     31911,     31911,
-    31911,     31912,     31912,     31912,     31912,     31912,     31912,     31913,
-    31913,     31913,     31913,     31913,     31913,     31914,     31914,     31914,
-    31914,     31914,     31914,     31914,     31915,     31915,     31915,     31915,
-    31915,     31915,     31916,     31916,     31916,     31916,     31916,     31916,
-    31917,     31917,     31917,     31917,     31917,     31917,     31918,     31918,
-    31918,     31918,     31918,     31918,     31918,     31919,     31919,     31919,
-    31919,     31919,     31919,     31920,     31920,     31920,     31920,     31920,
-    31920,     31921,     31921,     31921,     31921,     31921,     31921,     31922,
-    31922,     31922,     31922,     31922,     31922,     31922,     31923,     31923,
-    31923,     31923,     31923,     31923,     31924,     31924,     31924,     31924,
-    31924,     31924,     31925,     31925,     31925,     31925,     31925,     31925,
-    31926,     31926,     31926,     31926,     31926,     31926,     31926,     31927,
-    31927,     31927,     31927,     31927,     31927,     31928,     31928,     31928,
-    31928,     31928,     31928,     31929,     31929,     31929,     31929,     31929,
-    31929,     31929,     31930,     31930,     31930,     31930,     31930,     31930,
-    31931,     31931,     31931,     31931,     31931,     31931,     31932,     31932,
-    31932,     31932,     31932,     31932,     31933,     31933,     31933,     31933,
-    31933,     31933,     31933,     31934,     31934,     31934,     31934,     31934,
-    31934,     31935,     31935,     31935,     31935,     31935,     31935,     31935,
-    31936,     31936,     31936,     31936,     31936,     31936,     31937,     31937,
-    31937,     31937,     31937,     31937,     31938,     31938,     31938,     31938,
-    31938,     31938,     31938,     31939,     31939,     31939,     31939,     31939,
-    31939,     31940,     31940,     31940,     31940,     31940,     31940,     31941,
-    31941,     31941,     31941,     31941,     31941,     31941,     31942,     31942,
-    31942,     31942,     31942,     31942,     31943,     31943,     31943,     31943,
-    31943,     31943,     31943,     31944,     31944,     31944,     31944,     31944,
-    31944,     31945,     31945,     31945,     31945,     31945,     31945,     31946,
-    31946,     31946,     31946,     31946,     31946,     31946,     31947,     31947,
-    31947,     31947,     31947,     31947,     31948,     31948,     31948,     31948,
-    31948,     31948,     31948,     31949,     31949,     31949,     31949,     31949,
-    31949,     31950,     31950,     31950,     31950,     31950,     31950,     31950,
-    31951,     31951,     31951,     31951,     31951,     31951,     31952,     31952,
-    31952,     31952,     31952,     31952,     31952,     31953,     31953,     31953,
-    31953,     31953,     31953,     31954,     31954,     31954,     31954,     31954,
-    31954,     31954,     31955,     31955,     31955,     31955,     31955,     31955,
-    31956,     31956,     31956,     31956,     31956,     31956,     31956,     31957,
-    31957,     31957,     31957,     31957,     31957,     31958,     31958,     31958,
-    31958,     31958,     31958,     31958,     31959,     31959,     31959,     31959,
-    31959,     31959,     31960,     31960,     31960,     31960,     31960,     31960,
-    31960,     31961,     31961,     31961,     31961,     31961,     31961,     31962,
-    31962,     31962,     31962,     31962,     31962,     31962,     31963,     31963,
-    31963,     31963,     31963,     31963,     31963,     31964,     31964,     31964,
-    31964,     31964,     31964,     31965,     31965,     31965,     31965,     31965,
-    31965,     31965,     31966,     31966,     31966,     31966,     31966,     31966,
-    31967,     31967,     31967,     31967,     31967,     31967,     31967,     31968,
-    31968,     31968,     31968,     31968,     31968,     31968,     31969,     31969,
-    31969,     31969,     31969,     31969,     31970,     31970,     31970,     31970,
-    31970,     31970,     31970,     31971,     31971,     31971,     31971,     31971,
-    31971,     31972,     31972,     31972,     31972,     31972,     31972,     31972,
-    31973,     31973,     31973,     31973,     31973,     31973,     31973,     31974,
-    31974,     31974,     31974,     31974,     31974,     31975,     31975,     31975,
-    31975,     31975,     31975,     31975,     31976,     31976,     31976,     31976,
-    31976,     31976,     31976,     31977,     31977,     31977,     31977,     31977,
-    31977,     31978,     31978,     31978,     31978,     31978,     31978,     31978,
-    31979,     31979,     31979,     31979,     31979,     31979,     31979,     31980,
-    31980,     31980,     31980,     31980,     31980,     31980,     31981,     31981,
-    31981,     31981,     31981,     31981,     31982,     31982,     31982,     31982,
-    31982,     31982,     31982,     31983,     31983,     31983,     31983,     31983,
-    31983,     31983,     31984,     31984,     31984,     31984,     31984,     31984,
-    31985,     31985,     31985,     31985,     31985,     31985,     31985,     31986,
-    31986,     31986,     31986,     31986,     31986,     31986,     31987,     31987,
-    31987,     31987,     31987,     31987,     31987,     31988,     31988,     31988,
-    31988,     31988,     31988,     31989,     31989,     31989,     31989,     31989,
-    31989,     31989,     31990,     31990,     31990,     31990,     31990,     31990,
-    31990,     31991,     31991,     31991,     31991,     31991,     31991,     31991,
-    31992,     31992,     31992,     31992,     31992,     31992,     31992,     31993,
-    31993,     31993,     31993,     31993,     31993,     31993,     31994,     31994,
-    31994,     31994,     31994,     31994,     31995,     31995,     31995,     31995,
-    31995,     31995,     31995,     31996,     31996,     31996,     31996,     31996,
-    31996,     31996,     31997,     31997,     31997,     31997,     31997,     31997,
-    31997,     31998,     31998,     31998,     31998,     31998,     31998,     31998,
-    31999,     31999,     31999,     31999,     31999,     31999,     31999,     32000,
-    32000,     32000,     32000,     32000,     32000,     32000,     32001,     32001,
-    32001,     32001,     32001,     32001,     32002,     32002,     32002,     32002,
-    32002,     32002,     32002,     32003,     32003,     32003,     32003,     32003,
-    32003,     32003,     32004,     32004,     32004,     32004,     32004,     32004,
-    32004,     32005,     32005,     32005,     32005,     32005,     32005,     32005,
-    32006,     32006,     32006,     32006,     32006,     32006,     32006,     32007,
-    32007,     32007,     32007,     32007,     32007,     32007,     32008,     32008,
-    32008,     32008,     32008,     32008,     32008,     32009,     32009,     32009,
-    32009,     32009,     32009,     32009,     32010,     32010,     32010,     32010,
-    32010,     32010,     32010,     32011,     32011,     32011,     32011,     32011,
-    32011,     32011,     32012,     32012,     32012,     32012,     32012,     32012,
-    32012,     32013,     32013,     32013,     32013,     32013,     32013,     32013,
-    32014,     32014,     32014,     32014,     32014,     32014,     32014,     32015,
-    32015,     32015,     32015,     32015,     32015,     32015,     32016,     32016,
-    32016,     32016,     32016,     32016,     32016,     32017,     32017,     32017,
-    32017,     32017,     32017,     32017,     32018,     32018,     32018,     32018,
-    32018,     32018,     32018,     32019,     32019,     32019,     32019,     32019,
-    32019,     32019,     32020,     32020,     32020,     32020,     32020,     32020,
-    32020,     32021,     32021,     32021,     32021,     32021,     32021,     32021,
-    32022,     32022,     32022,     32022,     32022,     32022,     32022,     32023,
-    32023,     32023,     32023,     32023,     32023,     32023,     32024,     32024,
-    32024,     32024,     32024,     32024,     32024,     32025,     32025,     32025,
-    32025,     32025,     32025,     32025,     32025,     32026,     32026,     32026,
-    32026,     32026,     32026,     32026,     32027,     32027,     32027,     32027,
-    32027,     32027,     32027,     32028,     32028,     32028,     32028,     32028,
-    32028,     32028,     32029,     32029,     32029,     32029,     32029,     32029,
-    32029,     32030,     32030,     32030,     32030,     32030,     32030,     32030,
-    32031,     32031,     32031,     32031,     32031,     32031,     32031,     32032,
-    32032,     32032,     32032,     32032,     32032,     32032,     32032,     32033,
-    32033,     32033,     32033,     32033,     32033,     32033,     32034,     32034,
-    32034,     32034,     32034,     32034,     32034,     32035,     32035,     32035,
-    32035,     32035,     32035,     32035,     32036,     32036,     32036,     32036,
-    32036,     32036,     32036,     32037,     32037,     32037,     32037,     32037,
-    32037,     32037,     32037,     32038,     32038,     32038,     32038,     32038,
-    32038,     32038,     32039,     32039,     32039,     32039,     32039,     32039,
-    32039,     32040,     32040,     32040,     32040,     32040,     32040,     32040,
-    32041,     32041,     32041,     32041,     32041,     32041,     32041,     32041,
-    32042,     32042,     32042,     32042,     32042,     32042,     32042,     32043,
-    32043,     32043,     32043,     32043,     32043,     32043,     32044,     32044,
-    32044,     32044,     32044,     32044,     32044,     32044,     32045,     32045,
-    32045,     32045,     32045,     32045,     32045,     32046,     32046,     32046,
-    32046,     32046,     32046,     32046,     32047,     32047,     32047,     32047,
-    32047,     32047,     32047,     32047,     32048,     32048,     32048,     32048,
-    32048,     32048,     32048,     32049,     32049,     32049,     32049,     32049,
-    32049,     32049,     32050,     32050,     32050,     32050,     32050,     32050,
-    32050,     32050,     32051,     32051,     32051,     32051,     32051,     32051,
-    32051,     32052,     32052,     32052,     32052,     32052,     32052,     32052,
-    32053,     32053,     32053,     32053,     32053,     32053,     32053,     32053,
-    32054,     32054,     32054,     32054,     32054,     32054,     32054,     32055,
-    32055,     32055,     32055,     32055,     32055,     32055,     32055,     32056,
-    32056,     32056,     32056,     32056,     32056,     32056,     32057,     32057,
-    32057,     32057,     32057,     32057,     32057,     32058,     32058,     32058,
-    32058,     32058,     32058,     32058,     32058,     32059,     32059,     32059,
-    32059,     32059,     32059,     32059,     32060,     32060,     32060,     32060,
-    32060,     32060,     32060,     32060,     32061,     32061,     32061,     32061,
-    32061,     32061,     32061,     32062,     32062,     32062,     32062,     32062,
-    32062,     32062,     32062,     32063,     32063,     32063,     32063,     32063,
-    32063,     32063,     32064,     32064,     32064,     32064,     32064,     32064,
-    32064,     32064,     32065,     32065,     32065,     32065,     32065,     32065,
-    32065,     32066,     32066,     32066,     32066,     32066,     32066,     32066,
-    32066,     32067,     32067,     32067,     32067,     32067,     32067,     32067,
-    32068,     32068,     32068,     32068,     32068,     32068,     32068,     32068,
-    32069,     32069,     32069,     32069,     32069,     32069,     32069,     32070,
-    32070,     32070,     32070,     32070,     32070,     32070,     32070,     32071,
-    32071,     32071,     32071,     32071,     32071,     32071,     32071,     32072,
-    32072,     32072,     32072,     32072,     32072,     32072,     32073,     32073,
-    32073,     32073,     32073,     32073,     32073,     32073,     32074,     32074,
-    32074,     32074,     32074,     32074,     32074,     32075,     32075,     32075,
-    32075,     32075,     32075,     32075,     32075,     32076,     32076,     32076,
-    32076,     32076,     32076,     32076,     32076,     32077,     32077,     32077,
-    32077,     32077,     32077,     32077,     32078,     32078,     32078,     32078,
-    32078,     32078,     32078,     32078,     32079,     32079,     32079,     32079,
-    32079,     32079,     32079,     32079,     32080,     32080,     32080,     32080,
-    32080,     32080,     32080,     32081,     32081,     32081,     32081,     32081,
-    32081,     32081,     32081,     32082,     32082,     32082,     32082,     32082,
-    32082,     32082,     32082,     32083,     32083,     32083,     32083,     32083,
-    32083,     32083,     32084,     32084,     32084,     32084,     32084,     32084,
-    32084,     32084,     32085,     32085,     32085,     32085,     32085,     32085,
-    32085,     32085,     32086,     32086,     32086,     32086,     32086,     32086,
-    32086,     32086,     32087,     32087,     32087,     32087,     32087,     32087,
-    32087,     32088,     32088,     32088,     32088,     32088,     32088,     32088,
-    32088,     32089,     32089,     32089,     32089,     32089,     32089,     32089,
-    32089,     32090,     32090,     32090,     32090,     32090,     32090,     32090,
-    32090,     32091,     32091,     32091,     32091,     32091,     32091,     32091,
-    32092,     32092,     32092,     32092,     32092,     32092,     32092,     32092,
-    32093,     32093,     32093,     32093,     32093,     32093,     32093,     32093,
-    32094,     32094,     32094,     32094,     32094,     32094,     32094,     32094,
-    32095,     32095,     32095,     32095,     32095,     32095,     32095,     32095,
-    32096,     32096,     32096,     32096,     32096,     32096,     32096,     32096,
-    32097,     32097,     32097,     32097,     32097,     32097,     32097,     32098,
-    32098,     32098,     32098,     32098,     32098,     32098,     32098,     32099,
-    32099,     32099,     32099,     32099,     32099,     32099,     32099,     32100,
-    32100,     32100,     32100,     32100,     32100,     32100,     32100,     32101,
-    32101,     32101,     32101,     32101,     32101,     32101,     32101,     32102,
-    32102,     32102,     32102,     32102,     32102,     32102,     32102,     32103,
-    32103,     32103,     32103,     32103,     32103,     32103,     32103,     32104,
-    32104,     32104,     32104,     32104,     32104,     32104,     32104,     32105,
-    32105,     32105,     32105,     32105,     32105,     32105,     32105,     32106,
-    32106,     32106,     32106,     32106,     32106,     32106,     32106,     32107,
-    32107,     32107,     32107,     32107,     32107,     32107,     32107,     32108,
-    32108,     32108,     32108,     32108,     32108,     32108,     32108,     32109,
-    32109,     32109,     32109,     32109,     32109,     32109,     32109,     32110,
-    32110,     32110,     32110,     32110,     32110,     32110,     32110,     32111,
-    32111,     32111,     32111,     32111,     32111,     32111,     32111,     32112,
-    32112,     32112,     32112,     32112,     32112,     32112,     32112,     32113,
-    32113,     32113,     32113,     32113,     32113,     32113,     32113,     32114,
-    32114,     32114,     32114,     32114,     32114,     32114,     32114,     32115,
-    32115,     32115,     32115,     32115,     32115,     32115,     32115,     32116,
-    32116,     32116,     32116,     32116,     32116,     32116,     32116,     32117,
-    32117,     32117,     32117,     32117,     32117,     32117,     32117,     32118,
-    32118,     32118,     32118,     32118,     32118,     32118,     32118,     32119,
-    32119,     32119,     32119,     32119,     32119,     32119,     32119,     32119,
-    32120,     32120,     32120,     32120,     32120,     32120,     32120,     32120,
-    32121,     32121,     32121,     32121,     32121,     32121,     32121,     32121,
-    32122,     32122,     32122,     32122,     32122,     32122,     32122,     32122,
-    32123,     32123,     32123,     32123,     32123,     32123,     32123,     32123,
-    32124,     32124,     32124,     32124,     32124,     32124,     32124,     32124,
-    32125,     32125,     32125,     32125,     32125,     32125,     32125,     32125,
-    32125,     32126,     32126,     32126,     32126,     32126,     32126,     32126,
-    32126,     32127,     32127,     32127,     32127,     32127,     32127,     32127,
-    32127,     32128,     32128,     32128,     32128,     32128,     32128,     32128,
-    32128,     32129,     32129,     32129,     32129,     32129,     32129,     32129,
-    32129,     32129,     32130,     32130,     32130,     32130,     32130,     32130,
-    32130,     32130,     32131,     32131,     32131,     32131,     32131,     32131,
-    32131,     32131,     32132,     32132,     32132,     32132,     32132,     32132,
-    32132,     32132,     32133,     32133,     32133,     32133,     32133,     32133,
-    32133,     32133,     32133,     32134,     32134,     32134,     32134,     32134,
-    32134,     32134,     32134,     32135,     32135,     32135,     32135,     32135,
-    32135,     32135,     32135,     32136,     32136,     32136,     32136,     32136,
-    32136,     32136,     32136,     32136,     32137,     32137,     32137,     32137,
-    32137,     32137,     32137,     32137,     32138,     32138,     32138,     32138,
-    32138,     32138,     32138,     32138,     32138,     32139,     32139,     32139,
-    32139,     32139,     32139,     32139,     32139,     32140,     32140,     32140,
-    32140,     32140,     32140,     32140,     32140,     32141,     32141,     32141,
-    32141,     32141,     32141,     32141,     32141,     32141,     32142,     32142,
-    32142,     32142,     32142,     32142,     32142,     32142,     32143,     32143,
-    32143,     32143,     32143,     32143,     32143,     32143,     32143,     32144,
-    32144,     32144,     32144,     32144,     32144,     32144,     32144,     32145,
-    32145,     32145,     32145,     32145,     32145,     32145,     32145,     32145,
-    32146,     32146,     32146,     32146,     32146,     32146,     32146,     32146,
-    32147,     32147,     32147,     32147,     32147,     32147,     32147,     32147,
-    32147,     32148,     32148,     32148,     32148,     32148,     32148,     32148,
-    32148,     32149,     32149,     32149,     32149,     32149,     32149,     32149,
-    32149,     32149,     32150,     32150,     32150,     32150,     32150,     32150,
-    32150,     32150,     32151,     32151,     32151,     32151,     32151,     32151,
-    32151,     32151,     32151,     32152,     32152,     32152,     32152,     32152,
-    32152,     32152,     32152,     32153,     32153,     32153,     32153,     32153,
-    32153,     32153,     32153,     32153,     32154,     32154,     32154,     32154,
-    32154,     32154,     32154,     32154,     32155,     32155,     32155,     32155,
-    32155,     32155,     32155,     32155,     32155,     32156,     32156,     32156,
-    32156,     32156,     32156,     32156,     32156,     32156,     32157,     32157,
-    32157,     32157,     32157,     32157,     32157,     32157,     32158,     32158,
-    32158,     32158,     32158,     32158,     32158,     32158,     32158,     32159,
-    32159,     32159,     32159,     32159,     32159,     32159,     32159,     32159,
-    32160,     32160,     32160,     32160,     32160,     32160,     32160,     32160,
-    32161,     32161,     32161,     32161,     32161,     32161,     32161,     32161,
-    32161,     32162,     32162,     32162,     32162,     32162,     32162,     32162,
-    32162,     32162,     32163,     32163,     32163,     32163,     32163,     32163,
-    32163,     32163,     32164,     32164,     32164,     32164,     32164,     32164,
-    32164,     32164,     32164,     32165,     32165,     32165,     32165,     32165,
-    32165,     32165,     32165,     32165,     32166,     32166,     32166,     32166,
-    32166,     32166,     32166,     32166,     32166,     32167,     32167,     32167,
-    32167,     32167,     32167,     32167,     32167,     32168,     32168,     32168,
-    32168,     32168,     32168,     32168,     32168,     32168,     32169,     32169,
-    32169,     32169,     32169,     32169,     32169,     32169,     32169,     32170,
-    32170,     32170,     32170,     32170,     32170,     32170,     32170,     32170,
-    32171,     32171,     32171,     32171,     32171,     32171,     32171,     32171,
-    32171,     32172,     32172,     32172,     32172,     32172,     32172,     32172,
-    32172,     32172,     32173,     32173,     32173,     32173,     32173,     32173,
-    32173,     32173,     32174,     32174,     32174,     32174,     32174,     32174,
-    32174,     32174,     32174,     32175,     32175,     32175,     32175,     32175,
-    32175,     32175,     32175,     32175,     32176,     32176,     32176,     32176,
-    32176,     32176,     32176,     32176,     32176,     32177,     32177,     32177,
-    32177,     32177,     32177,     32177,     32177,     32177,     32178,     32178,
-    32178,     32178,     32178,     32178,     32178,     32178,     32178,     32179,
-    32179,     32179,     32179,     32179,     32179,     32179,     32179,     32179,
-    32180,     32180,     32180,     32180,     32180,     32180,     32180,     32180,
-    32180,     32181,     32181,     32181,     32181,     32181,     32181,     32181,
-    32181,     32181,     32182,     32182,     32182,     32182,     32182,     32182,
-    32182,     32182,     32182,     32183,     32183,     32183,     32183,     32183,
-    32183,     32183,     32183,     32183,     32184,     32184,     32184,     32184,
-    32184,     32184,     32184,     32184,     32184,     32185,     32185,     32185,
-    32185,     32185,     32185,     32185,     32185,     32185,     32186,     32186,
-    32186,     32186,     32186,     32186,     32186,     32186,     32186,     32187,
-    32187,     32187,     32187,     32187,     32187,     32187,     32187,     32187,
-    32188,     32188,     32188,     32188,     32188,     32188,     32188,     32188,
-    32188,     32189,     32189,     32189,     32189,     32189,     32189,     32189,
-    32189,     32189,     32190,     32190,     32190,     32190,     32190,     32190,
-    32190,     32190,     32190,     32191,     32191,     32191,     32191,     32191,
-    32191,     32191,     32191,     32191,     32191,     32192,     32192,     32192,
-    32192,     32192,     32192,     32192,     32192,     32192,     32193,     32193,
-    32193,     32193,     32193,     32193,     32193,     32193,     32193,     32194,
-    32194,     32194,     32194,     32194,     32194,     32194,     32194,     32194,
-    32195,     32195,     32195,     32195,     32195,     32195,     32195,     32195,
-    32195,     32196,     32196,     32196,     32196,     32196,     32196,     32196,
-    32196,     32196,     32196,     32197,     32197,     32197,     32197,     32197,
-    32197,     32197,     32197,     32197,     32198,     32198,     32198,     32198,
-    32198,     32198,     32198,     32198,     32198,     32199,     32199,     32199,
-    32199,     32199,     32199,     32199,     32199,     32199,     32200,     32200,
-    32200,     32200,     32200,     32200,     32200,     32200,     32200,     32200,
-    32201,     32201,     32201,     32201,     32201,     32201,     32201,     32201,
-    32201,     32202,     32202,     32202,     32202,     32202,     32202,     32202,
-    32202,     32202,     32203,     32203,     32203,     32203,     32203,     32203,
-    32203,     32203,     32203,     32203,     32204,     32204,     32204,     32204,
-    32204,     32204,     32204,     32204,     32204,     32205,     32205,     32205,
-    32205,     32205,     32205,     32205,     32205,     32205,     32206,     32206,
-    32206,     32206,     32206,     32206,     32206,     32206,     32206,     32206,
-    32207,     32207,     32207,     32207,     32207,     32207,     32207,     32207,
-    32207,     32208,     32208,     32208,     32208,     32208,     32208,     32208,
-    32208,     32208,     32208,     32209,     32209,     32209,     32209,     32209,
-    32209,     32209,     32209,     32209,     32210,     32210,     32210,     32210,
-    32210,     32210,     32210,     32210,     32210,     32211,     32211,     32211,
-    32211,     32211,     32211,     32211,     32211,     32211,     32211,     32212,
-    32212,     32212,     32212,     32212,     32212,     32212,     32212,     32212,
-    32213,     32213,     32213,     32213,     32213,     32213,     32213,     32213,
-    32213,     32213,     32214,     32214,     32214,     32214,     32214,     32214,
-    32214,     32214,     32214,     32215,     32215,     32215,     32215,     32215,
-    32215,     32215,     32215,     32215,     32215,     32216,     32216,     32216,
-    32216,     32216,     32216,     32216,     32216,     32216,     32217,     32217,
-    32217,     32217,     32217,     32217,     32217,     32217,     32217,     32217,
-    32218,     32218,     32218,     32218,     32218,     32218,     32218,     32218,
-    32218,     32218,     32219,     32219,     32219,     32219,     32219,     32219,
-    32219,     32219,     32219,     32220,     32220,     32220,     32220,     32220,
-    32220,     32220,     32220,     32220,     32220,     32221,     32221,     32221,
-    32221,     32221,     32221,     32221,     32221,     32221,     32222,     32222,
-    32222,     32222,     32222,     32222,     32222,     32222,     32222,     32222,
-    32223,     32223,     32223,     32223,     32223,     32223,     32223,     32223,
-    32223,     32223,     32224,     32224,     32224,     32224,     32224,     32224,
-    32224,     32224,     32224,     32224,     32225,     32225,     32225,     32225,
-    32225,     32225,     32225,     32225,     32225,     32226,     32226,     32226,
-    32226,     32226,     32226,     32226,     32226,     32226,     32226,     32227,
-    32227,     32227,     32227,     32227,     32227,     32227,     32227,     32227,
-    32227,     32228,     32228,     32228,     32228,     32228,     32228,     32228,
-    32228,     32228,     32229,     32229,     32229,     32229,     32229,     32229,
-    32229,     32229,     32229,     32229,     32230,     32230,     32230,     32230,
-    32230,     32230,     32230,     32230,     32230,     32230,     32231,     32231,
-    32231,     32231,     32231,     32231,     32231,     32231,     32231,     32231,
-    32232,     32232,     32232,     32232,     32232,     32232,     32232,     32232,
-    32232,     32232,     32233,     32233,     32233,     32233,     32233,     32233,
-    32233,     32233,     32233,     32233,     32234,     32234,     32234,     32234,
-    32234,     32234,     32234,     32234,     32234,     32235,     32235,     32235,
-    32235,     32235,     32235,     32235,     32235,     32235,     32235,     32236,
-    32236,     32236,     32236,     32236,     32236,     32236,     32236,     32236,
-    32236,     32237,     32237,     32237,     32237,     32237,     32237,     32237,
-    32237,     32237,     32237,     32238,     32238,     32238,     32238,     32238,
-    32238,     32238,     32238,     32238,     32238,     32239,     32239,     32239,
-    32239,     32239,     32239,     32239,     32239,     32239,     32239,     32240,
-    32240,     32240,     32240,     32240,     32240,     32240,     32240,     32240,
-    32240,     32241,     32241,     32241,     32241,     32241,     32241,     32241,
-    32241,     32241,     32241,     32242,     32242,     32242,     32242,     32242,
-    32242,     32242,     32242,     32242,     32242,     32243,     32243,     32243,
-    32243,     32243,     32243,     32243,     32243,     32243,     32243,     32244,
-    32244,     32244,     32244,     32244,     32244,     32244,     32244,     32244,
-    32244,     32245,     32245,     32245,     32245,     32245,     32245,     32245,
-    32245,     32245,     32245,     32246,     32246,     32246,     32246,     32246,
-    32246,     32246,     32246,     32246,     32246,     32247,     32247,     32247,
-    32247,     32247,     32247,     32247,     32247,     32247,     32247,     32247,
-    32248,     32248,     32248,     32248,     32248,     32248,     32248,     32248,
-    32248,     32248,     32249,     32249,     32249,     32249,     32249,     32249,
-    32249,     32249,     32249,     32249,     32250,     32250,     32250,     32250,
-    32250,     32250,     32250,     32250,     32250,     32250,     32251,     32251,
-    32251,     32251,     32251,     32251,     32251,     32251,     32251,     32251,
-    32252,     32252,     32252,     32252,     32252,     32252,     32252,     32252,
-    32252,     32252,     32253,     32253,     32253,     32253,     32253,     32253,
-    32253,     32253,     32253,     32253,     32253,     32254,     32254,     32254,
-    32254,     32254,     32254,     32254,     32254,     32254,     32254,     32255,
-    32255,     32255,     32255,     32255,     32255,     32255,     32255,     32255,
-    32255,     32256,     32256,     32256,     32256,     32256,     32256,     32256,
-    32256,     32256,     32256,     32257,     32257,     32257,     32257,     32257,
-    32257,     32257,     32257,     32257,     32257,     32257,     32258,     32258,
-    32258,     32258,     32258,     32258,     32258,     32258,     32258,     32258,
-    32259,     32259,     32259,     32259,     32259,     32259,     32259,     32259,
-    32259,     32259,     32260,     32260,     32260,     32260,     32260,     32260,
-    32260,     32260,     32260,     32260,     32260,     32261,     32261,     32261,
-    32261,     32261,     32261,     32261,     32261,     32261,     32261,     32262,
-    32262,     32262,     32262,     32262,     32262,     32262,     32262,     32262,
-    32262,     32262,     32263,     32263,     32263,     32263,     32263,     32263,
-    32263,     32263,     32263,     32263,     32264,     32264,     32264,     32264,
-    32264,     32264,     32264,     32264,     32264,     32264,     32264,     32265,
-    32265,     32265,     32265,     32265,     32265,     32265,     32265,     32265,
-    32265,     32266,     32266,     32266,     32266,     32266,     32266,     32266,
-    32266,     32266,     32266,     32266,     32267,     32267,     32267,     32267,
-    32267,     32267,     32267,     32267,     32267,     32267,     32268,     32268,
-    32268,     32268,     32268,     32268,     32268,     32268,     32268,     32268,
-    32268,     32269,     32269,     32269,     32269,     32269,     32269,     32269,
-    32269,     32269,     32269,     32270,     32270,     32270,     32270,     32270,
-    32270,     32270,     32270,     32270,     32270,     32270,     32271,     32271,
-    32271,     32271,     32271,     32271,     32271,     32271,     32271,     32271,
-    32272,     32272,     32272,     32272,     32272,     32272,     32272,     32272,
-    32272,     32272,     32272,     32273,     32273,     32273,     32273,     32273,
-    32273,     32273,     32273,     32273,     32273,     32273,     32274,     32274,
-    32274,     32274,     32274,     32274,     32274,     32274,     32274,     32274,
-    32275,     32275,     32275,     32275,     32275,     32275,     32275,     32275,
-    32275,     32275,     32275,     32276,     32276,     32276,     32276,     32276,
-    32276,     32276,     32276,     32276,     32276,     32276,     32277,     32277,
-    32277,     32277,     32277,     32277,     32277,     32277,     32277,     32277,
-    32278,     32278,     32278,     32278,     32278,     32278,     32278,     32278,
-    32278,     32278,     32278,     32279,     32279,     32279,     32279,     32279,
-    32279,     32279,     32279,     32279,     32279,     32279,     32280,     32280,
-    32280,     32280,     32280,     32280,     32280,     32280,     32280,     32280,
-    32280,     32281,     32281,     32281,     32281,     32281,     32281,     32281,
-    32281,     32281,     32281,     32281,     32282,     32282,     32282,     32282,
-    32282,     32282,     32282,     32282,     32282,     32282,     32283,     32283,
-    32283,     32283,     32283,     32283,     32283,     32283,     32283,     32283,
-    32283,     32284,     32284,     32284,     32284,     32284,     32284,     32284,
-    32284,     32284,     32284,     32284,     32285,     32285,     32285,     32285,
-    32285,     32285,     32285,     32285,     32285,     32285,     32285,     32286,
-    32286,     32286,     32286,     32286,     32286,     32286,     32286,     32286,
-    32286,     32286,     32287,     32287,     32287,     32287,     32287,     32287,
-    32287,     32287,     32287,     32287,     32287,     32288,     32288,     32288,
-    32288,     32288,     32288,     32288,     32288,     32288,     32288,     32288,
-    32289,     32289,     32289,     32289,     32289,     32289,     32289,     32289,
-    32289,     32289,     32289,     32290,     32290,     32290,     32290,     32290,
-    32290,     32290,     32290,     32290,     32290,     32290,     32291,     32291,
-    32291,     32291,     32291,     32291,     32291,     32291,     32291,     32291,
-    32291,     32292,     32292,     32292,     32292,     32292,     32292,     32292,
-    32292,     32292,     32292,     32292,     32293,     32293,     32293,     32293,
-    32293,     32293,     32293,     32293,     32293,     32293,     32293,     32294,
-    32294,     32294,     32294,     32294,     32294,     32294,     32294,     32294,
-    32294,     32294,     32295,     32295,     32295,     32295,     32295,     32295,
-    32295,     32295,     32295,     32295,     32295,     32296,     32296,     32296,
-    32296,     32296,     32296,     32296,     32296,     32296,     32296,     32296,
-    32296,     32297,     32297,     32297,     32297,     32297,     32297,     32297,
-    32297,     32297,     32297,     32297,     32298,     32298,     32298,     32298,
-    32298,     32298,     32298,     32298,     32298,     32298,     32298,     32299,
-    32299,     32299,     32299,     32299,     32299,     32299,     32299,     32299,
-    32299,     32299,     32300,     32300,     32300,     32300,     32300,     32300,
-    32300,     32300,     32300,     32300,     32300,     32300,     32301,     32301,
-    32301,     32301,     32301,     32301,     32301,     32301,     32301,     32301,
-    32301,     32302,     32302,     32302,     32302,     32302,     32302,     32302,
-    32302,     32302,     32302,     32302,     32303,     32303,     32303,     32303,
-    32303,     32303,     32303,     32303,     32303,     32303,     32303,     32304,
-    32304,     32304,     32304,     32304,     32304,     32304,     32304,     32304,
-    32304,     32304,     32304,     32305,     32305,     32305,     32305,     32305,
-    32305,     32305,     32305,     32305,     32305,     32305,     32306,     32306,
-    32306,     32306,     32306,     32306,     32306,     32306,     32306,     32306,
-    32306,     32306,     32307,     32307,     32307,     32307,     32307,     32307,
-    32307,     32307,     32307,     32307,     32307,     32308,     32308,     32308,
-    32308,     32308,     32308,     32308,     32308,     32308,     32308,     32308,
-    32309,     32309,     32309,     32309,     32309,     32309,     32309,     32309,
-    32309,     32309,     32309,     32309,     32310,     32310,     32310,     32310,
-    32310,     32310,     32310,     32310,     32310,     32310,     32310,     32311,
-    32311,     32311,     32311,     32311,     32311,     32311,     32311,     32311,
-    32311,     32311,     32311,     32312,     32312,     32312,     32312,     32312,
-    32312,     32312,     32312,     32312,     32312,     32312,     32312,     32313,
-    32313,     32313,     32313,     32313,     32313,     32313,     32313,     32313,
-    32313,     32313,     32314,     32314,     32314,     32314,     32314,     32314,
-    32314,     32314,     32314,     32314,     32314,     32314,     32315,     32315,
-    32315,     32315,     32315,     32315,     32315,     32315,     32315,     32315,
-    32315,     32316,     32316,     32316,     32316,     32316,     32316,     32316,
-    32316,     32316,     32316,     32316,     32316,     32317,     32317,     32317,
-    32317,     32317,     32317,     32317,     32317,     32317,     32317,     32317,
-    32317,     32318,     32318,     32318,     32318,     32318,     32318,     32318,
-    32318,     32318,     32318,     32318,     32319,     32319,     32319,     32319,
-    32319,     32319,     32319,     32319,     32319,     32319,     32319,     32319,
-    32320,     32320,     32320,     32320,     32320,     32320,     32320,     32320,
-    32320,     32320,     32320,     32320,     32321,     32321,     32321,     32321,
-    32321,     32321,     32321,     32321,     32321,     32321,     32321,     32321,
-    32322,     32322,     32322,     32322,     32322,     32322,     32322,     32322,
-    32322,     32322,     32322,     32323,     32323,     32323,     32323,     32323,
-    32323,     32323,     32323,     32323,     32323,     32323,     32323,     32324,
-    32324,     32324,     32324,     32324,     32324,     32324,     32324,     32324,
-    32324,     32324,     32324,     32325,     32325,     32325,     32325,     32325,
-    32325,     32325,     32325,     32325,     32325,     32325,     32325,     32326,
-    32326,     32326,     32326,     32326,     32326,     32326,     32326,     32326,
-    32326,     32326,     32326,     32327,     32327,     32327,     32327,     32327,
-    32327,     32327,     32327,     32327,     32327,     32327,     32327,     32328,
-    32328,     32328,     32328,     32328,     32328,     32328,     32328,     32328,
-    32328,     32328,     32328,     32329,     32329,     32329,     32329,     32329,
-    32329,     32329,     32329,     32329,     32329,     32329,     32329,     32330,
-    32330,     32330,     32330,     32330,     32330,     32330,     32330,     32330,
-    32330,     32330,     32330,     32331,     32331,     32331,     32331,     32331,
-    32331,     32331,     32331,     32331,     32331,     32331,     32331,     32332,
-    32332,     32332,     32332,     32332,     32332,     32332,     32332,     32332,
-    32332,     32332,     32332,     32333,     32333,     32333,     32333,     32333,
-    32333,     32333,     32333,     32333,     32333,     32333,     32333,     32334,
-    32334,     32334,     32334,     32334,     32334,     32334,     32334,     32334,
-    32334,     32334,     32334,     32335,     32335,     32335,     32335,     32335,
-    32335,     32335,     32335,     32335,     32335,     32335,     32335,     32335,
-    32336,     32336,     32336,     32336,     32336,     32336,     32336,     32336,
-    32336,     32336,     32336,     32336,     32337,     32337,     32337,     32337,
-    32337,     32337,     32337,     32337,     32337,     32337,     32337,     32337,
-    32338,     32338,     32338,     32338,     32338,     32338,     32338,     32338,
-    32338,     32338,     32338,     32338,     32339,     32339,     32339,     32339,
-    32339,     32339,     32339,     32339,     32339,     32339,     32339,     32339,
-    32340,     32340,     32340,     32340,     32340,     32340,     32340,     32340,
-    32340,     32340,     32340,     32340,     32340,     32341,     32341,     32341,
-    32341,     32341,     32341,     32341,     32341,     32341,     32341,     32341,
-    32341,     32342,     32342,     32342,     32342,     32342,     32342,     32342,
-    32342,     32342,     32342,     32342,     32342,     32343,     32343,     32343,
-    32343,     32343,     32343,     32343,     32343,     32343,     32343,     32343,
-    32343,     32343,     32344,     32344,     32344,     32344,     32344,     32344,
-    32344,     32344,     32344,     32344,     32344,     32344,     32345,     32345,
-    32345,     32345,     32345,     32345,     32345,     32345,     32345,     32345,
-    32345,     32345,     32345,     32346,     32346,     32346,     32346,     32346,
-    32346,     32346,     32346,     32346,     32346,     32346,     32346,     32347,
-    32347,     32347,     32347,     32347,     32347,     32347,     32347,     32347,
-    32347,     32347,     32347,     32347,     32348,     32348,     32348,     32348,
-    32348,     32348,     32348,     32348,     32348,     32348,     32348,     32348,
-    32349,     32349,     32349,     32349,     32349,     32349,     32349,     32349,
-    32349,     32349,     32349,     32349,     32349,     32350,     32350,     32350,
-    32350,     32350,     32350,     32350,     32350,     32350,     32350,     32350,
-    32350,     32351,     32351,     32351,     32351,     32351,     32351,     32351,
-    32351,     32351,     32351,     32351,     32351,     32351,     32352,     32352,
-    32352,     32352,     32352,     32352,     32352,     32352,     32352,     32352,
-    32352,     32352,     32352,     32353,     32353,     32353,     32353,     32353,
-    32353,     32353,     32353,     32353,     32353,     32353,     32353,     32354,
-    32354,     32354,     32354,     32354,     32354,     32354,     32354,     32354,
-    32354,     32354,     32354,     32354,     32355,     32355,     32355,     32355,
-    32355,     32355,     32355,     32355,     32355,     32355,     32355,     32355,
-    32355,     32356,     32356,     32356,     32356,     32356,     32356,     32356,
-    32356,     32356,     32356,     32356,     32356,     32356,     32357,     32357,
-    32357,     32357,     32357,     32357,     32357,     32357,     32357,     32357,
-    32357,     32357,     32357,     32358,     32358,     32358,     32358,     32358,
-    32358,     32358,     32358,     32358,     32358,     32358,     32358,     32359,
-    32359,     32359,     32359,     32359,     32359,     32359,     32359,     32359,
-    32359,     32359,     32359,     32359,     32360,     32360,     32360,     32360,
-    32360,     32360,     32360,     32360,     32360,     32360,     32360,     32360,
-    32360,     32361,     32361,     32361,     32361,     32361,     32361,     32361,
-    32361,     32361,     32361,     32361,     32361,     32361,     32362,     32362,
-    32362,     32362,     32362,     32362,     32362,     32362,     32362,     32362,
-    32362,     32362,     32362,     32363,     32363,     32363,     32363,     32363,
-    32363,     32363,     32363,     32363,     32363,     32363,     32363,     32363,
-    32364,     32364,     32364,     32364,     32364,     32364,     32364,     32364,
-    32364,     32364,     32364,     32364,     32364,     32365,     32365,     32365,
-    32365,     32365,     32365,     32365,     32365,     32365,     32365,     32365,
-    32365,     32365,     32366,     32366,     32366,     32366,     32366,     32366,
-    32366,     32366,     32366,     32366,     32366,     32366,     32366,     32367,
-    32367,     32367,     32367,     32367,     32367,     32367,     32367,     32367,
-    32367,     32367,     32367,     32367,     32368,     32368,     32368,     32368,
-    32368,     32368,     32368,     32368,     32368,     32368,     32368,     32368,
-    32368,     32368,     32369,     32369,     32369,     32369,     32369,     32369,
-    32369,     32369,     32369,     32369,     32369,     32369,     32369,     32370,
-    32370,     32370,     32370,     32370,     32370,     32370,     32370,     32370,
-    32370,     32370,     32370,     32370,     32371,     32371,     32371,     32371,
-    32371,     32371,     32371,     32371,     32371,     32371,     32371,     32371,
-    32371,     32372,     32372,     32372,     32372,     32372,     32372,     32372,
-    32372,     32372,     32372,     32372,     32372,     32372,     32372,     32373,
-    32373,     32373,     32373,     32373,     32373,     32373,     32373,     32373,
-    32373,     32373,     32373,     32373,     32374,     32374,     32374,     32374,
-    32374,     32374,     32374,     32374,     32374,     32374,     32374,     32374,
-    32374,     32375,     32375,     32375,     32375,     32375,     32375,     32375,
-    32375,     32375,     32375,     32375,     32375,     32375,     32375,     32376,
-    32376,     32376,     32376,     32376,     32376,     32376,     32376,     32376,
-    32376,     32376,     32376,     32376,     32377,     32377,     32377,     32377,
-    32377,     32377,     32377,     32377,     32377,     32377,     32377,     32377,
-    32377,     32377,     32378,     32378,     32378,     32378,     32378,     32378,
-    32378,     32378,     32378,     32378,     32378,     32378,     32378,     32379,
-    32379,     32379,     32379,     32379,     32379,     32379,     32379,     32379,
-    32379,     32379,     32379,     32379,     32379,     32380,     32380,     32380,
-    32380,     32380,     32380,     32380,     32380,     32380,     32380,     32380,
-    32380,     32380,     32381,     32381,     32381,     32381,     32381,     32381,
-    32381,     32381,     32381,     32381,     32381,     32381,     32381,     32381,
-    32382,     32382,     32382,     32382,     32382,     32382,     32382,     32382,
-    32382,     32382,     32382,     32382,     32382,     32383,     32383,     32383,
-    32383,     32383,     32383,     32383,     32383,     32383,     32383,     32383,
-    32383,     32383,     32383,     32384,     32384,     32384,     32384,     32384,
-    32384,     32384,     32384,     32384,     32384,     32384,     32384,     32384,
-    32384,     32385,     32385,     32385,     32385,     32385,     32385,     32385,
-    32385,     32385,     32385,     32385,     32385,     32385,     32385,     32386,
-    32386,     32386,     32386,     32386,     32386,     32386,     32386,     32386,
-    32386,     32386,     32386,     32386,     32387,     32387,     32387,     32387,
-    32387,     32387,     32387,     32387,     32387,     32387,     32387,     32387,
-    32387,     32387,     32388,     32388,     32388,     32388,     32388,     32388,
-    32388,     32388,     32388,     32388,     32388,     32388,     32388,     32388,
-    32389,     32389,     32389,     32389,     32389,     32389,     32389,     32389,
-    32389,     32389,     32389,     32389,     32389,     32389,     32390,     32390,
-    32390,     32390,     32390,     32390,     32390,     32390,     32390,     32390,
-    32390,     32390,     32390,     32390,     32391,     32391,     32391,     32391,
-    32391,     32391,     32391,     32391,     32391,     32391,     32391,     32391,
-    32391,     32391,     32392,     32392,     32392,     32392,     32392,     32392,
-    32392,     32392,     32392,     32392,     32392,     32392,     32392,     32392,
-    32393,     32393,     32393,     32393,     32393,     32393,     32393,     32393,
-    32393,     32393,     32393,     32393,     32393,     32393,     32394,     32394,
-    32394,     32394,     32394,     32394,     32394,     32394,     32394,     32394,
-    32394,     32394,     32394,     32394,     32395,     32395,     32395,     32395,
-    32395,     32395,     32395,     32395,     32395,     32395,     32395,     32395,
-    32395,     32395,     32396,     32396,     32396,     32396,     32396,     32396,
-    32396,     32396,     32396,     32396,     32396,     32396,     32396,     32396,
-    32397,     32397,     32397,     32397,     32397,     32397,     32397,     32397,
-    32397,     32397,     32397,     32397,     32397,     32397,     32398,     32398,
-    32398,     32398,     32398,     32398,     32398,     32398,     32398,     32398,
-    32398,     32398,     32398,     32398,     32398,     32399,     32399,     32399,
-    32399,     32399,     32399,     32399,     32399,     32399,     32399,     32399,
-    32399,     32399,     32399,     32400,     32400,     32400,     32400,     32400,
-    32400,     32400,     32400,     32400,     32400,     32400,     32400,     32400,
-    32400,     32401,     32401,     32401,     32401,     32401,     32401,     32401,
-    32401,     32401,     32401,     32401,     32401,     32401,     32401,     32401,
-    32402,     32402,     32402,     32402,     32402,     32402,     32402,     32402,
-    32402,     32402,     32402,     32402,     32402,     32402,     32403,     32403,
-    32403,     32403,     32403,     32403,     32403,     32403,     32403,     32403,
-    32403,     32403,     32403,     32403,     32404,     32404,     32404,     32404,
-    32404,     32404,     32404,     32404,     32404,     32404,     32404,     32404,
-    32404,     32404,     32404,     32405,     32405,     32405,     32405,     32405,
-    32405,     32405,     32405,     32405,     32405,     32405,     32405,     32405,
-    32405,     32406,     32406,     32406,     32406,     32406,     32406,     32406,
-    32406,     32406,     32406,     32406,     32406,     32406,     32406,     32406,
-    32407,     32407,     32407,     32407,     32407,     32407,     32407,     32407,
-    32407,     32407,     32407,     32407,     32407,     32407,     32407,     32408,
-    32408,     32408,     32408,     32408,     32408,     32408,     32408,     32408,
-    32408,     32408,     32408,     32408,     32408,     32409,     32409,     32409,
-    32409,     32409,     32409,     32409,     32409,     32409,     32409,     32409,
-    32409,     32409,     32409,     32409,     32410,     32410,     32410,     32410,
-    32410,     32410,     32410,     32410,     32410,     32410,     32410,     32410,
-    32410,     32410,     32410,     32411,     32411,     32411,     32411,     32411,
-    32411,     32411,     32411,     32411,     32411,     32411,     32411,     32411,
-    32411,     32412,     32412,     32412,     32412,     32412,     32412,     32412,
-    32412,     32412,     32412,     32412,     32412,     32412,     32412,     32412,
-    32413,     32413,     32413,     32413,     32413,     32413,     32413,     32413,
-    32413,     32413,     32413,     32413,     32413,     32413,     32413,     32414,
-    32414,     32414,     32414,     32414,     32414,     32414,     32414,     32414,
-    32414,     32414,     32414,     32414,     32414,     32414,     32415,     32415,
-    32415,     32415,     32415,     32415,     32415,     32415,     32415,     32415,
-    32415,     32415,     32415,     32415,     32415,     32416,     32416,     32416,
-    32416,     32416,     32416,     32416,     32416,     32416,     32416,     32416,
-    32416,     32416,     32416,     32416,     32417,     32417,     32417,     32417,
-    32417,     32417,     32417,     32417,     32417,     32417,     32417,     32417,
-    32417,     32417,     32417,     32418,     32418,     32418,     32418,     32418,
-    32418,     32418,     32418,     32418,     32418,     32418,     32418,     32418,
-    32418,     32418,     32419,     32419,     32419,     32419,     32419,     32419,
-    32419,     32419,     32419,     32419,     32419,     32419,     32419,     32419,
-    32419,     32420,     32420,     32420,     32420,     32420,     32420,     32420,
-    32420,     32420,     32420,     32420,     32420,     32420,     32420,     32420,
-    32421,     32421,     32421,     32421,     32421,     32421,     32421,     32421,
-    32421,     32421,     32421,     32421,     32421,     32421,     32421,     32422,
-    32422,     32422,     32422,     32422,     32422,     32422,     32422,     32422,
-    32422,     32422,     32422,     32422,     32422,     32422,     32423,     32423,
-    32423,     32423,     32423,     32423,     32423,     32423,     32423,     32423,
-    32423,     32423,     32423,     32423,     32423,     32423,     32424,     32424,
-    32424,     32424,     32424,     32424,     32424,     32424,     32424,     32424,
-    32424,     32424,     32424,     32424,     32424,     32425,     32425,     32425,
-    32425,     32425,     32425,     32425,     32425,     32425,     32425,     32425,
-    32425,     32425,     32425,     32425,     32426,     32426,     32426,     32426,
-    32426,     32426,     32426,     32426,     32426,     32426,     32426,     32426,
-    32426,     32426,     32426,     32426,     32427,     32427,     32427,     32427,
-    32427,     32427,     32427,     32427,     32427,     32427,     32427,     32427,
-    32427,     32427,     32427,     32428,     32428,     32428,     32428,     32428,
-    32428,     32428,     32428,     32428,     32428,     32428,     32428,     32428,
-    32428,     32428,     32428,     32429,     32429,     32429,     32429,     32429,
-    32429,     32429,     32429,     32429,     32429,     32429,     32429,     32429,
-    32429,     32429,     32430,     32430,     32430,     32430,     32430,     32430,
-    32430,     32430,     32430,     32430,     32430,     32430,     32430,     32430,
-    32430,     32430,     32431,     32431,     32431,     32431,     32431,     32431,
-    32431,     32431,     32431,     32431,     32431,     32431,     32431,     32431,
-    32431,     32432,     32432,     32432,     32432,     32432,     32432,     32432,
-    32432,     32432,     32432,     32432,     32432,     32432,     32432,     32432,
-    32432,     32433,     32433,     32433,     32433,     32433,     32433,     32433,
-    32433,     32433,     32433,     32433,     32433,     32433,     32433,     32433,
-    32433,     32434,     32434,     32434,     32434,     32434,     32434,     32434,
-    32434,     32434,     32434,     32434,     32434,     32434,     32434,     32434,
-    32435,     32435,     32435,     32435,     32435,     32435,     32435,     32435,
-    32435,     32435,     32435,     32435,     32435,     32435,     32435,     32435,
-    32436,     32436,     32436,     32436,     32436,     32436,     32436,     32436,
-    32436,     32436,     32436,     32436,     32436,     32436,     32436,     32436,
-    32437,     32437,     32437,     32437,     32437,     32437,     32437,     32437,
-    32437,     32437,     32437,     32437,     32437,     32437,     32437,     32437,
-    32438,     32438,     32438,     32438,     32438,     32438,     32438,     32438,
-    32438,     32438,     32438,     32438,     32438,     32438,     32438,     32438,
-    32439,     32439,     32439,     32439,     32439,     32439,     32439,     32439,
-    32439,     32439,     32439,     32439,     32439,     32439,     32439,     32439,
-    32440,     32440,     32440,     32440,     32440,     32440,     32440,     32440,
-    32440,     32440,     32440,     32440,     32440,     32440,     32440,     32440,
-    32441,     32441,     32441,     32441,     32441,     32441,     32441,     32441,
-    32441,     32441,     32441,     32441,     32441,     32441,     32441,     32441,
-    32442,     32442,     32442,     32442,     32442,     32442,     32442,     32442,
-    32442,     32442,     32442,     32442,     32442,     32442,     32442,     32442,
-    32443,     32443,     32443,     32443,     32443,     32443,     32443,     32443,
-    32443,     32443,     32443,     32443,     32443,     32443,     32443,     32443,
-    32444,     32444,     32444,     32444,     32444,     32444,     32444,     32444,
-    32444,     32444,     32444,     32444,     32444,     32444,     32444,     32444,
-    32444,     32445,     32445,     32445,     32445,     32445,     32445,     32445,
-    32445,     32445,     32445,     32445,     32445,     32445,     32445,     32445,
-    32445,     32446,     32446,     32446,     32446,     32446,     32446,     32446,
-    32446,     32446,     32446,     32446,     32446,     32446,     32446,     32446,
-    32446,     32447,     32447,     32447,     32447,     32447,     32447,     32447,
-    32447,     32447,     32447,     32447,     32447,     32447,     32447,     32447,
-    32447,     32447,     32448,     32448,     32448,     32448,     32448,     32448,
-    32448,     32448,     32448,     32448,     32448,     32448,     32448,     32448,
-    32448,     32448,     32449,     32449,     32449,     32449,     32449,     32449,
-    32449,     32449,     32449,     32449,     32449,     32449,     32449,     32449,
-    32449,     32449,     32449,     32450,     32450,     32450,     32450,     32450,
-    32450,     32450,     32450,     32450,     32450,     32450,     32450,     32450,
-    32450,     32450,     32450,     32451,     32451,     32451,     32451,     32451,
-    32451,     32451,     32451,     32451,     32451,     32451,     32451,     32451,
-    32451,     32451,     32451,     32451,     32452,     32452,     32452,     32452,
-    32452,     32452,     32452,     32452,     32452,     32452,     32452,     32452,
-    32452,     32452,     32452,     32452,     32452,     32453,     32453,     32453,
-    32453,     32453,     32453,     32453,     32453,     32453,     32453,     32453,
-    32453,     32453,     32453,     32453,     32453,     32454,     32454,     32454,
-    32454,     32454,     32454,     32454,     32454,     32454,     32454,     32454,
-    32454,     32454,     32454,     32454,     32454,     32454,     32455,     32455,
-    32455,     32455,     32455,     32455,     32455,     32455,     32455,     32455,
-    32455,     32455,     32455,     32455,     32455,     32455,     32455,     32456,
-    32456,     32456,     32456,     32456,     32456,     32456,     32456,     32456,
-    32456,     32456,     32456,     32456,     32456,     32456,     32456,     32456,
-    32457,     32457,     32457,     32457,     32457,     32457,     32457,     32457,
-    32457,     32457,     32457,     32457,     32457,     32457,     32457,     32457,
-    32457,     32458,     32458,     32458,     32458,     32458,     32458,     32458,
-    32458,     32458,     32458,     32458,     32458,     32458,     32458,     32458,
-    32458,     32458,     32459,     32459,     32459,     32459,     32459,     32459,
-    32459,     32459,     32459,     32459,     32459,     32459,     32459,     32459,
-    32459,     32459,     32459,     32460,     32460,     32460,     32460,     32460,
-    32460,     32460,     32460,     32460,     32460,     32460,     32460,     32460,
-    32460,     32460,     32460,     32460,     32461,     32461,     32461,     32461,
-    32461,     32461,     32461,     32461,     32461,     32461,     32461,     32461,
-    32461,     32461,     32461,     32461,     32461,     32462,     32462,     32462,
-    32462,     32462,     32462,     32462,     32462,     32462,     32462,     32462,
-    32462,     32462,     32462,     32462,     32462,     32462,     32463,     32463,
-    32463,     32463,     32463,     32463,     32463,     32463,     32463,     32463,
-    32463,     32463,     32463,     32463,     32463,     32463,     32463,     32464,
-    32464,     32464,     32464,     32464,     32464,     32464,     32464,     32464,
-    32464,     32464,     32464,     32464,     32464,     32464,     32464,     32464,
-    32464,     32465,     32465,     32465,     32465,     32465,     32465,     32465,
-    32465,     32465,     32465,     32465,     32465,     32465,     32465,     32465,
-    32465,     32465,     32466,     32466,     32466,     32466,     32466,     32466,
-    32466,     32466,     32466,     32466,     32466,     32466,     32466,     32466,
-    32466,     32466,     32466,     32466,     32467,     32467,     32467,     32467,
-    32467,     32467,     32467,     32467,     32467,     32467,     32467,     32467,
-    32467,     32467,     32467,     32467,     32467,     32468,     32468,     32468,
-    32468,     32468,     32468,     32468,     32468,     32468,     32468,     32468,
-    32468,     32468,     32468,     32468,     32468,     32468,     32468,     32469,
-    32469,     32469,     32469,     32469,     32469,     32469,     32469,     32469,
-    32469,     32469,     32469,     32469,     32469,     32469,     32469,     32469,
-    32470,     32470,     32470,     32470,     32470,     32470,     32470,     32470,
-    32470,     32470,     32470,     32470,     32470,     32470,     32470,     32470,
-    32470,     32470,     32471,     32471,     32471,     32471,     32471,     32471,
-    32471,     32471,     32471,     32471,     32471,     32471,     32471,     32471,
-    32471,     32471,     32471,     32471,     32472,     32472,     32472,     32472,
-    32472,     32472,     32472,     32472,     32472,     32472,     32472,     32472,
-    32472,     32472,     32472,     32472,     32472,     32473,     32473,     32473,
-    32473,     32473,     32473,     32473,     32473,     32473,     32473,     32473,
-    32473,     32473,     32473,     32473,     32473,     32473,     32473,     32474,
-    32474,     32474,     32474,     32474,     32474,     32474,     32474,     32474,
-    32474,     32474,     32474,     32474,     32474,     32474,     32474,     32474,
-    32474,     32475,     32475,     32475,     32475,     32475,     32475,     32475,
-    32475,     32475,     32475,     32475,     32475,     32475,     32475,     32475,
-    32475,     32475,     32475,     32476,     32476,     32476,     32476,     32476,
-    32476,     32476,     32476,     32476,     32476,     32476,     32476,     32476,
-    32476,     32476,     32476,     32476,     32476,     32477,     32477,     32477,
-    32477,     32477,     32477,     32477,     32477,     32477,     32477,     32477,
-    32477,     32477,     32477,     32477,     32477,     32477,     32477,     32478,
-    32478,     32478,     32478,     32478,     32478,     32478,     32478,     32478,
-    32478,     32478,     32478,     32478,     32478,     32478,     32478,     32478,
-    32478,     32479,     32479,     32479,     32479,     32479,     32479,     32479,
-    32479,     32479,     32479,     32479,     32479,     32479,     32479,     32479,
-    32479,     32479,     32479,     32479,     32480,     32480,     32480,     32480,
-    32480,     32480,     32480,     32480,     32480,     32480,     32480,     32480,
-    32480,     32480,     32480,     32480,     32480,     32480,     32481,     32481,
-    32481,     32481,     32481,     32481,     32481,     32481,     32481,     32481,
-    32481,     32481,     32481,     32481,     32481,     32481,     32481,     32481,
-    32482,     32482,     32482,     32482,     32482,     32482,     32482,     32482,
-    32482,     32482,     32482,     32482,     32482,     32482,     32482,     32482,
-    32482,     32482,     32482,     32483,     32483,     32483,     32483,     32483,
-    32483,     32483,     32483,     32483,     32483,     32483,     32483,     32483,
-    32483,     32483,     32483,     32483,     32483,     32484,     32484,     32484,
-    32484,     32484,     32484,     32484,     32484,     32484,     32484,     32484,
-    32484,     32484,     32484,     32484,     32484,     32484,     32484,     32484,
-    32485,     32485,     32485,     32485,     32485,     32485,     32485,     32485,
-    32485,     32485,     32485,     32485,     32485,     32485,     32485,     32485,
-    32485,     32485,     32486,     32486,     32486,     32486,     32486,     32486,
-    32486,     32486,     32486,     32486,     32486,     32486,     32486,     32486,
-    32486,     32486,     32486,     32486,     32486,     32487,     32487,     32487,
-    32487,     32487,     32487,     32487,     32487,     32487,     32487,     32487,
-    32487,     32487,     32487,     32487,     32487,     32487,     32487,     32487,
-    32488,     32488,     32488,     32488,     32488,     32488,     32488,     32488,
-    32488,     32488,     32488,     32488,     32488,     32488,     32488,     32488,
-    32488,     32488,     32488,     32489,     32489,     32489,     32489,     32489,
-    32489,     32489,     32489,     32489,     32489,     32489,     32489,     32489,
-    32489,     32489,     32489,     32489,     32489,     32490,     32490,     32490,
-    32490,     32490,     32490,     32490,     32490,     32490,     32490,     32490,
-    32490,     32490,     32490,     32490,     32490,     32490,     32490,     32490,
-    32491,     32491,     32491,     32491,     32491,     32491,     32491,     32491,
-    32491,     32491,     32491,     32491,     32491,     32491,     32491,     32491,
-    32491,     32491,     32491,     32492,     32492,     32492,     32492,     32492,
-    32492,     32492,     32492,     32492,     32492,     32492,     32492,     32492,
-    32492,     32492,     32492,     32492,     32492,     32492,     32493,     32493,
-    32493,     32493,     32493,     32493,     32493,     32493,     32493,     32493,
-    32493,     32493,     32493,     32493,     32493,     32493,     32493,     32493,
-    32493,     32493,     32494,     32494,     32494,     32494,     32494,     32494,
-    32494,     32494,     32494,     32494,     32494,     32494,     32494,     32494,
-    32494,     32494,     32494,     32494,     32494,     32495,     32495,     32495,
-    32495,     32495,     32495,     32495,     32495,     32495,     32495,     32495,
-    32495,     32495,     32495,     32495,     32495,     32495,     32495,     32495,
-    32496,     32496,     32496,     32496,     32496,     32496,     32496,     32496,
-    32496,     32496,     32496,     32496,     32496,     32496,     32496,     32496,
-    32496,     32496,     32496,     32497,     32497,     32497,     32497,     32497,
-    32497,     32497,     32497,     32497,     32497,     32497,     32497,     32497,
-    32497,     32497,     32497,     32497,     32497,     32497,     32497,     32498,
-    32498,     32498,     32498,     32498,     32498,     32498,     32498,     32498,
-    32498,     32498,     32498,     32498,     32498,     32498,     32498,     32498,
-    32498,     32498,     32499,     32499,     32499,     32499,     32499,     32499,
-    32499,     32499,     32499,     32499,     32499,     32499,     32499,     32499,
-    32499,     32499,     32499,     32499,     32499,     32499,     32500,     32500,
-    32500,     32500,     32500,     32500,     32500,     32500,     32500,     32500,
-    32500,     32500,     32500,     32500,     32500,     32500,     32500,     32500,
-    32500,     32500,     32501,     32501,     32501,     32501,     32501,     32501,
-    32501,     32501,     32501,     32501,     32501,     32501,     32501,     32501,
-    32501,     32501,     32501,     32501,     32501,     32502,     32502,     32502,
-    32502,     32502,     32502,     32502,     32502,     32502,     32502,     32502,
-    32502,     32502,     32502,     32502,     32502,     32502,     32502,     32502,
-    32502,     32503,     32503,     32503,     32503,     32503,     32503,     32503,
-    32503,     32503,     32503,     32503,     32503,     32503,     32503,     32503,
-    32503,     32503,     32503,     32503,     32503,     32504,     32504,     32504,
-    32504,     32504,     32504,     32504,     32504,     32504,     32504,     32504,
-    32504,     32504,     32504,     32504,     32504,     32504,     32504,     32504,
-    32504,     32505,     32505,     32505,     32505,     32505,     32505,     32505,
-    32505,     32505,     32505,     32505,     32505,     32505,     32505,     32505,
-    32505,     32505,     32505,     32505,     32505,     32506,     32506,     32506,
-    32506,     32506,     32506,     32506,     32506,     32506,     32506,     32506,
-    32506,     32506,     32506,     32506,     32506,     32506,     32506,     32506,
-    32506,     32507,     32507,     32507,     32507,     32507,     32507,     32507,
-    32507,     32507,     32507,     32507,     32507,     32507,     32507,     32507,
-    32507,     32507,     32507,     32507,     32507,     32508,     32508,     32508,
-    32508,     32508,     32508,     32508,     32508,     32508,     32508,     32508,
-    32508,     32508,     32508,     32508,     32508,     32508,     32508,     32508,
-    32508,     32509,     32509,     32509,     32509,     32509,     32509,     32509,
-    32509,     32509,     32509,     32509,     32509,     32509,     32509,     32509,
-    32509,     32509,     32509,     32509,     32509,     32509,     32510,     32510,
-    32510,     32510,     32510,     32510,     32510,     32510,     32510,     32510,
-    32510,     32510,     32510,     32510,     32510,     32510,     32510,     32510,
-    32510,     32510,     32511,     32511,     32511,     32511,     32511,     32511,
-    32511,     32511,     32511,     32511,     32511,     32511,     32511,     32511,
-    32511,     32511,     32511,     32511,     32511,     32511,     32511,     32512,
-    32512,     32512,     32512,     32512,     32512,     32512,     32512,     32512,
-    32512,     32512,     32512,     32512,     32512,     32512,     32512,     32512,
-    32512,     32512,     32512,     32513,     32513,     32513,     32513,     32513,
-    32513,     32513,     32513,     32513,     32513,     32513,     32513,     32513,
-    32513,     32513,     32513,     32513,     32513,     32513,     32513,     32513,
-    32514,     32514,     32514,     32514,     32514,     32514,     32514,     32514,
-    32514,     32514,     32514,     32514,     32514,     32514,     32514,     32514,
-    32514,     32514,     32514,     32514,     32514,     32515,     32515,     32515,
-    32515,     32515,     32515,     32515,     32515,     32515,     32515,     32515,
-    32515,     32515,     32515,     32515,     32515,     32515,     32515,     32515,
-    32515,     32516,     32516,     32516,     32516,     32516,     32516,     32516,
-    32516,     32516,     32516,     32516,     32516,     32516,     32516,     32516,
-    32516,     32516,     32516,     32516,     32516,     32516,     32517,     32517,
-    32517,     32517,     32517,     32517,     32517,     32517,     32517,     32517,
-    32517,     32517,     32517,     32517,     32517,     32517,     32517,     32517,
-    32517,     32517,     32517,     32518,     32518,     32518,     32518,     32518,
-    32518,     32518,     32518,     32518,     32518,     32518,     32518,     32518,
-    32518,     32518,     32518,     32518,     32518,     32518,     32518,     32518,
-    32519,     32519,     32519,     32519,     32519,     32519,     32519,     32519,
-    32519,     32519,     32519,     32519,     32519,     32519,     32519,     32519,
-    32519,     32519,     32519,     32519,     32519,     32519,     32520,     32520,
-    32520,     32520,     32520,     32520,     32520,     32520,     32520,     32520,
-    32520,     32520,     32520,     32520,     32520,     32520,     32520,     32520,
-    32520,     32520,     32520,     32521,     32521,     32521,     32521,     32521,
-    32521,     32521,     32521,     32521,     32521,     32521,     32521,     32521,
-    32521,     32521,     32521,     32521,     32521,     32521,     32521,     32521,
-    32522,     32522,     32522,     32522,     32522,     32522,     32522,     32522,
-    32522,     32522,     32522,     32522,     32522,     32522,     32522,     32522,
-    32522,     32522,     32522,     32522,     32522,     32522,     32523,     32523,
-    32523,     32523,     32523,     32523,     32523,     32523,     32523,     32523,
-    32523,     32523,     32523,     32523,     32523,     32523,     32523,     32523,
-    32523,     32523,     32523,     32524,     32524,     32524,     32524,     32524,
-    32524,     32524,     32524,     32524,     32524,     32524,     32524,     32524,
-    32524,     32524,     32524,     32524,     32524,     32524,     32524,     32524,
-    32524,     32525,     32525,     32525,     32525,     32525,     32525,     32525,
-    32525,     32525,     32525,     32525,     32525,     32525,     32525,     32525,
-    32525,     32525,     32525,     32525,     32525,     32525,     32526,     32526,
-    32526,     32526,     32526,     32526,     32526,     32526,     32526,     32526,
-    32526,     32526,     32526,     32526,     32526,     32526,     32526,     32526,
-    32526,     32526,     32526,     32526,     32527,     32527,     32527,     32527,
-    32527,     32527,     32527,     32527,     32527,     32527,     32527,     32527,
-    32527,     32527,     32527,     32527,     32527,     32527,     32527,     32527,
-    32527,     32527,     32528,     32528,     32528,     32528,     32528,     32528,
-    32528,     32528,     32528,     32528,     32528,     32528,     32528,     32528,
-    32528,     32528,     32528,     32528,     32528,     32528,     32528,     32528,
-    32529,     32529,     32529,     32529,     32529,     32529,     32529,     32529,
-    32529,     32529,     32529,     32529,     32529,     32529,     32529,     32529,
-    32529,     32529,     32529,     32529,     32529,     32529,     32530,     32530,
-    32530,     32530,     32530,     32530,     32530,     32530,     32530,     32530,
-    32530,     32530,     32530,     32530,     32530,     32530,     32530,     32530,
-    32530,     32530,     32530,     32530,     32531,     32531,     32531,     32531,
-    32531,     32531,     32531,     32531,     32531,     32531,     32531,     32531,
-    32531,     32531,     32531,     32531,     32531,     32531,     32531,     32531,
-    32531,     32531,     32532,     32532,     32532,     32532,     32532,     32532,
-    32532,     32532,     32532,     32532,     32532,     32532,     32532,     32532,
-    32532,     32532,     32532,     32532,     32532,     32532,     32532,     32532,
-    32532,     32533,     32533,     32533,     32533,     32533,     32533,     32533,
-    32533,     32533,     32533,     32533,     32533,     32533,     32533,     32533,
-    32533,     32533,     32533,     32533,     32533,     32533,     32533,     32534,
-    32534,     32534,     32534,     32534,     32534,     32534,     32534,     32534,
-    32534,     32534,     32534,     32534,     32534,     32534,     32534,     32534,
-    32534,     32534,     32534,     32534,     32534,     32534,     32535,     32535,
-    32535,     32535,     32535,     32535,     32535,     32535,     32535,     32535,
-    32535,     32535,     32535,     32535,     32535,     32535,     32535,     32535,
-    32535,     32535,     32535,     32535,     32536,     32536,     32536,     32536,
-    32536,     32536,     32536,     32536,     32536,     32536,     32536,     32536,
-    32536,     32536,     32536,     32536,     32536,     32536,     32536,     32536,
-    32536,     32536,     32536,     32537,     32537,     32537,     32537,     32537,
-    32537,     32537,     32537,     32537,     32537,     32537,     32537,     32537,
-    32537,     32537,     32537,     32537,     32537,     32537,     32537,     32537,
-    32537,     32537,     32538,     32538,     32538,     32538,     32538,     32538,
-    32538,     32538,     32538,     32538,     32538,     32538,     32538,     32538,
-    32538,     32538,     32538,     32538,     32538,     32538,     32538,     32538,
-    32538,     32539,     32539,     32539,     32539,     32539,     32539,     32539,
-    32539,     32539,     32539,     32539,     32539,     32539,     32539,     32539,
-    32539,     32539,     32539,     32539,     32539,     32539,     32539,     32539,
-    32540,     32540,     32540,     32540,     32540,     32540,     32540,     32540,
-    32540,     32540,     32540,     32540,     32540,     32540,     32540,     32540,
-    32540,     32540,     32540,     32540,     32540,     32540,     32540,     32541,
-    32541,     32541,     32541,     32541,     32541,     32541,     32541,     32541,
-    32541,     32541,     32541,     32541,     32541,     32541,     32541,     32541,
-    32541,     32541,     32541,     32541,     32541,     32541,     32542,     32542,
-    32542,     32542,     32542,     32542,     32542,     32542,     32542,     32542,
-    32542,     32542,     32542,     32542,     32542,     32542,     32542,     32542,
-    32542,     32542,     32542,     32542,     32542,     32543,     32543,     32543,
-    32543,     32543,     32543,     32543,     32543,     32543,     32543,     32543,
-    32543,     32543,     32543,     32543,     32543,     32543,     32543,     32543,
-    32543,     32543,     32543,     32543,     32543,     32544,     32544,     32544,
-    32544,     32544,     32544,     32544,     32544,     32544,     32544,     32544,
-    32544,     32544,     32544,     32544,     32544,     32544,     32544,     32544,
-    32544,     32544,     32544,     32544,     32545,     32545,     32545,     32545,
-    32545,     32545,     32545,     32545,     32545,     32545,     32545,     32545,
-    32545,     32545,     32545,     32545,     32545,     32545,     32545,     32545,
-    32545,     32545,     32545,     32545,     32546,     32546,     32546,     32546,
-    32546,     32546,     32546,     32546,     32546,     32546,     32546,     32546,
-    32546,     32546,     32546,     32546,     32546,     32546,     32546,     32546,
-    32546,     32546,     32546,     32547,     32547,     32547,     32547,     32547,
-    32547,     32547,     32547,     32547,     32547,     32547,     32547,     32547,
-    32547,     32547,     32547,     32547,     32547,     32547,     32547,     32547,
-    32547,     32547,     32547,     32548,     32548,     32548,     32548,     32548,
-    32548,     32548,     32548,     32548,     32548,     32548,     32548,     32548,
-    32548,     32548,     32548,     32548,     32548,     32548,     32548,     32548,
-    32548,     32548,     32548,     32549,     32549,     32549,     32549,     32549,
-    32549,     32549,     32549,     32549,     32549,     32549,     32549,     32549,
-    32549,     32549,     32549,     32549,     32549,     32549,     32549,     32549,
-    32549,     32549,     32549,     32550,     32550,     32550,     32550,     32550,
-    32550,     32550,     32550,     32550,     32550,     32550,     32550,     32550,
-    32550,     32550,     32550,     32550,     32550,     32550,     32550,     32550,
-    32550,     32550,     32550,     32551,     32551,     32551,     32551,     32551,
-    32551,     32551,     32551,     32551,     32551,     32551,     32551,     32551,
-    32551,     32551,     32551,     32551,     32551,     32551,     32551,     32551,
-    32551,     32551,     32551,     32551,     32552,     32552,     32552,     32552,
-    32552,     32552,     32552,     32552,     32552,     32552,     32552,     32552,
-    32552,     32552,     32552,     32552,     32552,     32552,     32552,     32552,
-    32552,     32552,     32552,     32552,     32553,     32553,     32553,     32553,
-    32553,     32553,     32553,     32553,     32553,     32553,     32553,     32553,
-    32553,     32553,     32553,     32553,     32553,     32553,     32553,     32553,
-    32553,     32553,     32553,     32553,     32553,     32554,     32554,     32554,
-    32554,     32554,     32554,     32554,     32554,     32554,     32554,     32554,
-    32554,     32554,     32554,     32554,     32554,     32554,     32554,     32554,
-    32554,     32554,     32554,     32554,     32554,     32555,     32555,     32555,
-    32555,     32555,     32555,     32555,     32555,     32555,     32555,     32555,
-    32555,     32555,     32555,     32555,     32555,     32555,     32555,     32555,
-    32555,     32555,     32555,     32555,     32555,     32555,     32556,     32556,
-    32556,     32556,     32556,     32556,     32556,     32556,     32556,     32556,
-    32556,     32556,     32556,     32556,     32556,     32556,     32556,     32556,
-    32556,     32556,     32556,     32556,     32556,     32556,     32556,     32557,
-    32557,     32557,     32557,     32557,     32557,     32557,     32557,     32557,
-    32557,     32557,     32557,     32557,     32557,     32557,     32557,     32557,
-    32557,     32557,     32557,     32557,     32557,     32557,     32557,     32557,
-    32558,     32558,     32558,     32558,     32558,     32558,     32558,     32558,
-    32558,     32558,     32558,     32558,     32558,     32558,     32558,     32558,
-    32558,     32558,     32558,     32558,     32558,     32558,     32558,     32558,
-    32558,     32559,     32559,     32559,     32559,     32559,     32559,     32559,
-    32559,     32559,     32559,     32559,     32559,     32559,     32559,     32559,
-    32559,     32559,     32559,     32559,     32559,     32559,     32559,     32559,
-    32559,     32559,     32560,     32560,     32560,     32560,     32560,     32560,
-    32560,     32560,     32560,     32560,     32560,     32560,     32560,     32560,
-    32560,     32560,     32560,     32560,     32560,     32560,     32560,     32560,
-    32560,     32560,     32560,     32561,     32561,     32561,     32561,     32561,
-    32561,     32561,     32561,     32561,     32561,     32561,     32561,     32561,
-    32561,     32561,     32561,     32561,     32561,     32561,     32561,     32561,
-    32561,     32561,     32561,     32561,     32561,     32562,     32562,     32562,
-    32562,     32562,     32562,     32562,     32562,     32562,     32562,     32562,
-    32562,     32562,     32562,     32562,     32562,     32562,     32562,     32562,
-    32562,     32562,     32562,     32562,     32562,     32562,     32563,     32563,
-    32563,     32563,     32563,     32563,     32563,     32563,     32563,     32563,
-    32563,     32563,     32563,     32563,     32563,     32563,     32563,     32563,
-    32563,     32563,     32563,     32563,     32563,     32563,     32563,     32563,
-    32564,     32564,     32564,     32564,     32564,     32564,     32564,     32564,
-    32564,     32564,     32564,     32564,     32564,     32564,     32564,     32564,
-    32564,     32564,     32564,     32564,     32564,     32564,     32564,     32564,
-    32564,     32564,     32565,     32565,     32565,     32565,     32565,     32565,
-    32565,     32565,     32565,     32565,     32565,     32565,     32565,     32565,
-    32565,     32565,     32565,     32565,     32565,     32565,     32565,     32565,
-    32565,     32565,     32565,     32565,     32566,     32566,     32566,     32566,
-    32566,     32566,     32566,     32566,     32566,     32566,     32566,     32566,
-    32566,     32566,     32566,     32566,     32566,     32566,     32566,     32566,
-    32566,     32566,     32566,     32566,     32566,     32566,     32567,     32567,
-    32567,     32567,     32567,     32567,     32567,     32567,     32567,     32567,
-    32567,     32567,     32567,     32567,     32567,     32567,     32567,     32567,
-    32567,     32567,     32567,     32567,     32567,     32567,     32567,     32567,
-    32568,     32568,     32568,     32568,     32568,     32568,     32568,     32568,
-    32568,     32568,     32568,     32568,     32568,     32568,     32568,     32568,
-    32568,     32568,     32568,     32568,     32568,     32568,     32568,     32568,
-    32568,     32568,     32568,     32569,     32569,     32569,     32569,     32569,
-    32569,     32569,     32569,     32569,     32569,     32569,     32569,     32569,
-    32569,     32569,     32569,     32569,     32569,     32569,     32569,     32569,
-    32569,     32569,     32569,     32569,     32569,     32570,     32570,     32570,
-    32570,     32570,     32570,     32570,     32570,     32570,     32570,     32570,
-    32570,     32570,     32570,     32570,     32570,     32570,     32570,     32570,
-    32570,     32570,     32570,     32570,     32570,     32570,     32570,     32570,
-    32571,     32571,     32571,     32571,     32571,     32571,     32571,     32571,
-    32571,     32571,     32571,     32571,     32571,     32571,     32571,     32571,
-    32571,     32571,     32571,     32571,     32571,     32571,     32571,     32571,
-    32571,     32571,     32571,     32572,     32572,     32572,     32572,     32572,
-    32572,     32572,     32572,     32572,     32572,     32572,     32572,     32572,
-    32572,     32572,     32572,     32572,     32572,     32572,     32572,     32572,
-    32572,     32572,     32572,     32572,     32572,     32573,     32573,     32573,
-    32573,     32573,     32573,     32573,     32573,     32573,     32573,     32573,
-    32573,     32573,     32573,     32573,     32573,     32573,     32573,     32573,
-    32573,     32573,     32573,     32573,     32573,     32573,     32573,     32573,
-    32574,     32574,     32574,     32574,     32574,     32574,     32574,     32574,
-    32574,     32574,     32574,     32574,     32574,     32574,     32574,     32574,
-    32574,     32574,     32574,     32574,     32574,     32574,     32574,     32574,
-    32574,     32574,     32574,     32574,     32575,     32575,     32575,     32575,
-    32575,     32575,     32575,     32575,     32575,     32575,     32575,     32575,
-    32575,     32575,     32575,     32575,     32575,     32575,     32575,     32575,
-    32575,     32575,     32575,     32575,     32575,     32575,     32575,     32576,
-    32576,     32576,     32576,     32576,     32576,     32576,     32576,     32576,
-    32576,     32576,     32576,     32576,     32576,     32576,     32576,     32576,
-    32576,     32576,     32576,     32576,     32576,     32576,     32576,     32576,
-    32576,     32576,     32577,     32577,     32577,     32577,     32577,     32577,
-    32577,     32577,     32577,     32577,     32577,     32577,     32577,     32577,
-    32577,     32577,     32577,     32577,     32577,     32577,     32577,     32577,
-    32577,     32577,     32577,     32577,     32577,     32577,     32578,     32578,
-    32578,     32578,     32578,     32578,     32578,     32578,     32578,     32578,
-    32578,     32578,     32578,     32578,     32578,     32578,     32578,     32578,
-    32578,     32578,     32578,     32578,     32578,     32578,     32578,     32578,
-    32578,     32578,     32579,     32579,     32579,     32579,     32579,     32579,
-    32579,     32579,     32579,     32579,     32579,     32579,     32579,     32579,
-    32579,     32579,     32579,     32579,     32579,     32579,     32579,     32579,
-    32579,     32579,     32579,     32579,     32579,     32579,     32580,     32580,
-    32580,     32580,     32580,     32580,     32580,     32580,     32580,     32580,
-    32580,     32580,     32580,     32580,     32580,     32580,     32580,     32580,
-    32580,     32580,     32580,     32580,     32580,     32580,     32580,     32580,
-    32580,     32580,     32581,     32581,     32581,     32581,     32581,     32581,
-    32581,     32581,     32581,     32581,     32581,     32581,     32581,     32581,
-    32581,     32581,     32581,     32581,     32581,     32581,     32581,     32581,
-    32581,     32581,     32581,     32581,     32581,     32581,     32582,     32582,
-    32582,     32582,     32582,     32582,     32582,     32582,     32582,     32582,
-    32582,     32582,     32582,     32582,     32582,     32582,     32582,     32582,
-    32582,     32582,     32582,     32582,     32582,     32582,     32582,     32582,
-    32582,     32582,     32583,     32583,     32583,     32583,     32583,     32583,
-    32583,     32583,     32583,     32583,     32583,     32583,     32583,     32583,
-    32583,     32583,     32583,     32583,     32583,     32583,     32583,     32583,
-    32583,     32583,     32583,     32583,     32583,     32583,     32583,     32584,
-    32584,     32584,     32584,     32584,     32584,     32584,     32584,     32584,
-    32584,     32584,     32584,     32584,     32584,     32584,     32584,     32584,
-    32584,     32584,     32584,     32584,     32584,     32584,     32584,     32584,
-    32584,     32584,     32584,     32585,     32585,     32585,     32585,     32585,
-    32585,     32585,     32585,     32585,     32585,     32585,     32585,     32585,
-    32585,     32585,     32585,     32585,     32585,     32585,     32585,     32585,
-    32585,     32585,     32585,     32585,     32585,     32585,     32585,     32585,
-    32586,     32586,     32586,     32586,     32586,     32586,     32586,     32586,
-    32586,     32586,     32586,     32586,     32586,     32586,     32586,     32586,
-    32586,     32586,     32586,     32586,     32586,     32586,     32586,     32586,
-    32586,     32586,     32586,     32586,     32586,     32587,     32587,     32587,
-    32587,     32587,     32587,     32587,     32587,     32587,     32587,     32587,
-    32587,     32587,     32587,     32587,     32587,     32587,     32587,     32587,
-    32587,     32587,     32587,     32587,     32587,     32587,     32587,     32587,
-    32587,     32587,     32588,     32588,     32588,     32588,     32588,     32588,
-    32588,     32588,     32588,     32588,     32588,     32588,     32588,     32588,
-    32588,     32588,     32588,     32588,     32588,     32588,     32588,     32588,
-    32588,     32588,     32588,     32588,     32588,     32588,     32588,     32588,
-    32589,     32589,     32589,     32589,     32589,     32589,     32589,     32589,
-    32589,     32589,     32589,     32589,     32589,     32589,     32589,     32589,
-    32589,     32589,     32589,     32589,     32589,     32589,     32589,     32589,
-    32589,     32589,     32589,     32589,     32589,     32590,     32590,     32590,
-    32590,     32590,     32590,     32590,     32590,     32590,     32590,     32590,
-    32590,     32590,     32590,     32590,     32590,     32590,     32590,     32590,
-    32590,     32590,     32590,     32590,     32590,     32590,     32590,     32590,
-    32590,     32590,     32590,     32591,     32591,     32591,     32591,     32591,
-    32591,     32591,     32591,     32591,     32591,     32591,     32591,     32591,
-    32591,     32591,     32591,     32591,     32591,     32591,     32591,     32591,
-    32591,     32591,     32591,     32591,     32591,     32591,     32591,     32591,
-    32592,     32592,     32592,     32592,     32592,     32592,     32592,     32592,
-    32592,     32592,     32592,     32592,     32592,     32592,     32592,     32592,
-    32592,     32592,     32592,     32592,     32592,     32592,     32592,     32592,
-    32592,     32592,     32592,     32592,     32592,     32592,     32593,     32593,
-    32593,     32593,     32593,     32593,     32593,     32593,     32593,     32593,
-    32593,     32593,     32593,     32593,     32593,     32593,     32593,     32593,
-    32593,     32593,     32593,     32593,     32593,     32593,     32593,     32593,
-    32593,     32593,     32593,     32593,     32593,     32594,     32594,     32594,
-    32594,     32594,     32594,     32594,     32594,     32594,     32594,     32594,
-    32594,     32594,     32594,     32594,     32594,     32594,     32594,     32594,
-    32594,     32594,     32594,     32594,     32594,     32594,     32594,     32594,
-    32594,     32594,     32594,     32595,     32595,     32595,     32595,     32595,
-    32595,     32595,     32595,     32595,     32595,     32595,     32595,     32595,
-    32595,     32595,     32595,     32595,     32595,     32595,     32595,     32595,
-    32595,     32595,     32595,     32595,     32595,     32595,     32595,     32595,
-    32595,     32596,     32596,     32596,     32596,     32596,     32596,     32596,
-    32596,     32596,     32596,     32596,     32596,     32596,     32596,     32596,
-    32596,     32596,     32596,     32596,     32596,     32596,     32596,     32596,
-    32596,     32596,     32596,     32596,     32596,     32596,     32596,     32596,
-    32597,     32597,     32597,     32597,     32597,     32597,     32597,     32597,
-    32597,     32597,     32597,     32597,     32597,     32597,     32597,     32597,
-    32597,     32597,     32597,     32597,     32597,     32597,     32597,     32597,
-    32597,     32597,     32597,     32597,     32597,     32597,     32597,     32598,
-    32598,     32598,     32598,     32598,     32598,     32598,     32598,     32598,
-    32598,     32598,     32598,     32598,     32598,     32598,     32598,     32598,
-    32598,     32598,     32598,     32598,     32598,     32598,     32598,     32598,
-    32598,     32598,     32598,     32598,     32598,     32598,     32599,     32599,
-    32599,     32599,     32599,     32599,     32599,     32599,     32599,     32599,
-    32599,     32599,     32599,     32599,     32599,     32599,     32599,     32599,
-    32599,     32599,     32599,     32599,     32599,     32599,     32599,     32599,
-    32599,     32599,     32599,     32599,     32599,     32600,     32600,     32600,
-    32600,     32600,     32600,     32600,     32600,     32600,     32600,     32600,
-    32600,     32600,     32600,     32600,     32600,     32600,     32600,     32600,
-    32600,     32600,     32600,     32600,     32600,     32600,     32600,     32600,
-    32600,     32600,     32600,     32600,     32600,     32601,     32601,     32601,
-    32601,     32601,     32601,     32601,     32601,     32601,     32601,     32601,
-    32601,     32601,     32601,     32601,     32601,     32601,     32601,     32601,
-    32601,     32601,     32601,     32601,     32601,     32601,     32601,     32601,
-    32601,     32601,     32601,     32601,     32602,     32602,     32602,     32602,
-    32602,     32602,     32602,     32602,     32602,     32602,     32602,     32602,
-    32602,     32602,     32602,     32602,     32602,     32602,     32602,     32602,
-    32602,     32602,     32602,     32602,     32602,     32602,     32602,     32602,
-    32602,     32602,     32602,     32602,     32603,     32603,     32603,     32603,
-    32603,     32603,     32603,     32603,     32603,     32603,     32603,     32603,
-    32603,     32603,     32603,     32603,     32603,     32603,     32603,     32603,
-    32603,     32603,     32603,     32603,     32603,     32603,     32603,     32603,
-    32603,     32603,     32603,     32603,     32604,     32604,     32604,     32604,
-    32604,     32604,     32604,     32604,     32604,     32604,     32604,     32604,
-    32604,     32604,     32604,     32604,     32604,     32604,     32604,     32604,
-    32604,     32604,     32604,     32604,     32604,     32604,     32604,     32604,
-    32604,     32604,     32604,     32604,     32605,     32605,     32605,     32605,
-    32605,     32605,     32605,     32605,     32605,     32605,     32605,     32605,
-    32605,     32605,     32605,     32605,     32605,     32605,     32605,     32605,
-    32605,     32605,     32605,     32605,     32605,     32605,     32605,     32605,
-    32605,     32605,     32605,     32605,     32606,     32606,     32606,     32606,
-    32606,     32606,     32606,     32606,     32606,     32606,     32606,     32606,
-    32606,     32606,     32606,     32606,     32606,     32606,     32606,     32606,
-    32606,     32606,     32606,     32606,     32606,     32606,     32606,     32606,
-    32606,     32606,     32606,     32606,     32606,     32607,     32607,     32607,
-    32607,     32607,     32607,     32607,     32607,     32607,     32607,     32607,
-    32607,     32607,     32607,     32607,     32607,     32607,     32607,     32607,
-    32607,     32607,     32607,     32607,     32607,     32607,     32607,     32607,
-    32607,     32607,     32607,     32607,     32607,     32607,     32608,     32608,
-    32608,     32608,     32608,     32608,     32608,     32608,     32608,     32608,
-    32608,     32608,     32608,     32608,     32608,     32608,     32608,     32608,
-    32608,     32608,     32608,     32608,     32608,     32608,     32608,     32608,
-    32608,     32608,     32608,     32608,     32608,     32608,     32608,     32609,
-    32609,     32609,     32609,     32609,     32609,     32609,     32609,     32609,
-    32609,     32609,     32609,     32609,     32609,     32609,     32609,     32609,
-    32609,     32609,     32609,     32609,     32609,     32609,     32609,     32609,
-    32609,     32609,     32609,     32609,     32609,     32609,     32609,     32609,
-    32610,     32610,     32610,     32610,     32610,     32610,     32610,     32610,
-    32610,     32610,     32610,     32610,     32610,     32610,     32610,     32610,
-    32610,     32610,     32610,     32610,     32610,     32610,     32610,     32610,
-    32610,     32610,     32610,     32610,     32610,     32610,     32610,     32610,
-    32610,     32611,     32611,     32611,     32611,     32611,     32611,     32611,
-    32611,     32611,     32611,     32611,     32611,     32611,     32611,     32611,
-    32611,     32611,     32611,     32611,     32611,     32611,     32611,     32611,
-    32611,     32611,     32611,     32611,     32611,     32611,     32611,     32611,
-    32611,     32611,     32611,     32612,     32612,     32612,     32612,     32612,
-    32612,     32612,     32612,     32612,     32612,     32612,     32612,     32612,
-    32612,     32612,     32612,     32612,     32612,     32612,     32612,     32612,
-    32612,     32612,     32612,     32612,     32612,     32612,     32612,     32612,
-    32612,     32612,     32612,     32612,     32612,     32613,     32613,     32613,
-    32613,     32613,     32613,     32613,     32613,     32613,     32613,     32613,
-    32613,     32613,     32613,     32613,     32613,     32613,     32613,     32613,
-    32613,     32613,     32613,     32613,     32613,     32613,     32613,     32613,
-    32613,     32613,     32613,     32613,     32613,     32613,     32613,     32614,
-    32614,     32614,     32614,     32614,     32614,     32614,     32614,     32614,
-    32614,     32614,     32614,     32614,     32614,     32614,     32614,     32614,
-    32614,     32614,     32614,     32614,     32614,     32614,     32614,     32614,
-    32614,     32614,     32614,     32614,     32614,     32614,     32614,     32614,
-    32614,     32615,     32615,     32615,     32615,     32615,     32615,     32615,
-    32615,     32615,     32615,     32615,     32615,     32615,     32615,     32615,
-    32615,     32615,     32615,     32615,     32615,     32615,     32615,     32615,
-    32615,     32615,     32615,     32615,     32615,     32615,     32615,     32615,
-    32615,     32615,     32615,     32615,     32616,     32616,     32616,     32616,
-    32616,     32616,     32616,     32616,     32616,     32616,     32616,     32616,
-    32616,     32616,     32616,     32616,     32616,     32616,     32616,     32616,
-    32616,     32616,     32616,     32616,     32616,     32616,     32616,     32616,
-    32616,     32616,     32616,     32616,     32616,     32616,     32617,     32617,
-    32617,     32617,     32617,     32617,     32617,     32617,     32617,     32617,
-    32617,     32617,     32617,     32617,     32617,     32617,     32617,     32617,
-    32617,     32617,     32617,     32617,     32617,     32617,     32617,     32617,
-    32617,     32617,     32617,     32617,     32617,     32617,     32617,     32617,
-    32617,     32618,     32618,     32618,     32618,     32618,     32618,     32618,
-    32618,     32618,     32618,     32618,     32618,     32618,     32618,     32618,
-    32618,     32618,     32618,     32618,     32618,     32618,     32618,     32618,
-    32618,     32618,     32618,     32618,     32618,     32618,     32618,     32618,
-    32618,     32618,     32618,     32618,     32618,     32619,     32619,     32619,
-    32619,     32619,     32619,     32619,     32619,     32619,     32619,     32619,
-    32619,     32619,     32619,     32619,     32619,     32619,     32619,     32619,
-    32619,     32619,     32619,     32619,     32619,     32619,     32619,     32619,
-    32619,     32619,     32619,     32619,     32619,     32619,     32619,     32619,
-    32620,     32620,     32620,     32620,     32620,     32620,     32620,     32620,
-    32620,     32620,     32620,     32620,     32620,     32620,     32620,     32620,
-    32620,     32620,     32620,     32620,     32620,     32620,     32620,     32620,
-    32620,     32620,     32620,     32620,     32620,     32620,     32620,     32620,
-    32620,     32620,     32620,     32620,     32621,     32621,     32621,     32621,
-    32621,     32621,     32621,     32621,     32621,     32621,     32621,     32621,
-    32621,     32621,     32621,     32621,     32621,     32621,     32621,     32621,
-    32621,     32621,     32621,     32621,     32621,     32621,     32621,     32621,
-    32621,     32621,     32621,     32621,     32621,     32621,     32621,     32621,
-    32622,     32622,     32622,     32622,     32622,     32622,     32622,     32622,
-    32622,     32622,     32622,     32622,     32622,     32622,     32622,     32622,
-    32622,     32622,     32622,     32622,     32622,     32622,     32622,     32622,
-    32622,     32622,     32622,     32622,     32622,     32622,     32622,     32622,
-    32622,     32622,     32622,     32622,     32623,     32623,     32623,     32623,
-    32623,     32623,     32623,     32623,     32623,     32623,     32623,     32623,
-    32623,     32623,     32623,     32623,     32623,     32623,     32623,     32623,
-    32623,     32623,     32623,     32623,     32623,     32623,     32623,     32623,
-    32623,     32623,     32623,     32623,     32623,     32623,     32623,     32623,
-    32624,     32624,     32624,     32624,     32624,     32624,     32624,     32624,
-    32624,     32624,     32624,     32624,     32624,     32624,     32624,     32624,
-    32624,     32624,     32624,     32624,     32624,     32624,     32624,     32624,
-    32624,     32624,     32624,     32624,     32624,     32624,     32624,     32624,
-    32624,     32624,     32624,     32624,     32624,     32625,     32625,     32625,
-    32625,     32625,     32625,     32625,     32625,     32625,     32625,     32625,
-    32625,     32625,     32625,     32625,     32625,     32625,     32625,     32625,
-    32625,     32625,     32625,     32625,     32625,     32625,     32625,     32625,
-    32625,     32625,     32625,     32625,     32625,     32625,     32625,     32625,
-    32625,     32625,     32626,     32626,     32626,     32626,     32626,     32626,
-    32626,     32626,     32626,     32626,     32626,     32626,     32626,     32626,
-    32626,     32626,     32626,     32626,     32626,     32626,     32626,     32626,
-    32626,     32626,     32626,     32626,     32626,     32626,     32626,     32626,
-    32626,     32626,     32626,     32626,     32626,     32626,     32626,     32627,
-    32627,     32627,     32627,     32627,     32627,     32627,     32627,     32627,
-    32627,     32627,     32627,     32627,     32627,     32627,     32627,     32627,
-    32627,     32627,     32627,     32627,     32627,     32627,     32627,     32627,
-    32627,     32627,     32627,     32627,     32627,     32627,     32627,     32627,
-    32627,     32627,     32627,     32627,     32628,     32628,     32628,     32628,
-    32628,     32628,     32628,     32628,     32628,     32628,     32628,     32628,
-    32628,     32628,     32628,     32628,     32628,     32628,     32628,     32628,
-    32628,     32628,     32628,     32628,     32628,     32628,     32628,     32628,
-    32628,     32628,     32628,     32628,     32628,     32628,     32628,     32628,
-    32628,     32628,     32629,     32629,     32629,     32629,     32629,     32629,
-    32629,     32629,     32629,     32629,     32629,     32629,     32629,     32629,
-    32629,     32629,     32629,     32629,     32629,     32629,     32629,     32629,
-    32629,     32629,     32629,     32629,     32629,     32629,     32629,     32629,
-    32629,     32629,     32629,     32629,     32629,     32629,     32629,     32629,
-    32630,     32630,     32630,     32630,     32630,     32630,     32630,     32630,
-    32630,     32630,     32630,     32630,     32630,     32630,     32630,     32630,
-    32630,     32630,     32630,     32630,     32630,     32630,     32630,     32630,
-    32630,     32630,     32630,     32630,     32630,     32630,     32630,     32630,
-    32630,     32630,     32630,     32630,     32630,     32630,     32631,     32631,
-    32631,     32631,     32631,     32631,     32631,     32631,     32631,     32631,
-    32631,     32631,     32631,     32631,     32631,     32631,     32631,     32631,
-    32631,     32631,     32631,     32631,     32631,     32631,     32631,     32631,
-    32631,     32631,     32631,     32631,     32631,     32631,     32631,     32631,
-    32631,     32631,     32631,     32631,     32631,     32632,     32632,     32632,
-    32632,     32632,     32632,     32632,     32632,     32632,     32632,     32632,
-    32632,     32632,     32632,     32632,     32632,     32632,     32632,     32632,
-    32632,     32632,     32632,     32632,     32632,     32632,     32632,     32632,
-    32632,     32632,     32632,     32632,     32632,     32632,     32632,     32632,
-    32632,     32632,     32632,     32632,     32633,     32633,     32633,     32633,
-    32633,     32633,     32633,     32633,     32633,     32633,     32633,     32633,
-    32633,     32633,     32633,     32633,     32633,     32633,     32633,     32633,
-    32633,     32633,     32633,     32633,     32633,     32633,     32633,     32633,
-    32633,     32633,     32633,     32633,     32633,     32633,     32633,     32633,
-    32633,     32633,     32633,     32634,     32634,     32634,     32634,     32634,
-    32634,     32634,     32634,     32634,     32634,     32634,     32634,     32634,
-    32634,     32634,     32634,     32634,     32634,     32634,     32634,     32634,
-    32634,     32634,     32634,     32634,     32634,     32634,     32634,     32634,
-    32634,     32634,     32634,     32634,     32634,     32634,     32634,     32634,
-    32634,     32634,     32635,     32635,     32635,     32635,     32635,     32635,
-    32635,     32635,     32635,     32635,     32635,     32635,     32635,     32635,
-    32635,     32635,     32635,     32635,     32635,     32635,     32635,     32635,
-    32635,     32635,     32635,     32635,     32635,     32635,     32635,     32635,
-    32635,     32635,     32635,     32635,     32635,     32635,     32635,     32635,
-    32635,     32635,     32636,     32636,     32636,     32636,     32636,     32636,
-    32636,     32636,     32636,     32636,     32636,     32636,     32636,     32636,
-    32636,     32636,     32636,     32636,     32636,     32636,     32636,     32636,
-    32636,     32636,     32636,     32636,     32636,     32636,     32636,     32636,
-    32636,     32636,     32636,     32636,     32636,     32636,     32636,     32636,
-    32636,     32636,     32637,     32637,     32637,     32637,     32637,     32637,
-    32637,     32637,     32637,     32637,     32637,     32637,     32637,     32637,
-    32637,     32637,     32637,     32637,     32637,     32637,     32637,     32637,
-    32637,     32637,     32637,     32637,     32637,     32637,     32637,     32637,
-    32637,     32637,     32637,     32637,     32637,     32637,     32637,     32637,
-    32637,     32637,     32637,     32638,     32638,     32638,     32638,     32638,
-    32638,     32638,     32638,     32638,     32638,     32638,     32638,     32638,
-    32638,     32638,     32638,     32638,     32638,     32638,     32638,     32638,
-    32638,     32638,     32638,     32638,     32638,     32638,     32638,     32638,
-    32638,     32638,     32638,     32638,     32638,     32638,     32638,     32638,
-    32638,     32638,     32638,     32639,     32639,     32639,     32639,     32639,
-    32639,     32639,     32639,     32639,     32639,     32639,     32639,     32639,
-    32639,     32639,     32639,     32639,     32639,     32639,     32639,     32639,
-    32639,     32639,     32639,     32639,     32639,     32639,     32639,     32639,
-    32639,     32639,     32639,     32639,     32639,     32639,     32639,     32639,
-    32639,     32639,     32639,     32639,     32640,     32640,     32640,     32640,
-    32640,     32640,     32640,     32640,     32640,     32640,     32640,     32640,
-    32640,     32640,     32640,     32640,     32640,     32640,     32640,     32640,
-    32640,     32640,     32640,     32640,     32640,     32640,     32640,     32640,
-    32640,     32640,     32640,     32640,     32640,     32640,     32640,     32640,
-    32640,     32640,     32640,     32640,     32640,     32640,     32641,     32641,
-    32641,     32641,     32641,     32641,     32641,     32641,     32641,     32641,
-    32641,     32641,     32641,     32641,     32641,     32641,     32641,     32641,
-    32641,     32641,     32641,     32641,     32641,     32641,     32641,     32641,
-    32641,     32641,     32641,     32641,     32641,     32641,     32641,     32641,
-    32641,     32641,     32641,     32641,     32641,     32641,     32641,     32642,
-    32642,     32642,     32642,     32642,     32642,     32642,     32642,     32642,
-    32642,     32642,     32642,     32642,     32642,     32642,     32642,     32642,
-    32642,     32642,     32642,     32642,     32642,     32642,     32642,     32642,
-    32642,     32642,     32642,     32642,     32642,     32642,     32642,     32642,
-    32642,     32642,     32642,     32642,     32642,     32642,     32642,     32642,
-    32642,     32643,     32643,     32643,     32643,     32643,     32643,     32643,
-    32643,     32643,     32643,     32643,     32643,     32643,     32643,     32643,
-    32643,     32643,     32643,     32643,     32643,     32643,     32643,     32643,
-    32643,     32643,     32643,     32643,     32643,     32643,     32643,     32643,
-    32643,     32643,     32643,     32643,     32643,     32643,     32643,     32643,
-    32643,     32643,     32643,     32644,     32644,     32644,     32644,     32644,
-    32644,     32644,     32644,     32644,     32644,     32644,     32644,     32644,
-    32644,     32644,     32644,     32644,     32644,     32644,     32644,     32644,
-    32644,     32644,     32644,     32644,     32644,     32644,     32644,     32644,
-    32644,     32644,     32644,     32644,     32644,     32644,     32644,     32644
+/**
+ * @brief tanh(x * pi) of a positive Q15 value, in Q15
+ * @param table The table from tanh_table::Generate()
+ * @param x Input 0 to Q15_MAX, maps to 0 to pi
+ * @return Interpolated tanh, 0 to 32644
+ */
+inline int32_t TanhLookup(const int16_t *table, const int32_t x)
+{
+    constexpr int32_t kFractionBits = 15 - kTanhTableBits;
+    const int32_t index = x >> kFractionBits;
+    const int32_t fraction = x & ((1 << kFractionBits) - 1);
+    const int32_t a = table[index];
+    const int32_t b = table[index + 1];
+    return a + (((b - a) * fraction + (1 << (kFractionBits - 1))) >> kFractionBits);
+}
 
-};
 }
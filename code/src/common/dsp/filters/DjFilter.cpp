@@ -24,6 +24,7 @@ SOFTWARE.
 
 #include "DjFilter.hpp"
 
+#include <algorithm>
 #include "common/dsp/math/math_utils.hpp"
 
 using namespace kastle2;
@@ -114,7 +115,98 @@ q15_t DjFilter::Process(q15_t input)
     return output;
 }
 
+FASTCODE void DjFilter::ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)
+{
+    // While crossfading, all the signals are needed for every sample
+    if (zone_ != prev_zone_ || crossfade_index_ < kCrossfadeLength)
+    {
+        for (size_t i = 0; i < size * stride; i += stride)
+        {
+            output[i] = Process(input[i]);
+        }
+        return;
+    }
+
+    // Both filters have to run to keep their state, but only one output is used
+    Svf &used = (zone_ == Zone::HIGHPASS) ? highpass_ : lowpass_;
+    Svf &unused = (zone_ == Zone::HIGHPASS) ? lowpass_ : highpass_;
+
+    q15_t dry[kBlockChunkSize];
+    q15_t wet[kBlockChunkSize];
+    for (size_t from = 0; from < size; from += kBlockChunkSize)
+    {
+        const size_t count = std::min(kBlockChunkSize, size - from);
+        const q15_t *in = input + from * stride;
+        q15_t *out = output + from * stride;
+
+        // Copy the input first, so it works in-place as well
+        for (size_t i = 0; i < count; i++)
+        {
+            dry[i] = in[i * stride];
+        }
+
+        unused.ProcessBlock(dry, wet, count);
+        used.ProcessBlock(dry, wet, count);
+
+        if (zone_ == Zone::NONE)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i * stride] = dry[i] / 2; // Lowering the input volume to match the SVF
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i * stride] = wet[i];
+            }
+        }
+    }
+}
+
 void DjFilter::SetCrossfade(q15_t crossfade)
+{
+    UpdateZone(crossfade);
+
+    switch (zone_)
+    {
+    case Zone::LOWPASS:
+        lowpass_.SetFrequency(LowpassFrequency(crossfade));
+        break;
+    case Zone::HIGHPASS:
+        highpass_.SetFrequency(HighpassFrequency(crossfade));
+        break;
+    case Zone::NONE:
+        break;
+    }
+}
+
+void DjFilter::SetParams(const Params &params)
+{
+    UpdateZone(params.crossfade);
+
+    // Only the filter of the zone follows the crossfade, the other one keeps its frequency
+    Svf::Params lowpass = lowpass_.GetParams();
+    Svf::Params highpass = highpass_.GetParams();
+    lowpass.resonance = highpass.resonance = params.resonance;
+    lowpass.force_resonance = highpass.force_resonance = params.force_resonance;
+    switch (zone_)
+    {
+    case Zone::LOWPASS:
+        lowpass.frequency = LowpassFrequency(params.crossfade);
+        break;
+    case Zone::HIGHPASS:
+        highpass.frequency = HighpassFrequency(params.crossfade);
+        break;
+    case Zone::NONE:
+        break;
+    }
+    lowpass_.SetParams(lowpass);
+    highpass_.SetParams(highpass);
+}
+
+void DjFilter::UpdateZone(q15_t crossfade)
 {
     // Keep some thresholds for the center deadzone
     if (crossfade < (-kCenterDeadzone - kCenterDeadzoneThreshold))
@@ -133,26 +225,26 @@ void DjFilter::SetCrossfade(q15_t crossfade)
     {
         zone_ = Zone::HIGHPASS;
     }
+}
 
-    q15_t norm;
+float DjFilter::LowpassFrequency(q15_t crossfade)
+{
+    return curve_map(map(crossfade, Q15_MIN, -kCenterDeadzone, Q15_ZERO, Q15_MAX), kLowpassMap);
+}
 
-    switch (zone_)
-    {
-    case Zone::LOWPASS:
-        norm = map(crossfade, Q15_MIN, -kCenterDeadzone, Q15_ZERO, Q15_MAX);
-        lowpass_.SetFrequency(curve_map(norm, kLowpassMap));
-        break;
-    case Zone::HIGHPASS:
-        norm = map(crossfade, kCenterDeadzone, Q15_MAX, Q15_ZERO, Q15_MAX);
-        highpass_.SetFrequency(curve_map(norm, kHighpassMap));
-        break;
-    case Zone::NONE:
-        break;
-    }
+float DjFilter::HighpassFrequency(q15_t crossfade)
+{
+    return curve_map(map(crossfade, kCenterDeadzone, Q15_MAX, Q15_ZERO, Q15_MAX), kHighpassMap);
 }
 
 void DjFilter::SetResonance(float resonance, Svf::ForceValue force)
 {
     lowpass_.SetResonance(resonance, force);
     highpass_.SetResonance(resonance, force);
-}
\ No newline at end of file
+}
+
+void DjFilter::SetTopology(Svf::Topology topology)
+{
+    lowpass_.SetTopology(topology);
+    highpass_.SetTopology(topology);
+}
@@ -26,6 +26,7 @@ SOFTWARE.
 
 #include <cstddef>
 #include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
 #include "Svf.hpp"
 
 namespace kastle2
@@ -41,6 +42,17 @@ namespace kastle2
 class DjFilter
 {
 public:
+    /**
+     * @brief Crossfade and resonance set together by SetParams()
+     * @details Fits a ParamSnapshot, like Svf::Params.
+     */
+    struct Params
+    {
+        q15_t crossfade = Q15_ZERO;                               ///< -1.0 is lowpass, 0.0 is bandpass, 1.0 is highpass
+        float resonance = 0.0f;                                   ///< 0.0 to 1.0
+        Svf::ForceValue force_resonance = Svf::ForceValue::FALSE; ///< See SetResonance()
+    };
+
     /**
      * @brief Initializes the filter with a given sample rate
      * @param sample_rate The sample rate of the audio
@@ -54,6 +66,15 @@ public:
      */
     q15_t Process(q15_t input);
 
+    /**
+     * @brief Processes a block of samples through the two filters
+     * @param input Input samples
+     * @param output Output samples (can be the same as input)
+     * @param size Number of samples to process
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1);
+
     /**
      * @brief Sets the filter crossfade
      * @param crossfade -1.0 is lowpass, 0.0 is bandpass, 1.0 is highpass
@@ -67,6 +88,18 @@ public:
      */
     void SetResonance(float resonance, Svf::ForceValue force = Svf::ForceValue::FALSE);
 
+    /**
+     * @brief Sets the structure of both filters (see Svf::SetTopology)
+     * @param topology DOUBLE_SAMPLED, ZDF or ZDF_QUADRATIC_DRIVE
+     */
+    void SetTopology(Svf::Topology topology);
+
+    /**
+     * @brief Sets the crossfade and resonance at once, each filter recomputes its coefficients once
+     * @details Nothing is recomputed for the values that didn't change (see Svf::SetParams()), so it can be called every block.
+     */
+    void SetParams(const Params &params);
+
 private:
     // Filters
     Svf lowpass_;
@@ -96,6 +129,9 @@ private:
     };
     static constexpr q15_t kCenterDeadzone = q15(0.2);
     static constexpr q15_t kCenterDeadzoneThreshold = q15(0.05);
+    void UpdateZone(q15_t crossfade);
+    static float LowpassFrequency(q15_t crossfade);
+    static float HighpassFrequency(q15_t crossfade);
     Zone prev_zone_ = Zone::NONE;
     Zone zone_ = Zone::NONE;
 
@@ -103,5 +139,8 @@ private:
     static constexpr int16_t kCrossfadeLength = 1024;
     Zone crossfade_from_ = Zone::NONE;
     int16_t crossfade_index_ = kCrossfadeLength; // Initialize to kCrossfadeLength to indicate no crossfade in progress
+
+    // Block processing works on the stack in chunks of this size
+    static constexpr size_t kBlockChunkSize = 16;
 };
 }
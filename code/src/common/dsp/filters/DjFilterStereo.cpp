@@ -25,6 +25,7 @@ SOFTWARE.
 
 #include "DjFilterStereo.hpp"
 
+#include <algorithm>
 #include "common/dsp/math/math_utils.hpp"
 
 using namespace kastle2;
@@ -45,18 +46,8 @@ void DjFilterStereo::Init(float sample_rate)
     SetCrossfade(Q15_ZERO);
 }
 
-FASTCODE void DjFilterStereo::Process(q15_t input_left, q15_t input_right)
+void DjFilterStereo::UpdateZone()
 {
-    q15_t in_left = input_left / 2; // Lowering the input volume to match the SVF
-    q15_t in_right = input_right / 2;
-    highpass_.Process(input_left, input_right);
-    lowpass_.Process(input_left, input_right);
-
-    q15_t hp_left = highpass_.GetLeft();
-    q15_t hp_right = highpass_.GetRight();
-    q15_t lp_left = lowpass_.GetLeft();
-    q15_t lp_right = lowpass_.GetRight();
-
     if (zone_ != prev_zone_)
     {
         // A zone change has been detected. Start a new crossfade.
@@ -65,6 +56,46 @@ FASTCODE void DjFilterStereo::Process(q15_t input_left, q15_t input_right)
     }
     prev_zone_ = zone_;
 
+    const bool crossfading = crossfade_index_ < kCrossfadeLength;
+    const bool lowpass_needed = zone_ == Zone::LOWPASS || (crossfading && crossfade_from_ == Zone::LOWPASS);
+    const bool highpass_needed = zone_ == Zone::HIGHPASS || (crossfading && crossfade_from_ == Zone::HIGHPASS);
+
+    // An idle filter has an old state, start it from silence
+    if (lowpass_needed && !lowpass_running_)
+    {
+        lowpass_.Reset();
+    }
+    if (highpass_needed && !highpass_running_)
+    {
+        highpass_.Reset();
+    }
+    lowpass_running_ = lowpass_needed;
+    highpass_running_ = highpass_needed;
+}
+
+FASTCODE void DjFilterStereo::Process(q15_t input_left, q15_t input_right)
+{
+    UpdateZone();
+
+    q15_t in_left = input_left / 2; // Lowering the input volume to match the SVF
+    q15_t in_right = input_right / 2;
+    q15_t hp_left = 0;
+    q15_t hp_right = 0;
+    q15_t lp_left = 0;
+    q15_t lp_right = 0;
+    if (highpass_running_)
+    {
+        highpass_.Process(input_left, input_right);
+        hp_left = highpass_.GetLeft();
+        hp_right = highpass_.GetRight();
+    }
+    if (lowpass_running_)
+    {
+        lowpass_.Process(input_left, input_right);
+        lp_left = lowpass_.GetLeft();
+        lp_right = lowpass_.GetRight();
+    }
+
     if (crossfade_index_ < kCrossfadeLength)
     {
         // using int32_t to avoid overflows
@@ -131,6 +162,98 @@ FASTCODE void DjFilterStereo::Process(q15_t input_left, q15_t input_right)
     }
 }
 
+const q15_t *DjFilterStereo::ZoneSignal(Zone zone, const q15_t *lowpass, const q15_t *highpass, const q15_t *dry)
+{
+    switch (zone)
+    {
+    case Zone::LOWPASS:
+        return lowpass;
+    case Zone::HIGHPASS:
+        return highpass;
+    default:
+        return dry;
+    }
+}
+
+FASTCODE void DjFilterStereo::ProcessBlock(const q15_t *input, q15_t *output, size_t frames)
+{
+    if (frames == 0)
+    {
+        return;
+    }
+
+    // Zone, crossfade and the running filters are decided once per block
+    UpdateZone();
+
+    if (!lowpass_running_ && !highpass_running_)
+    {
+        // Center zone, no filter at all
+        for (size_t i = 0; i < 2 * frames; i++)
+        {
+            output[i] = input[i] / 2; // Lowering the input volume to match the SVF
+        }
+    }
+    else
+    {
+        q15_t dry[2 * kBlockChunkFrames];
+        q15_t lowpass[2 * kBlockChunkFrames];
+        q15_t highpass[2 * kBlockChunkFrames];
+        for (size_t from = 0; from < frames; from += kBlockChunkFrames)
+        {
+            const size_t count = std::min(kBlockChunkFrames, frames - from);
+            const q15_t *in = input + 2 * from;
+            q15_t *out = output + 2 * from;
+
+            if (lowpass_running_)
+            {
+                lowpass_.ProcessBlock(in, lowpass, count);
+            }
+            if (highpass_running_)
+            {
+                highpass_.ProcessBlock(in, highpass, count);
+            }
+            // The dry signal is needed only when crossfading from or to the center zone
+            if (zone_ == Zone::NONE || (crossfade_index_ < kCrossfadeLength && crossfade_from_ == Zone::NONE))
+            {
+                for (size_t i = 0; i < 2 * count; i++)
+                {
+                    dry[i] = in[i] / 2; // Lowering the input volume to match the SVF
+                }
+            }
+
+            const q15_t *new_signal = ZoneSignal(zone_, lowpass, highpass, dry);
+            const q15_t *old_signal = ZoneSignal(crossfade_from_, lowpass, highpass, dry);
+            size_t i = 0;
+            if (crossfade_index_ < kCrossfadeLength)
+            {
+                // Same blend factors as fraction_to_q15(crossfade_index_, kCrossfadeLength), by one addition per frame
+                const size_t crossfade_frames = std::min<size_t>(count, kCrossfadeLength - crossfade_index_);
+                int32_t blend_accumulator = crossfade_index_ * 32767 + kCrossfadeLength / 2;
+                for (; i < 2 * crossfade_frames; i += 2)
+                {
+                    const q15_t blend_factor = blend_accumulator / static_cast<int32_t>(kCrossfadeLength);
+                    const q15_t inv_blend_factor = q15_inv(blend_factor);
+                    out[i] = q15_mult_fast(new_signal[i], blend_factor) + q15_mult_fast(old_signal[i], inv_blend_factor);
+                    out[i + 1] = q15_mult_fast(new_signal[i + 1], blend_factor) + q15_mult_fast(old_signal[i + 1], inv_blend_factor);
+                    blend_accumulator += 32767;
+                }
+                crossfade_index_ += crossfade_frames;
+            }
+            for (; i < 2 * count; i++)
+            {
+                out[i] = new_signal[i];
+            }
+        }
+    }
+
+    // Same last frame as Process() leaves
+    output_left_ = output[2 * frames - 2];
+    output_right_ = output[2 * frames - 1];
+
+    // Stops the filter faded out in this block, as Process() would after the last crossfade frame
+    UpdateZone();
+}
+
 q15_t DjFilterStereo::GetLeft()
 {
     return output_left_;
@@ -142,6 +265,47 @@ q15_t DjFilterStereo::GetRight()
 }
 
 void DjFilterStereo::SetCrossfade(q15_t crossfade)
+{
+    UpdateZone(crossfade);
+
+    switch (zone_)
+    {
+    case Zone::LOWPASS:
+        lowpass_.SetFrequency(LowpassFrequency(crossfade));
+        break;
+    case Zone::HIGHPASS:
+        highpass_.SetFrequency(HighpassFrequency(crossfade));
+        break;
+    case Zone::NONE:
+        break;
+    }
+}
+
+void DjFilterStereo::SetParams(const Params &params)
+{
+    UpdateZone(params.crossfade);
+
+    // Only the filter of the zone follows the crossfade, the other one keeps its frequency
+    SvfStereo::Params lowpass = lowpass_.GetParams();
+    SvfStereo::Params highpass = highpass_.GetParams();
+    lowpass.resonance = highpass.resonance = params.resonance;
+    lowpass.force_resonance = highpass.force_resonance = params.force_resonance;
+    switch (zone_)
+    {
+    case Zone::LOWPASS:
+        lowpass.frequency = LowpassFrequency(params.crossfade);
+        break;
+    case Zone::HIGHPASS:
+        highpass.frequency = HighpassFrequency(params.crossfade);
+        break;
+    case Zone::NONE:
+        break;
+    }
+    lowpass_.SetParams(lowpass);
+    highpass_.SetParams(highpass);
+}
+
+void DjFilterStereo::UpdateZone(q15_t crossfade)
 {
     // Keep some thresholds for the center deadzone
     if (crossfade < (-kCenterDeadzone - kCenterDeadzoneThreshold))
@@ -160,26 +324,26 @@ void DjFilterStereo::SetCrossfade(q15_t crossfade)
     {
         zone_ = Zone::HIGHPASS;
     }
+}
 
-    q15_t norm;
+float DjFilterStereo::LowpassFrequency(q15_t crossfade)
+{
+    return curve_map(map(crossfade, Q15_MIN, -kCenterDeadzone, Q15_ZERO, Q15_MAX), kLowpassMap);
+}
 
-    switch (zone_)
-    {
-    case Zone::LOWPASS:
-        norm = map(crossfade, Q15_MIN, -kCenterDeadzone, Q15_ZERO, Q15_MAX);
-        lowpass_.SetFrequency(curve_map(norm, kLowpassMap));
-        break;
-    case Zone::HIGHPASS:
-        norm = map(crossfade, kCenterDeadzone, Q15_MAX, Q15_ZERO, Q15_MAX);
-        highpass_.SetFrequency(curve_map(norm, kHighpassMap));
-        break;
-    case Zone::NONE:
-        break;
-    }
+float DjFilterStereo::HighpassFrequency(q15_t crossfade)
+{
+    return curve_map(map(crossfade, kCenterDeadzone, Q15_MAX, Q15_ZERO, Q15_MAX), kHighpassMap);
 }
 
 void DjFilterStereo::SetResonance(float resonance, SvfStereo::ForceValue force)
 {
     lowpass_.SetResonance(resonance, force);
     highpass_.SetResonance(resonance, force);
-}
\ No newline at end of file
+}
+
+void DjFilterStereo::SetTopology(SvfStereo::Topology topology)
+{
+    lowpass_.SetTopology(topology);
+    highpass_.SetTopology(topology);
+}
@@ -38,12 +38,27 @@ namespace kastle2
  * @ingroup dsp_filters
  * @brief DJ-style filter that crossfades between a lowpass and highpass filter. Uses two Svf filters per channel.
  * @note Slightly faster than two separate DjFilters.
+ *
+ * Only the filters the output needs are running: none in the center zone, one in the low or high zone
+ * and both only while crossfading between them. A filter starts from a clear state when it's needed again,
+ * the crossfade hides it.
  * @author Vaclav Mach (Bastl Instruments), Marek Mach (Bastl Instruments)
  * @date 2024-05-28
  */
 class DjFilterStereo
 {
 public:
+    /**
+     * @brief Crossfade and resonance set together by SetParams()
+     * @details Fits a ParamSnapshot, like SvfStereo::Params.
+     */
+    struct Params
+    {
+        q15_t crossfade = Q15_ZERO;                                           ///< -1.0 is lowpass, 0.0 is bandpass, 1.0 is highpass
+        float resonance = 0.0f;                                               ///< 0.0 to 1.0
+        SvfStereo::ForceValue force_resonance = SvfStereo::ForceValue::FALSE; ///< See SetResonance()
+    };
+
     /**
      * @brief Initializes the filter with a given sample rate
      * @param sample_rate The sample rate of the audio
@@ -57,6 +72,14 @@ public:
      */
     FASTCODE void Process(q15_t input_left, q15_t input_right);
 
+    /**
+     * @brief Processes a block of interleaved stereo frames through the two filters
+     * @param input Interleaved input frames (left, right)
+     * @param output Interleaved output frames (can be the same as input)
+     * @param frames Number of frames to process
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t frames);
+
     /**
      * @brief Returns the left processed signal.
      * @return Processed left channel
@@ -82,6 +105,18 @@ public:
      */
     void SetResonance(float resonance, SvfStereo::ForceValue force = SvfStereo::ForceValue::FALSE);
 
+    /**
+     * @brief Sets the structure of both filters (see SvfStereo::SetTopology)
+     * @param topology DOUBLE_SAMPLED, ZDF or ZDF_QUADRATIC_DRIVE
+     */
+    void SetTopology(SvfStereo::Topology topology);
+
+    /**
+     * @brief Sets the crossfade and resonance at once, each filter recomputes its coefficients once
+     * @details Nothing is recomputed for the values that didn't change (see SvfStereo::SetParams()), so it can be called every block.
+     */
+    void SetParams(const Params &params);
+
 private:
     // Filters
     SvfStereo lowpass_;
@@ -115,6 +150,9 @@ private:
     };
     static constexpr q15_t kCenterDeadzone = q15(0.2);
     static constexpr q15_t kCenterDeadzoneThreshold = q15(0.05);
+    void UpdateZone(q15_t crossfade);
+    static float LowpassFrequency(q15_t crossfade);
+    static float HighpassFrequency(q15_t crossfade);
     Zone prev_zone_ = Zone::NONE;
     Zone zone_ = Zone::NONE;
 
@@ -122,5 +160,22 @@ private:
     static constexpr uint32_t kCrossfadeLength = 2048;
     Zone crossfade_from_ = Zone::NONE;
     uint32_t crossfade_index_ = kCrossfadeLength; // Initialize to kCrossfadeLength to indicate no crossfade in progress
+
+    // Filters needed by the current zone and crossfade
+    bool lowpass_running_ = false;
+    bool highpass_running_ = false;
+
+    /**
+     * @brief Starts a crossfade on a zone change and starts or stops the filters, once per Process() or block
+     */
+    void UpdateZone();
+
+    /**
+     * @brief Interleaved block of the zone signal, chosen once per chunk
+     */
+    static const q15_t *ZoneSignal(Zone zone, const q15_t *lowpass, const q15_t *highpass, const q15_t *dry);
+
+    // Block processing works on the stack in chunks of this many frames
+    static constexpr size_t kBlockChunkFrames = 16;
 };
 }
@@ -24,6 +24,7 @@ SOFTWARE.
 */
 
 #include "Svf.hpp"
+#include <algorithm>
 #include <cmath>
 #include <numbers>
 #include "hardware/sync.h"
@@ -35,6 +36,7 @@ void Svf::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
     max_frequency_ = sample_rate_ / 3.f;
+    qmax_frequency_ = freq_to_q15(max_frequency_, sample_rate_);
 
     // Initialize states
     qinput_ = 0;
@@ -46,6 +48,8 @@ void Svf::Init(float sample_rate)
     qout_low_ = 0;
     qout_high_ = 0;
     qout_band_ = 0;
+    qzdf_s1_ = 0;
+    qzdf_s2_ = 0;
 
     // Set default values
     SetResonance(0.5f);
@@ -53,12 +57,30 @@ void Svf::Init(float sample_rate)
     SetFrequency(500.0f);
 }
 
+template <Svf::Type kType>
 FASTCODE q15_t Svf::Process(q15_t in)
 {
     // Some magic and guesswork so it fits into int_32t
     // Ideally we'd use int64_t for all the calculations but there is just not enough performace
     qinput_ = in >> kDownsample;
 
+    if (topology_ != Topology::DOUBLE_SAMPLED)
+    {
+        if (topology_ == Topology::ZDF)
+        {
+            ZdfPass(qinput_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_, qzdf_s2_, qlow_, qhigh_, qband_, qnotch_);
+        }
+        else
+        {
+            ZdfPass<true>(qinput_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_, qzdf_s2_, qlow_, qhigh_, qband_, qnotch_);
+        }
+        qout_notch_ = qnotch_ << (kDownsample - 1);
+        qout_low_ = qlow_ << (kDownsample - 1);
+        qout_high_ = qhigh_ << (kDownsample - 1);
+        qout_band_ = qband_ << (kDownsample - 1);
+        return SelectOutput<kType>(qinput_, qlow_, qhigh_, qband_, qnotch_);
+    }
+
     // First pass
     qnotch_ = qinput_ - mult(qdamp_, qband_);
     qlow_ = qlow_ + mult(qinternal_frequency_, qband_);
@@ -90,30 +112,168 @@ FASTCODE q15_t Svf::Process(q15_t in)
     qout_high_ = qhigh_ << (kDownsample - 1);
     qout_band_ = qband_ << (kDownsample - 1);
 
+    return SelectOutput<kType>(qinput_, qlow_, qhigh_, qband_, qnotch_);
+}
+
+FASTCODE q15_t Svf::Process(q15_t in)
+{
     switch (type_)
     {
     case Type::LOWPASS:
-        return qout_low_;
+        return Process<Type::LOWPASS>(in);
     case Type::HIGHPASS:
-        return qout_high_;
+        return Process<Type::HIGHPASS>(in);
     case Type::BANDPASS:
-        return qout_band_;
+        return Process<Type::BANDPASS>(in);
     case Type::NOTCH:
-        return qout_notch_;
+        return Process<Type::NOTCH>(in);
     case Type::BYPASS:
-        return qinput_;
+        return Process<Type::BYPASS>(in);
     default:
-        return 0;
+        return Process<Type::COUNT>(in);
     }
 }
 
+template <Svf::Type kType>
+FASTCODE void Svf::ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    // Coefficients and state are loaded once for the whole block
+    int32_t in = 0;
+    int32_t notch = qnotch_;
+    int32_t low = qlow_;
+    int32_t high = qhigh_;
+    int32_t band = qband_;
+
+    if (topology_ == Topology::ZDF)
+    {
+        ProcessZdf<kType, false>(input, output, size, stride, in, notch, low, high, band);
+    }
+    else if (topology_ == Topology::ZDF_QUADRATIC_DRIVE)
+    {
+        ProcessZdf<kType, true>(input, output, size, stride, in, notch, low, high, band);
+    }
+    else
+    {
+        ProcessDoubleSampled<kType>(input, output, size, stride, in, notch, low, high, band);
+    }
+
+    // Store the state back
+    qinput_ = in;
+    qnotch_ = notch;
+    qlow_ = low;
+    qhigh_ = high;
+    qband_ = band;
+    qout_notch_ = notch << (kDownsample - 1);
+    qout_low_ = low << (kDownsample - 1);
+    qout_high_ = high << (kDownsample - 1);
+    qout_band_ = band << (kDownsample - 1);
+}
+
+template <Svf::Type kType, bool kQuadraticDrive>
+FASTCODE void Svf::ProcessZdf(const q15_t *input, q15_t *output, size_t size, size_t stride,
+                              int32_t &in, int32_t &notch, int32_t &low, int32_t &high, int32_t &band)
+{
+    const int32_t f = qinternal_frequency_;
+    const int32_t drive = qdrive_;
+    const int32_t gain = qgain_;
+    const int32_t feedback = qfeedback_;
+    int32_t s1 = qzdf_s1_;
+    int32_t s2 = qzdf_s2_;
+
+    for (size_t i = 0; i < size * stride; i += stride)
+    {
+        in = input[i] >> kDownsample;
+        ZdfPass<kQuadraticDrive>(in, f, gain, feedback, drive, s1, s2, low, high, band, notch);
+        output[i] = SelectOutput<kType>(in, low, high, band, notch);
+    }
+
+    qzdf_s1_ = s1;
+    qzdf_s2_ = s2;
+}
+
+template <Svf::Type kType>
+FASTCODE void Svf::ProcessDoubleSampled(const q15_t *input, q15_t *output, size_t size, size_t stride,
+                                        int32_t &in, int32_t &notch, int32_t &low, int32_t &high, int32_t &band) const
+{
+    const int32_t f = qinternal_frequency_;
+    const int32_t damp = qdamp_;
+    const int32_t drive = qdrive_;
+
+    for (size_t i = 0; i < size * stride; i += stride)
+    {
+        in = input[i] >> kDownsample;
+        DoubleSampledPass(in, f, damp, drive, low, high, band, notch);
+        DoubleSampledPass(in, f, damp, drive, low, high, band, notch);
+
+        // The output is picked at compile time, no branch per sample
+        output[i] = SelectOutput<kType>(in, low, high, band, notch);
+    }
+}
+
+FASTCODE void Svf::ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)
+{
+    // One branch per block
+    switch (type_)
+    {
+    case Type::LOWPASS:
+        ProcessBlock<Type::LOWPASS>(input, output, size, stride);
+        break;
+    case Type::HIGHPASS:
+        ProcessBlock<Type::HIGHPASS>(input, output, size, stride);
+        break;
+    case Type::BANDPASS:
+        ProcessBlock<Type::BANDPASS>(input, output, size, stride);
+        break;
+    case Type::NOTCH:
+        ProcessBlock<Type::NOTCH>(input, output, size, stride);
+        break;
+    case Type::BYPASS:
+        ProcessBlock<Type::BYPASS>(input, output, size, stride);
+        break;
+    default:
+        ProcessBlock<Type::COUNT>(input, output, size, stride);
+        break;
+    }
+}
+
+// The fixed type variants, for FixedSvf and direct calls
+template q15_t Svf::Process<Svf::Type::LOWPASS>(q15_t);
+template q15_t Svf::Process<Svf::Type::HIGHPASS>(q15_t);
+template q15_t Svf::Process<Svf::Type::BANDPASS>(q15_t);
+template q15_t Svf::Process<Svf::Type::NOTCH>(q15_t);
+template q15_t Svf::Process<Svf::Type::BYPASS>(q15_t);
+template void Svf::ProcessBlock<Svf::Type::LOWPASS>(const q15_t *, q15_t *, size_t, size_t);
+template void Svf::ProcessBlock<Svf::Type::HIGHPASS>(const q15_t *, q15_t *, size_t, size_t);
+template void Svf::ProcessBlock<Svf::Type::BANDPASS>(const q15_t *, q15_t *, size_t, size_t);
+template void Svf::ProcessBlock<Svf::Type::NOTCH>(const q15_t *, q15_t *, size_t, size_t);
+template void Svf::ProcessBlock<Svf::Type::BYPASS>(const q15_t *, q15_t *, size_t, size_t);
+
 void Svf::SetFrequency(float frequency)
 {
     frequency = constrain(frequency, 1.0e-6, max_frequency_);
 
+    frequency_ = frequency;
+    frequency_fixed_point_ = false;
+
     // Set Internal Frequency for "frequency"
-    internal_frequency_ = 2.0f * sinf(std::numbers::pi * std::min(0.25f, frequency / (sample_rate_ * 2.0f))); // fs*2 because double sampled
-    tmp_qinternal_frequency_ = internal_frequency_ * 32768.0f;
+    tmp_qinternal_frequency_ = CalcFrequencyCoefficient(topology_, frequency, sample_rate_);
+
+    RecalculateDamp();
+    FinishValueSetting();
+}
+
+void Svf::SetFrequencyQ(q15_t frequency)
+{
+    qfrequency_ = std::clamp<q15_t>(frequency, 1, qmax_frequency_);
+    frequency_fixed_point_ = true;
+
+    // Same as SetFrequency, the sine (tangent) comes from the lookup table
+    tmp_qinternal_frequency_ = CalcFrequencyCoefficientQ(topology_, qfrequency_);
 
     RecalculateDamp();
     FinishValueSetting();
@@ -129,6 +289,7 @@ void Svf::SetResonance(float resonance, ForceValue force)
     {
         resonance_ = constrain(resonance, 0.005f, 1.f);
     }
+    tmp_qresonance_damp_ = 2.0f * (1.0f - std::pow(resonance_, 0.25f)) * 32768.0f;
     RecalculateDamp();
     RecalculateDrive();
     FinishValueSetting();
@@ -141,16 +302,123 @@ void Svf::SetDrive(float drive)
     FinishValueSetting();
 }
 
+void Svf::SetParams(const Params &params)
+{
+    const float frequency = constrain(params.frequency, 1.0e-6, max_frequency_);
+    const float resonance = constrain(params.resonance, params.force_resonance == ForceValue::TRUE ? 0.0f : 0.005f, 1.f);
+    const float drive = constrain(params.drive, 0.f, 1.f);
+
+    const bool frequency_changed = frequency_fixed_point_ || frequency != frequency_;
+    const bool resonance_changed = resonance != resonance_;
+    if (!frequency_changed && !resonance_changed && drive == pre_drive_)
+    {
+        return;
+    }
+
+    if (frequency_changed)
+    {
+        frequency_ = frequency;
+        frequency_fixed_point_ = false;
+        tmp_qinternal_frequency_ = CalcFrequencyCoefficient(topology_, frequency, sample_rate_);
+    }
+    if (resonance_changed)
+    {
+        resonance_ = resonance;
+        tmp_qresonance_damp_ = 2.0f * (1.0f - std::pow(resonance_, 0.25f)) * 32768.0f;
+    }
+    if (frequency_changed || resonance_changed)
+    {
+        RecalculateDamp();
+    }
+    pre_drive_ = drive;
+    RecalculateDrive();
+    FinishValueSetting();
+}
+
 void Svf::RecalculateDrive()
 {
     float drive = pre_drive_ * resonance_;
     tmp_qdrive_ = drive * 32768.0f;
 }
 
+void Svf::SetTopology(Topology topology)
+{
+    topology_ = topology;
+    qnotch_ = 0;
+    qlow_ = 0;
+    qhigh_ = 0;
+    qband_ = 0;
+    qzdf_s1_ = 0;
+    qzdf_s2_ = 0;
+    if (frequency_fixed_point_)
+    {
+        SetFrequencyQ(qfrequency_);
+    }
+    else
+    {
+        SetFrequency(frequency_);
+    }
+}
+
+int32_t Svf::CalcFrequencyCoefficient(Topology topology, float frequency, float sample_rate)
+{
+    if (topology != Topology::DOUBLE_SAMPLED)
+    {
+        return tanf(std::numbers::pi * frequency / sample_rate) * 32768.0f;
+    }
+    const float internal_frequency = 2.0f * sinf(std::numbers::pi * std::min(0.25f, frequency / (sample_rate * 2.0f))); // fs*2 because double sampled
+    return internal_frequency * 32768.0f;
+}
+
+int32_t Svf::CalcFrequencyCoefficientQ(Topology topology, q15_t frequency)
+{
+    return topology != Topology::DOUBLE_SAMPLED ? q15_svf_zdf_coefficient(frequency) : q15_svf_coefficient(frequency);
+}
+
+void Svf::CalcDamping(Topology topology, int32_t frequency, int32_t resonance_damp, int32_t &damp, int32_t &gain, int32_t &feedback)
+{
+    if (topology != Topology::DOUBLE_SAMPLED)
+    {
+        // Stable for any damping, no limit
+        damp = resonance_damp;
+        CalcZdfGains(frequency, damp, gain, feedback);
+        return;
+    }
+
+    // min(2 * (1 - resonance^0.25), min(2, 2 / f - f / 2)) in Q15, the resonance part is cached by SetResonance
+    // 2 / f in Q15 is 2^31 / f, the hardware divider makes it cheap
+    int32_t limit = 2 << 15;
+    if (frequency > 0)
+    {
+        limit = std::min<int32_t>(limit, static_cast<int32_t>((1u << 31) / static_cast<uint32_t>(frequency)) - frequency / 2);
+    }
+    damp = std::min(resonance_damp, limit);
+    gain = 0;
+    feedback = 0;
+}
+
+void Svf::CalcZdfGains(int32_t frequency, int32_t damp, int32_t &gain, int32_t &feedback)
+{
+    // gain = 1 / (1 + g * (g + k)), feedback = (g + k) * gain, in Q15, the products need 64 bits
+    const int64_t g_plus_k = static_cast<int64_t>(frequency) + damp;
+    const int64_t denominator = (int64_t{1} << 15) + ((frequency * g_plus_k) >> 15);
+    gain = static_cast<int32_t>((int64_t{1} << 30) / denominator);
+    feedback = static_cast<int32_t>((g_plus_k << 15) / denominator);
+}
+
 void Svf::RecalculateDamp()
 {
-    float damp = std::min(2.0f * (1.0f - std::pow(resonance_, 0.25f)), std::min(2.0f, 2.0f / internal_frequency_ - internal_frequency_ * 0.5f));
-    tmp_qdamp_ = damp * 32768.0f;
+    CalcDamping(topology_, tmp_qinternal_frequency_, tmp_qresonance_damp_, tmp_qdamp_, tmp_qgain_, tmp_qfeedback_);
+}
+
+void Svf::SetCoefficients(const Coefficients &coefficients)
+{
+    tmp_qdrive_ = coefficients.drive;
+    tmp_qdamp_ = coefficients.damp;
+    tmp_qinternal_frequency_ = coefficients.frequency;
+    tmp_qgain_ = coefficients.gain;
+    tmp_qfeedback_ = coefficients.feedback;
+    FinishValueSetting();
 }
 
 void Svf::FinishValueSetting()
@@ -160,6 +428,8 @@ void Svf::FinishValueSetting()
     qdrive_ = tmp_qdrive_;
     qdamp_ = tmp_qdamp_;
     qinternal_frequency_ = tmp_qinternal_frequency_;
+    qgain_ = tmp_qgain_;
+    qfeedback_ = tmp_qfeedback_;
 
     restore_interrupts(interrupts);
 }
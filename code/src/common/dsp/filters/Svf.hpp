@@ -52,6 +52,12 @@ namespace kastle2
  * Ported by: Stephen Hensley to Daisy
  * 
  * Ported to fixed point by: Vaclav Mach (Bastl Instruments)
+ *
+ * Topology::ZDF swaps the two passes for one pass of the zero-delay-feedback (trapezoidal) SVF by Andrew Simper
+ * and Vadim Zavalishin, which is stable up to the max frequency by itself and costs about half.
+ * It has the same gain, outputs and drive, and no damping limit.
+ * Topology::ZDF_QUADRATIC_DRIVE saves one more multiplication with a band * |band| drive, which tames
+ * the resonance at lower levels too.
  */
 
 class Svf
@@ -73,6 +79,41 @@ public:
         TRUE
     };
 
+    /**
+     * @brief Structure of the filter, selectable per instance
+     */
+    enum class Topology
+    {
+        DOUBLE_SAMPLED,     ///< Two Chamberlin passes per sample (default)
+        ZDF,                ///< One zero-delay-feedback pass per sample
+        ZDF_QUADRATIC_DRIVE ///< ZDF with the cheaper quadratic drive
+    };
+
+    /**
+     * @brief Fixed point coefficients, computed by the setters
+     * @details For computing them ahead (eg. in the UI loop, or stored in a preset) and setting them without any math.
+     */
+    struct Coefficients
+    {
+        int32_t drive = 0;
+        int32_t damp = 0;
+        int32_t frequency = 0;
+        int32_t gain = 0;     // ZDF only: 1 / (1 + g * (g + damp))
+        int32_t feedback = 0; // ZDF only: (g + damp) / (1 + g * (g + damp))
+    };
+
+    /**
+     * @brief Frequency, resonance and drive set together by SetParams()
+     * @details Trivially copyable, so it fits a ParamSnapshot handed from the UI to the audio callback.
+     */
+    struct Params
+    {
+        float frequency = 500.0f;                       ///< Cutoff frequency in Hz, up to sample_rate / 3
+        float resonance = 0.5f;                         ///< 0.0 to 1.0
+        float drive = 0.5f;                             ///< 0.0 to 1.0
+        ForceValue force_resonance = ForceValue::FALSE; ///< See SetResonance()
+    };
+
     /**
      * @brief Initializes a new State Variable Filter instance
      * @param sample_rate - The sample rate of the audio
@@ -86,12 +127,47 @@ public:
      */
     FASTCODE q15_t Process(q15_t input);
 
+    /**
+     * @brief Processes a block of samples, keeping the filter state in registers for the whole block.
+     * @param input - Input samples
+     * @param output - Output samples (can be the same as input)
+     * @param size - Number of samples to process
+     * @param stride - Distance between the samples, use 2 for one channel of interleaved stereo
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1);
+
+    /**
+     * @brief Process() with the output picked at compile time, the type set by SetType() is not used.
+     * @tparam kType The returned output
+     * @param input - The input signal to process
+     * @return The output signal of the kType
+     */
+    template <Type kType>
+    FASTCODE q15_t Process(q15_t input);
+
+    /**
+     * @brief ProcessBlock() with the output picked at compile time, without the branch per sample.
+     * @tparam kType The output written
+     * @param input - Input samples
+     * @param output - Output samples (can be the same as input)
+     * @param size - Number of samples to process
+     * @param stride - Distance between the samples, use 2 for one channel of interleaved stereo
+     */
+    template <Type kType>
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1);
+
     /**
      * @brief Sets the frequency of the cutoff frequency.
      * @param frequency Must be between 0.0 and sample_rate / 3
      */
     void SetFrequency(float frequency);
 
+    /**
+     * @brief Sets the cutoff frequency in fixed point, without any float math (fast enough for audio-rate modulation).
+     * @param frequency Relative frequency to the sample rate (see freq_to_q15), clamped to sample_rate / 3
+     */
+    void SetFrequencyQ(q15_t frequency);
+
     /**
      * @brief Sets the resonance of the filter.
      * @param resonance Must be between 0.0 and 1.0 to ensure stability.
@@ -118,29 +194,143 @@ public:
      */
     void SetDrive(float drive);
 
+    /**
+     * @brief Sets the frequency, resonance and drive at once, like SetFrequency(), SetResonance() and SetDrive()
+     * @details Only the coefficients of the changed values are recomputed, the damping once for both
+     * and nothing at all when none of them changed, so it can be called every block.
+     */
+    void SetParams(const Params &params);
+
+    /**
+     * @brief Returns the frequency, resonance and drive of the last float setters, for changing some of them with SetParams()
+     */
+    Params GetParams() const
+    {
+        return {frequency_, resonance_, pre_drive_, resonance_ < 0.005f ? ForceValue::TRUE : ForceValue::FALSE};
+    }
+
+    /**
+     * @brief Sets the structure of the filter, recomputes the coefficients and clears the state.
+     * @param topology DOUBLE_SAMPLED, ZDF or ZDF_QUADRATIC_DRIVE
+     */
+    void SetTopology(Topology topology);
+
+    /**
+     * @brief Returns the structure of the filter
+     */
+    Topology GetTopology() const
+    {
+        return topology_;
+    }
+
+    /**
+     * @brief Returns the coefficients of the current frequency, resonance and drive
+     */
+    Coefficients GetCoefficients() const
+    {
+        return {qdrive_, qdamp_, qinternal_frequency_, qgain_, qfeedback_};
+    }
+
+    /**
+     * @brief Sets the coefficients from GetCoefficients() of a filter with the same sample rate and topology, without any math
+     * @note The setters still start from their own last frequency and resonance.
+     */
+    void SetCoefficients(const Coefficients &coefficients);
+
     q15_t GetLowPassOutput() const;
     q15_t GetHighPassOutput() const;
     q15_t GetBandPassOutput() const;
     q15_t GetNotchOutput() const;
 
+    /**
+     * @brief Frequency coefficient of the topology, shared with SvfStereo
+     * @param frequency Cutoff in Hz, between 0 and sample_rate / 3
+     */
+    static int32_t CalcFrequencyCoefficient(Topology topology, float frequency, float sample_rate);
+
+    /**
+     * @brief Frequency coefficient of the topology from the lookup tables, shared with SvfStereo
+     * @param frequency Relative frequency to the sample rate (see freq_to_q15), up to sample_rate / 3
+     */
+    static int32_t CalcFrequencyCoefficientQ(Topology topology, q15_t frequency);
+
+    /**
+     * @brief Damping of the frequency coefficient and resonance, with the ZDF gains (Q15), shared with SvfStereo
+     * @details The double sampled damping is limited for stability, its gains are zero.
+     */
+    static void CalcDamping(Topology topology, int32_t frequency, int32_t resonance_damp, int32_t &damp, int32_t &gain, int32_t &feedback);
+
+    /**
+     * @brief One of the two passes of the double sampled filter, all signals in q15_t range
+     */
+    static inline void DoubleSampledPass(int32_t in, int32_t frequency, int32_t damp, int32_t drive,
+                                         int32_t &low, int32_t &high, int32_t &band, int32_t &notch)
+    {
+        notch = in - mult(damp, band);
+        low = low + mult(frequency, band);
+        high = notch - low;
+        band = mult(frequency, high) + band - mult(drive, mult(band, mult(band, band)));
+
+        notch = q15_saturate(notch);
+        low = q15_saturate(low);
+        high = q15_saturate(high);
+        band = q15_saturate(band);
+    }
+
+    /**
+     * @brief One zero-delay-feedback pass, the state is s1 and s2, all signals in q15_t range
+     * @details The input is scaled down by kDownsample as in the double sampled passes, which keeps the gains equal.
+     * @tparam kQuadraticDrive band * |band| drive instead of the cubic one
+     */
+    template <bool kQuadraticDrive = false>
+    static inline void ZdfPass(int32_t in, int32_t frequency, int32_t gain, int32_t feedback, int32_t drive,
+                               int32_t &s1, int32_t &s2, int32_t &low, int32_t &high, int32_t &band, int32_t &notch)
+    {
+        high = q15_saturate(mult(gain, in - s2) - mult(feedback, s1));
+        band = q15_saturate(mult(frequency, high) + s1);
+        if constexpr (kQuadraticDrive)
+        {
+            band = q15_saturate(band - mult(drive, mult(band, q15_abs(band))));
+        }
+        else
+        {
+            band = q15_saturate(band - mult(drive, mult(band, mult(band, band))));
+        }
+        s1 = q15_saturate(2 * band - s1);
+        low = q15_saturate(mult(frequency, band) + s2);
+        s2 = q15_saturate(2 * low - s2);
+        notch = q15_saturate(high + low);
+    }
+
 private:
     float sample_rate_ = 0.0f;
     float resonance_ = 0.0f;
     float pre_drive_ = 0.0f;
     float max_frequency_ = 0.0f;
-    float internal_frequency_ = 0.0f;
+    q15_t qmax_frequency_ = 0;
 
     Type type_ = Type::LOWPASS;
+    Topology topology_ = Topology::DOUBLE_SAMPLED;
+
+    // The last frequency setter, reapplied by SetTopology()
+    float frequency_ = 500.0f;
+    q15_t qfrequency_ = 0;
+    bool frequency_fixed_point_ = false;
 
     // Using these for calculations
     int32_t tmp_qdrive_ = 0;
     int32_t tmp_qdamp_ = 0;
     int32_t tmp_qinternal_frequency_ = 0;
+    int32_t tmp_qresonance_damp_ = 0;
+    int32_t tmp_qgain_ = 0;
+    int32_t tmp_qfeedback_ = 0;
 
     // These are set at once in FinishValueSetting to prevent glitches
     int32_t qdrive_ = 0;
     int32_t qdamp_ = 0;
     int32_t qinternal_frequency_ = 0;
+    int32_t qgain_ = 0;
+    int32_t qfeedback_ = 0;
 
     int32_t qnotch_ = 0;
     int32_t qlow_ = 0;
@@ -148,6 +338,10 @@ private:
     int32_t qband_ = 0;
     int32_t qinput_ = 0;
 
+    // ZDF state (the trapezoidal integrators)
+    int32_t qzdf_s1_ = 0;
+    int32_t qzdf_s2_ = 0;
+
     q15_t qout_low_ = 0;
     q15_t qout_high_ = 0;
     q15_t qout_band_ = 0;
@@ -160,6 +354,45 @@ private:
     void RecalculateDrive();
     void FinishValueSetting();
 
+    static void CalcZdfGains(int32_t frequency, int32_t damp, int32_t &gain, int32_t &feedback);
+
+    template <Type kType, bool kQuadraticDrive>
+    FASTCODE void ProcessZdf(const q15_t *input, q15_t *output, size_t size, size_t stride,
+                             int32_t &in, int32_t &notch, int32_t &low, int32_t &high, int32_t &band);
+
+    template <Type kType>
+    FASTCODE void ProcessDoubleSampled(const q15_t *input, q15_t *output, size_t size, size_t stride,
+                                       int32_t &in, int32_t &notch, int32_t &low, int32_t &high, int32_t &band) const;
+
+    template <Type kType>
+    static inline q15_t SelectOutput(int32_t in, int32_t low, int32_t high, int32_t band, int32_t notch)
+    {
+        if constexpr (kType == Type::LOWPASS)
+        {
+            return low << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::HIGHPASS)
+        {
+            return high << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::BANDPASS)
+        {
+            return band << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::NOTCH)
+        {
+            return notch << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::BYPASS)
+        {
+            return in;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
     static int32_t mult(int32_t a, int32_t b)
     {
         int32_t val = (a * b) >> 15;
@@ -174,4 +407,45 @@ private:
         return val;
     }
 };
+
+/**
+ * @class FixedSvf
+ * @ingroup dsp_filters
+ * @brief Svf with the type fixed at compile time, for filters which never change their type.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Process() and ProcessBlock() return the kType output without the runtime switch, and it fits as a stage of Chain.
+ */
+template <Svf::Type kType>
+class FixedSvf : public Svf
+{
+public:
+    /**
+     * @brief Initializes the filter (see Svf::Init()), with its type set to kType
+     * @param sample_rate - The sample rate of the audio
+     */
+    void Init(float sample_rate)
+    {
+        Svf::Init(sample_rate);
+        SetType(kType);
+    }
+
+    /**
+     * @brief Processes the input signal, returns the kType output
+     * @param input - The input signal to process
+     */
+    inline q15_t Process(q15_t input)
+    {
+        return Svf::Process<kType>(input);
+    }
+
+    /**
+     * @brief Processes a block of samples to the kType output (see Svf::ProcessBlock())
+     */
+    inline void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1)
+    {
+        Svf::ProcessBlock<kType>(input, output, size, stride);
+    }
+};
 }
@@ -25,10 +25,10 @@ SOFTWARE.
 */
 
 #include "SvfStereo.hpp"
+#include <algorithm>
 #include <cmath>
 #include "hardware/sync.h"
 #include "common/dsp/math/math_utils.hpp"
-#include <numbers>
 
 using namespace kastle2;
 
@@ -36,13 +36,11 @@ void SvfStereo::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
     max_frequency_ = sample_rate_ / 3.f;
+    qmax_frequency_ = freq_to_q15(max_frequency_, sample_rate_);
 
     // Initialize states
+    Reset();
     qinput_left_ = 0;
-    qnotch_left_ = 0;
-    qlow_left_ = 0;
-    qhigh_left_ = 0;
-    qband_left_ = 0;
     qout_raw_left_ = 0;
     qout_notch_left_ = 0;
     qout_low_left_ = 0;
@@ -50,10 +48,6 @@ void SvfStereo::Init(float sample_rate)
     qout_band_left_ = 0;
 
     qinput_right_ = 0;
-    qnotch_right_ = 0;
-    qlow_right_ = 0;
-    qhigh_right_ = 0;
-    qband_right_ = 0;
     qout_raw_right_ = 0;
     qout_notch_right_ = 0;
     qout_low_right_ = 0;
@@ -75,52 +69,34 @@ FASTCODE void SvfStereo::Process(q15_t input_left, q15_t input_right)
     qinput_left_ = input_left >> kDownsample;
     qinput_right_ = input_right >> kDownsample;
 
-    // First pass - left
-    qnotch_left_ = qinput_left_ - mult(qdamp_, qband_left_);
-    qlow_left_ = qlow_left_ + mult(qinternal_frequency_, qband_left_);
-    qhigh_left_ = qnotch_left_ - qlow_left_;
-    qband_left_ = mult(qinternal_frequency_, qhigh_left_) + qband_left_ - mult(qdrive_, mult(qband_left_, mult(qband_left_, qband_left_)));
-
-    qnotch_left_ = q15_saturate(qnotch_left_);
-    qlow_left_ = q15_saturate(qlow_left_);
-    qhigh_left_ = q15_saturate(qhigh_left_);
-    qband_left_ = q15_saturate(qband_left_);
-
-    // First pass - right
-    qnotch_right_ = qinput_right_ - mult(qdamp_, qband_right_);
-    qlow_right_ = qlow_right_ + mult(qinternal_frequency_, qband_right_);
-    qhigh_right_ = qnotch_right_ - qlow_right_;
-    qband_right_ = mult(qinternal_frequency_, qhigh_right_) + qband_right_ - mult(qdrive_, mult(qband_right_, mult(qband_right_, qband_right_)));
-
-    qnotch_right_ = q15_saturate(qnotch_right_);
-    qlow_right_ = q15_saturate(qlow_right_);
-    qhigh_right_ = q15_saturate(qhigh_right_);
-    qband_right_ = q15_saturate(qband_right_);
-
-    // Second pass - left
-    qnotch_left_ = qinput_left_ - mult(qdamp_, qband_left_);
-    qlow_left_ = qlow_left_ + mult(qinternal_frequency_, qband_left_);
-    qhigh_left_ = qnotch_left_ - qlow_left_;
-    qband_left_ = mult(qinternal_frequency_, qhigh_left_) + qband_left_ - mult(qdrive_, mult(qband_left_, mult(qband_left_, qband_left_)));
-
-    qnotch_left_ = q15_saturate(qnotch_left_);
-    qlow_left_ = q15_saturate(qlow_left_);
-    qhigh_left_ = q15_saturate(qhigh_left_);
-    qband_left_ = q15_saturate(qband_left_);
-
-    // Second pass - right
-    qnotch_right_ = qinput_right_ - mult(qdamp_, qband_right_);
-    qlow_right_ = qlow_right_ + mult(qinternal_frequency_, qband_right_);
-    qhigh_right_ = qnotch_right_ - qlow_right_;
-    qband_right_ = mult(qinternal_frequency_, qhigh_right_) + qband_right_ - mult(qdrive_, mult(qband_right_, mult(qband_right_, qband_right_)));
-
-    qnotch_right_ = q15_saturate(qnotch_right_);
-    qlow_right_ = q15_saturate(qlow_right_);
-    qhigh_right_ = q15_saturate(qhigh_right_);
-    qband_right_ = q15_saturate(qband_right_);
-
-    // Getting the results
+    switch (topology_)
+    {
+    case Topology::ZDF:
+        Svf::ZdfPass(qinput_left_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_left_, qzdf_s2_left_,
+                     qlow_left_, qhigh_left_, qband_left_, qnotch_left_);
+        Svf::ZdfPass(qinput_right_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_right_, qzdf_s2_right_,
+                     qlow_right_, qhigh_right_, qband_right_, qnotch_right_);
+        break;
+    case Topology::ZDF_QUADRATIC_DRIVE:
+        Svf::ZdfPass<true>(qinput_left_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_left_, qzdf_s2_left_,
+                           qlow_left_, qhigh_left_, qband_left_, qnotch_left_);
+        Svf::ZdfPass<true>(qinput_right_, qinternal_frequency_, qgain_, qfeedback_, qdrive_, qzdf_s1_right_, qzdf_s2_right_,
+                           qlow_right_, qhigh_right_, qband_right_, qnotch_right_);
+        break;
+    default:
+        // Two passes per channel
+        Svf::DoubleSampledPass(qinput_left_, qinternal_frequency_, qdamp_, qdrive_, qlow_left_, qhigh_left_, qband_left_, qnotch_left_);
+        Svf::DoubleSampledPass(qinput_right_, qinternal_frequency_, qdamp_, qdrive_, qlow_right_, qhigh_right_, qband_right_, qnotch_right_);
+        Svf::DoubleSampledPass(qinput_left_, qinternal_frequency_, qdamp_, qdrive_, qlow_left_, qhigh_left_, qband_left_, qnotch_left_);
+        Svf::DoubleSampledPass(qinput_right_, qinternal_frequency_, qdamp_, qdrive_, qlow_right_, qhigh_right_, qband_right_, qnotch_right_);
+        break;
+    }
 
+    UpdateOutputs();
+}
+
+FASTCODE void SvfStereo::UpdateOutputs()
+{
     // Dividing by two and upscaling with kDownsample for output
     // It's done with (x << (kDownsample - 1)) instead of ((x / 2) << kDownsample)
     qout_notch_left_ = qnotch_left_ << (kDownsample - 1);
@@ -134,6 +110,115 @@ FASTCODE void SvfStereo::Process(q15_t input_left, q15_t input_right)
     qout_band_right_ = qband_right_ << (kDownsample - 1);
 }
 
+template <SvfStereo::Type kType, Svf::Topology kTopology>
+FASTCODE void SvfStereo::ProcessFrames(const q15_t *input, q15_t *output, size_t frames)
+{
+    // The coefficients are shared by both channels, both states stay in locals for the whole block
+    const int32_t f = qinternal_frequency_;
+    const int32_t damp = qdamp_;
+    const int32_t drive = qdrive_;
+    const int32_t gain = qgain_;
+    const int32_t feedback = qfeedback_;
+
+    int32_t notch_left = qnotch_left_, low_left = qlow_left_, high_left = qhigh_left_, band_left = qband_left_;
+    int32_t notch_right = qnotch_right_, low_right = qlow_right_, high_right = qhigh_right_, band_right = qband_right_;
+    int32_t s1_left = qzdf_s1_left_, s2_left = qzdf_s2_left_;
+    int32_t s1_right = qzdf_s1_right_, s2_right = qzdf_s2_right_;
+    q15_t raw_left = qout_raw_left_;
+    q15_t raw_right = qout_raw_right_;
+
+    for (size_t i = 0; i < 2 * frames; i += 2)
+    {
+        raw_left = input[i];
+        raw_right = input[i + 1];
+        const int32_t in_left = raw_left >> kDownsample;
+        const int32_t in_right = raw_right >> kDownsample;
+
+        if constexpr (kTopology == Topology::DOUBLE_SAMPLED)
+        {
+            Svf::DoubleSampledPass(in_left, f, damp, drive, low_left, high_left, band_left, notch_left);
+            Svf::DoubleSampledPass(in_right, f, damp, drive, low_right, high_right, band_right, notch_right);
+            Svf::DoubleSampledPass(in_left, f, damp, drive, low_left, high_left, band_left, notch_left);
+            Svf::DoubleSampledPass(in_right, f, damp, drive, low_right, high_right, band_right, notch_right);
+        }
+        else
+        {
+            constexpr bool kQuadraticDrive = kTopology == Topology::ZDF_QUADRATIC_DRIVE;
+            Svf::ZdfPass<kQuadraticDrive>(in_left, f, gain, feedback, drive, s1_left, s2_left, low_left, high_left, band_left, notch_left);
+            Svf::ZdfPass<kQuadraticDrive>(in_right, f, gain, feedback, drive, s1_right, s2_right, low_right, high_right, band_right, notch_right);
+        }
+
+        output[i] = SelectOutput<kType>(raw_left, low_left, high_left, band_left, notch_left);
+        output[i + 1] = SelectOutput<kType>(raw_right, low_right, high_right, band_right, notch_right);
+    }
+
+    // Store the state back
+    qnotch_left_ = notch_left;
+    qlow_left_ = low_left;
+    qhigh_left_ = high_left;
+    qband_left_ = band_left;
+    qnotch_right_ = notch_right;
+    qlow_right_ = low_right;
+    qhigh_right_ = high_right;
+    qband_right_ = band_right;
+    qzdf_s1_left_ = s1_left;
+    qzdf_s2_left_ = s2_left;
+    qzdf_s1_right_ = s1_right;
+    qzdf_s2_right_ = s2_right;
+    qout_raw_left_ = raw_left;
+    qout_raw_right_ = raw_right;
+    qinput_left_ = raw_left >> kDownsample;
+    qinput_right_ = raw_right >> kDownsample;
+    UpdateOutputs();
+}
+
+template <SvfStereo::Type kType>
+FASTCODE void SvfStereo::ProcessBlock(const q15_t *input, q15_t *output, size_t frames)
+{
+    switch (topology_)
+    {
+    case Topology::ZDF:
+        ProcessFrames<kType, Topology::ZDF>(input, output, frames);
+        break;
+    case Topology::ZDF_QUADRATIC_DRIVE:
+        ProcessFrames<kType, Topology::ZDF_QUADRATIC_DRIVE>(input, output, frames);
+        break;
+    default:
+        ProcessFrames<kType, Topology::DOUBLE_SAMPLED>(input, output, frames);
+        break;
+    }
+}
+
+FASTCODE void SvfStereo::ProcessBlock(const q15_t *input, q15_t *output, size_t frames)
+{
+    // One branch per block
+    switch (type_)
+    {
+    case Type::LOWPASS:
+        ProcessBlock<Type::LOWPASS>(input, output, frames);
+        break;
+    case Type::HIGHPASS:
+        ProcessBlock<Type::HIGHPASS>(input, output, frames);
+        break;
+    case Type::BANDPASS:
+        ProcessBlock<Type::BANDPASS>(input, output, frames);
+        break;
+    case Type::NOTCH:
+        ProcessBlock<Type::NOTCH>(input, output, frames);
+        break;
+    case Type::BYPASS:
+        ProcessBlock<Type::BYPASS>(input, output, frames);
+        break;
+    }
+}
+
+// The fixed type variants, for direct calls
+template void SvfStereo::ProcessBlock<SvfStereo::Type::LOWPASS>(const q15_t *, q15_t *, size_t);
+template void SvfStereo::ProcessBlock<SvfStereo::Type::HIGHPASS>(const q15_t *, q15_t *, size_t);
+template void SvfStereo::ProcessBlock<SvfStereo::Type::BANDPASS>(const q15_t *, q15_t *, size_t);
+template void SvfStereo::ProcessBlock<SvfStereo::Type::NOTCH>(const q15_t *, q15_t *, size_t);
+template void SvfStereo::ProcessBlock<SvfStereo::Type::BYPASS>(const q15_t *, q15_t *, size_t);
+
 q15_t SvfStereo::GetLeft() const
 {
     switch (type_)
@@ -176,9 +261,23 @@ void SvfStereo::SetFrequency(float frequency)
 {
     frequency = constrain(frequency, 1.0e-6, max_frequency_);
 
-    // Set Internal Frequency for "frequency"
-    internal_frequency_ = 2.0f * sinf(std::numbers::pi * std::min(0.25f, frequency / (sample_rate_ * 2.0f))); // fs*2 because double sampled
-    tmp_qinternal_frequency_ = internal_frequency_ * 32768.0f;
+    frequency_ = frequency;
+    frequency_fixed_point_ = false;
+
+    // Set Internal Frequency for "frequency", shared with Svf
+    tmp_qinternal_frequency_ = Svf::CalcFrequencyCoefficient(topology_, frequency, sample_rate_);
+
+    RecalculateDamp();
+    FinishValueSetting();
+}
+
+void SvfStereo::SetFrequencyQ(q15_t frequency)
+{
+    qfrequency_ = std::clamp<q15_t>(frequency, 1, qmax_frequency_);
+    frequency_fixed_point_ = true;
+
+    // Same as SetFrequency, the sine (tangent) comes from the lookup table
+    tmp_qinternal_frequency_ = Svf::CalcFrequencyCoefficientQ(topology_, qfrequency_);
 
     RecalculateDamp();
     FinishValueSetting();
@@ -194,6 +293,7 @@ void SvfStereo::SetResonance(float resonance, ForceValue force)
     {
         resonance_ = constrain(resonance, 0.005f, 1.f);
     }
+    tmp_qresonance_damp_ = 2.0f * (1.0f - std::pow(resonance_, 0.25f)) * 32768.0f;
     RecalculateDamp();
     RecalculateDrive();
     FinishValueSetting();
@@ -206,16 +306,79 @@ void SvfStereo::SetDrive(float drive)
     FinishValueSetting();
 }
 
+void SvfStereo::SetParams(const Params &params)
+{
+    const float frequency = constrain(params.frequency, 1.0e-6, max_frequency_);
+    const float resonance = constrain(params.resonance, params.force_resonance == ForceValue::TRUE ? 0.0f : 0.005f, 1.f);
+    const float drive = constrain(params.drive, 0.f, 1.f);
+
+    const bool frequency_changed = frequency_fixed_point_ || frequency != frequency_;
+    const bool resonance_changed = resonance != resonance_;
+    if (!frequency_changed && !resonance_changed && drive == pre_drive_)
+    {
+        return;
+    }
+
+    if (frequency_changed)
+    {
+        frequency_ = frequency;
+        frequency_fixed_point_ = false;
+        tmp_qinternal_frequency_ = Svf::CalcFrequencyCoefficient(topology_, frequency, sample_rate_);
+    }
+    if (resonance_changed)
+    {
+        resonance_ = resonance;
+        tmp_qresonance_damp_ = 2.0f * (1.0f - std::pow(resonance_, 0.25f)) * 32768.0f;
+    }
+    if (frequency_changed || resonance_changed)
+    {
+        RecalculateDamp();
+    }
+    pre_drive_ = drive;
+    RecalculateDrive();
+    FinishValueSetting();
+}
+
 void SvfStereo::RecalculateDrive()
 {
     float drive = pre_drive_ * resonance_;
     tmp_qdrive_ = drive * 32768.0f;
 }
 
+void SvfStereo::SetTopology(Topology topology)
+{
+    topology_ = topology;
+    Reset();
+    if (frequency_fixed_point_)
+    {
+        SetFrequencyQ(qfrequency_);
+    }
+    else
+    {
+        SetFrequency(frequency_);
+    }
+}
+
+void SvfStereo::Reset()
+{
+    qnotch_left_ = 0;
+    qlow_left_ = 0;
+    qhigh_left_ = 0;
+    qband_left_ = 0;
+    qzdf_s1_left_ = 0;
+    qzdf_s2_left_ = 0;
+
+    qnotch_right_ = 0;
+    qlow_right_ = 0;
+    qhigh_right_ = 0;
+    qband_right_ = 0;
+    qzdf_s1_right_ = 0;
+    qzdf_s2_right_ = 0;
+}
+
 void SvfStereo::RecalculateDamp()
 {
-    float damp = std::min(2.0f * (1.0f - std::pow(resonance_, 0.25f)), std::min(2.0f, 2.0f / internal_frequency_ - internal_frequency_ * 0.5f));
-    tmp_qdamp_ = damp * 32768.0f;
+    Svf::CalcDamping(topology_, tmp_qinternal_frequency_, tmp_qresonance_damp_, tmp_qdamp_, tmp_qgain_, tmp_qfeedback_);
 }
 
 void SvfStereo::FinishValueSetting()
@@ -225,6 +388,8 @@ void SvfStereo::FinishValueSetting()
     qdrive_ = tmp_qdrive_;
     qdamp_ = tmp_qdamp_;
     qinternal_frequency_ = tmp_qinternal_frequency_;
+    qgain_ = tmp_qgain_;
+    qfeedback_ = tmp_qfeedback_;
 
     restore_interrupts(interrupts);
 }
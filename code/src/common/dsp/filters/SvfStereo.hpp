@@ -26,8 +26,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include "common/dsp/math/qmath.hpp"
 #include "common/fastcode.hpp"
+#include "Svf.hpp"
 
 namespace kastle2
 {
@@ -51,6 +53,8 @@ namespace kastle2
  * Additional thanks to Laurent de Soras for stability limit, and
  * Stefan Diedrichsen for the correct notch output
  * Ported by: Stephen Hensley to Daisy
+ *
+ * The ZDF topologies run the single pass of Svf::ZdfPass, see Svf.
  */
 
 class SvfStereo
@@ -71,6 +75,19 @@ public:
         TRUE
     };
 
+    using Topology = Svf::Topology;
+
+    /**
+     * @brief Frequency, resonance and drive set together by SetParams(), see Svf::Params
+     */
+    struct Params
+    {
+        float frequency = 500.0f;                       ///< Cutoff frequency in Hz, up to sample_rate / 3
+        float resonance = 0.5f;                         ///< 0.0 to 1.0
+        float drive = 0.5f;                             ///< 0.0 to 1.0
+        ForceValue force_resonance = ForceValue::FALSE; ///< See SetResonance()
+    };
+
     /**
      * @brief Initializes a new State Variable Filter instance
      * @param sample_rate - The sample rate of the audio
@@ -84,6 +101,22 @@ public:
      */
     FASTCODE void Process(q15_t input_left, q15_t input_right);
 
+    /**
+     * @brief Processes a block of interleaved stereo frames with the filter type set by SetType()
+     * @details The coefficients are loaded once and both channel states stay in locals for the whole block.
+     * GetLeft() and GetRight() return the last frame afterwards.
+     * @param input Interleaved input frames (left, right)
+     * @param output Interleaved output frames (can be the same as input)
+     * @param frames Number of frames to process
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t frames);
+
+    /**
+     * @brief Same as ProcessBlock above with the filter type fixed at compile time
+     */
+    template <Type kType>
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t frames);
+
     /**
      * @brief Returns the left processed signal.
      * @return Processed left channel
@@ -102,6 +135,12 @@ public:
      */
     void SetFrequency(float frequency);
 
+    /**
+     * @brief Sets the cutoff frequency in fixed point, without any float math (fast enough for audio-rate modulation).
+     * @param frequency Relative frequency to the sample rate (see freq_to_q15), clamped to sample_rate / 3
+     */
+    void SetFrequencyQ(q15_t frequency);
+
     /**
      * @brief Sets the resonance of the filter.
      * @param resonance Must be between 0.0 and 1.0 to ensure stability.
@@ -128,24 +167,67 @@ public:
      */
     void SetDrive(float drive);
 
+    /**
+     * @brief Sets the frequency, resonance and drive at once, recomputing only the changed coefficients (see Svf::SetParams())
+     */
+    void SetParams(const Params &params);
+
+    /**
+     * @brief Returns the frequency, resonance and drive of the last float setters, for changing some of them with SetParams()
+     */
+    Params GetParams() const
+    {
+        return {frequency_, resonance_, pre_drive_, resonance_ < 0.005f ? ForceValue::TRUE : ForceValue::FALSE};
+    }
+
+    /**
+     * @brief Clears the filter state, keeps the coefficients
+     */
+    void Reset();
+
+    /**
+     * @brief Sets the structure of the filter, recomputes the coefficients and clears the state.
+     * @param topology DOUBLE_SAMPLED, ZDF or ZDF_QUADRATIC_DRIVE
+     */
+    void SetTopology(Topology topology);
+
+    /**
+     * @brief Returns the structure of the filter
+     */
+    Topology GetTopology() const
+    {
+        return topology_;
+    }
+
 private:
     float sample_rate_ = 0.0f;
     float resonance_ = 0.0f;
     float pre_drive_ = 0.0f;
     float max_frequency_ = 0.0f;
-    float internal_frequency_ = 0.0f;
+    q15_t qmax_frequency_ = 0;
 
     Type type_ = Type::LOWPASS;
+    Topology topology_ = Topology::DOUBLE_SAMPLED;
+
+    // The last frequency setter, reapplied by SetTopology()
+    float frequency_ = 500.0f;
+    q15_t qfrequency_ = 0;
+    bool frequency_fixed_point_ = false;
 
     // Using these for calculations
     int32_t tmp_qdrive_ = 0;
     int32_t tmp_qdamp_ = 0;
     int32_t tmp_qinternal_frequency_ = 0;
+    int32_t tmp_qresonance_damp_ = 0;
+    int32_t tmp_qgain_ = 0;
+    int32_t tmp_qfeedback_ = 0;
 
     // These are set at once in FinishValueSetting to prevent glitches
     int32_t qdrive_ = 0;
     int32_t qdamp_ = 0;
     int32_t qinternal_frequency_ = 0;
+    int32_t qgain_ = 0;
+    int32_t qfeedback_ = 0;
 
     int32_t qnotch_left_ = 0;
     int32_t qlow_left_ = 0;
@@ -159,6 +241,12 @@ private:
     int32_t qband_right_ = 0;
     int32_t qinput_right_ = 0;
 
+    // ZDF state (the trapezoidal integrators)
+    int32_t qzdf_s1_left_ = 0;
+    int32_t qzdf_s2_left_ = 0;
+    int32_t qzdf_s1_right_ = 0;
+    int32_t qzdf_s2_right_ = 0;
+
     q15_t qout_raw_left_ = 0;
     q15_t qout_low_left_ = 0;
     q15_t qout_high_left_ = 0;
@@ -172,24 +260,38 @@ private:
     q15_t qout_notch_right_ = 0;
 
     static constexpr int32_t kDownsample = 1;
-    static constexpr int32_t kMultMax = 1 << 22; // Safety for not overflowing
 
     void RecalculateDamp();
     void RecalculateDrive();
     void FinishValueSetting();
+    FASTCODE void UpdateOutputs();
+
+    template <Type kType, Topology kTopology>
+    FASTCODE void ProcessFrames(const q15_t *input, q15_t *output, size_t frames);
 
-    static int32_t mult(int32_t a, int32_t b)
+    template <Type kType>
+    static inline q15_t SelectOutput(q15_t raw, int32_t low, int32_t high, int32_t band, int32_t notch)
     {
-        int32_t val = (a * b) >> 15;
-        if (val > kMultMax)
+        if constexpr (kType == Type::LOWPASS)
+        {
+            return low << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::HIGHPASS)
+        {
+            return high << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::BANDPASS)
+        {
+            return band << (kDownsample - 1);
+        }
+        else if constexpr (kType == Type::NOTCH)
         {
-            return kMultMax;
+            return notch << (kDownsample - 1);
         }
-        if (val < -kMultMax)
+        else
         {
-            return -kMultMax;
+            return raw;
         }
-        return val;
     }
 };
 }
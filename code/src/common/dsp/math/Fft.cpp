@@ -23,16 +23,14 @@ SOFTWARE.
 */
 
 #include "Fft.hpp"
-#include <numbers>
 
 using namespace kastle2;
 
 Fft::Fft(size_t samples, float sample_rate)
-    : samples_(samples), sample_rate_(sample_rate)
+    : fft_(samples), samples_(fft_.GetSize()), sample_rate_(sample_rate)
 {
-    source_buffer_ = std::make_unique<q15_t[]>(samples);
-    fft_buffer_ = std::make_unique<Complex[]>(samples);
-    magnitude_ = std::make_unique<float[]>(samples / 2);
+    source_buffer_ = std::make_unique<int16_t[]>(samples_);
+    fft_buffer_ = std::make_unique<FftQ15::Complex[]>(samples_);
     Reset();
 }
 
@@ -40,11 +38,12 @@ void Fft::Reset()
 {
     source_buffer_count_ = 0;
     source_buffer_index_ = 0;
+    dominant_bin_ = 0;
 }
 
 void Fft::AddSample(q15_t sample)
 {
-    source_buffer_[source_buffer_index_] = sample;
+    source_buffer_[source_buffer_index_] = static_cast<int16_t>(sample);
     source_buffer_index_ = (source_buffer_index_ + 1) % samples_;
     if (source_buffer_count_ < samples_)
     {
@@ -54,94 +53,31 @@ void Fft::AddSample(q15_t sample)
 
 void Fft::Compute()
 {
-    // Convert the q15_t samples to float numbers for FFT
-    for (size_t i = 0; i < source_buffer_count_; i++)
+    // Real input, the part of the buffer not filled yet is silence
+    for (size_t i = 0; i < samples_; i++)
     {
-        fft_buffer_[i].real = q15_to_float(source_buffer_[i]);
-        fft_buffer_[i].imag = 0.0;
+        fft_buffer_[i].real = i < source_buffer_count_ ? source_buffer_[i] : 0;
+        fft_buffer_[i].imag = 0;
     }
 
-    // Perform FFT
-    PerformFft(fft_buffer_.get(), samples_);
+    fft_.Transform(fft_buffer_.get());
 
-    // Calculate magnitude of the FFT output
-    for (size_t i = 0; i < samples_ / 2; i++)
-    {
-        magnitude_[i] = sqrtf(fft_buffer_[i].real * fft_buffer_[i].real + fft_buffer_[i].imag * fft_buffer_[i].imag);
-    }
-}
-
-float Fft::GetDominantFrequency()
-{
-    // Find the bin with the highest magnitude_
-    float maxMagnitude = 0;
-    int maxIndex = 0;
+    // Find the bin with the highest magnitude
+    uint32_t max_magnitude = 0;
+    dominant_bin_ = 0;
     for (size_t i = 1; i < samples_ / 2; i++)
     { // Start at 1 to skip the DC component
-        if (magnitude_[i] > maxMagnitude)
+        const uint32_t magnitude = FftQ15::MagnitudeSquared(fft_buffer_[i]);
+        if (magnitude > max_magnitude)
         {
-            maxMagnitude = magnitude_[i];
-            maxIndex = i;
+            max_magnitude = magnitude;
+            dominant_bin_ = i;
         }
     }
-
-    // Calculate the frequency of the bin with the highest magnitude_
-    return (float)maxIndex * (sample_rate_ / samples_);
 }
 
-void Fft::PerformFft(Complex *v, int n)
-{
-    // Bit reversal
-    BitReverse(v, n);
-
-    // Cooley-Tukey Fft
-    for (int length = 2; length <= n; length <<= 1)
-    {
-        float angle = -2.0f * std::numbers::pi / length;
-        Complex wlen = {cosf(angle), sinf(angle)};
-
-        for (int i = 0; i < n; i += length)
-        {
-            Complex w = {1.0f, 0.0f};
-            for (int j = 0; j < length / 2; ++j)
-            {
-                Complex u = v[i + j];
-                Complex t = {w.real * v[i + j + length / 2].real - w.imag * v[i + j + length / 2].imag,
-                             w.real * v[i + j + length / 2].imag + w.imag * v[i + j + length / 2].real};
-
-                v[i + j] = {u.real + t.real, u.imag + t.imag};
-                v[i + j + length / 2] = {u.real - t.real, u.imag - t.imag};
-
-                Complex temp = {w.real * wlen.real - w.imag * wlen.imag,
-                                w.real * wlen.imag + w.imag * wlen.real};
-                w = temp;
-            }
-        }
-    }
-}
-
-void Fft::BitReverse(Complex *v, int n)
+float Fft::GetDominantFrequency()
 {
-    int j = 0;
-    for (int i = 0; i < n; ++i)
-    {
-        if (i < j)
-        {
-            Swap(v[i], v[j]);
-        }
-        int m = n >> 1;
-        while (j >= m && m >= 2)
-        {
-            j -= m;
-            m >>= 1;
-        }
-        j += m;
-    }
+    // Calculate the frequency of the bin with the highest magnitude
+    return (float)dominant_bin_ * (sample_rate_ / samples_);
 }
-
-void Fft::Swap(Complex &a, Complex &b)
-{
-    Complex temp = a;
-    a = b;
-    b = temp;
-}
\ No newline at end of file
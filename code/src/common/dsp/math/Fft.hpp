@@ -24,9 +24,9 @@ SOFTWARE.
 
 #pragma once
 
-#include <cmath>
 #include <cstdint>
 #include <memory>
+#include "common/dsp/math/FftQ15.hpp"
 #include "common/dsp/math/qmath.hpp"
 
 namespace kastle2
@@ -36,25 +36,18 @@ namespace kastle2
  * @class Fft
  * @ingroup dsp_math
  * @brief Fast Fourier Transform (FFT) class for audio frequency analysis.
+ * @details Collects the samples in a circular buffer and finds the dominant frequency with FftQ15
+ *          (fixed-point, no floats in the transform).
  * @author Vaclav Mach (Bastl Instruments)
- * @warning This implementation is really slow on RP2040 and can't be used in the audio loop.
+ * @note Still a few milliseconds for 2048 points on RP2040, call Compute() from the UiLoop.
  * @date 2024-07-24
  */
 class Fft
 {
 public:
-    /**
-     * @brief Complex number structure.
-     */
-    struct Complex
-    {
-        float real;
-        float imag;
-    };
-
     /**
      * @brief Initialize the FFT.
-     * @param samples Circular buffer size for processing the samples.
+     * @param samples Circular buffer size for processing the samples (a power of two, see FftQ15).
      * @param sample_rate Sample rate of the audio.
      */
     Fft(size_t samples, float sample_rate);
@@ -71,7 +64,7 @@ public:
     void Reset();
 
     /**
-     * @brief Computes the FFT. SLOW! Should be called only in UiLoop.
+     * @brief Computes the FFT. Should be called only in UiLoop.
      */
     void Compute();
 
@@ -82,17 +75,14 @@ public:
     float GetDominantFrequency();
 
 private:
+    FftQ15 fft_;
     size_t samples_ = 0;
     float sample_rate_ = 0.0f;
-    std::unique_ptr<Complex[]> fft_buffer_;
-    std::unique_ptr<float[]> magnitude_;
+    std::unique_ptr<FftQ15::Complex[]> fft_buffer_;
+    size_t dominant_bin_ = 0;
 
-    std::unique_ptr<q15_t[]> source_buffer_;
+    std::unique_ptr<int16_t[]> source_buffer_;
     size_t source_buffer_index_ = 0;
     size_t source_buffer_count_ = 0;
-
-    static void PerformFft(Complex *v, int n);
-    static void BitReverse(Complex *v, int n);
-    static void Swap(Complex &a, Complex &b);
 };
 }
@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "FftQ15.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+using namespace kastle2;
+
+FftQ15::FftQ15(size_t size)
+{
+    // Round up to a supported power of two
+    size_ = kMinSize;
+    while (size_ < size && size_ < kMaxSize)
+    {
+        size_ <<= 1;
+    }
+
+    size_t log2 = 0;
+    while ((1u << log2) < size_)
+    {
+        log2++;
+    }
+    radix2_stage_ = (log2 & 1) != 0;
+    stages_ = log2 / 2 + (radix2_stage_ ? 1 : 0);
+
+    const size_t twiddles = size_ - size_ / 4;
+    twiddles_ = std::make_unique<Twiddle[]>(twiddles);
+    for (size_t k = 0; k < twiddles; k++)
+    {
+        const float angle = 2.0f * std::numbers::pi_v<float> * k / size_;
+        twiddles_[k].cos = static_cast<int16_t>(std::lround(std::clamp(cosf(angle) * 32768.0f, -32768.0f, 32767.0f)));
+        twiddles_[k].sin = static_cast<int16_t>(std::lround(std::clamp(sinf(angle) * 32768.0f, -32768.0f, 32767.0f)));
+    }
+
+    bit_reverse_ = std::make_unique<uint16_t[]>(size_);
+    for (size_t i = 0; i < size_; i++)
+    {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < log2; bit++)
+        {
+            reversed |= ((i >> bit) & 1) << (log2 - 1 - bit);
+        }
+        bit_reverse_[i] = static_cast<uint16_t>(reversed);
+    }
+}
+
+void FftQ15::Transform(Complex *data) const
+{
+    Reorder(data);
+    for (size_t stage = 0; stage < stages_; stage++)
+    {
+        Stage(data, stage);
+    }
+}
+
+void FftQ15::Reorder(Complex *data) const
+{
+    for (size_t i = 0; i < size_; i++)
+    {
+        const size_t j = bit_reverse_[i];
+        if (i < j)
+        {
+            const Complex temp = data[i];
+            data[i] = data[j];
+            data[j] = temp;
+        }
+    }
+}
+
+void FftQ15::Stage(Complex *data, const size_t stage, const bool scaled) const
+{
+    if (radix2_stage_)
+    {
+        if (stage == 0)
+        {
+            Radix2Stage(data, scaled ? 1 : 0);
+            return;
+        }
+        // Radix-4 stages combine blocks of 2, 8, 32...
+        Radix4Stage(data, static_cast<size_t>(2) << (2 * (stage - 1)), scaled ? 2 : 0);
+        return;
+    }
+    // Blocks of 1, 4, 16...
+    Radix4Stage(data, static_cast<size_t>(1) << (2 * stage), scaled ? 2 : 0);
+}
+
+void FftQ15::Radix2Stage(Complex *data, const int32_t shift) const
+{
+    for (size_t i = 0; i < size_; i += 2)
+    {
+        const Complex a = data[i];
+        const Complex b = data[i + 1];
+        data[i] = {(a.real + b.real) >> shift, (a.imag + b.imag) >> shift};
+        data[i + 1] = {(a.real - b.real) >> shift, (a.imag - b.imag) >> shift};
+    }
+}
+
+// x * w in Q15, split to 32-bit products so x can use up to 29 bits
+static inline int32_t Multiply(const int32_t x, const int32_t w)
+{
+    return (x >> 15) * w + (((x & 0x7FFF) * w + 0x4000) >> 15);
+}
+
+// x * W
+static inline FftQ15::Complex Rotate(const FftQ15::Complex &x, const int32_t cos, const int32_t sin)
+{
+    return {Multiply(x.real, cos) + Multiply(x.imag, sin), Multiply(x.imag, cos) - Multiply(x.real, sin)};
+}
+
+void FftQ15::Radix4Stage(Complex *data, const size_t quarter, const int32_t shift) const
+{
+    // Two radix-2 stages (blocks of quarter to 2 * quarter, and to 4 * quarter) in one pass
+    const size_t stride = size_ / (4 * quarter);
+    for (size_t block = 0; block < size_; block += 4 * quarter)
+    {
+        for (size_t j = 0; j < quarter; j++)
+        {
+            Complex *a = &data[block + j];
+            Complex *b = a + quarter;
+            Complex *c = b + quarter;
+            Complex *d = c + quarter;
+
+            const Twiddle &w1 = twiddles_[j * stride];
+            const Twiddle &w2 = twiddles_[2 * j * stride];
+            const Twiddle &w3 = twiddles_[3 * j * stride];
+            // W^0 is 1, which the Q15 table can only approximate
+            const Complex tb = j == 0 ? *b : Rotate(*b, w2.cos, w2.sin);
+            const Complex tc = j == 0 ? *c : Rotate(*c, w1.cos, w1.sin);
+            const Complex td = j == 0 ? *d : Rotate(*d, w3.cos, w3.sin);
+
+            const Complex sum = {a->real + tb.real, a->imag + tb.imag};
+            const Complex diff = {a->real - tb.real, a->imag - tb.imag};
+            const Complex odd_sum = {tc.real + td.real, tc.imag + td.imag};
+            const Complex odd_diff = {tc.real - td.real, tc.imag - td.imag};
+
+            // Scaled by 4 with rounding (or not at all), the odd difference is rotated by -i
+            const int32_t round = shift != 0 ? 1 << (shift - 1) : 0;
+            *a = {(sum.real + odd_sum.real + round) >> shift, (sum.imag + odd_sum.imag + round) >> shift};
+            *c = {(sum.real - odd_sum.real + round) >> shift, (sum.imag - odd_sum.imag + round) >> shift};
+            *b = {(diff.real + odd_diff.imag + round) >> shift, (diff.imag - odd_diff.real + round) >> shift};
+            *d = {(diff.real - odd_diff.imag + round) >> shift, (diff.imag + odd_diff.real + round) >> shift};
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class FftQ15
+ * @ingroup dsp_math
+ * @brief Fixed-point in-place complex FFT, radix-4 with a radix-2 stage for the odd powers of two.
+ * @details Twiddles (Q15) and the bit-reverse permutation are tabulated by the constructor,
+ *          the transform itself is integer only. Each stage scales its output down (by 4, or 2
+ *          for the radix-2 one), so the result is the DFT divided by the size and never overflows:
+ *          a full scale sine of bin k gives a magnitude of Q15_MAX / 2 in bins k and size - k.
+ *          The transform can be split (Reorder() and one Stage() at a time) to spread it over several calls.
+ *          Unscaled stages give the plain DFT, eg. for an inverse transform of a spectrum that was
+ *          scaled on the way in (see Stft). The values may then use more than 16 bits, up to 2^29.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class FftQ15
+{
+public:
+    /**
+     * @brief Complex Q15 value, int32 so the butterflies have headroom (or for more precision, see Stage()).
+     */
+    struct Complex
+    {
+        int32_t real;
+        int32_t imag;
+    };
+
+    /**
+     * @brief Smallest and largest supported size.
+     */
+    static constexpr size_t kMinSize = 4;
+    static constexpr size_t kMaxSize = 4096;
+
+    /**
+     * @brief Prepares the tables.
+     * @param size Number of points, a power of two from kMinSize to kMaxSize.
+     */
+    explicit FftQ15(size_t size);
+
+    /**
+     * @brief Returns the number of points.
+     */
+    inline size_t GetSize() const
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Returns the number of Stage() calls of one transform.
+     */
+    inline size_t GetStageCount() const
+    {
+        return stages_;
+    }
+
+    /**
+     * @brief Forward transform in place, natural order in and out, scaled by 1 / size.
+     * @param data GetSize() values, |real| and |imag| up to Q15_MAX.
+     */
+    void Transform(Complex *data) const;
+
+    /**
+     * @brief First step of the transform, the bit-reverse permutation.
+     */
+    void Reorder(Complex *data) const;
+
+    /**
+     * @brief One stage of the transform, call for stage 0 to GetStageCount() - 1 after Reorder().
+     * @param scaled Scales the stage output down (by 4, the radix-2 stage by 2), false leaves it to grow.
+     */
+    void Stage(Complex *data, size_t stage, bool scaled = true) const;
+
+    /**
+     * @brief Squared magnitude, no square root needed to compare bins.
+     */
+    static inline uint32_t MagnitudeSquared(const Complex &value)
+    {
+        return static_cast<uint32_t>(value.real * value.real) + static_cast<uint32_t>(value.imag * value.imag);
+    }
+
+private:
+    // W^k = cos - i * sin, k from 0 to 3/4 of the size (the radix-4 butterflies need W^3j)
+    struct Twiddle
+    {
+        int16_t cos;
+        int16_t sin;
+    };
+
+    size_t size_ = 0;
+    size_t stages_ = 0;
+    bool radix2_stage_ = false; // odd power of two, stage 0 is radix-2
+    std::unique_ptr<Twiddle[]> twiddles_;
+    std::unique_ptr<uint16_t[]> bit_reverse_;
+
+    void Radix2Stage(Complex *data, int32_t shift) const;
+    void Radix4Stage(Complex *data, size_t quarter, int32_t shift) const;
+};
+}
@@ -0,0 +1,127 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+namespace kastle2
+{
+
+/**
+ * @class LinearFit
+ * @ingroup dsp_math
+ * @brief Least-squares line y = offset + slope * x through the added points.
+ * @details Keeps only the sums, the line is computed when asked for. Meant for a handful of points
+ *          (eg. the calibration voltages), not for the audio path.
+ *          The sums are taken around the first point, which keeps the float precision for large x or y.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+class LinearFit
+{
+public:
+    /**
+     * @brief Removes all points.
+     */
+    void Reset()
+    {
+        count_ = 0;
+        sum_x_ = sum_y_ = sum_xx_ = sum_xy_ = 0.0f;
+    }
+
+    /**
+     * @brief Adds a point.
+     */
+    void Add(const float x, const float y)
+    {
+        if (count_ == 0)
+        {
+            origin_x_ = x;
+            origin_y_ = y;
+        }
+        const float dx = x - origin_x_;
+        const float dy = y - origin_y_;
+        count_++;
+        sum_x_ += dx;
+        sum_y_ += dy;
+        sum_xx_ += dx * dx;
+        sum_xy_ += dx * dy;
+    }
+
+    /**
+     * @brief Returns the number of added points.
+     */
+    size_t GetCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Returns the slope of the line, 0 for less than two distinct x.
+     */
+    float GetSlope() const
+    {
+        const float n = static_cast<float>(count_);
+        const float denominator = n * sum_xx_ - sum_x_ * sum_x_;
+        if (count_ < 2 || denominator == 0.0f)
+        {
+            return 0.0f;
+        }
+        return (n * sum_xy_ - sum_x_ * sum_y_) / denominator;
+    }
+
+    /**
+     * @brief Returns y of the line at x = 0.
+     */
+    float GetOffset() const
+    {
+        return Evaluate(0.0f);
+    }
+
+    /**
+     * @brief Returns y of the line at x.
+     */
+    float Evaluate(const float x) const
+    {
+        if (count_ == 0)
+        {
+            return 0.0f;
+        }
+        // The line goes through the mean of the points
+        const float n = static_cast<float>(count_);
+        return origin_y_ + sum_y_ / n + GetSlope() * (x - origin_x_ - sum_x_ / n);
+    }
+
+private:
+    size_t count_ = 0;
+    float origin_x_ = 0.0f;
+    float origin_y_ = 0.0f;
+    float sum_x_ = 0.0f;
+    float sum_y_ = 0.0f;
+    float sum_xx_ = 0.0f;
+    float sum_xy_ = 0.0f;
+};
+
+}
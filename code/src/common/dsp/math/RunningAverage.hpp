@@ -26,23 +26,211 @@ SOFTWARE.
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 
 namespace kastle2
 {
 
+/**
+ * @brief How the fixed size RunningAverage averages the values
+ * @ingroup dsp_math
+ */
+enum class RunningAverageMode
+{
+    WINDOW,      ///< Average (and median) of the last kSize values
+    EXPONENTIAL, ///< Exponential moving average with the weight 1 / kSize, no buffer
+};
+
+/**
+ * @class RunningAverage
+ * @ingroup dsp_math
+ * @brief Running average of a fixed number of values, without heap allocation.
+ * @details Same interface as RunningAverage<T> (the size given to the constructor), but the buffer is inline
+ *          and the sum is updated with each Add(), so GetAverage() doesn't loop over the buffer.
+ *          Once the buffer is full, the sum is divided by the constant kSize, which is a shift for power of two sizes.
+ *
+ *          RunningAverageMode::EXPONENTIAL keeps only the sum, as kSize times the average:
+ *          each Add() takes 1 / kSize of the average away and adds the new value. GetMedian() isn't available then.
+ * @tparam T Usually float or int32_t etc.
+ * @tparam kSize Number of the averaged values, prefer powers of two.
+ * @tparam kMode Window or exponential average.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ */
+template <typename T, size_t kSize = 0, RunningAverageMode kMode = RunningAverageMode::WINDOW>
+class RunningAverage
+{
+    static_assert(kSize > 0, "Exponential average needs a size");
+
+    // Wide enough for kSize values of T
+    using Sum = std::conditional_t<std::is_floating_point_v<T>, T,
+                                   std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+public:
+    /**
+     * @brief Construct a new Running Average object, without the resetting threshold
+     */
+    RunningAverage() = default;
+
+    /**
+     * @brief Construct a new Running Average object
+     * @param reset_threshold The threshold for resetting the average. If the difference between the current average and the new value exceeds this threshold, the average is reset.
+     * @note If reset_threshold is set to 0, the resetting is disabled.
+     */
+    explicit RunningAverage(T reset_threshold)
+    {
+        SetResetThreshold(reset_threshold);
+    }
+
+    /**
+     * @brief Sets the resetting threshold.
+     * @param threshold The resetting threshold value, setting it to 0 disables resetting.
+     */
+    void SetResetThreshold(T threshold)
+    {
+        reset_threshold_ = threshold;
+        reset_threshold_set_ = threshold > T{};
+    }
+
+    /**
+     * @brief Resets the average.
+     */
+    void Reset()
+    {
+        count_ = 0;
+        index_ = 0;
+        sum_ = 0;
+    }
+
+    /**
+     * @brief Checks if there are no values.
+     * @return True if the average is empty, false otherwise.
+     */
+    bool IsEmpty() const
+    {
+        return count_ == 0;
+    }
+
+    /**
+     * @brief Gets the count of the items (maxes out at kSize).
+     * @return The count of the items.
+     */
+    size_t GetCount() const
+    {
+        return count_;
+    }
+
+    /**
+     * @brief Adds a value to the average.
+     * @param value Usually float or int32_t etc.
+     */
+    void Add(T value)
+    {
+        if (reset_threshold_set_ && count_ > 0)
+        {
+            T avg = GetAverage();
+            T diff = (value > avg) ? (value - avg) : (avg - value);
+            if (diff > reset_threshold_)
+            {
+                Reset();
+            }
+        }
+
+        if constexpr (kMode == RunningAverageMode::EXPONENTIAL)
+        {
+            if (count_ == 0)
+            {
+                // Start at the first value instead of ramping up from 0
+                sum_ = static_cast<Sum>(value) * static_cast<Sum>(kSize);
+                count_ = kSize;
+            }
+            else
+            {
+                sum_ = sum_ - sum_ / static_cast<Sum>(kSize) + value;
+            }
+        }
+        else
+        {
+            if (count_ < kSize)
+            {
+                count_++;
+            }
+            else
+            {
+                sum_ -= values_[index_];
+            }
+            values_[index_] = value;
+            sum_ += value;
+            index_ = index_ + 1 < kSize ? index_ + 1 : 0;
+        }
+    }
+
+    /**
+     * @brief Gets the average of the values.
+     * @return The average of the values.
+     */
+    T GetAverage() const
+    {
+        if (count_ == kSize)
+        {
+            return static_cast<T>(sum_ / static_cast<Sum>(kSize));
+        }
+        return count_ > 0 ? static_cast<T>(sum_ / static_cast<Sum>(count_)) : 0;
+    }
+
+    /**
+     * @brief Gets the median of the values in the buffer.
+     * @return The median of the values.
+     */
+    T GetMedian() const
+    {
+        static_assert(kMode == RunningAverageMode::WINDOW, "The exponential average has no values for the median");
+        if (count_ == 0)
+        {
+            return 0;
+        }
+
+        // The buffer is filled from the start, the first count_ values are valid
+        std::array<T, kSize> temp_values;
+        std::copy(values_.begin(), values_.begin() + count_, temp_values.begin());
+        std::sort(temp_values.begin(), temp_values.begin() + count_);
+
+        if (count_ % 2 == 0)
+        {
+            return (temp_values[count_ / 2 - 1] + temp_values[count_ / 2]) / 2;
+        }
+        else
+        {
+            return temp_values[count_ / 2];
+        }
+    }
+
+private:
+    size_t count_ = 0;
+    size_t index_ = 0;
+    Sum sum_ = 0;
+    T reset_threshold_ = T{};
+    bool reset_threshold_set_ = false;
+    std::array<T, kMode == RunningAverageMode::WINDOW ? kSize : 0> values_{};
+};
+
 /**
  * @class RunningAverage
  * @ingroup dsp_math
  * @brief Calculating the running average and median of a set of values in a circular buffer.
  * @details Pass size of the buffer in the constructor. Add values with Add() method.
  *          Optionally set the resetting threshold with SetResetThreshold() method for instantaneous response to larger changes.
+ *          The buffer is allocated on the heap, use RunningAverage<T, kSize> when the size is known at compile time.
  * @tparam T Usually float or int32_t etc.
  * @author Vaclav Mach (Bastl Instruments), Marek Mach (Bastl Instruments)
  * @date 2024-07-31
  */
 template <typename T>
-class RunningAverage
+class RunningAverage<T, 0, RunningAverageMode::WINDOW>
 {
 public:
     /**
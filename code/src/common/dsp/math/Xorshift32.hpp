@@ -0,0 +1,104 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#ifndef KASTLE2_HOST
+#include "hardware/structs/rosc.h"
+#include "hardware/timer.h"
+#else
+#include <cstdlib>
+#endif
+
+namespace kastle2
+{
+
+/**
+ * @class Xorshift32
+ * @ingroup dsp_math
+ * @brief 32-bit xorshift pseudo-random generator (Marsaglia 13/17/5), each instance with its own state.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Three shifts and three xors per 32 random bits, no multiplication and no shared state, unlike rand() from
+ * newlib, which is slow and shared by both cores. The period is 2^32 - 1, the state must never be zero.
+ * The top bits are the best ones, NextBit() returns the top one.
+ */
+class Xorshift32
+{
+public:
+    /**
+     * @brief Sets the state, zero (which would stick) is replaced by the default seed.
+     */
+    void Seed(const uint32_t seed)
+    {
+        state_ = seed != 0 ? seed : kDefaultSeed;
+    }
+
+    /**
+     * @brief Returns the next 32 random bits.
+     */
+    inline uint32_t Next()
+    {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+
+    /**
+     * @brief Returns one random bit.
+     */
+    inline bool NextBit()
+    {
+        return Next() >> 31;
+    }
+
+    /**
+     * @brief Returns a seed which differs on each boot, from the random bit of the RP2040 ring oscillator.
+     * The host build returns rand(), seeded by the Hardware from the ADC readings like on the module.
+     */
+    static uint32_t HardwareSeed()
+    {
+#ifndef KASTLE2_HOST
+        // The ring oscillator jitters against the system clock, the timer spreads the seeds of close boots
+        uint32_t seed = 0;
+        for (int i = 0; i < 32; i++)
+        {
+            seed = (seed << 1) | (rosc_hw->randombit & 1u);
+        }
+        return seed ^ time_us_32();
+#else
+        return static_cast<uint32_t>(rand());
+#endif
+    }
+
+private:
+    static constexpr uint32_t kDefaultSeed = 2463534242u;
+
+    uint32_t state_ = kDefaultSeed;
+};
+
+}
@@ -0,0 +1,240 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace kastle2
+{
+
+/**
+ * @file lookup_generators.hpp
+ * @ingroup dsp_math
+ * @brief Compile time generators of the lookup tables, instead of tables generated by scripts.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Each generator is parameterized by the size of the table, its precision (the element type and the value of 1.0)
+ * and the guard entries the interpolation reads past the end (0 for a plain lookup, 1 for linear, 2 for cubic).
+ * The shared tables (eg. qmath_sine_table) are built by them, an app whose hot path needs a smaller
+ * or a more precise table builds its own:
+ *
+ *     // 256 entries of Q15 with one guard entry for the linear interpolation, 514 bytes
+ *     FASTDATA_INLINE(my_sine) inline constexpr auto my_sine = lookup_sine_table<int16_t, 8, 1>(32767.0);
+ *
+ * The math runs in double in the compiler, so the tables are the same on all the platforms.
+ */
+
+/**
+ * @brief Sine for the table generation (Taylor series, the argument must be within ±pi/2).
+ */
+constexpr double qmath_table_sine(const double x)
+{
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 12; i++)
+    {
+        term *= -x * x / ((2 * i) * (2 * i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Exponential for the table generation (halves the argument until it is small, then squares back).
+ */
+constexpr double qmath_table_exp(const double x)
+{
+    int halvings = 0;
+    double reduced = x;
+    while (reduced > 0.5 || reduced < -0.5)
+    {
+        reduced /= 2.0;
+        halvings++;
+    }
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i < 16; i++)
+    {
+        term *= reduced / i;
+        sum += term;
+    }
+    for (int i = 0; i < halvings; i++)
+    {
+        sum *= sum;
+    }
+    return sum;
+}
+
+/**
+ * @brief Conversion of the table values to the element type.
+ */
+enum class LookupRounding
+{
+    NEAREST,  ///< Rounded to the nearest value
+    TRUNCATE, ///< Rounded towards zero
+};
+
+/**
+ * @brief Converts the value to the fixed point element, saturated to the range of T.
+ * @param value Value, 1.0 maps to the scale
+ * @param scale The element value of 1.0, eg. 2^31 or Q31_MAX for Q31
+ * @param rounding How the fraction is dropped
+ */
+template <typename T>
+constexpr T lookup_to_fixed(const double value, const double scale, const LookupRounding rounding)
+{
+    double scaled = value * scale;
+    if (rounding == LookupRounding::NEAREST)
+    {
+        scaled += scaled < 0.0 ? -0.5 : 0.5;
+    }
+    if (scaled >= static_cast<double>(std::numeric_limits<T>::max()))
+    {
+        return std::numeric_limits<T>::max();
+    }
+    if (scaled <= static_cast<double>(std::numeric_limits<T>::min()))
+    {
+        return std::numeric_limits<T>::min();
+    }
+    return static_cast<T>(scaled);
+}
+
+/**
+ * @brief One period of sine in 2^Bits entries, followed by Guard entries repeating the period start.
+ * @tparam T Element type
+ * @tparam Bits Number of bits of the index
+ * @tparam Guard Entries read past the end by the interpolation
+ * @param scale The element value of 1.0 (saturated), eg. 2^31 for Q31
+ * @param rounding How the fraction is dropped
+ */
+template <typename T, size_t Bits, size_t Guard = 0>
+consteval std::array<T, (1u << Bits) + Guard> lookup_sine_table(const double scale,
+                                                                 const LookupRounding rounding = LookupRounding::NEAREST)
+{
+    static_assert(Bits >= 2, "The table needs at least one entry per quadrant");
+    constexpr size_t kSize = 1u << Bits;
+    constexpr size_t kQuarter = kSize / 4;
+    constexpr double kPi = 3.14159265358979323846;
+
+    std::array<T, kSize + Guard> table{};
+    for (size_t i = 0; i < kSize + Guard; i++)
+    {
+        // The quadrants mirror the first one, so the Taylor series only sees 0 to pi/2
+        const size_t index = i % kSize;
+        const size_t half = index % (kSize / 2);
+        const size_t mirrored = half <= kQuarter ? half : kSize / 2 - half;
+        const double sine = qmath_table_sine(2.0 * kPi * mirrored / kSize);
+        table[i] = lookup_to_fixed<T>(index < kSize / 2 ? sine : -sine, scale, rounding);
+    }
+    return table;
+}
+
+/**
+ * @brief Exponential decay exp(-decay * i / (Size - 1)), from 1.0 at the first entry to exp(-decay) at the last.
+ * @tparam T Element type
+ * @tparam Size Number of entries
+ * @tparam Guard Entries read past the end by the interpolation, they continue the curve
+ * @param decay Decay over the table
+ * @param scale The element value of 1.0 (saturated), eg. Q31_MAX
+ * @param rounding How the fraction is dropped
+ */
+template <typename T, size_t Size, size_t Guard = 0>
+consteval std::array<T, Size + Guard> lookup_exp_decay_table(const double decay, const double scale,
+                                                              const LookupRounding rounding = LookupRounding::NEAREST)
+{
+    static_assert(Size >= 2);
+    std::array<T, Size + Guard> table{};
+    for (size_t i = 0; i < Size + Guard; i++)
+    {
+        table[i] = lookup_to_fixed<T>(qmath_table_exp(-decay * static_cast<double>(i) / (Size - 1)), scale, rounding);
+    }
+    return table;
+}
+
+/**
+ * @brief Tukey window over Size entries: sine squared tapers over the taper fraction of the window, flat between them.
+ * @tparam T Element type
+ * @tparam Size Number of entries
+ * @tparam Guard Entries read past the end by the interpolation (zeros)
+ * @param taper Part of the window in the tapers, 1.0 is the Hann window
+ * @param scale The element value of 1.0 (saturated), eg. 32767.0 for Q15
+ * @param rounding How the fraction is dropped
+ */
+template <typename T, size_t Size, size_t Guard = 0>
+consteval std::array<T, Size + Guard> lookup_tukey_window_table(const double taper, const double scale,
+                                                                 const LookupRounding rounding = LookupRounding::NEAREST)
+{
+    static_assert(Size >= 2);
+    constexpr double kPi = 3.14159265358979323846;
+
+    std::array<T, Size + Guard> table{};
+    for (size_t i = 0; i < Size; i++)
+    {
+        // Entry centers, so the window is symmetric; the distance to the nearer edge stays within the Taylor range
+        const double x = (static_cast<double>(i) + 0.5) / Size;
+        const double edge = x < 0.5 ? x : 1.0 - x;
+        double value = 1.0;
+        if (edge < taper / 2.0)
+        {
+            const double sine = qmath_table_sine(kPi * edge / taper);
+            value = sine * sine;
+        }
+        table[i] = lookup_to_fixed<T>(value, scale, rounding);
+    }
+    return table;
+}
+
+/**
+ * @brief Equal-power fade out cos(pi/2 * i / (Size - 1)), from 1.0 at the first entry to 0 at the last.
+ * @details Read backwards it is the matching fade in, the powers of the two sum to 1.0 at every entry.
+ * @tparam T Element type
+ * @tparam Size Number of entries
+ * @tparam Guard Entries read past the end by the interpolation (zeros)
+ * @param scale The element value of 1.0 (saturated), eg. 32767.0 for Q15
+ * @param rounding How the fraction is dropped
+ */
+template <typename T, size_t Size, size_t Guard = 0>
+consteval std::array<T, Size + Guard> lookup_equal_power_fade_table(const double scale,
+                                                                     const LookupRounding rounding = LookupRounding::NEAREST)
+{
+    static_assert(Size >= 2);
+    constexpr double kPi = 3.14159265358979323846;
+
+    std::array<T, Size + Guard> table{};
+    for (size_t i = 0; i < Size; i++)
+    {
+        // cos(x) = sin(pi/2 - x), which keeps the Taylor series within 0 to pi/2
+        const double x = static_cast<double>(i) / (Size - 1);
+        table[i] = lookup_to_fixed<T>(qmath_table_sine(kPi / 2.0 * (1.0 - x)), scale, rounding);
+    }
+    return table;
+}
+
+}
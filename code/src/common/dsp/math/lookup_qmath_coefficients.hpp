@@ -0,0 +1,121 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/lookup_generators.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @file lookup_qmath_coefficients.hpp
+ * @ingroup dsp_math
+ * @brief Filter, envelope and pitch coefficient tables, generated at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Replaces sinf/expf/powf in the parameter updates, which take hundreds of cycles in soft-float on the RP2040.
+ * All the tables have one extra entry at the end, so the linear interpolation can always read [i + 1].
+ */
+
+#define QMATH_SVF_TABLE_SIZE 256
+#define QMATH_SVF_TABLE_SHIFT 6 // Q15 relative frequency 0-0.5 (14 bits) to 8 bits of index
+
+/**
+ * @brief State variable filter frequency coefficient 2 * sin(pi * f / (2 * fs)) in Q15 (can go over Q15_MAX).
+ * @details Indexed by the relative frequency f / fs in range 0-0.5, the filter is double sampled.
+ */
+inline constexpr std::array<int32_t, QMATH_SVF_TABLE_SIZE + 1> qmath_svf_table = []
+{
+    constexpr double pi = 3.14159265358979323846;
+    std::array<int32_t, QMATH_SVF_TABLE_SIZE + 1> table{};
+    for (size_t i = 0; i <= QMATH_SVF_TABLE_SIZE; i++)
+    {
+        const double relative_frequency = 0.5 * i / QMATH_SVF_TABLE_SIZE;
+        table[i] = static_cast<int32_t>(2.0 * qmath_table_sine(pi * relative_frequency / 2.0) * 32768.0 + 0.5);
+    }
+    return table;
+}();
+
+#define QMATH_SVF_ZDF_TABLE_SIZE 172 // Q15 relative frequency 0-0.336 (just over fs / 3), same index shift as QMATH_SVF_TABLE_SHIFT
+
+/**
+ * @brief Zero-delay-feedback state variable filter frequency coefficient tan(pi * f / fs) in Q15 (can go over Q15_MAX).
+ * @details Indexed by the relative frequency f / fs in range 0-0.336, the filter runs once per sample.
+ */
+inline constexpr std::array<int32_t, QMATH_SVF_ZDF_TABLE_SIZE + 1> qmath_svf_zdf_table = []
+{
+    constexpr double pi = 3.14159265358979323846;
+    std::array<int32_t, QMATH_SVF_ZDF_TABLE_SIZE + 1> table{};
+    for (size_t i = 0; i <= QMATH_SVF_ZDF_TABLE_SIZE; i++)
+    {
+        const double angle = pi * 0.5 * i / QMATH_SVF_TABLE_SIZE;
+        table[i] = static_cast<int32_t>(qmath_table_sine(angle) / qmath_table_sine(pi / 2.0 - angle) * 32768.0 + 0.5);
+    }
+    return table;
+}();
+
+#define QMATH_EXP_TABLE_SIZE 256
+#define QMATH_EXP_TABLE_RANGE 16 // Covered range of x
+#define QMATH_EXP_TABLE_SHIFT 23 // Q27 x in range 0-16 (31 bits) to 8 bits of index
+
+/**
+ * @brief (1 - exp(-x)) / x in Q31, for x in range 0-16.
+ * @details Tabulating the ratio instead of exp(-x) keeps the precision of 1 - exp(-x) for tiny x,
+ *          which are the long envelope times (coefficients very close to 1.0).
+ */
+inline constexpr std::array<int32_t, QMATH_EXP_TABLE_SIZE + 1> qmath_exp_table = []
+{
+    std::array<int32_t, QMATH_EXP_TABLE_SIZE + 1> table{};
+    table[0] = INT32_MAX; // Limit for x -> 0
+    for (size_t i = 1; i <= QMATH_EXP_TABLE_SIZE; i++)
+    {
+        const double x = static_cast<double>(QMATH_EXP_TABLE_RANGE) * i / QMATH_EXP_TABLE_SIZE;
+        table[i] = static_cast<int32_t>((1.0 - qmath_table_exp(-x)) / x * 2147483648.0 + 0.5);
+    }
+    return table;
+}();
+
+#define QMATH_EXP2_TABLE_SIZE 256
+#define QMATH_EXP2_TABLE_SHIFT 8 // Q16 fraction of an octave to 8 bits of index
+
+/**
+ * @brief 2^x in unsigned Q30 (1.0-2.0), for x in range 0-1 (one octave).
+ */
+inline constexpr std::array<uint32_t, QMATH_EXP2_TABLE_SIZE + 1> qmath_exp2_table = []
+{
+    constexpr double ln2 = 0.69314718055994530942;
+    std::array<uint32_t, QMATH_EXP2_TABLE_SIZE + 1> table{};
+    for (size_t i = 0; i <= QMATH_EXP2_TABLE_SIZE; i++)
+    {
+        table[i] = static_cast<uint32_t>(qmath_table_exp(ln2 * i / QMATH_EXP2_TABLE_SIZE) * 1073741824.0 + 0.5);
+    }
+    return table;
+}();
+
+}
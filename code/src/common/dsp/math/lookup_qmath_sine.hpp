@@ -24,6 +24,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include "common/fastcode.hpp"
+#include "common/dsp/math/lookup_generators.hpp"
 
 namespace kastle2
 {
@@ -31,1040 +35,27 @@ namespace kastle2
 /**
  * @file lookup_qmath_sine.h
  * @ingroup dsp_math
- * @brief Sine table for fast sine calculation.
+ * @brief Sine table for fast sine calculation, generated at compile time (see lookup_generators.hpp).
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-04-12
  */
 
-#include <cstdint>
-
 #define QMATH_SINE_TABLE_SIZE 4096
+#define QMATH_SINE_TABLE_BITS 12
 #define QMATH_SINE_TABLE_SHIFT_Q31 19 // (32 - 13)
 #define QMATH_SINE_TABLE_SHIFT_Q15 3 // (16 - 13)
 
-const int32_t qmath_sine_table[QMATH_SINE_TABLE_SIZE] = {
-    0, 3294197, 6588387, 9882561,
-    13176712, 16470832, 19764913, 23058947,
-    26352928, 29646846, 32940695, 36234466,
-    39528151, 42821744, 46115236, 49408620,
-    52701887, 55995030, 59288042, 62580914,
-    65873638, 69166208, 72458615, 75750851,
-    79042909, 82334782, 85626460, 88917937,
-    92209205, 95500255, 98791081, 102081675,
-    105372028, 108662134, 111951983, 115241570,
-    118530885, 121819921, 125108670, 128397125,
-    131685278, 134973122, 138260647, 141547847,
-    144834714, 148121241, 151407418, 154693240,
-    157978697, 161263783, 164548489, 167832808,
-    171116733, 174400254, 177683365, 180966058,
-    184248325, 187530159, 190811551, 194092495,
-    197372981, 200653003, 203932553, 207211624,
-    210490206, 213768293, 217045878, 220322951,
-    223599506, 226875535, 230151030, 233425984,
-    236700388, 239974235, 243247518, 246520228,
-    249792358, 253063900, 256334847, 259605191,
-    262874923, 266144038, 269412525, 272680379,
-    275947592, 279214155, 282480061, 285745302,
-    289009871, 292273760, 295536961, 298799466,
-    302061269, 305322361, 308582734, 311842381,
-    315101295, 318359466, 321616889, 324873555,
-    328129457, 331384586, 334638936, 337892498,
-    341145265, 344397230, 347648383, 350898719,
-    354148230, 357396906, 360644742, 363891730,
-    367137861, 370383128, 373627523, 376871039,
-    380113669, 383355404, 386596237, 389836160,
-    393075166, 396313247, 399550396, 402786604,
-    406021865, 409256170, 412489512, 415721883,
-    418953276, 422183684, 425413098, 428641511,
-    431868915, 435095303, 438320667, 441545000,
-    444768294, 447990541, 451211734, 454431865,
-    457650927, 460868912, 464085813, 467301622,
-    470516330, 473729932, 476942419, 480153784,
-    483364019, 486573117, 489781069, 492987869,
-    496193509, 499397982, 502601279, 505803394,
-    509004318, 512204045, 515402566, 518599875,
-    521795963, 524990824, 528184449, 531376831,
-    534567963, 537757837, 540946445, 544133781,
-    547319836, 550504604, 553688076, 556870245,
-    560051104, 563230645, 566408860, 569585743,
-    572761285, 575935480, 579108320, 582279796,
-    585449903, 588618632, 591785976, 594951927,
-    598116479, 601279623, 604441352, 607601658,
-    610760536, 613917975, 617073971, 620228514,
-    623381598, 626533215, 629683357, 632832018,
-    635979190, 639124865, 642269036, 645411696,
-    648552838, 651692453, 654830535, 657967075,
-    661102068, 664235505, 667367379, 670497682,
-    673626408, 676753549, 679879097, 683003045,
-    686125387, 689246113, 692365218, 695482694,
-    698598533, 701712728, 704825272, 707936158,
-    711045377, 714152924, 717258790, 720362968,
-    723465451, 726566232, 729665303, 732762657,
-    735858287, 738952186, 742044345, 745134758,
-    748223418, 751310318, 754395449, 757478806,
-    760560380, 763640164, 766718151, 769794334,
-    772868706, 775941259, 779011986, 782080880,
-    785147934, 788213141, 791276492, 794337982,
-    797397602, 800455346, 803511207, 806565177,
-    809617249, 812667415, 815715670, 818762005,
-    821806413, 824848888, 827889422, 830928007,
-    833964638, 836999305, 840032004, 843062726,
-    846091463, 849118210, 852142959, 855165703,
-    858186435, 861205147, 864221832, 867236484,
-    870249095, 873259659, 876268167, 879274614,
-    882278992, 885281293, 888281512, 891279640,
-    894275671, 897269597, 900261413, 903251110,
-    906238681, 909224120, 912207419, 915188572,
-    918167572, 921144411, 924119082, 927091579,
-    930061894, 933030021, 935995952, 938959681,
-    941921200, 944880503, 947837582, 950792431,
-    953745043, 956695411, 959643527, 962589385,
-    965532978, 968474300, 971413342, 974350098,
-    977284562, 980216726, 983146583, 986074127,
-    988999351, 991922248, 994842810, 997761031,
-    1000676905, 1003590424, 1006501581, 1009410370,
-    1012316784, 1015220816, 1018122458, 1021021705,
-    1023918550, 1026812985, 1029705004, 1032594600,
-    1035481766, 1038366495, 1041248781, 1044128617,
-    1047005996, 1049880912, 1052753357, 1055623324,
-    1058490808, 1061355801, 1064218296, 1067078288,
-    1069935768, 1072790730, 1075643169, 1078493076,
-    1081340445, 1084185270, 1087027544, 1089867259,
-    1092704411, 1095538991, 1098370993, 1101200410,
-    1104027237, 1106851465, 1109673089, 1112492101,
-    1115308496, 1118122267, 1120933406, 1123741908,
-    1126547765, 1129350972, 1132151521, 1134949406,
-    1137744621, 1140537158, 1143327011, 1146114174,
-    1148898640, 1151680403, 1154459456, 1157235792,
-    1160009405, 1162780288, 1165548435, 1168313840,
-    1171076495, 1173836395, 1176593533, 1179347902,
-    1182099496, 1184848308, 1187594332, 1190337562,
-    1193077991, 1195815612, 1198550419, 1201282407,
-    1204011567, 1206737894, 1209461382, 1212182024,
-    1214899813, 1217614743, 1220326809, 1223036002,
-    1225742318, 1228445750, 1231146291, 1233843935,
-    1236538675, 1239230506, 1241919421, 1244605414,
-    1247288478, 1249968606, 1252645794, 1255320034,
-    1257991320, 1260659646, 1263325005, 1265987392,
-    1268646800, 1271303222, 1273956653, 1276607086,
-    1279254516, 1281898935, 1284540337, 1287178717,
-    1289814068, 1292446384, 1295075659, 1297701886,
-    1300325060, 1302945174, 1305562222, 1308176198,
-    1310787095, 1313394909, 1315999631, 1318601257,
-    1321199781, 1323795195, 1326387494, 1328976672,
-    1331562723, 1334145641, 1336725419, 1339302052,
-    1341875533, 1344445857, 1347013017, 1349577007,
-    1352137822, 1354695455, 1357249901, 1359801152,
-    1362349204, 1364894050, 1367435685, 1369974101,
-    1372509294, 1375041258, 1377569986, 1380095472,
-    1382617710, 1385136696, 1387652422, 1390164882,
-    1392674072, 1395179984, 1397682613, 1400181954,
-    1402678000, 1405170745, 1407660183, 1410146309,
-    1412629117, 1415108601, 1417584755, 1420057574,
-    1422527051, 1424993180, 1427455956, 1429915374,
-    1432371426, 1434824109, 1437273414, 1439719338,
-    1442161874, 1444601017, 1447036760, 1449469098,
-    1451898025, 1454323536, 1456745625, 1459164286,
-    1461579514, 1463991302, 1466399645, 1468804538,
-    1471205974, 1473603949, 1475998456, 1478389489,
-    1480777044, 1483161115, 1485541696, 1487918781,
-    1490292364, 1492662441, 1495029006, 1497392053,
-    1499751576, 1502107570, 1504460029, 1506808949,
-    1509154322, 1511496145, 1513834411, 1516169114,
-    1518500250, 1520827813, 1523151797, 1525472197,
-    1527789007, 1530102222, 1532411837, 1534717846,
-    1537020244, 1539319024, 1541614183, 1543905714,
-    1546193612, 1548477872, 1550758488, 1553035455,
-    1555308768, 1557578421, 1559844408, 1562106725,
-    1564365367, 1566620327, 1568871601, 1571119183,
-    1573363068, 1575603251, 1577839726, 1580072489,
-    1582301533, 1584526854, 1586748447, 1588966306,
-    1591180426, 1593390801, 1595597428, 1597800299,
-    1599999411, 1602194758, 1604386335, 1606574136,
-    1608758157, 1610938393, 1613114838, 1615287487,
-    1617456335, 1619621377, 1621782608, 1623940023,
-    1626093616, 1628243383, 1630389319, 1632531418,
-    1634669676, 1636804087, 1638934646, 1641061349,
-    1643184191, 1645303166, 1647418269, 1649529496,
-    1651636841, 1653740300, 1655839867, 1657935539,
-    1660027308, 1662115172, 1664199124, 1666279161,
-    1668355276, 1670427466, 1672495725, 1674560049,
-    1676620432, 1678676870, 1680729357, 1682777890,
-    1684822463, 1686863072, 1688899711, 1690932376,
-    1692961062, 1694985765, 1697006479, 1699023199,
-    1701035922, 1703044642, 1705049355, 1707050055,
-    1709046739, 1711039401, 1713028037, 1715012642,
-    1716993211, 1718969740, 1720942225, 1722910659,
-    1724875040, 1726835361, 1728791620, 1730743810,
-    1732691928, 1734635968, 1736575927, 1738511799,
-    1740443581, 1742371267, 1744294853, 1746214334,
-    1748129707, 1750040966, 1751948107, 1753851126,
-    1755750017, 1757644777, 1759535401, 1761421885,
-    1763304224, 1765182414, 1767056450, 1768926328,
-    1770792044, 1772653593, 1774510970, 1776364172,
-    1778213194, 1780058032, 1781898681, 1783735137,
-    1785567396, 1787395453, 1789219305, 1791038946,
-    1792854372, 1794665580, 1796472565, 1798275323,
-    1800073849, 1801868139, 1803658189, 1805443995,
-    1807225553, 1809002858, 1810775906, 1812544694,
-    1814309216, 1816069469, 1817825449, 1819577151,
-    1821324572, 1823067707, 1824806552, 1826541103,
-    1828271356, 1829997307, 1831718951, 1833436286,
-    1835149306, 1836858008, 1838562388, 1840262441,
-    1841958164, 1843649553, 1845336604, 1847019312,
-    1848697674, 1850371686, 1852041343, 1853706643,
-    1855367581, 1857024153, 1858676355, 1860324183,
-    1861967634, 1863606704, 1865241388, 1866871683,
-    1868497586, 1870119091, 1871736196, 1873348897,
-    1874957189, 1876561070, 1878160535, 1879755580,
-    1881346202, 1882932397, 1884514161, 1886091491,
-    1887664383, 1889232832, 1890796837, 1892356392,
-    1893911494, 1895462140, 1897008325, 1898550047,
-    1900087301, 1901620084, 1903148392, 1904672222,
-    1906191570, 1907706433, 1909216806, 1910722688,
-    1912224073, 1913720958, 1915213340, 1916701216,
-    1918184581, 1919663432, 1921137767, 1922607581,
-    1924072871, 1925533633, 1926989864, 1928441561,
-    1929888720, 1931331338, 1932769411, 1934202936,
-    1935631910, 1937056329, 1938476190, 1939891490,
-    1941302225, 1942708392, 1944109987, 1945507008,
-    1946899451, 1948287312, 1949670589, 1951049279,
-    1952423377, 1953792881, 1955157788, 1956518093,
-    1957873796, 1959224890, 1960571375, 1961913246,
-    1963250501, 1964583136, 1965911148, 1967234535,
-    1968553292, 1969867417, 1971176906, 1972481757,
-    1973781967, 1975077532, 1976368450, 1977654717,
-    1978936331, 1980213288, 1981485585, 1982753220,
-    1984016189, 1985274489, 1986528118, 1987777073,
-    1989021350, 1990260946, 1991495860, 1992726087,
-    1993951625, 1995172471, 1996388622, 1997600076,
-    1998806829, 2000008879, 2001206222, 2002398857,
-    2003586779, 2004769987, 2005948478, 2007122248,
-    2008291295, 2009455617, 2010615210, 2011770073,
-    2012920201, 2014065592, 2015206245, 2016342155,
-    2017473321, 2018599739, 2019721407, 2020838323,
-    2021950484, 2023057887, 2024160529, 2025258408,
-    2026351522, 2027439867, 2028523442, 2029602243,
-    2030676269, 2031745516, 2032809982, 2033869665,
-    2034924562, 2035974670, 2037019988, 2038060512,
-    2039096241, 2040127172, 2041153301, 2042174628,
-    2043191150, 2044202863, 2045209767, 2046211857,
-    2047209133, 2048201592, 2049189231, 2050172048,
-    2051150040, 2052123207, 2053091544, 2054055050,
-    2055013723, 2055967560, 2056916560, 2057860719,
-    2058800036, 2059734508, 2060664133, 2061588910,
-    2062508835, 2063423908, 2064334124, 2065239484,
-    2066139983, 2067035621, 2067926394, 2068812302,
-    2069693342, 2070569511, 2071440808, 2072307231,
-    2073168777, 2074025446, 2074877233, 2075724139,
-    2076566160, 2077403294, 2078235540, 2079062896,
-    2079885360, 2080702930, 2081515603, 2082323379,
-    2083126254, 2083924228, 2084717298, 2085505463,
-    2086288720, 2087067068, 2087840505, 2088609029,
-    2089372638, 2090131331, 2090885105, 2091633960,
-    2092377892, 2093116901, 2093850985, 2094580142,
-    2095304370, 2096023667, 2096738032, 2097447464,
-    2098151960, 2098851519, 2099546139, 2100235819,
-    2100920556, 2101600350, 2102275199, 2102945101,
-    2103610054, 2104270057, 2104925109, 2105575208,
-    2106220352, 2106860540, 2107495770, 2108126041,
-    2108751352, 2109371700, 2109987085, 2110597505,
-    2111202959, 2111803444, 2112398960, 2112989506,
-    2113575080, 2114155680, 2114731305, 2115301954,
-    2115867626, 2116428319, 2116984031, 2117534762,
-    2118080511, 2118621275, 2119157054, 2119687847,
-    2120213651, 2120734467, 2121250292, 2121761126,
-    2122266967, 2122767814, 2123263666, 2123754522,
-    2124240380, 2124721240, 2125197100, 2125667960,
-    2126133817, 2126594672, 2127050522, 2127501367,
-    2127947206, 2128388038, 2128823862, 2129254676,
-    2129680480, 2130101272, 2130517052, 2130927819,
-    2131333572, 2131734309, 2132130030, 2132520734,
-    2132906420, 2133287087, 2133662734, 2134033361,
-    2134398966, 2134759548, 2135115107, 2135465642,
-    2135811153, 2136151637, 2136487095, 2136817525,
-    2137142927, 2137463301, 2137778644, 2138088958,
-    2138394240, 2138694490, 2138989708, 2139279892,
-    2139565043, 2139845159, 2140120240, 2140390284,
-    2140655293, 2140915264, 2141170197, 2141420092,
-    2141664948, 2141904764, 2142139541, 2142369276,
-    2142593971, 2142813624, 2143028234, 2143237802,
-    2143442326, 2143641807, 2143836244, 2144025635,
-    2144209982, 2144389283, 2144563539, 2144732748,
-    2144896910, 2145056025, 2145210092, 2145359112,
-    2145503083, 2145642006, 2145775880, 2145904705,
-    2146028480, 2146147205, 2146260881, 2146369505,
-    2146473080, 2146571603, 2146665076, 2146753497,
-    2146836866, 2146915184, 2146988450, 2147056664,
-    2147119825, 2147177934, 2147230991, 2147278995,
-    2147321946, 2147359845, 2147392690, 2147420483,
-    2147443222, 2147460908, 2147473542, 2147481121,
-    2147483647, 2147481121, 2147473542, 2147460908,
-    2147443222, 2147420483, 2147392690, 2147359845,
-    2147321946, 2147278995, 2147230991, 2147177934,
-    2147119825, 2147056664, 2146988450, 2146915184,
-    2146836866, 2146753497, 2146665076, 2146571603,
-    2146473080, 2146369505, 2146260881, 2146147205,
-    2146028480, 2145904705, 2145775880, 2145642006,
-    2145503083, 2145359112, 2145210092, 2145056025,
-    2144896910, 2144732748, 2144563539, 2144389283,
-    2144209982, 2144025635, 2143836244, 2143641807,
-    2143442326, 2143237802, 2143028234, 2142813624,
-    2142593971, 2142369276, 2142139541, 2141904764,
-    2141664948, 2141420092, 2141170197, 2140915264,
-    2140655293, 2140390284, 2140120240, 2139845159,
-    2139565043, 2139279892, 2138989708, 2138694490,
-    2138394240, 2138088958, 2137778644, 2137463301,
-    2137142927, 2136817525, 2136487095, 2136151637,
-    2135811153, 2135465642, 2135115107, 2134759548,
-    2134398966, 2134033361, 2133662734, 2133287087,
-    2132906420, 2132520734, 2132130030, 2131734309,
-    2131333572, 2130927819, 2130517052, 2130101272,
-    2129680480, 2129254676, 2128823862, 2128388038,
-    2127947206, 2127501367, 2127050522, 2126594672,
-    2126133817, 2125667960, 2125197100, 2124721240,
-    2124240380, 2123754522, 2123263666, 2122767814,
-    2122266967, 2121761126, 2121250292, 2120734467,
-    2120213651, 2119687847, 2119157054, 2118621275,
-    2118080511, 2117534762, 2116984031, 2116428319,
-    2115867626, 2115301954, 2114731305, 2114155680,
-    2113575080, 2112989506, 2112398960, 2111803444,
-    2111202959, 2110597505, 2109987085, 2109371700,
-    2108751352, 2108126041, 2107495770, 2106860540,
-    2106220352, 2105575208, 2104925109, 2104270057,
-    2103610054, 2102945101, 2102275199, 2101600350,
-    2100920556, 2100235819, 2099546139, 2098851519,
-    2098151960, 2097447464, 2096738032, 2096023667,
-    2095304370, 2094580142, 2093850985, 2093116901,
-    2092377892, 2091633960, 2090885105, 2090131331,
-    2089372638, 2088609029, 2087840505, 2087067068,
-    2086288720, 2085505463, 2084717298, 2083924228,
-    2083126254, 2082323379, 2081515603, 2080702930,
-    2079885360, 2079062896, 2078235540, 2077403294,
-    2076566160, 2075724139, 2074877233, 2074025446,
-    2073168777, 2072307231, 2071440808, 2070569511,
-    2069693342, 2068812302, 2067926394, 2067035621,
-    2066139983, 2065239484, 2064334124, 2063423908,
-    2062508835, 2061588910, 2060664133, 2059734508,
-    2058800036, 2057860719, 2056916560, 2055967560,
-    2055013723, 2054055050, 2053091544, 2052123207,
-    2051150040, 2050172048, 2049189231, 2048201592,
-    2047209133, 2046211857, 2045209767, 2044202863,
-    2043191150, 2042174628, 2041153301, 2040127172,
-    2039096241, 2038060512, 2037019988, 2035974670,
-    2034924562, 2033869665, 2032809982, 2031745516,
-    2030676269, 2029602243, 2028523442, 2027439867,
-    2026351522, 2025258408, 2024160529, 2023057887,
-    2021950484, 2020838323, 2019721407, 2018599739,
-    2017473321, 2016342155, 2015206245, 2014065592,
-    2012920201, 2011770073, 2010615210, 2009455617,
-    2008291295, 2007122248, 2005948478, 2004769987,
-    2003586779, 2002398857, 2001206222, 2000008879,
-    1998806829, 1997600076, 1996388622, 1995172471,
-    1993951625, 1992726087, 1991495860, 1990260946,
-    1989021350, 1987777073, 1986528118, 1985274489,
-    1984016189, 1982753220, 1981485585, 1980213288,
-    1978936331, 1977654717, 1976368450, 1975077532,
-    1973781967, 1972481757, 1971176906, 1969867417,
-    1968553292, 1967234535, 1965911148, 1964583136,
-    1963250501, 1961913246, 1960571375, 1959224890,
-    1957873796, 1956518093, 1955157788, 1953792881,
-    1952423377, 1951049279, 1949670589, 1948287312,
-    1946899451, 1945507008, 1944109987, 1942708392,
-    1941302225, 1939891490, 1938476190, 1937056329,
-    1935631910, 1934202936, 1932769411, 1931331338,
-    1929888720, 1928441561, 1926989864, 1925533633,
-    1924072871, 1922607581, 1921137767, 1919663432,
-    1918184581, 1916701216, 1915213340, 1913720958,
-    1912224073, 1910722688, 1909216806, 1907706433,
-    1906191570, 1904672222, 1903148392, 1901620084,
-    1900087301, 1898550047, 1897008325, 1895462140,
-    1893911494, 1892356392, 1890796837, 1889232832,
-    1887664383, 1886091491, 1884514161, 1882932397,
-    1881346202, 1879755580, 1878160535, 1876561070,
-    1874957189, 1873348897, 1871736196, 1870119091,
-    1868497586, 1866871683, 1865241388, 1863606704,
-    1861967634, 1860324183, 1858676355, 1857024153,
-    1855367581, 1853706643, 1852041343, 1850371686,
-    1848697674, 1847019312, 1845336604, 1843649553,
-    1841958164, 1840262441, 1838562388, 1836858008,
-    1835149306, 1833436286, 1831718951, 1829997307,
-    1828271356, 1826541103, 1824806552, 1823067707,
-    1821324572, 1819577151, 1817825449, 1816069469,
-    1814309216, 1812544694, 1810775906, 1809002858,
-    1807225553, 1805443995, 1803658189, 1801868139,
-    1800073849, 1798275323, 1796472565, 1794665580,
-    1792854372, 1791038946, 1789219305, 1787395453,
-    1785567396, 1783735137, 1781898681, 1780058032,
-    1778213194, 1776364172, 1774510970, 1772653593,
-    1770792044, 1768926328, 1767056450, 1765182414,
-    1763304224, 1761421885, 1759535401, 1757644777,
-    1755750017, 1753851126, 1751948107, 1750040966,
-    1748129707, 1746214334, 1744294853, 1742371267,
-    1740443581, 1738511799, 1736575927, 1734635968,
-    1732691928, 1730743810, 1728791620, 1726835361,
-    1724875040, 1722910659, 1720942225, 1718969740,
-    1716993211, 1715012642, 1713028037, 1711039401,
-    1709046739, 1707050055, 1705049355, 1703044642,
-    1701035922, 1699023199, 1697006479, 1694985765,
-    1692961062, 1690932376, 1688899711, 1686863072,
-    1684822463, 1682777890, 1680729357, 1678676870,
-    1676620432, 1674560049, 1672495725, 1670427466,
-    1668355276, 1666279161, 1664199124, 1662115172,
-    1660027308, 1657935539, 1655839867, 1653740300,
-    1651636841, 1649529496, 1647418269, 1645303166,
-    1643184191, 1641061349, 1638934646, 1636804087,
-    1634669676, 1632531418, 1630389319, 1628243383,
-    1626093616, 1623940023, 1621782608, 1619621377,
-    1617456335, 1615287487, 1613114838, 1610938393,
-    1608758157, 1606574136, 1604386335, 1602194758,
-    1599999411, 1597800299, 1595597428, 1593390801,
-    1591180426, 1588966306, 1586748447, 1584526854,
-    1582301533, 1580072489, 1577839726, 1575603251,
-    1573363068, 1571119183, 1568871601, 1566620327,
-    1564365367, 1562106725, 1559844408, 1557578421,
-    1555308768, 1553035455, 1550758488, 1548477872,
-    1546193612, 1543905714, 1541614183, 1539319024,
-    1537020244, 1534717846, 1532411837, 1530102222,
-    1527789007, 1525472197, 1523151797, 1520827813,
-    1518500250, 1516169114, 1513834411, 1511496145,
-    1509154322, 1506808949, 1504460029, 1502107570,
-    1499751576, 1497392053, 1495029006, 1492662441,
-    1490292364, 1487918781, 1485541696, 1483161115,
-    1480777044, 1478389489, 1475998456, 1473603949,
-    1471205974, 1468804538, 1466399645, 1463991302,
-    1461579514, 1459164286, 1456745625, 1454323536,
-    1451898025, 1449469098, 1447036760, 1444601017,
-    1442161874, 1439719338, 1437273414, 1434824109,
-    1432371426, 1429915374, 1427455956, 1424993180,
-    1422527051, 1420057574, 1417584755, 1415108601,
-    1412629117, 1410146309, 1407660183, 1405170745,
-    1402678000, 1400181954, 1397682613, 1395179984,
-    1392674072, 1390164882, 1387652422, 1385136696,
-    1382617710, 1380095472, 1377569986, 1375041258,
-    1372509294, 1369974101, 1367435685, 1364894050,
-    1362349204, 1359801152, 1357249901, 1354695455,
-    1352137822, 1349577007, 1347013017, 1344445857,
-    1341875533, 1339302052, 1336725419, 1334145641,
-    1331562723, 1328976672, 1326387494, 1323795195,
-    1321199781, 1318601257, 1315999631, 1313394909,
-    1310787095, 1308176198, 1305562222, 1302945174,
-    1300325060, 1297701886, 1295075659, 1292446384,
-    1289814068, 1287178717, 1284540337, 1281898935,
-    1279254516, 1276607086, 1273956653, 1271303222,
-    1268646800, 1265987392, 1263325005, 1260659646,
-    1257991320, 1255320034, 1252645794, 1249968606,
-    1247288478, 1244605414, 1241919421, 1239230506,
-    1236538675, 1233843935, 1231146291, 1228445750,
-    1225742318, 1223036002, 1220326809, 1217614743,
-    1214899813, 1212182024, 1209461382, 1206737894,
-    1204011567, 1201282407, 1198550419, 1195815612,
-    1193077991, 1190337562, 1187594332, 1184848308,
-    1182099496, 1179347902, 1176593533, 1173836395,
-    1171076495, 1168313840, 1165548435, 1162780288,
-    1160009405, 1157235792, 1154459456, 1151680403,
-    1148898640, 1146114174, 1143327011, 1140537158,
-    1137744621, 1134949406, 1132151521, 1129350972,
-    1126547765, 1123741908, 1120933406, 1118122267,
-    1115308496, 1112492101, 1109673089, 1106851465,
-    1104027237, 1101200410, 1098370993, 1095538991,
-    1092704411, 1089867259, 1087027544, 1084185270,
-    1081340445, 1078493076, 1075643169, 1072790730,
-    1069935768, 1067078288, 1064218296, 1061355801,
-    1058490808, 1055623324, 1052753357, 1049880912,
-    1047005996, 1044128617, 1041248781, 1038366495,
-    1035481766, 1032594600, 1029705004, 1026812985,
-    1023918550, 1021021705, 1018122458, 1015220816,
-    1012316784, 1009410370, 1006501581, 1003590424,
-    1000676905, 997761031, 994842810, 991922248,
-    988999351, 986074127, 983146583, 980216726,
-    977284562, 974350098, 971413342, 968474300,
-    965532978, 962589385, 959643527, 956695411,
-    953745043, 950792431, 947837582, 944880503,
-    941921200, 938959681, 935995952, 933030021,
-    930061894, 927091579, 924119082, 921144411,
-    918167572, 915188572, 912207419, 909224120,
-    906238681, 903251110, 900261413, 897269597,
-    894275671, 891279640, 888281512, 885281293,
-    882278992, 879274614, 876268167, 873259659,
-    870249095, 867236484, 864221832, 861205147,
-    858186435, 855165703, 852142959, 849118210,
-    846091463, 843062726, 840032004, 836999305,
-    833964638, 830928007, 827889422, 824848888,
-    821806413, 818762005, 815715670, 812667415,
-    809617249, 806565177, 803511207, 800455346,
-    797397602, 794337982, 791276492, 788213141,
-    785147934, 782080880, 779011986, 775941259,
-    772868706, 769794334, 766718151, 763640164,
-    760560380, 757478806, 754395449, 751310318,
-    748223418, 745134758, 742044345, 738952186,
-    735858287, 732762657, 729665303, 726566232,
-    723465451, 720362968, 717258790, 714152924,
-    711045377, 707936158, 704825272, 701712728,
-    698598533, 695482694, 692365218, 689246113,
-    686125387, 683003045, 679879097, 676753549,
-    673626408, 670497682, 667367379, 664235505,
-    661102068, 657967075, 654830535, 651692453,
-    648552838, 645411696, 642269036, 639124865,
-    635979190, 632832018, 629683357, 626533215,
-    623381598, 620228514, 617073971, 613917975,
-    610760536, 607601658, 604441352, 601279623,
-    598116479, 594951927, 591785976, 588618632,
-    585449903, 582279796, 579108320, 575935480,
-    572761285, 569585743, 566408860, 563230645,
-    560051104, 556870245, 553688076, 550504604,
-    547319836, 544133781, 540946445, 537757837,
-    534567963, 531376831, 528184449, 524990824,
-    521795963, 518599875, 515402566, 512204045,
-    509004318, 505803394, 502601279, 499397982,
-    496193509, 492987869, 489781069, 486573117,
-    483364019, 480153784, 476942419, 473729932,
-    470516330, 467301622, 464085813, 460868912,
-    457650927, 454431865, 451211734, 447990541,
-    444768294, 441545000, 438320667, 435095303,
-    431868915, 428641511, 425413098, 422183684,
-    418953276, 415721883, 412489512, 409256170,
-    406021865, 402786604, 399550396, 396313247,
-    393075166, 389836160, 386596237, 383355404,
-    380113669, 376871039, 373627523, 370383128,
-    367137861, 363891730, 360644742, 357396906,
-    354148230, 350898719, 347648383, 344397230,
-    341145265, 337892498, 334638936, 331384586,
-    328129457, 324873555, 321616889, 318359466,
-    315101295, 311842381, 308582734, 305322361,
-    302061269, 298799466, 295536961, 292273760,
-    289009871, 285745302, 282480061, 279214155,
-    275947592, 272680379, 269412525, 266144038,
-    262874923, 259605191, 256334847, 253063900,
-    249792358, 246520228, 243247518, 239974235,
-    236700388, 233425984, 230151030, 226875535,
-    223599506, 220322951, 217045878, 213768293,
-    210490206, 207211624, 203932553, 200653003,
-    197372981, 194092495, 190811551, 187530159,
-    184248325, 180966058, 177683365, 174400254,
-    171116733, 167832808, 164548489, 161263783,
-    157978697, 154693240, 151407418, 148121241,
-    144834714, 141547847, 138260647, 134973122,
-    131685278, 128397125, 125108670, 121819921,
-    118530885, 115241570, 111951983, 108662134,
-    105372028, 102081675, 98791081, 95500255,
-    92209205, 88917937, 85626460, 82334782,
-    79042909, 75750851, 72458615, 69166208,
-    65873638, 62580914, 59288042, 55995030,
-    52701887, 49408620, 46115236, 42821744,
-    39528151, 36234466, 32940695, 29646846,
-    26352928, 23058947, 19764913, 16470832,
-    13176712, 9882561, 6588387, 3294197,
-    0, -3294197, -6588387, -9882561,
-    -13176712, -16470832, -19764913, -23058947,
-    -26352928, -29646846, -32940695, -36234466,
-    -39528151, -42821744, -46115236, -49408620,
-    -52701887, -55995030, -59288042, -62580914,
-    -65873638, -69166208, -72458615, -75750851,
-    -79042909, -82334782, -85626460, -88917937,
-    -92209205, -95500255, -98791081, -102081675,
-    -105372028, -108662134, -111951983, -115241570,
-    -118530885, -121819921, -125108670, -128397125,
-    -131685278, -134973122, -138260647, -141547847,
-    -144834714, -148121241, -151407418, -154693240,
-    -157978697, -161263783, -164548489, -167832808,
-    -171116733, -174400254, -177683365, -180966058,
-    -184248325, -187530159, -190811551, -194092495,
-    -197372981, -200653003, -203932553, -207211624,
-    -210490206, -213768293, -217045878, -220322951,
-    -223599506, -226875535, -230151030, -233425984,
-    -236700388, -239974235, -243247518, -246520228,
-    -249792358, -253063900, -256334847, -259605191,
-    -262874923, -266144038, -269412525, -272680379,
-    -275947592, -279214155, -282480061, -285745302,
-    -289009871, -292273760, -295536961, -298799466,
-    -302061269, -305322361, -308582734, -311842381,
-    -315101295, -318359466, -321616889, -324873555,
-    -328129457, -331384586, -334638936, -337892498,
-    -341145265, -344397230, -347648383, -350898719,
-    -354148230, -357396906, -360644742, -363891730,
-    -367137861, -370383128, -373627523, -376871039,
-    -380113669, -383355404, -386596237, -389836160,
-    -393075166, -396313247, -399550396, -402786604,
-    -406021865, -409256170, -412489512, -415721883,
-    -418953276, -422183684, -425413098, -428641511,
-    -431868915, -435095303, -438320667, -441545000,
-    -444768294, -447990541, -451211734, -454431865,
-    -457650927, -460868912, -464085813, -467301622,
-    -470516330, -473729932, -476942419, -480153784,
-    -483364019, -486573117, -489781069, -492987869,
-    -496193509, -499397982, -502601279, -505803394,
-    -509004318, -512204045, -515402566, -518599875,
-    -521795963, -524990824, -528184449, -531376831,
-    -534567963, -537757837, -540946445, -544133781,
-    -547319836, -550504604, -553688076, -556870245,
-    -560051104, -563230645, -566408860, -569585743,
-    -572761285, -575935480, -579108320, -582279796,
-    -585449903, -588618632, -591785976, -594951927,
-    -598116479, -601279623, -604441352, -607601658,
-    -610760536, -613917975, -617073971, -620228514,
-    -623381598, -626533215, -629683357, -632832018,
-    -635979190, -639124865, -642269036, -645411696,
-    -648552838, -651692453, -654830535, -657967075,
-    -661102068, -664235505, -667367379, -670497682,
-    -673626408, -676753549, -679879097, -683003045,
-    -686125387, -689246113, -692365218, -695482694,
-    -698598533, -701712728, -704825272, -707936158,
-    -711045377, -714152924, -717258790, -720362968,
-    -723465451, -726566232, -729665303, -732762657,
-    -735858287, -738952186, -742044345, -745134758,
-    -748223418, -751310318, -754395449, -757478806,
-    -760560380, -763640164, -766718151, -769794334,
-    -772868706, -775941259, -779011986, -782080880,
-    -785147934, -788213141, -791276492, -794337982,
-    -797397602, -800455346, -803511207, -806565177,
-    -809617249, -812667415, -815715670, -818762005,
-    -821806413, -824848888, -827889422, -830928007,
-    -833964638, -836999305, -840032004, -843062726,
-    -846091463, -849118210, -852142959, -855165703,
-    -858186435, -861205147, -864221832, -867236484,
-    -870249095, -873259659, -876268167, -879274614,
-    -882278992, -885281293, -888281512, -891279640,
-    -894275671, -897269597, -900261413, -903251110,
-    -906238681, -909224120, -912207419, -915188572,
-    -918167572, -921144411, -924119082, -927091579,
-    -930061894, -933030021, -935995952, -938959681,
-    -941921200, -944880503, -947837582, -950792431,
-    -953745043, -956695411, -959643527, -962589385,
-    -965532978, -968474300, -971413342, -974350098,
-    -977284562, -980216726, -983146583, -986074127,
-    -988999351, -991922248, -994842810, -997761031,
-    -1000676905, -1003590424, -1006501581, -1009410370,
-    -1012316784, -1015220816, -1018122458, -1021021705,
-    -1023918550, -1026812985, -1029705004, -1032594600,
-    -1035481766, -1038366495, -1041248781, -1044128617,
-    -1047005996, -1049880912, -1052753357, -1055623324,
-    -1058490808, -1061355801, -1064218296, -1067078288,
-    -1069935768, -1072790730, -1075643169, -1078493076,
-    -1081340445, -1084185270, -1087027544, -1089867259,
-    -1092704411, -1095538991, -1098370993, -1101200410,
-    -1104027237, -1106851465, -1109673089, -1112492101,
-    -1115308496, -1118122267, -1120933406, -1123741908,
-    -1126547765, -1129350972, -1132151521, -1134949406,
-    -1137744621, -1140537158, -1143327011, -1146114174,
-    -1148898640, -1151680403, -1154459456, -1157235792,
-    -1160009405, -1162780288, -1165548435, -1168313840,
-    -1171076495, -1173836395, -1176593533, -1179347902,
-    -1182099496, -1184848308, -1187594332, -1190337562,
-    -1193077991, -1195815612, -1198550419, -1201282407,
-    -1204011567, -1206737894, -1209461382, -1212182024,
-    -1214899813, -1217614743, -1220326809, -1223036002,
-    -1225742318, -1228445750, -1231146291, -1233843935,
-    -1236538675, -1239230506, -1241919421, -1244605414,
-    -1247288478, -1249968606, -1252645794, -1255320034,
-    -1257991320, -1260659646, -1263325005, -1265987392,
-    -1268646800, -1271303222, -1273956653, -1276607086,
-    -1279254516, -1281898935, -1284540337, -1287178717,
-    -1289814068, -1292446384, -1295075659, -1297701886,
-    -1300325060, -1302945174, -1305562222, -1308176198,
-    -1310787095, -1313394909, -1315999631, -1318601257,
-    -1321199781, -1323795195, -1326387494, -1328976672,
-    -1331562723, -1334145641, -1336725419, -1339302052,
-    -1341875533, -1344445857, -1347013017, -1349577007,
-    -1352137822, -1354695455, -1357249901, -1359801152,
-    -1362349204, -1364894050, -1367435685, -1369974101,
-    -1372509294, -1375041258, -1377569986, -1380095472,
-    -1382617710, -1385136696, -1387652422, -1390164882,
-    -1392674072, -1395179984, -1397682613, -1400181954,
-    -1402678000, -1405170745, -1407660183, -1410146309,
-    -1412629117, -1415108601, -1417584755, -1420057574,
-    -1422527051, -1424993180, -1427455956, -1429915374,
-    -1432371426, -1434824109, -1437273414, -1439719338,
-    -1442161874, -1444601017, -1447036760, -1449469098,
-    -1451898025, -1454323536, -1456745625, -1459164286,
-    -1461579514, -1463991302, -1466399645, -1468804538,
-    -1471205974, -1473603949, -1475998456, -1478389489,
-    -1480777044, -1483161115, -1485541696, -1487918781,
-    -1490292364, -1492662441, -1495029006, -1497392053,
-    -1499751576, -1502107570, -1504460029, -1506808949,
-    -1509154322, -1511496145, -1513834411, -1516169114,
-    -1518500250, -1520827813, -1523151797, -1525472197,
-    -1527789007, -1530102222, -1532411837, -1534717846,
-    -1537020244, -1539319024, -1541614183, -1543905714,
-    -1546193612, -1548477872, -1550758488, -1553035455,
-    -1555308768, -1557578421, -1559844408, -1562106725,
-    -1564365367, -1566620327, -1568871601, -1571119183,
-    -1573363068, -1575603251, -1577839726, -1580072489,
-    -1582301533, -1584526854, -1586748447, -1588966306,
-    -1591180426, -1593390801, -1595597428, -1597800299,
-    -1599999411, -1602194758, -1604386335, -1606574136,
-    -1608758157, -1610938393, -1613114838, -1615287487,
-    -1617456335, -1619621377, -1621782608, -1623940023,
-    -1626093616, -1628243383, -1630389319, -1632531418,
-    -1634669676, -1636804087, -1638934646, -1641061349,
-    -1643184191, -1645303166, -1647418269, -1649529496,
-    -1651636841, -1653740300, -1655839867, -1657935539,
-    -1660027308, -1662115172, -1664199124, -1666279161,
-    -1668355276, -1670427466, -1672495725, -1674560049,
-    -1676620432, -1678676870, -1680729357, -1682777890,
-    -1684822463, -1686863072, -1688899711, -1690932376,
-    -1692961062, -1694985765, -1697006479, -1699023199,
-    -1701035922, -1703044642, -1705049355, -1707050055,
-    -1709046739, -1711039401, -1713028037, -1715012642,
-    -1716993211, -1718969740, -1720942225, -1722910659,
-    -1724875040, -1726835361, -1728791620, -1730743810,
-    -1732691928, -1734635968, -1736575927, -1738511799,
-    -1740443581, -1742371267, -1744294853, -1746214334,
-    -1748129707, -1750040966, -1751948107, -1753851126,
-    -1755750017, -1757644777, -1759535401, -1761421885,
-    -1763304224, -1765182414, -1767056450, -1768926328,
-    -1770792044, -1772653593, -1774510970, -1776364172,
-    -1778213194, -1780058032, -1781898681, -1783735137,
-    -1785567396, -1787395453, -1789219305, -1791038946,
-    -1792854372, -1794665580, -1796472565, -1798275323,
-    -1800073849, -1801868139, -1803658189, -1805443995,
-    -1807225553, -1809002858, -1810775906, -1812544694,
-    -1814309216, -1816069469, -1817825449, -1819577151,
-    -1821324572, -1823067707, -1824806552, -1826541103,
-    -1828271356, -1829997307, -1831718951, -1833436286,
-    -1835149306, -1836858008, -1838562388, -1840262441,
-    -1841958164, -1843649553, -1845336604, -1847019312,
-    -1848697674, -1850371686, -1852041343, -1853706643,
-    -1855367581, -1857024153, -1858676355, -1860324183,
-    -1861967634, -1863606704, -1865241388, -1866871683,
-    -1868497586, -1870119091, -1871736196, -1873348897,
-    -1874957189, -1876561070, -1878160535, -1879755580,
-    -1881346202, -1882932397, -1884514161, -1886091491,
-    -1887664383, -1889232832, -1890796837, -1892356392,
-    -1893911494, -1895462140, -1897008325, -1898550047,
-    -1900087301, -1901620084, -1903148392, -1904672222,
-    -1906191570, -1907706433, -1909216806, -1910722688,
-    -1912224073, -1913720958, -1915213340, -1916701216,
-    -1918184581, -1919663432, -1921137767, -1922607581,
-    -1924072871, -1925533633, -1926989864, -1928441561,
-    -1929888720, -1931331338, -1932769411, -1934202936,
-    -1935631910, -1937056329, -1938476190, -1939891490,
-    -1941302225, -1942708392, -1944109987, -1945507008,
-    -1946899451, -1948287312, -1949670589, -1951049279,
-    -1952423377, -1953792881, -1955157788, -1956518093,
-    -1957873796, -1959224890, -1960571375, -1961913246,
-    -1963250501, -1964583136, -1965911148, -1967234535,
-    -1968553292, -1969867417, -1971176906, -1972481757,
-    -1973781967, -1975077532, -1976368450, -1977654717,
-    -1978936331, -1980213288, -1981485585, -1982753220,
-    -1984016189, -1985274489, -1986528118, -1987777073,
-    -1989021350, -1990260946, -1991495860, -1992726087,
-    -1993951625, -1995172471, -1996388622, -1997600076,
-    -1998806829, -2000008879, -2001206222, -2002398857,
-    -2003586779, -2004769987, -2005948478, -2007122248,
-    -2008291295, -2009455617, -2010615210, -2011770073,
-    -2012920201, -2014065592, -2015206245, -2016342155,
-    -2017473321, -2018599739, -2019721407, -2020838323,
-    -2021950484, -2023057887, -2024160529, -2025258408,
-    -2026351522, -2027439867, -2028523442, -2029602243,
-    -2030676269, -2031745516, -2032809982, -2033869665,
-    -2034924562, -2035974670, -2037019988, -2038060512,
-    -2039096241, -2040127172, -2041153301, -2042174628,
-    -2043191150, -2044202863, -2045209767, -2046211857,
-    -2047209133, -2048201592, -2049189231, -2050172048,
-    -2051150040, -2052123207, -2053091544, -2054055050,
-    -2055013723, -2055967560, -2056916560, -2057860719,
-    -2058800036, -2059734508, -2060664133, -2061588910,
-    -2062508835, -2063423908, -2064334124, -2065239484,
-    -2066139983, -2067035621, -2067926394, -2068812302,
-    -2069693342, -2070569511, -2071440808, -2072307231,
-    -2073168777, -2074025446, -2074877233, -2075724139,
-    -2076566160, -2077403294, -2078235540, -2079062896,
-    -2079885360, -2080702930, -2081515603, -2082323379,
-    -2083126254, -2083924228, -2084717298, -2085505463,
-    -2086288720, -2087067068, -2087840505, -2088609029,
-    -2089372638, -2090131331, -2090885105, -2091633960,
-    -2092377892, -2093116901, -2093850985, -2094580142,
-    -2095304370, -2096023667, -2096738032, -2097447464,
-    -2098151960, -2098851519, -2099546139, -2100235819,
-    -2100920556, -2101600350, -2102275199, -2102945101,
-    -2103610054, -2104270057, -2104925109, -2105575208,
-    -2106220352, -2106860540, -2107495770, -2108126041,
-    -2108751352, -2109371700, -2109987085, -2110597505,
-    -2111202959, -2111803444, -2112398960, -2112989506,
-    -2113575080, -2114155680, -2114731305, -2115301954,
-    -2115867626, -2116428319, -2116984031, -2117534762,
-    -2118080511, -2118621275, -2119157054, -2119687847,
-    -2120213651, -2120734467, -2121250292, -2121761126,
-    -2122266967, -2122767814, -2123263666, -2123754522,
-    -2124240380, -2124721240, -2125197100, -2125667960,
-    -2126133817, -2126594672, -2127050522, -2127501367,
-    -2127947206, -2128388038, -2128823862, -2129254676,
-    -2129680480, -2130101272, -2130517052, -2130927819,
-    -2131333572, -2131734309, -2132130030, -2132520734,
-    -2132906420, -2133287087, -2133662734, -2134033361,
-    -2134398966, -2134759548, -2135115107, -2135465642,
-    -2135811153, -2136151637, -2136487095, -2136817525,
-    -2137142927, -2137463301, -2137778644, -2138088958,
-    -2138394240, -2138694490, -2138989708, -2139279892,
-    -2139565043, -2139845159, -2140120240, -2140390284,
-    -2140655293, -2140915264, -2141170197, -2141420092,
-    -2141664948, -2141904764, -2142139541, -2142369276,
-    -2142593971, -2142813624, -2143028234, -2143237802,
-    -2143442326, -2143641807, -2143836244, -2144025635,
-    -2144209982, -2144389283, -2144563539, -2144732748,
-    -2144896910, -2145056025, -2145210092, -2145359112,
-    -2145503083, -2145642006, -2145775880, -2145904705,
-    -2146028480, -2146147205, -2146260881, -2146369505,
-    -2146473080, -2146571603, -2146665076, -2146753497,
-    -2146836866, -2146915184, -2146988450, -2147056664,
-    -2147119825, -2147177934, -2147230991, -2147278995,
-    -2147321946, -2147359845, -2147392690, -2147420483,
-    -2147443222, -2147460908, -2147473542, -2147481121,
-    -2147483648, -2147481121, -2147473542, -2147460908,
-    -2147443222, -2147420483, -2147392690, -2147359845,
-    -2147321946, -2147278995, -2147230991, -2147177934,
-    -2147119825, -2147056664, -2146988450, -2146915184,
-    -2146836866, -2146753497, -2146665076, -2146571603,
-    -2146473080, -2146369505, -2146260881, -2146147205,
-    -2146028480, -2145904705, -2145775880, -2145642006,
-    -2145503083, -2145359112, -2145210092, -2145056025,
-    -2144896910, -2144732748, -2144563539, -2144389283,
-    -2144209982, -2144025635, -2143836244, -2143641807,
-    -2143442326, -2143237802, -2143028234, -2142813624,
-    -2142593971, -2142369276, -2142139541, -2141904764,
-    -2141664948, -2141420092, -2141170197, -2140915264,
-    -2140655293, -2140390284, -2140120240, -2139845159,
-    -2139565043, -2139279892, -2138989708, -2138694490,
-    -2138394240, -2138088958, -2137778644, -2137463301,
-    -2137142927, -2136817525, -2136487095, -2136151637,
-    -2135811153, -2135465642, -2135115107, -2134759548,
-    -2134398966, -2134033361, -2133662734, -2133287087,
-    -2132906420, -2132520734, -2132130030, -2131734309,
-    -2131333572, -2130927819, -2130517052, -2130101272,
-    -2129680480, -2129254676, -2128823862, -2128388038,
-    -2127947206, -2127501367, -2127050522, -2126594672,
-    -2126133817, -2125667960, -2125197100, -2124721240,
-    -2124240380, -2123754522, -2123263666, -2122767814,
-    -2122266967, -2121761126, -2121250292, -2120734467,
-    -2120213651, -2119687847, -2119157054, -2118621275,
-    -2118080511, -2117534762, -2116984031, -2116428319,
-    -2115867626, -2115301954, -2114731305, -2114155680,
-    -2113575080, -2112989506, -2112398960, -2111803444,
-    -2111202959, -2110597505, -2109987085, -2109371700,
-    -2108751352, -2108126041, -2107495770, -2106860540,
-    -2106220352, -2105575208, -2104925109, -2104270057,
-    -2103610054, -2102945101, -2102275199, -2101600350,
-    -2100920556, -2100235819, -2099546139, -2098851519,
-    -2098151960, -2097447464, -2096738032, -2096023667,
-    -2095304370, -2094580142, -2093850985, -2093116901,
-    -2092377892, -2091633960, -2090885105, -2090131331,
-    -2089372638, -2088609029, -2087840505, -2087067068,
-    -2086288720, -2085505463, -2084717298, -2083924228,
-    -2083126254, -2082323379, -2081515603, -2080702930,
-    -2079885360, -2079062896, -2078235540, -2077403294,
-    -2076566160, -2075724139, -2074877233, -2074025446,
-    -2073168777, -2072307231, -2071440808, -2070569511,
-    -2069693342, -2068812302, -2067926394, -2067035621,
-    -2066139983, -2065239484, -2064334124, -2063423908,
-    -2062508835, -2061588910, -2060664133, -2059734508,
-    -2058800036, -2057860719, -2056916560, -2055967560,
-    -2055013723, -2054055050, -2053091544, -2052123207,
-    -2051150040, -2050172048, -2049189231, -2048201592,
-    -2047209133, -2046211857, -2045209767, -2044202863,
-    -2043191150, -2042174628, -2041153301, -2040127172,
-    -2039096241, -2038060512, -2037019988, -2035974670,
-    -2034924562, -2033869665, -2032809982, -2031745516,
-    -2030676269, -2029602243, -2028523442, -2027439867,
-    -2026351522, -2025258408, -2024160529, -2023057887,
-    -2021950484, -2020838323, -2019721407, -2018599739,
-    -2017473321, -2016342155, -2015206245, -2014065592,
-    -2012920201, -2011770073, -2010615210, -2009455617,
-    -2008291295, -2007122248, -2005948478, -2004769987,
-    -2003586779, -2002398857, -2001206222, -2000008879,
-    -1998806829, -1997600076, -1996388622, -1995172471,
-    -1993951625, -1992726087, -1991495860, -1990260946,
-    -1989021350, -1987777073, -1986528118, -1985274489,
-    -1984016189, -1982753220, -1981485585, -1980213288,
-    -1978936331, -1977654717, -1976368450, -1975077532,
-    -1973781967, -1972481757, -1971176906, -1969867417,
-    -1968553292, -1967234535, -1965911148, -1964583136,
-    -1963250501, -1961913246, -1960571375, -1959224890,
-    -1957873796, -1956518093, -1955157788, -1953792881,
-    -1952423377, -1951049279, -1949670589, -1948287312,
-    -1946899451, -1945507008, -1944109987, -1942708392,
-    -1941302225, -1939891490, -1938476190, -1937056329,
-    -1935631910, -1934202936, -1932769411, -1931331338,
-    -1929888720, -1928441561, -1926989864, -1925533633,
-    -1924072871, -1922607581, -1921137767, -1919663432,
-    -1918184581, -1916701216, -1915213340, -1913720958,
-    -1912224073, -1910722688, -1909216806, -1907706433,
-    -1906191570, -1904672222, -1903148392, -1901620084,
-    -1900087301, -1898550047, -1897008325, -1895462140,
-    -1893911494, -1892356392, -1890796837, -1889232832,
-    -1887664383, -1886091491, -1884514161, -1882932397,
-    -1881346202, -1879755580, -1878160535, -1876561070,
-    -1874957189, -1873348897, -1871736196, -1870119091,
-    -1868497586, -1866871683, -1865241388, -1863606704,
-    -1861967634, -1860324183, -1858676355, -1857024153,
-    -1855367581, -1853706643, -1852041343, -1850371686,
-    -1848697674, -1847019312, -1845336604, -1843649553,
-    -1841958164, -1840262441, -1838562388, -1836858008,
-    -1835149306, -1833436286, -1831718951, -1829997307,
-    -1828271356, -1826541103, -1824806552, -1823067707,
-    -1821324572, -1819577151, -1817825449, -1816069469,
-    -1814309216, -1812544694, -1810775906, -1809002858,
-    -1807225553, -1805443995, -1803658189, -1801868139,
-    -1800073849, -1798275323, -1796472565, -1794665580,
-    -1792854372, -1791038946, -1789219305, -1787395453,
-    -1785567396, -1783735137, -1781898681, -1780058032,
-    -1778213194, -1776364172, -1774510970, -1772653593,
-    -1770792044, -1768926328, -1767056450, -1765182414,
-    -1763304224, -1761421885, -1759535401, -1757644777,
-    -1755750017, -1753851126, -1751948107, -1750040966,
-    -1748129707, -1746214334, -1744294853, -1742371267,
-    -1740443581, -1738511799, -1736575927, -1734635968,
-    -1732691928, -1730743810, -1728791620, -1726835361,
-    -1724875040, -1722910659, -1720942225, -1718969740,
-    -1716993211, -1715012642, -1713028037, -1711039401,
-    -1709046739, -1707050055, -1705049355, -1703044642,
-    -1701035922, -1699023199, -1697006479, -1694985765,
-    -1692961062, -1690932376, -1688899711, -1686863072,
-    -1684822463, -1682777890, -1680729357, -1678676870,
-    -1676620432, -1674560049, -1672495725, -1670427466,
-    -1668355276, -1666279161, -1664199124, -1662115172,
-    -1660027308, -1657935539, -1655839867, -1653740300,
-    -1651636841, -1649529496, -1647418269, -1645303166,
-    -1643184191, -1641061349, -1638934646, -1636804087,
-    -1634669676, -1632531418, -1630389319, -1628243383,
-    -1626093616, -1623940023, -1621782608, -1619621377,
-    -1617456335, -1615287487, -1613114838, -1610938393,
-    -1608758157, -1606574136, -1604386335, -1602194758,
-    -1599999411, -1597800299, -1595597428, -1593390801,
-    -1591180426, -1588966306, -1586748447, -1584526854,
-    -1582301533, -1580072489, -1577839726, -1575603251,
-    -1573363068, -1571119183, -1568871601, -1566620327,
-    -1564365367, -1562106725, -1559844408, -1557578421,
-    -1555308768, -1553035455, -1550758488, -1548477872,
-    -1546193612, -1543905714, -1541614183, -1539319024,
-    -1537020244, -1534717846, -1532411837, -1530102222,
-    -1527789007, -1525472197, -1523151797, -1520827813,
-    -1518500250, -1516169114, -1513834411, -1511496145,
-    -1509154322, -1506808949, -1504460029, -1502107570,
-    -1499751576, -1497392053, -1495029006, -1492662441,
-    -1490292364, -1487918781, -1485541696, -1483161115,
-    -1480777044, -1478389489, -1475998456, -1473603949,
-    -1471205974, -1468804538, -1466399645, -1463991302,
-    -1461579514, -1459164286, -1456745625, -1454323536,
-    -1451898025, -1449469098, -1447036760, -1444601017,
-    -1442161874, -1439719338, -1437273414, -1434824109,
-    -1432371426, -1429915374, -1427455956, -1424993180,
-    -1422527051, -1420057574, -1417584755, -1415108601,
-    -1412629117, -1410146309, -1407660183, -1405170745,
-    -1402678000, -1400181954, -1397682613, -1395179984,
-    -1392674072, -1390164882, -1387652422, -1385136696,
-    -1382617710, -1380095472, -1377569986, -1375041258,
-    -1372509294, -1369974101, -1367435685, -1364894050,
-    -1362349204, -1359801152, -1357249901, -1354695455,
-    -1352137822, -1349577007, -1347013017, -1344445857,
-    -1341875533, -1339302052, -1336725419, -1334145641,
-    -1331562723, -1328976672, -1326387494, -1323795195,
-    -1321199781, -1318601257, -1315999631, -1313394909,
-    -1310787095, -1308176198, -1305562222, -1302945174,
-    -1300325060, -1297701886, -1295075659, -1292446384,
-    -1289814068, -1287178717, -1284540337, -1281898935,
-    -1279254516, -1276607086, -1273956653, -1271303222,
-    -1268646800, -1265987392, -1263325005, -1260659646,
-    -1257991320, -1255320034, -1252645794, -1249968606,
-    -1247288478, -1244605414, -1241919421, -1239230506,
-    -1236538675, -1233843935, -1231146291, -1228445750,
-    -1225742318, -1223036002, -1220326809, -1217614743,
-    -1214899813, -1212182024, -1209461382, -1206737894,
-    -1204011567, -1201282407, -1198550419, -1195815612,
-    -1193077991, -1190337562, -1187594332, -1184848308,
-    -1182099496, -1179347902, -1176593533, -1173836395,
-    -1171076495, -1168313840, -1165548435, -1162780288,
-    -1160009405, -1157235792, -1154459456, -1151680403,
-    -1148898640, -1146114174, -1143327011, -1140537158,
-    -1137744621, -1134949406, -1132151521, -1129350972,
-    -1126547765, -1123741908, -1120933406, -1118122267,
-    -1115308496, -1112492101, -1109673089, -1106851465,
-    -1104027237, -1101200410, -1098370993, -1095538991,
-    -1092704411, -1089867259, -1087027544, -1084185270,
-    -1081340445, -1078493076, -1075643169, -1072790730,
-    -1069935768, -1067078288, -1064218296, -1061355801,
-    -1058490808, -1055623324, -1052753357, -1049880912,
-    -1047005996, -1044128617, -1041248781, -1038366495,
-    -1035481766, -1032594600, -1029705004, -1026812985,
-    -1023918550, -1021021705, -1018122458, -1015220816,
-    -1012316784, -1009410370, -1006501581, -1003590424,
-    -1000676905, -997761031, -994842810, -991922248,
-    -988999351, -986074127, -983146583, -980216726,
-    -977284562, -974350098, -971413342, -968474300,
-    -965532978, -962589385, -959643527, -956695411,
-    -953745043, -950792431, -947837582, -944880503,
-    -941921200, -938959681, -935995952, -933030021,
-    -930061894, -927091579, -924119082, -921144411,
-    -918167572, -915188572, -912207419, -909224120,
-    -906238681, -903251110, -900261413, -897269597,
-    -894275671, -891279640, -888281512, -885281293,
-    -882278992, -879274614, -876268167, -873259659,
-    -870249095, -867236484, -864221832, -861205147,
-    -858186435, -855165703, -852142959, -849118210,
-    -846091463, -843062726, -840032004, -836999305,
-    -833964638, -830928007, -827889422, -824848888,
-    -821806413, -818762005, -815715670, -812667415,
-    -809617249, -806565177, -803511207, -800455346,
-    -797397602, -794337982, -791276492, -788213141,
-    -785147934, -782080880, -779011986, -775941259,
-    -772868706, -769794334, -766718151, -763640164,
-    -760560380, -757478806, -754395449, -751310318,
-    -748223418, -745134758, -742044345, -738952186,
-    -735858287, -732762657, -729665303, -726566232,
-    -723465451, -720362968, -717258790, -714152924,
-    -711045377, -707936158, -704825272, -701712728,
-    -698598533, -695482694, -692365218, -689246113,
-    -686125387, -683003045, -679879097, -676753549,
-    -673626408, -670497682, -667367379, -664235505,
-    -661102068, -657967075, -654830535, -651692453,
-    -648552838, -645411696, -642269036, -639124865,
-    -635979190, -632832018, -629683357, -626533215,
-    -623381598, -620228514, -617073971, -613917975,
-    -610760536, -607601658, -604441352, -601279623,
-    -598116479, -594951927, -591785976, -588618632,
-    -585449903, -582279796, -579108320, -575935480,
-    -572761285, -569585743, -566408860, -563230645,
-    -560051104, -556870245, -553688076, -550504604,
-    -547319836, -544133781, -540946445, -537757837,
-    -534567963, -531376831, -528184449, -524990824,
-    -521795963, -518599875, -515402566, -512204045,
-    -509004318, -505803394, -502601279, -499397982,
-    -496193509, -492987869, -489781069, -486573117,
-    -483364019, -480153784, -476942419, -473729932,
-    -470516330, -467301622, -464085813, -460868912,
-    -457650927, -454431865, -451211734, -447990541,
-    -444768294, -441545000, -438320667, -435095303,
-    -431868915, -428641511, -425413098, -422183684,
-    -418953276, -415721883, -412489512, -409256170,
-    -406021865, -402786604, -399550396, -396313247,
-    -393075166, -389836160, -386596237, -383355404,
-    -380113669, -376871039, -373627523, -370383128,
-    -367137861, -363891730, -360644742, -357396906,
-    -354148230, -350898719, -347648383, -344397230,
-    -341145265, -337892498, -334638936, -331384586,
-    -328129457, -324873555, -321616889, -318359466,
-    -315101295, -311842381, -308582734, -305322361,
-    -302061269, -298799466, -295536961, -292273760,
-    -289009871, -285745302, -282480061, -279214155,
-    -275947592, -272680379, -269412525, -266144038,
-    -262874923, -259605191, -256334847, -253063900,
-    -249792358, -246520228, -243247518, -239974235,
-    -236700388, -233425984, -230151030, -226875535,
-    -223599506, -220322951, -217045878, -213768293,
-    -210490206, -207211624, -203932553, -200653003,
-    -197372981, -194092495, -190811551, -187530159,
-    -184248325, -180966058, -177683365, -174400254,
-    -171116733, -167832808, -164548489, -161263783,
-    -157978697, -154693240, -151407418, -148121241,
-    -144834714, -141547847, -138260647, -134973122,
-    -131685278, -128397125, -125108670, -121819921,
-    -118530885, -115241570, -111951983, -108662134,
-    -105372028, -102081675, -98791081, -95500255,
-    -92209205, -88917937, -85626460, -82334782,
-    -79042909, -75750851, -72458615, -69166208,
-    -65873638, -62580914, -59288042, -55995030,
-    -52701887, -49408620, -46115236, -42821744,
-    -39528151, -36234466, -32940695, -29646846,
-    -26352928, -23058947, -19764913, -16470832,
-    -13176712, -9882561, -6588387, -3294197};
+/**
+ * @brief Placement of the sine table, read by all the oscillators in the audio loop.
+ * The table is in RAM (16 kB) by default, define QMATH_SINE_TABLE_IN_FLASH for apps short on RAM.
+ */
+#ifndef QMATH_SINE_TABLE_IN_FLASH
+#define QMATH_SINE_TABLE_PLACEMENT FASTDATA_INLINE(qmath_sine_table)
+#else
+#define QMATH_SINE_TABLE_PLACEMENT
+#endif
+
+// sin(2 * pi * i / QMATH_SINE_TABLE_SIZE) in Q31, rounded and saturated (sin(pi / 2) is Q31_MAX)
+QMATH_SINE_TABLE_PLACEMENT inline constexpr std::array<int32_t, QMATH_SINE_TABLE_SIZE> qmath_sine_table =
+    lookup_sine_table<int32_t, QMATH_SINE_TABLE_BITS>(2147483648.0);
 }
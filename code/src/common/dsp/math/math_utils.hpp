@@ -669,4 +669,54 @@ constexpr float semitone_mod(int32_t semitones) noexcept
     return std::pow(2.0f, static_cast<float>(semitones) / 12.0f);
 }
 
+/**
+ * @brief Returns the smallest prime not below n (eg. delay lengths which don't share echoes)
+ * @param n The lower bound
+ * @return The prime
+ */
+inline constexpr size_t next_prime(size_t n)
+{
+    for (;; n++)
+    {
+        bool prime = n > 1;
+        for (size_t divisor = 2; divisor * divisor <= n && prime; divisor++)
+        {
+            prime = (n % divisor) != 0;
+        }
+        if (prime)
+        {
+            return n;
+        }
+    }
+}
+
+/**
+ * @brief Integer square root, rounded down (eg. the RMS from a mean square)
+ * @param n The number
+ * @return The root
+ */
+inline constexpr uint32_t isqrt(uint32_t n)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > n)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
 } // namespace kastle2
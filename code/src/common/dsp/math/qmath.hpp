@@ -26,6 +26,7 @@ SOFTWARE.
 #pragma once
 
 #include <cstdint>
+#include "lookup_qmath_coefficients.hpp"
 #include "lookup_qmath_sine.hpp"
 #include "math_utils.hpp"
 
@@ -564,6 +565,69 @@ inline constexpr q15_t q15_div(const q15_t a, const q15_t b)
     return q15_saturate(result);
 }
 
+/**
+ * @brief Divides a fixed point number by a constant, saturating the result, without a division.
+ * @details Same result as q15_div(a, kDivisor), bit exact. The quotient is estimated by multiplying with
+ * the reciprocal of kDivisor (integer part and Q15 fraction, computed at compile time). The estimate is
+ * at most 2 off, the remainder corrects it, so it costs 3 multiplies instead of a division call.
+ * @tparam kDivisor The denominator, positive and at least 2 (eg. Q15_HALF or q15(0.4f)).
+ * @param a The nominator, within -2 to 2 (the same range q15_div() handles).
+ * @return The result of the division.
+ */
+template <q15_t kDivisor>
+inline constexpr q15_t q15_div_by(const q15_t a)
+{
+    static_assert(kDivisor >= 2, "q15_div_by() needs a positive divisor of at least 2");
+    constexpr int32_t kInteger = (1 << 15) / kDivisor;
+    constexpr int32_t kFraction = (((1 << 15) % kDivisor << 15) + kDivisor / 2) / kDivisor;
+
+    const int32_t a32 = a << 15;
+    int32_t result = a * kInteger + ((a * kFraction) >> 15);
+    // Correct the estimate to the floor of the division...
+    int32_t remainder = a32 - result * kDivisor;
+    while (remainder < 0)
+    {
+        result--;
+        remainder += kDivisor;
+    }
+    while (remainder >= kDivisor)
+    {
+        result++;
+        remainder -= kDivisor;
+    }
+    // ...and round towards zero like the / operator
+    if (a32 < 0 && remainder != 0)
+    {
+        result++;
+    }
+    return q15_saturate(result);
+}
+
+#define Q15_RECIPROCAL_SHIFT 12
+
+/**
+ * @brief Reciprocal of a fixed point number for q15_mult_reciprocal(), in Q12 format.
+ * @details Meant for divisions by constants or by values which change slowly, so the division is done once.
+ * @param b The denominator, positive and at least q15(0.125f) to keep the product within 32 bits.
+ * @return 1 / b in Q12 format.
+ */
+inline constexpr int32_t q15_reciprocal(const q15_t b)
+{
+    return ((1 << (15 + Q15_RECIPROCAL_SHIFT)) + b / 2) / b;
+}
+
+/**
+ * @brief Divides a fixed point number by multiplying with a precomputed reciprocal, saturating the result.
+ * @details Same result as q15_div(a, b) within 1 LSB.
+ * @param a The nominator.
+ * @param reciprocal q15_reciprocal(b) of the denominator.
+ * @return The result of the division.
+ */
+inline constexpr q15_t q15_mult_reciprocal(const q15_t a, const int32_t reciprocal)
+{
+    return q15_saturate((a * reciprocal) >> Q15_RECIPROCAL_SHIFT);
+}
+
 /**
  * @brief Converts a fraction of two numbers into Q15 fixed point format.
  *
@@ -597,6 +661,127 @@ inline constexpr q15_t q15_sine(const q15_t x)
     return q31_to_q15(qmath_sine_table[q15_abs(x) >> QMATH_SINE_TABLE_SHIFT_Q15]);
 }
 
+/**
+ * @brief State variable filter frequency coefficient using a lookup table with linear interpolation.
+ * @param frequency Relative frequency to the sample rate (f / fs) in q15_t format, clamped to 0-0.5.
+ * @return 2 * sin(pi * f / (2 * fs)) in Q15 (up to 46341, which is over Q15_MAX).
+ */
+inline constexpr int32_t q15_svf_coefficient(const q15_t frequency)
+{
+    constexpr q15_t kMaxFrequency = QMATH_SVF_TABLE_SIZE << QMATH_SVF_TABLE_SHIFT; // 0.5
+    if (frequency <= 0)
+    {
+        return qmath_svf_table[0];
+    }
+    if (frequency >= kMaxFrequency)
+    {
+        return qmath_svf_table[QMATH_SVF_TABLE_SIZE];
+    }
+    const int32_t index = frequency >> QMATH_SVF_TABLE_SHIFT;
+    const int32_t fraction = (frequency & ((1 << QMATH_SVF_TABLE_SHIFT) - 1)) << (15 - QMATH_SVF_TABLE_SHIFT);
+    const int32_t a = qmath_svf_table[index];
+    const int32_t b = qmath_svf_table[index + 1];
+    return a + (((b - a) * fraction) >> 15);
+}
+
+/**
+ * @brief Zero-delay-feedback state variable filter frequency coefficient using a lookup table with linear interpolation.
+ * @param frequency Relative frequency to the sample rate (f / fs) in q15_t format, clamped to 0-0.336.
+ * @return tan(pi * f / fs) in Q15 (up to 57844, which is over Q15_MAX).
+ */
+inline constexpr int32_t q15_svf_zdf_coefficient(const q15_t frequency)
+{
+    constexpr q15_t kMaxFrequency = QMATH_SVF_ZDF_TABLE_SIZE << QMATH_SVF_TABLE_SHIFT;
+    if (frequency <= 0)
+    {
+        return qmath_svf_zdf_table[0];
+    }
+    if (frequency >= kMaxFrequency)
+    {
+        return qmath_svf_zdf_table[QMATH_SVF_ZDF_TABLE_SIZE];
+    }
+    const int32_t index = frequency >> QMATH_SVF_TABLE_SHIFT;
+    const int32_t fraction = (frequency & ((1 << QMATH_SVF_TABLE_SHIFT) - 1)) << (15 - QMATH_SVF_TABLE_SHIFT);
+    const int32_t a = qmath_svf_zdf_table[index];
+    const int32_t b = qmath_svf_zdf_table[index + 1];
+    return a + (((b - a) * fraction) >> 15);
+}
+
+/**
+ * @brief 1 - exp(-x) using a lookup table with linear interpolation.
+ * @details Used for exponential coefficients, exp(-x) itself is Q31_MAX minus the result.
+ *          Keeps the precision for very small x, eg. x = 1e-5 has 0.01 % error.
+ * @param x The argument in unsigned Q27 format (0-16), bigger values saturate.
+ * @return 1 - exp(-x) in q31_t format.
+ */
+inline constexpr q31_t q31_one_minus_exp(const uint32_t x)
+{
+    constexpr uint32_t kMaxX = static_cast<uint32_t>(QMATH_EXP_TABLE_RANGE) << 27;
+    if (x >= kMaxX)
+    {
+        return Q31_MAX;
+    }
+    const uint32_t index = x >> QMATH_EXP_TABLE_SHIFT;
+    const int64_t fraction = (x >> (QMATH_EXP_TABLE_SHIFT - 15)) & 0x7fff;
+    const int64_t a = qmath_exp_table[index];
+    const int64_t b = qmath_exp_table[index + 1];
+    const int64_t ratio = a + (((b - a) * fraction) >> 15);
+    const int64_t result = (static_cast<int64_t>(x) * ratio) >> 27;
+    return result > Q31_MAX ? Q31_MAX : static_cast<q31_t>(result);
+}
+
+/**
+ * @brief Multiplies a value by 2^octaves using a lookup table with linear interpolation (exponential pitch).
+ * @details Eg. a native frequency (freq_to_q31()) transposed by a V/Oct CV without powf,
+ *          cheap enough to be done every block for every voice. The error is about 0.01 cent.
+ * @param value The value to multiply, eg. a native frequency in q31_t format (must be positive).
+ * @param octaves The exponent in Q16 octaves (65536 is one octave up), see adc_to_octaves().
+ * @return value * 2^(octaves / 65536), saturated to Q31_MAX.
+ */
+inline constexpr q31_t q31_exp2(const q31_t value, const int32_t octaves)
+{
+    const int32_t whole = octaves >> 16; // Rounds down, also for negative octaves
+    const uint32_t index = (octaves >> QMATH_EXP2_TABLE_SHIFT) & (QMATH_EXP2_TABLE_SIZE - 1);
+    const uint32_t fraction = octaves & ((1 << QMATH_EXP2_TABLE_SHIFT) - 1);
+    const uint32_t a = qmath_exp2_table[index];
+    const uint32_t b = qmath_exp2_table[index + 1];
+    const uint32_t mantissa = a + (((b - a) * fraction) >> QMATH_EXP2_TABLE_SHIFT); // Q30, 1.0-2.0
+    const int64_t result = (static_cast<int64_t>(value) * mantissa) >> 30;
+    if (whole < 0)
+    {
+        return whole > -32 ? static_cast<q31_t>(result >> -whole) : 0;
+    }
+    if (whole >= 32 || result > (Q31_MAX >> whole))
+    {
+        return Q31_MAX;
+    }
+    return static_cast<q31_t>(result << whole);
+}
+
+/**
+ * @brief Converts a V/Oct CV in ADC values to Q16 octaves for q31_exp2().
+ * @param adc The ADC value, eg. Hardware::GetAnalogValue() of a pitch input (calibrated to ADC_1V per octave).
+ * @param adc_per_octave ADC values per octave, ADC_1V for the calibrated pitch inputs.
+ * @param fine_bits Fractional bits of the ADC value (0-4, eg. Hardware::kPitchFineBits for Hardware::GetPitchValueFine()).
+ * @return The pitch in Q16 octaves.
+ */
+inline constexpr int32_t adc_to_octaves(const int32_t adc, const int32_t adc_per_octave, const size_t fine_bits = 0)
+{
+    // Q23 octaves per ADC value, times the ADC value with 4 fractional bits fits 32 bits up to ±8 V
+    const int32_t reciprocal = ((1 << 23) + adc_per_octave / 2) / adc_per_octave;
+    return ((adc << (4 - fine_bits)) * reciprocal) >> (23 + 4 - 16);
+}
+
+/**
+ * @brief Converts Q16 semitones (eg. Quantizer::ProcessSemitones()) to Q16 octaves for q31_exp2().
+ * @param semitones The pitch in Q16 semitones.
+ * @return The pitch in Q16 octaves.
+ */
+inline constexpr int32_t semitones_to_octaves(const int32_t semitones)
+{
+    return static_cast<int32_t>((static_cast<int64_t>(semitones) * ((1 << 30) / 12) + (1 << 29)) >> 30);
+}
+
 /**
  * @brief Converts a frequency in Hz to a relative frequency to sample_rate.
  * @param frequency The frequency in Hz.
@@ -619,4 +804,106 @@ inline constexpr q15_t freq_to_q15(const float frequency, const float sample_rat
     return (frequency * (Q15_MAX / sample_rate));
 }
 
+
+/**
+ * @brief Stereo frame of two q15 samples packed in 32 bits, the left one in the low half.
+ *
+ * Interleaved 16-bit frames (eg. SamplePlayer16bit::ProcessBlock() output) are loaded with one
+ * 32-bit load instead of two halfwords. The M0+ has no packed multiply, so gains still multiply each half,
+ * the saturating add is done on both halves at once (SIMD within a register).
+ */
+using q15x2_t = uint32_t;
+
+/** @brief 32-bit view of interleaved q15least_t frames, allowed to alias them. */
+typedef uint32_t q15x2_alias_t __attribute__((__may_alias__));
+
+/**
+ * @brief Packs two q15 samples (in the q15least_t range) into a stereo frame.
+ */
+inline constexpr q15x2_t q15x2_pack(const q15_t left, const q15_t right)
+{
+    return static_cast<uint16_t>(left) | (static_cast<uint32_t>(right) << 16);
+}
+
+/**
+ * @brief Returns the left sample of a stereo frame.
+ */
+inline constexpr q15_t q15x2_left(const q15x2_t frame)
+{
+    return static_cast<int16_t>(frame & 0xFFFF);
+}
+
+/**
+ * @brief Returns the right sample of a stereo frame.
+ */
+inline constexpr q15_t q15x2_right(const q15x2_t frame)
+{
+    return static_cast<int32_t>(frame) >> 16;
+}
+
+/**
+ * @brief Loads a frame of interleaved q15least_t samples with one 32-bit load.
+ * @param frame The left sample of the frame, must be 4-byte aligned (alignas(4) on the buffer).
+ */
+inline q15x2_t q15x2_load(const q15least_t *frame)
+{
+    return *reinterpret_cast<const q15x2_alias_t *>(frame);
+}
+
+/**
+ * @brief Stores a frame to interleaved q15least_t samples with one 32-bit store.
+ * @param frame The left sample of the frame, must be 4-byte aligned (alignas(4) on the buffer).
+ * @param value The frame.
+ */
+inline void q15x2_store(q15least_t *frame, const q15x2_t value)
+{
+    *reinterpret_cast<q15x2_alias_t *>(frame) = value;
+}
+
+/**
+ * @brief Adds two stereo frames saturating each channel, bit exact with q15_add() on each of them.
+ */
+inline constexpr q15x2_t q15x2_add(const q15x2_t a, const q15x2_t b)
+{
+    constexpr uint32_t kSigns = 0x80008000;
+    // Add without the carry from the left half to the right one
+    const uint32_t sum = ((a & ~kSigns) + (b & ~kSigns)) ^ ((a ^ b) & kSigns);
+    // Overflow: both inputs of the same sign, the sum of the other one
+    const uint32_t overflow = ~(a ^ b) & (a ^ sum) & kSigns;
+    if (overflow == 0)
+    {
+        return sum;
+    }
+    const uint32_t mask = (overflow >> 15) * 0xFFFF;
+    // Q15_MAX for positive inputs, Q15_MIN for negative ones
+    const uint32_t saturated = 0x7FFF7FFF + ((a >> 15) & 0x00010001);
+    return (sum & ~mask) | (saturated & mask);
+}
+
+/**
+ * @brief Multiplies both channels of a stereo frame by a gain, as q15_mult().
+ */
+inline constexpr q15x2_t q15x2_mult(const q15x2_t frame, const q15_t gain)
+{
+    return q15x2_pack(q15_mult(q15x2_left(frame), gain), q15_mult(q15x2_right(frame), gain));
+}
+
+/**
+ * @brief Mixes two stereo frames with their gains, saturating.
+ */
+inline constexpr q15x2_t q15x2_mix(const q15x2_t a, const q15_t gain_a, const q15x2_t b, const q15_t gain_b)
+{
+    return q15x2_add(q15x2_mult(a, gain_a), q15x2_mult(b, gain_b));
+}
+
+/**
+ * @brief Crossfades two stereo frames.
+ * @param a The frame at position 0.
+ * @param b The frame at position Q15_MAX.
+ * @param position 0 to Q15_MAX.
+ */
+inline constexpr q15x2_t q15x2_crossfade(const q15x2_t a, const q15x2_t b, const q15_t position)
+{
+    return q15x2_mix(a, q15_inv(position), b, position);
+}
 }
@@ -0,0 +1,167 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AdpcmDecoder
+ * @ingroup dsp_sampling
+ * @brief Decodes IMA-ADPCM sample blocks into a small RAM ring for the SamplePlayer.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The sample data is kBlockFrames frames per block of 4-bit codes, followed by a seek table with the decoder
+ * state (predictor and step index) at the start of each block and channel, so any block decodes on its own.
+ * Random start points and reverse playback stay O(1): the player asks for the block under the playhead and
+ * the whole block is decoded into one of kSlots slots, direct mapped by the block number.
+ * Two slots are enough for the interpolation, which reads across at most one block boundary.
+ *
+ * The layout is described in WAVE_BARD_FORMAT.md.
+ */
+class AdpcmDecoder
+{
+public:
+    /**
+     * @brief Frames in one block (per channel).
+     */
+    static constexpr size_t kBlockFrames = 256;
+    static constexpr size_t kBlockShift = 8;
+
+    /**
+     * @brief Decoded blocks kept in RAM (power of two).
+     */
+    static constexpr size_t kSlots = 2;
+
+    /**
+     * @brief Bytes of 4-bit codes in one block per channel.
+     */
+    static constexpr size_t kCodeBytes = kBlockFrames / 2;
+
+    /**
+     * @brief Bytes of one seek table entry per channel: predictor (int16), step index (uint8) and a reserved byte.
+     */
+    static constexpr size_t kSeekEntryBytes = 4;
+
+    AdpcmDecoder()
+    {
+        Reset();
+    }
+
+    /**
+     * @brief Drops the decoded blocks, call it when the sample changes.
+     */
+    void Reset()
+    {
+        tags_.fill(kInvalidBlock);
+    }
+
+    /**
+     * @brief Returns the decoded (interleaved) frames of the block when it's in the ring.
+     * @param block Block number
+     * @return The frames, nullptr when the block has to be decoded.
+     */
+    inline const int16_t *Find(size_t block) const
+    {
+        const size_t slot = block & (kSlots - 1);
+        return tags_[slot] == block ? slots_[slot].data() : nullptr;
+    }
+
+    /**
+     * @brief Decodes the block into its slot.
+     * @param block Block number
+     * @param seek Seek table entries of the block, one per channel
+     * @param codes 4-bit codes of the block, interleaved by channel, low nibble first
+     * @param channels Number of channels (1 or 2)
+     * @return The decoded (interleaved) frames
+     */
+    FASTCODE const int16_t *Decode(size_t block, const uint8_t *seek, const uint8_t *codes, size_t channels)
+    {
+        const size_t slot = block & (kSlots - 1);
+        int16_t *frames = slots_[slot].data();
+        for (size_t channel = 0; channel < channels; channel++)
+        {
+            const uint8_t *entry = seek + channel * kSeekEntryBytes;
+            int32_t predictor = static_cast<int16_t>(entry[0] | (entry[1] << 8));
+            int32_t index = std::min<int32_t>(entry[2], kSteps.size() - 1);
+            for (size_t frame = 0; frame < kBlockFrames; frame++)
+            {
+                const size_t nibble = frame * channels + channel;
+                const uint32_t code = (codes[nibble >> 1] >> ((nibble & 1) * 4)) & 0x0F;
+
+                const int32_t step = kSteps[index];
+                int32_t difference = step >> 3;
+                if (code & 4)
+                {
+                    difference += step;
+                }
+                if (code & 2)
+                {
+                    difference += step >> 1;
+                }
+                if (code & 1)
+                {
+                    difference += step >> 2;
+                }
+                predictor = std::clamp<int32_t>((code & 8) ? predictor - difference : predictor + difference, INT16_MIN, INT16_MAX);
+                index = std::clamp<int32_t>(index + kIndexChanges[code & 7], 0, kSteps.size() - 1);
+
+                frames[nibble] = static_cast<int16_t>(predictor);
+            }
+        }
+        tags_[slot] = block;
+        return frames;
+    }
+
+    /**
+     * @brief IMA-ADPCM step sizes, by the step index (shared with AdpcmEncoder).
+     */
+    static constexpr std::array<int16_t, 89> kSteps = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+    /**
+     * @brief Step index change by the code magnitude.
+     */
+    static constexpr std::array<int8_t, 8> kIndexChanges = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+private:
+    static constexpr size_t kInvalidBlock = SIZE_MAX;
+
+    std::array<std::array<int16_t, kBlockFrames * 2>, kSlots> slots_;
+    std::array<size_t, kSlots> tags_;
+};
+
+}
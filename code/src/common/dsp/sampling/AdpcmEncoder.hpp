@@ -0,0 +1,166 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "AdpcmDecoder.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class AdpcmEncoder
+ * @ingroup dsp_sampling
+ * @brief Packs mono 16-bit samples into the AdpcmDecoder block layout at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * For the built-in voice prompts, which keep their plain PCM source in the code (it isn't linked, only
+ * the encoded array is) and shrink to about a quarter of the flash:
+ *
+ *     constexpr size_t hello_length = 4321;
+ *     constexpr int16_t hello_pcm[hello_length] = {...};
+ *     constexpr AdpcmEncoder::Encoded<hello_length> hello_data = AdpcmEncoder::Encode(hello_pcm);
+ *     constexpr SamplePlayer16bit::Sample hello = {
+ *         .data = hello_data.data(),
+ *         .length = AdpcmEncoder::PaddedLength(hello_length),
+ *         .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM,
+ *     };
+ *
+ * The encoder tracks the decoder state with exactly the decoder's arithmetic, so the seek table entries
+ * are the states the decoder reaches and the error doesn't build up over a block.
+ * The last block is padded with silence, the padded length is what the SamplePlayer plays.
+ * GCC counts about 170 constexpr operations per sample, prompts longer than about 190000 samples need
+ * a higher -fconstexpr-ops-limit (see the Calibration app).
+ */
+class AdpcmEncoder
+{
+public:
+    /**
+     * @brief Returns the sample length rounded up to whole blocks.
+     */
+    static constexpr size_t PaddedLength(size_t length)
+    {
+        return (length + AdpcmDecoder::kBlockFrames - 1) / AdpcmDecoder::kBlockFrames * AdpcmDecoder::kBlockFrames;
+    }
+
+    /**
+     * @brief Returns the bytes of the encoded mono sample (codes and seek table).
+     */
+    static constexpr size_t EncodedBytes(size_t length)
+    {
+        return PaddedLength(length) / AdpcmDecoder::kBlockFrames * (AdpcmDecoder::kCodeBytes + AdpcmDecoder::kSeekEntryBytes);
+    }
+
+    /**
+     * @brief The encoded mono sample of the length.
+     */
+    template <size_t N>
+    using Encoded = std::array<uint8_t, EncodedBytes(N)>;
+
+    /**
+     * @brief Encodes the mono sample, the codes of all blocks followed by the seek table.
+     * @param pcm Sample
+     */
+    template <size_t N>
+    static consteval Encoded<N> Encode(const int16_t (&pcm)[N])
+    {
+        constexpr size_t kBlocks = PaddedLength(N) / AdpcmDecoder::kBlockFrames;
+        constexpr size_t kTable = kBlocks * AdpcmDecoder::kCodeBytes;
+
+        Encoded<N> data{};
+        int32_t predictor = 0;
+        int32_t index = 0;
+        for (size_t block = 0; block < kBlocks; block++)
+        {
+            uint8_t *entry = data.data() + kTable + block * AdpcmDecoder::kSeekEntryBytes;
+            entry[0] = static_cast<uint8_t>(predictor & 0xFF);
+            entry[1] = static_cast<uint8_t>((predictor >> 8) & 0xFF);
+            entry[2] = static_cast<uint8_t>(index);
+
+            uint8_t *codes = data.data() + block * AdpcmDecoder::kCodeBytes;
+            for (size_t frame = 0; frame < AdpcmDecoder::kBlockFrames; frame++)
+            {
+                const size_t position = block * AdpcmDecoder::kBlockFrames + frame;
+                const int32_t sample = position < N ? pcm[position] : 0;
+                const uint32_t code = EncodeFrame(sample, predictor, index);
+                codes[frame >> 1] = static_cast<uint8_t>(codes[frame >> 1] | (code << ((frame & 1) * 4)));
+            }
+        }
+        return data;
+    }
+
+private:
+    /**
+     * @brief Picks the code of the sample and advances the state the same way AdpcmDecoder::Decode does.
+     */
+    static constexpr uint32_t EncodeFrame(int32_t sample, int32_t &predictor, int32_t &index)
+    {
+        const int32_t step = AdpcmDecoder::kSteps[index];
+        int32_t difference = sample - predictor;
+        uint32_t code = 0;
+        if (difference < 0)
+        {
+            code = 8;
+            difference = -difference;
+        }
+        if (difference >= step)
+        {
+            code |= 4;
+            difference -= step;
+        }
+        if (difference >= step >> 1)
+        {
+            code |= 2;
+            difference -= step >> 1;
+        }
+        if (difference >= step >> 2)
+        {
+            code |= 1;
+        }
+
+        int32_t delta = step >> 3;
+        if (code & 4)
+        {
+            delta += step;
+        }
+        if (code & 2)
+        {
+            delta += step >> 1;
+        }
+        if (code & 1)
+        {
+            delta += step >> 2;
+        }
+        predictor = std::clamp<int32_t>((code & 8) ? predictor - delta : predictor + delta, INT16_MIN, INT16_MAX);
+        index = std::clamp<int32_t>(index + AdpcmDecoder::kIndexChanges[code & 7], 0, AdpcmDecoder::kSteps.size() - 1);
+        return code;
+    }
+};
+
+}
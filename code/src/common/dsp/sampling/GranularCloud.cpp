@@ -0,0 +1,306 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "GranularCloud.hpp"
+#include <algorithm>
+#include <cmath>
+#include "common/core/MultiCore.hpp"
+#include "common/dsp/math/lookup_generators.hpp"
+
+using namespace kastle2;
+
+FASTDATA static const std::array<int16_t, GranularCloud::kWindowSize> hann_window =
+    lookup_tukey_window_table<int16_t, GranularCloud::kWindowSize>(1.0, 32767.0);
+FASTDATA static const std::array<int16_t, GranularCloud::kWindowSize> tukey_window =
+    lookup_tukey_window_table<int16_t, GranularCloud::kWindowSize>(0.5, 32767.0);
+
+void GranularCloud::Init(const size_t length)
+{
+    const size_t size = std::min(length, kMaxLength) + 1;
+    owned_buffer_ = std::make_unique<q15least_t[]>(size);
+    Init(std::span<q15least_t>(owned_buffer_.get(), size));
+}
+
+void GranularCloud::Init(std::span<q15least_t> buffer)
+{
+    buffer_ = buffer.data();
+    length_ = std::min(buffer.size() - 1, kMaxLength);
+    recording_ = true;
+    random_.Seed(1);
+    Reset();
+
+    SetGrainSize(length_ / 8);
+    SetDensity(20.0f);
+    SetPosition(0);
+    SetSpray(q15(0.1f));
+    SetPitch(1.0f);
+    SetStereoSpread(q15(0.5f));
+    SetWindow(Window::HANN);
+}
+
+void GranularCloud::Reset()
+{
+    std::fill_n(buffer_, length_ + 1, 0);
+    write_ = 0;
+    active_ = 0;
+    next_grain_ = 0;
+}
+
+void GranularCloud::SetRecording(const bool recording)
+{
+    recording_ = recording;
+}
+
+void GranularCloud::SetDensity(const float grains_per_second)
+{
+    interval_ = static_cast<uint32_t>(std::clamp(SAMPLE_RATE / std::max(grains_per_second, 0.1f), 1.0f, SAMPLE_RATE * 10.0f));
+    // Don't wait out a long interval of the previous density
+    next_grain_ = std::min(next_grain_, static_cast<int32_t>(interval_));
+    UpdateLevel();
+}
+
+void GranularCloud::SetGrainSize(const size_t samples)
+{
+    grain_size_ = std::clamp<uint32_t>(samples, kMinGrainSize, std::max<uint32_t>(length_ / 2, kMinGrainSize));
+    UpdateLevel();
+}
+
+void GranularCloud::SetPosition(const q15_t position)
+{
+    position_parameter_ = std::clamp(position, 0, Q15_MAX);
+}
+
+void GranularCloud::SetSpray(const q15_t spray)
+{
+    spray_ = std::clamp(spray, 0, Q15_MAX);
+}
+
+void GranularCloud::SetPitch(const float ratio)
+{
+    pitch_ = static_cast<uint32_t>(std::clamp(ratio, 0.25f, 4.0f) * 65536.0f);
+}
+
+void GranularCloud::SetStereoSpread(const q15_t spread)
+{
+    stereo_spread_ = std::clamp(spread, 0, Q15_MAX);
+}
+
+void GranularCloud::SetWindow(const Window window)
+{
+    window_type_ = window;
+}
+
+void GranularCloud::UpdateLevel()
+{
+    // Uncorrelated grains add up in power, so the level follows the square root of the overlap
+    const float overlap = static_cast<float>(grain_size_) / static_cast<float>(std::max<uint32_t>(interval_, 1));
+    level_ = float_to_q15(1.0f / std::sqrt(std::clamp(overlap, 1.0f, static_cast<float>(kMaxGrains))));
+}
+
+FASTCODE void GranularCloud::ProcessBlock(const q15_t *input, q15_t *output, size_t size)
+{
+    while (size > 0)
+    {
+        const size_t block = std::min(size, kMaxBlockSize);
+        Record(input, block);
+        Schedule(block);
+        std::fill_n(mix_[0].data(), 2 * block, 0);
+        std::fill_n(mix_[1].data(), 2 * block, 0);
+        RenderGrains(0, active_, mix_[0].data(), block);
+        Finish(output, block);
+        input += 2 * block;
+        output += 2 * block;
+        size -= block;
+    }
+}
+
+FASTCODE void GranularCloud::ProcessBlockParallel(const q15_t *input, q15_t *output, size_t size)
+{
+    while (size > 0)
+    {
+        const size_t block = std::min(size, kMaxBlockSize);
+        Record(input, block);
+        Schedule(block);
+        std::fill_n(mix_[0].data(), 2 * block, 0);
+        std::fill_n(mix_[1].data(), 2 * block, 0);
+        block_size_ = block;
+        MultiCore::ParallelFor(RenderGrainsJob, this, active_);
+        Finish(output, block);
+        input += 2 * block;
+        output += 2 * block;
+        size -= block;
+    }
+}
+
+FASTCODE void GranularCloud::RenderGrainsJob(void *context, const size_t from, const size_t to)
+{
+    GranularCloud *cloud = static_cast<GranularCloud *>(context);
+    // Only the first range starts at 0, so each core has its own mix
+    cloud->RenderGrains(from, to, cloud->mix_[from == 0 ? 0 : 1].data(), cloud->block_size_);
+}
+
+FASTCODE void GranularCloud::Record(const q15_t *input, const size_t size)
+{
+    if (!recording_)
+    {
+        return;
+    }
+    uint32_t write = write_;
+    for (size_t i = 0; i < size; i++)
+    {
+        buffer_[write] = static_cast<q15least_t>((input[2 * i] + input[2 * i + 1]) >> 1);
+        if (++write == length_)
+        {
+            write = 0;
+        }
+    }
+    // Copy of the first sample for the interpolation of the last one
+    buffer_[length_] = buffer_[0];
+    write_ = write;
+}
+
+FASTCODE void GranularCloud::Schedule(const size_t size)
+{
+    const int32_t block = static_cast<int32_t>(size);
+    while (next_grain_ < block)
+    {
+        StartGrain(static_cast<size_t>(std::max<int32_t>(next_grain_, 0)), size);
+        // A quarter of the interval of jitter, so the grains don't line up with the blocks
+        const int32_t jitter = static_cast<int32_t>((static_cast<int64_t>(random_.Process()) * (interval_ >> 2)) >> 15);
+        next_grain_ += std::max<int32_t>(static_cast<int32_t>(interval_) + jitter, 1);
+    }
+    next_grain_ -= block;
+}
+
+void GranularCloud::StartGrain(const size_t offset, const size_t size)
+{
+    if (active_ == kMaxGrains)
+    {
+        return;
+    }
+
+    // The playhead must neither overtake the recording nor fall behind it more than the buffer
+    const int32_t length = static_cast<int32_t>(grain_size_);
+    const int32_t speed_difference = static_cast<int32_t>(pitch_) - (1 << 16);
+    const int32_t drift = static_cast<int32_t>((static_cast<int64_t>(speed_difference) * length) >> 16);
+    const int32_t min_delay = std::max(drift, 0) + 2 + static_cast<int32_t>(kMaxBlockSize);
+    const int32_t max_delay = static_cast<int32_t>(length_) + std::min(drift, 0) - static_cast<int32_t>(kMaxBlockSize);
+    const q15_t spray = q15_mult(q15_abs(random_.Process()), spray_);
+    int32_t delay = q15_mult_fast(q15_add(position_parameter_, spray), static_cast<int32_t>(length_) - length);
+    delay = std::clamp(delay, min_delay, std::max(min_delay, max_delay));
+
+    // The block is already recorded, the grain starts offset samples after its start
+    int32_t start = static_cast<int32_t>(write_) - static_cast<int32_t>(size) + static_cast<int32_t>(offset) - delay;
+    while (start < 0)
+    {
+        start += length_;
+    }
+
+    const q15_t balance = q15_mult(random_.Process(), stereo_spread_);
+    const size_t grain = active_++;
+    position_[grain] = static_cast<uint32_t>(start) << 16;
+    increment_[grain] = pitch_;
+    window_phase_[grain] = 0;
+    window_increment_[grain] = UINT32_MAX / length;
+    remaining_[grain] = length;
+    wait_[grain] = offset;
+    gain_left_[grain] = q15_mult(level_, std::min(Q15_MAX, Q15_MAX - balance));
+    gain_right_[grain] = q15_mult(level_, std::min(Q15_MAX, Q15_MAX + balance));
+    window_[grain] = window_type_ == Window::TUKEY ? tukey_window.data() : hann_window.data();
+}
+
+FASTCODE void GranularCloud::RenderGrains(const size_t from, const size_t to, q15_t *mix, const size_t size)
+{
+    const q15least_t *buffer = buffer_;
+    const uint32_t limit = length_ << 16;
+
+    for (size_t grain = from; grain < to; grain++)
+    {
+        const uint32_t first = wait_[grain];
+        const uint32_t count = std::min<uint32_t>(size - first, remaining_[grain]);
+        uint32_t position = position_[grain];
+        const uint32_t increment = increment_[grain];
+        uint32_t window_phase = window_phase_[grain];
+        const uint32_t window_increment = window_increment_[grain];
+        const int16_t *window = window_[grain];
+        const q15_t gain_left = gain_left_[grain];
+        const q15_t gain_right = gain_right_[grain];
+        q15_t *out = mix + 2 * first;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            const uint32_t index = position >> 16;
+            const q15_t fraction = (position & 0xFFFF) >> 1;
+            const q15_t near = buffer[index];
+            const q15_t sample = near + q15_mult_fast(buffer[index + 1] - near, fraction);
+            const q15_t windowed = q15_mult_fast(sample, window[window_phase >> (32 - kWindowBits)]);
+            out[2 * i] += q15_mult_fast(windowed, gain_left);
+            out[2 * i + 1] += q15_mult_fast(windowed, gain_right);
+
+            window_phase += window_increment;
+            position += increment;
+            if (position >= limit)
+            {
+                position -= limit;
+            }
+        }
+
+        position_[grain] = position;
+        window_phase_[grain] = window_phase;
+        remaining_[grain] -= count;
+        wait_[grain] = 0;
+    }
+}
+
+FASTCODE void GranularCloud::Finish(q15_t *output, const size_t size)
+{
+    const q15_t *mix_0 = mix_[0].data();
+    const q15_t *mix_1 = mix_[1].data();
+    for (size_t i = 0; i < 2 * size; i++)
+    {
+        output[i] = q15_saturate(mix_0[i] + mix_1[i]);
+    }
+
+    // Keep the playing grains at the start
+    size_t grain = 0;
+    while (grain < active_)
+    {
+        if (remaining_[grain] > 0)
+        {
+            grain++;
+            continue;
+        }
+        const size_t last = --active_;
+        position_[grain] = position_[last];
+        increment_[grain] = increment_[last];
+        window_phase_[grain] = window_phase_[last];
+        window_increment_[grain] = window_increment_[last];
+        remaining_[grain] = remaining_[last];
+        wait_[grain] = wait_[last];
+        gain_left_[grain] = gain_left_[last];
+        gain_right_[grain] = gain_right_[last];
+        window_[grain] = window_[last];
+    }
+}
@@ -0,0 +1,252 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "common/config.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/synthesis/WhiteNoise.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class GranularCloud
+ * @ingroup dsp_sampling
+ * @brief Cloud of up to kMaxGrains grains played from a recording of the live input.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The input is recorded (summed to mono) into a ring buffer, unless the recording is frozen.
+ * Once per block the scheduler starts new grains at the set density, each with its own position in the buffer
+ * (plus a random spray), pitch and stereo balance. A grain is a 16.16 playhead read with linear interpolation
+ * and enveloped by a precomputed window table (Hann or Tukey).
+ *
+ * The grain state is kept as arrays of each field with the active grains at the start, so the render is
+ * one tight loop per grain over the block, with no per-sample checks of the grain end or the per-player
+ * overhead of SamplePlayer. ProcessBlockParallel() splits the active grains between both cores.
+ *
+ * @note The buffer is allocated on the heap by Init(length), or passed from the app arena (Kastle2::arena).
+ *       One extra sample keeps a copy of the first one for the interpolation, up to kMaxLength samples are used.
+ */
+class GranularCloud
+{
+public:
+    /**
+     * @brief Most grains playing at once, new grains are dropped when all of them play.
+     */
+    static constexpr size_t kMaxGrains = 24;
+
+    /**
+     * @brief Longest usable buffer (16.16 playheads).
+     */
+    static constexpr size_t kMaxLength = 0xFFFF;
+
+    /**
+     * @brief Longest block processed at once, longer blocks are split.
+     */
+    static constexpr size_t kMaxBlockSize = AUDIO_BUFFER_SIZE;
+
+    /**
+     * @brief Shortest grain in samples.
+     */
+    static constexpr size_t kMinGrainSize = 64;
+
+    /**
+     * @brief Entries of the window tables.
+     */
+    static constexpr size_t kWindowBits = 9;
+    static constexpr size_t kWindowSize = 1u << kWindowBits;
+
+    /**
+     * @brief Envelope of the grains.
+     */
+    enum class Window
+    {
+        HANN,  ///< Smooth, for dense clouds
+        TUKEY, ///< Flat top with short fades (a quarter of the grain each), for rhythmic grains
+        COUNT
+    };
+
+    /**
+     * @brief Initializes the cloud and allocates the buffer on the heap.
+     * @param length Recorded samples.
+     */
+    void Init(size_t length);
+
+    /**
+     * @brief Initializes the cloud over an existing buffer (eg. from Kastle2::arena).
+     * @param buffer The buffer, one sample longer than the recording. Must outlive the cloud.
+     */
+    void Init(std::span<q15least_t> buffer);
+
+    /**
+     * @brief Stops all the grains and clears the buffer.
+     */
+    void Reset();
+
+    /**
+     * @brief Records a block and renders the grains over it.
+     * @param input Interleaved stereo input
+     * @param output Interleaved stereo grains (can be the same as input)
+     * @param size Number of frames (left and right sample pairs) to process
+     */
+    FASTCODE void ProcessBlock(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Same as ProcessBlock(), the grains are split between both cores with MultiCore::ParallelFor().
+     * @note The second core must run MultiCore::JobWorker().
+     */
+    FASTCODE void ProcessBlockParallel(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Enables the recording, disabled freezes the buffer.
+     */
+    void SetRecording(bool recording);
+
+    /**
+     * @brief Sets how many grains start per second.
+     */
+    void SetDensity(float grains_per_second);
+
+    /**
+     * @brief Sets the length of the new grains.
+     * @param samples Length in samples, at least kMinGrainSize and at most a half of the buffer.
+     */
+    void SetGrainSize(size_t samples);
+
+    /**
+     * @brief Sets where in the buffer the new grains start.
+     * @param position 0 is the newest recording, Q15_MAX the oldest.
+     */
+    void SetPosition(q15_t position);
+
+    /**
+     * @brief Sets the random spread of the start positions.
+     * @param spray 0 for none, Q15_MAX for up to the whole buffer.
+     */
+    void SetSpray(q15_t spray);
+
+    /**
+     * @brief Sets the playback speed of the new grains.
+     * @param ratio 1.0 is the original pitch, within 0.25 to 4.
+     */
+    void SetPitch(float ratio);
+
+    /**
+     * @brief Sets the random stereo balance of the new grains.
+     * @param spread 0 is mono, Q15_MAX from fully left to fully right.
+     */
+    void SetStereoSpread(q15_t spread);
+
+    /**
+     * @brief Sets the envelope of the new grains.
+     */
+    void SetWindow(Window window);
+
+    /**
+     * @brief Returns the number of grains playing.
+     */
+    size_t GetActiveGrains() const
+    {
+        return active_;
+    }
+
+private:
+    /**
+     * @brief Records the block into the buffer.
+     */
+    FASTCODE void Record(const q15_t *input, size_t size);
+
+    /**
+     * @brief Starts the due grains of the block.
+     */
+    FASTCODE void Schedule(size_t size);
+
+    /**
+     * @brief Starts a grain at the offset into the block.
+     */
+    void StartGrain(size_t offset, size_t size);
+
+    /**
+     * @brief Renders the grains from (including) to (excluding), adding them to the mix.
+     */
+    FASTCODE void RenderGrains(size_t from, size_t to, q15_t *mix, size_t size);
+
+    /**
+     * @brief Sums the mixes to the output and removes the finished grains.
+     */
+    FASTCODE void Finish(q15_t *output, size_t size);
+
+    /**
+     * @brief MultiCore::ParallelFor() job over the grains, each core adds to its own mix.
+     */
+    FASTCODE static void RenderGrainsJob(void *context, size_t from, size_t to);
+
+    /**
+     * @brief Updates the grain level to the overlap of the grains.
+     */
+    void UpdateLevel();
+
+    std::unique_ptr<q15least_t[]> owned_buffer_;
+    q15least_t *buffer_ = nullptr;
+    uint32_t length_ = 0;
+    uint32_t write_ = 0;
+    bool recording_ = true;
+
+    // Grains, the first active_ are playing
+    std::array<uint32_t, kMaxGrains> position_;         ///< Playhead, 16.16
+    std::array<uint32_t, kMaxGrains> increment_;        ///< Playhead increment, 16.16
+    std::array<uint32_t, kMaxGrains> window_phase_;     ///< Position in the window, the whole 32 bits
+    std::array<uint32_t, kMaxGrains> window_increment_; ///< Window phase increment
+    std::array<uint32_t, kMaxGrains> remaining_;        ///< Samples until the end of the grain
+    std::array<uint32_t, kMaxGrains> wait_;             ///< Samples into the block before the grain starts
+    std::array<q15_t, kMaxGrains> gain_left_;
+    std::array<q15_t, kMaxGrains> gain_right_;
+    std::array<const int16_t *, kMaxGrains> window_;
+    size_t active_ = 0;
+
+    // Scheduler and the parameters of the new grains
+    WhiteNoise random_;
+    int32_t next_grain_ = 0;
+    uint32_t interval_ = 0;
+    uint32_t grain_size_ = 0;
+    uint32_t pitch_ = 1 << 16;
+    q15_t position_parameter_ = 0;
+    q15_t spray_ = 0;
+    q15_t stereo_spread_ = 0;
+    q15_t level_ = Q15_MAX;
+    Window window_type_ = Window::HANN;
+
+    size_t block_size_ = 0;
+    std::array<std::array<q15_t, kMaxBlockSize * 2>, 2> mix_;
+};
+}
@@ -24,11 +24,18 @@ SOFTWARE.
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 #include "common/dsp/math/math_utils.hpp"
+#include "common/core/XipStream.hpp"
 #include "common/fastcode.hpp"
+#include "AdpcmDecoder.hpp"
+#include "lookup_sample_companding.hpp"
+#include "lookup_sample_hermite.hpp"
 
 namespace kastle2
 {
@@ -39,6 +46,10 @@ namespace kastle2
  * @brief Simple helper class for playing samples from an allocated memory. You can use ready made aliases `SamplePlayer16bit` and `SamplePlayer32bit`.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-06-06
+ *
+ * The 16-bit player also decodes packed 12-bit and G.711 companded (µ-law, A-law) samples on read,
+ * the encoding is resolved once per block like the channel count. IMA-ADPCM samples are decoded a whole
+ * block at a time into an AdpcmDecoder ring, see SetAdpcmDecoder().
  */
 template <typename T>
 class SamplePlayer
@@ -53,16 +64,96 @@ public:
         STEREO = 2 ///< Interleaved stereo
     };
 
+    /**
+     * @brief Interpolation used in the hi-fi mode, selected at compile time in ProcessBlock().
+     */
+    enum class Interpolation
+    {
+        NONE,   ///< Nearest lower frame (the lo-fi mode)
+        LINEAR, ///< 2-point linear
+        HERMITE ///< 4-point Hermite (Catmull-Rom), much less imaging when pitched down, roughly twice the cost of linear
+    };
+
+    /**
+     * @brief How the sample data is stored. Everything but PCM is decoded to 16 bits, so only by the 16-bit player.
+     */
+    enum class Encoding
+    {
+        PCM,    ///< Samples of the type T
+        PCM12,  ///< 12-bit, two samples in 3 bytes: low 8 bits of the first, both high nibbles (first in the low one), low 8 bits of the second
+        MU_LAW,   ///< 8-bit G.711 µ-law
+        A_LAW,    ///< 8-bit G.711 A-law
+        IMA_ADPCM ///< 4-bit IMA-ADPCM blocks with a seek table (AdpcmDecoder), the length is whole blocks
+    };
+
+    /**
+     * @brief Frames of one step of the slice table, a sample has one slice point per step.
+     */
+    static constexpr size_t kSliceFrames = 256;
+
+    /**
+     * @brief Entry of the slice table for a step without a slice point.
+     */
+    static constexpr uint8_t kNoSlice = 0xFF;
+
     /**
      * @brief Simple wrapper for the audio sample
      */
     struct Sample
     {
-        const T *data = nullptr;  ///< Pointer to the sample data
-        size_t length = 0;        ///< Actual samples per channel (not bytes)
-        Channels channels = MONO; ///< Number of channels
+        const void *data = nullptr;        ///< Pointer to the sample data
+        size_t length = 0;                 ///< Actual samples per channel (not bytes)
+        Channels channels = MONO;          ///< Number of channels
+        Encoding encoding = Encoding::PCM; ///< How the data is stored
+        const uint8_t *slices = nullptr;   ///< Slice table, nullptr to start anywhere (see SnapToSlice())
+        const uint8_t *warm = nullptr;     ///< SRAM copy of the first warm_bytes of the data, read instead of it
+        size_t warm_bytes = 0;             ///< Size of the warm copy, 0 without one
     };
 
+    /**
+     * @brief Returns the number of bytes storing the first samples (whole 3-byte pairs for PCM12, whole blocks for IMA_ADPCM)
+     * @param samples Number of samples (frames times channels)
+     * @param encoding Sample encoding
+     */
+    static constexpr size_t EncodedBytes(size_t samples, Encoding encoding)
+    {
+        switch (encoding)
+        {
+        case Encoding::PCM12:
+            return ((samples + 1) >> 1) * 3;
+        case Encoding::MU_LAW:
+        case Encoding::A_LAW:
+            return samples;
+        case Encoding::IMA_ADPCM:
+            // Half a byte of code and the seek table entry spread over the block
+            return samples / AdpcmDecoder::kBlockFrames * (AdpcmDecoder::kCodeBytes + AdpcmDecoder::kSeekEntryBytes);
+        default:
+            return samples * sizeof(T);
+        }
+    }
+
+    /**
+     * @brief Returns the number of frames stored in the bytes
+     * @param bytes Size of the sample data in bytes
+     * @param channels Number of channels
+     * @param encoding Sample encoding
+     */
+    static constexpr size_t FramesInBytes(size_t bytes, Channels channels, Encoding encoding)
+    {
+        switch (encoding)
+        {
+        case Encoding::PCM12:
+            return (bytes / 3) * 2 / channels;
+        case Encoding::MU_LAW:
+        case Encoding::A_LAW:
+            return bytes / channels;
+        case Encoding::IMA_ADPCM:
+            return bytes / ((AdpcmDecoder::kCodeBytes + AdpcmDecoder::kSeekEntryBytes) * channels) * AdpcmDecoder::kBlockFrames;
+        default:
+            return bytes / sizeof(T) / channels;
+        }
+    }
+
     /**
      * @brief Initializes the SamplePlayer with the sample rate. Expects samples to have the same rate as the system.
      * @param sample_rate The sample rate of the samples and system
@@ -100,67 +191,68 @@ public:
         {
             return 0;
         }
+        if (start_delay_ > 0)
+        {
+            start_delay_--;
+            output_left_ = 0;
+            output_right_ = 0;
+            return 0;
+        }
 
-        if (!hifi_)
+        if (sample_.channels == MONO)
         {
-            if (sample_.channels == MONO)
-            {
-                output_left_ = sample_.data[static_cast<size_t>(index_)];
-                output_right_ = output_left_;
-            }
-            else if (sample_.channels == STEREO)
-            {
-                output_left_ = sample_.data[static_cast<size_t>(index_) * 2];
-                output_right_ = sample_.data[static_cast<size_t>(index_) * 2 + 1];
-            }
+            Interpolates() ? ReadDecodedFrame<MONO, Interpolation::LINEAR>(output_left_, output_right_) : ReadDecodedFrame<MONO, Interpolation::NONE>(output_left_, output_right_);
         }
         else
         {
-            if (sample_.channels == MONO)
+            Interpolates() ? ReadDecodedFrame<STEREO, Interpolation::LINEAR>(output_left_, output_right_) : ReadDecodedFrame<STEREO, Interpolation::NONE>(output_left_, output_right_);
+        }
+        Advance();
+
+        return output_left_;
+    }
+
+    /**
+     * @brief Renders a block of frames, the channel count and the interpolation are resolved once per block.
+     * @tparam kInterpolation Interpolation used when the hi-fi mode is enabled
+     * @param output Interleaved stereo output for size frames (mono samples go to both channels). Zeros after the playback ends.
+     * @param size Number of frames to render
+     */
+    template <Interpolation kInterpolation = Interpolation::LINEAR>
+    FASTCODE void ProcessBlock(T *output, size_t size)
+    {
+        size_t rendered = 0;
+        if (playing_ && sample_.data != nullptr && sample_.length != 0)
+        {
+            // Silence until the delayed start
+            const size_t delay = start_delay_ < size ? start_delay_ : size;
+            start_delay_ -= delay;
+            for (size_t i = 0; i < delay; i++)
             {
-                float index_floor = floor(index_);
-                float index_ceil = ceil(index_);
-                index_floor = constrain(index_floor, 0, sample_.length - 1);
-                index_ceil = constrain(index_ceil, 0, sample_.length - 1);
-                // Linear interpolation
-                output_left_ = (1.0f - (index_ - index_floor)) * sample_.data[(size_t)index_floor] +
-                               (index_ - index_floor) * sample_.data[(size_t)index_ceil];
-                output_right_ = output_left_;
+                output[2 * i] = 0;
+                output[2 * i + 1] = 0;
             }
-            else if (sample_.channels == STEREO)
+
+            if (stream_ != nullptr)
             {
-                float index_floor = floor(index_);
-                float index_ceil = ceil(index_);
-                index_floor = constrain(index_floor, 0, sample_.length - 1);
-                index_ceil = constrain(index_ceil, 0, sample_.length - 1);
-                // Linear interpolation
-                output_left_ = (1.0f - (index_ - index_floor)) * sample_.data[(size_t)index_floor * 2] +
-                               (index_ - index_floor) * sample_.data[(size_t)index_ceil * 2];
-                output_right_ = (1.0f - (index_ - index_floor)) * sample_.data[(size_t)index_floor * 2 + 1] +
-                                (index_ - index_floor) * sample_.data[(size_t)index_ceil * 2 + 1];
+                stream_->Prefetch(StreamOffset(static_cast<size_t>(position_ >> 32)), reverse_);
             }
-        }
-
-        if (reverse_)
-        {
-            index_ -= index_increment_;
-            if (index_ <= 0)
+            T *start = output + 2 * delay;
+            if (sample_.channels == MONO)
             {
-                index_ = 0;
-                playing_ = false;
+                rendered = Interpolates() ? RenderDecodedBlock<MONO, kInterpolation>(start, size - delay) : RenderDecodedBlock<MONO, Interpolation::NONE>(start, size - delay);
             }
-        }
-        else
-        {
-            index_ += index_increment_;
-            if (index_ >= sample_.length)
+            else
             {
-                index_ = sample_.length;
-                playing_ = false;
+                rendered = Interpolates() ? RenderDecodedBlock<STEREO, kInterpolation>(start, size - delay) : RenderDecodedBlock<STEREO, Interpolation::NONE>(start, size - delay);
             }
+            rendered += delay;
+        }
+        for (size_t i = rendered; i < size; i++)
+        {
+            output[2 * i] = 0;
+            output[2 * i + 1] = 0;
         }
-
-        return output_left_;
     }
 
     /**
@@ -188,7 +280,37 @@ public:
     void SetSample(Sample sample)
     {
         sample_ = sample;
-        index_ = 0.0f;
+        if constexpr (!kDecodes)
+        {
+            sample_.encoding = Encoding::PCM;
+        }
+        position_ = 0;
+        if (stream_ != nullptr)
+        {
+            stream_->SetSource(sample_.data, EncodedBytes(sample_.length * sample_.channels, sample_.encoding));
+        }
+        if (adpcm_ != nullptr)
+        {
+            adpcm_->Reset();
+        }
+    }
+
+    /**
+     * @brief Reads the sample through a streaming cache, prefetched in ProcessBlock(). Set before SetSample().
+     * @param stream Initialized stream owned by the caller, nullptr reads the sample directly.
+     */
+    void SetStream(XipStream *stream)
+    {
+        stream_ = stream;
+    }
+
+    /**
+     * @brief Sets the ring the IMA-ADPCM blocks are decoded into. Without it, IMA-ADPCM samples play silence.
+     * @param decoder Decoder owned by the caller, one per player.
+     */
+    void SetAdpcmDecoder(AdpcmDecoder *decoder)
+    {
+        adpcm_ = decoder;
     }
 
     /**
@@ -198,8 +320,14 @@ public:
     void SetSpeed(float speed)
     {
         speed_ = speed;
-        // Calculate the index increment based on the speed and rates
-        index_increment_ = speed_ * samples_rate_ / playback_rate_;
+        // Calculate the playhead increment based on the speed and rates
+        const float increment = std::max(0.0f, speed_ * samples_rate_ / playback_rate_);
+        increment_ = static_cast<uint64_t>(increment * kOne);
+        // Within the float rounding of the original pitch at the playback rate, the sample plays frame by frame
+        if (increment_ - (kUnityStep - kUnitySnap) <= 2 * kUnitySnap)
+        {
+            increment_ = kUnityStep;
+        }
     }
 
     /**
@@ -226,8 +354,9 @@ public:
      */
     void SetStart(size_t start_point)
     {
-        start_point_normal_ = constrain(start_point, 0, sample_.length);
-        start_point_reverse_ = sample_.length - start_point_normal_;
+        start_point = constrain(start_point, 0, sample_.length);
+        start_point_normal_ = SnapToSlice(start_point);
+        start_point_reverse_ = SnapToSlice(sample_.length - start_point);
     }
 
     /**
@@ -237,8 +366,39 @@ public:
     void SetStartSpeedAdjusted(size_t start_point)
     {
         size_t start_point_adjusted = (float)start_point * speed_;
-        start_point_normal_ = constrain(start_point_adjusted, 0, sample_.length);
-        start_point_reverse_ = sample_.length - start_point_normal_;
+        start_point_adjusted = constrain(start_point_adjusted, 0, sample_.length);
+        start_point_normal_ = SnapToSlice(start_point_adjusted);
+        start_point_reverse_ = SnapToSlice(sample_.length - start_point_adjusted);
+    }
+
+    /**
+     * @brief Returns the slice point at or before the frame, or the frame when the sample has no slice table.
+     * @details The table has one byte per kSliceFrames frames: the offset of the step's slice point (eg. its first
+     *          zero crossing) from the step start, or kNoSlice. The point is in the frame's step or in the one before.
+     * @param frame Frame within the sample
+     */
+    size_t SnapToSlice(size_t frame) const
+    {
+        if (sample_.slices == nullptr || frame >= sample_.length)
+        {
+            return frame;
+        }
+        // The point of the frame's step when it's not after the frame, otherwise the one of the step before
+        size_t step = frame / kSliceFrames;
+        for (size_t i = 0; i < 2; i++)
+        {
+            const uint8_t offset = sample_.slices[step];
+            if (offset != kNoSlice && step * kSliceFrames + offset <= frame)
+            {
+                return step * kSliceFrames + offset;
+            }
+            if (step == 0)
+            {
+                break;
+            }
+            step--;
+        }
+        return frame;
     }
 
     /**
@@ -266,13 +426,14 @@ public:
     {
         if (reverse_)
         {
-            index_ = sample_.length;
+            position_ = ToPosition(sample_.length);
         }
         else
         {
-            index_ = 0.0f;
+            position_ = 0;
         }
         playing_ = false;
+        start_delay_ = 0;
     }
 
     /**
@@ -282,15 +443,25 @@ public:
     {
         if (reverse_)
         {
-            index_ = start_point_reverse_;
+            position_ = ToPosition(start_point_reverse_);
         }
         else
         {
-            index_ = start_point_normal_;
+            position_ = ToPosition(start_point_normal_);
         }
         playing_ = true;
     }
 
+    /**
+     * @brief Delays the playback by a number of frames of silence, eg. to start at an exact frame inside the next block.
+     * @details The delay runs only while playing and Play() doesn't reset it, so it can be set just before Play().
+     * @param frames Number of frames
+     */
+    void SetStartDelay(size_t frames)
+    {
+        start_delay_ = frames;
+    }
+
     /**
      * @brief Returns whether the sample player is currently playing.
      * @return True if playing, false if stopped.
@@ -301,9 +472,9 @@ public:
     }
 
     /**
-     * @brief Enables the hi-fi mode (linear interpolation of samples). Off by default.
-     * @param hifi True enables linear interpolation using floats.
-     * @note Takes a lot more CPU, so use with care!
+     * @brief Enables the hi-fi mode (interpolation of samples). Off by default.
+     * @details Process() interpolates linearly, ProcessBlock() uses its Interpolation template parameter.
+     * @param hifi True enables the interpolation.
      */
     void SetHifi(bool hifi)
     {
@@ -311,14 +482,398 @@ public:
     }
 
 private:
+    // The playhead is 32.32 fixed point in sample frames, the samples can be longer than 16 bits of frames
+    static constexpr float kOne = 4294967296.0f;
+
+    // One frame per output frame, and the distance snapped to it (2^-20, a fraction of a cent)
+    static constexpr uint64_t kUnityStep = 1ull << 32;
+    static constexpr uint64_t kUnitySnap = 1ull << 12;
+
+    // The decoded encodings are 16-bit
+    static constexpr bool kDecodes = std::is_same_v<T, int16_t>;
+
+    // Most frames read at once (Hermite), decoded into a local buffer
+    static constexpr size_t kMaxReadFrames = 4;
+
+    static constexpr uint64_t ToPosition(size_t frame)
+    {
+        return static_cast<uint64_t>(frame) << 32;
+    }
+
+    /**
+     * @brief True when the hi-fi mode interpolates, the playhead on whole frames at the unity step reads them as they are.
+     */
+    inline bool Interpolates() const
+    {
+        return hifi_ && (increment_ != kUnityStep || static_cast<uint32_t>(position_) != 0);
+    }
+
+    /**
+     * @brief Linear interpolation, weight is Q15.
+     */
+    static inline T Interpolate(T a, T b, int32_t weight)
+    {
+        if constexpr (sizeof(T) <= 2)
+        {
+            return a + (((static_cast<int32_t>(b) - a) * weight) >> 15);
+        }
+        else
+        {
+            return a + static_cast<T>(((static_cast<int64_t>(b) - a) * weight) >> 15);
+        }
+    }
+
+    /**
+     * @brief 4-point Hermite interpolation, the coefficients are a Q15 row of lookup_sample_hermite.
+     */
+    static inline T Hermite(T a, T b, T c, T d, const int16_t *coefficients)
+    {
+        using Accumulator = std::conditional_t<sizeof(T) <= 2, int32_t, int64_t>;
+        constexpr Accumulator kMin = std::numeric_limits<T>::min();
+        constexpr Accumulator kMax = std::numeric_limits<T>::max();
+        const Accumulator sum = static_cast<Accumulator>(coefficients[0]) * a +
+                                static_cast<Accumulator>(coefficients[1]) * b +
+                                static_cast<Accumulator>(coefficients[2]) * c +
+                                static_cast<Accumulator>(coefficients[3]) * d;
+        // Catmull-Rom overshoots, the result has to be saturated
+        return static_cast<T>(std::clamp<Accumulator>((sum + (1 << 14)) >> 15, kMin, kMax));
+    }
+
+    /**
+     * @brief Returns the bytes offset to offset + bytes - 1 of the data, from the warm copy or the stream when they are cached.
+     */
+    inline const uint8_t *LocateBytes(size_t offset, size_t bytes) const
+    {
+        // The sample start from the warm copy, so the first block after a trigger doesn't wait for the flash
+        if (offset + bytes <= sample_.warm_bytes)
+        {
+            return sample_.warm + offset;
+        }
+        if (stream_ != nullptr)
+        {
+            const uint8_t *cached = stream_->Find(offset, bytes);
+            if (cached != nullptr)
+            {
+                return cached;
+            }
+        }
+        return static_cast<const uint8_t *>(sample_.data) + offset;
+    }
+
+    /**
+     * @brief Returns the byte offset of the frame, for IMA-ADPCM the offset of its codes.
+     */
+    inline size_t StreamOffset(size_t frame) const
+    {
+        if (sample_.encoding == Encoding::IMA_ADPCM)
+        {
+            return (frame * sample_.channels) >> 1;
+        }
+        return EncodedBytes(frame * sample_.channels, sample_.encoding);
+    }
+
+    /**
+     * @brief Returns the decoded frames of the IMA-ADPCM block, decodes the block when it isn't in the ring.
+     */
+    template <Channels kChannels>
+    inline const T *AdpcmBlock(size_t block) const
+    {
+        const int16_t *frames = adpcm_->Find(block);
+        if (frames == nullptr)
+        {
+            // The codes of all the blocks come first, then the seek table
+            const size_t code_bytes = AdpcmDecoder::kCodeBytes * kChannels;
+            const size_t seek_bytes = AdpcmDecoder::kSeekEntryBytes * kChannels;
+            const size_t table = (sample_.length >> AdpcmDecoder::kBlockShift) * code_bytes;
+            frames = adpcm_->Decode(block, LocateBytes(table + block * seek_bytes, seek_bytes), LocateBytes(block * code_bytes, code_bytes), kChannels);
+        }
+        return frames;
+    }
+
+    /**
+     * @brief Returns the first of count consecutive frames, from the stream when they are cached.
+     */
+    template <Channels kChannels>
+    inline const T *Locate(size_t first, size_t count) const
+    {
+        return reinterpret_cast<const T *>(LocateBytes(first * kChannels * sizeof(T), count * kChannels * sizeof(T)));
+    }
+
+    /**
+     * @brief Decodes one sample, index is relative to the bytes (even for PCM12, the bytes start with a pair)
+     */
+    template <Encoding kEncoding>
+    static inline T DecodeSample(const uint8_t *bytes, size_t index)
+    {
+        if constexpr (kEncoding == Encoding::PCM12)
+        {
+            const uint8_t *pair = bytes + (index >> 1) * 3;
+            const uint32_t value = (index & 1) ? (pair[1] >> 4) | (pair[2] << 4) : pair[0] | ((pair[1] & 0x0F) << 8);
+            return static_cast<T>(static_cast<int16_t>(value << 4));
+        }
+        else if constexpr (kEncoding == Encoding::MU_LAW)
+        {
+            return lookup_sample_mu_law[bytes[index]];
+        }
+        else
+        {
+            return lookup_sample_a_law[bytes[index]];
+        }
+    }
+
+    /**
+     * @brief Decodes count consecutive frames from the first one into the frames buffer.
+     */
+    template <Channels kChannels, Encoding kEncoding>
+    inline void Decode(size_t first, size_t count, T *frames) const
+    {
+        if constexpr (kEncoding == Encoding::IMA_ADPCM)
+        {
+            constexpr size_t kMask = AdpcmDecoder::kBlockFrames - 1;
+            const T *block = AdpcmBlock<kChannels>(first >> AdpcmDecoder::kBlockShift);
+            for (size_t frame = first; frame < first + count; frame++)
+            {
+                // The interpolation can reach into the next block
+                if (frame != first && (frame & kMask) == 0)
+                {
+                    block = AdpcmBlock<kChannels>(frame >> AdpcmDecoder::kBlockShift);
+                }
+                for (size_t channel = 0; channel < kChannels; channel++)
+                {
+                    frames[(frame - first) * kChannels + channel] = block[(frame & kMask) * kChannels + channel];
+                }
+            }
+        }
+        else
+        {
+            const size_t begin = first * kChannels;
+            const size_t end = (first + count) * kChannels;
+            // PCM12 is read by whole pairs
+            const size_t aligned = kEncoding == Encoding::PCM12 ? begin & ~size_t{1} : begin;
+            const size_t offset = EncodedBytes(aligned, kEncoding);
+            const uint8_t *bytes = LocateBytes(offset, EncodedBytes(end, kEncoding) - offset);
+            for (size_t i = begin; i < end; i++)
+            {
+                frames[i - begin] = DecodeSample<kEncoding>(bytes, i - aligned);
+            }
+        }
+    }
+
+    /**
+     * @brief Reads the frame under the playhead, the encoding is resolved here.
+     */
+    template <Channels kChannels, Interpolation kInterpolation>
+    inline void ReadDecodedFrame(T &left, T &right) const
+    {
+        if constexpr (kDecodes)
+        {
+            switch (sample_.encoding)
+            {
+            case Encoding::PCM12:
+                ReadEncodedFrame<kChannels, kInterpolation, Encoding::PCM12>(left, right);
+                return;
+            case Encoding::MU_LAW:
+                ReadEncodedFrame<kChannels, kInterpolation, Encoding::MU_LAW>(left, right);
+                return;
+            case Encoding::A_LAW:
+                ReadEncodedFrame<kChannels, kInterpolation, Encoding::A_LAW>(left, right);
+                return;
+            case Encoding::IMA_ADPCM:
+                if (adpcm_ == nullptr)
+                {
+                    left = 0;
+                    right = 0;
+                    return;
+                }
+                ReadEncodedFrame<kChannels, kInterpolation, Encoding::IMA_ADPCM>(left, right);
+                return;
+            default:
+                break;
+            }
+        }
+        ReadFrame<kChannels, kInterpolation, Encoding::PCM>(left, right);
+    }
+
+    /**
+     * @brief ReadFrame() of an encoded sample, out of line in the flash (see RenderEncodedBlock()).
+     */
+    template <Channels kChannels, Interpolation kInterpolation, Encoding kEncoding>
+    FLASHCODE void ReadEncodedFrame(T &left, T &right) const
+    {
+        ReadFrame<kChannels, kInterpolation, kEncoding>(left, right);
+    }
+
+    /**
+     * @brief Reads the frame under the playhead (clamped to the last frame).
+     */
+    template <Channels kChannels, Interpolation kInterpolation, Encoding kEncoding>
+    inline void ReadFrame(T &left, T &right) const
+    {
+        const size_t last = sample_.length - 1;
+        size_t index = static_cast<size_t>(position_ >> 32);
+        if (index > last)
+        {
+            index = last;
+        }
+
+        // Frames around the index read by the interpolation, clamped to the sample
+        size_t first = index;
+        size_t count = 1;
+        if constexpr (kInterpolation == Interpolation::HERMITE)
+        {
+            first = index > 0 ? index - 1 : index;
+            count = std::min(index + 2, last) - first + 1;
+        }
+        else if constexpr (kInterpolation == Interpolation::LINEAR)
+        {
+            count = index < last ? 2 : 1;
+        }
+        const T *frame;
+        T decoded[kMaxReadFrames * kChannels];
+        if constexpr (kEncoding == Encoding::PCM)
+        {
+            frame = Locate<kChannels>(first, count) + (index - first) * kChannels;
+        }
+        else
+        {
+            Decode<kChannels, kEncoding>(first, count, decoded);
+            frame = decoded + (index - first) * kChannels;
+        }
+
+        if constexpr (kInterpolation == Interpolation::HERMITE)
+        {
+            // Neighbours are clamped to the sample, the edges repeat the first or the last frame
+            const T *previous = index > 0 ? frame - kChannels : frame;
+            const T *next = index < last ? frame + kChannels : frame;
+            const T *after = index + 1 < last ? frame + 2 * kChannels : next;
+            const int16_t *coefficients = &lookup_sample_hermite[(static_cast<uint32_t>(position_) >> SAMPLE_HERMITE_TABLE_SHIFT) * 4];
+            left = Hermite(previous[0], frame[0], next[0], after[0], coefficients);
+            if constexpr (kChannels == STEREO)
+            {
+                right = Hermite(previous[1], frame[1], next[1], after[1], coefficients);
+            }
+            else
+            {
+                right = left;
+            }
+        }
+        else if constexpr (kInterpolation == Interpolation::LINEAR)
+        {
+            const size_t next = index < last ? kChannels : 0;
+            const int32_t weight = static_cast<uint32_t>(position_) >> 17;
+            left = Interpolate(frame[0], frame[next], weight);
+            if constexpr (kChannels == STEREO)
+            {
+                right = Interpolate(frame[1], frame[next + 1], weight);
+            }
+            else
+            {
+                right = left;
+            }
+        }
+        else
+        {
+            left = frame[0];
+            right = kChannels == STEREO ? frame[1] : left;
+        }
+    }
+
+    /**
+     * @brief Moves the playhead, stops at the start or the end of the sample.
+     */
+    inline void Advance()
+    {
+        if (reverse_)
+        {
+            if (position_ <= increment_)
+            {
+                position_ = 0;
+                playing_ = false;
+            }
+            else
+            {
+                position_ -= increment_;
+            }
+        }
+        else
+        {
+            position_ += increment_;
+            if (position_ >= ToPosition(sample_.length))
+            {
+                position_ = ToPosition(sample_.length);
+                playing_ = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Renders the block with the encoding of the sample.
+     * @return Number of rendered frames
+     */
+    template <Channels kChannels, Interpolation kInterpolation>
+    size_t RenderDecodedBlock(T *output, size_t size)
+    {
+        if constexpr (kDecodes)
+        {
+            switch (sample_.encoding)
+            {
+            case Encoding::PCM12:
+                return RenderEncodedBlock<kChannels, kInterpolation, Encoding::PCM12>(output, size);
+            case Encoding::MU_LAW:
+                return RenderEncodedBlock<kChannels, kInterpolation, Encoding::MU_LAW>(output, size);
+            case Encoding::A_LAW:
+                return RenderEncodedBlock<kChannels, kInterpolation, Encoding::A_LAW>(output, size);
+            case Encoding::IMA_ADPCM:
+                return adpcm_ != nullptr ? RenderEncodedBlock<kChannels, kInterpolation, Encoding::IMA_ADPCM>(output, size) : 0;
+            default:
+                break;
+            }
+        }
+        return RenderBlock<kChannels, kInterpolation, Encoding::PCM>(output, size);
+    }
+
+    /**
+     * @brief RenderBlock() of an encoded sample, out of line in the flash.
+     * @details Only 16-bit PCM is inlined into the FASTCODE Process() and ProcessBlock(). Every encoding, channel count
+     *          and interpolation there would add several kB to the 16 kB FASTCODE region. The encoded samples are
+     *          the rarer ones (speech prompts, re-encoded banks), they run from the flash instead.
+     */
+    template <Channels kChannels, Interpolation kInterpolation, Encoding kEncoding>
+    FLASHCODE size_t RenderEncodedBlock(T *output, size_t size)
+    {
+        return RenderBlock<kChannels, kInterpolation, kEncoding>(output, size);
+    }
+
+    /**
+     * @brief Renders the frames until the block or the playback ends.
+     * @return Number of rendered frames
+     */
+    template <Channels kChannels, Interpolation kInterpolation, Encoding kEncoding>
+    size_t RenderBlock(T *output, size_t size)
+    {
+        size_t i = 0;
+        while (i < size && playing_)
+        {
+            ReadFrame<kChannels, kInterpolation, kEncoding>(output_left_, output_right_);
+            output[2 * i] = output_left_;
+            output[2 * i + 1] = output_right_;
+            Advance();
+            i++;
+        }
+        return i;
+    }
+
     float samples_rate_ = 0.0f;
     float playback_rate_ = 0.0f;
     Sample sample_;
+    XipStream *stream_ = nullptr;
+    AdpcmDecoder *adpcm_ = nullptr;
     float speed_ = 1.f;
     size_t start_point_normal_ = 0;
     size_t start_point_reverse_ = 0;
-    float index_increment_ = 0.0f;
-    float index_ = 0.0f;
+    uint64_t increment_ = 0;
+    uint64_t position_ = 0;
+    size_t start_delay_ = 0;
     bool playing_ = false;
     bool hifi_ = false;
     bool reverse_ = false;
@@ -0,0 +1,77 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kastle2
+{
+
+/**
+ * @file lookup_sample_companding.hpp
+ * @ingroup dsp_sampling
+ * @brief G.711 µ-law and A-law decoding tables for the SamplePlayer, generated at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * One 16-bit linear sample per code, the same values as the G.711 reference decoder (µ-law peaks at ±32124, A-law at ±32256).
+ */
+
+inline constexpr std::array<int16_t, 256> lookup_sample_mu_law = []
+{
+    std::array<int16_t, 256> table{};
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        const int32_t code = ~static_cast<int32_t>(i) & 0xFF;
+        const int32_t magnitude = (((code & 0x0F) << 3) + 0x84) << ((code & 0x70) >> 4);
+        table[i] = static_cast<int16_t>((code & 0x80) ? 0x84 - magnitude : magnitude - 0x84);
+    }
+    return table;
+}();
+
+inline constexpr std::array<int16_t, 256> lookup_sample_a_law = []
+{
+    std::array<int16_t, 256> table{};
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        const int32_t code = static_cast<int32_t>(i) ^ 0x55;
+        const int32_t segment = (code & 0x70) >> 4;
+        int32_t magnitude = (code & 0x0F) << 4;
+        if (segment == 0)
+        {
+            magnitude += 8;
+        }
+        else
+        {
+            magnitude = (magnitude + 0x108) << (segment - 1);
+        }
+        table[i] = static_cast<int16_t>((code & 0x80) ? magnitude : -magnitude);
+    }
+    return table;
+}();
+
+}
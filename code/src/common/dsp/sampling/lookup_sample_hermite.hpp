@@ -0,0 +1,73 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace kastle2
+{
+
+/**
+ * @file lookup_sample_hermite.hpp
+ * @ingroup dsp_sampling
+ * @brief 4-point Hermite (Catmull-Rom) interpolation coefficients for the SamplePlayer, generated at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * One row of 4 Q15 coefficients per fractional position, for the frames at -1, 0, +1 and +2.
+ * The coefficient of the frame 0 is 1.0 at the fraction 0, it's saturated to Q15 max (1 LSB of gain error).
+ */
+
+#define SAMPLE_HERMITE_TABLE_BITS 8
+#define SAMPLE_HERMITE_TABLE_SIZE (1 << SAMPLE_HERMITE_TABLE_BITS)
+#define SAMPLE_HERMITE_TABLE_SHIFT (32 - SAMPLE_HERMITE_TABLE_BITS) // 32 bits of fraction to the row index
+
+inline constexpr std::array<int16_t, SAMPLE_HERMITE_TABLE_SIZE * 4> lookup_sample_hermite = []
+{
+    std::array<int16_t, SAMPLE_HERMITE_TABLE_SIZE * 4> table{};
+    for (size_t i = 0; i < SAMPLE_HERMITE_TABLE_SIZE; i++)
+    {
+        const double t = static_cast<double>(i) / SAMPLE_HERMITE_TABLE_SIZE;
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+        const double coefficients[4] = {
+            -0.5 * t3 + t2 - 0.5 * t,
+            1.5 * t3 - 2.5 * t2 + 1.0,
+            -1.5 * t3 + 2.0 * t2 + 0.5 * t,
+            0.5 * t3 - 0.5 * t2,
+        };
+        for (size_t c = 0; c < 4; c++)
+        {
+            const double scaled = coefficients[c] * 32768.0;
+            const double rounded = scaled < 0.0 ? scaled - 0.5 : scaled + 0.5;
+            table[i * 4 + c] = static_cast<int16_t>(rounded > 32767.0 ? 32767.0 : rounded);
+        }
+    }
+    return table;
+}();
+
+}
@@ -24,6 +24,7 @@ SOFTWARE.
 */
 
 #include "Fm2.hpp"
+#include "common/core/Interp.hpp"
 
 using namespace kastle2;
 
@@ -44,7 +45,7 @@ void Fm2::Init(const float sample_rate)
     mod_.SetWaveform(Oscillator::Waveform::SINE);
 }
 
-q31_t Fm2::Process()
+void Fm2::UpdateFrequencies()
 {
     if (prev_ratio_ != ratio_ || prev_freq_ != freq_)
     {
@@ -53,6 +54,11 @@ q31_t Fm2::Process()
         car_.SetNativeFrequency(prev_freq_);
         mod_.SetNativeFrequency(q31_mult(prev_freq_, prev_ratio_));
     }
+}
+
+q31_t Fm2::Process()
+{
+    UpdateFrequencies();
 
     q31_t modval = mod_.Process();
     modval = q31_mult(modval, index_);
@@ -60,6 +66,30 @@ q31_t Fm2::Process()
     return car_.Process();
 }
 
+FASTCODE void Fm2::ProcessBlock(q31_t *output, size_t size)
+{
+    UpdateFrequencies();
+
+    // Modulator on the interp0 phase accumulator, phase modulated carrier lookups on interp1
+    Interp::SetupOscillator(qmath_sine_table.data(), QMATH_SINE_TABLE_BITS, Interp::ToPhase(mod_.GetPhase()), mod_.GetPhaseIncrement());
+    Interp::SetupLookup(qmath_sine_table.data(), QMATH_SINE_TABLE_BITS);
+
+    const q31_t index = index_;
+    const q31_t car_inc = car_.GetPhaseIncrement();
+    q31_t car_phase = car_.GetPhase();
+    for (size_t i = 0; i < size; i++)
+    {
+        const q31_t modval = q31_mult(Interp::PopOscillator<int32_t>(), index);
+        // don't use q31_add to enable overflow
+        car_phase = (int32_t)car_phase + (int32_t)modval;
+        output[i] = Interp::Lookup<int32_t>(Interp::ToPhase(car_phase));
+        car_phase = (int32_t)car_phase + (int32_t)car_inc;
+    }
+
+    mod_.Reset(Interp::FromPhase(Interp::GetPhase()));
+    car_.Reset(car_phase);
+}
+
 void Fm2::SetFrequency(const float frequency)
 {
     SetNativeFrequency(freq_to_q31(frequency, sample_rate_));
@@ -25,8 +25,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
 #include "Oscillator.hpp"
 
 namespace kastle2
@@ -58,6 +60,14 @@ public:
      */
     q31_t Process();
 
+    /**
+     * @brief Generates a block of samples, the sine lookups run on the interpolators (see Interp).
+     * @details Only the oscillator phases are updated, not their outputs and flags.
+     * @param output Array of at least size samples to fill, in Q31 fixed point format.
+     * @param size Number of samples to generate.
+     */
+    FASTCODE void ProcessBlock(q31_t *output, size_t size);
+
     /**
      * @brief Sets the carrier frequency.
      * @param frequency The frequency in Hz.
@@ -102,5 +112,7 @@ private:
     q31_t prev_freq_ = 0;
     q31_t ratio_ = 0;
     q31_t prev_ratio_ = 0;
+
+    void UpdateFrequencies();
 };
 }
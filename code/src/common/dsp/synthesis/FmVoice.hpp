@@ -0,0 +1,296 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "common/core/Interp.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/synthesis/Oscillator.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Routing of the FmVoice operators, fixed at compile time
+ * @ingroup dsp_synthesis
+ *
+ * Operator 0 is the first one. Each operator can be modulated only by the operators after it
+ * (they are rendered from the last one), its own bit is the feedback.
+ */
+template <size_t kOperators>
+struct FmAlgorithm
+{
+    /** @brief Bit j set: operator j modulates the operator */
+    std::array<uint8_t, kOperators> modulators{};
+
+    /** @brief Bit j set: operator j goes to the output */
+    uint8_t carriers = 1;
+
+    constexpr bool IsValid() const
+    {
+        if (kOperators == 0 || kOperators > 8 || carriers == 0 || (carriers >> kOperators) != 0)
+        {
+            return false;
+        }
+        for (size_t op = 0; op < kOperators; op++)
+        {
+            // Only the later operators and the feedback
+            if ((modulators[op] & ((1u << op) - 1)) != 0 || (modulators[op] >> kOperators) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief The common 4 operator algorithms
+ */
+namespace fm_algorithms
+{
+/** @brief 3 -> 2 -> 1 -> 0, feedback on 3 */
+inline constexpr FmAlgorithm<4> kStack{{0b0010, 0b0100, 0b1000, 0b1000}, 0b0001};
+/** @brief (1 -> 0) + (3 -> 2), feedback on 3 */
+inline constexpr FmAlgorithm<4> kTwoStacks{{0b0010, 0b0000, 0b1000, 0b1000}, 0b0101};
+/** @brief 1, 2 and 3 -> 0, feedback on 3 */
+inline constexpr FmAlgorithm<4> kThreeModulators{{0b1110, 0b0000, 0b0000, 0b1000}, 0b0001};
+/** @brief 3 -> (0, 1, 2), feedback on 3 */
+inline constexpr FmAlgorithm<4> kOneToThree{{0b1000, 0b1000, 0b1000, 0b1000}, 0b0111};
+/** @brief All the operators to the output, feedback on 3 */
+inline constexpr FmAlgorithm<4> kAdditive{{0b0000, 0b0000, 0b0000, 0b1000}, 0b1111};
+}
+
+/**
+ * @class FmVoice
+ * @ingroup dsp_synthesis
+ * @brief FM (phase modulation) voice of N sine operators with the routing fixed at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Each operator runs at a ratio of the voice frequency and has a level, which is its amplitude
+ * both as a modulator and as a carrier. A full level modulator moves the phase by ±pi.
+ * The feedback (the own bit in the algorithm) uses the average of the last two outputs of the operator.
+ *
+ * Only block rendering: the phase increments are computed once per block (only when the frequency or
+ * a ratio changed), the operators of the algorithm are unrolled at compile time and the sine lookups
+ * of the shared RAM table (qmath_sine_table) run on interp1 of the calling core (see Interp).
+ *
+ *     FmVoice<4, fm_algorithms::kStack> voice;
+ *     voice.Init(SAMPLE_RATE);
+ *     voice.SetRatio(1, FmVoice<4, fm_algorithms::kStack>::kRatioOne * 2);
+ *     voice.ProcessBlock(buffer, size);
+ */
+template <size_t kOperators, FmAlgorithm<kOperators> kAlgorithm>
+class FmVoice
+{
+    static_assert(kAlgorithm.IsValid(), "Operators can be modulated only by the later operators");
+
+public:
+    /** @brief Ratio of 1.0 (the voice frequency) for SetRatio() */
+    static constexpr uint32_t kRatioOne = 1u << 16;
+
+    /**
+     * @brief Initializes the voice to 440 Hz, all ratios 1, carriers at full level, modulators at half.
+     * @param sample_rate The sample rate of the audio engine.
+     */
+    void Init(const float sample_rate)
+    {
+        sample_rate_ = sample_rate;
+        for (size_t op = 0; op < kOperators; op++)
+        {
+            ratio_[op] = kRatioOne;
+            level_[op] = (kAlgorithm.carriers & (1u << op)) ? Q15_MAX : Q15_HALF;
+        }
+        feedback_ = Q15_ZERO;
+        SetFrequency(440.0f);
+        Reset();
+    }
+
+    /**
+     * @brief Sets the voice frequency.
+     * @param frequency The frequency in Hz.
+     */
+    void SetFrequency(const float frequency)
+    {
+        SetNativeFrequency(freq_to_q31(frequency, sample_rate_));
+    }
+
+    /**
+     * @brief Sets the voice frequency.
+     * @param frequency The frequency in Q31 fixed point format relative to the sample_rate.
+     */
+    void SetNativeFrequency(const q31_t frequency)
+    {
+        increments_dirty_ |= frequency != frequency_;
+        frequency_ = frequency;
+    }
+
+    /**
+     * @brief Sets the frequency of the operator relative to the voice frequency.
+     * @param op Operator index
+     * @param ratio Ratio in Q16 (kRatioOne is the voice frequency)
+     */
+    void SetRatio(const size_t op, const uint32_t ratio)
+    {
+        increments_dirty_ |= ratio != ratio_[op];
+        ratio_[op] = ratio;
+    }
+
+    /**
+     * @brief Sets the amplitude of the operator output, as a modulator and as a carrier.
+     * @param op Operator index
+     * @param level 0 to Q15_MAX
+     */
+    void SetLevel(const size_t op, const q15_t level)
+    {
+        level_[op] = level;
+    }
+
+    /**
+     * @brief Sets the feedback amount of the operators with the feedback in the algorithm.
+     * @param feedback 0 to Q15_MAX (±pi phase)
+     */
+    void SetFeedback(const q15_t feedback)
+    {
+        feedback_ = feedback;
+    }
+
+    /**
+     * @brief Restarts all the operators at the zero phase.
+     */
+    void Reset()
+    {
+        phase_.fill(0);
+        output_.fill(0);
+        previous_output_.fill(0);
+    }
+
+    /**
+     * @brief Returns the phase of the operator (the whole uint32_t range is one period).
+     */
+    uint32_t GetPhase(const size_t op) const
+    {
+        return phase_[op];
+    }
+
+    /**
+     * @brief Generates a block of samples, the sum of the carriers saturated to q15_t.
+     * @param output Array of at least size samples to fill.
+     * @param size Number of samples to generate.
+     */
+    FASTCODE void ProcessBlock(q15_t *output, const size_t size)
+    {
+        UpdateIncrements();
+        Interp::SetupLookup(qmath_sine_table.data(), QMATH_SINE_TABLE_BITS);
+
+        // The whole state in locals for the block
+        State state{phase_, output_, previous_output_};
+        for (size_t i = 0; i < size; i++)
+        {
+            output[i] = RenderSample(state, std::make_index_sequence<kOperators>{});
+        }
+        phase_ = state.phase;
+        output_ = state.output;
+        previous_output_ = state.previous_output;
+    }
+
+private:
+    struct State
+    {
+        std::array<uint32_t, kOperators> phase;
+        std::array<int32_t, kOperators> output;
+        std::array<int32_t, kOperators> previous_output;
+    };
+
+    float sample_rate_ = 0.0f;
+    q31_t frequency_ = 0;
+    bool increments_dirty_ = true;
+    q15_t feedback_ = Q15_ZERO;
+    std::array<uint32_t, kOperators> ratio_{};
+    std::array<uint32_t, kOperators> increment_{};
+    std::array<q15_t, kOperators> level_{};
+    std::array<uint32_t, kOperators> phase_{};
+    std::array<int32_t, kOperators> output_{};
+    std::array<int32_t, kOperators> previous_output_{};
+
+    void UpdateIncrements()
+    {
+        if (!increments_dirty_)
+        {
+            return;
+        }
+        increments_dirty_ = false;
+        // The q31_t oscillator phase runs from -1 to 1, so its increment is the uint32_t one
+        const uint32_t increment = static_cast<uint32_t>(Oscillator::CalcPhaseIncrement(frequency_));
+        for (size_t op = 0; op < kOperators; op++)
+        {
+            increment_[op] = static_cast<uint32_t>((static_cast<uint64_t>(increment) * ratio_[op]) >> 16);
+        }
+    }
+
+    template <size_t... kOps>
+    FASTCODE inline q15_t RenderSample(State &state, std::index_sequence<kOps...>) const
+    {
+        // From the last operator, so the modulators are ready
+        (RenderOperator<kOperators - 1 - kOps>(state), ...);
+
+        int32_t sum = 0;
+        ((sum += (kAlgorithm.carriers & (1u << kOps)) ? state.output[kOps] : 0), ...);
+        return q15_saturate(sum);
+    }
+
+    template <size_t kOp>
+    FASTCODE inline void RenderOperator(State &state) const
+    {
+        constexpr uint8_t kModulators = kAlgorithm.modulators[kOp];
+
+        // A full level output is ±2^31, half of the period
+        uint32_t phase = state.phase[kOp];
+        for (size_t j = kOp + 1; j < kOperators; j++)
+        {
+            if (kModulators & (1u << j))
+            {
+                phase += static_cast<uint32_t>(state.output[j]) << 16;
+            }
+        }
+        if constexpr ((kModulators & (1u << kOp)) != 0)
+        {
+            const int32_t average = (state.output[kOp] + state.previous_output[kOp]) >> 1;
+            phase += static_cast<uint32_t>(average * feedback_) << 1;
+            state.previous_output[kOp] = state.output[kOp];
+        }
+
+        const int32_t sine = Interp::Lookup<int32_t>(phase) >> 16;
+        state.output[kOp] = (sine * level_[kOp]) >> 15;
+        state.phase[kOp] += increment_[kOp];
+    }
+};
+
+}
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #include "MultiOscillator.hpp"
+#include "common/core/Interp.hpp"
 #include "common/dsp/math/math_utils.hpp"
 
 using namespace kastle2;
@@ -68,6 +69,11 @@ void MultiOscillator::PhaseAdd(const q31_t phase)
     phase_ = (int32_t)phase_ + (int32_t)phase;
 }
 
+void MultiOscillator::SetBandLimited(const bool band_limited)
+{
+    band_limited_ = band_limited;
+}
+
 void MultiOscillator::SetPhaseFeedback(const q31_t feedback)
 {
     feedback_ = feedback;
@@ -91,6 +97,10 @@ FASTCODE MultiOscillator::Outputs MultiOscillator::Process()
     }
     outputs_.square = phase_ < pulse_width_ ? Q31_MAX : Q31_MIN;
     outputs_.ramp = phase_;
+    if (band_limited_)
+    {
+        BandLimit(outputs_, phase_);
+    }
 
     // don't use arm_add_q31 to enable overflow
     phase_ = (int32_t)phase_ + (int32_t)phase_inc_;
@@ -98,6 +108,104 @@ FASTCODE MultiOscillator::Outputs MultiOscillator::Process()
     return outputs_;
 }
 
+FASTCODE void MultiOscillator::ProcessBlock(Outputs *outputs, size_t size)
+{
+    const q31_t phase_inc = phase_inc_;
+    const q31_t pulse_width = pulse_width_;
+    const q31_t feedback = feedback_;
+    q31_t phase = phase_;
+    q31_t sine = outputs_.sine;
+
+    if (feedback == Q31_ZERO && size > 0)
+    {
+        // Phase accumulation and the sine lookup on the interpolator
+        Interp::SetupOscillator(qmath_sine_table.data(), QMATH_SINE_TABLE_BITS, Interp::ToPhase(phase), phase_inc);
+        for (size_t i = 0; i < size; i++)
+        {
+            phase = Interp::FromPhase(Interp::GetPhase());
+            outputs[i].sine = Interp::PopOscillator<int32_t>();
+            outputs[i].square = phase < pulse_width ? Q31_MAX : Q31_MIN;
+            outputs[i].ramp = phase;
+        }
+        phase_ = Interp::FromPhase(Interp::GetPhase());
+        if (band_limited_)
+        {
+            // The ramp is the phase of each sample
+            for (size_t i = 0; i < size; i++)
+            {
+                BandLimit(outputs[i], outputs[i].ramp);
+            }
+        }
+        outputs_ = outputs[size - 1];
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++)
+    {
+        if (feedback != Q31_ZERO)
+        {
+            sine = q31_sine(((int32_t)phase + (int32_t)q31_mult(feedback, sine)) / 2 + Q31_HALF);
+        }
+        else
+        {
+            sine = q31_sine(phase / 2 + Q31_HALF);
+        }
+        outputs[i].sine = sine;
+        outputs[i].square = phase < pulse_width ? Q31_MAX : Q31_MIN;
+        outputs[i].ramp = phase;
+        if (band_limited_)
+        {
+            BandLimit(outputs[i], phase);
+        }
+
+        // don't use arm_add_q31 to enable overflow
+        phase = (int32_t)phase + (int32_t)phase_inc;
+    }
+
+    phase_ = phase;
+    if (size > 0)
+    {
+        outputs_ = outputs[size - 1];
+    }
+}
+
+FASTCODE void MultiOscillator::BandLimit(Outputs &output, const q31_t phase) const
+{
+    // Below ~1 Hz the steps don't alias, negative increments are not corrected
+    const uint32_t increment = static_cast<uint32_t>(phase_inc_);
+    const uint32_t increment_high = increment >> 16;
+    if (phase_inc_ <= 0 || increment_high == 0)
+    {
+        return;
+    }
+
+    // Phase wrap: the ramp steps down, the square up
+    const uint32_t position = Interp::ToPhase(phase);
+    if (position < increment)
+    {
+        const q31_t residual = BlepResidual(position, increment_high);
+        output.ramp += residual;
+        output.square = q31_add(output.square, -residual);
+    }
+    else if (-position < increment)
+    {
+        const q31_t residual = BlepResidual(-position, increment_high);
+        output.ramp -= residual;
+        output.square = q31_add(output.square, residual);
+    }
+
+    // Pulse width: the square steps down
+    const uint32_t edge = position - Interp::ToPhase(pulse_width_);
+    if (edge < increment)
+    {
+        output.square = q31_add(output.square, BlepResidual(edge, increment_high));
+    }
+    else if (-edge < increment)
+    {
+        output.square = q31_add(output.square, -BlepResidual(-edge, increment_high));
+    }
+}
+
 q31_t MultiOscillator::CalcPhaseIncrement(const q31_t frequency)
 {
 
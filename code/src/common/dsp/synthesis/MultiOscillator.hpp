@@ -41,6 +41,8 @@ namespace kastle2
  * Defaults to 440Hz.
  * Built on Oscillator.hpp.
  *
+ * The square and ramp are naive (they alias at high pitches) unless SetBandLimited() is on.
+ * Then the samples next to their steps get a polyBLEP correction, the rest of the samples cost nothing more.
  */
 class MultiOscillator
 {
@@ -76,11 +78,25 @@ public:
      */
     void SetPulseWidth(const q31_t pulse_width);
 
+    /**
+     * @brief Turns the polyBLEP correction of the square and ramp on or off.
+     * @param band_limited true for the band-limited waveforms, off by default.
+     */
+    void SetBandLimited(const bool band_limited);
+
     /**
      * @brief Processes the waveform to be generated and returns one sample.
      */
     FASTCODE Outputs Process();
 
+    /**
+     * @brief Generates a block of samples.
+     * @details Without phase feedback the phase and the sine lookup run on the interpolator (see Interp).
+     * @param outputs Array of at least size outputs to fill.
+     * @param size Number of samples to generate.
+     */
+    FASTCODE void ProcessBlock(Outputs *outputs, size_t size);
+
     /**
      * @brief Adds a value to the current phase.
      * @param phase The value to add to the current phase in q31_t format.
@@ -122,8 +138,33 @@ public:
     q31_t pulse_width_ = Q31_ZERO;
     q31_t native_frequency_ = Q31_ZERO;
     q31_t feedback_ = Q31_ZERO;
+    bool band_limited_ = false;
     Outputs outputs_;
 
+    /**
+     * @brief polyBLEP residual of a sample next to a step.
+     * @param distance Distance of the sample from the step, less than the increment (unsigned phase units).
+     * @param increment High 16 bits of the phase increment, not zero.
+     * @return (1 - distance / increment)^2 in q31_t, for a step of 2 (from Q31_MAX to Q31_MIN or back).
+     */
+    static inline q31_t BlepResidual(const uint32_t distance, const uint32_t increment)
+    {
+        // Only this division per corrected sample, the RP2040 has a hardware divider
+        int32_t rest = 32768 - static_cast<int32_t>(((distance >> 16) << 15) / increment);
+        if (rest > 32767)
+        {
+            rest = 32767;
+        }
+        return (rest * rest) << 1;
+    }
+
+    /**
+     * @brief Corrects the square and ramp of the sample if it is next to one of their steps.
+     * @param output Sample to correct.
+     * @param phase Phase of the sample.
+     */
+    FASTCODE void BandLimit(Outputs &output, const q31_t phase) const;
+
     /**
      * @brief Calculates the phase increment for a given frequency.
      * @param frequency The frequency in q31_t format.
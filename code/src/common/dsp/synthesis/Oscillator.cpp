@@ -49,7 +49,8 @@ void Oscillator::SetNativeFrequency(const q31_t native_frequency)
 {
     native_frequency_ = native_frequency;
     phase_inc_ = CalcPhaseIncrement(native_frequency_);
-    ticks_ = Q31_MAX / native_frequency_;
+    // A stopped oscillator never completes a period
+    ticks_ = native_frequency_ != 0 ? Q31_MAX / native_frequency_ : UINT32_MAX;
 }
 
 void Oscillator::SetTicks(const uint32_t ticks)
@@ -112,6 +113,11 @@ q31_t Oscillator::GetPhase() const
     return phase_;
 }
 
+q31_t Oscillator::GetPhaseIncrement() const
+{
+    return phase_inc_;
+}
+
 void Oscillator::PhaseAdd(const q31_t phase)
 {
     // don't use q31_add to enable overflow
@@ -154,6 +154,12 @@ public:
      */
     q31_t GetPhase() const;
 
+    /**
+     * @brief Get the phase increment per sample
+     * @return phase increment in q31_t format
+     */
+    q31_t GetPhaseIncrement() const;
+
     /**
      * @brief Adds a value to the current phase.
      * @param phase The value to add to the current phase in q31_t format.
@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #include "OscillatorQ15.hpp"
+#include "common/core/Interp.hpp"
 #include "common/dsp/math/math_utils.hpp"
 
 using namespace kastle2;
@@ -94,8 +95,8 @@ bool OscillatorQ15::IsFalling()
 
 void OscillatorQ15::PhaseAdd(q15_t phase)
 {
-    // don't use q31_add to enable overflow
-    phase_ = (int16_t)phase_ + (int16_t)phase;
+    // don't use q31_add to enable overflow, wrap to 16 bits to stay in the sine table
+    phase_ = (int16_t)(phase_ + phase);
 }
 
 void OscillatorQ15::Reset(q15_t _phase)
@@ -139,8 +140,8 @@ q15_t OscillatorQ15::Process()
 
     q15_t new_phase;
 
-    // don't use arm_add_q31 to enable overflow
-    new_phase = (int16_t)phase_ + (int16_t)phase_inc_;
+    // don't use arm_add_q31 to enable overflow, wrap to 16 bits to stay in the sine table
+    new_phase = (int16_t)(phase_ + phase_inc_);
 
     // overflow
     if (phase_ > new_phase)
@@ -165,6 +166,41 @@ q15_t OscillatorQ15::Process()
     return out;
 }
 
+FASTCODE void OscillatorQ15::ProcessBlock(q15_t *output, size_t size)
+{
+    if (waveform_ != Oscillator::Waveform::SINE || size == 0)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            output[i] = Process();
+        }
+        return;
+    }
+
+    // The 16 bit phase goes to the top of the interpolator phase
+    // kPhaseOffset matches the q15_sine(phase / 2 + Q15_HALF) indexing of Process()
+    constexpr int32_t kPhaseOffset = 2 * Q15_HALF;
+    Interp::SetupOscillator(qmath_sine_table.data(), QMATH_SINE_TABLE_BITS,
+                            static_cast<uint32_t>(phase_ + kPhaseOffset) << 16,
+                            static_cast<uint32_t>(phase_inc_) << 16);
+    for (size_t i = 0; i < size; i++)
+    {
+        q15_t out = q31_to_q15(Interp::PopOscillator<int32_t>());
+        if (amplitude_ != Q15_MAX)
+        {
+            out = q15_mult(out, amplitude_);
+        }
+        output[i] = out;
+    }
+
+    // Flags of the last sample
+    const q15_t new_phase = (int16_t)((Interp::GetPhase() >> 16) - kPhaseOffset);
+    const q15_t last_phase = (int16_t)(new_phase - phase_inc_);
+    eoc_ = last_phase > new_phase;
+    eor_ = (last_phase < Q15_ZERO && new_phase >= Q15_ZERO);
+    phase_ = new_phase;
+}
+
 /**
  * @brief Calculates the phase increment for a given relative frequency. Basically multiply by 2, since the Oscillators use -1 to 1 range.
  * @param frequency The frequency to calculate the phase increment for.
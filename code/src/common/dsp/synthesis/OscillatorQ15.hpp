@@ -26,8 +26,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
 #include "Oscillator.hpp"
 
 namespace kastle2
@@ -116,6 +118,15 @@ public:
      */
     q15_t Process();
 
+    /**
+     * @brief Generates a block of samples.
+     * @details The sine runs on the interpolator (see Interp), the other waveforms call Process().
+     *          EOC and EOR flags are the ones of the last sample.
+     * @param output Array of at least size samples to fill.
+     * @param size Number of samples to generate.
+     */
+    FASTCODE void ProcessBlock(q15_t *output, size_t size);
+
     /**
      * @brief Adds a value to the current phase.
      * @param phase The value to add to the current phase in q31_t format.
@@ -0,0 +1,214 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "WavetableOscillator.hpp"
+#include <bit>
+#include "common/core/Interp.hpp"
+#include "common/dsp/math/math_utils.hpp"
+
+using namespace kastle2;
+
+bool WavetableOscillator::Load(UserDataFile &file_reader, Wavetables &wavetables)
+{
+    wavetables = {};
+
+    // Validate file header
+    if (!file_reader.Validate("k2wt"))
+    {
+        return false;
+    }
+
+    // The header and the samples are read in place
+    const uint8_t *header = file_reader.Map<uint8_t>(0, kHeaderSize);
+    if (header == nullptr)
+    {
+        return false;
+    }
+    const uint32_t file_size = file_reader.GetHeader().file_size;
+
+    Wavetables loaded;
+    loaded.samples = reinterpret_cast<const int16_t *>(header + kHeaderSize);
+    loaded.table_bits = header[9];
+    loaded.levels = header[10];
+    loaded.tables = header[11];
+
+    if (header[8] != kVersion ||
+        !between(loaded.table_bits, kMinTableBits, kMaxTableBits) ||
+        !between(loaded.levels, 1, kMaxLevels) ||
+        loaded.tables == 0)
+    {
+        return false;
+    }
+
+    // The samples and the end marker must fit the file
+    const size_t samples_size = loaded.tables * loaded.levels * loaded.LevelSize() * sizeof(int16_t);
+    if (kHeaderSize + samples_size + 4 > file_size)
+    {
+        return false;
+    }
+
+    wavetables = loaded;
+    return true;
+}
+
+void WavetableOscillator::Init(const float sample_rate, const Wavetables &wavetables)
+{
+    sample_rate_ = sample_rate;
+    phase_ = 0;
+    table_ = 0;
+    morph_ = 0;
+    SetWavetables(wavetables);
+    SetFrequency(440); // 440 Hz
+}
+
+void WavetableOscillator::SetWavetables(const Wavetables &wavetables)
+{
+    wavetables_ = wavetables;
+    if (wavetables_.IsValid() && table_ >= wavetables_.tables)
+    {
+        table_ = wavetables_.tables - 1;
+        morph_ = 0;
+    }
+    UpdateLevel();
+}
+
+void WavetableOscillator::SetFrequency(const float frequency)
+{
+    SetNativeFrequency(freq_to_q31(frequency, sample_rate_));
+}
+
+void WavetableOscillator::SetNativeFrequency(const q31_t native_frequency)
+{
+    native_frequency_ = native_frequency;
+    // 1.0 (sample rate) is the whole 32 bit phase range, negative frequencies play backwards
+    phase_inc_ = static_cast<uint32_t>(native_frequency) << 1;
+    UpdateLevel();
+}
+
+void WavetableOscillator::SetPosition(const q15_t position)
+{
+    if (!wavetables_.IsValid())
+    {
+        return;
+    }
+    const int32_t scaled = constrain(position, Q15_ZERO, Q15_MAX) * static_cast<int32_t>(wavetables_.tables - 1);
+    table_ = scaled >> 15;
+    morph_ = scaled & 0x7FFF;
+    if (table_ >= wavetables_.tables - 1)
+    {
+        table_ = wavetables_.tables - 1;
+        morph_ = 0;
+    }
+    UpdateLevel();
+}
+
+void WavetableOscillator::Reset(const uint32_t phase)
+{
+    phase_ = phase;
+}
+
+void WavetableOscillator::UpdateLevel()
+{
+    if (!wavetables_.IsValid())
+    {
+        level_a_ = nullptr;
+        level_b_ = nullptr;
+        return;
+    }
+
+    // Highest harmonic of the level 0 times the increment, Nyquist is 2^31
+    const uint64_t increment = static_cast<uint64_t>(std::abs(static_cast<int64_t>(native_frequency_))) << 1;
+    const uint64_t top = increment << (wavetables_.table_bits - 1);
+    // Each level halves the harmonics, so it's the number of octaves above Nyquist (rounded up)
+    const uint32_t level = top <= (uint64_t(1) << 31) ? 0 : std::bit_width((top - 1) >> 31);
+    level_ = std::min(level, wavetables_.levels - 1);
+
+    level_a_ = wavetables_.Get(table_, level_);
+    level_b_ = wavetables_.Get(std::min(table_ + 1, wavetables_.tables - 1), level_);
+}
+
+FASTCODE q15_t WavetableOscillator::Process()
+{
+    if (level_a_ == nullptr)
+    {
+        return Q15_ZERO;
+    }
+
+    const uint32_t table_bits = wavetables_.table_bits;
+    const int16_t *sample = level_a_ + (phase_ >> (32 - table_bits));
+    const int32_t fraction = (phase_ << table_bits) >> 17;
+    int32_t out = Interpolate(sample, fraction);
+    if (morph_ != 0)
+    {
+        const int32_t next = Interpolate(sample + (level_b_ - level_a_), fraction);
+        out += ((next - out) * morph_) >> 15;
+    }
+
+    phase_ += phase_inc_;
+    return out;
+}
+
+FASTCODE void WavetableOscillator::ProcessBlock(q15_t *output, size_t size)
+{
+    if (level_a_ == nullptr)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            output[i] = Q15_ZERO;
+        }
+        return;
+    }
+
+    // Phase accumulation and the addressing of the samples on the interpolator
+    const uint32_t table_bits = wavetables_.table_bits;
+    Interp::SetupOscillator(level_a_, table_bits, phase_, phase_inc_);
+
+    if (morph_ == 0)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            const uint32_t phase = Interp::GetPhase();
+            const int16_t *sample = Interp::PopOscillatorAddress<int16_t>();
+            output[i] = Interpolate(sample, (phase << table_bits) >> 17);
+        }
+    }
+    else
+    {
+        // Same position in the next table
+        const ptrdiff_t next_table = level_b_ - level_a_;
+        const int32_t morph = morph_;
+        for (size_t i = 0; i < size; i++)
+        {
+            const uint32_t phase = Interp::GetPhase();
+            const int16_t *sample = Interp::PopOscillatorAddress<int16_t>();
+            const int32_t fraction = (phase << table_bits) >> 17;
+            const int32_t out = Interpolate(sample, fraction);
+            const int32_t next = Interpolate(sample + next_table, fraction);
+            output[i] = out + (((next - out) * morph) >> 15);
+        }
+    }
+
+    phase_ = Interp::GetPhase();
+}
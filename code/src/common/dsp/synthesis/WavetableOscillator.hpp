@@ -0,0 +1,191 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/core/UserDataFile.hpp"
+#include "common/dsp/math/qmath.hpp"
+#include "common/fastcode.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class WavetableOscillator
+ * @ingroup dsp_synthesis
+ * @brief Wavetable oscillator reading band-limited tables from the user data flash.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The tables come from a k2wt user data file (scripts/wavetable_pack.py), little endian:
+ * - 0: "k2wt", 4: file size (uint32), 8: version (1), 9: table bits, 10: mip levels, 11: tables
+ * - 12: int16 samples, for each table and each of its mip levels 2^table_bits samples and one guard sample
+ *   (a copy of the first one, so the interpolation doesn't need to wrap)
+ * - file size - 4: "ahoj"
+ *
+ * Mip level 0 has all the harmonics the table can hold (2^table_bits / 2), each next level has half of them.
+ * The level is picked from the phase increment, the highest one whose harmonics all stay below Nyquist,
+ * so the playback doesn't alias without any runtime band limiting.
+ *
+ * The position morphs between the neighbouring tables. The samples are read from the flash through XIP.
+ */
+class WavetableOscillator
+{
+public:
+    /**
+     * @brief Tables of a k2wt file, the samples stay in the flash.
+     */
+    struct Wavetables
+    {
+        const int16_t *samples = nullptr;
+        uint32_t table_bits = 0;
+        uint32_t levels = 0;
+        uint32_t tables = 0;
+
+        /**
+         * @brief Samples of one mip level including the guard sample.
+         */
+        constexpr size_t LevelSize() const
+        {
+            return (size_t(1) << table_bits) + 1;
+        }
+
+        /**
+         * @brief First sample of the mip level of the table.
+         */
+        constexpr const int16_t *Get(const uint32_t table, const uint32_t level) const
+        {
+            return samples + (table * levels + level) * LevelSize();
+        }
+
+        constexpr bool IsValid() const
+        {
+            return samples != nullptr;
+        }
+    };
+
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 12;
+    static constexpr uint32_t kMinTableBits = 6;
+    static constexpr uint32_t kMaxTableBits = 12;
+    static constexpr uint32_t kMaxLevels = 16;
+
+    /**
+     * @brief Validates the k2wt file in the user data and maps its tables.
+     * @param file_reader User data reader.
+     * @param wavetables Filled with the tables of the file.
+     * @return false if there is no valid k2wt file.
+     */
+    static bool Load(UserDataFile &file_reader, Wavetables &wavetables);
+
+    /**
+     * @brief Initializes the oscillator.
+     * @param sample_rate The sample rate in Hz.
+     * @param wavetables Tables to play, the oscillator is silent until valid ones are set.
+     */
+    void Init(const float sample_rate, const Wavetables &wavetables);
+
+    /**
+     * @brief Sets the tables to play.
+     */
+    void SetWavetables(const Wavetables &wavetables);
+
+    /**
+     * @brief Sets the frequency of the oscillator.
+     * @param frequency The frequency in Hz.
+     */
+    void SetFrequency(const float frequency);
+
+    /**
+     * @brief Sets the "native frequency" of the oscillator and picks the mip level for it.
+     * @param native_frequency The frequency in q31_t format where 1.0 is the sample_rate.
+     */
+    void SetNativeFrequency(const q31_t native_frequency);
+
+    /**
+     * @brief Sets the position in the tables.
+     * @param position Q15_ZERO is the first table, Q15_MAX the last one, morphing between the neighbours.
+     */
+    void SetPosition(const q15_t position);
+
+    /**
+     * @brief Resets the phase of the oscillator.
+     * @param phase The phase to reset to, the whole 32 bit range is one period.
+     */
+    void Reset(const uint32_t phase = 0);
+
+    /**
+     * @brief Returns the mip level used for the current frequency.
+     */
+    uint32_t GetLevel() const
+    {
+        return level_;
+    }
+
+    /**
+     * @brief Generates one sample.
+     * @return Sample in q15_t format.
+     */
+    FASTCODE q15_t Process();
+
+    /**
+     * @brief Generates a block of samples.
+     * @details The phase accumulation and the table addressing run on the interpolator (see Interp).
+     * @param output Array of at least size samples to fill, in q15_t format.
+     * @param size Number of samples to generate.
+     */
+    FASTCODE void ProcessBlock(q15_t *output, size_t size);
+
+private:
+    Wavetables wavetables_;
+    float sample_rate_ = 0.0f;
+    uint32_t phase_ = 0;
+    uint32_t phase_inc_ = 0;
+    q31_t native_frequency_ = Q31_ZERO;
+    uint32_t level_ = 0;
+    uint32_t table_ = 0;
+    // Morph from the table to the next one, 15 bits
+    int32_t morph_ = 0;
+    // Current mip level of the table and of the next one
+    const int16_t *level_a_ = nullptr;
+    const int16_t *level_b_ = nullptr;
+
+    /**
+     * @brief Picks the mip level for the phase increment and updates the level pointers.
+     */
+    void UpdateLevel();
+
+    /**
+     * @brief Linear interpolation of a sample and the next one, 15 bit fraction.
+     */
+    static inline int32_t Interpolate(const int16_t *sample, const int32_t fraction)
+    {
+        return sample[0] + (((sample[1] - sample[0]) * fraction) >> 15);
+    }
+};
+
+}
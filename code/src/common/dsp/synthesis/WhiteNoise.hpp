@@ -25,6 +25,9 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/Xorshift32.hpp"
 #include "common/dsp/math/qmath.hpp"
 
 namespace kastle2
@@ -33,26 +36,24 @@ namespace kastle2
 /**
  * @class WhiteNoise
  * @ingroup dsp_synthesis
- * @brief White noise generator with custom seed, default seed is 1.
+ * @brief White noise generator with custom seed.
  * @author Marek Mach (Bastl Instruments)
  * @date 2025-08-25
  *
  * Based on the DaisySP White Noise, Copyright (c) 2020 Electrosmith, Corp
+ * The values come from an Xorshift32, Render() takes two samples from each 32 random bits.
+ * Seed it with Xorshift32::HardwareSeed() for a different noise on each boot.
  */
 class WhiteNoise
 {
 public:
     /**
      * @brief Sets the seed for the white noise generator.
-     * @param seed The seed value to initialize the random number generator.
+     * @param seed The seed value to initialize the random number generator, 0 selects the default one.
      */
     void Seed(const uint32_t seed)
     {
-        rand_seed_ = seed;
-        if (rand_seed_ == 0)
-        {
-            rand_seed_ = 1; // cannot be zero
-        }
+        random_.Seed(seed);
     }
 
     /**
@@ -61,12 +62,31 @@ public:
      */
     inline q15_t Process()
     {
-        rand_seed_ *= 16807;
-        return q31_to_q15(rand_seed_);
+        return static_cast<int16_t>(random_.Next() >> 16);
+    }
+
+    /**
+     * @brief Renders a block of white noise.
+     * @param output Output for size samples.
+     * @param size Number of samples.
+     */
+    inline void Render(q15_t *output, const size_t size)
+    {
+        size_t i = 0;
+        for (; i + 1 < size; i += 2)
+        {
+            const uint32_t bits = random_.Next();
+            output[i] = static_cast<int16_t>(bits >> 16);
+            output[i + 1] = static_cast<int16_t>(bits);
+        }
+        if (i < size)
+        {
+            output[i] = Process();
+        }
     }
 
 private:
-    uint32_t rand_seed_ = 1;
+    Xorshift32 random_;
 };
 
 } // namespace kastle2
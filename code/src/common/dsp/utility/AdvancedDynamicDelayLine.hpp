@@ -25,9 +25,15 @@ SOFTWARE.
 */
 
 #pragma once
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include "DelayLineStorage.hpp"
+#include "common/core/DmaFill.hpp"
 
 #define SLEW_TYPE_SLOW 1
 #define SLEW_TYPE_FAST 2
@@ -36,6 +42,15 @@ SOFTWARE.
 namespace kastle2
 {
 
+/**
+ * @brief Fixed point format of the AdvancedDynamicDelayLine delay smoothing
+ */
+enum class DelaySlew
+{
+    BITS_64, ///< 32.32, any length, 64-bit multiply per Read() (a libgcc call on the Cortex-M0+)
+    BITS_32, ///< 16.16 (fewer fraction bits above 0x10000 samples), up to kMaxLength32BitSlew samples, only shifts and adds
+};
+
 /**
  * @class AdvancedDynamicDelayLine
  * @ingroup dsp_utility
@@ -45,6 +60,7 @@ namespace kastle2
  *
  * @note You need to create it using `new` keyword and delete it using `delete` keyword when you don't need it.
  *       Be careful with the RAM usage, it will crash if you try to allocate too much memory.
+ *       To keep the buffer out of the heap, pass memory from the app arena (Kastle2::arena) instead of the length.
  *
  * There are two pointers (write pointer, read pointer), they independently increment with each write/read.
  * Be careful and store the read value (can't read twice the same sample).
@@ -59,11 +75,40 @@ namespace kastle2
  *  -  SetReverse()       which allows you to change the direction of the index - if the buffer is not being recorded to and is jus playing, it will play backwards
  *                      recording to it however will fill it up backwards so it will sound normal again until you set the reverse to false
  *
+ * The samples are stored as T, or compressed by its DelayLineStorage: `AdvancedDynamicDelayLine<MuLawSample>` keeps
+ * twice the time in the same memory, `AdvancedDynamicDelayLine<Packed12Sample>` a third more. The memory passed in is
+ * then in the items of the storage, see Items().
+ *
+ * The pointers wrap without a division: a line of a power of two samples over its whole length wraps by a mask,
+ * the others subtract the length (the modulo is left for a loop that just got shorter than a pointer).
+ * ReadBlock() and WriteBlock() wrap once per block, when the line plays forward at the normal speed
+ * and the delay doesn't glide, the samples between the wraps are copied in spans.
+ *
+ * Reset() clears the buffer in the background by the DMA (DmaFill), the reads ahead of the clear return silence
+ * and the writes ahead of it wait for it (it's far ahead after the first one), so a reset doesn't stall its caller.
+ *
+ * The delay smoothing is selected by kSlew. DelaySlew::BITS_32 glides the same way as the 64-bit default
+ * (same time constant, it settles exactly on the delay), without the 64-bit multiply in every Read().
+ * The Benchmark app measures both.
+ *
  * Loosely based on `DelayLine` from DaisySP by shensley, Electrosmith listed under MIT License.
  */
-template <typename T>
+template <typename T, DelaySlew kSlew = DelaySlew::BITS_64>
 class AdvancedDynamicDelayLine
 {
+    using Storage = DelayLineStorage<T>;
+
+public:
+    using Sample = typename Storage::Sample; ///< Type of Write() and Read()
+    using Item = typename Storage::Item;     ///< Element of the buffer
+
+    /**
+     * @brief Returns the number of buffer items for a delay line of the length (eg. for Kastle2::arena.Allocate)
+     */
+    static constexpr size_t Items(const size_t length)
+    {
+        return Storage::Items(length);
+    }
 
 private:
     // this weird thing allows us to play with 64bit numbers without a speed penalty
@@ -77,6 +122,13 @@ private:
         } parts;
     } expanded_t;
 
+    // The slew adds delay_ shifted by the fraction bits minus this, the BITS_32 slew keeps at least these fraction bits
+#if SLEW_TYPE == SLEW_TYPE_SLOW
+    static constexpr uint32_t kSlewShift = 12;
+#elif SLEW_TYPE == SLEW_TYPE_FAST
+    static constexpr uint32_t kSlewShift = 10;
+#endif
+
     inline void IncrementPointer(expanded_t *ptr, expanded_t *inc, const size_t length, const bool reverse)
     {
         if (IsOversampling(inc))
@@ -98,33 +150,83 @@ private:
         }
         if (reverse)
         {
-            ptr->parts.top = ((length + ptr->parts.top) - inc->parts.top) % length;
+            ptr->parts.top = Wrap((length + ptr->parts.top) - inc->parts.top, length);
         }
         else
         {
-            ptr->parts.top = ((length + ptr->parts.top) + inc->parts.top) % length;
+            ptr->parts.top = Wrap((length + ptr->parts.top) + inc->parts.top, length);
         }
     }
 
+    /**
+     * @brief value % length, the pointer sums are under twice the length unless the loop just got shorter.
+     * @note A line of 1 sample has mask_ 0 too, the mask gives the 0 of the modulo there as well.
+     */
+    inline size_t Wrap(size_t value, const size_t length) const
+    {
+        if (length == mask_ + 1)
+        {
+            return value & mask_;
+        }
+        if (value < length)
+        {
+            return value;
+        }
+        value -= length;
+        return value < length ? value : value % length;
+    }
+
 public:
     /**
      * @brief  0x00010000 is 1-1 sampling (default), below is undersampling, above is oversampling
      */
     static constexpr uint32_t kDefaultSampling = 0x00010000;
 
+    /**
+     * @brief Longest delay line with DelaySlew::BITS_32, longer buffers are used only up to this length
+     * Lines up to 0x10000 samples slew in 16.16, the longer ones give up as many fraction bits as they need.
+     */
+    static constexpr size_t kMaxLength32BitSlew = size_t{1} << (32 - kSlewShift);
+
     /**
      * @brief Prepares the delay line and allocates memory
      * @param max_length The size of the delay line
      */
     AdvancedDynamicDelayLine(const size_t max_length)
     {
-        max_length_ = max_length;
-        line_ = std::make_unique<T[]>(max_length_);
+        max_length_ = LimitLength(max_length);
+        slew_fraction_bits_ = SlewFractionBits(max_length_);
+        mask_ = std::has_single_bit(max_length_) ? max_length_ - 1 : 0;
+        owned_line_ = std::make_unique<Item[]>(Storage::Items(max_length_));
+        line_ = owned_line_.get();
         length_read_ = max_length_;
         length_write_ = max_length_;
         Reset();
     }
 
+    /**
+     * @brief Prepares the delay line over an existing buffer (eg. from Kastle2::arena)
+     * @param line The buffer, holding the delay line of Items() items. Must outlive the delay line.
+     */
+    AdvancedDynamicDelayLine(const std::span<Item> line)
+    {
+        max_length_ = LimitLength(Storage::Samples(line.size()));
+        slew_fraction_bits_ = SlewFractionBits(max_length_);
+        mask_ = std::has_single_bit(max_length_) ? max_length_ - 1 : 0;
+        line_ = line.data();
+        length_read_ = max_length_;
+        length_write_ = max_length_;
+        Reset();
+    }
+
+    /**
+     * @brief Waits for the background clear, the buffer may go away after the delay line
+     */
+    ~AdvancedDynamicDelayLine()
+    {
+        DmaFill::Wait(fill_);
+    }
+
     /**
      * @brief Returns the max length of the delay buffer
      * @return Buffer max length in size_t
@@ -163,12 +265,12 @@ public:
 
     /**
      * @brief Sets the Length of the record and playback buffer (can be changed on the fly, unlike max_length)
-     * @param length Buffer length in samples
+     * @param length Buffer length in samples, at least 1 (the pointers wrap modulo the length)
      */
     void inline SetLengthBoth(const size_t length)
     {
-        length_read_ = length <= max_length_ ? length : max_length_;
-        length_write_ = length <= max_length_ ? length : max_length_;
+        length_read_ = ClampLength(length);
+        length_write_ = ClampLength(length);
     }
 
     /**
@@ -178,7 +280,7 @@ public:
      */
     void inline SetLengthRead(const size_t length)
     {
-        length_read_ = length <= max_length_ ? length : max_length_;
+        length_read_ = ClampLength(length);
     }
 
     /**
@@ -188,7 +290,7 @@ public:
      */
     void inline SetLengthWrite(const size_t length)
     {
-        length_write_ = length <= max_length_ ? length : max_length_;
+        length_write_ = ClampLength(length);
     }
 
     /**
@@ -231,13 +333,20 @@ public:
     }
 
     /**
-     * @brief Clears buffer, sets write pointer to 0, and delay to 1 sample
+     * @brief Clears buffer (in the background, see DmaFill), sets write pointer to 0, and delay to 1 sample
      */
     void Reset()
     {
-        for (size_t i = 0; i < max_length_; i++)
+        if constexpr (Storage::kSilenceByte >= 0)
+        {
+            fill_ = DmaFill::Start(line_, Storage::Items(max_length_) * sizeof(Item), Storage::kSilenceByte);
+        }
+        else
         {
-            line_[i] = T(0);
+            for (size_t i = 0; i < max_length_; i++)
+            {
+                Storage::Store(line_, i, Sample(0));
+            }
         }
         write_ptr_.big = 0;
         write_ptr_prev_ = 0;
@@ -271,13 +380,21 @@ public:
      */
     inline void SetDelaySnap(const size_t delay)
     {
-        delay_smooth_.parts.top = delay < max_length_ ? delay : max_length_ - 1;
+        size_t snapped = delay < max_length_ ? delay : max_length_ - 1;
         delay_ = delay;
         // if it is reversed, invert the delay amount to keep the behavior identical
         if (reverse_)
         {
-            delay_smooth_.parts.top = max_length_ - delay_smooth_.parts.top;
-            delay_ = delay_smooth_.parts.top;
+            snapped = max_length_ - snapped;
+            delay_ = snapped;
+        }
+        if constexpr (kSlew == DelaySlew::BITS_32)
+        {
+            delay_smooth_ = snapped << slew_fraction_bits_;
+        }
+        else
+        {
+            delay_smooth_.parts.top = snapped;
         }
     }
 
@@ -287,7 +404,14 @@ public:
      */
     inline size_t GetDelay() const
     {
-        return delay_smooth_.parts.top;
+        if constexpr (kSlew == DelaySlew::BITS_32)
+        {
+            return delay_smooth_ >> slew_fraction_bits_;
+        }
+        else
+        {
+            return delay_smooth_.parts.top;
+        }
     }
 
     /**
@@ -320,17 +444,17 @@ public:
     }
 
     /**
-     * @brief Writes the sample of type T to the delay line, and advances the write pointer
+     * @brief Writes the sample to the delay line, and advances the write pointer
      * @param sample The sample to write
      */
-    void Write(const T sample)
+    void Write(const Sample sample)
     {
         if (!IsOversampling(&write_ptr_inc_))
         {
             // Simple implement without oversampling
             IncrementPointer(&write_ptr_, &write_ptr_inc_, length_write_, reverse_);
             recorded_samples_.big += write_ptr_inc_.big; // simple incrementing is required
-            line_[write_ptr_.parts.top] = sample;
+            Store(write_ptr_.parts.top, sample);
         }
         else
         {
@@ -344,7 +468,7 @@ public:
             {
                 while (write_ptr_prev_ >= write_ptr_.parts.top) // worth 6% - maybe could be optimized
                 {
-                    line_[write_ptr_prev_] = sample;
+                    Store(write_ptr_prev_, sample);
                     // prevent underflow (might cause artifacts but I don't hear any)
                     if (write_ptr_prev_ == 0)
                         break;
@@ -355,7 +479,7 @@ public:
             {
                 while (write_ptr_prev_ <= write_ptr_.parts.top)
                 {
-                    line_[write_ptr_prev_++] = sample;
+                    Store(write_ptr_prev_++, sample);
                 }
             }
         }
@@ -380,25 +504,129 @@ public:
      * @brief Get a sample, it's distance (delay) from the newest is set by SetDelay()
      * @return A single sample from the delay line
      */
-    T Read()
+    Sample Read()
     {
         // Increment read pointer
         IncrementPointer(&read_ptr_, &write_ptr_inc_, length_read_, reverse_);
 
         // Calculate the delay position pointer (slew limited)
+        if constexpr (kSlew == DelaySlew::BITS_32)
+        {
+            // smooth * (1 - 2^-N) + delay * 2^-N, the subtraction rounds up so it settles exactly on the delay
+#if SLEW_TYPE == SLEW_TYPE_SLOW
+            delay_smooth_ = delay_smooth_ - (delay_smooth_ >> 12) + (delay_ << (slew_fraction_bits_ - 12));
+#elif SLEW_TYPE == SLEW_TYPE_FAST
+            delay_smooth_ = delay_smooth_ - (delay_smooth_ >> 10) + (delay_ << (slew_fraction_bits_ - 10));
+#endif
+        }
+        else
+        {
 #if SLEW_TYPE == SLEW_TYPE_SLOW
-        delay_smooth_.big = (static_cast<uint64_t>(delay_) << 20) + ((delay_smooth_.big * 4095) >> 12);
+            delay_smooth_.big = (static_cast<uint64_t>(delay_) << 20) + ((delay_smooth_.big * 4095) >> 12);
 #elif SLEW_TYPE == SLEW_TYPE_FAST
-        delay_smooth_.big = (static_cast<uint64_t>(delay_) << 22) + ((delay_smooth_.big * 1023) >> 10);
+            delay_smooth_.big = (static_cast<uint64_t>(delay_) << 22) + ((delay_smooth_.big * 1023) >> 10);
 #endif
 
-        // For short delays, make sure they are always correct
-        if (delay_ <= kShortDelay && delay_smooth_.parts.top > delay_ && delay_smooth_.parts.top - delay_ < 10 && delay_smooth_.parts.top - delay_ > 0)
+            // For short delays, make sure they are always correct
+            if (delay_ <= kShortDelay && delay_smooth_.parts.top > delay_ && delay_smooth_.parts.top - delay_ < 10 && delay_smooth_.parts.top - delay_ > 0)
+            {
+                delay_smooth_.parts.top++;
+            }
+        }
+        const size_t index = Wrap(length_read_ + read_ptr_.parts.top - GetDelay(), length_read_);
+        if (fill_ && !IsCleared(index))
+        {
+            return Sample(0);
+        }
+        return Storage::Load(line_, index);
+    }
+
+    /**
+     * @brief Whether the delay settled on the SetDelay() value, so the reads step through the line one by one.
+     * @note Only DelaySlew::BITS_32 settles exactly, the 64-bit slew always reads as gliding.
+     */
+    inline bool IsDelaySettled() const
+    {
+        if constexpr (kSlew == DelaySlew::BITS_32)
+        {
+            return delay_smooth_ == delay_ << slew_fraction_bits_;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Writes a block, the same as Write() for each sample.
+     * @details Forward at the normal speed, the line wraps once per block and the samples are stored in spans.
+     * @param samples The samples to write, converted to Sample as by Write().
+     * @param count Number of samples.
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo.
+     */
+    template <typename U>
+    void WriteBlock(const U *samples, const size_t count, const size_t stride = 1)
+    {
+        if (count == 0 || IsOversampling(&write_ptr_inc_) || reverse_ || fill_)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                Write(static_cast<Sample>(samples[i * stride]));
+            }
+            return;
+        }
+
+        const size_t length = length_write_;
+        const size_t first = Wrap(length + write_ptr_.parts.top + 1, length);
+        size_t position = first;
+        for (size_t done = 0; done < count; position = 0)
+        {
+            const size_t span = std::min(count - done, length - position);
+            for (size_t i = 0; i < span; i++)
+            {
+                Storage::Store(line_, position + i, static_cast<Sample>(samples[(done + i) * stride]));
+            }
+            done += span;
+        }
+        write_ptr_.parts.top = Wrap(first + count - 1, length);
+        recorded_samples_.big += write_ptr_inc_.big * count;
+    }
+
+    /**
+     * @brief Reads a block, the same as Read() for each sample.
+     * @details Forward at the normal speed with the delay settled (IsDelaySettled()), the line wraps once per block
+     *          and the samples are loaded in spans. Reading a block before writing it
+     *          is the same as interleaving them only when the delay is at least the block.
+     * @param samples Where to store the samples, converted from Sample.
+     * @param count Number of samples.
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo.
+     */
+    template <typename U>
+    void ReadBlock(U *samples, const size_t count, const size_t stride = 1)
+    {
+        // A delay over the loop length wraps the 32-bit index in Read(), the positions aren't a span then
+        if (count == 0 || IsOversampling(&write_ptr_inc_) || reverse_ || fill_ || !IsDelaySettled() || GetDelay() > length_read_)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                samples[i * stride] = Read();
+            }
+            return;
+        }
+
+        const size_t length = length_read_;
+        const size_t first = Wrap(length + read_ptr_.parts.top + 1, length);
+        size_t position = Wrap(length + first - GetDelay(), length);
+        for (size_t done = 0; done < count; position = 0)
         {
-            delay_smooth_.parts.top++;
+            const size_t span = std::min(count - done, length - position);
+            for (size_t i = 0; i < span; i++)
+            {
+                samples[(done + i) * stride] = Storage::Load(line_, position + i);
+            }
+            done += span;
         }
-        T a = line_[(length_read_ + read_ptr_.parts.top - (delay_smooth_.parts.top)) % length_read_];
-        return a;
+        read_ptr_.parts.top = Wrap(first + count - 1, length);
     }
 
     /**
@@ -418,19 +646,75 @@ public:
     }
 
 private:
+    // Whether the background clear of Reset() got past the sample, forgets the clear once it's done
+    inline bool IsCleared(const size_t index)
+    {
+        if (DmaFill::IsDone(fill_))
+        {
+            fill_ = 0;
+            return true;
+        }
+        return DmaFill::IsFilled(fill_, Storage::Items(index + 1) * sizeof(Item));
+    }
+
+    inline void Store(const size_t index, const Sample sample)
+    {
+        while (fill_ && !IsCleared(index))
+        {
+        }
+        Storage::Store(line_, index, sample);
+    }
+
     expanded_t write_ptr_ = {0};
     size_t write_ptr_prev_ = 0;
     expanded_t write_ptr_inc_ = {0};
     expanded_t read_ptr_ = {0};
     size_t delay_ = 0;
-    expanded_t delay_smooth_ = {0};
+    std::conditional_t<kSlew == DelaySlew::BITS_32, uint32_t, expanded_t> delay_smooth_ = {0};
+    uint32_t slew_fraction_bits_ = 16; // DelaySlew::BITS_32 only
     size_t max_length_ = 0;
+    size_t mask_ = 0; // max_length_ - 1 when it's a power of two, 0 otherwise
     size_t length_read_ = 0;
     size_t length_write_ = 0;
     expanded_t recorded_samples_ = {0};
     bool reverse_ = false;
-    std::unique_ptr<T[]> line_;
+    Item *line_ = nullptr;
+    DmaFill::Ticket fill_ = 0; // background clear of the buffer, 0 when it's cleared
+    std::unique_ptr<Item[]> owned_line_; // only when allocated by the delay line itself
 
     static constexpr size_t kShortDelay = 48; // do corrections only for delays shorter than this
+
+    // Fraction bits of the BITS_32 slew, the whole line has to fit the integer part
+    static constexpr uint32_t SlewFractionBits(const size_t length)
+    {
+        uint32_t bits = 16;
+        while (bits > kSlewShift && length > (size_t{1} << (32 - bits)))
+        {
+            bits--;
+        }
+        return bits;
+    }
+
+    static constexpr size_t LimitLength(const size_t length)
+    {
+        if constexpr (kSlew == DelaySlew::BITS_32)
+        {
+            return length < kMaxLength32BitSlew ? length : kMaxLength32BitSlew;
+        }
+        else
+        {
+            return length;
+        }
+    }
+
+    // Loop lengths between 1 and max_length_, an empty loop would divide by zero in IncrementPointer()
+    inline size_t ClampLength(const size_t length) const
+    {
+        if (length < 1)
+        {
+            return 1;
+        }
+        return length <= max_length_ ? length : max_length_;
+    }
 };
 }
@@ -0,0 +1,204 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class BandMeter
+ * @ingroup dsp_utility
+ * @brief Peak levels of a few frequency bands for a meter, filtered at a fraction of the sample rate.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The stereo input is summed to mono and decimated by kDecimation (the mean of the frames). Three one-pole lowpass
+ * filters split it at kCrossovers: the lowest band is the first lowpass, the middle ones the differences of the
+ * neighbouring lowpasses and the highest one the rest above the last lowpass, so the bands sum back to the input.
+ * Each band keeps the peak of its absolute value. Update() holds the peaks (kHoldSeconds) and lets them fall
+ * (kFallDbPerSecond), call it at a steady rate, eg. for each frame of the meter.
+ */
+class BandMeter
+{
+public:
+    /**
+     * @brief Number of bands.
+     */
+    static constexpr size_t kBands = 4;
+
+    /**
+     * @brief Frames averaged into one filtered sample.
+     */
+    static constexpr size_t kDecimation = 2;
+
+    /**
+     * @brief Edges between the bands, Hz.
+     */
+    static constexpr float kCrossovers[kBands - 1] = {200.0f, 1000.0f, 4000.0f};
+
+    /**
+     * @brief How long a peak stays before it falls.
+     */
+    static constexpr float kHoldSeconds = 0.5f;
+
+    /**
+     * @brief How fast the held peaks fall.
+     */
+    static constexpr float kFallDbPerSecond = 24.0f;
+
+    /**
+     * @brief Initializes the filters and clears the levels.
+     * @param sample_rate Rate of the frames passed to Process().
+     * @param update_rate Rate of the Update() calls.
+     */
+    void Init(const float sample_rate, const float update_rate)
+    {
+        constexpr float kPi = 3.14159265358979323846f;
+        const float rate = sample_rate / kDecimation;
+        for (size_t i = 0; i < kBands - 1; i++)
+        {
+            coefficients_[i] = static_cast<q15_t>((1.0f - std::exp(-2.0f * kPi * kCrossovers[i] / rate)) * 32767.0f);
+            lowpass_[i] = 0;
+        }
+        for (size_t i = 0; i < kBands; i++)
+        {
+            peaks_[i] = 0;
+            levels_[i] = 0;
+            hold_[i] = 0;
+        }
+        hold_updates_ = static_cast<uint32_t>(kHoldSeconds * update_rate);
+        fall_ = static_cast<q15_t>(std::pow(10.0f, -kFallDbPerSecond / 20.0f / update_rate) * 32767.0f);
+        sum_ = 0;
+        phase_ = 0;
+    }
+
+    /**
+     * @brief Filters the frames and updates the peaks of the bands.
+     * @param input Interleaved stereo frames.
+     * @param frames Number of frames.
+     */
+    void Process(const q15_t *input, const size_t frames)
+    {
+        for (size_t i = 0; i < frames; i++)
+        {
+            sum_ += input[2 * i] + input[2 * i + 1];
+            if (++phase_ < kDecimation)
+            {
+                continue;
+            }
+            const q15_t x = sum_ / static_cast<int32_t>(2 * kDecimation);
+            sum_ = 0;
+            phase_ = 0;
+
+            // The differences are 17 bits at most, the products fit 32 bits
+            q15_t below = 0;
+            for (size_t band = 0; band < kBands - 1; band++)
+            {
+                lowpass_[band] += ((x - lowpass_[band]) * coefficients_[band]) >> 15;
+                Peak(band, lowpass_[band] - below);
+                below = lowpass_[band];
+            }
+            Peak(kBands - 1, x - below);
+        }
+    }
+
+    /**
+     * @brief Moves the peaks since the last update into the levels, holding and falling.
+     */
+    void Update()
+    {
+        for (size_t i = 0; i < kBands; i++)
+        {
+            const q15_t peak = peaks_[i] > Q15_MAX ? Q15_MAX : peaks_[i];
+            peaks_[i] = 0;
+            if (peak >= levels_[i])
+            {
+                levels_[i] = peak;
+                hold_[i] = hold_updates_;
+            }
+            else if (hold_[i] > 0)
+            {
+                hold_[i]--;
+            }
+            else
+            {
+                levels_[i] = std::max(peak, q15_mult(levels_[i], fall_));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the held peak of the band.
+     * @param band Band from the lowest, less than kBands.
+     * @return Peak level, 0 to Q15_MAX.
+     */
+    q15_t GetLevel(const size_t band) const
+    {
+        return levels_[band];
+    }
+
+    /**
+     * @brief Maps a level to a brightness, 6 dB per 32 steps (48 dB from full brightness to dark).
+     * @param level Level from GetLevel().
+     * @return Brightness 0 to 255.
+     */
+    static uint8_t ToBrightness(const q15_t level)
+    {
+        if (level <= 0)
+        {
+            return 0;
+        }
+        // The bit length and the 3 bits after the leading one, 8 steps per 6 dB, Q15_MAX is 119
+        const int32_t bits = 32 - __builtin_clz(static_cast<uint32_t>(level));
+        const int32_t fraction = ((level << (16 - bits)) >> 12) & 7;
+        const int32_t steps = ((bits - 1) * 8 + fraction - (119 - 64)) * 4;
+        return static_cast<uint8_t>(steps < 0 ? 0 : (steps > 255 ? 255 : steps));
+    }
+
+private:
+    inline void Peak(const size_t band, const q15_t value)
+    {
+        const q15_t magnitude = value < 0 ? -value : value;
+        peaks_[band] = magnitude > peaks_[band] ? magnitude : peaks_[band];
+    }
+
+    q15_t coefficients_[kBands - 1] = {}; ///< One-pole lowpass coefficients, Q15
+    q15_t lowpass_[kBands - 1] = {};      ///< Lowpass states
+    q15_t peaks_[kBands] = {};            ///< Peaks since the last Update(), the top band may exceed Q15_MAX
+    q15_t levels_[kBands] = {};           ///< Held and falling peaks
+    uint32_t hold_[kBands] = {};          ///< Updates left before the level falls
+    uint32_t hold_updates_ = 0;
+    q15_t fall_ = 0; ///< Fall per update, Q15
+    int32_t sum_ = 0;
+    uint32_t phase_ = 0;
+};
+
+}
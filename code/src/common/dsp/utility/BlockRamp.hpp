@@ -0,0 +1,233 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "common/core/Divider.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class BlockRamp
+ * @ingroup dsp_utility
+ * @brief Audio rate smoothing of a parameter, one ramp over each audio block.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * A Slewer called per sample costs a call and two branches per frame and parameter. The ramp is
+ * calculated once per block instead (Start()), from the value at the end of the previous block
+ * to the new one, and the DSP loop takes it as an array (Process()). When the value didn't change,
+ * IsRamping() is false and the loop can use the constant GetValue() without generating anything.
+ *
+ * Shapes:
+ * - LINEAR reaches the target at the end of the block,
+ * - ONE_POLE moves 1 / 2^shift of the remaining distance each block (linear within the block),
+ *   for bigger jumps which would click even when ramped over one block.
+ *
+ * @code
+ * // UiLoop
+ * mix_ramp_.SetValue(mix);
+ * // AudioLoop
+ * if (mix_ramp_.Start(size))
+ * {
+ *     q15_t mix[AUDIO_BUFFER_SIZE];
+ *     mix_ramp_.Process(mix, size);
+ *     ... per sample mix[i]
+ * }
+ * else
+ * {
+ *     ... constant mix_ramp_.GetValue()
+ * }
+ * @endcode
+ *
+ * @note Process() continues where the previous one stopped, so a block processed in sub-blocks calls Start()
+ *       once and Process() for each of them. The difference of two values must fit int32_t.
+ */
+class BlockRamp
+{
+public:
+    /**
+     * @brief Shape of the smoothing
+     */
+    enum class Shape : uint8_t
+    {
+        LINEAR,   ///< The target is reached at the end of the block
+        ONE_POLE, ///< A part of the remaining distance each block
+    };
+
+    /**
+     * @brief Initializes the ramp, the value is there already (no ramp).
+     * @param value The initial value
+     * @param shape The smoothing shape
+     * @param shift ONE_POLE moves 1 / 2^shift of the distance each block
+     */
+    void Init(const int32_t value = 0, const Shape shape = Shape::LINEAR, const uint8_t shift = 2)
+    {
+        target_value_ = value;
+        current_value_ = value;
+        shape_ = shape;
+        shift_ = shift;
+        ramping_ = false;
+    }
+
+    /**
+     * @brief Updates the value the next blocks will ramp to
+     * @param value The target value
+     */
+    void SetValue(const int32_t value)
+    {
+        target_value_ = value;
+    }
+
+    /**
+     * @brief Jumps to the target value, the next block doesn't ramp
+     */
+    void Jump()
+    {
+        current_value_ = target_value_;
+    }
+
+    /**
+     * @brief Calculates the ramp of a block, call it once at the block start.
+     * @param size Number of frames of the block
+     * @return True if the value ramps in this block, false if it stays at GetValue()
+     */
+    bool Start(const size_t size)
+    {
+        const int32_t difference = target_value_ - current_value_;
+        ramping_ = difference != 0 && size > 0;
+        if (!ramping_)
+        {
+            return false;
+        }
+
+        // Where this block ends
+        int32_t distance = difference;
+        if (shape_ == Shape::ONE_POLE)
+        {
+            distance = difference >> shift_;
+            // The last steps are smaller than the resolution, finish them at once
+            if (distance == 0 || distance == -1)
+            {
+                distance = difference;
+            }
+        }
+
+        // Step per frame, whole part rounded down and the rest as a 16 bit fraction
+        const Divider::Result step = Divider::DivMod(distance, static_cast<int32_t>(size));
+        step_ = step.quotient;
+        int32_t remainder = step.remainder;
+        if (remainder < 0)
+        {
+            step_--;
+            remainder += static_cast<int32_t>(size);
+        }
+        step_fraction_ = Divider::Quotient<uint32_t>(static_cast<uint32_t>(remainder) << 16, static_cast<uint32_t>(size));
+        fraction_ = 0;
+        value_ = current_value_;
+        end_value_ = current_value_ + distance;
+        remaining_ = size;
+
+        // The block ends there, whether or not all of it is processed
+        current_value_ = end_value_;
+        return true;
+    }
+
+    /**
+     * @brief Writes the next values of the block ramp, the last frame of the block gets the end value exactly.
+     * @param output The values, one per frame
+     * @param count Number of frames
+     */
+    void Process(int32_t *output, const size_t count)
+    {
+        if (!ramping_)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                output[i] = current_value_;
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            fraction_ += step_fraction_;
+            value_ += step_ + static_cast<int32_t>(fraction_ >> 16);
+            fraction_ &= 0xFFFF;
+            output[i] = value_;
+        }
+        if (count >= remaining_)
+        {
+            output[remaining_ - 1] = end_value_;
+            value_ = end_value_;
+            remaining_ = 0;
+        }
+        else
+        {
+            remaining_ -= count;
+        }
+    }
+
+    /**
+     * @brief Returns the value at the end of the current block (the constant when not ramping)
+     */
+    int32_t GetValue() const
+    {
+        return current_value_;
+    }
+
+    /**
+     * @brief Returns whether the current block ramps (set by Start())
+     */
+    bool IsRamping() const
+    {
+        return ramping_;
+    }
+
+    /**
+     * @brief Check if the ramp has reached its target
+     * @return True if the value equals the target value
+     */
+    bool IsAtTarget() const
+    {
+        return current_value_ == target_value_;
+    }
+
+private:
+    int32_t target_value_ = 0;
+    int32_t current_value_ = 0;
+    int32_t end_value_ = 0;
+    int32_t value_ = 0;
+    int32_t step_ = 0;
+    uint32_t step_fraction_ = 0;
+    uint32_t fraction_ = 0;
+    size_t remaining_ = 0;
+    Shape shape_ = Shape::LINEAR;
+    uint8_t shift_ = 2;
+    bool ramping_ = false;
+};
+}
@@ -0,0 +1,118 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <cstddef>
+#include <tuple>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class Chain
+ * @ingroup dsp_utility
+ * @brief Serial chain of mono processors, put together at compile time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The stages are members of the chain (no pointers, no virtual calls), so the compiler sees the whole
+ * chain and can inline it into the caller's loop. A stage is anything with
+ * `q15_t Process(q15_t)` and `void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride)`,
+ * eg. FixedSvf, SoftClipper, HardClipper or DjFilter.
+ *
+ * @code
+ * Chain<FixedSvf<Svf::Type::LOWPASS>, SoftClipper> chain;
+ * chain.Get<0>().Init(SAMPLE_RATE);
+ * chain.Get<1>().SetDrive(q15(0.5f));
+ * chain.ProcessBlock(input, output, AUDIO_BUFFER_SIZE);
+ * @endcode
+ *
+ * @note Stereo processors (StereoDelay, SvfStereo...) have their own interfaces and are not stages.
+ * @tparam Stages The processors, in the order the signal goes through them
+ */
+template <typename... Stages>
+class Chain
+{
+    static_assert(sizeof...(Stages) > 0, "At least one stage is needed");
+
+public:
+    /**
+     * @brief Returns a stage, to initialize or control it
+     * @tparam kIndex Index of the stage in the chain
+     */
+    template <size_t kIndex>
+    inline auto &Get()
+    {
+        return std::get<kIndex>(stages_);
+    }
+
+    /**
+     * @brief Processes one sample through all the stages
+     * @param input The input sample
+     * @return The output of the last stage
+     */
+    inline q15_t Process(q15_t input)
+    {
+        return ProcessStage<0>(input);
+    }
+
+    /**
+     * @brief Processes a block through all the stages, one stage over the whole block at a time
+     * @param input Input samples
+     * @param output Output samples (can be the same as input)
+     * @param size Number of samples to process
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo
+     */
+    inline void ProcessBlock(const q15_t *input, q15_t *output, size_t size, size_t stride = 1)
+    {
+        std::apply(
+            [&](auto &first, auto &...rest)
+            {
+                first.ProcessBlock(input, output, size, stride);
+                // The rest works in place on the output
+                (rest.ProcessBlock(output, output, size, stride), ...);
+            },
+            stages_);
+    }
+
+private:
+    template <size_t kIndex>
+    inline q15_t ProcessStage(q15_t sample)
+    {
+        sample = std::get<kIndex>(stages_).Process(sample);
+        if constexpr (kIndex + 1 < sizeof...(Stages))
+        {
+            return ProcessStage<kIndex + 1>(sample);
+        }
+        else
+        {
+            return sample;
+        }
+    }
+
+    std::tuple<Stages...> stages_;
+};
+}
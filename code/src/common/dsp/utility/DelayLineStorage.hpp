@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Sample type tag of the delay lines storing 12-bit samples, two of them packed in three bytes.
+ * @ingroup dsp_utility
+ *
+ * `AdvancedDynamicDelayLine<Packed12Sample>` is written and read in q15_t, keeps the top 12 bits of each sample
+ * (72 dB of dynamic range) and takes 75% of the memory of the 16-bit line. See MuLawSample for half of the memory.
+ */
+struct Packed12Sample
+{
+};
+
+/**
+ * @brief How the delay lines keep their samples in memory.
+ * @ingroup dsp_utility
+ * @tparam T Sample type of the delay line, stored as it is by default.
+ *
+ * Sample is the type of Write() and Read(), Item the element of the buffer. The lines index the samples
+ * through Load() and Store(), the storages other than an array of T specialize this.
+ */
+template <typename T>
+struct DelayLineStorage
+{
+    using Sample = T;
+    using Item = T;
+
+    /**
+     * @brief Byte of a buffer of silence, -1 when the silent item isn't one byte repeated.
+     */
+    static constexpr int kSilenceByte = []
+    {
+        const auto bytes = std::bit_cast<std::array<uint8_t, sizeof(Item)>>(Item(Sample(0)));
+        for (const uint8_t byte : bytes)
+        {
+            if (byte != bytes[0])
+            {
+                return -1;
+            }
+        }
+        return static_cast<int>(bytes[0]);
+    }();
+
+    /**
+     * @brief Returns the number of items holding the samples.
+     */
+    static constexpr size_t Items(const size_t samples)
+    {
+        return samples;
+    }
+
+    /**
+     * @brief Returns the number of samples the items hold.
+     */
+    static constexpr size_t Samples(const size_t items)
+    {
+        return items;
+    }
+
+    static inline Sample Load(const Item *line, const size_t index)
+    {
+        return line[index];
+    }
+
+    static inline void Store(Item *line, const size_t index, const Sample sample)
+    {
+        line[index] = sample;
+    }
+};
+
+/**
+ * @brief Packed 12-bit storage: the even sample in the first byte and the low nibble of the second byte,
+ *        the odd sample in the high nibble of the second byte and the third byte.
+ */
+template <>
+struct DelayLineStorage<Packed12Sample>
+{
+    using Sample = q15_t;
+    using Item = uint8_t;
+
+    static constexpr int kSilenceByte = 0;
+
+    static constexpr size_t Items(const size_t samples)
+    {
+        return (samples * 3 + 1) / 2;
+    }
+
+    static constexpr size_t Samples(const size_t items)
+    {
+        return items * 2 / 3;
+    }
+
+    static inline Sample Load(const Item *line, const size_t index)
+    {
+        const Item *pair = line + (index >> 1) * 3;
+        uint32_t code;
+        if (index & 1)
+        {
+            code = (pair[1] >> 4) | (static_cast<uint32_t>(pair[2]) << 4);
+        }
+        else
+        {
+            code = pair[0] | (static_cast<uint32_t>(pair[1] & 0x0F) << 8);
+        }
+        // Sign extend the 12 bits back to q15
+        return static_cast<int32_t>(code << 20) >> 16;
+    }
+
+    static inline void Store(Item *line, const size_t index, const Sample sample)
+    {
+        const uint32_t code = static_cast<uint32_t>(q15_saturate(sample) >> 4) & 0x0FFF;
+        Item *pair = line + (index >> 1) * 3;
+        if (index & 1)
+        {
+            pair[1] = static_cast<Item>((pair[1] & 0x0F) | (code << 4));
+            pair[2] = static_cast<Item>(code >> 4);
+        }
+        else
+        {
+            pair[0] = static_cast<Item>(code);
+            pair[1] = static_cast<Item>((pair[1] & 0xF0) | (code >> 8));
+        }
+    }
+};
+
+}
@@ -28,11 +28,22 @@ using namespace kastle2;
 
 void KastleRungler::Init(int8_t shift_result)
 {
-    shift_register_ = rand() & 0xFF;
-    shift_result_ = shift_result;
+    random_.Seed(Xorshift32::HardwareSeed());
+    shift_register_ = random_.Next() >> 24;
+    SetShiftResult(shift_result);
     steps_ = 0;
 }
 
+void KastleRungler::SetShiftResult(int8_t shift_result)
+{
+    shift_result_ = shift_result;
+    for (size_t i = 0; i < output_map_.size(); i++)
+    {
+        output_map_[i] = kVoltageMap[i] << shift_result_;
+    }
+    UpdateOutput();
+}
+
 uint32_t KastleRungler::GetOutput()
 {
     return output_;
@@ -42,10 +53,7 @@ void KastleRungler::Reset()
 {
     // Shift the register to the right by the number of steps to "start from beginning"
     uint8_t how_many_shift = kLength - 1 - (steps_ % kLength);
-    for (size_t i = 0; i < how_many_shift; i++)
-    {
-        Step(SAME);
-    }
+    Advance(how_many_shift, SAME);
     steps_ = kLength - 1; // 0 doesn't work here, because we are increasing it in Step() right away
 }
 
@@ -67,11 +75,55 @@ uint32_t KastleRungler::Step(BitIn bit_in)
         new_bit = !new_bit;
         break;
     case RANDOM:
-        new_bit = rand() & 1;
+        new_bit = random_.NextBit();
+        break;
+    default:
         break;
     }
     bit_write(shift_register_, 0, new_bit);
 
+    UpdateOutput();
+    return output_;
+}
+
+uint32_t KastleRungler::Advance(size_t steps, BitIn bit_in)
+{
+    steps_ += steps;
+
+    switch (bit_in)
+    {
+    case SAME:
+        // Rotation, repeats every 8 steps
+        steps %= kLength;
+        shift_register_ = static_cast<uint8_t>((shift_register_ << steps) | (shift_register_ >> (kLength - steps)));
+        break;
+    case INVERT:
+        // Rotation inverting the bits, 8 steps invert the whole register
+        steps %= 2 * kLength;
+        if (steps >= kLength)
+        {
+            shift_register_ = ~shift_register_;
+            steps -= kLength;
+        }
+        shift_register_ = static_cast<uint8_t>((shift_register_ << steps) | (shift_register_ >> (kLength - steps)));
+        shift_register_ ^= (1u << steps) - 1;
+        break;
+    case RANDOM:
+        // 8 random bits replace the whole register
+        steps = steps < kLength ? steps : kLength;
+        for (size_t i = 0; i < steps; i++)
+        {
+            shift_register_ = static_cast<uint8_t>((shift_register_ << 1) | random_.NextBit());
+        }
+        break;
+    }
+
+    UpdateOutput();
+    return output_;
+}
+
+void KastleRungler::UpdateOutput()
+{
     // Make output index
     uint8_t map_index = 0;
     bit_write(map_index, 0, bit_read(shift_register_, 0));
@@ -79,6 +131,5 @@ uint32_t KastleRungler::Step(BitIn bit_in)
     bit_write(map_index, 2, bit_read(shift_register_, 5));
 
     // Use the value from PWM map as the result
-    output_ = kVoltageMap[map_index] << shift_result_;
-    return output_;
-}
\ No newline at end of file
+    output_ = output_map_[map_index];
+}
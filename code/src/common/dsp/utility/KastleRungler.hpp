@@ -24,8 +24,11 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include "common/dsp/math/Xorshift32.hpp"
 #include "common/dsp/math/bit_utils.hpp"
 
 namespace kastle2
@@ -69,6 +72,12 @@ public:
      */
     void Init(int8_t shift_result = kDefaultShiftResult);
 
+    /**
+     * @brief Sets how to shift the result and rebuilds the output map.
+     * @param shift_result How to shift the result (use `2` for 0-1023 range)
+     */
+    void SetShiftResult(int8_t shift_result);
+
     /**
      * @brief Fake reset, Steps() the register with Same to "start from beginning".
      */
@@ -93,11 +102,31 @@ public:
      */
     uint32_t Step(BitIn bit_in);
 
+    /**
+     * @brief Advances the register by a number of steps at once, as if Step() was called that many times.
+     * @param steps Number of steps to advance
+     * @param bit_in The input signal to generate the new bits.
+     * @return The new output value.
+     *
+     * The register only rotates with SAME and rotates with inverted bits with INVERT (all bits inverted
+     * after 8 steps), so at most 8 steps are made whatever the count. For fast-forwarding after a resync.
+     */
+    uint32_t Advance(size_t steps, BitIn bit_in);
+
 private:
+    /**
+     * @brief Updates the output from the current register.
+     */
+    void UpdateOutput();
+
     uint32_t output_ = 0;
     uint8_t shift_register_ = 0;
+    Xorshift32 random_; // Bits of RANDOM, seeded from the hardware in Init()
     int8_t shift_result_ = 0;
     static constexpr uint8_t kVoltageMap[8] = {0, 80, 120, 150, 180, 200, 220, 255};
+
+    // kVoltageMap shifted by shift_result_
+    std::array<uint32_t, 8> output_map_{};
     static constexpr int8_t kDefaultShiftResult = 2; // 256 => 1024
 
     size_t steps_ = 0;
@@ -0,0 +1,109 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+#include "common/dsp/sampling/lookup_sample_companding.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class MuLawSample
+ * @ingroup dsp_utility
+ * @brief 8-bit G.711 µ-law sample, a drop-in storage type for the delay lines with twice the time in the same RAM.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Converts from and to q15_t implicitly, so `AdvancedDynamicDelayLine<MuLawSample>` is used the same way as
+ * the 16-bit line. Each sample is coded on its own, so the reads stay random access (any delay, reverse,
+ * oversampling), unlike ADPCM which decodes from a seek point only.
+ *
+ * The quantization noise follows the signal level (about 38 dB below it, 14-bit resolution near silence).
+ * Decoding a sample and coding it again gives the same code, so the loops which are only played back stay lossless,
+ * each pass mixed in feedback adds the noise of one coding.
+ */
+struct MuLawSample
+{
+    uint8_t code = 0xFF; ///< µ-law code, 0xFF is zero
+
+    constexpr MuLawSample() = default;
+
+    /**
+     * @brief Codes the sample, values outside of the q15 range are clipped.
+     */
+    constexpr MuLawSample(const q15_t sample)
+        : code(Encode(sample)) {}
+
+    /**
+     * @brief Decodes the sample.
+     */
+    constexpr operator q15_t() const
+    {
+        return lookup_sample_mu_law[code];
+    }
+
+    /**
+     * @brief Returns the µ-law code of the sample, same as the G.711 reference encoder.
+     */
+    static constexpr uint8_t Encode(const q15_t sample)
+    {
+        const int32_t sign = sample < 0 ? 0x80 : 0x00;
+        int32_t magnitude = sample < 0 ? -sample : sample;
+        if (magnitude > kClip)
+        {
+            magnitude = kClip;
+        }
+        magnitude += kBias;
+
+        const int32_t exponent = kExponents[magnitude >> 7];
+        const int32_t mantissa = (magnitude >> (exponent + 3)) & 0x0F;
+        return static_cast<uint8_t>(~(sign | (exponent << 4) | mantissa));
+    }
+
+private:
+    static constexpr int32_t kBias = 0x84;
+    static constexpr int32_t kClip = 32635;
+
+    // Segment of the biased magnitude by its top 8 bits (the Cortex-M0+ has no CLZ instruction)
+    static constexpr std::array<uint8_t, 256> kExponents = []
+    {
+        std::array<uint8_t, 256> table{};
+        for (size_t i = 2; i < table.size(); i++)
+        {
+            table[i] = static_cast<uint8_t>(table[i / 2] + 1);
+        }
+        return table;
+    }();
+};
+
+static_assert(sizeof(MuLawSample) == 1, "MuLawSample is stored as one byte");
+static_assert(MuLawSample::Encode(0) == 0xFF && MuLawSample::Encode(-1) == 0x7F, "µ-law zero codes");
+static_assert(MuLawSample(static_cast<q15_t>(MuLawSample(12345))).code == MuLawSample(12345).code, "Coding is idempotent");
+
+}
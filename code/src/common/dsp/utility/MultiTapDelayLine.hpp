@@ -0,0 +1,234 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace kastle2
+{
+
+/**
+ * @class MultiTapDelayLine
+ * @ingroup dsp_utility
+ * @brief Delay line with one write head and kTaps interpolated read heads (taps).
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * Chorus or multi-tap patterns read the same signal at several delays. With AdvancedDynamicDelayLine
+ * each of them needs its own buffer and its own Write(), here they share one buffer and one write.
+ *
+ * Each tap has its own delay, slew limited the same way as AdvancedDynamicDelayLine::SetDelay() with DelaySlew::BITS_32,
+ * and is read with linear interpolation between the two neighbouring samples, so a gliding delay
+ * doesn't step by whole samples. Delay N returns the sample written N writes ago (read before write).
+ *
+ * There is no oversampling, reverse or loop length, use AdvancedDynamicDelayLine for those.
+ *
+ * @note The buffer is allocated on the heap by the length constructor, or passed from the app arena (Kastle2::arena).
+ *       It is used up to kMaxLength samples (16.16 delay smoothing).
+ */
+template <typename T, size_t kTaps>
+class MultiTapDelayLine
+{
+    static_assert(std::is_integral_v<T>, "Interpolation works with integer samples");
+    static_assert(kTaps > 0, "At least one tap is needed");
+
+public:
+    /**
+     * @brief Longest usable delay line, longer buffers are used only up to this length
+     */
+    static constexpr size_t kMaxLength = 0x10000;
+
+    /**
+     * @brief Prepares the delay line and allocates memory
+     * @param max_length The size of the delay line
+     */
+    MultiTapDelayLine(const size_t max_length)
+    {
+        max_length_ = max_length < kMaxLength ? max_length : kMaxLength;
+        owned_line_ = std::make_unique<T[]>(max_length_);
+        line_ = owned_line_.get();
+        Reset();
+    }
+
+    /**
+     * @brief Prepares the delay line over an existing buffer (eg. from Kastle2::arena)
+     * @param line The buffer, its size is the size of the delay line. Must outlive the delay line.
+     */
+    MultiTapDelayLine(const std::span<T> line)
+    {
+        max_length_ = line.size() < kMaxLength ? line.size() : kMaxLength;
+        line_ = line.data();
+        Reset();
+    }
+
+    /**
+     * @brief Returns the max length of the delay buffer
+     * @return Buffer max length in size_t
+     */
+    size_t inline GetMaxLength() const
+    {
+        return max_length_;
+    }
+
+    /**
+     * @brief Clears buffer, sets write pointer to 0, and all the taps to 1 sample
+     */
+    void Reset()
+    {
+        for (size_t i = 0; i < max_length_; i++)
+        {
+            line_[i] = T(0);
+        }
+        write_ptr_ = 0;
+        for (size_t tap = 0; tap < kTaps; tap++)
+        {
+            SetDelaySnap(tap, 1);
+        }
+    }
+
+    /**
+     * @brief Sets the delay time of a tap in samples, the tap glides to it
+     * @param tap The tap index (0 to kTaps - 1)
+     * @param delay The delay time in samples
+     */
+    inline void SetDelay(const size_t tap, const size_t delay)
+    {
+        taps_[tap].delay = ClampDelay(delay);
+    }
+
+    /**
+     * @brief Sets the delay time of a tap in samples directly, without slew limiting
+     * @param tap The tap index (0 to kTaps - 1)
+     * @param delay The delay time in samples
+     */
+    inline void SetDelaySnap(const size_t tap, const size_t delay)
+    {
+        taps_[tap].delay = ClampDelay(delay);
+        taps_[tap].smooth = taps_[tap].delay << 16;
+    }
+
+    /**
+     * @brief Gets the delay value of a tap after smoothing (whole samples)
+     * @param tap The tap index (0 to kTaps - 1)
+     * @return The delay time in samples
+     */
+    inline size_t GetDelay(const size_t tap) const
+    {
+        return taps_[tap].smooth >> 16;
+    }
+
+    /**
+     * @brief Writes the sample to the delay line and advances the write pointer.
+     * @param sample The sample to write
+     */
+    inline void Write(const T sample)
+    {
+        line_[write_ptr_] = sample;
+        write_ptr_ = write_ptr_ + 1 < max_length_ ? write_ptr_ + 1 : 0;
+    }
+
+    /**
+     * @brief Reads one tap, call it once per tap and sample (it advances the tap's slew)
+     * @param tap The tap index (0 to kTaps - 1)
+     * @return Interpolated sample, its distance from the newest is set by SetDelay()
+     */
+    inline T Read(const size_t tap)
+    {
+        return ReadTap(taps_[tap]);
+    }
+
+    /**
+     * @brief Reads all the taps and writes the input, for each sample of the block
+     * @param input Samples to write
+     * @param output Tap outputs, kTaps interleaved values for each sample (output[i * kTaps + tap])
+     * @param size Number of samples
+     * @note Only for taps without feedback, a feedback path needs Read() and Write() per sample.
+     */
+    void ProcessBlock(const T *input, T *output, const size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            for (size_t tap = 0; tap < kTaps; tap++)
+            {
+                output[i * kTaps + tap] = ReadTap(taps_[tap]);
+            }
+            Write(input[i]);
+        }
+    }
+
+private:
+    // Smoothed delay is 16.16, samples in the top 16 bits, fraction in the bottom
+    struct Tap
+    {
+        size_t delay;
+        uint32_t smooth;
+    };
+
+    inline size_t ClampDelay(const size_t delay) const
+    {
+        // The interpolation reads one sample further than the delay
+        if (delay < 1)
+        {
+            return 1;
+        }
+        return delay < max_length_ - 1 ? delay : max_length_ - 2;
+    }
+
+    // Wraps the index of the sample written `delay` writes ago
+    inline size_t Index(const size_t delay) const
+    {
+        return write_ptr_ >= delay ? write_ptr_ - delay : write_ptr_ + max_length_ - delay;
+    }
+
+    inline T ReadTap(Tap &tap)
+    {
+        // Same slew as AdvancedDynamicDelayLine (SLEW_TYPE_FAST, DelaySlew::BITS_32)
+        tap.smooth = tap.smooth - (tap.smooth >> 10) + (tap.delay << 6);
+
+        size_t delay = tap.smooth >> 16;
+        int32_t fraction = static_cast<int32_t>(tap.smooth & 0xFFFF) >> 1; // 15 bits
+        // Approaching 1 from below
+        if (delay < 1)
+        {
+            delay = 1;
+            fraction = 0;
+        }
+
+        const int32_t newer = line_[Index(delay)];
+        const int32_t older = line_[Index(delay + 1)];
+        return static_cast<T>(newer + (((older - newer) * fraction) >> 15));
+    }
+
+    std::array<Tap, kTaps> taps_;
+    size_t write_ptr_ = 0;
+    size_t max_length_ = 0;
+    T *line_ = nullptr;
+    std::unique_ptr<T[]> owned_line_; // only when allocated by the delay line itself
+};
+}
@@ -0,0 +1,279 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @brief Quality of the Oversampler half-band filters, selected at compile time
+ */
+enum class OversamplerQuality : uint8_t
+{
+    LOW,  ///< 15 taps (4 multiplies per filter and sample), flat to 0.3 of the base rate, -53 dB images
+    HIGH, ///< 31 taps (8 multiplies per filter and sample), flat to 0.4 of the base rate, -52 dB images
+};
+
+/**
+ * @class HalfBand
+ * @ingroup dsp_utility
+ * @brief Polyphase half-band FIR interpolator and decimator by 2, in Q15.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * A half-band filter has every other coefficient zero, apart from the center one (0.5), so one of the two
+ * polyphase branches is a plain delay. The coefficients of the other one are symmetric and each pair is
+ * folded to one multiply of the summed samples: kPairs multiplies per output pair (interpolation)
+ * or per output sample (decimation).
+ *
+ * The coefficients are in Q14 (twice the half-band ones, so each branch has the gain of 1), which keeps
+ * the folded sums of full scale samples within 32 bits.
+ *
+ * @tparam kPairs Number of coefficient pairs, the filter has 4 * kPairs - 1 taps
+ */
+template <size_t kPairs>
+class HalfBand
+{
+public:
+    /**
+     * @brief Coefficients of one side of the filter, from the center outwards, their sum is 1 << 13.
+     */
+    using Coefficients = std::array<int32_t, kPairs>;
+
+    /**
+     * @brief Prepares the filter with its coefficients and clears the history
+     */
+    constexpr explicit HalfBand(const Coefficients &coefficients) : coefficients_(coefficients)
+    {
+    }
+
+    /**
+     * @brief Clears the history
+     */
+    void Reset()
+    {
+        even_.Reset();
+        odd_.Reset();
+    }
+
+    /**
+     * @brief Interpolates one input sample to two output samples at the double rate.
+     * @param input The input sample
+     * @param first The first output sample
+     * @param second The second output sample
+     */
+    inline void Upsample(const q15_t input, q15_t &first, q15_t &second)
+    {
+        even_.Push(input);
+        first = Fold(even_);
+        // The center tap branch
+        second = even_[kPairs - 1];
+    }
+
+    /**
+     * @brief Decimates two input samples at the double rate to one output sample.
+     * @param first The first input sample
+     * @param second The second input sample
+     * @return The output sample
+     */
+    inline q15_t Downsample(const q15_t first, const q15_t second)
+    {
+        even_.Push(first);
+        odd_.Push(second);
+        return (odd_[kPairs] + Fold(even_)) >> 1;
+    }
+
+private:
+    // History window over a doubled buffer, the newest sample is [0] and no shifting is needed
+    template <size_t kLength>
+    class Window
+    {
+    public:
+        void Reset()
+        {
+            buffer_.fill(0);
+            position_ = 0;
+        }
+
+        inline void Push(const q15_t sample)
+        {
+            position_ = position_ == 0 ? kLength - 1 : position_ - 1;
+            buffer_[position_] = sample;
+            buffer_[position_ + kLength] = sample;
+        }
+
+        inline q15_t operator[](const size_t age) const
+        {
+            return buffer_[position_ + age];
+        }
+
+    private:
+        std::array<q15_t, 2 * kLength> buffer_{};
+        size_t position_ = 0;
+    };
+
+    inline q15_t Fold(const Window<2 * kPairs> &window) const
+    {
+        int32_t sum = 0;
+        for (size_t k = 0; k < kPairs; k++)
+        {
+            sum += coefficients_[k] * (window[kPairs - 1 - k] + window[kPairs + k]);
+        }
+        return q15_saturate((sum + (1 << 13)) >> 14);
+    }
+
+    Coefficients coefficients_;
+    Window<2 * kPairs> even_;
+    Window<kPairs + 1> odd_; // decimation only
+};
+
+/**
+ * @brief Kaiser windowed half-band designs for HalfBand (Q14, one side from the center)
+ */
+struct HalfBandDesigns
+{
+    static constexpr HalfBand<4>::Coefficients kLow{10081, -2516, 797, -170};                       ///< 15 taps, see OversamplerQuality::LOW
+    static constexpr HalfBand<8>::Coefficients kHigh{10352, -3216, 1671, -954, 541, -287, 134, -49}; ///< 31 taps, see OversamplerQuality::HIGH
+    static constexpr HalfBand<2>::Coefficients kShort{9498, -1306};                                 ///< 7 taps, for already band limited signals
+};
+
+/**
+ * @class Oversampler
+ * @ingroup dsp_utility
+ * @brief Runs a nonlinear stage (clipper, waveshaper) at 2x or 4x the sample rate, so its harmonics don't alias.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The input is interpolated by HalfBand filters, the stage processes kFactor samples for each input
+ * sample and the result is decimated back. For 4x the second stage runs on a signal which is already
+ * band limited, so it uses a short (7 tap) filter. One Oversampler keeps the history of one channel.
+ *
+ * @code
+ * Oversampler<2> oversampler;
+ * SoftClipper clipper;
+ * oversampler.ProcessBlock(clipper, input, output, size);
+ * @endcode
+ *
+ * @tparam kFactor 2 or 4
+ * @tparam kQuality Taps of the first filter pair, the cost is kFactor times the stage plus the filters
+ * @note The signal is delayed by about 2 * pairs samples at the base rate (7 for LOW, 15 for HIGH at 2x).
+ */
+template <size_t kFactor, OversamplerQuality kQuality = OversamplerQuality::LOW>
+class Oversampler
+{
+    static_assert(kFactor == 2 || kFactor == 4, "Oversampling by 2 or 4");
+
+    static constexpr size_t kPairs = kQuality == OversamplerQuality::HIGH ? 8 : 4;
+    static constexpr size_t kSecondPairs = 2;
+
+    static constexpr typename HalfBand<kPairs>::Coefficients Design()
+    {
+        if constexpr (kQuality == OversamplerQuality::HIGH)
+        {
+            return HalfBandDesigns::kHigh;
+        }
+        else
+        {
+            return HalfBandDesigns::kLow;
+        }
+    }
+
+public:
+    /**
+     * @brief Clears the filters
+     */
+    void Reset()
+    {
+        up_.Reset();
+        down_.Reset();
+        up_second_.Reset();
+        down_second_.Reset();
+    }
+
+    /**
+     * @brief Processes one sample through the oversampled stage
+     * @param stage Anything with q15_t Process(q15_t), called kFactor times
+     * @param input The input sample
+     * @return The output sample
+     */
+    template <typename Stage>
+    inline q15_t Process(Stage &stage, const q15_t input)
+    {
+        q15_t first, second;
+        up_.Upsample(input, first, second);
+        // In order, the argument evaluation order is unspecified
+        if constexpr (kFactor == 2)
+        {
+            first = stage.Process(first);
+            second = stage.Process(second);
+        }
+        else
+        {
+            first = ProcessSecond(stage, first);
+            second = ProcessSecond(stage, second);
+        }
+        return down_.Downsample(first, second);
+    }
+
+    /**
+     * @brief Processes a block of samples through the oversampled stage
+     * @param stage Anything with q15_t Process(q15_t), called kFactor times per sample
+     * @param input Input samples
+     * @param output Output samples (can be the same as input)
+     * @param size Number of samples to process
+     * @param stride Distance between the samples, use 2 for one channel of interleaved stereo
+     */
+    template <typename Stage>
+    inline void ProcessBlock(Stage &stage, const q15_t *input, q15_t *output, size_t size, size_t stride = 1)
+    {
+        for (size_t i = 0; i < size * stride; i += stride)
+        {
+            output[i] = Process(stage, input[i]);
+        }
+    }
+
+private:
+    template <typename Stage>
+    inline q15_t ProcessSecond(Stage &stage, const q15_t input)
+    {
+        q15_t first, second;
+        up_second_.Upsample(input, first, second);
+        first = stage.Process(first);
+        second = stage.Process(second);
+        return down_second_.Downsample(first, second);
+    }
+
+    HalfBand<kPairs> up_{Design()};
+    HalfBand<kPairs> down_{Design()};
+    // 4x only
+    HalfBand<kSecondPairs> up_second_{HalfBandDesigns::kShort};
+    HalfBand<kSecondPairs> down_second_{HalfBandDesigns::kShort};
+};
+}
@@ -0,0 +1,173 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "lookup_SlewGenerator.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class PortamentoQ15
+ * @ingroup dsp_utility
+ * @brief Fixed point Portamento: an exponential glide with the speed in seconds, advanced a whole block at a time.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The glide covers 99% of the distance in the set time, like Portamento. Instead of one multiplication
+ * per tick, Process() looks up the decay of all the ticks of the block in the SlewGenerator table
+ * (exp(-4 * i / 1023)), so a block costs the same whatever its size. The fraction of the table step carries
+ * over to the next block, so the slow glides don't stall. Once at the target, Process() returns false
+ * and the caller keeps whatever it derived from the value.
+ *
+ * @code
+ * // UiLoop
+ * pitch_glide_.SetValue(pitch);
+ * // AudioLoop
+ * if (pitch_glide_.Process(size))
+ * {
+ *     oscillator_.SetPitch(pitch_glide_.GetValue());
+ * }
+ * @endcode
+ */
+class PortamentoQ15
+{
+public:
+    /**
+     * @brief Initializes the glide, the value is there already.
+     * @param update_rate Ticks per second (eg. the sample rate when Process() gets the frames of the block)
+     * @param value The initial value
+     */
+    void Init(const float update_rate, const int32_t value = 0)
+    {
+        update_rate_ = update_rate;
+        current_value_ = value;
+        target_value_ = value;
+        rate_ = kMaxRate;
+        phase_ = 0;
+    }
+
+    /**
+     * @brief Sets the glide time.
+     * @param speed Seconds to cover 99% of the distance, 0 jumps to the target.
+     */
+    void SetSpeed(const float speed)
+    {
+        if (speed <= 0.0f)
+        {
+            rate_ = kMaxRate;
+            return;
+        }
+        // Table steps per tick: ln(100) over the ticks of the glide, the table covers exp(0) to exp(-4)
+        const float steps = std::log(100.0f) * kLastStep / (4.0f * update_rate_ * speed);
+        rate_ = static_cast<uint32_t>(std::min(steps * 65536.0f, static_cast<float>(kMaxRate)));
+    }
+
+    /**
+     * @brief Updates the value the output glides towards
+     * @param value The target value
+     */
+    void SetValue(const int32_t value)
+    {
+        target_value_ = value;
+    }
+
+    /**
+     * @brief Jumps to the target value
+     */
+    void Jump()
+    {
+        current_value_ = target_value_;
+    }
+
+    /**
+     * @brief Glides for the ticks at once.
+     * @param ticks Number of ticks (eg. the frames of the block)
+     * @return True if the value changed, false when it stayed (at the target)
+     */
+    bool Process(const size_t ticks)
+    {
+        if (current_value_ == target_value_)
+        {
+            phase_ = 0;
+            return false;
+        }
+
+        // Table steps of the ticks, whole ones now and the fraction with the next block
+        const uint64_t index = phase_ + static_cast<uint64_t>(rate_) * ticks;
+        phase_ = static_cast<uint32_t>(index & 0xFFFF);
+        uint64_t steps = index >> 16;
+        if (steps == 0)
+        {
+            return false;
+        }
+
+        // The remaining distance decays, truncated so it reaches zero. A whole table is exp(-4),
+        // an int32_t distance is gone after a few of them
+        const bool below = current_value_ < target_value_;
+        uint64_t distance = below ? static_cast<uint64_t>(static_cast<int64_t>(target_value_) - current_value_)
+                                  : static_cast<uint64_t>(static_cast<int64_t>(current_value_) - target_value_);
+        for (; steps > kLastStep && distance != 0; steps -= kLastStep)
+        {
+            distance = (distance * slew_generator_table[kLastStep]) >> 31;
+        }
+        distance = (distance * slew_generator_table[std::min<uint64_t>(steps, kLastStep)]) >> 31;
+
+        const int64_t remaining = below ? -static_cast<int64_t>(distance) : static_cast<int64_t>(distance);
+        current_value_ = static_cast<int32_t>(target_value_ + remaining);
+        return true;
+    }
+
+    /**
+     * @brief Returns the current value
+     */
+    int32_t GetValue() const
+    {
+        return current_value_;
+    }
+
+    /**
+     * @brief Returns true if the value is at the target
+     */
+    bool IsAtTarget() const
+    {
+        return current_value_ == target_value_;
+    }
+
+private:
+    static constexpr uint32_t kLastStep = SLEW_GENERATOR_TABLE_SIZE - 1;
+    // Four whole tables per tick, the distance is gone at once
+    static constexpr uint32_t kMaxRate = (4 * kLastStep) << 16;
+
+    float update_rate_ = 1.0f;
+    int32_t current_value_ = 0;
+    int32_t target_value_ = 0;
+    uint32_t rate_ = kMaxRate; ///< Table steps per tick (16.16)
+    uint32_t phase_ = 0;       ///< Fraction of the table step carried to the next block (16 bits)
+};
+}
@@ -33,6 +33,7 @@ void Quantizer::Init(const float threshold_semitones)
 {
     enabled_ = false;
     prev_frequency_ = 1.0f;
+    prev_semitones_ = 0;
     threshold_enabled_ = false;
 
     if (threshold_semitones > 0.0f)
@@ -40,6 +41,7 @@ void Quantizer::Init(const float threshold_semitones)
         threshold_enabled_ = true;
         // precalculate the frequency ratio here to avoid doing log2 each Process()
         threshold_ratio_ = std::pow(2.0, threshold_semitones / 12.0);
+        threshold_semitones_ = static_cast<int32_t>(threshold_semitones * kSemitone);
     }
 
     // Set up the default scale table
@@ -60,6 +62,32 @@ void Quantizer::SetScaleTable(std::span<const Scale> scale_table)
 {
     scale_table_ = scale_table;
     scale_index_ = 0;
+    UpdateNoteOffsets();
+}
+
+void Quantizer::UpdateNoteOffsets()
+{
+    const Scale scale = scale_table_.empty() ? 0 : scale_table_[scale_index_];
+    scale_empty_ = (scale & 0xFFF) == 0;
+
+    // The same search as in ProcessMultiplier(), done once per scale and root
+    for (size_t note = 0; note < note_offsets_.size(); ++note)
+    {
+        note_offsets_[note] = 0;
+        for (size_t i = 0; i < 12 && !scale_empty_; ++i)
+        {
+            if ((scale & (1 << ((note + i + scale_root_offset_) % 12))) != 0)
+            {
+                note_offsets_[note] = static_cast<int8_t>(i);
+                break;
+            }
+            if ((scale & (1 << ((note + 12 - i + scale_root_offset_) % 12))) != 0)
+            {
+                note_offsets_[note] = -static_cast<int8_t>(i);
+                break;
+            }
+        }
+    }
 }
 
 float Quantizer::Process(const float frequency)
@@ -238,13 +266,39 @@ float Quantizer::ProcessMultiplier(float multiplier)
     return prev_multiplier_;
 }
 
+FASTCODE int32_t Quantizer::ProcessSemitones(const int32_t semitones)
+{
+    if (!enabled_ || scale_empty_)
+    {
+        return semitones;
+    }
+
+    // Compare it to the previous pitch for hysteresis
+    if (threshold_enabled_ && std::abs(semitones - prev_semitones_) < threshold_semitones_)
+    {
+        return prev_semitones_;
+    }
+
+    // Nearest semitone, and its note in the octave (also for negative pitches)
+    const int32_t semitone = (semitones + kSemitone / 2) >> 16;
+    int32_t note = semitone % 12;
+    if (note < 0)
+    {
+        note += 12;
+    }
+
+    prev_semitones_ = (semitone + note_offsets_[note]) * kSemitone;
+    return prev_semitones_;
+}
+
 void Quantizer::SetScale(const size_t scale_index)
 {
-    if (scale_index >= GetScaleTableSize())
+    if (scale_index >= GetScaleTableSize() || scale_index == scale_index_)
     {
         return;
     }
     scale_index_ = scale_index;
+    UpdateNoteOffsets();
 }
 
 void Quantizer::SetScale(const DefaultScale scale)
@@ -259,7 +313,12 @@ size_t Quantizer::GetScale() const
 
 void Quantizer::SetRoot(const ScaleRoot root)
 {
+    if (static_cast<uint32_t>(root) == scale_root_offset_)
+    {
+        return;
+    }
     scale_root_offset_ = static_cast<uint32_t>(root);
+    UpdateNoteOffsets();
 }
 
 Quantizer::ScaleRoot Quantizer::GetRoot() const
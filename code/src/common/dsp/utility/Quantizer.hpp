@@ -25,10 +25,13 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 #include "common/EnumTools.hpp"
+#include "common/config.hpp"
+#include "common/fastcode.hpp"
 
 namespace kastle2
 {
@@ -44,6 +47,9 @@ namespace kastle2
  * It supports different quantization types such as chromatic, major, major pentatonic, major chord, blues, minor, minor pentatonic, and minor chord.
  * The class also allows enabling or disabling the quantization.
  *
+ * Process() and ProcessMultiplier() work with float frequencies and search the tables on each call.
+ * ProcessSemitones() is the integer path, the pitch is in Q16 semitones and the nearest note of the scale
+ * comes from a small table rebuilt only when the scale or the root changes, so it can run at audio rate.
  */
 class Quantizer
 {
@@ -122,6 +128,34 @@ public:
      */
     float ProcessMultiplier(float multiplier);
 
+    /**
+     * @brief One semitone in the Q16 pitch of ProcessSemitones().
+     */
+    static constexpr int32_t kSemitone = 1 << 16;
+
+    /**
+     * @brief Processes the input pitch in Q16 semitones and returns the quantized pitch, the integer version of ProcessMultiplier().
+     *
+     * The pitch is rounded to the nearest semitone and moved to the nearest note of the scale (upwards first when
+     * two are equally far, as in ProcessMultiplier()). The scale root is applied. If the quantizer is disabled,
+     * the input pitch is returned unchanged.
+     *
+     * @param semitones The input pitch relative to C in Q16 semitones (kSemitone per semitone), can be negative.
+     * @return The quantized pitch in Q16 semitones (whole semitones).
+     */
+    int32_t ProcessSemitones(const int32_t semitones);
+
+    /**
+     * @brief Converts an ADC value (ADC_1V per octave, see Hardware::GetAnalogValue()) to Q16 semitones for ProcessSemitones().
+     * @param adc The ADC value, eg. a V/Oct CV.
+     * @param fine_bits Fractional bits of the ADC value (0 to 4, eg. Hardware::kPitchFineBits for Hardware::GetPitchValueFine()).
+     * @return The pitch in Q16 semitones.
+     */
+    static constexpr int32_t AdcToSemitones(const int32_t adc, const size_t fine_bits = 0)
+    {
+        return ((adc << (kAdcFineBitsMax - fine_bits)) * kAdcToSemitones) >> (kAdcToSemitonesBits - 16 + kAdcFineBitsMax);
+    }
+
     /**
      * @brief Sets the quantization scale.
      *
@@ -218,11 +252,26 @@ private:
     float threshold_ratio_ = 0.0f;   ///< The minimal threshold between two quantization levels.
     float prev_frequency_ = 0.0f;    ///< The previous frequency.
     float prev_multiplier_ = 0.0f;   ///< The previous multiplier.
+    int32_t threshold_semitones_ = 0; ///< The minimal threshold between two quantization levels in Q16 semitones.
+    int32_t prev_semitones_ = 0;      ///< The previous pitch in Q16 semitones.
+
+    std::array<int8_t, 12> note_offsets_{}; ///< Semitones from each note of the octave to the nearest note of the scale.
+    bool scale_empty_ = true;               ///< The scale has no notes, ProcessSemitones() returns the input.
+
+    /**
+     * @brief Rebuilds note_offsets_ for the current scale and root.
+     */
+    void UpdateNoteOffsets();
 
     std::span<const Scale> scale_table_;                               ///< The current scale table.
     static inline EnumArray<DefaultScale, Scale> default_scale_table_; ///< Filled in Init()
 
     static constexpr float kMultiplierMultiplyThreshold = 0.97193f;
     static constexpr float kMultiplierDivideThreshold = 1.94387f;
+
+    // ADC to semitones: ADC values (up to kAdcFineBitsMax fine bits) times the Q20 semitones per fine ADC step, barely fits 32 bits up to ADC_8V
+    static constexpr size_t kAdcFineBitsMax = 4;
+    static constexpr size_t kAdcToSemitonesBits = 20;
+    static constexpr int32_t kAdcToSemitones = ((12 << kAdcToSemitonesBits) + ADC_1V / 2) / ADC_1V;
 };
 }
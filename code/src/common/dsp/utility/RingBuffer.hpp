@@ -103,14 +103,15 @@ public:
 
     /**
      * @brief Return the front item of the ring buffer without removing it
+     * @return The item, nullptr if the buffer is empty
      */
-    std::optional<const T &> Front() const
+    const T *Front() const
     {
         if (IsEmpty())
         {
-            return std::nullopt;
+            return nullptr;
         }
-        return buffer_[head_];
+        return &buffer_[head_];
     }
 
     /**
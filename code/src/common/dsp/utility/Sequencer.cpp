@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #include "Sequencer.hpp"
+#include <algorithm>
 #include "common/dsp/math/bit_utils.hpp"
 #include "common/dsp/math/math_utils.hpp"
 
@@ -37,15 +38,19 @@ void Sequencer::Init(const size_t length)
     TriggerGenerator::FillTriggers(triggers_, kMaxLength);
 
     // Generate random values
+    random_.Seed(Xorshift32::HardwareSeed());
     for (size_t i = 0; i < kMaxLength; i++)
     {
-        cv_bits_[i] = rand() & 1u;
+        cv_bits_[i] = random_.NextBit();
     }
+    RebuildCvMap();
+    UpdateCvOutput();
 }
 
 void Sequencer::SetLength(const size_t length)
 {
     length_ = length > kMaxLength ? kMaxLength : (length < kMinLength ? kMinLength : length);
+    RebuildCvMap();
     Reset();
 }
 
@@ -72,10 +77,74 @@ void Sequencer::RealignTo(const size_t steps)
 void Sequencer::NextStep(const Feed trigger_feed, const Feed cv_feed)
 {
     reaching_next_cycle_ = false;
-    current_step_ = (current_step_ + 1) % length_;
+    current_step_ = Wrap(current_step_ + 1);
+    FeedStep(current_step_, trigger_feed, cv_feed);
+    UpdateTriggerOutput();
+    UpdateCvOutput();
+}
+
+void Sequencer::Advance(const size_t steps, const Feed trigger_feed, const Feed cv_feed)
+{
+    if (steps == 0)
+    {
+        return;
+    }
+    reaching_next_cycle_ = false;
+
+    // Whole cycles feed every step the same number of times
+    const size_t cycles = steps / length_;
+    if (cycles > 0)
+    {
+        const std::bitset<kMaxLength> active = std::bitset<kMaxLength>().set() >> (kMaxLength - length_);
+        bool cv_changed = false;
+
+        if (trigger_feed == Feed::INVERT && (cycles & 1u))
+        {
+            triggers_ ^= active;
+        }
+        if (cv_feed == Feed::INVERT && (cycles & 1u))
+        {
+            cv_bits_ ^= active;
+            cv_changed = true;
+        }
+        if (trigger_feed == Feed::RANDOM || cv_feed == Feed::RANDOM)
+        {
+            // Once randomized, more cycles give nothing new
+            for (size_t i = 0; i < length_; i++)
+            {
+                if (trigger_feed == Feed::RANDOM)
+                {
+                    triggers_[i] = random_.NextBit();
+                }
+                if (cv_feed == Feed::RANDOM)
+                {
+                    cv_bits_[i] = random_.NextBit();
+                }
+            }
+            cv_changed |= cv_feed == Feed::RANDOM;
+        }
+        if (cv_changed)
+        {
+            RebuildCvMap();
+        }
+    }
+
+    // The rest steps one by one
+    const size_t rest = steps - cycles * length_;
+    for (size_t i = 0; i < rest; i++)
+    {
+        current_step_ = Wrap(current_step_ + 1);
+        FeedStep(current_step_, trigger_feed, cv_feed);
+    }
 
+    UpdateTriggerOutput();
+    UpdateCvOutput();
+}
+
+void Sequencer::FeedStep(const size_t step, const Feed trigger_feed, const Feed cv_feed)
+{
     // Read current trigger
-    bool new_trigger = triggers_[current_step_];
+    bool new_trigger = triggers_[step];
 
     // Change it
     switch (trigger_feed)
@@ -84,16 +153,17 @@ void Sequencer::NextStep(const Feed trigger_feed, const Feed cv_feed)
         new_trigger = !new_trigger;
         break;
     case Feed::RANDOM:
-        new_trigger = rand() & 1;
+        new_trigger = random_.NextBit();
+        break;
+    default:
         break;
     }
 
     // Write it back
-    triggers_[current_step_] = new_trigger;
-    UpdateTriggerOutput();
+    triggers_[step] = new_trigger;
 
     // Read current CV bit
-    bool new_cv_bit = cv_bits_[current_step_];
+    bool new_cv_bit = cv_bits_[step];
 
     // Change it
     switch (cv_feed)
@@ -102,13 +172,14 @@ void Sequencer::NextStep(const Feed trigger_feed, const Feed cv_feed)
         new_cv_bit = !new_cv_bit;
         break;
     case Feed::RANDOM:
-        new_cv_bit = rand() & 1;
+        new_cv_bit = random_.NextBit();
+        break;
+    default:
         break;
     }
 
     // Write it back
-    cv_bits_[current_step_] = new_cv_bit;
-    UpdateCvOutput();
+    WriteCvBit(step, new_cv_bit);
 }
 
 void Sequencer::UpdateTriggerOutput()
@@ -120,20 +191,49 @@ void Sequencer::UpdateTriggerOutput()
 void Sequencer::UpdateCvOutput()
 {
     // Reaching next cycle is used to have CV ready before the actual clock
-    uint32_t step = current_step_;
+    size_t step = current_step_;
     if (reaching_next_cycle_)
     {
-        step = (current_step_ + 1) % length_;
+        step = Wrap(current_step_ + 1);
     }
 
-    // Make CV output index
-    uint8_t map_index = 0;
-    bit_write(map_index, 0, cv_bits_[(step + 0) % length_]);
-    bit_write(map_index, 1, cv_bits_[(step + 3) % length_]);
-    bit_write(map_index, 2, cv_bits_[(step + 5) % length_]);
-
     // Use the value from PWM map as the result
-    cv_output_ = kVoltageMap[map_index];
+    cv_output_ = kVoltageMap[cv_map_[step]];
+}
+
+void Sequencer::RebuildCvMap()
+{
+    for (size_t step = 0; step < length_; step++)
+    {
+        // Make CV output index
+        uint8_t map_index = 0;
+        for (size_t bit = 0; bit < 3; bit++)
+        {
+            bit_write(map_index, bit, cv_bits_[(step + kCvTaps[bit]) % length_]);
+        }
+        cv_map_[step] = map_index;
+    }
+}
+
+void Sequencer::UpdateCvMap(const size_t step)
+{
+    // The bit of the step is bit 0 of its own index, bit 1 of the index 3 steps back and bit 2 of 5 steps back
+    const bool value = cv_bits_[step];
+    for (size_t bit = 0; bit < 3; bit++)
+    {
+        const size_t offset = kCvTaps[bit] % length_;
+        const size_t index = step >= offset ? step - offset : step + length_ - offset;
+        bit_write(cv_map_[index], bit, value);
+    }
+}
+
+void Sequencer::WriteCvBit(const size_t step, const bool value)
+{
+    if (cv_bits_[step] != value)
+    {
+        cv_bits_[step] = value;
+        UpdateCvMap(step);
+    }
 }
 
 bool Sequencer::ReachingNextCycle()
@@ -173,15 +273,54 @@ void Sequencer::GenerateTriggers(const TriggerGenerator::Type type, const q15_t
 
 void Sequencer::GenerateTriggersUsingTable(const q15_t input)
 {
-    TriggerGenerator::PatternTriggerGenerator(input, triggers_, length_, generator_table_);
+    if (num_patterns_ == 0)
+    {
+        return;
+    }
+    const size_t index = TriggerGenerator::PatternIndex(input, num_patterns_);
+    TriggerGenerator::ExpandedPatternTriggerGenerator(patterns_[index], triggers_, length_);
 }
 
 void Sequencer::SetTriggerGeneratorTable(std::span<const uint32_t> table)
 {
-    generator_table_ = table;
+    num_patterns_ = std::min(table.size(), kMaxPatterns);
+    for (size_t i = 0; i < num_patterns_; i++)
+    {
+        patterns_[i] = TriggerGenerator::ExpandPattern<kMaxLength>(table[i]);
+    }
 }
 
 uint32_t Sequencer::GetCvOutput() const
 {
     return cv_output_;
-}
\ No newline at end of file
+}
+
+void Sequencer::SetRatchets(const size_t ratchets)
+{
+    ratchets_ = std::clamp<size_t>(ratchets, 1, kMaxRatchets);
+}
+
+void Sequencer::SetSwing(const q15_t swing)
+{
+    swing_ = std::clamp<q15_t>(swing, 0, Q15_MAX);
+}
+
+size_t Sequencer::GetStepTriggerFrames(const uint32_t step_frames, std::array<uint32_t, kMaxRatchets> &frames, uint32_t &gate_frames) const
+{
+    if (!trigger_output_)
+    {
+        return 0;
+    }
+
+    // The odd steps start later, by up to half a step
+    const uint32_t swing_frames = (current_step_ & 1u) ? static_cast<uint32_t>((static_cast<uint64_t>(step_frames) * swing_) >> 16) : 0;
+    const uint32_t swung_frames = step_frames - swing_frames;
+
+    // The ratchets split the rest of the step evenly, each offset divided on its own so the rounding does not add up
+    for (size_t i = 0; i < ratchets_; i++)
+    {
+        frames[i] = swing_frames + static_cast<uint32_t>((static_cast<uint64_t>(swung_frames) * i) / ratchets_);
+    }
+    gate_frames = swung_frames / ratchets_;
+    return ratchets_;
+}
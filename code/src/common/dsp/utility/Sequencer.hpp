@@ -24,10 +24,14 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include "TriggerGenerator.hpp"
+#include "common/dsp/math/Xorshift32.hpp"
+#include "common/dsp/math/qmath.hpp"
 
 namespace kastle2
 {
@@ -43,6 +47,10 @@ namespace kastle2
  * The CV sequencer is inspired by Rungler and can generate 8 different voltages.
  * For another implementation (closer to the original) see KastleRungler class.
  *
+ * A step with a trigger can repeat it (ratchets) and the odd steps can be delayed (swing).
+ * GetStepTriggerFrames() gives the frames of the triggers within the step, so they can be
+ * scheduled in between the clock ticks instead of being rounded to them.
+ *
  */
 class Sequencer
 {
@@ -76,6 +84,18 @@ public:
      */
     void NextStep(const Feed trigger_feed, const Feed cv_feed);
 
+    /**
+     * @brief Advances the sequencer by a number of steps at once, as if NextStep() was called that many times.
+     * @param steps Number of steps to advance
+     * @param trigger_feed How to modify the triggers of the passed steps
+     * @param cv_feed How to modify the CV bits of the passed steps
+     *
+     * The cost does not depend on the number of steps: whole cycles of the sequence are applied to all
+     * steps at once (the same feed twice is no change for INVERT), only the rest is stepped through.
+     * For fast-forwarding after a resync.
+     */
+    void Advance(const size_t steps, const Feed trigger_feed, const Feed cv_feed);
+
     /**
      * @brief Gets the current trigger output state.
      * @return True if the current step has a trigger active, false otherwise
@@ -104,13 +124,18 @@ public:
     /**
      * @brief Generates triggers using a predefined pattern table.
      * @param input Q15 input value (0-32767) that selects which pattern from the table to use
-     * @warning Requires SetTriggerGeneratorTable() to be called first.
+     * @note Does nothing until SetTriggerGeneratorTable() is called.
+     *
+     * The patterns are expanded in SetTriggerGeneratorTable(), so this only copies the selected one.
      */
     void GenerateTriggersUsingTable(const q15_t input);
 
     /**
      * @brief Sets the pattern table for table-based trigger generation using GenerateTriggersUsingTable().
      * @param table Span of pattern data where each uint32_t contains a 16-step pattern
+     *
+     * Each pattern is expanded to kMaxLength steps right away (at most kMaxPatterns are used),
+     * the table does not have to stay valid afterwards.
      */
     void SetTriggerGeneratorTable(std::span<const uint32_t> table);
 
@@ -162,6 +187,39 @@ public:
      */
     bool ReachingNextCycle();
 
+    /**
+     * @brief Maximum number of the triggers of a step (ratchets).
+     */
+    static constexpr size_t kMaxRatchets = 8;
+
+    /**
+     * @brief Sets the number of the triggers of each step with a trigger (ratchets), spread evenly over the step.
+     * @param ratchets 1 for a single trigger, up to kMaxRatchets (clamped)
+     */
+    void SetRatchets(const size_t ratchets);
+
+    /**
+     * @brief Gets the number of the triggers of each step with a trigger.
+     */
+    size_t GetRatchets() const { return ratchets_; }
+
+    /**
+     * @brief Sets the swing - the delay of the odd steps.
+     * @param swing 0 for straight steps, Q15_MAX delays the odd steps by half a step (75 % swing)
+     */
+    void SetSwing(const q15_t swing);
+
+    /**
+     * @brief Gets the frames of the triggers of the current step, with the ratchets and the swing applied.
+     * @param step_frames Length of the step in frames (the clock period)
+     * @param frames Filled with the offsets of the triggers from the step start, in the time order
+     * @param gate_frames Length of each trigger's gate (the time between the ratchets)
+     * @return Number of the triggers (0 when the step has no trigger)
+     *
+     * A swung step is shorter, its ratchets are spread over the rest of it, the next step is not moved.
+     */
+    size_t GetStepTriggerFrames(const uint32_t step_frames, std::array<uint32_t, kMaxRatchets> &frames, uint32_t &gate_frames) const;
+
     /**
      * @brief Minimum number of steps supported by the sequencer.
      */
@@ -177,6 +235,11 @@ public:
      */
     static constexpr size_t kDefaultLength = 16;
 
+    /**
+     * @brief Maximum number of patterns of the trigger generator table.
+     */
+    static constexpr size_t kMaxPatterns = 64;
+
     /**
      * @brief Voltage mapping table for CV output generation.
      * Maps 3-bit CV indices (0-7) to voltage values in the 0-1023 range.
@@ -190,6 +253,34 @@ private:
      */
     void UpdateCvOutput();
 
+    /**
+     * @brief Rebuilds the CV map index of every step, needed after the length or all the CV bits changed.
+     */
+    void RebuildCvMap();
+
+    /**
+     * @brief Updates the CV map indexes which read the CV bit of the step (the step itself, 3 and 5 steps back).
+     */
+    void UpdateCvMap(const size_t step);
+
+    /**
+     * @brief Writes the CV bit of the step and keeps the CV map up to date.
+     */
+    void WriteCvBit(const size_t step, const bool value);
+
+    /**
+     * @brief Returns the step after the given one, wrapped to the sequence length.
+     */
+    size_t Wrap(const size_t step) const
+    {
+        return step >= length_ ? step - length_ : step;
+    }
+
+    /**
+     * @brief Applies the feed to the trigger and the CV bit of the step.
+     */
+    void FeedStep(const size_t step, const Feed trigger_feed, const Feed cv_feed);
+
     /**
      * @brief Updates the trigger output for the current step.
      */
@@ -205,6 +296,22 @@ private:
      */
     std::bitset<kMaxLength> cv_bits_;
 
+    /**
+     * @brief kVoltageMap index of each step, made of the CV bits at (step+0), (step+3) and (step+5).
+     * Built for the current length, so the output of a step is one read.
+     */
+    std::array<uint8_t, kMaxLength> cv_map_{};
+
+    /**
+     * @brief Step offsets of the CV bits making bits 0, 1 and 2 of the kVoltageMap index.
+     */
+    static constexpr size_t kCvTaps[3] = {0, 3, 5};
+
+    /**
+     * @brief Random bits of the RANDOM feed, seeded from the hardware in Init().
+     */
+    Xorshift32 random_;
+
     /**
      * @brief Current trigger output state.
      */
@@ -226,9 +333,24 @@ private:
     uint32_t cv_output_ = 0;
 
     /**
-     * @brief Reference to the pattern table for table-based trigger generation.
+     * @brief Patterns of the table for table-based trigger generation, expanded to kMaxLength steps.
+     */
+    std::array<std::bitset<kMaxLength>, kMaxPatterns> patterns_{};
+
+    /**
+     * @brief Number of valid patterns in patterns_.
+     */
+    size_t num_patterns_ = 0;
+
+    /**
+     * @brief Number of the triggers of each step with a trigger.
+     */
+    size_t ratchets_ = 1;
+
+    /**
+     * @brief Delay of the odd steps, Q15_MAX is half a step.
      */
-    std::span<const uint32_t> generator_table_;
+    q15_t swing_ = 0;
 
     /**
      * @brief Flag indicating if CV is being prepared for the next cycle.
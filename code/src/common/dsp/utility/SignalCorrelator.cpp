@@ -35,6 +35,22 @@ void SignalCorrelator::AddSample(int16_t sample1, int16_t sample2)
     arr_index_ = (arr_index_ + 1) % size_;
 }
 
+void SignalCorrelator::AddBlock(const int16_t *samples1, const int16_t *samples2, size_t size, size_t stride)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        sum1_ += samples1[i * stride];
+        sum2_ += samples2[i * stride];
+        if (++count_ == decimation_)
+        {
+            AddSample(sum1_ >> decimation_shift_, sum2_ >> decimation_shift_);
+            sum1_ = 0;
+            sum2_ = 0;
+            count_ = 0;
+        }
+    }
+}
+
 bool SignalCorrelator::FindCorrelation(int16_t threshold, Expand expand)
 {
     int32_t threshold_expanded = threshold * size_; // scale threshold to the number of samples
@@ -24,10 +24,12 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <array>
 #include <algorithm>
+#include <bit>
 #include <memory>
 #include "common/dsp/math/qmath.hpp"
 
@@ -39,6 +41,9 @@ namespace kastle2
  * @brief A utility class used to detect if two signals are nearly identical. Used for self-patch detection and similar tasks.
  * @author Marek Mach (Bastl Instruments)
  * @date 2025-09-25
+ *
+ * With a decimation, AddBlock() stores the means of each decimation samples instead of every sample,
+ * so the same buffer covers a decimation times longer stretch and the input costs one pass per block.
  */
 class SignalCorrelator
 {
@@ -53,10 +58,13 @@ public:
     /**
      * @brief Constructor for SignalCorrelator.
      * @param size The size of the internal buffer.
+     * @param decimation Input samples per stored mean in AddBlock(), a power of two (eg. 8).
      */
-    SignalCorrelator(uint32_t size) : size_(size), 
+    SignalCorrelator(uint32_t size, uint32_t decimation = 1) : size_(size),
                                       buffer1_(std::make_unique<int16_t[]>(size)),
-                                      buffer2_(std::make_unique<int16_t[]>(size))
+                                      buffer2_(std::make_unique<int16_t[]>(size)),
+                                      decimation_(std::bit_floor(std::max(decimation, 1u))),
+                                      decimation_shift_(std::countr_zero(decimation_))
     {
         std::fill_n(buffer1_.get(), size_, 0);
         std::fill_n(buffer2_.get(), size_, 0);
@@ -68,6 +76,15 @@ public:
      * @param sample2 The second signal sample.
      */
     void AddSample(int16_t sample1, int16_t sample2);
+
+    /**
+     * @brief Adds a block of both signals at the decimated rate, the means continue over the blocks.
+     * @param samples1 The first signal.
+     * @param samples2 The second signal.
+     * @param size Number of samples of each signal.
+     * @param stride Distance between the samples, use 2 for interleaved stereo.
+     */
+    void AddBlock(const int16_t *samples1, const int16_t *samples2, size_t size, size_t stride = 1);
     
     /**
      * @brief Finds if the two signals are correlated within a given threshold.
@@ -83,6 +100,11 @@ private:
     std::unique_ptr<int16_t[]> buffer2_;
     int32_t arr_index_ = 0;
     int32_t arr_index_margin_ = 3; // margin around the write index to ignore in correlation
+    uint32_t decimation_;
+    uint8_t decimation_shift_;
+    int32_t sum1_ = 0;
+    int32_t sum2_ = 0;
+    uint32_t count_ = 0;
 };
 
 } // namespace kastle2
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 namespace kastle2
@@ -106,6 +107,36 @@ public:
         return current_value_;
     }
 
+    /**
+     * @brief Makes the steps of size Process() calls at once, for values used once per block.
+     * @param size Number of Process() steps (eg. the frames of the block)
+     * @return True if the value changed, false once it's at the target (the derived values can be kept)
+     */
+    bool ProcessBlock(size_t size)
+    {
+        if (current_value_ == target_value_ || size == 0)
+        {
+            return false;
+        }
+
+        // The distance of size steps, the target when it's closer
+        const int64_t difference = static_cast<int64_t>(target_value_) - current_value_;
+        const int64_t distance = static_cast<int64_t>(speed_) * static_cast<int64_t>(size);
+        if (difference > distance)
+        {
+            current_value_ += static_cast<int32_t>(distance);
+        }
+        else if (-difference > distance)
+        {
+            current_value_ -= static_cast<int32_t>(distance);
+        }
+        else
+        {
+            current_value_ = target_value_;
+        }
+        return true;
+    }
+
     /**
      * @brief Get the current value without processing
      * @return Current smooth value
@@ -0,0 +1,397 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include "common/dsp/math/FftQ15.hpp"
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class Stft
+ * @ingroup dsp_utility
+ * @brief Fixed-point short-time Fourier transform, spectrum processing and overlap-add resynthesis.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * A frame of kSize samples (Hann window) is taken every kHop = kSize / 4 samples, transformed by FftQ15,
+ * converted to magnitude and phase, handed to the app's SpectrumCallback, converted back, inverse
+ * transformed and overlap-added to the output. The output is the input delayed by kLatency when the callback
+ * leaves the bins alone.
+ *
+ * The work of a frame is split to kSteps steps (window, each FFT stage, chunks of bins...) and Process() runs them
+ * evenly over the hop, so a block of audio does only its share of the frame and the cost per block stays flat.
+ * A frame not finished by the next hop is finished at once and counted by GetOverrunCount().
+ *
+ * Samples are Q15, the frames are Q23 inside (8 more bits of precision). Magnitudes are in the same scale,
+ * a full scale sine between two bins gives about kFullScale. Phases are q31_t angles, Q31_MAX is pi,
+ * so phase increments wrap around by themselves (add them as uint32_t).
+ *
+ * @note Meant for the second core: SecondCoreProcess, or a MultiCore worker with whole blocks.
+ *       Large object (about 28 * kSize bytes with the FFT tables), allocate it from the app arena or the heap.
+ *       Add the FftQ15 stage functions to the app's APP_FASTCODE_HOT list to run them from RAM.
+ */
+template <size_t kSize = 512>
+class Stft
+{
+    static_assert(kSize >= 16 && kSize <= FftQ15::kMaxSize && (kSize & (kSize - 1)) == 0,
+                  "The frame size must be a power of two supported by FftQ15");
+
+public:
+    /**
+     * @brief Samples between two frames (75 % overlap).
+     */
+    static constexpr size_t kHop = kSize / 4;
+
+    /**
+     * @brief Bins from DC to the Nyquist frequency.
+     */
+    static constexpr size_t kBins = kSize / 2 + 1;
+
+    /**
+     * @brief Delay of the output in samples.
+     */
+    static constexpr size_t kLatency = kSize + kHop;
+
+    /**
+     * @brief Magnitude of a full scale sine (centered in a bin).
+     */
+    static constexpr int32_t kFullScale = 1 << 22;
+
+    /**
+     * @brief Called once per frame with the bins, modifies them in place.
+     * @param context Pointer given to the constructor.
+     * @param magnitudes kBins magnitudes (see kFullScale).
+     * @param phases kBins phases (Q31_MAX is pi).
+     * @param bins kBins.
+     */
+    using SpectrumCallback = void (*)(void *context, int32_t *magnitudes, q31_t *phases, size_t bins);
+
+    /**
+     * @brief Prepares the FFT tables and windows.
+     * @param callback Spectrum processing, nullptr passes the spectrum through.
+     * @param context Passed to the callback.
+     */
+    Stft(const SpectrumCallback callback = nullptr, void *context = nullptr)
+        : fft_(kSize), callback_(callback), context_(context)
+    {
+        for (size_t i = 0; i < kSize; i++)
+        {
+            const float hann = 0.5f - 0.5f * cosf(2.0f * std::numbers::pi_v<float> * i / kSize);
+            analysis_window_[i] = static_cast<int16_t>(hann * 32767.0f);
+            // The squared Hann windows sum to 1.5 at 75 % overlap
+            synthesis_window_[i] = static_cast<int16_t>(hann * 32767.0f / 1.5f);
+        }
+        Reset();
+    }
+
+    /**
+     * @brief Clears the buffers, the output is silent for the next kLatency samples.
+     */
+    void Reset()
+    {
+        input_.fill(0);
+        ola_.fill(0);
+        output_.fill(0);
+        input_pos_ = 0;
+        ola_pos_ = 0;
+        hop_pos_ = 0;
+        budget_ = 0;
+        step_ = kSteps;
+    }
+
+    /**
+     * @brief Processes a block, runs the share of the frame work that falls into it.
+     * @param input Input samples.
+     * @param output Output samples, may be the input.
+     * @param size Number of samples.
+     * @param stride Distance of the samples, 2 for one channel of an interleaved stereo block.
+     */
+    void Process(const q15_t *input, q15_t *output, const size_t size, const size_t stride = 1)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            input_[input_pos_] = static_cast<int16_t>(q15_saturate(input[i * stride]));
+            input_pos_ = (input_pos_ + 1) & (kSize - 1);
+            output[i * stride] = output_[hop_pos_];
+
+            // kSteps per hop, spread over its samples
+            budget_ += kSteps;
+            while (budget_ >= kHop && step_ < kSteps)
+            {
+                budget_ -= kHop;
+                RunStep();
+            }
+
+            if (++hop_pos_ == kHop)
+            {
+                hop_pos_ = 0;
+                NextFrame();
+            }
+        }
+    }
+
+    /**
+     * @brief Returns how many frames had to be finished in one go at the hop.
+     */
+    uint32_t GetOverrunCount() const
+    {
+        return overruns_;
+    }
+
+    /**
+     * @brief Converts a complex value to magnitude and phase (CORDIC, shifts and adds only).
+     * @param value Complex value up to 2^29.
+     * @param magnitude Magnitude in the scale of the value.
+     * @param phase Angle, Q31_MAX is pi.
+     */
+    static void ToPolar(const FftQ15::Complex &value, int32_t &magnitude, q31_t &phase)
+    {
+        int32_t x = value.real;
+        int32_t y = value.imag;
+        uint32_t angle = 0;
+        // The iterations cover +-pi / 2, the left half plane is turned by pi first
+        if (x < 0)
+        {
+            x = -x;
+            y = -y;
+            angle = kPi;
+        }
+        for (size_t i = 0; i < kCordicIterations; i++)
+        {
+            const int32_t x_shifted = x >> i;
+            if (y > 0)
+            {
+                x += y >> i;
+                y -= x_shifted;
+                angle += kCordicAngles[i];
+            }
+            else
+            {
+                x -= y >> i;
+                y += x_shifted;
+                angle -= kCordicAngles[i];
+            }
+        }
+        magnitude = MultiplyQ15(x, kCordicGainInverse);
+        phase = static_cast<q31_t>(angle);
+    }
+
+    /**
+     * @brief Converts magnitude and phase to a complex value, the inverse of ToPolar().
+     */
+    static FftQ15::Complex FromPolar(const int32_t magnitude, const q31_t phase)
+    {
+        int32_t x = MultiplyQ15(magnitude, kCordicGainInverse);
+        int32_t y = 0;
+        int32_t angle = phase;
+        if (angle > kHalfPi || angle < -kHalfPi)
+        {
+            x = -x;
+            angle = static_cast<int32_t>(static_cast<uint32_t>(angle) + kPi);
+        }
+        for (size_t i = 0; i < kCordicIterations; i++)
+        {
+            const int32_t x_shifted = x >> i;
+            if (angle >= 0)
+            {
+                x -= y >> i;
+                y += x_shifted;
+                angle -= static_cast<int32_t>(kCordicAngles[i]);
+            }
+            else
+            {
+                x += y >> i;
+                y -= x_shifted;
+                angle += static_cast<int32_t>(kCordicAngles[i]);
+            }
+        }
+        return {x, y};
+    }
+
+private:
+    // Bins converted per step
+    static constexpr size_t kBinsPerStep = 64;
+    static constexpr size_t kBinSteps = (kBins + kBinsPerStep - 1) / kBinsPerStep;
+
+    static constexpr size_t Log2(const size_t value)
+    {
+        size_t log2 = 0;
+        while ((static_cast<size_t>(1) << log2) < value)
+        {
+            log2++;
+        }
+        return log2;
+    }
+    // Same as FftQ15::GetStageCount()
+    static constexpr size_t kFftStages = Log2(kSize) / 2 + (Log2(kSize) & 1);
+
+    // Frame steps in order
+    static constexpr size_t kStepForward = 0;                            // window and bit reversal (at the hop)
+    static constexpr size_t kStepForwardStages = kStepForward + 1;       // forward FFT stages, scaled
+    static constexpr size_t kStepToPolar = kStepForwardStages + kFftStages; // chunks of bins to polar
+    static constexpr size_t kStepCallback = kStepToPolar + kBinSteps;    // the app's processing
+    static constexpr size_t kStepFromPolar = kStepCallback + 1;          // chunks of bins back, conjugated
+    static constexpr size_t kStepInverse = kStepFromPolar + kBinSteps;   // bit reversal
+    static constexpr size_t kStepInverseStages = kStepInverse + 1;       // FFT stages of the inverse, unscaled
+    static constexpr size_t kStepOverlapAdd = kStepInverseStages + kFftStages;
+    static constexpr size_t kSteps = kStepOverlapAdd + 1;
+
+    static constexpr size_t kCordicIterations = 16;
+    // atan(2^-i) in q31_t angles (Q31_MAX is pi)
+    static constexpr std::array<uint32_t, kCordicIterations> kCordicAngles = {
+        536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838, 5340245,
+        2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861};
+    // 1 / 1.64676 (gain of the iterations) in Q15
+    static constexpr int32_t kCordicGainInverse = 19898;
+    static constexpr uint32_t kPi = 0x80000000u;
+    static constexpr int32_t kHalfPi = 0x40000000;
+
+    // x * w in Q15, split so x can use up to 29 bits
+    static inline int32_t MultiplyQ15(const int32_t x, const int32_t w)
+    {
+        return (x >> 15) * w + (((x & 0x7FFF) * w + 0x4000) >> 15);
+    }
+
+    void NextFrame()
+    {
+        if (step_ < kSteps)
+        {
+            overruns_++;
+            while (step_ < kSteps)
+            {
+                RunStep();
+            }
+        }
+
+        // The oldest hop has all its frames added
+        for (size_t i = 0; i < kHop; i++)
+        {
+            const size_t index = (ola_pos_ + i) & (kSize - 1);
+            output_[i] = q15_saturate((ola_[index] + 0x80) >> 8);
+            ola_[index] = 0;
+        }
+        ola_pos_ = (ola_pos_ + kHop) & (kSize - 1);
+
+        // The window has to be copied before more input comes
+        step_ = kStepForward;
+        budget_ = 0;
+        RunStep();
+    }
+
+    void RunStep()
+    {
+        const size_t step = step_++;
+        if (step == kStepForward)
+        {
+            // The oldest sample of the window is at the write position, Q15 * Q15 to Q23
+            for (size_t i = 0; i < kSize; i++)
+            {
+                const int32_t sample = input_[(input_pos_ + i) & (kSize - 1)];
+                frame_[i] = {(sample * analysis_window_[i]) >> 7, 0};
+            }
+            fft_.Reorder(frame_.data());
+        }
+        else if (step < kStepToPolar)
+        {
+            fft_.Stage(frame_.data(), step - kStepForwardStages);
+        }
+        else if (step < kStepCallback)
+        {
+            const size_t first = (step - kStepToPolar) * kBinsPerStep;
+            const size_t last = first + kBinsPerStep < kBins ? first + kBinsPerStep : kBins;
+            for (size_t k = first; k < last; k++)
+            {
+                ToPolar(frame_[k], magnitudes_[k], phases_[k]);
+            }
+        }
+        else if (step == kStepCallback)
+        {
+            if (callback_ != nullptr)
+            {
+                callback_(context_, magnitudes_.data(), phases_.data(), kBins);
+            }
+        }
+        else if (step < kStepInverse)
+        {
+            // The inverse is the forward transform of the conjugate, the real part of the result is the frame.
+            // The upper half of a real signal's spectrum mirrors the lower one.
+            const size_t first = (step - kStepFromPolar) * kBinsPerStep;
+            const size_t last = first + kBinsPerStep < kBins ? first + kBinsPerStep : kBins;
+            for (size_t k = first; k < last; k++)
+            {
+                const FftQ15::Complex value = FromPolar(magnitudes_[k], phases_[k]);
+                frame_[k] = {value.real, -value.imag};
+                if (k != 0 && k != kSize / 2)
+                {
+                    frame_[kSize - k] = value;
+                }
+            }
+        }
+        else if (step == kStepInverse)
+        {
+            fft_.Reorder(frame_.data());
+        }
+        else if (step < kStepOverlapAdd)
+        {
+            fft_.Stage(frame_.data(), step - kStepInverseStages, false);
+        }
+        else
+        {
+            for (size_t i = 0; i < kSize; i++)
+            {
+                ola_[(ola_pos_ + i) & (kSize - 1)] += MultiplyQ15(frame_[i].real, synthesis_window_[i]);
+            }
+        }
+    }
+
+    FftQ15 fft_;
+    SpectrumCallback callback_;
+    void *context_;
+
+    std::array<int16_t, kSize> analysis_window_;
+    std::array<int16_t, kSize> synthesis_window_;
+    std::array<int16_t, kSize> input_;
+    std::array<FftQ15::Complex, kSize> frame_;
+    std::array<int32_t, kBins> magnitudes_;
+    std::array<q31_t, kBins> phases_;
+    std::array<int32_t, kSize> ola_;
+    std::array<q15_t, kHop> output_;
+
+    size_t input_pos_ = 0;
+    size_t ola_pos_ = 0;
+    size_t hop_pos_ = 0;
+    size_t budget_ = 0;
+    size_t step_ = kSteps;
+    uint32_t overruns_ = 0;
+};
+}
@@ -0,0 +1,121 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class TailTracker
+ * @ingroup dsp_utility
+ * @brief Tells when a stage with memory has gone silent, so whole stages can be skipped on idle input.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The bypass contract: a stage (one node or a chain of them, eg. delays with feedback and filters) feeds the tracker
+ * the block level of the signal it keeps in its memory (Process()). The tracker knows the tail of the stage,
+ * the longest time a sample stays in it, and reports IsSilent() once the level stayed below kSilenceFloor
+ * for the whole tail: everything the memory holds has decayed below the noise floor.
+ * While the stage's input is silent too (eg. Base::IsInputSilent()), the stage can skip its processing
+ * and output silence. Its memory is left as it is, so nothing is lost when the processing resumes.
+ *
+ * The floor is a power of two, so the level of a block can be the OR of the absolute values of its samples,
+ * which is below the floor exactly when all of them are (no compare per sample).
+ *
+ * @code
+ * // Init
+ * tail_.Init(kDelayLength);
+ * // AudioLoop
+ * if (Kastle2::base.IsInputSilent() && tail_.IsSilent())
+ * {
+ *     ... fill the output with zeros and return
+ * }
+ * q15_t level = 0;
+ * ... per sample level |= q15_abs(wet)
+ * tail_.Process(level, size);
+ * @endcode
+ */
+class TailTracker
+{
+public:
+    /**
+     * @brief Level below which a signal counts as silent (about -60 dBFS), a power of two.
+     */
+    static constexpr q15_t kSilenceFloor = 32;
+
+    /**
+     * @brief Initializes the tracker, the stage is not silent until it has been quiet for the tail.
+     * @param tail Longest time a sample stays in the stage, in frames.
+     */
+    void Init(const size_t tail)
+    {
+        tail_ = tail;
+        quiet_ = 0;
+    }
+
+    /**
+     * @brief Updates the tracker with the level of a processed block.
+     * @param level Peak (or the OR of the absolute values) of the block.
+     * @param size Number of frames of the block.
+     */
+    void Process(const q15_t level, const size_t size)
+    {
+        if (level >= kSilenceFloor)
+        {
+            quiet_ = 0;
+        }
+        else if (quiet_ < tail_)
+        {
+            quiet_ += size;
+        }
+    }
+
+    /**
+     * @brief Marks the stage as not silent, eg. when its state changes in a way which can make sound by itself.
+     */
+    void Wake()
+    {
+        quiet_ = 0;
+    }
+
+    /**
+     * @brief Returns true when the memory of the stage has decayed below the floor.
+     */
+    bool IsSilent() const
+    {
+        return quiet_ >= tail_;
+    }
+
+private:
+    size_t tail_ = 0;
+    size_t quiet_ = 0;
+};
+
+}
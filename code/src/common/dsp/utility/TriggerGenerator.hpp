@@ -135,13 +135,52 @@ public:
     static void PatternTriggerGenerator(q15_t input, std::bitset<N> &triggers, size_t length, std::span<const uint32_t> table)
     {
         ClearTriggers(triggers, length);
-        size_t index = constrain(map(input, 0, Q15_MAX, 0, table.size()), 0, table.size() - 1);
+        size_t index = PatternIndex(input, table.size());
         for (size_t i = 0; i < length && i < N; i++)
         {
             triggers[i] = bit_read(table[index], kGeneratorPatternLength - 1 - i % kGeneratorPatternLength);
         }
     }
 
+    /**
+     * @brief Returns the index of the table pattern selected by the Q15 input value, as PatternTriggerGenerator() does.
+     * @param input Q15 input value (0-32767)
+     * @param table_size Number of patterns in the table
+     */
+    static size_t PatternIndex(q15_t input, size_t table_size)
+    {
+        return constrain(map(input, 0, Q15_MAX, 0, table_size), 0, table_size - 1);
+    }
+
+    /**
+     * @brief Expands a table pattern to N steps, repeating it every kGeneratorPatternLength steps.
+     * @param rhythm Pattern from the table (MSB first)
+     * @return Triggers of all N steps (step i is bit i)
+     */
+    template <size_t N>
+    static std::bitset<N> ExpandPattern(Rhythm rhythm)
+    {
+        std::bitset<N> pattern;
+        for (size_t i = 0; i < N; i++)
+        {
+            pattern[i] = bit_read(rhythm, kGeneratorPatternLength - 1 - i % kGeneratorPatternLength);
+        }
+        return pattern;
+    }
+
+    /**
+     * @brief Sets the triggers from a pattern expanded by ExpandPattern(), same result as PatternTriggerGenerator().
+     * @param pattern Expanded pattern
+     * @param triggers Bitset reference to store the triggers
+     * @param length Length of the active portion of the bitset
+     */
+    template <size_t N>
+    static void ExpandedPatternTriggerGenerator(const std::bitset<N> &pattern, std::bitset<N> &triggers, size_t length)
+    {
+        const std::bitset<N> active = length >= N ? std::bitset<N>().set() : std::bitset<N>().set() >> (N - length);
+        triggers = (triggers & ~active) | (pattern & active);
+    }
+
     /**
      * @brief Generates divider of 2 triggers based on the Q15 input value.
      * @param input Q15 input value (0-32767)
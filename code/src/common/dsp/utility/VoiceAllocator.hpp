@@ -0,0 +1,242 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace kastle2
+{
+
+/**
+ * @class VoiceAllocator
+ * @ingroup dsp_utility
+ * @brief Owns kVoices voices of a polyphonic (or paraphonic) app and assigns notes to them.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The voices are one contiguous array, so the audio loop renders them one after another, block by block,
+ * and each core can take its own slice of them (GetCoreVoices()).
+ *
+ * Allocation of NoteOn():
+ * - a note which already has a voice retriggers the same voice,
+ * - otherwise the free voice (no held note) triggered the longest time ago, so releases ring out,
+ * - otherwise the held voice triggered the longest time ago is stolen.
+ *
+ * The voice count can be lowered at runtime (eg. to 1 for a mono mode), only the first GetVoiceCount()
+ * voices are then allocated. The note is any 8 bit number, so notes outside the MIDI range (>= 128) can
+ * stand for other sources, like the trigger input.
+ *
+ * @tparam Voice Voice state (oscillators, filters, envelope, render buffer...)
+ * @tparam kVoices Number of voices
+ */
+template <typename Voice, size_t kVoices>
+class VoiceAllocator
+{
+    static_assert(kVoices > 0, "At least one voice is needed");
+
+public:
+    /**
+     * @brief Returned instead of the voice index when no voice plays the note.
+     */
+    static constexpr size_t kNoVoice = kVoices;
+
+    /**
+     * @brief Releases all the voices and sets the voice count to kVoices.
+     */
+    void Reset()
+    {
+        for (auto &slot : slots_)
+        {
+            slot = Slot{};
+        }
+        counter_ = 0;
+        voice_count_ = kVoices;
+        last_voice_ = 0;
+    }
+
+    /**
+     * @brief Sets how many voices (from the first) are allocated, the others keep their notes but get no new ones.
+     * @param count Number of voices (1 to kVoices).
+     */
+    void SetVoiceCount(const size_t count)
+    {
+        voice_count_ = count < 1 ? 1 : (count > kVoices ? kVoices : count);
+        if (last_voice_ >= voice_count_)
+        {
+            last_voice_ = 0;
+        }
+    }
+
+    /**
+     * @brief Returns the number of voices which are allocated.
+     */
+    size_t GetVoiceCount() const
+    {
+        return voice_count_;
+    }
+
+    /**
+     * @brief Assigns the note to a voice, see the class description for the order.
+     * @param note The note (eg. MIDI note number).
+     * @return Index of the voice which should play (trigger) the note.
+     */
+    size_t NoteOn(const uint8_t note)
+    {
+        size_t voice = Find(note);
+        if (voice == kNoVoice)
+        {
+            voice = Oldest(false);
+        }
+        if (voice == kNoVoice)
+        {
+            voice = Oldest(true);
+        }
+        slots_[voice] = Slot{.note = note, .held = true, .age = ++counter_};
+        last_voice_ = voice;
+        return voice;
+    }
+
+    /**
+     * @brief Releases the note, its voice keeps the note (eg. for the envelope release) until it is reused.
+     * @param note The note.
+     * @return Index of the voice which played the note, kNoVoice if none.
+     */
+    size_t NoteOff(const uint8_t note)
+    {
+        const size_t voice = Find(note);
+        if (voice != kNoVoice)
+        {
+            slots_[voice].held = false;
+        }
+        return voice;
+    }
+
+    /**
+     * @brief Returns the last note assigned to the voice.
+     */
+    uint8_t GetNote(const size_t voice) const
+    {
+        return slots_[voice].note;
+    }
+
+    /**
+     * @brief Returns whether the note of the voice is held (NoteOn() without NoteOff()).
+     */
+    bool IsHeld(const size_t voice) const
+    {
+        return slots_[voice].held;
+    }
+
+    /**
+     * @brief Returns the index of the voice of the latest NoteOn().
+     */
+    size_t GetLastVoice() const
+    {
+        return last_voice_;
+    }
+
+    /**
+     * @brief Returns the voice.
+     */
+    Voice &operator[](const size_t voice)
+    {
+        return voices_[voice];
+    }
+
+    /**
+     * @brief Returns all the voices.
+     */
+    std::span<Voice, kVoices> GetVoices()
+    {
+        return voices_;
+    }
+
+    /**
+     * @brief Returns the slice of the voices a core processes, the voices are split evenly among the cores.
+     * @param core The core (0 to cores - 1).
+     * @param cores Number of cores sharing the voices.
+     * @return First voice and number of voices of the core.
+     */
+    static constexpr std::pair<size_t, size_t> GetCoreRange(const size_t core, const size_t cores = 2)
+    {
+        const size_t from = core * kVoices / cores;
+        const size_t to = (core + 1) * kVoices / cores;
+        return {from, to - from};
+    }
+
+    /**
+     * @brief Returns the voices a core processes, see GetCoreRange().
+     */
+    std::span<Voice> GetCoreVoices(const size_t core, const size_t cores = 2)
+    {
+        const auto [from, count] = GetCoreRange(core, cores);
+        return std::span<Voice>(voices_).subspan(from, count);
+    }
+
+private:
+    struct Slot
+    {
+        uint8_t note = 0;
+        bool held = false;
+        uint32_t age = 0; // counter_ at the NoteOn(), 0 for never
+    };
+
+    size_t Find(const uint8_t note) const
+    {
+        for (size_t voice = 0; voice < voice_count_; voice++)
+        {
+            if (slots_[voice].age != 0 && slots_[voice].note == note)
+            {
+                return voice;
+            }
+        }
+        return kNoVoice;
+    }
+
+    // The voice triggered the longest time ago of the free (or held) ones, lowest index first
+    size_t Oldest(const bool held) const
+    {
+        size_t oldest = kNoVoice;
+        for (size_t voice = 0; voice < voice_count_; voice++)
+        {
+            if (slots_[voice].held == held && (oldest == kNoVoice || slots_[voice].age < slots_[oldest].age))
+            {
+                oldest = voice;
+            }
+        }
+        return oldest;
+    }
+
+    std::array<Voice, kVoices> voices_;
+    std::array<Slot, kVoices> slots_{};
+    uint32_t counter_ = 0;
+    size_t voice_count_ = kVoices;
+    size_t last_voice_ = 0;
+};
+}
@@ -24,136 +24,13 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include "common/fastcode.hpp"
+#include "common/dsp/math/lookup_generators.hpp"
 
 constexpr int SLEW_GENERATOR_TABLE_SIZE = 1024;
-const int32_t slew_generator_table[SLEW_GENERATOR_TABLE_SIZE] = {
-     2147483647, 2139103233, 2130755524, 2122440391, 2114157707, 2105907346, 2097689182, 2089503088,
-     2081348940, 2073226613, 2065135983, 2057076926, 2049049319, 2041053039, 2033087964, 2025153972,
-     2017250942, 2009378754, 2001537285, 1993726418, 1985946032, 1978196009, 1970476229, 1962786576,
-     1955126931, 1947497177, 1939897197, 1932326876, 1924786098, 1917274747, 1909792709, 1902339869,
-     1894916113, 1887521328, 1880155400, 1872818218, 1865509668, 1858229640, 1850978021, 1843754701,
-     1836559570, 1829392518, 1822253434, 1815142210, 1808058737, 1801002907, 1793974612, 1786973745,
-     1780000197, 1773053864, 1766134638, 1759242414, 1752377087, 1745538551, 1738726702, 1731941435,
-     1725182648, 1718450236, 1711744098, 1705064129, 1698410229, 1691782295, 1685180226, 1678603921,
-     1672053280, 1665528203, 1659028589, 1652554339, 1646105355, 1639681537, 1633282788, 1626909010,
-     1620560104, 1614235975, 1607936526, 1601661660, 1595411281, 1589185293, 1582983603, 1576806113,
-     1570652732, 1564523363, 1558417914, 1552336290, 1546278400, 1540244151, 1534233450, 1528246205,
-     1522282325, 1516341718, 1510424295, 1504529964, 1498658635, 1492810218, 1486984625, 1481181765,
-     1475401551, 1469643894, 1463908705, 1458195898, 1452505385, 1446837078, 1441190892, 1435566740,
-     1429964535, 1424384193, 1418825627, 1413288754, 1407773488, 1402279744, 1396807440, 1391356491,
-     1385926814, 1380518326, 1375130945, 1369764587, 1364419171, 1359094615, 1353790838, 1348507758,
-     1343245296, 1338003369, 1332781900, 1327580806, 1322400010, 1317239431, 1312098991, 1306978611,
-     1301878213, 1296797719, 1291737052, 1286696133, 1281674886, 1276673234, 1271691101, 1266728411,
-     1261785086, 1256861053, 1251956236, 1247070559, 1242203949, 1237356330, 1232527628, 1227717770,
-     1222926683, 1218154292, 1213400525, 1208665310, 1203948573, 1199250243, 1194570248, 1189908516,
-     1185264977, 1180639558, 1176032190, 1171442802, 1166871324, 1162317686, 1157781817, 1153263650,
-     1148763115, 1144280143, 1139814665, 1135366613, 1130935920, 1126522517, 1122126337, 1117747313,
-     1113385378, 1109040465, 1104712508, 1100401440, 1096107196, 1091829710, 1087568916, 1083324750,
-     1079097147, 1074886041, 1070691370, 1066513067, 1062351070, 1058205315, 1054075739, 1049962278,
-     1045864869, 1041783450, 1037717959, 1033668333, 1029634511, 1025616430, 1021614029, 1017627248,
-     1013656025, 1009700299, 1005760010, 1001835098,  997925503,  994031164,  990152023,  986288020,
-      982439096,  978605192,  974786250,  970982211,  967193017,  963418610,  959658932,  955913927,
-      952183536,  948467702,  944766370,  941079481,  937406980,  933748811,  930104918,  926475245,
-      922859737,  919258337,  915670992,  912097647,  908538246,  904992735,  901461061,  897943168,
-      894439004,  890948515,  887471647,  884008348,  880558563,  877122242,  873699330,  870289776,
-      866893527,  863510533,  860140740,  856784097,  853440554,  850110058,  846792560,  843488008,
-      840196351,  836917540,  833651525,  830398255,  827157680,  823929752,  820714421,  817511637,
-      814321351,  811143516,  807978082,  804825001,  801684224,  798555704,  795439393,  792335244,
-      789243208,  786163238,  783095288,  780039310,  776995258,  773963085,  770942745,  767934192,
-      764937380,  761952262,  758978793,  756016929,  753066623,  750127830,  747200505,  744284605,
-      741380083,  738486896,  735605000,  732734350,  729874902,  727026614,  724189440,  721363339,
-      718548266,  715744178,  712951034,  710168790,  707397403,  704636831,  701887032,  699147964,
-      696419586,  693701854,  690994728,  688298167,  685612129,  682936573,  680271458,  677616743,
-      674972388,  672338353,  669714597,  667101080,  664497762,  661904603,  659321564,  656748605,
-      654185687,  651632771,  649089817,  646556787,  644033641,  641520343,  639016852,  636523131,
-      634039141,  631564845,  629100205,  626645183,  624199741,  621763843,  619337451,  616920527,
-      614513035,  612114939,  609726201,  607346784,  604976653,  602615772,  600264104,  597921613,
-      595588263,  593264019,  590948845,  588642706,  586345567,  584057392,  581778147,  579507796,
-      577246305,  574993639,  572749764,  570514646,  568288250,  566070543,  563861490,  561661058,
-      559469212,  557285921,  555111149,  552944865,  550787034,  548637624,  546496601,  544363934,
-      542239590,  540123536,  538015739,  535916168,  533824791,  531741575,  529666488,  527599500,
-      525540578,  523489690,  521446806,  519411894,  517384924,  515365863,  513354682,  511351349,
-      509355834,  507368107,  505388136,  503415892,  501451345,  499494464,  497545220,  495603582,
-      493669522,  491743009,  489824015,  487912509,  486008462,  484111846,  482222632,  480340790,
-      478466291,  476599108,  474739212,  472886573,  471041165,  469202958,  467371924,  465548036,
-      463731265,  461921585,  460118966,  458323382,  456534805,  454753208,  452978564,  451210845,
-      449450024,  447696075,  445948971,  444208684,  442475189,  440748459,  439028467,  437315188,
-      435608594,  433908660,  432215360,  430528668,  428848559,  427175005,  425507983,  423847466,
-      422193429,  420545847,  418904695,  417269947,  415641578,  414019565,  412403881,  410794502,
-      409191403,  407594561,  406003950,  404419546,  402841326,  401269264,  399703337,  398143521,
-      396589792,  395042127,  393500501,  391964891,  390435274,  388911626,  387393924,  385882145,
-      384376265,  382876262,  381382113,  379893794,  378411284,  376934559,  375463596,  373998374,
-      372538870,  371085062,  369636927,  368194443,  366757589,  365326342,  363900680,  362480581,
-      361066025,  359656988,  358253451,  356855390,  355462785,  354075615,  352693859,  351317494,
-      349946501,  348580858,  347220544,  345865538,  344515821,  343171371,  341832167,  340498190,
-      339169418,  337845832,  336527411,  335214134,  333905983,  332602937,  331304976,  330012080,
-      328724230,  327441405,  326163587,  324890755,  323622890,  322359973,  321101985,  319848905,
-      318600716,  317357398,  316118932,  314885298,  313656479,  312432455,  311213208,  309998719,
-      308788970,  307583941,  306383615,  305187973,  303996997,  302810669,  301628970,  300451883,
-      299279390,  298111472,  296948111,  295789291,  294634993,  293485199,  292339892,  291199055,
-      290062670,  288930720,  287803186,  286680053,  285561303,  284446919,  283336884,  282231180,
-      281129792,  280032701,  278939892,  277851348,  276767051,  275686986,  274611136,  273539484,
-      272472014,  271408710,  270349555,  269294534,  268243630,  267196827,  266154109,  265115460,
-      264080864,  263050306,  262023770,  261001239,  259982699,  258968134,  257957528,  256950865,
-      255948132,  254949311,  253954388,  252963348,  251976175,  250992855,  250013372,  249037711,
-      248065858,  247097797,  246133514,  245172994,  244216223,  243263185,  242313867,  241368253,
-      240426329,  239488081,  238553495,  237622555,  236695249,  235771561,  234851478,  233934986,
-      233022070,  232112717,  231206912,  230304643,  229405894,  228510653,  227618905,  226730637,
-      225845836,  224964487,  224086578,  223212095,  222341024,  221473353,  220609068,  219748156,
-      218890603,  218036397,  217185524,  216337972,  215493727,  214652777,  213815109,  212980710,
-      212149566,  211321667,  210496998,  209675547,  208857302,  208042250,  207230379,  206421676,
-      205616129,  204813726,  204014454,  203218301,  202425255,  201635304,  200848435,  200064637,
-      199283898,  198506206,  197731549,  196959914,  196191291,  195425668,  194663032,  193903372,
-      193146677,  192392935,  191642134,  190894263,  190149311,  189407266,  188668117,  187931852,
-      187198460,  186467930,  185740252,  185015413,  184293402,  183574209,  182857823,  182144232,
-      181433427,  180725395,  180020126,  179317609,  178617834,  177920790,  177226465,  176534851,
-      175845935,  175159708,  174476159,  173795277,  173117052,  172441475,  171768533,  171098218,
-      170430518,  169765424,  169102926,  168443013,  167785675,  167130903,  166478685,  165829013,
-      165181876,  164537265,  163895169,  163255579,  162618485,  161983877,  161351746,  160722081,
-      160094874,  159470114,  158847793,  158227899,  157610426,  156995361,  156382697,  155772424,
-      155164532,  154559013,  153955857,  153355054,  152756596,  152160474,  151566677,  150975198,
-      150386028,  149799156,  149214575,  148632275,  148052247,  147474483,  146898973,  146325710,
-      145754683,  145185885,  144619307,  144054940,  143492775,  142932804,  142375018,  141819409,
-      141265968,  140714687,  140165557,  139618570,  139073718,  138530992,  137990384,  137451885,
-      136915489,  136381185,  135848966,  135318825,  134790752,  134264740,  133740781,  133218866,
-      132698988,  132181139,  131665311,  131151496,  130639686,  130129873,  129622050,  129116208,
-      128612341,  128110439,  127610497,  127112505,  126616457,  126122345,  125630161,  125139897,
-      124651547,  124165103,  123680556,  123197901,  122717130,  122238234,  121761207,  121286042,
-      120812731,  120341268,  119871644,  119403853,  118937887,  118473740,  118011404,  117550872,
-      117092138,  116635193,  116180032,  115726647,  115275032,  114825178,  114377081,  113930732,
-      113486124,  113043252,  112602109,  112162686,  111724979,  111288979,  110854681,  110422078,
-      109991163,  109561930,  109134372,  108708482,  108284255,  107861682,  107440759,  107021479,
-      106603835,  106187820,  105773429,  105360655,  104949492,  104539934,  104131974,  103725606,
-      103320823,  102917620,  102515991,  102115929,  101717429,  101320483,  100925087,  100531233,
-      100138917,   99748131,   99358871,   98971129,   98584901,   98200180,   97816960,   97435236,
-       97055001,   96676250,   96298978,   95923177,   95548843,   95175970,   94804552,   94434584,
-       94066059,   93698973,   93333319,   92969091,   92606286,   92244896,   91884916,   91526341,
-       91169166,   90813384,   90458991,   90105981,   89754348,   89404088,   89055194,   88707662,
-       88361486,   88016661,   87673182,   87331043,   86990240,   86650766,   86312617,   85975788,
-       85640273,   85306067,   84973166,   84641564,   84311256,   83982237,   83654501,   83328045,
-       83002863,   82678950,   82356301,   82034911,   81714775,   81395888,   81078246,   80761844,
-       80446676,   80132738,   79820025,   79508533,   79198256,   78889190,   78581330,   78274672,
-       77969210,   77664940,   77361858,   77059959,   76759237,   76459689,   76161310,   75864096,
-       75568041,   75273142,   74979394,   74686791,   74395331,   74105008,   73815818,   73527757,
-       73240820,   72955002,   72670300,   72386709,   72104225,   71822843,   71542559,   71263369,
-       70985268,   70708253,   70432318,   70157461,   69883676,   69610960,   69339308,   69068715,
-       68799179,   68530695,   68263259,   67996866,   67731512,   67467195,   67203908,   66941650,
-       66680414,   66420198,   66160998,   65902809,   65645627,   65389450,   65134272,   64880090,
-       64626899,   64374697,   64123479,   63873241,   63623980,   63375692,   63128372,   62882018,
-       62636625,   62392190,   62148708,   61906177,   61664592,   61423950,   61184248,   60945480,
-       60707644,   60470737,   60234754,   59999692,   59765547,   59532316,   59299995,   59068580,
-       58838069,   58608457,   58379742,   58151919,   57924985,   57698936,   57473770,   57249482,
-       57026070,   56803529,   56581857,   56361050,   56141105,   55922018,   55703786,   55486406,
-       55269874,   55054187,   54839341,   54625335,   54412163,   54199823,   53988312,   53777626,
-       53567762,   53358718,   53150489,   52943072,   52736466,   52530665,   52325667,   52121470,
-       51918069,   51715463,   51513646,   51312618,   51112374,   50912911,   50714227,   50516318,
-       50319181,   50122814,   49927213,   49732375,   49538298,   49344978,   49152412,   48960598,
-       48769533,   48579213,   48389636,   48200798,   48012698,   47825332,   47638696,   47452790,
-       47267608,   47083149,   46899411,   46716389,   46534081,   46352485,   46171597,   45991416,
-       45811937,   45633159,   45455079,   45277693,   45101000,   44924996,   44749680,   44575047,
-       44401096,   44227823,   44055227,   43883305,   43712053,   43541470,   43371552,   43202297,
-       43033703,   42865767,   42698486,   42531858,   42365880,   42200550,   42035865,   41871823,
-       41708421,   41545657,   41383528,   41222031,   41061165,   40900926,   40741313,   40582323,
-       40423953,   40266201,   40109065,   39952542,   39796630,   39641326,   39486628,   39332534,
-};
+// exp(-4 * i / (SLEW_GENERATOR_TABLE_SIZE - 1)) in Q31_MAX units, truncated
+// Read by each slew step in the audio loop, one shared copy in RAM (4 kB)
+FASTDATA_INLINE(slew_generator_table) inline constexpr std::array<int32_t, SLEW_GENERATOR_TABLE_SIZE> slew_generator_table =
+    kastle2::lookup_exp_decay_table<int32_t, SLEW_GENERATOR_TABLE_SIZE>(4.0, 2147483647.0, kastle2::LookupRounding::TRUNCATE);
@@ -43,4 +43,15 @@ void copy_fastcode_to_ram(void)
     }
 }
 
+void copy_fastcode_overlay_to_ram(const FastcodeOverlay &overlay)
+{
+    // All the overlays are linked to run from the end of .fastcode
+    const uint32_t *src = overlay.load_start;
+    uint32_t *dst = &__fastcode_end__;
+    while (src < overlay.load_end)
+    {
+        *dst++ = *src++;
+    }
+}
+
 #endif
\ No newline at end of file
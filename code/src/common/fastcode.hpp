@@ -24,6 +24,8 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstdint>
+
 /**
  * @file fastcode.hpp
  * @ingroup core
@@ -33,12 +35,58 @@ SOFTWARE.
  *
  * Code marked with FASTCODE is placed in a separate section in the compiled binary.
  * That section is copied to RAM at startup by calling copy_fastcode_to_ram() function and executed from there.
+ *
+ * Functions can also be moved there by the linker, without FASTCODE, by listing them in
+ * common/fastcode_hot.txt (all apps) or in the app's APP_FASTCODE_HOT list.
+ * After each build, build/output/kastle2-<app>-fastcode.txt shows the RAM used by each function
+ * and the largest functions still running from the flash (scripts/fastcode_report.py).
+ *
+ * The apps mark their own functions with FASTCODE_APP(name), name being the app's overlay (fx_wizard etc.).
+ * The single app images place them in .fastcode as well. The multi-app image (apps/MultiApp) gives each app
+ * its own overlay, with the app's hot list (APP_FASTCODE_OVERLAYS). All the overlays run from the same RAM
+ * right after .fastcode and Kastle2::RegisterApp() copies only the registered app's one there,
+ * so the RAM holds the common hot path and one app, not the sum of all of them.
+ *
+ * Lookup tables read in the audio loop can be marked with FASTDATA (FASTDATA_INLINE for inline tables
+ * in headers), so they are read from RAM instead of going through the XIP cache, where they evict the code.
+ * The fastcode report lists them with the RAM they take.
+ *
+ * The rest runs from the flash through the XIP cache. Rarely run functions (startup, settings, test mode)
+ * are marked COLDCODE, GCC optimizes them for size and the linker packs them together with the startup code,
+ * away from the functions of the UI loop (common/flash_hot.txt), which are grouped right after them.
  */
 
 /**
  * @brief Enables "fast code" functionality.
+ * @note Define KASTLE2_FASTCODE_DISABLED for the whole target to run everything from flash (benchmarking etc.).
  */
+#ifndef KASTLE2_FASTCODE_DISABLED
 #define FASTCODE_ENABLED
+#endif
+
+/**
+ * @brief Load image of an app overlay in the flash, see FASTCODE_OVERLAY().
+ * Empty (the default) for the single app images, which have no overlays.
+ */
+struct FastcodeOverlay
+{
+    const uint32_t *load_start = nullptr; ///< First word of the image
+    const uint32_t *load_end = nullptr;   ///< Word after the image
+};
+
+/**
+ * @brief Marks a rarely run function (startup, settings, test mode), optimized for size and kept out of the hot code.
+ * GCC places cold functions in .text.unlikely.*, which the linker script puts together at the start of .text.
+ * @note The calls to it are treated as unlikely too (a function always calling it becomes cold as well),
+ *       don't use it on anything the UI loop or the audio runs on each pass.
+ */
+#define COLDCODE __attribute__((cold)) __attribute__((noinline))
+
+/**
+ * @brief Keeps a function out of line, so it runs from the flash even when a FASTCODE function calls it.
+ * For the rarely taken paths of a hot function, which would take the RAM of the FASTCODE region when inlined into it.
+ */
+#define FLASHCODE __attribute__((noinline))
 
 // Actual implementation
 
@@ -55,6 +103,45 @@ SOFTWARE.
  */
 void copy_fastcode_to_ram(void);
 
+/**
+ * @brief Marks a function of the app, placed in the overlay of the given name (a C identifier, eg. fx_wizard).
+ * Use the same name for all the app's functions, in the declarations as well as the definitions.
+ * @note Only for the app's own functions, the inline functions of the shared headers use FASTCODE.
+ */
+#define FASTCODE_APP(name) __attribute__((section(".fastcode.app." #name))) __attribute__((noinline))
+
+/**
+ * @brief Declares the linker symbols of the overlay (the linker defines them for each OVERLAY section).
+ * Use once, outside of any function, before FASTCODE_OVERLAY().
+ */
+#define FASTCODE_OVERLAY_DECLARE(name)            \
+    extern uint32_t __load_start_fastcode_##name[]; \
+    extern uint32_t __load_stop_fastcode_##name[]
+
+/**
+ * @brief Load image of the named overlay, for Kastle2::RegisterApp().
+ */
+#define FASTCODE_OVERLAY(name) FastcodeOverlay{__load_start_fastcode_##name, __load_stop_fastcode_##name}
+
+/**
+ * @brief Copies the app overlay to RAM, right after .fastcode. Called by Kastle2::RegisterApp().
+ * @note The overlay previously there is overwritten, so its functions must not run anymore (on any core).
+ */
+void copy_fastcode_overlay_to_ram(const FastcodeOverlay &overlay);
+
+/**
+ * @brief Marks a read-only table to be placed in RAM.
+ * It goes to the .data section, which is copied to RAM by the startup code, so it doesn't use the FASTCODE region.
+ * @note Only for const tables, GCC rejects const and writable variables in the same section.
+ */
+#define FASTDATA __attribute__((section(".data.fastdata")))
+
+/**
+ * @brief FASTDATA for an inline table defined in a header, placed once in RAM for all the translation units.
+ * GCC rejects inline (COMDAT) and plain variables in the same section, so each of these tables gets its own.
+ */
+#define FASTDATA_INLINE(name) __attribute__((section(".data.fastdata." #name)))
+
 #else
 
 /**
@@ -62,4 +149,29 @@ void copy_fastcode_to_ram(void);
  */
 #define FASTCODE
 
+/**
+ * @brief Placeholder if fastcode is disabled.
+ */
+#define FASTCODE_APP(name)
+
+/**
+ * @brief Placeholder if fastcode is disabled.
+ */
+#define FASTCODE_OVERLAY_DECLARE(name) static_assert(true, #name)
+
+/**
+ * @brief Placeholder if fastcode is disabled, there are no overlays.
+ */
+#define FASTCODE_OVERLAY(name) FastcodeOverlay{}
+
+/**
+ * @brief Placeholder if fastcode is disabled.
+ */
+#define FASTDATA
+
+/**
+ * @brief Placeholder if fastcode is disabled.
+ */
+#define FASTDATA_INLINE(name)
+
 #endif
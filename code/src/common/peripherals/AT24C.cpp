@@ -25,32 +25,31 @@ SOFTWARE.
 #include "AT24C.hpp"
 #include <cstdlib>
 #include <cstring>
-#include <memory>
 #include "hardware/i2c.h"
 
 using namespace kastle2;
 
-void AT24C::Init(i2c_inst_t *i2c_inst, uint8_t i2c_address)
+void AT24C::Init(I2cBus &bus, uint8_t i2c_address)
 {
-    i2c_inst_ = i2c_inst;
+    bus_ = &bus;
     i2c_address_ = i2c_address;
 }
 
 bool AT24C::Read(uint16_t address, uint8_t *data, size_t len)
 {
-    uint8_t addr_buffer[kMaxAddressSize];
-    WriteAddressTo(address, addr_buffer);
-
-    size_t count = 0;
-    count = i2c_write_blocking_until(i2c_inst_, i2c_address_, addr_buffer, address_size_, true, make_timeout_time_ms(kReadTimeout));
-    if (count == 0)
-    {
-        return false;
-    }
-    count = i2c_read_blocking_until(i2c_inst_, i2c_address_, data, len, false, make_timeout_time_ms(kReadTimeout));
-    if (count == 0)
+    // The memory reads on from the given address, each transaction reads a part
+    while (len > 0)
     {
-        return false;
+        const size_t read_len = len < kMaxQueuedRead ? len : kMaxQueuedRead;
+        uint8_t addr_buffer[kMaxAddressSize];
+        WriteAddressTo(address, addr_buffer);
+        if (!bus_->Read(i2c_address_, addr_buffer, address_size_, data, read_len))
+        {
+            return false;
+        }
+        address += read_len;
+        data += read_len;
+        len -= read_len;
     }
     return true;
 }
@@ -86,20 +85,54 @@ size_t AT24C::PageWrite(uint16_t address, const uint8_t *data, size_t len)
         write_len = len;
     }
 
-    // Dynamically allocate buffer for address + data
+    // Buffer for address + data
+    uint8_t buffer[kMaxAddressSize + I2cBus::kMaxBytes];
     size_t buffer_size = address_size_ + write_len;
-    std::unique_ptr<uint8_t[]> buffer(new uint8_t[buffer_size]);
-    WriteAddressTo(address, buffer.get());
-    memcpy(buffer.get() + address_size_, data, write_len);
-    i2c_write_blocking_until(i2c_inst_, i2c_address_, buffer.get(), buffer_size, false, make_timeout_time_ms(kWriteTimeout));
+    WriteAddressTo(address, buffer);
+    memcpy(buffer + address_size_, data, write_len);
 
-    // Sleep to allow EEPROM to write the data
-    sleep_ms(kWriteDelay);
+    // The bus holds the memory while it writes the data, the next access waits for it
+    bus_->Write(i2c_address_, buffer, buffer_size, buffer_size, kWriteDelay * 1000);
 
     // Returns number of written bytes
     return write_len;
 }
 
+bool AT24C::QueuePageWrite(uint16_t address, const uint8_t *data, size_t len, I2cBus::Job *job)
+{
+    if (len == 0 || address % page_size_ + len > page_size_ || address_size_ + len > I2cBus::kMaxBytes)
+    {
+        return false;
+    }
+
+    uint8_t buffer[I2cBus::kMaxBytes];
+    WriteAddressTo(address, buffer);
+    memcpy(buffer + address_size_, data, len);
+    return bus_->QueueWrite(i2c_address_, buffer, address_size_ + len, address_size_ + len, kWriteDelay * 1000, job);
+}
+
+bool AT24C::QueueRead(uint16_t address, uint8_t *data, size_t len, I2cBus::Job *job)
+{
+    if (len > kMaxQueuedRead)
+    {
+        return false;
+    }
+
+    uint8_t addr_buffer[kMaxAddressSize];
+    WriteAddressTo(address, addr_buffer);
+    return bus_->QueueRead(i2c_address_, addr_buffer, address_size_, data, len, job);
+}
+
+bool AT24C::Wait(const I2cBus::Job &job)
+{
+    return bus_->Wait(job);
+}
+
+bool AT24C::IsBusy() const
+{
+    return bus_->IsBusy(i2c_address_);
+}
+
 bool AT24C::WriteByte(uint16_t address, uint8_t data)
 {
     return Write(address, &data, 1);
@@ -25,6 +25,7 @@ SOFTWARE.
 #pragma once
 
 #include "hardware/i2c.h"
+#include "common/peripherals/I2cBus.hpp"
 
 namespace kastle2
 {
@@ -73,7 +74,7 @@ public:
      * Sets up the I2C memory
      * doesn't connect to it yet
      */
-    void Init(i2c_inst_t *i2c_inst, uint8_t i2c_address_ = kDefaultI2cAddress);
+    void Init(I2cBus &bus, uint8_t i2c_address_ = kDefaultI2cAddress);
 
     /**
      * Writes an array of bytes
@@ -87,6 +88,26 @@ public:
      */
     bool WriteByte(uint16_t address, uint8_t data);
 
+    /**
+     * Queues a write within one page on the I2C bus, returns right away
+     * The bus holds the memory during its write cycle, the codec can use the bus meanwhile
+     * If the data crosses the page or the bus queue is full, returns false
+     */
+    bool QueuePageWrite(uint16_t address, const uint8_t *data, size_t len, I2cBus::Job *job = nullptr);
+    /**
+     * Queues a read of up to kMaxQueuedRead bytes on the I2C bus, returns right away
+     * The data buffer has to stay valid until the job is done
+     * If the bus queue is full, returns false
+     */
+    bool QueueRead(uint16_t address, uint8_t *data, size_t len, I2cBus::Job *job);
+    /**
+     * Waits for a queued job, returns false if it failed
+     */
+    bool Wait(const I2cBus::Job &job);
+    /**
+     * Checks if a queued write is still being sent or written by the memory
+     */
+    bool IsBusy() const;
     /**
      * Reads an array of bytes
      * If the reading fails (eg. chip not available), returns false
@@ -119,10 +140,14 @@ public:
      * Simple timeout for reading.
      */
     static constexpr uint32_t kReadTimeout = 100;
+    /**
+     * Longest read of one I2C transaction, the longer reads are split
+     */
+    static constexpr size_t kMaxQueuedRead = I2cBus::kMaxBytes - kMaxAddressSize;
 
 private:
     uint8_t i2c_address_;
-    i2c_inst_t *i2c_inst_;
+    I2cBus *bus_ = nullptr;
 
     size_t size_;
     size_t address_size_;
@@ -0,0 +1,430 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "I2cBus.hpp"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+using namespace kastle2;
+
+#ifndef KASTLE2_HOST
+// Bus instance for the I2C interrupt handler
+static I2cBus *i2c_bus_instance = nullptr;
+
+static void i2c_irq_handler()
+{
+    if (i2c_bus_instance != nullptr)
+    {
+        i2c_bus_instance->IrqHandler();
+    }
+}
+#endif
+
+void I2cBus::Init(i2c_inst_t *i2c_inst)
+{
+    i2c_inst_ = i2c_inst;
+    running_ = nullptr;
+    errors_ = 0;
+    for (Transaction &transaction : queue_)
+    {
+        transaction.queued = false;
+    }
+    holds_ = {};
+
+#ifndef KASTLE2_HOST
+    tx_dma_channel_ = dma_claim_unused_channel(true);
+    rx_dma_channel_ = dma_claim_unused_channel(true);
+
+    // The TX DREQ asks for data while the FIFO is at most half full, the RX DREQ for each received byte
+    i2c_hw_t *hw = i2c_get_hw(i2c_inst_);
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+    hw->dma_tdlr = 8;
+    hw->dma_rdlr = 0;
+
+    // STOP of each message, the one of the last message completes the transaction
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    i2c_bus_instance = this;
+    const uint irq = I2C0_IRQ + i2c_hw_index(i2c_inst_);
+    irq_set_exclusive_handler(irq, i2c_irq_handler);
+    irq_set_enabled(irq, true);
+#endif
+}
+
+bool I2cBus::QueueWrite(uint8_t address, const uint8_t *data, size_t size, size_t message_size, uint32_t hold_us, Job *job)
+{
+    if (size == 0 || size > kMaxBytes || message_size == 0 || size % message_size != 0)
+    {
+        return false;
+    }
+
+    Transaction *transaction = Claim();
+    if (transaction == nullptr)
+    {
+        return false;
+    }
+
+    transaction->address = address;
+    transaction->size = static_cast<uint16_t>(size);
+    transaction->hold_us = hold_us;
+    transaction->read_buffer = nullptr;
+    transaction->read_size = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        const bool stop = (i + 1) % message_size == 0;
+        transaction->commands[i] = data[i] | (stop ? I2C_IC_DATA_CMD_STOP_BITS : 0);
+    }
+
+    Submit(*transaction, job);
+    return true;
+}
+
+bool I2cBus::QueueRead(uint8_t address, const uint8_t *command, size_t command_size, uint8_t *buffer, size_t size, Job *job)
+{
+    if (size == 0 || command_size + size > kMaxBytes)
+    {
+        return false;
+    }
+
+    Transaction *transaction = Claim();
+    if (transaction == nullptr)
+    {
+        return false;
+    }
+
+    transaction->address = address;
+    transaction->size = static_cast<uint16_t>(command_size + size);
+    transaction->hold_us = 0;
+    transaction->read_buffer = buffer;
+    transaction->read_size = static_cast<uint16_t>(size);
+    for (size_t i = 0; i < command_size; i++)
+    {
+        transaction->commands[i] = command[i];
+    }
+    // Read commands, the first one turns the bus around, the last one ends the transaction
+    for (size_t i = 0; i < size; i++)
+    {
+        uint32_t read = I2C_IC_DATA_CMD_CMD_BITS;
+        if (i == 0 && command_size > 0)
+        {
+            read |= I2C_IC_DATA_CMD_RESTART_BITS;
+        }
+        if (i + 1 == size)
+        {
+            read |= I2C_IC_DATA_CMD_STOP_BITS;
+        }
+        transaction->commands[command_size + i] = read;
+    }
+
+    Submit(*transaction, job);
+    return true;
+}
+
+bool I2cBus::Write(uint8_t address, const uint8_t *data, size_t size, size_t message_size, uint32_t hold_us)
+{
+    Job job;
+    while (!QueueWrite(address, data, size, message_size, hold_us, &job))
+    {
+        if (GetFreeTransactions() > 0)
+        {
+            return false; // Doesn't fit
+        }
+        Process();
+        busy_wait_us_32(kPollUs);
+    }
+    return Wait(job);
+}
+
+bool I2cBus::Read(uint8_t address, const uint8_t *command, size_t command_size, uint8_t *buffer, size_t size)
+{
+    Job job;
+    while (!QueueRead(address, command, command_size, buffer, size, &job))
+    {
+        if (GetFreeTransactions() > 0)
+        {
+            return false; // Doesn't fit
+        }
+        Process();
+        busy_wait_us_32(kPollUs);
+    }
+    return Wait(job);
+}
+
+bool I2cBus::Wait(const Job &job)
+{
+    while (job.IsPending())
+    {
+        Process();
+        busy_wait_us_32(kPollUs);
+    }
+    return job.status == Status::DONE;
+}
+
+void I2cBus::WaitIdle(uint8_t address)
+{
+    while (IsBusy(address))
+    {
+        Process();
+        busy_wait_us_32(kPollUs);
+    }
+}
+
+void I2cBus::Process()
+{
+    const uint32_t interrupts = save_and_disable_interrupts();
+#ifndef KASTLE2_HOST
+    if (running_ != nullptr && absolute_time_diff_us(started_, get_absolute_time()) > kTimeoutUs)
+    {
+        // Stuck bus, disabling the controller drops the FIFOs
+        dma_channel_abort(tx_dma_channel_);
+        dma_channel_abort(rx_dma_channel_);
+        i2c_get_hw(i2c_inst_)->enable = 0;
+        errors_ = errors_ + 1;
+        Complete(false);
+    }
+#endif
+    if (running_ == nullptr)
+    {
+        StartNext();
+    }
+    restore_interrupts(interrupts);
+}
+
+bool I2cBus::IsBusy(uint8_t address) const
+{
+    const uint32_t interrupts = save_and_disable_interrupts();
+    bool busy = IsHeld(address);
+    for (const Transaction &transaction : queue_)
+    {
+        busy |= transaction.queued && transaction.address == address;
+    }
+    restore_interrupts(interrupts);
+    return busy;
+}
+
+size_t I2cBus::GetFreeTransactions() const
+{
+    size_t free = 0;
+    for (const Transaction &transaction : queue_)
+    {
+        free += transaction.queued ? 0 : 1;
+    }
+    return free;
+}
+
+void I2cBus::IrqHandler()
+{
+#ifndef KASTLE2_HOST
+    i2c_hw_t *hw = i2c_get_hw(i2c_inst_);
+    const uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS)
+    {
+        // NACK or lost arbitration, the controller flushes the FIFO until the abort is cleared.
+        // The next transaction is started by Process(), after the STOP of this one.
+        dma_channel_abort(tx_dma_channel_);
+        dma_channel_abort(rx_dma_channel_);
+        (void)hw->clr_tx_abrt;
+        (void)hw->clr_stop_det;
+        if (running_ != nullptr)
+        {
+            errors_ = errors_ + 1;
+            Complete(false);
+        }
+        return;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS)
+    {
+        (void)hw->clr_stop_det;
+
+        // The STOP of the last message, nothing is left to send
+        if (running_ != nullptr && !dma_channel_is_busy(tx_dma_channel_) && (hw->status & I2C_IC_STATUS_TFE_BITS))
+        {
+            // The last received byte can still be on its way to the buffer
+            while (running_->read_size > 0 && dma_channel_is_busy(rx_dma_channel_))
+            {
+                tight_loop_contents();
+            }
+            Complete(true);
+            StartNext();
+        }
+    }
+#endif
+}
+
+I2cBus::Transaction *I2cBus::Claim()
+{
+    // The interrupt only frees the transactions, a free one stays free while it's filled
+    for (Transaction &transaction : queue_)
+    {
+        if (!transaction.queued)
+        {
+            return &transaction;
+        }
+    }
+    return nullptr;
+}
+
+void I2cBus::Submit(Transaction &transaction, Job *job)
+{
+    transaction.job = job;
+    if (job != nullptr)
+    {
+        job->status = Status::QUEUED;
+    }
+
+    const uint32_t interrupts = save_and_disable_interrupts();
+    transaction.sequence = sequence_++;
+    transaction.queued = true;
+    if (running_ == nullptr)
+    {
+        StartNext();
+    }
+    restore_interrupts(interrupts);
+}
+
+bool I2cBus::IsHeld(uint8_t address) const
+{
+    for (const DeviceHold &hold : holds_)
+    {
+        if (hold.address == address && absolute_time_diff_us(get_absolute_time(), hold.until) > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void I2cBus::Hold(uint8_t address, uint32_t hold_us)
+{
+    // The device's own slot, or the one which expired first
+    DeviceHold *slot = &holds_[0];
+    for (DeviceHold &hold : holds_)
+    {
+        if (hold.address == address)
+        {
+            slot = &hold;
+            break;
+        }
+        if (absolute_time_diff_us(hold.until, slot->until) > 0)
+        {
+            slot = &hold;
+        }
+    }
+    slot->address = address;
+    slot->until = make_timeout_time_us(hold_us);
+}
+
+void I2cBus::StartNext()
+{
+    // Oldest ready transaction, the held devices wait
+    Transaction *next = nullptr;
+    for (Transaction &transaction : queue_)
+    {
+        if (transaction.queued && !IsHeld(transaction.address) &&
+            (next == nullptr || sequence_ - transaction.sequence > sequence_ - next->sequence))
+        {
+            next = &transaction;
+        }
+    }
+    if (next != nullptr)
+    {
+        Start(*next);
+    }
+}
+
+void I2cBus::Start(Transaction &transaction)
+{
+    running_ = &transaction;
+    started_ = get_absolute_time();
+
+#ifndef KASTLE2_HOST
+    i2c_hw_t *hw = i2c_get_hw(i2c_inst_);
+    hw->enable = 0;
+    hw->tar = transaction.address;
+    hw->enable = 1;
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+
+    dma_channel_config config;
+    if (transaction.read_size > 0)
+    {
+        config = dma_channel_get_default_config(rx_dma_channel_);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+        channel_config_set_read_increment(&config, false);
+        channel_config_set_write_increment(&config, true);
+        channel_config_set_dreq(&config, i2c_get_dreq(i2c_inst_, false));
+        dma_channel_configure(rx_dma_channel_, &config, transaction.read_buffer, &hw->data_cmd, transaction.read_size, true);
+    }
+
+    config = dma_channel_get_default_config(tx_dma_channel_);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, i2c_get_dreq(i2c_inst_, true));
+    dma_channel_configure(tx_dma_channel_, &config, &hw->data_cmd, transaction.commands.data(), transaction.size, true);
+#else
+    // Message by message with the blocking calls of the emulated bus
+    const absolute_time_t timeout = make_timeout_time_us(kTimeoutUs);
+    const size_t write_size = transaction.size - transaction.read_size;
+    uint8_t message[kMaxBytes];
+    size_t length = 0;
+    bool success = true;
+    for (size_t i = 0; i < write_size; i++)
+    {
+        message[length++] = transaction.commands[i] & 0xFF;
+        if (transaction.commands[i] & I2C_IC_DATA_CMD_STOP_BITS)
+        {
+            success &= i2c_write_blocking_until(i2c_inst_, transaction.address, message, length, false, timeout) == static_cast<int>(length);
+            length = 0;
+        }
+    }
+    if (transaction.read_size > 0)
+    {
+        if (length > 0)
+        {
+            success &= i2c_write_blocking_until(i2c_inst_, transaction.address, message, length, true, timeout) == static_cast<int>(length);
+        }
+        success &= i2c_read_blocking_until(i2c_inst_, transaction.address, transaction.read_buffer, transaction.read_size, false, timeout) == transaction.read_size;
+    }
+    Complete(success);
+#endif
+}
+
+void I2cBus::Complete(bool success)
+{
+    Transaction &transaction = *running_;
+    if (transaction.hold_us > 0)
+    {
+        Hold(transaction.address, transaction.hold_us);
+    }
+    if (transaction.job != nullptr)
+    {
+        transaction.job->status = success ? Status::DONE : Status::FAILED;
+    }
+    running_ = nullptr;
+    transaction.queued = false;
+}
@@ -0,0 +1,229 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+namespace kastle2
+{
+
+/**
+ * @class I2cBus
+ * @ingroup peripherals
+ * @brief Shared I2C bus of the codec and the EEPROM, with a small queue of DMA driven transactions.
+ * @note Don't access directly, use Kastle2::i2c_bus instead.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * A write transaction is a burst of messages to one device, each message ends with a STOP and the controller
+ * starts the next one by itself, so a whole burst is one DMA transfer to the DATA_CMD register.
+ * A read transaction writes the command bytes, then reads the data to the caller's buffer with a second DMA channel.
+ * The STOP_DET interrupt of the last message completes the transaction and starts the next one,
+ * so the queue runs without the UI loop. Process() in the UI loop only handles the timeouts and the held devices.
+ *
+ * A device can be held after a transaction (the EEPROM write cycle), the transactions of the other devices
+ * go on meanwhile. The queue is served oldest first, skipping the held devices.
+ *
+ * The caller can pass a Job to follow its transaction, Write() and Read() wait for it.
+ * Queue from the first core only. The host build runs the transactions right away on the emulated bus.
+ */
+class I2cBus
+{
+public:
+    /**
+     * @brief Queued transactions.
+     */
+    static constexpr size_t kMaxTransactions = 4;
+
+    /**
+     * @brief Bytes of one transaction, with the register or memory addresses.
+     */
+    static constexpr size_t kMaxBytes = 64;
+
+    /**
+     * @brief Transaction taking longer than this is aborted (100 kHz bus).
+     */
+    static constexpr uint32_t kTimeoutUs = 50000;
+
+    /**
+     * @brief State of a queued transaction.
+     */
+    enum class Status
+    {
+        IDLE,
+        QUEUED,
+        DONE,
+        FAILED,
+        COUNT
+    };
+
+    /**
+     * @brief Follows one transaction, owned by the caller until it's done.
+     */
+    struct Job
+    {
+        volatile Status status = Status::IDLE;
+
+        inline bool IsPending() const
+        {
+            return status == Status::QUEUED;
+        }
+    };
+
+    /**
+     * @brief Sets up the DMA channels and the interrupt. The I2C itself is initialized by Hardware::Init().
+     * @param i2c_inst I2C instance
+     */
+    void Init(i2c_inst_t *i2c_inst);
+
+    /**
+     * @brief Queues a burst of write messages to the device and starts it when the bus is free.
+     * @param address 7-bit device address
+     * @param data Messages one after another, copied to the queue
+     * @param size Total bytes, at most kMaxBytes
+     * @param message_size Bytes of each message, the size is a multiple of it
+     * @param hold_us Time the device is busy after the transaction (other devices can use the bus)
+     * @param job Optional, follows the transaction
+     * @return False if the queue is full or the transaction doesn't fit
+     */
+    bool QueueWrite(uint8_t address, const uint8_t *data, size_t size, size_t message_size, uint32_t hold_us = 0, Job *job = nullptr);
+
+    /**
+     * @brief Queues a read: writes the command bytes, then reads the data after a repeated START.
+     * @param address 7-bit device address
+     * @param command Command bytes (eg. register or memory address), copied to the queue
+     * @param command_size Number of command bytes
+     * @param buffer Receives the data, has to stay valid until the job is done
+     * @param size Bytes to read, the command and the data are at most kMaxBytes
+     * @param job Optional, follows the transaction
+     * @return False if the queue is full or the transaction doesn't fit
+     */
+    bool QueueRead(uint8_t address, const uint8_t *command, size_t command_size, uint8_t *buffer, size_t size, Job *job = nullptr);
+
+    /**
+     * @brief Blocking QueueWrite(), waits for a free transaction and the end of the write.
+     * @return True if the device acknowledged all the bytes
+     */
+    bool Write(uint8_t address, const uint8_t *data, size_t size, size_t message_size, uint32_t hold_us = 0);
+
+    /**
+     * @brief Blocking QueueRead(), waits for a free transaction and the data.
+     * @return True if the data were read
+     */
+    bool Read(uint8_t address, const uint8_t *command, size_t command_size, uint8_t *buffer, size_t size);
+
+    /**
+     * @brief Waits until the job is done, blocking.
+     * @return True if the transaction succeeded
+     */
+    bool Wait(const Job &job);
+
+    /**
+     * @brief Waits until the device has no queued or running transaction and isn't held, blocking.
+     * @param address 7-bit device address
+     */
+    void WaitIdle(uint8_t address);
+
+    /**
+     * @brief Aborts the transaction running too long and starts the transactions of the released devices.
+     *        Call it from the UI loop.
+     */
+    void Process();
+
+    /**
+     * @brief Checks if the device has a queued or running transaction or is held.
+     * @param address 7-bit device address
+     */
+    bool IsBusy(uint8_t address) const;
+
+    /**
+     * @brief Returns the number of free transactions of the queue.
+     */
+    size_t GetFreeTransactions() const;
+
+    /**
+     * @brief Returns the number of the aborted transactions (NACK, timeout).
+     */
+    inline uint32_t GetErrors() const
+    {
+        return errors_;
+    }
+
+    /**
+     * @brief Completes the transaction at the last STOP, called by the interrupt handler.
+     */
+    void IrqHandler();
+
+private:
+    struct Transaction
+    {
+        volatile bool queued = false;
+        uint8_t address = 0;
+        uint16_t size = 0;
+        uint32_t hold_us = 0;
+        uint32_t sequence = 0;
+        uint8_t *read_buffer = nullptr;
+        uint16_t read_size = 0;
+        Job *job = nullptr;
+        // DATA_CMD words, the last byte of each message has the STOP bit
+        std::array<uint32_t, kMaxBytes> commands;
+    };
+
+    struct DeviceHold
+    {
+        uint8_t address = 0;
+        absolute_time_t until{};
+    };
+
+    // Two devices on the bus, with a spare
+    static constexpr size_t kMaxHolds = 3;
+
+    // Polling of the blocking waits, it also moves the emulated time of the host build
+    static constexpr uint32_t kPollUs = 10;
+
+    Transaction *Claim();
+    void Submit(Transaction &transaction, Job *job);
+    bool IsHeld(uint8_t address) const;
+    void Hold(uint8_t address, uint32_t hold_us);
+    void StartNext();
+    void Start(Transaction &transaction);
+    void Complete(bool success);
+
+    i2c_inst_t *i2c_inst_ = nullptr;
+    int tx_dma_channel_ = -1;
+    int rx_dma_channel_ = -1;
+    std::array<Transaction, kMaxTransactions> queue_;
+    std::array<DeviceHold, kMaxHolds> holds_;
+    Transaction *volatile running_ = nullptr;
+    absolute_time_t started_{};
+    uint32_t sequence_ = 0;
+    volatile uint32_t errors_ = 0;
+};
+}
@@ -28,14 +28,19 @@ SOFTWARE.
 
 using namespace kastle2;
 
-bool NAU88C22::Init(i2c_inst_t *i2c_inst)
+bool NAU88C22::Init(I2cBus &bus, const float sample_rate)
 {
-    i2c_inst_ = i2c_inst;
+    bus_ = &bus;
     next_time_finish_special_registers_ = get_absolute_time();
     zero_cross_enabled_ = false;
+    shadow_.fill(0);
+    dirty_.fill(0);
+    known_.fill(0);
 
     // Init itself
     WriteRegister(RESET, 0x000); // Reset all
+    Flush();
+    bus_->WaitIdle(I2C_ADDRESS);
     sleep_ms(100);
 
     uint16_t device_id = ReadRegister(DEVICE_ID);
@@ -59,7 +64,10 @@ bool NAU88C22::Init(i2c_inst_t *i2c_inst)
     WriteRegister(CLOCK_CONTROL_1, 0b0); // External MCLK etc
     WriteRegister(CLOCK_CONTROL_2, 0b000000000);
 
-    WriteRegister(DAC_CONTROL, 0b000001000);        // DAC soft mute is disabled, DAC oversampling rate is 128x
+    // 128x oversampling up to 48 kHz (the rates of the datasheet), 64x at the experimental 96 kHz
+    const uint16_t oversampling = sample_rate > 48000.0f ? 0b000000000 : 0b000001000;
+
+    WriteRegister(DAC_CONTROL, oversampling);       // DAC soft mute is disabled, DAC oversampling rate is 128x (64x at 96 kHz)
     WriteRegister(LEFT_DAC_DIGITAL_VOLUME, 0x0FF);  // DAC left digital volume control, max volume is FF
     WriteRegister(RIGHT_DAC_DIGITAL_VOLUME, 0x1FF); // DAC right digital volume control, max volume is FF
     WriteRegister(DAC_LIMITER_1, 0b000000000);      // Disable DAC limiter
@@ -70,7 +78,7 @@ bool NAU88C22::Init(i2c_inst_t *i2c_inst)
 
     WriteRegister(INPUT_CONTROL, 0b001000100); // Enable line inputs
 
-    WriteRegister(ADC_CONTROL, 0b000001000);             // ADC HP filter is disabled, ADC oversampling rate is 128x
+    WriteRegister(ADC_CONTROL, oversampling);            // ADC HP filter is disabled, ADC oversampling rate is 128x (64x at 96 kHz)
     WriteRegister(LEFT_ADC_BOOST_CONTROL, 0b000000000);  // Direct ADC: Line disconnected, Aux disconnected
     WriteRegister(RIGHT_ADC_BOOST_CONTROL, 0b000000000); //  Direct ADC: Line disconnected, Aux disconnected
                                                          // WriteRegister(LEFT_ADC_BOOST_CONTROL, 0b001010000);  // Line connected at 0db, Aux disconnected
@@ -95,31 +103,107 @@ bool NAU88C22::Init(i2c_inst_t *i2c_inst)
     SetEqPath(EqPath::INPUT);
     SetEqBand(EqBand::BAND_5, EqCutoff::CUTOFF_4, -2, EqWidth::WIDE);
 
+    // Configured before the audio starts
+    while (!Flush())
+    {
+        bus_->WaitIdle(I2C_ADDRESS);
+    }
+    bus_->WaitIdle(I2C_ADDRESS);
+
     return true;
 }
 
 void NAU88C22::WriteRegister(uint8_t addr, uint16_t value)
 {
-    // the value can be 9-bit, so the MSB is part of the register address
-    uint8_t data[2] = {
-        (uint8_t)(addr << 1 | ((value >> 8) & 1)),
-        (uint8_t)(value & 0xFF)};
+    if (addr >= kRegisterCount)
+    {
+        return;
+    }
+
+    value &= kValueMask;
+    const uint32_t word = addr / 32;
+    const uint32_t bit = 1u << (addr % 32);
+    if (addr == RESET)
+    {
+        // All the registers go back to their defaults, the pending writes are pointless
+        dirty_.fill(0);
+        known_.fill(0);
+    }
+    else if ((known_[word] & bit) && shadow_[addr] == value)
+    {
+        return;
+    }
 
-    i2c_write_blocking_until(i2c_inst_, I2C_ADDRESS, data, 2, false, make_timeout_time_ms(20));
+    shadow_[addr] = value;
+    known_[word] |= bit;
+    dirty_[word] |= bit;
 }
 
 uint16_t NAU88C22::ReadRegister(uint8_t addr)
 {
+    const uint32_t word = addr / 32;
+    const uint32_t bit = 1u << (addr % 32);
+    if (addr < kRegisterCount && (known_[word] & bit))
+    {
+        return shadow_[addr];
+    }
+
     uint8_t data[1] = {(uint8_t)(addr << 1)};
-    i2c_write_blocking_until(i2c_inst_, I2C_ADDRESS, data, 1, true, make_timeout_time_ms(20));
     uint8_t received_bytes[2];
-    uint8_t num_bytes_read;
-    num_bytes_read = i2c_read_blocking_until(i2c_inst_, I2C_ADDRESS, received_bytes, 2, false, make_timeout_time_ms(20));
-    if (num_bytes_read != 2)
+    if (!bus_->Read(I2C_ADDRESS, data, 1, received_bytes, 2))
     {
         return INVALID;
     }
-    return (received_bytes[0] << 8) | received_bytes[1];
+
+    const uint16_t value = (received_bytes[0] << 8) | received_bytes[1];
+    if (addr < kRegisterCount)
+    {
+        shadow_[addr] = value & kValueMask;
+        known_[word] |= bit;
+    }
+    return value;
+}
+
+bool NAU88C22::QueueProbe(I2cBus::Job *job)
+{
+    const uint8_t command[1] = {(uint8_t)(DEVICE_ID << 1)};
+    probe_buffer_[0] = 0;
+    probe_buffer_[1] = 0;
+    return bus_ != nullptr && bus_->QueueRead(I2C_ADDRESS, command, 1, probe_buffer_, 2, job);
+}
+
+bool NAU88C22::Flush()
+{
+    for (size_t word = 0; word < dirty_.size(); word++)
+    {
+        while (dirty_[word] != 0)
+        {
+            if (bus_->GetFreeTransactions() == 0)
+            {
+                return false;
+            }
+
+            uint8_t data[kBurstRegisters * 2];
+            size_t count = 0;
+            for (size_t next = word; next < dirty_.size() && count < kBurstRegisters; next++)
+            {
+                while (dirty_[next] != 0 && count < kBurstRegisters)
+                {
+                    const uint8_t addr = next * 32 + __builtin_ctz(dirty_[next]);
+                    dirty_[next] &= dirty_[next] - 1;
+
+                    // the value can be 9-bit, so the MSB is part of the register address
+                    data[count * 2] = (uint8_t)(addr << 1 | ((shadow_[addr] >> 8) & 1));
+                    data[count * 2 + 1] = (uint8_t)(shadow_[addr] & 0xFF);
+                    count++;
+                }
+            }
+
+            // One message per register, sent in the address order
+            bus_->QueueWrite(I2C_ADDRESS, data, count * 2, 2);
+        }
+    }
+    return true;
 }
 
 void NAU88C22::SetEqPath(EqPath path)
@@ -155,6 +239,58 @@ void NAU88C22::SetEqBand(EqBand band, EqCutoff cutoff, int8_t gain, EqWidth widt
     WriteRegister(EQ1 + static_cast<uint8_t>(band), reg);
 }
 
+void NAU88C22::SetInputHighPass(HighPass high_pass)
+{
+    uint16_t reg = ReadRegister(ADC_CONTROL) & 0b000001111;
+    if (high_pass == HighPass::DC_BLOCK)
+    {
+        reg |= 0b100000000; // HPF enabled, audio mode
+    }
+    else if (high_pass != HighPass::OFF)
+    {
+        const uint16_t cutoff = static_cast<uint16_t>(high_pass) - static_cast<uint16_t>(HighPass::CUTOFF_1);
+        reg |= 0b110000000 | (cutoff << 4); // HPF enabled, application mode
+    }
+    WriteRegister(ADC_CONTROL, reg);
+}
+
+void NAU88C22::SetInputAlc(bool enabled, uint8_t target, bool limiter)
+{
+    if (target > MAX_ALC_TARGET)
+    {
+        target = MAX_ALC_TARGET;
+    }
+
+    // Both channels, max gain +35.25 dB, min gain -12 dB
+    WriteRegister(ALC_CONTROL_1, (enabled ? 0b110000000 : 0) | 0b000111000);
+    // No hold time
+    WriteRegister(ALC_CONTROL_2, target);
+    // Default decay and attack
+    WriteRegister(ALC_CONTROL_3, (limiter ? 0b100000000 : 0) | 0b000110010);
+
+    if (!enabled)
+    {
+        // The PGA keeps the last ALC gain, back to the set one
+        special_registers_set_[SpecialRegister::INPUT_GAIN] = true;
+    }
+}
+
+void NAU88C22::SetOutputLimiter(bool enabled, uint8_t threshold, uint8_t boost)
+{
+    if (threshold > MAX_LIMITER_THRESHOLD)
+    {
+        threshold = MAX_LIMITER_THRESHOLD;
+    }
+    if (boost > MAX_LIMITER_BOOST)
+    {
+        boost = MAX_LIMITER_BOOST;
+    }
+
+    // Default decay and attack
+    WriteRegister(DAC_LIMITER_1, (enabled ? 0b100000000 : 0) | 0b000110010);
+    WriteRegister(DAC_LIMITER_2, (threshold << 4) | boost);
+}
+
 void NAU88C22::SetHpVolume(uint8_t volume)
 {
     volume &= MAX_HP_VOLUME;
@@ -188,6 +324,7 @@ void NAU88C22::Update()
 {
     if (absolute_time_diff_us(next_time_finish_special_registers_, get_absolute_time()) < 0)
     {
+        Flush();
         return;
     }
 
@@ -219,6 +356,8 @@ void NAU88C22::Update()
     // Update codec each few ms, not immediatelly
     // Prevents codec sound glitches
     next_time_finish_special_registers_ = make_timeout_time_ms(20);
+
+    Flush();
 }
 
 void NAU88C22::SetZeroCrossUpdate(bool enabled)
@@ -24,8 +24,10 @@ SOFTWARE.
 
 #pragma once
 
+#include <array>
 #include "hardware/i2c.h"
 #include "common/EnumTools.hpp"
+#include "common/peripherals/I2cBus.hpp"
 
 namespace kastle2
 {
@@ -37,6 +39,10 @@ namespace kastle2
  * @note Don't access directly, use Kastle2::codec instead.
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2023-11-28
+ *
+ * The written values are kept in a shadow register file with a dirty bit per register. WriteRegister() only
+ * updates the shadow, Update() sends the dirty registers in one DMA burst over the shared I2C bus,
+ * so a gain change never blocks the UI loop. The reads of the written registers come from the shadow.
  */
 class NAU88C22
 {
@@ -83,6 +89,23 @@ public:
         COUNT
     };
 
+    // ADC high-pass filter
+    // Cutoffs of the application mode depend on the sample rate, see datasheet (ADC control register)
+    enum class HighPass
+    {
+        OFF,
+        DC_BLOCK, // Audio mode, a few Hz
+        CUTOFF_1,
+        CUTOFF_2,
+        CUTOFF_3,
+        CUTOFF_4,
+        CUTOFF_5,
+        CUTOFF_6,
+        CUTOFF_7,
+        CUTOFF_8,
+        COUNT
+    };
+
     enum class SpecialRegister
     {
         HP_VOLUME,
@@ -92,13 +115,15 @@ public:
     };
 
     /**
-     * @brief Initializes the codec.
-     * @param i2c_inst I2C instance
+     * @brief Initializes the codec, all the registers are written before it returns.
+     * @param bus I2C bus shared with the EEPROM
+     * @param sample_rate Sample rate of the I2S, selects the oversampling rate
      */
-    bool Init(i2c_inst_t *i2c_inst);
+    bool Init(I2cBus &bus, float sample_rate);
 
     /**
-     * @brief Writes a value to the codec's register.
+     * @brief Writes a value to the codec's register, sent by the next Update().
+     *        Writing the value the register already has does nothing.
      * @param addr Register address
      * @param value Value to write (usually 9 bits)
      */
@@ -106,11 +131,28 @@ public:
 
     /**
      * @brief Reads a value from the codec's register.
+     *        The registers written since the reset are read from the shadow, the others from the codec (blocking).
      * @param addr Register address
      * @return Value from the register
      */
     uint16_t ReadRegister(uint8_t addr);
 
+    /**
+     * @brief Queues a read of the device ID from the codec, doesn't wait for it.
+     * @param job Followed by the caller, IsProbeValid() is valid once it's done
+     * @return false if the bus queue is full
+     */
+    bool QueueProbe(I2cBus::Job *job);
+
+    /**
+     * @brief Checks the device ID read by QueueProbe().
+     * @return true if it's the NAU88C22
+     */
+    bool IsProbeValid() const
+    {
+        return ((probe_buffer_[0] << 8) | probe_buffer_[1]) == DEVICE_ID_SHOULD_BE;
+    }
+
     /**
      * @brief Sets the HP volume.
      * @param volume Max is 63, 0x3f (+6dB)
@@ -144,9 +186,32 @@ public:
      */
     void SetEqPath(EqPath path);
 
+    /**
+     * @brief Sets the high-pass filter of the ADC, it removes the input DC offset without CPU work.
+     * @param high_pass Off, DC blocking or one of the application mode cutoffs
+     */
+    void SetInputHighPass(HighPass high_pass);
+
+    /**
+     * @brief Sets the automatic level control of the input, it drives the input PGA gain instead of SetInputGain().
+     * @param enabled True to enable, false to return to the gain of SetInputGain()
+     * @param target Target level, 0 is -22.5 dB, each step is +1.5 dB, 15 is -1.5 dB
+     * @param limiter True for the limiter mode (fast attack, only reduces the gain over the target)
+     */
+    void SetInputAlc(bool enabled, uint8_t target, bool limiter);
+
+    /**
+     * @brief Sets the limiter of the DAC, it limits the output peaks without CPU work.
+     * @param enabled True to enable, false to disable
+     * @param threshold 0 is -1 dB, each step is -1 dB, 5 is -6 dB
+     * @param boost Gain under the threshold, 0 to 12 dB
+     */
+    void SetOutputLimiter(bool enabled, uint8_t threshold, uint8_t boost);
+
     /**
      * @brief Finishes writing to the special registers (HP volume, input gain, 3D effect)
-     *        This is used to avoid writing to the codec too often
+     *        This is used to avoid writing to the codec too often.
+     *        Then queues the dirty registers on the I2C bus.
      */
     void Update();
 
@@ -222,17 +287,41 @@ public:
     static constexpr uint8_t MAX_INPUT_GAIN = 0x3F;     // +32.25 dB
     static constexpr uint8_t DEFAULT_3D_EFFECT = 0;     // none
     static constexpr uint8_t MAX_3D_EFFECT = 0xF;       // 100% 3D
+    static constexpr uint8_t MAX_ALC_TARGET = 0xF;      // -1.5 dB
+    static constexpr uint8_t MAX_LIMITER_THRESHOLD = 5; // -6 dB
+    static constexpr uint8_t MAX_LIMITER_BOOST = 12;    // +12 dB
 
     static constexpr uint16_t DEVICE_ID_SHOULD_BE = 0x01A;
 
 private:
-    i2c_inst_t *i2c_inst_;
+    I2cBus *bus_ = nullptr;
+
+    // Device ID read by QueueProbe()
+    uint8_t probe_buffer_[2] = {};
 
     // Invalid recieved value
     static const uint16_t INVALID = 0xFFFF;
 
+    // Registers 0x00 to MISC_CONTROLS, 9 bits each
+    static constexpr uint8_t kRegisterCount = MISC_CONTROLS + 1;
+    static constexpr uint16_t kValueMask = 0x1FF;
+
+    // Register writes of one burst, two bytes each
+    static constexpr size_t kBurstRegisters = I2cBus::kMaxBytes / 2;
+
     void SendSpecialRegister(SpecialRegister reg, uint8_t value);
 
+    /**
+     * @brief Queues the dirty registers, in bursts of kBurstRegisters.
+     * @return True if no register is left dirty
+     */
+    bool Flush();
+
+    // Shadow register file, a known value is the one written (or read) since the reset
+    std::array<uint16_t, kRegisterCount> shadow_;
+    std::array<uint32_t, (kRegisterCount + 31) / 32> dirty_;
+    std::array<uint32_t, (kRegisterCount + 31) / 32> known_;
+
     EnumArray<SpecialRegister, uint8_t> special_registers_values_;
     EnumArray<SpecialRegister, bool> special_registers_set_;
 
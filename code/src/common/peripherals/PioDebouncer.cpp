@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "PioDebouncer.hpp"
+#include "PioDebouncer.pio.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+using namespace kastle2;
+
+static_assert(PioDebouncer::kPinCount == pio_debouncer_PIN_COUNT, "The pin count comes from the PIO program");
+
+void PioDebouncer::Init(PIO pio, uint first_pin, uint32_t lockout_us, uint32_t system_clock_hz)
+{
+    pio_ = pio;
+    lockout_us_ = lockout_us;
+    read_index_ = 0;
+    sm_ = pio_claim_unused_sm(pio, true);
+    const uint offset = pio_add_program(pio, &pio_debouncer_program);
+
+    state_channel_ = dma_claim_unused_channel(true);
+    time_channel_ = dma_claim_unused_channel(true);
+
+    // The timer, right after each state
+    dma_channel_config config = dma_channel_get_default_config(time_channel_);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_ring(&config, true, kEventsBits + 2);
+    channel_config_set_chain_to(&config, state_channel_);
+    channel_config_set_irq_quiet(&config, true);
+    dma_channel_configure(time_channel_, &config, times_.data(), &timer_hw->timerawl, 1, false);
+
+    // The states from the RX FIFO, waits for its DREQ after each chain trigger
+    config = dma_channel_get_default_config(state_channel_);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, false);
+    channel_config_set_write_increment(&config, true);
+    channel_config_set_ring(&config, true, kEventsBits + 2);
+    channel_config_set_dreq(&config, pio_get_dreq(pio, sm_, false));
+    channel_config_set_chain_to(&config, time_channel_);
+    channel_config_set_irq_quiet(&config, true);
+    dma_channel_configure(state_channel_, &config, states_.data(), &pio->rxf[sm_], 1, true);
+
+    pio_debouncer_program_init(pio, sm_, offset, first_pin, CalcClockDivider(system_clock_hz));
+}
+
+void PioDebouncer::SetSystemClock(uint32_t system_clock_hz)
+{
+    if (pio_ != nullptr)
+    {
+        pio_sm_set_clkdiv(pio_, sm_, CalcClockDivider(system_clock_hz));
+    }
+}
+
+bool PioDebouncer::Pop(Event &event)
+{
+    // The timestamp channel writes last, each slot behind its write address is complete
+    const uint32_t written = dma_hw->ch[time_channel_].write_addr - static_cast<uint32_t>(reinterpret_cast<uintptr_t>(times_.data()));
+    const size_t write_index = (written / sizeof(uint32_t)) & (kEvents - 1);
+    if (read_index_ == write_index)
+    {
+        return false;
+    }
+    __dmb();
+    event.pins = states_[read_index_];
+    event.time_us = times_[read_index_];
+    read_index_ = (read_index_ + 1) & (kEvents - 1);
+    return true;
+}
+
+float PioDebouncer::CalcClockDivider(uint32_t system_clock_hz) const
+{
+    return static_cast<float>(system_clock_hz) * static_cast<float>(lockout_us_) / (1000000.f * pio_debouncer_LOCKOUT_CYCLES);
+}
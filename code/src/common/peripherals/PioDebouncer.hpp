@@ -0,0 +1,113 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "pico/types.h"
+#include "hardware/pio.h"
+
+namespace kastle2
+{
+
+/**
+ * @class PioDebouncer
+ * @ingroup peripherals
+ * @brief Debounces consecutive input pins on a PIO state machine, the DMA timestamps each change.
+ * @note Don't access directly, use Kastle2::hw instead.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ *
+ * The state machine samples the pins and pushes their state when it changes, then ignores them for the lockout
+ * time (the bouncing), see PioDebouncer.pio. The first edge of a press goes out right away, so its time is exact,
+ * and the state after the lockout is pushed again if it settled differently.
+ *
+ * One DMA channel moves each state from the RX FIFO to a ring and chains to a second one copying the timer
+ * (time_us_32()) to a parallel ring, which chains back to the first. Nothing runs on the CPU until Pop()
+ * reads the events, so it can be called as often as needed.
+ */
+class PioDebouncer
+{
+public:
+    /**
+     * @brief Number of the pins, fixed by the PIO program.
+     */
+    static constexpr size_t kPinCount = 2;
+
+    /**
+     * @brief One change of the pins.
+     */
+    struct Event
+    {
+        uint32_t pins;    ///< Levels of the pins, bit 0 is the first pin
+        uint32_t time_us; ///< time_us_32() time of the change (one sample period late at most)
+    };
+
+    /**
+     * @brief Starts the state machine and the DMA.
+     * @param pio PIO instance, the state machine is claimed from it.
+     * @param first_pin First of the kPinCount consecutive pins, already set up as inputs.
+     * @param lockout_us Time the pins are ignored for after a change.
+     * @param system_clock_hz Current system clock.
+     */
+    void Init(PIO pio, uint first_pin, uint32_t lockout_us, uint32_t system_clock_hz);
+
+    /**
+     * @brief Keeps the lockout time after the system clock change.
+     * @param system_clock_hz New system clock.
+     */
+    void SetSystemClock(uint32_t system_clock_hz);
+
+    /**
+     * @brief Reads the oldest change not read yet.
+     * @param event Filled with the change.
+     * @return False when there is no new change.
+     */
+    bool Pop(Event &event);
+
+private:
+    /**
+     * @brief State machine clock divider giving the lockout time.
+     */
+    float CalcClockDivider(uint32_t system_clock_hz) const;
+
+    // The rings wrap the DMA write address, so they are aligned to their size
+    static constexpr size_t kEventsBits = 5;
+    static constexpr size_t kEvents = 1 << kEventsBits;
+    static constexpr size_t kRingBytes = kEvents * sizeof(uint32_t);
+
+    alignas(kRingBytes) std::array<uint32_t, kEvents> states_{};
+    alignas(kRingBytes) std::array<uint32_t, kEvents> times_{};
+
+    PIO pio_ = nullptr;
+    uint sm_ = 0;
+    uint state_channel_ = 0;
+    uint time_channel_ = 0;
+    uint32_t lockout_us_ = 0;
+    size_t read_index_ = 0;
+};
+
+}
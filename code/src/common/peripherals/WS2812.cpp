@@ -33,6 +33,9 @@ SOFTWARE.
 
 #include "WS2812.hpp"
 #include "WS2812.pio.h"
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
 
 using namespace kastle2;
 
@@ -66,12 +69,28 @@ void WS2812::Initialize(size_t pin, size_t length, PIO pio, size_t sm, DataByte
     pio_ = pio;
     sm_ = sm;
     data_ = std::make_unique<uint32_t[]>(length);
+    frame_ = std::make_unique<uint32_t[]>(length);
     bytes_[0] = b1;
     bytes_[1] = b2;
     bytes_[2] = b3;
     size_t offset = pio_add_program(pio, &ws2812_program);
     size_t bits = 24;
-    ws2812_program_init(pio, sm, offset, pin, 800000, bits);
+    ws2812_program_init(pio, sm, offset, pin, kBitRate, bits);
+
+    // The frame goes to the state machine TX FIFO by DMA, paced by its DREQ
+    dma_channel_ = dma_claim_unused_channel(true);
+    dma_channel_config config = dma_channel_get_default_config(dma_channel_);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma_channel_, &config, &pio->txf[sm], frame_.get(), length, false);
+}
+
+void WS2812::SetSystemClock(uint32_t system_clock_hz)
+{
+    constexpr float cycles_per_bit = ws2812_T1 + ws2812_T2 + ws2812_T3;
+    pio_sm_set_clkdiv(pio_, sm_, static_cast<float>(system_clock_hz) / (kBitRate * cycles_per_bit));
 }
 
 uint32_t WS2812::ConvertData(uint32_t rgb)
@@ -105,6 +124,7 @@ void WS2812::SetPixelColor(size_t index, uint32_t color)
     if (index < length_)
     {
         data_[index] = ConvertData(color);
+        MarkDirty();
     }
 }
 
@@ -135,14 +155,66 @@ void WS2812::Fill(uint32_t color, size_t first, size_t count)
     {
         data_[i] = color;
     }
+    MarkDirty();
+}
+
+void WS2812::BeginFrame()
+{
+    sequence_ = sequence_ + 1;
+    // Update() must see the odd sequence before any pixel of the batch
+    __dmb();
+}
+
+void WS2812::EndFrame()
+{
+    __dmb();
+    sequence_ = sequence_ + 1;
+    MarkDirty();
 }
 
 void WS2812::Show()
 {
+    MarkDirty();
+    bool started = false;
+    while (!started)
+    {
+        // The interrupt sending the frames can't start one in between the checks and the transfer
+        const uint32_t interrupts = save_and_disable_interrupts();
+        started = Update();
+        restore_interrupts(interrupts);
+        tight_loop_contents();
+    }
+}
+
+bool WS2812::Update()
+{
+    const uint32_t sequence = sequence_;
+    if (!dirty_ || (sequence & 1) != 0 || dma_channel_is_busy(dma_channel_))
+    {
+        return false;
+    }
+    // Cleared before copying, a pixel written during the copy marks the frame dirty again
+    dirty_ = false;
+    __dmb();
     for (size_t i = 0; i < length_; i++)
     {
-        pio_sm_put_blocking(pio_, sm_, data_[i]);
+        frame_[i] = data_[i];
     }
+    __dmb();
+    if (sequence_ != sequence)
+    {
+        // A batch started meanwhile (from the other core), the next Update() sends it whole
+        dirty_ = true;
+        return false;
+    }
+    dma_channel_transfer_from_buffer_now(dma_channel_, frame_.get(), length_);
+    return true;
+}
+
+void WS2812::MarkDirty()
+{
+    __dmb();
+    dirty_ = true;
 }
 
 uint32_t WS2812::ApplyBrightness(uint32_t color, uint8_t brightness)
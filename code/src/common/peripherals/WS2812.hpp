@@ -181,11 +181,47 @@ public:
      */
     void Fill(uint32_t color, size_t first, size_t count);
 
+    /**
+     * @brief Starts a batch of pixel writes, Update() doesn't send a frame until EndFrame().
+     * @note For the writes outside of the interrupt which calls Update(), so it never sends half of them.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Ends the batch of pixel writes, the next Update() sends all of them in one frame.
+     */
+    void EndFrame();
+
     /**
      * @brief Sends the data to the LEDs. You need to call this after setting the pixel colors.
+     * @note Waits for the previous frame to be sent, the frame itself is sent by DMA and Show() doesn't wait for it.
      */
     void Show();
 
+    /**
+     * @brief Starts sending the frame by DMA if a pixel changed since the last frame and the previous transfer is done.
+     * @note Doesn't block, so it can be called from an interrupt. The caller keeps the frames apart
+     *       by at least the WS2812 reset time, the DMA doesn't know when the PIO shifted the last pixel out.
+     *       A batch between BeginFrame() and EndFrame() is sent only whole.
+     * @return True if a new frame was started.
+     */
+    bool Update();
+
+    /**
+     * @brief Keeps the LED bit rate on another system clock (after a system clock change).
+     * @param system_clock_hz The new system clock.
+     */
+    void SetSystemClock(uint32_t system_clock_hz);
+
+    /**
+     * @brief Whether a pixel changed since the last frame was started.
+     * @return True if the next Update() has something to send.
+     */
+    bool IsDirty() const
+    {
+        return dirty_;
+    }
+
     /**
      * @brief Applies the brightness to the color.
      * @param color Color (eg. 0xFF00FF) to apply the brightness to.
@@ -257,12 +293,23 @@ public:
     static constexpr uint32_t COLD_WHITE = 0x4f6f7f;
 
 private:
+    static constexpr float kBitRate = 800000.0f; ///< WS2812 data rate
+
     size_t pin_;
     size_t length_;
     PIO pio_;
     size_t sm_;
     DataByte bytes_[4];
-    std::unique_ptr<uint32_t[]> data_;
+    std::unique_ptr<uint32_t[]> data_;  // Written by SetPixelColor() and Fill()
+    std::unique_ptr<uint32_t[]> frame_; // Copy of data_ read by the DMA, so the colors can change while sending
+    int dma_channel_ = -1;
+    volatile bool dirty_ = false;
+    volatile uint32_t sequence_ = 0; // Odd while a batch is written, changes with every batch
+
+    /**
+     * @brief Marks the frame as changed, after the pixel data is written.
+     */
+    void MarkDirty();
 
     void Initialize(size_t pin, size_t length, PIO pio, size_t sm, DataByte b1, DataByte b2, DataByte b3);
     uint32_t ConvertData(uint32_t rgb);
@@ -0,0 +1,189 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "LatencyMeter.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include "common/core/Kastle2.hpp"
+
+using namespace kastle2;
+
+namespace
+{
+constexpr const char *kChannelNames[2] = {"L", "R"};
+
+/**
+ * @brief Formats frames with two decimals, without the float printf.
+ */
+void FormatFrames(char *buff, size_t size, float frames)
+{
+    const long hundredths = lroundf(frames * 100.0f);
+    snprintf(buff, size, "%ld.%02ld", hundredths / 100, labs(hundredths % 100));
+}
+}
+
+COLDCODE void LatencyMeter::Init(float sample_rate)
+{
+    sample_rate_ = sample_rate;
+    Start();
+}
+
+COLDCODE void LatencyMeter::Start()
+{
+    listening_ = false;
+    result_ready_ = false;
+    frames_ = 0;
+    // The first impulse right away
+    impulse_frame_ = 0 - kPeriodFrames;
+    measured_ = 0;
+    for (size_t channel = 0; channel < 2; channel++)
+    {
+        sum_[channel] = 0.0f;
+        found_[channel] = 0;
+    }
+}
+
+FASTCODE void LatencyMeter::Process(const q15_t *input, q15_t *output, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        const uint32_t frame = frames_ + static_cast<uint32_t>(i);
+        if (frame - impulse_frame_ >= kPeriodFrames && !IsDone())
+        {
+            output[2 * i] = kImpulseLevel;
+            output[2 * i + 1] = kImpulseLevel;
+            impulse_frame_ = frame;
+            listening_ = true;
+            peaks_[0] = {};
+            peaks_[1] = {};
+        }
+
+        const uint32_t since = frame - impulse_frame_;
+        if (listening_ && since >= kWindowFrames)
+        {
+            // The previous window waits for the UI loop, this one is dropped
+            if (!result_ready_)
+            {
+                results_[0] = peaks_[0];
+                results_[1] = peaks_[1];
+                result_ready_ = true;
+            }
+            listening_ = false;
+        }
+
+        for (size_t channel = 0; channel < 2; channel++)
+        {
+            const q15_t sample = input[2 * i + channel];
+            if (listening_)
+            {
+                Peak &peak = peaks_[channel];
+                if (!peak.next_found)
+                {
+                    peak.next = sample;
+                    peak.next_found = true;
+                }
+                if (abs(sample) > abs(peak.value))
+                {
+                    peak = {since, previous_[channel], sample, sample, false};
+                }
+            }
+            previous_[channel] = sample;
+        }
+    }
+    frames_ += static_cast<uint32_t>(size);
+}
+
+COLDCODE float LatencyMeter::Interpolate(const Peak &peak)
+{
+    // Parabola through the peak and its neighbours, the peak turned positive
+    const float sign = peak.value < 0 ? -1.0f : 1.0f;
+    const float a = sign * static_cast<float>(peak.previous);
+    const float b = sign * static_cast<float>(peak.value);
+    const float c = sign * static_cast<float>(peak.next);
+    const float denominator = a - 2.0f * b + c;
+    float delta = denominator != 0.0f ? 0.5f * (a - c) / denominator : 0.0f;
+    delta = delta > 0.5f ? 0.5f : (delta < -0.5f ? -0.5f : delta);
+    return static_cast<float>(peak.frame) + delta;
+}
+
+COLDCODE void LatencyMeter::Update()
+{
+    if (!result_ready_ || IsDone())
+    {
+        return;
+    }
+    const Peak results[2] = {results_[0], results_[1]};
+    result_ready_ = false;
+    measured_++;
+
+    char buff[128];
+    char frames[24];
+    for (size_t channel = 0; channel < 2; channel++)
+    {
+        if (abs(results[channel].value) < kDetectLevel)
+        {
+            snprintf(buff, sizeof(buff), "LATENCY %s: no impulse", kChannelNames[channel]);
+            Kastle2::debug.PrintLine(buff);
+            continue;
+        }
+        const float latency = Interpolate(results[channel]);
+        if (found_[channel] == 0 || latency < min_[channel])
+        {
+            min_[channel] = latency;
+        }
+        if (found_[channel] == 0 || latency > max_[channel])
+        {
+            max_[channel] = latency;
+        }
+        sum_[channel] += latency;
+        found_[channel]++;
+
+        FormatFrames(frames, sizeof(frames), latency);
+        snprintf(buff, sizeof(buff), "LATENCY %s: %s frames, %ld us", kChannelNames[channel], frames,
+                 lroundf(latency * 1e6f / sample_rate_));
+        Kastle2::debug.PrintLine(buff);
+    }
+
+    if (IsDone())
+    {
+        for (size_t channel = 0; channel < 2; channel++)
+        {
+            if (found_[channel] == 0)
+            {
+                snprintf(buff, sizeof(buff), "LATENCY %s: FAIL, check Audio OUT -> Audio IN", kChannelNames[channel]);
+                Kastle2::debug.PrintLine(buff);
+                continue;
+            }
+            char min[24];
+            char max[24];
+            FormatFrames(min, sizeof(min), min_[channel]);
+            FormatFrames(frames, sizeof(frames), sum_[channel] / static_cast<float>(found_[channel]));
+            FormatFrames(max, sizeof(max), max_[channel]);
+            snprintf(buff, sizeof(buff), "LATENCY %s: min %s avg %s max %s frames (%u/%u)", kChannelNames[channel], min,
+                     frames, max, static_cast<unsigned>(found_[channel]), static_cast<unsigned>(kMeasurements));
+            Kastle2::debug.PrintLine(buff);
+        }
+    }
+    Kastle2::debug.Flush();
+}
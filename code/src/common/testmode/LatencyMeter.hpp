@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "common/dsp/math/qmath.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class LatencyMeter
+ * @ingroup testmode
+ * @brief Measures the round trip latency of the audio, Audio OUT jack -> Audio IN jack.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ * @details Each kPeriodFrames an impulse goes to both outputs and the inputs look for its peak
+ * within kWindowFrames. The frames are counted by the audio callback, so the latency includes the blocks
+ * buffered by the I2S driver and the pipelining of the callback as well as the codec filters.
+ * The peak is refined with a parabola through its neighbours to a fraction of a frame.
+ *
+ * Process() runs in the audio callback, Update() in the UI loop prints each measurement
+ * and a summary after kMeasurements via USB Serial.
+ */
+class LatencyMeter
+{
+public:
+    static constexpr size_t kMeasurements = 8;        ///< Measurements before the summary
+    static constexpr uint32_t kPeriodFrames = 16384;  ///< Frames between the impulses
+    static constexpr uint32_t kWindowFrames = 4096;   ///< Frames after an impulse searched for its peak
+    static constexpr q15_t kImpulseLevel = q15(0.25f); ///< Impulse on the output
+    static constexpr q15_t kDetectLevel = q15(0.02f);  ///< Smallest peak taken for the impulse
+
+    /**
+     * @brief Initializes the meter.
+     * @param sample_rate The sample rate of the system
+     */
+    void Init(float sample_rate);
+
+    /**
+     * @brief Starts the measurements over, the first impulse goes out on the next block.
+     */
+    void Start();
+
+    /**
+     * @brief Emits the impulses and tracks their peaks, called by the audio callback.
+     * @param input The input buffer
+     * @param output The output buffer, the impulse is written over it
+     * @param size The size of the buffer in left and right pairs
+     */
+    void Process(const q15_t *input, q15_t *output, size_t size);
+
+    /**
+     * @brief Prints the finished measurements, called by the UI loop.
+     */
+    void Update();
+
+    /**
+     * @brief Whether the summary of kMeasurements was printed.
+     */
+    bool IsDone() const
+    {
+        return measured_ >= kMeasurements;
+    }
+
+private:
+    /**
+     * @brief Peak of one channel, the samples around it for the interpolation.
+     */
+    struct Peak
+    {
+        uint32_t frame;  ///< Frames after the impulse
+        q15_t previous;  ///< Sample before the peak
+        q15_t value;     ///< The peak sample
+        q15_t next;      ///< Sample after the peak
+        bool next_found; ///< The sample after the peak was seen
+    };
+
+    float sample_rate_ = 0.0f;
+
+    uint32_t frames_ = 0;               ///< Frames counted by Process()
+    uint32_t impulse_frame_ = 0;        ///< Frame of the last impulse
+    bool listening_ = false;            ///< Searching the window of the last impulse
+    q15_t previous_[2] = {0, 0};        ///< Last input sample of each channel
+    Peak peaks_[2] = {};                ///< Peaks of the current window
+    Peak results_[2] = {};              ///< Peaks of the last finished window
+    volatile bool result_ready_ = false; ///< results_ written by Process(), read by Update()
+
+    size_t measured_ = 0;        ///< Measurements printed
+    float sum_[2] = {0.0f, 0.0f}; ///< Sums of the latencies for the summary
+    float min_[2] = {0.0f, 0.0f};
+    float max_[2] = {0.0f, 0.0f};
+    size_t found_[2] = {0, 0}; ///< Measurements where the impulse was found
+
+    /**
+     * @brief Latency of a peak in frames, with the parabolic interpolation.
+     */
+    static float Interpolate(const Peak &peak);
+};
+
+}
@@ -30,6 +30,7 @@ using namespace kastle2;
 
 TestEntry::TestEntry(const Config &config) : config_(config)
 {
+    budget_ms_ = config_.budget_ms != 0 ? config_.budget_ms : DefaultBudgetMs(config_.type);
     if (config_.type == Type::FFT)
     {
         // Set up the fft
@@ -40,9 +41,92 @@ TestEntry::TestEntry(const Config &config) : config_(config)
     }
 }
 
+COLDCODE uint32_t TestEntry::DefaultBudgetMs(Type type)
+{
+    switch (type)
+    {
+    case Type::DIGITAL_COMBO:
+    case Type::DIGITAL_OUT_ANALOG_IN:
+        return 200;
+    case Type::ANALOG_COMBO:
+        return 500;
+    case Type::EEPROM:
+    case Type::CODEC:
+        return 250;
+    case Type::FFT:
+    case Type::MIDI_IN:
+        return 3000;
+    case Type::DIGITAL_IN:
+        return 5000;
+    default:
+        // The manual tests wait for the user
+        return 0;
+    }
+}
+
+void TestEntry::Reset()
+{
+    passed_ = false;
+    failed_ = false;
+    running_ = false;
+}
+
+void TestEntry::Start(uint32_t now_us)
+{
+    Reset();
+    running_ = true;
+    started_us_ = now_us;
+    low_reached_ = false;
+    high_reached_ = false;
+    fft_hold_count_ = 0;
+    step_result_ = true;
+    Step(0);
+}
+
+void TestEntry::CheckBudget(uint32_t now_us)
+{
+    if (IsFinished() || budget_ms_ == 0)
+    {
+        return;
+    }
+    if (now_us - started_us_ > budget_ms_ * 1000)
+    {
+        failed_ = true;
+        running_ = false;
+        finished_us_ = now_us;
+    }
+}
+
+uint32_t TestEntry::GetDurationMs(uint32_t now_us) const
+{
+    if (!running_ && !IsFinished())
+    {
+        return 0; // Not started yet
+    }
+    return ((IsFinished() ? finished_us_ : now_us) - started_us_) / 1000;
+}
+
+void TestEntry::Pass()
+{
+    passed_ = true;
+    running_ = false;
+    finished_us_ = time_us_32();
+}
+
+void TestEntry::Step(size_t step)
+{
+    step_ = step;
+    step_us_ = time_us_32();
+}
+
+bool TestEntry::IsSettled(uint32_t settle_us) const
+{
+    return time_us_32() - step_us_ >= settle_us;
+}
+
 void TestEntry::Run()
 {
-    if (passed_ || IsSkipped())
+    if (!running_ || IsSkipped())
     {
         return;
     }
@@ -73,6 +157,10 @@ void TestEntry::Run()
     case Type::MIDI_IN:
         RunMidiIn();
         break;
+    case Type::EEPROM:
+    case Type::CODEC:
+        RunI2c();
+        break;
     default:
         // Handle unknown type
         break;
@@ -89,11 +177,48 @@ bool TestEntry::HasPassed() const
     return passed_;
 }
 
+bool TestEntry::HasFailed() const
+{
+    return failed_;
+}
+
+TestEntry::Lane TestEntry::GetLane() const
+{
+    switch (config_.type)
+    {
+    case Type::DIGITAL_COMBO:
+    case Type::ANALOG_COMBO:
+    case Type::DIGITAL_OUT_ANALOG_IN:
+        return Lane::CORE_0;
+    case Type::FFT:
+        return Lane::CORE_1;
+    case Type::EEPROM:
+    case Type::CODEC:
+        return Lane::I2C;
+    default:
+        return Lane::EVENT;
+    }
+}
+
+size_t TestEntry::GetOutput() const
+{
+    switch (config_.type)
+    {
+    case Type::DIGITAL_COMBO:
+    case Type::DIGITAL_OUT_ANALOG_IN:
+        return static_cast<size_t>(config_.digital_output);
+    case Type::ANALOG_COMBO:
+        return static_cast<size_t>(Hardware::DigitalOutput::COUNT) + static_cast<size_t>(config_.analog_output);
+    default:
+        return kNoOutput;
+    }
+}
+
 void TestEntry::RunButton()
 {
     if (Kastle2::hw.JustPressed(config_.button))
     {
-        passed_ = true;
+        Pass();
     }
 }
 
@@ -114,7 +239,7 @@ void TestEntry::RunPot()
     }
     if (low_reached_ && high_reached_)
     {
-        passed_ = true;
+        Pass();
     }
 }
 
@@ -123,66 +248,104 @@ void TestEntry::RunDigitalInput()
     bool state = Kastle2::hw.GetDigitalIn(config_.digital_input);
     if (state != prev_state_)
     {
-        passed_ = true;
+        Pass();
     }
     prev_state_ = state;
 }
 
 void TestEntry::RunDigitalCombo()
 {
-    // test low & high
-    for (size_t i = 0; i < 2; i++)
-    {
-        bool val = i;
-        Kastle2::hw.SetDigitalOut(config_.digital_output, val);
-        sleep_ms(5);
-        bool result = Kastle2::hw.GetDigitalIn(config_.digital_input);
-        if (result != val)
-        {
-            return;
-        }
+    // Steps 0 and 1 set low and high, 2 and 3 read them back
+    if (step_ < 2)
+    {
+        Kastle2::hw.SetDigitalOut(config_.digital_output, step_ == 1);
+        Step(step_ + 2);
+        return;
     }
-    passed_ = true;
+    if (!IsSettled(kDigitalSettleUs))
+    {
+        return;
+    }
+    const bool val = step_ == 3;
+    if (Kastle2::hw.GetDigitalIn(config_.digital_input) != val)
+    {
+        // Again until the budget is over
+        Step(0);
+        return;
+    }
+    if (val)
+    {
+        Pass();
+        return;
+    }
+    Step(1);
 }
 
 void TestEntry::RunAnalogCombo()
 {
-    bool result = true;
-    for (size_t i = 0; i < kAnalogTestsCount; i++)
+    // Even steps set the value, odd ones read it back
+    const size_t i = step_ / 2;
+    if ((step_ & 1) == 0)
     {
         Kastle2::hw.SetAnalogOut(config_.analog_output, kAnalogTestValues[i]);
+        Step(step_ + 1);
+        return;
+    }
+    if (!IsSettled(kAnalogSettleUs))
+    {
+        return;
+    }
 
-        // Need to call it multiple times to get the correct value (2 normal ADCs, 2*8 ADCs multiplexed) etc.
-        UpdateAllAdcs();
+    volatile int32_t reading = Kastle2::hw.GetAnalogValue(config_.analog_input);
+    volatile int32_t should_match = kAnalogTestResults[i];
+    if (diff(reading, should_match) > kAnalogTestsTolerance)
+    {
+        step_result_ = false;
+    }
+    if (i + 1 < kAnalogTestsCount)
+    {
+        Step(step_ + 1);
+        return;
+    }
 
-        volatile int32_t reading = Kastle2::hw.GetAnalogValue(config_.analog_input);
-        volatile int32_t should_match = kAnalogTestResults[i];
-        if (diff(reading, should_match) > kAnalogTestsTolerance)
-        {
-            result = false;
-        }
+    // The whole sweep has to match
+    if (step_result_)
+    {
+        Pass();
+        return;
     }
-    passed_ = result;
+    step_result_ = true;
+    Step(0);
 }
 
 void TestEntry::RunDigitalOutputAnalogInput()
 {
-    Kastle2::hw.SetDigitalOut(config_.digital_output, true);
-    UpdateAllAdcs();
+    // Step 0 sets high, 1 reads it and sets low, 2 reads it
+    if (step_ == 0)
+    {
+        Kastle2::hw.SetDigitalOut(config_.digital_output, true);
+        Step(1);
+        return;
+    }
+    if (!IsSettled(kAnalogSettleUs))
+    {
+        return;
+    }
     volatile int32_t reading = Kastle2::hw.GetAnalogValue(config_.analog_input);
-    bool result = true;
-    if (reading < kHigh)
+    if (step_ == 1)
     {
-        result = false;
+        step_result_ = reading >= kHigh;
+        Kastle2::hw.SetDigitalOut(config_.digital_output, false);
+        Step(2);
+        return;
     }
-    Kastle2::hw.SetDigitalOut(config_.digital_output, false);
-    UpdateAllAdcs();
-    reading = Kastle2::hw.GetAnalogValue(config_.analog_input);
-    if (reading > kLow)
+    if (step_result_ && reading <= kLow)
     {
-        result = false;
+        Pass();
+        return;
     }
-    passed_ = result;
+    step_result_ = true;
+    Step(0);
 }
 
 void TestEntry::RunFft()
@@ -194,7 +357,7 @@ void TestEntry::RunFft()
         fft_hold_count_++;
         if (fft_hold_count_ > kFftHoldCount && env_follower_.GetEnvelope() > config_.match_volume)
         {
-            passed_ = true;
+            Pass();
         }
     }
     else
@@ -209,19 +372,38 @@ void TestEntry::RunMidiIn()
     // If we received the expected MIDI message, mark the test as passed
     if (!passed_ && midi_message_received_)
     {
-        passed_ = true;
+        Pass();
         // Reset the flag for the next test (not necessary but I'm leaving it here...)
         midi_message_received_ = false;
     }
 }
 
-void TestEntry::UpdateAllAdcs()
+void TestEntry::RunI2c()
 {
-    // Allow some time for ADC to take readings
-    sleep_ms(10);
+    // Step 0 queues the read, 1 waits for it
+    if (i2c_job_.IsPending())
+    {
+        return;
+    }
+    if (step_ == 0)
+    {
+        const bool queued = config_.type == Type::EEPROM ? Kastle2::memory.QueueProbe(&i2c_job_) : Kastle2::codec.QueueProbe(&i2c_job_);
+        if (queued)
+        {
+            Step(1);
+        }
+        return; // Or the bus queue is full, next time
+    }
+    const bool valid = config_.type == Type::EEPROM ? Kastle2::memory.IsProbeValid() : Kastle2::codec.IsProbeValid();
+    if (i2c_job_.status == I2cBus::Status::DONE && valid)
+    {
+        Pass();
+        return;
+    }
+    Step(0);
 }
 
-const char *TestEntry::GetName() const
+COLDCODE const char *TestEntry::GetName() const
 {
     return config_.name;
 }
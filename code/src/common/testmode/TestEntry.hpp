@@ -30,6 +30,7 @@ SOFTWARE.
 #include "common/core/midi/Message.hpp"
 #include "common/dsp/control/EnvelopeFollower.hpp"
 #include "common/dsp/math/Fft.hpp"
+#include "common/peripherals/I2cBus.hpp"
 
 namespace kastle2
 {
@@ -38,7 +39,10 @@ namespace kastle2
  * @class TestEntry
  * @ingroup testmode
  * @brief Single test entry to be used in Test Mode.
- * @details Can test buttons, pots, digital inputs, digital outputs, analog inputs, analog outputs and FFT.
+ * @details Can test buttons, pots, digital inputs, digital outputs, analog inputs, analog outputs, FFT
+ *          and the I2C devices (EEPROM, codec).
+ *          Run() never waits, the settling of an output or an I2C transfer spreads over the next calls,
+ *          so the TestScheduler can run many entries at once. Each attempt has a time budget, see Start().
  * @author Vaclav Mach (Bastl Instruments)
  * @date 2024-07-23
  */
@@ -58,6 +62,19 @@ public:
         DIGITAL_OUT_ANALOG_IN, ///< Digital output is connected to analog input (tests LOW, HIGH)
         FFT,                   ///< Audio output is connected to audio input (tests FFT frequency and amplitude)
         MIDI_IN,               ///< Test MIDI message recognition
+        EEPROM,                ///< The EEPROM holds the init message (queued I2C read)
+        CODEC,                 ///< The codec returns its device ID (queued I2C read)
+    };
+
+    /**
+     * @brief Where the TestScheduler runs the entry.
+     */
+    enum class Lane
+    {
+        EVENT,  ///< Waits for something to happen (buttons, pots, jacks, MIDI), polled on core 0
+        CORE_0, ///< Drives an output and reads an input back, one entry per output at a time
+        CORE_1, ///< Computes on the second core (FFT)
+        I2C,    ///< Waits for a queued I2C transfer
     };
 
     /**
@@ -89,6 +106,7 @@ public:
         q15_t match_volume = 0;                      ///< For FFT tests
         float match_frequency = 0.0f;                ///< For FFT tests
         midi::Message::Type midi_message_type = {};  ///< For MIDI_IN tests
+        uint32_t budget_ms = 0;                      ///< Time budget of one attempt, 0 for the default of the type
 
         // Named parameter constructors for type-safe construction
         static Config Button(const char *name, Hardware::Version ver, Hardware::Button btn)
@@ -167,6 +185,22 @@ public:
                 .version = ver,
                 .midi_message_type = msg_type};
         }
+
+        static Config Eeprom(const char *name, Hardware::Version ver)
+        {
+            return Config{
+                .name = name,
+                .type = Type::EEPROM,
+                .version = ver};
+        }
+
+        static Config Codec(const char *name, Hardware::Version ver)
+        {
+            return Config{
+                .name = name,
+                .type = Type::CODEC,
+                .version = ver};
+        }
     };
 
     /**
@@ -176,10 +210,36 @@ public:
     explicit TestEntry(const Config &config);
 
     /**
-     * @brief Runs the test.
+     * @brief Starts a new attempt, the time budget starts now.
+     * @param now_us Current time_us_32()
+     */
+    void Start(uint32_t now_us);
+
+    /**
+     * @brief Clears the result, the entry waits for the next Start().
+     */
+    void Reset();
+
+    /**
+     * @brief Returns if an attempt is started and not finished yet.
+     */
+    bool IsRunning() const
+    {
+        return running_;
+    }
+
+    /**
+     * @brief Runs one step of the test, returns right away.
+     * @details The CORE_1 entries are run by the second core, the rest by the UI loop.
      */
     void Run();
 
+    /**
+     * @brief Fails the attempt if it's over its time budget.
+     * @param now_us Current time_us_32()
+     */
+    void CheckBudget(uint32_t now_us);
+
     /**
      * @brief Stores the audio samples so the Run can check them (only in FFT mode)
      */
@@ -191,6 +251,27 @@ public:
      */
     bool HasPassed() const;
 
+    /**
+     * @brief Returns if the attempt ran out of its time budget.
+     * @return true if the test has failed
+     */
+    bool HasFailed() const;
+
+    /**
+     * @brief Returns if the attempt has passed or failed.
+     */
+    bool IsFinished() const
+    {
+        return passed_ || failed_;
+    }
+
+    /**
+     * @brief Returns how long the attempt took, or has been running.
+     * @param now_us Current time_us_32()
+     * @return Time in milliseconds
+     */
+    uint32_t GetDurationMs(uint32_t now_us) const;
+
     /**
      * @brief User interaction needed for passing this test
      * @return true if manual interaction is needed
@@ -215,6 +296,29 @@ public:
      */
     bool IsSkipped() const;
 
+    /**
+     * @brief Returns where the entry runs.
+     */
+    Lane GetLane() const;
+
+    /**
+     * @brief Returns the output the entry drives, for the CORE_0 entries.
+     * @return Digital outputs first, then the analog ones, kNoOutput for the others
+     */
+    size_t GetOutput() const;
+
+    ///> Number of the outputs GetOutput() returns
+    static constexpr size_t kOutputCount = static_cast<size_t>(Hardware::DigitalOutput::COUNT) + static_cast<size_t>(Hardware::AnalogOutput::COUNT);
+
+    ///> GetOutput() of the entries which don't drive an output
+    static constexpr size_t kNoOutput = kOutputCount;
+
+    ///> Digital output settle time
+    static constexpr uint32_t kDigitalSettleUs = 5000;
+
+    ///> Allow some time for ADC to take readings (2 normal ADCs, 2*8 ADCs multiplexed)
+    static constexpr uint32_t kAnalogSettleUs = 10000;
+
     ///> ADC low threshold
     static constexpr int32_t kLow = 400;
 
@@ -245,6 +349,16 @@ public:
 private:
     Config config_;
     bool passed_ = false;
+    bool failed_ = false;
+    bool running_ = false;
+
+    ///> Time budget of one attempt, 0 for none (the manual tests)
+    uint32_t budget_ms_ = 0;
+    uint32_t started_us_ = 0;
+    uint32_t finished_us_ = 0;
+
+    ///> Default time budget of one attempt of the type
+    static uint32_t DefaultBudgetMs(Type type);
 
     void RunButton();
     void RunPot();
@@ -254,8 +368,23 @@ private:
     void RunDigitalOutputAnalogInput();
     void RunFft();
     void RunMidiIn();
+    void RunI2c();
+
+    void Pass();
 
-    void UpdateAllAdcs();
+    /**
+     * @brief Waits for the output to settle without blocking.
+     * @return true once the time since the last step is over
+     */
+    bool IsSettled(uint32_t settle_us) const;
+
+    ///> Moves to the step, the settling starts now
+    void Step(size_t step);
+
+    ///> Step of the output/input sequences and the I2C transfer
+    size_t step_ = 0;
+    uint32_t step_us_ = 0;
+    bool step_result_ = true;
 
     bool prev_state_ = false;
 
@@ -270,5 +399,8 @@ private:
     // MIDI message stuff
     midi::Message::Type midi_message_type_;
     bool midi_message_received_ = false;
+
+    // I2C transfer of the EEPROM and codec tests
+    I2cBus::Job i2c_job_;
 };
 }
@@ -28,7 +28,12 @@ SOFTWARE.
 
 using namespace kastle2;
 
-void TestMode::Init(float sample_rate)
+#ifndef KASTLE2_HOST
+// End of the firmware image, from the linker script
+extern char __flash_binary_end;
+#endif
+
+COLDCODE void TestMode::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
 
@@ -38,6 +43,8 @@ void TestMode::Init(float sample_rate)
     startup_env_.Init(sample_rate);
     pitch_env_.Init(sample_rate);
     sample_player_.Init(sample_rate, 11025);
+    sample_player_.SetAdpcmDecoder(&prompt_decoder_);
+    latency_meter_.Init(sample_rate);
 
     osc_left_.SetFrequency(kTestFrequencyLeft);
     osc_left_.SetWaveform(Oscillator::Waveform::SINE);
@@ -64,6 +71,15 @@ void TestMode::Init(float sample_rate)
     // Versions
     version_index_ = 0;
 
+    // The FFT of the tests runs as jobs on the second core
+    scheduler_.Init(tests_);
+    Kastle2::StartSecondCore(MultiCore::JobWorker);
+
+    // Firmware checksum, in the background of the UI loop
+#ifndef KASTLE2_HOST
+    firmware_crc_.Start(reinterpret_cast<const void *>(XIP_BASE), reinterpret_cast<uintptr_t>(&__flash_binary_end) - XIP_BASE);
+#endif
+
     // Wait for a bit
     sleep_ms(200);
 
@@ -123,6 +139,8 @@ void TestMode::SetStage(Stage stage)
         SetLeds(WS2812::RED);
         Kastle2::hw.LatchLeds();
         startup_env_.Trigger();
+        scheduler_.StartRound();
+        round_reported_ = false;
         break;
     case Stage::SUCCESS:
         PrintState();
@@ -131,6 +149,12 @@ void TestMode::SetStage(Stage stage)
         sample_player_.SetSample(version::test_success);
         sample_player_.Play();
         break;
+    case Stage::LATENCY:
+        Kastle2::debug.PrintLine("Measuring the latency, Audio OUT -> Audio IN");
+        latency_meter_.Start();
+        break;
+    default:
+        break;
     }
 }
 
@@ -152,7 +176,7 @@ bool TestMode::NextVersionSample()
     return false;
 }
 
-void TestMode::PrintState()
+COLDCODE void TestMode::PrintState()
 {
     Kastle2::debug.PrintLine("KASTLE2 Test Mode Results:");
     for (size_t i = 0; i < tests_.size(); i++)
@@ -163,6 +187,13 @@ void TestMode::PrintState()
         sprintf(buff, "%s: %s", tests_[i].GetName(), passed ? "OK" : (skipped ? "SKIP" : "FAIL"));
         Kastle2::debug.PrintLine(buff);
     }
+    if (firmware_crc_.IsDone())
+    {
+        char buff[32];
+        sprintf(buff, "FIRMWARE CRC32: %08lx", static_cast<unsigned long>(firmware_crc_.GetResult()));
+        Kastle2::debug.PrintLine(buff);
+    }
+    MemoryMonitor::Print(Kastle2::debug);
     Kastle2::debug.Flush();
 
     // each 1.2s print test results
@@ -206,12 +237,20 @@ void TestMode::AudioLoop(q15_t *input, q15_t *output, size_t size)
         output[2 * i + 1] = out_right;
     }
 
+    // The impulses go over the silence
+    if (stage_ == Stage::LATENCY)
+    {
+        latency_meter_.Process(input, output, size);
+    }
+
     osc_left_.SetFrequency((pitch_env_value_ >> 21) + kTestFrequencyLeft);
     osc_right_.SetFrequency((pitch_env_value_ >> 21) + kTestFrequencyRight);
 }
 
 void TestMode::UiLoop()
 {
+    firmware_crc_.Process();
+
     switch (stage_)
     {
     case Stage::CALIBRATED:
@@ -235,13 +274,16 @@ void TestMode::UiLoop()
     case Stage::SUCCESS:
         StageSuccess();
         break;
+    case Stage::LATENCY:
+        StageLatency();
+        break;
     case Stage::CITADEL_PLAYGROUND:
         StageCitadelPlayground();
         break;
     }
 }
 
-void TestMode::StageIntro()
+COLDCODE void TestMode::StageIntro()
 {
     Kastle2::hw.LatchLeds();
     for (size_t i = 0; i < kTestColors.size(); i++)
@@ -263,39 +305,12 @@ void TestMode::StageIntro()
 
 void TestMode::StageTesting()
 {
-    bool all_tests_passed = true;
-    bool automatic_tests_passed = true;
-    for (size_t i = 0; i < tests_.size(); i++)
+    if (scheduler_.Process() > 0)
     {
-        // Skip tests that are skipped
-        if (tests_[i].IsSkipped())
-        {
-            continue;
-        }
-        bool prev_passed = tests_[i].HasPassed();
-        if (prev_passed)
-        {
-            continue;
-        }
-        tests_[i].Run();
-        if (tests_[i].HasPassed())
-        {
-            if (!prev_passed)
-            {
-                Ding();
-            }
-        }
-        else
-        {
-            all_tests_passed = false;
-            if (!tests_[i].IsManual())
-            {
-                automatic_tests_passed = false;
-            }
-        }
+        Ding();
     }
 
-    uint32_t color = automatic_tests_passed ? WS2812::BLUE : WS2812::RED;
+    uint32_t color = scheduler_.HaveAutomaticPassed() ? WS2812::BLUE : WS2812::RED;
     SetLeds(WS2812::ApplyBrightness(color, 255 - (pitch_env_value_ >> 24)));
 
     if (absolute_time_diff_us(next_time_print_state_, get_absolute_time()) > 0)
@@ -303,21 +318,45 @@ void TestMode::StageTesting()
         PrintState();
     }
 
-    if (all_tests_passed)
+    if (scheduler_.HaveAllPassed())
     {
         startup_env_.SetSustainLevel(0);
         sleep_ms(300);
-        PrintState();
+        scheduler_.PrintSummary();
         SetStage(Stage::SUCCESS);
+        return;
+    }
+
+    // Each automatic test passed or ran out of its time, the failed ones get another try
+    if (scheduler_.IsRoundDone() && !round_reported_)
+    {
+        scheduler_.PrintSummary();
+        round_reported_ = true;
+    }
+    if (round_reported_ && !scheduler_.HaveAutomaticPassed())
+    {
+        scheduler_.StartRound();
+        round_reported_ = false;
     }
 }
 
-void TestMode::StageSuccess()
+COLDCODE void TestMode::StageSuccess()
 {
     SetLeds(WS2812::GREEN);
 
-    // If player ended and we are on Citadel, go to playground
-    if (!sample_player_.IsPlaying() && Kastle2::hw.GetVersion() == Hardware::Version::CITADEL)
+    // If player ended, measure the latency
+    if (!sample_player_.IsPlaying())
+    {
+        SetStage(Stage::LATENCY);
+    }
+}
+
+COLDCODE void TestMode::StageLatency()
+{
+    latency_meter_.Update();
+
+    // When done and we are on Citadel, go to playground
+    if (latency_meter_.IsDone() && Kastle2::hw.GetVersion() == Hardware::Version::CITADEL)
     {
         SetStage(Stage::CITADEL_PLAYGROUND);
     }
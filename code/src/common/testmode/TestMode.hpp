@@ -27,6 +27,7 @@ SOFTWARE.
 #include <cstdint>
 #include <span>
 #include <cstddef>
+#include "common/core/Crc.hpp"
 #include "common/core/Hardware.hpp"
 #include "common/dsp/control/AdsrEnv.hpp"
 #include "common/dsp/control/EnvelopeFollower.hpp"
@@ -34,7 +35,9 @@ SOFTWARE.
 #include "common/dsp/sampling/SamplePlayer.hpp"
 #include "common/dsp/synthesis/Oscillator.hpp"
 #include "common/peripherals/WS2812.hpp"
+#include "common/testmode/LatencyMeter.hpp"
 #include "common/testmode/TestEntry.hpp"
+#include "common/testmode/TestScheduler.hpp"
 
 namespace kastle2
 {
@@ -73,8 +76,17 @@ namespace kastle2
  * - Tri OUT -> ADC MODE
  * - Gate OUT -> ADC FEED 2
  *
- * Each 1 second the test results are printed via USB Serial.
+ * The tests run at once (TestScheduler): the outputs and inputs on core 0, the FFT of the audio
+ * on the second core and the EEPROM and codec checks on the I2C bus. Each automatic test has a time budget,
+ * once they all passed or failed, a summary with the time of each test is printed via USB Serial
+ * and the failed ones are tried again.
+ *
+ * Each 1.2 seconds the test results are printed via USB Serial.
+ * They include the CRC32 of the firmware image (the version chain samples included), computed in the background,
+ * which should match zlib.crc32() of the released .bin file.
  * When all tests pass, the LEDs will turn green and a success sound will play.
+ * Then the round trip latency of the audio is measured (LatencyMeter) and printed via USB Serial,
+ * the Citadel goes on to the playground after it.
  */
 
 class TestMode
@@ -90,6 +102,7 @@ public:
         VERSION,
         TESTING,
         SUCCESS,
+        LATENCY,
         CITADEL_PLAYGROUND
     };
 
@@ -155,9 +168,15 @@ private:
     ///> Sample player for intro/success sounds
     SamplePlayer16bit sample_player_;
 
+    ///> Decoded blocks of the (IMA-ADPCM) voice prompts
+    AdpcmDecoder prompt_decoder_;
+
     ///> The version chain for the intro
     std::span<const SamplePlayer16bit::Sample> version_chain_;
 
+    ///> Checksum of the firmware image, runs during the intro
+    Crc firmware_crc_;
+
     ///> The time for the next print state
     absolute_time_t next_time_print_state_;
 
@@ -204,6 +223,11 @@ private:
      */
     void StageSuccess();
 
+    /**
+     * @brief Latency loop of the test mode, prints the measurements.
+     */
+    void StageLatency();
+
     /**
      * @brief After the success, there is a playground stage for testing switches and input detection (most useful on Citadel)
      */
@@ -226,7 +250,7 @@ private:
     using BTN = Hardware::Button;
 
     ///> The test definitions
-    std::array<TestEntry, 26> tests_ = {
+    std::array<TestEntry, 28> tests_ = {
         TE(TEC::DigitalCombo("PULSE -> TRIG", BOTH, DO::PULSE_OUT, DI::TRIG_IN)),
         TE(TEC::DigitalCombo("PULSE -> RESET", BOTH, DO::PULSE_OUT, DI::RESET_IN)),
         TE(TEC::DigitalCombo("SYNC OUT -> SYNC IN", BOTH, DO::SYNC_OUT, DI::SYNC_IN)),
@@ -244,6 +268,8 @@ private:
         TE(TEC::Fft("AUDIO LEFT", BOTH, TE::Channel::LEFT, kTestVolume, kTestFrequencyLeft)),
         TE(TEC::Fft("AUDIO RIGHT", BOTH, TE::Channel::RIGHT, kTestVolume, kTestFrequencyRight)),
         TE(TEC::MidiIn("MIDI CLK IN", Hardware::Version::CITADEL, midi::Message::Type::CLOCK)),
+        TE(TEC::Eeprom("EEPROM", BOTH)),
+        TE(TEC::Codec("CODEC", BOTH)),
         TE(TEC::Button("BUTTON SHIFT", BOTH, BTN::SHIFT)),
         TE(TEC::Button("BUTTON MODE", BOTH, BTN::MODE)),
         TE(TEC::Pot("POT 1", BOTH, POT::POT_1)),
@@ -254,6 +280,15 @@ private:
         TE(TEC::Pot("POT 6", BOTH, POT::POT_6)),
         TE(TEC::Pot("POT 7", BOTH, POT::POT_7))};
 
+    ///> Runs the tests at once
+    TestScheduler scheduler_;
+
+    ///> Round trip latency of the audio, after the success
+    LatencyMeter latency_meter_;
+
+    ///> The summary of the current round is printed
+    bool round_reported_ = false;
+
     ///> Longest test name (we need that for the printing buffer)
     static constexpr size_t kLongestTestName = 20;
 
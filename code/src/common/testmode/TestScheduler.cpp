@@ -0,0 +1,238 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "TestScheduler.hpp"
+#include <cstdio>
+#include "common/core/Kastle2.hpp"
+#include "common/core/MultiCore.hpp"
+
+using namespace kastle2;
+
+COLDCODE void TestScheduler::Init(std::span<TestEntry> tests)
+{
+    tests_ = tests;
+    output_owners_.fill(nullptr);
+    second_core_busy_ = false;
+    passed_count_ = 0;
+    round_ = 0;
+}
+
+void TestScheduler::StartRound()
+{
+    // The second core might be still on the FFT entries
+    MultiCore::Join();
+    second_core_busy_ = false;
+
+    for (auto &test : tests_)
+    {
+        if (test.HasFailed())
+        {
+            test.Reset();
+        }
+    }
+    passed_count_ = CountPassed();
+    round_++;
+    round_start_us_ = time_us_32();
+    round_end_us_ = 0;
+}
+
+bool TestScheduler::TryStart(TestEntry &test, uint32_t now_us)
+{
+    if (test.GetLane() == TestEntry::Lane::CORE_0)
+    {
+        TestEntry *&owner = output_owners_[test.GetOutput()];
+        if (owner != nullptr && owner != &test)
+        {
+            return false; // Its turn comes later
+        }
+        owner = &test;
+    }
+    test.Start(now_us);
+    return true;
+}
+
+size_t TestScheduler::Process()
+{
+    const uint32_t now_us = time_us_32();
+    if (second_core_busy_ && !MultiCore::IsBusy())
+    {
+        second_core_busy_ = false;
+    }
+
+    bool second_core_work = false;
+    for (auto &test : tests_)
+    {
+        if (test.IsSkipped() || test.IsFinished())
+        {
+            continue;
+        }
+        const TestEntry::Lane lane = test.GetLane();
+        if (lane == TestEntry::Lane::CORE_1 && second_core_busy_)
+        {
+            continue;
+        }
+        if (!test.IsRunning() && !TryStart(test, now_us))
+        {
+            continue;
+        }
+
+        if (lane == TestEntry::Lane::CORE_1)
+        {
+            second_core_work = true;
+        }
+        else
+        {
+            test.Run();
+        }
+        test.CheckBudget(now_us);
+
+        if (test.IsFinished() && lane == TestEntry::Lane::CORE_0)
+        {
+            output_owners_[test.GetOutput()] = nullptr;
+        }
+    }
+
+    if (second_core_work)
+    {
+        // The FFT takes a few milliseconds, core 0 polls the rest meanwhile
+        second_core_busy_ = true;
+        MultiCore::Submit(RunSecondCore, this);
+    }
+
+    if (round_end_us_ == 0 && IsRoundDone())
+    {
+        round_end_us_ = now_us;
+    }
+
+    const size_t passed = CountPassed();
+    const size_t newly_passed = passed - passed_count_;
+    passed_count_ = passed;
+    return newly_passed;
+}
+
+void TestScheduler::RunSecondCore(void *context)
+{
+    TestScheduler *scheduler = static_cast<TestScheduler *>(context);
+    for (auto &test : scheduler->tests_)
+    {
+        if (test.GetLane() == TestEntry::Lane::CORE_1)
+        {
+            test.Run();
+        }
+    }
+}
+
+size_t TestScheduler::CountPassed() const
+{
+    size_t count = 0;
+    for (const auto &test : tests_)
+    {
+        if (test.HasPassed())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+bool TestScheduler::IsRoundDone() const
+{
+    for (const auto &test : tests_)
+    {
+        if (!test.IsSkipped() && !test.IsManual() && !test.IsFinished())
+        {
+            return false;
+        }
+    }
+    return !second_core_busy_;
+}
+
+bool TestScheduler::HaveAllPassed() const
+{
+    for (const auto &test : tests_)
+    {
+        if (!test.IsSkipped() && !test.HasPassed())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestScheduler::HaveAutomaticPassed() const
+{
+    for (const auto &test : tests_)
+    {
+        if (!test.IsSkipped() && !test.IsManual() && !test.HasPassed())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+COLDCODE const char *TestScheduler::GetLaneName(TestEntry::Lane lane)
+{
+    switch (lane)
+    {
+    case TestEntry::Lane::EVENT:
+        return "EVENT";
+    case TestEntry::Lane::CORE_0:
+        return "CORE 0";
+    case TestEntry::Lane::CORE_1:
+        return "CORE 1";
+    case TestEntry::Lane::I2C:
+        return "I2C";
+    }
+    return "";
+}
+
+COLDCODE void TestScheduler::PrintSummary()
+{
+    const uint32_t now_us = time_us_32();
+    size_t passed = 0;
+    size_t failed = 0;
+    size_t waiting = 0;
+    char buff[64];
+    for (const auto &test : tests_)
+    {
+        if (test.IsSkipped())
+        {
+            continue;
+        }
+        const char *status = test.HasPassed() ? "OK" : (test.HasFailed() ? "FAIL" : "WAIT");
+        passed += test.HasPassed();
+        failed += test.HasFailed();
+        waiting += !test.IsFinished();
+        snprintf(buff, sizeof(buff), "%-20s %-4s %-6s %5lu ms", test.GetName(), status, GetLaneName(test.GetLane()),
+                 static_cast<unsigned long>(test.GetDurationMs(now_us)));
+        Kastle2::debug.PrintLine(buff);
+    }
+    const uint32_t end_us = round_end_us_ != 0 ? round_end_us_ : now_us;
+    snprintf(buff, sizeof(buff), "ROUND %lu: %u OK, %u FAIL, %u WAIT, %lu ms", static_cast<unsigned long>(round_),
+             static_cast<unsigned>(passed), static_cast<unsigned>(failed), static_cast<unsigned>(waiting),
+             static_cast<unsigned long>((end_us - round_start_us_) / 1000));
+    Kastle2::debug.PrintLine(buff);
+    Kastle2::debug.Flush();
+}
@@ -0,0 +1,120 @@
+/*
+MIT License
+
+Copyright (c) 2026 Vaclav Mach (Bastl Instruments)
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "common/testmode/TestEntry.hpp"
+
+namespace kastle2
+{
+
+/**
+ * @class TestScheduler
+ * @ingroup testmode
+ * @brief Runs the independent test entries of the Test Mode at once, each within its time budget.
+ * @author Vaclav Mach (Bastl Instruments)
+ * @date 2026-10-14
+ * @details The entries run by their TestEntry::Lane:
+ * - EVENT entries (buttons, pots, jacks, MIDI) are polled on each Process() call.
+ * - CORE_0 entries drive an output and read it back. Entries of different outputs run together,
+ *   the ones sharing an output (eg. CV -> PARAM 2 and CV -> PITCH 1) take turns, the budget starts with the turn.
+ * - CORE_1 entries (FFT) are computed by the second core as a MultiCore job, which runs while core 0 polls the rest.
+ *   The second core must run MultiCore::JobWorker().
+ * - I2C entries queue their transfers on the bus and check them on the next calls.
+ *
+ * A round ends when each automatic entry passed or ran out of its budget, then PrintSummary() reports it
+ * and StartRound() tries the failed entries again (eg. after fixing the patching).
+ * The manual entries (buttons, pots) have no budget, they wait for the user across the rounds.
+ */
+class TestScheduler
+{
+public:
+    /**
+     * @brief Sets the entries to schedule, they have to outlive the scheduler.
+     * @param tests The test entries
+     */
+    void Init(std::span<TestEntry> tests);
+
+    /**
+     * @brief Starts a new round, the failed entries get a new attempt.
+     */
+    void StartRound();
+
+    /**
+     * @brief Runs one step of each running entry and starts the waiting ones. Never waits.
+     * @return Number of entries which passed since the last call
+     */
+    size_t Process();
+
+    /**
+     * @brief Each automatic entry passed or failed.
+     */
+    bool IsRoundDone() const;
+
+    /**
+     * @brief Each entry passed (the skipped ones aside).
+     */
+    bool HaveAllPassed() const;
+
+    /**
+     * @brief Each automatic entry passed (the skipped ones aside).
+     */
+    bool HaveAutomaticPassed() const;
+
+    /**
+     * @brief Prints the result, lane and time of each entry of the round over USB serial.
+     */
+    void PrintSummary();
+
+private:
+    /**
+     * @brief Second core job, runs the CORE_1 entries.
+     */
+    static void RunSecondCore(void *context);
+
+    ///> Starts the entry, the CORE_0 ones only when their output is free
+    bool TryStart(TestEntry &test, uint32_t now_us);
+
+    size_t CountPassed() const;
+
+    static const char *GetLaneName(TestEntry::Lane lane);
+
+    std::span<TestEntry> tests_;
+
+    ///> The CORE_0 entry driving each output, nullptr when free
+    std::array<TestEntry *, TestEntry::kOutputCount> output_owners_ = {};
+
+    ///> The CORE_1 entries belong to the second core until its job is done
+    bool second_core_busy_ = false;
+
+    size_t passed_count_ = 0;
+    uint32_t round_ = 0;
+    uint32_t round_start_us_ = 0;
+    uint32_t round_end_us_ = 0;
+};
+}
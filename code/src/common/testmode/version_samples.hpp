@@ -13,12 +13,15 @@
 
 /*
  * Samples made using TTS Maker (voice 178 - Chloe) and sped up by 1.05x
+ * Stored as IMA-ADPCM (encoded at compile time from the PCM in version_samples.cpp), the lengths are
+ * the PCM ones, the played samples are padded to whole ADPCM blocks.
  */
 
 #pragma once
 
 #include <cstdint>
 #include <cstddef>
+#include "common/dsp/sampling/AdpcmEncoder.hpp"
 #include "common/dsp/sampling/SamplePlayer.hpp"
 
 namespace kastle2
@@ -49,49 +52,49 @@ static constexpr size_t release_candidate_length = 13188;
 static constexpr size_t rc_length = 8467;
 static constexpr size_t calibrated_length = 7308;
 
-extern const int16_t one_data[];
-extern const int16_t eight_data[];
-extern const int16_t five_data[];
-extern const int16_t beta_version_data[];
-extern const int16_t four_data[];
-extern const int16_t nine_data[];
-extern const int16_t version_data[];
-extern const int16_t three_data[];
-extern const int16_t point_data[];
-extern const int16_t seven_data[];
-extern const int16_t kastle2_data[];
-extern const int16_t two_data[];
-extern const int16_t six_data[];
-extern const int16_t zero_data[];
-extern const int16_t ten_data[];
-extern const int16_t test_mode_data[];
-extern const int16_t test_success_data[];
-extern const int16_t citadel_data[];
-extern const int16_t release_candidate_data[];
-extern const int16_t rc_data[];
-extern const int16_t calibrated_data[];
+extern const AdpcmEncoder::Encoded<one_length> one_data;
+extern const AdpcmEncoder::Encoded<eight_length> eight_data;
+extern const AdpcmEncoder::Encoded<five_length> five_data;
+extern const AdpcmEncoder::Encoded<beta_version_length> beta_version_data;
+extern const AdpcmEncoder::Encoded<four_length> four_data;
+extern const AdpcmEncoder::Encoded<nine_length> nine_data;
+extern const AdpcmEncoder::Encoded<version_length> version_data;
+extern const AdpcmEncoder::Encoded<three_length> three_data;
+extern const AdpcmEncoder::Encoded<point_length> point_data;
+extern const AdpcmEncoder::Encoded<seven_length> seven_data;
+extern const AdpcmEncoder::Encoded<kastle2_length> kastle2_data;
+extern const AdpcmEncoder::Encoded<two_length> two_data;
+extern const AdpcmEncoder::Encoded<six_length> six_data;
+extern const AdpcmEncoder::Encoded<zero_length> zero_data;
+extern const AdpcmEncoder::Encoded<ten_length> ten_data;
+extern const AdpcmEncoder::Encoded<test_mode_length> test_mode_data;
+extern const AdpcmEncoder::Encoded<test_success_length> test_success_data;
+extern const AdpcmEncoder::Encoded<citadel_length> citadel_data;
+extern const AdpcmEncoder::Encoded<release_candidate_length> release_candidate_data;
+extern const AdpcmEncoder::Encoded<rc_length> rc_data;
+extern const AdpcmEncoder::Encoded<calibrated_length> calibrated_data;
 
- constexpr SamplePlayer16bit::Sample one = {.data = one_data, .length = one_length};
- constexpr SamplePlayer16bit::Sample eight = {.data = eight_data, .length = eight_length};
- constexpr SamplePlayer16bit::Sample five = {.data = five_data, .length = five_length};
- constexpr SamplePlayer16bit::Sample beta_version = {.data = beta_version_data, .length = beta_version_length};
- constexpr SamplePlayer16bit::Sample four = {.data = four_data, .length = four_length};
- constexpr SamplePlayer16bit::Sample nine = {.data = nine_data, .length = nine_length};
- constexpr SamplePlayer16bit::Sample version = {.data = version_data, .length = version_length};
- constexpr SamplePlayer16bit::Sample three = {.data = three_data, .length = three_length};
- constexpr SamplePlayer16bit::Sample point = {.data = point_data, .length = point_length};
- constexpr SamplePlayer16bit::Sample seven = {.data = seven_data, .length = seven_length};
- constexpr SamplePlayer16bit::Sample kastle2 = {.data = kastle2_data, .length = kastle2_length};
- constexpr SamplePlayer16bit::Sample two = {.data = two_data, .length = two_length};
- constexpr SamplePlayer16bit::Sample six = {.data = six_data, .length = six_length};
- constexpr SamplePlayer16bit::Sample zero = {.data = zero_data, .length = zero_length};
- constexpr SamplePlayer16bit::Sample ten = {.data = ten_data, .length = ten_length};
- constexpr SamplePlayer16bit::Sample test_mode = {.data = test_mode_data, .length = test_mode_length};
- constexpr SamplePlayer16bit::Sample test_success = {.data = test_success_data, .length = test_success_length};
- constexpr SamplePlayer16bit::Sample citadel = {.data = citadel_data, .length = citadel_length};
- constexpr SamplePlayer16bit::Sample release_candidate = {.data = release_candidate_data, .length = release_candidate_length};
- constexpr SamplePlayer16bit::Sample rc = {.data = rc_data, .length = rc_length};
- constexpr SamplePlayer16bit::Sample calibrated = {.data = calibrated_data, .length = calibrated_length};
+ constexpr SamplePlayer16bit::Sample one = {.data = one_data.data(), .length = AdpcmEncoder::PaddedLength(one_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample eight = {.data = eight_data.data(), .length = AdpcmEncoder::PaddedLength(eight_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample five = {.data = five_data.data(), .length = AdpcmEncoder::PaddedLength(five_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample beta_version = {.data = beta_version_data.data(), .length = AdpcmEncoder::PaddedLength(beta_version_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample four = {.data = four_data.data(), .length = AdpcmEncoder::PaddedLength(four_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample nine = {.data = nine_data.data(), .length = AdpcmEncoder::PaddedLength(nine_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample version = {.data = version_data.data(), .length = AdpcmEncoder::PaddedLength(version_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample three = {.data = three_data.data(), .length = AdpcmEncoder::PaddedLength(three_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample point = {.data = point_data.data(), .length = AdpcmEncoder::PaddedLength(point_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample seven = {.data = seven_data.data(), .length = AdpcmEncoder::PaddedLength(seven_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample kastle2 = {.data = kastle2_data.data(), .length = AdpcmEncoder::PaddedLength(kastle2_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample two = {.data = two_data.data(), .length = AdpcmEncoder::PaddedLength(two_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample six = {.data = six_data.data(), .length = AdpcmEncoder::PaddedLength(six_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample zero = {.data = zero_data.data(), .length = AdpcmEncoder::PaddedLength(zero_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample ten = {.data = ten_data.data(), .length = AdpcmEncoder::PaddedLength(ten_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample test_mode = {.data = test_mode_data.data(), .length = AdpcmEncoder::PaddedLength(test_mode_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample test_success = {.data = test_success_data.data(), .length = AdpcmEncoder::PaddedLength(test_success_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample citadel = {.data = citadel_data.data(), .length = AdpcmEncoder::PaddedLength(citadel_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample release_candidate = {.data = release_candidate_data.data(), .length = AdpcmEncoder::PaddedLength(release_candidate_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample rc = {.data = rc_data.data(), .length = AdpcmEncoder::PaddedLength(rc_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
+ constexpr SamplePlayer16bit::Sample calibrated = {.data = calibrated_data.data(), .length = AdpcmEncoder::PaddedLength(calibrated_length), .encoding = SamplePlayer16bit::Encoding::IMA_ADPCM};
  constexpr SamplePlayer16bit::Sample empty = {.data = {}, .length = 0};
 
 }
@@ -74,7 +74,7 @@ inline constexpr int32_t apply_pot_mod(const int32_t val, const int32_t mod)
  */
 inline constexpr int32_t apply_pot_mod_attenuvert(const int32_t val, const int32_t mod)
 {
-    static constexpr int32_t precise_half = (POT_RANGE / 2);
+    constexpr int32_t precise_half = (POT_RANGE / 2);
     const int32_t normalized_mod = mod - precise_half;
     return (val * normalized_mod) / precise_half;
 }
@@ -84,6 +84,12 @@ extern "C"
 #define CFG_TUD_MIDI 1
 #define CFG_TUD_VENDOR 0
 
+// USB audio, enabled per app (USB_AUDIO in create_kastle2_app), see UsbAudio.hpp
+#ifndef KASTLE2_USB_AUDIO
+#define KASTLE2_USB_AUDIO 0
+#endif
+#define CFG_TUD_AUDIO KASTLE2_USB_AUDIO
+
 // CDC FIFO size of TX and RX
 #define CFG_TUD_CDC_RX_BUFSIZE (TUD_OPT_HIGH_SPEED ? 512 : 64)
 #define CFG_TUD_CDC_TX_BUFSIZE (TUD_OPT_HIGH_SPEED ? 512 : 64)
@@ -92,6 +98,48 @@ extern "C"
 #define CFG_TUD_MIDI_RX_BUFSIZE (TUD_OPT_HIGH_SPEED ? 512 : 64)
 #define CFG_TUD_MIDI_TX_BUFSIZE (TUD_OPT_HIGH_SPEED ? 512 : 64)
 
+// USB audio: UAC2, one clock source at SAMPLE_RATE, 16-bit stereo playback (with feedback) and recording
+// KASTLE2_SAMPLE_RATE comes from the build like in config.hpp
+#ifndef KASTLE2_SAMPLE_RATE
+#define KASTLE2_SAMPLE_RATE 44000
+#endif
+#define USB_AUDIO_SAMPLE_RATE KASTLE2_SAMPLE_RATE
+#define USB_AUDIO_ITF_CONTROL 4  // after the CDC and MIDI interfaces
+#define USB_AUDIO_ITF_PLAYBACK 5 // host -> Kastle input
+#define USB_AUDIO_ITF_RECORD 6   // Kastle output -> host
+#define USB_AUDIO_ENTITY_CLOCK 0x01
+#define USB_AUDIO_ENTITY_PLAYBACK_IT 0x02
+#define USB_AUDIO_ENTITY_PLAYBACK_OT 0x03
+#define USB_AUDIO_ENTITY_RECORD_IT 0x04
+#define USB_AUDIO_ENTITY_RECORD_OT 0x05
+
+// Length of the class specific AC descriptors (the clock and the terminals)
+#define USB_AUDIO_AC_DESC_LEN (TUD_AUDIO_DESC_CLK_SRC_LEN + 2 * TUD_AUDIO_DESC_INPUT_TERM_LEN + 2 * TUD_AUDIO_DESC_OUTPUT_TERM_LEN)
+// Length of the whole audio function (usb_descriptors.c)
+#define USB_AUDIO_DESC_LEN (TUD_AUDIO_DESC_IAD_LEN + TUD_AUDIO_DESC_STD_AC_LEN + TUD_AUDIO_DESC_CS_AC_LEN + USB_AUDIO_AC_DESC_LEN + \
+                            2 * (2 * TUD_AUDIO_DESC_STD_AS_INT_LEN + TUD_AUDIO_DESC_CS_AS_INT_LEN + TUD_AUDIO_DESC_TYPE_I_FORMAT_LEN + \
+                                 TUD_AUDIO_DESC_STD_AS_ISO_EP_LEN + TUD_AUDIO_DESC_CS_AS_ISO_EP_LEN) +                            \
+                            TUD_AUDIO_DESC_STD_AS_ISO_FB_EP_LEN)
+
+#define CFG_TUD_AUDIO_FUNC_1_DESC_LEN USB_AUDIO_DESC_LEN
+#define CFG_TUD_AUDIO_FUNC_1_N_AS_INT 2
+#define CFG_TUD_AUDIO_FUNC_1_CTRL_BUF_SZ 64
+
+// Recording (EP IN), one frame more than the nominal SAMPLE_RATE / 1000 per ms for the drift
+#define CFG_TUD_AUDIO_ENABLE_EP_IN 1
+#define CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX 2
+#define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_TX 2
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX TUD_AUDIO_EP_SIZE(USB_AUDIO_SAMPLE_RATE, 2, 2)
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ (4 * CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX)
+
+// Playback (EP OUT) with the feedback endpoint
+#define CFG_TUD_AUDIO_ENABLE_EP_OUT 1
+#define CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX 2
+#define CFG_TUD_AUDIO_FUNC_1_N_CHANNELS_RX 2
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX TUD_AUDIO_EP_SIZE(USB_AUDIO_SAMPLE_RATE, 2, 2)
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ (4 * CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX)
+#define CFG_TUD_AUDIO_ENABLE_FEEDBACK_EP 1
+
 #ifdef __cplusplus
 }
 #endif
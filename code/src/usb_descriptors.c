@@ -71,10 +71,23 @@ enum
     ITF_NUM_CDC_DATA,
     ITF_NUM_MIDI,
     ITF_NUM_MIDI_STREAMING,
+#if KASTLE2_USB_AUDIO
+    ITF_NUM_AUDIO_CONTROL,
+    ITF_NUM_AUDIO_PLAYBACK,
+    ITF_NUM_AUDIO_RECORD,
+#endif
     ITF_NUM_TOTAL
 };
 
+#if KASTLE2_USB_AUDIO
+TU_VERIFY_STATIC(ITF_NUM_AUDIO_CONTROL == USB_AUDIO_ITF_CONTROL &&
+                     ITF_NUM_AUDIO_PLAYBACK == USB_AUDIO_ITF_PLAYBACK &&
+                     ITF_NUM_AUDIO_RECORD == USB_AUDIO_ITF_RECORD,
+                 "USB audio interface numbers in tusb_config.h don't match");
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + TUD_MIDI_DESC_LEN + USB_AUDIO_DESC_LEN)
+#else
 #define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + TUD_MIDI_DESC_LEN)
+#endif
 
 #if CFG_TUSB_MCU == OPT_MCU_LPC175X_6X || CFG_TUSB_MCU == OPT_MCU_LPC177X_8X || CFG_TUSB_MCU == OPT_MCU_LPC40XX
 // LPC 17xx and 40xx endpoint type (bulk/interrupt/iso) are fixed by its number
@@ -89,6 +102,47 @@ enum
 #define EPNUM_CDC_IN 0x03
 #define EPNUM_MIDI 0x04
 #endif
+#define EPNUM_AUDIO_PLAYBACK 0x05 // OUT, and its feedback IN
+#define EPNUM_AUDIO_RECORD 0x06
+
+// USB audio function: clock -> (USB streaming -> Kastle input) and (Kastle output -> USB streaming)
+// Interface number, string index, playback EP OUT, feedback EP IN and recording EP IN addresses
+#define USB_AUDIO_DESCRIPTOR(_itfnum, _stridx, _epout, _epfb, _epin)                                                                              \
+    TUD_AUDIO_DESC_IAD(_itfnum, 0x03, 0x00),                                                                                                      \
+    TUD_AUDIO_DESC_STD_AC(_itfnum, 0x00, _stridx),                                                                                                \
+    TUD_AUDIO_DESC_CS_AC(0x0200, AUDIO_FUNC_IO_BOX, USB_AUDIO_AC_DESC_LEN, 0x00),                                                                 \
+    TUD_AUDIO_DESC_CLK_SRC(USB_AUDIO_ENTITY_CLOCK, AUDIO_CLOCK_SOURCE_ATT_INT_FIX_CLK,                                                            \
+                           (AUDIO_CTRL_R << AUDIO_CLOCK_SOURCE_CTRL_CLK_FRQ_POS) | (AUDIO_CTRL_R << AUDIO_CLOCK_SOURCE_CTRL_CLK_VAL_POS),           \
+                           0x00, 0x00),                                                                                                           \
+    TUD_AUDIO_DESC_INPUT_TERM(USB_AUDIO_ENTITY_PLAYBACK_IT, AUDIO_TERM_TYPE_USB_STREAMING, 0x00, USB_AUDIO_ENTITY_CLOCK, 0x02,                     \
+                              AUDIO_CHANNEL_CONFIG_NON_PREDEFINED, 0x00, 0x0000, 0x00),                                                           \
+    TUD_AUDIO_DESC_OUTPUT_TERM(USB_AUDIO_ENTITY_PLAYBACK_OT, AUDIO_TERM_TYPE_OUT_GENERIC_SPEAKER, 0x00, USB_AUDIO_ENTITY_PLAYBACK_IT,              \
+                               USB_AUDIO_ENTITY_CLOCK, 0x0000, 0x00),                                                                             \
+    TUD_AUDIO_DESC_INPUT_TERM(USB_AUDIO_ENTITY_RECORD_IT, AUDIO_TERM_TYPE_IN_GENERIC_MIC, 0x00, USB_AUDIO_ENTITY_CLOCK, 0x02,                      \
+                              AUDIO_CHANNEL_CONFIG_NON_PREDEFINED, 0x00, 0x0000, 0x00),                                                           \
+    TUD_AUDIO_DESC_OUTPUT_TERM(USB_AUDIO_ENTITY_RECORD_OT, AUDIO_TERM_TYPE_USB_STREAMING, 0x00, USB_AUDIO_ENTITY_RECORD_IT,                        \
+                               USB_AUDIO_ENTITY_CLOCK, 0x0000, 0x00),                                                                             \
+    /* Playback: alternate 0 without endpoints, alternate 1 streaming */                                                                         \
+    TUD_AUDIO_DESC_STD_AS_INT((uint8_t)((_itfnum) + 1), 0x00, 0x00, 0x00),                                                                       \
+    TUD_AUDIO_DESC_STD_AS_INT((uint8_t)((_itfnum) + 1), 0x01, 0x02, 0x00),                                                                       \
+    TUD_AUDIO_DESC_CS_AS_INT(USB_AUDIO_ENTITY_PLAYBACK_IT, AUDIO_CTRL_NONE, AUDIO_FORMAT_TYPE_I, AUDIO_DATA_FORMAT_TYPE_I_PCM, 0x02,              \
+                             AUDIO_CHANNEL_CONFIG_NON_PREDEFINED, 0x00),                                                                          \
+    TUD_AUDIO_DESC_TYPE_I_FORMAT(CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_RX, 16),                                                                 \
+    TUD_AUDIO_DESC_STD_AS_ISO_EP(_epout, (uint8_t)(TUSB_XFER_ISOCHRONOUS | TUSB_ISO_EP_ATT_ASYNCHRONOUS | TUSB_ISO_EP_ATT_DATA),                  \
+                                 CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX, 0x01),                                                                       \
+    TUD_AUDIO_DESC_CS_AS_ISO_EP(AUDIO_CS_AS_ISO_DATA_EP_ATT_NON_MAX_PACKETS_OK, AUDIO_CTRL_NONE, AUDIO_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, \
+                                0x0000),                                                                                                          \
+    TUD_AUDIO_DESC_STD_AS_ISO_FB_EP(_epfb, 4, 0x01),                                                                                              \
+    /* Recording: alternate 0 without endpoints, alternate 1 streaming */                                                                        \
+    TUD_AUDIO_DESC_STD_AS_INT((uint8_t)((_itfnum) + 2), 0x00, 0x00, 0x00),                                                                       \
+    TUD_AUDIO_DESC_STD_AS_INT((uint8_t)((_itfnum) + 2), 0x01, 0x01, 0x00),                                                                       \
+    TUD_AUDIO_DESC_CS_AS_INT(USB_AUDIO_ENTITY_RECORD_OT, AUDIO_CTRL_NONE, AUDIO_FORMAT_TYPE_I, AUDIO_DATA_FORMAT_TYPE_I_PCM, 0x02,                \
+                             AUDIO_CHANNEL_CONFIG_NON_PREDEFINED, 0x00),                                                                          \
+    TUD_AUDIO_DESC_TYPE_I_FORMAT(CFG_TUD_AUDIO_FUNC_1_N_BYTES_PER_SAMPLE_TX, 16),                                                                 \
+    TUD_AUDIO_DESC_STD_AS_ISO_EP(_epin, (uint8_t)(TUSB_XFER_ISOCHRONOUS | TUSB_ISO_EP_ATT_ASYNCHRONOUS | TUSB_ISO_EP_ATT_DATA),                   \
+                                 CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX, 0x01),                                                                        \
+    TUD_AUDIO_DESC_CS_AS_ISO_EP(AUDIO_CS_AS_ISO_DATA_EP_ATT_NON_MAX_PACKETS_OK, AUDIO_CTRL_NONE, AUDIO_CS_AS_ISO_DATA_EP_LOCK_DELAY_UNIT_UNDEFINED, \
+                                0x0000)
 
 uint8_t const desc_fs_configuration[] = {
     // Config number, interface count, string index, total length, attribute, power in mA
@@ -98,7 +152,13 @@ uint8_t const desc_fs_configuration[] = {
     TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, 0x80 | EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, 0x80 | EPNUM_CDC_IN, 64),
 
     // Interface number, string index, EP Out & EP In address, EP size
-    TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 5, EPNUM_MIDI, 0x80 | EPNUM_MIDI, 64)};
+    TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 5, EPNUM_MIDI, 0x80 | EPNUM_MIDI, 64),
+
+#if KASTLE2_USB_AUDIO
+    // Interface number, string index, playback EP OUT, feedback EP IN, recording EP IN
+    USB_AUDIO_DESCRIPTOR(ITF_NUM_AUDIO_CONTROL, 6, EPNUM_AUDIO_PLAYBACK, 0x80 | EPNUM_AUDIO_PLAYBACK, 0x80 | EPNUM_AUDIO_RECORD),
+#endif
+};
 
 #if TUD_OPT_HIGH_SPEED
 uint8_t const desc_hs_configuration[] =
@@ -110,7 +170,13 @@ uint8_t const desc_hs_configuration[] =
         TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, 0x80 | EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, 0x80 | EPNUM_CDC_IN, 512),
 
         // Interface number, string index, EP Out & EP In address, EP size
-        TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 5, EPNUM_MIDI, 0x80 | EPNUM_MIDI, 512)};
+        TUD_MIDI_DESCRIPTOR(ITF_NUM_MIDI, 5, EPNUM_MIDI, 0x80 | EPNUM_MIDI, 512),
+
+#if KASTLE2_USB_AUDIO
+        // Interface number, string index, playback EP OUT, feedback EP IN, recording EP IN
+        USB_AUDIO_DESCRIPTOR(ITF_NUM_AUDIO_CONTROL, 6, EPNUM_AUDIO_PLAYBACK, 0x80 | EPNUM_AUDIO_PLAYBACK, 0x80 | EPNUM_AUDIO_RECORD),
+#endif
+};
 #endif
 
 // Invoked when received GET CONFIGURATION DESCRIPTOR
@@ -148,6 +214,7 @@ char const *string_desc_arr[] = {
 #else
     "Kastle 2",                // 5: MIDI Interface
 #endif
+    "Kastle 2 Audio",          // 6: Audio Interface
 };
 
 static uint16_t _desc_str[32];